@@ -27,6 +27,28 @@ typedef struct
     int count;
 } cblock_t;
 
+// The cinematic file is streamed through a ring buffer. It is filled in
+// big sequential reads, topped up on the frames where nothing has to be
+// decoded, so a disc seek no longer lands in the middle of a frame.
+enum
+{
+    CIN_STREAM_SIZE = 0x80000, // 512KB, a couple of seconds of video
+    CIN_READ_CHUNK = 0x10000,  // 64KB per read
+    CIN_PREFILL_CHUNKS = 4,    // read before the first frame
+    CIN_HEADER_SIZE = 5 * 4 + 256 * 256 // dimensions, sound format, huffman counts
+};
+
+// Huffman codes up to HUFF_LOOKUP_BITS long are decoded with a single
+// table lookup. Each entry holds the symbol and its code length, or for
+// longer codes the tree node reached after HUFF_LOOKUP_BITS bits.
+enum
+{
+    HUFF_LOOKUP_BITS = 9,
+    HUFF_LOOKUP_SIZE = 1 << HUFF_LOOKUP_BITS,
+    HUFF_NODE_MASK = 0x1ff, // low 9 bits: node number
+    HUFF_LEN_SHIFT = 12     // high 4 bits: bits consumed
+};
+
 typedef struct
 {
     qboolean restart_sound;
@@ -42,9 +64,19 @@ typedef struct
     // order 1 huffman stuff
     int * hnodes1; // [256][256][2];
     int numhnodes1[256];
+    unsigned short * hlookup1; // [256][HUFF_LOOKUP_SIZE]
 
     int h_used[512];
     int h_count[512];
+
+    // read-ahead ring buffer, head and tail are total bytes in/out
+    byte * stream;
+    int stream_head;
+    int stream_tail;
+    int file_remaining;
+
+    qboolean no_sound;       // set while benchmarking
+    qboolean huff_reference; // decode with the bit by bit tree walk
 } cinematics_t;
 
 static cinematics_t cin;
@@ -173,6 +205,16 @@ void SCR_StopCinematic(void)
         Z_Free(cin.hnodes1);
         cin.hnodes1 = NULL;
     }
+    if (cin.hlookup1)
+    {
+        Z_Free(cin.hlookup1);
+        cin.hlookup1 = NULL;
+    }
+    if (cin.stream)
+    {
+        Z_Free(cin.stream);
+        cin.stream = NULL;
+    }
 
     // switch back down to 11 khz sound if necessary
     if (cin.restart_sound)
@@ -236,6 +278,46 @@ int SmallestNode1(int numhnodes)
     return bestnode;
 }
 
+/*
+==================
+Huff1LookupInit
+
+Builds the lookup tables for Huff1Decompress from the node trees. The
+bits of an index are the next bits of the stream, first one lowest.
+A context whose root is already a leaf emits that symbol with a zero
+length code, as the tree walk does.
+==================
+*/
+static void Huff1LookupInit(void)
+{
+    int prev, bits, len;
+    int node;
+    const int * hnodesbase = cin.hnodes1 - 256 * 2; // nodes 0-255 aren't stored
+    const int * hnodes;
+    unsigned short * lookup;
+
+    if (!cin.hlookup1)
+    {
+        cin.hlookup1 = Z_Malloc(256 * HUFF_LOOKUP_SIZE * sizeof(unsigned short));
+    }
+
+    for (prev = 0; prev < 256; prev++)
+    {
+        hnodes = hnodesbase + (prev << 9);
+        lookup = cin.hlookup1 + prev * HUFF_LOOKUP_SIZE;
+
+        for (bits = 0; bits < HUFF_LOOKUP_SIZE; bits++)
+        {
+            node = cin.numhnodes1[prev];
+            for (len = 0; node >= 256 && len < HUFF_LOOKUP_BITS; len++)
+            {
+                node = hnodes[node * 2 + ((bits >> len) & 1)];
+            }
+            lookup[bits] = node | (len << HUFF_LEN_SHIFT);
+        }
+    }
+}
+
 /*
 ==================
 Huff1TableInit
@@ -293,14 +375,19 @@ void Huff1TableInit(void)
 
         cin.numhnodes1[prev] = numhnodes - 1;
     }
+
+    Huff1LookupInit();
 }
 
 /*
 ==================
-Huff1Decompress
+Huff1DecompressReference
+
+The original decoder, walking the tree one bit at a time.
+Kept to check Huff1Decompress against.
 ==================
 */
-cblock_t Huff1Decompress(cblock_t in)
+cblock_t Huff1DecompressReference(cblock_t in)
 {
     byte * input;
     byte * out_p;
@@ -423,6 +510,217 @@ cblock_t Huff1Decompress(cblock_t in)
     return out;
 }
 
+/*
+==================
+Huff1Decompress
+
+Decodes HUFF_LOOKUP_BITS bits at a time through cin.hlookup1 and only
+walks the tree for the rare longer codes. Produces the same output as
+Huff1DecompressReference.
+==================
+*/
+cblock_t Huff1Decompress(cblock_t in)
+{
+    const byte * input;
+    const byte * input_end;
+    const int * hnodesbase;
+    byte * out_p;
+    cblock_t out;
+    unsigned bitbuf;
+    int bitcount;
+    int count;
+    int prev, entry, node, len;
+
+    // get decompressed count
+    count = in.data[0] + (in.data[1] << 8) + (in.data[2] << 16) + (in.data[3] << 24);
+    input = in.data + 4;
+    input_end = in.data + in.count;
+    out_p = out.data = Z_Malloc(count);
+
+    hnodesbase = cin.hnodes1 - 256 * 2; // nodes 0-255 aren't stored
+
+    bitbuf = 0;
+    bitcount = 0;
+    prev = 0;
+
+    while (count)
+    {
+        // keep at least 25 bits buffered, zeros past the end
+        while (bitcount <= 24)
+        {
+            if (input < input_end)
+            {
+                bitbuf |= (unsigned)*input << bitcount;
+            }
+            input++;
+            bitcount += 8;
+        }
+
+        entry = cin.hlookup1[(prev << HUFF_LOOKUP_BITS) + (bitbuf & (HUFF_LOOKUP_SIZE - 1))];
+        node = entry & HUFF_NODE_MASK;
+        len = entry >> HUFF_LEN_SHIFT;
+        bitbuf >>= len;
+        bitcount -= len;
+
+        // long code, finish it off a bit at a time
+        while (node >= 256)
+        {
+            if (!bitcount)
+            {
+                if (input < input_end)
+                {
+                    bitbuf = *input;
+                }
+                input++;
+                bitcount = 8;
+            }
+            node = hnodesbase[(prev << 9) + node * 2 + (bitbuf & 1)];
+            bitbuf >>= 1;
+            bitcount--;
+        }
+
+        *out_p++ = node;
+        prev = node;
+        count--;
+    }
+
+    out.count = out_p - out.data;
+
+    return out;
+}
+
+/*
+==================
+SCR_StreamFill
+
+Reads up to max bytes of the cinematic into the ring buffer.
+Returns the number of bytes read, 0 at the end of the file.
+==================
+*/
+static int SCR_StreamFill(int max)
+{
+    int offset, len, r;
+
+    len = CIN_STREAM_SIZE - (cin.stream_head - cin.stream_tail);
+    offset = cin.stream_head & (CIN_STREAM_SIZE - 1);
+
+    // one contiguous piece at a time
+    if (len > CIN_STREAM_SIZE - offset)
+    {
+        len = CIN_STREAM_SIZE - offset;
+    }
+    if (len > max)
+    {
+        len = max;
+    }
+    if (len > cin.file_remaining)
+    {
+        len = cin.file_remaining;
+    }
+    if (len <= 0)
+    {
+        return 0;
+    }
+
+    r = fread(cin.stream + offset, 1, len, cl.cinematic_file);
+    if (r <= 0)
+    {
+        cin.file_remaining = 0;
+        return 0;
+    }
+
+    cin.stream_head += r;
+    cin.file_remaining -= r;
+    return r;
+}
+
+/*
+==================
+SCR_StreamRead
+
+Copies len bytes out of the ring buffer, reading
+more from the file first if it is running low.
+==================
+*/
+static qboolean SCR_StreamRead(void * buffer, int len)
+{
+    byte * out = (byte *)buffer;
+    int offset, n;
+
+    while (cin.stream_head - cin.stream_tail < len)
+    {
+        if (!SCR_StreamFill(CIN_READ_CHUNK))
+        {
+            return false;
+        }
+    }
+
+    while (len > 0)
+    {
+        offset = cin.stream_tail & (CIN_STREAM_SIZE - 1);
+        n = CIN_STREAM_SIZE - offset;
+        if (n > len)
+        {
+            n = len;
+        }
+
+        memcpy(out, cin.stream + offset, n);
+        cin.stream_tail += n;
+        out += n;
+        len -= n;
+    }
+
+    return true;
+}
+
+/*
+==================
+SCR_BeginCinematicStream
+
+Reads the cinematic header and huffman tables from cl.cinematic_file,
+which must be at the start of a file_len bytes long cinematic, then
+starts streaming the frames.
+==================
+*/
+static void SCR_BeginCinematicStream(int file_len)
+{
+    int width = 0;
+    int height = 0;
+    int i;
+
+    FS_Read(&width, 4, cl.cinematic_file);
+    FS_Read(&height, 4, cl.cinematic_file);
+    cin.width = LittleLong(width);
+    cin.height = LittleLong(height);
+
+    FS_Read(&cin.s_rate, 4, cl.cinematic_file);
+    cin.s_rate = LittleLong(cin.s_rate);
+
+    FS_Read(&cin.s_width, 4, cl.cinematic_file);
+    cin.s_width = LittleLong(cin.s_width);
+
+    FS_Read(&cin.s_channels, 4, cl.cinematic_file);
+    cin.s_channels = LittleLong(cin.s_channels);
+
+    Huff1TableInit();
+
+    if (!cin.stream)
+    {
+        cin.stream = Z_Malloc(CIN_STREAM_SIZE);
+    }
+    cin.stream_head = 0;
+    cin.stream_tail = 0;
+    cin.file_remaining = file_len - CIN_HEADER_SIZE;
+
+    for (i = 0; i < CIN_PREFILL_CHUNKS; i++)
+    {
+        if (!SCR_StreamFill(CIN_READ_CHUNK))
+        {
+            break;
+        }
+    }
+}
+
 /*
 ==================
 SCR_ReadNextFrame
@@ -437,29 +735,16 @@ byte * SCR_ReadNextFrame(void)
     static byte samples[22050 / 14 * 4] PS2_ALIGN(16); // 6.2KB
     static byte compressed[0x20000] PS2_ALIGN(16);     // 128KB
 
-    int r;
     int command;
     int size;
     byte * pic;
     cblock_t in, huf1;
     int start, end, count;
 
-    if (feof(cl.cinematic_file))
-    {
-        Com_DPrintf("Cinematic at the end of file!\n");
-        return NULL;
-    }
-
     // read the next frame
-    r = fread(&command, 4, 1, cl.cinematic_file);
-    if (r == 0) // we'll give it one more chance
-    {
-        r = fread(&command, 4, 1, cl.cinematic_file);
-    }
-
-    if (r != 1)
+    if (!SCR_StreamRead(&command, 4))
     {
-        Com_DPrintf("Failed to fread() cinematic frame!\n");
+        Com_DPrintf("Cinematic at the end of file!\n");
         return NULL;
     }
 
@@ -473,13 +758,19 @@ byte * SCR_ReadNextFrame(void)
     if (command == 1)
     {
         // read palette
-        FS_Read(cl.cinematicpalette, sizeof(cl.cinematicpalette), cl.cinematic_file);
+        if (!SCR_StreamRead(cl.cinematicpalette, sizeof(cl.cinematicpalette)))
+        {
+            return NULL;
+        }
         cl.cinematicpalette_active = 0; // dubious....  exposes an edge case
     }
 
     // decompress the next frame
     size = 0;
-    FS_Read(&size, 4, cl.cinematic_file);
+    if (!SCR_StreamRead(&size, 4))
+    {
+        return NULL;
+    }
     size = LittleLong(size);
 
     if (size > sizeof(compressed) || size < 1)
@@ -488,21 +779,38 @@ byte * SCR_ReadNextFrame(void)
         return NULL;
     }
 
-    FS_Read(compressed, size, cl.cinematic_file);
+    if (!SCR_StreamRead(compressed, size))
+    {
+        Com_DPrintf("Cinematic error: Truncated frame!\n");
+        return NULL;
+    }
 
     // read sound
     start = cl.cinematicframe * cin.s_rate / 14;
     end = (cl.cinematicframe + 1) * cin.s_rate / 14;
     count = end - start;
 
-    FS_Read(samples, count * cin.s_width * cin.s_channels, cl.cinematic_file);
+    if (!SCR_StreamRead(samples, count * cin.s_width * cin.s_channels))
+    {
+        return NULL;
+    }
 
-    S_RawSamples(count, cin.s_rate, cin.s_width, cin.s_channels, samples);
+    if (!cin.no_sound)
+    {
+        S_RawSamples(count, cin.s_rate, cin.s_width, cin.s_channels, samples);
+    }
 
     in.data = compressed;
     in.count = size;
 
-    huf1 = Huff1Decompress(in);
+    if (cin.huff_reference)
+    {
+        huf1 = Huff1DecompressReference(in);
+    }
+    else
+    {
+        huf1 = Huff1Decompress(in);
+    }
 
     pic = huf1.data;
 
@@ -543,6 +851,8 @@ void SCR_RunCinematic(void)
     frame = (cls.realtime - cl.cinematictime) * 14.0 / 1000;
     if (frame <= cl.cinematicframe)
     {
+        // nothing to decode this time, read ahead instead
+        SCR_StreamFill(CIN_READ_CHUNK);
         return;
     }
 
@@ -616,7 +926,7 @@ SCR_PlayCinematic
 */
 void SCR_PlayCinematic(const char * arg)
 {
-    int width, height;
+    int len;
     byte * palette;
     char name[MAX_OSPATH];
     const char * dot;
@@ -652,7 +962,7 @@ void SCR_PlayCinematic(const char * arg)
     }
 
     Com_sprintf(name, sizeof(name), "video/%s", arg);
-    FS_FOpenFile(name, &cl.cinematic_file);
+    len = FS_FOpenFile(name, &cl.cinematic_file);
     if (!cl.cinematic_file)
     {
         Com_DPrintf("Cinematic %s not found!\n", name);
@@ -664,19 +974,7 @@ void SCR_PlayCinematic(const char * arg)
     SCR_EndLoadingPlaque();
     cls.state = ca_active;
 
-    FS_Read(&width, 4, cl.cinematic_file);
-    FS_Read(&height, 4, cl.cinematic_file);
-    cin.width = LittleLong(width);
-    cin.height = LittleLong(height);
-
-    FS_Read(&cin.s_rate, 4, cl.cinematic_file);
-    cin.s_rate = LittleLong(cin.s_rate);
-    FS_Read(&cin.s_width, 4, cl.cinematic_file);
-    cin.s_width = LittleLong(cin.s_width);
-    FS_Read(&cin.s_channels, 4, cl.cinematic_file);
-    cin.s_channels = LittleLong(cin.s_channels);
-
-    Huff1TableInit();
+    SCR_BeginCinematicStream(len);
 
     // switch up to 22 khz sound if necessary
     old_khz = Cvar_VariableValue("s_khz");
@@ -705,8 +1003,7 @@ This is used for testing in the PS2 port.
 static char last_test_cinematic[MAX_QPATH];
 qboolean CinematicTest_PlayDirect(const char * filename)
 {
-    int width = 0;
-    int height = 0;
+    int len = 0;
     int old_khz = 0;
 
     Com_DPrintf("Trying to play cinematic '%s' ...\n", filename);
@@ -721,21 +1018,11 @@ qboolean CinematicTest_PlayDirect(const char * filename)
         return false;
     }
 
-    FS_Read(&width, 4, cl.cinematic_file);
-    FS_Read(&height, 4, cl.cinematic_file);
-    cin.width = LittleLong(width);
-    cin.height = LittleLong(height);
-
-    FS_Read(&cin.s_rate, 4, cl.cinematic_file);
-    cin.s_rate = LittleLong(cin.s_rate);
-
-    FS_Read(&cin.s_width, 4, cl.cinematic_file);
-    cin.s_width = LittleLong(cin.s_width);
+    fseek(cl.cinematic_file, 0, SEEK_END);
+    len = ftell(cl.cinematic_file);
+    fseek(cl.cinematic_file, 0, SEEK_SET);
 
-    FS_Read(&cin.s_channels, 4, cl.cinematic_file);
-    cin.s_channels = LittleLong(cin.s_channels);
-
-    Huff1TableInit();
+    SCR_BeginCinematicStream(len);
 
     // switch up to 22 khz sound if necessary
     old_khz = Cvar_VariableValue("s_khz");
@@ -802,3 +1089,105 @@ qboolean CinematicTest_RunFrame(void)
 
     return true;
 }
+
+/*
+==================
+SCR_CinematicBench_f
+
+Decodes every frame of a cinematic as fast as possible, without
+sound or drawing, once with the lookup table Huffman decoder and
+once with the reference one. Reports the average and worst frame
+times of each and checks that both produced the same pictures.
+==================
+*/
+static qboolean SCR_CinematicBenchPass(const char * name, qboolean reference, unsigned * checksum)
+{
+    byte * pic;
+    int len, frames;
+    int start, frame_start, frame_time, worst;
+
+    len = FS_FOpenFile(name, &cl.cinematic_file);
+    if (!cl.cinematic_file)
+    {
+        Com_Printf("%s not found.\n", name);
+        return false;
+    }
+
+    start = Sys_Milliseconds();
+    SCR_BeginCinematicStream(len);
+    Com_Printf("%s: %ix%i, header and tables %i ms\n", name, cin.width, cin.height, Sys_Milliseconds() - start);
+
+    cin.no_sound = true;
+    cin.huff_reference = reference;
+    cl.cinematicframe = 0;
+    frames = 0;
+    worst = 0;
+    *checksum = 0;
+    start = Sys_Milliseconds();
+
+    for (;;)
+    {
+        frame_start = Sys_Milliseconds();
+        pic = SCR_ReadNextFrame();
+        if (!pic)
+        {
+            break;
+        }
+
+        frame_time = Sys_Milliseconds() - frame_start;
+        if (frame_time > worst)
+        {
+            worst = frame_time;
+        }
+
+        *checksum = (*checksum << 1 | *checksum >> 31) ^ Com_BlockChecksum(pic, cin.width * cin.height);
+        Z_Free(pic);
+        frames++;
+    }
+
+    frame_time = Sys_Milliseconds() - start;
+    Com_Printf("%s: %i frames in %i ms, avg %.2f ms, worst %i ms (budget %i ms)\n",
+               reference ? "reference" : "lookup   ", frames, frame_time,
+               frames ? (float)frame_time / frames : 0.0f, worst, 1000 / 14);
+
+    cin.no_sound = false;
+    cin.huff_reference = false;
+    cl.cinematicframe = 0;
+    SCR_StopCinematic();
+    return true;
+}
+
+void SCR_CinematicBench_f(void)
+{
+    char name[MAX_OSPATH];
+    unsigned sum_lookup, sum_reference;
+
+    if (Cmd_Argc() != 2)
+    {
+        Com_Printf("usage: cin_bench <file.cin>\n");
+        return;
+    }
+
+    if (cl.cinematictime > 0 || cl.cinematic_file)
+    {
+        Com_Printf("A cinematic is already playing.\n");
+        return;
+    }
+
+    Com_sprintf(name, sizeof(name), "video/%s", Cmd_Argv(1));
+
+    if (!SCR_CinematicBenchPass(name, false, &sum_lookup) ||
+        !SCR_CinematicBenchPass(name, true, &sum_reference))
+    {
+        return;
+    }
+
+    if (sum_lookup == sum_reference)
+    {
+        Com_Printf("checksums match (%08x)\n", sum_lookup);
+    }
+    else
+    {
+        Com_Printf("WARNING: checksums differ, lookup %08x, reference %08x\n", sum_lookup, sum_reference);
+    }
+}
@@ -1723,6 +1723,44 @@ void CL_SendCommand(void)
     CL_CheckForResend();
 }
 
+// Real time accumulated since the last client frame ran.
+static int extratime = 0;
+
+/*
+==================
+CL_IdleMsec
+
+Milliseconds until CL_Frame will run a frame again,
+mirroring the flood protection and framerate limiter.
+==================
+*/
+int CL_IdleMsec(void)
+{
+    float idle;
+
+    if (dedicated->value)
+    {
+        return 100;
+    }
+
+    if (cl_timedemo->value || cl_maxfps->value <= 0)
+    {
+        return 0;
+    }
+
+    idle = 1000 / cl_maxfps->value - extratime;
+    if (cls.state == ca_connected && 100 - extratime > idle)
+    {
+        idle = 100 - extratime;
+    }
+
+    if (idle <= 0)
+    {
+        return 0;
+    }
+    return (int)ceil(idle);
+}
+
 /*
 ==================
 CL_Frame
@@ -1731,7 +1769,6 @@ CL_Frame
 */
 void CL_Frame(int msec)
 {
-    static int extratime = 0;
     static int lasttimecalled;
 
     if (dedicated->value)
@@ -426,6 +426,7 @@ void SCR_Init(void)
     Cmd_AddCommand("sizeup", SCR_SizeUp_f);
     Cmd_AddCommand("sizedown", SCR_SizeDown_f);
     Cmd_AddCommand("sky", SCR_Sky_f);
+    Cmd_AddCommand("cin_bench", SCR_CinematicBench_f);
 
     scr_initialized = true;
 }
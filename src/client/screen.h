@@ -56,6 +56,7 @@ void SCR_RunCinematic(void);
 void SCR_StopCinematic(void);
 void SCR_FinishCinematic(void);
 qboolean SCR_DrawCinematic(void);
+void SCR_CinematicBench_f(void);
 
 // LAMPERT: Added to QPS2 for testing.
 qboolean CinematicTest_PlayDirect(const char * filename);
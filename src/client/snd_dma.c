@@ -75,6 +75,10 @@ cvar_t * s_khz;
 cvar_t * s_show;
 cvar_t * s_mixahead;
 cvar_t * s_primary;
+cvar_t * s_mixer;
+cvar_t * s_adpcm;
+cvar_t * s_cachesize;
+cvar_t * s_resample;
 
 int s_rawend;
 portable_samplepair_t s_rawsamples[MAX_RAW_SAMPLES];
@@ -124,11 +128,17 @@ void S_Init(void)
         s_show = Cvar_Get("s_show", "0", 0);
         s_testsound = Cvar_Get("s_testsound", "0", 0);
         s_primary = Cvar_Get("s_primary", "0", CVAR_ARCHIVE); // win32 specific
+        s_mixer = Cvar_Get("s_mixer", "1", CVAR_ARCHIVE);
+        s_adpcm = Cvar_Get("s_adpcm", "0", CVAR_ARCHIVE);
+        s_cachesize = Cvar_Get("s_cachesize", "0", CVAR_ARCHIVE); // KB, 0 = no limit
+        s_resample = Cvar_Get("s_resample", "1", CVAR_ARCHIVE);
 
         Cmd_AddCommand("play", S_Play);
         Cmd_AddCommand("stopsound", S_StopAllSounds);
         Cmd_AddCommand("soundlist", S_SoundList);
         Cmd_AddCommand("soundinfo", S_SoundInfo_f);
+        Cmd_AddCommand("s_mixbench", S_MixBench_f);
+        Cmd_AddCommand("s_resamplebench", S_ResampleBench_f);
 
         if (!SNDDMA_Init())
         {
@@ -136,6 +146,7 @@ void S_Init(void)
         }
 
         S_InitScaletable();
+        S_InitMixKernels();
 
         sound_started = 1;
         num_sfx = 0;
@@ -171,14 +182,15 @@ void S_Shutdown(void)
     Cmd_RemoveCommand("stopsound");
     Cmd_RemoveCommand("soundlist");
     Cmd_RemoveCommand("soundinfo");
+    Cmd_RemoveCommand("s_mixbench");
+    Cmd_RemoveCommand("s_resamplebench");
 
     // free all sounds
     for (i = 0, sfx = known_sfx; i < num_sfx; i++, sfx++)
     {
         if (!sfx->name[0])
             continue;
-        if (sfx->cache)
-            Z_Free(sfx->cache);
+        S_FreeSfxCache(sfx);
         memset(sfx, 0, sizeof(*sfx));
     }
 
@@ -326,16 +338,16 @@ void S_EndRegistration(void)
         if (!sfx->name[0])
             continue;
         if (sfx->registration_sequence != s_registration_sequence)
-        {                           // don't need this sound
-            if (sfx->cache)         // it is possible to have a leftover
-                Z_Free(sfx->cache); // from a server that didn't finish loading
+        {                        // don't need this sound
+            S_FreeSfxCache(sfx); // it is possible to have a leftover
+                                 // from a server that didn't finish loading
             memset(sfx, 0, sizeof(*sfx));
         }
         else
         { // make sure it is paged in
             if (sfx->cache)
             {
-                size = sfx->cache->length * sfx->cache->width;
+                size = sfx->cache->size;
                 Com_PageInMemory((byte *)sfx->cache, size);
             }
         }
@@ -831,7 +843,7 @@ void S_AddLoopSounds(void)
         sfx = cl.sound_precache[sounds[i]];
         if (!sfx)
             continue; // bad sound effect
-        sc = sfx->cache;
+        sc = S_LoadSound(sfx); // may have been evicted
         if (!sc)
             continue;
 
@@ -1007,6 +1019,8 @@ void S_Update(vec3_t origin, vec3_t forward, vec3_t right, vec3_t up)
     // rebuild scale tables if volume is modified
     if (s_volume->modified)
         S_InitScaletable();
+    if (s_mixer->modified)
+        S_InitMixKernels();
 
     VectorCopy(origin, listener_origin);
     VectorCopy(forward, listener_forward);
@@ -1160,9 +1174,10 @@ void S_SoundList(void)
     int i;
     sfx_t * sfx;
     sfxcache_t * sc;
-    int size, total;
+    int size, total, expanded;
 
     total = 0;
+    expanded = 0;
     for (sfx = known_sfx, i = 0; i < num_sfx; i++, sfx++)
     {
         if (!sfx->registration_sequence)
@@ -1170,13 +1185,17 @@ void S_SoundList(void)
         sc = sfx->cache;
         if (sc)
         {
-            size = sc->length * sc->width * (sc->stereo + 1);
+            size = sc->size;
             total += size;
+            expanded += sc->length * sc->width * (sc->stereo + 1) + sizeof(sfxcache_t);
             if (sc->loopstart >= 0)
                 Com_Printf("L");
             else
                 Com_Printf(" ");
-            Com_Printf("(%2db) %6i : %s\n", sc->width * 8, size, sfx->name);
+            if (sc->format == SFX_ADPCM)
+                Com_Printf("(adpcm) %6i : %s\n", size, sfx->name);
+            else
+                Com_Printf("(%2db)   %6i : %s\n", sc->width * 8, size, sfx->name);
         }
         else
         {
@@ -1187,4 +1206,7 @@ void S_SoundList(void)
         }
     }
     Com_Printf("Total resident: %i\n", total);
+    Com_Printf("As decoded PCM: %i (%i saved)\n", expanded, expanded - total);
+    Com_Printf("ADPCM blocks decoded: %i\n", snd_adpcm_decoded);
+    snd_adpcm_decoded = 0;
 }
@@ -30,6 +30,23 @@ typedef struct
     int right;
 } portable_samplepair_t;
 
+// sfxcache_t formats
+enum
+{
+    SFX_PCM,  // 8 or 16 bit samples, see width
+    SFX_ADPCM // IMA ADPCM blocks, decoded to 16 bit by the mixer
+};
+
+// IMA ADPCM blocks are self contained so the mixer can start
+// decoding at any block boundary: a 4 byte header with the
+// predictor state followed by two samples per byte.
+enum
+{
+    ADPCM_BLOCK_SAMPLES = 256,
+    ADPCM_BLOCK_HEADER = 4,
+    ADPCM_BLOCK_BYTES = ADPCM_BLOCK_HEADER + ADPCM_BLOCK_SAMPLES / 2
+};
+
 typedef struct
 {
     int length;
@@ -37,6 +54,8 @@ typedef struct
     int speed; // not needed, because converted on load?
     int width;
     int stereo;
+    int format; // SFX_PCM or SFX_ADPCM
+    int size;   // bytes allocated for this cache, header included
     byte data[1]; // variable sized
 } sfxcache_t;
 
@@ -46,6 +65,7 @@ typedef struct sfx_s
     int registration_sequence;
     sfxcache_t * cache;
     char * truename;
+    int lastused; // paintedtime of the last S_LoadSound, for cache eviction
 } sfx_t;
 
 // a playsound_t will be generated by each call to S_StartSound,
@@ -122,6 +142,9 @@ void SNDDMA_Submit(void);
 #define MAX_CHANNELS 32
 extern channel_t channels[MAX_CHANNELS];
 
+extern sfx_t known_sfx[];
+extern int num_sfx;
+
 extern int paintedtime;
 extern int s_rawend;
 extern vec3_t listener_origin;
@@ -142,12 +165,24 @@ extern cvar_t * s_show;
 extern cvar_t * s_mixahead;
 extern cvar_t * s_testsound;
 extern cvar_t * s_primary;
+extern cvar_t * s_mixer;
+extern cvar_t * s_adpcm;
+extern cvar_t * s_cachesize;
+extern cvar_t * s_resample;
 
 wavinfo_t GetWavinfo(char * name, byte * wav, int wavlength);
 void S_InitScaletable(void);
 sfxcache_t * S_LoadSound(sfx_t * s);
+void S_FreeSfxCache(sfx_t * s);
+void S_ResampleBench_f(void);
+void S_EncodeADPCM(const short * in, int count, byte * out);
+void S_DecodeADPCMBlock(const byte * block, int count, short * out);
 void S_IssuePlaysound(playsound_t * ps);
 void S_PaintChannels(int endtime);
+void S_InitMixKernels(void);
+void S_FlushADPCMCache(const sfxcache_t * sc);
+extern int snd_adpcm_decoded;
+void S_MixBench_f(void);
 
 // picks a channel based on priorities, empty slots, number of channels
 channel_t * S_PickChannel(int entnum, int entchannel);
@@ -26,6 +26,183 @@ int cache_full_cycle;
 
 byte * S_Alloc(int size);
 
+/*
+===============================================================================
+
+RESAMPLING
+
+Sounds are converted to the mixing rate once, at load time. The loops
+below are specialized by input width, output width and rate ratio so
+none of them branch per sample. s_resample 0 picks the original nearest
+sample decimation, which the specialized versions reproduce exactly;
+s_resample 1 interpolates linearly when upsampling and averages sample
+pairs when halving the rate.
+
+===============================================================================
+*/
+
+// sample in, always widened to 16 bits
+#define READ_8(in, n) (((int)((const byte *)(in))[n] - 128) << 8)
+#define READ_16(in, n) LittleShort(((const short *)(in))[n])
+
+// sample out
+#define WRITE_8(out, n, val) (((signed char *)(out))[n] = (val) >> 8)
+#define WRITE_16(out, n, val) (((short *)(out))[n] = (val))
+
+typedef void (*resamplefunc_t)(byte * out, const byte * in, int outcount, int incount, int inrate, int outrate);
+
+// 8.8 fixed point step, as in the original ResampleSfx
+#define DEFINE_NEAREST(name, READ, WRITE)                                         \
+    static void name(byte * out, const byte * in, int outcount, int incount, int inrate, int outrate) \
+    {                                                                             \
+        const int fracstep = (float)inrate / outrate * 256;                       \
+        int i, samplefrac = 0;                                                    \
+        for (i = 0; i < outcount; i++, samplefrac += fracstep)                    \
+            WRITE(out, i, READ(in, samplefrac >> 8));                             \
+    }
+
+#define DEFINE_COPY(name, READ, WRITE)                                            \
+    static void name(byte * out, const byte * in, int outcount, int incount, int inrate, int outrate) \
+    {                                                                             \
+        int i;                                                                    \
+        for (i = 0; i < outcount; i++)                                            \
+            WRITE(out, i, READ(in, i));                                           \
+    }
+
+#define DEFINE_DROP(name, READ, WRITE)                                            \
+    static void name(byte * out, const byte * in, int outcount, int incount, int inrate, int outrate) \
+    {                                                                             \
+        int i;                                                                    \
+        for (i = 0; i < outcount; i++)                                            \
+            WRITE(out, i, READ(in, i << 1));                                      \
+    }
+
+#define DEFINE_DOUBLE(name, READ, WRITE)                                          \
+    static void name(byte * out, const byte * in, int outcount, int incount, int inrate, int outrate) \
+    {                                                                             \
+        int i;                                                                    \
+        for (i = 0; i < outcount; i++)                                            \
+            WRITE(out, i, READ(in, i >> 1));                                      \
+    }
+
+// 2:1, averages each pair of input samples
+#define DEFINE_HALVE(name, READ, WRITE)                                           \
+    static void name(byte * out, const byte * in, int outcount, int incount, int inrate, int outrate) \
+    {                                                                             \
+        int i;                                                                    \
+        for (i = 0; i < outcount; i++)                                            \
+        {                                                                         \
+            const int a = READ(in, i << 1);                                       \
+            const int b = ((i << 1) + 1 < incount) ? READ(in, (i << 1) + 1) : a;  \
+            WRITE(out, i, (a + b) >> 1);                                          \
+        }                                                                         \
+    }
+
+// 1:2, every other output sample is the midpoint of its neighbours
+#define DEFINE_INTERP2(name, READ, WRITE)                                         \
+    static void name(byte * out, const byte * in, int outcount, int incount, int inrate, int outrate) \
+    {                                                                             \
+        int i;                                                                    \
+        for (i = 0; i + 1 < outcount; i += 2)                                     \
+        {                                                                         \
+            const int a = READ(in, i >> 1);                                       \
+            const int b = ((i >> 1) + 1 < incount) ? READ(in, (i >> 1) + 1) : a;  \
+            WRITE(out, i, a);                                                     \
+            WRITE(out, i + 1, (a + b) >> 1);                                      \
+        }                                                                         \
+        if (i < outcount)                                                         \
+            WRITE(out, i, READ(in, i >> 1));                                      \
+    }
+
+// any ratio. The source position is stepped exactly as a whole part
+// plus a remainder in 1/outrate units, so long sounds don't drift; the
+// remainder is scaled to a 15 bit weight so the 16 bit delta times it
+// fits in an int.
+#define DEFINE_LINEAR(name, READ, WRITE)                                          \
+    static void name(byte * out, const byte * in, int outcount, int incount, int inrate, int outrate) \
+    {                                                                             \
+        const int whole = inrate / outrate;                                       \
+        const int part = inrate % outrate;                                        \
+        const int recip = (1 << 30) / outrate;                                    \
+        int i, n = 0, rem = 0;                                                    \
+        for (i = 0; i < outcount; i++)                                            \
+        {                                                                         \
+            const int a = READ(in, n);                                            \
+            const int b = (n + 1 < incount) ? READ(in, n + 1) : a;                \
+            const int weight = (rem * recip) >> 15;                               \
+            WRITE(out, i, a + (((b - a) * weight) >> 15));                        \
+            n += whole;                                                           \
+            rem += part;                                                          \
+            if (rem >= outrate)                                                   \
+            {                                                                     \
+                rem -= outrate;                                                   \
+                n++;                                                              \
+            }                                                                     \
+        }                                                                         \
+    }
+
+#define DEFINE_RESAMPLERS(suffix, READ, WRITE)         \
+    DEFINE_NEAREST(Resample_Nearest##suffix, READ, WRITE) \
+    DEFINE_COPY(Resample_Copy##suffix, READ, WRITE)       \
+    DEFINE_DROP(Resample_Drop##suffix, READ, WRITE)       \
+    DEFINE_DOUBLE(Resample_Double##suffix, READ, WRITE)   \
+    DEFINE_HALVE(Resample_Halve##suffix, READ, WRITE)     \
+    DEFINE_INTERP2(Resample_Interp2##suffix, READ, WRITE) \
+    DEFINE_LINEAR(Resample_Linear##suffix, READ, WRITE)
+
+DEFINE_RESAMPLERS(_8to8, READ_8, WRITE_8)
+DEFINE_RESAMPLERS(_8to16, READ_8, WRITE_16)
+DEFINE_RESAMPLERS(_16to8, READ_16, WRITE_8)
+DEFINE_RESAMPLERS(_16to16, READ_16, WRITE_16)
+
+enum
+{
+    RATIO_ONE,    // same rate
+    RATIO_HALF,   // input is twice the mixing rate
+    RATIO_DOUBLE, // input is half the mixing rate
+    RATIO_OTHER,
+    NUM_RATIOS
+};
+
+// [s_resample][inwidth - 1][outwidth - 1][ratio]
+static const resamplefunc_t resamplers[2][2][2][NUM_RATIOS] = {
+    { // nearest sample
+      { { Resample_Copy_8to8, Resample_Drop_8to8, Resample_Double_8to8, Resample_Nearest_8to8 },
+        { Resample_Copy_8to16, Resample_Drop_8to16, Resample_Double_8to16, Resample_Nearest_8to16 } },
+      { { Resample_Copy_16to8, Resample_Drop_16to8, Resample_Double_16to8, Resample_Nearest_16to8 },
+        { Resample_Copy_16to16, Resample_Drop_16to16, Resample_Double_16to16, Resample_Nearest_16to16 } } },
+    { // filtered
+      { { Resample_Copy_8to8, Resample_Halve_8to8, Resample_Interp2_8to8, Resample_Linear_8to8 },
+        { Resample_Copy_8to16, Resample_Halve_8to16, Resample_Interp2_8to16, Resample_Linear_8to16 } },
+      { { Resample_Copy_16to8, Resample_Halve_16to8, Resample_Interp2_16to8, Resample_Linear_16to8 },
+        { Resample_Copy_16to16, Resample_Halve_16to16, Resample_Interp2_16to16, Resample_Linear_16to16 } } }
+};
+
+/*
+================
+S_Resample
+
+Converts incount samples at inrate to outcount samples at outrate.
+================
+*/
+static void S_Resample(byte * out, int outwidth, int outcount,
+                       const byte * in, int inwidth, int incount,
+                       int inrate, int outrate, int filtered)
+{
+    int ratio;
+
+    if (inrate == outrate)
+        ratio = RATIO_ONE;
+    else if (inrate == outrate * 2)
+        ratio = RATIO_HALF;
+    else if (inrate * 2 == outrate)
+        ratio = RATIO_DOUBLE;
+    else
+        ratio = RATIO_OTHER;
+
+    resamplers[filtered != 0][inwidth - 1][outwidth - 1][ratio](out, in, outcount, incount, inrate, outrate);
+}
+
 /*
 ================
 ResampleSfx
@@ -33,11 +210,8 @@ ResampleSfx
 */
 void ResampleSfx(sfx_t * sfx, int inrate, int inwidth, byte * data)
 {
-    int outcount;
-    int srcsample;
+    int outcount, incount;
     float stepscale;
-    int i;
-    int sample, samplefrac, fracstep;
     sfxcache_t * sc;
 
     sc = sfx->cache;
@@ -46,49 +220,396 @@ void ResampleSfx(sfx_t * sfx, int inrate, int inwidth, byte * data)
 
     stepscale = (float)inrate / dma.speed; // this is usually 0.5, 1, or 2
 
+    incount = sc->length;
     outcount = sc->length / stepscale;
     sc->length = outcount;
     if (sc->loopstart != -1)
         sc->loopstart = sc->loopstart / stepscale;
 
     sc->speed = dma.speed;
-    if (s_loadas8bit->value)
+    if (sc->format == SFX_ADPCM)
+        sc->width = 2; // the encoder wants the full 16 bits
+    else if (s_loadas8bit->value)
         sc->width = 1;
     else
         sc->width = inwidth;
     sc->stereo = 0;
 
     // resample / decimate to the current source rate
+    S_Resample(sc->data, sc->width, outcount, data, inwidth, incount,
+               inrate, dma.speed, s_resample->value);
+}
+
+/*
+================
+S_ResampleBench_f
 
-    if (stepscale == 1 && inwidth == 1 && sc->width == 1)
+Runs every registered sound through the original per sample loop and
+the specialized resamplers. Reports the time taken by each, checks that
+the nearest sample path is still bit exact, and measures the SNR of
+both paths against a floating point version of the filtered path.
+================
+*/
+static void S_ResampleReference(byte * out, int outwidth, int outcount,
+                                const byte * in, int inwidth, float stepscale)
+{
+    int i, sample, srcsample;
+    int samplefrac = 0;
+    const int fracstep = stepscale * 256;
+
+    for (i = 0; i < outcount; i++)
     {
-        // fast special case
-        for (i = 0; i < outcount; i++)
-            ((signed char *)sc->data)[i] = (int)((unsigned char)(data[i]) - 128);
+        srcsample = samplefrac >> 8;
+        samplefrac += fracstep;
+        if (inwidth == 2)
+            sample = LittleShort(((short *)in)[srcsample]);
+        else
+            sample = (int)((unsigned char)(in[srcsample]) - 128) << 8;
+        if (outwidth == 2)
+            ((short *)out)[i] = sample;
+        else
+            ((signed char *)out)[i] = sample >> 8;
     }
+}
+
+static double S_ResampleNoise(const short * out, const byte * in, int inwidth,
+                              int incount, int outcount, float stepscale, double * signal)
+{
+    int i;
+    double noise = 0;
+
+#define READ_SAMPLE(n) ((n) < incount ? ((inwidth == 2) ? READ_16(in, n) : READ_8(in, n)) : 0)
+
+    for (i = 0; i < outcount; i++)
+    {
+        const double pos = i * (double)stepscale;
+        const int n = (int)pos;
+        const double a = READ_SAMPLE(n);
+        const double b = (n + 1 < incount) ? READ_SAMPLE(n + 1) : a;
+        double ideal;
+
+        if (stepscale == 2)
+            ideal = (a + b) * 0.5; // the filtered path averages pairs here
+        else
+            ideal = a + (b - a) * (pos - n);
+
+        *signal += ideal * ideal;
+        noise += (out[i] - ideal) * (out[i] - ideal);
+    }
+
+#undef READ_SAMPLE
+
+    return noise;
+}
+
+void S_ResampleBench_f(void)
+{
+    enum
+    {
+        BENCH_PASSES = 8
+    };
+
+    char namebuffer[MAX_QPATH];
+    int i, pass, size;
+    int sounds, samples, mismatches;
+    int ms_ref, ms_nearest, ms_linear, start;
+    double signal, noise_nearest, noise_linear;
+    sfx_t * sfx;
+    byte * data;
+    wavinfo_t info;
+
+    sounds = samples = mismatches = 0;
+    ms_ref = ms_nearest = ms_linear = 0;
+    signal = noise_nearest = noise_linear = 0;
+
+    for (i = 0, sfx = known_sfx; i < num_sfx; i++, sfx++)
+    {
+        short * ref;
+        short * out;
+        const char * name;
+        float stepscale;
+        int outcount;
+        double dummy = 0;
+
+        if (!sfx->name[0] || sfx->name[0] == '*')
+            continue;
+
+        name = sfx->truename ? sfx->truename : sfx->name;
+        if (name[0] == '#')
+            strcpy(namebuffer, &name[1]);
+        else
+            Com_sprintf(namebuffer, sizeof(namebuffer), "sound/%s", name);
+
+        size = FS_LoadFile(namebuffer, (void **)&data);
+        if (!data)
+            continue;
+
+        info = GetWavinfo(sfx->name, data, size);
+        if (info.channels != 1 || !info.rate)
+        {
+            FS_FreeFile(data);
+            continue;
+        }
+
+        stepscale = (float)info.rate / dma.speed;
+        outcount = info.samples / stepscale;
+        ref = Z_Malloc(outcount * 2 + 2);
+        out = Z_Malloc(outcount * 2 + 2);
+
+        start = Sys_Milliseconds();
+        for (pass = 0; pass < BENCH_PASSES; pass++)
+            S_ResampleReference((byte *)ref, 2, outcount, data + info.dataofs, info.width, stepscale);
+        ms_ref += Sys_Milliseconds() - start;
+
+        start = Sys_Milliseconds();
+        for (pass = 0; pass < BENCH_PASSES; pass++)
+            S_Resample((byte *)out, 2, outcount, data + info.dataofs, info.width, info.samples,
+                       info.rate, dma.speed, 0);
+        ms_nearest += Sys_Milliseconds() - start;
+
+        if (memcmp(ref, out, outcount * 2))
+            mismatches++;
+        noise_nearest += S_ResampleNoise(out, data + info.dataofs, info.width, info.samples,
+                                         outcount, stepscale, &signal);
+
+        start = Sys_Milliseconds();
+        for (pass = 0; pass < BENCH_PASSES; pass++)
+            S_Resample((byte *)out, 2, outcount, data + info.dataofs, info.width, info.samples,
+                       info.rate, dma.speed, 1);
+        ms_linear += Sys_Milliseconds() - start;
+
+        noise_linear += S_ResampleNoise(out, data + info.dataofs, info.width, info.samples,
+                                        outcount, stepscale, &dummy);
+
+        Z_Free(ref);
+        Z_Free(out);
+        FS_FreeFile(data);
+
+        sounds++;
+        samples += outcount;
+    }
+
+    Com_Printf("%i sounds, %i samples at %i Hz, %i passes\n", sounds, samples, dma.speed, BENCH_PASSES);
+    Com_Printf("reference: %i ms\n", ms_ref);
+    Com_Printf("nearest:   %i ms, SNR %.1f dB, %i sounds differ from reference\n", ms_nearest,
+               noise_nearest > 0 ? 10 * log10(signal / noise_nearest) : 999.0, mismatches);
+    Com_Printf("linear:    %i ms, SNR %.1f dB\n", ms_linear,
+               noise_linear > 0 ? 10 * log10(signal / noise_linear) : 999.0);
+}
+
+//=============================================================================
+
+/*
+===============================================================================
+
+IMA ADPCM
+
+===============================================================================
+*/
+
+static const int adpcm_index_table[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+static const int adpcm_step_table[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static inline int S_ADPCMStep(int code, int * predictor, int * index)
+{
+    const int step = adpcm_step_table[*index];
+    int diff = step >> 3;
+
+    if (code & 4)
+        diff += step;
+    if (code & 2)
+        diff += step >> 1;
+    if (code & 1)
+        diff += step >> 2;
+
+    if (code & 8)
+        *predictor -= diff;
     else
+        *predictor += diff;
+
+    if (*predictor > 32767)
+        *predictor = 32767;
+    else if (*predictor < -32768)
+        *predictor = -32768;
+
+    *index += adpcm_index_table[code];
+    if (*index < 0)
+        *index = 0;
+    else if (*index > 88)
+        *index = 88;
+
+    return *predictor;
+}
+
+/*
+================
+S_EncodeADPCM
+
+Encodes count 16 bit samples into (count + ADPCM_BLOCK_SAMPLES - 1) /
+ADPCM_BLOCK_SAMPLES blocks. The last block is padded with silence.
+================
+*/
+void S_EncodeADPCM(const short * in, int count, byte * out)
+{
+    int predictor = 0;
+    int index = 0;
+    int i, j;
+
+    for (i = 0; i < count; i += ADPCM_BLOCK_SAMPLES, out += ADPCM_BLOCK_BYTES)
     {
-        // general case
-        samplefrac = 0;
-        fracstep = stepscale * 256;
-        for (i = 0; i < outcount; i++)
+        byte * nibbles = out + ADPCM_BLOCK_HEADER;
+
+        out[0] = predictor & 0xff;
+        out[1] = (predictor >> 8) & 0xff;
+        out[2] = index;
+        out[3] = 0;
+
+        memset(nibbles, 0, ADPCM_BLOCK_SAMPLES / 2);
+
+        for (j = 0; j < ADPCM_BLOCK_SAMPLES && i + j < count; j++)
         {
-            srcsample = samplefrac >> 8;
-            samplefrac += fracstep;
-            if (inwidth == 2)
-                sample = LittleShort(((short *)data)[srcsample]);
-            else
-                sample = (int)((unsigned char)(data[srcsample]) - 128) << 8;
-            if (sc->width == 2)
-                ((short *)sc->data)[i] = sample;
-            else
-                ((signed char *)sc->data)[i] = sample >> 8;
+            const int step = adpcm_step_table[index];
+            int diff = in[i + j] - predictor;
+            int code = 0;
+
+            if (diff < 0)
+            {
+                code = 8;
+                diff = -diff;
+            }
+            if (diff >= step)
+            {
+                code |= 4;
+                diff -= step;
+            }
+            if (diff >= (step >> 1))
+            {
+                code |= 2;
+                diff -= step >> 1;
+            }
+            if (diff >= (step >> 2))
+            {
+                code |= 1;
+            }
+
+            S_ADPCMStep(code, &predictor, &index);
+            nibbles[j >> 1] |= code << ((j & 1) * 4);
         }
     }
 }
 
+/*
+================
+S_DecodeADPCMBlock
+
+Decodes the first count samples of a block.
+================
+*/
+void S_DecodeADPCMBlock(const byte * block, int count, short * out)
+{
+    const byte * nibbles = block + ADPCM_BLOCK_HEADER;
+    int predictor = (short)(block[0] | (block[1] << 8));
+    int index = block[2];
+    int i;
+
+    for (i = 0; i + 2 <= count; i += 2)
+    {
+        const int b = nibbles[i >> 1];
+        out[i + 0] = S_ADPCMStep(b & 15, &predictor, &index);
+        out[i + 1] = S_ADPCMStep(b >> 4, &predictor, &index);
+    }
+    if (i < count)
+    {
+        out[i] = S_ADPCMStep(nibbles[i >> 1] & 15, &predictor, &index);
+    }
+}
+
 //=============================================================================
 
+/*
+==============
+S_FreeSfxCache
+==============
+*/
+void S_FreeSfxCache(sfx_t * s)
+{
+    if (!s->cache)
+        return;
+
+    S_FlushADPCMCache(s->cache);
+    Z_Free(s->cache);
+    s->cache = NULL;
+}
+
+/*
+==============
+S_EvictSounds
+
+Frees the least recently used sounds until another needed bytes fit
+in s_cachesize kilobytes. Sounds still playing on a channel are kept,
+so the budget can be exceeded when everything resident is in use.
+==============
+*/
+static void S_EvictSounds(int needed)
+{
+    const int budget = s_cachesize->value * 1024;
+    int i, total;
+    sfx_t * sfx;
+    sfx_t * oldest;
+
+    if (budget <= 0)
+        return;
+
+    total = 0;
+    for (i = 0, sfx = known_sfx; i < num_sfx; i++, sfx++)
+    {
+        if (sfx->cache)
+            total += sfx->cache->size;
+    }
+
+    while (total + needed > budget)
+    {
+        oldest = NULL;
+        for (i = 0, sfx = known_sfx; i < num_sfx; i++, sfx++)
+        {
+            int j;
+
+            if (!sfx->cache)
+                continue;
+            if (oldest && sfx->lastused >= oldest->lastused)
+                continue;
+
+            for (j = 0; j < MAX_CHANNELS; j++)
+            {
+                if (channels[j].sfx == sfx)
+                    break;
+            }
+            if (j == MAX_CHANNELS)
+                oldest = sfx;
+        }
+
+        if (!oldest)
+            break; // everything left is playing
+
+        total -= oldest->cache->size;
+        S_FreeSfxCache(oldest);
+    }
+}
+
 /*
 ==============
 S_LoadSound
@@ -103,6 +624,7 @@ sfxcache_t * S_LoadSound(sfx_t * s)
     float stepscale;
     sfxcache_t * sc;
     int size;
+    int resident;
     char * name;
 
     if (s->name[0] == '*')
@@ -111,7 +633,10 @@ sfxcache_t * S_LoadSound(sfx_t * s)
     // see if still in memory
     sc = s->cache;
     if (sc)
+    {
+        s->lastused = paintedtime;
         return sc;
+    }
 
     //Com_Printf ("S_LoadSound: %x\n", (int)stackbuf);
     // load it in
@@ -146,9 +671,23 @@ sfxcache_t * S_LoadSound(sfx_t * s)
     stepscale = (float)info.rate / dma.speed;
     len = info.samples / stepscale;
 
-    len = len * info.width * info.channels;
+    if (s_adpcm->value)
+    {
+        // resampled to 16 bits first, then packed into ADPCM blocks;
+        // only the blocks stay in the cache
+        resident = (len + ADPCM_BLOCK_SAMPLES - 1) / ADPCM_BLOCK_SAMPLES * ADPCM_BLOCK_BYTES + sizeof(sfxcache_t);
+        len = len * 2 * info.channels;
+    }
+    else
+    {
+        len = len * info.width * info.channels;
+        resident = len + sizeof(sfxcache_t);
+    }
+
+    size = len + sizeof(sfxcache_t);
+    S_EvictSounds(resident);
 
-    sc = s->cache = Z_Malloc(len + sizeof(sfxcache_t));
+    sc = s->cache = Z_Malloc(size);
     if (!sc)
     {
         FS_FreeFile(data);
@@ -160,11 +699,29 @@ sfxcache_t * S_LoadSound(sfx_t * s)
     sc->speed = info.rate;
     sc->width = info.width;
     sc->stereo = info.channels;
+    sc->format = s_adpcm->value ? SFX_ADPCM : SFX_PCM;
+    sc->size = size;
 
     ResampleSfx(s, sc->speed, sc->width, data + info.dataofs);
 
     FS_FreeFile(data);
 
+    if (sc->format == SFX_ADPCM)
+    {
+        sfxcache_t * pcm = sc;
+        const int blocks = (pcm->length + ADPCM_BLOCK_SAMPLES - 1) / ADPCM_BLOCK_SAMPLES;
+
+        size = blocks * ADPCM_BLOCK_BYTES + sizeof(sfxcache_t);
+        sc = s->cache = Z_Malloc(size);
+
+        *sc = *pcm;
+        sc->size = size;
+        S_EncodeADPCM((const short *)pcm->data, pcm->length, sc->data);
+
+        Z_Free(pcm);
+    }
+
+    s->lastused = paintedtime;
     return sc;
 }
 
@@ -23,12 +23,26 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 #include "snd_loc.h"
 
 #define PAINTBUFFER_SIZE 2048
-portable_samplepair_t paintbuffer[PAINTBUFFER_SIZE];
+// 16 byte aligned so the wide kernels can use quadword loads
+portable_samplepair_t paintbuffer[PAINTBUFFER_SIZE] __attribute__((aligned(16)));
 int snd_scaletable[32][256];
 int *snd_p, snd_linear_count, snd_vol;
 short * snd_out;
 
 void S_WriteLinearBlastStereo16(void);
+void S_PaintChannelFrom8(channel_t * ch, sfxcache_t * sc, int count, int offset);
+void S_PaintChannelFrom16(channel_t * ch, sfxcache_t * sc, int count, int offset);
+void S_PaintChannelFromADPCM(channel_t * ch, sfxcache_t * sc, int count, int offset);
+
+// Mixing kernels, selected by S_InitMixKernels.
+// The plain S_PaintChannelFrom* / S_WriteLinearBlastStereo16
+// functions are the reference versions.
+typedef void (*paintfunc_t)(channel_t * ch, sfxcache_t * sc, int count, int offset);
+typedef void (*blastfunc_t)(void);
+
+static paintfunc_t snd_paint8 = S_PaintChannelFrom8;
+static paintfunc_t snd_paint16 = S_PaintChannelFrom16;
+static blastfunc_t snd_blast = S_WriteLinearBlastStereo16;
 
 #if !(defined __linux__ && defined __i386__)
 #if !id386
@@ -128,7 +142,7 @@ void S_TransferStereo16(unsigned long * pbuf, int endtime)
         snd_linear_count <<= 1;
 
         // write a linear blast of samples
-        S_WriteLinearBlastStereo16();
+        snd_blast();
 
         snd_p += snd_linear_count;
         lpaintedtime += (snd_linear_count >> 1);
@@ -217,9 +231,6 @@ CHANNEL MIXING
 ===============================================================================
 */
 
-void S_PaintChannelFrom8(channel_t * ch, sfxcache_t * sc, int endtime, int offset);
-void S_PaintChannelFrom16(channel_t * ch, sfxcache_t * sc, int endtime, int offset);
-
 void S_PaintChannels(int endtime)
 {
     int i;
@@ -309,10 +320,12 @@ void S_PaintChannels(int endtime)
 
                 if (count > 0 && ch->sfx)
                 {
-                    if (sc->width == 1) // FIXME; 8 bit asm is wrong now
-                        S_PaintChannelFrom8(ch, sc, count, ltime - paintedtime);
+                    if (sc->format == SFX_ADPCM)
+                        S_PaintChannelFromADPCM(ch, sc, count, ltime - paintedtime);
+                    else if (sc->width == 1)
+                        snd_paint8(ch, sc, count, ltime - paintedtime);
                     else
-                        S_PaintChannelFrom16(ch, sc, count, ltime - paintedtime);
+                        snd_paint16(ch, sc, count, ltime - paintedtime);
 
                     ltime += count;
                 }
@@ -374,8 +387,9 @@ void S_PaintChannelFrom8(channel_t * ch, sfxcache_t * sc, int count, int offset)
     if (ch->rightvol > 255)
         ch->rightvol = 255;
 
-    lscale = snd_scaletable[ch->leftvol >> 11];
-    rscale = snd_scaletable[ch->rightvol >> 11];
+    // 32 volume rows, as the asm version does (vol & 0xF8)
+    lscale = snd_scaletable[ch->leftvol >> 3];
+    rscale = snd_scaletable[ch->rightvol >> 3];
     sfx = (signed char *)sc->data + ch->pos;
 
     samp = &paintbuffer[offset];
@@ -490,3 +504,446 @@ void S_PaintChannelFrom16(channel_t * ch, sfxcache_t * sc, int count, int offset
 
     ch->pos += count;
 }
+
+/*
+===============================================================================
+
+WIDE MIXING KERNELS
+
+Same results as the reference functions above, bit for bit, but written
+to keep four samples in flight per iteration. The 8 bit path replaces the
+scaletable lookups with a multiply (every row of the table is just the
+signed sample times row[1]), which avoids pulling 2KB of table through
+the cache for every channel. The clipper uses EE MMI instructions when
+building for the PS2; elsewhere the branchless C loop is left to the
+compiler's vectorizer.
+
+===============================================================================
+*/
+
+static void S_PaintChannelFrom8_Wide(channel_t * ch, sfxcache_t * sc, int count, int offset)
+{
+    int lscale, rscale;
+    const signed char * sfx;
+    int * samp;
+    int i;
+
+    if (ch->leftvol > 255)
+        ch->leftvol = 255;
+    if (ch->rightvol > 255)
+        ch->rightvol = 255;
+
+    lscale = snd_scaletable[ch->leftvol >> 3][1];
+    rscale = snd_scaletable[ch->rightvol >> 3][1];
+
+    // nothing audible to add
+    if (!lscale && !rscale)
+    {
+        ch->pos += count;
+        return;
+    }
+
+    sfx = (const signed char *)sc->data + ch->pos;
+    samp = &paintbuffer[offset].left;
+
+    for (i = 0; i + 4 <= count; i += 4, samp += 8)
+    {
+        const int d0 = sfx[i + 0];
+        const int d1 = sfx[i + 1];
+        const int d2 = sfx[i + 2];
+        const int d3 = sfx[i + 3];
+
+        samp[0] += d0 * lscale;
+        samp[1] += d0 * rscale;
+        samp[2] += d1 * lscale;
+        samp[3] += d1 * rscale;
+        samp[4] += d2 * lscale;
+        samp[5] += d2 * rscale;
+        samp[6] += d3 * lscale;
+        samp[7] += d3 * rscale;
+    }
+    for (; i < count; i++, samp += 2)
+    {
+        samp[0] += sfx[i] * lscale;
+        samp[1] += sfx[i] * rscale;
+    }
+
+    ch->pos += count;
+}
+
+static void S_PaintChannelFrom16_Wide(channel_t * ch, sfxcache_t * sc, int count, int offset)
+{
+    int leftvol, rightvol;
+    const signed short * sfx;
+    int * samp;
+    int i;
+
+    leftvol = ch->leftvol * snd_vol;
+    rightvol = ch->rightvol * snd_vol;
+
+    if (!leftvol && !rightvol)
+    {
+        ch->pos += count;
+        return;
+    }
+
+    sfx = (const signed short *)sc->data + ch->pos;
+    samp = &paintbuffer[offset].left;
+
+    for (i = 0; i + 4 <= count; i += 4, samp += 8)
+    {
+        const int d0 = sfx[i + 0];
+        const int d1 = sfx[i + 1];
+        const int d2 = sfx[i + 2];
+        const int d3 = sfx[i + 3];
+
+        samp[0] += (d0 * leftvol) >> 8;
+        samp[1] += (d0 * rightvol) >> 8;
+        samp[2] += (d1 * leftvol) >> 8;
+        samp[3] += (d1 * rightvol) >> 8;
+        samp[4] += (d2 * leftvol) >> 8;
+        samp[5] += (d2 * rightvol) >> 8;
+        samp[6] += (d3 * leftvol) >> 8;
+        samp[7] += (d3 * rightvol) >> 8;
+    }
+    for (; i < count; i++, samp += 2)
+    {
+        samp[0] += (sfx[i] * leftvol) >> 8;
+        samp[1] += (sfx[i] * rightvol) >> 8;
+    }
+
+    ch->pos += count;
+}
+
+static inline short S_ClipSample(int val)
+{
+    val >>= 8;
+    val = (val > 0x7fff) ? 0x7fff : val;
+    val = (val < -0x8000) ? -0x8000 : val;
+    return (short)val;
+}
+
+static void S_WriteLinearBlastStereo16_Wide(void)
+{
+    const int * p = snd_p;
+    short * out = snd_out;
+    int count = snd_linear_count;
+
+#ifdef _EE
+    // The MMI loop needs 8 byte aligned loads and stores. The paint
+    // buffer is aligned and the output is always at least 4 byte
+    // aligned, so at most one stereo pair goes through the scalar path.
+    while (count > 0 && ((unsigned)out & 7))
+    {
+        *out++ = S_ClipSample(*p++);
+        count--;
+    }
+
+    if (!((unsigned)p & 7) && count >= 8)
+    {
+        int blocks = count >> 3;
+        count &= 7;
+
+        // 8 samples per iteration: shift, clamp to [-32768,32767] and
+        // pack the low halfwords into one quadword.
+        __asm__ volatile(
+            "li      $8, 0x7fff        \n"
+            "dsll32  $9, $8, 0         \n"
+            "or      $8, $8, $9        \n"
+            "pcpyld  $8, $8, $8        \n" // $8 = 4 x 0x00007fff
+            "li      $9, -32768        \n"
+            "dsll32  $10, $9, 0        \n"
+            "dsrl32  $9, $10, 0        \n"
+            "or      $9, $9, $10       \n"
+            "pcpyld  $9, $9, $9        \n" // $9 = 4 x 0xffff8000
+            "1:                        \n"
+            "ld      $10, 0(%0)        \n"
+            "ld      $11, 8(%0)        \n"
+            "ld      $12, 16(%0)       \n"
+            "ld      $13, 24(%0)       \n"
+            "pcpyld  $10, $11, $10     \n"
+            "pcpyld  $12, $13, $12     \n"
+            "psraw   $10, $10, 8       \n"
+            "psraw   $12, $12, 8       \n"
+            "pmaxw   $10, $10, $9      \n"
+            "pmaxw   $12, $12, $9      \n"
+            "pminw   $10, $10, $8      \n"
+            "pminw   $12, $12, $8      \n"
+            "ppach   $10, $12, $10     \n"
+            "pcpyud  $11, $10, $10     \n"
+            "sd      $10, 0(%1)        \n"
+            "sd      $11, 8(%1)        \n"
+            "addiu   %2, %2, -1        \n"
+            "addiu   %0, %0, 32        \n"
+            "addiu   %1, %1, 16        \n"
+            "bnez    %2, 1b            \n"
+            : "+r"(p), "+r"(out), "+r"(blocks)
+            :
+            : "$8", "$9", "$10", "$11", "$12", "$13", "memory");
+    }
+#endif // _EE
+
+    for (; count >= 4; count -= 4, p += 4, out += 4)
+    {
+        out[0] = S_ClipSample(p[0]);
+        out[1] = S_ClipSample(p[1]);
+        out[2] = S_ClipSample(p[2]);
+        out[3] = S_ClipSample(p[3]);
+    }
+    while (count-- > 0)
+    {
+        *out++ = S_ClipSample(*p++);
+    }
+}
+
+/*
+================
+S_InitMixKernels
+
+s_mixer 0 selects the reference kernels, anything else the wide ones.
+================
+*/
+void S_InitMixKernels(void)
+{
+    s_mixer->modified = false;
+
+    if (s_mixer->value)
+    {
+        snd_paint8 = S_PaintChannelFrom8_Wide;
+        snd_paint16 = S_PaintChannelFrom16_Wide;
+        snd_blast = S_WriteLinearBlastStereo16_Wide;
+    }
+    else
+    {
+        snd_paint8 = S_PaintChannelFrom8;
+        snd_paint16 = S_PaintChannelFrom16;
+        snd_blast = S_WriteLinearBlastStereo16;
+    }
+}
+
+/*
+================
+S_MixBench_f
+
+Mixes MAX_CHANNELS channels of random 8 and 16 bit data through
+both kernel sets, checks that the outputs match and prints the
+throughput of each in stereo samples per second.
+================
+*/
+static int S_MixBenchRun(paintfunc_t paint8, paintfunc_t paint16, blastfunc_t blast,
+                         sfxcache_t * sc8, sfxcache_t * sc16, short * out, int passes)
+{
+    channel_t chans[MAX_CHANNELS];
+    int i, pass;
+    const int start = Sys_Milliseconds();
+
+    for (pass = 0; pass < passes; pass++)
+    {
+        memset(chans, 0, sizeof(chans));
+        memset(paintbuffer, 0, sizeof(paintbuffer));
+
+        for (i = 0; i < MAX_CHANNELS; i++)
+        {
+            chans[i].leftvol = (i * 37 + pass) & 255;
+            chans[i].rightvol = (i * 91 + pass) & 255;
+            chans[i].pos = i;
+
+            if (i & 1)
+                paint8(&chans[i], sc8, PAINTBUFFER_SIZE - i, i);
+            else
+                paint16(&chans[i], sc16, PAINTBUFFER_SIZE - i, i);
+        }
+
+        snd_p = (int *)paintbuffer;
+        snd_out = out;
+        snd_linear_count = PAINTBUFFER_SIZE * 2;
+        blast();
+    }
+
+    return Sys_Milliseconds() - start;
+}
+
+void S_MixBench_f(void)
+{
+    enum
+    {
+        BENCH_PASSES = 64
+    };
+
+    sfxcache_t * sc8;
+    sfxcache_t * sc16;
+    sfxcache_t * sca;
+    short * out_ref;
+    short * out_wide;
+    short * out_adpcm;
+    int i, mismatch;
+    int ms_ref, ms_wide, ms_adpcm;
+    const int saved_vol = snd_vol;
+    const int out_bytes = PAINTBUFFER_SIZE * 2 * sizeof(short);
+
+    sc8 = Z_Malloc(sizeof(sfxcache_t) + PAINTBUFFER_SIZE + MAX_CHANNELS);
+    sc16 = Z_Malloc(sizeof(sfxcache_t) + (PAINTBUFFER_SIZE + MAX_CHANNELS) * 2);
+    out_ref = Z_Malloc(out_bytes);
+    out_wide = Z_Malloc(out_bytes);
+    out_adpcm = Z_Malloc(out_bytes);
+
+    sc8->width = 1;
+    sc16->width = 2;
+    sc8->length = sc16->length = PAINTBUFFER_SIZE + MAX_CHANNELS;
+    for (i = 0; i < PAINTBUFFER_SIZE + MAX_CHANNELS; i++)
+    {
+        sc8->data[i] = rand() & 0xff;
+        ((short *)sc16->data)[i] = rand() & 0xffff;
+    }
+
+    // s_volume 1, the loudest the game mixes at. Past that, channel
+    // volume * snd_vol * sample overflows an int in the reference mixer.
+    // 32 channels of random data still clip plenty.
+    snd_vol = 256;
+
+    ms_ref = S_MixBenchRun(S_PaintChannelFrom8, S_PaintChannelFrom16, S_WriteLinearBlastStereo16,
+                           sc8, sc16, out_ref, BENCH_PASSES);
+    ms_wide = S_MixBenchRun(S_PaintChannelFrom8_Wide, S_PaintChannelFrom16_Wide, S_WriteLinearBlastStereo16_Wide,
+                            sc8, sc16, out_wide, BENCH_PASSES);
+
+    // same 16 bit data through the ADPCM path
+    sca = Z_Malloc(sizeof(sfxcache_t) + ((sc16->length + ADPCM_BLOCK_SAMPLES - 1) / ADPCM_BLOCK_SAMPLES) * ADPCM_BLOCK_BYTES);
+    *sca = *sc16;
+    sca->format = SFX_ADPCM;
+    S_EncodeADPCM((const short *)sc16->data, sc16->length, sca->data);
+    ms_adpcm = S_MixBenchRun(S_PaintChannelFrom8_Wide, S_PaintChannelFromADPCM, S_WriteLinearBlastStereo16_Wide,
+                             sc8, sca, out_adpcm, BENCH_PASSES);
+    S_FlushADPCMCache(sca);
+
+    mismatch = 0;
+    for (i = 0; i < PAINTBUFFER_SIZE * 2; i++)
+    {
+        if (out_ref[i] != out_wide[i])
+            mismatch++;
+    }
+
+    Com_Printf("%i channels, %i passes of %i samples\n", MAX_CHANNELS, BENCH_PASSES, PAINTBUFFER_SIZE);
+    Com_Printf("reference: %i ms (%i samples/s)\n", ms_ref,
+               ms_ref ? (int)((double)BENCH_PASSES * PAINTBUFFER_SIZE * 1000 / ms_ref) : 0);
+    Com_Printf("wide:      %i ms (%i samples/s)\n", ms_wide,
+               ms_wide ? (int)((double)BENCH_PASSES * PAINTBUFFER_SIZE * 1000 / ms_wide) : 0);
+    Com_Printf("adpcm:     %i ms (%i samples/s)\n", ms_adpcm,
+               ms_adpcm ? (int)((double)BENCH_PASSES * PAINTBUFFER_SIZE * 1000 / ms_adpcm) : 0);
+    if (mismatch)
+        Com_Printf("WARNING: %i samples differ between kernels\n", mismatch);
+    else
+        Com_Printf("outputs match\n");
+
+    snd_vol = saved_vol;
+    memset(paintbuffer, 0, sizeof(paintbuffer));
+
+    Z_Free(sc8);
+    Z_Free(sc16);
+    Z_Free(out_ref);
+    Z_Free(out_wide);
+    Z_Free(out_adpcm);
+    Z_Free(sca);
+}
+
+/*
+===============================================================================
+
+ADPCM MIXING
+
+Every channel keeps the last block it decoded, so a sound playing over
+several paint calls decodes each block only once.
+
+===============================================================================
+*/
+
+typedef struct
+{
+    const sfxcache_t * sc;
+    int block;
+    short pcm[ADPCM_BLOCK_SAMPLES];
+} adpcmblock_t;
+
+static adpcmblock_t snd_adpcm_blocks[MAX_CHANNELS];
+int snd_adpcm_decoded; // blocks decoded since the last soundlist
+
+/*
+================
+S_FlushADPCMCache
+
+Must be called before an ADPCM sfxcache_t is freed.
+================
+*/
+void S_FlushADPCMCache(const sfxcache_t * sc)
+{
+    int i;
+
+    for (i = 0; i < MAX_CHANNELS; i++)
+    {
+        if (snd_adpcm_blocks[i].sc == sc)
+            snd_adpcm_blocks[i].sc = NULL;
+    }
+}
+
+static const short * S_GetADPCMBlock(channel_t * ch, const sfxcache_t * sc, int block)
+{
+    static adpcmblock_t scratch;
+    adpcmblock_t * cached;
+    const int chnum = ch - channels;
+
+    if (chnum >= 0 && chnum < MAX_CHANNELS)
+        cached = &snd_adpcm_blocks[chnum];
+    else
+        cached = &scratch;
+
+    if (cached->sc != sc || cached->block != block)
+    {
+        int count = sc->length - block * ADPCM_BLOCK_SAMPLES;
+        if (count > ADPCM_BLOCK_SAMPLES)
+            count = ADPCM_BLOCK_SAMPLES;
+
+        S_DecodeADPCMBlock(sc->data + block * ADPCM_BLOCK_BYTES, count, cached->pcm);
+        cached->sc = sc;
+        cached->block = block;
+        snd_adpcm_decoded++;
+    }
+
+    return cached->pcm;
+}
+
+void S_PaintChannelFromADPCM(channel_t * ch, sfxcache_t * sc, int count, int offset)
+{
+    int leftvol, rightvol;
+    int * samp;
+
+    leftvol = ch->leftvol * snd_vol;
+    rightvol = ch->rightvol * snd_vol;
+
+    if (!leftvol && !rightvol)
+    {
+        ch->pos += count;
+        return;
+    }
+
+    samp = &paintbuffer[offset].left;
+
+    while (count > 0)
+    {
+        const int block = ch->pos / ADPCM_BLOCK_SAMPLES;
+        const int first = ch->pos - block * ADPCM_BLOCK_SAMPLES;
+        const short * sfx = S_GetADPCMBlock(ch, sc, block) + first;
+        int n = ADPCM_BLOCK_SAMPLES - first;
+        int i;
+
+        if (n > count)
+            n = count;
+
+        for (i = 0; i < n; i++, samp += 2)
+        {
+            samp[0] += (sfx[i] * leftvol) >> 8;
+            samp[1] += (sfx[i] * rightvol) >> 8;
+        }
+
+        ch->pos += n;
+        count -= n;
+    }
+}
@@ -468,15 +468,39 @@ void MSG_ReadDir(sizebuf_t * sb, vec3_t dir)
 
 /*
 ==================
-MSG_WriteDeltaEntity
+MSG_EncodeDeltaEntity
 
-Writes part of a packetentities message.
-Can delta from either a baseline or a previous packet_entity
+PS2: Encodes the delta straight into a small byte buffer instead of going
+through SZ_GetSpace for every field, so the result can also be cached and
+reused by the server when several clients need the same delta. The byte
+layout is unchanged. Returns the number of bytes written to buf (at most
+MAX_ENTITY_DELTA_BYTES), or zero if there was nothing to send.
 ==================
 */
-void MSG_WriteDeltaEntity(entity_state_t * from, entity_state_t * to, sizebuf_t * msg, qboolean force, qboolean newentity)
+static inline byte * MSG_PutShort(byte * p, int c)
+{
+    p[0] = c & 0xff;
+    p[1] = (c >> 8) & 0xff;
+    return p + 2;
+}
+
+static inline byte * MSG_PutLong(byte * p, int c)
+{
+    p[0] = c & 0xff;
+    p[1] = (c >> 8) & 0xff;
+    p[2] = (c >> 16) & 0xff;
+    p[3] = (c >> 24) & 0xff;
+    return p + 4;
+}
+
+#define MSG_PutByte(p, c) (*(p)++ = (byte)(c))
+#define MSG_PutCoord(p, f) ((p) = MSG_PutShort((p), (int)((f)*8)))
+#define MSG_PutAngle(p, f) (*(p)++ = (byte)((int)((f)*256 / 360) & 255))
+
+int MSG_EncodeDeltaEntity(entity_state_t * from, entity_state_t * to, byte * buf, qboolean force, qboolean newentity)
 {
     int bits;
+    byte * p;
 
     if (!to->number)
         Com_Error(ERR_FATAL, "Unset entity number");
@@ -568,7 +592,7 @@ void MSG_WriteDeltaEntity(entity_state_t * from, entity_state_t * to, sizebuf_t
     // write the message
     //
     if (!bits && !force)
-        return; // nothing to send!
+        return 0; // nothing to send!
 
     //----------
 
@@ -579,93 +603,118 @@ void MSG_WriteDeltaEntity(entity_state_t * from, entity_state_t * to, sizebuf_t
     else if (bits & 0x0000ff00)
         bits |= U_MOREBITS1;
 
-    MSG_WriteByte(msg, bits & 255);
+    p = buf;
+    MSG_PutByte(p, bits & 255);
 
     if (bits & 0xff000000)
     {
-        MSG_WriteByte(msg, (bits >> 8) & 255);
-        MSG_WriteByte(msg, (bits >> 16) & 255);
-        MSG_WriteByte(msg, (bits >> 24) & 255);
+        MSG_PutByte(p, (bits >> 8) & 255);
+        MSG_PutByte(p, (bits >> 16) & 255);
+        MSG_PutByte(p, (bits >> 24) & 255);
     }
     else if (bits & 0x00ff0000)
     {
-        MSG_WriteByte(msg, (bits >> 8) & 255);
-        MSG_WriteByte(msg, (bits >> 16) & 255);
+        MSG_PutByte(p, (bits >> 8) & 255);
+        MSG_PutByte(p, (bits >> 16) & 255);
     }
     else if (bits & 0x0000ff00)
     {
-        MSG_WriteByte(msg, (bits >> 8) & 255);
+        MSG_PutByte(p, (bits >> 8) & 255);
     }
 
     //----------
 
     if (bits & U_NUMBER16)
-        MSG_WriteShort(msg, to->number);
+        p = MSG_PutShort(p, to->number);
     else
-        MSG_WriteByte(msg, to->number);
+        MSG_PutByte(p, to->number);
 
     if (bits & U_MODEL)
-        MSG_WriteByte(msg, to->modelindex);
+        MSG_PutByte(p, to->modelindex);
     if (bits & U_MODEL2)
-        MSG_WriteByte(msg, to->modelindex2);
+        MSG_PutByte(p, to->modelindex2);
     if (bits & U_MODEL3)
-        MSG_WriteByte(msg, to->modelindex3);
+        MSG_PutByte(p, to->modelindex3);
     if (bits & U_MODEL4)
-        MSG_WriteByte(msg, to->modelindex4);
+        MSG_PutByte(p, to->modelindex4);
 
     if (bits & U_FRAME8)
-        MSG_WriteByte(msg, to->frame);
+        MSG_PutByte(p, to->frame);
     if (bits & U_FRAME16)
-        MSG_WriteShort(msg, to->frame);
+        p = MSG_PutShort(p, to->frame);
 
     if ((bits & U_SKIN8) && (bits & U_SKIN16)) //used for laser colors
-        MSG_WriteLong(msg, to->skinnum);
+        p = MSG_PutLong(p, to->skinnum);
     else if (bits & U_SKIN8)
-        MSG_WriteByte(msg, to->skinnum);
+        MSG_PutByte(p, to->skinnum);
     else if (bits & U_SKIN16)
-        MSG_WriteShort(msg, to->skinnum);
+        p = MSG_PutShort(p, to->skinnum);
 
     if ((bits & (U_EFFECTS8 | U_EFFECTS16)) == (U_EFFECTS8 | U_EFFECTS16))
-        MSG_WriteLong(msg, to->effects);
+        p = MSG_PutLong(p, to->effects);
     else if (bits & U_EFFECTS8)
-        MSG_WriteByte(msg, to->effects);
+        MSG_PutByte(p, to->effects);
     else if (bits & U_EFFECTS16)
-        MSG_WriteShort(msg, to->effects);
+        p = MSG_PutShort(p, to->effects);
 
     if ((bits & (U_RENDERFX8 | U_RENDERFX16)) == (U_RENDERFX8 | U_RENDERFX16))
-        MSG_WriteLong(msg, to->renderfx);
+        p = MSG_PutLong(p, to->renderfx);
     else if (bits & U_RENDERFX8)
-        MSG_WriteByte(msg, to->renderfx);
+        MSG_PutByte(p, to->renderfx);
     else if (bits & U_RENDERFX16)
-        MSG_WriteShort(msg, to->renderfx);
+        p = MSG_PutShort(p, to->renderfx);
 
     if (bits & U_ORIGIN1)
-        MSG_WriteCoord(msg, to->origin[0]);
+        MSG_PutCoord(p, to->origin[0]);
     if (bits & U_ORIGIN2)
-        MSG_WriteCoord(msg, to->origin[1]);
+        MSG_PutCoord(p, to->origin[1]);
     if (bits & U_ORIGIN3)
-        MSG_WriteCoord(msg, to->origin[2]);
+        MSG_PutCoord(p, to->origin[2]);
 
     if (bits & U_ANGLE1)
-        MSG_WriteAngle(msg, to->angles[0]);
+        MSG_PutAngle(p, to->angles[0]);
     if (bits & U_ANGLE2)
-        MSG_WriteAngle(msg, to->angles[1]);
+        MSG_PutAngle(p, to->angles[1]);
     if (bits & U_ANGLE3)
-        MSG_WriteAngle(msg, to->angles[2]);
+        MSG_PutAngle(p, to->angles[2]);
 
     if (bits & U_OLDORIGIN)
     {
-        MSG_WriteCoord(msg, to->old_origin[0]);
-        MSG_WriteCoord(msg, to->old_origin[1]);
-        MSG_WriteCoord(msg, to->old_origin[2]);
+        MSG_PutCoord(p, to->old_origin[0]);
+        MSG_PutCoord(p, to->old_origin[1]);
+        MSG_PutCoord(p, to->old_origin[2]);
     }
 
     if (bits & U_SOUND)
-        MSG_WriteByte(msg, to->sound);
+        MSG_PutByte(p, to->sound);
     if (bits & U_EVENT)
-        MSG_WriteByte(msg, to->event);
+        MSG_PutByte(p, to->event);
     if (bits & U_SOLID)
-        MSG_WriteShort(msg, to->solid);
+        p = MSG_PutShort(p, to->solid);
+
+    return p - buf;
+}
+
+#undef MSG_PutByte
+#undef MSG_PutCoord
+#undef MSG_PutAngle
+
+/*
+==================
+MSG_WriteDeltaEntity
+
+Writes part of a packetentities message.
+Can delta from either a baseline or a previous packet_entity
+==================
+*/
+void MSG_WriteDeltaEntity(entity_state_t * from, entity_state_t * to, sizebuf_t * msg, qboolean force, qboolean newentity)
+{
+    byte buf[MAX_ENTITY_DELTA_BYTES];
+    int len;
+
+    len = MSG_EncodeDeltaEntity(from, to, buf, force, newentity);
+    if (len > 0)
+        SZ_Write(msg, buf, len);
 }
 
 //============================================================
@@ -1602,6 +1651,7 @@ void Qcommon_Frame(int msec)
     }
 
     SV_Frame(msec);
+    NET_FlushPackets();
 
     if (host_speeds->value)
     {
@@ -1609,6 +1659,7 @@ void Qcommon_Frame(int msec)
     }
 
     CL_Frame(msec);
+    NET_FlushPackets();
 /*
     if (host_speeds->value)
     {
@@ -1631,6 +1682,41 @@ void Qcommon_Frame(int msec)
 */
 }
 
+/*
+=================
+Qcommon_IdleMsec
+
+Real time in milliseconds until either the server needs to run its next
+tick or the client wants to run its next frame. Zero means a frame should
+run right away. Used by the main loop to sleep instead of spinning.
+=================
+*/
+int Qcommon_IdleMsec(void)
+{
+    int idle;
+    int cl_idle;
+
+    if (fixedtime->value)
+    {
+        return 0;
+    }
+
+    idle = SV_IdleMsec();
+    cl_idle = CL_IdleMsec();
+    if (cl_idle < idle)
+    {
+        idle = cl_idle;
+    }
+
+    // Frame times get scaled by timescale in Qcommon_Frame.
+    if (timescale->value > 0 && timescale->value != 1)
+    {
+        idle = (int)(idle / timescale->value);
+    }
+
+    return idle;
+}
+
 /*
 =================
 Qcommon_Shutdown
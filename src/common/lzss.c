@@ -0,0 +1,166 @@
+/* ================================================================================================
+ * -*- C -*-
+ * File: lzss.c
+ * Brief: LZSS coder shared by the save games, the built-in textures and tools/imgdump.c.
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#include "common/q_lzss.h"
+
+enum
+{
+    LZ_HASH_BITS = 12,
+    LZ_HASH_SIZE = 1 << LZ_HASH_BITS
+};
+
+// most recent position of each 3 byte hash, and the
+// position before it with the same hash, by window slot
+static int lz_head[LZ_HASH_SIZE];
+static int lz_prev[LZ_WINDOW];
+
+static inline int LZ_Hash(const unsigned char * p)
+{
+    const unsigned v = p[0] | (p[1] << 8) | (p[2] << 16);
+    return (v * 2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+static inline void LZ_Insert(const unsigned char * in, int pos)
+{
+    const int h = LZ_Hash(in + pos);
+    lz_prev[pos & (LZ_WINDOW - 1)] = lz_head[h];
+    lz_head[h] = pos;
+}
+
+/*
+==============
+LZ_Compress
+
+Candidates are tried nearest first and only a longer match replaces
+the one found, so equal lengths keep the shortest distance. The
+position being coded goes into the tables after the search, which
+keeps every chain link in the window valid.
+==============
+*/
+int LZ_Compress(const unsigned char * in, int inlen, unsigned char * out, int max_tries)
+{
+    int ip, op, flagpos, bit;
+    int cand, tries, len, best, maxlen, dist, k;
+
+    for (k = 0; k < LZ_HASH_SIZE; k++)
+        lz_head[k] = -1;
+
+    ip = op = 0;
+    while (ip < inlen)
+    {
+        flagpos = op++;
+        out[flagpos] = 0;
+
+        for (bit = 0; bit < 8 && ip < inlen; bit++)
+        {
+            best = 0;
+            dist = 0;
+
+            if (ip + LZ_MIN_MATCH <= inlen)
+            {
+                maxlen = inlen - ip;
+                if (maxlen > LZ_MAX_MATCH)
+                    maxlen = LZ_MAX_MATCH;
+
+                cand = lz_head[LZ_Hash(in + ip)];
+                for (tries = max_tries; cand >= 0 && ip - cand <= LZ_WINDOW && tries > 0; tries--)
+                {
+                    len = 0;
+                    while (len < maxlen && in[cand + len] == in[ip + len])
+                        len++;
+                    if (len > best)
+                    {
+                        best = len;
+                        dist = ip - cand;
+                        if (best == maxlen)
+                            break;
+                    }
+                    cand = lz_prev[cand & (LZ_WINDOW - 1)];
+                }
+
+                LZ_Insert(in, ip);
+            }
+
+            if (best < LZ_MIN_MATCH)
+            {
+                out[op++] = in[ip++];
+                continue;
+            }
+
+            out[flagpos] |= 1 << bit;
+            out[op++] = (dist - 1) & 0xFF;
+            if (best <= LZ_SHORT_MATCH)
+            {
+                out[op++] = ((dist - 1) >> 8) | ((best - LZ_MIN_MATCH) << 4);
+            }
+            else
+            {
+                out[op++] = ((dist - 1) >> 8) | 0xF0;
+                out[op++] = best - LZ_SHORT_MATCH - 1;
+            }
+
+            // keep the chains warm inside the match
+            for (k = 1; k < best && ip + k + LZ_MIN_MATCH <= inlen; k++)
+                LZ_Insert(in, ip + k);
+
+            ip += best;
+        }
+    }
+
+    return op;
+}
+
+/*
+==============
+LZ_Decompress
+==============
+*/
+int LZ_Decompress(const unsigned char * in, int inlen, unsigned char * out, int outlen)
+{
+    int ip, op, bit, flags;
+    int dist, len;
+
+    ip = op = 0;
+    while (ip < inlen)
+    {
+        flags = in[ip++];
+
+        for (bit = 0; bit < 8 && ip < inlen; bit++)
+        {
+            if (!(flags & (1 << bit)))
+            {
+                if (op >= outlen)
+                    return -1;
+                out[op++] = in[ip++];
+                continue;
+            }
+
+            if (ip + 2 > inlen)
+                return -1;
+            dist = (in[ip] | ((in[ip + 1] & 0x0F) << 8)) + 1;
+            len = (in[ip + 1] >> 4) + LZ_MIN_MATCH;
+            ip += 2;
+            if (len > LZ_SHORT_MATCH)
+            {
+                if (ip >= inlen)
+                    return -1;
+                len = in[ip++] + LZ_SHORT_MATCH + 1;
+            }
+
+            if (dist > op || op + len > outlen)
+                return -1;
+
+            // byte by byte, references can overlap the output
+            for (; len > 0; len--, op++)
+                out[op] = out[op - dist];
+        }
+    }
+
+    return op;
+}
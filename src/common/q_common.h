@@ -120,6 +120,14 @@ void MSG_WriteAngle(sizebuf_t * sb, float f);
 void MSG_WriteAngle16(sizebuf_t * sb, float f);
 void MSG_WriteDeltaUsercmd(sizebuf_t * sb, struct usercmd_s * from, struct usercmd_s * cmd);
 void MSG_WriteDeltaEntity(struct entity_state_s * from, struct entity_state_s * to, sizebuf_t * msg, qboolean force, qboolean newentity);
+
+// Worst case size of an encoded entity delta: 4 bytes of header bits,
+// a 16 bit number and every field at its largest encoding.
+enum
+{
+    MAX_ENTITY_DELTA_BYTES = 48
+};
+int MSG_EncodeDeltaEntity(struct entity_state_s * from, struct entity_state_s * to, byte * buf, qboolean force, qboolean newentity);
 void MSG_WriteDir(sizebuf_t * sb, vec3_t vector);
 void MSG_BeginReading(sizebuf_t * sb);
 int MSG_ReadChar(sizebuf_t * sb);
@@ -560,6 +568,7 @@ void NET_Sleep(int msec);
 
 qboolean NET_GetPacket(netsrc_t sock, netadr_t * net_from, sizebuf_t * net_message);
 void NET_SendPacket(netsrc_t sock, int length, const void * data, netadr_t to);
+void NET_FlushPackets(void); // sends datagrams batched by NET_SendPacket, if any
 
 qboolean NET_CompareAdr(netadr_t a, netadr_t b);
 qboolean NET_CompareBaseAdr(netadr_t a, netadr_t b);
@@ -777,6 +786,7 @@ void Z_FreeTags(int tag);
 
 void Qcommon_Init(int argc, char ** argv);
 void Qcommon_Frame(int msec);
+int Qcommon_IdleMsec(void); // how long until the server or client has work to do
 void Qcommon_Shutdown(void);
 
 #define NUMVERTEXNORMALS 162
@@ -807,6 +817,9 @@ void Sys_SendKeyEvents(void);
 void Sys_Error(const char * error, ...) Q_PRINTF_FUNC(1, 2);
 void Sys_Quit(void);
 
+// blocks the calling thread for roughly msec milliseconds
+void Sys_SleepMsec(int msec);
+
 char * Sys_GetClipboardData(void);
 void Sys_CopyProtect(void);
 
@@ -822,11 +835,13 @@ void CL_Init(void);
 void CL_Drop(void);
 void CL_Shutdown(void);
 void CL_Frame(int msec);
+int CL_IdleMsec(void);
 void Con_Print(char * text);
 void SCR_BeginLoadingPlaque(void);
 
 void SV_Init(void);
 void SV_Shutdown(char * finalmsg, qboolean reconnect);
 void SV_Frame(int msec);
+int SV_IdleMsec(void);
 
 #endif // Q_COMMON_H
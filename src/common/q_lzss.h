@@ -0,0 +1,43 @@
+/* ================================================================================================
+ * -*- C -*-
+ * File: q_lzss.h
+ * Brief: LZSS coder shared by the save games, the built-in textures and tools/imgdump.c.
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#ifndef Q_LZSS_H
+#define Q_LZSS_H
+
+//
+// A control byte holds flags for the next 8 items, each one either a
+// literal byte or a back reference into the last 4K of output. A reference
+// is 2 bytes (12 bits distance - 1, 4 bits length - 3), length bits all
+// set means an extra byte follows with the length - 18.
+//
+// Only plain C, so the host tools build it as is.
+//
+
+enum
+{
+    LZ_WINDOW      = 4096,
+    LZ_MIN_MATCH   = 3,
+    LZ_SHORT_MATCH = LZ_MIN_MATCH + 14,
+    LZ_MAX_MATCH   = LZ_SHORT_MATCH + 1 + 255
+};
+
+// Compressed data can grow by one control byte every 8 literals.
+#define LZ_BOUND(len) ((len) + (len) / 8 + 16)
+
+// Compresses 'inlen' bytes into 'out', which must have LZ_BOUND(inlen) bytes.
+// 'max_tries' is how many earlier positions starting with the same bytes are
+// tried for each match: 1 is fast, LZ_WINDOW finds the longest match there is.
+// Returns the compressed length. Not reentrant, the match tables are static.
+int LZ_Compress(const unsigned char * in, int inlen, unsigned char * out, int max_tries);
+
+// Returns the decompressed length, or -1 if the data is malformed
+// or doesn't fit in 'outlen' bytes.
+int LZ_Decompress(const unsigned char * in, int inlen, unsigned char * out, int outlen);
+
+#endif // Q_LZSS_H
@@ -520,6 +520,8 @@ extern cvar_t * flood_msgs;
 extern cvar_t * flood_persecond;
 extern cvar_t * flood_waitdelay;
 extern cvar_t * sv_maplist;
+extern cvar_t * g_savecompress;
+extern cvar_t * g_savestats;
 
 #define world (&g_edicts[0])
 
@@ -732,6 +734,16 @@ void ClientBeginServerFrame(edict_t * ent);
 void player_pain(edict_t * self, edict_t * other, float kick, int damage);
 void player_die(edict_t * self, edict_t * inflictor, edict_t * attacker, int damage, vec3_t point);
 
+//
+// g_save.c
+//
+void Svcmd_SaveBench_f(void);
+
+//
+// g_spawn.c
+//
+unsigned ED_HashSpawnFunctions(unsigned hash, byte * base);
+
 //
 // g_svcmds.c
 //
@@ -63,6 +63,8 @@ cvar_t * flood_msgs;
 cvar_t * flood_persecond;
 cvar_t * flood_waitdelay;
 cvar_t * sv_maplist;
+cvar_t * g_savecompress;
+cvar_t * g_savestats;
 
 void SpawnEntities(char * mapname, char * entities, char * spawnpoint);
 void ClientThink(edict_t * ent, usercmd_t * cmd);
@@ -19,6 +19,7 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 */
 
 #include "g_local.h"
+#include "common/q_lzss.h"
 
 #define Function(f) \
     {               \
@@ -204,6 +205,10 @@ void InitGame(void)
     // dm map list
     sv_maplist = gi.cvar("sv_maplist", "", 0);
 
+    // savegames
+    g_savecompress = gi.cvar("g_savecompress", "1", CVAR_ARCHIVE);
+    g_savestats = gi.cvar("g_savestats", "0", 0);
+
     // items
     InitItems();
 
@@ -227,7 +232,445 @@ void InitGame(void)
 
 //=========================================================
 
-void WriteField1(FILE * f, field_t * field, byte * base)
+/*
+==============================================================================
+
+SAVEGAME FILES
+
+A save file is a fixed header followed by a payload of tagged chunks.
+The payload is built in memory and written out with a single fwrite,
+optionally LZ compressed, since the memory card is very slow with lots
+of small writes. The loader reads the whole file in one go, validates
+the header, checksum, structure sizes and build, then parses the chunks
+straight out of the buffer.
+
+Bump SAVE_VERSION whenever a saved structure or the chunk layout changes.
+
+==============================================================================
+*/
+
+#define SAVE_TAG(a, b, c, d) (((d) << 24) + ((c) << 16) + ((b) << 8) + (a))
+
+enum
+{
+    SAVE_IDENT = SAVE_TAG('Q', '2', 'S', 'V'),
+    SAVE_VERSION = 2,
+
+    // header flags
+    SAVE_LZ = 1,
+
+    // chunk tags
+    CHUNK_SCHEMA = SAVE_TAG('S', 'C', 'H', 'M'),
+    CHUNK_GAME = SAVE_TAG('G', 'A', 'M', 'E'),
+    CHUNK_CLIENTS = SAVE_TAG('C', 'L', 'N', 'T'),
+    CHUNK_LEVEL = SAVE_TAG('L', 'E', 'V', 'L'),
+    CHUNK_EDICTS = SAVE_TAG('E', 'D', 'C', 'T'),
+
+    SAVE_INITIAL_SIZE = 64 * 1024
+};
+
+typedef struct
+{
+    int ident;
+    int version;
+    int flags;
+    int size;          // uncompressed payload bytes
+    int disksize;      // payload bytes following the header
+    unsigned checksum; // of the uncompressed payload
+} savehdr_t;
+
+typedef struct
+{
+    byte * data;
+    int cursize;
+    int maxsize;
+    int readcount;
+    int tag; // memory tag the buffer was allocated with
+} savebuf_t;
+
+static void SaveBuf_Init(savebuf_t * sb, int size, int tag)
+{
+    sb->data = gi.TagMalloc(size, tag);
+    sb->cursize = 0;
+    sb->maxsize = size;
+    sb->readcount = 0;
+    sb->tag = tag;
+}
+
+static void SaveBuf_Free(savebuf_t * sb)
+{
+    if (sb->data)
+    {
+        gi.TagFree(sb->data);
+        sb->data = NULL;
+    }
+    sb->cursize = sb->maxsize = sb->readcount = 0;
+}
+
+static void * SaveBuf_GetSpace(savebuf_t * sb, int length)
+{
+    void * p;
+    byte * data;
+    int newsize;
+
+    if (sb->cursize + length > sb->maxsize)
+    {
+        newsize = sb->maxsize * 2;
+        while (newsize < sb->cursize + length)
+            newsize *= 2;
+
+        data = gi.TagMalloc(newsize, sb->tag);
+        memcpy(data, sb->data, sb->cursize);
+        gi.TagFree(sb->data);
+        sb->data = data;
+        sb->maxsize = newsize;
+    }
+
+    p = sb->data + sb->cursize;
+    sb->cursize += length;
+    return p;
+}
+
+static void SaveBuf_Write(savebuf_t * sb, const void * data, int length)
+{
+    memcpy(SaveBuf_GetSpace(sb, length), data, length);
+}
+
+static void SaveBuf_WriteInt(savebuf_t * sb, int i)
+{
+    SaveBuf_Write(sb, &i, sizeof(i));
+}
+
+static int SaveBuf_BeginChunk(savebuf_t * sb, int tag)
+{
+    SaveBuf_WriteInt(sb, tag);
+    SaveBuf_WriteInt(sb, 0); // patched by SaveBuf_EndChunk
+    return sb->cursize;
+}
+
+static void SaveBuf_EndChunk(savebuf_t * sb, int start)
+{
+    const int length = sb->cursize - start;
+    memcpy(sb->data + start - sizeof(int), &length, sizeof(length));
+}
+
+static const void * SaveBuf_Read(savebuf_t * sb, int length)
+{
+    const void * p;
+
+    if (length < 0 || sb->readcount + length > sb->cursize)
+        gi.error("Savegame is truncated or corrupt");
+
+    p = sb->data + sb->readcount;
+    sb->readcount += length;
+    return p;
+}
+
+static int SaveBuf_ReadInt(savebuf_t * sb)
+{
+    int i;
+    memcpy(&i, SaveBuf_Read(sb, sizeof(i)), sizeof(i));
+    return i;
+}
+
+/*
+==============
+SaveBuf_ReadChunk
+
+Checks that the next chunk is the expected one and returns its length.
+==============
+*/
+static int SaveBuf_ReadChunk(savebuf_t * sb, int tag)
+{
+    int t, length;
+
+    t = SaveBuf_ReadInt(sb);
+    length = SaveBuf_ReadInt(sb);
+
+    if (t != tag)
+        gi.error("Savegame has chunk %.4s where %.4s was expected", (char *)&t, (char *)&tag);
+    if (length < 0 || sb->readcount + length > sb->cursize)
+        gi.error("Savegame chunk %.4s is truncated", (char *)&tag);
+
+    return length;
+}
+
+/*
+==============================================================================
+
+LZ compression for the save payload (common/lzss.c). Edicts are mostly
+zeros and repeated strings, so this gets a level down to a fraction of
+its size for very little CPU. Only the latest position with the same
+hash is tried for each match, to keep saving fast.
+
+==============================================================================
+*/
+
+#define SAVE_LZ_TRIES 1
+
+static unsigned Save_Checksum(const byte * data, int length)
+{
+    unsigned h = 2166136261u;
+    int i;
+
+    for (i = 0; i < length; i++)
+        h = (h ^ data[i]) * 16777619u;
+
+    return h;
+}
+
+//=========================================================
+
+static void Save_InitBuffer(savebuf_t * sb)
+{
+    // leave room for the header so an uncompressed file goes out as is
+    SaveBuf_Init(sb, SAVE_INITIAL_SIZE, TAG_GAME);
+    SaveBuf_GetSpace(sb, sizeof(savehdr_t));
+}
+
+/*
+==============
+Save_LayoutId
+
+Function and mmove pointers are saved as offsets from InitGame and
+mmove_reloc, which only mean the same thing in the build that wrote
+them. This hashes the build stamp and the offsets of every spawn and
+item function, so a save from any other build is refused.
+==============
+*/
+static unsigned Save_LayoutId(void)
+{
+    const char * stamp = __DATE__ " " __TIME__;
+    byte * base = (byte *)InitGame;
+    unsigned hash = 2166136261u;
+    gitem_t * item;
+    int i;
+
+#define LAYOUT_HASH(x) (hash = (hash ^ (unsigned)(x)) * 16777619u)
+
+    while (*stamp)
+        LAYOUT_HASH(*stamp++);
+
+    hash = ED_HashSpawnFunctions(hash, base);
+
+    for (i = 0, item = itemlist; i < game.num_items; i++, item++)
+    {
+        LAYOUT_HASH(item->pickup ? (byte *)item->pickup - base : 0);
+        LAYOUT_HASH(item->use ? (byte *)item->use - base : 0);
+        LAYOUT_HASH(item->drop ? (byte *)item->drop - base : 0);
+        LAYOUT_HASH(item->weaponthink ? (byte *)item->weaponthink - base : 0);
+    }
+
+    // mmoves live in the data of the monster files
+    LAYOUT_HASH((byte *)itemlist - (byte *)&mmove_reloc);
+    LAYOUT_HASH((byte *)&level - (byte *)&mmove_reloc);
+
+#undef LAYOUT_HASH
+
+    return hash;
+}
+
+/*
+==============
+Save_WriteSchema
+
+Sizes of everything that is dumped as a raw structure and the code
+layout id, so a save from a build with a different layout is refused
+instead of loaded as garbage.
+==============
+*/
+static void Save_WriteSchema(savebuf_t * sb)
+{
+    const int start = SaveBuf_BeginChunk(sb, CHUNK_SCHEMA);
+
+    SaveBuf_WriteInt(sb, sizeof(game_locals_t));
+    SaveBuf_WriteInt(sb, sizeof(level_locals_t));
+    SaveBuf_WriteInt(sb, sizeof(gclient_t));
+    SaveBuf_WriteInt(sb, sizeof(edict_t));
+    SaveBuf_WriteInt(sb, (int)Save_LayoutId());
+
+    SaveBuf_EndChunk(sb, start);
+}
+
+static void Save_CheckSchema(savebuf_t * sb)
+{
+    if (SaveBuf_ReadChunk(sb, CHUNK_SCHEMA) != 5 * (int)sizeof(int))
+        gi.error("Savegame schema is not supported");
+
+    if (SaveBuf_ReadInt(sb) != sizeof(game_locals_t) ||
+        SaveBuf_ReadInt(sb) != sizeof(level_locals_t) ||
+        SaveBuf_ReadInt(sb) != sizeof(gclient_t) ||
+        SaveBuf_ReadInt(sb) != sizeof(edict_t))
+    {
+        gi.error("Savegame from a build with mismatched structures");
+    }
+
+    if ((unsigned)SaveBuf_ReadInt(sb) != Save_LayoutId())
+        gi.error("Savegame from a different build of the game");
+}
+
+/*
+==============
+Save_WriteFile
+
+Fills in the header, compresses the payload if enabled and writes
+the whole thing with a single fwrite. Returns the file size.
+==============
+*/
+static int Save_WriteFile(const char * filename, savebuf_t * sb, const char * what, int start_time)
+{
+    FILE * f;
+    savehdr_t * hdr;
+    byte * out;
+    int outsize;
+    int compress_time;
+    const int hdrsize = sizeof(savehdr_t);
+    const int size = sb->cursize - hdrsize;
+
+    compress_time = Sys_Milliseconds();
+
+    out = sb->data;
+    outsize = sb->cursize;
+    hdr = (savehdr_t *)sb->data;
+    hdr->ident = SAVE_IDENT;
+    hdr->version = SAVE_VERSION;
+    hdr->flags = 0;
+    hdr->size = size;
+    hdr->disksize = size;
+    hdr->checksum = Save_Checksum(sb->data + hdrsize, size);
+
+    if (g_savecompress->value)
+    {
+        byte * packed = gi.TagMalloc(hdrsize + LZ_BOUND(size), TAG_GAME);
+        const int packedsize = LZ_Compress(sb->data + hdrsize, size, packed + hdrsize, SAVE_LZ_TRIES);
+
+        if (packedsize < size)
+        {
+            hdr->flags |= SAVE_LZ;
+            hdr->disksize = packedsize;
+            memcpy(packed, hdr, hdrsize);
+            out = packed;
+            outsize = hdrsize + packedsize;
+        }
+        else
+        {
+            gi.TagFree(packed);
+        }
+    }
+
+    compress_time = Sys_Milliseconds() - compress_time;
+
+    f = fopen(filename, "wb");
+    if (!f)
+    {
+        if (out != sb->data)
+            gi.TagFree(out);
+        SaveBuf_Free(sb);
+        gi.error("Couldn't open %s", filename);
+    }
+
+    fwrite(out, outsize, 1, f);
+    fclose(f);
+
+    if (g_savestats->value)
+    {
+        gi.dprintf("%s: %i bytes, %i on disk%s, %i ms (%i ms compressing)\n", what, size, outsize,
+                   (hdr->flags & SAVE_LZ) ? " (lz)" : "", Sys_Milliseconds() - start_time, compress_time);
+    }
+
+    if (out != sb->data)
+        gi.TagFree(out);
+    SaveBuf_Free(sb);
+
+    return outsize;
+}
+
+/*
+==============
+Save_ReadFile
+
+Reads and validates a whole save file, leaving the uncompressed
+payload in sb ready for parsing. The buffer is allocated with the
+given memory tag so an error halfway through a load does not leak it
+past the next level change.
+==============
+*/
+static void Save_ReadFile(const char * filename, savebuf_t * sb, int tag)
+{
+    FILE * f;
+    savehdr_t hdr;
+    byte * packed;
+    int filesize;
+
+    f = fopen(filename, "rb");
+    if (!f)
+        gi.error("Couldn't open %s", filename);
+
+    fseek(f, 0, SEEK_END);
+    filesize = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    if (filesize < (int)sizeof(hdr) || fread(&hdr, sizeof(hdr), 1, f) != 1)
+    {
+        fclose(f);
+        gi.error("%s is not a savegame", filename);
+    }
+    if (hdr.ident != SAVE_IDENT)
+    {
+        fclose(f);
+        gi.error("%s is not a savegame", filename);
+    }
+    if (hdr.version != SAVE_VERSION)
+    {
+        fclose(f);
+        gi.error("Savegame version %i, expected %i", hdr.version, SAVE_VERSION);
+    }
+    if (hdr.size < 0 || hdr.disksize < 0 || hdr.disksize != filesize - (int)sizeof(hdr))
+    {
+        fclose(f);
+        gi.error("Savegame %s is truncated", filename);
+    }
+
+    SaveBuf_Init(sb, hdr.size + 1, tag);
+    sb->cursize = hdr.size;
+
+    if (!(hdr.flags & SAVE_LZ))
+    {
+        if (hdr.size != hdr.disksize || fread(sb->data, hdr.size, 1, f) != 1)
+        {
+            fclose(f);
+            SaveBuf_Free(sb);
+            gi.error("Savegame %s is truncated", filename);
+        }
+        fclose(f);
+    }
+    else
+    {
+        packed = gi.TagMalloc(hdr.disksize + 1, tag);
+        if (fread(packed, hdr.disksize, 1, f) != 1 ||
+            LZ_Decompress(packed, hdr.disksize, sb->data, hdr.size) != hdr.size)
+        {
+            fclose(f);
+            gi.TagFree(packed);
+            SaveBuf_Free(sb);
+            gi.error("Savegame %s is corrupt", filename);
+        }
+        fclose(f);
+        gi.TagFree(packed);
+    }
+
+    if (Save_Checksum(sb->data, sb->cursize) != hdr.checksum)
+    {
+        SaveBuf_Free(sb);
+        gi.error("Savegame %s is corrupt", filename);
+    }
+
+    Save_CheckSchema(sb);
+}
+
+//=========================================================
+
+void WriteField1(field_t * field, byte * base)
 {
     void * p;
     int len;
@@ -299,7 +742,7 @@ void WriteField1(FILE * f, field_t * field, byte * base)
     }
 }
 
-void WriteField2(FILE * f, field_t * field, byte * base)
+void WriteField2(savebuf_t * sb, field_t * field, byte * base)
 {
     int len;
     void * p;
@@ -314,13 +757,13 @@ void WriteField2(FILE * f, field_t * field, byte * base)
         if (*(char **)p)
         {
             len = strlen(*(char **)p) + 1;
-            fwrite(*(char **)p, len, 1, f);
+            SaveBuf_Write(sb, *(char **)p, len);
         }
         break;
     }
 }
 
-void ReadField(FILE * f, field_t * field, byte * base)
+void ReadField(savebuf_t * sb, field_t * field, byte * base)
 {
     void * p;
     int len;
@@ -346,13 +789,16 @@ void ReadField(FILE * f, field_t * field, byte * base)
         else
         {
             *(char **)p = gi.TagMalloc(len, TAG_LEVEL);
-            fread(*(char **)p, len, 1, f);
+            memcpy(*(char **)p, SaveBuf_Read(sb, len), len);
+            (*(char **)p)[len - 1] = 0;
         }
         break;
     case F_EDICT:
         index = *(int *)p;
         if (index == -1)
             *(edict_t **)p = NULL;
+        else if (index < 0 || index >= game.maxentities)
+            gi.error("ReadField: bad edict index %i in %s", index, field->name);
         else
             *(edict_t **)p = &g_edicts[index];
         break;
@@ -360,6 +806,8 @@ void ReadField(FILE * f, field_t * field, byte * base)
         index = *(int *)p;
         if (index == -1)
             *(gclient_t **)p = NULL;
+        else if (index < 0 || index >= game.maxclients)
+            gi.error("ReadField: bad client index %i in %s", index, field->name);
         else
             *(gclient_t **)p = &game.clients[index];
         break;
@@ -367,6 +815,8 @@ void ReadField(FILE * f, field_t * field, byte * base)
         index = *(int *)p;
         if (index == -1)
             *(gitem_t **)p = NULL;
+        else if (index < 0 || index >= game.num_items)
+            gi.error("ReadField: bad item index %i in %s", index, field->name);
         else
             *(gitem_t **)p = &itemlist[index];
         break;
@@ -403,7 +853,7 @@ WriteClient
 All pointer variables (except function pointers) must be handled specially.
 ==============
 */
-void WriteClient(FILE * f, gclient_t * client)
+void WriteClient(savebuf_t * sb, gclient_t * client)
 {
     field_t * field;
     gclient_t temp;
@@ -414,16 +864,16 @@ void WriteClient(FILE * f, gclient_t * client)
     // change the pointers to lengths or indexes
     for (field = clientfields; field->name; field++)
     {
-        WriteField1(f, field, (byte *)&temp);
+        WriteField1(field, (byte *)&temp);
     }
 
     // write the block
-    fwrite(&temp, sizeof(temp), 1, f);
+    SaveBuf_Write(sb, &temp, sizeof(temp));
 
-    // now write any allocated data following the edict
+    // now write any allocated data following the client
     for (field = clientfields; field->name; field++)
     {
-        WriteField2(f, field, (byte *)client);
+        WriteField2(sb, field, (byte *)client);
     }
 }
 
@@ -434,15 +884,15 @@ ReadClient
 All pointer variables (except function pointers) must be handled specially.
 ==============
 */
-void ReadClient(FILE * f, gclient_t * client)
+void ReadClient(savebuf_t * sb, gclient_t * client)
 {
     field_t * field;
 
-    fread(client, sizeof(*client), 1, f);
+    memcpy(client, SaveBuf_Read(sb, sizeof(*client)), sizeof(*client));
 
     for (field = clientfields; field->name; field++)
     {
-        ReadField(f, field, (byte *)client);
+        ReadField(sb, field, (byte *)client);
     }
 }
 
@@ -462,59 +912,63 @@ last save position.
 */
 void WriteGame(char * filename, qboolean autosave)
 {
-    FILE * f;
-    int i;
-    char str[16];
+    savebuf_t sb;
+    int i, start, start_time;
+
+    start_time = Sys_Milliseconds();
 
     if (!autosave)
         SaveClientData();
 
-    f = fopen(filename, "wb");
-    if (!f)
-        gi.error("Couldn't open %s", filename);
-
-    memset(str, 0, sizeof(str));
-    strcpy(str, __DATE__);
-    fwrite(str, sizeof(str), 1, f);
+    Save_InitBuffer(&sb);
+    Save_WriteSchema(&sb);
 
+    start = SaveBuf_BeginChunk(&sb, CHUNK_GAME);
     game.autosaved = autosave;
-    fwrite(&game, sizeof(game), 1, f);
+    SaveBuf_Write(&sb, &game, sizeof(game));
     game.autosaved = false;
+    SaveBuf_EndChunk(&sb, start);
 
+    start = SaveBuf_BeginChunk(&sb, CHUNK_CLIENTS);
     for (i = 0; i < game.maxclients; i++)
-        WriteClient(f, &game.clients[i]);
+        WriteClient(&sb, &game.clients[i]);
+    SaveBuf_EndChunk(&sb, start);
 
-    fclose(f);
+    Save_WriteFile(filename, &sb, "WriteGame", start_time);
 }
 
 void ReadGame(char * filename)
 {
-    FILE * f;
-    int i;
-    char str[16];
+    savebuf_t sb;
+    int i, start_time;
+
+    start_time = Sys_Milliseconds();
 
     gi.FreeTags(TAG_GAME);
 
-    f = fopen(filename, "rb");
-    if (!f)
-        gi.error("Couldn't open %s", filename);
+    Save_ReadFile(filename, &sb, TAG_GAME);
 
-    fread(str, sizeof(str), 1, f);
-    if (strcmp(str, __DATE__))
-    {
-        fclose(f);
-        gi.error("Savegame from an older version.\n");
-    }
+    if (SaveBuf_ReadChunk(&sb, CHUNK_GAME) != sizeof(game))
+        gi.error("ReadGame: mismatched game size");
 
     g_edicts = gi.TagMalloc(game.maxentities * sizeof(g_edicts[0]), TAG_GAME);
     globals.edicts = g_edicts;
 
-    fread(&game, sizeof(game), 1, f);
+    memcpy(&game, SaveBuf_Read(&sb, sizeof(game)), sizeof(game));
+
+    if (game.maxclients < 1 || game.maxclients > MAX_CLIENTS)
+        gi.error("ReadGame: bad maxclients %i", game.maxclients);
+    if (SaveBuf_ReadChunk(&sb, CHUNK_CLIENTS) < game.maxclients * (int)sizeof(gclient_t))
+        gi.error("ReadGame: missing clients");
+
     game.clients = gi.TagMalloc(game.maxclients * sizeof(game.clients[0]), TAG_GAME);
     for (i = 0; i < game.maxclients; i++)
-        ReadClient(f, &game.clients[i]);
+        ReadClient(&sb, &game.clients[i]);
 
-    fclose(f);
+    SaveBuf_Free(&sb);
+
+    if (g_savestats->value)
+        gi.dprintf("ReadGame: %i ms\n", Sys_Milliseconds() - start_time);
 }
 
 //==========================================================
@@ -526,7 +980,7 @@ WriteEdict
 All pointer variables (except function pointers) must be handled specially.
 ==============
 */
-void WriteEdict(FILE * f, edict_t * ent)
+void WriteEdict(savebuf_t * sb, edict_t * ent)
 {
     field_t * field;
     edict_t temp;
@@ -537,16 +991,16 @@ void WriteEdict(FILE * f, edict_t * ent)
     // change the pointers to lengths or indexes
     for (field = fields; field->name; field++)
     {
-        WriteField1(f, field, (byte *)&temp);
+        WriteField1(field, (byte *)&temp);
     }
 
     // write the block
-    fwrite(&temp, sizeof(temp), 1, f);
+    SaveBuf_Write(sb, &temp, sizeof(temp));
 
     // now write any allocated data following the edict
     for (field = fields; field->name; field++)
     {
-        WriteField2(f, field, (byte *)ent);
+        WriteField2(sb, field, (byte *)ent);
     }
 }
 
@@ -557,7 +1011,7 @@ WriteLevelLocals
 All pointer variables (except function pointers) must be handled specially.
 ==============
 */
-void WriteLevelLocals(FILE * f)
+void WriteLevelLocals(savebuf_t * sb)
 {
     field_t * field;
     level_locals_t temp;
@@ -568,16 +1022,16 @@ void WriteLevelLocals(FILE * f)
     // change the pointers to lengths or indexes
     for (field = levelfields; field->name; field++)
     {
-        WriteField1(f, field, (byte *)&temp);
+        WriteField1(field, (byte *)&temp);
     }
 
     // write the block
-    fwrite(&temp, sizeof(temp), 1, f);
+    SaveBuf_Write(sb, &temp, sizeof(temp));
 
-    // now write any allocated data following the edict
+    // now write any allocated data following the level
     for (field = levelfields; field->name; field++)
     {
-        WriteField2(f, field, (byte *)&level);
+        WriteField2(sb, field, (byte *)&level);
     }
 }
 
@@ -588,15 +1042,15 @@ ReadEdict
 All pointer variables (except function pointers) must be handled specially.
 ==============
 */
-void ReadEdict(FILE * f, edict_t * ent)
+void ReadEdict(savebuf_t * sb, edict_t * ent)
 {
     field_t * field;
 
-    fread(ent, sizeof(*ent), 1, f);
+    memcpy(ent, SaveBuf_Read(sb, sizeof(*ent)), sizeof(*ent));
 
     for (field = fields; field->name; field++)
     {
-        ReadField(f, field, (byte *)ent);
+        ReadField(sb, field, (byte *)ent);
     }
 }
 
@@ -607,59 +1061,70 @@ ReadLevelLocals
 All pointer variables (except function pointers) must be handled specially.
 ==============
 */
-void ReadLevelLocals(FILE * f)
+void ReadLevelLocals(savebuf_t * sb)
 {
     field_t * field;
 
-    fread(&level, sizeof(level), 1, f);
+    memcpy(&level, SaveBuf_Read(sb, sizeof(level)), sizeof(level));
 
     for (field = levelfields; field->name; field++)
     {
-        ReadField(f, field, (byte *)&level);
+        ReadField(sb, field, (byte *)&level);
     }
 }
 
 /*
 =================
-WriteLevel
+WriteLevelBuffer
 
+Serializes the level locals and every entity in use.
 =================
 */
-void WriteLevel(char * filename)
+static int WriteLevelBuffer(savebuf_t * sb)
 {
-    int i;
+    int i, start, count;
     edict_t * ent;
-    FILE * f;
-    void * base;
-
-    f = fopen(filename, "wb");
-    if (!f)
-        gi.error("Couldn't open %s", filename);
 
-    // write out edict size for checking
-    i = sizeof(edict_t);
-    fwrite(&i, sizeof(i), 1, f);
+    Save_InitBuffer(sb);
+    Save_WriteSchema(sb);
 
-    // write out a function pointer for checking
-    base = (void *)InitGame;
-    fwrite(&base, sizeof(base), 1, f);
+    start = SaveBuf_BeginChunk(sb, CHUNK_LEVEL);
+    WriteLevelLocals(sb);
+    SaveBuf_EndChunk(sb, start);
 
-    // write out level_locals_t
-    WriteLevelLocals(f);
-
-    // write out all the entities
+    // entities are stored as (number, edict, strings) records,
+    // terminated by a -1
+    count = 0;
+    start = SaveBuf_BeginChunk(sb, CHUNK_EDICTS);
     for (i = 0; i < globals.num_edicts; i++)
     {
         ent = &g_edicts[i];
         if (!ent->inuse)
             continue;
-        fwrite(&i, sizeof(i), 1, f);
-        WriteEdict(f, ent);
+        SaveBuf_WriteInt(sb, i);
+        WriteEdict(sb, ent);
+        count++;
     }
-    i = -1;
-    fwrite(&i, sizeof(i), 1, f);
+    SaveBuf_WriteInt(sb, -1);
+    SaveBuf_EndChunk(sb, start);
 
-    fclose(f);
+    return count;
+}
+
+/*
+=================
+WriteLevel
+
+=================
+*/
+void WriteLevel(char * filename)
+{
+    savebuf_t sb;
+    int start_time;
+
+    start_time = Sys_Milliseconds();
+    WriteLevelBuffer(&sb);
+    Save_WriteFile(filename, &sb, "WriteLevel", start_time);
 }
 
 /*
@@ -680,69 +1145,49 @@ No clients are connected yet.
 */
 void ReadLevel(char * filename)
 {
+    savebuf_t sb;
     int entnum;
-    FILE * f;
-    int i;
-    void * base;
+    int i, start_time;
     edict_t * ent;
 
-    f = fopen(filename, "rb");
-    if (!f)
-        gi.error("Couldn't open %s", filename);
+    start_time = Sys_Milliseconds();
 
     // free any dynamic memory allocated by loading the level
     // base state
     gi.FreeTags(TAG_LEVEL);
 
+    Save_ReadFile(filename, &sb, TAG_LEVEL);
+
     // wipe all the entities
     memset(g_edicts, 0, game.maxentities * sizeof(g_edicts[0]));
     globals.num_edicts = maxclients->value + 1;
 
-    // check edict size
-    fread(&i, sizeof(i), 1, f);
-    if (i != sizeof(edict_t))
-    {
-        fclose(f);
-        gi.error("ReadLevel: mismatched edict size");
-    }
-
-    // check function pointer base address
-    fread(&base, sizeof(base), 1, f);
-#ifdef _WIN32
-    if (base != (void *)InitGame)
-    {
-        fclose(f);
-        gi.error("ReadLevel: function pointers have moved");
-    }
-#else
-    gi.dprintf("Function offsets %d\n", ((byte *)base) - ((byte *)InitGame));
-#endif
-
     // load the level locals
-    ReadLevelLocals(f);
+    if (SaveBuf_ReadChunk(&sb, CHUNK_LEVEL) < (int)sizeof(level))
+        gi.error("ReadLevel: mismatched level size");
+    ReadLevelLocals(&sb);
 
     // load all the entities
+    SaveBuf_ReadChunk(&sb, CHUNK_EDICTS);
     while (1)
     {
-        if (fread(&entnum, sizeof(entnum), 1, f) != 1)
-        {
-            fclose(f);
-            gi.error("ReadLevel: failed to read entnum");
-        }
+        entnum = SaveBuf_ReadInt(&sb);
         if (entnum == -1)
             break;
+        if (entnum < 0 || entnum >= game.maxentities)
+            gi.error("ReadLevel: bad entnum %i", entnum);
         if (entnum >= globals.num_edicts)
             globals.num_edicts = entnum + 1;
 
         ent = &g_edicts[entnum];
-        ReadEdict(f, ent);
+        ReadEdict(&sb, ent);
 
         // let the server rebuild world links for this ent
         memset(&ent->area, 0, sizeof(ent->area));
         gi.linkentity(ent);
     }
 
-    fclose(f);
+    SaveBuf_Free(&sb);
 
     // mark all clients as unconnected
     for (i = 0; i < maxclients->value; i++)
@@ -767,4 +1212,65 @@ void ReadLevel(char * filename)
                 ent->nextthink = level.time + ent->delay;
         }
     }
+
+    if (g_savestats->value)
+        gi.dprintf("ReadLevel: %i edicts, %i ms\n", globals.num_edicts, Sys_Milliseconds() - start_time);
+}
+
+/*
+=================
+Svcmd_SaveBench_f
+
+"sv savebench [count]"
+Times serializing the current level, writing it to disk and reading it
+back, raw and compressed. The read side stops at the validated payload
+so the running level is left alone.
+=================
+*/
+void Svcmd_SaveBench_f(void)
+{
+    savebuf_t sb, rb;
+    char name[MAX_OSPATH];
+    cvar_t * gamedir;
+    int count, iter, pass;
+    int edicts, disksize, t0, t_build, t_write, t_read;
+    float oldcompress;
+
+    count = (gi.argc() > 2) ? atoi(gi.argv(2)) : 4;
+    if (count < 1)
+        count = 1;
+
+    gamedir = gi.cvar("game", "", 0);
+    sprintf(name, "%s/savebench.sav", *gamedir->string ? gamedir->string : GAMEVERSION);
+
+    oldcompress = g_savecompress->value;
+
+    for (pass = 0; pass < 2; pass++)
+    {
+        gi.cvar_set("g_savecompress", pass ? "1" : "0");
+        edicts = disksize = t_build = t_write = t_read = 0;
+
+        for (iter = 0; iter < count; iter++)
+        {
+            t0 = Sys_Milliseconds();
+            edicts = WriteLevelBuffer(&sb);
+            t_build += Sys_Milliseconds() - t0;
+
+            t0 = Sys_Milliseconds();
+            disksize = Save_WriteFile(name, &sb, "savebench", t0);
+            t_write += Sys_Milliseconds() - t0;
+
+            t0 = Sys_Milliseconds();
+            Save_ReadFile(name, &rb, TAG_LEVEL);
+            SaveBuf_Free(&rb);
+            t_read += Sys_Milliseconds() - t0;
+        }
+
+        gi.cprintf(NULL, PRINT_HIGH, "%s: %i edicts, %i bytes on disk, build %.2f ms, write %.2f ms, read %.2f ms\n",
+                   pass ? "lz" : "raw", edicts, disksize, (float)t_build / count,
+                   (float)t_write / count, (float)t_read / count);
+    }
+
+    gi.cvar_set("g_savecompress", oldcompress ? "1" : "0");
+    remove(name);
 }
@@ -266,47 +266,207 @@ spawn_t spawns[] = {
     { NULL, NULL }
 };
 
+/*
+==============================================================================
+
+SPAWN LOOKUP TABLES
+
+PS2: ED_CallSpawn and ED_ParseField used to strcmp linearly
+through itemlist[], spawns[] and fields[] for every entity and every
+key. The tables never change, so they are hashed once into open
+addressed tables on first use. Insertion order matches the old search
+order (items before spawns, first duplicate wins), so lookups resolve
+to exactly the same entries as the linear scans did.
+
+==============================================================================
+*/
+
+#define SPAWN_HASH_SIZE 512 // Must be a power of two
+#define FIELD_HASH_SIZE 256 // Must be a power of two
+
+typedef struct
+{
+    const char * name;
+    gitem_t * item;
+    spawn_t * spawn;
+} spawn_hash_t;
+
+static spawn_hash_t spawn_hash[SPAWN_HASH_SIZE];
+static field_t * field_hash[FIELD_HASH_SIZE];
+static qboolean spawn_hash_built = false;
+
+// FNV-1a. Classnames are matched case-sensitively, field keys are not.
+static unsigned ED_HashString(const char * str, qboolean nocase)
+{
+    unsigned hash = 2166136261u;
+    int c;
+
+    while ((c = *str++) != 0)
+    {
+        if (nocase && c >= 'A' && c <= 'Z')
+            c += 'a' - 'A';
+        hash = (hash ^ (unsigned)c) * 16777619u;
+    }
+    return hash;
+}
+
+static void ED_HashSpawn(const char * name, gitem_t * item, spawn_t * spawn)
+{
+    unsigned i, probes;
+
+    i = ED_HashString(name, false) & (SPAWN_HASH_SIZE - 1);
+    for (probes = 0; probes < SPAWN_HASH_SIZE; probes++)
+    {
+        if (!spawn_hash[i].name)
+        {
+            spawn_hash[i].name = name;
+            spawn_hash[i].item = item;
+            spawn_hash[i].spawn = spawn;
+            return;
+        }
+        if (!strcmp(spawn_hash[i].name, name))
+            return; // an earlier entry already owns this classname
+        i = (i + 1) & (SPAWN_HASH_SIZE - 1);
+    }
+    gi.error("ED_HashSpawn: SPAWN_HASH_SIZE overflow");
+}
+
+static void ED_HashField(field_t * f)
+{
+    unsigned i, probes;
+
+    i = ED_HashString(f->name, true) & (FIELD_HASH_SIZE - 1);
+    for (probes = 0; probes < FIELD_HASH_SIZE; probes++)
+    {
+        if (!field_hash[i])
+        {
+            field_hash[i] = f;
+            return;
+        }
+        if (!Q_stricmp(field_hash[i]->name, f->name))
+            return; // an earlier entry already owns this key
+        i = (i + 1) & (FIELD_HASH_SIZE - 1);
+    }
+    gi.error("ED_HashField: FIELD_HASH_SIZE overflow");
+}
+
 /*
 ===============
-ED_CallSpawn
+ED_BuildSpawnHash
 
-Finds the spawn function for the entity and calls it
+Itemlist is static, but game.num_items is only known after InitItems,
+so this is deferred until the first entity is spawned.
 ===============
 */
-void ED_CallSpawn(edict_t * ent)
+static void ED_BuildSpawnHash(void)
 {
     spawn_t * s;
     gitem_t * item;
+    field_t * f;
     int i;
 
+    memset(spawn_hash, 0, sizeof(spawn_hash));
+    memset(field_hash, 0, sizeof(field_hash));
+
+    for (i = 0, item = itemlist; i < game.num_items; i++, item++)
+    {
+        if (item->classname)
+            ED_HashSpawn(item->classname, item, NULL);
+    }
+    for (s = spawns; s->name; s++)
+    {
+        ED_HashSpawn(s->name, NULL, s);
+    }
+
+    for (f = fields; f->name; f++)
+    {
+        if (!(f->flags & FFL_NOSPAWN))
+            ED_HashField(f);
+    }
+
+    spawn_hash_built = true;
+}
+
+static spawn_hash_t * ED_FindSpawn(const char * classname)
+{
+    unsigned i, probes;
+
+    if (!spawn_hash_built)
+        ED_BuildSpawnHash();
+
+    i = ED_HashString(classname, false) & (SPAWN_HASH_SIZE - 1);
+    for (probes = 0; probes < SPAWN_HASH_SIZE && spawn_hash[i].name; probes++)
+    {
+        if (!strcmp(spawn_hash[i].name, classname))
+            return &spawn_hash[i];
+        i = (i + 1) & (SPAWN_HASH_SIZE - 1);
+    }
+    return NULL;
+}
+
+static field_t * ED_FindField(const char * key)
+{
+    unsigned i, probes;
+
+    if (!spawn_hash_built)
+        ED_BuildSpawnHash();
+
+    i = ED_HashString(key, true) & (FIELD_HASH_SIZE - 1);
+    for (probes = 0; probes < FIELD_HASH_SIZE && field_hash[i]; probes++)
+    {
+        if (!Q_stricmp(field_hash[i]->name, key))
+            return field_hash[i];
+        i = (i + 1) & (FIELD_HASH_SIZE - 1);
+    }
+    return NULL;
+}
+
+/*
+===============
+ED_CallSpawn
+
+Finds the spawn function for the entity and calls it
+===============
+*/
+void ED_CallSpawn(edict_t * ent)
+{
+    spawn_hash_t * s;
+
     if (!ent->classname)
     {
         gi.dprintf("ED_CallSpawn: NULL classname\n");
         return;
     }
 
-    // check item spawn functions
-    for (i = 0, item = itemlist; i < game.num_items; i++, item++)
-    {
-        if (!item->classname)
-            continue;
-        if (!strcmp(item->classname, ent->classname))
-        { // found it
-            SpawnItem(ent, item);
-            return;
-        }
+    s = ED_FindSpawn(ent->classname);
+    if (s)
+    { // found it
+        if (s->item)
+            SpawnItem(ent, s->item);
+        else
+            s->spawn->spawn(ent);
+        return;
     }
+    gi.dprintf("%s doesn't have a spawn function\n", ent->classname);
+}
+
+/*
+===============
+ED_HashSpawnFunctions
+
+Folds the offset of every spawn function from base into hash.
+The savegame code uses this to tell game builds apart.
+===============
+*/
+unsigned ED_HashSpawnFunctions(unsigned hash, byte * base)
+{
+    spawn_t * s;
 
-    // check normal spawn functions
     for (s = spawns; s->name; s++)
     {
-        if (!strcmp(s->name, ent->classname))
-        { // found it
-            s->spawn(ent);
-            return;
-        }
+        hash = (hash ^ (unsigned)((byte *)s->spawn - base)) * 16777619u;
     }
-    gi.dprintf("%s doesn't have a spawn function\n", ent->classname);
+    return hash;
 }
 
 /*
@@ -357,45 +517,44 @@ void ED_ParseField(char * key, char * value, edict_t * ent)
     float v;
     vec3_t vec;
 
-    for (f = fields; f->name; f++)
+    f = ED_FindField(key);
+    if (!f)
     {
-        if (!(f->flags & FFL_NOSPAWN) && !Q_stricmp(f->name, key))
-        { // found it
-            if (f->flags & FFL_SPAWNTEMP)
-                b = (byte *)&st;
-            else
-                b = (byte *)ent;
+        gi.dprintf("%s is not a field\n", key);
+        return;
+    }
 
-            switch (f->type)
-            {
-            case F_LSTRING:
-                *(char **)(b + f->ofs) = ED_NewString(value);
-                break;
-            case F_VECTOR:
-                sscanf(value, "%f %f %f", &vec[0], &vec[1], &vec[2]);
-                ((float *)(b + f->ofs))[0] = vec[0];
-                ((float *)(b + f->ofs))[1] = vec[1];
-                ((float *)(b + f->ofs))[2] = vec[2];
-                break;
-            case F_INT:
-                *(int *)(b + f->ofs) = atoi(value);
-                break;
-            case F_FLOAT:
-                *(float *)(b + f->ofs) = atof(value);
-                break;
-            case F_ANGLEHACK:
-                v = atof(value);
-                ((float *)(b + f->ofs))[0] = 0;
-                ((float *)(b + f->ofs))[1] = v;
-                ((float *)(b + f->ofs))[2] = 0;
-                break;
-            case F_IGNORE:
-                break;
-            }
-            return;
-        }
+    if (f->flags & FFL_SPAWNTEMP)
+        b = (byte *)&st;
+    else
+        b = (byte *)ent;
+
+    switch (f->type)
+    {
+    case F_LSTRING:
+        *(char **)(b + f->ofs) = ED_NewString(value);
+        break;
+    case F_VECTOR:
+        sscanf(value, "%f %f %f", &vec[0], &vec[1], &vec[2]);
+        ((float *)(b + f->ofs))[0] = vec[0];
+        ((float *)(b + f->ofs))[1] = vec[1];
+        ((float *)(b + f->ofs))[2] = vec[2];
+        break;
+    case F_INT:
+        *(int *)(b + f->ofs) = atoi(value);
+        break;
+    case F_FLOAT:
+        *(float *)(b + f->ofs) = atof(value);
+        break;
+    case F_ANGLEHACK:
+        v = atof(value);
+        ((float *)(b + f->ofs))[0] = 0;
+        ((float *)(b + f->ofs))[1] = v;
+        ((float *)(b + f->ofs))[2] = 0;
+        break;
+    case F_IGNORE:
+        break;
     }
-    gi.dprintf("%s is not a field\n", key);
 }
 
 /*
@@ -517,8 +676,11 @@ void SpawnEntities(char * mapname, char * entities, char * spawnpoint)
     int inhibit;
     char * com_token;
     int i;
+    int start_time;
     float skill_level;
 
+    start_time = Sys_Milliseconds();
+
     skill_level = floor(skill->value);
     if (skill_level < 0)
         skill_level = 0;
@@ -596,6 +758,7 @@ void SpawnEntities(char * mapname, char * entities, char * spawnpoint)
     }
 
     gi.dprintf("%i entities inhibited\n", inhibit);
+    gi.dprintf("%i entities spawned in %i ms\n", globals.num_edicts, Sys_Milliseconds() - start_time);
 
 #ifdef DEBUG
     i = 1;
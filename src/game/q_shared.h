@@ -290,6 +290,7 @@ int Hunk_End(void);
 extern int curtime;
 
 int Sys_Milliseconds(void);
+unsigned int Sys_Microseconds(void); // for timing short runs, use differences only
 void Sys_Mkdir(const char * path);
 
 // directory searching
@@ -89,6 +89,11 @@ int Sys_Milliseconds(void)
     return 0;
 }
 
+unsigned int Sys_Microseconds(void)
+{
+    return 0;
+}
+
 void Sys_Mkdir(const char * path)
 {
 }
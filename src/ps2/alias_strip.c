@@ -0,0 +1,316 @@
+/* ================================================================================================
+ * -*- C -*-
+ * File: alias_strip.c
+ * Brief: Conversion of the MD2 triangle lists to the deduplicated vertexes and
+ *        triangle strips of the alias model layout (tools/md2strips.c checks it).
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#include "ps2/alias_strip.h"
+
+#include <string.h>
+
+typedef struct
+{
+    const int * tri_verts;  // [num_tris * 3] deduplicated vertex per corner
+    const int * edge_table; // corner (tri * 3 + i) starting each directed edge, or -1
+    u32 edge_mask;
+    const byte * used;
+    int * stamps;
+} ps2_alias_stripper_t;
+
+/*
+==============
+PS2_AliasHash
+
+Remarks: Local function.
+Hash for the (xyz, st) pair and directed edge lookup tables.
+==============
+*/
+static inline u32 PS2_AliasHash(int a, int b, u32 mask)
+{
+    return (((u32)a * 2654435761u) ^ ((u32)b * 40503u)) & mask;
+}
+
+/*
+==============
+PS2_AliasTableSize
+
+Remarks: Local function.
+Power of two slots for the lookup tables, kept at most half full.
+==============
+*/
+static int PS2_AliasTableSize(int num_tris)
+{
+    int table_size = 16;
+    while (table_size < num_tris * 3 * 2)
+    {
+        table_size <<= 1;
+    }
+    return table_size;
+}
+
+/*
+==============
+PS2_AliasStripFrom
+
+Remarks: Local function.
+Grows a strip from triangle 'tri' rotated by 'rot', following shared
+edges with the winding a strip expects. Triangles already used by
+other strips or by this one (stamped with strip_id) are skipped.
+Returns the number of triangles; indexes/strip_tris are filled in.
+==============
+*/
+static int PS2_AliasStripFrom(const ps2_alias_stripper_t * st, int tri, int rot, int strip_id,
+                              int * indexes, int * strip_tris)
+{
+    int i, k, p, q, corner, next;
+    u32 slot;
+
+    indexes[0] = st->tri_verts[tri * 3 + rot];
+    indexes[1] = st->tri_verts[tri * 3 + (rot + 1) % 3];
+    indexes[2] = st->tri_verts[tri * 3 + (rot + 2) % 3];
+    strip_tris[0] = tri;
+    st->stamps[tri] = strip_id;
+
+    for (k = 1;; ++k)
+    {
+        // Edge the next triangle must have, in its own winding order.
+        if (k & 1)
+        {
+            p = indexes[k + 1];
+            q = indexes[k];
+        }
+        else
+        {
+            p = indexes[k];
+            q = indexes[k + 1];
+        }
+
+        next = -1;
+        slot = PS2_AliasHash(p, q, st->edge_mask);
+        for (; (corner = st->edge_table[slot]) != -1; slot = (slot + 1) & st->edge_mask)
+        {
+            const int t = corner / 3;
+            i = corner % 3;
+            if (st->tri_verts[corner] == p && st->tri_verts[t * 3 + (i + 1) % 3] == q &&
+                !st->used[t] && st->stamps[t] != strip_id)
+            {
+                next = corner;
+                break;
+            }
+        }
+        if (next < 0)
+        {
+            break;
+        }
+
+        const int t = next / 3;
+        indexes[k + 2] = st->tri_verts[t * 3 + (next % 3 + 2) % 3];
+        strip_tris[k] = t;
+        st->stamps[t] = strip_id;
+    }
+
+    return k;
+}
+
+/*
+==============
+PS2_AliasStripScratchSize
+==============
+*/
+int PS2_AliasStripScratchSize(int num_tris)
+{
+    const int num_corners = num_tris * 3;
+    return sizeof(int) * (num_corners                 // tri_verts
+                        + num_corners * 2             // pair xyz/st
+                        + PS2_AliasTableSize(num_tris) * 2 // pair and edge tables
+                        + num_tris                    // stamps
+                        + (num_tris + 2) * 2          // strip indexes, current and best
+                        + num_tris * 2                // strip triangles, current and best
+                        + num_tris                    // start order
+                        + num_corners                 // output strip indexes
+                        + num_tris)                   // output strip lengths
+                        + num_tris;                   // used flags
+}
+
+/*
+==============
+PS2_AliasBuildStrips
+==============
+*/
+qboolean PS2_AliasBuildStrips(ps2_alias_strips_t * strips, const dtriangle_t * tris,
+                              int num_tris, int num_xyz, int num_st, void * scratch)
+{
+    int i, j, k;
+
+    const int num_corners = num_tris * 3;
+    const int table_size  = PS2_AliasTableSize(num_tris);
+    const u32 table_mask  = table_size - 1;
+
+    int * tri_verts     = (int *)scratch;
+    int * pair_xyz      = tri_verts + num_corners;
+    int * pair_st       = pair_xyz + num_corners;
+    int * pair_table    = pair_st + num_corners;
+    int * edge_table    = pair_table + table_size;
+    int * stamps        = edge_table + table_size;
+    int * cur_idx       = stamps + num_tris;
+    int * best_idx      = cur_idx + num_tris + 2;
+    int * cur_tris      = best_idx + num_tris + 2;
+    int * best_tris     = cur_tris + num_tris;
+    int * order         = best_tris + num_tris;
+    int * strip_indexes = order + num_tris;
+    int * strip_lengths = strip_indexes + num_corners;
+    byte * used         = (byte *)(strip_lengths + num_tris);
+
+    memset(pair_table, -1, sizeof(int) * table_size * 2); // Also clears edge_table.
+    memset(stamps, -1, sizeof(int) * num_tris);
+    memset(used, 0, num_tris);
+
+    //
+    // Deduplicate the (xyz, st) pairs of every triangle corner:
+    //
+    int num_verts = 0;
+    for (i = 0; i < num_tris; ++i)
+    {
+        for (j = 0; j < 3; ++j)
+        {
+            const int xyz = LittleShort(tris[i].index_xyz[j]);
+            const int st  = LittleShort(tris[i].index_st[j]);
+            if (xyz < 0 || xyz >= num_xyz || st < 0 || st >= num_st)
+            {
+                return false;
+            }
+
+            u32 slot = PS2_AliasHash(xyz, st, table_mask);
+            int v;
+            while ((v = pair_table[slot]) != -1 && (pair_xyz[v] != xyz || pair_st[v] != st))
+            {
+                slot = (slot + 1) & table_mask;
+            }
+            if (v == -1)
+            {
+                v = num_verts++;
+                pair_xyz[v] = xyz;
+                pair_st[v]  = st;
+                pair_table[slot] = v;
+            }
+            tri_verts[i * 3 + j] = v;
+        }
+    }
+
+    //
+    // Directed edge table, so strips can find their neighbors.
+    // Degenerate triangles are dropped here, they draw nothing.
+    //
+    for (i = 0; i < num_tris; ++i)
+    {
+        const int * tv = &tri_verts[i * 3];
+        if (tv[0] == tv[1] || tv[1] == tv[2] || tv[2] == tv[0])
+        {
+            used[i] = 1;
+            continue;
+        }
+        for (j = 0; j < 3; ++j)
+        {
+            u32 slot = PS2_AliasHash(tv[j], tv[(j + 1) % 3], table_mask);
+            while (edge_table[slot] != -1)
+            {
+                slot = (slot + 1) & table_mask;
+            }
+            edge_table[slot] = i * 3 + j;
+        }
+    }
+
+    //
+    // Strips are started from the triangles with the fewest neighbors
+    // first: the ends of a run, which can then be followed all the way.
+    // Counting sort by the number of edges shared, 0 to 3, kept in
+    // cur_tris until the strips need it.
+    //
+    int counts[5] = { 0, 0, 0, 0, 0 };
+    for (i = 0; i < num_tris; ++i)
+    {
+        int neighbors = 0;
+        for (j = 0; j < 3 && !used[i]; ++j)
+        {
+            const int p = tri_verts[i * 3 + (j + 1) % 3];
+            const int q = tri_verts[i * 3 + j];
+            int corner;
+            u32 slot = PS2_AliasHash(p, q, table_mask);
+            for (; (corner = edge_table[slot]) != -1; slot = (slot + 1) & table_mask)
+            {
+                if (tri_verts[corner] == p && tri_verts[(corner / 3) * 3 + (corner % 3 + 1) % 3] == q)
+                {
+                    ++neighbors;
+                    break;
+                }
+            }
+        }
+        cur_tris[i] = neighbors;
+        ++counts[neighbors + 1];
+    }
+    for (i = 1; i < 4; ++i)
+    {
+        counts[i] += counts[i - 1];
+    }
+    for (i = 0; i < num_tris; ++i)
+    {
+        order[counts[cur_tris[i]]++] = i;
+    }
+
+    //
+    // Greedy stripification, keeping the longest of the
+    // three strips each unused triangle can start.
+    //
+    ps2_alias_stripper_t stripper;
+    stripper.tri_verts  = tri_verts;
+    stripper.edge_table = edge_table;
+    stripper.edge_mask  = table_mask;
+    stripper.used       = used;
+    stripper.stamps     = stamps;
+
+    int num_indexes = 0;
+    int num_strips  = 0;
+    int strip_id    = 0;
+
+    for (k = 0; k < num_tris; ++k)
+    {
+        const int tri = order[k];
+        if (used[tri])
+        {
+            continue;
+        }
+
+        int best_len = 0;
+        for (j = 0; j < 3; ++j)
+        {
+            const int len = PS2_AliasStripFrom(&stripper, tri, j, strip_id++, cur_idx, cur_tris);
+            if (len > best_len)
+            {
+                best_len = len;
+                memcpy(best_idx,  cur_idx,  sizeof(int) * (len + 2));
+                memcpy(best_tris, cur_tris, sizeof(int) * len);
+            }
+        }
+
+        for (j = 0; j < best_len; ++j)
+        {
+            used[best_tris[j]] = 1;
+        }
+        memcpy(strip_indexes + num_indexes, best_idx, sizeof(int) * (best_len + 2));
+        strip_lengths[num_strips++] = best_len + 2;
+        num_indexes += best_len + 2;
+    }
+
+    strips->num_verts   = num_verts;
+    strips->num_indexes = num_indexes;
+    strips->num_strips  = num_strips;
+    strips->vert_xyz    = pair_xyz;
+    strips->vert_st     = pair_st;
+    strips->indexes     = strip_indexes;
+    strips->lengths     = strip_lengths;
+    return true;
+}
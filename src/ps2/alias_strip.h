@@ -0,0 +1,47 @@
+/* ================================================================================================
+ * -*- C -*-
+ * File: alias_strip.h
+ * Brief: Conversion of the MD2 triangle lists to the deduplicated vertexes and
+ *        triangle strips of the alias model layout (tools/md2strips.c checks it).
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#ifndef PS2_ALIAS_STRIP_H
+#define PS2_ALIAS_STRIP_H
+
+#include "game/q_shared.h"
+#include "common/q_files.h"
+#include "ps2/defs_ps2.h"
+
+//
+// Nothing in here depends on the PS2DEV SDK, so the host tool
+// strips the models with the very same code the loader uses.
+//
+// Triangle k of a strip uses indexes k, k+1, k+2,
+// with the first two swapped for odd k to keep the winding.
+//
+
+typedef struct
+{
+    int num_verts;       // unique (xyz, st) pairs
+    int num_indexes;     // in all strips
+    int num_strips;
+    const int * vert_xyz; // [num_verts] frame vertex of each pair
+    const int * vert_st;  // [num_verts] st vertex of each pair
+    const int * indexes;  // [num_indexes] into the pairs, strip after strip
+    const int * lengths;  // [num_strips] indexes in each strip
+} ps2_alias_strips_t;
+
+// Bytes of scratch memory PS2_AliasBuildStrips needs for 'num_tris' triangles.
+int PS2_AliasStripScratchSize(int num_tris);
+
+// Deduplicates the (xyz, st) corners of the MD2 triangles and joins the triangles
+// in strips, dropping the degenerate ones. Everything written to 'strips' points
+// into 'scratch', which must stay around for as long as it is used. Returns false
+// if a triangle has an xyz or st index out of range.
+qboolean PS2_AliasBuildStrips(ps2_alias_strips_t * strips, const dtriangle_t * tris,
+                              int num_tris, int num_xyz, int num_st, void * scratch);
+
+#endif // PS2_ALIAS_STRIP_H
@@ -5,553 +5,58 @@ typedef unsigned char byte;
 const int backtile_width  = 64;
 const int backtile_height = 64;
 const int backtile_size_bytes = 8192;
-const byte backtile_data[] __attribute__((aligned(16))) = {
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x64, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x85, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x85, 0x88, 0x64, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x85, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x65, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x65, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x64, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x85, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x64, 0x84, 0x85, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x85, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x85, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x65, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x64, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x64, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x85, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x85, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x64, 0x84, 0x85, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x64, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x85, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x85, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x85, 0x88, 0x64, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x65, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x64, 0x84, 0x64, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x85, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x85, 0x88, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x85, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x64, 0x84, 0x64, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x85, 0x88, 0x64, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x85, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x64, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x64, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x85, 0x88, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x64, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x85, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x85, 0x88, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x64, 0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88
+const int backtile_packed_size = 763;
+const byte backtile_packed[] = {
+    0x7A, 0x1D, 0x00, 0x10, 0x1C, 0x00, 0x00, 0x04, 0x00, 0x02, 0x10, 0x0C, 0x20, 0x1D, 0xFF, 
+    0x07, 0x30, 0x0C, 0x80, 0x22, 0x60, 0x08, 0x20, 0x09, 0x10, 0x1E, 0x60, 0x1B, 0x40, 0x26, 
+    0x60, 0x9F, 0x14, 0x50, 0x2A, 0x50, 0x4C, 0x40, 0x5E, 0x50, 0x22, 0x50, 0x1C, 0x1A, 0x15, 
+    0x50, 0xDF, 0x27, 0x30, 0x7D, 0x60, 0x3F, 0x30, 0x58, 0xA0, 0x22, 0x80, 0x18, 0x0B, 0x60, 
+    0x15, 0x60, 0xE7, 0x00, 0x40, 0x72, 0x70, 0x18, 0x00, 0x18, 0x1A, 0x20, 0x40, 0x25, 0xA0, 
+    0x12, 0x00, 0xFE, 0x1A, 0x5D, 0x40, 0x2B, 0x60, 0x6B, 0x30, 0x22, 0x70, 0x61, 0x00, 0x9B, 
+    0x00, 0x25, 0x80, 0xFF, 0x2C, 0xA0, 0x0E, 0x91, 0x39, 0x40, 0xD1, 0x70, 0x6C, 0xC0, 0x13, 
+    0x51, 0x22, 0xE0, 0x26, 0x40, 0x9F, 0x15, 0x50, 0x6C, 0x10, 0x34, 0x70, 0x3D, 0x70, 0x99, 
+    0x80, 0x1D, 0x19, 0x17, 0x90, 0xFF, 0xDB, 0x20, 0x15, 0x50, 0x26, 0x40, 0x0B, 0xB1, 0x8B, 
+    0x50, 0x7B, 0x61, 0x00, 0xF0, 0x00, 0xFE, 0x60, 0xFF, 0xD6, 0x51, 0x27, 0xF0, 0x04, 0xE3, 
+    0x40, 0x9D, 0xC0, 0x7F, 0x81, 0xDF, 0x41, 0xC4, 0x00, 0xFB, 0xA0, 0xFF, 0x90, 0x61, 0x5D, 
+    0x30, 0xD7, 0x51, 0xA1, 0xE0, 0xA2, 0x40, 0x03, 0x21, 0xAA, 0xB0, 0xD6, 0x40, 0x7F, 0xFF, 
+    0x31, 0xE2, 0x50, 0x21, 0xE0, 0x27, 0x72, 0xD1, 0x70, 0x32, 0x62, 0x7C, 0x11, 0x2E, 0xFF, 
+    0x22, 0xF0, 0x02, 0x3F, 0x90, 0xD2, 0x51, 0x84, 0x40, 0x56, 0x60, 0xC6, 0xA2, 0x09, 0x00, 
+    0x13, 0x62, 0xFF, 0x40, 0x90, 0x08, 0x93, 0xC5, 0x62, 0x20, 0x81, 0x0E, 0x50, 0x29, 0x40, 
+    0x5B, 0x12, 0x10, 0x40, 0xFB, 0x6D, 0x73, 0x11, 0x30, 0x1A, 0x1B, 0x70, 0xB4, 0xF1, 0x02, 
+    0xDE, 0x80, 0xBA, 0x80, 0x45, 0xA0, 0xFD, 0x1D, 0x60, 0x2E, 0xF5, 0x30, 0xC0, 0xF3, 0x0D, 
+    0x5E, 0x51, 0x00, 0x40, 0x03, 0xB4, 0x4B, 0x93, 0xFF, 0x3F, 0x81, 0xC0, 0xA3, 0x43, 0x60, 
+    0x03, 0xF4, 0x01, 0xC7, 0x72, 0x40, 0xD2, 0xC0, 0x63, 0xBE, 0x81, 0xFF, 0x03, 0xF4, 0x00, 
+    0x07, 0x83, 0xB1, 0xC1, 0xC0, 0xD3, 0x2A, 0xA1, 0xAF, 0x61, 0x8E, 0x72, 0x9A, 0x60, 0xFF, 
+    0xC0, 0xE3, 0x1B, 0x51, 0x03, 0xF4, 0x05, 0x86, 0x93, 0xC0, 0xF3, 0x07, 0x1F, 0xF0, 0x04, 
+    0xF4, 0x71, 0xE1, 0x61, 0xFF, 0xC0, 0xF3, 0x00, 0x35, 0x60, 0x06, 0x10, 0x03, 0xD4, 0xD3, 
+    0xF3, 0x04, 0x00, 0xC0, 0x41, 0x15, 0x20, 0xD3, 0xFF, 0x0B, 0x91, 0x04, 0x11, 0x63, 0xE5, 
+    0x09, 0xF4, 0x02, 0x03, 0xF4, 0x04, 0xF0, 0x72, 0xC0, 0xF3, 0x0D, 0x03, 0xF4, 0x04, 0xFF, 
+    0x76, 0xA0, 0xC0, 0xF3, 0x04, 0x1F, 0x90, 0x74, 0x41, 0x96, 0x75, 0x4A, 0x83, 0xC0, 0xF3, 
+    0x03, 0x4E, 0x90, 0xFF, 0x1F, 0xF0, 0x04, 0x18, 0x93, 0xC0, 0xE3, 0x36, 0x41, 0x6E, 0x80, 
+    0x2F, 0xA0, 0x33, 0x73, 0x92, 0xA3, 0xFF, 0xA7, 0x34, 0x3C, 0xA4, 0x1F, 0x90, 0x1D, 0xA7, 
+    0x9A, 0xA0, 0xC0, 0xF3, 0x04, 0xF2, 0x00, 0x03, 0xF4, 0x07, 0xFF, 0x2D, 0x70, 0xED, 0x72, 
+    0x63, 0xC4, 0x7E, 0x51, 0x03, 0xF4, 0x01, 0xDB, 0x84, 0x54, 0x64, 0xD6, 0xA0, 0xFF, 0x43, 
+    0x94, 0xC3, 0x63, 0x83, 0x97, 0x85, 0xB1, 0xCE, 0xC0, 0x0A, 0x74, 0x25, 0x75, 0x1A, 0x50, 
+    0xFF, 0x9E, 0x56, 0x25, 0xF1, 0x01, 0x0A, 0xF4, 0x03, 0x3B, 0x50, 0x1A, 0x40, 0x15, 0x50, 
+    0xB1, 0xF6, 0x02, 0xCB, 0xF7, 0x00, 0xFF, 0xEC, 0x77, 0x96, 0xE5, 0xE5, 0x70, 0xD2, 0x60, 
+    0xCB, 0xF7, 0x00, 0xE7, 0xB2, 0xC0, 0xF2, 0x01, 0xCA, 0x88, 0xFF, 0x5F, 0x74, 0xEE, 0xE7, 
+    0x41, 0x63, 0xBD, 0xC1, 0xA7, 0xD2, 0x0A, 0xE4, 0xA4, 0xA1, 0xF1, 0xE3, 0xFF, 0x55, 0x23, 
+    0x56, 0xD3, 0xC2, 0xF3, 0x05, 0x30, 0xA8, 0x7B, 0x90, 0x3F, 0x80, 0x5B, 0x11, 0x0A, 0xF4, 
+    0x06, 0xFF, 0x50, 0x79, 0x7C, 0x95, 0x9C, 0x85, 0x91, 0x67, 0x0A, 0xC4, 0xC4, 0x71, 0x43, 
+    0xA5, 0x26, 0x30, 0xFF, 0x9B, 0x01, 0x4A, 0x90, 0x0A, 0xF4, 0x06, 0xCA, 0xA7, 0x5E, 0x62, 
+    0x18, 0x45, 0x93, 0x9A, 0xEA, 0xD3, 0xFF, 0x3E, 0x96, 0xAA, 0x41, 0x93, 0x95, 0xE2, 0x85, 
+    0xD1, 0x83, 0x0A, 0x84, 0x57, 0x93, 0x33, 0xA4, 0xFF, 0x7F, 0xC3, 0xCC, 0x85, 0xCB, 0xA7, 
+    0x05, 0xD4, 0x40, 0xF9, 0x02, 0xC1, 0x11, 0xA1, 0x95, 0x0A, 0xC4, 0x7F, 0xA6, 0xF9, 0x06, 
+    0x9A, 0x94, 0x4A, 0x41, 0xF8, 0x86, 0xC7, 0xA7, 0x05, 0xB4, 0x04, 0x00, 0x2E, 0xFE, 0x2E, 
+    0x5B, 0x34, 0x9B, 0xF7, 0x0F, 0xFA, 0xF7, 0x0A, 0x9B, 0xF7, 0x0F, 0x13, 0x91, 0x5E, 0xF0, 
+    0x00, 0x9B, 0xF7, 0x13, 0xFF, 0x5E, 0xF0, 0x09, 0xE7, 0x87, 0x57, 0x92, 0x2A, 0x67, 0xFE, 
+    0xFB, 0x05, 0xEE, 0x82, 0x9B, 0xF7, 0x10, 0x33, 0xD3, 0xFF, 0x5E, 0x90, 0x1D, 0x50, 0x9B, 
+    0xF7, 0x0A, 0x5E, 0xF0, 0x0E, 0x9B, 0xF7, 0x10, 0xFA, 0xF7, 0x0C, 0x9B, 0xF7, 0x06, 0x56, 
+    0x13, 0xFF, 0x3E, 0x88, 0x5E, 0xF0, 0x03, 0x9B, 0xF7, 0x13, 0xFA, 0xF7, 0x0E, 0x9B, 0xF7, 
+    0x0B, 0xFA, 0xF7, 0x11, 0x9B, 0xF7, 0x0E, 0xFE, 0xFB, 0x02, 0xFF, 0x5E, 0x80, 0x9B, 0xF7, 
+    0x0C, 0x5E, 0xF0, 0x0C, 0x82, 0x8E, 0x9B, 0xF7, 0x05, 0x5E, 0xF0, 0x0C, 0x95, 0x73, 0x05, 
+    0x10, 0xFF, 0xC8, 0x34, 0xDD, 0xD5, 0x91, 0x74, 0x5E, 0xF0, 0x02, 0x56, 0xF4, 0x02, 0x8B, 
+    0x74, 0xA3, 0x3B, 0xFA, 0x57, 0xFF, 0x5E, 0xF0, 0x03, 0xEE, 0xF0, 0x02, 0x73, 0x61, 0xDF, 
+    0xC8, 0x94, 0xFF, 0x01, 0xF9, 0xA7, 0x31, 0x88, 0xD7, 0x66, 0x00, 0x1C, 0x2E
 };
 
@@ -5,6560 +5,1619 @@ typedef unsigned char byte;
 const int conback_width  = 256;
 const int conback_height = 192;
 const int conback_size_bytes = 98304;
-const byte conback_data[] __attribute__((aligned(16))) = {
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 
-    0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x84, 0x63, 0x88, 0x63, 0x88, 0x42, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x63, 
-    0x8C, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 
-    0x63, 0x8C, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 
-    0x8C, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x63, 
-    0x8C, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x43, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x85, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 
-    0x88, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x84, 0x42, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x63, 0x8C, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 
-    0x8C, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x63, 0x8C, 
-    0x42, 0x88, 0x22, 0x80, 0x63, 0x88, 0x42, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 
-    0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x84, 0x42, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 
-    0x42, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x63, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x63, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x84, 
-    0x63, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x63, 0x8C, 0x63, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x42, 0x88, 0x42, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x63, 0x88, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x84, 0x90, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x44, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x63, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x63, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x84, 0x44, 0x84, 0x22, 0x84, 0x22, 0x80, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x44, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 
-    0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x42, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 0x42, 0x88, 0x63, 0x8C, 
-    0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 
-    0x8C, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x63, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x80, 0x21, 0x84, 0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x44, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x44, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x22, 0x80, 0x44, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x80, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0xA5, 0x94, 0x42, 
-    0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x63, 0x8C, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 
-    0x63, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 
-    0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 
-    0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x63, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x63, 0x8C, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x63, 0x8C, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 
-    0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x44, 0x84, 0x44, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x44, 0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x42, 0x84, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x44, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x63, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x63, 
-    0x88, 0xA5, 0x90, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x44, 
-    0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x80, 0x42, 
-    0x88, 0x42, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x22, 0x80, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x22, 0x80, 
-    0x63, 0x88, 0x42, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 
-    0x80, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x21, 0x80, 0x42, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x80, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x22, 0x84, 0x21, 0x84, 0x42, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x22, 0x80, 0x42, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x84, 0x42, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x80, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x44, 0x84, 0x22, 0x84, 0x22, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x63, 0x8C, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x63, 0x88, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x22, 0x80, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x21, 0x80, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x63, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0xA5, 0x94, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x44, 0x84, 0x44, 0x84, 0x21, 0x80, 
-    0x44, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x21, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 
-    0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 
-    0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x44, 0x84, 0x21, 0x80, 0x42, 0x88, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x44, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 
-    0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 
-    0x8C, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x44, 0x84, 0x42, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x84, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x44, 0x84, 0x22, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x63, 0x88, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x44, 0x84, 0x44, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 0x63, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x44, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x63, 
-    0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x84, 0x42, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x22, 0x80, 
-    0x63, 0x88, 0x42, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x63, 0x88, 
-    0x84, 0x90, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x63, 0x88, 0x63, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x44, 0x84, 0x42, 0x88, 0x42, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x21, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x63, 0x8C, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x64, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x63, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 
-    0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x84, 0x44, 0x84, 0x22, 0x84, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 
-    0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x65, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x80, 0x21, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x84, 0x8C, 
-    0xA5, 0x90, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x84, 0x8C, 0x63, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x63, 
-    0x8C, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 
-    0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x64, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x63, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x86, 0x8C, 0xA5, 0x90, 
-    0xA5, 0x90, 0x84, 0x8C, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0x86, 
-    0x8C, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x44, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x63, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x84, 0x63, 0x8C, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x21, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x22, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x44, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x63, 0x88, 0x84, 0x8C, 0xA5, 0x90, 0x84, 0x8C, 
-    0x63, 0x88, 0x63, 0x88, 0x42, 0x84, 0x01, 0x80, 0x21, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x42, 0x88, 0x44, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0xA5, 
-    0x90, 0xA5, 0x90, 0xC6, 0x94, 0x84, 0x8C, 0x63, 0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x44, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x63, 0x88, 0x22, 0x84, 0x64, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x80, 0x63, 0x88, 0x42, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x8C, 0xA5, 0x90, 0x63, 0x88, 0x63, 0x88, 0x64, 0x88, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x22, 0x80, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x63, 0x88, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x63, 0x88, 0x63, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x42, 0x84, 0x21, 0x84, 0x43, 0x84, 0x64, 
-    0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 
-    0x42, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x8C, 0x63, 0x88, 0x63, 0x88, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x43, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x63, 0x8C, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x84, 0x44, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x63, 0x88, 0x63, 0x88, 
-    0x63, 0x8C, 0xC6, 0x94, 0x65, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x85, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x22, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x63, 0x8C, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0xC6, 0x94, 0xA5, 0x90, 0x84, 0x8C, 0x63, 0x88, 0x22, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x43, 0x84, 0x63, 0x88, 0x22, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x80, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 
-    0x21, 0x80, 0x63, 0x88, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0x64, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x22, 0x80, 0x65, 0x88, 0x22, 0x84, 0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x63, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x64, 
-    0x88, 0x43, 0x84, 0xA5, 0x90, 0x85, 0x88, 0x86, 0x8C, 0x63, 0x88, 0x22, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 
-    0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x63, 0x88, 0x44, 0x84, 0x85, 0x88, 0x84, 0x8C, 0x43, 
-    0x84, 0x64, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 
-    0x88, 0x43, 0x84, 0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x65, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x63, 
-    0x8C, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x8C, 0x43, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x63, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x43, 0x84, 0x84, 
-    0x8C, 0x84, 0x8C, 0xA5, 0x90, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x63, 0x8C, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x63, 0x8C, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0xA5, 0x90, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x44, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 
-    0x80, 0x22, 0x84, 0x84, 0x8C, 0x63, 0x88, 0xA5, 0x90, 0x84, 0x90, 0x43, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x84, 0x90, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x42, 0x88, 0x44, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 0x42, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x63, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x63, 0x8C, 0x22, 0x84, 0x63, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x22, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x21, 
-    0x84, 0x84, 0x8C, 0x84, 0x8C, 0x63, 0x88, 0x63, 0x88, 0x22, 0x84, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x22, 0x80, 0x21, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x01, 0x80, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x63, 0x88, 0x63, 0x88, 0x44, 0x84, 0x86, 0x8C, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 
-    0x88, 0x42, 0x88, 0x44, 0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 0x42, 0x84, 0x44, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x84, 
-    0x42, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x22, 0x80, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x42, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x64, 0x88, 0xA5, 0x90, 0x64, 0x88, 0x63, 0x88, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x80, 0x22, 0x84, 0x21, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x8C, 0x64, 0x88, 0x64, 0x88, 
-    0x64, 0x88, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 
-    0x8C, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x42, 0x84, 0x42, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x88, 0x42, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x63, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0xA5, 
-    0x90, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x21, 0x80, 0x01, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 
-    0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x84, 0x8C, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x42, 0x88, 0x22, 0x80, 
-    0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x84, 
-    0x8C, 0x63, 0x88, 0x22, 0x84, 0x63, 0x88, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x22, 0x80, 0x21, 
-    0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x80, 0x42, 
-    0x88, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x63, 0x88, 0x44, 0x84, 0x64, 0x88, 0x63, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x80, 0x22, 
-    0x80, 0x42, 0x88, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x63, 0x8C, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x63, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0xA5, 
-    0x90, 0xA5, 0x90, 0x22, 0x84, 0x63, 0x88, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x42, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x63, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x64, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x42, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x84, 
-    0x8C, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0xA5, 
-    0x90, 0x86, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x63, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 
-    0x01, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x63, 0x88, 0x84, 0x8C, 0x44, 
-    0x84, 0x84, 0x8C, 0xA5, 0x90, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x63, 0x88, 0x21, 0x80, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x65, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0xA5, 
-    0x90, 0xA5, 0x90, 0x44, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x63, 0x8C, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 0x63, 
-    0x88, 0x63, 0x88, 0x44, 0x84, 0x63, 0x88, 0x84, 0x8C, 0xA5, 0x90, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 
-    0x42, 0x88, 0x22, 0x80, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x63, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x63, 0x88, 0x21, 
-    0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x8C, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x21, 0x80, 0x21, 0x80, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x01, 0x80, 0x22, 0x84, 0x21, 0x80, 0x44, 
-    0x84, 0x63, 0x88, 0x43, 0x84, 0x63, 0x88, 0x84, 0x8C, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x22, 0x80, 0x01, 
-    0x80, 0x22, 0x80, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x63, 0x88, 0x84, 0x8C, 0x42, 0x88, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x43, 
-    0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x64, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x63, 0x88, 0x43, 0x84, 0x44, 0x84, 0x63, 0x88, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x80, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 
-    0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x44, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x21, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x01, 0x80, 0x21, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x84, 0x8C, 0x44, 0x84, 0x43, 0x84, 0x63, 0x88, 
-    0x84, 0x8C, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x22, 
-    0x84, 0x64, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x65, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x63, 
-    0x8C, 0x42, 0x84, 0x42, 0x88, 0x22, 0x80, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x63, 
-    0x8C, 0x84, 0x8C, 0x22, 0x84, 0x63, 0x88, 0x84, 0x90, 0x22, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x84, 0x01, 0x80, 0x21, 0x80, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x80, 0x21, 0x80, 0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x63, 0x88, 0x84, 0x90, 0x42, 0x88, 
-    0x44, 0x84, 0x63, 0x88, 0x84, 0x90, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x64, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x63, 
-    0x8C, 0x84, 0x8C, 0x21, 0x80, 0x63, 0x88, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x80, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x21, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x84, 0x22, 
-    0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x84, 0x63, 0x88, 0x63, 0x88, 0x42, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x80, 
-    0x63, 0x88, 0xA5, 0x90, 0x43, 0x84, 0x84, 0x8C, 0x63, 0x88, 0x21, 0x84, 0x63, 0x8C, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x64, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0xA5, 0x90, 0x44, 0x84, 0x21, 0x84, 0xA5, 0x90, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x21, 0x80, 0x22, 0x80, 0x01, 0x80, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x22, 
-    0x84, 0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x63, 0x8C, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x01, 0x80, 
-    0x21, 0x80, 0x01, 0x80, 0x84, 0x8C, 0x84, 0x8C, 0x43, 0x84, 0x84, 0x8C, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x80, 0x22, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x22, 0x84, 0x63, 0x8C, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x63, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x84, 0x8C, 0x21, 0x84, 0x44, 0x84, 0x84, 0x90, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x22, 0x80, 0x21, 0x80, 0x22, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x80, 0x21, 0x80, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x63, 0x88, 0x44, 0x84, 0x42, 0x84, 0x63, 0x88, 0x63, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x44, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 
-    0x84, 0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x21, 
-    0x80, 0x22, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x63, 
-    0x8C, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x63, 0x8C, 0x63, 0x88, 0x63, 0x88, 0x21, 0x84, 0x84, 0x8C, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x80, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x44, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x63, 0x88, 0x44, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x63, 0x88, 
-    0x44, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x80, 0x42, 0x84, 0x84, 0x8C, 0x63, 0x88, 0x63, 
-    0x88, 0xA5, 0x90, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x63, 0x88, 0x21, 
-    0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x63, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x65, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x63, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x84, 0x8C, 0x63, 0x8C, 0x63, 0x88, 0xA5, 0x90, 0x84, 0x8C, 0x21, 0x84, 
-    0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x22, 0x80, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x63, 
-    0x8C, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x84, 
-    0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x84, 0x8C, 0xA5, 
-    0x90, 0x63, 0x88, 0x42, 0x84, 0xA5, 0x90, 0xA5, 0x90, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x63, 
-    0x8C, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x80, 0x63, 0x8C, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x84, 0x90, 0x84, 0x8C, 0x42, 0x84, 0x63, 0x88, 0x84, 0x90, 0x63, 0x88, 
-    0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x64, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x63, 
-    0x88, 0x84, 0x90, 0x63, 0x88, 0x63, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x80, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x44, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 
-    0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0xA5, 0x94, 0x42, 0x88, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x80, 0x44, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x63, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x63, 0x8C, 0x84, 0x90, 0x63, 0x8C, 0x63, 0x88, 0x63, 0x88, 0x84, 0x90, 
-    0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x44, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x80, 0x22, 0x80, 0x22, 0x80, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x63, 0x8C, 0xA5, 0x90, 0x84, 0x8C, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x44, 0x84, 
-    0x63, 0x8C, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x80, 0x63, 0x88, 0x63, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x63, 0x88, 0x44, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x44, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x22, 0x84, 0x44, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x84, 0x90, 0x63, 0x8C, 0x21, 0x84, 0x63, 0x88, 0x84, 0x90, 
-    0x63, 0x88, 0x43, 0x84, 0x01, 0x80, 0x01, 0x80, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 
-    0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x44, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x64, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 
-    0x80, 0x42, 0x88, 0x63, 0x8C, 0xC6, 0x94, 0xA5, 0x90, 0x84, 0x8C, 0x63, 0x88, 0x63, 0x88, 
-    0x43, 0x84, 0x84, 0x90, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x22, 
-    0x80, 0x42, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x42, 0x84, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x63, 0x8C, 0x63, 0x88, 0x63, 0x88, 0x21, 0x84, 
-    0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 
-    0x8C, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x63, 0x88, 0x42, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x84, 0x8C, 
-    0x63, 0x88, 0x63, 0x88, 0x44, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x84, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0xA5, 0x90, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x21, 
-    0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x63, 0x8C, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 
-    0x84, 0x90, 0x22, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x22, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x64, 
-    0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x64, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x01, 0x80, 0x01, 0x80, 0x22, 0x80, 0x64, 0x88, 0xA5, 0x90, 
-    0x84, 0x8C, 0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 0x63, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x63, 0x8C, 0x42, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 
-    0x42, 0x88, 0x22, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x65, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x44, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x63, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x21, 0x80, 0x84, 0x90, 0x21, 0x80, 0x21, 0x84, 
-    0x42, 0x84, 0x63, 0x88, 0x22, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x63, 0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x63, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x01, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0xA5, 0x90, 0x42, 0x84, 0x63, 0x88, 0x44, 0x84, 0x63, 0x88, 0x84, 0x8C, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x64, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x22, 0x84, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x84, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x84, 0x42, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x80, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x64, 
-    0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x63, 0x8C, 0x84, 0x90, 0x21, 0x84, 
-    0x63, 0x88, 0x63, 0x88, 0x63, 0x8C, 0x22, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x01, 0x80, 0x21, 0x80, 
-    0x43, 0x84, 0xA5, 0x90, 0x63, 0x88, 0x63, 0x88, 0x42, 0x84, 0x63, 0x88, 0x63, 0x88, 0x63, 
-    0x8C, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x64, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x22, 
-    0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 
-    0x8C, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 0x8C, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 
-    0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 
-    0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x84, 0x90, 0x42, 0x88, 
-    0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x84, 0x8C, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x43, 0x84, 0x44, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x63, 0x8C, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x21, 0x84, 0x44, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x44, 0x84, 0x63, 0x8C, 0x84, 0x8C, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x63, 
-    0x8C, 0x42, 0x88, 0x63, 0x8C, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x44, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x80, 0x42, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x44, 0x84, 0x22, 0x80, 0x42, 0x88, 0x84, 0x90, 0x63, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x84, 0x90, 0x01, 0x80, 0x21, 0x80, 0x01, 
-    0x80, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x44, 0x84, 0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x63, 0x88, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x84, 0x90, 0x84, 0x8C, 0x63, 0x88, 0x84, 
-    0x8C, 0x63, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x22, 0x84, 0x44, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x8C, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x42, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x84, 0x90, 0x42, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x63, 0x8C, 0x63, 0x8C, 0x01, 0x80, 0x01, 
-    0x80, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x22, 0x84, 0x43, 0x84, 
-    0x63, 0x8C, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x63, 0x8C, 0x43, 0x84, 0x63, 
-    0x88, 0x63, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x63, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x80, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x64, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x44, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x42, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x63, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x84, 0x90, 
-    0x21, 0x84, 0x63, 0x8C, 0x63, 0x8C, 0x21, 0x84, 0x42, 0x84, 0xA5, 0x90, 0x63, 0x88, 0x01, 
-    0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x63, 0x8C, 0x63, 0x8C, 0x43, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 
-    0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0xA5, 0x90, 0x84, 
-    0x8C, 0x63, 0x88, 0x84, 0x8C, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x44, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x44, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x42, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x65, 0x88, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x22, 0x80, 0x42, 0x88, 0x43, 0x84, 
-    0x63, 0x8C, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x42, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x44, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x63, 0x88, 0x63, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x84, 0x90, 0x42, 0x88, 0x63, 0x8C, 0x63, 0x88, 0x63, 0x88, 0x42, 0x88, 0x84, 0x90, 0x42, 
-    0x88, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x63, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x63, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x44, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x84, 
-    0x90, 0x84, 0x8C, 0x63, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x80, 0x63, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x22, 
-    0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x80, 
-    0x22, 0x80, 0x42, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x44, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x63, 0x8C, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x80, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x22, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x44, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x84, 0x90, 0x42, 0x88, 0x21, 0x84, 0x63, 0x88, 0x42, 0x88, 0x63, 0x88, 0x84, 
-    0x8C, 0x42, 0x88, 0x01, 0x80, 0x01, 0x80, 0x44, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x22, 0x80, 
-    0x42, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x64, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x21, 0x80, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x63, 0x88, 
-    0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x43, 
-    0x84, 0x64, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x84, 0x22, 0x80, 0x21, 0x84, 0x42, 0x88, 0x44, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x84, 0x8C, 0x63, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x63, 0x8C, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 
-    0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x64, 0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x44, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x44, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x42, 0x84, 0x43, 0x84, 0x84, 0x90, 0x42, 0x88, 0x42, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 
-    0x88, 0x63, 0x88, 0x21, 0x84, 0x01, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x63, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x63, 0x8C, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 
-    0x8C, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 0x88, 
-    0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x63, 0x8C, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x80, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 
-    0x80, 0x42, 0x88, 0x84, 0x90, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x84, 0x21, 0x84, 
-    0x63, 0x88, 0x84, 0x8C, 0x42, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x42, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x44, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x80, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x44, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 
-    0x44, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x84, 0x22, 0x84, 0x63, 0x88, 0x84, 0x90, 0x42, 0x88, 0x42, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x63, 0x88, 0x63, 0x8C, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x44, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x63, 0x88, 0x63, 0x88, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x84, 0x90, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 
-    0x21, 0x80, 0x44, 0x84, 0x84, 0x8C, 0x22, 0x84, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x63, 0x88, 0x21, 0x80, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 0x21, 
-    0x84, 0x01, 0x80, 0x22, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x84, 0x63, 0x8C, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 
-    0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x63, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x63, 
-    0x8C, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x84, 0x90, 0x63, 0x8C, 0x21, 0x84, 0x21, 0x84, 
-    0x63, 0x88, 0x21, 0x84, 0x44, 0x84, 0x84, 0x90, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 0x21, 0x80, 0x42, 0x88, 
-    0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x80, 0x21, 0x80, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x63, 0x88, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x21, 0x80, 0x22, 0x80, 0x22, 0x80, 0x84, 0x90, 0x22, 0x80, 0x22, 0x80, 0x42, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 
-    0x42, 0x88, 0x42, 0x88, 0x44, 0x84, 0x22, 0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x88, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x44, 0x84, 0x22, 0x80, 0x44, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x84, 0x90, 0x63, 0x8C, 0x63, 0x88, 
-    0x21, 0x84, 0x63, 0x88, 0x22, 0x84, 0x44, 0x84, 0xA5, 0x94, 0x22, 0x80, 0x22, 0x80, 0x42, 
-    0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 
-    0x80, 0x22, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 
-    0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x65, 0x88, 
-    0x21, 0x80, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x42, 0x84, 0x42, 0x84, 0x42, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x80, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x44, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x84, 0x90, 0x22, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x84, 0x8C, 0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x44, 0x84, 0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x44, 0x84, 0x44, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x84, 0x90, 0x63, 0x8C, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 0x63, 0x88, 0x44, 0x84, 0xA5, 0x94, 0x64, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x84, 
-    0x42, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 
-    0x42, 0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0xA5, 0x90, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x84, 0x90, 0x21, 0x84, 
-    0x01, 0x80, 0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x22, 0x80, 0x44, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x63, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 
-    0x44, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x63, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x63, 0x88, 0x22, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x44, 0x84, 0x44, 
-    0x84, 0x22, 0x80, 0x42, 0x88, 0x63, 0x8C, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x84, 0x90, 
-    0x63, 0x8C, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x84, 0x90, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x64, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 
-    0x8C, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x63, 0x8C, 
-    0x21, 0x84, 0x22, 0x80, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x22, 
-    0x80, 0x22, 0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x44, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x22, 0x80, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 
-    0x22, 0x80, 0x43, 0x84, 0x42, 0x84, 0x22, 0x84, 0x42, 0x88, 0x63, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x44, 0x84, 0x21, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x80, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0xA5, 0x94, 0x84, 0x90, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x84, 0x90, 0x63, 
-    0x8C, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x44, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x84, 0x8C, 0x22, 0x84, 0x21, 0x80, 0x44, 0x84, 0x44, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x80, 
-    0x21, 0x84, 0x63, 0x88, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x44, 0x84, 0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x84, 0x22, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x44, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x44, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x84, 0x8C, 0x21, 0x84, 0x21, 0x80, 0x42, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x84, 0x90, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x44, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x22, 0x84, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0xA5, 0x94, 0x84, 0x90, 0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x84, 0x8C, 0xA5, 
-    0x94, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x44, 0x84, 0x44, 0x84, 0x21, 0x80, 0x44, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x80, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x22, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 
-    0x63, 0x8C, 0x42, 0x84, 0x22, 0x80, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x80, 0x43, 0x84, 0x22, 0x80, 0x63, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x64, 
-    0x84, 0x21, 0x84, 0x84, 0x8C, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x63, 0x8C, 0x21, 0x84, 0x01, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x63, 
-    0x8C, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x21, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x44, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 
-    0x88, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0xA5, 0x94, 0x63, 0x8C, 0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x84, 
-    0x90, 0x84, 0x8C, 0x01, 0x80, 0x22, 0x84, 0x64, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x84, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x63, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x84, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x44, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x22, 0x80, 0x21, 0x84, 0x84, 0x90, 0x01, 0x80, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 
-    0x01, 0x80, 0x21, 0x80, 0x63, 0x8C, 0x22, 0x84, 0x01, 0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x63, 0x8C, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x21, 
-    0x80, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x80, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x80, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x63, 0x8C, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x8C, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x64, 0x88, 0x22, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0xA5, 0x94, 0x63, 0x8C, 0x01, 0x80, 0x21, 0x84, 0x63, 
-    0x88, 0x84, 0x90, 0x43, 0x84, 0x01, 0x80, 0x21, 0x80, 0x22, 0x80, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x43, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x85, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x44, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x44, 0x84, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 
-    0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x22, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x80, 0x42, 0x88, 0x42, 0x84, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 
-    0x42, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 
-    0x80, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x84, 0x8C, 0x21, 0x84, 0x01, 0x80, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x63, 0x8C, 0x63, 0x88, 0x01, 0x80, 0x21, 0x80, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x44, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x80, 0x63, 0x88, 0x63, 
-    0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x84, 0x63, 0x8C, 0x42, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x84, 0x90, 0x84, 0x8C, 0x42, 0x88, 0x42, 
-    0x88, 0x84, 0x8C, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x80, 
-    0x44, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x44, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x44, 0x84, 0x22, 0x80, 0x22, 0x80, 0x21, 
-    0x84, 0x22, 0x84, 0x63, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x42, 0x88, 
-    0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x84, 0x42, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x80, 0x22, 0x80, 0x43, 0x84, 0x42, 0x84, 0x42, 0x84, 0x22, 0x80, 0x42, 0x88, 0x42, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0xA5, 0x90, 0x42, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x01, 0x80, 0x42, 0x88, 0x63, 0x8C, 0x01, 0x80, 0x01, 
-    0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x44, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x63, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x42, 
-    0x84, 0x22, 0x80, 0x43, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x44, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x84, 0x8C, 0x42, 0x88, 0x63, 
-    0x88, 0x42, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 
-    0x80, 0x43, 0x84, 0x42, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x80, 0x22, 0x80, 0x43, 0x84, 0x42, 0x84, 0x42, 0x84, 0x22, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x80, 0x42, 0x88, 0x21, 0x84, 0x84, 0x90, 0x01, 0x80, 
-    0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x01, 0x80, 0x63, 0x88, 0x63, 0x8C, 0x01, 
-    0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x63, 0x8C, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x63, 0x88, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x80, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x44, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x84, 0x8C, 0x42, 
-    0x84, 0x42, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x80, 
-    0x21, 0x84, 0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x42, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x65, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x44, 0x84, 0x44, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x84, 0x22, 0x84, 
-    0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 0x43, 0x84, 0x44, 
-    0x84, 0x44, 0x84, 0x44, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x44, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x84, 0x90, 
-    0x01, 0x80, 0x42, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x63, 0x88, 0x63, 
-    0x8C, 0x01, 0x80, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x44, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 
-    0x80, 0x22, 0x80, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x84, 0x44, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x44, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x84, 0x90, 0x84, 
-    0x8C, 0x42, 0x84, 0x43, 0x84, 0x44, 0x84, 0x21, 0x80, 0x42, 0x84, 0x43, 0x84, 0x42, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x44, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x44, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 
-    0x63, 0x88, 0x22, 0x84, 0x42, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x63, 0x8C, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 
-    0x8C, 0x63, 0x88, 0x22, 0x84, 0x01, 0x80, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x42, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x44, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x42, 0x84, 0x22, 0x84, 0x63, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x44, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x43, 0x84, 0x44, 0x84, 0x21, 0x84, 0x44, 0x84, 0x84, 
-    0x90, 0x63, 0x88, 0x42, 0x84, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 
-    0x63, 0x88, 0x01, 0x80, 0x22, 0x80, 0x43, 0x84, 0x22, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x42, 
-    0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x21, 0x80, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x80, 0x63, 0x8C, 0x43, 0x84, 0x21, 0x84, 0x01, 0x80, 0x22, 0x84, 0x43, 0x84, 0x63, 
-    0x88, 0x63, 0x88, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x44, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x80, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x63, 0x8C, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x8C, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x80, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x63, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x84, 0x42, 0x84, 0x43, 0x84, 0x63, 0x88, 
-    0x43, 0x84, 0x44, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 
-    0x80, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x63, 0x8C, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 
-    0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x63, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 
-    0x42, 0x88, 0x21, 0x80, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x01, 0x80, 0x21, 0x80, 0x43, 
-    0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x44, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x80, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x42, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x84, 0x21, 0x84, 0x63, 0x88, 0x01, 0x80, 0x01, 0x80, 0x42, 0x84, 0x42, 0x84, 
-    0x63, 0x88, 0x42, 0x88, 0x84, 0x90, 0x01, 0x80, 0x21, 0x84, 0x22, 0x80, 0x22, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x21, 0x80, 0x85, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x44, 
-    0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x80, 0x01, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0xA5, 0x94, 0x01, 0x80, 0x21, 0x80, 
-    0x01, 0x80, 0x44, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x44, 0x84, 0x22, 0x84, 
-    0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x22, 0x84, 0x42, 0x84, 0x42, 0x88, 
-    0x42, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x22, 
-    0x84, 0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 0x22, 0x80, 0x22, 
-    0x84, 0x63, 0x8C, 0x84, 0x8C, 0x84, 0x90, 0x63, 0x88, 0x01, 0x80, 0x01, 0x80, 0x42, 0x84, 
-    0x42, 0x84, 0x63, 0x88, 0x43, 0x84, 0x84, 0x90, 0x01, 0x80, 0x22, 0x80, 0x42, 0x88, 0x22, 
-    0x80, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x85, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x63, 0x8C, 0x42, 0x88, 0x43, 
-    0x84, 0x44, 0x84, 0x21, 0x84, 0x42, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x63, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x63, 0x8C, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x80, 0x44, 0x84, 0x63, 0x88, 0x22, 
-    0x80, 0x22, 0x84, 0x22, 0x84, 0x44, 0x84, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x84, 0x90, 
-    0x01, 0x80, 0x22, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x63, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x42, 0x88, 0x65, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x63, 0x8C, 0xA5, 0x90, 0x84, 0x8C, 0x63, 0x88, 0x21, 0x84, 0x42, 0x84, 0x63, 0x88, 
-    0x42, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x84, 0x8C, 0x21, 0x80, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x63, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x63, 0x8C, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 0x44, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x21, 0x80, 0x44, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x22, 0x80, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x80, 0x21, 0x84, 0x42, 0x84, 0x22, 0x80, 
-    0x63, 0x88, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 0x44, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x44, 0x84, 0x44, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x84, 0x90, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x44, 0x84, 0x44, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x42, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x44, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x63, 0x8C, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x64, 0x88, 0x84, 0x90, 0xA5, 0x90, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 
-    0x63, 0x88, 0x42, 0x84, 0x42, 0x84, 0x44, 0x84, 0x63, 0x8C, 0x63, 0x88, 0x21, 0x80, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x80, 0x21, 
-    0x84, 0x42, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x80, 0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 0x80, 0x63, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x63, 0x88, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x63, 0x88, 0x84, 0x90, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0xA5, 0x90, 0x84, 0x8C, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 
-    0x21, 0x80, 0x63, 0x88, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x84, 0x90, 0x21, 0x84, 0x01, 
-    0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x80, 0x44, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0xA5, 0x90, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x63, 0x8C, 
-    0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x01, 
-    0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x44, 0x84, 0x84, 0x8C, 0x84, 0x8C, 0x63, 0x88, 
-    0x63, 0x88, 0x22, 0x84, 0x22, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x21, 
-    0x80, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x63, 
-    0x8C, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x42, 0x88, 0x44, 0x84, 0x21, 0x84, 0x42, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 0x63, 
-    0x8C, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x44, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0xA5, 0x90, 0x22, 0x80, 0x42, 0x84, 0x63, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x84, 0x21, 0x84, 0x21, 0x84, 0x84, 0x90, 0x21, 
-    0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x63, 0x8C, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x63, 0x8C, 
-    0x42, 0x88, 0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x44, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x8C, 0x63, 0x88, 0x84, 0x8C, 
-    0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 0x84, 0x90, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 
-    0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x42, 0x88, 0x22, 0x80, 0x22, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x84, 0x21, 0x84, 0x63, 0x88, 
-    0x63, 0x88, 0x84, 0x8C, 0x84, 0x90, 0x84, 0x90, 0x63, 0x88, 0x42, 0x84, 0x63, 0x88, 0x63, 
-    0x8C, 0x01, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x85, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x63, 0x88, 0x63, 0x88, 0x42, 0x88, 0x21, 0x80, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x84, 0x64, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x44, 0x84, 
-    0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x01, 0x80, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 0x22, 0x80, 0x22, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x64, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x63, 0x8C, 0xA5, 0x90, 0x21, 0x84, 0x21, 0x84, 
-    0x63, 0x88, 0x63, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x63, 0x8C, 0x42, 0x84, 0x84, 
-    0x90, 0x42, 0x88, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x84, 0x42, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x63, 0x8C, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x42, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x80, 0x44, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x84, 0x84, 0x8C, 0x84, 0x8C, 0x63, 0x88, 
-    0x63, 0x88, 0x84, 0x8C, 0x22, 0x84, 0x63, 0x88, 0x22, 0x84, 0x63, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x84, 0x8C, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x44, 0x84, 0x63, 0x8C, 
-    0x21, 0x84, 0x42, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x63, 0x88, 0x21, 0x80, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x44, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0xA5, 0x90, 0x84, 0x8C, 0x21, 0x84, 
-    0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x63, 0x88, 0x84, 0x90, 0x63, 0x8C, 0x43, 0x84, 0x63, 
-    0x88, 0x84, 0x90, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x84, 0x90, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x63, 0x8C, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x85, 0x88, 0x64, 0x84, 
-    0x63, 0x88, 0x42, 0x84, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x63, 0x88, 0x84, 0x8C, 0x63, 
-    0x88, 0x21, 0x80, 0x84, 0x8C, 0xA5, 0x90, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x22, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x21, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x88, 
-    0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x84, 0x90, 0xA5, 0x90, 0x84, 0x90, 
-    0x21, 0x84, 0x63, 0x88, 0x63, 0x8C, 0x42, 0x84, 0x84, 0x8C, 0x63, 0x88, 0x42, 0x84, 0x42, 
-    0x84, 0x84, 0x8C, 0x63, 0x8C, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x63, 0x8C, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x44, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x80, 0x21, 0x80, 0x22, 0x84, 
-    0x64, 0x88, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x44, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 
-    0x88, 0x84, 0x8C, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x63, 0x8C, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x44, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x84, 0x90, 0x84, 0x90, 0x43, 0x84, 
-    0x21, 0x84, 0x63, 0x88, 0x84, 0x8C, 0x63, 0x8C, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 
-    0x84, 0x42, 0x84, 0xA5, 0x90, 0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 
-    0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x84, 0x42, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x42, 0x88, 0x44, 0x84, 0x42, 
-    0x88, 0x44, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x84, 0x8C, 0x22, 0x84, 0x43, 0x84, 0x63, 
-    0x88, 0x63, 0x88, 0x63, 0x88, 0x42, 0x84, 0x42, 0x84, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x44, 0x84, 0x44, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x80, 0x21, 
-    0x80, 0x21, 0x84, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 
-    0x8C, 0x63, 0x88, 0x44, 0x84, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x8C, 0x84, 0x8C, 
-    0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x63, 0x88, 0x84, 0x8C, 0x64, 
-    0x88, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0x63, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 
-    0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 0x84, 0x8C, 0x63, 0x88, 0x21, 0x84, 0x22, 
-    0x80, 0x01, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x44, 0x84, 0x44, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0xA5, 0x90, 0x84, 0x90, 
-    0x42, 0x84, 0x42, 0x84, 0x42, 0x84, 0x63, 0x88, 0x42, 0x84, 0x42, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x63, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 
-    0x8C, 0xA5, 0x94, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 
-    0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 
-    0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 0x64, 0x88, 0x44, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x63, 0x88, 0x63, 0x88, 0x63, 0x8C, 0x21, 0x84, 0x42, 0x88, 0x84, 0x8C, 
-    0xA5, 0x90, 0x01, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x44, 0x84, 0x43, 0x84, 0x44, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x80, 0x22, 0x80, 0x21, 0x80, 0x84, 0x90, 0x85, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x42, 0x88, 
-    0x42, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x84, 0x44, 0x84, 0x63, 0x88, 0x63, 0x88, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x63, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x84, 0x90, 0xA5, 0x90, 0x84, 0x90, 0x84, 0x90, 0x42, 0x88, 0x21, 0x80, 0x21, 
-    0x80, 0x22, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x44, 0x84, 0x43, 
-    0x84, 0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x84, 0x90, 0x84, 0x90, 
-    0x63, 0x8C, 0x63, 0x88, 0x42, 0x84, 0x42, 0x84, 0x63, 0x88, 0x42, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x63, 0x88, 0x21, 0x84, 0x63, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x22, 0x80, 
-    0x43, 0x84, 0x42, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x21, 0x80, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x01, 0x80, 0x22, 0x80, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 
-    0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x01, 0x80, 0x22, 0x84, 0x42, 0x88, 0x84, 0x90, 
-    0x84, 0x8C, 0x42, 0x88, 0x84, 0x8C, 0x42, 0x88, 0x63, 0x88, 0x64, 0x88, 0x22, 0x84, 0x03, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x80, 0x44, 0x84, 0x63, 0x88, 
-    0x63, 0x88, 0x63, 0x8C, 0x63, 0x8C, 0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x21, 0x80, 0x01, 
-    0x80, 0x42, 0x88, 0x42, 0x84, 0x42, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x84, 0x90, 0x84, 0x90, 0x63, 0x88, 0x22, 0x84, 0x01, 0x80, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x44, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x84, 0x90, 0xC6, 0x94, 
-    0x22, 0x84, 0x63, 0x88, 0x63, 0x88, 0x42, 0x84, 0x42, 0x84, 0x42, 0x84, 0x63, 0x88, 0x63, 
-    0x88, 0x44, 0x84, 0x44, 0x84, 0x63, 0x88, 0xA5, 0x90, 0x21, 0x80, 0x21, 0x80, 0x22, 0x80, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 0x22, 0x80, 0x44, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x21, 0x80, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x63, 0x88, 0xA5, 0x90, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x84, 0x42, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 
-    0x84, 0x01, 0x80, 0x63, 0x88, 0x63, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x63, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x88, 0xA5, 0x90, 0x63, 0x88, 0x22, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 
-    0x22, 0x84, 0x01, 0x80, 0x65, 0x88, 0x84, 0x8C, 0x63, 0x88, 0x63, 0x88, 0x22, 0x84, 0x22, 
-    0x80, 0x22, 0x80, 0x03, 0x80, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x63, 0x8C, 0x63, 0x8C, 
-    0x63, 0x88, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x22, 0x80, 0x63, 0x8C, 0x44, 0x84, 0x63, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x42, 0x88, 
-    0x63, 0x8C, 0x63, 0x8C, 0x84, 0x90, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 
-    0x84, 0x90, 0x43, 0x84, 0x63, 0x88, 0x84, 0x8C, 0x63, 0x8C, 0x22, 0x80, 0x42, 0x84, 0x42, 
-    0x84, 0x42, 0x84, 0x21, 0x84, 0x63, 0x88, 0x84, 0x90, 0x21, 0x84, 0x01, 0x80, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x63, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x42, 0x84, 0x22, 0x80, 0x42, 0x88, 0x63, 
-    0x8C, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x42, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x63, 
-    0x8C, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x63, 0x8C, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x63, 
-    0x88, 0x21, 0x84, 0x01, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x01, 0x80, 0x63, 0x88, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x63, 0x88, 0x84, 0x90, 0x44, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x63, 0x8C, 0x84, 0x8C, 0x44, 0x84, 0x63, 
-    0x88, 0x22, 0x84, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x63, 0x8C, 
-    0x63, 0x8C, 0x22, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x44, 
-    0x84, 0x44, 0x84, 0x42, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x44, 0x84, 
-    0x84, 0x90, 0x84, 0x8C, 0x84, 0x90, 0x63, 0x8C, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x44, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x64, 0x88, 0xC6, 0x94, 0xA5, 0x90, 
-    0x84, 0x90, 0x63, 0x88, 0x43, 0x84, 0x63, 0x88, 0x84, 0x8C, 0x63, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x63, 0x88, 0x63, 0x88, 0xA5, 0x94, 0x84, 0x8C, 0x21, 0x80, 0x21, 0x80, 
-    0x22, 0x80, 0x42, 0x88, 0x21, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x22, 0x84, 0x22, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x44, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x42, 0x88, 0x01, 0x80, 0x01, 0x80, 0x63, 0x88, 0x44, 0x84, 0x21, 0x84, 
-    0x63, 0x88, 0x22, 0x84, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x42, 0x84, 0x42, 0x88, 0x63, 
-    0x88, 0x84, 0x8C, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x63, 0x88, 0x84, 0x90, 0x63, 
-    0x88, 0x43, 0x84, 0x22, 0x80, 0x22, 0x80, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x63, 0x88, 
-    0x63, 0x8C, 0x63, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 
-    0x80, 0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 
-    0x63, 0x88, 0x63, 0x8C, 0x84, 0x8C, 0x63, 0x88, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x22, 
-    0x80, 0x01, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x86, 0x8C, 0xA5, 0x90, 
-    0x84, 0x90, 0x63, 0x88, 0x63, 0x88, 0x21, 0x84, 0x63, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x21, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x63, 0x88, 0xA5, 0x90, 0xA5, 0x94, 0x01, 0x80, 0x01, 0x80, 
-    0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x44, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x63, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0xA5, 0x94, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x44, 0x84, 0x43, 0x84, 0x42, 0x84, 0x43, 0x84, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x01, 0x80, 0x21, 0x80, 0x42, 0x84, 0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x63, 0x88, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x42, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x63, 0x88, 0x44, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x84, 
-    0x90, 0x22, 0x84, 0x63, 0x88, 0x22, 0x80, 0x03, 0x80, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x63, 0x88, 0x42, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x21, 0x80, 0x63, 0x88, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 
-    0x63, 0x88, 0x63, 0x88, 0x21, 0x84, 0x84, 0x8C, 0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x86, 0x8C, 0xC6, 0x94, 
-    0x84, 0x90, 0x63, 0x8C, 0x63, 0x88, 0x21, 0x80, 0x21, 0x84, 0x44, 0x84, 0x84, 0x8C, 0x84, 
-    0x8C, 0x43, 0x84, 0x01, 0x80, 0x01, 0x80, 0x22, 0x80, 0xA5, 0x94, 0x84, 0x8C, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x22, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 
-    0x63, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x8C, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x84, 0x63, 0x8C, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x22, 0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x63, 0x88, 
-    0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x63, 0x88, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x80, 0x42, 0x88, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x21, 0x80, 0x01, 0x80, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x84, 
-    0x90, 0x63, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x84, 0x8C, 0x84, 0x90, 0x44, 0x84, 0x22, 0x80, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x63, 0x88, 0x44, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x01, 0x80, 0x01, 
-    0x80, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x01, 0x80, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x03, 0x80, 0x21, 0x84, 
-    0x22, 0x84, 0x42, 0x84, 0x22, 0x80, 0x63, 0x88, 0x44, 0x84, 0x21, 0x80, 0x01, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 
-    0x44, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x63, 
-    0x8C, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x86, 0x8C, 0xC6, 0x94, 0xA5, 0x90, 
-    0x63, 0x8C, 0x63, 0x8C, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x84, 
-    0x8C, 0x63, 0x88, 0x84, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x85, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x44, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x80, 0x42, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x01, 0x80, 0x21, 0x80, 0x42, 0x88, 0x01, 0x80, 
-    0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0xA5, 
-    0x90, 0x43, 0x84, 0x84, 0x90, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x84, 0x84, 0x8C, 0x84, 0x90, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x64, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x63, 0x8C, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x01, 
-    0x80, 0x01, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x80, 0x01, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x03, 0x80, 
-    0x42, 0x84, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x84, 0x8C, 0xA5, 0x90, 0x01, 0x80, 0x01, 
-    0x80, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x63, 0x8C, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x64, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x65, 0x88, 0xC6, 0x94, 0xA5, 0x90, 
-    0x84, 0x8C, 0x63, 0x8C, 0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x84, 
-    0x8C, 0x84, 0x8C, 0x63, 0x88, 0x84, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x44, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x63, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 
-    0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x22, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x80, 0x43, 0x84, 0x42, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x84, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x80, 0x43, 0x84, 0x21, 0x84, 0x63, 0x88, 0x63, 0x88, 0x63, 
-    0x8C, 0x42, 0x88, 0x42, 0x88, 0x84, 0x8C, 0x63, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x84, 
-    0x63, 0x88, 0x84, 0x90, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x01, 0x80, 0x01, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x03, 0x80, 
-    0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x84, 0x8C, 0x01, 0x80, 0x21, 0x80, 0x21, 
-    0x80, 0x22, 0x84, 0x22, 0x80, 0x21, 0x80, 0x01, 0x80, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x84, 0x8C, 0x01, 
-    0x80, 0x01, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x64, 0x88, 0xA5, 0x94, 0xA5, 0x90, 
-    0x84, 0x8C, 0x42, 0x88, 0x63, 0x88, 0x63, 0x88, 0x22, 0x84, 0x63, 0x88, 0x84, 0x8C, 0x63, 
-    0x88, 0x84, 0x8C, 0x63, 0x88, 0x63, 0x88, 0xA5, 0x90, 0x84, 0x8C, 0x42, 0x88, 0x42, 0x88, 
-    0x01, 0x80, 0x01, 0x80, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x63, 0x88, 
-    0x43, 0x84, 0x63, 0x88, 0x84, 0x90, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 0x80, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x80, 0x43, 0x84, 0x42, 0x84, 0x42, 0x84, 0x22, 0x80, 0x42, 0x88, 0x42, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 
-    0x80, 0x21, 0x84, 0x42, 0x84, 0x42, 0x84, 0x21, 0x80, 0x22, 0x80, 0x21, 0x84, 0x01, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x63, 0x88, 0x63, 0x8C, 0x84, 0x90, 0x84, 0x90, 0x84, 0x90, 0x63, 
-    0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x63, 0x88, 0x63, 0x88, 
-    0x63, 0x88, 0x42, 0x84, 0x42, 0x84, 0x84, 0x90, 0x85, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x03, 0x80, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x84, 0x8C, 0x01, 0x80, 0x21, 
-    0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x80, 0x01, 0x80, 0x84, 0x8C, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x23, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x01, 0x80, 0x01, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x85, 0x88, 0xA5, 0x90, 0xA5, 0x90, 
-    0x84, 0x8C, 0x84, 0x8C, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x44, 0x84, 0x63, 0x88, 0x84, 
-    0x8C, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x84, 0x8C, 0xA5, 0x90, 0x84, 0x8C, 
-    0x42, 0x88, 0x01, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x63, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x22, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x84, 0x22, 0x84, 0x63, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x44, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x63, 0x88, 0x63, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 0x43, 0x84, 0x63, 0x8C, 0x63, 0x8C, 0x23, 0x84, 0x84, 
-    0x90, 0x84, 0x90, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 
-    0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x84, 0x8C, 0x22, 0x84, 0x42, 0x84, 0x84, 0x90, 0x84, 
-    0x90, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x80, 0x22, 0x84, 0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 0x84, 0x8C, 0x01, 
-    0x80, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x01, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x42, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x84, 0x8C, 0x01, 0x80, 0x01, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x64, 0x88, 0xA5, 0x94, 0x84, 0x90, 0x84, 0x8C, 
-    0x63, 0x88, 0x42, 0x84, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x84, 0x63, 
-    0x88, 0x63, 0x88, 0x42, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x84, 0x84, 0x90, 0x63, 0x88, 
-    0x21, 0x80, 0x01, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x85, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x80, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x63, 
-    0x8C, 0x84, 0x90, 0x84, 0x90, 0x63, 0x88, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 
-    0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x63, 0x88, 0x42, 0x84, 0x63, 
-    0x88, 0x84, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x43, 0x84, 
-    0x22, 0x80, 0x22, 0x84, 0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x84, 
-    0x8C, 0x01, 0x80, 0x21, 0x80, 0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x01, 0x80, 
-    0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x80, 0x42, 0x84, 0x63, 0x88, 0x01, 0x80, 0x01, 0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x65, 0x88, 0xA6, 0x94, 0x84, 0x90, 0x63, 0x88, 
-    0x42, 0x84, 0x42, 0x84, 0x63, 0x88, 0x63, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x63, 0x88, 0x42, 
-    0x84, 0x42, 0x84, 0x63, 0x88, 0x42, 0x84, 0x42, 0x84, 0x42, 0x84, 0x42, 0x84, 0x63, 0x88, 
-    0x21, 0x80, 0x01, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x44, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x80, 0x63, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x65, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x63, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 
-    0x80, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 
-    0x42, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x42, 0x88, 0x63, 
-    0x8C, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x63, 0x88, 0x22, 
-    0x80, 0x63, 0x88, 0x42, 0x84, 0x84, 0x90, 0xA5, 0x90, 0x84, 0x8C, 0x21, 0x84, 0x63, 0x8C, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x01, 0x80, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x63, 0x88, 0x01, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x01, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x01, 0x80, 0x01, 0x80, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x80, 0x21, 0x80, 0x65, 0x88, 0xA5, 0x94, 0xA5, 0x94, 0x84, 0x8C, 0x42, 0x88, 
-    0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 0x42, 0x84, 0x63, 0x88, 0x42, 0x88, 0x84, 0x8C, 0x63, 
-    0x88, 0x42, 0x84, 0x42, 0x84, 0x63, 0x88, 0x42, 0x84, 0x42, 0x84, 0x42, 0x84, 0x63, 0x88, 
-    0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x63, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x64, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x84, 0x42, 
-    0x84, 0x42, 0x84, 0x42, 0x84, 0x63, 0x88, 0x63, 0x8C, 0x84, 0x8C, 0x84, 0x90, 0xA5, 0x90, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x01, 0x80, 0x22, 0x84, 0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x63, 0x88, 0x01, 0x80, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0x01, 0x80, 0x01, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x22, 0x84, 0x42, 0x84, 0x43, 
-    0x84, 0x23, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x43, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x65, 0x88, 0xA5, 0x94, 0xA5, 0x90, 0x84, 0x8C, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 0x63, 0x88, 0x42, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 
-    0x88, 0x63, 0x88, 0x21, 0x84, 0x42, 0x84, 0x44, 0x84, 0x42, 0x84, 0x64, 0x88, 0x63, 0x88, 
-    0x63, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 
-    0x8C, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x63, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 
-    0x8C, 0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x63, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x84, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 0x80, 0x22, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 
-    0x42, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x23, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x21, 0x84, 0x22, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x80, 0x42, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x84, 0x90, 0x84, 0x90, 0xA5, 0x90, 0x84, 0x8C, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x01, 0x80, 
-    0x21, 0x80, 0x01, 0x80, 0x84, 0x8C, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x80, 0x42, 0x88, 0x63, 0x8C, 0x01, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x63, 0x8C, 0x63, 0x88, 0x42, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x84, 0x42, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x01, 0x80, 0x01, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x44, 0x84, 0x43, 0x84, 0x85, 
-    0x88, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0x84, 0x90, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x22, 0x80, 0x63, 0x88, 0x42, 0x84, 0x42, 0x84, 0x63, 0x88, 0x63, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x84, 0x42, 0x84, 0x84, 0x90, 0x63, 0x8C, 
-    0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x80, 0x63, 0x88, 0x42, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x84, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x65, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x63, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x84, 0x22, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x22, 0x80, 0x63, 0x88, 0x42, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 
-    0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x84, 0x22, 
-    0x80, 0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x63, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 0x22, 0x84, 
-    0x63, 0x88, 0x21, 0x80, 0x63, 0x88, 0x84, 0x90, 0x84, 0x90, 0x84, 0x8C, 0xA5, 0x90, 0x84, 
-    0x8C, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x22, 0x80, 0x01, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x01, 0x80, 0x63, 0x8C, 0x42, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x01, 0x80, 
-    0x01, 0x80, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x65, 0x88, 0xA5, 0x90, 0xC6, 
-    0x94, 0xA5, 0x90, 0x84, 0x8C, 0x84, 0x8C, 0x42, 0x88, 0x42, 0x84, 0x21, 0x80, 0x42, 0x84, 
-    0x42, 0x84, 0x42, 0x84, 0x22, 0x80, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 0x22, 0x84, 0x63, 
-    0x88, 0x63, 0x88, 0x63, 0x88, 0x42, 0x84, 0x42, 0x88, 0x42, 0x84, 0x63, 0x88, 0x42, 0x88, 
-    0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x44, 0x84, 0x42, 0x88, 0x42, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x80, 0x22, 0x84, 0x63, 0x88, 
-    0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 
-    0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x42, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x64, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x44, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x22, 0x84, 0x63, 0x8C, 0x42, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 
-    0x42, 0x84, 0x22, 0x80, 0x22, 0x84, 0x63, 0x88, 0x21, 0x80, 0x21, 0x84, 0x63, 0x88, 0x84, 
-    0x8C, 0xA5, 0x90, 0xA5, 0x90, 0x42, 0x88, 0x21, 0x80, 0x42, 0x84, 0x42, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x22, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x01, 0x80, 0x43, 0x84, 0x42, 0x88, 0x84, 0x90, 0x01, 0x80, 0x01, 0x80, 0x43, 0x84, 
-    0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x80, 0x63, 0x88, 0x42, 0x84, 0x43, 
-    0x84, 0x63, 0x88, 0x63, 0x88, 0x42, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x84, 0x84, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0x84, 0x8C, 0x84, 0x8C, 0x63, 0x88, 0x42, 0x84, 0x42, 0x84, 0x42, 0x84, 0x42, 0x84, 
-    0x42, 0x84, 0x42, 0x84, 0x22, 0x80, 0x22, 0x80, 0x22, 0x80, 0x22, 0x80, 0x22, 0x80, 0x22, 
-    0x84, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x84, 0x63, 0x88, 0x84, 0x8C, 
-    0x22, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x21, 0x84, 0x44, 0x84, 0x22, 0x84, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x85, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x80, 0x42, 0x88, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 0x42, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 
-    0x22, 0x84, 0x01, 0x80, 0x42, 0x88, 0x63, 0x88, 0x42, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x22, 0x80, 0x21, 0x80, 0x22, 0x80, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x63, 
-    0x88, 0x63, 0x88, 0x44, 0x84, 0x84, 0x8C, 0x84, 0x8C, 0x21, 0x80, 0x21, 0x80, 0x42, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x01, 0x80, 0x21, 0x80, 0x42, 0x88, 0x63, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x63, 0x8C, 0x63, 
-    0x88, 0x22, 0x84, 0x42, 0x84, 0x42, 0x84, 0x42, 0x84, 0x42, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x63, 0x88, 0x42, 0x88, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0x84, 
-    0x8C, 0x63, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x22, 0x80, 0x22, 0x80, 0x22, 
-    0x80, 0x22, 0x84, 0x42, 0x84, 0x42, 0x84, 0x42, 0x84, 0x63, 0x88, 0x84, 0x8C, 0xA5, 0x90, 
-    0x43, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x80, 0x42, 
-    0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x22, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x80, 0x22, 0x80, 0x65, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x84, 0x42, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x80, 0x21, 0x84, 
-    0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x42, 0x88, 0x21, 0x84, 0x63, 0x88, 0x63, 
-    0x88, 0x63, 0x8C, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x44, 0x84, 0x63, 0x88, 0x64, 
-    0x88, 0x63, 0x88, 0x42, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x42, 0x88, 0x01, 0x80, 0x63, 0x8C, 
-    0xA5, 0x90, 0x84, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x63, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x84, 0x8C, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x90, 0x43, 
-    0x84, 0x22, 0x80, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x84, 0x42, 0x84, 
-    0x21, 0x80, 0x42, 0x84, 0x42, 0x84, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x21, 0x80, 0x01, 
-    0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x43, 
-    0x84, 0x22, 0x80, 0x42, 0x84, 0x42, 0x84, 0x63, 0x88, 0x84, 0x8C, 0x42, 0x88, 0x21, 0x84, 
-    0x01, 0x80, 0x01, 0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x84, 0x63, 0x88, 0x42, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 
-    0x63, 0x88, 0x21, 0x80, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 0x21, 0x84, 0x42, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 
-    0x80, 0x63, 0x8C, 0x63, 0x8C, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x80, 0x21, 0x80, 0x23, 0x84, 0x63, 
-    0x88, 0x42, 0x84, 0x63, 0x88, 0x84, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0xA5, 0x90, 
-    0x84, 0x8C, 0x84, 0x8C, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x84, 0x22, 0x80, 0x22, 0x84, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x63, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x90, 0x63, 
-    0x8C, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x84, 
-    0x42, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x42, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x42, 0x84, 0x42, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x21, 
-    0x84, 0x21, 0x80, 0x42, 0x84, 0x21, 0x84, 0x63, 0x88, 0x63, 0x8C, 0x84, 0x8C, 0x21, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x44, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x80, 0x42, 0x88, 0x22, 
-    0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x63, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x63, 0x88, 0x22, 0x80, 
-    0x21, 0x80, 0x42, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x63, 
-    0x88, 0x23, 0x84, 0x63, 0x88, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x63, 0x8C, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 
-    0x88, 0x01, 0x80, 0x01, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x84, 0x63, 0x8C, 0x63, 0x8C, 0x42, 
-    0x88, 0x22, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x42, 0x84, 0x42, 0x84, 0x21, 0x80, 0x03, 0x80, 0x03, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 
-    0x8C, 0x21, 0x80, 0x21, 0x80, 0x42, 0x84, 0x42, 0x88, 0x84, 0x8C, 0x42, 0x88, 0x43, 0x84, 
-    0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x84, 0x90, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x22, 0x84, 0x63, 0x88, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x84, 0x42, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x63, 0x88, 0x63, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x42, 0x88, 0x84, 0x8C, 0x84, 0x8C, 
-    0x42, 0x88, 0x21, 0x80, 0x42, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x63, 0x88, 0x21, 
-    0x84, 0x42, 0x84, 0x63, 0x88, 0x21, 0x84, 0x01, 0x80, 0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x63, 0x8C, 0x43, 0x84, 0x42, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x03, 0x80, 0x42, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 
-    0x8C, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 
-    0x42, 0x84, 0x42, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x03, 
-    0x80, 0x03, 0x80, 0x03, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x84, 0x42, 0x84, 0x42, 0x84, 0x22, 0x80, 0x63, 0x8C, 0x84, 0x8C, 0x22, 0x84, 0x21, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x44, 0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 
-    0x42, 0x84, 0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x80, 0x42, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x22, 
-    0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x22, 0x80, 0x01, 0x80, 
-    0x21, 0x80, 0x84, 0x8C, 0x84, 0x8C, 0x42, 0x88, 0x63, 0x88, 0x63, 0x88, 0x42, 0x84, 0x22, 
-    0x84, 0x42, 0x84, 0x45, 0x88, 0x65, 0x88, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x22, 0x84, 
-    0x42, 0x84, 0x84, 0x90, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x44, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x03, 0x80, 0x03, 0x80, 0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 
-    0x21, 0x80, 0x22, 0x84, 0x42, 0x84, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 0x03, 0x80, 0x03, 
-    0x80, 0x01, 0x80, 0x03, 0x80, 0x03, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 0x84, 0x42, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x63, 0x8C, 0x63, 0x88, 0x84, 0x8C, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 
-    0x42, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x65, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x22, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 
-    0x42, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x21, 0x80, 0x01, 0x80, 0x22, 0x84, 0x42, 0x88, 0x63, 0x88, 0x84, 0x90, 0x63, 0x88, 0x22, 
-    0x84, 0x42, 0x84, 0x63, 0x88, 0x21, 0x80, 0x63, 0x88, 0x45, 0x88, 0x42, 0x84, 0x21, 0x84, 
-    0x22, 0x80, 0x42, 0x88, 0x63, 0x8C, 0x63, 0x88, 0x63, 0x88, 0x44, 0x84, 0x63, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x23, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x84, 0x42, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x80, 0x03, 0x80, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 0x03, 0x80, 0x21, 0x80, 0x22, 0x80, 
-    0x42, 0x84, 0x42, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x84, 0x22, 
-    0x84, 0x63, 0x88, 0x84, 0x90, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x21, 0x84, 0x21, 0x80, 0x01, 0x80, 0x22, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x44, 0x84, 0x44, 0x84, 0x21, 0x80, 0x44, 0x84, 0x42, 
-    0x88, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x42, 0x88, 0x63, 0x8C, 0x84, 
-    0x8C, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x63, 0x88, 0x63, 0x8C, 0x63, 0x88, 
-    0x21, 0x80, 0x21, 0x80, 0x42, 0x84, 0x42, 0x88, 0x84, 0x90, 0x44, 0x84, 0x43, 0x84, 0x63, 
-    0x88, 0x42, 0x88, 0x64, 0x88, 0x63, 0x88, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x03, 0x80, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x03, 0x80, 0x03, 0x80, 0x22, 0x84, 0x22, 0x80, 0x21, 0x80, 0x03, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x42, 0x84, 0x42, 0x84, 0x21, 0x84, 0x42, 0x84, 0x63, 
-    0x88, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x42, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x01, 0x80, 0x21, 0x84, 0x42, 0x88, 0x44, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 0x88, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x44, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x84, 0x21, 
-    0x84, 0x84, 0x90, 0x84, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x45, 0x88, 0x63, 0x88, 
-    0x63, 0x88, 0x21, 0x80, 0x22, 0x80, 0x63, 0x88, 0x42, 0x88, 0x84, 0x90, 0x63, 0x88, 0x63, 
-    0x88, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x44, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x84, 0x42, 0x84, 0x42, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 0x42, 0x84, 0x42, 0x84, 0x21, 0x84, 0x42, 
-    0x84, 0x63, 0x8C, 0x63, 0x8C, 0x42, 0x84, 0x21, 0x84, 0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x42, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x64, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x63, 0x88, 0x63, 0x88, 0x22, 0x80, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x22, 0x80, 0x21, 0x80, 0x22, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x21, 0x80, 0x22, 0x80, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x21, 0x84, 0x63, 0x8C, 0x63, 0x88, 0x63, 0x88, 0x84, 0x90, 0x63, 
-    0x88, 0x63, 0x88, 0x64, 0x88, 0x63, 0x88, 0x44, 0x84, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x42, 0x88, 0x42, 0x88, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x84, 0x42, 
-    0x88, 0x42, 0x84, 0x22, 0x80, 0x21, 0x80, 0x22, 0x80, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x42, 0x84, 0x01, 0x80, 0x42, 0x84, 0x42, 0x84, 0x84, 0x90, 0x63, 0x8C, 0x63, 
-    0x88, 0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 
-    0x01, 0x80, 0x22, 0x80, 0x22, 0x80, 0x22, 0x80, 0x01, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x63, 
-    0x88, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x63, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 
-    0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x22, 0x84, 0x01, 0x80, 0x21, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x63, 0x8C, 0x63, 0x88, 0x63, 0x8C, 0x63, 0x88, 0x63, 
-    0x88, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x44, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 
-    0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 
-    0x43, 0x84, 0x42, 0x84, 0x21, 0x84, 0x63, 0x88, 0x63, 0x8C, 0x84, 0x90, 0x63, 0x88, 0x22, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x22, 0x80, 
-    0x21, 0x80, 0x22, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x43, 
-    0x84, 0x63, 0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 
-    0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x80, 0x22, 
-    0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x63, 0x8C, 0x84, 0x8C, 0x84, 0x90, 0x84, 
-    0x90, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x22, 0x80, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x84, 0x42, 
-    0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x80, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 
-    0x42, 0x84, 0x42, 0x84, 0x63, 0x88, 0x84, 0x90, 0x84, 0x90, 0x84, 0x90, 0x22, 0x84, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x22, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 
-    0x8C, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x63, 0x88, 0x42, 0x84, 0x22, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 
-    0x84, 0x63, 0x88, 0x84, 0x90, 0x84, 0x90, 0x84, 0x90, 0x63, 0x8C, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x01, 0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 
-    0x84, 0x42, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x84, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 
-    0x63, 0x88, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x22, 0x80, 0x43, 0x84, 0x21, 0x80, 0x42, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x65, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 
-    0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x8C, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x63, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x42, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 0x42, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x22, 0x80, 
-    0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x42, 0x88, 
-    0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x03, 0x80, 0x21, 0x80, 
-    0x22, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x42, 0x84, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x43, 0x84, 
-    0x42, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x63, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x42, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x22, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 
-    0x01, 0x80, 0x22, 0x80, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x63, 0x88, 0x63, 0x88, 0x42, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 
-    0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x64, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 0x42, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x22, 0x80, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x84, 0x22, 0x80, 0x01, 0x80, 0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x42, 0x88, 0x42, 0x88, 0x01, 0x80, 0x21, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x63, 0x88, 0x22, 0x84, 
-    0x42, 0x88, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x42, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 
-    0x22, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 
-    0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x22, 0x80, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x22, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x80, 0x22, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 
-    0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x63, 0x88, 0x01, 0x80, 0x21, 
-    0x80, 0x21, 0x84, 0x22, 0x84, 0x22, 0x80, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x84, 0x42, 0x84, 0x63, 0x88, 
-    0x22, 0x84, 0x44, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 0x22, 0x80, 0x44, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 
-    0x8C, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x63, 0x8C, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x63, 0x88, 0x42, 0x88, 0x21, 0x80, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x42, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 0x22, 0x84, 
-    0x42, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x21, 0x84, 0x42, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x8C, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x84, 0x8C, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x23, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x84, 0x42, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x84, 0x44, 0x84, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 
-    0x84, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x42, 0x84, 0x22, 0x80, 0x42, 0x88, 0x63, 
-    0x8C, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x63, 0x8C, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x85, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x8C, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x63, 0x88, 0x21, 0x84, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x42, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x22, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x63, 
-    0x88, 0x63, 0x88, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x21, 0x80, 
-    0x22, 0x80, 0x84, 0x8C, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x84, 0x42, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x44, 0x84, 0x01, 0x80, 0x01, 0x80, 0x22, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x21, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x63, 0x88, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x63, 0x8C, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 
-    0x80, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x80, 0x42, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x22, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x63, 0x8C, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x42, 0x84, 
-    0x21, 0x80, 0x42, 0x84, 0x42, 0x88, 0x21, 0x80, 0x44, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x22, 0x80, 0x22, 0x80, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x44, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x63, 0x8C, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x22, 0x80, 
-    0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0xA5, 0x94, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x44, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x63, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x80, 0x42, 0x88, 0x22, 0x80, 0x63, 0x88, 0x63, 
-    0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 
-    0x80, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 0x63, 0x8C, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 0x44, 0x84, 0x01, 0x80, 0x01, 
-    0x80, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x22, 0x80, 0x22, 0x80, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x80, 0x63, 0x88, 
-    0x63, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x63, 0x8C, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x63, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x21, 0x80, 0x22, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 
-    0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x44, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x22, 0x84, 0x01, 0x80, 0x22, 0x84, 0x84, 0x8C, 0x01, 0x80, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x44, 0x84, 0x21, 
-    0x80, 0x22, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x80, 0x22, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x63, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x84, 0x63, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x63, 0x88, 0x44, 0x84, 0x22, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x01, 0x80, 0x22, 0x84, 0x84, 0x8C, 0x01, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 0x84, 
-    0x8C, 0x22, 0x80, 0x01, 0x80, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x84, 0x44, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x63, 0x88, 0x21, 0x84, 0x43, 0x84, 0xA5, 0x90, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x22, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x63, 0x88, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x22, 0x84, 0x63, 0x88, 0x01, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x84, 0x42, 0x88, 0x44, 
-    0x84, 0x84, 0x8C, 0x21, 0x80, 0x01, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 
-    0x8C, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x65, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x44, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x80, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x21, 0x80, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x80, 0x01, 0x80, 0x21, 0x80, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x22, 0x84, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 
-    0x84, 0x42, 0x88, 0x64, 0x88, 0x01, 0x80, 0x21, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x63, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x64, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x44, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0xA6, 0x94, 0x84, 0x90, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x84, 
-    0x8C, 0x21, 0x80, 0x01, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x84, 0x22, 0x84, 0x22, 0x80, 0x21, 0x80, 0x22, 
-    0x80, 0x44, 0x84, 0x43, 0x84, 0x84, 0x90, 0x01, 0x80, 0x01, 0x80, 0x22, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 0x44, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x22, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 
-    0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x44, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x22, 0x80, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x01, 0x80, 0x84, 0x90, 0x63, 0x88, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x42, 0x88, 0x42, 
-    0x88, 0x84, 0x90, 0x42, 0x88, 0x01, 0x80, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x01, 0x80, 0x42, 0x88, 0x84, 0x90, 0x22, 0x80, 0x21, 0x80, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x63, 0x88, 0x42, 0x88, 0x44, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x80, 0x63, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x63, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x01, 0x80, 0x21, 0x80, 0x63, 0x88, 0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x63, 0x8C, 0x44, 0x84, 0x01, 0x80, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x80, 0x42, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x80, 0x42, 0x88, 0x84, 0x90, 0x21, 0x80, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x63, 0x8C, 0x22, 0x80, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x22, 0x80, 0x43, 0x84, 0x44, 0x84, 0x21, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x63, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 0x44, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x63, 0x8C, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x63, 0x8C, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 0x63, 0x88, 0x01, 0x80, 0x01, 0x80, 0x22, 0x84, 0x23, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x21, 0x84, 0x22, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x63, 0x88, 0x42, 0x84, 0x21, 0x80, 0x22, 0x84, 0x63, 0x8C, 0x84, 0x90, 0x22, 0x80, 
-    0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x63, 
-    0x88, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x63, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x01, 0x80, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x63, 
-    0x88, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x01, 0x80, 0x63, 0x88, 0x44, 
-    0x84, 0x63, 0x88, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x84, 0x90, 0x42, 0x88, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 0x22, 0x80, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x63, 0x8C, 
-    0x42, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x63, 
-    0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x80, 0x22, 
-    0x80, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x42, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x22, 0x80, 0x22, 0x84, 0x42, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x63, 0x8C, 0x63, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x01, 0x80, 0x22, 0x84, 0x63, 0x88, 0x22, 
-    0x84, 0x63, 0x88, 0x23, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 
-    0x43, 0x84, 0x21, 0x80, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x21, 0x84, 0x01, 0x80, 0x64, 
-    0x88, 0x63, 0x88, 0x22, 0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x84, 0x22, 0x84, 0x84, 0x90, 
-    0x21, 0x84, 0x01, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x84, 0x43, 0x84, 0x42, 0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x63, 
-    0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x84, 0x22, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x80, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x63, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x80, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x42, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x63, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x01, 0x80, 0x43, 0x84, 0x63, 
-    0x88, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 0x21, 0x80, 0x44, 0x84, 0x01, 0x80, 
-    0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 0x80, 0x22, 0x84, 0x43, 0x84, 0x01, 
-    0x80, 0x44, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x84, 0x22, 0x84, 0x21, 0x80, 0x63, 0x88, 
-    0x84, 0x90, 0x01, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x84, 0x63, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x64, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x63, 0x8C, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 
-    0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 
-    0x63, 0x8C, 0x21, 0x80, 0x22, 0x84, 0x63, 0x88, 0x22, 0x84, 0x21, 0x80, 0x01, 0x80, 0x63, 
-    0x88, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x80, 0x21, 0x80, 0x63, 0x88, 
-    0x01, 0x80, 0x21, 0x80, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x01, 0x80, 0x44, 0x84, 0x65, 0x88, 0x63, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x84, 0x90, 0x01, 0x80, 0x01, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x84, 0x63, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 
-    0x88, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x84, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x63, 0x8C, 0x21, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x22, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x84, 0x42, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x63, 0x88, 0x44, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x42, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x80, 0x44, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x01, 
-    0x80, 0x44, 0x84, 0x63, 0x8C, 0x63, 0x88, 0x63, 0x88, 0x22, 0x80, 0x22, 0x80, 0x21, 0x84, 
-    0x42, 0x88, 0x22, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x80, 0x43, 0x84, 0x01, 0x80, 0x43, 0x84, 0xA5, 0x90, 0x63, 0x88, 0x43, 0x84, 0x63, 0x88, 
-    0x22, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x01, 0x80, 0x22, 0x84, 0x44, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 
-    0x22, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x44, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x63, 0x8C, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x22, 
-    0x84, 0x63, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x63, 0x88, 0x21, 
-    0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x01, 0x80, 0x22, 0x84, 0x63, 0x88, 0x44, 0x84, 0x22, 0x84, 0x22, 0x80, 0x42, 0x84, 
-    0x43, 0x84, 0x84, 0x90, 0x01, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x84, 0x90, 0x43, 0x84, 0x63, 0x88, 
-    0x43, 0x84, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x01, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x42, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x63, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 
-    0x21, 0x80, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x63, 0x8C, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x22, 0x80, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 
-    0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x22, 0x84, 0x01, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x01, 0x80, 0x42, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x84, 0x90, 0x01, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x01, 0x80, 0x21, 0x80, 0x84, 0x8C, 0x63, 0x88, 
-    0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x01, 0x80, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x84, 0x44, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x65, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x84, 
-    0x42, 0x88, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x22, 0x80, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x44, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x01, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x22, 0x84, 0x42, 0x84, 0x44, 0x84, 0xA5, 0x90, 0x01, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x01, 0x80, 0x21, 0x80, 0x63, 0x88, 
-    0x44, 0x84, 0x01, 0x80, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x01, 0x80, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x44, 0x84, 0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x84, 0x42, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x22, 0x80, 0x42, 0x88, 0x42, 0x84, 
-    0x42, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x44, 0x84, 0x42, 0x84, 
-    0x42, 0x84, 0x42, 0x84, 0x42, 0x84, 0x63, 0x8C, 0x63, 0x8C, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x01, 0x80, 0x01, 0x80, 
-    0x42, 0x88, 0x63, 0x8C, 0x44, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x8C, 0x22, 0x80, 0x01, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x63, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 
-    0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x84, 0x22, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x63, 0x8C, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 
-    0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x22, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x63, 0x8C, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x44, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x63, 0x88, 
-    0x42, 0x88, 0x63, 0x88, 0x63, 0x88, 0x42, 0x84, 0x84, 0x90, 0x63, 0x8C, 0x21, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x01, 0x80, 
-    0x01, 0x80, 0x22, 0x84, 0x84, 0x90, 0x63, 0x88, 0x44, 0x84, 0x21, 0x80, 0x63, 0x8C, 0x01, 
-    0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x63, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 
-    0x80, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 
-    0x80, 0x22, 0x80, 0x22, 0x84, 0x42, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x42, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x22, 0x80, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x84, 0x8C, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x44, 0x84, 0x43, 
-    0x84, 0x42, 0x84, 0x43, 0x84, 0x22, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x80, 
-    0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 
-    0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x01, 0x80, 
-    0x64, 0x88, 0x63, 0x8C, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x84, 0x90, 0x63, 0x88, 0x01, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x01, 0x80, 0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x63, 
-    0x8C, 0x01, 0x80, 0x01, 0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x22, 0x84, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x43, 0x84, 0x44, 0x84, 0x44, 0x84, 0x21, 0x80, 0x44, 0x84, 0x42, 0x88, 0x44, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x22, 0x80, 0x21, 0x80, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x44, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x44, 0x84, 0x42, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x80, 0x42, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x63, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x80, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x01, 0x80, 0x63, 0x88, 0x84, 0x8C, 0x43, 0x84, 0x63, 0x88, 0x63, 0x88, 0x84, 0x90, 0x21, 
-    0x80, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x01, 0x80, 0x21, 0x84, 0x84, 0x8C, 0x63, 0x88, 0x43, 0x84, 0x63, 
-    0x88, 0x22, 0x84, 0x22, 0x80, 0x01, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 
-    0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x84, 0x44, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x84, 0x43, 0x84, 
-    0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x63, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x84, 0x8C, 0x42, 
-    0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x44, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x22, 0x80, 0x42, 0x84, 0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 0x44, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x63, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x01, 0x80, 0x42, 0x84, 0x63, 0x8C, 0x22, 0x84, 0x22, 0x84, 0x64, 0x88, 0x63, 
-    0x8C, 0x01, 0x80, 0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x01, 0x80, 0x01, 0x80, 0x42, 0x88, 0x22, 0x84, 0x63, 
-    0x88, 0x43, 0x84, 0x63, 0x8C, 0x01, 0x80, 0x21, 0x80, 0x22, 0x84, 0x63, 0x8C, 0x43, 0x84, 
-    0x44, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 0x22, 0x80, 0x44, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x22, 0x80, 
-    0x42, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x44, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x80, 0x22, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x80, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x84, 0x22, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x63, 
-    0x8C, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x63, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x8C, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 0x21, 0x80, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x63, 0x88, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x84, 0x84, 0x8C, 0x22, 0x84, 0x22, 0x84, 0x63, 
-    0x88, 0x63, 0x8C, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 0x44, 0x84, 0x63, 
-    0x88, 0x44, 0x84, 0x21, 0x80, 0x84, 0x90, 0x01, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x44, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 
-    0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x80, 0x63, 0x88, 
-    0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x44, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x44, 0x84, 0x22, 
-    0x80, 0x22, 0x80, 0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x80, 0x42, 0x88, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x80, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x84, 0x22, 0x80, 0x42, 0x84, 0x42, 0x84, 0x42, 0x84, 0x22, 
-    0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x22, 0x80, 0x22, 0x80, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x63, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 
-    0x22, 0x84, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x01, 0x80, 0x21, 0x80, 0x84, 0x8C, 0x22, 0x84, 0x63, 
-    0x88, 0x84, 0x8C, 0x63, 0x8C, 0x01, 0x80, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x01, 0x80, 0x01, 0x80, 0x44, 
-    0x84, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x84, 0x90, 0x01, 0x80, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 0x63, 0x88, 
-    0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 
-    0x42, 0x84, 0x22, 0x80, 0x42, 0x88, 0x63, 0x8C, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x84, 0x42, 
-    0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x42, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x80, 0x22, 0x80, 0x43, 0x84, 0x42, 
-    0x84, 0x42, 0x84, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 
-    0x21, 0x80, 0x22, 0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 
-    0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x01, 0x80, 0x21, 0x80, 0x63, 0x8C, 0x22, 
-    0x84, 0x44, 0x84, 0x84, 0x8C, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x01, 
-    0x80, 0x44, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x84, 0x63, 0x8C, 0x01, 0x80, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x22, 0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x42, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x65, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 
-    0x88, 0x44, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x44, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x01, 0x80, 0x22, 0x84, 0x42, 0x84, 0x22, 0x84, 0x42, 0x84, 0x63, 0x8C, 0x22, 0x80, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x63, 0x88, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 
-    0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x43, 0x84, 0x01, 0x80, 0x01, 
-    0x80, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x01, 0x80, 0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 
-    0x01, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x42, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x63, 0x8C, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x44, 0x84, 0x01, 
-    0x80, 0x01, 0x80, 0x43, 0x84, 0x64, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x01, 0x80, 0x21, 0x80, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x84, 0x01, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x63, 
-    0x8C, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x8C, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x84, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x63, 0x8C, 0x42, 0x88, 
-    0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 
-    0x44, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x22, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x42, 0x88, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 
-    0x22, 0x80, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x63, 0x8C, 0x42, 0x88, 0x63, 0x8C, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x01, 0x80, 0x01, 0x80, 0x21, 0x84, 0x64, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x21, 0x80, 
-    0x21, 0x84, 0x44, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x22, 0x84, 
-    0x63, 0x88, 0x42, 0x88, 0x01, 0x80, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x80, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x21, 0x80, 0x85, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 
-    0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x84, 0x22, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x22, 0x80, 0x63, 0x88, 0x42, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 
-    0x42, 0x88, 0x42, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x22, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 
-    0x88, 0x21, 0x84, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x63, 0x88, 0x44, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x84, 0x8C, 
-    0x63, 0x88, 0x44, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x84, 0x42, 0x84, 0x21, 
-    0x84, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 
-    0x8C, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 
-    0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x63, 
-    0x8C, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x63, 0x88, 0x44, 0x84, 
-    0x22, 0x80, 0x01, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x01, 0x80, 
-    0x84, 0x90, 0x63, 0x8C, 0x63, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x63, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 
-    0x63, 0x8C, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 
-    0x22, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 
-    0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x01, 0x80, 0x01, 0x80, 0x21, 0x84, 0x44, 0x84, 
-    0x44, 0x84, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x01, 0x80, 0x84, 0x90, 0x42, 0x88, 0x84, 0x8C, 0x21, 0x80, 0x22, 0x84, 0x44, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x44, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x22, 0x80, 0x21, 0x84, 0x42, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 
-    0x21, 0x80, 0x22, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x44, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x44, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x43, 0x84, 0x43, 0x84, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x80, 0x01, 0x80, 0x84, 0x8C, 0x21, 0x84, 0x63, 0x88, 0x01, 0x80, 0x21, 0x80, 0x21, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x80, 0x43, 0x84, 0x44, 0x84, 0x44, 0x84, 0x42, 0x88, 0x44, 0x84, 0x42, 0x88, 0x44, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x63, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x44, 0x84, 0x42, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x22, 0x80, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x63, 0x88, 0x21, 0x80, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x22, 0x80, 0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0xA5, 0x90, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 
-    0x8C, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 0x21, 
-    0x80, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x63, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x63, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 
-    0x21, 0x80, 0x42, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x63, 0x8C, 0x21, 0x84, 0x01, 0x80, 0x63, 0x88, 0x84, 0x8C, 0x42, 0x84, 0x01, 0x80, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x22, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x42, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x42, 
-    0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x63, 0x8C, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x44, 0x84, 0x22, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x22, 0x84, 0x63, 0x8C, 0x22, 0x80, 
-    0x01, 0x80, 0x21, 0x80, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x22, 0x80, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x44, 0x84, 0x21, 0x80, 0x21, 0x80, 0x63, 0x88, 0x84, 0x90, 0x42, 0x88, 0x21, 
-    0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x80, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x42, 0x84, 0x22, 0x80, 0x22, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x84, 0x90, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x8C, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x84, 0x43, 
-    0x84, 0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x88, 0x22, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x22, 0x80, 0x42, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 0x22, 0x80, 0x21, 
-    0x80, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x80, 0x21, 0x84, 0x44, 0x84, 0x21, 0x80, 0x43, 0x84, 0x84, 0x8C, 0x42, 
-    0x84, 0x01, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 
-    0x22, 0x84, 0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 0x22, 0x80, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x80, 0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x84, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x22, 0x80, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x21, 
-    0x80, 0x63, 0x88, 0x22, 0x84, 0x43, 0x84, 0x44, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x84, 0x01, 0x80, 0x21, 0x80, 0x21, 
-    0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x84, 0x63, 
-    0x8C, 0x21, 0x84, 0x01, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 0x43, 0x84, 0x42, 0x84, 0x42, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 0x42, 0x84, 
-    0x42, 0x84, 0x22, 0x80, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x88, 0x42, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x63, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 
-    0x8C, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x44, 
-    0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x42, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 
-    0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x22, 0x84, 0x44, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x63, 
-    0x8C, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x44, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x44, 0x84, 0x44, 0x84, 0x21, 0x80, 0x44, 0x84, 0x42, 0x88, 0x44, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x43, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x44, 0x84, 0x44, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x80, 
-    0x22, 0x80, 0x42, 0x88, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x63, 0x8C, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x63, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x44, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x44, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x44, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x63, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 0x44, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x63, 0x88, 
-    0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x63, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x63, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x65, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x63, 0x88, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 
-    0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 
-    0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 
-    0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x63, 
-    0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x80, 0x22, 
-    0x80, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x63, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x63, 0x88, 
-    0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 
-    0x8C, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x63, 0x8C, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x44, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x63, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x44, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x63, 
-    0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x84, 0x22, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x80, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x21, 0x84, 
-    0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x84, 0x42, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x84, 0x22, 0x80, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x65, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x63, 0x8C, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x63, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x80, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x84, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x44, 0x84, 0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 0x88, 
-    0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x80, 0x22, 0x80, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x63, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x8C, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x64, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x42, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x80, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 
-    0x8C, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x21, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x63, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 
-    0x63, 0x8C, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 
-    0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x8C, 0x42, 
-    0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x80, 0x44, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x42, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x44, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 
-    0x42, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 
-    0x43, 0x84, 0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 
-    0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 
-    0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x43, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 
-    0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x63, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x63, 0x8C, 0x42, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x63, 0x88, 
-    0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 
-    0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x65, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x63, 0x88, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x44, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 
-    0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x8C, 0x22, 0x84, 0x42, 0x88, 0x63, 0x8C, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x22, 
-    0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x42, 0x88, 
-    0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x21, 0x80, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x42, 0x84, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x44, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x80, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x44, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 0x88, 0x42, 
-    0x88, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0xA5, 0x94, 0x42, 
-    0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x80, 0x44, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x63, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x63, 
-    0x88, 0x22, 0x80, 0x22, 0x80, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 
-    0x80, 0x43, 0x84, 0x44, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x80, 0x63, 0x88, 0x63, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 
-    0x8C, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x63, 0x88, 0x44, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x44, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x63, 0x8C, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x22, 0x84, 0x44, 0x84, 0x22, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x84, 
-    0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x80, 0x43, 0x84, 0x44, 0x84, 0x63, 0x88, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x84, 0x22, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x22, 0x84, 0x42, 0x88, 0x63, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 
-    0x22, 0x80, 0x42, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x63, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x63, 0x8C, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x42, 0x84, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 
-    0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x84, 0x44, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0xA5, 0x90, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 
-    0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x44, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 
-    0x22, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x84, 0x42, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x44, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x84, 0x42, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x44, 0x84, 
-    0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x65, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x44, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x63, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x63, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x63, 0x88, 0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x44, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x42, 0x88, 
-    0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x44, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x84, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x64, 0x84, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x84, 0x42, 0x84, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x80, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x80, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x84, 0x42, 0x84, 0x21, 0x84, 0x22, 0x80, 0x42, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 
-    0x63, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 
-    0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 
-    0x8C, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 
-    0x22, 0x80, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x84, 0x22, 0x84, 
-    0x22, 0x80, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x63, 0x8C, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x44, 0x84, 0x44, 0x84, 0x21, 0x80, 0x44, 
-    0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x44, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x22, 
-    0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x21, 0x80, 0x44, 0x84, 0x44, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 
-    0x44, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x80, 0x21, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x44, 0x84, 0x44, 0x84, 0x21, 0x80, 0x44, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 
-    0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 0x22, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x44, 0x84, 
-    0x44, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x42, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x44, 0x84, 0x42, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x22, 0x80, 
-    0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 
-    0x42, 0x84, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x80, 0x63, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x42, 0x84, 0x43, 0x84, 0x63, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x63, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x8C, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x42, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x42, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x80, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x63, 0x88, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x44, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 
-    0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x44, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x80, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x64, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x44, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x42, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x84, 0x22, 0x80, 0x22, 0x80, 0x22, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x22, 0x80, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x42, 0x88, 0x44, 0x84, 0x22, 0x80, 0x63, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x44, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x22, 0x80, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x84, 0x22, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x44, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x80, 0x22, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x80, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x84, 0x22, 0x80, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 
-    0x42, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x65, 0x88, 0x43, 0x84, 0x63, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x84, 0x22, 0x80, 0x42, 0x88, 0x43, 
-    0x84, 0x63, 0x8C, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x80, 0x42, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x80, 0x44, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x63, 0x88, 0x63, 0x88, 
-    0x42, 0x88, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x44, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x80, 0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x63, 0x8C, 0x43, 0x84, 0x22, 0x80, 0x42, 0x84, 0x42, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x63, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 0x42, 
-    0x88, 0x42, 0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 0x80, 0x43, 0x84, 0x42, 0x84, 0x63, 0x88, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 
-    0x80, 0x43, 0x84, 0x42, 0x84, 0x42, 0x84, 0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x84, 0x42, 0x84, 0x42, 0x88, 
-    0x22, 0x80, 0x43, 0x84, 0x42, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x80, 0x22, 0x80, 0x43, 0x84, 0x42, 0x84, 0x42, 0x84, 
-    0x22, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x22, 
-    0x80, 0x22, 0x80, 0x42, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x44, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x63, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x63, 0x8C, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x80, 0x21, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x22, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x22, 0x84, 0x42, 0x88, 0x44, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x80, 0x21, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x63, 0x88, 0x63, 0x88, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x44, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x42, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x42, 0x84, 0x21, 0x80, 0x42, 0x88, 0x22, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x64, 0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x80, 0x22, 0x80, 0x44, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x21, 0x84, 0x44, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x44, 
-    0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x22, 0x80, 0x22, 
-    0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x44, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 
-    0x88, 0x44, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x44, 0x84, 0x44, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x21, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x22, 0x84, 0x44, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x63, 
-    0x8C, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x44, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x44, 
-    0x84, 0x44, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x44, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 
-    0x84, 0x44, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x44, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 
-    0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x21, 
-    0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x42, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 
-    0x84, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x21, 0x80, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x80, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 
-    0x44, 0x84, 0x42, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x84, 0x22, 0x80, 0x42, 0x84, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x43, 0x84, 0x44, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x84, 0x42, 0x88, 0x42, 0x84, 0x42, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 
-    0x21, 0x80, 0x43, 0x84, 0x21, 0x80, 0x44, 0x84, 0x43, 0x84, 0x42, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x84, 0x42, 0x88, 0x22, 0x80, 0x42, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 0x80, 0x43, 
-    0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x42, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x80, 0x42, 0x84, 0x42, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x63, 0x8C, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x44, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x63, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x44, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 
-    0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x63, 0x88, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 
-    0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x42, 0x88, 0x21, 0x80, 0x42, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 
-    0x84, 0x42, 0x84, 0x22, 0x80, 0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x42, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 0x80, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x44, 0x84, 0x42, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x63, 0x88, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x21, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0x21, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 
-    0x80, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x63, 
-    0x8C, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x63, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x21, 0x84, 0x63, 0x88, 0x42, 0x88, 0x43, 0x84, 0x42, 
-    0x88, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x21, 0x84, 0x42, 0x88, 0x63, 0x88, 
-    0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 
-    0x80, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x42, 0x88, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x80, 0x42, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x80, 0x42, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x80, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x44, 0x84, 0x21, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x43, 
-    0x84, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x43, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 
-    0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x63, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x80, 0x43, 
-    0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x64, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x44, 0x84, 0x43, 0x84, 0x22, 0x84, 0x44, 0x84, 0x63, 
-    0x88, 0x44, 0x84, 0x44, 0x84, 0x44, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x44, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x44, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 
-    0x88, 0x22, 0x84, 0x44, 0x84, 0x43, 0x84, 0x22, 0x84, 0x44, 0x84, 0x63, 0x88, 0x43, 0x84, 
-    0x44, 0x84, 0x44, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x44, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x44, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0x22, 0x84, 0x44, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x44, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x44, 0x84, 0x43, 0x84, 0x44, 0x84, 0x22, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x42, 
-    0x88, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x43, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x44, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0x22, 0x84, 0x63, 0x88, 0x43, 0x84, 0x44, 0x84, 0x44, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x44, 0x84, 0x43, 0x84, 0x22, 0x84, 0x44, 0x84, 0x44, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x44, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x44, 
-    0x84, 0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x44, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x44, 0x84, 0x43, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 
-    0x22, 0x84, 0x44, 0x84, 0x43, 0x84, 0x44, 0x84, 0x44, 0x84, 0x44, 0x84, 0x22, 0x84, 0x44, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x44, 0x84, 0x44, 0x84, 0x22, 0x84, 0x22, 0x84, 0x44, 0x84, 
-    0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x63, 0x88, 0x43, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x44, 0x84, 0x42, 0x88, 
-    0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x43, 0x84, 0x22, 0x84, 0x43, 0x84, 0x22, 
-    0x84, 0x43, 0x84, 0x64, 0x88, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x22, 0x80, 0x21, 0x84, 0x22, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x84, 0x42, 0x88, 0x42, 0x84, 0x22, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x22, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x80, 0x21, 0x84, 0x22, 0x80, 
-    0x22, 0x80, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 
-    0x84, 0x22, 0x80, 0x21, 0x84, 0x22, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x42, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 
-    0x42, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x22, 0x80, 0x21, 0x84, 0x22, 0x80, 0x21, 0x84, 0x21, 
-    0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x80, 
-    0x22, 0x80, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x22, 
-    0x80, 0x22, 0x84, 0x21, 0x84, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x22, 0x84, 
-    0x22, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x43, 0x84, 0x22, 
-    0x84, 0x22, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x22, 0x80, 0x21, 0x84, 0x22, 0x80, 0x22, 0x84, 
-    0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x22, 0x80, 0x22, 
-    0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x42, 0x84, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x84, 0x22, 0x84, 0x22, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x80, 0x22, 0x80, 0x22, 0x80, 0x21, 0x84, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x80, 0x21, 0x84, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x42, 0x88, 0x22, 0x84, 0x22, 0x80, 0x21, 0x80, 0x21, 
-    0x84, 0x21, 0x80, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x22, 
-    0x80, 0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x22, 0x80, 0x21, 0x84, 0x21, 0x80, 0x22, 0x80, 0x22, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x22, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 
-    0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x22, 0x80, 0x21, 0x84, 0x21, 0x80, 0x22, 0x80, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 
-    0x80, 0x21, 0x80, 0x22, 0x80, 0x21, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x84, 0x21, 
-    0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 
-    0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x22, 0x80, 0x21, 
-    0x84, 0x21, 0x84, 0x22, 0x80, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x80, 0x21, 0x80, 
-    0x22, 0x80, 0x21, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x22, 0x80, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x22, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x80, 0x21, 
-    0x84, 0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 
-    0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 
-    0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x80, 0x22, 0x80, 0x21, 0x84, 0x21, 0x84, 
-    0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 
-    0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x84, 0x21, 0x80, 0x01, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x43, 0x84
+const int conback_packed_size = 24179;
+const byte conback_packed[] = {
+    0x00, 0x2E, 0x1C, 0x1F, 0x1C, 0x2E, 0x2E, 0x2E, 0x1D, 0x00, 0x2E, 0x01, 0xF5, 0x1C, 0x1C, 
+    0x01, 0x1C, 0x1C, 0x00, 0x2E, 0x01, 0x02, 0x1C, 0x2E, 0x1C, 0x1C, 0x1C, 0x98, 0x1D, 0xF5, 
+    0xF6, 0x0C, 0x00, 0x1A, 0x30, 0x1C, 0x01, 0x18, 0x00, 0x00, 0x1D, 0x01, 0x1D, 0x1D, 0x01, 
+    0x1F, 0x02, 0x2E, 0xA0, 0x01, 0x01, 0x2E, 0x1C, 0xF5, 0x17, 0x00, 0x1C, 0x32, 0x00, 0x41, 
+    0x27, 0x00, 0x1F, 0x1D, 0x2E, 0x1D, 0xF5, 0x30, 0x00, 0x01, 0xD6, 0x2E, 0x20, 0x00, 0x3F, 
+    0x20, 0x2E, 0x17, 0x20, 0x1D, 0x07, 0x10, 0x25, 0x00, 0xAA, 0x01, 0x30, 0x10, 0x1F, 0x17, 
+    0x00, 0x1D, 0x33, 0x00, 0x01, 0x1E, 0x00, 0x0D, 0x3A, 0x10, 0x2E, 0x6B, 0x00, 0x21, 0x00, 
+    0x1C, 0x2E, 0x1F, 0x01, 0x02, 0xF6, 0x61, 0x10, 0x01, 0x1D, 0x2E, 0x1F, 0x1F, 0xF6, 0x92, 
+    0xF5, 0x72, 0x00, 0x01, 0x1F, 0x38, 0x00, 0xF5, 0x1F, 0x33, 0x00, 0xAF, 0x25, 0x00, 0x7D, 
+    0x20, 0x7A, 0x10, 0x3D, 0x00, 0x1F, 0x3B, 0x10, 0x1F, 0x52, 0x10, 0x9D, 0x00, 0x00, 0xF5, 
+    0x03, 0x00, 0x58, 0x00, 0x55, 0x00, 0x1F, 0x1F, 0x11, 0x30, 0xCF, 0x87, 0x20, 0xBF, 0x10, 
+    0x4A, 0x00, 0x85, 0x20, 0x1C, 0x02, 0x35, 0x10, 0xC9, 0x10, 0xB9, 0xA9, 0x00, 0x01, 0x01, 
+    0xCC, 0x00, 0x79, 0x20, 0xCC, 0x40, 0x2E, 0xCC, 0x00, 0x72, 0x2E, 0xCC, 0x10, 0x02, 0x01, 
+    0xD3, 0x10, 0x04, 0x11, 0x84, 0x00, 0x1F, 0xEB, 0xE2, 0x20, 0x1C, 0x10, 0x2E, 0x1E, 0x00, 
+    0x1C, 0x0C, 0x00, 0x3E, 0x20, 0x84, 0x20, 0xF8, 0x1F, 0x1F, 0x1F, 0x0F, 0x00, 0xF8, 0x00, 
+    0x48, 0x00, 0x5C, 0x00, 0x32, 0x30, 0xF4, 0x1C, 0x1D, 0x16, 0x10, 0x1F, 0xAB, 0x10, 0x22, 
+    0x00, 0x60, 0x00, 0x3F, 0x30, 0xBF, 0xF4, 0x00, 0xF1, 0x00, 0xA0, 0x00, 0x2C, 0x00, 0x4D, 
+    0x01, 0x2C, 0x00, 0x01, 0x3E, 0x31, 0x17, 0x89, 0x10, 0x17, 0x00, 0x3B, 0x10, 0x1C, 0xD0, 
+    0x00, 0x01, 0x2E, 0xF6, 0xB2, 0x1F, 0x0E, 0x20, 0x1D, 0x1D, 0xE4, 0x00, 0xD5, 0x00, 0x02, 
+    0xFC, 0x00, 0xFE, 0x01, 0x7D, 0x00, 0x32, 0x00, 0x11, 0x00, 0x12, 0x00, 0x42, 0x10, 0xF4, 
+    0x00, 0x23, 0x00, 0xFE, 0x1F, 0x29, 0x00, 0x07, 0x10, 0x08, 0x00, 0x82, 0x10, 0x74, 0x00, 
+    0x1A, 0x00, 0x2B, 0x00, 0xFE, 0x02, 0x1F, 0x00, 0x0F, 0x10, 0x49, 0x00, 0x8D, 0x00, 0x94, 
+    0x11, 0x66, 0x20, 0x60, 0x10, 0xFF, 0x0F, 0x00, 0x71, 0x21, 0x17, 0x01, 0x62, 0x10, 0x12, 
+    0x00, 0xCE, 0x10, 0x4D, 0x00, 0x32, 0x00, 0x35, 0xCC, 0x00, 0x1F, 0xCC, 0x10, 0x18, 0x11, 
+    0x20, 0x1C, 0x11, 0x1D, 0x1D, 0x6E, 0xF5, 0x32, 0x00, 0xBD, 0x21, 0x64, 0x00, 0x1D, 0x00, 
+    0x11, 0xBE, 0x11, 0x01, 0x0D, 0x6F, 0x10, 0xF5, 0xE9, 0x00, 0x08, 0x12, 0x1D, 0x01, 0xF6, 
+    0xF6, 0xFF, 0x47, 0x20, 0x32, 0x70, 0xBA, 0x00, 0xCF, 0x10, 0x54, 0x00, 0xDF, 0x00, 0x0B, 
+    0x10, 0x80, 0x10, 0xEF, 0xA8, 0x00, 0xC1, 0x00, 0xC8, 0x00, 0x2A, 0x20, 0x01, 0x57, 0x21, 
+    0x10, 0x12, 0xE0, 0x00, 0xDF, 0x13, 0x20, 0x0A, 0x00, 0x33, 0x22, 0xB0, 0x11, 0x33, 0x00, 
+    0x1F, 0x5D, 0x01, 0x6E, 0x10, 0xFF, 0x36, 0x00, 0x3A, 0x00, 0xB5, 0x10, 0xFF, 0x21, 0xF9, 
+    0x10, 0x35, 0x32, 0x49, 0x30, 0x8C, 0x00, 0x71, 0x2A, 0x00, 0x02, 0x2E, 0x1E, 0x27, 0x02, 
+    0x1E, 0x01, 0x21, 0x20, 0x01, 0xE7, 0x8B, 0x02, 0x83, 0x10, 0xE3, 0x10, 0x2E, 0x1D, 0x9D, 
+    0x00, 0x2C, 0x00, 0x2A, 0x01, 0xFF, 0xB9, 0x10, 0x99, 0x10, 0x0C, 0x00, 0x98, 0x10, 0xCC, 
+    0x60, 0x2C, 0x11, 0x5A, 0x01, 0x8B, 0x00, 0x7D, 0x08, 0x12, 0xF6, 0x34, 0x11, 0x2C, 0x10, 
+    0x6F, 0x00, 0x89, 0x00, 0x0C, 0x00, 0xF5, 0xDF, 0x57, 0x21, 0x26, 0x00, 0x4E, 0x00, 0xDB, 
+    0x00, 0x89, 0x10, 0x1F, 0xA9, 0x10, 0x62, 0x10, 0xFF, 0xF8, 0x12, 0xC8, 0x10, 0x31, 0x33, 
+    0xAA, 0x10, 0x3C, 0x30, 0x11, 0x10, 0x5C, 0x10, 0x83, 0x00, 0xFF, 0x32, 0x30, 0x02, 0x23, 
+    0x38, 0x00, 0x52, 0x03, 0xD4, 0x10, 0xC8, 0x12, 0xA5, 0x02, 0xE3, 0x00, 0x7F, 0x32, 0x10, 
+    0xA0, 0x01, 0x2E, 0x10, 0x64, 0x01, 0x91, 0x22, 0x38, 0x12, 0x17, 0x10, 0xF5, 0xC3, 0x0A, 
+    0x11, 0xE1, 0x12, 0x1D, 0x1C, 0xF6, 0xF5, 0x2E, 0x13, 0x2A, 0x00, 0xF8, 0x2E, 0x02, 0xF5, 
+    0xEF, 0x00, 0xF4, 0x21, 0x18, 0x10, 0x66, 0x02, 0x6A, 0x03, 0x19, 0x1A, 0x00, 0x1B, 0x2E, 
+    0x27, 0x03, 0x5E, 0x12, 0x1D, 0x1D, 0xF6, 0xAF, 0xE1, 0x10, 0xAF, 0x23, 0xD9, 0x10, 0x06, 
+    0x11, 0x2E, 0xAE, 0x11, 0xF5, 0x2B, 0x00, 0xF7, 0x1F, 0x10, 0x6C, 0x22, 0xFC, 0x11, 0xF5, 
+    0x99, 0x00, 0x94, 0x10, 0xCC, 0x10, 0x10, 0x21, 0x7B, 0x55, 0x10, 0x21, 0x11, 0x2B, 0xE0, 
+    0x32, 0x05, 0x10, 0x0F, 0x02, 0xBA, 0x10, 0x01, 0xDE, 0x1B, 0x0D, 0x00, 0x2F, 0x00, 0xC7, 
+    0x20, 0x94, 0x00, 0xF5, 0x91, 0x11, 0x20, 0x11, 0xFF, 0x87, 0x11, 0x8F, 0x00, 0xDD, 0x23, 
+    0xE7, 0x11, 0x76, 0x10, 0x33, 0x14, 0xA3, 0x01, 0x0E, 0x10, 0x67, 0x6B, 0x21, 0x32, 0x30, 
+    0xA6, 0x23, 0x01, 0xF5, 0x88, 0x01, 0xEB, 0x20, 0x1D, 0xEF, 0x10, 0x00, 0xFB, 0x11, 0x1F, 
+    0x00, 0xFF, 0x30, 0xF6, 0xD2, 0x20, 0x3F, 0x13, 0x76, 0x10, 0x7F, 0x4D, 0x14, 0x6C, 0x24, 
+    0x12, 0x00, 0x5F, 0x20, 0xFF, 0x03, 0xAC, 0x00, 0x23, 0x11, 0x1F, 0x0F, 0x41, 0x01, 0x40, 
+    0x24, 0x17, 0x24, 0xBC, 0x21, 0x01, 0x1C, 0xF6, 0x1B, 0xFC, 0x1D, 0x1E, 0x36, 0x11, 0x89, 
+    0x21, 0x31, 0x00, 0x19, 0x00, 0x54, 0x00, 0x9E, 0x20, 0xF7, 0xA6, 0x12, 0x0E, 0x00, 0x7F, 
+    0x21, 0x1B, 0x0F, 0x20, 0x79, 0x20, 0x39, 0x23, 0xE2, 0x21, 0xFF, 0xCC, 0x10, 0x9E, 0x12, 
+    0x47, 0x10, 0x2A, 0x00, 0x08, 0x13, 0x48, 0x21, 0x89, 0x11, 0xC6, 0x23, 0xFF, 0x35, 0x00, 
+    0xEE, 0x21, 0x02, 0x14, 0x2A, 0x11, 0x9C, 0x13, 0x9D, 0x11, 0xF9, 0x11, 0x9C, 0x13, 0xBE, 
+    0xF5, 0xAE, 0x01, 0xFE, 0x21, 0x5D, 0x32, 0x10, 0x21, 0x3A, 0x10, 0xF6, 0xD8, 0x13, 0x07, 
+    0x20, 0x00, 0xEA, 0x02, 0xC6, 0x13, 0x2E, 0x1E, 0x1E, 0x1D, 0x1C, 0xFA, 0x1B, 0x21, 0x00, 
+    0x1E, 0x11, 0x00, 0x1F, 0x10, 0x99, 0x11, 0x59, 0x05, 0xFA, 0x22, 0xFF, 0xD8, 0x01, 0x06, 
+    0x11, 0x7A, 0x04, 0x14, 0x25, 0x19, 0x10, 0xA7, 0x23, 0x14, 0x21, 0x93, 0x00, 0xD9, 0xF8, 
+    0x32, 0x1F, 0x1E, 0xEA, 0x11, 0x8A, 0x00, 0x1E, 0x82, 0x25, 0x9C, 0x01, 0xFF, 0xA0, 0x00, 
+    0xD1, 0x11, 0x32, 0x15, 0xA2, 0x13, 0x24, 0x10, 0x08, 0x15, 0x2C, 0x11, 0x5B, 0x24, 0xF3, 
+    0xB9, 0x20, 0xBF, 0x33, 0x01, 0x1C, 0xC5, 0x01, 0x22, 0x10, 0xA9, 0x10, 0x4E, 0x00, 0xFE, 
+    0xF5, 0x8A, 0x33, 0x1C, 0x31, 0xB3, 0x21, 0xCC, 0x40, 0xCE, 0x00, 0x0F, 0x34, 0xBC, 0x10, 
+    0xFF, 0x82, 0x14, 0x2F, 0x22, 0x48, 0x11, 0x0C, 0x40, 0x38, 0x30, 0x1E, 0x00, 0x84, 0x22, 
+    0xB0, 0x11, 0x7F, 0xC7, 0x31, 0xA7, 0x00, 0x32, 0x00, 0x25, 0x00, 0x9D, 0x24, 0x75, 0x12, 
+    0x83, 0x21, 0x1E, 0x46, 0x01, 0xF5, 0x00, 0x67, 0x02, 0x1C, 0x1D, 0x1B, 0x41, 0x15, 0x1E, 
+    0xFF, 0xA9, 0x01, 0xB9, 0x35, 0x0D, 0x01, 0x7D, 0x11, 0xF3, 0x10, 0x25, 0x11, 0x49, 0x40, 
+    0xAE, 0x22, 0x7F, 0xDC, 0x00, 0x43, 0x10, 0x97, 0x11, 0x18, 0x00, 0x75, 0x10, 0xE9, 0x15, 
+    0x42, 0x01, 0xF6, 0xD9, 0x84, 0x01, 0x1E, 0x1B, 0xE4, 0x01, 0xB3, 0x30, 0x1E, 0x0A, 0x22, 
+    0xB6, 0x01, 0xFF, 0xAD, 0x16, 0x09, 0x10, 0xF4, 0x23, 0x0E, 0x00, 0x05, 0x10, 0x9F, 0x20, 
+    0x68, 0x13, 0x08, 0x10, 0xFF, 0xB9, 0x30, 0x4C, 0x00, 0x48, 0x00, 0x4A, 0x36, 0x12, 0x40, 
+    0xB1, 0x26, 0xCC, 0x40, 0xD7, 0x10, 0xFC, 0x02, 0x03, 0x8B, 0x00, 0x3E, 0x12, 0x52, 0x40, 
+    0xE7, 0x11, 0xAE, 0x05, 0x86, 0x25, 0xFF, 0xAC, 0x11, 0x18, 0x11, 0x6B, 0x13, 0xB9, 0x01, 
+    0xB1, 0x10, 0x3D, 0x03, 0x4D, 0x11, 0x79, 0x11, 0xFF, 0xB9, 0x13, 0xA4, 0x25, 0x5A, 0x00, 
+    0x34, 0x00, 0xDA, 0x10, 0x1C, 0x26, 0x57, 0x16, 0x47, 0x10, 0xFF, 0xBD, 0x11, 0xA5, 0x12, 
+    0x2B, 0x06, 0xAF, 0x01, 0x7D, 0x00, 0x2C, 0x24, 0x22, 0x25, 0x03, 0x26, 0x73, 0x47, 0x00, 
+    0x05, 0x10, 0x1F, 0xF5, 0x1D, 0x21, 0x97, 0x40, 0xE8, 0x25, 0x1C, 0x7A, 0xF6, 0x4E, 0x02, 
+    0x02, 0x6B, 0x24, 0x64, 0x33, 0xF2, 0x04, 0x3A, 0x00, 0x1B, 0xFF, 0x23, 0x16, 0x29, 0x01, 
+    0x13, 0x03, 0x0E, 0x12, 0x50, 0x10, 0x88, 0x23, 0xAE, 0x26, 0x0B, 0x01, 0xFF, 0x8B, 0x10, 
+    0x0A, 0x02, 0x84, 0x13, 0x1F, 0x26, 0x34, 0x00, 0x51, 0x20, 0x52, 0x10, 0x2C, 0x20, 0x3F, 
+    0x40, 0x04, 0x6C, 0x01, 0x27, 0x02, 0xCC, 0x00, 0xF0, 0x23, 0x77, 0x26, 0x01, 0x02, 0xFF, 
+    0xEF, 0x10, 0xCB, 0x22, 0x15, 0x11, 0x63, 0x10, 0x94, 0x01, 0x4D, 0x10, 0x57, 0x16, 0x1F, 
+    0x25, 0xFF, 0x5C, 0x15, 0x42, 0x12, 0x42, 0x16, 0x43, 0x23, 0x31, 0x00, 0x32, 0x30, 0x00, 
+    0x23, 0x57, 0x26, 0x35, 0x60, 0x25, 0xF6, 0x80, 0x00, 0x1B, 0xFF, 0x01, 0xE7, 0x24, 0x1D, 
+    0x1B, 0xFE, 0xF6, 0xDB, 0x14, 0x34, 0x00, 0x23, 0x10, 0xAA, 0x13, 0xE5, 0x10, 0xF1, 0x00, 
+    0x2D, 0x27, 0xBF, 0xE5, 0x17, 0x84, 0x13, 0x19, 0x28, 0x48, 0x21, 0x47, 0x11, 0x55, 0x10, 
+    0xF5, 0xFF, 0x00, 0x37, 0xB9, 0x01, 0x37, 0x10, 0xD5, 0x06, 0x1B, 0xD5, 0x17, 0x98, 0x31, 
+    0x1B, 0x1D, 0xFE, 0x1F, 0xEF, 0x04, 0x4A, 0x01, 0xE9, 0x10, 0x4C, 0x11, 0x98, 0x34, 0x52, 
+    0x11, 0x6A, 0x21, 0xFD, 0x1E, 0x00, 0xF5, 0x33, 0x11, 0x53, 0x22, 0xAA, 0x00, 0x24, 0x01, 
+    0xFD, 0x23, 0x55, 0x12, 0xBF, 0x12, 0x40, 0x6F, 0x26, 0xBF, 0x02, 0xF9, 0x10, 0x35, 0x00, 
+    0x3C, 0x06, 0x9C, 0x96, 0x26, 0xFF, 0xF0, 0x26, 0x21, 0x21, 0x8F, 0x26, 0xC6, 0x00, 0x0D, 
+    0x00, 0x93, 0x14, 0x05, 0x31, 0xA3, 0x14, 0xFF, 0x32, 0x20, 0x79, 0x01, 0xB7, 0x01, 0x32, 
+    0x30, 0x24, 0x10, 0xF4, 0x37, 0x84, 0x31, 0x38, 0x11, 0xF7, 0x00, 0x00, 0x34, 0x00, 0x1F, 
+    0x10, 0x1C, 0x07, 0x01, 0x14, 0x01, 0xD7, 0x18, 0xBA, 0x22, 0xFC, 0x2E, 0xF6, 0x5F, 0x40, 
+    0x27, 0x23, 0xFE, 0x02, 0x5E, 0x22, 0x05, 0x11, 0x38, 0x00, 0xBF, 0xC5, 0x10, 0xFC, 0x25, 
+    0x55, 0x37, 0xD5, 0x16, 0xD9, 0x14, 0xFE, 0x11, 0x1C, 0x45, 0x14, 0xF9, 0xDE, 0x11, 0x1C, 
+    0x1D, 0x8E, 0x20, 0x65, 0x17, 0x84, 0x12, 0x70, 0x38, 0x28, 0x11, 0x7B, 0x47, 0x29, 0x2F, 
+    0x00, 0x1E, 0x6D, 0x00, 0x38, 0x00, 0x12, 0x10, 0xFB, 0x03, 0x1D, 0xFF, 0x7C, 0x14, 0xA0, 
+    0x21, 0x21, 0x00, 0x32, 0x67, 0xCC, 0x20, 0xF5, 0x00, 0xFF, 0x30, 0x76, 0x31, 0x3F, 0x57, 
+    0x00, 0x75, 0x22, 0xE3, 0x02, 0xAD, 0x20, 0x04, 0x22, 0xF5, 0x12, 0x1D, 0x1E, 0xFF, 0x5B, 
+    0x10, 0x98, 0x17, 0x39, 0x12, 0xC4, 0x17, 0xA3, 0x23, 0x4C, 0x01, 0x19, 0x15, 0x6C, 0x00, 
+    0x7B, 0x5E, 0x20, 0x1A, 0x00, 0xF6, 0xC0, 0x31, 0x55, 0x15, 0xCF, 0x25, 0xD3, 0x14, 0x1E, 
+    0xF7, 0xA3, 0x30, 0x4E, 0x11, 0xD4, 0x08, 0xF6, 0x18, 0x04, 0x03, 0x00, 0x11, 0x10, 0x64, 
+    0x08, 0xFD, 0x5D, 0x38, 0xF5, 0x3B, 0x15, 0x4B, 0x26, 0x50, 0x01, 0x91, 0x11, 0xFC, 0x32, 
+    0x24, 0x10, 0xEF, 0xC6, 0x07, 0xFF, 0x02, 0xEC, 0x10, 0x03, 0x10, 0x1E, 0x36, 0x11, 0xDE, 
+    0x34, 0x0B, 0x22, 0xFF, 0xE3, 0x28, 0xB9, 0x07, 0xDC, 0x12, 0x4D, 0x10, 0xDE, 0x27, 0x7C, 
+    0x2A, 0x05, 0x32, 0x12, 0x16, 0xEF, 0x66, 0x21, 0x32, 0x36, 0x0F, 0x1A, 0x3C, 0x03, 0x1E, 
+    0x09, 0x00, 0x1B, 0x23, 0xCC, 0x20, 0x7F, 0x9B, 0x28, 0xA7, 0x28, 0x64, 0x11, 0xA9, 0x38, 
+    0xC4, 0x2A, 0x39, 0x00, 0x59, 0x00, 0x1D, 0xFF, 0x3D, 0x15, 0x8D, 0x10, 0x0C, 0x10, 0x65, 
+    0x02, 0x66, 0x25, 0xE3, 0x27, 0xA3, 0x00, 0xDD, 0x05, 0xFF, 0xAD, 0x30, 0xFC, 0x33, 0x74, 
+    0x19, 0x38, 0x21, 0x1F, 0x11, 0xD4, 0x14, 0x5B, 0x21, 0x56, 0x01, 0xEF, 0xFC, 0x04, 0x04, 
+    0x06, 0x9B, 0x37, 0x77, 0x10, 0x2E, 0x4F, 0x11, 0x91, 0x36, 0x07, 0x3B, 0xFF, 0x69, 0x36, 
+    0xE1, 0x01, 0x05, 0x12, 0xF8, 0x04, 0x1C, 0x13, 0x9E, 0x10, 0x33, 0x22, 0x11, 0x2A, 0xFF, 
+    0x40, 0x10, 0xE2, 0x07, 0x7A, 0x03, 0x55, 0x00, 0x68, 0x22, 0x80, 0x11, 0x40, 0x11, 0xD3, 
+    0x15, 0xEF, 0xF0, 0x24, 0xCA, 0x31, 0xC3, 0x26, 0x66, 0x38, 0xF5, 0x5D, 0x17, 0xEA, 0x15, 
+    0x8D, 0x38, 0x7F, 0x6D, 0x24, 0x32, 0x16, 0x57, 0x10, 0x2B, 0x14, 0x13, 0x23, 0xAA, 0x10, 
+    0xF9, 0x26, 0x03, 0xCF, 0xF4, 0x13, 0x54, 0x00, 0x41, 0x29, 0x05, 0x00, 0x1B, 0x1B, 0x3D, 
+    0x02, 0x75, 0x26, 0xFF, 0x39, 0x15, 0xE8, 0x31, 0x84, 0x07, 0x5B, 0x03, 0xF5, 0x31, 0x50, 
+    0x14, 0xFB, 0x24, 0x32, 0x20, 0xFF, 0x78, 0x29, 0x53, 0x16, 0x0C, 0x2B, 0x5D, 0x12, 0x90, 
+    0x1B, 0xA7, 0x27, 0xFE, 0x00, 0x15, 0x12, 0xFF, 0x59, 0x37, 0x2D, 0x17, 0xE7, 0x00, 0xFD, 
+    0x22, 0x02, 0x0A, 0x77, 0x17, 0x1D, 0x2C, 0x85, 0x35, 0xFF, 0x3D, 0x29, 0x23, 0x2A, 0x7B, 
+    0x12, 0xD2, 0x11, 0xD1, 0x22, 0x5F, 0x20, 0x01, 0x01, 0x9A, 0x41, 0xFF, 0x23, 0x12, 0x1F, 
+    0x28, 0xFA, 0x23, 0xAB, 0x1B, 0xA5, 0x37, 0x43, 0x21, 0x7E, 0x4A, 0xC8, 0x23, 0xF1, 0x01, 
+    0x00, 0x1C, 0x1B, 0x1F, 0x25, 0x09, 0xC3, 0x00, 0xDB, 0x23, 0x97, 0x1B, 0xFF, 0xCC, 0x00, 
+    0x45, 0x12, 0xCC, 0x10, 0x3B, 0x00, 0xCE, 0x10, 0x57, 0x3B, 0x82, 0x06, 0x3C, 0x10, 0xFB, 
+    0xBB, 0x32, 0x29, 0x1B, 0x1B, 0x3D, 0x28, 0x98, 0x37, 0xDB, 0x36, 0xDA, 0x12, 0x91, 0x16, 
+    0xFF, 0xB4, 0x2A, 0x74, 0x11, 0x32, 0x30, 0xF4, 0x01, 0xFF, 0xFC, 0x06, 0x1D, 0x1C, 0x53, 
+    0x29, 0x06, 0x04, 0xFB, 0xF7, 0x03, 0x94, 0x00, 0xF6, 0xC7, 0x00, 0xA3, 0x37, 0xF7, 0x26, 
+    0xA9, 0x47, 0x1C, 0x11, 0xFF, 0xA0, 0x2B, 0xF1, 0x10, 0xCE, 0x30, 0xE9, 0x36, 0xAA, 0x10, 
+    0xC1, 0x03, 0xF1, 0x21, 0x68, 0x26, 0xDF, 0xFF, 0xFC, 0x09, 0x21, 0x09, 0x06, 0x22, 0x8D, 
+    0x23, 0x7F, 0x10, 0xF6, 0x29, 0x10, 0xED, 0x28, 0xFC, 0x01, 0x1B, 0x01, 0x11, 0x6B, 0x26, 
+    0x32, 0x77, 0xA2, 0x2B, 0x47, 0x10, 0xCC, 0x10, 0xFF, 0x58, 0x2C, 0x53, 0x31, 0xCB, 0x15, 
+    0xC9, 0x06, 0x00, 0x02, 0x73, 0x12, 0xCB, 0x26, 0xF8, 0x14, 0xFF, 0xEB, 0x16, 0x6C, 0x11, 
+    0x93, 0x14, 0xED, 0x1C, 0x5D, 0x15, 0x06, 0x20, 0xD3, 0x26, 0x64, 0x02, 0xFF, 0x6E, 0x02, 
+    0xD6, 0x28, 0x8F, 0x49, 0x0F, 0x29, 0x98, 0x10, 0x10, 0x12, 0x53, 0x10, 0x22, 0x2D, 0xFF, 
+    0x11, 0x00, 0xE8, 0x16, 0x4E, 0x29, 0x32, 0x00, 0x1C, 0x21, 0x32, 0xC0, 0xDB, 0x71, 0xA8, 
+    0x13, 0xFD, 0x32, 0x00, 0x02, 0x05, 0x3D, 0xD7, 0x39, 0x73, 0x3E, 0xCC, 0x25, 0xC6, 0x26, 
+    0x43, 0x12, 0xFF, 0x7E, 0x11, 0x44, 0x09, 0x6F, 0x02, 0xFB, 0x15, 0xEE, 0x2D, 0x3A, 0x06, 
+    0x51, 0x29, 0x7B, 0x10, 0xFF, 0x32, 0x46, 0x58, 0x26, 0x32, 0x46, 0xD2, 0x12, 0xB9, 0x12, 
+    0x90, 0x10, 0xC8, 0x29, 0x79, 0x1C, 0xFF, 0x20, 0x2A, 0x0A, 0x19, 0x74, 0x32, 0x66, 0x25, 
+    0x52, 0x13, 0xD3, 0x26, 0x5A, 0x12, 0x24, 0x10, 0xFF, 0xE7, 0x2C, 0x17, 0x3B, 0x24, 0x35, 
+    0x02, 0x32, 0xFF, 0xFC, 0x03, 0x91, 0x2B, 0x63, 0x15, 0x48, 0x2E, 0xFE, 0x1C, 0x32, 0x8D, 
+    0x58, 0x10, 0xD6, 0x22, 0x93, 0x3A, 0xB3, 0x52, 0xC4, 0x2B, 0x63, 0x16, 0xFB, 0x53, 0x12, 
+    0xBE, 0x10, 0x01, 0x32, 0x00, 0xD8, 0x3E, 0x8B, 0x47, 0xED, 0x37, 0xFF, 0xFC, 0x03, 0xFF, 
+    0xC0, 0x18, 0x6D, 0x14, 0xD3, 0x14, 0xBD, 0x25, 0xA8, 0x11, 0x63, 0x02, 0x9B, 0x23, 0x32, 
+    0x46, 0x2F, 0x25, 0x14, 0xCC, 0x20, 0x68, 0x10, 0x32, 0x56, 0x2E, 0xCC, 0x00, 0xF5, 0x2B, 
+    0xFF, 0xF2, 0x2C, 0x9F, 0x2E, 0x65, 0x2D, 0x6A, 0x04, 0x66, 0x02, 0x73, 0x00, 0x45, 0x21, 
+    0xB1, 0x12, 0xFF, 0xC5, 0x2F, 0x41, 0x11, 0x7B, 0x2A, 0xFF, 0x2B, 0xA2, 0x13, 0x4F, 0x3B, 
+    0xFF, 0xFC, 0x03, 0x32, 0x2E, 0xFF, 0x7F, 0x2D, 0x1A, 0x20, 0x46, 0x2F, 0xD2, 0x2C, 0x54, 
+    0x39, 0x1F, 0x28, 0x8B, 0x13, 0x05, 0x29, 0xFE, 0xF5, 0x7F, 0x30, 0xC7, 0x02, 0xFB, 0x36, 
+    0x32, 0x20, 0xCC, 0x25, 0x7B, 0x16, 0x08, 0x2C, 0xFF, 0xAF, 0x13, 0xFF, 0xFC, 0x08, 0x14, 
+    0x3C, 0xD0, 0x11, 0x8E, 0x21, 0x4A, 0x13, 0x4B, 0x29, 0x83, 0x11, 0xFF, 0xCC, 0x20, 0x55, 
+    0x21, 0xAA, 0x1F, 0x7E, 0x2F, 0x98, 0x1C, 0x00, 0x2D, 0x0B, 0x31, 0x3F, 0x12, 0xFF, 0xBB, 
+    0x0B, 0x45, 0x49, 0x42, 0x2F, 0x2A, 0x11, 0x49, 0x33, 0xA9, 0x14, 0x5E, 0x21, 0x48, 0x18, 
+    0x9F, 0xFE, 0x18, 0x90, 0x0D, 0x03, 0x25, 0xEE, 0x2B, 0xFF, 0xFC, 0x08, 0x1B, 0x5C, 0x62, 
+    0x12, 0xFF, 0x20, 0x11, 0x54, 0x11, 0x45, 0x26, 0x22, 0x40, 0x52, 0x39, 0xAE, 0x20, 0x9B, 
+    0x38, 0xF3, 0x29, 0xFD, 0x28, 0x00, 0xF5, 0x96, 0x24, 0x99, 0x2C, 0x87, 0x21, 0x71, 0x3B, 
+    0xD2, 0x12, 0xB6, 0x00, 0xFE, 0x02, 0x78, 0x11, 0xFF, 0xFC, 0x06, 0xD9, 0x2D, 0x3F, 0x27, 
+    0x06, 0x46, 0x0F, 0x10, 0x66, 0x10, 0xFF, 0x58, 0x18, 0x84, 0x22, 0x32, 0x77, 0xE3, 0x3A, 
+    0xCC, 0x40, 0xCD, 0x1A, 0x62, 0x03, 0x9F, 0x25, 0xFF, 0x66, 0x24, 0xEB, 0x20, 0x14, 0x23, 
+    0x2B, 0x32, 0x39, 0x29, 0x04, 0x32, 0x65, 0x35, 0x9F, 0x16, 0xFF, 0x1D, 0x20, 0x49, 0x13, 
+    0x77, 0x32, 0x4B, 0x14, 0xBF, 0x17, 0x31, 0x1B, 0x6C, 0x35, 0x34, 0x26, 0xFF, 0x2F, 0x3F, 
+    0x25, 0x4B, 0xFC, 0x40, 0x8B, 0x30, 0x5B, 0x11, 0xE8, 0x3A, 0xAD, 0x2E, 0x77, 0x20, 0xFF, 
+    0x52, 0x18, 0xA3, 0x29, 0x39, 0x20, 0xFB, 0x3F, 0x18, 0x2C, 0xAF, 0x10, 0xDE, 0x26, 0x46, 
+    0x00, 0xFF, 0xCC, 0x65, 0xFB, 0x25, 0x1D, 0x20, 0x74, 0x10, 0xFA, 0x17, 0x81, 0x2A, 0xE6, 
+    0x22, 0x23, 0x26, 0xFF, 0xB6, 0x11, 0x9A, 0x29, 0x32, 0x26, 0x76, 0x2B, 0x32, 0x46, 0xF5, 
+    0x13, 0xDA, 0x20, 0xCC, 0x50, 0xFC, 0x1C, 0x19, 0x54, 0x20, 0x40, 0x22, 0x37, 0x00, 0x64, 
+    0x1D, 0xF2, 0x14, 0x23, 0x10, 0xFF, 0x0F, 0x4D, 0x3B, 0x23, 0xCF, 0x42, 0xD5, 0x23, 0x3B, 
+    0x27, 0xBA, 0x31, 0xFF, 0xFC, 0x05, 0x64, 0x20, 0xC3, 0x44, 0x2D, 0xE4, 0x29, 0x02, 0x1C, 
+    0x9D, 0x9C, 0x20, 0x24, 0x84, 0x20, 0x7F, 0x37, 0x27, 0x41, 0x14, 0x2D, 0x10, 0x48, 0x20, 
+    0x8F, 0x37, 0xCC, 0x35, 0x65, 0x4D, 0x9D, 0xF8, 0xF5, 0x1C, 0x02, 0x2C, 0x2E, 0x0D, 0x41, 
+    0x5E, 0x39, 0xFF, 0xFC, 0x05, 0x9C, 0x1B, 0xFF, 0xA2, 0x3B, 0x4F, 0x30, 0xEE, 0x11, 0xCC, 
+    0x10, 0x24, 0x03, 0x8B, 0x27, 0xC3, 0x20, 0x6A, 0x23, 0xCF, 0x09, 0x13, 0x47, 0x38, 0xB8, 
+    0x10, 0xB6, 0x16, 0xF6, 0x5C, 0x2C, 0x3C, 0x63, 0x24, 0xFF, 0x34, 0x10, 0x97, 0x10, 0xE4, 
+    0x12, 0x22, 0x23, 0xE3, 0x11, 0x71, 0x4A, 0x0A, 0x4B, 0xBE, 0x38, 0x3F, 0x32, 0x20, 0xB4, 
+    0x10, 0xFF, 0xFC, 0x04, 0x59, 0x27, 0xFB, 0x12, 0x47, 0x2B, 0x01, 0x5A, 0xF8, 0x9C, 0x9C, 
+    0x9D, 0x46, 0x26, 0xD9, 0x22, 0xC0, 0x18, 0x2D, 0x29, 0x36, 0x21, 0x17, 0x37, 0x11, 0x4C, 
+    0x10, 0xB4, 0x4C, 0x02, 0x7B, 0x21, 0x2E, 0xF5, 0x9C, 0xF8, 0x5A, 0x9C, 0x5A, 0xA5, 0x13, 
+    0xA4, 0x13, 0xCB, 0x26, 0xFF, 0xFC, 0x09, 0x2C, 0x3D, 0xFF, 0xF9, 0x30, 0x44, 0x20, 0xE4, 
+    0x36, 0xCD, 0x27, 0xBF, 0x00, 0xCC, 0x30, 0x47, 0x11, 0x99, 0x28, 0xFF, 0xCC, 0x40, 0x68, 
+    0x20, 0x24, 0x16, 0x5A, 0x1D, 0x1A, 0x24, 0x01, 0x10, 0xF1, 0x14, 0x09, 0x3D, 0xEF, 0x89, 
+    0x33, 0xD2, 0x2F, 0x62, 0x04, 0xDB, 0x38, 0x01, 0xF8, 0x09, 0x11, 0x02, 0xEC, 0x19, 0x1F, 
+    0x5F, 0x4C, 0xFF, 0xFC, 0x05, 0x9C, 0x00, 0xE8, 0x24, 0x17, 0x16, 0xF5, 0x9D, 0x9C, 0xE0, 
+    0x9D, 0xF5, 0xF5, 0xF6, 0x8E, 0x69, 0x08, 0x2D, 0x21, 0xB7, 0x14, 0xFF, 0xE6, 0x36, 0xA9, 
+    0x21, 0x0B, 0x11, 0x74, 0x24, 0x68, 0x13, 0xCC, 0x06, 0x7A, 0x09, 0xBD, 0x12, 0xE1, 0x97, 
+    0x0C, 0x9C, 0x9B, 0x9D, 0xF5, 0x9B, 0x16, 0x44, 0x27, 0x5A, 0x01, 0xFF, 0xFF, 0xFC, 0x07, 
+    0xE3, 0x1E, 0x29, 0x3E, 0x63, 0x23, 0x09, 0x12, 0xCC, 0x30, 0x80, 0x15, 0x6D, 0x23, 0x1F, 
+    0xCC, 0x40, 0x2A, 0x1D, 0x35, 0x31, 0xCC, 0x30, 0xB3, 0x00, 0xF5, 0x1D, 0x1A, 0xFF, 0x39, 
+    0x38, 0xBE, 0x20, 0x51, 0x20, 0x97, 0x25, 0xD3, 0x3C, 0x75, 0x11, 0x29, 0x07, 0x2D, 0x2C, 
+    0xFF, 0xD1, 0x38, 0x79, 0x06, 0x5C, 0x22, 0xFA, 0x20, 0xAF, 0x1A, 0xCE, 0x2F, 0x08, 0x2D, 
+    0x0E, 0x12, 0x0F, 0xB3, 0x1C, 0x0F, 0x27, 0xCB, 0x28, 0x5D, 0x19, 0x9C, 0xF5, 0xF5, 0x5C, 
+    0xFA, 0x8E, 0x00, 0x00, 0x1E, 0x7B, 0x1B, 0x74, 0x19, 0xCC, 0x45, 0xEB, 0x13, 0xCC, 0x55, 
+    0xBF, 0x7F, 0x10, 0x65, 0x28, 0x69, 0x01, 0x72, 0x10, 0xBC, 0x14, 0x33, 0x10, 0xF5, 0x38, 
+    0x02, 0xFF, 0xBD, 0x2A, 0xE6, 0x22, 0x26, 0x2E, 0xCC, 0xA5, 0x4C, 0x34, 0x3F, 0x06, 0x05, 
+    0x15, 0x13, 0x00, 0xFF, 0x58, 0x2E, 0x8F, 0x25, 0x5C, 0x26, 0xCC, 0x60, 0x4D, 0x24, 0x9C, 
+    0x25, 0xCC, 0x30, 0x1F, 0x25, 0xFB, 0x8D, 0x14, 0xCC, 0x10, 0x5C, 0xCD, 0x27, 0x3B, 0x2F, 
+    0xCB, 0x4D, 0xE1, 0x17, 0x79, 0x14, 0xFF, 0x02, 0x27, 0x88, 0x4B, 0xAB, 0x2D, 0xDC, 0x01, 
+    0x1B, 0x08, 0x01, 0x29, 0xC9, 0x2F, 0xFF, 0xFC, 0x07, 0x27, 0x62, 0x14, 0x10, 0x11, 0xF7, 
+    0x02, 0xF5, 0xF5, 0xC9, 0x10, 0x8E, 0x8E, 0xFF, 0x73, 0x00, 0x27, 0x09, 0x19, 0x25, 0x0E, 
+    0x0D, 0x00, 0x15, 0x4D, 0x00, 0x95, 0x13, 0xCC, 0x05, 0x1F, 0x9F, 0x24, 0x6D, 0x14, 0xC6, 
+    0x10, 0x5C, 0x2E, 0xFF, 0x20, 0x1F, 0x8E, 0xF5, 0x70, 0xF5, 0x02, 0x9B, 0x19, 0x34, 0x13, 
+    0x51, 0x35, 0xFF, 0xFC, 0x05, 0xF6, 0xFF, 0x36, 0x03, 0xEB, 0x20, 0xE6, 0x13, 0x58, 0x24, 
+    0x85, 0x1E, 0xA9, 0x2C, 0x06, 0x23, 0x68, 0x22, 0xCF, 0xC0, 0x21, 0x26, 0x45, 0x06, 0x3F, 
+    0xE2, 0x3F, 0x1D, 0x18, 0xF2, 0x2C, 0x99, 0x10, 0xFE, 0x02, 0xF6, 0x35, 0x40, 0x38, 0x27, 
+    0x13, 0x46, 0x3C, 0x1F, 0x10, 0xAB, 0x10, 0xEA, 0x34, 0xBF, 0x71, 0x16, 0x8D, 0x31, 0xB9, 
+    0x23, 0xFF, 0xFC, 0x04, 0xB9, 0x04, 0x7D, 0x15, 0x9B, 0xFE, 0x00, 0xDE, 0x1E, 0xFD, 0x20, 
+    0xE2, 0x09, 0x65, 0x5C, 0x92, 0x10, 0xF6, 0x98, 0x07, 0xB6, 0x12, 0x3D, 0xA2, 0x25, 0xF6, 
+    0x7F, 0x20, 0x00, 0x12, 0x65, 0x3D, 0xEB, 0x10, 0x1E, 0x1E, 0x02, 0x1F, 0x01, 0x01, 0x1F, 
+    0x8E, 0x1F, 0xF5, 0x9C, 0x9B, 0xFC, 0x9B, 0x5C, 0x7A, 0x11, 0x55, 0x1D, 0xFF, 0xFC, 0x05, 
+    0xD5, 0x10, 0x13, 0x22, 0x8D, 0x33, 0xFF, 0xB2, 0x12, 0x62, 0x00, 0xCC, 0x40, 0xFC, 0x2D, 
+    0x1E, 0x13, 0xE8, 0x1A, 0x9A, 0x39, 0x21, 0x23, 0xF3, 0xCC, 0x10, 0x75, 0x10, 0x1E, 0x19, 
+    0xDC, 0x0D, 0xF0, 0x35, 0xD5, 0x2D, 0xD5, 0x14, 0xFF, 0x72, 0x14, 0x73, 0x3C, 0xF7, 0x10, 
+    0x35, 0x14, 0x39, 0x11, 0x39, 0x25, 0x35, 0x30, 0x05, 0x27, 0x03, 0xF8, 0x00, 0xFF, 0xFC, 
+    0x09, 0x2E, 0x5C, 0x1C, 0x9C, 0x18, 0x5A, 0xFF, 0xFE, 0x50, 0x00, 0x01, 0x32, 0x3D, 0x17, 
+    0x37, 0x37, 0x33, 0x97, 0x21, 0xC8, 0x3C, 0xD6, 0x2B, 0x37, 0x8E, 0x05, 0x96, 0x10, 0x6A, 
+    0x21, 0x01, 0x35, 0x32, 0x00, 0x01, 0x1B, 0x18, 0xFE, 0x9D, 0xA3, 0x02, 0x04, 0x24, 0xFF, 
+    0xFC, 0x05, 0x12, 0x20, 0x59, 0x13, 0xE0, 0x13, 0x9A, 0x19, 0xFF, 0x97, 0x13, 0xC3, 0x22, 
+    0x10, 0x13, 0xCC, 0x40, 0x7B, 0x3A, 0x85, 0x26, 0xCC, 0x20, 0x5D, 0x2D, 0xBF, 0x93, 0x11, 
+    0x5F, 0x02, 0x22, 0x11, 0x50, 0x25, 0x27, 0x00, 0x7E, 0x04, 0x1E, 0x80, 0x1F, 0xFF, 0xAF, 
+    0x2A, 0x01, 0x27, 0xCB, 0x0C, 0xE9, 0x2D, 0x89, 0x23, 0x80, 0x11, 0x04, 0x22, 0x32, 0x10, 
+    0xBF, 0x28, 0x45, 0x5A, 0x15, 0x12, 0x22, 0x15, 0x11, 0x65, 0x13, 0x95, 0x10, 0x02, 0xF3, 
+    0x15, 0xFF, 0xC3, 0x40, 0x00, 0x00, 0xFE, 0x1E, 0x77, 0x32, 0xF6, 0x15, 0xF0, 0x12, 0xA2, 
+    0x25, 0x34, 0x26, 0x3F, 0x41, 0x00, 0xCC, 0x75, 0x86, 0x29, 0x78, 0x28, 0x00, 0x20, 0x39, 
+    0x13, 0x9D, 0x9D, 0xFE, 0x9C, 0xDC, 0x48, 0xF0, 0x2B, 0x22, 0x17, 0x84, 0x2E, 0xDF, 0x24, 
+    0x15, 0x20, 0xBD, 0x17, 0x7F, 0xD7, 0x23, 0xF2, 0x10, 0xCC, 0x70, 0x4B, 0x15, 0x53, 0x20, 
+    0xFA, 0x10, 0x78, 0x27, 0x2E, 0xFF, 0xBF, 0x09, 0xCC, 0x30, 0xDA, 0x15, 0xED, 0x42, 0xBB, 
+    0x13, 0x6B, 0x38, 0x52, 0x00, 0xC6, 0x11, 0xFF, 0xC5, 0x00, 0x5F, 0x09, 0xD6, 0x25, 0x8E, 
+    0x24, 0xB9, 0x48, 0x75, 0x17, 0x8B, 0x2E, 0x32, 0x40, 0x3F, 0xC8, 0x29, 0x7D, 0x37, 0x2E, 
+    0x3E, 0x9B, 0x1B, 0x57, 0x24, 0x8E, 0x00, 0x9C, 0x9D, 0xFC, 0x9D, 0x9D, 0xFE, 0x50, 0x03, 
+    0x10, 0xCF, 0x10, 0xC4, 0x3B, 0x65, 0x2D, 0x66, 0x0F, 0xFF, 0x0E, 0x01, 0x06, 0x1D, 0xCC, 
+    0x45, 0x31, 0x17, 0xCC, 0x25, 0xDB, 0x24, 0x0D, 0x19, 0x36, 0x00, 0x83, 0x34, 0x00, 0x3B, 
+    0x02, 0x1D, 0x9D, 0xF5, 0x9C, 0x2B, 0xB1, 0x32, 0xFF, 0xBA, 0x35, 0x61, 0x10, 0x99, 0x27, 
+    0x52, 0x23, 0xD5, 0x14, 0x75, 0x15, 0x89, 0x25, 0x9B, 0x10, 0xFF, 0x45, 0x31, 0x1C, 0x11, 
+    0xCC, 0x00, 0x91, 0x06, 0xC5, 0x25, 0x88, 0x28, 0x5B, 0x2D, 0x6C, 0x38, 0x3B, 0xCA, 0x10, 
+    0x1F, 0x24, 0x2B, 0x90, 0x4E, 0x4A, 0x19, 0x26, 0x01, 0xF5, 0x2E, 0xFA, 0x1B, 0xCB, 0x07, 
+    0xF6, 0x42, 0x02, 0x2C, 0x18, 0x9A, 0x2A, 0xF4, 0x21, 0xE3, 0x10, 0xFF, 0xF1, 0x3A, 0xE4, 
+    0x2E, 0x5F, 0x2C, 0xB9, 0x11, 0x4F, 0x10, 0x69, 0x0C, 0x01, 0x3E, 0x19, 0x38, 0xD5, 0x83, 
+    0x11, 0x9D, 0xF8, 0x04, 0x1D, 0xFE, 0x50, 0x1E, 0x18, 0x14, 0x32, 0x4D, 0xFF, 0x9D, 0x2A, 
+    0x63, 0x11, 0x65, 0x2D, 0xBE, 0x11, 0xB3, 0x25, 0x4F, 0x26, 0xAA, 0x10, 0xF2, 0x27, 0x71, 
+    0xD8, 0x10, 0x8E, 0x1D, 0x01, 0x04, 0x04, 0x12, 0x05, 0x07, 0x06, 0xF5, 0xDC, 0x1B, 0x5A, 
+    0x64, 0x2A, 0x33, 0x3B, 0x2F, 0x21, 0x1D, 0xF3, 0x04, 0x82, 0x39, 0xFB, 0xE3, 0x26, 0x54, 
+    0x10, 0xF6, 0x4E, 0x1F, 0x24, 0x35, 0xCC, 0x30, 0x05, 0x02, 0xCC, 0x20, 0xFE, 0x1B, 0xCC, 
+    0x00, 0xCF, 0x34, 0x30, 0x16, 0xD9, 0x11, 0xFD, 0x11, 0xCC, 0x30, 0xE5, 0x33, 0x07, 0xCD, 
+    0x1B, 0x87, 0x10, 0x14, 0x00, 0xF6, 0xF6, 0x1C, 0x2E, 0x1E, 0xFE, 0x1C, 0xFF, 0x01, 0x9A, 
+    0x05, 0x48, 0x20, 0x64, 0x3D, 0x08, 0x61, 0x62, 0x2A, 0x32, 0x20, 0x3F, 0x54, 0x22, 0xB8, 
+    0x21, 0x23, 0x2D, 0x40, 0x12, 0xB0, 0x2A, 0x67, 0x01, 0x5C, 0x9C, 0xFE, 0x5C, 0xBB, 0x07, 
+    0xFB, 0x32, 0x76, 0x18, 0xEB, 0x01, 0xA5, 0x2B, 0xFF, 0x10, 0x77, 0x23, 0xFF, 0x02, 0x2E, 
+    0x2D, 0x17, 0x75, 0x22, 0xCB, 0x13, 0x12, 0x4D, 0x81, 0x28, 0x76, 0x28, 0xFE, 0x01, 0x08, 
+    0x01, 0x1E, 0x1D, 0x08, 0x27, 0x9D, 0x5C, 0x5C, 0x5C, 0xFF, 0x6C, 0x1A, 0x4F, 0x07, 0x2F, 
+    0x11, 0xCC, 0x39, 0xD7, 0x14, 0x38, 0x2D, 0x3A, 0x21, 0x47, 0x30, 0xBF, 0x99, 0x30, 0xD5, 
+    0x20, 0x4A, 0x27, 0x79, 0x0E, 0xCC, 0x00, 0x67, 0x16, 0xF5, 0xCC, 0x00, 0xFB, 0x50, 0x1E, 
+    0xCC, 0x10, 0xF5, 0x1D, 0x11, 0x59, 0x19, 0xB4, 0x12, 0xAB, 0x15, 0x59, 0x46, 0xFF, 0x44, 
+    0x39, 0x1A, 0x00, 0x5D, 0x0E, 0x5F, 0x17, 0xC8, 0x34, 0xA4, 0x14, 0xBC, 0x44, 0x62, 0x12, 
+    0xF7, 0x5A, 0x12, 0x07, 0x31, 0xB3, 0x21, 0x2E, 0xDD, 0x0A, 0x06, 0x33, 0x49, 0x00, 0x06, 
+    0x11, 0xED, 0xD6, 0x00, 0x9C, 0x14, 0x06, 0xC0, 0x14, 0x1F, 0xC1, 0x00, 0xFF, 0x10, 0xD5, 
+    0x01, 0xFF, 0x15, 0x2A, 0xE6, 0x41, 0xFC, 0x01, 0x77, 0x0E, 0x6B, 0x20, 0xD2, 0x1C, 0xD1, 
+    0x17, 0xCF, 0x01, 0x6F, 0xB1, 0x13, 0x12, 0x20, 0x76, 0x37, 0xDF, 0x37, 0x1F, 0x02, 0x02, 
+    0x09, 0x13, 0x1F, 0xF0, 0xF5, 0xF5, 0xF5, 0x9D, 0x90, 0x02, 0xDE, 0x22, 0xAB, 0x33, 0xFA, 
+    0x2F, 0xFF, 0xE2, 0x29, 0xEE, 0x10, 0x00, 0x22, 0x95, 0x20, 0xCC, 0x40, 0x8E, 0x2B, 0xCC, 
+    0x40, 0x2C, 0x28, 0xFF, 0xCC, 0x80, 0x28, 0x23, 0x42, 0x24, 0xF2, 0x3A, 0x26, 0x03, 0x1E, 
+    0x32, 0x12, 0x22, 0x9B, 0x21, 0xF9, 0xDC, 0x13, 0x1D, 0x1E, 0x68, 0x0F, 0x81, 0x3C, 0x0D, 
+    0x4D, 0x60, 0x20, 0x7A, 0x24, 0x3F, 0x32, 0x10, 0x16, 0x2F, 0xCC, 0x14, 0x72, 0x4D, 0x78, 
+    0x22, 0x5F, 0x01, 0x9D, 0xF5, 0xF7, 0x73, 0x02, 0xFB, 0x22, 0xA4, 0x13, 0x1E, 0x42, 0x16, 
+    0x40, 0x3A, 0x05, 0x15, 0x9A, 0x24, 0xFF, 0x82, 0x1F, 0x2B, 0x36, 0x82, 0x2A, 0xF9, 0x13, 
+    0x3B, 0x20, 0x4F, 0x3B, 0xCD, 0x13, 0x5C, 0x24, 0xB4, 0x1F, 0x1E, 0x07, 0x14, 0x1E, 0x3D, 
+    0x16, 0x07, 0x06, 0x5C, 0x6F, 0x06, 0xFF, 0xDA, 0x20, 0x49, 0x47, 0x35, 0x26, 0x27, 0x00, 
+    0xB1, 0x26, 0x57, 0x3C, 0x38, 0x11, 0xDB, 0x1F, 0xCF, 0x7C, 0x28, 0xF3, 0x25, 0x4E, 0x11, 
+    0x93, 0x10, 0x1C, 0x1E, 0xCC, 0x00, 0x6F, 0x46, 0x7F, 0x81, 0x21, 0x26, 0x35, 0x4E, 0x2C, 
+    0xF9, 0x45, 0x92, 0x25, 0x95, 0x21, 0x15, 0x22, 0xF5, 0xFE, 0x1C, 0x98, 0x09, 0xC4, 0x02, 
+    0xFE, 0x30, 0x5D, 0x12, 0x54, 0x22, 0xB2, 0x27, 0x76, 0x3C, 0x1F, 0xC6, 0x23, 0xCB, 0x01, 
+    0x17, 0x32, 0xEB, 0x10, 0x31, 0x15, 0x1F, 0x9C, 0x9C, 0xBF, 0xFE, 0x40, 0xFA, 0x31, 0xDA, 
+    0x26, 0x04, 0x2E, 0x1B, 0x3E, 0x68, 0x10, 0xF5, 0x95, 0x04, 0x3F, 0x9F, 0x3F, 0x58, 0x25, 
+    0xCD, 0x1B, 0xFC, 0x20, 0x52, 0x2B, 0x0E, 0x10, 0x1D, 0x5C, 0x9F, 0x92, 0x28, 0xFF, 0x14, 
+    0x3C, 0x17, 0x04, 0x00, 0x91, 0x04, 0x1C, 0x9D, 0x82, 0x10, 0xBF, 0x2A, 0x23, 0x9E, 0x2B, 
+    0x3D, 0x1A, 0xED, 0x06, 0xD2, 0x00, 0xA4, 0x00, 0xF6, 0x64, 0x12, 0xFF, 0x17, 0x10, 0xCC, 
+    0x80, 0x0E, 0x3A, 0x0F, 0x10, 0xD2, 0x29, 0x39, 0x1C, 0xCC, 0x20, 0x3B, 0x26, 0xFF, 0x1E, 
+    0x17, 0xCC, 0x10, 0xBE, 0x02, 0x97, 0x33, 0xE3, 0x2E, 0xDB, 0x18, 0xE8, 0x19, 0x93, 0x2C, 
+    0xFF, 0x6E, 0x14, 0x7B, 0x2C, 0xDB, 0x19, 0x44, 0x32, 0xAA, 0x10, 0xA7, 0x26, 0x60, 0x35, 
+    0x86, 0x3B, 0x87, 0xD3, 0x13, 0xF7, 0x23, 0x9C, 0x12, 0x9C, 0x5A, 0x5C, 0x9D, 0xF3, 0x29, 
+    0xFF, 0x6E, 0x24, 0x9C, 0x37, 0xA2, 0x28, 0x86, 0x12, 0x2F, 0x4D, 0x20, 0x17, 0xB6, 0x16, 
+    0x86, 0x2D, 0xFF, 0x63, 0x14, 0x6B, 0x16, 0xF8, 0x39, 0xE8, 0x18, 0xC9, 0x16, 0xE6, 0x25, 
+    0x7E, 0x10, 0x04, 0x17, 0xF1, 0x46, 0x11, 0xF5, 0x9D, 0x1B, 0x45, 0x1E, 0x38, 0x20, 0x0C, 
+    0x25, 0xAD, 0x20, 0xFF, 0x7F, 0x19, 0x89, 0x08, 0x2B, 0x10, 0xC3, 0x14, 0x95, 0x27, 0x93, 
+    0x27, 0x9B, 0x31, 0x22, 0x2E, 0x7F, 0x18, 0x21, 0xB8, 0x1A, 0x6E, 0x2C, 0xCC, 0x40, 0xFF, 
+    0x01, 0x6E, 0x09, 0x77, 0x01, 0x19, 0xFF, 0xB5, 0x38, 0x10, 0x4A, 0x35, 0x20, 0x20, 0x20, 
+    0x5D, 0x01, 0x40, 0x1E, 0x35, 0x11, 0x4B, 0x22, 0xFD, 0xCC, 0x3E, 0x1D, 0xB7, 0x05, 0x3A, 
+    0x20, 0x29, 0x22, 0x16, 0x23, 0xAA, 0x30, 0x5B, 0x20, 0x71, 0x67, 0x00, 0x9C, 0x9C, 0x1B, 
+    0x93, 0x01, 0xB0, 0x01, 0x0E, 0x10, 0x1F, 0xFF, 0x63, 0x1C, 0x11, 0x3E, 0x9F, 0x17, 0xB0, 
+    0x11, 0x3F, 0x28, 0x22, 0x26, 0x53, 0x10, 0x9B, 0x1D, 0xFF, 0x99, 0x17, 0xA7, 0x22, 0x63, 
+    0x29, 0xFF, 0x23, 0x0B, 0x00, 0xC0, 0x21, 0x56, 0x01, 0x41, 0x10, 0xFF, 0x95, 0x07, 0x07, 
+    0x04, 0x05, 0x06, 0x4B, 0x0D, 0x30, 0x14, 0x07, 0x15, 0x2A, 0x24, 0x42, 0x00, 0xE6, 0xF6, 
+    0xD6, 0x02, 0x19, 0x37, 0x01, 0x02, 0xF2, 0x35, 0xBE, 0x20, 0xD4, 0x24, 0xFF, 0x6E, 0x3D, 
+    0x63, 0x11, 0xCC, 0x30, 0xAB, 0x22, 0x9F, 0x27, 0x22, 0x31, 0x88, 0x1A, 0x71, 0x0E, 0xFF, 
+    0x65, 0x1D, 0xC3, 0x15, 0x5B, 0x05, 0x9D, 0x34, 0x03, 0x12, 0x5C, 0x11, 0x64, 0x00, 0xE7, 
+    0x10, 0xFF, 0xD7, 0x25, 0x90, 0x17, 0x78, 0x3B, 0xCD, 0x10, 0x32, 0x20, 0xAC, 0x38, 0x48, 
+    0x27, 0xBD, 0x2B, 0xD0, 0x01, 0x8E, 0x1D, 0x1F, 0xFC, 0x00, 0xF5, 0xF7, 0x27, 0xB7, 0x24, 
+    0xFF, 0x75, 0x39, 0x87, 0x31, 0x2E, 0x35, 0xF2, 0x2B, 0x1C, 0x3F, 0x64, 0x10, 0x87, 0x3C, 
+    0x74, 0x12, 0xF7, 0x14, 0x25, 0x04, 0x13, 0x96, 0x10, 0x1E, 0x9E, 0x11, 0xBE, 0x20, 0x93, 
+    0x2C, 0xD4, 0x03, 0xE0, 0x1D, 0x1E, 0x8E, 0x1E, 0xF5, 0x5B, 0x10, 0x48, 0x10, 0x41, 0x11, 
+    0xFF, 0xEB, 0x2C, 0xC5, 0x10, 0x0B, 0x23, 0xF2, 0x47, 0x48, 0x28, 0xDB, 0x1D, 0x47, 0x10, 
+    0x6B, 0x46, 0xFF, 0x30, 0x26, 0xCC, 0x30, 0x0C, 0x33, 0x32, 0x10, 0x08, 0x13, 0xCC, 0x40, 
+    0x35, 0x01, 0x96, 0x31, 0xFF, 0xE4, 0x23, 0x84, 0x10, 0xC7, 0x3F, 0xB2, 0x12, 0x8E, 0x4D, 
+    0xD7, 0x22, 0xEF, 0x1C, 0x3B, 0x20, 0xF3, 0x9F, 0x26, 0x00, 0x40, 0x1F, 0xF6, 0x14, 0x28, 
+    0xAE, 0x03, 0x92, 0x1B, 0x19, 0x00, 0xFD, 0x35, 0x04, 0xF5, 0xF7, 0x46, 0xC4, 0x00, 0x00, 
+    0x02, 0xD1, 0x25, 0x94, 0x14, 0x98, 0x10, 0xFF, 0xC1, 0x27, 0x6B, 0x27, 0xFA, 0x23, 0x73, 
+    0x49, 0x4C, 0x39, 0xEE, 0x21, 0x41, 0x12, 0x07, 0x00, 0x3F, 0xE9, 0x0F, 0xA7, 0x12, 0x25, 
+    0x00, 0x93, 0x2C, 0x85, 0x00, 0x0A, 0x19, 0x1D, 0x9D, 0x2E, 0x1B, 0x00, 0x01, 0x4D, 0x10, 
+    0x6B, 0x00, 0x5C, 0x50, 0x21, 0x2E, 0x2E, 0xFE, 0x1E, 0x4D, 0x3F, 0xDC, 0x20, 0xE1, 0x16, 
+    0xCC, 0x50, 0xFD, 0x2F, 0x73, 0x17, 0x39, 0x1F, 0x3F, 0xA4, 0x13, 0x20, 0x10, 0x32, 0x2F, 
+    0xA1, 0x16, 0xD0, 0x20, 0xC8, 0x25, 0x2E, 0x19, 0xFF, 0xCE, 0x23, 0x2C, 0x22, 0x44, 0x04, 
+    0xEB, 0x2C, 0x2C, 0x2F, 0x2C, 0x16, 0xF9, 0x03, 0x98, 0x00, 0xBF, 0xCC, 0x06, 0x33, 0x07, 
+    0x3B, 0x0A, 0x23, 0x58, 0x61, 0x39, 0xF7, 0x12, 0x02, 0x7E, 0x02, 0x87, 0xFD, 0x1C, 0x5A, 
+    0x26, 0xD9, 0x0D, 0x9D, 0x1D, 0xF5, 0x2B, 0xF2, 0x1B, 0xFD, 0xAF, 0x00, 0x8E, 0x9C, 0x23, 
+    0xD0, 0x21, 0xBC, 0x02, 0x1D, 0x2A, 0x27, 0x12, 0x32, 0x00, 0xFF, 0x6F, 0x23, 0x71, 0x2D, 
+    0x82, 0x24, 0x4E, 0x2B, 0x98, 0x15, 0x73, 0x26, 0x0F, 0x21, 0xAB, 0x1C, 0x1E, 0x1F, 0x86, 
+    0x1B, 0x93, 0x3C, 0xFB, 0x00, 0x47, 0x2C, 0xF5, 0x2B, 0x2E, 0xB8, 0x1B, 0xF5, 0x2B, 0xC9, 
+    0x01, 0xE5, 0x2F, 0x07, 0x01, 0x1E, 0xB9, 0x33, 0xFF, 0x49, 0x21, 0xB7, 0x11, 0xCC, 0x04, 
+    0x55, 0x56, 0xCC, 0x10, 0x8F, 0x25, 0x15, 0x12, 0xCC, 0x40, 0xEF, 0x65, 0x21, 0xCC, 0x40, 
+    0x84, 0x2C, 0x41, 0x11, 0x1A, 0x16, 0x13, 0x24, 0x25, 0x43, 0x22, 0xBD, 0xD3, 0x33, 0xF5, 
+    0x63, 0x13, 0xA0, 0x31, 0xB4, 0x21, 0x8B, 0x01, 0xF5, 0xB3, 0x14, 0xFC, 0x2E, 0xF6, 0x01, 
+    0x15, 0x98, 0x12, 0x22, 0x12, 0x4F, 0x10, 0xFF, 0x2B, 0x42, 0x4A, 0xF8, 0x02, 0x9D, 0x1F, 
+    0xF5, 0x28, 0xAF, 0x10, 0x72, 0x1D, 0x3D, 0x10, 0x34, 0x01, 0xDF, 0x03, 0x15, 0xF0, 0x24, 
+    0xE2, 0x2A, 0x6B, 0x27, 0x0B, 0x0F, 0x1E, 0x98, 0x14, 0x85, 0x23, 0xC1, 0x8E, 0x12, 0x1C, 
+    0xF6, 0xF5, 0xF5, 0xF6, 0x21, 0x12, 0x5F, 0x30, 0x1F, 0xDB, 0x14, 0x6C, 0x12, 0xEA, 0x50, 
+    0x24, 0x15, 0x26, 0x00, 0x1E, 0xF5, 0x9C, 0x98, 0x1C, 0x9D, 0xF5, 0xE5, 0x30, 0xBE, 0x42, 
+    0x1E, 0x1E, 0xE9, 0x2D, 0xFF, 0xC4, 0x24, 0x17, 0x30, 0xB2, 0x23, 0xCC, 0x28, 0x5D, 0x33, 
+    0x69, 0x02, 0x6B, 0x33, 0x2E, 0x12, 0x8F, 0x55, 0x24, 0x80, 0x0B, 0x05, 0x28, 0xDE, 0x01, 
+    0x2E, 0x01, 0x1A, 0xC8, 0x1B, 0xFF, 0xBF, 0x45, 0x67, 0x10, 0x7D, 0x29, 0xB7, 0x00, 0x8A, 
+    0x47, 0x9D, 0x41, 0x48, 0x25, 0x23, 0x10, 0x7F, 0x22, 0x02, 0xEC, 0x2D, 0x32, 0x10, 0x38, 
+    0x17, 0x2F, 0x10, 0x1B, 0x2D, 0x68, 0x00, 0x9C, 0xC8, 0x1B, 0x01, 0x9C, 0xFC, 0x22, 0x1E, 
+    0x8E, 0xF1, 0x18, 0xB8, 0x14, 0xDF, 0x83, 0x3F, 0xFD, 0x23, 0xB6, 0x28, 0xB3, 0x1E, 0x11, 
+    0x10, 0x1B, 0x65, 0x7D, 0x97, 0x2A, 0xFF, 0xCD, 0x0A, 0xDE, 0x08, 0xD4, 0x20, 0x5F, 0x10, 
+    0x37, 0x12, 0x1E, 0x24, 0xCC, 0x25, 0x63, 0x2E, 0xC3, 0x96, 0x02, 0x56, 0x02, 0x9D, 0x9D, 
+    0x1C, 0x9D, 0x23, 0x3D, 0x54, 0x25, 0xFF, 0x27, 0x13, 0x01, 0x17, 0xB1, 0x11, 0x9F, 0x26, 
+    0x1F, 0xFD, 0x02, 0xCC, 0x20, 0x92, 0x2F, 0xCC, 0x40, 0xFF, 0x57, 0x32, 0x1E, 0x02, 0xCC, 
+    0x00, 0xB8, 0x11, 0x52, 0x4C, 0x74, 0x02, 0xAF, 0x10, 0xE8, 0x29, 0xFF, 0x27, 0x00, 0x3B, 
+    0x10, 0x87, 0x12, 0xEC, 0x25, 0x37, 0x37, 0x36, 0x10, 0x5E, 0x10, 0x69, 0x21, 0x0F, 0x5D, 
+    0x21, 0x63, 0x14, 0x71, 0x25, 0x06, 0x17, 0x9D, 0x01, 0x1B, 0x2B, 0xF1, 0xA7, 0x12, 0x1E, 
+    0x1F, 0x1E, 0x21, 0x44, 0xCC, 0x10, 0xF6, 0x3C, 0x02, 0x31, 0xFF, 0x03, 0x48, 0x48, 0x17, 
+    0x7B, 0x05, 0xDA, 0x08, 0x5D, 0x3F, 0xCE, 0x24, 0x65, 0x4A, 0x5F, 0x10, 0xBF, 0x2B, 0x10, 
+    0x30, 0x13, 0xB7, 0x21, 0x5E, 0x42, 0x0D, 0x1C, 0xB9, 0x02, 0x1B, 0x28, 0x02, 0xE7, 0x7E, 
+    0x2E, 0x16, 0x12, 0x90, 0x00, 0x1E, 0x1B, 0x83, 0x11, 0x92, 0x16, 0x51, 0x14, 0x7F, 0xA9, 
+    0x00, 0x1F, 0xFD, 0x00, 0xAF, 0x11, 0xA2, 0x27, 0xCC, 0x50, 0x64, 0x14, 0x1F, 0x11, 0x02, 
+    0xFF, 0xB3, 0x14, 0xFD, 0x00, 0x9A, 0x25, 0xE1, 0x14, 0x52, 0x3C, 0x81, 0x23, 0xB9, 0x31, 
+    0x2C, 0x01, 0xFF, 0x17, 0x25, 0x96, 0x24, 0x9C, 0x24, 0x7C, 0x02, 0x48, 0x1A, 0xB8, 0x16, 
+    0x32, 0x41, 0x61, 0x19, 0xE1, 0x74, 0x25, 0x02, 0xF5, 0xF5, 0x01, 0xFB, 0x15, 0xB4, 0x1C, 
+    0xDD, 0x12, 0x7D, 0x86, 0x3B, 0x1B, 0xD6, 0x16, 0xD1, 0x21, 0xA0, 0x02, 0x8D, 0x21, 0x30, 
+    0x13, 0xF5, 0xF2, 0x1B, 0x80, 0x00, 0xF6, 0xF5, 0xD0, 0x04, 0x02, 0x14, 0x99, 0x4C, 0xBD, 
+    0x19, 0x7F, 0x04, 0x1C, 0xBF, 0x22, 0xD8, 0x1E, 0x81, 0x09, 0x0E, 0x10, 0x66, 0x13, 0x9C, 
+    0x27, 0x1F, 0xFC, 0x1E, 0xF6, 0x57, 0x0D, 0x03, 0x07, 0x86, 0x11, 0x7A, 0x13, 0x88, 0x00, 
+    0x50, 0x23, 0xFE, 0x1C, 0x49, 0x07, 0xD2, 0x2B, 0xD3, 0x07, 0x1F, 0xED, 0x47, 0x21, 0x13, 
+    0x20, 0x54, 0x00, 0xEE, 0x02, 0xCC, 0x40, 0x61, 0x30, 0x15, 0x02, 0x19, 0xC9, 0x29, 0x80, 
+    0x30, 0x95, 0x16, 0xFF, 0x54, 0x0B, 0x53, 0x18, 0xCF, 0x1A, 0x55, 0x11, 0x58, 0x10, 0x9A, 
+    0x4C, 0x59, 0x24, 0xC6, 0x38, 0x1D, 0x32, 0x20, 0x1B, 0x97, 0x11, 0x47, 0x16, 0xA5, 0x17, 
+    0x1D, 0x1C, 0x9D, 0xF0, 0x02, 0xF5, 0x9C, 0x9D, 0xF6, 0x0B, 0xC3, 0x00, 0x72, 0x0C, 0x93, 
+    0x34, 0xFF, 0xE7, 0x0E, 0x6D, 0x11, 0x6C, 0x2F, 0x6D, 0x07, 0xA9, 0x23, 0xE6, 0x02, 0x73, 
+    0x19, 0xCD, 0x06, 0xFE, 0xF6, 0xDF, 0x10, 0x61, 0x43, 0xD8, 0x3D, 0xE5, 0x19, 0x68, 0x19, 
+    0x22, 0x02, 0x7F, 0x23, 0x0F, 0x62, 0x20, 0x4B, 0x10, 0x27, 0x14, 0x03, 0x05, 0x1F, 0x1F, 
+    0x9D, 0x9C, 0xF0, 0xF5, 0xF6, 0x9C, 0x9C, 0x4A, 0x01, 0x1A, 0x21, 0xF2, 0x28, 0x39, 0x28, 
+    0xEF, 0x44, 0x32, 0x96, 0x3A, 0x94, 0x06, 0xAD, 0x28, 0x1F, 0xCC, 0x40, 0x70, 0x2D, 0xCC, 
+    0x40, 0xFF, 0xF7, 0x22, 0x8D, 0x00, 0xBF, 0x04, 0xC7, 0x2D, 0x28, 0x36, 0xA7, 0x26, 0x0E, 
+    0x20, 0xE5, 0x4E, 0xFF, 0xF8, 0x11, 0x81, 0x25, 0x81, 0x00, 0x07, 0x0C, 0xB4, 0x38, 0xF8, 
+    0x10, 0x44, 0x13, 0x43, 0x01, 0x0F, 0xDA, 0x16, 0x83, 0x1D, 0x6C, 0x37, 0x41, 0x10, 0x2B, 
+    0x9D, 0xF6, 0xF5, 0xFE, 0x2B, 0xF6, 0x2C, 0x92, 0x2A, 0x00, 0x23, 0xCC, 0x14, 0x19, 0x3F, 
+    0x6E, 0x25, 0x08, 0x23, 0xFF, 0xB9, 0x27, 0x65, 0x20, 0x39, 0x11, 0x11, 0x27, 0xC3, 0x2B, 
+    0x07, 0x21, 0x6A, 0x21, 0x0F, 0x24, 0x77, 0xCE, 0x21, 0x08, 0x2A, 0xCC, 0x25, 0x5C, 0xBE, 
+    0x25, 0xE9, 0x01, 0x63, 0x00, 0xF5, 0xFE, 0x9D, 0x05, 0x04, 0x42, 0x2A, 0xA9, 0x1E, 0x43, 
+    0x01, 0x89, 0x01, 0x2D, 0x11, 0x13, 0x29, 0xFF, 0x1F, 0xFD, 0x02, 0x2F, 0x24, 0xCC, 0x00, 
+    0x4E, 0x11, 0x07, 0x0C, 0x0E, 0x04, 0xB5, 0x11, 0x26, 0x00, 0x9D, 0xCC, 0x10, 0x03, 0xD9, 
+    0x24, 0xE6, 0x25, 0xC7, 0x3A, 0x1F, 0x1B, 0x60, 0x17, 0xE7, 0x6E, 0x00, 0x8B, 0x01, 0x05, 
+    0x12, 0x1E, 0x1E, 0xFA, 0x05, 0xCC, 0x10, 0x51, 0x3D, 0x9F, 0x40, 0x11, 0x5F, 0x27, 0x5C, 
+    0x23, 0xA2, 0x1B, 0x4A, 0x22, 0x02, 0x2B, 0xFE, 0x02, 0xEE, 0x2B, 0xB4, 0x2E, 0x68, 0x11, 
+    0xC4, 0x35, 0x1B, 0x77, 0x22, 0x4F, 0x24, 0xDB, 0x12, 0xFF, 0xE6, 0x1E, 0x57, 0x36, 0x0F, 
+    0x23, 0xB7, 0x31, 0xC1, 0x05, 0x65, 0x3D, 0x14, 0x10, 0x6D, 0x33, 0x7F, 0x98, 0x26, 0x6E, 
+    0x2F, 0x49, 0x00, 0xDB, 0x00, 0x27, 0x21, 0x3B, 0x14, 0x3D, 0x00, 0x02, 0xE2, 0x9C, 0x07, 
+    0x0E, 0x1C, 0x1B, 0x02, 0x38, 0x21, 0x4F, 0x10, 0xB8, 0x81, 0xFF, 0x42, 0x21, 0x1F, 0xFD, 
+    0x01, 0x3C, 0x10, 0x69, 0x10, 0x2E, 0x18, 0xA3, 0x03, 0xB0, 0x14, 0x9C, 0x17, 0x9F, 0x2C, 
+    0x32, 0x35, 0x01, 0x9F, 0x1F, 0xC4, 0x35, 0x55, 0x10, 0xF5, 0x1B, 0xD9, 0x1D, 0xA7, 0xA6, 
+    0x11, 0x5B, 0x06, 0x67, 0x05, 0x1E, 0x1B, 0x68, 0x10, 0x2E, 0x38, 0x24, 0x6F, 0x00, 0x13, 
+    0x94, 0x16, 0x1E, 0x2C, 0x80, 0x29, 0x1B, 0x30, 0x14, 0x74, 0x00, 0x2B, 0xF4, 0x02, 0x01, 
+    0x9A, 0x01, 0x1C, 0xFC, 0x16, 0x64, 0x4E, 0x21, 0x3B, 0x99, 0x32, 0xFF, 0x1F, 0x15, 0x99, 
+    0x3C, 0xDF, 0x1A, 0x3C, 0x21, 0x96, 0x11, 0x7B, 0x00, 0xBF, 0x01, 0x6D, 0x03, 0xDF, 0x99, 
+    0x3C, 0x1F, 0x3D, 0x20, 0x11, 0xD1, 0x13, 0xFF, 0x20, 0x5C, 0x67, 0x25, 0x19, 0x22, 0x21, 
+    0xAE, 0x11, 0x1E, 0x2E, 0x02, 0x9B, 0x00, 0x01, 0xF5, 0x1C, 0xFA, 0x2B, 0x5D, 0x26, 0x2E, 
+    0xFC, 0x01, 0x34, 0x28, 0x96, 0x12, 0xAD, 0x31, 0x1F, 0xFD, 0x02, 0xFF, 0xA6, 0x22, 0xCC, 
+    0x00, 0x7C, 0x00, 0x97, 0x14, 0xCC, 0x20, 0x96, 0x26, 0x83, 0x12, 0xF9, 0x02, 0x7F, 0x2E, 
+    0x2E, 0xF1, 0x10, 0x3F, 0x3A, 0xFD, 0x01, 0xBC, 0x1A, 0x9E, 0x01, 0xA3, 0x14, 0x1B, 0xFF, 
+    0xE6, 0x12, 0xB5, 0x11, 0x03, 0x13, 0x42, 0x2B, 0x3B, 0x13, 0xA0, 0x13, 0x98, 0x35, 0x0A, 
+    0x16, 0xFF, 0x2A, 0x00, 0xFC, 0x14, 0xA8, 0x2D, 0xBF, 0x2D, 0xCD, 0x11, 0xDE, 0x3A, 0x78, 
+    0x0A, 0x8C, 0x2A, 0xFF, 0x4C, 0x10, 0x3F, 0x20, 0x33, 0x10, 0xA4, 0x2B, 0x99, 0x09, 0x1F, 
+    0x10, 0x0B, 0x0E, 0x05, 0x2E, 0xDF, 0x4C, 0x17, 0xEB, 0x15, 0x5F, 0x10, 0x17, 0x18, 0xD2, 
+    0x00, 0x02, 0x56, 0x29, 0x13, 0x27, 0xEF, 0xCC, 0x25, 0x62, 0x1C, 0x0E, 0x1E, 0x00, 0x01, 
+    0x1B, 0x7C, 0x2D, 0x3F, 0x11, 0xF9, 0x3F, 0xFE, 0x1D, 0xB1, 0x04, 0xEA, 0x38, 0x3B, 0x20, 
+    0x53, 0x2E, 0x64, 0x1F, 0x35, 0x02, 0xAA, 0x1B, 0x1D, 0xCC, 0x30, 0x2E, 0xCC, 0x40, 0x7D, 
+    0x11, 0x32, 0x46, 0x01, 0x1C, 0x9C, 0xFF, 0xF1, 0x19, 0x52, 0x2C, 0x11, 0x11, 0xF8, 0x2D, 
+    0xD3, 0x09, 0x5D, 0x22, 0x87, 0x26, 0x35, 0x13, 0xFF, 0x2F, 0x10, 0x44, 0x12, 0x19, 0x0B, 
+    0x25, 0x13, 0xDA, 0x15, 0x32, 0x10, 0x46, 0x22, 0xB3, 0x10, 0xF3, 0xFE, 0x00, 0x78, 0x0E, 
+    0x2B, 0x1D, 0xFF, 0x00, 0x76, 0x22, 0x2F, 0x20, 0x4B, 0x20, 0xF8, 0x1C, 0x2E, 0x5C, 0x31, 
+    0x17, 0x92, 0x04, 0x72, 0x11, 0xCC, 0x45, 0x69, 0x2E, 0xFF, 0x6C, 0x15, 0x65, 0x2D, 0xA2, 
+    0x17, 0xAB, 0x10, 0xC1, 0x21, 0xEB, 0x17, 0xD1, 0x30, 0xD2, 0x11, 0xBE, 0x5C, 0xC7, 0x33, 
+    0x4C, 0x00, 0xCC, 0x25, 0x1D, 0x00, 0x5C, 0x07, 0x5C, 0x65, 0x05, 0x8F, 0x65, 0x0B, 0xA9, 
+    0x3D, 0x69, 0x23, 0xD1, 0x10, 0xF6, 0x02, 0xF6, 0xBC, 0x23, 0xDF, 0x1F, 0xFD, 0x01, 0xCC, 
+    0x60, 0x51, 0x35, 0x53, 0x58, 0x8F, 0x21, 0x1D, 0xFF, 0x05, 0x28, 0x02, 0x77, 0xE3, 0x25, 
+    0x6B, 0x2A, 0x1A, 0x00, 0x1B, 0x10, 0x00, 0x37, 0x33, 0x22, 0x33, 0x2E, 0xFE, 0xF6, 0x99, 
+    0x20, 0x9E, 0x13, 0xA7, 0x20, 0x08, 0x2A, 0x32, 0x00, 0xAA, 0x00, 0x3C, 0x13, 0x01, 0x06, 
+    0x00, 0x1E, 0x1F, 0x2B, 0x1F, 0x01, 0xF6, 0xF5, 0xFE, 0x1E, 0xFB, 0x19, 0xED, 0x1E, 0xB5, 
+    0x27, 0xED, 0x22, 0x01, 0x11, 0x1C, 0x06, 0x0D, 0x01, 0xFF, 0x32, 0x3D, 0xE8, 0x18, 0x31, 
+    0x25, 0x53, 0x2A, 0x41, 0x31, 0x81, 0x0D, 0xB9, 0x24, 0xD7, 0x28, 0x3F, 0x5F, 0x30, 0x16, 
+    0x3C, 0xF5, 0x32, 0x7E, 0x2C, 0xCF, 0x17, 0xBD, 0x1B, 0x1D, 0x8E, 0xEF, 0x66, 0x09, 0x37, 
+    0x07, 0x07, 0x1C, 0x1B, 0x15, 0x5C, 0xF4, 0x46, 0xEF, 0x2D, 0x46, 0x25, 0xDF, 0xCC, 0x00, 
+    0x1F, 0xCD, 0x2A, 0x01, 0x3D, 0x0E, 0xCC, 0x40, 0xF6, 0xCC, 0x00, 0x85, 0x14, 0xF3, 0x7C, 
+    0x10, 0x6C, 0x10, 0x1C, 0x1A, 0x03, 0x0F, 0x75, 0x1A, 0xC7, 0x10, 0x71, 0x30, 0xF9, 0x15, 
+    0x09, 0xF6, 0xF6, 0xA7, 0x10, 0xDB, 0x21, 0xA1, 0x14, 0x2B, 0x35, 0x51, 0x3F, 0x6F, 0xDD, 
+    0x14, 0xB0, 0x00, 0x32, 0x00, 0x02, 0x2A, 0x2E, 0xFA, 0x0C, 0x0B, 0x06, 0x2B, 0xF0, 0x01, 
+    0xF5, 0xF5, 0x02, 0xA4, 0x1B, 0x60, 0x36, 0xFF, 0x20, 0x04, 0x24, 0xEF, 0x40, 0x21, 0x25, 
+    0x2B, 0x99, 0x3C, 0x34, 0x4F, 0xF5, 0x7A, 0x15, 0x1E, 0x34, 0xC3, 0x22, 0xFF, 0xFF, 0x18, 
+    0xFC, 0x14, 0xA3, 0x07, 0xF3, 0x2D, 0x8E, 0x14, 0x3B, 0x20, 0xD4, 0x24, 0xFF, 0x10, 0x77, 
+    0xCC, 0x06, 0x0F, 0x10, 0x56, 0x0C, 0x9C, 0x2A, 0x0B, 0x6D, 0x00, 0x35, 0x00, 0x5C, 0x7F, 
+    0x56, 0x3E, 0x51, 0x21, 0x0E, 0x11, 0x62, 0x16, 0x1F, 0x4D, 0xEF, 0x00, 0x1F, 0x5D, 0xF6, 
+    0xFF, 0x74, 0x11, 0x44, 0x39, 0x00, 0x00, 0xCC, 0x40, 0x32, 0x47, 0x9F, 0x30, 0xFB, 0x10, 
+    0x95, 0x17, 0xFD, 0x25, 0x00, 0x1B, 0x4B, 0x20, 0x9B, 0x30, 0x15, 0x10, 0x9E, 0x05, 0x93, 
+    0x3E, 0x66, 0x45, 0x5F, 0x90, 0x30, 0x32, 0x20, 0x6E, 0x10, 0xE5, 0x12, 0x97, 0x00, 0x2B, 
+    0xD7, 0x1A, 0x9D, 0xF1, 0xFE, 0x13, 0x1F, 0x1C, 0x1B, 0x7E, 0x00, 0x9C, 0x14, 0x7D, 0x10, 
+    0x83, 0x12, 0xFF, 0xCF, 0x19, 0xDB, 0x10, 0xF1, 0x23, 0x16, 0x26, 0x96, 0x15, 0x9E, 0x11, 
+    0x12, 0x24, 0x68, 0x26, 0xFF, 0xE8, 0x4A, 0xE5, 0x13, 0xBB, 0x02, 0x87, 0x15, 0x04, 0x12, 
+    0x81, 0x3A, 0xFD, 0x10, 0x15, 0x11, 0x26, 0x2E, 0x0A, 0x06, 0xA8, 0x10, 0x1B, 0x02, 0xFF, 
+    0x03, 0xF5, 0x02, 0xFF, 0x59, 0x1C, 0x68, 0x22, 0x60, 0x00, 0x53, 0x25, 0xA4, 0x40, 0x99, 
+    0x00, 0x2B, 0x19, 0x66, 0x11, 0xDF, 0xBC, 0x07, 0xCC, 0x20, 0x76, 0x18, 0xAD, 0x12, 0xFE, 
+    0x04, 0x1E, 0xCB, 0x12, 0x91, 0x3A, 0x1F, 0x32, 0x46, 0xA8, 0x25, 0xAC, 0x25, 0x45, 0x14, 
+    0xF1, 0x10, 0x1D, 0x1E, 0xF6, 0xFD, 0xD7, 0x27, 0x1D, 0x2E, 0x07, 0x26, 0x35, 0xBC, 0x3A, 
+    0x40, 0x13, 0x61, 0x24, 0x32, 0x40, 0xB1, 0x7D, 0x44, 0x1B, 0x1E, 0x2E, 0xF7, 0x07, 0x4A, 
+    0x00, 0x2B, 0x9B, 0x04, 0xFD, 0x6B, 0x00, 0x1B, 0x9D, 0x03, 0xE7, 0x26, 0xE2, 0x01, 0x3F, 
+    0x1E, 0xED, 0x26, 0xFF, 0x11, 0xFF, 0x10, 0x46, 0x40, 0x41, 0xF1, 0x14, 0xB0, 0x28, 0x4C, 
+    0x20, 0x20, 0x00, 0xAB, 0x3B, 0xF7, 0x10, 0xFF, 0xB1, 0x01, 0x54, 0x37, 0x0A, 0x02, 0x88, 
+    0x18, 0xCE, 0x2B, 0x8C, 0x00, 0xFF, 0x00, 0x84, 0x18, 0xF5, 0x6A, 0x08, 0xF5, 0x04, 0x07, 
+    0x02, 0x26, 0x2F, 0xCD, 0x24, 0x03, 0x10, 0x6D, 0x18, 0x9F, 0x0F, 0x21, 0x9F, 0x08, 0xCC, 
+    0x40, 0x1F, 0x4D, 0x44, 0x13, 0x01, 0xF6, 0xCC, 0x80, 0xFF, 0xF2, 0x26, 0x2B, 0x12, 0x8C, 
+    0x10, 0xA0, 0x1D, 0x8F, 0x11, 0x5D, 0x14, 0x39, 0x26, 0xAB, 0x16, 0xF7, 0xD7, 0x2F, 0xC4, 
+    0x22, 0x03, 0x10, 0x1E, 0x1C, 0x20, 0xBD, 0x09, 0x8D, 0x28, 0x0C, 0x10, 0x83, 0x40, 0x32, 
+    0x7D, 0x29, 0x1E, 0x1C, 0x2E, 0x2B, 0xF6, 0xA2, 0x1E, 0xFC, 0x02, 0x02, 0xFC, 0x36, 0x6D, 
+    0x3F, 0x12, 0x19, 0x2B, 0x13, 0xDB, 0x2F, 0x26, 0x28, 0xFF, 0xF1, 0x23, 0x56, 0x10, 0x7B, 
+    0x14, 0x02, 0x20, 0x1E, 0x1E, 0x76, 0x12, 0x2A, 0x23, 0x77, 0x4F, 0xFF, 0x23, 0x30, 0x7F, 
+    0x40, 0x05, 0x29, 0xE1, 0x24, 0x88, 0x00, 0x4F, 0x2F, 0x65, 0x2F, 0x30, 0x04, 0xFE, 0xF5, 
+    0x33, 0x14, 0x7B, 0x00, 0x4B, 0x12, 0x2A, 0x13, 0x56, 0x15, 0x62, 0x05, 0xF5, 0x2C, 0x6F, 
+    0xCC, 0x20, 0x1F, 0xBD, 0xCC, 0x30, 0x5F, 0x1D, 0x1C, 0xCC, 0x00, 0x7B, 0x00, 0xF6, 0x7B, 
+    0xDC, 0x30, 0x02, 0x00, 0x1A, 0xED, 0x16, 0xF1, 0x19, 0xCF, 0x15, 0x00, 0x21, 0xF5, 0xFF, 
+    0x92, 0x07, 0x2D, 0x15, 0xF6, 0x22, 0xFE, 0x13, 0xDE, 0x00, 0xFB, 0x2C, 0x9D, 0x16, 0x9F, 
+    0x25, 0x07, 0x32, 0x30, 0x0B, 0x2A, 0x5F, 0x12, 0x2B, 0x01, 0x02, 0x02, 0x01, 0xF8, 0xF6, 
+    0x9C, 0xF5, 0xFE, 0x12, 0x48, 0x00, 0xD2, 0x2C, 0xA7, 0x01, 0x0A, 0x15, 0xFF, 0x27, 0x37, 
+    0x0C, 0x00, 0xB4, 0x00, 0x76, 0x22, 0x18, 0x27, 0x10, 0x22, 0xF5, 0x2B, 0xF3, 0x11, 0xFB, 
+    0xF1, 0x11, 0x6F, 0x15, 0xF5, 0x12, 0x26, 0x88, 0x25, 0xAF, 0x03, 0x73, 0x12, 0x05, 0x44, 
+    0xFF, 0x40, 0x16, 0xCC, 0x66, 0x07, 0x00, 0x01, 0x08, 0xFF, 0x01, 0xFE, 0x01, 0xCC, 0x36, 
+    0x49, 0x29, 0xFF, 0x8F, 0x15, 0x53, 0x23, 0xCC, 0x40, 0x1F, 0x9D, 0xB9, 0x12, 0xCB, 0x6A, 
+    0xAB, 0x11, 0xE5, 0x11, 0x7B, 0x53, 0x1E, 0xCC, 0x10, 0x19, 0xD3, 0x00, 0xB2, 0x28, 0x20, 
+    0x3F, 0x3E, 0x1B, 0x1E, 0xFF, 0xE0, 0x1D, 0x41, 0x00, 0x2B, 0x00, 0x30, 0x00, 0x65, 0x02, 
+    0xF1, 0x07, 0x00, 0x3A, 0x91, 0x23, 0xFD, 0x07, 0x00, 0xF5, 0xBA, 0x02, 0xB2, 0x19, 0xA4, 
+    0x10, 0xFD, 0x13, 0xFD, 0x07, 0x05, 0x00, 0xFF, 0xFE, 0x10, 0xFC, 0x22, 0xC5, 0x11, 0xC9, 
+    0x04, 0x20, 0x11, 0xDB, 0x11, 0xD7, 0x30, 0x0E, 0x3D, 0xEF, 0x95, 0x36, 0x43, 0x10, 0x05, 
+    0x24, 0xDE, 0x21, 0x02, 0x3E, 0x03, 0x63, 0x38, 0x1D, 0x11, 0xFF, 0xC0, 0x18, 0x2D, 0x20, 
+    0x26, 0x00, 0xC3, 0x12, 0x89, 0x1B, 0x8F, 0x21, 0x8F, 0x03, 0x0A, 0x00, 0xF3, 0xCC, 0x00, 
+    0xFF, 0x02, 0x2E, 0x1F, 0x95, 0x0A, 0x86, 0x3C, 0xB8, 0x3A, 0xE5, 0x02, 0xFF, 0x29, 0x10, 
+    0xCC, 0x20, 0x57, 0x11, 0x74, 0x22, 0xCC, 0x40, 0xA6, 0x22, 0xCB, 0x59, 0xCC, 0x00, 0xFF, 
+    0xC6, 0x28, 0x36, 0x21, 0xA6, 0x00, 0x6D, 0x04, 0xE0, 0x3C, 0xFD, 0x13, 0x96, 0x21, 0xBC, 
+    0x0E, 0xFF, 0xF7, 0x21, 0x7D, 0x21, 0x0A, 0x00, 0x00, 0x35, 0xAD, 0x21, 0x45, 0x24, 0xB0, 
+    0x1D, 0xFD, 0x10, 0x0F, 0xC2, 0x0D, 0x57, 0x11, 0xFB, 0x09, 0xCA, 0x18, 0xF5, 0x9D, 0x2E, 
+    0x8E, 0xB0, 0x8E, 0x1B, 0x02, 0x01, 0x61, 0x04, 0xFE, 0x21, 0x5C, 0x29, 0x20, 0xFF, 0xAD, 
+    0x00, 0xE1, 0x27, 0xDF, 0x36, 0x8D, 0x07, 0x3B, 0x2B, 0xE4, 0x16, 0x65, 0x2D, 0x99, 0x3C, 
+    0xFF, 0x92, 0x29, 0xFD, 0x20, 0x11, 0x11, 0xB2, 0x09, 0x7C, 0x35, 0xD3, 0x01, 0xD9, 0x11, 
+    0x14, 0x00, 0x52, 0x5C, 0x00, 0x22, 0x2E, 0xF6, 0xCC, 0x05, 0x1B, 0x62, 0x03, 0x9D, 0xFE, 
+    0xF5, 0x40, 0x00, 0x7F, 0x2C, 0x9A, 0x00, 0xE5, 0x22, 0x25, 0x38, 0x60, 0x1B, 0xFC, 0x10, 
+    0xFF, 0x15, 0x1A, 0x21, 0x03, 0x1F, 0x5D, 0x57, 0x29, 0xBB, 0x2F, 0x57, 0x20, 0x50, 0x29, 
+    0x17, 0x10, 0x79, 0xCC, 0x20, 0x2E, 0x1A, 0x17, 0x02, 0xB4, 0x01, 0x0F, 0x25, 0xE8, 0x20, 
+    0x1E, 0xFF, 0x32, 0x02, 0xA4, 0x25, 0x84, 0x25, 0x31, 0x09, 0xA8, 0x27, 0xD0, 0x15, 0x31, 
+    0x24, 0x9F, 0x23, 0xF7, 0x03, 0x10, 0x25, 0x13, 0xCE, 0x10, 0xF6, 0xFF, 0x00, 0xDE, 0x08, 
+    0x56, 0x01, 0xF9, 0x0C, 0xFF, 0x23, 0x22, 0xD6, 0x1F, 0xF6, 0x13, 0x1E, 0x00, 0x96, 0x1E, 
+    0xF9, 0x39, 0xB9, 0x14, 0x95, 0x28, 0xFF, 0x99, 0x3C, 0x4D, 0x10, 0x22, 0x10, 0xDF, 0x00, 
+    0x41, 0x04, 0x7F, 0x00, 0xA9, 0x04, 0x99, 0x14, 0x9F, 0x2E, 0x23, 0xA2, 0x30, 0x83, 0x02, 
+    0x92, 0x32, 0x4E, 0x16, 0x1C, 0x1F, 0x1E, 0x00, 0x87, 0x33, 0x22, 0x6E, 0x05, 0xFE, 0x00, 
+    0xF6, 0x01, 0xF5, 0x9D, 0xD1, 0x01, 0xF7, 0xC4, 0x11, 0xBF, 0x2A, 0xD3, 0x2D, 0x01, 0xE2, 
+    0x0A, 0xCC, 0x00, 0xBD, 0x41, 0x1F, 0x7D, 0xFF, 0x18, 0x29, 0xCB, 0x4A, 0x60, 0x23, 0x5E, 
+    0x2E, 0xCC, 0x20, 0x0C, 0x15, 0x0E, 0x25, 0x72, 0x32, 0xEF, 0x7D, 0x12, 0xB8, 0x10, 0xC1, 
+    0x32, 0xAC, 0x22, 0x1B, 0x9B, 0x00, 0xB0, 0x13, 0x67, 0x10, 0x6F, 0xBE, 0x3A, 0xD6, 0x2A, 
+    0x41, 0x15, 0xD5, 0x10, 0xF6, 0x92, 0x0D, 0xFF, 0x00, 0x01, 0xFC, 0xF5, 0x02, 0x13, 0x1A, 
+    0xDD, 0x21, 0x3F, 0x31, 0xD7, 0x04, 0xDF, 0x21, 0x87, 0x37, 0xE7, 0x08, 0x37, 0xFF, 0x24, 
+    0xCC, 0x10, 0x2E, 0x1F, 0xCC, 0x05, 0xED, 0x27, 0x65, 0x2D, 0xFE, 0x01, 0x65, 0x1D, 0x5B, 
+    0x04, 0x78, 0x1E, 0x21, 0x26, 0x28, 0x20, 0x17, 0x34, 0xFC, 0x19, 0x17, 0x39, 0x13, 0xA2, 
+    0x11, 0xDD, 0x34, 0x2B, 0xCB, 0x10, 0x1F, 0x1B, 0x9D, 0xFE, 0x1D, 0xCC, 0x06, 0xF8, 0x10, 
+    0x5E, 0x18, 0x6B, 0x37, 0x47, 0x1F, 0x4B, 0x18, 0x70, 0x36, 0xFF, 0x1F, 0x6D, 0x54, 0x15, 
+    0xCB, 0x5A, 0x2E, 0x2A, 0xE5, 0x16, 0xCC, 0x30, 0xC5, 0x36, 0x61, 0x33, 0xFF, 0x73, 0x11, 
+    0xDB, 0x21, 0x4C, 0x0B, 0x0B, 0x13, 0xFF, 0x45, 0xCC, 0x2F, 0x63, 0x47, 0x13, 0x01, 0x3B, 
+    0xA9, 0x3A, 0x32, 0x00, 0x02, 0x98, 0x11, 0xBC, 0x01, 0xB7, 0x04, 0xF6, 0x01, 0xE2, 0x8E, 
+    0x9A, 0x0A, 0x8E, 0x01, 0x02, 0xFC, 0x24, 0xC7, 0x16, 0x8C, 0x13, 0xFF, 0x93, 0x26, 0x9C, 
+    0x12, 0xBC, 0x29, 0x87, 0x17, 0xED, 0x17, 0x92, 0x10, 0xCC, 0x35, 0x74, 0x00, 0xFF, 0x8D, 
+    0x19, 0xEF, 0x23, 0x66, 0x03, 0x8A, 0x00, 0x42, 0x21, 0x29, 0x0D, 0x66, 0x10, 0xD2, 0x15, 
+    0x7F, 0xC5, 0x10, 0x6F, 0x2E, 0x7D, 0x12, 0x64, 0x16, 0xD3, 0x2E, 0x6B, 0x0D, 0x88, 0x0B, 
+    0x1B, 0xEE, 0x2B, 0x33, 0x00, 0x92, 0x17, 0x32, 0x03, 0xF6, 0xE8, 0x27, 0x54, 0x10, 0x99, 
+    0x10, 0xFF, 0x90, 0x08, 0x9A, 0x15, 0x61, 0x29, 0x97, 0x0B, 0x9A, 0x02, 0x12, 0x32, 0xCB, 
+    0x39, 0x8F, 0x25, 0xFF, 0x9B, 0x10, 0x78, 0x21, 0xB7, 0x08, 0xD7, 0x36, 0xCC, 0x10, 0x92, 
+    0x3D, 0xB6, 0x16, 0xC3, 0x40, 0xF5, 0xFC, 0x08, 0x1C, 0x04, 0x05, 0x1E, 0xC8, 0x2F, 0x26, 
+    0x1A, 0x53, 0x17, 0xE1, 0x2A, 0xC3, 0x32, 0x20, 0x7B, 0x06, 0x1F, 0x1E, 0x1E, 0x2B, 0x5A, 
+    0x1D, 0xF8, 0x1F, 0xFE, 0x8E, 0xD0, 0x00, 0x0D, 0x08, 0x7A, 0x12, 0x06, 0x12, 0xFF, 0x3C, 
+    0x12, 0x13, 0x51, 0x11, 0xDF, 0x0A, 0x36, 0x32, 0x10, 0x99, 0xAC, 0xE1, 0x13, 0x2F, 0x00, 
+    0xF6, 0x5C, 0x12, 0x65, 0x3D, 0xDF, 0xCD, 0x36, 0xD5, 0x10, 0x8B, 0x2D, 0xCC, 0x45, 0x55, 
+    0x10, 0x1B, 0xCC, 0x45, 0x6A, 0x0F, 0xE0, 0x01, 0xF5, 0x1D, 0x1B, 0x03, 0x31, 0x13, 0xA9, 
+    0x1F, 0x82, 0x03, 0xFF, 0x17, 0x00, 0x9F, 0x07, 0x56, 0x3E, 0xC6, 0x10, 0x77, 0x11, 0x1F, 
+    0x5D, 0x83, 0x31, 0xCC, 0x40, 0xEF, 0x33, 0x01, 0xEC, 0x22, 0xF3, 0x2A, 0xCC, 0x10, 0x19, 
+    0x89, 0x02, 0xC4, 0x08, 0xA9, 0x10, 0x1F, 0x14, 0x26, 0x7D, 0x24, 0x4C, 0x26, 0xDB, 0x26, 
+    0x34, 0x00, 0xF6, 0xF6, 0xF6, 0xDD, 0x1A, 0x10, 0x1F, 0x3A, 0x01, 0xAB, 0x00, 0x55, 0x12, 
+    0x1F, 0xE1, 0x12, 0x49, 0x0C, 0xE7, 0x68, 0x18, 0x8E, 0x08, 0x5B, 0x1D, 0x01, 0x9D, 0x01, 
+    0x01, 0xB4, 0x11, 0x16, 0x00, 0xFF, 0xD4, 0x10, 0x85, 0x1A, 0x78, 0x23, 0x81, 0x17, 0xEB, 
+    0x17, 0x88, 0x10, 0x26, 0x00, 0x32, 0x10, 0xFF, 0x3C, 0x1A, 0xC1, 0x02, 0xFF, 0x19, 0x1F, 
+    0x21, 0x66, 0x53, 0xE2, 0x2C, 0x1B, 0x10, 0xCC, 0x16, 0xDF, 0x1B, 0x2C, 0x3B, 0x26, 0x27, 
+    0x01, 0x50, 0x10, 0x75, 0x00, 0x1B, 0x11, 0x30, 0xFF, 0x11, 0xE9, 0x03, 0x0C, 0x03, 0x5C, 
+    0x39, 0x29, 0x1C, 0xDF, 0x0A, 0x1A, 0x22, 0x68, 0x13, 0xFF, 0x3E, 0x13, 0x46, 0x23, 0xDE, 
+    0x42, 0xEB, 0x40, 0x7E, 0x23, 0xCB, 0x3A, 0xCC, 0x00, 0x5A, 0x10, 0xFF, 0xCE, 0x13, 0x92, 
+    0x20, 0x2C, 0x29, 0x0E, 0x15, 0xE9, 0x24, 0x13, 0x1E, 0xC1, 0x12, 0x0C, 0x28, 0xDF, 0xA3, 
+    0x00, 0x2E, 0x0C, 0x32, 0x00, 0xEA, 0x1B, 0x78, 0x10, 0x1D, 0xC0, 0x05, 0x62, 0x1B, 0xE7, 
+    0x6A, 0x20, 0x5D, 0x15, 0x72, 0x12, 0x1D, 0x9C, 0xBC, 0x2F, 0x02, 0x0C, 0xFF, 0x02, 0xFE, 
+    0x1C, 0x3C, 0x15, 0x78, 0x26, 0xF6, 0x21, 0x8E, 0x1C, 0xE0, 0x03, 0xF6, 0x02, 0x0A, 0x37, 
+    0xFF, 0xCC, 0x36, 0x80, 0x12, 0xCF, 0x09, 0xE6, 0x12, 0x26, 0x00, 0x0A, 0x1C, 0x99, 0x3C, 
+    0xBB, 0x12, 0xBF, 0x89, 0x3A, 0x86, 0x16, 0x8F, 0x06, 0xCC, 0x46, 0xDC, 0x24, 0x24, 0x00, 
+    0x1B, 0x5C, 0x02, 0xF7, 0xA0, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xF5, 0x6F, 0x0E, 0x2B, 0x10, 
+    0x48, 0x25, 0xB4, 0x08, 0xFF, 0xBA, 0x0A, 0xC4, 0x37, 0xF5, 0x25, 0x1B, 0x08, 0x1F, 0x2D, 
+    0x53, 0x18, 0xCC, 0x20, 0x78, 0x00, 0x1E, 0xF6, 0x65, 0x12, 0xCC, 0x10, 0x8C, 0x25, 0xA2, 
+    0x3A, 0x1C, 0x01, 0x1A, 0xBF, 0x75, 0x26, 0xC7, 0x2D, 0x4D, 0x24, 0x45, 0x14, 0x2C, 0x3C, 
+    0x26, 0x3F, 0x1E, 0x9E, 0x15, 0xF7, 0xBE, 0x10, 0xBF, 0x22, 0x4F, 0x11, 0xF5, 0x51, 0x2A, 
+    0xBE, 0x13, 0xFF, 0x2E, 0x33, 0x04, 0xEB, 0x98, 0x1F, 0x48, 0x07, 0x1E, 0xE7, 0x01, 0x1B, 
+    0x69, 0x07, 0xF7, 0x21, 0x43, 0x20, 0x7E, 0x1B, 0x25, 0x16, 0x4B, 0x10, 0x5C, 0x0F, 0x9F, 
+    0x15, 0x39, 0x25, 0x96, 0x00, 0x1F, 0xEF, 0x36, 0x17, 0x14, 0x14, 0xAC, 0x21, 0x63, 0x00, 
+    0x1E, 0x66, 0x03, 0xF7, 0x1F, 0x20, 0x01, 0x7B, 0x8E, 0x12, 0x7F, 0x50, 0x1B, 0xCB, 0x26, 
+    0x7B, 0x2D, 0xCC, 0x45, 0x44, 0x15, 0x03, 0xFB, 0x00, 0x05, 0x6E, 0x0F, 0x02, 0xEF, 0x23, 
+    0xFF, 0x27, 0xEF, 0x06, 0xD8, 0x1B, 0x71, 0x11, 0xFD, 0xC9, 0x23, 0x1F, 0xD0, 0x12, 0x44, 
+    0x2F, 0xD7, 0x40, 0xE7, 0x3C, 0x68, 0x00, 0x99, 0x21, 0x73, 0xCC, 0x40, 0xD3, 0x21, 0x9D, 
+    0x1D, 0x57, 0x12, 0x6A, 0x00, 0x29, 0x00, 0x1E, 0xFF, 0xA7, 0x23, 0xBC, 0x6D, 0x13, 0x00, 
+    0x3E, 0x0F, 0x99, 0x01, 0x32, 0x03, 0x8F, 0x11, 0xD8, 0x13, 0x8F, 0x5F, 0x3C, 0xE5, 0x2C, 
+    0x18, 0x09, 0x60, 0x23, 0x9D, 0x01, 0x1F, 0x82, 0x02, 0xFE, 0x1F, 0x95, 0x06, 0xEB, 0x25, 
+    0x1D, 0x00, 0xBD, 0x3B, 0xC4, 0x15, 0xBD, 0x17, 0xCD, 0x25, 0xFF, 0x02, 0x36, 0x8C, 0x00, 
+    0x32, 0x00, 0x1A, 0x00, 0xA5, 0x06, 0x64, 0x10, 0x3F, 0x21, 0xC2, 0x26, 0xFF, 0x66, 0x03, 
+    0x7E, 0x31, 0x99, 0x4C, 0x01, 0x26, 0x47, 0x10, 0xBD, 0x37, 0xF9, 0x39, 0xAE, 0x3D, 0xE2, 
+    0x1C, 0xFF, 0x10, 0xF5, 0x9D, 0x03, 0x62, 0x11, 0x97, 0x22, 0xFF, 0x11, 0xF7, 0xD6, 0x10, 
+    0x7E, 0x26, 0xCC, 0x00, 0x1B, 0xE9, 0x39, 0x1F, 0x6D, 0xAF, 0x11, 0xCC, 0x10, 0x1F, 0x41, 
+    0x01, 0xCC, 0xE0, 0x20, 0x24, 0xBF, 0x11, 0x1B, 0x16, 0x02, 0xF6, 0x1E, 0xF3, 0x37, 0x1E, 
+    0xF1, 0x01, 0x1B, 0xF6, 0x4B, 0x34, 0x0A, 0x00, 0x0E, 0x00, 0x6B, 0x09, 0x1F, 0x25, 0x43, 
+    0x49, 0x22, 0x3C, 0x0B, 0x92, 0x2C, 0x79, 0x20, 0x1A, 0x01, 0x9D, 0xFB, 0x66, 0x00, 0xB1, 
+    0x0C, 0x02, 0xFF, 0x02, 0x62, 0x3C, 0xE4, 0x14, 0xCC, 0x3C, 0xE4, 0x18, 0xFF, 0xF8, 0x10, 
+    0x93, 0x37, 0xBA, 0x0B, 0x94, 0x23, 0x94, 0x02, 0x8C, 0x23, 0x30, 0x11, 0x95, 0x17, 0xFF, 
+    0x95, 0x2C, 0xF4, 0x27, 0x52, 0x06, 0x98, 0x11, 0x6B, 0x23, 0x3B, 0x40, 0x99, 0x29, 0x33, 
+    0x02, 0x23, 0xA9, 0x0C, 0x18, 0x35, 0x1F, 0x01, 0x03, 0xFF, 0x15, 0x2B, 0x9D, 0xF8, 0x8E, 
+    0x1D, 0x1A, 0xA7, 0x21, 0xEA, 0x23, 0x2C, 0x40, 0x3E, 0x1A, 0xCC, 0x20, 0xFD, 0x72, 0x02, 
+    0xF6, 0x0C, 0x0A, 0xA0, 0x19, 0x9D, 0x00, 0xFA, 0x38, 0x66, 0x26, 0xCC, 0x40, 0xFB, 0x04, 
+    0x13, 0x65, 0x22, 0x9D, 0xD8, 0x10, 0x65, 0x12, 0x67, 0x10, 0xF2, 0x1D, 0x52, 0x2B, 0xFF, 
+    0x21, 0x14, 0x79, 0x10, 0xBC, 0x13, 0xAE, 0x13, 0x09, 0x27, 0xA0, 0x23, 0x81, 0x27, 0x3E, 
+    0x00, 0x17, 0xD8, 0x02, 0x44, 0x12, 0x66, 0x01, 0x2B, 0xF5, 0x0D, 0x01, 0x8E, 0x1F, 0x78, 
+    0x02, 0x1D, 0x8E, 0x1F, 0x15, 0x85, 0x13, 0xA5, 0x03, 0x19, 0x19, 0x2E, 0xFE, 0x02, 0x49, 
+    0x43, 0x0B, 0x10, 0x9F, 0x46, 0x07, 0x34, 0x1D, 0x11, 0xF9, 0x04, 0x98, 0x01, 0xF7, 0x52, 
+    0x11, 0x5F, 0x40, 0x3E, 0x13, 0x01, 0x9D, 0x14, 0x22, 0x14, 0x23, 0x20, 0x28, 0x16, 0x1F, 
+    0xF5, 0x1F, 0x4D, 0x00, 0x1B, 0x07, 0x3C, 0x10, 0x09, 0x2A, 0x03, 0x02, 0x8E, 0xF9, 0xFF, 
+    0x00, 0x1C, 0x8E, 0x91, 0x15, 0x4D, 0x20, 0x99, 0x49, 0xC5, 0x17, 0x20, 0x01, 0xFF, 0xCC, 
+    0x20, 0xD1, 0x2F, 0xBC, 0x10, 0x59, 0x27, 0x23, 0x3D, 0x03, 0x0C, 0xF1, 0x15, 0x6C, 0x20, 
+    0xD3, 0x32, 0x07, 0x4E, 0x28, 0x1C, 0x18, 0xA1, 0x20, 0x02, 0xE4, 0x08, 0x3A, 0x35, 0x75, 
+    0xD4, 0x00, 0x1B, 0x27, 0x05, 0x1D, 0x06, 0x15, 0x3B, 0x0B, 0xB7, 0x00, 0x1E, 0xBE, 0x2E, 
+    0x49, 0x11, 0x37, 0x0C, 0x01, 0x00, 0xCD, 0x22, 0x3B, 0x3D, 0x02, 0x7C, 0x00, 0x8D, 0xF5, 
+    0x03, 0x2E, 0xF9, 0x15, 0xB7, 0x15, 0x02, 0xF5, 0x8E, 0xA4, 0x01, 0xFF, 0xB7, 0x27, 0xB0, 
+    0x11, 0x05, 0x23, 0x3B, 0x1C, 0x29, 0x03, 0x93, 0x17, 0xCC, 0xC5, 0xDE, 0x16, 0x3B, 0xBB, 
+    0x32, 0xB5, 0x23, 0x2E, 0xFE, 0x08, 0x5C, 0x24, 0x7E, 0x11, 0x1D, 0xF6, 0xFE, 0x02, 0x62, 
+    0x22, 0xC8, 0x10, 0x1C, 0x02, 0xCC, 0x25, 0xCE, 0x25, 0x17, 0x22, 0xFF, 0x1B, 0xFE, 0x2E, 
+    0x03, 0x0B, 0xE1, 0x1A, 0x9C, 0x0C, 0x52, 0x10, 0xE3, 0x1F, 0xD0, 0x1B, 0x6A, 0x2B, 0xEF, 
+    0x9A, 0x26, 0xE0, 0x3C, 0x85, 0x14, 0xCC, 0x00, 0x01, 0xCC, 0x00, 0xFD, 0x00, 0x6C, 0x18, 
+    0xFF, 0x13, 0x00, 0x2C, 0x07, 0xCC, 0x00, 0xFF, 0x12, 0x6D, 0x23, 0xEB, 0x21, 0x12, 0x16, 
+    0xE3, 0x2F, 0x3B, 0x58, 0x0A, 0x50, 0x06, 0x2E, 0x8D, 0x03, 0x6D, 0x13, 0xA5, 0x22, 0x1C, 
+    0xF6, 0xFD, 0x43, 0x0C, 0xF6, 0x65, 0x35, 0x61, 0x00, 0x64, 0x3F, 0x32, 0x20, 0x7A, 0x10, 
+    0xFF, 0x00, 0xE4, 0x9C, 0xF6, 0x08, 0x16, 0x8E, 0x2E, 0xFF, 0x1E, 0x8E, 0x00, 0xD6, 0x19, 
+    0xFF, 0x91, 0x23, 0x1F, 0x0C, 0x7F, 0x31, 0x15, 0x2B, 0xCC, 0x05, 0xCC, 0x22, 0xE3, 0x23, 
+    0xB5, 0x16, 0xFE, 0xF6, 0xF0, 0x08, 0x49, 0x10, 0x96, 0x17, 0xCC, 0x1D, 0x17, 0x23, 0x58, 
+    0x00, 0xF5, 0x0B, 0x7F, 0x3D, 0x10, 0x17, 0x27, 0xF3, 0x10, 0x7B, 0x2A, 0xCC, 0x25, 0x30, 
+    0x01, 0x26, 0x2D, 0x9D, 0xF2, 0x2E, 0xED, 0x04, 0xF5, 0xF6, 0xF0, 0x02, 0xA7, 0x01, 0x91, 
+    0x13, 0x96, 0x3B, 0xFF, 0xC5, 0x26, 0x99, 0x10, 0x31, 0x25, 0xD1, 0x2E, 0xF2, 0x05, 0xCC, 
+    0x00, 0x21, 0x07, 0x90, 0x13, 0xFF, 0xC7, 0x08, 0xCC, 0x30, 0x06, 0x11, 0xCC, 0x60, 0xE7, 
+    0x2E, 0xDB, 0x2D, 0xD8, 0x19, 0x86, 0x5C, 0xFB, 0xB7, 0x0F, 0xD5, 0x00, 0xF6, 0xAC, 0x01, 
+    0x09, 0x00, 0x2F, 0x14, 0x20, 0x20, 0xD3, 0x23, 0x27, 0x6F, 0x15, 0xE5, 0x3F, 0x4E, 0x4F, 
+    0x2B, 0x8E, 0x4A, 0x18, 0x8E, 0xF5, 0xFF, 0x95, 0x02, 0xA0, 0x34, 0xEA, 0x0E, 0x83, 0x03, 
+    0x6D, 0x23, 0x8F, 0x1E, 0x29, 0x16, 0xF1, 0x11, 0xFF, 0x46, 0x00, 0x37, 0x18, 0x2A, 0x0E, 
+    0xEA, 0x18, 0x25, 0x06, 0x5D, 0x22, 0xFE, 0x39, 0x9C, 0x12, 0x7F, 0x6F, 0x2A, 0x11, 0x23, 
+    0x98, 0x2D, 0x4C, 0x03, 0xCA, 0x10, 0x44, 0x20, 0x54, 0x12, 0x02, 0xF3, 0x8B, 0x0C, 0x1A, 
+    0x24, 0x2E, 0x9D, 0x2A, 0x07, 0x28, 0x00, 0xA1, 0x02, 0xD1, 0x02, 0xFF, 0x67, 0x10, 0x36, 
+    0x10, 0x68, 0x10, 0xD3, 0x14, 0x50, 0x22, 0xCC, 0x30, 0xA7, 0x36, 0x75, 0x23, 0x7D, 0xBD, 
+    0x02, 0xF6, 0x51, 0x10, 0x22, 0x14, 0x79, 0x03, 0x26, 0x2A, 0xCC, 0x30, 0x19, 0xDF, 0xF6, 
+    0x23, 0x56, 0x0D, 0xC8, 0x06, 0xF6, 0x3B, 0xE8, 0x03, 0x1D, 0x4D, 0x02, 0x8B, 0x03, 0xFF, 
+    0x4C, 0x05, 0x48, 0x17, 0x3A, 0x26, 0xED, 0x34, 0x17, 0x00, 0xE4, 0x34, 0x32, 0x00, 0x10, 
+    0x20, 0xE9, 0x4F, 0x00, 0x2B, 0x8E, 0x27, 0x1F, 0x1F, 0xFF, 0x00, 0x3A, 0x00, 0xFC, 0x22, 
+    0xFF, 0x82, 0x1B, 0x83, 0x02, 0x06, 0x10, 0xE2, 0x24, 0x03, 0x27, 0x0C, 0x27, 0x9A, 0x41, 
+    0x8F, 0x1E, 0xFF, 0xF3, 0x1C, 0x0D, 0x1C, 0xFE, 0x29, 0xCB, 0x1F, 0x92, 0x2D, 0xED, 0x11, 
+    0xCE, 0x31, 0x16, 0x18, 0x4F, 0xCC, 0x36, 0x37, 0x10, 0xDB, 0x3A, 0xCC, 0x26, 0x2B, 0x9D, 
+    0x98, 0x00, 0x1F, 0xFC, 0xF6, 0x1C, 0x2A, 0x04, 0x28, 0x2D, 0x60, 0x14, 0xF5, 0x24, 0x2F, 
+    0x20, 0xCC, 0x00, 0xFF, 0x59, 0x2F, 0xCC, 0x00, 0x07, 0x1A, 0xCC, 0x10, 0xE3, 0x22, 0x33, 
+    0x00, 0x15, 0x18, 0x92, 0x35, 0x7F, 0xA7, 0x2C, 0x71, 0x16, 0x92, 0x05, 0x41, 0x25, 0x63, 
+    0x10, 0x91, 0x08, 0x79, 0x01, 0x1E, 0xFF, 0x74, 0x01, 0x6A, 0x06, 0xEE, 0x25, 0x28, 0x1B, 
+    0x33, 0x11, 0xFD, 0x13, 0x82, 0x33, 0x65, 0x55, 0x36, 0x02, 0xCD, 0x24, 0xC4, 0x3D, 0x02, 
+    0x5B, 0x1D, 0xD8, 0x06, 0xF5, 0x1D, 0xFE, 0x8E, 0x2E, 0x08, 0xEC, 0x20, 0x10, 0x0B, 0x50, 
+    0x17, 0x94, 0x20, 0x11, 0x17, 0x90, 0x10, 0xFF, 0xCC, 0x35, 0x32, 0x10, 0xCC, 0x15, 0x16, 
+    0x38, 0xB7, 0x00, 0x16, 0x13, 0xFE, 0x38, 0x5C, 0x0B, 0xDF, 0xCE, 0x24, 0x6A, 0x21, 0x27, 
+    0x29, 0xCC, 0x45, 0xFE, 0x00, 0x02, 0xE9, 0x01, 0xCC, 0x25, 0xD9, 0x11, 0x08, 0x2B, 0xF5, 
+    0x2A, 0x19, 0xE1, 0x0E, 0x8E, 0x99, 0x06, 0x3E, 0x25, 0xFF, 0x4E, 0x10, 0x36, 0x00, 0xDE, 
+    0x08, 0xC3, 0x01, 0x49, 0x11, 0x29, 0x22, 0xCC, 0xA0, 0x3E, 0x20, 0xFF, 0x6B, 0x1B, 0xCC, 
+    0x00, 0x1A, 0x35, 0xCC, 0x40, 0x72, 0x24, 0xA0, 0x3F, 0x2F, 0x02, 0x8A, 0x01, 0xFF, 0x45, 
+    0x17, 0x54, 0x32, 0xD5, 0x0D, 0x5F, 0x13, 0x26, 0x17, 0x98, 0x29, 0x6C, 0x37, 0x63, 0x32, 
+    0x4B, 0x3E, 0x22, 0x41, 0x2B, 0x1E, 0xA7, 0x0E, 0x8E, 0x1D, 0x8E, 0x00, 0x1F, 0xFE, 0x1F, 
+    0x00, 0x02, 0xD0, 0x25, 0xF7, 0x14, 0x76, 0x28, 0x04, 0x11, 0x66, 0x00, 0xD8, 0x24, 0xFF, 
+    0x9F, 0x15, 0x9D, 0x00, 0xCC, 0x45, 0xDF, 0x11, 0x36, 0x03, 0x0B, 0x13, 0x79, 0x45, 0x06, 
+    0x24, 0xFF, 0xFE, 0x5B, 0x1C, 0x00, 0xA6, 0x06, 0x21, 0x15, 0xB9, 0x3C, 0x98, 0x16, 0xCC, 
+    0x45, 0x24, 0x1D, 0xFD, 0x00, 0x01, 0xF5, 0x03, 0x02, 0x4B, 0x2C, 0xFD, 0x3F, 0x5E, 0x23, 
+    0x7A, 0x10, 0xCC, 0x00, 0xFF, 0xB2, 0x20, 0x5B, 0x16, 0xCC, 0x00, 0x60, 0x00, 0x36, 0x18, 
+    0xF9, 0x1B, 0xCC, 0xE0, 0x5F, 0x36, 0xFF, 0xB1, 0x12, 0x85, 0x12, 0x3F, 0x23, 0xDD, 0x10, 
+    0xFC, 0x00, 0x5F, 0x04, 0x9C, 0x1D, 0x8E, 0x10, 0xFE, 0x1E, 0x47, 0x10, 0x97, 0x11, 0xA8, 
+    0x20, 0x80, 0x00, 0x3F, 0x01, 0x99, 0x2D, 0xA3, 0x14, 0xFD, 0x1C, 0x16, 0x1F, 0xD4, 0x07, 
+    0xF8, 0x00, 0x7B, 0x05, 0xA1, 0x18, 0x6E, 0x17, 0x27, 0x00, 0xFF, 0x47, 0x17, 0x24, 0x1F, 
+    0x8A, 0x13, 0xD4, 0x3C, 0x32, 0x3D, 0x3A, 0x20, 0x0F, 0x2A, 0x6A, 0x00, 0xFF, 0x46, 0x20, 
+    0x60, 0x16, 0x64, 0x1C, 0xC1, 0x18, 0x9D, 0x12, 0x1D, 0x16, 0xFF, 0x1B, 0xA5, 0x24, 0x3F, 
+    0xBC, 0x00, 0xF5, 0x24, 0x22, 0x27, 0x2A, 0x00, 0xEF, 0x04, 0xD8, 0x00, 0xF5, 0x8E, 0x84, 
+    0x8E, 0xF6, 0xFD, 0x04, 0x2B, 0x8E, 0x01, 0x1E, 0x3D, 0x13, 0xFF, 0x70, 0x2C, 0xF6, 0x20, 
+    0x6A, 0x12, 0xCC, 0x40, 0x01, 0x2F, 0x5A, 0x34, 0xE2, 0x1D, 0x6F, 0x05, 0x9F, 0x82, 0x17, 
+    0x13, 0x09, 0x65, 0x2C, 0xCC, 0x30, 0xE8, 0x10, 0x1F, 0x18, 0xE8, 0x2E, 0xFF, 0x8C, 0x12, 
+    0xF3, 0x18, 0x50, 0x27, 0xEC, 0x23, 0xDF, 0x15, 0xCE, 0x02, 0x45, 0x2E, 0x2A, 0x1B, 0x3F, 
+    0x8A, 0x00, 0xFF, 0x1C, 0x5F, 0x4D, 0x3B, 0x3F, 0x80, 0x21, 0x2B, 0x1E, 0x1E, 0x8E, 0xE1, 
+    0x90, 0x12, 0x03, 0x8E, 0x1F, 0x8E, 0x44, 0x03, 0x34, 0x5F, 0xD3, 0x05, 0xFF, 0x1A, 0x01, 
+    0xD7, 0x13, 0xC7, 0x14, 0x32, 0x4D, 0xFE, 0x16, 0x65, 0x3D, 0x69, 0x15, 0xEF, 0x1A, 0xFF, 
+    0x2A, 0x20, 0xFE, 0x19, 0x65, 0x0D, 0x33, 0x01, 0xE2, 0x00, 0xF4, 0x00, 0x08, 0x1F, 0x2A, 
+    0x13, 0x0F, 0x68, 0x03, 0x34, 0x00, 0xA0, 0x30, 0xD6, 0x1B, 0x1E, 0x1D, 0x02, 0x9D, 0xC2, 
+    0x2B, 0xFF, 0x30, 0x1C, 0x2B, 0x8E, 0x1E, 0x36, 0x07, 0x2D, 0x16, 0xFF, 0xFB, 0x20, 0x54, 
+    0x29, 0x3B, 0x3B, 0x9F, 0x10, 0xCC, 0x40, 0x91, 0x27, 0x89, 0x23, 0x74, 0x1C, 0xEF, 0xDA, 
+    0x15, 0xCC, 0x30, 0x07, 0x18, 0xE4, 0x14, 0xF5, 0xFF, 0x00, 0xB1, 0x1A, 0x5C, 0x09, 0x7E, 
+    0x1B, 0xC5, 0x09, 0x1A, 0x5E, 0x7C, 0x02, 0x4C, 0x00, 0xD6, 0x0A, 0x87, 0x15, 0x02, 0x7F, 
+    0x64, 0x00, 0x39, 0x22, 0x0E, 0x10, 0xF6, 0x1E, 0x23, 0x20, 0xE5, 0x16, 0x72, 0x1A, 0x1F, 
+    0xD8, 0x1E, 0x1B, 0xF5, 0xB4, 0x00, 0xD1, 0x0A, 0xF5, 0x91, 0x10, 0x89, 0x12, 0xFF, 0x1C, 
+    0x1C, 0xD7, 0x25, 0xBF, 0x25, 0x4F, 0x10, 0x33, 0x02, 0x08, 0x2F, 0xD3, 0x33, 0x2D, 0x02, 
+    0xFF, 0x7C, 0x00, 0xCC, 0x35, 0x27, 0x00, 0x33, 0x02, 0x4B, 0x10, 0x3B, 0x00, 0x10, 0x1F, 
+    0x64, 0x23, 0x8F, 0x6D, 0x11, 0xFB, 0x1E, 0x41, 0x22, 0x30, 0x00, 0x01, 0x2E, 0x19, 0x57, 
+    0x20, 0x60, 0x1F, 0x02, 0x9C, 0x9D, 0xF5, 0xFC, 0x0D, 0x8F, 0x04, 0x02, 0xFE, 0x9D, 0xC8, 
+    0x2A, 0x28, 0x01, 0x99, 0x21, 0xC5, 0x33, 0x63, 0x02, 0x01, 0x00, 0x96, 0x2B, 0xFF, 0xCC, 
+    0x70, 0xC1, 0x21, 0xCC, 0x00, 0x8D, 0x25, 0xCC, 0x00, 0x52, 0x27, 0x89, 0x1D, 0xCC, 0x00, 
+    0xFC, 0x1D, 0x02, 0x3C, 0x11, 0xCC, 0x05, 0x06, 0x0C, 0x66, 0x26, 0xE7, 0x5E, 0x03, 0x02, 
+    0xFC, 0x1E, 0x01, 0x0F, 0x0B, 0x08, 0x1B, 0xD7, 0x4A, 0x23, 0x16, 0x59, 0x12, 0x40, 0x23, 
+    0xDF, 0x32, 0x16, 0x5D, 0x08, 0x8D, 0x13, 0x24, 0x26, 0x76, 0x11, 0x2B, 0x6F, 0x15, 0x02, 
+    0x26, 0xFF, 0x7E, 0x05, 0x65, 0x1D, 0x19, 0x00, 0x8A, 0x10, 0xA9, 0x08, 0xC9, 0x27, 0xAA, 
+    0x32, 0x75, 0x2B, 0xFF, 0x02, 0x22, 0x2E, 0x4B, 0xA8, 0x11, 0x68, 0x1B, 0xA9, 0x10, 0xA4, 
+    0x23, 0xF2, 0x12, 0xE5, 0x00, 0xC7, 0xCC, 0x55, 0xFA, 0x1A, 0x74, 0x42, 0x5C, 0x2B, 0x9C, 
+    0xE6, 0x18, 0x01, 0x05, 0xFC, 0x1B, 0x02, 0x70, 0x04, 0x23, 0x4B, 0x97, 0x2D, 0x0D, 0x3E, 
+    0x24, 0x12, 0xC0, 0x14, 0xFF, 0xE5, 0x2D, 0xE7, 0x6E, 0x8C, 0x00, 0xCC, 0x00, 0x36, 0x18, 
+    0xBD, 0x21, 0x7A, 0x35, 0xCC, 0x30, 0xFB, 0x55, 0x24, 0x6B, 0x13, 0x1F, 0xBB, 0x0E, 0xAB, 
+    0x2A, 0xE7, 0x3E, 0x84, 0x2C, 0xA2, 0x2C, 0xFF, 0x30, 0x10, 0xAB, 0x32, 0x26, 0x10, 0xA6, 
+    0x09, 0x1C, 0x12, 0x9B, 0x11, 0xDC, 0x14, 0x0D, 0x11, 0x98, 0x8E, 0x8E, 0x8E, 0x13, 0x00, 
+    0x4D, 0x08, 0xF5, 0x2B, 0xEC, 0x1F, 0xFF, 0xEB, 0x30, 0x65, 0x12, 0x33, 0x00, 0xEF, 0x32, 
+    0x05, 0x17, 0x32, 0x15, 0xD9, 0x10, 0x8E, 0x00, 0xFF, 0x20, 0x28, 0x25, 0x11, 0x93, 0x01, 
+    0xA5, 0x11, 0xE9, 0x00, 0xB1, 0x14, 0x98, 0x4C, 0x70, 0x27, 0x3F, 0x1A, 0x1F, 0x3C, 0x00, 
+    0x2D, 0x17, 0x16, 0x10, 0xDF, 0x22, 0x85, 0x18, 0x9C, 0x9D, 0xC2, 0x1D, 0xA4, 0x0D, 0xF5, 
+    0xF6, 0x8E, 0x8E, 0x6F, 0x0F, 0xE3, 0x28, 0xEF, 0x5D, 0x20, 0xA0, 0x12, 0x40, 0x37, 0xCC, 
+    0x40, 0x1D, 0xCC, 0x40, 0xE7, 0x3E, 0xCC, 0x70, 0xE7, 0x05, 0x3C, 0xCC, 0x30, 0xB4, 0x14, 
+    0x2E, 0x9C, 0x07, 0x10, 0x83, 0x21, 0xC1, 0x00, 0xF7, 0x0A, 0x10, 0x45, 0x1A, 0x35, 0x2F, 
+    0x1D, 0x65, 0x06, 0xFB, 0x44, 0x4D, 0x12, 0xC6, 0x2A, 0x2F, 0x12, 0x10, 0x19, 0x5F, 0xDC, 
+    0x03, 0x04, 0x1C, 0x2E, 0xFD, 0x00, 0x1F, 0x1B, 0xFE, 0x9D, 0x90, 0x0A, 0x6E, 0x06, 0x61, 
+    0x02, 0xE0, 0x2A, 0x33, 0x01, 0xEC, 0x17, 0xD1, 0x01, 0xFF, 0x08, 0x32, 0xE7, 0x31, 0xA5, 
+    0x25, 0xA6, 0x2F, 0xB5, 0x01, 0x3A, 0x05, 0x71, 0x03, 0x81, 0x2A, 0xBB, 0x67, 0x1B, 0xE0, 
+    0x06, 0xF5, 0xE6, 0x20, 0x05, 0x21, 0xA6, 0x11, 0xF6, 0xF6, 0x11, 0xCF, 0x39, 0x14, 0x49, 
+    0x00, 0x30, 0x2D, 0xCC, 0x16, 0x9C, 0x1E, 0xF9, 0x03, 0xC8, 0x01, 0xFF, 0x76, 0x08, 0xF9, 
+    0x02, 0x3A, 0x11, 0x3F, 0x14, 0x89, 0x1C, 0x80, 0x0D, 0xE9, 0x00, 0xE9, 0x0A, 0xFF, 0xBB, 
+    0x26, 0x8F, 0x15, 0x50, 0x26, 0x0E, 0x49, 0x4D, 0x02, 0x3F, 0x36, 0xCC, 0x10, 0x5F, 0x20, 
+    0xFF, 0x93, 0x15, 0x9C, 0x00, 0xC5, 0x00, 0x11, 0x03, 0x04, 0x10, 0x6C, 0x10, 0x1A, 0x18, 
+    0x37, 0x31, 0xFF, 0x51, 0x10, 0xBC, 0x29, 0x1F, 0x21, 0x07, 0x10, 0x09, 0x04, 0xA6, 0x12, 
+    0xB7, 0x18, 0xB0, 0x05, 0xE3, 0x4A, 0x14, 0x42, 0x3D, 0x1F, 0x9D, 0x9C, 0x94, 0x03, 0xFF, 
+    0x00, 0x25, 0x01, 0xFF, 0x94, 0x00, 0x1F, 0x2B, 0x40, 0x15, 0x08, 0x11, 0xC3, 0x14, 0xF7, 
+    0x23, 0x61, 0x31, 0x5A, 0x27, 0xCF, 0x93, 0x11, 0xCC, 0x25, 0x0A, 0x11, 0x47, 0x16, 0x1E, 
+    0x1E, 0x7E, 0x03, 0xCB, 0x04, 0xFF, 0x17, 0x78, 0x85, 0x20, 0xC7, 0x11, 0xB2, 0x27, 0x94, 
+    0x11, 0x11, 0x28, 0x0E, 0x05, 0xFD, 0x05, 0xF8, 0xF5, 0x9D, 0x2B, 0x02, 0x08, 0x6E, 0x1A, 
+    0xCC, 0x35, 0x17, 0x10, 0xE8, 0x11, 0xF7, 0x91, 0x24, 0xC1, 0x30, 0x0C, 0x1C, 0x1F, 0xF2, 
+    0x16, 0xCC, 0x20, 0x53, 0x33, 0xB9, 0x14, 0xFF, 0xCC, 0x30, 0x6E, 0x34, 0x31, 0x16, 0x32, 
+    0x00, 0xFF, 0x0C, 0x22, 0x25, 0x79, 0x12, 0xC2, 0x02, 0xFF, 0xB6, 0x1F, 0x4D, 0x19, 0xA3, 
+    0x3C, 0x46, 0x28, 0xB8, 0x14, 0x07, 0x1E, 0x4C, 0x3F, 0x17, 0x14, 0x0F, 0xAC, 0x0C, 0xF9, 
+    0x14, 0x95, 0x26, 0x2B, 0x00, 0x5C, 0x9D, 0x9D, 0x9D, 0xFE, 0x1B, 0x5F, 0x01, 0x5F, 0x25, 
+    0x04, 0x0E, 0xEE, 0x16, 0x6E, 0x19, 0xF3, 0x27, 0x57, 0x3E, 0xFF, 0x3B, 0x1D, 0x66, 0x3B, 
+    0xAC, 0x28, 0x9D, 0x26, 0xCC, 0x05, 0x01, 0x01, 0xC4, 0x10, 0xA9, 0x00, 0xF9, 0x04, 0x15, 
+    0x1C, 0x5C, 0x0F, 0x25, 0xEC, 0x11, 0x88, 0x10, 0x60, 0x10, 0xCC, 0x25, 0xA6, 0x1B, 0x1F, 
+    0x10, 0x96, 0x26, 0x02, 0x9C, 0xF9, 0x0E, 0x02, 0x6E, 0x00, 0xF0, 0x02, 0xF6, 0x2B, 0x2E, 
+    0x76, 0x02, 0x72, 0x20, 0xFD, 0x20, 0x3A, 0x1E, 0xFF, 0x2F, 0x13, 0xCC, 0xD0, 0x62, 0x19, 
+    0x53, 0x33, 0xCC, 0x30, 0x2F, 0x3B, 0x56, 0x13, 0xD5, 0x22, 0xFE, 0xF6, 0x92, 0x27, 0x15, 
+    0x2B, 0x2D, 0x14, 0xFE, 0x2D, 0xA1, 0x10, 0x33, 0x12, 0xF4, 0x00, 0xFF, 0xEC, 0x1C, 0x89, 
+    0x08, 0x93, 0x21, 0x5E, 0x02, 0xD8, 0x19, 0x53, 0x00, 0x75, 0x0D, 0x82, 0x02, 0x93, 0x1F, 
+    0x2A, 0xC3, 0x17, 0x1F, 0xF6, 0xFC, 0x12, 0x9D, 0x1D, 0xD3, 0x05, 0xE6, 0x01, 0x0C, 0x0E, 
+    0xF3, 0x02, 0x1B, 0x02, 0x6E, 0x02, 0xE2, 0x23, 0xA1, 0x10, 0xBF, 0x2C, 0x24, 0xD0, 0x16, 
+    0xA4, 0x0D, 0x2F, 0x22, 0xA9, 0x3E, 0x07, 0x13, 0x01, 0x01, 0x0D, 0xFD, 0x06, 0x00, 0xF5, 
+    0x70, 0x06, 0x94, 0x21, 0xA3, 0x17, 0xA6, 0x15, 0xA2, 0x26, 0x2F, 0x15, 0x6B, 0xCB, 0x20, 
+    0xC9, 0x11, 0x02, 0x22, 0x02, 0x1D, 0xFD, 0x03, 0x2F, 0x1A, 0xF5, 0xFC, 0x2B, 0x02, 0x6B, 
+    0x06, 0x6D, 0x19, 0xFC, 0x15, 0x25, 0x12, 0xD1, 0x15, 0xF7, 0x28, 0xFF, 0x39, 0x2B, 0xCD, 
+    0x10, 0xCC, 0x50, 0x66, 0x27, 0x75, 0x2C, 0x86, 0x10, 0xCC, 0x30, 0x10, 0x21, 0xF9, 0x9F, 
+    0x44, 0x1C, 0x2B, 0xE4, 0x33, 0x05, 0x10, 0x9E, 0x20, 0x50, 0x00, 0xEC, 0x12, 0xFF, 0x38, 
+    0x21, 0xAF, 0x2A, 0x96, 0x13, 0x62, 0x12, 0xAC, 0x7C, 0x51, 0x1F, 0xE3, 0x37, 0xC0, 0x00, 
+    0x99, 0xC1, 0x12, 0x18, 0x1A, 0x8F, 0x02, 0x95, 0x05, 0x9D, 0xF5, 0x0B, 0x03, 0xBF, 0x63, 
+    0x3C, 0xDE, 0x01, 0x21, 0x0F, 0x03, 0x13, 0x9C, 0x25, 0x33, 0x00, 0x02, 0x4F, 0x13, 0xFD, 
+    0xCF, 0x10, 0xF5, 0x9D, 0x15, 0x06, 0x11, 0x85, 0x12, 0xAA, 0x06, 0x94, 0x11, 0x5B, 0x2A, 
+    0xFF, 0x6E, 0x18, 0x23, 0x12, 0xBF, 0x06, 0x6C, 0x26, 0xC6, 0x25, 0x0C, 0x00, 0x53, 0x08, 
+    0x26, 0x25, 0x90, 0x1D, 0x2B, 0x9C, 0x2B, 0xFE, 0x01, 0xF6, 0x9D, 0xFE, 0x05, 0xFC, 0x9D, 
+    0x02, 0x68, 0x11, 0x7D, 0x10, 0x6B, 0x10, 0x56, 0x24, 0x7A, 0x04, 0x4C, 0x22, 0xFF, 0xCC, 
+    0x60, 0x72, 0x25, 0xCC, 0x40, 0xC7, 0x18, 0x15, 0x11, 0xCC, 0x10, 0xD0, 0x2D, 0xA6, 0x29, 
+    0xDF, 0xE8, 0x1D, 0x8E, 0x22, 0x96, 0x27, 0xB5, 0x35, 0x7B, 0x21, 0x1C, 0xAE, 0x00, 0x8E, 
+    0x17, 0xFF, 0x37, 0x25, 0x5B, 0x20, 0x26, 0x20, 0x69, 0x25, 0x91, 0x14, 0xBA, 0x2C, 0x1C, 
+    0x12, 0xCF, 0x00, 0x50, 0x1E, 0x1F, 0x1D, 0x5C, 0x10, 0x04, 0x1B, 0x3D, 0x04, 0x9D, 0xFF, 
+    0x3F, 0x1D, 0xA6, 0x3A, 0x83, 0x15, 0xFD, 0x27, 0x55, 0x00, 0xAB, 0x00, 0x96, 0x4A, 0xF5, 
+    0x26, 0xFF, 0xCF, 0x17, 0x65, 0x10, 0x20, 0x1A, 0x5D, 0x30, 0x0E, 0x22, 0xA3, 0x13, 0x9A, 
+    0x12, 0xCB, 0x3A, 0x9F, 0x97, 0x0C, 0x65, 0x36, 0x16, 0x12, 0x20, 0x04, 0x8A, 0x00, 0x2B, 
+    0x2B, 0x3C, 0x01, 0xE2, 0x9D, 0x3C, 0x16, 0xF6, 0xF6, 0x9C, 0x75, 0x06, 0xFF, 0x23, 0xF7, 
+    0x2E, 0xFF, 0xCD, 0x11, 0xBC, 0x01, 0x9F, 0x20, 0xF4, 0x14, 0x9C, 0x13, 0x35, 0x28, 0x79, 
+    0x11, 0x9B, 0x1C, 0xFF, 0xCC, 0x20, 0x87, 0x11, 0x6D, 0x1D, 0x53, 0x3B, 0x32, 0x40, 0x3B, 
+    0x2D, 0x1C, 0x20, 0x13, 0x13, 0x7F, 0x40, 0x14, 0x4B, 0x3F, 0xB4, 0x24, 0xB1, 0x20, 0x30, 
+    0x18, 0x2B, 0x1A, 0x94, 0x00, 0xF5, 0x7B, 0x3F, 0x2D, 0xAC, 0x1C, 0x2E, 0xAC, 0x0C, 0x32, 
+    0x0D, 0x0C, 0x10, 0xD5, 0x21, 0x1B, 0xF9, 0xFA, 0x00, 0xF5, 0xF5, 0x98, 0x01, 0x95, 0x03, 
+    0x48, 0x15, 0x1E, 0x08, 0x73, 0x20, 0xE3, 0xF5, 0x10, 0xCF, 0x20, 0x1E, 0x1F, 0x01, 0x27, 
+    0x15, 0x03, 0x00, 0x05, 0x10, 0x99, 0x00, 0x00, 0xF5, 0x1B, 0x0F, 0x20, 0x0B, 0x30, 0x9D, 
+    0x5C, 0x0C, 0x00, 0x66, 0xF5, 0x0C, 0x30, 0xE1, 0x18, 0x1E, 0x8E, 0x08, 0x34, 0x90, 0x26, 
+    0x01, 0xA3, 0x46, 0x08, 0xE2, 0x18, 0x9C, 0x2B, 0xF6, 0xF7, 0x09, 0xF6, 0x95, 0x09, 0xBE, 
+    0x01, 0x7F, 0x04, 0x9B, 0x35, 0x34, 0x18, 0x66, 0x24, 0x21, 0x26, 0x1E, 0xE4, 0x0E, 0xFF, 
+    0xFE, 0x36, 0xAD, 0x10, 0x3A, 0x15, 0xCC, 0x24, 0xC8, 0x20, 0x7F, 0x2D, 0x26, 0x27, 0x35, 
+    0x13, 0xFB, 0xD5, 0x28, 0x7F, 0x12, 0x03, 0xAA, 0x39, 0xCC, 0x2C, 0x7F, 0x36, 0x27, 0x23, 
+    0x26, 0x22, 0xFF, 0xAA, 0x2A, 0x3D, 0x00, 0x66, 0x02, 0xA2, 0x03, 0x37, 0x35, 0xAC, 0x4C, 
+    0x66, 0x21, 0x18, 0x3F, 0x25, 0xB2, 0x1A, 0x5C, 0x11, 0x22, 0xF5, 0xF5, 0xB5, 0x01, 0x9D, 
+    0x9C, 0x3E, 0x8E, 0x73, 0x01, 0x6C, 0x0E, 0x59, 0x34, 0x9C, 0x38, 0xAD, 0x00, 0x1E, 0x1F, 
+    0xC0, 0x2B, 0x18, 0x9D, 0x9D, 0x2E, 0x2E, 0x03, 0x10, 0x43, 0x0C, 0xE1, 0x7B, 0x00, 0xF6, 
+    0x1B, 0xF5, 0xF5, 0x66, 0x10, 0x4D, 0x05, 0x12, 0x00, 0xDC, 0x9D, 0x9D, 0x95, 0x10, 0xE2, 
+    0x02, 0x45, 0x09, 0x1F, 0xE5, 0x1C, 0x5D, 0x20, 0xC7, 0x23, 0x12, 0x4B, 0x10, 0x67, 0x00, 
+    0x2B, 0x2B, 0x02, 0xFC, 0x00, 0xFA, 0x09, 0xFD, 0x7B, 0x01, 0xF5, 0x4F, 0x04, 0x56, 0x23, 
+    0xE8, 0x21, 0xAD, 0x16, 0x64, 0x15, 0xFF, 0x04, 0xFF, 0x51, 0x28, 0x5C, 0x0A, 0xEE, 0x03, 
+    0x6C, 0x1B, 0x3B, 0x28, 0xF7, 0x29, 0x1B, 0x2A, 0xC6, 0x21, 0xFF, 0xF3, 0x09, 0x79, 0x39, 
+    0xD1, 0x13, 0x8D, 0x18, 0xF7, 0x3F, 0x27, 0x16, 0x9F, 0x12, 0xE8, 0x43, 0xFF, 0xC7, 0x32, 
+    0x5E, 0x23, 0x1E, 0x02, 0xF3, 0x2C, 0x14, 0x22, 0xAC, 0x0C, 0x4B, 0x1C, 0xF4, 0x02, 0xEF, 
+    0x19, 0x16, 0x2B, 0x27, 0xCE, 0x13, 0xB2, 0x25, 0x8E, 0x18, 0x06, 0x05, 0x05, 0xC7, 0x12, 
+    0x1F, 0xBB, 0x22, 0xF0, 0x3E, 0x57, 0x18, 0x7C, 0x21, 0x1E, 0x0F, 0x2B, 0x9D, 0x2E, 0xC0, 
+    0x9D, 0x2E, 0xF5, 0x5C, 0x1D, 0x4E, 0x3A, 0x10, 0x38, 0x0B, 0x56, 0xF5, 0x7C, 0x00, 0x5B, 
+    0x01, 0x8E, 0x51, 0x02, 0xF5, 0x0D, 0x19, 0x2E, 0xF9, 0xDA, 0x06, 0x1D, 0x8E, 0x3A, 0x25, 
+    0x72, 0x26, 0x01, 0x11, 0xF9, 0x04, 0xBA, 0x10, 0x0C, 0x2B, 0x9B, 0xC4, 0x04, 0x00, 0x12, 
+    0xF5, 0x1B, 0x1B, 0xF5, 0xBE, 0x9C, 0x22, 0x01, 0xCF, 0x17, 0x32, 0x2C, 0xC8, 0x21, 0xAD, 
+    0x01, 0xF5, 0x26, 0x13, 0xF7, 0xBE, 0x11, 0x7F, 0x28, 0xBF, 0x16, 0xF5, 0x44, 0x21, 0x09, 
+    0x23, 0x7F, 0x4D, 0x76, 0x19, 0xC7, 0x8E, 0x03, 0xF9, 0x10, 0x53, 0x17, 0x1C, 0xF5, 0x9C, 
+    0x21, 0x1B, 0x10, 0x00, 0xFF, 0x80, 0x05, 0xAF, 0x07, 0x97, 0x0D, 0x19, 0x11, 0x09, 0x13, 
+    0x5D, 0x10, 0xCB, 0x14, 0xB7, 0x2B, 0xFF, 0x62, 0x23, 0x86, 0x2D, 0xFA, 0x02, 0x58, 0x2C, 
+    0x79, 0x10, 0xFD, 0x15, 0x20, 0x1A, 0xF4, 0x27, 0x0A, 0x8E, 0x03, 0x06, 0x5C, 0xD8, 0x11, 
+    0x01, 0xF5, 0x9C, 0xF5, 0x1F, 0xCD, 0x08, 0x66, 0x28, 0xF2, 0x33, 0x21, 0x23, 0x4D, 0x00, 
+    0x8E, 0x1F, 0x1D, 0xA4, 0x8E, 0x19, 0x28, 0x29, 0x1E, 0x4E, 0x4A, 0x00, 0x02, 0xC2, 0x0A, 
+    0x60, 0x8E, 0x8E, 0x1E, 0x02, 0x1B, 0x35, 0x00, 0x43, 0x02, 0xF5, 0xF0, 0x2E, 0x02, 0x02, 
+    0x2B, 0x42, 0x0D, 0x00, 0x00, 0x33, 0x40, 0x9D, 0x3F, 0x41, 0xBA, 0x11, 0x1F, 0x9C, 0x9B, 
+    0x9C, 0x2B, 0x5F, 0x04, 0x02, 0xF2, 0x1E, 0x01, 0x01, 0x01, 0xF5, 0xFB, 0x09, 0x95, 0x00, 
+    0xC6, 0x12, 0x7F, 0x00, 0xC3, 0x57, 0x16, 0xE9, 0x23, 0xF6, 0xF6, 0x1E, 0x2E, 0x50, 0x06, 
+    0x52, 0x26, 0xEF, 0xF1, 0x16, 0x21, 0x15, 0x00, 0x10, 0xD6, 0x15, 0x1B, 0x91, 0x07, 0xB0, 
+    0x10, 0x18, 0x20, 0xFF, 0x9A, 0x10, 0xE6, 0x21, 0x7D, 0x27, 0xD4, 0x09, 0x22, 0x12, 0x96, 
+    0x1A, 0x2F, 0x20, 0x37, 0x18, 0xFD, 0x7A, 0x26, 0x1F, 0x84, 0x14, 0x3E, 0x10, 0x87, 0x24, 
+    0x42, 0x11, 0x16, 0x02, 0xA8, 0x1B, 0xE7, 0x3B, 0x32, 0x81, 0x00, 0x97, 0x02, 0x01, 0x02, 
+    0x82, 0x00, 0xFF, 0x1A, 0x8E, 0x04, 0xD8, 0x1F, 0x8E, 0xF5, 0x55, 0x01, 0x7C, 0x02, 0x2B, 
+    0x0C, 0x05, 0xB7, 0x17, 0x37, 0xD3, 0x1E, 0x3C, 0x11, 0xC8, 0x27, 0x1D, 0xDA, 0x00, 0xD6, 
+    0x00, 0x02, 0x9D, 0xEB, 0xEF, 0x00, 0xCB, 0x09, 0x1D, 0x78, 0x02, 0x1D, 0x3A, 0x1B, 0x3F, 
+    0x0C, 0xCE, 0x0C, 0xE1, 0x4B, 0x0C, 0x2B, 0x9D, 0x2B, 0x02, 0xFD, 0x10, 0x49, 0x10, 0x3E, 
+    0x21, 0x73, 0xF5, 0x13, 0x47, 0x28, 0x1F, 0x5C, 0xFE, 0x00, 0x60, 0x26, 0x1D, 0x1F, 0xF5, 
+    0xFC, 0x03, 0x9D, 0x21, 0x23, 0x9D, 0x00, 0x6D, 0x10, 0xDC, 0x36, 0x2F, 0x00, 0x11, 0x12, 
+    0x9F, 0xD8, 0x12, 0xC8, 0x15, 0xE5, 0x20, 0x1D, 0x22, 0x59, 0x25, 0x2E, 0x1B, 0x9C, 0x1A, 
+    0xFF, 0x2C, 0x21, 0x06, 0x23, 0x8F, 0x18, 0xE6, 0x22, 0xF7, 0x13, 0x08, 0x10, 0xFA, 0x12, 
+    0xA5, 0x2A, 0xFF, 0xAF, 0x49, 0xBB, 0x11, 0x5F, 0x00, 0xB2, 0x1C, 0x2C, 0x3A, 0xF8, 0x8A, 
+    0x01, 0x03, 0xD8, 0x10, 0x0F, 0x32, 0x1D, 0xFF, 0x18, 0xB8, 0x09, 0x57, 0x10, 0x8E, 0x8E, 
+    0xF5, 0x1B, 0xF7, 0x20, 0x05, 0xD0, 0x00, 0x1C, 0x05, 0x9D, 0x61, 0x26, 0xE3, 0x27, 0x8C, 
+    0x40, 0xD2, 0x21, 0x25, 0xDC, 0x11, 0xF5, 0xC8, 0x00, 0x1E, 0x1E, 0x9B, 0x00, 0xF5, 0x02, 
+    0xDF, 0xC8, 0x0E, 0x3B, 0x2C, 0xAF, 0x38, 0xD8, 0x08, 0x0F, 0x22, 0x8E, 0x05, 0x3C, 0x58, 
+    0x12, 0x3B, 0x12, 0x2D, 0x7A, 0x11, 0x5A, 0xFE, 0x00, 0xF5, 0x03, 0x23, 0x04, 0x1F, 0x1F, 
+    0xF8, 0xF5, 0x9C, 0x03, 0x22, 0x01, 0xBE, 0x3C, 0x03, 0x00, 0x8F, 0x14, 0xAE, 0x21, 0xFF, 
+    0x9A, 0x01, 0x2A, 0x03, 0xF9, 0x12, 0xD8, 0x21, 0x1B, 0x11, 0x79, 0x3C, 0x82, 0x10, 0xB5, 
+    0x02, 0xDF, 0x0A, 0x00, 0x13, 0x28, 0x13, 0x23, 0xFF, 0x3B, 0xE0, 0x00, 0x03, 0xF3, 0x11, 
+    0x6B, 0x28, 0xFF, 0x42, 0x11, 0x3C, 0x15, 0x0F, 0x40, 0x28, 0x10, 0x61, 0x00, 0xCE, 0x15, 
+    0x37, 0x1C, 0xD2, 0x09, 0xFF, 0x4A, 0x10, 0x8B, 0x09, 0xFC, 0x04, 0xAF, 0x0D, 0x35, 0x26, 
+    0x2D, 0x10, 0x62, 0x18, 0x00, 0x02, 0xDE, 0xF6, 0x90, 0x06, 0x70, 0x13, 0xC0, 0x02, 0x28, 
+    0x00, 0xF5, 0x4C, 0x0E, 0x46, 0x39, 0x4F, 0xE8, 0x38, 0x46, 0x00, 0xA4, 0x17, 0xFF, 0x10, 
+    0x1F, 0x2B, 0xA8, 0x03, 0x4E, 0xDF, 0xFF, 0x10, 0x32, 0x01, 0x00, 0x41, 0x79, 0x1B, 0xDF, 
+    0x00, 0x9D, 0x4A, 0x2D, 0x97, 0x2E, 0x27, 0xB6, 0x28, 0x3F, 0x30, 0x5B, 0x01, 0x5A, 0x9B, 
+    0xFB, 0x04, 0x1F, 0x01, 0xE5, 0x65, 0x0C, 0x1C, 0x20, 0x01, 0x03, 0x9D, 0x26, 0x00, 0x17, 
+    0x20, 0x53, 0x00, 0xFF, 0x5A, 0x13, 0xF4, 0x10, 0x2F, 0x03, 0x31, 0x33, 0x92, 0x11, 0xA8, 
+    0x28, 0x62, 0x1C, 0xAE, 0x36, 0xFF, 0x0C, 0x11, 0x76, 0x1F, 0x10, 0x3D, 0x73, 0x05, 0x57, 
+    0x18, 0x6D, 0x2F, 0x5A, 0x0E, 0xDA, 0x13, 0x7F, 0xB5, 0x2D, 0x0C, 0x12, 0x6F, 0x11, 0xB9, 
+    0x10, 0x39, 0x02, 0xA1, 0x4E, 0x51, 0x0C, 0x2E, 0xFA, 0xF6, 0x3F, 0x17, 0x1C, 0xF2, 0x14, 
+    0x14, 0x00, 0xDB, 0x03, 0x3A, 0x18, 0x1E, 0x10, 0xDF, 0x8D, 0x02, 0x92, 0x04, 0x19, 0x10, 
+    0x8E, 0x02, 0xDD, 0x12, 0x8E, 0x5E, 0x13, 0xE0, 0x01, 0xE0, 0x02, 0x2E, 0x9D, 0x2B, 0x1B, 
+    0x03, 0x04, 0x56, 0x23, 0x0B, 0x19, 0xE7, 0x10, 0x01, 0x0A, 0x13, 0x5D, 0x00, 0x8E, 0x8E, 
+    0xA4, 0x01, 0xE4, 0x00, 0xC5, 0x05, 0xA3, 0xC1, 0x1A, 0x13, 0x22, 0x1F, 0x1F, 0x4E, 0x5A, 
+    0x0D, 0x1E, 0x34, 0x01, 0x3E, 0x8E, 0x2A, 0x12, 0x97, 0x1D, 0xF3, 0x08, 0x81, 0x13, 0xC9, 
+    0x1F, 0x1F, 0x5A, 0xFC, 0x9B, 0x9C, 0x2A, 0x04, 0x00, 0x10, 0x28, 0x07, 0x41, 0x00, 0x45, 
+    0x11, 0x92, 0x11, 0xFF, 0x99, 0x12, 0xC7, 0x39, 0x0B, 0x03, 0xE4, 0x20, 0x1D, 0x2A, 0xFF, 
+    0x16, 0xC2, 0x03, 0x11, 0x12, 0xFF, 0x9F, 0x02, 0x73, 0x00, 0x2C, 0x06, 0x18, 0x10, 0x34, 
+    0x07, 0x06, 0x26, 0x23, 0x33, 0xBD, 0x46, 0xFC, 0x2E, 0x18, 0x25, 0x16, 0xCF, 0x12, 0x71, 
+    0x13, 0x68, 0x2D, 0x3F, 0x34, 0x23, 0x10, 0xFF, 0x19, 0x20, 0xDB, 0x14, 0xC9, 0x1C, 0x55, 
+    0x08, 0xAC, 0x4C, 0x04, 0x00, 0xB0, 0x03, 0x5D, 0x18, 0x1F, 0x49, 0x11, 0x2B, 0x36, 0x8F, 
+    0x04, 0xFF, 0x10, 0xE3, 0x00, 0xF5, 0x9C, 0x1C, 0xD2, 0x2B, 0xA7, 0x0C, 0x9D, 0x2B, 0x7B, 
+    0x2C, 0x5C, 0xF8, 0x13, 0x23, 0x00, 0xFF, 0xE7, 0x05, 0x30, 0x12, 0x2C, 0x1F, 0x0F, 0x00, 
+    0x15, 0x2F, 0x2B, 0x02, 0x6B, 0x11, 0x34, 0x10, 0xF8, 0x1D, 0x4E, 0xF6, 0x4B, 0x01, 0x39, 
+    0x07, 0x22, 0x06, 0x97, 0x2D, 0x9E, 0x35, 0xC1, 0x10, 0x2C, 0x1C, 0x19, 0x9B, 0x9C, 0x9D, 
+    0x25, 0x16, 0x28, 0x38, 0xFF, 0x47, 0x16, 0x31, 0x11, 0x4C, 0x49, 0x07, 0x20, 0xE8, 0x2B, 
+    0x68, 0x2E, 0x6C, 0x10, 0x11, 0x00, 0xFB, 0x2E, 0x00, 0xFA, 0x2D, 0x01, 0x38, 0x18, 0xC3, 
+    0x11, 0x49, 0x3C, 0x2E, 0x00, 0xFE, 0x39, 0xFF, 0x15, 0x10, 0xF6, 0x11, 0x3F, 0x10, 0x47, 
+    0x38, 0xDA, 0x18, 0xBC, 0x39, 0x33, 0x17, 0x96, 0x1A, 0xFF, 0xE9, 0x29, 0x37, 0x03, 0xE9, 
+    0x02, 0x39, 0x00, 0xF1, 0x1D, 0x81, 0x02, 0xF8, 0x17, 0x72, 0x0E, 0xBF, 0x02, 0x07, 0x16, 
+    0x19, 0x72, 0x18, 0x19, 0x11, 0x1C, 0x0F, 0xFB, 0x00, 0x1D, 0x80, 0x14, 0xC7, 0xC5, 0x03, 
+    0xE2, 0x07, 0xD1, 0x07, 0xF6, 0xF5, 0x2B, 0x3F, 0x10, 0x70, 0x21, 0x4F, 0x93, 0x10, 0x98, 
+    0x23, 0x95, 0x00, 0xFF, 0x20, 0x1D, 0x4E, 0x01, 0x1B, 0x9D, 0xFF, 0xC6, 0x00, 0x96, 0x04, 
+    0x31, 0x0D, 0x27, 0x2E, 0x10, 0x10, 0xF6, 0x08, 0x64, 0x11, 0x70, 0x24, 0xF3, 0x7D, 0x22, 
+    0x03, 0x01, 0x03, 0x9C, 0x32, 0x07, 0x56, 0x07, 0x63, 0x2E, 0x0B, 0x00, 0xFF, 0x68, 0x01, 
+    0x1C, 0x18, 0x7D, 0x16, 0xB6, 0x06, 0xEF, 0x12, 0xA7, 0x28, 0x71, 0x16, 0xBF, 0x21, 0xFF, 
+    0x00, 0x3D, 0x74, 0x25, 0x15, 0x20, 0x7F, 0x30, 0xB8, 0x18, 0xD1, 0x20, 0xAF, 0x16, 0x31, 
+    0x23, 0xFF, 0xC3, 0x0C, 0x52, 0x05, 0x55, 0x06, 0x24, 0x24, 0xD1, 0x2A, 0xD8, 0x16, 0x51, 
+    0x00, 0xA9, 0x13, 0x7F, 0x48, 0x2A, 0x13, 0x20, 0x9D, 0x06, 0x23, 0x01, 0xD0, 0x0A, 0x3D, 
+    0x36, 0xAB, 0x06, 0x1C, 0x5F, 0x69, 0x16, 0x62, 0x02, 0xB4, 0x01, 0x0C, 0x05, 0x45, 0x1D, 
+    0x1E, 0x00, 0x02, 0x1F, 0x58, 0xF5, 0x02, 0x2B, 0xBE, 0x07, 0x48, 0x07, 0x1B, 0x0A, 0x3A, 
+    0x2B, 0x7E, 0x18, 0xFE, 0x10, 0x1B, 0x18, 0x3F, 0x25, 0x77, 0x10, 0x4A, 0x02, 0xEE, 0x11, 
+    0x01, 0x8E, 0x4E, 0x12, 0x10, 0xFF, 0x00, 0x55, 0x04, 0x1F, 0x8E, 0x9D, 0x9C, 0x00, 0xF8, 
+    0x8C, 0x1D, 0x1D, 0x55, 0x08, 0x1C, 0x01, 0xFB, 0x27, 0x00, 0x21, 0x28, 0x1D, 0x58, 0x2E, 
+    0x01, 0x18, 0x24, 0x1A, 0x54, 0x00, 0x1B, 0x61, 0x2F, 0x1C, 0xFD, 0x1D, 0x0A, 0x2E, 0x20, 
+    0x05, 0xB2, 0x20, 0x71, 0x00, 0xCE, 0x18, 0xA7, 0x10, 0x21, 0x18, 0xFF, 0xCF, 0x14, 0x6D, 
+    0x23, 0xE9, 0x10, 0x0A, 0x36, 0x54, 0x02, 0x48, 0x19, 0x50, 0x21, 0x21, 0x00, 0xFF, 0x28, 
+    0x3B, 0x08, 0x03, 0x92, 0x22, 0x0B, 0x31, 0x6A, 0x02, 0xC6, 0x2F, 0xD4, 0x13, 0xAC, 0x00, 
+    0xBF, 0x3C, 0x2F, 0x76, 0x2B, 0xA4, 0x02, 0xEC, 0x01, 0xB1, 0x10, 0x41, 0x11, 0xF6, 0xD6, 
+    0x08, 0xFF, 0x3D, 0x28, 0xFB, 0x1B, 0x1B, 0x1F, 0x54, 0x02, 0x48, 0x04, 0x73, 0x0E, 0x46, 
+    0x01, 0x70, 0x1B, 0x71, 0xD8, 0x12, 0x02, 0x02, 0x8C, 0x00, 0x01, 0xFC, 0x1B, 0x7D, 0x1E, 
+    0x9D, 0xF0, 0x1D, 0xF6, 0x2B, 0x2B, 0x4F, 0x00, 0x5F, 0x2E, 0x02, 0x15, 0x6E, 0x15, 0xEB, 
+    0x2A, 0x15, 0x53, 0x01, 0x1E, 0x38, 0x12, 0x9D, 0x2E, 0x04, 0x70, 0x01, 0x39, 0x01, 0x1D, 
+    0xFF, 0x26, 0x1D, 0xFF, 0x31, 0x52, 0x29, 0xF9, 0x49, 0x01, 0x5C, 0x03, 0x1E, 0x2B, 0xED, 
+    0x0C, 0x4D, 0x01, 0x4F, 0x02, 0x51, 0x01, 0x2E, 0xF6, 0x2B, 0xFF, 0x2C, 0x19, 0x36, 0x5F, 
+    0x90, 0x03, 0x6D, 0x00, 0x6C, 0x0B, 0xBE, 0x23, 0x6B, 0x11, 0xE8, 0x11, 0xFB, 0x3B, 0x10, 
+    0xC2, 0x11, 0x02, 0x83, 0x00, 0xBA, 0x2E, 0xBA, 0x18, 0xF3, 0x06, 0xD9, 0x16, 0xEF, 0x8B, 
+    0x15, 0x55, 0x25, 0x92, 0x22, 0x07, 0x12, 0x18, 0xCA, 0x27, 0x9B, 0x2C, 0xDF, 0x36, 0xFF, 
+    0x1B, 0x15, 0x46, 0x20, 0xC7, 0x0E, 0x98, 0x26, 0x35, 0x16, 0xC9, 0x24, 0x3D, 0x15, 0xB7, 
+    0x00, 0xFF, 0x1F, 0x29, 0x58, 0x1A, 0x7F, 0x18, 0x3B, 0x2B, 0xE0, 0x11, 0x94, 0x04, 0x77, 
+    0x03, 0x01, 0x02, 0xFF, 0xAA, 0x02, 0x24, 0x04, 0xDF, 0x13, 0xB8, 0x00, 0xAD, 0x02, 0x74, 
+    0x34, 0x5C, 0x2B, 0x86, 0x10, 0xDF, 0xBB, 0x03, 0x1F, 0x01, 0x1F, 0x00, 0xFF, 0x21, 0xD8, 
+    0x1F, 0x8E, 0x70, 0x10, 0x55, 0x00, 0x3C, 0x1E, 0xF6, 0x0F, 0x07, 0xCC, 0x4C, 0xB6, 0x10, 
+    0x7D, 0x04, 0x19, 0x29, 0xFE, 0x2B, 0xF2, 0x1A, 0xFA, 0x03, 0xF9, 0x2A, 0xFD, 0x19, 0x34, 
+    0x24, 0x1B, 0x21, 0xD3, 0x15, 0xF3, 0x07, 0x12, 0x6B, 0x08, 0x1D, 0x1E, 0x74, 0x0A, 0xD0, 
+    0x3B, 0x00, 0x1B, 0xF3, 0x35, 0x7F, 0x0C, 0x12, 0x25, 0x19, 0x43, 0x2C, 0xF9, 0x36, 0x2B, 
+    0x46, 0x8D, 0x28, 0x14, 0x20, 0x1C, 0xFC, 0x1C, 0x19, 0xC5, 0x4B, 0x10, 0x20, 0x14, 0x12, 
+    0x4B, 0x05, 0x47, 0x2F, 0xCD, 0x0F, 0xFF, 0x52, 0x3C, 0x8D, 0x10, 0xC8, 0x12, 0xC6, 0x27, 
+    0x50, 0x01, 0x3B, 0x27, 0xF8, 0x2B, 0x32, 0x1D, 0xFD, 0x15, 0x10, 0xF5, 0x11, 0x0B, 0xC7, 
+    0x15, 0x36, 0x04, 0x5B, 0x27, 0x0B, 0x1B, 0x6E, 0x02, 0xE0, 0xF5, 0x1E, 0xF5, 0xF6, 0x2B, 
+    0xB2, 0x0F, 0x4F, 0x20, 0xAD, 0x2B, 0xFF, 0x8D, 0x12, 0x23, 0x26, 0x99, 0x06, 0x4D, 0x0D, 
+    0xE8, 0x0A, 0x5A, 0x00, 0xF3, 0x05, 0x56, 0x23, 0x0F, 0x0C, 0x03, 0xFF, 0x14, 0xFA, 0x2E, 
+    0x6F, 0x11, 0x1F, 0x19, 0x03, 0x03, 0xFE, 0x9D, 0xD3, 0x15, 0x1A, 0x0B, 0xFF, 0x50, 0x32, 
+    0x00, 0x23, 0x11, 0xCC, 0x3C, 0x04, 0x22, 0xFF, 0xB7, 0x25, 0x6E, 0x10, 0x12, 0x00, 0x41, 
+    0x03, 0xFE, 0x3F, 0xCC, 0x30, 0xD7, 0x09, 0x2A, 0x11, 0x7F, 0x23, 0x24, 0xD2, 0x2A, 0x08, 
+    0x00, 0xF5, 0x18, 0xFF, 0x35, 0x8B, 0x04, 0xCC, 0x00, 0xF6, 0xFF, 0x62, 0x05, 0x0C, 0x00, 
+    0xF2, 0x11, 0xE5, 0x11, 0xCA, 0x11, 0x2A, 0x21, 0x29, 0x30, 0xF9, 0x13, 0xFF, 0xB9, 0x10, 
+    0x20, 0x23, 0x1B, 0x2C, 0x50, 0x3F, 0x32, 0x20, 0x20, 0x15, 0xFC, 0x11, 0x78, 0x17, 0xBF, 
+    0xB3, 0x17, 0x94, 0x27, 0xDC, 0x20, 0x90, 0x01, 0x0E, 0x00, 0x17, 0x04, 0xF6, 0xD3, 0x08, 
+    0xDC, 0x2B, 0x9C, 0x87, 0x24, 0x55, 0x19, 0x59, 0x00, 0xF6, 0x24, 0x0A, 0xFD, 0x11, 0xF5, 
+    0x00, 0x12, 0xF5, 0xF9, 0x01, 0x1C, 0xD0, 0x07, 0xFA, 0x01, 0xAB, 0x00, 0x01, 0x14, 0xF7, 
+    0xFF, 0x13, 0x74, 0x2E, 0x5F, 0x1B, 0x19, 0xF8, 0x14, 0xB9, 0x08, 0xF1, 0x0C, 0x66, 0x07, 
+    0xC0, 0x01, 0xF6, 0x1B, 0xF6, 0x5C, 0xF5, 0x31, 0x29, 0xD9, 0x25, 0xFF, 0x9D, 0x18, 0xB3, 
+    0x5C, 0x12, 0x0F, 0xD0, 0x21, 0x2F, 0x25, 0xBB, 0x20, 0xCC, 0x40, 0xD0, 0x15, 0x7F, 0x23, 
+    0x24, 0x82, 0x00, 0xAE, 0x1C, 0xC9, 0x1C, 0x17, 0x1C, 0x32, 0x20, 0xCC, 0x20, 0x1C, 0xFE, 
+    0x02, 0x7E, 0x09, 0x3C, 0x01, 0xA9, 0x38, 0x08, 0x28, 0x82, 0x13, 0x0B, 0x1C, 0x0A, 0x11, 
+    0xFB, 0xFD, 0x07, 0x23, 0x2F, 0x1C, 0x83, 0x01, 0x11, 0x01, 0x47, 0x22, 0x35, 0x00, 0x74, 
+    0x2A, 0x73, 0xB5, 0x00, 0xFD, 0x26, 0x1D, 0xF5, 0xFF, 0x05, 0xDA, 0x36, 0x00, 0x20, 0x8C, 
+    0x8D, 0x26, 0x27, 0x01, 0xE4, 0x10, 0x35, 0x14, 0x1F, 0x1F, 0x2B, 0x04, 0x02, 0xD7, 0x12, 
+    0x22, 0x9F, 0x10, 0xC0, 0x01, 0x9D, 0x1E, 0x13, 0x1D, 0xAB, 0x0B, 0xED, 0x00, 0x7B, 0xE6, 
+    0x12, 0xD6, 0x0D, 0x1C, 0x52, 0x05, 0x13, 0x00, 0x42, 0x19, 0x28, 0x00, 0x1B, 0xD8, 0x1C, 
+    0x18, 0x9B, 0xF0, 0x0A, 0x64, 0x13, 0x1F, 0x43, 0x02, 0x00, 0x03, 0xFB, 0xBB, 0x01, 0x4F, 
+    0x05, 0x02, 0x62, 0x20, 0xD6, 0x08, 0x30, 0x00, 0x4D, 0x30, 0xB9, 0x13, 0xFF, 0x13, 0x1B, 
+    0x9C, 0x00, 0x83, 0x2D, 0x0D, 0x2A, 0xB1, 0x10, 0x19, 0x1C, 0x1B, 0x3F, 0x23, 0x24, 0xDF, 
+    0x22, 0x1A, 0x08, 0x17, 0x26, 0x00, 0x1B, 0x00, 0xCC, 0x90, 0x19, 0x31, 0x3B, 0x39, 0x22, 
+    0x7F, 0x31, 0x25, 0x57, 0x11, 0xAC, 0x54, 0x1F, 0x02, 0x03, 0x05, 0x4A, 0x13, 0xF3, 0x32, 
+    0x1C, 0xFF, 0x79, 0x00, 0x5C, 0x22, 0x14, 0x20, 0x32, 0x17, 0x15, 0x16, 0xB1, 0x26, 0xBF, 
+    0x08, 0x00, 0x41, 0x0F, 0x37, 0x23, 0xE0, 0x01, 0x12, 0x02, 0x90, 0x18, 0xF5, 0x1F, 0xF5, 
+    0x2B, 0xEE, 0x2B, 0xB6, 0x05, 0x45, 0x17, 0x2C, 0x01, 0x1E, 0x29, 0x08, 0x45, 0x24, 0xFE, 
+    0x00, 0x7B, 0x5F, 0x18, 0x38, 0x04, 0x02, 0x3D, 0x03, 0x30, 0x23, 0xFF, 0x00, 0x7D, 0x12, 
+    0x19, 0xF3, 0xEC, 0x0C, 0x25, 0x0F, 0xF6, 0x1F, 0x40, 0x02, 0x6E, 0x0E, 0x44, 0x01, 0x4A, 
+    0x04, 0xF7, 0x00, 0x05, 0x62, 0x19, 0x32, 0x13, 0x1D, 0xCC, 0x4C, 0x6C, 0x12, 0x6B, 0x0A, 
+    0xB6, 0x2B, 0xFE, 0x1E, 0x85, 0x01, 0x03, 0x32, 0x13, 0x32, 0x1B, 0x2A, 0x16, 0x1B, 0x4D, 
+    0x25, 0xC3, 0x21, 0xFF, 0x28, 0x1D, 0x2F, 0x2C, 0xCC, 0x50, 0xB8, 0x11, 0x62, 0x08, 0x4B, 
+    0x18, 0x11, 0x14, 0x4A, 0x01, 0xFF, 0x79, 0x04, 0x01, 0x00, 0x4E, 0x05, 0xBC, 0x04, 0x11, 
+    0x2F, 0x4D, 0x3D, 0x53, 0x21, 0x4C, 0x00, 0xFE, 0x1F, 0xA6, 0x02, 0xC9, 0x2A, 0x32, 0x20, 
+    0x5E, 0x2C, 0x9F, 0x02, 0x06, 0x00, 0x5C, 0x25, 0x73, 0x02, 0x15, 0x9D, 0x12, 0x02, 0xF6, 
+    0x10, 0x25, 0x1A, 0x17, 0x13, 0x00, 0xF6, 0xC3, 0x99, 0x00, 0x84, 0x02, 0x9D, 0x9C, 0x9C, 
+    0x2E, 0xCF, 0x00, 0x53, 0x06, 0x63, 0xFE, 0x10, 0xE9, 0x01, 0x1C, 0x2E, 0x2B, 0xED, 0x02, 
+    0x44, 0x08, 0x2E, 0xEF, 0xCD, 0x11, 0x46, 0x1A, 0x02, 0x01, 0x41, 0x1A, 0x9D, 0xFD, 0x20, 
+    0xEC, 0x24, 0xFE, 0x20, 0xF3, 0x2C, 0x02, 0xFF, 0x35, 0x9D, 0x1E, 0x61, 0x2A, 0x44, 0x01, 
+    0xCC, 0x0C, 0xF0, 0x2E, 0xBF, 0x5C, 0x16, 0xC6, 0x22, 0xF0, 0x09, 0x04, 0x10, 0xF2, 0x2F, 
+    0x6F, 0x2D, 0x1C, 0xD9, 0x00, 0x7F, 0xF7, 0x40, 0xDE, 0x34, 0xEF, 0x11, 0x25, 0x13, 0x87, 
+    0x2D, 0xC8, 0x26, 0xF2, 0x23, 0x1F, 0xAE, 0x1D, 0xA3, 0x07, 0xA0, 0x16, 0x32, 0x01, 0x02, 
+    0xE7, 0x25, 0x1B, 0x80, 0x16, 0xFF, 0x2F, 0x22, 0x07, 0x13, 0x52, 0x1C, 0x02, 0x11, 0x49, 
+    0x11, 0x42, 0x10, 0x71, 0x20, 0x59, 0x20, 0x7F, 0x4F, 0x1C, 0x79, 0x02, 0xCD, 0x10, 0xF0, 
+    0x01, 0xA4, 0x04, 0x0B, 0x00, 0x07, 0x0B, 0x8E, 0x78, 0x1D, 0x8E, 0x2E, 0x0B, 0x10, 0x99, 
+    0x01, 0xDC, 0x2A, 0x13, 0x00, 0x1E, 0xFF, 0xBA, 0x2A, 0xBB, 0x0B, 0xE7, 0x06, 0x26, 0x0D, 
+    0x36, 0x10, 0x94, 0x16, 0x2C, 0x06, 0x87, 0x17, 0x39, 0xB2, 0x00, 0x02, 0xF5, 0x55, 0x0F, 
+    0xFF, 0x02, 0x0D, 0x01, 0x2B, 0x9C, 0xF0, 0x9C, 0x5A, 0x9C, 0x9D, 0xB0, 0x0A, 0x21, 0x1A, 
+    0x6F, 0x00, 0xFF, 0x30, 0xD9, 0x48, 0x14, 0x9D, 0x9C, 0x29, 0x04, 0x31, 0x02, 0x1E, 0x39, 
+    0x00, 0xF4, 0x01, 0xFF, 0x20, 0x25, 0x96, 0x00, 0xCE, 0x21, 0xDF, 0x17, 0xDE, 0x10, 0x7F, 
+    0x09, 0xCC, 0x10, 0xF6, 0x12, 0xFE, 0xF6, 0xCC, 0x20, 0x05, 0x1A, 0x1B, 0x1C, 0x20, 0x30, 
+    0x0B, 0x2D, 0xCD, 0x27, 0xCC, 0x30, 0xFD, 0x32, 0x20, 0x19, 0xCB, 0x16, 0xDF, 0x10, 0xE8, 
+    0x14, 0x94, 0x1B, 0xE4, 0x20, 0x2E, 0x18, 0xFF, 0x5E, 0x01, 0x5D, 0x10, 0xFE, 0x1A, 0x0E, 
+    0x1D, 0x5D, 0x01, 0xFE, 0x1B, 0x16, 0x1F, 0xF9, 0x1A, 0xFF, 0xD0, 0x26, 0xD0, 0x01, 0x14, 
+    0x11, 0xB0, 0x16, 0x25, 0x0C, 0x81, 0x0E, 0x08, 0x2A, 0x60, 0x08, 0xCF, 0x05, 0x0A, 0x0F, 
+    0x01, 0x02, 0x21, 0xCE, 0x03, 0xF5, 0x5C, 0xC1, 0x05, 0xB7, 0x08, 0x6E, 0x02, 0xBD, 0x19, 
+    0x38, 0x18, 0xB3, 0x28, 0x2E, 0x13, 0x02, 0x00, 0x10, 0x2B, 0xFC, 0x1C, 0x1E, 0xC8, 0x12, 
+    0x48, 0x02, 0xE9, 0x13, 0x41, 0x1D, 0xFE, 0x00, 0x51, 0x13, 0xFF, 0xD8, 0x10, 0x6B, 0x0E, 
+    0xF2, 0x0F, 0xF6, 0x2B, 0x2D, 0x05, 0x18, 0x00, 0xA0, 0x12, 0xD3, 0x2E, 0xFF, 0xBA, 0x1E, 
+    0xDF, 0x12, 0xAB, 0x2B, 0x94, 0x13, 0x16, 0x00, 0x94, 0x27, 0xCC, 0x20, 0x1B, 0x17, 0xFF, 
+    0x91, 0x10, 0xE3, 0x21, 0xD5, 0x26, 0xDC, 0x26, 0x4C, 0x05, 0x05, 0x18, 0x0A, 0x2D, 0x3D, 
+    0x10, 0xFF, 0x2C, 0x28, 0xF0, 0x24, 0xF6, 0x38, 0x3F, 0x25, 0xC5, 0x06, 0xD8, 0x16, 0x06, 
+    0x14, 0x7E, 0x16, 0xFF, 0xB0, 0x01, 0xAE, 0x20, 0x0C, 0x23, 0x53, 0x11, 0x04, 0x12, 0x39, 
+    0x30, 0x26, 0x2E, 0x50, 0x0D, 0xCF, 0xC0, 0x03, 0x0B, 0x1D, 0x06, 0x46, 0xC1, 0x00, 0x02, 
+    0x02, 0x7C, 0x17, 0x00, 0x42, 0xF2, 0x8C, 0x08, 0x28, 0x01, 0x1F, 0xD4, 0x13, 0x65, 0x00, 
+    0x53, 0x04, 0x53, 0x0A, 0xFD, 0x00, 0x00, 0x02, 0xD1, 0x1B, 0xF3, 0x0F, 0xE7, 0x10, 0x00, 
+    0x01, 0x2D, 0x01, 0x34, 0x32, 0xF7, 0x09, 0x20, 0x96, 0x2F, 0x23, 0x00, 0x01, 0x34, 0x02, 
+    0x45, 0x06, 0x5B, 0x13, 0xB0, 0x1B, 0xFF, 0x4A, 0x2F, 0x70, 0x09, 0xAE, 0x10, 0x94, 0x36, 
+    0xAB, 0x20, 0xE8, 0x42, 0xCB, 0x01, 0xCC, 0x90, 0xEF, 0xAA, 0x09, 0xED, 0x3C, 0xCF, 0x22, 
+    0x17, 0x14, 0x02, 0xB5, 0x1B, 0xD3, 0x18, 0xB6, 0x2E, 0xFF, 0xCA, 0x27, 0x24, 0x12, 0xF3, 
+    0x4F, 0x74, 0x20, 0x3F, 0x25, 0x1C, 0x23, 0x52, 0x0C, 0xEF, 0x21, 0xFF, 0x28, 0x11, 0x47, 
+    0x3A, 0x54, 0x2C, 0x32, 0x50, 0x32, 0x3D, 0xF3, 0x00, 0x92, 0x02, 0xB8, 0x10, 0xCF, 0xB9, 
+    0x18, 0x01, 0x13, 0x00, 0x20, 0xDB, 0x00, 0xF5, 0x1E, 0x95, 0x03, 0x16, 0x00, 0xF0, 0x1D, 
+    0xF5, 0x8C, 0xF5, 0x83, 0x0D, 0x90, 0x09, 0x96, 0x00, 0xFA, 0x01, 0xDB, 0xC3, 0x06, 0xF1, 
+    0x37, 0xF6, 0x0E, 0x07, 0x17, 0x0D, 0x1E, 0xFF, 0x20, 0xF5, 0x10, 0x5C, 0x4E, 0x4E, 0x32, 
+    0x31, 0xFF, 0x20, 0x2F, 0x36, 0x02, 0x0D, 0x00, 0x2E, 0xFF, 0x20, 0x0B, 0xFA, 0x12, 0x00, 
+    0x00, 0xC1, 0x15, 0x1A, 0x3D, 0x3A, 0x16, 0x7C, 0x10, 0xDE, 0x22, 0xFF, 0xCE, 0x25, 0xE9, 
+    0x33, 0xCA, 0x14, 0xFB, 0x34, 0xA2, 0x10, 0x63, 0x00, 0x34, 0x02, 0xD7, 0x2C, 0xEF, 0x7F, 
+    0x4B, 0xFC, 0x3F, 0x24, 0x17, 0x39, 0x35, 0x2B, 0x21, 0x21, 0x83, 0x01, 0x45, 0x21, 0xFF, 
+    0x3F, 0x36, 0x59, 0x1A, 0x3A, 0x3C, 0x63, 0x2F, 0x5C, 0x10, 0x15, 0x36, 0x1F, 0x32, 0xA0, 
+    0x2B, 0xFC, 0x1C, 0x02, 0xC4, 0x01, 0x01, 0x23, 0x52, 0x00, 0x23, 0x0A, 0xA2, 0x1C, 0x19, 
+    0x0C, 0x3F, 0x00, 0x23, 0xA8, 0x13, 0xF0, 0x12, 0xBA, 0x01, 0x2B, 0x07, 0xC1, 0x07, 0x01, 
+    0x8E, 0xBE, 0xF5, 0x69, 0x1B, 0xE3, 0x04, 0x74, 0x06, 0xDB, 0x20, 0x5F, 0x00, 0x4E, 0x26, 
+    0x04, 0xEF, 0x05, 0x06, 0xD1, 0x30, 0xE4, 0x02, 0x2F, 0x22, 0x4E, 0x03, 0x31, 0x1A, 0x00, 
+    0xB0, 0x22, 0xF9, 0x02, 0x15, 0x02, 0x9D, 0x59, 0x15, 0xB3, 0x1F, 0xBF, 0x17, 0x3A, 0x17, 
+    0xF2, 0x24, 0x7F, 0x51, 0x1D, 0xD2, 0x17, 0x87, 0x22, 0xA4, 0x45, 0x9B, 0x26, 0xEC, 0x27, 
+    0x04, 0x25, 0xF5, 0xFB, 0xCD, 0x04, 0xE4, 0x05, 0x1B, 0xA2, 0x0B, 0xA7, 0x3E, 0xE1, 0x1E, 
+    0xD1, 0x3E, 0x1F, 0x3C, 0xFB, 0x38, 0x10, 0xCA, 0x10, 0xF6, 0xF7, 0x10, 0x8C, 0x34, 0x0C, 
+    0x15, 0x57, 0x37, 0x59, 0x07, 0xFF, 0xEA, 0x29, 0x0E, 0x11, 0x09, 0x24, 0x50, 0x01, 0x51, 
+    0x36, 0x15, 0x00, 0x32, 0x00, 0x54, 0x43, 0xFE, 0x1E, 0x3C, 0x00, 0x1E, 0x2F, 0x30, 0x18, 
+    0xF6, 0x1A, 0xE1, 0x06, 0x00, 0x01, 0x05, 0x00, 0xE3, 0xEE, 0x12, 0x0B, 0x05, 0xF6, 0x8B, 
+    0x19, 0xD6, 0x03, 0x0C, 0x0C, 0x41, 0x00, 0xC7, 0x91, 0x12, 0x7A, 0x1E, 0xEF, 0x01, 0x1D, 
+    0x4E, 0x4E, 0xCB, 0x00, 0x2E, 0x2A, 0xC7, 0xFE, 0x00, 0xFA, 0x02, 0x3B, 0x02, 0x4E, 0x4E, 
+    0x8E, 0xFF, 0x10, 0x0B, 0x05, 0xC3, 0x2E, 0x02, 0x5D, 0x1C, 0x1D, 0x02, 0xF5, 0x9D, 0x15, 
+    0x09, 0xFC, 0x11, 0xFF, 0xCB, 0x2A, 0x88, 0x25, 0xBF, 0x21, 0x7F, 0x00, 0x83, 0x1B, 0x9A, 
+    0x03, 0xF9, 0x30, 0xEC, 0x18, 0xFF, 0x8F, 0x19, 0xCC, 0x00, 0xD8, 0x10, 0x03, 0x29, 0x6F, 
+    0x22, 0x2D, 0x05, 0x25, 0x24, 0xFF, 0x24, 0xFF, 0xBC, 0x29, 0x49, 0x07, 0xCC, 0x60, 0xFF, 
+    0x07, 0x1E, 0x4E, 0x32, 0x37, 0x3F, 0x25, 0xFE, 0x01, 0xFF, 0xF6, 0x05, 0x45, 0x20, 0x52, 
+    0x4C, 0x44, 0x2C, 0x72, 0x24, 0x5A, 0x12, 0x18, 0x20, 0x03, 0x38, 0x7F, 0xCD, 0x04, 0xBE, 
+    0x2B, 0x38, 0x01, 0xC5, 0x17, 0x94, 0x1B, 0x0A, 0x3A, 0x10, 0x1F, 0x2E, 0x8C, 0xF5, 0x2B, 
+    0xF7, 0x00, 0x00, 0x08, 0x8B, 0xF6, 0x01, 0xEE, 0x08, 0xFB, 0x04, 0x06, 0x97, 0x13, 0xF5, 
+    0xE9, 0x09, 0x5D, 0x29, 0xB2, 0x28, 0x31, 0x10, 0x41, 0x10, 0xE9, 0xF5, 0x23, 0x1F, 0x4E, 
+    0x04, 0x11, 0x1F, 0x0C, 0x12, 0xC8, 0x04, 0xF8, 0x07, 0xFE, 0x2B, 0x22, 0x06, 0x4B, 0x00, 
+    0x55, 0x02, 0x30, 0x0B, 0xE7, 0x02, 0xBE, 0x2F, 0xCC, 0x5C, 0xFF, 0x4C, 0x00, 0xCF, 0x11, 
+    0xAB, 0x44, 0xFD, 0x11, 0x63, 0x2F, 0xCC, 0x20, 0xD0, 0x13, 0xCA, 0x29, 0xFE, 0x01, 0x16, 
+    0x18, 0x38, 0x12, 0x36, 0x10, 0x22, 0x24, 0x0A, 0x1B, 0xBE, 0x25, 0x32, 0x11, 0x0F, 0x30, 
+    0x10, 0x84, 0x18, 0x1E, 0x22, 0x15, 0x11, 0x1B, 0x1B, 0x1F, 0x1B, 0xFF, 0x38, 0x04, 0x52, 
+    0x0C, 0x30, 0x10, 0x45, 0x12, 0x9A, 0x05, 0x55, 0x33, 0x39, 0x2C, 0x38, 0x10, 0xFF, 0x32, 
+    0x30, 0x72, 0x16, 0xF3, 0x02, 0x22, 0x11, 0x88, 0x13, 0xCA, 0x0C, 0xEB, 0x01, 0xA4, 0x00, 
+    0x63, 0xAF, 0x01, 0x04, 0x44, 0x1F, 0x2E, 0x02, 0xF7, 0x14, 0xBF, 0x04, 0xF5, 0x35, 0xC6, 
+    0x13, 0x2B, 0x17, 0x0F, 0x2E, 0xC3, 0x0A, 0xFE, 0x30, 0x1D, 0x1D, 0x9E, 0x4E, 0x06, 0x2B, 
+    0x3C, 0x12, 0x25, 0x05, 0x42, 0x24, 0x4E, 0x4E, 0x09, 0x02, 0x7F, 0x00, 0x13, 0x0D, 0x05, 
+    0x36, 0x03, 0x0D, 0x07, 0x1E, 0x0F, 0x25, 0x0F, 0x5B, 0x0A, 0x01, 0xFF, 0xE7, 0x0C, 0xDC, 
+    0x2E, 0x5F, 0x2B, 0x76, 0x2B, 0xE7, 0x12, 0xF7, 0x33, 0xBF, 0x39, 0x8C, 0x24, 0x1F, 0xD3, 
+    0x1D, 0x9F, 0x2E, 0xE4, 0x27, 0x5C, 0x22, 0x2B, 0x14, 0x1E, 0x1E, 0x2E, 0xFE, 0x1E, 0x33, 
+    0x3C, 0xC6, 0x36, 0x26, 0x35, 0x38, 0x11, 0x76, 0x17, 0xE5, 0x22, 0x31, 0x22, 0xFD, 0x06, 
+    0x3A, 0x2E, 0xAA, 0x04, 0xF9, 0x17, 0xB6, 0x00, 0x26, 0x31, 0xE9, 0x12, 0x07, 0x22, 0x7F, 
+    0xF2, 0x28, 0x76, 0x26, 0x77, 0x22, 0x03, 0x2C, 0x07, 0x1A, 0x14, 0x11, 0x0C, 0x00, 0xF6, 
+    0x47, 0x98, 0x10, 0xB2, 0x10, 0x04, 0x32, 0x01, 0x01, 0x2B, 0xF1, 0x06, 0x01, 0x1A, 0x8B, 
+    0xD5, 0x06, 0x1E, 0xDC, 0x07, 0xE5, 0x18, 0x1C, 0xF5, 0x1B, 0xFF, 0xC4, 0x44, 0x05, 0x2B, 
+    0x00, 0x33, 0x80, 0x1C, 0xEA, 0x03, 0xF5, 0x37, 0x0C, 0x31, 0xFF, 0x00, 0x9E, 0x02, 0x49, 
+    0x09, 0x53, 0x1A, 0xF8, 0x24, 0xCC, 0x4C, 0x1C, 0x1A, 0x8A, 0x26, 0xFF, 0xE2, 0x25, 0xF4, 
+    0x10, 0xBB, 0x29, 0xB9, 0x11, 0x84, 0x11, 0x8E, 0x16, 0xCC, 0x80, 0xCF, 0x36, 0xFF, 0x0F, 
+    0x10, 0x25, 0x23, 0x55, 0x08, 0xCC, 0x30, 0x44, 0x22, 0x8E, 0x1C, 0xCC, 0x10, 0x08, 0x0C, 
+    0xFF, 0x27, 0x22, 0xFC, 0x20, 0x2E, 0x03, 0xA0, 0x05, 0xF8, 0x13, 0xBE, 0x1D, 0xE1, 0x0A, 
+    0x9C, 0x02, 0xFF, 0x50, 0x5F, 0x14, 0x10, 0xE9, 0x00, 0x0C, 0x19, 0x32, 0x60, 0x2C, 0x14, 
+    0xA3, 0x00, 0x6B, 0x3E, 0x7B, 0xD5, 0x1F, 0x0C, 0x1E, 0xF5, 0xCE, 0x07, 0x08, 0x06, 0xAD, 
+    0x09, 0xBA, 0x00, 0x1E, 0x8F, 0xC4, 0x1B, 0x09, 0x11, 0xFD, 0x02, 0xFF, 0x00, 0x5C, 0xF5, 
+    0x1B, 0x86, 0x11, 0x7F, 0x01, 0x1B, 0xFD, 0x20, 0x35, 0x2F, 0x0D, 0x21, 0x1F, 0x02, 0x01, 
+    0x04, 0x31, 0x1A, 0x1F, 0xFC, 0xF6, 0x8E, 0xEB, 0x1B, 0x34, 0x05, 0x46, 0x33, 0x01, 0x09, 
+    0x33, 0x0F, 0x9C, 0x36, 0xDF, 0x28, 0x11, 0x6F, 0x10, 0x7A, 0x27, 0x06, 0x19, 0xE6, 0x10, 
+    0xF5, 0x92, 0x14, 0xBF, 0x12, 0xFF, 0x9C, 0x21, 0xC2, 0x46, 0xF7, 0x50, 0xCC, 0x40, 0x3E, 
+    0x01, 0x4A, 0x03, 0x33, 0x23, 0xCC, 0x20, 0xFB, 0x32, 0x00, 0xCC, 0x20, 0x1D, 0x08, 0x2D, 
+    0x33, 0x2A, 0x83, 0x2B, 0x53, 0x37, 0x66, 0x12, 0xFF, 0x2E, 0x00, 0x65, 0x1B, 0x35, 0x01, 
+    0x4B, 0x22, 0x5F, 0x23, 0x1F, 0x00, 0x5D, 0x04, 0xD4, 0x15, 0xBF, 0x3D, 0x25, 0x14, 0x17, 
+    0x8E, 0x25, 0x06, 0x28, 0x09, 0x29, 0x57, 0x16, 0x1E, 0x06, 0x09, 0xEB, 0x0A, 0x19, 0x06, 
+    0x34, 0x1D, 0x0D, 0x23, 0x02, 0x03, 0x03, 0x07, 0x3A, 0xAC, 0x36, 0x3F, 0xEA, 0x31, 0x3F, 
+    0x1A, 0xFF, 0x00, 0x0A, 0x11, 0xFF, 0x10, 0xF9, 0x01, 0x1E, 0xF6, 0xF9, 0xBA, 0x0A, 0xF5, 
+    0x02, 0x37, 0x04, 0x3E, 0x30, 0x12, 0x01, 0x0A, 0x14, 0x62, 0x2B, 0xFF, 0xBD, 0x2F, 0xCE, 
+    0x1D, 0x6D, 0x10, 0xCC, 0x7C, 0x77, 0x17, 0xD2, 0x10, 0x80, 0x03, 0xEC, 0x20, 0xFF, 0xF8, 
+    0x22, 0x81, 0x2F, 0x0A, 0x30, 0x8E, 0x1C, 0xCC, 0x20, 0x7B, 0x02, 0x1E, 0x21, 0xAC, 0x22, 
+    0xFF, 0xFF, 0x25, 0x90, 0x06, 0xE9, 0x02, 0x0F, 0x16, 0x09, 0x21, 0xC8, 0x11, 0x34, 0x20, 
+    0x0E, 0x21, 0xFF, 0xFE, 0x17, 0xE7, 0x10, 0x10, 0x2E, 0xE5, 0x2E, 0xEE, 0x2E, 0xEF, 0x10, 
+    0x32, 0x20, 0x62, 0x20, 0x7F, 0x3C, 0x1E, 0x2E, 0x3D, 0x6A, 0x14, 0x64, 0x1E, 0x9C, 0x00, 
+    0x30, 0x04, 0x02, 0x12, 0x1E, 0xFF, 0x06, 0x34, 0x05, 0x20, 0x07, 0x0F, 0xFE, 0x01, 0x00, 
+    0x00, 0x00, 0x16, 0xF4, 0x13, 0xEB, 0x52, 0x3F, 0x5E, 0x00, 0x47, 0x1E, 0xFD, 0x02, 0xFF, 
+    0x00, 0xFE, 0x00, 0xEC, 0x09, 0x2B, 0x2B, 0xFE, 0x2B, 0xF4, 0x14, 0x3C, 0x21, 0x55, 0x1E, 
+    0xE8, 0x3E, 0x63, 0x13, 0xCE, 0x22, 0x79, 0x55, 0xFF, 0x80, 0x06, 0xD9, 0x1F, 0x16, 0x17, 
+    0x0D, 0x11, 0x99, 0x30, 0x2A, 0x13, 0xCE, 0x3D, 0x9B, 0x29, 0xBF, 0xD6, 0x35, 0xCC, 0x40, 
+    0x0C, 0x33, 0xE3, 0x10, 0x49, 0x34, 0x32, 0x20, 0x02, 0x33, 0x01, 0xFF, 0x45, 0x29, 0x42, 
+    0x20, 0x0B, 0x00, 0x66, 0x00, 0xFB, 0x1C, 0x27, 0x1B, 0x34, 0x1D, 0x16, 0x10, 0xFF, 0x20, 
+    0x29, 0x34, 0x1A, 0x3B, 0x10, 0x36, 0x2A, 0x25, 0x32, 0x09, 0x16, 0x05, 0x23, 0xFC, 0x36, 
+    0x7F, 0x38, 0x00, 0x01, 0x05, 0x11, 0x03, 0x5C, 0x2A, 0xB2, 0x26, 0x12, 0x4F, 0xB6, 0x1D, 
+    0x01, 0xFD, 0xD7, 0x10, 0x02, 0xA2, 0x16, 0x1F, 0x2E, 0x2A, 0x1C, 0xE2, 0x11, 0x91, 0x00, 
+    0x08, 0x11, 0xC3, 0xFF, 0x20, 0x1A, 0x03, 0xF5, 0x02, 0x02, 0x02, 0x0F, 0x15, 0x36, 0x50, 
+    0xFF, 0x01, 0x02, 0xDC, 0x0C, 0xAC, 0x11, 0x80, 0x23, 0x8C, 0x23, 0x3F, 0x21, 0x75, 0x10, 
+    0x06, 0x59, 0xFF, 0xC2, 0x12, 0x80, 0x24, 0xAF, 0x12, 0xCC, 0x30, 0xB2, 0x2C, 0xCC, 0x00, 
+    0x8B, 0x0B, 0x24, 0x30, 0x9F, 0xFD, 0x10, 0x32, 0x29, 0xAC, 0x28, 0xD0, 0x10, 0xC8, 0x25, 
+    0x2E, 0x19, 0xF5, 0x28, 0xFF, 0xDA, 0x25, 0xC9, 0x21, 0x43, 0x29, 0xDF, 0x03, 0x2A, 0x02, 
+    0xDD, 0x11, 0x3B, 0x3D, 0x06, 0x01, 0xFD, 0xD2, 0x01, 0x02, 0x34, 0x26, 0x18, 0x2D, 0x32, 
+    0x10, 0x29, 0x24, 0x13, 0x17, 0x6C, 0x23, 0xFF, 0xB2, 0x16, 0x7A, 0x15, 0x02, 0x01, 0x13, 
+    0x00, 0x8B, 0x02, 0xE0, 0x11, 0x02, 0x01, 0x0D, 0x18, 0xFF, 0x15, 0x02, 0xCD, 0x40, 0x11, 
+    0x06, 0x77, 0x1F, 0xFF, 0x27, 0x03, 0x00, 0xEA, 0x06, 0x42, 0x35, 0xFF, 0x0E, 0x00, 0x42, 
+    0x10, 0x2D, 0x52, 0x39, 0x15, 0x03, 0x01, 0xC5, 0x0C, 0x84, 0x37, 0x61, 0x39, 0xFF, 0x7D, 
+    0x1C, 0x6E, 0x10, 0x9D, 0x32, 0xC0, 0x17, 0xF9, 0x00, 0x79, 0x12, 0x54, 0x00, 0xDE, 0x3A, 
+    0xFF, 0x99, 0x30, 0xAE, 0x2B, 0xCC, 0x00, 0xBB, 0x11, 0x27, 0x1D, 0xCC, 0x10, 0x2F, 0x00, 
+    0xFA, 0x13, 0xFF, 0xA7, 0x31, 0xBE, 0x15, 0x32, 0x30, 0x3A, 0x00, 0x16, 0x13, 0xF3, 0x38, 
+    0x32, 0x27, 0x08, 0x21, 0xFF, 0xB1, 0x0E, 0xE3, 0x2D, 0x6D, 0x21, 0xF6, 0x23, 0x42, 0x00, 
+    0x76, 0x15, 0xEF, 0x1C, 0x77, 0x21, 0xFF, 0x22, 0x12, 0x33, 0x29, 0x25, 0x05, 0xBE, 0x29, 
+    0x93, 0x11, 0x1E, 0x12, 0x54, 0x21, 0x0E, 0x24, 0xFF, 0xD7, 0x17, 0xCE, 0x07, 0x12, 0x1B, 
+    0x14, 0x4A, 0x00, 0x10, 0x78, 0x00, 0xF0, 0x2A, 0xFF, 0x00, 0xFF, 0x19, 0x10, 0x97, 0x06, 
+    0x93, 0x10, 0x47, 0x2D, 0x18, 0x01, 0xF6, 0x61, 0x34, 0x01, 0x35, 0x32, 0xFF, 0x8E, 0x4E, 
+    0x65, 0x30, 0x6B, 0x19, 0xBE, 0x14, 0xF7, 0x2A, 0x34, 0x2F, 0x15, 0x01, 0x0D, 0x0C, 0xFC, 
+    0x2E, 0x01, 0x78, 0x17, 0xBC, 0x33, 0xB2, 0x23, 0xCC, 0x28, 0x2A, 0x33, 0x63, 0x1F, 0xBF, 
+    0xCA, 0x2C, 0xF5, 0x10, 0x16, 0x16, 0xD7, 0x1D, 0x05, 0x28, 0x50, 0x28, 0x1A, 0xC8, 0x1B, 
+    0xFF, 0xD5, 0x38, 0xE3, 0x16, 0xDD, 0x22, 0x1E, 0x21, 0x4B, 0x10, 0xF1, 0x4E, 0x35, 0x22, 
+    0x23, 0x30, 0xFF, 0xDA, 0x13, 0xEE, 0x13, 0x32, 0x20, 0xBC, 0x18, 0x07, 0x26, 0x5E, 0x01, 
+    0xA4, 0x02, 0x00, 0x06, 0xDB, 0xCA, 0x03, 0xFC, 0x01, 0xF6, 0x32, 0x12, 0x0A, 0x11, 0x1F, 
+    0xD8, 0x19, 0x38, 0x04, 0xFF, 0x07, 0x22, 0xCF, 0x35, 0xF0, 0x02, 0xD6, 0x03, 0x05, 0x2B, 
+    0x08, 0x24, 0x54, 0x27, 0x2A, 0x11, 0xFF, 0x48, 0x09, 0x19, 0x00, 0x00, 0x42, 0x3F, 0x27, 
+    0x78, 0x10, 0x7F, 0x12, 0x7C, 0x10, 0x6D, 0x14, 0xFF, 0x46, 0x00, 0x7F, 0x30, 0x9C, 0x2F, 
+    0x3A, 0x00, 0xD9, 0x00, 0xBD, 0x39, 0x02, 0x13, 0x7F, 0x12, 0xFF, 0x8F, 0x13, 0x91, 0x4E, 
+    0x82, 0x10, 0x03, 0x25, 0xCC, 0x30, 0xE6, 0x01, 0xF4, 0x18, 0xCC, 0x20, 0xFF, 0xD1, 0x3B, 
+    0x9D, 0x00, 0x4C, 0x00, 0xFB, 0x1B, 0xE2, 0x16, 0x1D, 0x10, 0xAA, 0x16, 0xEF, 0x11, 0xFF, 
+    0x64, 0x22, 0xE0, 0x00, 0x58, 0x10, 0x72, 0x00, 0xEC, 0x15, 0x37, 0x37, 0xB8, 0x25, 0xB2, 
+    0x10, 0xEE, 0x02, 0x1A, 0x22, 0x7F, 0x12, 0xFA, 0x33, 0xF5, 0xD4, 0x16, 0x1F, 0x1D, 0x9C, 
+    0x3D, 0x7F, 0x8B, 0x36, 0x12, 0x02, 0xFF, 0x00, 0x65, 0x22, 0x11, 0x16, 0x18, 0x3E, 0xDB, 
+    0x00, 0xF5, 0x1F, 0xD6, 0x01, 0x17, 0x11, 0x51, 0x00, 0x11, 0x31, 0xFE, 0x4C, 0xF5, 0x1D, 
+    0x1B, 0xFF, 0xFF, 0x52, 0x0A, 0x1C, 0x5B, 0x11, 0x11, 0x02, 0x8A, 0x2B, 0xED, 0x2B, 0x65, 
+    0x00, 0x3A, 0x08, 0xFF, 0xDE, 0x20, 0x90, 0x10, 0xCC, 0x3C, 0x99, 0x4E, 0xD9, 0x0D, 0x7F, 
+    0x20, 0xC1, 0x2C, 0xE1, 0x25, 0xFF, 0xF2, 0x1C, 0xCC, 0x40, 0xC2, 0x1D, 0xC4, 0x28, 0xCC, 
+    0x40, 0x27, 0x12, 0x1F, 0x11, 0x32, 0x00, 0xFF, 0x04, 0x00, 0x08, 0x03, 0x42, 0x29, 0x55, 
+    0x35, 0x3E, 0x25, 0x27, 0x00, 0xEC, 0x21, 0x2E, 0x1E, 0xFF, 0x5F, 0x23, 0x63, 0x2C, 0x66, 
+    0x20, 0x39, 0x2C, 0x4B, 0x25, 0x75, 0x2C, 0x08, 0x28, 0x47, 0x06, 0xFD, 0xF2, 0x04, 0x02, 
+    0xF8, 0x01, 0x01, 0x0A, 0xA8, 0x22, 0x89, 0x29, 0xAA, 0x17, 0x0F, 0x00, 0x3F, 0x70, 0x1C, 
+    0x53, 0x10, 0xD4, 0x11, 0xDD, 0x20, 0x11, 0x09, 0xF2, 0x24, 0x1D, 0x9D, 0xE7, 0x26, 0x49, 
+    0x0F, 0x0B, 0x41, 0x10, 0x2E, 0xF6, 0xFF, 0x00, 0x17, 0x02, 0x27, 0x20, 0xFF, 0xA9, 0x1B, 
+    0x7F, 0x2D, 0x93, 0x3B, 0xBA, 0x11, 0x1F, 0x04, 0x44, 0x0B, 0x97, 0x2C, 0x5A, 0x11, 0xFD, 
+    0xD7, 0x45, 0xF5, 0x85, 0x20, 0x15, 0x24, 0x16, 0x01, 0xC3, 0x06, 0xCD, 0x27, 0x14, 0x19, 
+    0xFF, 0xE8, 0x2C, 0xE4, 0x02, 0x0A, 0x3B, 0xCC, 0x00, 0x48, 0x20, 0xB0, 0x30, 0x0A, 0x19, 
+    0xD1, 0x11, 0xD8, 0x1C, 0x1C, 0x18, 0xDC, 0x60, 0xFF, 0x20, 0x01, 0x25, 0x00, 0x58, 0x02, 
+    0xFF, 0x8E, 0x23, 0xE8, 0x28, 0x63, 0x02, 0x1B, 0x30, 0x39, 0x2D, 0x4A, 0x2F, 0x47, 0x2B, 
+    0x58, 0x3B, 0x3B, 0x6A, 0x14, 0x34, 0x00, 0x1E, 0x3C, 0x24, 0x13, 0x1B, 0x00, 0x34, 0x01, 
+    0xF5, 0xFE, 0x01, 0xE5, 0x0A, 0xA5, 0x00, 0x0C, 0x15, 0xA0, 0x11, 0x53, 0x11, 0x14, 0x2D, 
+    0xE1, 0x00, 0xF7, 0x03, 0x07, 0x1C, 0x00, 0xD8, 0x07, 0x9D, 0xED, 0x53, 0xFF, 0x25, 0x14, 
+    0x01, 0xFF, 0x00, 0xAF, 0x11, 0x17, 0xFE, 0x00, 0x59, 0x13, 0xBC, 0x13, 0x02, 0xB9, 0x15, 
+    0x1D, 0x35, 0x27, 0xFF, 0x65, 0x10, 0xB4, 0x4D, 0xC7, 0x32, 0x00, 0x20, 0xCC, 0x0C, 0xF3, 
+    0x15, 0x8C, 0x24, 0xD4, 0x15, 0xFF, 0x12, 0x20, 0xA9, 0x11, 0xB8, 0x1F, 0xCC, 0x40, 0xC6, 
+    0x13, 0xB5, 0x39, 0x02, 0x15, 0x39, 0x12, 0xEF, 0x01, 0x04, 0x95, 0x21, 0x00, 0x10, 0x28, 
+    0x16, 0x1F, 0xD0, 0x02, 0x6F, 0x21, 0xFA, 0x37, 0xFD, 0x68, 0x3D, 0x1F, 0xD5, 0x10, 0x09, 
+    0x2C, 0x31, 0x2F, 0xA8, 0x1C, 0x50, 0x12, 0x07, 0x26, 0xCF, 0x21, 0x00, 0x04, 0x02, 0x7C, 
+    0x13, 0x19, 0x11, 0x1E, 0x1E, 0x40, 0x33, 0x89, 0x28, 0xFF, 0xFD, 0x32, 0x29, 0x05, 0xD3, 
+    0x04, 0xBB, 0x08, 0x94, 0x2C, 0x7D, 0x3F, 0xFF, 0x41, 0x0C, 0x1E, 0xB9, 0x20, 0x1A, 0x1F, 
+    0x02, 0xE9, 0x33, 0xED, 0x02, 0x00, 0x15, 0xF6, 0xFF, 0x00, 0x7F, 0xEE, 0x16, 0x4C, 0x10, 
+    0x63, 0x26, 0xA7, 0x43, 0x65, 0x10, 0xCE, 0x20, 0x37, 0x05, 0x1B, 0xFF, 0x63, 0x15, 0xBC, 
+    0x16, 0xD5, 0x11, 0xCE, 0x2B, 0x0C, 0x31, 0x08, 0x29, 0x6B, 0x00, 0x5C, 0x16, 0xBF, 0x01, 
+    0x23, 0x71, 0x20, 0xFD, 0x00, 0xE2, 0x2C, 0x4F, 0x20, 0xCC, 0x00, 0x1C, 0xCC, 0x00, 0xC7, 
+    0x6F, 0x15, 0xC7, 0x16, 0x32, 0x40, 0x2E, 0x01, 0x03, 0xD9, 0x24, 0xE6, 0x25, 0x7D, 0x24, 
+    0x23, 0x01, 0x85, 0x00, 0x82, 0x01, 0x24, 0x01, 0xDA, 0x28, 0x9D, 0x08, 0x1E, 0xFF, 0xFA, 
+    0x05, 0x6A, 0x12, 0x51, 0x3D, 0x8F, 0x34, 0x5E, 0x3A, 0x7E, 0x3A, 0xCD, 0x03, 0x85, 0x2F, 
+    0xFF, 0x51, 0x1B, 0x65, 0x0C, 0xDD, 0x00, 0x69, 0x3F, 0xC0, 0x23, 0x5F, 0x1F, 0x32, 0x4D, 
+    0x0E, 0x17, 0xFF, 0xDA, 0x22, 0xE9, 0x04, 0x19, 0x26, 0xFF, 0x30, 0x11, 0x05, 0xFF, 0x4A, 
+    0xFF, 0x13, 0xD6, 0x13, 0xFF, 0xBD, 0x38, 0xCC, 0x3C, 0xE6, 0x22, 0xF4, 0x10, 0x4D, 0x18, 
+    0x9D, 0x27, 0xE0, 0x00, 0xC4, 0x00, 0xFF, 0xC9, 0x21, 0x27, 0x21, 0xE1, 0x30, 0xAE, 0x32, 
+    0x0A, 0x11, 0xCC, 0x30, 0x23, 0x15, 0xC4, 0x01, 0xFF, 0x40, 0x00, 0xB9, 0x28, 0xB7, 0x22, 
+    0xA4, 0x00, 0x9D, 0x00, 0x33, 0x00, 0x37, 0x13, 0xCC, 0x40, 0x9F, 0x61, 0x22, 0x11, 0x22, 
+    0x62, 0x1B, 0xE1, 0x32, 0xFE, 0x02, 0x2E, 0xF6, 0xDE, 0x01, 0xFF, 0x72, 0x3B, 0x80, 0x11, 
+    0x29, 0x04, 0x7F, 0x00, 0xC3, 0x01, 0x96, 0x0A, 0x51, 0x13, 0x4B, 0x00, 0xFF, 0x32, 0x10, 
+    0x15, 0x12, 0x73, 0x01, 0x67, 0x14, 0x31, 0x13, 0xEB, 0x00, 0x90, 0x16, 0x14, 0x10, 0x7F, 
+    0x3D, 0x05, 0x29, 0x33, 0x7A, 0x04, 0x9D, 0x12, 0x30, 0x21, 0xD1, 0x10, 0x13, 0x0A, 0x1F, 
+    0xBA, 0x1B, 0x0C, 0x21, 0x8E, 0xFF, 0x43, 0xED, 0x12, 0x00, 0x20, 0x2E, 0xE1, 0x0D, 0xFE, 
+    0x1E, 0x6D, 0x23, 0xDA, 0x15, 0x32, 0x30, 0xE6, 0x25, 0x13, 0x10, 0xB3, 0x01, 0x59, 0x12, 
+    0xFF, 0x5C, 0x05, 0xCA, 0x3A, 0x65, 0x30, 0x66, 0x10, 0x16, 0x01, 0x75, 0x15, 0x2A, 0x1A, 
+    0xEC, 0x00, 0xFF, 0x92, 0x1B, 0xFC, 0x14, 0xCB, 0x11, 0xE5, 0x20, 0xCC, 0x40, 0x81, 0x11, 
+    0x25, 0x13, 0x06, 0x02, 0xFE, 0x02, 0x89, 0x12, 0x46, 0x13, 0x74, 0x16, 0x5A, 0x25, 0x19, 
+    0x11, 0x37, 0x00, 0x50, 0x24, 0xFF, 0x1B, 0x10, 0xBA, 0x29, 0x62, 0x14, 0xCA, 0x0A, 0x72, 
+    0x02, 0x75, 0x28, 0x03, 0x23, 0x42, 0x2B, 0xFF, 0x3B, 0x13, 0xFA, 0x16, 0x2C, 0x11, 0xA4, 
+    0x10, 0x09, 0x25, 0x90, 0x28, 0x1F, 0x08, 0x9F, 0x1B, 0xFF, 0x48, 0x00, 0x9E, 0x01, 0x19, 
+    0x10, 0x9B, 0x13, 0xBB, 0x16, 0xB2, 0x22, 0x84, 0x27, 0xF3, 0x19, 0x1F, 0x03, 0x0D, 0xFF, 
+    0x60, 0x02, 0x20, 0x32, 0x15, 0xFF, 0x11, 0x9D, 0x1E, 0x8E, 0xFF, 0xDF, 0x25, 0x32, 0x30, 
+    0xC8, 0x20, 0x8D, 0x23, 0xBA, 0x20, 0x01, 0x11, 0xEE, 0x46, 0x97, 0x0C, 0xFF, 0xF3, 0x12, 
+    0x65, 0x30, 0x4F, 0x2C, 0x92, 0x17, 0x9F, 0x1D, 0xB3, 0x11, 0x0C, 0x3B, 0xE0, 0x20, 0x7F, 
+    0xA9, 0x01, 0x04, 0x15, 0xCC, 0x40, 0x60, 0x05, 0xCC, 0x20, 0x07, 0x29, 0x32, 0x30, 0x01, 
+    0x7C, 0x1C, 0x9C, 0x61, 0x16, 0x1C, 0x10, 0x21, 0x07, 0x82, 0x04, 0x1C, 0x16, 0x2E, 0xEE, 
+    0x1E, 0xEB, 0x11, 0x38, 0x12, 0x7D, 0x23, 0x1B, 0x73, 0x3A, 0xF1, 0x11, 0xD7, 0x04, 0xFF, 
+    0x8C, 0x12, 0x09, 0x00, 0x74, 0x2B, 0x7F, 0x21, 0x67, 0x21, 0xE3, 0x13, 0x1C, 0x26, 0x32, 
+    0x4D, 0xFF, 0xB5, 0x32, 0x82, 0x2C, 0x04, 0x33, 0x17, 0x12, 0xA8, 0x22, 0x01, 0x25, 0xFE, 
+    0x3A, 0x08, 0x07, 0xC3, 0x23, 0x4D, 0xC4, 0x1B, 0xF6, 0x2E, 0x1B, 0x9D, 0x0B, 0x04, 0xBD, 
+    0x4B, 0xFF, 0xFF, 0x20, 0xF0, 0x3A, 0x98, 0x7D, 0x1C, 0x10, 0xEC, 0x20, 0xF4, 0x1C, 0xA4, 
+    0x19, 0xCC, 0x2C, 0x7F, 0x67, 0x06, 0xA9, 0x1E, 0x1D, 0x21, 0x03, 0x22, 0x10, 0x2A, 0x94, 
+    0x12, 0x31, 0x00, 0xF6, 0xBF, 0xCC, 0x80, 0x43, 0x10, 0xCC, 0x10, 0x1A, 0x28, 0x07, 0x11, 
+    0xBA, 0x18, 0x19, 0x0E, 0x00, 0xF7, 0xE3, 0x35, 0xA8, 0x10, 0xBB, 0x16, 0x1B, 0x10, 0x00, 
+    0x37, 0x33, 0x22, 0x33, 0xCF, 0x1B, 0xDF, 0x5D, 0x14, 0xC6, 0x24, 0x38, 0x26, 0x17, 0x00, 
+    0x32, 0x00, 0x1D, 0x8E, 0x14, 0x00, 0x21, 0xFF, 0x2E, 0x00, 0x20, 0x20, 0x7C, 0x13, 0xA5, 
+    0x2B, 0x32, 0x2D, 0xF7, 0x18, 0xCB, 0x10, 0xDE, 0x23, 0x3F, 0x87, 0x31, 0x0D, 0x00, 0xE2, 
+    0x28, 0x00, 0x01, 0x12, 0x00, 0xD6, 0x1E, 0x1B, 0x1C, 0xE3, 0xEA, 0x1C, 0x1A, 0x24, 0xF6, 
+    0x2E, 0x5C, 0x26, 0x0F, 0xF7, 0x24, 0xCC, 0x3C, 0xFF, 0x65, 0x0D, 0x40, 0x00, 0x06, 0x25, 
+    0xE6, 0x1C, 0x66, 0x21, 0xB8, 0x2C, 0x0B, 0x02, 0xE7, 0x1D, 0xFF, 0x02, 0x44, 0x22, 0x12, 
+    0x96, 0x11, 0x6C, 0x40, 0x13, 0x0D, 0xE3, 0x15, 0x1A, 0x38, 0xD4, 0x19, 0x7E, 0xF5, 0x7C, 
+    0x01, 0x71, 0x00, 0xCC, 0x30, 0xA9, 0x17, 0xA3, 0x16, 0x32, 0x60, 0x1A, 0xC7, 0x70, 0x14, 
+    0x0F, 0x1A, 0x66, 0x11, 0x1F, 0x1C, 0x1E, 0x5E, 0x2A, 0x00, 0x18, 0xFF, 0xBA, 0x21, 0xD0, 
+    0x09, 0x4E, 0x06, 0xC4, 0x12, 0x30, 0x10, 0xC7, 0x13, 0x29, 0x16, 0x88, 0x10, 0xFF, 0x32, 
+    0x00, 0x77, 0x01, 0x4E, 0x01, 0x3F, 0x00, 0x05, 0x32, 0x6E, 0x2A, 0xF9, 0x23, 0xBF, 0x14, 
+    0x3F, 0x27, 0x21, 0x53, 0x12, 0x17, 0x13, 0xF9, 0x21, 0x19, 0x26, 0xE2, 0x1A, 0x29, 0x2B, 
+    0xDB, 0xA3, 0x00, 0xFE, 0x07, 0x1F, 0x0B, 0x0A, 0xC9, 0x18, 0x2E, 0xCF, 0x07, 0x0E, 0x07, 
+    0xF8, 0x1B, 0x1C, 0x2B, 0xFF, 0x06, 0x2C, 0x23, 0x88, 0x2C, 0xD8, 0x24, 0xF6, 0x20, 0xFE, 
+    0x1B, 0x8E, 0x2D, 0xB6, 0x14, 0xC3, 0x23, 0x16, 0x24, 0xD3, 0x2C, 0xA4, 0x0C, 0x86, 0x0C, 
+    0xFE, 0x01, 0x85, 0x00, 0x75, 0x00, 0xF3, 0x11, 0x78, 0x12, 0xE2, 0x2F, 0x53, 0x1A, 0x4D, 
+    0x04, 0xFF, 0x1A, 0x11, 0xD2, 0x14, 0xB5, 0x1B, 0xCC, 0x20, 0xBC, 0x1E, 0xCC, 0x10, 0x32, 
+    0x00, 0xD7, 0x14, 0xFF, 0x35, 0x10, 0x8D, 0x18, 0x56, 0x13, 0xD9, 0x00, 0xD0, 0x10, 0x69, 
+    0x1A, 0xEB, 0x20, 0xA9, 0x3E, 0x3F, 0x34, 0x00, 0xBC, 0x30, 0x1F, 0x37, 0x45, 0x11, 0x48, 
+    0x11, 0x32, 0x00, 0x1F, 0x1B, 0xFD, 0x83, 0x00, 0x1E, 0x2C, 0x1E, 0x07, 0x3A, 0xC1, 0x07, 
+    0xFD, 0x00, 0x32, 0x7D, 0x02, 0x26, 0x4F, 0xAD, 0x2A, 0x32, 0x3D, 0x3B, 0x30, 0xF1, 0x02, 
+    0x2B, 0xF5, 0x05, 0x26, 0x2B, 0x1C, 0x2E, 0x8E, 0x94, 0x14, 0x31, 0x25, 0x2C, 0x19, 0x8E, 
+    0x2E, 0x2B, 0xDE, 0x1E, 0x61, 0x17, 0xC4, 0x02, 0xCC, 0x3C, 0xFF, 0x28, 0xF5, 0x15, 0x05, 
+    0x82, 0x07, 0xFE, 0xF5, 0xB8, 0x2A, 0x43, 0x00, 0x00, 0x1B, 0x6B, 0x14, 0x65, 0x30, 0xF4, 
+    0x14, 0xB8, 0x67, 0xBF, 0x99, 0x50, 0x5A, 0x2A, 0x78, 0x16, 0xCC, 0x40, 0x29, 0x11, 0x8B, 
+    0x13, 0x2E, 0x40, 0x1C, 0xFF, 0x06, 0x3E, 0x32, 0x70, 0xF8, 0x11, 0xE0, 0x23, 0xD0, 0x2D, 
+    0xCC, 0x11, 0x21, 0x2A, 0x57, 0x13, 0xFF, 0x66, 0x15, 0x1A, 0x30, 0x47, 0x03, 0x1E, 0x15, 
+    0x12, 0x30, 0x4A, 0x19, 0x5A, 0x4C, 0xA6, 0x10, 0xFF, 0x52, 0x11, 0xFB, 0x10, 0x91, 0x20, 
+    0x87, 0x29, 0xAB, 0x1A, 0xF5, 0x11, 0x32, 0x4D, 0x23, 0x10, 0xDF, 0x31, 0x3F, 0x00, 0x22, 
+    0xFD, 0x02, 0x09, 0x0C, 0x79, 0x1F, 0x1B, 0xFF, 0x02, 0xA6, 0x1D, 0xE3, 0x56, 0x1D, 0xBD, 
+    0x0B, 0x1E, 0x2E, 0x2B, 0x7E, 0x14, 0x52, 0x2A, 0x6C, 0x20, 0xE7, 0x6D, 0x15, 0x9D, 0x10, 
+    0xFE, 0x01, 0x02, 0x1E, 0x57, 0x2B, 0x01, 0x08, 0xD1, 0x03, 0x7F, 0xA5, 0x2E, 0x25, 0x10, 
+    0x21, 0x10, 0x09, 0x15, 0x71, 0x10, 0x09, 0x25, 0x2E, 0x25, 0x01, 0xEF, 0x9D, 0x1B, 0x9B, 
+    0x19, 0x32, 0x4D, 0xD9, 0x2A, 0xF6, 0xFB, 0x07, 0x32, 0x23, 0x84, 0x00, 0xFF, 0x28, 0x02, 
+    0x5D, 0x1B, 0x4A, 0x39, 0xB6, 0x0A, 0xCA, 0x08, 0x66, 0x10, 0x49, 0x14, 0x89, 0x14, 0xFF, 
+    0x20, 0x3C, 0x6B, 0x35, 0x72, 0x21, 0x4A, 0x24, 0x5F, 0x3C, 0x62, 0x13, 0x18, 0x3D, 0xF2, 
+    0x18, 0xFF, 0x3D, 0x02, 0x34, 0x36, 0x0B, 0x4E, 0xDD, 0x0E, 0xBA, 0x12, 0x82, 0x3A, 0x7A, 
+    0x11, 0x06, 0x20, 0x57, 0x6B, 0x00, 0x1F, 0x26, 0x4F, 0x22, 0x01, 0xFB, 0x00, 0xF5, 0xFE, 
+    0x00, 0x8C, 0xAF, 0xCE, 0x22, 0x38, 0x10, 0x6E, 0x04, 0x9B, 0x00, 0xF5, 0x2D, 0x09, 0x02, 
+    0xFF, 0x01, 0x7F, 0x84, 0x24, 0x12, 0x22, 0x54, 0x1D, 0xE4, 0x22, 0x38, 0x20, 0x22, 0x00, 
+    0x18, 0x24, 0x1C, 0xFE, 0x1E, 0xD6, 0x19, 0x4B, 0x22, 0xB8, 0x6F, 0xE0, 0x24, 0x06, 0x11, 
+    0xC2, 0x10, 0xA7, 0x15, 0xFF, 0x8B, 0x15, 0x99, 0x19, 0x80, 0x00, 0x42, 0x38, 0x39, 0x56, 
+    0x49, 0x00, 0x61, 0x07, 0xC7, 0x11, 0xFB, 0xB1, 0x22, 0x02, 0x10, 0x1A, 0x4B, 0x27, 0xF1, 
+    0x21, 0xF9, 0x01, 0x4C, 0x3D, 0xBB, 0x13, 0xFF, 0x14, 0x17, 0x48, 0x2E, 0x40, 0x2B, 0x02, 
+    0x1D, 0x7F, 0x22, 0xD1, 0x11, 0xA0, 0x19, 0x12, 0x00, 0xFE, 0xF5, 0xC5, 0x13, 0x52, 0x2E, 
+    0x03, 0x00, 0xAB, 0x15, 0x39, 0x22, 0x36, 0x05, 0x10, 0x00, 0xBF, 0xC6, 0x14, 0x9F, 0x30, 
+    0x98, 0x13, 0x8B, 0x1A, 0x65, 0x4B, 0xEE, 0x01, 0x8E, 0x80, 0x03, 0xBE, 0xF5, 0x3B, 0x15, 
+    0xF9, 0x27, 0x11, 0x00, 0x10, 0x07, 0x12, 0x2B, 0x2B, 0xE4, 0x18, 0x3F, 0x7C, 0x23, 0xE8, 
+    0x14, 0x87, 0x18, 0x99, 0x10, 0xDC, 0x33, 0x51, 0x31, 0x1B, 0x1E, 0xDF, 0x06, 0x1D, 0x0F, 
+    0x5D, 0xC8, 0x29, 0x6A, 0x2E, 0xD7, 0x04, 0x02, 0x6A, 0x0C, 0xC8, 0x38, 0xFF, 0x1E, 0x22, 
+    0x53, 0x28, 0x46, 0x02, 0x9A, 0x15, 0x7E, 0x32, 0xCB, 0x49, 0xF7, 0x2A, 0x15, 0x2E, 0xFE, 
+    0x1D, 0x32, 0x00, 0xF6, 0x16, 0xFE, 0x12, 0x25, 0x2D, 0x09, 0x10, 0xD8, 0x17, 0xFA, 0x3F, 
+    0xFF, 0xD6, 0x05, 0x0C, 0x22, 0x86, 0x26, 0x7F, 0x17, 0x21, 0x10, 0xE7, 0x0F, 0x43, 0x08, 
+    0x94, 0x3F, 0xFF, 0xA1, 0x23, 0x90, 0x01, 0x4C, 0x21, 0x2A, 0x21, 0x6B, 0x2E, 0xFD, 0x06, 
+    0x63, 0x37, 0x0E, 0x10, 0x3F, 0xCF, 0x00, 0x17, 0x20, 0x9C, 0x14, 0x96, 0x10, 0x7A, 0x12, 
+    0xF8, 0x06, 0x1D, 0xF5, 0x0C, 0x8C, 0x2E, 0x01, 0x1B, 0xCA, 0x19, 0x1D, 0x01, 0x8E, 0x5C, 
+    0xE3, 0x10, 0x00, 0x2A, 0x0C, 0x2B, 0x01, 0x8E, 0x88, 0x10, 0x50, 0x23, 0xEA, 0x3B, 0xF7, 
+    0x89, 0x10, 0xEB, 0x21, 0x3E, 0x18, 0xF6, 0x24, 0x1D, 0x8E, 0x05, 0x64, 0x23, 0x7E, 0x15, 
+    0xFF, 0x96, 0x28, 0x1B, 0x10, 0xA0, 0x10, 0xEB, 0x21, 0xDC, 0x14, 0x34, 0x1F, 0xA2, 0x27, 
+    0xC7, 0x20, 0xFF, 0x32, 0x0D, 0x7F, 0x20, 0x07, 0x03, 0x3F, 0x13, 0x05, 0x13, 0x3F, 0x21, 
+    0xAE, 0x11, 0x95, 0x26, 0xFF, 0xA2, 0x25, 0xC9, 0x30, 0x1B, 0x5E, 0xDF, 0x4C, 0x37, 0x12, 
+    0x8B, 0x11, 0x64, 0x05, 0x85, 0x05, 0xFF, 0x56, 0x4E, 0x9B, 0x10, 0x64, 0x2A, 0x49, 0x02, 
+    0x2B, 0x20, 0xF2, 0x1D, 0x76, 0x19, 0x37, 0x19, 0xFF, 0x6E, 0x16, 0x6B, 0x16, 0x32, 0x3D, 
+    0x8B, 0x35, 0xC1, 0x22, 0xAE, 0x24, 0xD4, 0x2A, 0xDD, 0x1C, 0x5B, 0xA4, 0x10, 0x33, 0x07, 
+    0x1B, 0xEC, 0x2C, 0x93, 0x05, 0x8E, 0xFE, 0x01, 0xF6, 0xFD, 0x41, 0x02, 0x2B, 0x15, 0x05, 
+    0xEA, 0x20, 0xCC, 0x8C, 0xEE, 0x03, 0x82, 0x12, 0x46, 0x14, 0xFF, 0xD7, 0x11, 0xD0, 0x18, 
+    0x22, 0x16, 0x7F, 0x18, 0xB4, 0x16, 0x1B, 0x3E, 0xBC, 0x22, 0xAC, 0x11, 0xFD, 0xBC, 0x21, 
+    0x01, 0x2F, 0x04, 0x9D, 0x02, 0x3E, 0x11, 0x7D, 0x3C, 0x8B, 0x38, 0xCB, 0x4A, 0xF7, 0xF5, 
+    0x22, 0x17, 0x20, 0x12, 0x25, 0x2E, 0xFF, 0x06, 0x44, 0x37, 0x52, 0x2D, 0xC7, 0x10, 0xF9, 
+    0x54, 0x41, 0x2E, 0x02, 0xBA, 0x21, 0x62, 0x28, 0xD5, 0x19, 0x5B, 0x10, 0x6A, 0x03, 0xCF, 
+    0xE7, 0x15, 0xFF, 0x41, 0x20, 0x3B, 0x2B, 0x10, 0x1F, 0x1E, 0x34, 0x00, 0x3E, 0x00, 0x7F, 
+    0x0D, 0x14, 0xB0, 0x23, 0x32, 0x1D, 0x30, 0x02, 0x53, 0x20, 0x5C, 0x3E, 0x3E, 0x1D, 0x02, 
+    0x7F, 0x1E, 0x06, 0xF5, 0x02, 0xFF, 0x1C, 0x08, 0x0B, 0xFE, 0x08, 0x57, 0x0B, 0xA9, 0x01, 
+    0x8E, 0xFC, 0x1B, 0x19, 0x33, 0x0C, 0xFF, 0x02, 0xFE, 0x0B, 0x69, 0x46, 0xA2, 0x10, 0xBE, 
+    0x0C, 0xDB, 0xE9, 0x17, 0xFC, 0x10, 0x02, 0x71, 0x2C, 0x58, 0x00, 0xF6, 0xD6, 0x20, 0x7C, 
+    0x24, 0xFF, 0x39, 0x08, 0x07, 0x0C, 0xCC, 0x04, 0x8C, 0x21, 0x5E, 0x45, 0x4E, 0x14, 0x81, 
+    0x30, 0x73, 0x26, 0xFF, 0x32, 0x2D, 0x9C, 0x29, 0xCB, 0x6A, 0x47, 0x13, 0xDB, 0x13, 0xFE, 
+    0x24, 0x0C, 0x15, 0x1A, 0x10, 0xFF, 0xA6, 0x00, 0x74, 0x16, 0x47, 0x20, 0x04, 0x02, 0xB3, 
+    0x20, 0xE1, 0x3C, 0x4A, 0x11, 0xCC, 0x21, 0xEF, 0x4D, 0x21, 0xA6, 0x00, 0x76, 0x3E, 0x2A, 
+    0x00, 0xF6, 0xDE, 0x0E, 0xDD, 0x26, 0xBB, 0x03, 0xFF, 0x68, 0x06, 0x42, 0x15, 0x9E, 0x14, 
+    0x0E, 0x02, 0x66, 0x02, 0xD9, 0x01, 0x38, 0x13, 0xCD, 0x10, 0x0F, 0x39, 0x10, 0x91, 0x25, 
+    0x98, 0x16, 0x10, 0x10, 0x8E, 0x1B, 0x02, 0xF5, 0x1C, 0xF5, 0x1E, 0x31, 0x01, 0x59, 0x17, 
+    0x4C, 0x18, 0x8E, 0x1C, 0x9C, 0xE1, 0xFF, 0x23, 0x02, 0x8E, 0x1D, 0x1B, 0x5E, 0x15, 0xA4, 
+    0x10, 0xCA, 0x00, 0xFF, 0xAB, 0x02, 0x41, 0x09, 0xE3, 0x2C, 0xE6, 0x27, 0x10, 0x00, 0x52, 
+    0x12, 0x1B, 0x16, 0xC9, 0x17, 0xFF, 0x2E, 0x0D, 0x55, 0x3B, 0xF6, 0x36, 0x5F, 0x20, 0xED, 
+    0x0B, 0x15, 0x4E, 0x6B, 0x25, 0x25, 0x29, 0xFF, 0xFE, 0x1A, 0xB3, 0x39, 0xFF, 0x28, 0x56, 
+    0x09, 0x20, 0x2D, 0xF4, 0x24, 0x5F, 0x00, 0x82, 0x01, 0xFF, 0x1D, 0x30, 0x66, 0x20, 0xC0, 
+    0x14, 0xB0, 0x3D, 0x24, 0x2A, 0xC6, 0x26, 0xB5, 0x13, 0xDF, 0x5C, 0xFF, 0x3F, 0x22, 0x22, 
+    0x1B, 0x8B, 0x16, 0xFF, 0x1B, 0x46, 0x31, 0x32, 0x2D, 0xDC, 0x13, 0x11, 0x12, 0xFF, 0x14, 
+    0x24, 0xB8, 0x21, 0xAE, 0x20, 0xC5, 0x09, 0x8F, 0x23, 0x87, 0x37, 0x40, 0x00, 0xFF, 0x03, 
+    0x70, 0x1B, 0x1D, 0x1E, 0xF6, 0xED, 0x08, 0xB0, 0x2D, 0xE7, 0x15, 0x2B, 0xFB, 0x75, 0x01, 
+    0x4F, 0x05, 0x8E, 0x5F, 0x35, 0xC1, 0x2A, 0xEC, 0x03, 0x06, 0x29, 0x0A, 0x10, 0xFF, 0xCC, 
+    0x11, 0xCC, 0x4C, 0xE9, 0x14, 0x76, 0x37, 0x39, 0x00, 0xA0, 0x1F, 0xDB, 0x1B, 0xD3, 0x27, 
+    0xFF, 0x5F, 0x00, 0x11, 0x03, 0x9C, 0x10, 0x05, 0x1F, 0x73, 0x32, 0x32, 0x2D, 0x04, 0x05, 
+    0x45, 0x46, 0xDF, 0x98, 0x12, 0xFF, 0x22, 0x32, 0x20, 0x6C, 0x20, 0xDC, 0x01, 0x02, 0x35, 
+    0x2F, 0xDF, 0x11, 0xFF, 0x48, 0x20, 0xE8, 0x43, 0x16, 0x01, 0xF7, 0x16, 0x09, 0x11, 0xBD, 
+    0x00, 0x6E, 0x19, 0x0A, 0x11, 0xFF, 0x51, 0x02, 0x9F, 0x0F, 0x63, 0x00, 0xFD, 0x00, 0x27, 
+    0x1A, 0x81, 0x27, 0x66, 0x1C, 0x36, 0x2D, 0xFF, 0x72, 0x15, 0x44, 0x00, 0x16, 0x1B, 0x32, 
+    0x4D, 0x40, 0x17, 0xD4, 0x23, 0x59, 0x45, 0x7A, 0x10, 0x3A, 0x8E, 0x4C, 0x00, 0x8E, 0x3C, 
+    0x02, 0xFF, 0x00, 0x16, 0x38, 0x8E, 0x1F, 0xFE, 0x9D, 0xFE, 0x00, 0x1B, 0x1C, 0x21, 0x28, 
+    0x49, 0x01, 0xEC, 0x33, 0xE0, 0x18, 0x21, 0x22, 0xFF, 0xCC, 0xFC, 0x01, 0x86, 0x03, 0x46, 
+    0x0E, 0x68, 0x25, 0xC8, 0x14, 0x73, 0x14, 0xE0, 0x23, 0x97, 0x23, 0xFF, 0x27, 0x00, 0xEC, 
+    0x16, 0x74, 0x15, 0x90, 0x14, 0xCC, 0x27, 0xCB, 0x6A, 0x0F, 0x0C, 0x1A, 0x2B, 0xFB, 0x2A, 
+    0x1E, 0x5F, 0x00, 0x19, 0xD2, 0x42, 0x31, 0x20, 0x47, 0x10, 0x19, 0x21, 0x0D, 0x00, 0xFF, 
+    0x18, 0x1A, 0x39, 0x02, 0x3F, 0x19, 0xD6, 0x38, 0x17, 0x12, 0x96, 0x1B, 0xDC, 0x03, 0x4B, 
+    0x03, 0xFE, 0xF6, 0x07, 0x04, 0x0B, 0x1B, 0x09, 0x1A, 0x0E, 0x00, 0x55, 0x00, 0xFA, 0x14, 
+    0xBD, 0x2D, 0xFD, 0xA9, 0x02, 0x1B, 0x9E, 0x29, 0xAA, 0x00, 0x3A, 0x44, 0xBB, 0x2B, 0x0F, 
+    0x2C, 0xEE, 0x00, 0x71, 0xB8, 0x2E, 0xF6, 0x1B, 0x9C, 0xEE, 0x04, 0xE5, 0x14, 0xFF, 0x00, 
+    0xF5, 0xFF, 0x0A, 0x09, 0x79, 0x00, 0xFE, 0x05, 0x91, 0x18, 0x41, 0x10, 0xB1, 0x2F, 0x32, 
+    0x10, 0x7B, 0x20, 0xDF, 0xD0, 0x10, 0x9D, 0x00, 0xCC, 0x0C, 0xA6, 0x26, 0xCC, 0x4C, 0x1B, 
+    0xCC, 0x3C, 0x81, 0x06, 0xFF, 0x5B, 0x12, 0x2C, 0x20, 0x80, 0x14, 0xCB, 0x11, 0xFF, 0x30, 
+    0xE0, 0x12, 0xEB, 0x20, 0x94, 0x10, 0xF9, 0xCB, 0x4A, 0xF6, 0xF6, 0x2E, 0x28, 0xC7, 0x10, 
+    0x32, 0x20, 0x6D, 0x00, 0x4E, 0x1E, 0xFF, 0x40, 0x10, 0xBC, 0x18, 0x49, 0x13, 0xE0, 0x14, 
+    0x1C, 0x40, 0x1B, 0x11, 0x06, 0x07, 0xEB, 0x29, 0x7F, 0xC9, 0x03, 0x8C, 0x00, 0xF8, 0x01, 
+    0x26, 0x2E, 0x57, 0x06, 0x93, 0x00, 0xE7, 0x3E, 0x2E, 0xF9, 0x65, 0x06, 0xF6, 0xF6, 0x4A, 
+    0x00, 0x34, 0x3C, 0xB0, 0x28, 0x4C, 0x15, 0x37, 0x16, 0x4F, 0xC6, 0x30, 0x43, 0x29, 0x0D, 
+    0x01, 0x3A, 0x3E, 0x1B, 0xF6, 0x00, 0x00, 0x02, 0x86, 0x02, 0xB3, 0x10, 0x5A, 0x10, 0x8E, 
+    0x8E, 0x2E, 0x02, 0xE4, 0x0A, 0xFC, 0x02, 0x1E, 0xFF, 0x02, 0x3C, 0x02, 0x44, 0x13, 0x0F, 
+    0x1D, 0x5C, 0x00, 0x08, 0x10, 0xF7, 0x6C, 0x00, 0xFA, 0x09, 0x7F, 0x10, 0xF6, 0x33, 0x04, 
+    0x4D, 0x0A, 0xA6, 0x00, 0x65, 0x50, 0xFF, 0xCF, 0x00, 0xE5, 0x28, 0x11, 0x38, 0x00, 0x14, 
+    0x24, 0x12, 0x0C, 0x24, 0xE1, 0x15, 0x0A, 0x1D, 0xFF, 0xD9, 0x36, 0xBD, 0x11, 0x2C, 0x05, 
+    0xBF, 0x12, 0x91, 0x14, 0xA8, 0x26, 0x19, 0x21, 0x03, 0x26, 0xFF, 0x60, 0x33, 0x1F, 0x3A, 
+    0x91, 0x21, 0x1C, 0x24, 0xF1, 0x07, 0x5D, 0x11, 0xBB, 0x32, 0xDF, 0x5C, 0xFF, 0x22, 0x16, 
+    0x75, 0x00, 0xD0, 0x16, 0x57, 0x10, 0x9F, 0x2C, 0x4F, 0x28, 0x32, 0x3D, 0x1D, 0x10, 0xFF, 
+    0x66, 0x12, 0x19, 0x01, 0xFD, 0x29, 0xCD, 0x00, 0x58, 0x2C, 0x8F, 0x27, 0x4C, 0x27, 0xC8, 
+    0x0B, 0xE1, 0xEA, 0x01, 0xF5, 0xF5, 0xF6, 0x2B, 0xFF, 0x00, 0xC9, 0x10, 0x11, 0x0B, 0x00, 
+    0x8E, 0x1D, 0x2B, 0xF5, 0x1B, 0x1F, 0x02, 0x8E, 0xFF, 0x72, 0x23, 0x57, 0x02, 0x97, 0x17, 
+    0x37, 0x12, 0x3E, 0x14, 0x6D, 0x21, 0xDC, 0x17, 0xBE, 0x00, 0x7F, 0xCC, 0x4C, 0xA0, 0x13, 
+    0x86, 0x03, 0x79, 0x07, 0xFB, 0x22, 0x65, 0x13, 0x06, 0x27, 0xF5, 0xF7, 0xA5, 0x0B, 0x64, 
+    0x14, 0x92, 0x00, 0x1D, 0x78, 0x00, 0x44, 0x2F, 0x32, 0x4D, 0xB9, 0x20, 0x8F, 0xFF, 0x18, 
+    0xA6, 0x25, 0xF0, 0x26, 0x52, 0x21, 0x1C, 0x01, 0x9D, 0xF3, 0x11, 0xFF, 0xB6, 0x13, 0xC4, 
+    0x10, 0x6B, 0x14, 0xF1, 0x2B, 0xD7, 0x15, 0x49, 0x18, 0x07, 0x3F, 0x75, 0x10, 0xFB, 0xDF, 
+    0x3C, 0x6A, 0x0D, 0xF6, 0xF3, 0x0C, 0xAC, 0x0B, 0x0D, 0x00, 0x9D, 0x16, 0x39, 0x34, 0xFF, 
+    0x4A, 0x24, 0x7B, 0x12, 0x6F, 0x2C, 0x9A, 0x10, 0x83, 0x13, 0x32, 0x4D, 0x09, 0x24, 0x39, 
+    0x21, 0x91, 0x97, 0x36, 0x1F, 0x8E, 0x5C, 0x00, 0x06, 0xF5, 0x2B, 0xEE, 0x04, 0xF7, 0x5F, 
+    0x11, 0x10, 0x10, 0x7A, 0x02, 0xF5, 0xFE, 0x05, 0x10, 0x18, 0x83, 0x19, 0x6C, 0x22, 0xFF, 
+    0xB2, 0x20, 0xCA, 0x10, 0xAF, 0x1B, 0x27, 0x1B, 0x3D, 0x10, 0xDD, 0x2A, 0xCC, 0x5C, 0x0F, 
+    0x03, 0x8F, 0xEC, 0x10, 0xAB, 0x3A, 0x5F, 0x20, 0x91, 0x1E, 0x1B, 0x1F, 0x1B, 0x2B, 0x10, 
+    0xDC, 0x1D, 0x1E, 0x76, 0x12, 0xF8, 0x29, 0x01, 0x1C, 0x01, 0x13, 0x10, 0x02, 0x02, 0xFF, 
+    0x44, 0x02, 0x53, 0x13, 0x49, 0x10, 0xF8, 0x10, 0x70, 0x1C, 0xA1, 0x10, 0x02, 0x10, 0xBA, 
+    0x2C, 0xFF, 0x7C, 0x1D, 0xBE, 0x2D, 0x01, 0x01, 0x92, 0x04, 0xAD, 0x01, 0x72, 0x46, 0x58, 
+    0x07, 0xCF, 0x30, 0xDF, 0x43, 0x00, 0xFF, 0x10, 0x7D, 0x35, 0x86, 0x07, 0x11, 0x1A, 0x2E, 
+    0x1D, 0x2C, 0x14, 0x22, 0xFF, 0xB9, 0x15, 0x4E, 0x28, 0xC0, 0x2A, 0xB7, 0x2F, 0xA1, 0x0E, 
+    0x3B, 0x22, 0x0F, 0x17, 0x02, 0x13, 0x68, 0x8E, 0xF5, 0x9D, 0x07, 0x02, 0x2B, 0x04, 0x04, 
+    0x90, 0x38, 0x01, 0xF4, 0x8E, 0x01, 0x00, 0x15, 0x1D, 0xFF, 0x12, 0xE4, 0x06, 0xFF, 0x01, 
+    0xDD, 0x00, 0xFF, 0x34, 0x25, 0x76, 0x1A, 0xBB, 0x45, 0xCC, 0x4C, 0x63, 0x17, 0x3B, 0x04, 
+    0xB1, 0x39, 0x54, 0x10, 0xBF, 0xBB, 0x2C, 0x2E, 0x2B, 0x03, 0x00, 0xFF, 0x11, 0x64, 0x19, 
+    0x38, 0x20, 0xF6, 0x32, 0x4D, 0x37, 0x43, 0x19, 0x0D, 0x32, 0x35, 0x20, 0x1E, 0xFF, 0x09, 
+    0x32, 0x60, 0x2E, 0x1C, 0xFE, 0x9D, 0xB9, 0x19, 0xA0, 0x22, 0xFE, 0x21, 0xFA, 0x10, 0x55, 
+    0x24, 0x72, 0xD5, 0xB9, 0x1B, 0xFD, 0x11, 0x17, 0x1E, 0xDC, 0x07, 0x19, 0x00, 0xC0, 0x06, 
+    0xFF, 0x00, 0x93, 0x11, 0xEA, 0x18, 0xFF, 0x95, 0x10, 0xA8, 0x13, 0x60, 0x10, 0xC2, 0x31, 
+    0x89, 0x29, 0x1A, 0x24, 0x3E, 0x04, 0x2C, 0x33, 0x03, 0xC2, 0x17, 0x95, 0x2A, 0x8E, 0xF6, 
+    0x02, 0x1D, 0x1D, 0x5C, 0xFF, 0xEE, 0x02, 0x0F, 0x11, 0xE3, 0x16, 0x00, 0x04, 0x6C, 0x01, 
+    0x10, 0x00, 0xDB, 0x03, 0x4A, 0x08, 0xCF, 0x3B, 0x26, 0x03, 0x34, 0x58, 0x20, 0xEF, 0x5B, 
+    0xF5, 0x1E, 0x56, 0x05, 0x61, 0x15, 0xFF, 0x79, 0x00, 0x7A, 0x10, 0xD3, 0x2A, 0x54, 0x05, 
+    0x6D, 0x02, 0x81, 0x11, 0xF9, 0x33, 0x3C, 0x65, 0xDF, 0x1E, 0x18, 0x94, 0x01, 0x5F, 0x0B, 
+    0x0D, 0x4C, 0x3D, 0x00, 0x1D, 0xA8, 0x05, 0xCA, 0x10, 0xFD, 0x32, 0x20, 0x1D, 0x32, 0x00, 
+    0xE5, 0x09, 0x63, 0x10, 0x9C, 0x10, 0xB4, 0x1E, 0xF4, 0x16, 0x7F, 0x7D, 0x27, 0x72, 0x12, 
+    0x49, 0x10, 0x3A, 0x01, 0x2F, 0x02, 0x51, 0x00, 0xA7, 0x1B, 0xF5, 0xF7, 0x09, 0x00, 0xF6, 
+    0x04, 0x2E, 0x15, 0xF5, 0x48, 0x16, 0x09, 0x12, 0x00, 0x27, 0xEC, 0x11, 0xFF, 0x26, 0x05, 
+    0x6A, 0x1D, 0x22, 0x34, 0x2F, 0x14, 0x65, 0x12, 0xC6, 0x20, 0x68, 0x2B, 0xA9, 0x3E, 0xE1, 
+    0xA6, 0x2B, 0x01, 0x1F, 0xF6, 0x9D, 0x01, 0x0D, 0xC6, 0x04, 0xD5, 0x11, 0xE5, 0x63, 0x16, 
+    0x8E, 0x01, 0x0B, 0x1B, 0x1F, 0xFE, 0x0A, 0xBE, 0x01, 0x3A, 0x09, 0xFD, 0x46, 0x10, 0x1F, 
+    0xA7, 0x00, 0xDA, 0x4A, 0x81, 0x01, 0xCC, 0x3C, 0x33, 0x0B, 0x11, 0x30, 0xFF, 0x46, 0x13, 
+    0x05, 0x01, 0xE3, 0x1A, 0x6E, 0x32, 0x1C, 0x00, 0xD4, 0x2F, 0x83, 0x22, 0x2C, 0x1E, 0xFB, 
+    0xEB, 0x3D, 0x9E, 0x10, 0x1B, 0x69, 0x09, 0xBD, 0x08, 0xA7, 0x11, 0xB3, 0x00, 0x13, 0x00, 
+    0xFF, 0xF9, 0x10, 0x7D, 0x07, 0x9C, 0x25, 0x97, 0x21, 0x32, 0x1C, 0xC0, 0x00, 0x13, 0x15, 
+    0x28, 0x16, 0xFF, 0x34, 0x15, 0x84, 0x27, 0x9C, 0x11, 0x13, 0x10, 0xC4, 0x02, 0xA7, 0x3B, 
+    0x0D, 0x27, 0x59, 0x00, 0xED, 0x86, 0x15, 0x1E, 0xC1, 0x05, 0x4B, 0x18, 0xF6, 0x0E, 0x08, 
+    0x24, 0x00, 0xED, 0x08, 0xFF, 0x2C, 0x03, 0x3B, 0x2B, 0xE3, 0x0A, 0x31, 0x16, 0x14, 0x31, 
+    0x9F, 0x27, 0x03, 0x34, 0xFE, 0x10, 0x83, 0x30, 0x39, 0xEF, 0x07, 0x1D, 0xF5, 0x9D, 0x02, 
+    0x8E, 0x6E, 0x10, 0xEB, 0x8C, 0x14, 0x00, 0x05, 0x1B, 0x85, 0x00, 0x2B, 0x18, 0x08, 0x93, 
+    0x00, 0xB1, 0x12, 0xFF, 0x83, 0x38, 0x27, 0x0B, 0xAB, 0x24, 0xDC, 0x24, 0xE3, 0x1D, 0x66, 
+    0x06, 0x58, 0x1E, 0xF8, 0x11, 0xFF, 0x9C, 0x00, 0x91, 0x00, 0x7B, 0x24, 0xEA, 0x10, 0x73, 
+    0x30, 0xEE, 0x23, 0x88, 0x15, 0x1F, 0x11, 0xF7, 0x32, 0x2D, 0x33, 0x00, 0x2D, 0x02, 0xF6, 
+    0xA8, 0x18, 0xB8, 0x10, 0x0A, 0x00, 0x43, 0x00, 0xFF, 0xA6, 0x36, 0xEE, 0x2E, 0xF9, 0x10, 
+    0x26, 0x00, 0xE0, 0x67, 0x18, 0x28, 0xC9, 0x18, 0x3A, 0x03, 0xEF, 0x7C, 0x25, 0x72, 0x46, 
+    0xA7, 0x2B, 0x48, 0x04, 0x1D, 0x32, 0x12, 0xE9, 0x12, 0x31, 0x00, 0xFF, 0x83, 0x29, 0x29, 
+    0x14, 0x39, 0x26, 0xDD, 0x16, 0x84, 0x00, 0xE8, 0x10, 0xAF, 0x2C, 0x5C, 0x34, 0x1F, 0x9A, 
+    0x26, 0x8E, 0x23, 0x59, 0x27, 0x76, 0x20, 0xEF, 0x07, 0x02, 0x1D, 0x1B, 0x8F, 0x77, 0x03, 
+    0x1C, 0x19, 0xA7, 0x29, 0x12, 0x0B, 0x1F, 0x1C, 0xF6, 0xFE, 0x0A, 0xFF, 0x78, 0x26, 0x48, 
+    0x02, 0xAD, 0x00, 0xFE, 0x25, 0xCC, 0x3C, 0xDC, 0x20, 0x59, 0x00, 0x69, 0x11, 0xF7, 0x6A, 
+    0x10, 0x9B, 0x1A, 0x51, 0x10, 0x1E, 0xCC, 0x3C, 0xC8, 0x17, 0xB0, 0x19, 0x3A, 0x4E, 0xEF, 
+    0x1F, 0x36, 0x32, 0x4D, 0x20, 0x25, 0xF0, 0x21, 0x01, 0x3A, 0x04, 0xEE, 0x40, 0x27, 0x1E, 
+    0xFB, 0x43, 0x15, 0x06, 0x26, 0x19, 0xC7, 0x26, 0xE7, 0x2C, 0xA4, 0x30, 0xA6, 0x1B, 0x5E, 
+    0x20, 0xFF, 0xC8, 0x09, 0xCF, 0x35, 0xFC, 0x2D, 0x2A, 0x25, 0x1D, 0x01, 0x75, 0x11, 0x91, 
+    0x1D, 0xE0, 0x24, 0xFF, 0x86, 0x15, 0x9E, 0x16, 0x37, 0x20, 0x26, 0x14, 0x31, 0x16, 0xC1, 
+    0x4C, 0x8F, 0x21, 0x0A, 0x11, 0xDF, 0x06, 0x32, 0x02, 0x3E, 0xDE, 0x17, 0xD5, 0x03, 0xBA, 
+    0x09, 0x02, 0x4C, 0x02, 0x65, 0x20, 0xE5, 0x7B, 0x11, 0x8E, 0xA0, 0x00, 0xF6, 0x02, 0x6B, 
+    0x01, 0x5C, 0x3E, 0x5D, 0x03, 0xFF, 0xB6, 0x47, 0x01, 0x3F, 0x92, 0x14, 0x5B, 0x02, 0x5D, 
+    0x33, 0xA0, 0x17, 0xFE, 0x28, 0x02, 0x14, 0xFF, 0x93, 0x2A, 0x55, 0x11, 0x7F, 0x24, 0x63, 
+    0x1D, 0x8D, 0x00, 0xA9, 0x38, 0x97, 0x11, 0x80, 0x4D, 0xFF, 0x52, 0x38, 0x34, 0x1D, 0x4E, 
+    0x24, 0x75, 0x2A, 0x21, 0x13, 0x9A, 0x2C, 0xD0, 0x4C, 0xBC, 0x27, 0xF7, 0x91, 0x11, 0x10, 
+    0x0B, 0x72, 0x35, 0xF5, 0x72, 0x45, 0x82, 0x10, 0x58, 0x3B, 0x65, 0x00, 0xFF, 0x96, 0x01, 
+    0xB2, 0x20, 0x0C, 0x48, 0xBD, 0x12, 0xF0, 0x0F, 0x6A, 0x16, 0xA7, 0x12, 0xD0, 0x14, 0xFF, 
+    0x46, 0x36, 0xA9, 0x21, 0x2E, 0x00, 0x8B, 0x22, 0x6D, 0x27, 0x33, 0x12, 0x28, 0x00, 0x86, 
+    0x00, 0x7C, 0x8E, 0x8E, 0x27, 0x00, 0x77, 0x04, 0xDC, 0x10, 0x57, 0x38, 0x0A, 0x15, 0xF5, 
+    0xFF, 0xFE, 0x0A, 0x20, 0x42, 0xD4, 0x17, 0x73, 0x10, 0xCC, 0x4C, 0x4E, 0x29, 0xCC, 0x4C, 
+    0x84, 0x13, 0xFF, 0x9B, 0x02, 0x5F, 0x22, 0x81, 0x0D, 0x08, 0x10, 0x5D, 0x24, 0xF9, 0x4C, 
+    0xCE, 0x19, 0x19, 0x1A, 0xFF, 0x6C, 0x2F, 0xBD, 0x00, 0x99, 0x1B, 0x98, 0x27, 0xAA, 0x21, 
+    0x38, 0x1B, 0x93, 0x26, 0x2F, 0x4E, 0xFF, 0x32, 0x10, 0xDA, 0x29, 0xF2, 0x21, 0x00, 0x27, 
+    0x61, 0x37, 0xA7, 0x2B, 0x59, 0x29, 0x40, 0x20, 0xFF, 0xEA, 0x21, 0x5A, 0x13, 0x9C, 0x11, 
+    0xE9, 0x30, 0x11, 0x40, 0x9B, 0x36, 0x32, 0x04, 0x7E, 0x23, 0xFF, 0xF3, 0x2A, 0xAD, 0x11, 
+    0x38, 0x24, 0x4C, 0x18, 0x36, 0x13, 0x12, 0x1C, 0xC1, 0x11, 0x97, 0x21, 0x81, 0x11, 0x01, 
+    0x1B, 0x8E, 0x8E, 0x1C, 0x5C, 0x2E, 0xED, 0x05, 0x13, 0xB5, 0x10, 0x59, 0x29, 0x1E, 0x8E, 
+    0xFA, 0x05, 0x2E, 0xF6, 0x8E, 0xFF, 0xC0, 0x10, 0x55, 0x20, 0x30, 0x12, 0xD2, 0x36, 0x9F, 
+    0x0D, 0x6F, 0x10, 0x60, 0x24, 0xCC, 0x1C, 0xFF, 0xBE, 0x0D, 0xC8, 0x2C, 0xD2, 0x20, 0xFE, 
+    0x19, 0x69, 0x14, 0xF5, 0x24, 0x82, 0x13, 0x1C, 0x33, 0xFB, 0x45, 0x39, 0x4C, 0x12, 0xF6, 
+    0x6A, 0x09, 0xF3, 0x00, 0x14, 0x16, 0xD4, 0x0A, 0xDA, 0x36, 0xFF, 0xE9, 0x2E, 0x99, 0x43, 
+    0x5F, 0x20, 0xA6, 0x13, 0x0E, 0x27, 0x3E, 0x13, 0x0C, 0x47, 0xDB, 0x22, 0xE7, 0xEE, 0x26, 
+    0x72, 0x36, 0x15, 0x2A, 0x01, 0x02, 0xEE, 0x12, 0xD8, 0x09, 0x8C, 0x3D, 0xFF, 0xAA, 0x14, 
+    0x94, 0x29, 0x4F, 0x31, 0x5B, 0x11, 0x37, 0x2E, 0x7A, 0x11, 0x0B, 0x10, 0x4E, 0x24, 0x3B, 
+    0xBF, 0x17, 0x6A, 0x37, 0x1D, 0x54, 0x06, 0xBD, 0x14, 0xFF, 0x03, 0x8E, 0x01, 0xFC, 0x5C, 
+    0x1C, 0xFF, 0x02, 0xA0, 0x06, 0x73, 0x10, 0x47, 0x00, 0xFF, 0x10, 0xFF, 0x01, 0xFF, 0xB4, 
+    0x39, 0x93, 0x28, 0x9D, 0x12, 0xCE, 0x10, 0x3B, 0x24, 0x8F, 0x23, 0x01, 0x11, 0xB7, 0x10, 
+    0xFF, 0x70, 0x20, 0x65, 0x2A, 0x69, 0x00, 0xDD, 0x26, 0x5C, 0x20, 0x9B, 0x11, 0x2D, 0x19, 
+    0x61, 0x29, 0xFF, 0xC3, 0x11, 0xCF, 0x35, 0x83, 0x12, 0x9B, 0x13, 0x92, 0x0A, 0x35, 0x1A, 
+    0x96, 0x12, 0xDD, 0x21, 0xF1, 0x32, 0x40, 0xF5, 0x1F, 0x18, 0x51, 0x24, 0x4B, 0x10, 0x0C, 
+    0x66, 0xEF, 0x11, 0x9F, 0x72, 0x45, 0xDF, 0x05, 0x88, 0x11, 0xA7, 0x3B, 0xDE, 0x1F, 0xF5, 
+    0xF6, 0x9B, 0x10, 0xFF, 0x91, 0x27, 0xA9, 0x1A, 0x57, 0x04, 0x7E, 0x14, 0x40, 0x29, 0xFB, 
+    0x27, 0xF0, 0x2F, 0x49, 0x36, 0xFF, 0x51, 0x29, 0xE8, 0x02, 0x69, 0x1D, 0x6D, 0x17, 0x3E, 
+    0x46, 0x2E, 0x03, 0xF0, 0x1C, 0x42, 0x24, 0xFB, 0xAE, 0x21, 0xC7, 0x03, 0x1D, 0x01, 0x0E, 
+    0x5F, 0x19, 0x79, 0x16, 0x3E, 0x31, 0x34, 0x3A, 0xFF, 0x6A, 0x24, 0xA6, 0x4B, 0x4A, 0x22, 
+    0x6A, 0x20, 0xA0, 0x19, 0x7E, 0x1D, 0xCD, 0x1F, 0xB1, 0x23, 0xFF, 0x29, 0x29, 0xA7, 0x40, 
+    0x4E, 0x1F, 0x08, 0x10, 0x8F, 0x0C, 0xEF, 0x17, 0xE7, 0x5E, 0xAB, 0x1A, 0xFF, 0x4F, 0x18, 
+    0xDE, 0x17, 0x73, 0x33, 0xD5, 0x3C, 0xD8, 0x14, 0x2C, 0x11, 0x2B, 0x2D, 0xA6, 0x36, 0xFF, 
+    0x72, 0x15, 0xA7, 0x1B, 0x88, 0x10, 0x27, 0x2C, 0x53, 0x3E, 0x36, 0x00, 0x36, 0x18, 0x11, 
+    0x13, 0xFF, 0xB4, 0x10, 0x9B, 0x18, 0xD7, 0x20, 0x0B, 0x45, 0xAD, 0x10, 0xC3, 0x1D, 0xAA, 
+    0x02, 0x48, 0x10, 0x7F, 0xC9, 0x10, 0x2A, 0x01, 0x0D, 0x28, 0xB0, 0x0F, 0x2D, 0x2F, 0xD8, 
+    0x09, 0x60, 0x2F, 0x8E, 0x39, 0x00, 0x04, 0x1B, 0x1E, 0xFD, 0x1F, 0x16, 0x31, 0x65, 0x02, 
+    0x8E, 0x2B, 0xFE, 0x02, 0x80, 0x08, 0xD7, 0x1A, 0x8A, 0x2A, 0xC6, 0x14, 0x4A, 0x05, 0xCA, 
+    0x16, 0xC2, 0x25, 0xFF, 0x8F, 0x11, 0x34, 0x0C, 0x88, 0x34, 0x1C, 0x01, 0x78, 0x20, 0x01, 
+    0x26, 0xAD, 0x2C, 0x06, 0x14, 0xFF, 0x8F, 0x20, 0x39, 0x10, 0x01, 0x00, 0xF7, 0x2E, 0xD4, 
+    0x36, 0xE7, 0x3E, 0x56, 0x10, 0xC7, 0x14, 0xDD, 0xBB, 0x03, 0x02, 0x29, 0x0F, 0x8E, 0x30, 
+    0x6C, 0x2B, 0x1D, 0xE4, 0x0C, 0x07, 0x18, 0xFF, 0x4D, 0x00, 0x8F, 0x0C, 0xE6, 0x2A, 0x4B, 
+    0x33, 0xC1, 0x10, 0x60, 0x10, 0x8F, 0x1D, 0xA7, 0x4B, 0xFF, 0xD3, 0x11, 0xE3, 0x11, 0x74, 
+    0x20, 0x4A, 0x00, 0xF9, 0x19, 0x41, 0x34, 0x7B, 0x12, 0xDC, 0x2D, 0xFF, 0x0C, 0x12, 0x16, 
+    0x0F, 0x79, 0x15, 0x00, 0x00, 0x51, 0x10, 0xBE, 0x2E, 0x04, 0x35, 0xBC, 0x35, 0xF1, 0x00, 
+    0x0F, 0x8E, 0x01, 0x1B, 0x04, 0x04, 0xB0, 0x10, 0xCB, 0x15, 0xD0, 0x11, 0xF0, 0x8E, 0x2B, 
+    0x2E, 0x9D, 0xB4, 0x0C, 0xD8, 0x10, 0x32, 0x05, 0xC6, 0x2D, 0xFF, 0x01, 0x12, 0xCC, 0x3C, 
+    0x83, 0x10, 0x07, 0x23, 0xCC, 0x4C, 0x85, 0x3D, 0x89, 0x2E, 0x68, 0x38, 0xFF, 0x14, 0x15, 
+    0xB2, 0x28, 0xDA, 0x2B, 0x48, 0x02, 0x05, 0x11, 0x2D, 0x23, 0xE7, 0x4E, 0x24, 0x00, 0xFE, 
+    0x1E, 0x7E, 0x01, 0xB5, 0x19, 0x2F, 0x20, 0x32, 0x20, 0xC5, 0x36, 0xF3, 0x1F, 0x44, 0x31, 
+    0xFF, 0xE2, 0x22, 0xD9, 0x30, 0x3D, 0x23, 0x2A, 0x22, 0x72, 0x46, 0x2E, 0x22, 0xD3, 0x36, 
+    0x1D, 0x10, 0xF7, 0x8A, 0x05, 0x34, 0x00, 0x0B, 0x1A, 0x1B, 0xB1, 0x12, 0x5A, 0x00, 0xB5, 
+    0x27, 0x18, 0x18, 0xFE, 0x1B, 0x7C, 0x13, 0x14, 0x18, 0xEF, 0x20, 0x7B, 0x22, 0xE8, 0x29, 
+    0xB4, 0x41, 0x8C, 0x15, 0x3E, 0x1F, 0x00, 0x05, 0xF2, 0x05, 0x30, 0x17, 0xD0, 0x14, 0xE1, 
+    0x04, 0x1F, 0x8E, 0xF8, 0x9D, 0x01, 0xF5, 0xFE, 0x19, 0x38, 0x10, 0xA1, 0x20, 0x93, 0x11, 
+    0x4C, 0x00, 0xE5, 0xCA, 0x0C, 0x2E, 0x1B, 0x08, 0x1D, 0x1E, 0xA3, 0x10, 0x75, 0x23, 0xC6, 
+    0x01, 0xFD, 0x71, 0x00, 0x1B, 0x00, 0x09, 0xCC, 0x2C, 0x71, 0x24, 0x06, 0x15, 0x1D, 0x1A, 
+    0x01, 0x0E, 0xFB, 0x74, 0x20, 0xA9, 0x12, 0x1E, 0x23, 0x0C, 0xB0, 0x17, 0x1A, 0x28, 0x8F, 
+    0x21, 0x9C, 0x27, 0xC7, 0x8A, 0x38, 0x32, 0x20, 0x53, 0x12, 0x1C, 0x2E, 0x9C, 0x12, 0x31, 
+    0x26, 0x24, 0xFF, 0xAA, 0x21, 0xED, 0x18, 0xAB, 0x15, 0xD7, 0x10, 0x72, 0x25, 0x56, 0x00, 
+    0xA7, 0x3B, 0x51, 0x21, 0xEF, 0x6C, 0x22, 0x02, 0x26, 0x80, 0x15, 0xD1, 0x2C, 0x1F, 0x0A, 
+    0x0D, 0xE8, 0x13, 0xE1, 0x1C, 0xFF, 0x7F, 0x58, 0xD9, 0x11, 0x10, 0x02, 0x28, 0x13, 0x98, 
+    0x28, 0x8B, 0x31, 0x06, 0x11, 0xEE, 0x0C, 0xF8, 0x8E, 0x1F, 0xF6, 0x5C, 0x01, 0x50, 0x21, 
+    0xB2, 0x10, 0x68, 0x0F, 0x12, 0x0D, 0xFC, 0xF6, 0x8E, 0xFB, 0x20, 0xFB, 0x16, 0xB2, 0x16, 
+    0xF9, 0x2B, 0xFE, 0x37, 0x77, 0x11, 0xCB, 0x69, 0x1C, 0xA6, 0x20, 0x1E, 0xA1, 0x2D, 0x1C, 
+    0xF5, 0x03, 0x1C, 0xDE, 0x23, 0xFF, 0x10, 0x15, 0x6A, 0x10, 0x81, 0x1D, 0xFF, 0x29, 0x77, 
+    0x38, 0xED, 0x15, 0x36, 0x14, 0x42, 0x10, 0xFF, 0x14, 0x17, 0x07, 0x11, 0x6B, 0x01, 0xFD, 
+    0x02, 0xFF, 0x16, 0x31, 0x10, 0x1E, 0x23, 0x4A, 0x22, 0xFF, 0xF3, 0x5F, 0x15, 0x21, 0xEB, 
+    0x13, 0x30, 0x1C, 0x4A, 0x00, 0x47, 0x23, 0xB7, 0x30, 0xDF, 0x2E, 0xEF, 0xFE, 0x15, 0x3B, 
+    0x34, 0x64, 0x10, 0x2D, 0x00, 0x1B, 0xA5, 0x0B, 0xD2, 0x11, 0xA1, 0x14, 0xFF, 0xFD, 0x11, 
+    0x5F, 0x24, 0x3C, 0x36, 0x37, 0x1E, 0x66, 0x3F, 0xD4, 0x36, 0x19, 0x3D, 0x8A, 0x10, 0xE4, 
+    0x02, 0x1E, 0xFF, 0x00, 0x8E, 0x8E, 0x3A, 0x06, 0x17, 0x29, 0xAE, 0x17, 0xF0, 0x1F, 0x1F, 
+    0xF5, 0x2B, 0xF1, 0x00, 0xB2, 0x25, 0x25, 0x21, 0xA4, 0x18, 0xFF, 0xEC, 0x12, 0xF5, 0x44, 
+    0xBC, 0x17, 0xAF, 0x10, 0x6E, 0x00, 0xBF, 0x26, 0xCC, 0x3C, 0x82, 0x0D, 0xFF, 0x66, 0x00, 
+    0x99, 0x21, 0x45, 0x12, 0x8F, 0x24, 0xC9, 0x20, 0x7F, 0x12, 0x34, 0x14, 0xC8, 0x2F, 0x7F, 
+    0x7D, 0x11, 0x6A, 0x2A, 0xF2, 0x12, 0x38, 0x38, 0xFC, 0x13, 0xFA, 0x20, 0x96, 0x00, 0x2B, 
+    0xFF, 0x65, 0x4E, 0xF1, 0x11, 0x3D, 0x20, 0x4C, 0x27, 0xFF, 0x30, 0x13, 0x15, 0x19, 0x43, 
+    0x15, 0x36, 0xEF, 0x1F, 0x32, 0xD0, 0x02, 0x19, 0x01, 0x26, 0x11, 0xF6, 0x04, 0x1F, 0x3A, 
+    0x2D, 0x69, 0x18, 0xFF, 0xB6, 0x00, 0x91, 0x0D, 0x83, 0x14, 0x5A, 0x10, 0xAF, 0x06, 0xC1, 
+    0x04, 0x19, 0x19, 0x9F, 0x3A, 0xEF, 0x01, 0x31, 0x39, 0x11, 0xFF, 0x04, 0x03, 0x02, 0x1E, 
+    0xDF, 0x00, 0x49, 0x25, 0x63, 0x0B, 0xFF, 0xE2, 0x02, 0xFF, 0x01, 0x3D, 0x14, 0xD0, 0x2B, 
+    0xB9, 0x1E, 0x28, 0x13, 0x0E, 0x00, 0x29, 0x0B, 0xFF, 0x9D, 0x35, 0x46, 0x21, 0x6F, 0x01, 
+    0x8F, 0x0C, 0x87, 0x00, 0xC8, 0x0B, 0x0A, 0x12, 0x5D, 0x0E, 0xFF, 0x9A, 0x47, 0x4A, 0x00, 
+    0x5C, 0x07, 0x81, 0x25, 0xB7, 0x20, 0x60, 0x0A, 0xA5, 0x12, 0x1E, 0x21, 0xFF, 0xD0, 0x1D, 
+    0xC1, 0x1E, 0xD3, 0x22, 0xDC, 0x11, 0xA1, 0x26, 0xCC, 0x30, 0x9C, 0x24, 0x3B, 0x22, 0xFF, 
+    0x26, 0x2A, 0x92, 0x36, 0x68, 0x00, 0x72, 0x46, 0xD0, 0x0B, 0xCC, 0x23, 0xA7, 0x2B, 0xFD, 
+    0x22, 0xDF, 0x22, 0x14, 0x3D, 0x24, 0x7F, 0x1E, 0x7C, 0x12, 0x1E, 0x00, 0xF6, 0x17, 0x14, 
+    0xD0, 0x02, 0xFE, 0x1F, 0x5B, 0x09, 0xC3, 0x14, 0x24, 0x10, 0xF5, 0x39, 0x6E, 0x02, 0x0D, 
+    0x00, 0x84, 0x33, 0x7F, 0x08, 0x00, 0x1F, 0x2C, 0xED, 0x07, 0xFF, 0x00, 0xAE, 0x35, 0x8B, 
+    0x16, 0x3E, 0x12, 0x01, 0xFE, 0xF6, 0x03, 0x03, 0xE8, 0x15, 0x27, 0x64, 0xF9, 0x32, 0xFB, 
+    0x3E, 0xCC, 0x4C, 0xD3, 0x06, 0xFF, 0xC8, 0x18, 0x26, 0x26, 0xCC, 0x1C, 0x82, 0x1D, 0x06, 
+    0x01, 0x36, 0x20, 0x66, 0x42, 0x6A, 0x06, 0x9F, 0x10, 0x10, 0x94, 0x27, 0xE8, 0x20, 0x45, 
+    0x16, 0x1B, 0x10, 0xF5, 0xF6, 0x27, 0x01, 0xFF, 0x53, 0x20, 0x73, 0x04, 0xCA, 0x11, 0xD3, 
+    0x10, 0x39, 0x13, 0xAC, 0x05, 0x52, 0x38, 0x0F, 0x23, 0xFF, 0x0C, 0x26, 0xA4, 0x11, 0x8A, 
+    0x38, 0x5C, 0x11, 0x72, 0x25, 0x91, 0x20, 0xBC, 0x13, 0x54, 0x1E, 0xFB, 0xD7, 0x3E, 0x67, 
+    0x2E, 0x1B, 0x0D, 0x1F, 0x36, 0x18, 0x02, 0x01, 0x30, 0x25, 0xB3, 0x11, 0xFF, 0x86, 0x28, 
+    0xC0, 0x14, 0xF1, 0x0F, 0x14, 0x16, 0xE7, 0x10, 0x67, 0x21, 0x0A, 0x11, 0x7F, 0x12, 0xDE, 
+    0x8E, 0x01, 0x05, 0x69, 0x27, 0xEC, 0x17, 0x51, 0x23, 0x1F, 0x13, 0x08, 0xFF, 0x21, 0xF7, 
+    0xDE, 0x24, 0x47, 0x16, 0xE4, 0x29, 0x1D, 0x87, 0x00, 0x4B, 0x19, 0x35, 0x03, 0xF2, 0x39, 
+    0xFE, 0xF6, 0x96, 0x27, 0x74, 0x00, 0x7A, 0x00, 0xD1, 0x01, 0x4B, 0x00, 0x61, 0x11, 0xF9, 
+    0x29, 0xFF, 0xA0, 0x10, 0xB9, 0x14, 0xCB, 0x43, 0xBE, 0x13, 0x84, 0x19, 0xC6, 0x20, 0x86, 
+    0x14, 0xA3, 0x2B, 0x7F, 0xB8, 0x14, 0x1D, 0x11, 0xAA, 0x49, 0xD8, 0x20, 0x80, 0x19, 0x1E, 
+    0x32, 0xFB, 0x12, 0x1B, 0xFC, 0x1B, 0x1F, 0x72, 0x05, 0x09, 0x00, 0x2B, 0x09, 0x72, 0x35, 
+    0xF6, 0x0D, 0xA7, 0x3B, 0xFF, 0x47, 0x2A, 0x38, 0x10, 0x48, 0x15, 0xEE, 0x01, 0xE7, 0x24, 
+    0x08, 0x11, 0xA9, 0x2C, 0x86, 0x11, 0xFF, 0x26, 0x10, 0xEA, 0x10, 0xE5, 0x00, 0x51, 0x03, 
+    0x57, 0x10, 0xAC, 0x26, 0xB4, 0x10, 0x3F, 0x14, 0xF9, 0x13, 0x21, 0x1D, 0x1F, 0xEE, 0x0A, 
+    0x02, 0x05, 0x61, 0x00, 0xF0, 0x48, 0x7A, 0x01, 0xCF, 0x12, 0x20, 0x34, 0x27, 0x59, 0x14, 
+    0x02, 0x07, 0x1B, 0x1B, 0xC3, 0x16, 0xCC, 0x3C, 0xFF, 0xCB, 0x3C, 0x17, 0x18, 0x42, 0x20, 
+    0x0F, 0x29, 0x29, 0x23, 0xCC, 0x4C, 0x41, 0x21, 0xC3, 0x2C, 0xBF, 0x0A, 0x11, 0xB0, 0x26, 
+    0x7C, 0x12, 0xC9, 0x19, 0xA7, 0x10, 0xA1, 0x35, 0x1E, 0x2F, 0x16, 0xFF, 0x73, 0x11, 0x8D, 
+    0x13, 0xCC, 0x30, 0x33, 0x22, 0x95, 0x12, 0x09, 0x34, 0x72, 0x31, 0x16, 0x20, 0xFF, 0xBD, 
+    0x00, 0xA7, 0x0B, 0x1E, 0x1A, 0x7C, 0x10, 0x60, 0x25, 0x13, 0x3E, 0x9F, 0x38, 0xD3, 0x20, 
+    0xFF, 0x8B, 0x49, 0xD3, 0x20, 0x70, 0x24, 0x22, 0x22, 0xBA, 0x05, 0x4E, 0x00, 0x3F, 0x01, 
+    0xB3, 0x01, 0xDF, 0x96, 0x30, 0xD2, 0x2C, 0xB5, 0x27, 0x32, 0x00, 0x62, 0x00, 0xF5, 0x21, 
+    0x07, 0x96, 0x12, 0xF7, 0xC0, 0x07, 0x2D, 0x04, 0xC5, 0x04, 0x1B, 0x37, 0x12, 0x3B, 0x1D, 
+    0x53, 0x2B, 0x91, 0x2D, 0xEF, 0x92, 0x2C, 0xAB, 0x22, 0xC3, 0x00, 0x23, 0x11, 0x01, 0x4A, 
+    0x02, 0xF3, 0x01, 0x0E, 0x13, 0xFD, 0x9F, 0xFD, 0x04, 0xF6, 0x72, 0x10, 0x2D, 0x39, 0x9C, 
+    0x14, 0x8A, 0x21, 0xF6, 0x36, 0x32, 0x20, 0xFF, 0xE0, 0x26, 0x25, 0x28, 0xC1, 0x21, 0x3A, 
+    0x12, 0xA3, 0x23, 0x6D, 0x00, 0x6E, 0x3C, 0xB4, 0x2C, 0xFF, 0x5F, 0x2D, 0x2C, 0x22, 0x80, 
+    0x20, 0x9A, 0x13, 0x7A, 0x10, 0xA8, 0x24, 0x23, 0x2C, 0xB3, 0x16, 0xFF, 0x88, 0x00, 0x3F, 
+    0x12, 0x29, 0x36, 0x94, 0x09, 0xE9, 0x15, 0x5F, 0x35, 0x2C, 0x21, 0xB6, 0x17, 0xFE, 0xF6, 
+    0x86, 0x1B, 0x83, 0x14, 0x52, 0x12, 0xC3, 0x01, 0x01, 0x10, 0xD1, 0x43, 0x81, 0x27, 0xFD, 
+    0x52, 0x07, 0xF6, 0xA4, 0x00, 0x6F, 0x36, 0xCB, 0x10, 0x9B, 0x2A, 0x91, 0x13, 0x7E, 0x2B, 
+    0xFF, 0xF6, 0x21, 0xF6, 0x15, 0x3B, 0x18, 0x46, 0x2D, 0x13, 0x14, 0x2E, 0x5D, 0x9F, 0xFD, 
+    0x04, 0x19, 0x3C, 0xFD, 0x68, 0x00, 0x1E, 0x7D, 0x2B, 0x7A, 0x0A, 0xB0, 0x28, 0xB0, 0x21, 
+    0x32, 0x10, 0xB8, 0x1A, 0xCF, 0xFB, 0x3F, 0xCC, 0x30, 0x31, 0x17, 0xC5, 0x18, 0x1D, 0x19, 
+    0xBB, 0x32, 0x9F, 0x47, 0xFF, 0xF5, 0x35, 0xF6, 0x2F, 0x67, 0x0D, 0xDB, 0x13, 0x35, 0x01, 
+    0x8F, 0x21, 0x37, 0x12, 0x5F, 0x10, 0xFF, 0x78, 0x08, 0xD2, 0x29, 0xC4, 0x00, 0x95, 0x10, 
+    0xF1, 0x29, 0xE1, 0x24, 0x44, 0x10, 0xC3, 0x20, 0xFF, 0xE4, 0x21, 0xC5, 0x16, 0xF6, 0x3C, 
+    0x0A, 0x21, 0x15, 0x23, 0x32, 0x00, 0x5B, 0x10, 0xBC, 0x0C, 0xFF, 0x27, 0x10, 0x3F, 0x2B, 
+    0xFC, 0x10, 0xE0, 0x05, 0x4F, 0x14, 0x90, 0x29, 0x22, 0x12, 0x7C, 0x2C, 0xFF, 0x4B, 0x11, 
+    0x3C, 0x14, 0x51, 0x11, 0x3A, 0x10, 0xB6, 0x10, 0xF4, 0x0B, 0x11, 0x28, 0xCD, 0x11, 0xDF, 
+    0xAC, 0x00, 0x79, 0x27, 0x52, 0x10, 0x2A, 0x3E, 0x59, 0x14, 0x1E, 0x90, 0x18, 0x38, 0x26, 
+    0xFD, 0x8E, 0x12, 0x02, 0x9D, 0x1C, 0x49, 0x10, 0xAB, 0x21, 0x01, 0x01, 0xCC, 0x00, 0x0B, 
+    0x10, 0xFF, 0x1D, 0x13, 0x37, 0x2C, 0xCC, 0x00, 0x9C, 0x0B, 0xE4, 0x02, 0xD3, 0x14, 0xA6, 
+    0x1B, 0x90, 0x35, 0xFF, 0x2F, 0x2A, 0x84, 0x00, 0xA2, 0x01, 0xEC, 0x11, 0x70, 0x20, 0xBE, 
+    0x2C, 0x48, 0x2C, 0x6F, 0x17, 0xFF, 0x9F, 0x10, 0x5A, 0x1E, 0x82, 0x24, 0x01, 0x1C, 0xE8, 
+    0x37, 0x1B, 0x3A, 0x84, 0x05, 0x40, 0x22, 0xFF, 0x22, 0x27, 0x36, 0x21, 0xC5, 0x06, 0x9B, 
+    0x13, 0x32, 0x00, 0x07, 0x12, 0x21, 0x06, 0xB5, 0x00, 0xFF, 0xFE, 0x20, 0x49, 0x23, 0xC9, 
+    0x0C, 0x1F, 0x2B, 0x84, 0x21, 0xA3, 0x12, 0x17, 0x10, 0xA7, 0x18, 0xFF, 0xC3, 0x02, 0xD0, 
+    0x19, 0x0A, 0x13, 0x7A, 0x18, 0x6E, 0x05, 0x8E, 0x01, 0x9F, 0xFD, 0x05, 0x4B, 0x63, 0xFF, 
+    0x51, 0x19, 0xE9, 0x10, 0x9B, 0x24, 0x0C, 0x21, 0x32, 0x10, 0x8E, 0x17, 0x27, 0x44, 0xE3, 
+    0x10, 0xFF, 0x27, 0x2B, 0xCC, 0x30, 0x35, 0x07, 0x79, 0x23, 0xE4, 0x33, 0x0B, 0x00, 0x89, 
+    0x00, 0xAF, 0x14, 0xFF, 0x2A, 0x3A, 0x6C, 0x12, 0x4D, 0x26, 0x45, 0x24, 0x3B, 0x20, 0x08, 
+    0x24, 0x60, 0x00, 0x9F, 0x35, 0xFF, 0x32, 0x11, 0x8B, 0x00, 0x80, 0x45, 0xFC, 0x12, 0x90, 
+    0x34, 0x3C, 0x20, 0x50, 0x00, 0x26, 0x00, 0xCF, 0x20, 0x25, 0x32, 0x40, 0x22, 0x10, 0xB0, 
+    0x03, 0xF6, 0xF6, 0xA3, 0x2C, 0x6B, 0x29, 0xFF, 0x07, 0x05, 0x3D, 0x30, 0x7B, 0x22, 0xE4, 
+    0x14, 0x91, 0x00, 0xC1, 0x2B, 0x60, 0x21, 0xF2, 0x14, 0xFF, 0x24, 0x0B, 0x4F, 0x11, 0xED, 
+    0x1A, 0x9F, 0xFD, 0x06, 0x4B, 0x63, 0xF5, 0x22, 0x17, 0x20, 0x96, 0x12, 0x7F, 0x94, 0x34, 
+    0x68, 0x26, 0x7C, 0x23, 0xF0, 0x24, 0x29, 0x19, 0x0D, 0x33, 0x34, 0x00, 0x19, 0xFF, 0xAB, 
+    0x20, 0xF9, 0x22, 0x32, 0x0D, 0x80, 0x14, 0x79, 0x12, 0x9F, 0x24, 0x04, 0x00, 0xC3, 0x15, 
+    0x7F, 0x50, 0x01, 0xA7, 0x3B, 0x23, 0x58, 0x14, 0x27, 0xE5, 0x25, 0x60, 0x1B, 0xB6, 0x11, 
+    0x02, 0xFF, 0x23, 0x00, 0xF8, 0x04, 0xAF, 0x29, 0xF3, 0x35, 0x95, 0x2C, 0x70, 0x00, 0x9C, 
+    0x13, 0x8F, 0x11, 0xFF, 0x3A, 0x24, 0x82, 0x00, 0xAE, 0x01, 0x4A, 0x1A, 0x66, 0x00, 0x82, 
+    0x2F, 0xC6, 0x1F, 0x3C, 0x1C, 0xFF, 0x54, 0x11, 0x38, 0x26, 0x3C, 0x02, 0x44, 0x31, 0xA4, 
+    0x07, 0x42, 0x12, 0x12, 0x26, 0xE8, 0x23, 0xFF, 0x2F, 0x0A, 0x9F, 0xFD, 0x09, 0x36, 0x12, 
+    0x8C, 0x0C, 0x85, 0x23, 0xDE, 0x24, 0xA5, 0x31, 0x63, 0x18, 0x7D, 0x32, 0x10, 0x1B, 0xCC, 
+    0x10, 0x8A, 0x24, 0xCC, 0x40, 0x92, 0x3E, 0x5E, 0x00, 0x1A, 0xFF, 0x98, 0x21, 0x01, 0x36, 
+    0xDA, 0x33, 0xBE, 0x13, 0x51, 0x18, 0xB6, 0x21, 0x40, 0x11, 0x12, 0x2A, 0xFD, 0x89, 0x22, 
+    0x2E, 0xD9, 0x04, 0xF7, 0x20, 0xA2, 0x16, 0xA9, 0x13, 0x9C, 0x06, 0x87, 0x1F, 0xFF, 0x3C, 
+    0x2A, 0x05, 0x24, 0x41, 0x10, 0xA3, 0x23, 0xD0, 0x15, 0x63, 0x2A, 0x82, 0x45, 0x14, 0x32, 
+    0xFF, 0xBF, 0xF5, 0x27, 0x32, 0x50, 0x3F, 0xF0, 0x26, 0x8F, 0x21, 0x66, 0x14, 0xB6, 0x10, 
+    0xCC, 0x00, 0x0A, 0x27, 0xFD, 0x1A, 0x1F, 0x1A, 0xA4, 0x11, 0xD5, 0x38, 0x2F, 0x2C, 0xB7, 
+    0x24, 0x32, 0x2C, 0x53, 0x34, 0xFF, 0x64, 0x17, 0xA7, 0x4B, 0x23, 0x10, 0x9F, 0x28, 0x1E, 
+    0x33, 0x61, 0x1E, 0x10, 0x01, 0xA3, 0x2C, 0xFF, 0x4A, 0x11, 0x13, 0x1A, 0x2C, 0x33, 0xFB, 
+    0x07, 0x7D, 0x1A, 0x7B, 0x35, 0x0C, 0x3E, 0x95, 0x2D, 0xFF, 0xBA, 0x1C, 0xBF, 0xF5, 0x25, 
+    0x0E, 0x14, 0x79, 0x14, 0x3F, 0xF0, 0x26, 0xE6, 0x19, 0x3C, 0x13, 0xD3, 0x28, 0xFF, 0xD1, 
+    0x2B, 0xAF, 0x00, 0xCC, 0x00, 0xFB, 0x1B, 0x32, 0x4C, 0x3E, 0x2F, 0x32, 0x4C, 0x01, 0x1C, 
+    0xFF, 0x4A, 0x28, 0x5F, 0x10, 0xB7, 0x23, 0xFE, 0x10, 0x08, 0x2C, 0x67, 0x23, 0x94, 0x12, 
+    0x22, 0x01, 0xFF, 0x01, 0x00, 0x05, 0x00, 0xC6, 0x29, 0xB2, 0x12, 0x2C, 0x10, 0x31, 0x32, 
+    0x73, 0x2F, 0xCB, 0x3A, 0xFF, 0xB3, 0x33, 0xFD, 0x2B, 0xE7, 0x36, 0x3D, 0x11, 0x19, 0x36, 
+    0x50, 0x00, 0xC7, 0x0C, 0x52, 0x10, 0xFE, 0x1D, 0x47, 0x0C, 0x75, 0x39, 0xB3, 0x05, 0x25, 
+    0x11, 0xCA, 0x10, 0x82, 0x10, 0xC5, 0x2A, 0xFF, 0x32, 0x30, 0xD2, 0x20, 0x3F, 0xF0, 0x26, 
+    0xC4, 0x28, 0xCC, 0x40, 0x94, 0x25, 0x23, 0x00, 0x8D, 0x00, 0xFF, 0x04, 0x00, 0xAC, 0x2C, 
+    0xFA, 0x2C, 0x32, 0x4C, 0xE1, 0x25, 0xAD, 0x47, 0x37, 0x30, 0xA7, 0x4B, 0xFF, 0x37, 0x20, 
+    0x25, 0x06, 0xF3, 0x1A, 0x78, 0x1A, 0xCE, 0x12, 0x1C, 0x33, 0xF1, 0x3F, 0xF2, 0x18, 0xBF, 
+    0xF1, 0x00, 0x06, 0x32, 0xCC, 0x2F, 0x0B, 0x34, 0x82, 0x1C, 0x17, 0x2A, 0xF5, 0xBF, 0xF6, 
+    0x29, 0x7F, 0x32, 0x30, 0x3F, 0xF0, 0x28, 0x81, 0x14, 0x6A, 0x1F, 0xCC, 0x40, 0xA9, 0x10, 
+    0xFC, 0x28, 0x19, 0x7F, 0xB5, 0x26, 0x8B, 0x4B, 0x16, 0x01, 0x34, 0x0B, 0xDB, 0x00, 0xE5, 
+    0x11, 0x55, 0x2F, 0x01, 0xFF, 0x5F, 0x1B, 0xA7, 0x6B, 0x14, 0x16, 0xF2, 0x19, 0x73, 0x13, 
+    0x97, 0x24, 0x48, 0x10, 0x25, 0x1D, 0xFF, 0x57, 0x22, 0x53, 0x33, 0xA1, 0x2A, 0x60, 0x15, 
+    0x56, 0x1A, 0x1A, 0x17, 0x9A, 0x10, 0x28, 0x03, 0xFF, 0xB5, 0x10, 0x20, 0x10, 0xBF, 0xF5, 
+    0x26, 0xF0, 0x03, 0x9F, 0x14, 0x3F, 0xF0, 0x25, 0x03, 0x14, 0xCC, 0x10, 0xFF, 0x92, 0x20, 
+    0xCC, 0x00, 0x27, 0x31, 0x57, 0x3E, 0xAB, 0x00, 0x75, 0x15, 0xA0, 0x34, 0x6B, 0x34, 0xFD, 
+    0xF8, 0x11, 0x1F, 0x53, 0x62, 0xA7, 0x5B, 0xA9, 0x2D, 0x7F, 0x04, 0xF5, 0x02, 0x64, 0x10, 
+    0xFE, 0x02, 0x0F, 0x3D, 0x02, 0x26, 0xE2, 0x07, 0xCC, 0x25, 0xCC, 0x08, 0x82, 0x03, 0x25, 
+    0x15, 0xEF, 0xE2, 0x25, 0x4F, 0x01, 0x54, 0x20, 0x9A, 0x00, 0x02, 0x6D, 0x14, 0xBF, 0xF5, 
+    0x27, 0x9B, 0x20, 0xFF, 0x78, 0x15, 0xFF, 0xF5, 0x26, 0xCC, 0x00, 0x45, 0x10, 0x07, 0x0C, 
+    0xA6, 0x02, 0xB8, 0x2B, 0xF3, 0x23, 0x9C, 0x01, 0x03, 0xD9, 0x24, 0xB4, 0x33, 0xE4, 0x23, 
+    0x1F, 0x1B, 0x9A, 0x08, 0xFF, 0xED, 0x08, 0xAE, 0x17, 0x53, 0x42, 0x9A, 0x27, 0x46, 0x2E, 
+    0x15, 0x22, 0x72, 0x21, 0x5B, 0x23, 0xE7, 0x0F, 0x30, 0x18, 0x22, 0x11, 0x00, 0xF5, 0xF5, 
+    0x5D, 0x00, 0x03, 0x2D, 0xF7, 0x0D, 0xFD, 0xB8, 0x27, 0x1B, 0x04, 0x10, 0x6B, 0x19, 0x28, 
+    0x20, 0x8F, 0x11, 0x45, 0x00, 0x8D, 0x18, 0xFF, 0x55, 0x26, 0x99, 0x02, 0x9E, 0x10, 0x40, 
+    0x21, 0x0B, 0x6A, 0x46, 0x28, 0xDC, 0x12, 0x8A, 0x4A, 0xBF, 0xD5, 0x21, 0xC2, 0x02, 0xE5, 
+    0x32, 0x3F, 0xF0, 0x27, 0x32, 0x21, 0xCC, 0x00, 0xF5, 0xC7, 0x16, 0xFF, 0x9F, 0x29, 0xCC, 
+    0x30, 0x17, 0x19, 0x46, 0x00, 0x32, 0x14, 0x05, 0x3C, 0x9F, 0xFC, 0x12, 0x93, 0x1D, 0x9F, 
+    0x77, 0x23, 0x12, 0x18, 0x3D, 0x25, 0x25, 0x03, 0x11, 0x00, 0x1D, 0x1B, 0xDE, 0x17, 0xCC, 
+    0xF6, 0x1E, 0x32, 0x24, 0x1F, 0x13, 0x1B, 0xF5, 0x6F, 0x07, 0x90, 0x20, 0xFF, 0x23, 0x1C, 
+    0x32, 0x10, 0x81, 0x22, 0x7C, 0x23, 0xA4, 0x11, 0x43, 0x14, 0xF0, 0x1B, 0xF3, 0x39, 0xFF, 
+    0x0B, 0x2A, 0x6E, 0x08, 0x50, 0x37, 0x83, 0x2A, 0x86, 0x28, 0x00, 0x20, 0xE1, 0x35, 0x3F, 
+    0xF0, 0x27, 0xFF, 0x20, 0x1A, 0x35, 0x01, 0xA1, 0x02, 0xCC, 0x30, 0x2B, 0x37, 0x54, 0x00, 
+    0xF9, 0x02, 0x48, 0x3F, 0xFF, 0x2A, 0x00, 0xC3, 0x2C, 0xFD, 0x11, 0x23, 0x00, 0x60, 0x04, 
+    0x53, 0x62, 0x0D, 0x25, 0x03, 0x13, 0x7F, 0x42, 0x2B, 0x75, 0x10, 0x33, 0x20, 0x8F, 0x13, 
+    0x49, 0x21, 0x7B, 0x13, 0x53, 0x22, 0x1D, 0xFF, 0xCB, 0x0A, 0x95, 0x04, 0x17, 0x2B, 0x47, 
+    0x00, 0x4D, 0x10, 0xB4, 0x11, 0x22, 0x1D, 0xC1, 0x26, 0xFF, 0x35, 0x4D, 0xCE, 0x1B, 0x9E, 
+    0x11, 0x03, 0x1A, 0x54, 0x1D, 0x73, 0x17, 0x0B, 0x69, 0x1C, 0x0C, 0x7F, 0x95, 0x3F, 0xED, 
+    0x26, 0xFA, 0x1B, 0x72, 0x24, 0x6D, 0x44, 0x3F, 0xF0, 0x26, 0xCC, 0x10, 0x2E, 0xEF, 0xCC, 
+    0x40, 0x8B, 0x22, 0xBA, 0x20, 0x4F, 0x08, 0x9C, 0xC9, 0x17, 0x1C, 0x10, 0x08, 0x2E, 0x7F, 
+    0xF8, 0x2D, 0x9F, 0xFC, 0x0F, 0x47, 0x1D, 0x73, 0x25, 0xD2, 0x10, 0x12, 0x10, 0xFF, 0x2B, 
+    0x2E, 0xFF, 0xB4, 0x0F, 0x32, 0x33, 0x71, 0x16, 0x22, 0x00, 0x8C, 0x01, 0x67, 0x33, 0x28, 
+    0x12, 0x32, 0x30, 0xFF, 0x63, 0x11, 0x99, 0x13, 0xBF, 0x30, 0xA0, 0x11, 0xAB, 0x20, 0x1B, 
+    0x23, 0xCC, 0x18, 0x40, 0x01, 0xDE, 0xF6, 0x7C, 0x20, 0x13, 0x00, 0xD5, 0x10, 0x98, 0x00, 
+    0x1F, 0x54, 0x10, 0xE5, 0x03, 0xFF, 0xB9, 0x2D, 0x3F, 0xF0, 0x27, 0xCC, 0x10, 0x32, 0x10, 
+    0xCC, 0x10, 0x1F, 0x14, 0x07, 0x21, 0xA7, 0x17, 0xBE, 0x19, 0xA4, 0x1B, 0xE3, 0x25, 0xED, 
+    0x10, 0xB9, 0x11, 0x9F, 0xFC, 0x11, 0x1D, 0x42, 0x1A, 0xC7, 0x43, 0x20, 0x4B, 0x36, 0x08, 
+    0x11, 0x1C, 0x1C, 0xF6, 0x0A, 0x1A, 0x5E, 0x10, 0xFF, 0xE7, 0x16, 0xBE, 0x0B, 0x76, 0x04, 
+    0x2B, 0x10, 0x68, 0x2F, 0x91, 0x12, 0xB1, 0x24, 0x4B, 0x18, 0xBF, 0x18, 0x00, 0x9F, 0x13, 
+    0xD5, 0x01, 0x28, 0x04, 0x5A, 0x20, 0x1D, 0x12, 0xF6, 0x3C, 0x12, 0xFF, 0x33, 0x01, 0x57, 
+    0x29, 0xA1, 0x00, 0x5D, 0x25, 0x92, 0x14, 0x67, 0x37, 0xBB, 0x01, 0x6B, 0x40, 0x7F, 0x3F, 
+    0xF0, 0x22, 0xAF, 0x10, 0xCB, 0x20, 0xCC, 0x00, 0x1A, 0x10, 0xCC, 0x10, 0x29, 0x18, 0x1C, 
+    0xFE, 0x1A, 0x7C, 0x1B, 0x2B, 0x02, 0x2C, 0x18, 0x08, 0x27, 0x9F, 0xFC, 0x11, 0x7D, 0x27, 
+    0x44, 0x1A, 0x77, 0x05, 0x32, 0x59, 0x17, 0x3B, 0x12, 0x1E, 0x9A, 0x22, 0x7A, 0x28, 0x7F, 
+    0x00, 0xF6, 0xF0, 0xF6, 0x01, 0x1E, 0xF6, 0x1C, 0x25, 0x4A, 0x1F, 0xFE, 0x13, 0x9A, 0x13, 
+    0xDF, 0x1E, 0x17, 0x59, 0x28, 0x30, 0x29, 0x61, 0x32, 0x6E, 0x36, 0x2E, 0xE0, 0x0B, 0xCC, 
+    0x01, 0xFF, 0x3C, 0x04, 0x6B, 0x1D, 0x30, 0x3F, 0xFF, 0x3C, 0x51, 0x27, 0xC5, 0x3A, 0x3F, 
+    0xF0, 0x27, 0xBC, 0x10, 0xFF, 0xD1, 0x20, 0xCC, 0x40, 0xC9, 0x27, 0xC9, 0x25, 0xAF, 0x12, 
+    0xF7, 0x2A, 0x09, 0x14, 0x1F, 0x02, 0xFF, 0xC6, 0x23, 0xA8, 0x21, 0x53, 0x62, 0xBE, 0x2B, 
+    0x1F, 0x37, 0xE5, 0x27, 0x78, 0x01, 0x1E, 0x2D, 0xF7, 0xFD, 0x45, 0x96, 0x23, 0xE6, 0x12, 
+    0xF6, 0x2A, 0x01, 0x14, 0x2F, 0x99, 0x32, 0x52, 0x1D, 0x1F, 0xB8, 0x02, 0x0D, 0x01, 0x2E, 
+    0x07, 0x48, 0x1D, 0xA6, 0x12, 0x1B, 0x1B, 0x1F, 0xDE, 0x1B, 0x55, 0x37, 0x0D, 0x13, 0x97, 
+    0x25, 0x4D, 0x18, 0x01, 0x13, 0x10, 0xC2, 0x00, 0xBF, 0xE4, 0x0D, 0x9C, 0x3E, 0xE0, 0x16, 
+    0x8F, 0x13, 0x37, 0x01, 0x32, 0x00, 0x2E, 0x1E, 0x00, 0xFE, 0x1F, 0x32, 0x00, 0x3F, 0xF0, 
+    0x27, 0x0C, 0x28, 0x2D, 0x1C, 0x06, 0x3E, 0xEB, 0x57, 0xBE, 0x46, 0xEF, 0x5F, 0x6C, 0xF1, 
+    0x10, 0x43, 0x0A, 0x0B, 0x15, 0x01, 0x6F, 0x0F, 0x52, 0x6C, 0xE0, 0x10, 0xFF, 0x51, 0x33, 
+    0x85, 0x27, 0x81, 0x3C, 0x34, 0x27, 0x2A, 0x11, 0xEC, 0x16, 0x30, 0x1C, 0xFF, 0x2F, 0xFF, 
+    0x06, 0x04, 0x77, 0x19, 0x22, 0x06, 0x3A, 0x01, 0x0B, 0x11, 0x38, 0x16, 0xAB, 0x04, 0x30, 
+    0x34, 0xDB, 0x63, 0x1B, 0x3B, 0x46, 0xF6, 0x94, 0x12, 0xB8, 0x0A, 0x2E, 0x42, 0x1D, 0x69, 
+    0x20, 0x7F, 0x97, 0x20, 0x6E, 0x07, 0xB1, 0x36, 0x2F, 0x10, 0xE0, 0x0F, 0xC4, 0x23, 0x32, 
+    0x10, 0x1B, 0xBF, 0x32, 0x00, 0x3F, 0xF0, 0x27, 0x1F, 0xFD, 0x07, 0xC2, 0x06, 0x5F, 0xBC, 
+    0xCF, 0x1F, 0x1F, 0xB8, 0x12, 0xFF, 0x42, 0x3C, 0x58, 0x15, 0x1C, 0x20, 0xE9, 0x0C, 0xC5, 
+    0x31, 0x40, 0x27, 0x2B, 0x2D, 0x14, 0x1A, 0x3F, 0x3C, 0x12, 0x49, 0x1C, 0x45, 0x00, 0x8A, 
+    0x00, 0x65, 0x21, 0x57, 0x22, 0x01, 0xF6, 0xFF, 0xFC, 0x25, 0x23, 0x10, 0x32, 0x40, 0xB3, 
+    0x14, 0x31, 0x13, 0xBE, 0x19, 0xAF, 0x24, 0x0F, 0x2E, 0x1F, 0x9A, 0x16, 0xAE, 0x24, 0xB9, 
+    0x00, 0x56, 0x20, 0x43, 0x20, 0x1C, 0xF5, 0xF6, 0xBF, 0xE1, 0x3B, 0xF1, 0x33, 0x32, 0x20, 
+    0xFF, 0x26, 0x3F, 0xF0, 0x26, 0x1F, 0xFD, 0x07, 0x1A, 0x5F, 0xBC, 0xFD, 0x40, 0x00, 0xF5, 
+    0x52, 0x0C, 0xDA, 0x2C, 0x14, 0x42, 0x52, 0x1C, 0x4A, 0x36, 0x3D, 0x0F, 0x3F, 0xF6, 0x28, 
+    0x4A, 0x2C, 0xE3, 0x25, 0x5F, 0x03, 0x17, 0x28, 0x8A, 0x1B, 0x01, 0xF6, 0xC3, 0x00, 0x7A, 
+    0x77, 0x13, 0x2E, 0x1B, 0x1E, 0xF5, 0x85, 0x12, 0x06, 0x13, 0xAF, 0xFF, 0x3C, 0x12, 0x17, 
+    0x0E, 0x10, 0x46, 0x3B, 0x1B, 0x28, 0x21, 0x1E, 0x2B, 0x22, 0x5B, 0x76, 0x22, 0xE1, 0x14, 
+    0xF6, 0x33, 0x02, 0x4E, 0x02, 0x1D, 0xAC, 0x17, 0x1F, 0x7F, 0x42, 0x01, 0x8A, 0x30, 0xE6, 
+    0x1D, 0x98, 0x13, 0xFA, 0x00, 0x3F, 0xF0, 0x25, 0x1F, 0xFD, 0x07, 0x19, 0xEF, 0xD3, 0x00, 
+    0xCC, 0x23, 0x20, 0x3F, 0xA6, 0x00, 0xF6, 0xC4, 0x08, 0xAD, 0x22, 0x2B, 0x00, 0x7F, 0x30, 
+    0x00, 0x66, 0x00, 0xED, 0x2F, 0xE1, 0x13, 0x13, 0x2E, 0x2D, 0x00, 0x01, 0x15, 0xF5, 0x5F, 
+    0xCC, 0x14, 0x93, 0x15, 0xD6, 0x04, 0x9D, 0x20, 0x2F, 0x1A, 0x1B, 0x25, 0x11, 0x1E, 0xF3, 
+    0x6B, 0x1A, 0xF8, 0x0A, 0x1E, 0xF6, 0x85, 0x00, 0x17, 0x17, 0x3A, 0x4A, 0x32, 0x00, 0x5F, 
+    0x61, 0x28, 0x37, 0x08, 0x7F, 0x10, 0x72, 0x06, 0xB2, 0x05, 0xF6, 0xB1, 0x04, 0xF6, 0xF7, 
+    0x77, 0x03, 0x45, 0x11, 0x38, 0x00, 0xF6, 0x7D, 0x00, 0xAD, 0x24, 0xD0, 0x00, 0x15, 0x00, 
+    0xFF, 0xE1, 0x33, 0x45, 0x28, 0x83, 0x23, 0x0C, 0x20, 0xCB, 0x39, 0xB1, 0x11, 0x3F, 0x50, 
+    0x72, 0x08, 0xFF, 0xDE, 0x11, 0x3F, 0xF0, 0x09, 0xCB, 0x69, 0xCC, 0x00, 0xC6, 0x28, 0xEB, 
+    0x26, 0xCC, 0x00, 0x99, 0x17, 0xFF, 0x5F, 0x7C, 0x2D, 0x1C, 0x58, 0x04, 0x61, 0x4B, 0x02, 
+    0x32, 0x00, 0x35, 0x2E, 0x27, 0x45, 0x24, 0xFD, 0x08, 0x04, 0x1B, 0x87, 0x2C, 0xCD, 0x2A, 
+    0x6E, 0x01, 0xED, 0x12, 0xF6, 0x35, 0x65, 0x11, 0x97, 0x44, 0x20, 0x5C, 0x13, 0x2F, 0x00, 
+    0x1E, 0x89, 0x14, 0x2E, 0xF5, 0x35, 0x02, 0xFF, 0x32, 0x00, 0x41, 0x10, 0x4A, 0x10, 0x13, 
+    0x43, 0x91, 0x00, 0x17, 0x2C, 0x40, 0x29, 0xA1, 0x15, 0xFE, 0x2E, 0x9A, 0x15, 0x79, 0x1E, 
+    0x26, 0x12, 0x9E, 0x2D, 0x77, 0x13, 0x83, 0x23, 0x7B, 0x21, 0xDF, 0x52, 0x2E, 0x84, 0x35, 
+    0x0C, 0x30, 0x3F, 0x80, 0xD5, 0x01, 0xF6, 0x8C, 0x01, 0x3F, 0xF0, 0x08, 0xFD, 0x1F, 0xFD, 
+    0x07, 0x1A, 0x5F, 0xBC, 0x84, 0x11, 0xB3, 0x35, 0x25, 0x17, 0xE9, 0x00, 0x1E, 0x2C, 0xFF, 
+    0x4F, 0x25, 0x78, 0x28, 0xDB, 0x2E, 0x32, 0x10, 0x24, 0x03, 0x31, 0x28, 0x7D, 0x10, 0x52, 
+    0x27, 0xED, 0xA0, 0x3A, 0x1B, 0x00, 0x3A, 0x5D, 0x20, 0x1B, 0x90, 0x11, 0x1E, 0x25, 0x25, 
+    0x10, 0xFE, 0x1B, 0xC1, 0x07, 0x92, 0x26, 0x23, 0x02, 0x50, 0x20, 0x50, 0x4E, 0x64, 0x02, 
+    0x21, 0x24, 0x3F, 0x8C, 0x00, 0xD5, 0x07, 0x7D, 0x2E, 0x4E, 0x41, 0xAA, 0x17, 0xF6, 0x33, 
+    0x1B, 0x1B, 0x7F, 0x3D, 0x19, 0x9E, 0x0F, 0x3F, 0x20, 0xAA, 0x0A, 0x6B, 0x1F, 0x3F, 0x80, 
+    0x5F, 0x00, 0xF6, 0xFF, 0x6E, 0x00, 0x3F, 0xF0, 0x09, 0x1F, 0xFD, 0x07, 0x0C, 0x05, 0x5F, 
+    0xAC, 0xDC, 0x16, 0x52, 0x3C, 0x03, 0x1F, 0xFF, 0x2F, 0x00, 0xD4, 0x09, 0xE6, 0x15, 0x58, 
+    0x14, 0x73, 0x39, 0xF5, 0x36, 0xF2, 0x2C, 0x41, 0x3E, 0xBF, 0x1A, 0x10, 0x2F, 0x35, 0x00, 
+    0x3A, 0x17, 0x12, 0x7C, 0x16, 0x17, 0x05, 0x1D, 0x8B, 0x11, 0xFF, 0x0D, 0x12, 0x5F, 0x2B, 
+    0x15, 0x19, 0x03, 0x00, 0x28, 0x11, 0x8D, 0x00, 0xA1, 0x04, 0xC5, 0x12, 0xFF, 0xD4, 0x10, 
+    0xA5, 0x11, 0xC0, 0x18, 0x25, 0x24, 0x88, 0x14, 0xAD, 0x34, 0x3B, 0x10, 0x4A, 0x14, 0xFF, 
+    0xF8, 0x24, 0xD9, 0x11, 0x9C, 0x00, 0x3F, 0x10, 0x0C, 0x40, 0x3F, 0x70, 0xF7, 0x14, 0x09, 
+    0x16, 0xCF, 0x3F, 0xF0, 0x09, 0x1F, 0xFD, 0x06, 0xF9, 0x2E, 0x14, 0x27, 0x1B, 0xF6, 0xA8, 
+    0x2F, 0xCA, 0x1A, 0xFD, 0x30, 0x2D, 0xF6, 0xBF, 0x03, 0x4E, 0x20, 0xDB, 0x2B, 0x24, 0x27, 
+    0x09, 0x2C, 0x35, 0x48, 0xFF, 0x88, 0x13, 0xEF, 0x4A, 0x29, 0x23, 0x96, 0x13, 0x8F, 0x23, 
+    0x32, 0x50, 0xD7, 0x20, 0x65, 0x37, 0xFF, 0x32, 0x50, 0x57, 0x37, 0x4D, 0x38, 0x62, 0x11, 
+    0x57, 0x47, 0x53, 0x31, 0x22, 0x1A, 0x32, 0x90, 0xFB, 0x8D, 0x34, 0x8C, 0x06, 0x1B, 0xDC, 
+    0x01, 0x73, 0x14, 0x55, 0x2C, 0x66, 0x01, 0xF2, 0x03, 0xFF, 0xC6, 0x27, 0xBD, 0x27, 0xDD, 
+    0x29, 0x32, 0x20, 0x12, 0x21, 0xCE, 0x28, 0x8B, 0x10, 0xCC, 0x80, 0xFF, 0xD8, 0x21, 0x8C, 
+    0x14, 0x32, 0x70, 0xCB, 0x48, 0xCC, 0x1F, 0x33, 0x10, 0x12, 0x00, 0x9C, 0x12, 0xFD, 0x5E, 
+    0x16, 0x1F, 0x11, 0x01, 0x1E, 0x24, 0x04, 0x10, 0x13, 0x00, 0x4C, 0x12, 0x6D, 0x3B, 0xFF, 
+    0xD9, 0x28, 0x39, 0x3B, 0x3A, 0x38, 0x32, 0x00, 0x98, 0x21, 0x32, 0x40, 0xDC, 0x14, 0xF6, 
+    0x21, 0xFF, 0x32, 0x00, 0x91, 0x16, 0x95, 0x3A, 0x51, 0x14, 0x01, 0x16, 0x32, 0x20, 0x57, 
+    0x37, 0xAE, 0x48, 0xFB, 0xA9, 0x04, 0x57, 0x47, 0x1E, 0x81, 0x24, 0x36, 0x18, 0x32, 0x50, 
+    0x70, 0x10, 0x35, 0x4F, 0xFB, 0xF8, 0x1A, 0x45, 0x2C, 0x1F, 0x65, 0x30, 0xA9, 0x24, 0xB1, 
+    0x11, 0xE7, 0x17, 0x69, 0x13, 0xFF, 0x32, 0x50, 0x0F, 0x12, 0x5B, 0x30, 0x32, 0x30, 0x2F, 
+    0x45, 0xCC, 0x30, 0x32, 0x40, 0xAF, 0x27, 0x3B, 0xB9, 0x3C, 0xCC, 0x40, 0x02, 0xC1, 0x5B, 
+    0xDE, 0x03, 0xFC, 0x19, 0xF5, 0x02, 0xFB, 0x54, 0x13, 0x04, 0x18, 0x01, 0x2D, 0x10, 0x89, 
+    0x10, 0x54, 0x09, 0xFE, 0x30, 0x01, 0x32, 0xF7, 0x38, 0x20, 0xDF, 0x34, 0x32, 0x20, 0x2E, 
+    0x32, 0x00, 0x2E, 0x11, 0xE0, 0x2C, 0x8C, 0x12, 0xFF, 0xA7, 0x2B, 0x32, 0x30, 0x8B, 0x22, 
+    0x32, 0x80, 0x57, 0x27, 0x26, 0x2C, 0x5E, 0x26, 0x57, 0x47, 0xFF, 0x16, 0x01, 0x37, 0x10, 
+    0x36, 0x16, 0xB8, 0x1B, 0x8B, 0x34, 0x47, 0x4A, 0x30, 0x22, 0x48, 0x0C, 0xFF, 0x56, 0x11, 
+    0x9E, 0x2D, 0xB4, 0x1B, 0xCC, 0x10, 0xB7, 0x20, 0xA4, 0x3B, 0xFB, 0x20, 0xD2, 0x30, 0xFF, 
+    0x9C, 0x27, 0x11, 0x22, 0x88, 0x17, 0xCC, 0x30, 0x30, 0x29, 0x04, 0x11, 0xCC, 0x80, 0x32, 
+    0x40, 0x58, 0x01, 0x1D, 0x1A, 0x30, 0x10, 0xE2, 0x03, 0x2E, 0xEE, 0x09, 0x1D, 0xF8, 0x1B, 
+    0xF5, 0x1B, 0xC2, 0x03, 0x39, 0x00, 0xA4, 0x04, 0xE0, 0x28, 0xD4, 0x26, 0xFF, 0x51, 0x10, 
+    0x7A, 0x17, 0xEE, 0x10, 0x13, 0x2B, 0x32, 0x30, 0x25, 0x10, 0x32, 0x10, 0x21, 0x24, 0xFF, 
+    0x32, 0x40, 0x1F, 0x00, 0x11, 0x44, 0x32, 0x70, 0x8B, 0x33, 0x32, 0x20, 0x3E, 0x10, 0x79, 
+    0x22, 0xFF, 0xF3, 0x12, 0x66, 0x10, 0x5F, 0x2C, 0x55, 0x35, 0x13, 0x11, 0x14, 0x25, 0x19, 
+    0x10, 0x7D, 0x30, 0xFF, 0x2E, 0x3F, 0xB7, 0x27, 0x65, 0x30, 0x02, 0x10, 0x66, 0x00, 0x6F, 
+    0x10, 0x99, 0x00, 0xCD, 0x10, 0xFF, 0xDC, 0x14, 0x0C, 0x28, 0x9B, 0x27, 0x32, 0x20, 0xCC, 
+    0x20, 0x12, 0x20, 0xCC, 0x00, 0x05, 0x00, 0xBE, 0x2E, 0x32, 0x80, 0x21, 0x20, 0x42, 0x15, 
+    0xDA, 0x2C, 0x30, 0x10, 0x5C, 0x0F, 0x02, 0xF9, 0xED, 0x0F, 0x1F, 0x1E, 0xF7, 0x06, 0x3A, 
+    0x16, 0xE0, 0x1D, 0x08, 0x20, 0xBE, 0x19, 0xB9, 0x4D, 0x2B, 0x1F, 0x1E, 0x0A, 0x10, 0x7C, 
+    0x34, 0x27, 0x20, 0x1E, 0xD6, 0x14, 0xFF, 0x27, 0x00, 0x0A, 0x00, 0x5F, 0x1E, 0x7D, 0x07, 
+    0x2B, 0x16, 0x1E, 0x30, 0x32, 0x00, 0x80, 0x0D, 0xFF, 0x3D, 0x20, 0x33, 0x20, 0x06, 0x10, 
+    0x5A, 0x10, 0x80, 0x2F, 0x86, 0x17, 0x4C, 0x10, 0x07, 0x00, 0xFF, 0x2D, 0x0A, 0x06, 0x00, 
+    0xC4, 0x0B, 0x49, 0x10, 0xCC, 0x1B, 0x59, 0x00, 0x66, 0x70, 0x5C, 0x30, 0x9F, 0x48, 0x20, 
+    0x7E, 0x00, 0x65, 0x30, 0xC1, 0x15, 0x65, 0x50, 0x1F, 0x01, 0x6A, 0x0C, 0xFB, 0x8C, 0x10, 
+    0x32, 0x90, 0x1E, 0x8F, 0x10, 0xBF, 0x20, 0xA4, 0x00, 0xF3, 0x2A, 0x0C, 0x00, 0x3F, 0x32, 
+    0x80, 0xFE, 0x07, 0xCC, 0xB0, 0x27, 0x10, 0xA9, 0x03, 0x08, 0x10, 0x1F, 0x1F, 0xF8, 0x8E, 
+    0x8E, 0x8E, 0x03, 0x00, 0x38, 0x00, 0xA1, 0x10, 0x71, 0x20, 0x11, 0x00, 0xFF, 0x13, 0x10, 
+    0x01, 0x00, 0x1D, 0x10, 0x03, 0x00, 0xD7, 0x50, 0x4D, 0x20, 0x32, 0xF0, 0x00, 0x08, 0x00, 
+    0xFF, 0x32, 0x60, 0x1E, 0x00, 0x32, 0x60, 0x3F, 0x20, 0x37, 0x50, 0x15, 0x20, 0x76, 0x00, 
+    0x32, 0xC0, 0xFF, 0x14, 0x00, 0x32, 0x20, 0x6D, 0x30, 0x32, 0x70, 0x66, 0x30, 0x32, 0x30, 
+    0xBA, 0x20, 0xB2, 0x10, 0xDD, 0x32, 0x40, 0x8E, 0x32, 0x80, 0x47, 0x00, 0x32, 0xE0, 0x8E, 
+    0x32, 0x40, 0x17, 0x01, 0x0F, 0x66, 0x30, 0xC2, 0x50, 0x6F, 0x20, 0x32, 0x50, 0x1C
 };
 
@@ -5,4376 +5,206 @@ typedef unsigned char byte;
 const int conchars_width  = 128;
 const int conchars_height = 128;
 const int conchars_size_bytes = 65536;
-const byte conchars_data[] __attribute__((aligned(16))) = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3B, 0x3B, 0x00, 0x3F, 0x3B, 0x3B, 0xFF, 0x53, 
-    0x4B, 0x53, 0xFF, 0x47, 0x3F, 0x43, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 
-    0x4F, 0x47, 0x4B, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x4F, 0x47, 0x4B, 
-    0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x4F, 0x47, 
-    0x4B, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x43, 0x43, 0x33, 0xFF, 0x37, 
-    0x37, 0x2B, 0xFF, 0x37, 0x37, 0x2B, 0xFF, 0x37, 0x37, 0x2B, 0xFF, 0x37, 0x37, 0x2B, 0xFF, 
-    0x2F, 0x2F, 0x23, 0x00, 0x2B, 0x2B, 0x23, 0x00, 0x2B, 0x2B, 0x23, 0xFF, 0x3B, 0x37, 0x37, 
-    0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2B, 0x2B, 
-    0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x1B, 0x1B, 0x1B, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 
-    0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 
-    0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x1B, 0x1B, 0x1B, 
-    0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x23, 0x23, 
-    0x23, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x2B, 
-    0x2B, 0x23, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x23, 0x23, 0x1B, 0xFF, 
-    0x2B, 0x2B, 0x23, 0xFF, 0x23, 0x23, 0x1B, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x23, 0x23, 0x23, 
-    0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 
-    0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 
-    0x07, 0x07, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x33, 0x2F, 0x2F, 0xFF, 0x37, 0x37, 0x2B, 0xFF, 
-    0x33, 0x2F, 0x2F, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x33, 0x2F, 0x2F, 
-    0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 
-    0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 
-    0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x8B, 0x8B, 0x00, 
-    0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x3B, 0x3B, 0x00, 0x3F, 0x3B, 0x3B, 0xFF, 0x5F, 0x5F, 0x6F, 
-    0xFF, 0x5B, 0x5B, 0x67, 0xFF, 0x47, 0x3F, 0x43, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x3B, 0x37, 
-    0x37, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x3B, 
-    0x37, 0x37, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 
-    0x3B, 0x37, 0x37, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x3B, 0x37, 0x37, 
-    0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x47, 0x3F, 
-    0x43, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x2F, 0x2F, 0x23, 0x00, 0x2B, 0x2B, 0x23, 0xFF, 0x3B, 
-    0x37, 0x37, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 
-    0x2B, 0x2B, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x1B, 0x1B, 0x1B, 0xFF, 0x0B, 0x07, 0x07, 
-    0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 
-    0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x1B, 
-    0x1B, 0x1B, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 
-    0x23, 0x23, 0x23, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x23, 0x23, 0x23, 
-    0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x2F, 0x2B, 
-    0x2B, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2B, 
-    0x2B, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 
-    0x2B, 0x2B, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 
-    0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x33, 0x2F, 0x2F, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x43, 0x43, 
-    0x33, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x33, 
-    0x2F, 0x2F, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x23, 0x23, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 
-    0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 
-    0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x8B, 0x8B, 0x00, 0x8B, 0x8B, 
-    0x8B, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 
-    0xAB, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x3F, 0x3B, 0x3B, 0x00, 0x3F, 0x3B, 0x3B, 0xFF, 0x5B, 0x53, 0x5F, 0xFF, 0x7B, 
-    0x7B, 0x7B, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x33, 0x2F, 0x2F, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 
-    0x2F, 0x2B, 0x2B, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x2F, 0x2B, 0x2B, 
-    0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x2F, 0x2B, 
-    0x2B, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x27, 
-    0x27, 0x27, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x27, 0x27, 0x27, 0xFF, 
-    0x3B, 0x37, 0x37, 0xFF, 0x47, 0x3F, 0x43, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x37, 0x27, 0x1B, 
-    0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x2B, 0x2B, 
-    0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x1B, 0x1B, 0x1B, 0xFF, 0x0B, 
-    0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 
-    0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 
-    0xFF, 0x1B, 0x1B, 0x1B, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x2B, 0x2B, 
-    0x23, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x37, 
-    0x27, 0x1B, 0xFF, 0x23, 0x23, 0x1B, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x37, 0x37, 0x2B, 0xFF, 
-    0x2B, 0x2B, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x2F, 0x2B, 0x2B, 
-    0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x43, 0x33, 0x27, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x3B, 0x37, 
-    0x37, 0xFF, 0x3F, 0x2F, 0x23, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x3B, 
-    0x37, 0x37, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x47, 0x3F, 0x43, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 
-    0x4F, 0x4F, 0x3B, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x37, 0x37, 0x2B, 0xFF, 0x2F, 0x2F, 0x23, 
-    0xFF, 0x33, 0x2F, 0x2F, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x23, 0x23, 0x23, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 
-    0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 
-    0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x8B, 0x8B, 0x00, 
-    0x8B, 0x8B, 0x8B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xAB, 0xAB, 0xAB, 
-    0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 
-    0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 
-    0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x3B, 0x3B, 0x00, 0x3F, 0x3B, 0x3B, 0xFF, 0x4F, 0x47, 0x4B, 
-    0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x33, 0x2F, 0x2F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x2B, 0x2B, 
-    0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x2B, 
-    0x2B, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 
-    0x23, 0x23, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x23, 0x23, 0x23, 
-    0xFF, 0x23, 0x23, 0x23, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x23, 0x23, 
-    0x23, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x2B, 
-    0x2B, 0x23, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 
-    0x2B, 0x2B, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x1B, 0x1B, 0x1B, 
-    0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 
-    0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 
-    0x07, 0x07, 0xFF, 0x1B, 0x1B, 0x1B, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 
-    0x2B, 0x2B, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x33, 0x2F, 0x2F, 
-    0xFF, 0x23, 0x23, 0x23, 0xFF, 0x23, 0x23, 0x1B, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x2F, 0x2B, 
-    0x2B, 0xFF, 0x23, 0x23, 0x1B, 0xFF, 0x23, 0x23, 0x1B, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2F, 
-    0x2B, 0x2B, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x37, 0x37, 0x2B, 0xFF, 
-    0x2F, 0x2F, 0x23, 0xFF, 0x37, 0x37, 0x2B, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x37, 0x37, 0x2B, 
-    0xFF, 0x37, 0x37, 0x2B, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x33, 0x2F, 0x2F, 0xFF, 0x3B, 0x37, 
-    0x37, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x43, 0x43, 0x33, 0xFF, 0x37, 0x37, 0x2B, 0xFF, 0x37, 
-    0x37, 0x2B, 0xFF, 0x33, 0x2F, 0x2F, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x23, 0x23, 0x23, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xAB, 
-    0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 
-    0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x8B, 
-    0x8B, 0x00, 0x8B, 0x8B, 0x8B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 
-    0xAB, 0xAB, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xAB, 0xAB, 
-    0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 
-    0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 
-    0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x37, 0x37, 0x00, 0x3B, 0x37, 0x37, 0xFF, 0x4F, 
-    0x47, 0x4B, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 
-    0x1F, 0x1F, 0x1F, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x2F, 0x2F, 0x23, 
-    0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x23, 0x23, 0x1B, 0xFF, 0x23, 0x23, 0x1B, 0xFF, 0x2F, 0x2F, 
-    0x23, 0xFF, 0x23, 0x23, 0x1B, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x1B, 
-    0x1B, 0x1B, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x23, 0x23, 0x23, 0xFF, 
-    0x23, 0x23, 0x23, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x37, 0x37, 0x2B, 0xFF, 0x23, 0x23, 0x23, 
-    0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x23, 0x23, 
-    0x23, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x23, 0x23, 0x1B, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x1B, 
-    0x1B, 0x1B, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 
-    0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 
-    0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x1B, 0x1B, 0x1B, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x2B, 0x2B, 
-    0x23, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x2F, 
-    0x2B, 0x2B, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x1B, 0x1B, 0x17, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 
-    0x2F, 0x2B, 0x2B, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x23, 0x23, 0x1B, 0xFF, 0x23, 0x23, 0x1B, 
-    0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x23, 0x23, 0x1B, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x23, 0x23, 
-    0x23, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x2F, 
-    0x2F, 0x23, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 
-    0x37, 0x37, 0x2B, 0xFF, 0x43, 0x43, 0x33, 0xFF, 0x43, 0x43, 0x33, 0xFF, 0x37, 0x37, 0x2B, 
-    0xFF, 0x37, 0x37, 0x2B, 0xFF, 0x33, 0x2F, 0x2F, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x23, 0x23, 
-    0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 
-    0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 
-    0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x8B, 0x8B, 0x8B, 0x00, 0x8B, 0x8B, 0x8B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x8B, 0x8B, 
-    0x8B, 0xFF, 0x8B, 0x8B, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 
-    0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 
-    0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x23, 0x00, 0x2F, 0x2F, 0x23, 
-    0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x1F, 
-    0x1F, 0xFF, 0x23, 0x23, 0x1B, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x0F, 
-    0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 
-    0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 
-    0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x23, 0x23, 
-    0x23, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x43, 0x43, 0x33, 0xFF, 0x37, 
-    0x27, 0x1B, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 
-    0x23, 0x23, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 
-    0xFF, 0x1B, 0x1B, 0x1B, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 
-    0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 
-    0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x1B, 0x1B, 0x1B, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 
-    0x2F, 0x2F, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x27, 0x27, 0x27, 
-    0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x1B, 0x1B, 0x17, 0xFF, 0x3F, 0x3F, 
-    0x3F, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x2F, 
-    0x2B, 0x2B, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x27, 0x27, 0x27, 0xFF, 
-    0x27, 0x27, 0x27, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x27, 0x27, 0x27, 
-    0xFF, 0x27, 0x27, 0x27, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x33, 0x2F, 
-    0x2F, 0xFF, 0x37, 0x37, 0x2B, 0xFF, 0x43, 0x43, 0x33, 0xFF, 0x43, 0x43, 0x33, 0xFF, 0x37, 
-    0x37, 0x2B, 0xFF, 0x33, 0x2F, 0x2F, 0xFF, 0x33, 0x2F, 0x2F, 0xFF, 0x2F, 0x23, 0x17, 0xFF, 
-    0x2F, 0x23, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 
-    0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 
-    0xAB, 0xAB, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x8B, 0x8B, 0x8B, 0x00, 0x8B, 0x8B, 0x8B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x8B, 0x8B, 0x8B, 0xFF, 0x7B, 0x7B, 0x7B, 0xFF, 
-    0x7B, 0x7B, 0x7B, 0xFF, 0x7B, 0x7B, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x23, 0x00, 0x2F, 
-    0x2F, 0x23, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 
-    0x23, 0x23, 0x1B, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1B, 0x1B, 0x1B, 
-    0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 
-    0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 
-    0x07, 0x07, 0xFF, 0x1B, 0x1B, 0x1B, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 
-    0x1F, 0x1F, 0x1F, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x37, 0x37, 0x2B, 
-    0xFF, 0x23, 0x23, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x2F, 0x2F, 
-    0x23, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x2B, 
-    0x2B, 0x23, 0xFF, 0x1B, 0x1B, 0x1B, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 
-    0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 
-    0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x1B, 0x1B, 0x1B, 0xFF, 0x2B, 0x2B, 
-    0x23, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x27, 
-    0x27, 0x27, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x1B, 0x1B, 0x17, 0x00, 
-    0x0F, 0x0B, 0x07, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x2F, 0x2F, 0x23, 
-    0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x2F, 0x2F, 0x23, 0xFF, 0x37, 0x37, 0x2B, 0xFF, 0x37, 0x37, 
-    0x2B, 0xFF, 0x43, 0x33, 0x27, 0xFF, 0x37, 0x37, 0x2B, 0xFF, 0x37, 0x37, 0x2B, 0xFF, 0x37, 
-    0x37, 0x2B, 0xFF, 0x37, 0x37, 0x2B, 0xFF, 0x37, 0x37, 0x2B, 0xFF, 0x37, 0x37, 0x2B, 0xFF, 
-    0x37, 0x37, 0x2B, 0xFF, 0x3F, 0x2F, 0x23, 0xFF, 0x43, 0x33, 0x27, 0xFF, 0x3F, 0x2F, 0x23, 
-    0xFF, 0x3F, 0x2F, 0x23, 0xFF, 0x33, 0x2F, 0x2F, 0xFF, 0x2F, 0x23, 0x17, 0xFF, 0x2F, 0x23, 
-    0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 
-    0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 
-    0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x8B, 0x8B, 0x8B, 0x00, 0x8B, 0x8B, 0x8B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x8B, 0x8B, 0x8B, 0xFF, 0x7B, 0x7B, 0x7B, 0xFF, 0x7B, 0x7B, 0x7B, 0xFF, 0x7B, 0x7B, 
-    0x7B, 0x00, 0x7B, 0x7B, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x23, 
-    0x00, 0x2F, 0x2F, 0x23, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x2B, 0x2B, 
-    0x23, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x23, 0x23, 0x1B, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1B, 
-    0x1B, 0x1B, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 
-    0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 
-    0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x1B, 0x1B, 0x1B, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x23, 0x23, 
-    0x23, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x2F, 
-    0x2B, 0x2B, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 
-    0x2F, 0x2F, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x2B, 0x2B, 0x23, 
-    0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x1B, 0x1B, 0x1B, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 
-    0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 
-    0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x1B, 0x1B, 0x1B, 0xFF, 
-    0x1F, 0x1F, 0x1F, 0xFF, 0x2B, 0x2B, 0x23, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x2B, 0x2B, 0x23, 
-    0xFF, 0x27, 0x27, 0x27, 0xFF, 0x2F, 0x2B, 0x2B, 0xFF, 0x23, 0x23, 0x23, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x0F, 0x0B, 0x07, 0x00, 0x0F, 0x0B, 0x07, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x0F, 
-    0x0B, 0x07, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 
-    0x1B, 0x13, 0x0B, 0xFF, 0x13, 0x0B, 0x0B, 0xFF, 0x13, 0x0B, 0x0B, 0xFF, 0x13, 0x0B, 0x0B, 
-    0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x13, 0x0B, 0x0B, 0xFF, 0x13, 0x0B, 
-    0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x17, 
-    0x17, 0x13, 0xFF, 0x17, 0x17, 0x13, 0xFF, 0x23, 0x23, 0x1B, 0xFF, 0x2F, 0x23, 0x17, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x3F, 0x43, 0x00, 0x3F, 0x3B, 
-    0x3B, 0x00, 0x27, 0x27, 0x27, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 
-    0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 
-    0xAB, 0xAB, 0xAB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0x7B, 0x7B, 0x00, 0x7B, 0x7B, 0x7B, 0xFF, 0x7B, 
-    0x7B, 0x7B, 0xFF, 0x7B, 0x7B, 0x7B, 0xFF, 0x7B, 0x7B, 0x7B, 0x00, 0x7B, 0x7B, 0x7B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x2F, 0x2F, 0x23, 0x00, 0x3B, 0x37, 0x37, 0x00, 0x2F, 0x2B, 0x2B, 0x00, 
-    0x2B, 0x2B, 0x23, 0x00, 0x23, 0x23, 0x23, 0x00, 0x23, 0x23, 0x1B, 0x00, 0x1F, 0x1F, 0x1F, 
-    0x00, 0x1B, 0x1B, 0x1B, 0x00, 0x0B, 0x07, 0x07, 0x00, 0x6B, 0x6B, 0x6B, 0xFF, 0x8B, 0x8B, 
-    0x8B, 0xFF, 0x7B, 0x7B, 0x7B, 0xFF, 0x6B, 0x6B, 0x6B, 0xFF, 0x6B, 0x6B, 0x6B, 0xFF, 0x6B, 
-    0x6B, 0x6B, 0xFF, 0x5F, 0x5F, 0x6F, 0xFF, 0x5F, 0x5F, 0x6F, 0xFF, 0x5F, 0x5F, 0x6F, 0xFF, 
-    0x5F, 0x5F, 0x6F, 0xFF, 0x5F, 0x5F, 0x6F, 0xFF, 0x5F, 0x5F, 0x6F, 0xFF, 0x5F, 0x5F, 0x6F, 
-    0xFF, 0x5F, 0x5F, 0x6F, 0xFF, 0x5F, 0x5F, 0x6F, 0xFF, 0x5F, 0x5F, 0x6F, 0xFF, 0x5F, 0x5F, 
-    0x6F, 0xFF, 0x5B, 0x53, 0x5F, 0xFF, 0x5B, 0x53, 0x5F, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x3F, 
-    0x3B, 0x3B, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x1B, 0x1B, 0x1B, 0x00, 0x53, 0x4B, 0x53, 0xFF, 
-    0x3F, 0x3B, 0x3B, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0x07, 
-    0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 
-    0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x27, 0x27, 
-    0x27, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x00, 
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x47, 0x3F, 0x43, 0xFF, 
-    0x3F, 0x3B, 0x3B, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0x7B, 0x7B, 
-    0x00, 0x7B, 0x7B, 0x7B, 0x00, 0x7B, 0x7B, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x6B, 0x6B, 0x6B, 0xFF, 0x6B, 0x6B, 0x6B, 0xFF, 
-    0x5B, 0x5B, 0x5B, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x3F, 0x3B, 0x3B, 
-    0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x3B, 0x37, 
-    0x37, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x3B, 
-    0x37, 0x37, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 
-    0x3F, 0x3B, 0x3B, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x3F, 0x3B, 0x3B, 
-    0xFF, 0x47, 0x3F, 0x43, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x53, 0x4B, 
-    0x53, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-    0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 
-    0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 
-    0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 
-    0x27, 0x27, 0x27, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x27, 0x27, 0x27, 
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x3F, 
-    0x3F, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x27, 0x1B, 0x0F, 0x00, 0x2F, 0x23, 0x13, 0x00, 
-    0x3F, 0x2F, 0x17, 0x00, 0x3F, 0x2F, 0x17, 0x00, 0x3F, 0x2F, 0x17, 0x00, 0x3B, 0x2B, 0x17, 
-    0x00, 0x3F, 0x2F, 0x17, 0x00, 0x3B, 0x2B, 0x17, 0x00, 0x3B, 0x2B, 0x17, 0x00, 0x3F, 0x2F, 
-    0x17, 0x00, 0x3F, 0x2F, 0x17, 0x00, 0x3B, 0x2B, 0x17, 0x00, 0x3F, 0x2F, 0x17, 0x00, 0x3B, 
-    0x2B, 0x17, 0x00, 0x2F, 0x23, 0x13, 0x00, 0x3B, 0x2B, 0x17, 0x00, 0x3F, 0x2F, 0x17, 0x00, 
-    0x3F, 0x2F, 0x17, 0x00, 0x2F, 0x23, 0x13, 0x00, 0x27, 0x1B, 0x0F, 0x00, 0x17, 0x0F, 0x0B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x7B, 0x7B, 0x7B, 0xFF, 0x5B, 0x5B, 0x5B, 0xFF, 0x5B, 0x5B, 0x5B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x5B, 0x5B, 0x5B, 0xFF, 0x5B, 0x5B, 0x5B, 0xFF, 0x7B, 0x7B, 0x7B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x6B, 0x6B, 0x6B, 0xFF, 0x5B, 0x5B, 
-    0x5B, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0x47, 0x3F, 0x43, 0xFF, 0x4F, 
-    0x47, 0x4B, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 
-    0x4F, 0x47, 0x4B, 0xFF, 0x4B, 0x4B, 0x4B, 0xFF, 0x4B, 0x4B, 0x4B, 0xFF, 0x4B, 0x4B, 0x4B, 
-    0xFF, 0x4B, 0x4B, 0x4B, 0xFF, 0x4B, 0x4B, 0x4B, 0xFF, 0x4B, 0x4B, 0x4B, 0xFF, 0x4B, 0x4B, 
-    0x4B, 0xFF, 0x4B, 0x4B, 0x4B, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x47, 
-    0x3F, 0x43, 0xFF, 0x47, 0x3F, 0x43, 0xFF, 0x47, 0x3F, 0x43, 0xFF, 0x33, 0x2F, 0x2F, 0xFF, 
-    0x53, 0x4B, 0x53, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x00, 0x00, 0x00, 
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-    0x00, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 
-    0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 
-    0x0B, 0x07, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x3F, 0x3B, 
-    0x3B, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x27, 
-    0x27, 0x27, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-    0x47, 0x3F, 0x43, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x27, 0x27, 0x27, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 
-    0xAB, 0xAB, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x27, 0x1B, 0x0F, 0x00, 0x17, 0x0F, 0x0B, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x2F, 0x23, 
-    0x13, 0xFF, 0x3F, 0x2F, 0x17, 0xFF, 0x3F, 0x2F, 0x17, 0xFF, 0x3F, 0x2F, 0x17, 0xFF, 0x3B, 
-    0x2B, 0x17, 0xFF, 0x3F, 0x2F, 0x17, 0xFF, 0x3B, 0x2B, 0x17, 0xFF, 0x3B, 0x2B, 0x17, 0xFF, 
-    0x3F, 0x2F, 0x17, 0xFF, 0x3F, 0x2F, 0x17, 0xFF, 0x3B, 0x2B, 0x17, 0xFF, 0x3F, 0x2F, 0x17, 
-    0xFF, 0x3B, 0x2B, 0x17, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x3B, 0x2B, 0x17, 0xFF, 0x3F, 0x2F, 
-    0x17, 0xFF, 0x3F, 0x2F, 0x17, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x17, 
-    0x0F, 0x0B, 0xFF, 0x27, 0x1B, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x7B, 0x7B, 0x7B, 0xFF, 0x5B, 0x5B, 0x5B, 0xFF, 0x5B, 0x5B, 0x5B, 
-    0xFF, 0x5B, 0x5B, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x5B, 0x5B, 0x5B, 0x00, 0x5B, 0x5B, 0x5B, 0xFF, 0x5B, 0x5B, 0x5B, 0xFF, 0x7B, 
-    0x7B, 0x7B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x5B, 0x5B, 0x5B, 0xFF, 
-    0x4B, 0x4B, 0x4B, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x47, 0x3F, 0x43, 0xFF, 0x33, 0x2F, 
-    0x2F, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x00, 
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-    0x00, 0x00, 0x00, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 
-    0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 
-    0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 
-    0x3F, 0x3B, 0x3B, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x3F, 0x3B, 0x3B, 
-    0xFF, 0x27, 0x27, 0x27, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-    0x00, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x33, 0x2F, 0x2F, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x27, 
-    0x27, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 
-    0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 
-    0x1B, 0x0F, 0x00, 0x27, 0x1B, 0x0F, 0xFF, 0x3F, 0x2F, 0x17, 0xFF, 0x3F, 0x2F, 0x17, 0xFF, 
-    0x3F, 0x2F, 0x17, 0xFF, 0x3B, 0x2B, 0x17, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 
-    0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 
-    0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 
-    0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 
-    0x2F, 0x23, 0x13, 0xFF, 0x3B, 0x2B, 0x17, 0xFF, 0x3F, 0x2F, 0x17, 0xFF, 0x3F, 0x2F, 0x17, 
-    0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x9B, 0x9B, 0x9B, 0xFF, 0x7B, 0x7B, 0x7B, 0xFF, 0x5B, 0x5B, 0x5B, 0xFF, 0x5B, 
-    0x5B, 0x5B, 0xFF, 0x5B, 0x5B, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x5B, 0x5B, 0x5B, 0x00, 0x5B, 0x5B, 0x5B, 0xFF, 0x5B, 0x5B, 0x5B, 
-    0xFF, 0x7B, 0x7B, 0x7B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x5B, 0x5B, 
-    0x5B, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x33, 0x2F, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-    0x00, 0x00, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 
-    0x33, 0x2F, 0x2F, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x27, 0x27, 0x27, 
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 
-    0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 
-    0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x53, 0x4B, 
-    0x53, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x3F, 
-    0x3B, 0x3B, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-    0x00, 0x00, 0x00, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x33, 0x2F, 0x2F, 0xFF, 0x27, 0x27, 0x27, 
-    0xFF, 0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 
-    0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x27, 0x1B, 0x0F, 0x00, 0x27, 0x1B, 0x0F, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x27, 0x1B, 
-    0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 
-    0x1B, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 
-    0x1F, 0x17, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 
-    0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x1F, 0x17, 
-    0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 
-    0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0x00, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 0x9B, 0xFF, 0x7B, 0x7B, 0x7B, 0xFF, 0x5B, 0x5B, 0x5B, 
-    0xFF, 0x5B, 0x5B, 0x5B, 0xFF, 0x5B, 0x5B, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x5B, 0x5B, 0x00, 0x5B, 0x5B, 0x5B, 0xFF, 0x5B, 
-    0x5B, 0x5B, 0xFF, 0x7B, 0x7B, 0x7B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x57, 0x4F, 0x5B, 0xFF, 0x47, 0x3F, 0x43, 0xFF, 0x33, 0x2F, 0x2F, 0xFF, 0x00, 0x00, 0x00, 
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x3F, 0x3B, 
-    0x3B, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x27, 
-    0x27, 0x27, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 
-    0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 
-    0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-    0x53, 0x4B, 0x53, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x47, 0x3F, 0x43, 
-    0xFF, 0x47, 0x3F, 0x43, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x53, 0x4B, 
-    0x53, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x53, 
-    0x4B, 0x53, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 
-    0x53, 0x4B, 0x53, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x53, 0x4B, 0x53, 
-    0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x57, 0x4F, 0x5B, 0xFF, 0x5B, 0x53, 
-    0x5F, 0xFF, 0x4B, 0x4B, 0x4B, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0x33, 0x2F, 0x2F, 0xFF, 0x27, 
-    0x27, 0x27, 0xFF, 0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 
-    0x17, 0x0F, 0x0B, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 
-    0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 
-    0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 
-    0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 
-    0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 
-    0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 
-    0x0B, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 0x9B, 0xFF, 0x7B, 0x7B, 0x7B, 0xFF, 0x5B, 
-    0x5B, 0x5B, 0xFF, 0x5B, 0x5B, 0x5B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x5B, 0x5B, 0x5B, 
-    0xFF, 0x5B, 0x5B, 0x5B, 0xFF, 0x7B, 0x7B, 0x7B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x53, 0x4B, 0x53, 0xFF, 0x47, 0x3F, 0x43, 0xFF, 0x2F, 0x2F, 0x2F, 0xFF, 0x00, 
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 
-    0x3F, 0x3B, 0x3B, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x3F, 0x3B, 0x3B, 
-    0xFF, 0x27, 0x27, 0x27, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 
-    0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 
-    0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x00, 0x00, 0x00, 
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-    0x00, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x3B, 
-    0x37, 0x37, 0xFF, 0x47, 0x3F, 0x43, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 
-    0x3F, 0x3B, 0x3B, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x3F, 0x3B, 0x3B, 
-    0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x3F, 0x3B, 
-    0x3B, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x3F, 
-    0x3B, 0x3B, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 
-    0x3B, 0x37, 0x37, 0xFF, 0x33, 0x2F, 0x2F, 0xFF, 0x33, 0x2F, 0x2F, 0xFF, 0x27, 0x27, 0x27, 
-    0xFF, 0x2F, 0x2F, 0x2F, 0xFF, 0x2F, 0x2F, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 
-    0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 
-    0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 
-    0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 
-    0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 
-    0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 
-    0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x53, 0x4B, 0x53, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x2F, 0x2F, 0x2F, 
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x53, 0x4B, 
-    0x53, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x53, 0x4B, 0x53, 0xFF, 0x3F, 
-    0x3B, 0x3B, 0xFF, 0x27, 0x27, 0x27, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0x07, 0x07, 
-    0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 
-    0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x0B, 0x07, 0x07, 0xFF, 0x00, 
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 
-    0x00, 0x00, 0x00, 0xFF, 0x4F, 0x47, 0x4B, 0xFF, 0x3F, 0x3B, 0x3B, 0xFF, 0x27, 0x27, 0x27, 
-    0xFF, 0x3B, 0x37, 0x37, 0x00, 0x3B, 0x37, 0x37, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0x3F, 0x3F, 
-    0x3F, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0x3F, 
-    0x3F, 0x3F, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 
-    0x3F, 0x3F, 0x3F, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0x3F, 0x3F, 0x3F, 
-    0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0x3F, 0x3F, 0x3F, 0xFF, 0x3F, 0x3F, 
-    0x3F, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x3B, 0x37, 0x37, 0xFF, 0x2F, 0x2F, 0x2F, 0xFF, 0x2F, 
-    0x2F, 0x2F, 0xFF, 0x2F, 0x2F, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 
-    0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 
-    0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 
-    0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 
-    0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 
-    0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x4B, 0x53, 0x00, 0x3B, 0x37, 0x37, 0x00, 0x2F, 
-    0x2F, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0x4B, 0x53, 0x00, 0x3F, 0x3B, 0x3B, 0x00, 0x27, 0x27, 0x27, 0x00, 0x53, 0x4B, 0x53, 
-    0x00, 0x3F, 0x3B, 0x3B, 0x00, 0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 
-    0x07, 0x07, 0x00, 0x0B, 0x07, 0x07, 0x00, 0x0B, 0x07, 0x07, 0x00, 0x0B, 0x07, 0x07, 0x00, 
-    0x0B, 0x07, 0x07, 0x00, 0x0B, 0x07, 0x07, 0x00, 0x0B, 0x07, 0x07, 0x00, 0x0B, 0x07, 0x07, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x47, 0x4B, 0x00, 0x3F, 0x3B, 0x3B, 0x00, 0x27, 
-    0x27, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x37, 0x37, 0x00, 0x3F, 0x3F, 0x3F, 0x00, 
-    0x3F, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x3F, 
-    0x00, 0x3F, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 
-    0x3F, 0x00, 0x3F, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x3F, 0x00, 0x3F, 
-    0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x3F, 0x00, 
-    0x3F, 0x3F, 0x3F, 0x00, 0x3B, 0x37, 0x37, 0x00, 0x3B, 0x37, 0x37, 0x00, 0x2F, 0x2F, 0x2F, 
-    0x00, 0x2F, 0x2F, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 
-    0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 
-    0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 
-    0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 
-    0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 
-    0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 
-    0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 
-    0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 
-    0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 
-    0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 
-    0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 
-    0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 
-    0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 
-    0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 
-    0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 
-    0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 
-    0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 
-    0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 
-    0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 
-    0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 
-    0x00, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 
-    0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 
-    0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 
-    0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 
-    0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 
-    0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 
-    0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 
-    0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 
-    0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 
-    0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 
-    0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xAB, 0xAB, 0xAB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 
-    0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 
-    0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 
-    0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 
-    0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 
-    0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 
-    0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0xAB, 0xAB, 0xAB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xAB, 
-    0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 
-    0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xAB, 0xAB, 
-    0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 
-    0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xAB, 0xAB, 0xAB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 
-    0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xAB, 
-    0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 
-    0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 
-    0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 
-    0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 
-    0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 
-    0x00, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 
-    0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 
-    0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 
-    0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 
-    0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 
-    0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 
-    0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 
-    0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 
-    0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 
-    0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 
-    0xAB, 0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 
-    0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xAB, 0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 
-    0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 
-    0x9B, 0x9B, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x2B, 0x1F, 0x13, 0x00, 0x2B, 0x1F, 0x13, 0x00, 0x2B, 0x1F, 0x13, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x2B, 0x1F, 0x13, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x2B, 0x1F, 0x13, 0x00, 0x2B, 0x1F, 0x13, 0x00, 
-    0x1F, 0x17, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x1F, 0x13, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x2B, 0x1F, 0x13, 0x00, 0x0F, 
-    0x0F, 0x0F, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x2F, 0x23, 0x13, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 0x9B, 0x9B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xAB, 0xAB, 0xAB, 0x00, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x2F, 0x23, 0x13, 0x00, 0x1F, 0x17, 0x0F, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x0F, 0x0F, 0x0F, 
-    0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 
-    0x9B, 0x00, 0x1F, 0x17, 0x0F, 0x00, 0x1F, 0x17, 0x0F, 0x00, 0x1F, 0x17, 0x0F, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 
-    0x9B, 0x9B, 0x9B, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x27, 0x1B, 0x0F, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x27, 0x1B, 0x0F, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xAB, 
-    0xAB, 0xAB, 0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xFF, 0x9B, 0x9B, 0x9B, 0xFF, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 
-    0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0x00, 0x1F, 0x17, 0x0F, 0xFF, 0x2B, 0x1F, 0x13, 0xFF, 0x2B, 0x1F, 0x13, 0xFF, 0x2B, 0x1F, 
-    0x13, 0xFF, 0x2B, 0x1F, 0x13, 0xFF, 0x2B, 0x1F, 0x13, 0xFF, 0x2B, 0x1F, 0x13, 0xFF, 0x2B, 
-    0x1F, 0x13, 0xFF, 0x2B, 0x1F, 0x13, 0xFF, 0x2B, 0x1F, 0x13, 0xFF, 0x2B, 0x1F, 0x13, 0xFF, 
-    0x2B, 0x1F, 0x13, 0xFF, 0x2B, 0x1F, 0x13, 0xFF, 0x2B, 0x1F, 0x13, 0xFF, 0x2B, 0x1F, 0x13, 
-    0xFF, 0x2B, 0x1F, 0x13, 0xFF, 0x2B, 0x1F, 0x13, 0xFF, 0x2B, 0x1F, 0x13, 0xFF, 0x2B, 0x1F, 
-    0x13, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 0x00, 0x2B, 0x1F, 0x13, 0x00, 0x2B, 
-    0x1F, 0x13, 0xFF, 0x2B, 0x1F, 0x13, 0xFF, 0x2B, 0x1F, 0x13, 0xFF, 0x47, 0x37, 0x1B, 0xFF, 
-    0x4B, 0x23, 0x23, 0xFF, 0x2B, 0x1F, 0x13, 0xFF, 0x2B, 0x1F, 0x13, 0xFF, 0x2B, 0x1F, 0x13, 
-    0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 
-    0x13, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x3F, 
-    0x3F, 0x3F, 0xFF, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x2F, 0x23, 0x13, 0x00, 0x2F, 0x23, 0x13, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x1F, 0x1F, 
-    0x1F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x13, 0x13, 0x13, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x0F, 
-    0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 
-    0x27, 0x1B, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 
-    0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x13, 0x13, 0x13, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x1F, 
-    0x1F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x27, 
-    0x1B, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 
-    0x1F, 0x17, 0x0F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 
-    0xFF, 0x13, 0x13, 0x13, 0xFF, 0x13, 0x13, 0x13, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 
-    0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 
-    0xBB, 0xBB, 0x00, 0x9B, 0x9B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x17, 0x0F, 0x00, 0x1F, 
-    0x17, 0x0F, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x53, 0x3F, 0x2F, 0xFF, 0x5F, 0x47, 0x37, 0xFF, 
-    0x5F, 0x47, 0x37, 0xFF, 0x5F, 0x47, 0x37, 0xFF, 0x5F, 0x47, 0x37, 0xFF, 0x5F, 0x47, 0x37, 
-    0xFF, 0x5F, 0x47, 0x37, 0xFF, 0x5F, 0x47, 0x37, 0xFF, 0x5F, 0x47, 0x37, 0xFF, 0x5F, 0x47, 
-    0x37, 0xFF, 0x5F, 0x47, 0x37, 0xFF, 0x5F, 0x47, 0x37, 0xFF, 0x5F, 0x47, 0x37, 0xFF, 0x5F, 
-    0x47, 0x37, 0xFF, 0x5F, 0x47, 0x37, 0xFF, 0x5F, 0x47, 0x37, 0xFF, 0x5F, 0x47, 0x37, 0xFF, 
-    0x53, 0x3F, 0x2F, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 
-    0x00, 0x5F, 0x47, 0x37, 0xFF, 0x5F, 0x47, 0x37, 0xFF, 0x47, 0x37, 0x1B, 0xFF, 0x9F, 0x57, 
-    0x33, 0xFF, 0x5F, 0x47, 0x37, 0xFF, 0x47, 0x37, 0x1B, 0xFF, 0x5F, 0x47, 0x37, 0xFF, 0x5F, 
-    0x47, 0x37, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 
-    0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 
-    0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x2F, 0x23, 0x13, 0x00, 0x2F, 0x23, 0x13, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 
-    0x1F, 0x1F, 0x1F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x13, 0x13, 0x13, 
-    0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x1F, 0x1F, 
-    0x1F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x2F, 
-    0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 
-    0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x3B, 0x2B, 0x17, 0xFF, 0x1F, 0x1F, 0x1F, 
-    0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x17, 
-    0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x0F, 
-    0x0F, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x13, 0x13, 0x13, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 
-    0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 
-    0xA7, 0x2F, 0xFF, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x17, 0x0F, 0x00, 0x1F, 0x17, 0x0F, 
-    0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x53, 0x3F, 0x2F, 0xFF, 0x47, 0x37, 0x1B, 0xFF, 0x37, 0x27, 
-    0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 
-    0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 
-    0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 
-    0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 
-    0x1B, 0xFF, 0x47, 0x37, 0x1B, 0xFF, 0x53, 0x3F, 0x2F, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x1F, 
-    0x17, 0x0F, 0xFF, 0x3B, 0x2B, 0x17, 0xFF, 0x37, 0x23, 0x13, 0xFF, 0x4B, 0x23, 0x23, 0xFF, 
-    0x77, 0x2F, 0x23, 0xFF, 0x53, 0x2F, 0x17, 0xFF, 0x4B, 0x23, 0x23, 0xFF, 0x37, 0x23, 0x13, 
-    0xFF, 0x3B, 0x2B, 0x17, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x2F, 0x23, 
-    0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 
-    0x1F, 0x1F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x4B, 0x5B, 0x27, 0x00, 0x4B, 0x5B, 0x27, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x1F, 
-    0x1F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x13, 
-    0x13, 0x13, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 
-    0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x1F, 0x1F, 0x1F, 
-    0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x0F, 0x0F, 
-    0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x1F, 
-    0x17, 0x0F, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 
-    0x17, 0x0F, 0x0B, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x2F, 0x2F, 0x2F, 0xFF, 0x1F, 0x17, 0x0F, 
-    0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 
-    0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0x1B, 0x00, 0x3F, 0x4F, 0x1B, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0xA7, 
-    0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x17, 0x0F, 0x00, 0x1F, 
-    0x17, 0x0F, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x47, 0x37, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 
-    0x37, 0x27, 0x1B, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x0F, 0x0B, 0x07, 
-    0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x0F, 0x0B, 
-    0x07, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x0F, 
-    0x0B, 0x07, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 
-    0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x47, 0x37, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 
-    0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x2B, 0x1F, 0x13, 0xFF, 0x3B, 0x2B, 0x17, 0xFF, 0x37, 0x23, 
-    0x13, 0xFF, 0x77, 0x2F, 0x23, 0xFF, 0x47, 0x37, 0x1B, 0xFF, 0x37, 0x23, 0x13, 0xFF, 0x3B, 
-    0x2B, 0x17, 0xFF, 0x2B, 0x1F, 0x13, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x2F, 0x2F, 0x2F, 0xFF, 
-    0x3B, 0x2B, 0x17, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 
-    0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x4B, 0x5B, 0x27, 0x00, 0x4B, 0x5B, 0x27, 0xFF, 0x4B, 0x5B, 0x27, 0xFF, 0x4B, 
-    0x5B, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x17, 0x0F, 0x00, 0x1F, 0x17, 0x0F, 0xFF, 
-    0x2F, 0x23, 0x13, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 
-    0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 
-    0x0F, 0xFF, 0x2F, 0x2F, 0x2F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x1F, 
-    0x1F, 0x1F, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 
-    0x1F, 0x1F, 0x1F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x1F, 0x1F, 
-    0xFF, 0x13, 0x13, 0x13, 0xFF, 0x13, 0x13, 0x13, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x17, 
-    0x0F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x13, 0x13, 0x13, 0xFF, 0x1F, 
-    0x17, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 
-    0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0x1B, 0x00, 0x3F, 0x4F, 0x1B, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0xA7, 0x2F, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x13, 0x0B, 
-    0x00, 0x1B, 0x13, 0x0B, 0xFF, 0x2B, 0x1F, 0x13, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 
-    0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x0F, 
-    0x0B, 0x07, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 
-    0x0F, 0x0B, 0x07, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x0F, 0x0B, 0x07, 
-    0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x0F, 0x0B, 0x07, 0xFF, 0x27, 0x1B, 
-    0x0F, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x2B, 
-    0x1F, 0x13, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x37, 0x23, 0x13, 0xFF, 
-    0x37, 0x13, 0x0B, 0xFF, 0x63, 0x23, 0x17, 0xFF, 0x47, 0x37, 0x1B, 0xFF, 0x37, 0x13, 0x0B, 
-    0xFF, 0x37, 0x23, 0x13, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x2F, 0x2F, 
-    0x2F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 
-    0x1B, 0x0F, 0xFF, 0x13, 0x13, 0x13, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x4B, 0x5B, 0x27, 0x00, 0x4B, 0x5B, 0x27, 0xFF, 0x4B, 0x5B, 0x27, 
-    0xFF, 0x4B, 0x5B, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x17, 0x0F, 0x00, 0x1F, 0x17, 
-    0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x27, 
-    0x1B, 0x0F, 0xFF, 0x13, 0x13, 0x13, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 
-    0x0F, 0x0F, 0x0F, 0xFF, 0x2F, 0x2F, 0x2F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 
-    0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x1F, 0x1F, 
-    0x1F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x0F, 
-    0x0F, 0x0F, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x13, 0x13, 0x13, 0xFF, 0x13, 0x13, 0x13, 0xFF, 
-    0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x17, 0x0F, 0x0B, 
-    0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x0F, 0x0F, 
-    0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0x1B, 0x00, 0x3F, 0x4F, 0x1B, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x7B, 0x33, 0xFF, 0x5F, 0x7B, 0x33, 0xFF, 0x5F, 0x7B, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 
-    0x13, 0x0B, 0x00, 0x1B, 0x13, 0x0B, 0xFF, 0x2B, 0x1F, 0x13, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 
-    0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x47, 0x37, 0x1B, 0xFF, 0x53, 0x3F, 0x2F, 
-    0xFF, 0x53, 0x3F, 0x2F, 0xFF, 0x53, 0x3F, 0x2F, 0xFF, 0x53, 0x3F, 0x2F, 0xFF, 0x53, 0x3F, 
-    0x2F, 0xFF, 0x53, 0x3F, 0x2F, 0xFF, 0x53, 0x3F, 0x2F, 0xFF, 0x53, 0x3F, 0x2F, 0xFF, 0x53, 
-    0x3F, 0x2F, 0xFF, 0x53, 0x3F, 0x2F, 0xFF, 0x53, 0x3F, 0x2F, 0xFF, 0x53, 0x3F, 0x2F, 0xFF, 
-    0x47, 0x37, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 
-    0xFF, 0x2B, 0x1F, 0x13, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x37, 0x13, 
-    0x0B, 0xFF, 0x37, 0x13, 0x0B, 0xFF, 0x4B, 0x23, 0x23, 0xFF, 0x4B, 0x23, 0x23, 0xFF, 0x37, 
-    0x13, 0x0B, 0xFF, 0x37, 0x13, 0x0B, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 
-    0x2F, 0x2F, 0x2F, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 
-    0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x3B, 0x2B, 0x17, 0xFF, 0x2F, 0x2F, 0x2F, 0xFF, 0x2F, 0x2F, 
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x5B, 0x27, 0x00, 0x4B, 
-    0x5B, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x1B, 0x0F, 0x00, 
-    0x27, 0x1B, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 
-    0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 
-    0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x2F, 0x2F, 0x2F, 0xFF, 0x1F, 
-    0x1F, 0x1F, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x13, 0x13, 0x13, 0xFF, 0x13, 0x13, 0x13, 0xFF, 
-    0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x13, 0x13, 0x13, 
-    0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x13, 0x13, 
-    0x13, 0xFF, 0x13, 0x13, 0x13, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x17, 
-    0x0F, 0x0B, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 
-    0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0x1B, 0x00, 0x3F, 
-    0x4F, 0x1B, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x7B, 0x33, 0xFF, 
-    0x5F, 0x7B, 0x33, 0xFF, 0x4B, 0x5B, 0x27, 0xFF, 0x37, 0x43, 0x13, 0xFF, 0x37, 0x43, 0x13, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x13, 0x0B, 0x00, 0x1B, 0x13, 0x0B, 0xFF, 0x2B, 0x1F, 
-    0x13, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 
-    0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 
-    0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 
-    0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 
-    0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x37, 0x27, 0x1B, 0xFF, 0x2B, 
-    0x1F, 0x13, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x1B, 0x13, 0x0B, 0x00, 0x2F, 0x23, 0x13, 0xFF, 
-    0x1B, 0x13, 0x0B, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x37, 0x23, 0x13, 0xFF, 0x37, 0x23, 0x13, 
-    0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x0F, 0x0F, 
-    0x0F, 0xFF, 0x2F, 0x2F, 0x4B, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x3B, 0x2B, 0x17, 0xFF, 0x2F, 
-    0x23, 0x13, 0xFF, 0x2F, 0x2F, 0x2F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 
-    0x2F, 0x23, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x23, 
-    0x13, 0x00, 0x2F, 0x23, 0x13, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 
-    0x1B, 0x0F, 0xFF, 0x2F, 0x2F, 0x2F, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 
-    0x0F, 0x0F, 0x0F, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 
-    0xFF, 0x13, 0x13, 0x13, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 
-    0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x13, 0x13, 0x13, 0xFF, 0x13, 
-    0x13, 0x13, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 
-    0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 
-    0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x13, 0x13, 0x13, 0xFF, 0x0F, 0x0F, 
-    0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x33, 
-    0x00, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0x1B, 
-    0x00, 0x3F, 0x4F, 0x1B, 0xFF, 0x5F, 0x7B, 0x33, 0xFF, 0x5F, 0x7B, 0x33, 0xFF, 0x4B, 0x5B, 
-    0x27, 0xFF, 0x37, 0x43, 0x13, 0xFF, 0x4B, 0x5B, 0x27, 0x00, 0x37, 0x43, 0x13, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x13, 0x0B, 0x00, 
-    0x1B, 0x13, 0x0B, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x1B, 0x13, 0x0B, 
-    0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x1B, 0x13, 
-    0x0B, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x1B, 
-    0x13, 0x0B, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 
-    0x1B, 0x13, 0x0B, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x1B, 0x13, 0x0B, 
-    0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x1B, 0x13, 0x0B, 0x00, 0x1B, 0x13, 0x0B, 0x00, 0x1B, 0x13, 
-    0x0B, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x23, 0x17, 0x0F, 0xFF, 0x23, 
-    0x17, 0x0F, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 0x1B, 0x13, 0x0B, 0xFF, 
-    0x0F, 0x0F, 0x0F, 0xFF, 0x2F, 0x2F, 0x2F, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x1F, 0x17, 0x0F, 
-    0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0x1F, 0x1F, 
-    0x1F, 0xFF, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x27, 0x1B, 0x0F, 0x00, 0x27, 0x1B, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x2F, 0x2F, 0x2F, 
-    0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x2F, 0x2F, 0x2F, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x0F, 0x0F, 
-    0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 
-    0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 
-    0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 
-    0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 
-    0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 
-    0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 
-    0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 
-    0x43, 0x13, 0x00, 0x37, 0x43, 0x13, 0xFF, 0x37, 0x43, 0x13, 0xFF, 0x37, 0x43, 0x13, 0xFF, 
-    0x4B, 0x5B, 0x27, 0x00, 0x37, 0x43, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x1B, 0x13, 0x0B, 0x00, 0x1B, 0x13, 0x0B, 0x00, 0x1B, 0x13, 0x0B, 0x00, 0x1B, 
-    0x13, 0x0B, 0x00, 0x1B, 0x13, 0x0B, 0x00, 0x1B, 0x13, 0x0B, 0x00, 0x1B, 0x13, 0x0B, 0x00, 
-    0x1B, 0x13, 0x0B, 0x00, 0x1B, 0x13, 0x0B, 0x00, 0x1B, 0x13, 0x0B, 0x00, 0x1B, 0x13, 0x0B, 
-    0x00, 0x1B, 0x13, 0x0B, 0x00, 0x1B, 0x13, 0x0B, 0x00, 0x1B, 0x13, 0x0B, 0x00, 0x1B, 0x13, 
-    0x0B, 0x00, 0x1B, 0x13, 0x0B, 0x00, 0x1B, 0x13, 0x0B, 0x00, 0x1B, 0x13, 0x0B, 0x00, 0x1B, 
-    0x13, 0x0B, 0x00, 0x1B, 0x13, 0x0B, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x1B, 0x13, 0x0B, 0x00, 0x1B, 0x13, 0x0B, 0x00, 0x1B, 0x13, 0x0B, 0x00, 0x23, 0x17, 0x0F, 
-    0x00, 0x23, 0x17, 0x0F, 0x00, 0x1B, 0x13, 0x0B, 0x00, 0x1B, 0x13, 0x0B, 0x00, 0x1B, 0x13, 
-    0x0B, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x2F, 0x2F, 0x2F, 0x00, 0x2F, 0x23, 0x13, 0x00, 0x1F, 
-    0x17, 0x0F, 0x00, 0x2F, 0x23, 0x13, 0x00, 0x2F, 0x23, 0x13, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 
-    0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x1B, 0x0F, 0x00, 0x1F, 0x17, 0x0F, 0x00, 0x2F, 
-    0x2F, 0x2F, 0x00, 0x27, 0x1B, 0x0F, 0x00, 0x2F, 0x2F, 0x2F, 0x00, 0x17, 0x0F, 0x0B, 0x00, 
-    0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 
-    0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 
-    0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 
-    0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 
-    0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 
-    0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 
-    0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x43, 0x13, 0x00, 0x37, 0x43, 0x13, 0x00, 0x37, 0x43, 
-    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x0F, 0x0B, 0x00, 
-    0x27, 0x1B, 0x0F, 0x00, 0x2F, 0x23, 0x13, 0x00, 0x3F, 0x2F, 0x17, 0x00, 0x3F, 0x2F, 0x17, 
-    0x00, 0x3F, 0x2F, 0x17, 0x00, 0x3B, 0x2B, 0x17, 0x00, 0x3F, 0x2F, 0x17, 0x00, 0x3B, 0x2B, 
-    0x17, 0x00, 0x3B, 0x2B, 0x17, 0x00, 0x3F, 0x2F, 0x17, 0x00, 0x3F, 0x2F, 0x17, 0x00, 0x3B, 
-    0x2B, 0x17, 0x00, 0x3F, 0x2F, 0x17, 0x00, 0x3B, 0x2B, 0x17, 0x00, 0x2F, 0x23, 0x13, 0x00, 
-    0x3B, 0x2B, 0x17, 0x00, 0x3F, 0x2F, 0x17, 0x00, 0x3F, 0x2F, 0x17, 0x00, 0x2F, 0x23, 0x13, 
-    0x00, 0x27, 0x1B, 0x0F, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x7B, 0x33, 0xFF, 0x4B, 
-    0x5B, 0x27, 0xFF, 0x4B, 0x5B, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x4B, 0x5B, 0x27, 
-    0xFF, 0x4B, 0x5B, 0x27, 0xFF, 0x5F, 0x7B, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 
-    0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x1B, 0x0F, 0x00, 0x17, 0x0F, 
-    0x0B, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x3F, 0x2F, 0x17, 0xFF, 0x3F, 
-    0x2F, 0x17, 0xFF, 0x3F, 0x2F, 0x17, 0xFF, 0x3B, 0x2B, 0x17, 0xFF, 0x3F, 0x2F, 0x17, 0xFF, 
-    0x3B, 0x2B, 0x17, 0xFF, 0x3B, 0x2B, 0x17, 0xFF, 0x3F, 0x2F, 0x17, 0xFF, 0x3F, 0x2F, 0x17, 
-    0xFF, 0x3B, 0x2B, 0x17, 0xFF, 0x3F, 0x2F, 0x17, 0xFF, 0x3B, 0x2B, 0x17, 0xFF, 0x2F, 0x23, 
-    0x13, 0xFF, 0x3B, 0x2B, 0x17, 0xFF, 0x3F, 0x2F, 0x17, 0xFF, 0x3F, 0x2F, 0x17, 0xFF, 0x2F, 
-    0x23, 0x13, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x27, 0x1B, 0x0F, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x7B, 0x33, 
-    0xFF, 0x4B, 0x5B, 0x27, 0xFF, 0x4B, 0x5B, 0x27, 0xFF, 0x4B, 0x5B, 0x27, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x5B, 0x27, 0x00, 0x4B, 
-    0x5B, 0x27, 0xFF, 0x4B, 0x5B, 0x27, 0xFF, 0x5F, 0x7B, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0xA7, 
-    0x2F, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x1B, 0x0F, 0x00, 0x27, 0x1B, 0x0F, 0xFF, 
-    0x3F, 0x2F, 0x17, 0xFF, 0x3F, 0x2F, 0x17, 0xFF, 0x3F, 0x2F, 0x17, 0xFF, 0x3B, 0x2B, 0x17, 
-    0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 
-    0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 
-    0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 
-    0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x3B, 0x2B, 0x17, 
-    0xFF, 0x3F, 0x2F, 0x17, 0xFF, 0x3F, 0x2F, 0x17, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x27, 0x1B, 
-    0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x7B, 0x33, 0xFF, 0x4B, 0x5B, 0x27, 0xFF, 0x4B, 0x5B, 0x27, 0xFF, 0x4B, 0x5B, 0x27, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x5B, 0x27, 
-    0x00, 0x4B, 0x5B, 0x27, 0xFF, 0x4B, 0x5B, 0x27, 0xFF, 0x5F, 0x7B, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x1B, 0x0F, 0x00, 0x27, 0x1B, 
-    0x0F, 0xFF, 0x2F, 0x23, 0x13, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 
-    0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 
-    0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 
-    0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x1F, 0x17, 
-    0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 
-    0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 
-    0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x7B, 0x33, 0xFF, 0x4B, 0x5B, 0x27, 0xFF, 0x4B, 0x5B, 0x27, 0xFF, 0x4B, 0x5B, 
-    0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 
-    0x5B, 0x27, 0x00, 0x4B, 0x5B, 0x27, 0xFF, 0x4B, 0x5B, 0x27, 0xFF, 0x5F, 0x7B, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 
-    0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 
-    0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x0F, 0x0B, 0x00, 
-    0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 
-    0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 
-    0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 
-    0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 
-    0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 
-    0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x27, 0x1B, 0x0F, 0xFF, 0x1F, 0x17, 0x0F, 0xFF, 0x17, 0x0F, 
-    0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x7B, 0x33, 0xFF, 0x4B, 0x5B, 0x27, 0xFF, 0x4B, 0x5B, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x33, 
-    0x00, 0x5F, 0x8F, 0x33, 0x00, 0x4B, 0x5B, 0x27, 0xFF, 0x4B, 0x5B, 0x27, 0xFF, 0x5F, 0x7B, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 
-    0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 
-    0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 
-    0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 
-    0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 
-    0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 
-    0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0xFF, 
-    0x17, 0x0F, 0x0B, 0xFF, 0x17, 0x0F, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x8F, 0x33, 
-    0x00, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 
-    0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 
-    0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 
-    0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 
-    0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 
-    0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x17, 0x0F, 
-    0x0B, 0x00, 0x17, 0x0F, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0xA7, 0x2F, 
-    0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0xA7, 0x2F, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 
-    0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0x8F, 0x33, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 
-    0x2F, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 
-    0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0xA7, 0x2F, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0xA7, 0x2F, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 
-    0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 
-    0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 
-    0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 
-    0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 
-    0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 
-    0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 
-    0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 
-    0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 
-    0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 
-    0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0xA7, 
-    0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 
-    0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 
-    0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 
-    0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 
-    0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 
-    0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 
-    0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 
-    0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0xA7, 0x2F, 
-    0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 
-    0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 
-    0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0xA7, 0x2F, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 
-    0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xA7, 
-    0x2F, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0xA7, 0x2F, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x5F, 0xA7, 0x2F, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0xA7, 0x2F, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 
-    0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 
-    0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 
-    0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 
-    0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 
-    0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0xA7, 0x2F, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 
-    0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 
-    0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 
-    0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 
-    0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 
-    0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 
-    0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 
-    0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 
-    0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 
-    0x00, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 
-    0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 
-    0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 
-    0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 
-    0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x53, 0xBB, 0x27, 0x00, 
-    0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 
-    0x8F, 0x33, 0xFF, 0x5F, 0x8F, 0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 
-    0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 
-    0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x5F, 0xA7, 0x2F, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x53, 
-    0xBB, 0x27, 0xFF, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0xA7, 0x2F, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x53, 0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0xFF, 0x5F, 0x8F, 0x33, 0xFF, 0x5F, 0x8F, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
-    0xBB, 0x27, 0x00, 0x53, 0xBB, 0x27, 0x00, 0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xBB, 0x27, 0x00, 
-    0x5F, 0x8F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00
+const int conchars_packed_size = 2970;
+const byte conchars_packed[] = {
+    0x42, 0xFF, 0x00, 0x60, 0x27, 0x24, 0x26, 0x25, 0x00, 0x80, 0x9A, 0x02, 0x9B, 0x00, 0x00, 
+    0xFF, 0xFF, 0xF4, 0x28, 0x9C, 0x2C, 0x20, 0xF4, 0xF4, 0xF4, 0x2D, 0x8E, 0x00, 0x40, 0x2D, 
+    0xF4, 0x00, 0x9C, 0xF4, 0x2C, 0x2B, 0x2A, 0x2C, 0xF4, 0x28, 0x40, 0x2A, 0x9D, 0xF4, 0x9D, 
+    0xF4, 0x2C, 0x17, 0x50, 0x2C, 0x80, 0x29, 0x9B, 0x29, 0xF4, 0x2A, 0x29, 0x5A, 0x4F, 0x70, 
+    0x41, 0x00, 0xF0, 0x1D, 0x27, 0x20, 0x21, 0x26, 0x28, 0x00, 0xC0, 0x26, 0x62, 0x9C, 0x7F, 
+    0xF0, 0x0A, 0x2A, 0xF4, 0x2A, 0x19, 0x00, 0x00, 0x40, 0x29, 0x80, 0x27, 0x9A, 0x28, 0x9C, 
+    0x2A, 0x29, 0x2C, 0x4F, 0x60, 0x36, 0x0B, 0x00, 0x20, 0x0E, 0x60, 0x09, 0x0B, 0x80, 0x7E, 
+    0xF0, 0x03, 0x22, 0x08, 0x68, 0x25, 0x29, 0x2A, 0x00, 0x80, 0x2B, 0x00, 0x00, 0x80, 0x00, 
+    0x5A, 0x01, 0x7F, 0xF0, 0x04, 0x5A, 0x9D, 0x28, 0x9B, 0xF4, 0xF4, 0x2A, 0x40, 0x2A, 0x9C, 
+    0x58, 0x28, 0x28, 0x59, 0xAA, 0x20, 0x25, 0x90, 0x99, 0x27, 0x9B, 0x9C, 0x7F, 0xF0, 0x09, 
+    0x0A, 0x0A, 0x81, 0xF0, 0x06, 0xC1, 0x17, 0x20, 0x27, 0x25, 0x28, 0x29, 0x02, 0x68, 0x00, 
+    0x6C, 0x00, 0xC6, 0x2C, 0x04, 0x20, 0x00, 0x10, 0x2B, 0x28, 0x2B, 0xFF, 0x00, 0xDE, 0x10, 
+    0x41, 0x7F, 0xA0, 0xF4, 0x2B, 0x29, 0x2C, 0x9D, 0x7F, 0x01, 0x9D, 0x99, 0x00, 0x01, 0x9C, 
+    0x9B, 0x01, 0x10, 0x79, 0x00, 0x28, 0x27, 0xB1, 0x01, 0x0F, 0x7F, 0xF0, 0x0B, 0x81, 0x50, 
+    0x15, 0x50, 0x07, 0xA0, 0x28, 0x25, 0x2A, 0x02, 0x08, 0x02, 0x02, 0x9C, 0x00, 0x00, 0x9D, 
+    0x9D, 0x9C, 0x9D, 0xA0, 0x9C, 0x9C, 0x2D, 0x2C, 0x2B, 0x7F, 0x00, 0x9B, 0x67, 0x01, 0x20, 
+    0x9C, 0x2C, 0x2C, 0x9D, 0x2C, 0x7F, 0x70, 0x02, 0xF4, 0x42, 0x02, 0x7F, 0x11, 0xF5, 0x28, 
+    0x2A, 0xF4, 0x80, 0x00, 0x9D, 0x04, 0x9C, 0x2C, 0x33, 0x10, 0x9C, 0x9C, 0xF4, 0x9B, 0x9A, 
+    0x99, 0x7F, 0xF0, 0x10, 0x0A, 0x09, 0x7F, 0xF0, 0x02, 0x00, 0x20, 0x9C, 0x28, 0x7E, 0x00, 
+    0x90, 0x9D, 0xF4, 0x02, 0x01, 0x00, 0x40, 0x02, 0x02, 0xFF, 0x00, 0xC8, 0x2A, 0x9A, 0x5A, 
+    0xFF, 0xF1, 0x06, 0xF5, 0x04, 0x00, 0x02, 0xA6, 0x21, 0x89, 0xA9, 0x21, 0x2B, 0x29, 0x7F, 
+    0x10, 0x29, 0x29, 0x5B, 0x7F, 0xF0, 0x0A, 0x18, 0x09, 0x08, 0x08, 0xFF, 0xF1, 0x07, 0x7F, 
+    0x10, 0x9D, 0x9C, 0x02, 0x4F, 0xE7, 0xC0, 0xFF, 0x40, 0x7F, 0xB0, 0xFF, 0x20, 0xFF, 0x1F, 
+    0xF6, 0x20, 0x9B, 0x0C, 0x9B, 0x58, 0x27, 0x13, 0x00, 0x00, 0x59, 0x58, 0x59, 0x59, 0x0F, 
+    0x7E, 0x80, 0x7F, 0xF0, 0x00, 0x7D, 0xF0, 0x0A, 0x7F, 0x10, 0x2A, 0xF4, 0x2C, 0x9D, 0xBF, 
+    0x7F, 0x90, 0xFF, 0x11, 0xE7, 0x12, 0xEF, 0x00, 0x7F, 0x90, 0x97, 0x00, 0xF4, 0x7F, 0x10, 
+    0x04, 0xFF, 0x1F, 0x00, 0x20, 0x1C, 0x8D, 0x8D, 0x8D, 0x1F, 0x00, 0x1F, 0x8D, 0x8D, 0x1D, 
+    0x1F, 0x1F, 0x9E, 0x9E, 0x1A, 0x9D, 0x5F, 0xF0, 0x08, 0x08, 0x7D, 0xF0, 0x0B, 0x00, 0x80, 
+    0x07, 0x09, 0x08, 0x10, 0x07, 0x07, 0x07, 0x20, 0x00, 0x70, 0x22, 0x22, 0x25, 0x80, 0x27, 
+    0x27, 0xFF, 0x24, 0x27, 0x2B, 0x00, 0x00, 0x10, 0x1F, 0x87, 0x50, 0x0C, 0x20, 0x14, 0x00, 
+    0x17, 0x50, 0x00, 0xA0, 0x26, 0x27, 0x2B, 0x2E, 0x0C, 0x00, 0x40, 0x70, 0xF0, 0x10, 0x18, 
+    0x22, 0x0A, 0x06, 0x50, 0x07, 0x07, 0x32, 0x06, 0x6E, 0x00, 0x27, 0x27, 0x02, 0x54, 0x0B, 
+    0x10, 0x27, 0x26, 0x44, 0x27, 0x27, 0x7F, 0xF0, 0x1B, 0x04, 0x27, 0x2B, 0x78, 0xF4, 0x18, 
+    0x0A, 0x88, 0x08, 0x06, 0x06, 0x08, 0x20, 0x06, 0x06, 0x08, 0x7F, 0x00, 0x28, 0x06, 0x25, 
+    0x04, 0x07, 0x35, 0x05, 0x00, 0x40, 0x25, 0x25, 0x50, 0x26, 0x26, 0x26, 0x29, 0xFF, 0xF0, 
+    0x1C, 0x28, 0x7F, 0xF0, 0x00, 0x1D, 0x00, 0x1A, 0x18, 0x15, 0x15, 0x15, 0x16, 0x15, 0x16, 
+    0x8A, 0x16, 0x05, 0x20, 0x18, 0x06, 0x00, 0x18, 0x1A, 0x1D, 0x7F, 0xE0, 0x28, 0x06, 0x05, 
+    0x28, 0x4F, 0xF0, 0x00, 0x25, 0x7F, 0xF0, 0x1D, 0x25, 0x29, 0xEB, 0x7F, 0x90, 0x85, 0x22, 
+    0x1A, 0x7C, 0x10, 0x18, 0x00, 0xA0, 0x81, 0x20, 0x7F, 0xE0, 0x44, 0x25, 0x29, 0x4E, 0xE0, 
+    0x01, 0x24, 0x27, 0x7F, 0xF0, 0x1C, 0x24, 0xE9, 0x7F, 0xF0, 0x01, 0x18, 0x1A, 0x00, 0x10, 
+    0x5D, 0x02, 0x10, 0x01, 0x00, 0x04, 0x10, 0x73, 0x00, 0x20, 0x7F, 0xD0, 0x23, 0x26, 0x7F, 
+    0xF0, 0x00, 0x67, 0x90, 0x7F, 0xD0, 0x26, 0x10, 0x26, 0x27, 0x25, 0x24, 0x00, 0xA0, 0x23, 
+    0x22, 0x05, 0x66, 0x04, 0x7F, 0xA0, 0x7E, 0x31, 0x1D, 0x1D, 0x70, 0x30, 0x00, 0x90, 0x5D, 
+    0x46, 0x1D, 0x80, 0x01, 0x7F, 0xB0, 0x24, 0x26, 0x03, 0x7F, 0xF0, 0x18, 0x25, 0x0E, 0x27, 
+    0x22, 0x06, 0xA1, 0x22, 0x00, 0x90, 0x28, 0x29, 0x29, 0x2B, 0x4E, 0x03, 0xFF, 0xF1, 0x00, 
+    0x00, 0xF0, 0x03, 0xFF, 0xE2, 0x24, 0x28, 0x7F, 0xF0, 0x1C, 0xFF, 0xC4, 0x28, 0x04, 0x00, 
+    0xD0, 0x28, 0x28, 0x03, 0x7E, 0xF0, 0x00, 0x00, 0xF0, 0x91, 0x7C, 0x0C, 0x0A, 0x06, 0x50, 
+    0x09, 0x20, 0x07, 0x50, 0x05, 0x90, 0x04, 0x30, 0x0B, 0xFF, 0x28, 0x30, 0x30, 0x80, 0x0C, 
+    0x70, 0x71, 0xF0, 0x22, 0x7F, 0xF0, 0x0C, 0xC4, 0x04, 0x70, 0x10, 0x0B, 0x10, 0xFF, 0x17, 
+    0x50, 0x80, 0x40, 0x78, 0xB0, 0x8D, 0x80, 0x91, 0xF0, 0x15, 0x20, 0xC0, 0x7F, 0xB0, 0x3D, 
+    0x25, 0xFF, 0x68, 0x00, 0x24, 0x80, 0x20, 0x50, 0x7E, 0xF0, 0x03, 0x1E, 0x70, 0x1F, 0xB0, 
+    0x7E, 0xF0, 0x17, 0x8E, 0xF0, 0x01, 0xFF, 0xFF, 0x40, 0x4F, 0xB0, 0x94, 0xF0, 0x04, 0x9C, 
+    0x61, 0xB7, 0x40, 0x07, 0x30, 0x51, 0x80, 0x0F, 0xD0, 0xDF, 0x9E, 0xF0, 0x0E, 0xFF, 0x50, 
+    0x41, 0x24, 0xFB, 0x51, 0x93, 0x30, 0x0C, 0x27, 0x03, 0x7F, 0xF0, 0x06, 0xFF, 0xFF, 0xF0, 
+    0x01, 0x66, 0xF1, 0x07, 0x8E, 0xF1, 0x0F, 0x87, 0x41, 0x7E, 0x60, 0x13, 0x60, 0xC7, 0xF0, 
+    0x02, 0x57, 0x80, 0xFF, 0x80, 0x30, 0x7F, 0xF0, 0x0B, 0xAE, 0xF2, 0x10, 0xFF, 0xC2, 0x18, 
+    0x91, 0x80, 0xF0, 0x02, 0x50, 0xF0, 0x07, 0x18, 0xF3, 0x22, 0xFF, 0xED, 0xF3, 0x52, 0xA7, 
+    0x51, 0x08, 0x60, 0x0E, 0x60, 0x76, 0x93, 0x12, 0x30, 0x0F, 0x43, 0x88, 0x31, 0xFF, 0x8F, 
+    0x43, 0x28, 0x70, 0x38, 0x50, 0x76, 0xB1, 0x08, 0xF0, 0x01, 0x0D, 0xD0, 0xCB, 0x61, 0x50, 
+    0x30, 0xF7, 0x18, 0x60, 0x78, 0x50, 0x50, 0x40, 0x0B, 0xF3, 0x91, 0xD3, 0xA2, 0x17, 0x40, 
+    0x1F, 0x54, 0xFF, 0x28, 0x72, 0x18, 0xF2, 0x02, 0xB0, 0x60, 0x67, 0xA0, 0xE6, 0x11, 0x17, 
+    0xB0, 0xBF, 0x62, 0xCF, 0x60, 0xFF, 0x87, 0xA2, 0x17, 0x81, 0x30, 0x51, 0x1E, 0x83, 0xFF, 
+    0xF1, 0x12, 0x47, 0xA4, 0xA4, 0x29, 0x7F, 0x90, 0xFF, 0x5E, 0x60, 0xD7, 0x70, 0x42, 0x50, 
+    0xE7, 0xA0, 0x77, 0x82, 0x48, 0x60, 0x7F, 0xF0, 0x01, 0x13, 0xF0, 0x08, 0xFF, 0x05, 0x40, 
+    0x3C, 0x10, 0x38, 0x81, 0x7E, 0x80, 0x96, 0x41, 0x07, 0xB4, 0x67, 0xD1, 0x8F, 0x70, 0xFF, 
+    0x7F, 0xF1, 0x05, 0x56, 0x61, 0xA0, 0x60, 0x0F, 0xC2, 0x58, 0x61, 0xC6, 0x60, 0x6F, 0x91, 
+    0x87, 0x80, 0xFB, 0x67, 0xA2, 0x66, 0x70, 0x0C, 0xE6, 0x3B, 0x7F, 0xF2, 0x07, 0x67, 0xF5, 
+    0x06, 0x98, 0xF3, 0x4D, 0x18, 0xE5, 0xFF, 0x0F, 0xF4, 0x85, 0xD7, 0xF3, 0x01, 0x88, 0x61, 
+    0x6A, 0x16, 0xEF, 0x93, 0x0F, 0x40, 0x28, 0x90, 0xFC, 0x72, 0xFF, 0x51, 0x94, 0xA7, 0x75, 
+    0x6D, 0xA1, 0xDB, 0x87, 0xAF, 0x52, 0xFF, 0x53, 0x07, 0xF0, 0x03, 0x37, 0x50, 0xFF, 0x0F, 
+    0xD0, 0x07, 0xD0, 0x57, 0xC2, 0xAA, 0x76, 0x7E, 0xC2, 0xEC, 0x23, 0x1C, 0xB0, 0xFF, 0x53, 
+    0xFF, 0x1F, 0x70, 0x6F, 0x78, 0xB7, 0xA0, 0x1F, 0xC1, 0x57, 0xD0, 0x7F, 0xE0, 0x14, 0xC0, 
+    0x42, 0x10, 0xFF, 0x6C, 0x70, 0x7F, 0xF0, 0x01, 0x1F, 0x91, 0xEF, 0xD0, 0x8B, 0x66, 0x97, 
+    0xB0, 0x7F, 0xA1, 0xFF, 0xF0, 0x0E, 0xFD, 0x6F, 0x80, 0x0A, 0x7F, 0xF0, 0x1E, 0x7F, 0xF1, 
+    0x06, 0x64, 0xB0, 0x0E, 0x46, 0xF7, 0x71, 0xFF, 0xF1, 0x06, 0xFF, 0x6F, 0xE0, 0x67, 0xF1, 
+    0x01, 0x7F, 0xF2, 0x07, 0xF7, 0x73, 0x7F, 0xF2, 0x04, 0xCD, 0x95, 0xD7, 0x91, 0x7F, 0xF2, 
+    0x05, 0xFF, 0xAF, 0x78, 0x00, 0xF0, 0xBE, 0xD8, 0xC0, 0x0E, 0x60, 0xCE, 0xE8, 0xFF, 0xF3, 
+    0x14, 0x3F, 0xC1, 0x07, 0xF0, 0x02, 0xFF, 0x37, 0x9B, 0x17, 0xF9, 0x01, 0x2F, 0x57, 0xFE, 
+    0xC5, 0xFF, 0xF3, 0x0C, 0x7F, 0xDC, 0xC7, 0xF1, 0x00, 0x6B, 0xF4, 0x05, 0xFF, 0x68, 0xFA, 
+    0x00, 0x9F, 0x52, 0xBD, 0xB9, 0xDF, 0xD0, 0xE8, 0xE7, 0x7F, 0xF0, 0x07, 0xB7, 0x57, 0xF5, 
+    0x84, 0xFF, 0xF8, 0xF6, 0x03, 0x16, 0xB4, 0xC3, 0xF8, 0x01, 0x9F, 0xE3, 0x08, 0xA9, 0x7F, 
+    0xF0, 0x01, 0x87, 0x55, 0xE8, 0x93, 0xF7, 0x21, 0xF5, 0x07, 0xF0, 0xF6, 0x0C, 0x1C, 0x90, 
+    0x0B, 0xBB, 0x83, 0x7F, 0xF0, 0x03, 0x28, 0x41, 0xAE, 0x59, 0xFF, 0x57, 0x93, 0x6F, 0xF1, 
+    0x00, 0x19, 0xFC, 0x00, 0x1E, 0xF9, 0x0B, 0x6C, 0x32, 0x87, 0xF1, 0x00, 0xBF, 0x89, 0x0F, 
+    0x5A, 0xFF, 0x0F, 0xDC, 0x84, 0xA4, 0x7F, 0xC2, 0xA2, 0xFE, 0x2D, 0x7F, 0xF3, 0x41, 0x36, 
+    0x86, 0x0D, 0x22, 0xF7, 0xFF, 0x75, 0xFF, 0x9E, 0xF8, 0x0A, 0x31, 0xC3, 0xC8, 0xA0, 0xE6, 
+    0xF8, 0x00, 0x65, 0xBB, 0x95, 0xFA, 0x03, 0x8D, 0xFA, 0x01, 0x7F, 0xF4, 0x05, 0xFF, 0x10, 
+    0xEA, 0x4F, 0xCA, 0x9E, 0x8A, 0x55, 0xE0, 0xE7, 0xAA, 0xDF, 0xF3, 0x06, 0x9E, 0x90, 0x7F, 
+    0xF8, 0x06, 0xFF, 0x77, 0xC3, 0x0F, 0xE5, 0xBF, 0xAC, 0x56, 0x60, 0xF6, 0xA2, 0x87, 0xA6, 
+    0x67, 0x80, 0xA0, 0xDF, 0xFF, 0x17, 0xF7, 0x0A, 0x78, 0x98, 0xFF, 0xF2, 0x06, 0xE7, 0x74, 
+    0x0D, 0xE5, 0x7F, 0x38, 0xB7, 0xF7, 0x00, 0xE7, 0xF0, 0x04, 0xFF, 0x7F, 0xE0, 0x5E, 0xD4, 
+    0xAF, 0xB0, 0xFF, 0xF1, 0x01, 0xFF, 0xB0, 0xBF, 0xF5, 0x02, 0xFF, 0xD0, 0x5F, 0x81, 0xFF, 
+    0xFF, 0xF1, 0x02, 0x78, 0xA9, 0xAF, 0x91, 0x1F, 0x30, 0x86, 0xEC, 0xDF, 0x97, 0xFF, 0xF7, 
+    0x02, 0xF8, 0xF7, 0x2A, 0xFF, 0x77, 0xF2, 0x05, 0x55, 0xF0, 0x2D, 0x80, 0xF4, 0x3D, 0xFF, 
+    0x92, 0x8D, 0x81, 0x08, 0xF5, 0x1B, 0x35, 0xF5, 0x27, 0xA9, 0xFB, 0x07, 0xFF, 0x7F, 0xF7, 
+    0x03, 0x4F, 0x82, 0x5F, 0xBC, 0x7F, 0xF8, 0x19, 0x37, 0xF6, 0x03, 0x07, 0xFE, 0x0D, 0xEF, 
+    0xA2, 0x3F, 0x30, 0xFF, 0xC6, 0xF6, 0x03, 0x7F, 0xF8, 0x12, 0x07, 0xBB, 0xF7, 0xFF, 0x00, 
+    0xF8, 0xB0, 0x57, 0xF0, 0x09, 0x97, 0xAD, 0x27, 0xF0, 0x07, 0xFF, 0x2C, 0x57, 0x82, 0xC3, 
+    0xF7, 0xFE, 0x0E, 0x8E, 0xBF, 0xFF, 0xE0, 0x25, 0x90, 0x6F, 0xF4, 0x01, 0xB7, 0x6D, 0xFF, 
+    0x7F, 0xD8, 0x50, 0xA0, 0x7F, 0xF1, 0x11, 0xD6, 0x77, 0xFF, 0xD1, 0x5F, 0xC3, 0x18, 0xF6, 
+    0x00, 0xFF, 0xF7, 0x04, 0x7F, 0x17, 0x89, 0x5A, 0x50, 0xFF, 0xF2, 0x01, 0xFF, 0xF1, 0x03, 
+    0x9B, 0xFF, 0x31, 0x87, 0xF6, 0x06, 0x54, 0xF0, 0x0F, 0x5D, 0x22, 0x19, 0x00, 0xE0, 0x5D, 
+    0xFF, 0xFF, 0x05, 0x00, 0x14, 0x88, 0x01, 0x04, 0x00, 0x01, 0x02, 0x18, 0x18, 0x5D, 0x1A, 
+    0x18, 0x02, 0x04, 0x2D, 0x50, 0x18, 0x5D, 0x02, 0x5D, 0x2F, 0x5D, 0x00, 0x01, 0x01, 0x01, 
+    0x02, 0x1A, 0x5D, 0x5D, 0x5D, 0x48, 0x02, 0x2F, 0x02, 0x00, 0x10, 0x1A, 0x5D, 0x02, 0x10, 
+    0x01, 0x10, 0x5D, 0x2F, 0x2F, 0x01, 0xB7, 0xF0, 0x1F, 0x5D, 0x5A, 0x56, 0x02, 0x54, 0x00, 
+    0xC0, 0x56, 0x5A, 0x5D, 0xFF, 0x54, 0x54, 0x40, 0x14, 0xF9, 0x54, 0x14, 0x54, 0x54, 0x67, 
+    0x00, 0x18, 0x10, 0x18, 0x1A, 0x1A, 0x1A, 0x7F, 0x80, 0x1A, 0x02, 0x2F, 0x09, 0x7F, 0x10, 
+    0x5D, 0x18, 0x9A, 0x00, 0x02, 0x5D, 0x02, 0x02, 0xB4, 0x16, 0x02, 0x05, 0x00, 0x5D, 0x80, 
+    0x30, 0x7F, 0x70, 0xD5, 0x00, 0x20, 0x49, 0x0E, 0x70, 0xD4, 0xD4, 0x7E, 0xF0, 0x06, 0x14, 
+    0x5A, 0x00, 0xC0, 0x14, 0x01, 0x80, 0x00, 0x16, 0x64, 0x88, 0xA4, 0x62, 0x88, 0x64, 0xFA, 
+    0x16, 0xFF, 0x10, 0x18, 0xE1, 0x00, 0x2F, 0x50, 0x6B, 0x10, 0x7F, 0x60, 0x8A, 0x00, 0x00, 
+    0x01, 0x1A, 0x1A, 0x18, 0x5D, 0x18, 0x5D, 0x5D, 0x60, 0x1D, 0x1A, 0x03, 0x5D, 0x1A, 0x16, 
+    0x00, 0x7F, 0xF0, 0x06, 0xC9, 0x92, 0xD5, 0x81, 0xF0, 0x04, 0x5D, 0x5A, 0x7E, 0x00, 0x1A, 
+    0x1F, 0x00, 0x80, 0x02, 0x1A, 0x80, 0x00, 0x5A, 0x5D, 0x19, 0x16, 0x64, 0xA4, 0x80, 0x14, 
+    0x64, 0x16, 0x19, 0x01, 0x03, 0x16, 0x5D, 0x00, 0x64, 0x5D, 0x02, 0x2A, 0x00, 0xC8, 0xC8, 
+    0x2F, 0x10, 0x0C, 0x01, 0x01, 0x9A, 0x02, 0x68, 0x00, 0x03, 0x14, 0x00, 0x0C, 0x01, 0x02, 
+    0x01, 0x8E, 0x00, 0xE2, 0x2F, 0x94, 0x00, 0x1D, 0x2F, 0x5D, 0x80, 0x10, 0x7F, 0xF0, 0x09, 
+    0x81, 0x50, 0x33, 0x15, 0x50, 0x07, 0x20, 0x1C, 0x19, 0xF0, 0x00, 0x7F, 0xD0, 0x5A, 0x19, 
+    0x00, 0x1C, 0x1C, 0x64, 0xAA, 0xA6, 0x14, 0xAA, 0x64, 0xF6, 0x1C, 0x67, 0x00, 0x71, 0x00, 
+    0x2F, 0xFF, 0x10, 0x7F, 0x30, 0x8E, 0x11, 0xFF, 0x10, 0x0E, 0x03, 0x70, 0x01, 0xFF, 0x00, 
+    0x0F, 0x01, 0x01, 0x18, 0x2F, 0x2F, 0x21, 0x14, 0x00, 0x1D, 0x1D, 0x02, 0x1D, 0x7F, 0xF0, 
+    0x0D, 0xD6, 0xD6, 0x19, 0x7F, 0xF0, 0x04, 0x14, 0x56, 0x00, 0x80, 0x8E, 0x11, 0x19, 0x1C, 
+    0x1A, 0x00, 0xAA, 0xAA, 0x88, 0x88, 0xAA, 0xAA, 0x1A, 0x01, 0x92, 0x03, 0x7F, 0x11, 0x16, 
+    0x03, 0x47, 0x50, 0x1A, 0x5D, 0x0F, 0x00, 0x11, 0x67, 0x00, 0x01, 0x02, 0x03, 0xF2, 0x00, 
+    0x2F, 0x1D, 0x1D, 0x35, 0xF7, 0x00, 0x1A, 0x08, 0x10, 0x5D, 0x14, 0x10, 0x7F, 0xF0, 0x0B, 
+    0xD6, 0xD6, 0x1C, 0xC8, 0xCA, 0x80, 0xF1, 0x00, 0x80, 0x20, 0x00, 0xC0, 0x19, 0x1C, 0xFF, 
+    0x02, 0x18, 0x01, 0x01, 0x64, 0x1C, 0x1C, 0x18, 0x01, 0xBA, 0x40, 0x18, 0x16, 0x18, 0x03, 
+    0x1A, 0x18, 0x7F, 0x62, 0x02, 0x08, 0x1A, 0x1A, 0x03, 0x6A, 0x00, 0x1D, 0x5D, 0x5D, 0x2F, 
+    0xFF, 0x71, 0x20, 0x83, 0x10, 0x79, 0x20, 0x0A, 0x00, 0x7F, 0xF0, 0x0A, 0x7D, 0xF0, 0x04, 
+    0x80, 0x10, 0x00, 0xF0, 0x01, 0xB9, 0x15, 0x20, 0x1B, 0x1B, 0x04, 0x00, 0xFF, 0x00, 0xF1, 
+    0x00, 0x02, 0xFF, 0x11, 0x9D, 0xFF, 0x40, 0x03, 0x7F, 0x20, 0x00, 0xF0, 0x06, 0x66, 0xF3, 
+    0x06, 0xCA, 0xCA, 0x7D, 0xF0, 0x04, 0x7D, 0x00, 0xF0, 0x46, 0xD3, 0x00, 0x40, 0x29, 0xF0, 
+    0x10, 0x28, 0x41, 0x2F, 0x61, 0x34, 0x00, 0xD4, 0xFF, 0x37, 0x21, 0x05, 0x30, 0x0E, 0x50, 
+    0x16, 0x60, 0x0A, 0x10, 0x08, 0x00, 0x5C, 0x10, 0x18, 0x90, 0x67, 0x0F, 0x80, 0x27, 0x50, 
+    0x00, 0xF0, 0x14, 0xD5, 0xD6, 0xD8, 0x22, 0xDF, 0x12, 0xD6, 0xBF, 0x47, 0x10, 0x3C, 0x10, 
+    0x50, 0x30, 0x46, 0x60, 0x50, 0x50, 0x91, 0x40, 0xD4, 0x7F, 0x20, 0x0F, 0x8C, 0x50, 0x6C, 
+    0x80, 0x17, 0x50, 0x80, 0xF0, 0x02, 0x1D, 0x1A, 0x18, 0x15, 0x40, 0x15, 0x15, 0x16, 0x15, 
+    0x16, 0x16, 0x05, 0x20, 0x18, 0xFF, 0x06, 0x00, 0x33, 0x03, 0x7F, 0xF0, 0x03, 0xC9, 0x00, 
+    0xC8, 0x20, 0x61, 0x50, 0x4E, 0x40, 0x90, 0x40, 0xBF, 0x20, 0x10, 0xEF, 0x30, 0x17, 0xE1, 
+    0x30, 0x41, 0x7E, 0xC0, 0x55, 0x21, 0x1A, 0x7C, 0x10, 0xFF, 0x3A, 0x03, 0x00, 0x80, 0x81, 
+    0x20, 0x7F, 0xF0, 0x00, 0xB4, 0x11, 0x7F, 0x90, 0x4E, 0x80, 0xDF, 0x50, 0x7F, 0x99, 0x50, 
+    0x26, 0x21, 0xEF, 0x60, 0x9E, 0x60, 0xFF, 0xC0, 0x7F, 0x30, 0xC4, 0x15, 0x1A, 0xFC, 0x1A, 
+    0x5D, 0x02, 0x10, 0x01, 0x00, 0x04, 0x10, 0x00, 0x20, 0x7F, 0xF0, 0x00, 0x3C, 0x10, 0xFF, 
+    0xD9, 0x30, 0xCE, 0x40, 0x4C, 0x70, 0xE7, 0x51, 0x92, 0x50, 0x7F, 0xA0, 0xAE, 0x50, 0x7F, 
+    0xF1, 0x04, 0xCC, 0x1D, 0x1D, 0x70, 0x40, 0x00, 0x90, 0x5D, 0x1D, 0x80, 0x01, 0x7F, 0xC0, 
+    0xFF, 0x58, 0x81, 0x5F, 0x51, 0x5F, 0x52, 0x56, 0x60, 0x7F, 0x91, 0x27, 0x60, 0x1C, 0x60, 
+    0x7F, 0xF2, 0x04, 0xFF, 0xA9, 0x04, 0x00, 0xF0, 0x01, 0xFF, 0xF2, 0x01, 0x00, 0xF0, 0xE7, 
+    0xC0, 0x71, 0x7E, 0x52, 0x51, 0x72, 0x05, 0x40, 0xFF, 0x04, 0x30, 0xEF, 0xB2, 0x25, 0xA0, 
+    0x71, 0xF0, 0x23, 0x7F, 0xF0, 0x0C, 0xFF, 0x51, 0xF7, 0x52, 0x04, 0x00, 0xFF, 0x90, 0x53, 
+    0x78, 0xA0, 0x8D, 0x80, 0x91, 0xF0, 0x15, 0x20, 0xC0, 0x7F, 0xB0, 0xE7, 0x52, 0x24, 0x80, 
+    0xFF, 0x90, 0xC3, 0x65, 0xD0, 0x1E, 0x50, 0x1F, 0xB0, 0x7E, 0xF0, 0x17, 0x8E, 0xF0, 0x01, 
+    0xFF, 0x40, 0x4F, 0xB0, 0xFF, 0x94, 0xF0, 0x04, 0x9C, 0x61, 0xB7, 0x60, 0x00, 0x10, 0x1B, 
+    0x95, 0x0F, 0xC0, 0x9E, 0xF0, 0x0E, 0xE7, 0xD3, 0xFF, 0x58, 0x51, 0x02, 0x20, 0x73, 0xC5, 
+    0xFF, 0xF0, 0x0C, 0x66, 0xF1, 0x07, 0x8E, 0xF1, 0x0F, 0x67, 0xA5, 0x13, 0x82, 0xFF, 0xC7, 
+    0xF0, 0x03, 0x7F, 0xE4, 0x7F, 0xF0, 0x0B, 0xAE, 0xF2, 0x10, 0xFF, 0xC2, 0x18, 0x91, 0x80, 
+    0xF0, 0x02, 0x50, 0xF0, 0x07, 0xFF, 0x18, 0xF3, 0x22, 0x20, 0xF8, 0x54, 0xE0, 0xB7, 0xEF, 
+    0x77, 0x76, 0x93, 0xEF, 0xF7, 0x0B, 0x9F, 0xA2, 0x07, 0x60, 0xFF, 0xA5, 0x95, 0xE6, 0xF3, 
+    0x08, 0xAB, 0xA3, 0xEF, 0xF7, 0x31, 0x87, 0xD6, 0x18, 0xF2, 0x00, 0xB0, 0x60, 0x67, 0xA0, 
+    0xFF, 0xEF, 0xF7, 0x09, 0xCF, 0x60, 0xEF, 0xF7, 0x0D, 0x3D, 0x60, 0xEA, 0xF1, 0x03, 0xE8, 
+    0xF2, 0x07, 0xDF, 0x76, 0xEF, 0xF7, 0x06, 0xFF, 0xF7, 0xA4, 0xEF, 0xF7, 0x0E, 0xDF, 0xD3, 
+    0x7E, 0xF2, 0x09, 0xD7, 0xA5, 0xEF, 0xD7, 0x3D, 0x87, 0xEF, 0xF7, 0x1E, 0xFF, 0x7F, 0xF1, 
+    0x03, 0x56, 0x61, 0xA0, 0x60, 0x0F, 0xC2, 0xEF, 0xF7, 0x00, 0xDF, 0xA7, 0x87, 0x70, 0xEF, 
+    0xF7, 0x07, 0xFF, 0x56, 0x2D, 0x7F, 0xF2, 0x07, 0x67, 0xF5, 0x06, 0x98, 0xF3, 0x4D, 0x18, 
+    0xE5, 0x0F, 0xF4, 0x85, 0xC7, 0xFB, 0x08, 0x47, 0x66, 0xFF, 0x07, 0x92, 0x0F, 0x62, 0x1F, 
+    0x97, 0x20, 0xA4, 0x11, 0x33, 0xAB, 0xDA, 0xD3, 0xB7, 0x2F, 0x40, 0xFF, 0xFF, 0x83, 0x07, 
+    0xF0, 0x03, 0x37, 0x50, 0x0F, 0xD0, 0x07, 0xD0, 0x57, 0xC2, 0xAA, 0x76, 0x7E, 0xC2, 0xFF, 
+    0xEC, 0x23, 0x1C, 0xB0, 0xFF, 0x53, 0x1F, 0x70, 0x6F, 0x78, 0xB7, 0xA0, 0x1F, 0xC1, 0x57, 
+    0xD0, 0xFF, 0x7F, 0xE0, 0x14, 0xC0, 0x42, 0x10, 0x6C, 0x70, 0x7F, 0xF0, 0x01, 0x1F, 0x91, 
+    0xEF, 0xD0, 0x8B, 0x66, 0xEF, 0x97, 0xB0, 0x7F, 0xA1, 0xFF, 0xF0, 0x0E, 0x6F, 0x80, 0xD5, 
+    0x7F, 0xF0, 0x1E, 0x7F, 0xF1, 0x06, 0x64, 0xB0, 0xFF, 0x0E, 0x46, 0xA7, 0xBC, 0x2F, 0xF0, 
+    0x02, 0x6F, 0xE0, 0x67, 0xF1, 0x01, 0x7F, 0xF2, 0x07, 0xF7, 0x73, 0x7F, 0xF2, 0x04, 0xFF, 
+    0xCD, 0x95, 0xD7, 0x91, 0x7F, 0xF2, 0x05, 0xAF, 0xFE, 0x1F, 0xCF, 0xFB, 0x98, 0xD8, 0xB0, 
+    0xC5, 0x75, 0xE7, 0xE9, 0xFF, 0xFF, 0xF3, 0x13, 0x3F, 0xC1, 0x07, 0xF0, 0x02, 0x37, 0x9B, 
+    0x17, 0xF9, 0x01, 0x50, 0xFE, 0x00, 0x2F, 0x42, 0xFF, 0xF3, 0x0A, 0xFF, 0x7F, 0xDC, 0xC7, 
+    0xF1, 0x00, 0x6B, 0xF4, 0x05, 0x68, 0xFA, 0x00, 0x9F, 0x52, 0xBD, 0xB9, 0xDF, 0xD0, 0xE8, 
+    0xE7, 0xFF, 0x7F, 0xF0, 0x07, 0xB7, 0x57, 0xF5, 0x84, 0xF8, 0xF6, 0x03, 0x16, 0xB4, 0xC3, 
+    0xF8, 0x01, 0x9F, 0xE3, 0x08, 0xA9, 0xBF, 0x7F, 0xF0, 0x01, 0x87, 0x55, 0xE8, 0x93, 0x21, 
+    0xF5, 0x07, 0xF0, 0xF6, 0x0C, 0x1C, 0x90, 0xD4, 0xBB, 0x83, 0xFF, 0x7F, 0xF0, 0x03, 0x28, 
+    0x41, 0xAE, 0x59, 0x57, 0x93, 0x6F, 0xF1, 0x00, 0x19, 0xFC, 0x00, 0x1E, 0xF9, 0x0B, 0x6C, 
+    0x32, 0xFF, 0x87, 0xF1, 0x00, 0xBF, 0x89, 0x0F, 0x5A, 0x0F, 0xDC, 0x84, 0xA4, 0x7F, 0xC2, 
+    0xA2, 0xFE, 0x2D, 0x7F, 0xF3, 0x41, 0xFF, 0x36, 0x86, 0x0D, 0x22, 0xF7, 0xFF, 0x75, 0x9E, 
+    0xF8, 0x0A, 0x31, 0xC3, 0xC8, 0xA0, 0xE6, 0xF8, 0x00, 0x65, 0xBB, 0xFF, 0x95, 0xFA, 0x03, 
+    0x8D, 0xFA, 0x01, 0x7F, 0xF4, 0x05, 0x10, 0xEA, 0x4F, 0xCA, 0x9E, 0x8A, 0x55, 0xE0, 0xE7, 
+    0xAA, 0xFF, 0xDF, 0xF3, 0x06, 0x9E, 0x90, 0x7F, 0xF8, 0x06, 0x77, 0xC3, 0x0F, 0xE5, 0xBF, 
+    0xAC, 0x56, 0x60, 0xF6, 0xA2, 0xFF, 0x87, 0xA6, 0x67, 0x80, 0xA0, 0xDF, 0x17, 0xF7, 0x0A, 
+    0x78, 0x98, 0xFF, 0xF2, 0x06, 0xE7, 0x74, 0x0D, 0xE5, 0xFF, 0x7F, 0x38, 0xB7, 0xF7, 0x00, 
+    0xE7, 0xF0, 0x04, 0x7F, 0xE0, 0x5E, 0xD4, 0xAF, 0xB0, 0xFF, 0xF1, 0x01, 0xFF, 0xB0, 0xFF, 
+    0xBF, 0xF5, 0x06, 0x88, 0xC5, 0xFF, 0xF1, 0x0A, 0x78, 0xA9, 0xAF, 0x91, 0x1F, 0x30, 0x86, 
+    0xEC, 0xDF, 0x97, 0xFF, 0xFF, 0xF7, 0x02, 0xF8, 0xF7, 0x2A, 0x77, 0xF2, 0x05, 0x55, 0xF0, 
+    0x2D, 0x80, 0xF4, 0x3D, 0xFF, 0x92, 0x8D, 0x81, 0x08, 0xF5, 0x1B, 0xFF, 0x35, 0xF5, 0x27, 
+    0xA9, 0xFB, 0x07, 0x7F, 0xF7, 0x03, 0x4F, 0x82, 0x5F, 0xBC, 0x7F, 0xF8, 0x19, 0x37, 0xF6, 
+    0x03, 0x07, 0xFE, 0x0D, 0xFF, 0xEF, 0xA2, 0x3F, 0x30, 0xC6, 0xF6, 0x03, 0x7F, 0xF8, 0x12, 
+    0x07, 0xBB, 0xF7, 0xFF, 0x00, 0xF8, 0xB0, 0x57, 0xF0, 0x09, 0xFF, 0x97, 0xAD, 0x27, 0xF0, 
+    0x07, 0x2C, 0x57, 0x82, 0xC3, 0xF7, 0xFE, 0x0E, 0x8E, 0xBF, 0xFF, 0xE0, 0x25, 0x90, 0xFF, 
+    0x6F, 0xF4, 0x01, 0xB7, 0x6D, 0x7F, 0xD8, 0x50, 0xA0, 0x7F, 0xF1, 0x11, 0xD6, 0x77, 0xFF, 
+    0xD1, 0x5F, 0xC3, 0xFF, 0x18, 0xF6, 0x00, 0xFF, 0xF7, 0x04, 0x17, 0x89, 0x5A, 0x50, 0xFF, 
+    0xF2, 0x01, 0xFF, 0xF1, 0x03, 0x9B, 0xFF, 0x31, 0x87, 0xF6, 0x06, 0x01, 0x54, 0xF0, 0x0D
+    
 };
 
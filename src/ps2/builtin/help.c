@@ -5,6560 +5,1189 @@ typedef unsigned char byte;
 const int help_width  = 256;
 const int help_height = 192;
 const int help_size_bytes = 98304;
-const byte help_data[] __attribute__((aligned(16))) = {
-    0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 
-    0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 
-    0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 
-    0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 
-    0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 
-    0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x64, 0x88, 0x64, 0x88, 0x63, 0x8C, 0x64, 0x84, 0x02, 0x80, 
-    0x02, 0x80, 0x01, 0x80, 0x8A, 0x99, 0x2C, 0x91, 0x8A, 0x99, 0x8A, 0x99, 0x2C, 0x91, 0x8A, 
-    0x99, 0x8A, 0x99, 0x8A, 0x99, 0xCC, 0xA1, 0x2F, 0xAA, 0x0E, 0xA6, 0xEB, 0x99, 0xCC, 0xA1, 
-    0x2C, 0x91, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x2C, 0x91, 0x8A, 0x99, 0x8A, 
-    0x99, 0x2C, 0x91, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0xCC, 0xA1, 0x2F, 0xAA, 0x0E, 0xA6, 
-    0xEB, 0x99, 0xCC, 0xA1, 0xAB, 0x9D, 0x8A, 0x99, 0x2C, 0x91, 0xAB, 0x9D, 0xAB, 0x9D, 0x8A, 
-    0x99, 0x2C, 0x91, 0x8A, 0x99, 0xAB, 0x9D, 0x8A, 0x99, 0x2C, 0x91, 0xCC, 0xA1, 0xAB, 0x9D, 
-    0x2C, 0x91, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x2C, 0x91, 0xAB, 0x9D, 0x8A, 0x99, 0x2C, 
-    0x91, 0xAB, 0x9D, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x2C, 0x9D, 0xAB, 0x9D, 
-    0x8A, 0x99, 0xAB, 0x9D, 0xAB, 0x9D, 0x8A, 0x99, 0xAB, 0x9D, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 
-    0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 
-    0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0xAB, 0x9D, 0xAB, 
-    0x9D, 0x8A, 0x99, 0x2C, 0x91, 0xEB, 0x99, 0xCC, 0xA1, 0x0E, 0xA6, 0xEB, 0x99, 0x0E, 0xA6, 
-    0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x2B, 0x9A, 0x0E, 0xA6, 0x0E, 0xA6, 0x50, 
-    0xB2, 0x8B, 0x96, 0x50, 0xB2, 0x0E, 0xA6, 0xEB, 0x99, 0x8A, 0x99, 0xAB, 0x9D, 0xEB, 0x99, 
-    0xAB, 0x9D, 0xEB, 0x99, 0xAB, 0x9D, 0xEB, 0x99, 0x0E, 0xA6, 0xEB, 0x99, 0xAB, 0x9D, 0xEB, 
-    0x99, 0xCC, 0xA1, 0xEB, 0x99, 0xAB, 0x9D, 0xAB, 0x9D, 0x8A, 0x99, 0xAB, 0x9D, 0x8A, 0x99, 
-    0xAB, 0x9D, 0x8A, 0x99, 0xAB, 0x9D, 0xEB, 0x99, 0xCC, 0xA1, 0xEB, 0x99, 0xCC, 0xA1, 0xAB, 
-    0x9D, 0xAB, 0x9D, 0xEB, 0x99, 0x0E, 0xA6, 0xCC, 0xA1, 0x2B, 0x9A, 0x0E, 0xA6, 0xCC, 0xA1, 
-    0x0E, 0xA6, 0x2B, 0x9A, 0x0E, 0xA6, 0xCC, 0xA1, 0xCC, 0xA1, 0xCC, 0xA1, 0x2B, 0x9A, 0x0E, 
-    0xA6, 0xCC, 0xA1, 0x0E, 0xA6, 0x2B, 0x9A, 0x0E, 0xA6, 0xAB, 0x9D, 0x8A, 0x99, 0x8A, 0x99, 
-    0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8C, 0xA1, 0x8C, 0xA1, 0x8C, 0xA1, 0x8C, 
-    0xA1, 0x8C, 0xA1, 0x8C, 0xA1, 0x8C, 0xA1, 0x8C, 0xA1, 0x8C, 0xA1, 0x8C, 0xA1, 0x8C, 0xA1, 
-    0x8C, 0xA1, 0x8C, 0xA1, 0x8C, 0xA1, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 
-    0x91, 0x69, 0x91, 0x27, 0x8D, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x27, 0x8D, 0x8A, 0x99, 
-    0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x27, 0x8D, 0x69, 0x91, 0x69, 0x91, 0x69, 
-    0x91, 0x69, 0x91, 0x27, 0x8D, 0x69, 0x91, 0x69, 0x91, 0x27, 0x8D, 0x69, 0x91, 0x27, 0x8D, 
-    0x69, 0x91, 0x27, 0x8D, 0xE9, 0x8C, 0x27, 0x8D, 0x69, 0x91, 0xC8, 0x8C, 0xC8, 0x8C, 0x27, 
-    0x8D, 0xC8, 0x8C, 0x27, 0x8D, 0xC8, 0x8C, 0x27, 0x8D, 0xC8, 0x8C, 0x27, 0x8D, 0xC8, 0x8C, 
-    0x27, 0x8D, 0xC8, 0x8C, 0x27, 0x8D, 0xC8, 0x8C, 0x27, 0x8D, 0xC8, 0x8C, 0x27, 0x8D, 0xC8, 
-    0x8C, 0x27, 0x8D, 0xC8, 0x8C, 0x27, 0x8D, 0x06, 0x89, 0xC8, 0x8C, 0x27, 0x8D, 0x27, 0x8D, 
-    0x69, 0x91, 0x69, 0x91, 0x27, 0x8D, 0x27, 0x8D, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 
-    0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0x84, 0x90, 0x86, 0x8C, 0x86, 0x8C, 
-    0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x66, 0x8C, 0x84, 
-    0x8C, 0x64, 0x88, 0x64, 0x88, 0x22, 0x84, 0x64, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x64, 0x88, 
-    0x63, 0x8C, 0x02, 0x80, 0x01, 0x80, 0x69, 0x91, 0x0B, 0x8D, 0x69, 0x91, 0x0B, 0x8D, 0x69, 
-    0x91, 0x69, 0x91, 0x0B, 0x8D, 0x69, 0x91, 0xEB, 0x99, 0x2B, 0x9A, 0xEB, 0x99, 0xEB, 0x99, 
-    0xEB, 0x99, 0x69, 0x91, 0x0B, 0x8D, 0x69, 0x91, 0x0B, 0x8D, 0x69, 0x91, 0x0B, 0x8D, 0x69, 
-    0x91, 0x0B, 0x8D, 0x69, 0x91, 0x69, 0x91, 0x0B, 0x8D, 0x69, 0x91, 0xEB, 0x99, 0x2B, 0x9A, 
-    0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0x0E, 0xA6, 0x2B, 0x9A, 0xEB, 0x99, 0x8A, 0x99, 0x8A, 
-    0x99, 0x2C, 0x91, 0x69, 0x91, 0x69, 0x91, 0x2C, 0x91, 0x69, 0x91, 0x8A, 0x99, 0x8A, 0x99, 
-    0x2C, 0x91, 0x69, 0x91, 0x69, 0x91, 0x2C, 0x91, 0x69, 0x91, 0x8A, 0x99, 0x2C, 0x91, 0x69, 
-    0x91, 0x8A, 0x99, 0x2C, 0x91, 0x69, 0x91, 0x8A, 0x99, 0x2C, 0x91, 0x69, 0x91, 0x69, 0x91, 
-    0x2C, 0x91, 0x69, 0x91, 0x2C, 0x91, 0x2C, 0x91, 0x69, 0x91, 0x2C, 0x91, 0x8A, 0x99, 0xAB, 
-    0x9D, 0xAB, 0x9D, 0xAB, 0x9D, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 
-    0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 
-    0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0xEB, 0x99, 0xEB, 0x99, 
-    0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0x2B, 
-    0x9A, 0x0E, 0xA6, 0x0E, 0xA6, 0x2B, 0x9A, 0xEB, 0x99, 0x2C, 0x91, 0x69, 0x91, 0x8A, 0x99, 
-    0x2C, 0x91, 0x8A, 0x99, 0x8A, 0x99, 0x2C, 0x91, 0xEB, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 
-    0x99, 0x8A, 0x99, 0x2C, 0x91, 0x8A, 0x99, 0x8A, 0x99, 0x69, 0x91, 0x2C, 0x91, 0x69, 0x91, 
-    0x69, 0x91, 0x2C, 0x91, 0x69, 0x91, 0x8A, 0x99, 0x8A, 0x99, 0x2C, 0x91, 0xEB, 0x99, 0x8A, 
-    0x99, 0x2C, 0x91, 0x8A, 0x99, 0x8A, 0x99, 0x8C, 0xA1, 0x8C, 0xA1, 0x8C, 0xA1, 0x29, 0x9D, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x8C, 0xA1, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x0B, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0xEA, 0x94, 
-    0x08, 0x99, 0x08, 0x99, 0x0B, 0x8D, 0x08, 0x99, 0x29, 0x9D, 0xEA, 0x94, 0x29, 0x9D, 0x29, 
-    0x9D, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x29, 0x9D, 0x6B, 0xA1, 0x6B, 0xA1, 
-    0x6B, 0xA1, 0x6B, 0xA1, 0x29, 0x9D, 0x6B, 0xA1, 0x6B, 0xA1, 0x29, 0x9D, 0xC8, 0x90, 0xC8, 
-    0x90, 0xC9, 0x94, 0xC8, 0x90, 0xEA, 0x94, 0x08, 0x99, 0xC9, 0x94, 0xEA, 0x94, 0x08, 0x99, 
-    0xC9, 0x94, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0xEA, 0x94, 0xC8, 0x90, 0x08, 0x99, 0xC8, 
-    0x90, 0x08, 0x99, 0xC9, 0x94, 0x08, 0x99, 0xC8, 0x90, 0xC8, 0x90, 0xEA, 0x94, 0xC6, 0x94, 
-    0xC8, 0x90, 0x08, 0x99, 0xC9, 0x94, 0x08, 0x99, 0xC8, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC8, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 
-    0x06, 0x89, 0x06, 0x89, 0xA7, 0x88, 0x06, 0x89, 0x06, 0x89, 0xA7, 0x88, 0x06, 0x89, 0xA7, 
-    0x88, 0x06, 0x89, 0xA7, 0x88, 0xE5, 0x84, 0xA7, 0x88, 0xE5, 0x84, 0xE5, 0x84, 0xA5, 0x90, 
-    0x06, 0x89, 0x06, 0x89, 0x27, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 0x06, 
-    0x89, 0x06, 0x89, 0x06, 0x89, 0xA7, 0x88, 0xE5, 0x84, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 
-    0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 
-    0x88, 0x85, 0x88, 0x86, 0x88, 0x86, 0x88, 0x85, 0x88, 0x64, 0x88, 0x86, 0x8C, 0x84, 0x90, 
-    0x64, 0x88, 0x23, 0x84, 0x02, 0x80, 0x01, 0x80, 0x2C, 0x91, 0xEA, 0x94, 0xC8, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC8, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xEA, 0x94, 0xC8, 0x90, 
-    0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC8, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 
-    0x94, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xE9, 0x8C, 0xEA, 0x94, 
-    0x6B, 0xA1, 0x0B, 0x99, 0xC9, 0x94, 0xEA, 0x94, 0x29, 0x9D, 0x2C, 0x9D, 0x0B, 0x99, 0xE9, 
-    0x8C, 0xA7, 0x90, 0x29, 0x9D, 0xC9, 0x94, 0xC9, 0x94, 0xC9, 0x94, 0xC9, 0x94, 0xC8, 0x8C, 
-    0xC8, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC9, 0x94, 0xC9, 0x94, 0xC9, 0x94, 0xC9, 0x94, 0xC6, 
-    0x94, 0xC9, 0x94, 0xA7, 0x90, 0xC9, 0x94, 0xC9, 0x94, 0xA7, 0x90, 0xC9, 0x94, 0xC9, 0x94, 
-    0xC8, 0x8C, 0xC9, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC9, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0x0B, 0x8D, 0x0B, 0x8D, 0x29, 0x9D, 0x29, 0x9D, 0x6B, 0xA1, 
-    0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xEA, 
-    0x94, 0xC9, 0x94, 0x08, 0x99, 0x08, 0x99, 0xE9, 0x8C, 0xEA, 0x94, 0xEA, 0x94, 0xC9, 0x94, 
-    0xEA, 0x94, 0xEA, 0x94, 0x29, 0x9D, 0xEA, 0x94, 0x0B, 0x99, 0x29, 0x9D, 0x0B, 0x99, 0x2C, 
-    0x9D, 0x6B, 0xA1, 0x8A, 0x99, 0x2C, 0x9D, 0x29, 0x9D, 0xEA, 0x94, 0xE9, 0x8C, 0x08, 0x99, 
-    0xC9, 0x94, 0xE9, 0x8C, 0xA7, 0x90, 0xEA, 0x94, 0xC9, 0x94, 0xC9, 0x94, 0xC8, 0x8C, 0xC9, 
-    0x94, 0xC9, 0x94, 0xC8, 0x8C, 0xEA, 0x94, 0xC8, 0x8C, 0xEA, 0x94, 0xC9, 0x94, 0xC8, 0x8C, 
-    0xC8, 0x90, 0xC9, 0x94, 0xC8, 0x8C, 0xC8, 0x90, 0xE9, 0x8C, 0xEA, 0x94, 0x08, 0x99, 0xC8, 
-    0x8C, 0xEA, 0x94, 0x08, 0x99, 0xC8, 0x8C, 0xA7, 0x90, 0xEA, 0x94, 0xEA, 0x94, 0xEA, 0x94, 
-    0x29, 0x9D, 0xEA, 0x94, 0xEA, 0x94, 0x29, 0x9D, 0xC9, 0x94, 0xC8, 0x90, 0xC8, 0x90, 0x29, 
-    0x9D, 0xC8, 0x90, 0xC9, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 
-    0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC8, 0x90, 0xC6, 0x94, 
-    0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 
-    0x94, 0xA8, 0x88, 0xA7, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x85, 0x88, 
-    0x86, 0x88, 0x85, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x85, 
-    0x88, 0x85, 0x88, 0x85, 0x88, 0x86, 0x88, 0x85, 0x88, 0x44, 0x84, 0x85, 0x88, 0x86, 0x88, 
-    0x85, 0x88, 0x86, 0x88, 0x86, 0x88, 0x64, 0x84, 0x64, 0x84, 0x86, 0x88, 0x86, 0x88, 0x65, 
-    0x88, 0x86, 0x88, 0x65, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x65, 0x88, 0x65, 0x88, 
-    0x86, 0x88, 0x65, 0x88, 0x86, 0x88, 0x44, 0x84, 0x86, 0x88, 0x65, 0x88, 0x65, 0x88, 0x86, 
-    0x88, 0x44, 0x84, 0x86, 0x88, 0x65, 0x88, 0x86, 0x88, 0x65, 0x88, 0x86, 0x88, 0x86, 0x88, 
-    0x86, 0x88, 0x65, 0x88, 0x86, 0x88, 0x85, 0x88, 0x85, 0x88, 0x86, 0x8C, 0x84, 0x90, 0xA7, 
-    0x88, 0xA5, 0x90, 0x84, 0x8C, 0x84, 0x8C, 0x65, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 
-    0x64, 0x88, 0x85, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x45, 0x88, 0x65, 0x88, 0x43, 0x84, 0x65, 
-    0x88, 0x43, 0x84, 0x84, 0x8C, 0x84, 0x8C, 0x65, 0x88, 0x65, 0x88, 0x63, 0x8C, 0xA5, 0x90, 
-    0x63, 0x8C, 0x64, 0x84, 0x25, 0x80, 0x42, 0x80, 0x01, 0x80, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 
-    0x90, 0xA7, 0x90, 0xC8, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 
-    0xC8, 0x90, 0xA7, 0x90, 0xC8, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 
-    0x90, 0xC8, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xA7, 0x90, 0x08, 0x99, 
-    0x08, 0x99, 0x29, 0x9D, 0xEA, 0x94, 0x08, 0x99, 0x29, 0x9D, 0xEA, 0x94, 0xC8, 0x90, 0xC6, 
-    0x94, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 
-    0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xE9, 0x8C, 0xC6, 0x94, 0xC8, 0x90, 0xC6, 0x94, 
-    0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xE9, 0x8C, 0xC6, 0x94, 0xC8, 
-    0x90, 0xC6, 0x94, 0xC9, 0x94, 0xE9, 0x8C, 0xC8, 0x90, 0xE9, 0x8C, 0xE9, 0x8C, 0x0B, 0x8D, 
-    0x29, 0x9D, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x29, 0x9D, 0xC8, 0x90, 0xC8, 0x90, 0xC8, 
-    0x90, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0x29, 0x9D, 0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 
-    0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0xEA, 0x94, 0x29, 0x9D, 0x29, 
-    0x9D, 0x6B, 0xA1, 0x29, 0x9D, 0x6B, 0xA1, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0xC8, 0x90, 
-    0xC8, 0x90, 0x08, 0x99, 0xC9, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0x08, 
-    0x99, 0xC8, 0x90, 0x08, 0x99, 0xA7, 0x90, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 
-    0xC8, 0x90, 0x08, 0x99, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 
-    0x99, 0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 
-    0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 
-    0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0x06, 0x89, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 
-    0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x88, 0x08, 0x99, 0xC6, 0x94, 0xC8, 0x8C, 0x86, 
-    0x88, 0x46, 0x84, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x03, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x03, 0x80, 0x24, 0x80, 0x03, 0x80, 0x24, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 
-    0x80, 0x24, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x02, 0x80, 0x24, 0x80, 0x03, 0x80, 
-    0x03, 0x80, 0x03, 0x80, 0x02, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 
-    0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x24, 0x80, 0x03, 0x80, 0x24, 0x80, 
-    0x03, 0x80, 0x02, 0x80, 0x03, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x03, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0xA5, 0x90, 0xA5, 0x90, 0x63, 
-    0x8C, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0x84, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x64, 0x88, 
-    0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0x65, 0x88, 0x43, 
-    0x84, 0x65, 0x88, 0x65, 0x88, 0x45, 0x88, 0x86, 0x88, 0x65, 0x88, 0x63, 0x8C, 0xA7, 0x88, 
-    0x63, 0x8C, 0x86, 0x88, 0x64, 0x84, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0xC8, 0x90, 0xC8, 
-    0x90, 0xC6, 0x94, 0xC8, 0x90, 0xC8, 0x90, 0xC8, 0x90, 0xC8, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xC8, 0x90, 0xC6, 0x94, 0xC8, 0x90, 0xC8, 0x90, 0xC8, 0x90, 0xC8, 0x90, 0xA7, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC8, 0x90, 
-    0xEA, 0x94, 0x29, 0x9D, 0xE8, 0xA0, 0x29, 0x9D, 0xEA, 0x94, 0x08, 0x99, 0xA7, 0x88, 0xA5, 
-    0x90, 0xC9, 0x94, 0xC8, 0x90, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 0xEA, 0x94, 
-    0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xE9, 0x8C, 0xA7, 0x90, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 
-    0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 
-    0xC6, 0x94, 0xC8, 0x8C, 0xC8, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC9, 
-    0x94, 0xA7, 0x90, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 
-    0xC8, 0x8C, 0xEA, 0x94, 0x29, 0x9D, 0x2C, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0xC8, 0x90, 0xC8, 
-    0x90, 0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0xC8, 0x90, 0x29, 0x9D, 0xC8, 0x90, 
-    0x29, 0x9D, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x6B, 0xA1, 0x29, 0x9D, 0x6B, 0xA1, 0x29, 0x9D, 0x08, 0x99, 
-    0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC8, 0x90, 0x08, 0x99, 0xC8, 
-    0x90, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xC9, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xC8, 0x90, 
-    0x08, 0x99, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0xC8, 0x90, 0x08, 
-    0x99, 0xC9, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC9, 0x94, 0xA5, 0x90, 
-    0xC8, 0x8C, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC8, 0x90, 0x08, 0x99, 0xC6, 
-    0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x63, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 
-    0x84, 0x8C, 0x84, 0x8C, 0xA5, 0x94, 0x84, 0x8C, 0x86, 0x88, 0x63, 0x8C, 0x44, 0x84, 0xA5, 
-    0x90, 0x63, 0x88, 0x85, 0x88, 0x64, 0x88, 0x86, 0x88, 0xC6, 0x94, 0x64, 0x88, 0x64, 0x84, 
-    0x64, 0x84, 0x86, 0x88, 0xC6, 0x94, 0xA5, 0x90, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xA8, 
-    0x88, 0x85, 0x88, 0x05, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x02, 0x80, 0xA5, 0x90, 0xA5, 
-    0x90, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x90, 0x84, 0x8C, 0x86, 0x88, 0x85, 0x88, 0x63, 0x8C, 
-    0x64, 0x88, 0x86, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x65, 0x88, 0x65, 
-    0x88, 0x66, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0x84, 0x8C, 0x85, 0x88, 
-    0x84, 0x8C, 0x86, 0x8C, 0x63, 0x8C, 0x65, 0x88, 0x25, 0x80, 0x02, 0x80, 0x01, 0x80, 0xC6, 
-    0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC8, 0x90, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC8, 0x90, 0xC6, 0x94, 0xC8, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 0x90, 
-    0xA7, 0x88, 0xA7, 0x90, 0xC8, 0x90, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xA7, 0x90, 0xA7, 
-    0x90, 0xA7, 0x90, 0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 0x86, 0x8C, 0xC9, 0x94, 0x08, 0x99, 
-    0x08, 0x99, 0xC8, 0x90, 0xC8, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC8, 
-    0x8C, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xC8, 0x90, 
-    0x08, 0x99, 0xA7, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0xC8, 0x90, 0xC8, 0x90, 0xA5, 0x90, 0xA7, 
-    0x90, 0x84, 0x90, 0xA7, 0x90, 0xE5, 0x84, 0xA7, 0x90, 0x86, 0x8C, 0xC6, 0x94, 0xC8, 0x90, 
-    0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 
-    0x99, 0xC8, 0x90, 0xC6, 0x94, 0x86, 0x8C, 0xC9, 0x94, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 
-    0xEA, 0x94, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0xEA, 0x94, 0x29, 0x9D, 0x08, 0x99, 0xEA, 
-    0x94, 0x29, 0x9D, 0x29, 0x9D, 0x6B, 0xA1, 0x6B, 0xA1, 0x29, 0x9D, 0x09, 0xA5, 0x29, 0x9D, 
-    0xEA, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0x08, 0x99, 0xC9, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0xC8, 
-    0x90, 0xC8, 0x90, 0x08, 0x99, 0xC8, 0x90, 0xC8, 0x90, 0xC8, 0x90, 0xA7, 0x90, 0xC6, 0x94, 
-    0x08, 0x99, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0x08, 
-    0x99, 0xC8, 0x90, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 
-    0xA7, 0x90, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC8, 
-    0x8C, 0x08, 0x99, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x8C, 0x42, 0x84, 0x00, 0x80, 0x42, 0x84, 
-    0x64, 0x84, 0xA5, 0x94, 0x00, 0x80, 0x84, 0x8C, 0x63, 0x8C, 0x42, 0x84, 0x02, 0x80, 0x42, 
-    0x88, 0x00, 0x80, 0x44, 0x84, 0x23, 0x84, 0x21, 0x80, 0xA5, 0x90, 0xA5, 0x90, 0x64, 0x88, 
-    0x00, 0x80, 0x00, 0x80, 0x85, 0x88, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0xA8, 0x88, 0x24, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0xA5, 
-    0x90, 0xC8, 0x90, 0xA5, 0x90, 0x84, 0x90, 0xA7, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x65, 0x88, 
-    0x65, 0x88, 0x84, 0x8C, 0x65, 0x88, 0x64, 0x88, 0x86, 0x88, 0x64, 0x88, 0x84, 0x8C, 0x25, 
-    0x80, 0x43, 0x84, 0x23, 0x84, 0x65, 0x88, 0x64, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 
-    0x84, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0x23, 0x84, 0x02, 0x80, 0x01, 
-    0x80, 0xA5, 0x90, 0xC9, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 
-    0xC9, 0x94, 0xC9, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 
-    0x94, 0xC9, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0xC9, 0x94, 0xC6, 0x94, 0x87, 0x84, 
-    0x23, 0x80, 0x05, 0x80, 0x24, 0x80, 0x23, 0x84, 0x85, 0x88, 0xC6, 0x94, 0xC9, 0x94, 0xC8, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC9, 0x94, 0x08, 0x99, 0x00, 0x80, 0x21, 0x84, 
-    0x08, 0x99, 0x08, 0x99, 0xA7, 0x90, 0x86, 0x8C, 0x42, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x85, 0x88, 0xC6, 0x94, 0x86, 0x8C, 0x42, 0x88, 0x00, 0x80, 0x00, 0x80, 0x64, 0x88, 
-    0xA7, 0x90, 0xC8, 0x90, 0xA5, 0x90, 0x21, 0x84, 0x00, 0x80, 0x00, 0x80, 0xC6, 0x94, 0x00, 
-    0x80, 0x01, 0x80, 0x00, 0x80, 0x00, 0x80, 0x23, 0x80, 0x42, 0x88, 0x23, 0x80, 0x23, 0x84, 
-    0xEA, 0x94, 0x84, 0x90, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x08, 0x99, 0x08, 
-    0x99, 0x00, 0x80, 0x42, 0x88, 0x08, 0x99, 0x08, 0x99, 0x42, 0x88, 0x42, 0x88, 0x29, 0x9D, 
-    0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 0xEA, 0x94, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0xEA, 
-    0x94, 0x29, 0x9D, 0x08, 0x99, 0x6B, 0xA1, 0x6B, 0xA1, 0x09, 0xA5, 0x6B, 0xA1, 0x29, 0x9D, 
-    0x29, 0x9D, 0xEA, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0xC8, 0x90, 0x08, 0x99, 0xC6, 0x94, 0xC8, 
-    0x90, 0x08, 0x99, 0xC8, 0x90, 0xC8, 0x90, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xA5, 0x90, 
-    0xC9, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0xC8, 
-    0x90, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 
-    0xC8, 0x90, 0xC6, 0x94, 0x29, 0x9D, 0xC6, 0x94, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0xC6, 0x94, 0xA5, 0x94, 0xA5, 0x94, 0x63, 0x88, 0x84, 0x8C, 0xE7, 0x9C, 
-    0xC6, 0x94, 0x66, 0x8C, 0xA5, 0x94, 0x22, 0x84, 0x63, 0x88, 0x63, 0x88, 0x85, 0x88, 0x06, 
-    0x89, 0xC6, 0x94, 0x00, 0x80, 0xA5, 0x94, 0x84, 0x90, 0x00, 0x80, 0x06, 0x89, 0xA7, 0x88, 
-    0xA5, 0x94, 0x64, 0x84, 0x00, 0x80, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0xC8, 0x8C, 0xA8, 0x88, 0x24, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 
-    0x80, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x88, 
-    0x63, 0x8C, 0xA7, 0x88, 0x64, 0x88, 0x86, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x25, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x25, 0x80, 0x63, 0x8C, 0x64, 0x88, 0x64, 0x88, 
-    0x84, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x25, 0x80, 0x02, 
-    0x80, 0x01, 0x80, 0xE9, 0x8C, 0xC6, 0x94, 0xC8, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 
-    0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 
-    0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x90, 
-    0x44, 0x84, 0x02, 0x80, 0x23, 0x80, 0x23, 0x84, 0x21, 0x80, 0x23, 0x80, 0xA7, 0x90, 0x08, 
-    0x99, 0xC6, 0x94, 0xC8, 0x90, 0xA7, 0x90, 0xC8, 0x90, 0xC8, 0x90, 0xA7, 0x90, 0x63, 0x8C, 
-    0x00, 0x80, 0x08, 0x99, 0xC8, 0x90, 0xC8, 0x90, 0x63, 0x8C, 0x00, 0x80, 0xA5, 0x94, 0xC6, 
-    0x94, 0xA5, 0x94, 0x63, 0x8C, 0x66, 0x8C, 0x42, 0x88, 0x63, 0x8C, 0xA5, 0x90, 0xE7, 0x9C, 
-    0x42, 0x88, 0x64, 0x88, 0xEA, 0x94, 0x42, 0x88, 0x42, 0x88, 0x84, 0x90, 0x00, 0x80, 0x42, 
-    0x88, 0xC7, 0x98, 0x86, 0x88, 0x00, 0x80, 0x00, 0x80, 0xC8, 0x90, 0x29, 0x9D, 0x42, 0x88, 
-    0x42, 0x88, 0x29, 0x9D, 0x00, 0x80, 0x00, 0x80, 0x29, 0x9D, 0xC6, 0x94, 0x00, 0x80, 0x00, 
-    0x80, 0xE8, 0xA0, 0x00, 0x80, 0x00, 0x80, 0x42, 0x88, 0xC6, 0x94, 0x42, 0x88, 0x84, 0x8C, 
-    0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0xEA, 0x94, 0x29, 0x9D, 0x08, 
-    0x99, 0xEA, 0x94, 0x29, 0x9D, 0x09, 0xA5, 0x29, 0x9D, 0x6B, 0xA1, 0x29, 0x9D, 0x6B, 0xA1, 
-    0x29, 0x9D, 0x29, 0x9D, 0xEA, 0x94, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xC8, 0x90, 0xC9, 
-    0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 
-    0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0xC6, 0x94, 0xC9, 
-    0x94, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC9, 0x94, 0x08, 0x99, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0xC9, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x84, 0x90, 
-    0x00, 0x80, 0xA5, 0x94, 0x08, 0x99, 0xA5, 0x90, 0x42, 0x88, 0x42, 0x88, 0x84, 0x90, 0x06, 
-    0x89, 0xC7, 0x98, 0x84, 0x90, 0x00, 0x80, 0xA5, 0x94, 0xA5, 0x90, 0x00, 0x80, 0x27, 0x8D, 
-    0x85, 0x88, 0x84, 0x8C, 0xA5, 0x94, 0x21, 0x84, 0x06, 0x89, 0xC6, 0x94, 0xC6, 0x94, 0x08, 
-    0x99, 0x08, 0x99, 0xC6, 0x94, 0x06, 0x89, 0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0xA5, 0x90, 0xC6, 0x94, 0x84, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 
-    0x63, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x65, 0x88, 0x63, 0x8C, 0x86, 0x88, 0x02, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x45, 0x88, 0xA7, 0x88, 
-    0x64, 0x88, 0x86, 0x8C, 0x63, 0x8C, 0x65, 0x88, 0x84, 0x8C, 0x85, 0x88, 0x45, 0x88, 0x64, 
-    0x88, 0x02, 0x80, 0x01, 0x80, 0xC8, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 
-    0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 
-    0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 
-    0xC8, 0x8C, 0x23, 0x80, 0x42, 0x84, 0xA7, 0x90, 0xC7, 0x98, 0x25, 0x80, 0x42, 0x84, 0xA7, 
-    0x90, 0x08, 0x99, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 
-    0xA5, 0x94, 0x63, 0x8C, 0x0A, 0x99, 0x08, 0x99, 0x08, 0x99, 0x63, 0x8C, 0x63, 0x8C, 0xE7, 
-    0x9C, 0xC7, 0x98, 0xE8, 0xA0, 0x63, 0x8C, 0x84, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x29, 0x9D, 
-    0x09, 0xA5, 0x29, 0x9D, 0x0B, 0x99, 0xC7, 0x98, 0x42, 0x84, 0x84, 0x8C, 0xC9, 0x94, 0x42, 
-    0x84, 0x42, 0x84, 0xC8, 0x90, 0xC6, 0x94, 0x63, 0x8C, 0x42, 0x88, 0xEA, 0x94, 0xC9, 0x94, 
-    0x84, 0x8C, 0x42, 0x88, 0x0A, 0x99, 0x42, 0x88, 0x84, 0x8C, 0xA7, 0x90, 0xA7, 0x90, 0x42, 
-    0x88, 0x42, 0x88, 0x08, 0x99, 0x42, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x42, 0x88, 0x42, 0x88, 
-    0xA5, 0x90, 0xEA, 0x94, 0x08, 0x99, 0xEA, 0x94, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 
-    0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x6B, 0xA1, 0xEA, 0x94, 0x09, 0xA5, 
-    0x29, 0x9D, 0x6B, 0xA1, 0x29, 0x9D, 0x29, 0x9D, 0xC8, 0x90, 0xC8, 0x90, 0xC8, 0x90, 0xC6, 
-    0x94, 0xC8, 0x90, 0xC8, 0x90, 0x08, 0x99, 0xC8, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 
-    0xC9, 0x94, 0xA5, 0x90, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0xC9, 0x94, 0xC6, 
-    0x94, 0xC8, 0x90, 0x08, 0x99, 0xC8, 0x90, 0xEA, 0x94, 0x08, 0x99, 0xC8, 0x90, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0x29, 0x9D, 0xEA, 0x94, 0x08, 
-    0x99, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0xA5, 0x90, 0xA5, 0x90, 0x08, 0x99, 
-    0xC6, 0x94, 0xA6, 0x94, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x94, 0x84, 0x8C, 0x84, 0x90, 0xA5, 
-    0x94, 0x63, 0x8C, 0xA5, 0x90, 0xA5, 0x94, 0x21, 0x84, 0xA5, 0x90, 0x84, 0x90, 0x21, 0x84, 
-    0x06, 0x89, 0x86, 0x88, 0x84, 0x90, 0xA5, 0x90, 0x21, 0x84, 0x06, 0x89, 0xA5, 0x90, 0xA5, 
-    0x90, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x06, 0x89, 0x84, 0x8C, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 0x90, 0x06, 0x89, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x8C, 
-    0xA5, 0x90, 0xA5, 0x90, 0x64, 0x88, 0x86, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x85, 0x88, 0x63, 
-    0x8C, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x25, 0x80, 0x43, 0x84, 0x02, 0x80, 0x63, 0x8C, 
-    0xA7, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x64, 
-    0x88, 0x44, 0x84, 0x02, 0x80, 0x01, 0x80, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 
-    0xC6, 0x94, 0xC9, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC9, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 
-    0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 
-    0x08, 0x99, 0x27, 0x8D, 0x63, 0x8C, 0x22, 0x84, 0x86, 0x8C, 0x86, 0x8C, 0x25, 0x80, 0x63, 
-    0x88, 0xEA, 0x94, 0xC8, 0x90, 0xC8, 0x90, 0xA7, 0x90, 0xEA, 0x94, 0xC6, 0x94, 0xEA, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0x84, 0x90, 0x08, 0x99, 0xA7, 0x90, 0x08, 0x99, 0xA5, 0x94, 0x84, 
-    0x90, 0xC6, 0x94, 0xA7, 0x88, 0x06, 0x89, 0xA5, 0x94, 0xC6, 0x94, 0x84, 0x90, 0x84, 0x90, 
-    0xC9, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0x84, 0x8C, 0x84, 0x90, 0xE7, 
-    0x9C, 0x84, 0x90, 0x84, 0x90, 0xC8, 0x90, 0x86, 0x88, 0x84, 0x8C, 0x63, 0x8C, 0xEA, 0x94, 
-    0xC9, 0x94, 0xA5, 0x90, 0x84, 0x8C, 0xE8, 0xA0, 0x84, 0x8C, 0x84, 0x8C, 0xA7, 0x90, 0xA7, 
-    0x90, 0x84, 0x90, 0x84, 0x8C, 0xEA, 0x94, 0x84, 0x90, 0xA6, 0x94, 0xA5, 0x90, 0x84, 0x8C, 
-    0x84, 0x90, 0xA7, 0x90, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xEA, 0x94, 0x29, 
-    0x9D, 0xEA, 0x94, 0xE8, 0xA0, 0x29, 0x9D, 0xEA, 0x94, 0x09, 0xA5, 0x6B, 0xA1, 0x09, 0xA5, 
-    0x29, 0x9D, 0x29, 0x9D, 0x6B, 0xA1, 0x29, 0x9D, 0xEA, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC9, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 
-    0xC9, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0x08, 0x99, 0xC9, 
-    0x94, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC9, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 0x90, 0xC8, 0x8C, 0xC6, 0x94, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xA5, 0x90, 0xA5, 0x90, 
-    0x42, 0x88, 0x00, 0x80, 0xC6, 0x94, 0xA5, 0x94, 0x63, 0x8C, 0x84, 0x90, 0x84, 0x90, 0x08, 
-    0x99, 0xE7, 0x9C, 0x84, 0x8C, 0x23, 0x84, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 0x84, 0x90, 
-    0x84, 0x90, 0xA5, 0x90, 0x42, 0x88, 0x85, 0x88, 0x84, 0x90, 0x84, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0x85, 0x88, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x06, 0x89, 0x84, 0x8C, 0x02, 0x80, 
-    0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xC6, 0x94, 0x06, 0x89, 0x84, 0x8C, 0xA5, 0x90, 
-    0xA5, 0x90, 0x86, 0x88, 0xA5, 0x90, 0x64, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x65, 
-    0x88, 0x85, 0x88, 0x42, 0x84, 0x02, 0x80, 0x02, 0x80, 0x43, 0x84, 0x45, 0x88, 0x02, 0x80, 
-    0x45, 0x88, 0xC8, 0x8C, 0x84, 0x8C, 0x65, 0x88, 0x84, 0x8C, 0x65, 0x88, 0x65, 0x88, 0x84, 
-    0x8C, 0x64, 0x88, 0x25, 0x80, 0x02, 0x80, 0x01, 0x80, 0xC8, 0x90, 0xC8, 0x90, 0xC6, 0x94, 
-    0xC9, 0x94, 0xA5, 0x90, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0xC6, 
-    0x94, 0xC9, 0x94, 0xA5, 0x90, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x90, 
-    0x08, 0x99, 0x27, 0x8D, 0x69, 0x91, 0x27, 0x8D, 0x63, 0x88, 0x02, 0x80, 0x24, 0x80, 0x84, 
-    0x90, 0x29, 0x9D, 0x69, 0x91, 0x06, 0x89, 0x08, 0x99, 0x08, 0x99, 0xC9, 0x94, 0x08, 0x99, 
-    0x08, 0x99, 0x29, 0x9D, 0xC6, 0x94, 0x84, 0x90, 0xE7, 0x9C, 0xA5, 0x90, 0xC8, 0x90, 0x08, 
-    0x99, 0x84, 0x90, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x94, 0x84, 0x90, 0x08, 0x99, 0xC7, 0x98, 
-    0x84, 0x90, 0xA5, 0x90, 0x85, 0x88, 0xA4, 0x80, 0x64, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0x84, 
-    0x90, 0x63, 0x88, 0x85, 0x88, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x88, 0x84, 0x90, 0x84, 0x8C, 
-    0x0A, 0x99, 0xC9, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0x0B, 0x99, 0xA5, 0x94, 0x63, 0x8C, 0x63, 
-    0x8C, 0x84, 0x8C, 0x84, 0x90, 0xC7, 0x98, 0x08, 0x99, 0x84, 0x90, 0xA6, 0x94, 0x29, 0x9D, 
-    0xA5, 0x90, 0x84, 0x90, 0xC7, 0x98, 0x29, 0x9D, 0xC6, 0x94, 0xC6, 0x94, 0x29, 0x9D, 0x08, 
-    0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x6B, 0xA1, 0x29, 0x9D, 
-    0x6B, 0xA1, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0xC9, 0x94, 0xA7, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC8, 0x8C, 0xA7, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC8, 0x8C, 
-    0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 
-    0x94, 0xC6, 0x94, 0xEA, 0x94, 0x08, 0x99, 0xA5, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 
-    0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC8, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0x08, 
-    0x99, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 
-    0x08, 0x99, 0xA5, 0x94, 0xA5, 0x94, 0x00, 0x80, 0x00, 0x80, 0x08, 0x99, 0xA5, 0x94, 0x63, 
-    0x8C, 0x84, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0x63, 0x8C, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x94, 
-    0xC6, 0x94, 0x00, 0x80, 0x00, 0x80, 0x63, 0x8C, 0x84, 0x90, 0xA5, 0x94, 0x00, 0x80, 0x00, 
-    0x80, 0x63, 0x88, 0x23, 0x84, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x06, 0x89, 0x06, 0x89, 
-    0xA4, 0x80, 0x22, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xC6, 0x94, 0x06, 0x89, 0xA5, 0x90, 
-    0xA7, 0x88, 0x84, 0x90, 0x84, 0x90, 0xA5, 0x90, 0x86, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x86, 
-    0x8C, 0x84, 0x90, 0x64, 0x88, 0x64, 0x88, 0x23, 0x80, 0x23, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x23, 0x80, 0xC8, 0x8C, 0xC6, 0x94, 0x64, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x86, 0x88, 0x84, 
-    0x8C, 0x86, 0x88, 0x64, 0x88, 0x02, 0x80, 0x24, 0x80, 0x01, 0x80, 0xC9, 0x94, 0xC6, 0x94, 
-    0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0xC9, 0x94, 0xC8, 0x8C, 0xC6, 
-    0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0xC9, 0x94, 0xC8, 0x8C, 
-    0x08, 0x99, 0x08, 0x99, 0xC9, 0x94, 0x27, 0x8D, 0x8A, 0x99, 0xEB, 0x99, 0xCC, 0xA1, 0xCC, 
-    0xA1, 0x0E, 0xA6, 0x8A, 0x99, 0x06, 0x89, 0xEA, 0x94, 0x29, 0x9D, 0xC9, 0x94, 0xA5, 0x90, 
-    0xC9, 0x94, 0x08, 0x99, 0x6B, 0xA1, 0xC6, 0x94, 0xA5, 0x90, 0x84, 0x90, 0x63, 0x88, 0x64, 
-    0x88, 0x6B, 0xA1, 0x6B, 0xA1, 0x84, 0x90, 0x63, 0x88, 0x84, 0x8C, 0xE7, 0x9C, 0xEA, 0x94, 
-    0x6B, 0xA1, 0xC6, 0x94, 0x84, 0x8C, 0x63, 0x8C, 0xA5, 0x94, 0x29, 0x9D, 0xA5, 0x90, 0xA5, 
-    0x90, 0x29, 0x9D, 0x6B, 0xA1, 0x29, 0x9D, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xA7, 0x90, 
-    0x84, 0x90, 0x0A, 0x99, 0xC9, 0x94, 0xA5, 0x94, 0xA5, 0x90, 0x0A, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0x63, 0x8C, 0x63, 0x8C, 0xA6, 0x94, 0x29, 0x9D, 0x29, 0x9D, 0x85, 0x88, 0xA6, 0x94, 
-    0xC8, 0x8C, 0x29, 0x9D, 0xA5, 0x94, 0xC7, 0x98, 0x29, 0x9D, 0xC6, 0x94, 0xC6, 0x94, 0x08, 
-    0x99, 0xEA, 0x94, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0xEA, 0x94, 0x09, 0xA5, 0x29, 0x9D, 
-    0x6B, 0xA1, 0x29, 0x9D, 0x6B, 0xA1, 0x6B, 0xA1, 0x29, 0x9D, 0x29, 0x9D, 0x6B, 0xA1, 0xA7, 
-    0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 
-    0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 
-    0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 0x90, 
-    0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 
-    0x90, 0xC8, 0x8C, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0xA5, 0x90, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x27, 0x8D, 0xC6, 0x94, 0x08, 
-    0x99, 0xE7, 0x9C, 0xE7, 0x9C, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0x27, 0x8D, 0xE7, 0x9C, 
-    0x08, 0x99, 0xC6, 0x94, 0x27, 0x8D, 0xE7, 0x9C, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xE7, 
-    0x9C, 0xE7, 0x9C, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xC8, 0x8C, 0xC6, 0x94, 0xA5, 0x90, 
-    0x08, 0x99, 0x06, 0x89, 0xE5, 0x84, 0xA4, 0x80, 0x23, 0x84, 0x02, 0x80, 0x23, 0x84, 0x02, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xC6, 0x94, 0x06, 0x89, 
-    0x84, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0x63, 0x8C, 0xA7, 0x88, 0xA5, 0x94, 0xA5, 0x90, 0x43, 
-    0x84, 0x64, 0x88, 0x86, 0x88, 0x84, 0x8C, 0x65, 0x88, 0xA5, 0x90, 0xA5, 0x94, 0xC6, 0x94, 
-    0xA7, 0x90, 0xC8, 0x8C, 0x08, 0x99, 0xA5, 0x90, 0x43, 0x84, 0x86, 0x88, 0x84, 0x8C, 0x65, 
-    0x88, 0x84, 0x8C, 0x85, 0x88, 0x64, 0x88, 0x25, 0x80, 0x02, 0x80, 0x01, 0x80, 0xC9, 0x94, 
-    0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xC9, 0x94, 0x08, 0x99, 0x08, 
-    0x99, 0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xC9, 0x94, 0x08, 0x99, 
-    0x08, 0x99, 0xC8, 0x90, 0xC8, 0x90, 0x08, 0x99, 0xC9, 0x94, 0x08, 0x99, 0x69, 0x91, 0x8A, 
-    0x99, 0x8A, 0x99, 0x69, 0x91, 0x08, 0x99, 0xEA, 0x94, 0x29, 0x9D, 0xC9, 0x94, 0xC6, 0x94, 
-    0xA7, 0x90, 0xC8, 0x90, 0x08, 0x99, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0xAD, 0xA5, 0x6B, 
-    0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x29, 0x9D, 0x6B, 0xA1, 0x8A, 0x99, 0x6B, 0xA1, 0x29, 0x9D, 
-    0xC9, 0x94, 0x08, 0x99, 0x6B, 0xA1, 0x8A, 0x99, 0x8A, 0x99, 0x6B, 0xA1, 0x08, 0x99, 0x29, 
-    0x9D, 0x6B, 0xA1, 0x29, 0x9D, 0xEA, 0x94, 0xE8, 0xA0, 0x6B, 0xA1, 0x29, 0x9D, 0x29, 0x9D, 
-    0x69, 0x91, 0x29, 0x9D, 0x29, 0x9D, 0xA7, 0x90, 0x29, 0x9D, 0x29, 0x9D, 0x0B, 0x99, 0xC6, 
-    0x94, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x0A, 0x99, 0x29, 0x9D, 
-    0x29, 0x9D, 0xA7, 0x90, 0xC8, 0x8C, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0xA5, 0x90, 0xC6, 
-    0x94, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0xEA, 0x94, 0x09, 0xA5, 0x29, 0x9D, 0x29, 0x9D, 
-    0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x29, 0x9D, 0x6B, 
-    0xA1, 0x29, 0x9D, 0xA7, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 
-    0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 
-    0x90, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 
-    0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 
-    0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC8, 0x8C, 0xA5, 
-    0x90, 0xC6, 0x94, 0xC8, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 
-    0x84, 0x90, 0xC8, 0x8C, 0x08, 0x99, 0x69, 0x91, 0x8A, 0x99, 0xAB, 0x9D, 0x8A, 0x99, 0x69, 
-    0x91, 0x27, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 0x06, 0x89, 0x06, 0x89, 0xC6, 0x94, 0xC8, 0x8C, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC8, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 
-    0x90, 0xA5, 0x90, 0xC8, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xC8, 0x8C, 0xA7, 0x88, 0xA7, 0x88, 
-    0xC8, 0x8C, 0xA5, 0x90, 0xC8, 0x8C, 0xC8, 0x8C, 0xA5, 0x90, 0xC8, 0x8C, 0xA5, 0x90, 0xC8, 
-    0x8C, 0xA5, 0x90, 0xC8, 0x8C, 0xC8, 0x8C, 0x06, 0x89, 0xC8, 0x8C, 0xC6, 0x94, 0xA7, 0x88, 
-    0xA5, 0x90, 0xC8, 0x8C, 0x86, 0x88, 0x06, 0x89, 0x06, 0x89, 0x27, 0x8D, 0x27, 0x8D, 0x06, 
-    0x89, 0xC6, 0x94, 0x06, 0x89, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0xA5, 0x94, 0x84, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x90, 0xA7, 
-    0x88, 0xA5, 0x90, 0x64, 0x88, 0x84, 0x8C, 0x65, 0x88, 0x84, 0x8C, 0x86, 0x88, 0xA5, 0x90, 
-    0x08, 0x99, 0xC6, 0x94, 0xA5, 0x90, 0x65, 0x88, 0x65, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x86, 
-    0x88, 0x63, 0x8C, 0x65, 0x88, 0x65, 0x88, 0x65, 0x88, 0x23, 0x84, 0x02, 0x80, 0x01, 0x80, 
-    0xA5, 0x90, 0xC8, 0x90, 0xC8, 0x90, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xC9, 0x94, 0xC6, 
-    0x94, 0xEA, 0x94, 0xC8, 0x90, 0xC8, 0x90, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xC9, 0x94, 
-    0xC6, 0x94, 0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xEA, 0x94, 0xC9, 
-    0x94, 0xC9, 0x94, 0xEA, 0x94, 0x29, 0x9D, 0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 
-    0xA7, 0x90, 0xA7, 0x90, 0xC9, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xEA, 
-    0x94, 0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0xE9, 0x8C, 
-    0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xE9, 0x8C, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0xC9, 
-    0x94, 0x08, 0x99, 0x2C, 0x91, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC9, 0x94, 
-    0xC8, 0x8C, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC9, 0x94, 0xC8, 0x90, 0xC8, 0x90, 0xC8, 
-    0x90, 0xEA, 0x94, 0xC9, 0x94, 0xEA, 0x94, 0xC8, 0x90, 0xC8, 0x90, 0xC8, 0x90, 0xC8, 0x90, 
-    0xC6, 0x94, 0xC9, 0x94, 0xA7, 0x90, 0xC8, 0x8C, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0x08, 0x99, 0x08, 0x99, 0xEA, 0x94, 0x09, 0xA5, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x29, 0x9D, 0x6B, 0xA1, 0x29, 
-    0x9D, 0x6B, 0xA1, 0x29, 0x9D, 0xC8, 0x90, 0xC8, 0x90, 0xC8, 0x90, 0xC8, 0x90, 0xC8, 0x90, 
-    0xC8, 0x90, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 
-    0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC9, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 
-    0xC9, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0x08, 0x99, 
-    0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0x06, 0x89, 0x08, 
-    0x99, 0x27, 0x8D, 0x27, 0x8D, 0x06, 0x89, 0x06, 0x89, 0xC8, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xC8, 0x8C, 0xA5, 0x90, 0xC8, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 
-    0x86, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 
-    0x88, 0x86, 0x88, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 
-    0xA7, 0x88, 0x86, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0x86, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 
-    0x88, 0xA5, 0x90, 0x63, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0x65, 0x88, 0xA7, 0x88, 0x84, 0x8C, 
-    0x66, 0x8C, 0x84, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 0x86, 0x88, 0xA5, 
-    0x90, 0x84, 0x90, 0xA5, 0x90, 0x85, 0x88, 0x64, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x85, 0x88, 
-    0x85, 0x88, 0x84, 0x90, 0x64, 0x88, 0x65, 0x88, 0x84, 0x8C, 0x65, 0x88, 0x84, 0x8C, 0x86, 
-    0x88, 0x84, 0x8C, 0x65, 0x88, 0x84, 0x8C, 0x65, 0x88, 0x65, 0x88, 0x25, 0x80, 0x02, 0x80, 
-    0x01, 0x80, 0xEA, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 
-    0x94, 0xA7, 0x90, 0xC8, 0x90, 0x08, 0x99, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 
-    0xC6, 0x94, 0xA7, 0x90, 0xC8, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA8, 0x88, 0xA8, 0x88, 0xA7, 
-    0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0x86, 0x8C, 0xA8, 0x88, 0x86, 0x88, 
-    0xA8, 0x88, 0xA8, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 
-    0x88, 0x86, 0x8C, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0xA8, 0x88, 0xA8, 0x88, 0xA7, 0x88, 
-    0xA8, 0x88, 0x86, 0x88, 0xC8, 0x8C, 0x86, 0x88, 0x85, 0x88, 0xA8, 0x88, 0x86, 0x8C, 0xA7, 
-    0x90, 0x87, 0x84, 0xA7, 0x88, 0xA7, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 
-    0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x48, 0x84, 0x86, 0x8C, 0x86, 0x88, 0x86, 
-    0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x8C, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 
-    0x86, 0x88, 0x86, 0x88, 0x46, 0x84, 0x86, 0x8C, 0xA8, 0x88, 0xA7, 0x88, 0xA8, 0x88, 0xA8, 
-    0x88, 0xA7, 0x88, 0xC8, 0x8C, 0xA7, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x88, 
-    0x67, 0x8C, 0xC8, 0x90, 0xA8, 0x88, 0xA8, 0x88, 0xC8, 0x8C, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 
-    0x88, 0xE9, 0x8C, 0xA7, 0x88, 0xA7, 0x88, 0xC8, 0x8C, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 
-    0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x64, 0x88, 0x86, 0x88, 0x86, 0x88, 0x48, 
-    0x84, 0x65, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 
-    0x86, 0x88, 0xA7, 0x88, 0x86, 0x88, 0xA7, 0x88, 0x86, 0x88, 0xA7, 0x88, 0x86, 0x88, 0x86, 
-    0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 
-    0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 
-    0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 
-    0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x44, 0x80, 0x86, 
-    0x88, 0x86, 0x88, 0x86, 0x88, 0x65, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0xA7, 0x88, 
-    0xA5, 0x90, 0xA7, 0x88, 0x86, 0x88, 0x86, 0x88, 0x85, 0x88, 0x86, 0x88, 0xA7, 0x88, 0x86, 
-    0x88, 0x65, 0x88, 0xA7, 0x88, 0x86, 0x88, 0x64, 0x88, 0x86, 0x88, 0x86, 0x88, 0x44, 0x84, 
-    0x86, 0x88, 0x86, 0x88, 0x64, 0x84, 0x86, 0x88, 0x64, 0x84, 0x86, 0x88, 0x64, 0x84, 0x86, 
-    0x88, 0x64, 0x84, 0x64, 0x84, 0x86, 0x88, 0x86, 0x88, 0x44, 0x84, 0x86, 0x88, 0x86, 0x88, 
-    0x86, 0x88, 0x25, 0x80, 0x86, 0x88, 0x46, 0x84, 0x64, 0x88, 0x86, 0x88, 0x25, 0x80, 0x86, 
-    0x88, 0x44, 0x84, 0x86, 0x88, 0x25, 0x80, 0x86, 0x88, 0x64, 0x84, 0x86, 0x88, 0x25, 0x80, 
-    0x86, 0x88, 0x86, 0x88, 0x25, 0x80, 0x85, 0x88, 0x46, 0x84, 0x44, 0x84, 0x86, 0x88, 0x86, 
-    0x88, 0x85, 0x88, 0x64, 0x88, 0x86, 0x88, 0x64, 0x88, 0x64, 0x88, 0x86, 0x88, 0x44, 0x84, 
-    0x86, 0x88, 0x25, 0x80, 0x65, 0x88, 0x86, 0x88, 0x44, 0x84, 0x44, 0x84, 0x86, 0x88, 0x44, 
-    0x84, 0x85, 0x88, 0x85, 0x88, 0x65, 0x88, 0x65, 0x88, 0x85, 0x88, 0x64, 0x88, 0x25, 0x80, 
-    0xA5, 0x90, 0x64, 0x88, 0x86, 0x88, 0x64, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x64, 0x88, 0x65, 
-    0x88, 0x65, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x44, 0x80, 
-    0x02, 0x80, 0x01, 0x80, 0x29, 0x9D, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC8, 
-    0x90, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x85, 0x88, 0x25, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x05, 0x80, 0x24, 0x80, 0x25, 0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x25, 0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x25, 0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 0x80, 0x25, 0x80, 0x05, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x05, 0x80, 0x02, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 
-    0x80, 0x24, 0x80, 0x25, 0x80, 0x05, 0x80, 0x24, 0x80, 0x25, 0x80, 0x05, 0x80, 0x24, 0x80, 
-    0x25, 0x80, 0x05, 0x80, 0x24, 0x80, 0x25, 0x80, 0x05, 0x80, 0x24, 0x80, 0x24, 0x80, 0x05, 
-    0x80, 0x24, 0x80, 0x25, 0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 0x80, 0x24, 0x80, 0x25, 0x80, 
-    0x24, 0x80, 0x05, 0x80, 0x24, 0x80, 0x25, 0x80, 0x25, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x05, 0x80, 0xA7, 0x90, 0x25, 0x80, 0x05, 0x80, 0x24, 0x80, 0x25, 0x80, 0x05, 0x80, 
-    0x24, 0x80, 0x25, 0x80, 0x25, 0x80, 0x24, 0x80, 0x25, 0x80, 0x05, 0x80, 0x24, 0x80, 0x25, 
-    0x80, 0x25, 0x80, 0x05, 0x80, 0x24, 0x80, 0x25, 0x80, 0x23, 0x80, 0x24, 0x80, 0x05, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x25, 0x80, 0x24, 0x80, 0x24, 0x80, 0x25, 0x80, 0x05, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x05, 0x80, 0x24, 0x80, 0x24, 0x80, 0x25, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x25, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x05, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0xA5, 0x90, 0xC8, 0x90, 0x84, 0x8C, 0x84, 0x8C, 0x65, 0x88, 0x84, 0x8C, 0x65, 0x88, 0x84, 
-    0x8C, 0x86, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 
-    0x23, 0x84, 0x02, 0x80, 0x01, 0x80, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 
-    0x9D, 0x29, 0x9D, 0xEA, 0x94, 0x08, 0x99, 0x86, 0x88, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 
-    0x29, 0x9D, 0x29, 0x9D, 0xEA, 0x94, 0x08, 0x99, 0x86, 0x88, 0x02, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 
-    0x02, 0x80, 0xA5, 0x90, 0xA7, 0x90, 0x65, 0x88, 0x86, 0x88, 0x85, 0x88, 0x85, 0x88, 0x84, 
-    0x8C, 0x86, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 
-    0x64, 0x88, 0x25, 0x80, 0x02, 0x80, 0x01, 0x80, 0xA5, 0x90, 0x08, 0x99, 0x08, 0x99, 0xC8, 
-    0x90, 0xC6, 0x94, 0xA7, 0x90, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0x9D, 0xEA, 0x94, 0x29, 0x9D, 0x08, 0x99, 0xA7, 0x88, 0x02, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xA7, 0x90, 0x63, 0x8C, 0x65, 0x88, 0x64, 0x88, 0x84, 
-    0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x63, 0x8C, 0x65, 0x88, 0x84, 0x8C, 
-    0x85, 0x88, 0x45, 0x88, 0x64, 0x88, 0x02, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xA7, 0x90, 0x08, 
-    0x99, 0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0xEA, 0x94, 
-    0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0x85, 0x88, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xA7, 0x90, 0x65, 0x88, 0x43, 0x84, 0x65, 
-    0x88, 0x84, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x65, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x64, 0x88, 
-    0x84, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x44, 0x84, 0x02, 0x80, 0x01, 0x80, 0xA5, 0x90, 0x08, 
-    0x99, 0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0xC6, 0x94, 0x29, 0x9D, 0xEA, 0x94, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x64, 0x88, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xA7, 0x90, 0x64, 0x88, 0x65, 
-    0x88, 0x63, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0xA7, 0x88, 0x65, 0x88, 0x84, 0x8C, 
-    0x65, 0x88, 0x65, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x25, 0x80, 0x02, 0x80, 0x01, 0x80, 0xA5, 
-    0x90, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 
-    0xC8, 0x90, 0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC8, 0x90, 0x84, 
-    0x90, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xA7, 0x90, 0x84, 
-    0x8C, 0x43, 0x84, 0x65, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0x63, 0x8C, 0x65, 0x88, 0x84, 0x8C, 
-    0x84, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x64, 0x88, 0x02, 0x80, 0x24, 0x80, 0x01, 
-    0x80, 0xA5, 0x90, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 
-    0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC9, 0x94, 0xC8, 
-    0x90, 0x84, 0x90, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xA7, 
-    0x90, 0x84, 0x8C, 0x64, 0x88, 0x65, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0x43, 0x84, 0x84, 0x8C, 
-    0x86, 0x88, 0x84, 0x8C, 0x65, 0x88, 0x84, 0x8C, 0x85, 0x88, 0x64, 0x88, 0x25, 0x80, 0x02, 
-    0x80, 0x01, 0x80, 0xA5, 0x90, 0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 
-    0xC8, 0x90, 0xEA, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC9, 
-    0x94, 0xC6, 0x94, 0xA7, 0x90, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 
-    0x90, 0xA7, 0x88, 0x84, 0x8C, 0x65, 0x88, 0x86, 0x8C, 0x43, 0x84, 0x84, 0x90, 0xA7, 0x88, 
-    0x43, 0x84, 0x84, 0x8C, 0x86, 0x88, 0x63, 0x8C, 0x65, 0x88, 0x65, 0x88, 0x65, 0x88, 0x23, 
-    0x84, 0x02, 0x80, 0x01, 0x80, 0xA5, 0x90, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xC8, 0x90, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xA7, 0x90, 0x08, 0x99, 0xC8, 0x90, 0xEA, 0x94, 0x08, 
-    0x99, 0x08, 0x99, 0xC9, 0x94, 0x08, 0x99, 0x65, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0xA7, 0x88, 0xA7, 0x90, 0x64, 0x88, 0x64, 0x88, 0x84, 0x8C, 0x65, 0x88, 0xA7, 0x88, 
-    0x45, 0x88, 0x84, 0x90, 0x86, 0x88, 0x84, 0x8C, 0x65, 0x88, 0x84, 0x8C, 0x65, 0x88, 0x65, 
-    0x88, 0x25, 0x80, 0x02, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xC8, 0x90, 0x08, 0x99, 0xC8, 0x90, 
-    0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xC8, 0x90, 0xC6, 0x94, 0xEA, 0x94, 0x08, 0x99, 0x08, 
-    0x99, 0x29, 0x9D, 0x29, 0x9D, 0xC8, 0x90, 0x29, 0x9D, 0x69, 0x91, 0x86, 0x8C, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x21, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 
-    0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x02, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x21, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0xA5, 0x90, 0xA5, 0x94, 0x63, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0x86, 0x88, 
-    0x65, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x65, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x85, 0x88, 0x63, 
-    0x8C, 0x64, 0x88, 0x44, 0x80, 0x02, 0x80, 0x01, 0x80, 0xA5, 0x90, 0x08, 0x99, 0xC8, 0x90, 
-    0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xC8, 0x90, 0xC6, 0x94, 0xEA, 0x94, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xC9, 0x94, 0x27, 0x8D, 0x8A, 0x99, 
-    0x69, 0x91, 0x6B, 0xA1, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 
-    0xA1, 0x6B, 0xA1, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0xEA, 0x94, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0xEA, 0x94, 0x29, 0x9D, 0x6B, 0xA1, 0x29, 0x9D, 
-    0x29, 0x9D, 0x6B, 0xA1, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x6B, 
-    0xA1, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0xEA, 0x94, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 
-    0xEA, 0x94, 0xEA, 0x94, 0x08, 0x99, 0xC9, 0x94, 0x29, 0x9D, 0x29, 0x9D, 0x8C, 0xA1, 0x6B, 
-    0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 
-    0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x6B, 0xA1, 0x6B, 0xA1, 0x8C, 
-    0xA1, 0x8C, 0xA1, 0x8C, 0xA1, 0xAD, 0xA5, 0x8C, 0xA1, 0xAD, 0xA5, 0x8C, 0xA1, 0x8C, 0xA1, 
-    0x69, 0x91, 0x27, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 0x0B, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 0x69, 
-    0x91, 0x27, 0x8D, 0x27, 0x8D, 0x69, 0x91, 0x69, 0x91, 0x06, 0x89, 0x69, 0x91, 0x69, 0x91, 
-    0x27, 0x8D, 0x69, 0x91, 0x69, 0x91, 0x27, 0x8D, 0x69, 0x91, 0x27, 0x8D, 0x69, 0x91, 0x69, 
-    0x91, 0x27, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 
-    0xE9, 0x8C, 0x27, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 0xE9, 0x8C, 0x27, 0x8D, 0x27, 0x8D, 0xE9, 
-    0x8C, 0x27, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 0xC9, 0x94, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0xA7, 0x90, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xA5, 0x90, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC8, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x94, 
-    0xA7, 0x88, 0xA5, 0x90, 0xC8, 0x90, 0x86, 0x8C, 0x67, 0x8C, 0xA5, 0x90, 0xC8, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x94, 0xA7, 0x88, 0xA7, 0x88, 0x84, 0x90, 0xA7, 0x88, 0x63, 0x8C, 0xA7, 
-    0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0x85, 0x88, 0x84, 0x8C, 0x86, 0x88, 
-    0x84, 0x8C, 0x63, 0x8C, 0x64, 0x84, 0x85, 0x88, 0x65, 0x88, 0x65, 0x88, 0x85, 0x88, 0x23, 
-    0x84, 0x25, 0x80, 0x25, 0x80, 0x24, 0x80, 0x02, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xC8, 0x90, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xA7, 0x90, 0x08, 0x99, 0xC6, 
-    0x94, 0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC8, 0x90, 0xC9, 0x94, 
-    0x27, 0x8D, 0x69, 0x91, 0xAB, 0x9D, 0xAB, 0x9D, 0xCC, 0xA1, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 
-    0xA6, 0x2B, 0x9A, 0x0E, 0xA6, 0xEB, 0x99, 0xCC, 0xA1, 0xAB, 0x9D, 0xEB, 0x99, 0xCC, 0xA1, 
-    0xAB, 0x9D, 0xAB, 0x9D, 0xAB, 0x9D, 0xEB, 0x99, 0xAB, 0x9D, 0xAB, 0x9D, 0xEB, 0x99, 0xAB, 
-    0x9D, 0xEB, 0x99, 0x8A, 0x99, 0xEB, 0x99, 0xAB, 0x9D, 0xCC, 0xA1, 0x0E, 0xA6, 0xCC, 0xA1, 
-    0xEB, 0x99, 0xCC, 0xA1, 0xCC, 0xA1, 0xCC, 0xA1, 0xEB, 0x99, 0xCC, 0xA1, 0xCC, 0xA1, 0x0E, 
-    0xA6, 0xCC, 0xA1, 0x0E, 0xA6, 0xEB, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0xAB, 0x9D, 0xAB, 0x9D, 
-    0x8A, 0x99, 0x8A, 0x99, 0x2C, 0x91, 0x8A, 0x99, 0x8A, 0x99, 0x2C, 0x91, 0x0E, 0xA6, 0x0E, 
-    0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 
-    0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0xCC, 0xA1, 0xEB, 0x99, 0xCC, 0xA1, 0xAB, 0x9D, 0xAB, 
-    0x9D, 0xAB, 0x9D, 0xAB, 0x9D, 0xAB, 0x9D, 0xEB, 0x99, 0xAB, 0x9D, 0xCC, 0xA1, 0xCC, 0xA1, 
-    0x0E, 0xA6, 0xEB, 0x99, 0xAB, 0x9D, 0xCC, 0xA1, 0xCC, 0xA1, 0xCC, 0xA1, 0x0E, 0xA6, 0x0E, 
-    0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x2F, 0xAA, 0x8B, 0x96, 0x50, 0xB2, 0x2F, 0xAA, 0x8B, 0x96, 
-    0x2F, 0xAA, 0x0E, 0xA6, 0xCC, 0xA1, 0x8A, 0x99, 0x2C, 0x91, 0xAB, 0x9D, 0xAB, 0x9D, 0x8A, 
-    0x99, 0x2C, 0x91, 0xAB, 0x9D, 0x8A, 0x99, 0x8A, 0x99, 0x2E, 0x89, 0xAB, 0x9D, 0x8A, 0x99, 
-    0x8A, 0x99, 0xEB, 0x99, 0xAB, 0x9D, 0xEB, 0x99, 0xEB, 0x99, 0xAB, 0x9D, 0xAB, 0x9D, 0xEB, 
-    0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0xAB, 0x9D, 0xAB, 0x9D, 0x8A, 0x99, 0x2C, 0x91, 
-    0x8A, 0x99, 0x8A, 0x99, 0x69, 0x91, 0x2C, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x0B, 
-    0x8D, 0x69, 0x91, 0x69, 0x91, 0x2C, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 
-    0x69, 0x91, 0x0B, 0x8D, 0x27, 0x8D, 0x69, 0x91, 0x69, 0x91, 0x8A, 0x99, 0x69, 0x91, 0x8A, 
-    0x99, 0x8A, 0x99, 0x8A, 0x99, 0x69, 0x91, 0x8A, 0x99, 0x69, 0x91, 0x8A, 0x99, 0x27, 0x8D, 
-    0x69, 0x91, 0xAB, 0x9D, 0xEB, 0x99, 0xEB, 0x99, 0x8A, 0x99, 0x69, 0x91, 0x69, 0x91, 0x69, 
-    0x91, 0x69, 0x91, 0x27, 0x8D, 0x69, 0x91, 0x69, 0x91, 0x27, 0x8D, 0x0B, 0x8D, 0x27, 0x8D, 
-    0x69, 0x91, 0x27, 0x8D, 0x27, 0x8D, 0x0B, 0x8D, 0x69, 0x91, 0x27, 0x8D, 0x69, 0x91, 0x27, 
-    0x8D, 0x0B, 0x8D, 0x69, 0x91, 0xE9, 0x8C, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x27, 0x8D, 
-    0x27, 0x8D, 0xC9, 0x94, 0x27, 0x8D, 0xC8, 0x8C, 0xC8, 0x8C, 0x27, 0x8D, 0xC8, 0x8C, 0x69, 
-    0x91, 0xC8, 0x8C, 0x27, 0x8D, 0xC8, 0x8C, 0xE9, 0x8C, 0xC8, 0x8C, 0x27, 0x8D, 0xC8, 0x8C, 
-    0x27, 0x8D, 0xC8, 0x8C, 0x06, 0x89, 0x06, 0x89, 0x27, 0x8D, 0x06, 0x89, 0x27, 0x8D, 0x06, 
-    0x89, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x63, 0x8C, 0x65, 0x88, 
-    0x84, 0x8C, 0x84, 0x8C, 0x86, 0x88, 0x85, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x25, 0x80, 0x25, 
-    0x80, 0x25, 0x80, 0x25, 0x80, 0x05, 0x80, 0x24, 0x80, 0x02, 0x80, 0x01, 0x80, 0xA5, 0x90, 
-    0xC8, 0x90, 0xC6, 0x94, 0xEA, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xA7, 0x90, 0xC6, 0x94, 0x08, 
-    0x99, 0xC8, 0x90, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC8, 0x90, 
-    0xC8, 0x90, 0xC9, 0x94, 0xC9, 0x94, 0xEA, 0x94, 0xC9, 0x94, 0xE9, 0x8C, 0x29, 0x9D, 0xE9, 
-    0x8C, 0x29, 0x9D, 0xEA, 0x94, 0xEA, 0x94, 0xC9, 0x94, 0xC9, 0x94, 0xC9, 0x94, 0xEA, 0x94, 
-    0xC9, 0x94, 0xC9, 0x94, 0xE9, 0x8C, 0xC9, 0x94, 0xEA, 0x94, 0xC9, 0x94, 0x0B, 0x99, 0xC9, 
-    0x94, 0xC9, 0x94, 0xC9, 0x94, 0xE9, 0x8C, 0xC9, 0x94, 0xEA, 0x94, 0x0B, 0x99, 0xC9, 0x94, 
-    0xE9, 0x8C, 0xC8, 0x90, 0xC9, 0x94, 0xE9, 0x8C, 0xC9, 0x94, 0xE9, 0x8C, 0xA7, 0x90, 0xC8, 
-    0x8C, 0xC8, 0x8C, 0xC8, 0x8C, 0xC8, 0x90, 0xC8, 0x8C, 0xA8, 0x88, 0xC8, 0x90, 0xC8, 0x8C, 
-    0xA7, 0x88, 0xA7, 0x88, 0x67, 0x8C, 0xA5, 0x90, 0xA8, 0x88, 0xA7, 0x88, 0xA5, 0x90, 0xC9, 
-    0x94, 0x08, 0x99, 0x08, 0x99, 0xC8, 0x8C, 0x08, 0x99, 0x08, 0x99, 0xC9, 0x94, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC8, 0x90, 0xC8, 0x8C, 0xC9, 0x94, 0xC8, 0x8C, 0xC8, 
-    0x90, 0xC8, 0x8C, 0xC8, 0x8C, 0xA8, 0x88, 0xC8, 0x90, 0xE9, 0x8C, 0xE9, 0x8C, 0xC8, 0x90, 
-    0xC8, 0x8C, 0xC9, 0x94, 0xC8, 0x8C, 0xC9, 0x94, 0xC8, 0x8C, 0xC9, 0x94, 0xC8, 0x8C, 0xC8, 
-    0x8C, 0xC8, 0x8C, 0xC6, 0x94, 0xE9, 0x8C, 0x08, 0x99, 0xEA, 0x94, 0x29, 0x9D, 0x29, 0x9D, 
-    0xEA, 0x94, 0xEA, 0x94, 0x08, 0x99, 0xEA, 0x94, 0xE9, 0x8C, 0xC6, 0x94, 0xA7, 0x90, 0xA8, 
-    0x88, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC8, 0x8C, 0xA8, 0x88, 0xA7, 0x90, 0xA7, 0x90, 
-    0xC8, 0x8C, 0x86, 0x8C, 0xA8, 0x88, 0xC8, 0x90, 0xA8, 0x88, 0xC8, 0x90, 0xA7, 0x90, 0xA7, 
-    0x88, 0xA7, 0x88, 0xA7, 0x90, 0xA8, 0x88, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x88, 
-    0xA5, 0x90, 0xA7, 0x88, 0x86, 0x8C, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 
-    0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0x86, 0x8C, 
-    0x86, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC8, 
-    0x8C, 0xA5, 0x90, 0xC8, 0x8C, 0xC6, 0x94, 0xC8, 0x8C, 0xA5, 0x90, 0xC8, 0x8C, 0xA5, 0x90, 
-    0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x90, 0xC8, 0x90, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 
-    0x90, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 
-    0xA5, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0xA5, 0x94, 0x86, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0x86, 
-    0x8C, 0x86, 0x8C, 0x84, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0x66, 0x8C, 0x86, 0x88, 0xA5, 0x90, 
-    0xA7, 0x90, 0x84, 0x90, 0x86, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x90, 0x85, 0x88, 0xA5, 
-    0x90, 0x63, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0xA5, 0x90, 0x64, 0x88, 
-    0x84, 0x8C, 0x86, 0x88, 0x63, 0x8C, 0xA7, 0x88, 0x66, 0x8C, 0x85, 0x88, 0x64, 0x88, 0x43, 
-    0x84, 0x66, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 
-    0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0x63, 0x8C, 0xA5, 0x90, 0x84, 0x90, 0x65, 0x88, 0x84, 0x8C, 
-    0x86, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0x64, 0x84, 0x25, 0x80, 0x05, 0x80, 0x25, 
-    0x80, 0x25, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 0x80, 0x25, 0x80, 0x01, 0x80, 
-    0xA5, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xC8, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xC8, 
-    0x90, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xC9, 0x94, 0x08, 0x99, 
-    0xEA, 0x94, 0x08, 0x99, 0xC8, 0x90, 0xC6, 0x94, 0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 0x29, 
-    0x9D, 0xEA, 0x94, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0xC9, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xEA, 0x94, 0xC6, 
-    0x94, 0x29, 0x9D, 0xC8, 0x90, 0xA7, 0x90, 0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 0xA7, 0x90, 
-    0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xE9, 0x8C, 0x29, 0x9D, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 
-    0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xC8, 0x8C, 0x86, 0x8C, 0xA5, 0x90, 0xA7, 
-    0x88, 0xC8, 0x90, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 0xC9, 0x94, 0x08, 0x99, 
-    0xC9, 0x94, 0xA5, 0x90, 0xC8, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC8, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xC8, 0x90, 0xC8, 0x90, 0xC6, 0x94, 
-    0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xA7, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 
-    0xA5, 0x94, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC8, 0x90, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA5, 0x90, 0xA7, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 
-    0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0x86, 0x8C, 0x84, 0x90, 0xA7, 0x88, 
-    0x84, 0x90, 0xA7, 0x88, 0xA5, 0x94, 0x86, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0x84, 
-    0x90, 0x86, 0x88, 0x84, 0x8C, 0xA7, 0x90, 0x84, 0x8C, 0x86, 0x88, 0xA5, 0x90, 0x63, 0x8C, 
-    0xA7, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0x84, 0x8C, 0x86, 
-    0x88, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 
-    0xA7, 0x88, 0x84, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x86, 
-    0x88, 0x84, 0x8C, 0x86, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x90, 0x85, 0x88, 0xA5, 0x90, 
-    0x65, 0x88, 0x84, 0x8C, 0x85, 0x88, 0x64, 0x88, 0x05, 0x80, 0x05, 0x80, 0x25, 0x80, 0x25, 
-    0x80, 0x25, 0x80, 0x05, 0x80, 0x24, 0x80, 0x45, 0x88, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 
-    0x01, 0x80, 0xC6, 0x94, 0xA7, 0x88, 0xC6, 0x94, 0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 0xA7, 
-    0x90, 0xC8, 0x90, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xC8, 0x90, 
-    0x08, 0x99, 0x08, 0x99, 0xC8, 0x90, 0xC8, 0x90, 0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 0xEA, 
-    0x94, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0xEA, 0x94, 0x29, 0x9D, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x0A, 0x99, 0xC8, 0x90, 0xA7, 0x90, 0xC9, 0x94, 0x29, 
-    0x9D, 0xC9, 0x94, 0xA5, 0x94, 0xC8, 0x90, 0xA5, 0x90, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 
-    0x08, 0x99, 0xA7, 0x90, 0xA5, 0x94, 0xC8, 0x90, 0x08, 0x99, 0xA5, 0x90, 0xA7, 0x90, 0xEA, 
-    0x94, 0xEA, 0x94, 0xC9, 0x94, 0x85, 0x88, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC8, 
-    0x8C, 0xA5, 0x90, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 
-    0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 
-    0x88, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC8, 0x90, 0xC8, 
-    0x8C, 0x08, 0x99, 0x08, 0x99, 0xA7, 0x88, 0x08, 0x99, 0xA5, 0x90, 0x08, 0x99, 0xA7, 0x90, 
-    0xC7, 0x98, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xA7, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0x86, 0x8C, 0xA5, 0x94, 0xA7, 0x88, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 
-    0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 
-    0x86, 0x8C, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0x86, 0x8C, 
-    0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA5, 0x90, 0xC8, 0x90, 0xA5, 0x90, 0xC6, 
-    0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 
-    0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0x84, 0x90, 0xA7, 0x90, 0x08, 0x99, 0xC6, 
-    0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0xA7, 0x88, 
-    0x84, 0x90, 0xA7, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0x86, 
-    0x8C, 0xA7, 0x88, 0x84, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0x86, 0x8C, 
-    0xA7, 0x88, 0x84, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0x86, 0x88, 0x63, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x88, 
-    0x84, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 
-    0x88, 0x85, 0x88, 0x85, 0x88, 0x64, 0x88, 0x84, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 
-    0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0x85, 0x88, 0x64, 0x88, 0x46, 0x84, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 
-    0x80, 0x24, 0x80, 0x25, 0x80, 0x02, 0x80, 0x45, 0x88, 0x45, 0x88, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x01, 0x80, 0xC6, 0x94, 0xA5, 0x90, 0xC8, 0x90, 0x08, 0x99, 0xC8, 0x90, 0xC6, 
-    0x94, 0xA7, 0x90, 0x08, 0x99, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 
-    0xC8, 0x90, 0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC8, 0x90, 0xC6, 0x94, 0xEA, 
-    0x94, 0x08, 0x99, 0x29, 0x9D, 0xEA, 0x94, 0x08, 0x99, 0x09, 0xA5, 0x29, 0x9D, 0x08, 0x99, 
-    0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x43, 
-    0x84, 0xC8, 0x90, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x00, 0x80, 0xA5, 0x90, 0x29, 0x9D, 
-    0x63, 0x8C, 0x63, 0x8C, 0x08, 0x99, 0x64, 0x84, 0x63, 0x88, 0x86, 0x88, 0xC6, 0x94, 0x63, 
-    0x88, 0x64, 0x84, 0xEA, 0x94, 0xA5, 0x90, 0x21, 0x80, 0x42, 0x84, 0x42, 0x88, 0x85, 0x88, 
-    0xA7, 0x90, 0x42, 0x84, 0x42, 0x84, 0x42, 0x88, 0x42, 0x88, 0xC6, 0x94, 0x63, 0x8C, 0x02, 
-    0x80, 0xA5, 0x90, 0xC6, 0x94, 0x22, 0x84, 0x23, 0x84, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0xA5, 0x90, 0x63, 0x8C, 0x63, 0x8C, 0x65, 0x88, 0xA7, 0x90, 0xA5, 
-    0x90, 0x85, 0x88, 0x63, 0x8C, 0x42, 0x84, 0x42, 0x84, 0x85, 0x88, 0xA7, 0x90, 0xC6, 0x94, 
-    0xC7, 0x98, 0x42, 0x84, 0x42, 0x84, 0x08, 0x99, 0x63, 0x8C, 0x42, 0x84, 0x42, 0x84, 0x42, 
-    0x84, 0x42, 0x84, 0xA7, 0x90, 0x84, 0x90, 0x42, 0x84, 0x42, 0x84, 0x42, 0x84, 0xA5, 0x90, 
-    0xA5, 0x90, 0x42, 0x84, 0x42, 0x84, 0x42, 0x84, 0x42, 0x84, 0x42, 0x84, 0x84, 0x8C, 0x42, 
-    0x84, 0xA5, 0x90, 0x84, 0x8C, 0x42, 0x84, 0x08, 0x99, 0x84, 0x8C, 0x42, 0x84, 0x84, 0x8C, 
-    0x85, 0x88, 0x42, 0x84, 0x42, 0x84, 0x63, 0x88, 0x63, 0x88, 0x08, 0x99, 0xA5, 0x90, 0xA7, 
-    0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0xA7, 0x90, 0xA7, 
-    0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 
-    0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 
-    0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xA5, 0x90, 0xC6, 0x94, 
-    0xA5, 0x90, 0x86, 0x8C, 0x84, 0x90, 0xA7, 0x88, 0x84, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0x84, 
-    0x8C, 0xA7, 0x88, 0x84, 0x90, 0xA7, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0x64, 0x88, 0x86, 0x8C, 
-    0x84, 0x8C, 0x86, 0x88, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x63, 
-    0x8C, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x85, 0x88, 
-    0x85, 0x88, 0x46, 0x84, 0x05, 0x80, 0x02, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x23, 0x80, 0x66, 0x8C, 0x23, 0x80, 0x44, 0x84, 0x84, 0x90, 0x24, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x01, 0x80, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC8, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 0x90, 
-    0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x63, 0x8C, 0x84, 0x90, 0x84, 
-    0x90, 0x42, 0x88, 0x21, 0x84, 0x42, 0x88, 0x00, 0x80, 0xA6, 0x94, 0x00, 0x80, 0x00, 0x80, 
-    0x08, 0x99, 0x63, 0x8C, 0x00, 0x80, 0x29, 0x9D, 0x00, 0x80, 0x00, 0x80, 0x84, 0x8C, 0xC6, 
-    0x94, 0x21, 0x84, 0x21, 0x84, 0x08, 0x99, 0x64, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x64, 0x88, 0xA7, 0x90, 0x42, 0x84, 0x84, 0x90, 0xE7, 0x9C, 0x84, 0x90, 0x63, 0x8C, 0xC6, 
-    0x94, 0x84, 0x8C, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0xA5, 0x94, 0x08, 0x99, 0xA5, 0x90, 
-    0xA7, 0x88, 0x08, 0x99, 0xA5, 0x90, 0x64, 0x88, 0x42, 0x88, 0x23, 0x84, 0x23, 0x84, 0x63, 
-    0x8C, 0xA7, 0x90, 0x84, 0x8C, 0x63, 0x8C, 0x85, 0x88, 0x63, 0x8C, 0x43, 0x84, 0xA5, 0x90, 
-    0xC8, 0x90, 0xC7, 0x98, 0x65, 0x88, 0x64, 0x88, 0x08, 0x99, 0x63, 0x8C, 0x21, 0x84, 0x63, 
-    0x8C, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x8C, 0x42, 0x84, 0x63, 0x88, 0xA5, 0x90, 0x63, 0x88, 
-    0x65, 0x88, 0xA7, 0x90, 0xA5, 0x94, 0xA5, 0x94, 0x21, 0x84, 0x63, 0x8C, 0x08, 0x99, 0x84, 
-    0x8C, 0x64, 0x88, 0xA5, 0x90, 0x84, 0x8C, 0x63, 0x8C, 0xC6, 0x94, 0xA5, 0x90, 0x42, 0x84, 
-    0x84, 0x90, 0x85, 0x88, 0x42, 0x84, 0xA5, 0x90, 0x84, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xA7, 
-    0x90, 0xC6, 0x94, 0xC8, 0x8C, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 
-    0xC8, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x94, 0xA7, 0x88, 0xA7, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xC8, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0x86, 0x88, 
-    0xA5, 0x90, 0xA7, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 
-    0x90, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC8, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0x86, 0x8C, 0x85, 0x88, 
-    0x86, 0x8C, 0x85, 0x88, 0xA5, 0x94, 0x85, 0x88, 0x86, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x66, 
-    0x8C, 0x65, 0x88, 0x84, 0x8C, 0x66, 0x8C, 0x84, 0x8C, 0x64, 0x88, 0x86, 0x88, 0x84, 0x90, 
-    0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0x85, 0x88, 0x46, 0x84, 
-    0x23, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x24, 0x80, 0x05, 
-    0x80, 0x65, 0x88, 0x64, 0x88, 0x23, 0x80, 0xA5, 0x94, 0x23, 0x80, 0x66, 0x8C, 0xA5, 0x94, 
-    0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 
-    0x90, 0xC6, 0x94, 0xA7, 0x90, 0x08, 0x99, 0x08, 0x99, 0xA7, 0x90, 0x06, 0x89, 0xA7, 0x90, 
-    0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 0x90, 0x06, 0x89, 0xC8, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 
-    0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x84, 0x8C, 0xA5, 
-    0x90, 0x08, 0x99, 0x84, 0x90, 0x63, 0x88, 0x84, 0x8C, 0x84, 0x90, 0xC7, 0x98, 0x63, 0x8C, 
-    0x63, 0x8C, 0x08, 0x99, 0xA5, 0x94, 0x63, 0x8C, 0x08, 0x99, 0x42, 0x88, 0x42, 0x88, 0x21, 
-    0x84, 0x63, 0x8C, 0x21, 0x84, 0x63, 0x88, 0xC6, 0x94, 0x22, 0x84, 0x22, 0x84, 0xC9, 0x94, 
-    0x22, 0x84, 0x84, 0x8C, 0xC7, 0x98, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x90, 0x84, 0x8C, 0x84, 
-    0x90, 0x08, 0x99, 0xC6, 0x94, 0x84, 0x90, 0x63, 0x8C, 0x84, 0x90, 0x08, 0x99, 0x86, 0x8C, 
-    0xA7, 0x90, 0x86, 0x88, 0xC6, 0x94, 0x85, 0x88, 0x84, 0x90, 0xC6, 0x94, 0x29, 0x9D, 0xC6, 
-    0x94, 0x84, 0x8C, 0xC6, 0x94, 0xA5, 0x90, 0x84, 0x90, 0x08, 0x99, 0xA5, 0x94, 0xA5, 0x90, 
-    0xC9, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0x86, 0x8C, 0xA5, 0x90, 0xC7, 0x98, 0x63, 0x8C, 0x84, 
-    0x90, 0xA6, 0x94, 0xE7, 0x9C, 0xC9, 0x94, 0xA5, 0x94, 0x42, 0x84, 0x08, 0x99, 0xC6, 0x94, 
-    0x08, 0x99, 0x29, 0x9D, 0xC9, 0x94, 0x08, 0x99, 0x08, 0x99, 0x63, 0x8C, 0x63, 0x8C, 0x08, 
-    0x99, 0xA6, 0x94, 0x84, 0x90, 0xA7, 0x90, 0xC7, 0x98, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0x84, 0x90, 0x08, 0x99, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x94, 0xA7, 0x90, 0xC7, 0x98, 0xC7, 
-    0x98, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x94, 
-    0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0x86, 0x8C, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0x86, 0x8C, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC8, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x88, 
-    0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0x86, 
-    0x88, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xC8, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0x86, 0x8C, 0x84, 0x8C, 0x85, 0x88, 0x64, 0x88, 0x86, 0x8C, 0x84, 0x8C, 0x86, 
-    0x88, 0x84, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x64, 0x88, 
-    0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x64, 0x88, 0x46, 0x84, 0x05, 0x80, 
-    0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x44, 0x80, 0x24, 0x80, 0x45, 0x88, 0x24, 
-    0x80, 0x02, 0x80, 0xA5, 0x94, 0x25, 0x80, 0x65, 0x88, 0xA7, 0x90, 0x45, 0x88, 0xA5, 0x94, 
-    0x66, 0x8C, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x01, 0x80, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xA5, 0x90, 0xA7, 0x90, 
-    0xC8, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC8, 0x90, 0xC8, 0x8C, 0xC6, 0x94, 0xC8, 0x90, 0xC6, 
-    0x94, 0xA7, 0x90, 0xC9, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 
-    0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0xE7, 0x9C, 0xC8, 0x90, 0x08, 0x99, 0x6B, 0xA1, 0xC6, 
-    0x94, 0x84, 0x90, 0x43, 0x84, 0x84, 0x90, 0x08, 0x99, 0xA5, 0x94, 0x84, 0x90, 0x84, 0x90, 
-    0x84, 0x90, 0x08, 0x99, 0xC6, 0x94, 0xA5, 0x94, 0x84, 0x90, 0x08, 0x99, 0x84, 0x90, 0x63, 
-    0x8C, 0x63, 0x8C, 0x84, 0x90, 0x63, 0x8C, 0x63, 0x8C, 0xC6, 0x94, 0x84, 0x8C, 0x84, 0x90, 
-    0xC7, 0x98, 0x84, 0x90, 0x84, 0x8C, 0xC6, 0x94, 0x84, 0x90, 0x84, 0x8C, 0x63, 0x8C, 0x63, 
-    0x8C, 0x29, 0x9D, 0xC6, 0x94, 0x08, 0x99, 0x84, 0x90, 0x84, 0x90, 0x29, 0x9D, 0xA7, 0x90, 
-    0xA7, 0x88, 0x85, 0x88, 0xC9, 0x94, 0x86, 0x8C, 0xA5, 0x90, 0x84, 0x90, 0x29, 0x9D, 0x08, 
-    0x99, 0xC6, 0x94, 0x84, 0x90, 0x29, 0x9D, 0xA5, 0x90, 0x63, 0x8C, 0x63, 0x8C, 0x84, 0x90, 
-    0xA5, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0x08, 0x99, 0xC7, 
-    0x98, 0x84, 0x90, 0x63, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 0x84, 0x8C, 0xC6, 0x94, 
-    0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xA5, 0x94, 0xA7, 0x88, 0x63, 0x8C, 0xA5, 
-    0x90, 0x08, 0x99, 0xC6, 0x94, 0x84, 0x90, 0xA7, 0x90, 0xE7, 0x9C, 0x84, 0x90, 0xA5, 0x90, 
-    0x85, 0x88, 0x84, 0x90, 0x08, 0x99, 0xA5, 0x94, 0x84, 0x90, 0x84, 0x8C, 0x63, 0x8C, 0x63, 
-    0x8C, 0x08, 0x99, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 
-    0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x94, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x94, 0xA7, 
-    0x88, 0xA5, 0x94, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xC8, 0x90, 
-    0xC8, 0x90, 0xC6, 0x94, 0x86, 0x8C, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC8, 0x90, 0xC6, 
-    0x94, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 
-    0x90, 0xA7, 0x88, 0xA5, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC8, 0x8C, 
-    0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 
-    0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xC8, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x64, 
-    0x88, 0x86, 0x8C, 0x64, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 
-    0x85, 0x88, 0x84, 0x8C, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x88, 0x85, 0x88, 0x44, 0x84, 0x05, 0x80, 0x05, 0x80, 
-    0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x02, 0x80, 0x23, 0x80, 0x86, 
-    0x8C, 0x66, 0x8C, 0x02, 0x80, 0xA5, 0x94, 0x86, 0x88, 0x66, 0x8C, 0xC7, 0x98, 0x25, 0x80, 
-    0xA5, 0x94, 0xA5, 0x94, 0x23, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xA7, 0x90, 0x08, 0x99, 0xA7, 0x90, 0xA5, 0x90, 
-    0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC8, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 
-    0x90, 0xC6, 0x94, 0x08, 0x99, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x6B, 
-    0xA1, 0xA5, 0x90, 0xC6, 0x94, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0xA7, 0x90, 0x84, 0x90, 
-    0xC7, 0x98, 0xA5, 0x94, 0x84, 0x8C, 0xC6, 0x94, 0xA5, 0x94, 0x84, 0x90, 0xEA, 0x94, 0x84, 
-    0x90, 0xA5, 0x94, 0x63, 0x8C, 0x63, 0x8C, 0xC6, 0x94, 0x84, 0x90, 0xA5, 0x90, 0x84, 0x8C, 
-    0x84, 0x90, 0x63, 0x88, 0x84, 0x8C, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC8, 0x90, 0x08, 
-    0x99, 0x84, 0x90, 0x84, 0x8C, 0x0A, 0x99, 0xA5, 0x90, 0x85, 0x88, 0x84, 0x90, 0x08, 0x99, 
-    0x86, 0x8C, 0x86, 0x8C, 0xA5, 0x94, 0x08, 0x99, 0x08, 0x99, 0xA5, 0x90, 0x84, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x94, 0x84, 0x8C, 0x6B, 0xA1, 0xA5, 0x90, 0x84, 0x90, 0x08, 0x99, 
-    0x08, 0x99, 0x84, 0x90, 0x63, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 0x84, 0x8C, 0x84, 0x90, 0x29, 
-    0x9D, 0xA5, 0x94, 0x84, 0x90, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xA5, 0x94, 
-    0xA5, 0x94, 0xA5, 0x94, 0x44, 0x84, 0x84, 0x8C, 0xE7, 0x9C, 0x08, 0x99, 0xC6, 0x94, 0x84, 
-    0x90, 0xA5, 0x90, 0x08, 0x99, 0xA5, 0x94, 0x84, 0x90, 0xC7, 0x98, 0x08, 0x99, 0xA5, 0x94, 
-    0x84, 0x8C, 0x84, 0x90, 0xC7, 0x98, 0xC6, 0x94, 0xA5, 0x94, 0x63, 0x8C, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC9, 0x94, 0xA5, 0x94, 0xA7, 0x88, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x94, 0xA8, 
-    0x88, 0x86, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x94, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0x86, 0x8C, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 
-    0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 
-    0x90, 0xA5, 0x90, 0x86, 0x88, 0xA5, 0x90, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xE9, 0x8C, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x06, 0x89, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xC6, 0x94, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0x84, 
-    0x8C, 0xA7, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x85, 0x88, 0x85, 0x88, 
-    0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0x63, 0x88, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 
-    0x25, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x45, 0x88, 0xA5, 0x94, 0x24, 
-    0x80, 0xA5, 0x94, 0xA5, 0x94, 0x24, 0x80, 0xA7, 0x90, 0x66, 0x8C, 0x63, 0x8C, 0xE7, 0x9C, 
-    0x45, 0x88, 0x66, 0x8C, 0xC8, 0x90, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x01, 0x80, 0xA5, 
-    0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC8, 0x8C, 0xC6, 0x94, 
-    0xA7, 0x90, 0xC8, 0x8C, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0xC6, 
-    0x94, 0xC9, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC9, 0x94, 
-    0xC8, 0x8C, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0xC8, 0x8C, 0x08, 0x99, 0xC9, 0x94, 0xEA, 
-    0x94, 0x6B, 0xA1, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x6B, 0xA1, 0xC6, 0x94, 
-    0x84, 0x90, 0x6B, 0xA1, 0xC6, 0x94, 0x84, 0x90, 0xC6, 0x94, 0xA5, 0x94, 0xA5, 0x90, 0x0A, 
-    0x99, 0x84, 0x90, 0x08, 0x99, 0xA5, 0x90, 0x63, 0x8C, 0x08, 0x99, 0x84, 0x90, 0xA5, 0x90, 
-    0x84, 0x90, 0xC6, 0x94, 0x29, 0x9D, 0x29, 0x9D, 0xA5, 0x90, 0x84, 0x90, 0x84, 0x90, 0x84, 
-    0x90, 0x0A, 0x99, 0x08, 0x99, 0x84, 0x90, 0x86, 0x8C, 0xC9, 0x94, 0x84, 0x90, 0x84, 0x90, 
-    0x29, 0x9D, 0xC9, 0x94, 0x27, 0x8D, 0xEA, 0x94, 0x29, 0x9D, 0xC8, 0x8C, 0xE8, 0xA0, 0x85, 
-    0x88, 0x63, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0xC6, 0x94, 0x29, 0x9D, 0xA5, 0x94, 0x84, 0x90, 
-    0xA5, 0x90, 0x85, 0x88, 0xA5, 0x94, 0xC9, 0x94, 0x86, 0x8C, 0x63, 0x8C, 0x84, 0x8C, 0x08, 
-    0x99, 0x29, 0x9D, 0xC6, 0x94, 0x84, 0x90, 0x63, 0x8C, 0x84, 0x8C, 0x44, 0x80, 0x08, 0x99, 
-    0xA5, 0x94, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 0xC9, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xA5, 0x90, 0xC7, 0x98, 0x29, 0x9D, 0xC6, 0x94, 0xA5, 0x90, 0xA6, 0x94, 0xC8, 0x8C, 
-    0xE8, 0xA0, 0x84, 0x90, 0x84, 0x8C, 0x08, 0x99, 0x29, 0x9D, 0xA5, 0x94, 0x63, 0x8C, 0x63, 
-    0x8C, 0x63, 0x8C, 0x84, 0x8C, 0x08, 0x99, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x94, 0xA7, 
-    0x88, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 
-    0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 
-    0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0xA5, 0x90, 0x86, 
-    0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 
-    0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 
-    0x88, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x66, 0x8C, 
-    0x65, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 0xA5, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0x65, 0x88, 0x85, 0x88, 0x44, 0x84, 0x45, 0x88, 
-    0x45, 0x88, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x85, 0x88, 0xC7, 
-    0x98, 0x24, 0x80, 0xA5, 0x94, 0x66, 0x8C, 0x23, 0x80, 0xC7, 0x98, 0x67, 0x8C, 0x45, 0x88, 
-    0xE8, 0xA0, 0x25, 0x80, 0xA5, 0x94, 0xA5, 0x94, 0x23, 0x80, 0x23, 0x80, 0x24, 0x80, 0x01, 
-    0x80, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 
-    0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC8, 
-    0x8C, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xA7, 0x90, 
-    0xC6, 0x94, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC9, 0x94, 0x08, 
-    0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0xA5, 0x2A, 0xAD, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 
-    0x29, 0x9D, 0x6B, 0xA1, 0x6B, 0xA1, 0xE8, 0xA0, 0x6B, 0xA1, 0x29, 0x9D, 0x29, 0x9D, 0x6B, 
-    0xB1, 0x29, 0x9D, 0x6B, 0xA1, 0x6B, 0xA1, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 
-    0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 
-    0x9D, 0x08, 0x99, 0xA7, 0x90, 0x09, 0xA5, 0x29, 0x9D, 0x08, 0x99, 0xA7, 0x90, 0xE8, 0xA0, 
-    0x29, 0x9D, 0x29, 0x9D, 0xA7, 0x90, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0xEA, 
-    0x94, 0x29, 0x9D, 0xE8, 0xA0, 0xE8, 0xA0, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 
-    0xE8, 0xA0, 0x6B, 0xA1, 0x6B, 0xA1, 0x29, 0x9D, 0xE8, 0xA0, 0x29, 0x9D, 0x6B, 0xA1, 0x6B, 
-    0xA1, 0x29, 0x9D, 0x2A, 0xA9, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 
-    0x6B, 0xA1, 0x08, 0x99, 0x29, 0x9D, 0x6B, 0xA1, 0x29, 0x9D, 0xC6, 0x94, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0x6B, 0xA1, 0x6B, 0xA1, 0x29, 0x9D, 0x29, 0x9D, 0x6B, 0xA1, 0x6B, 0xA1, 
-    0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x6B, 0xA1, 0x6B, 0xA1, 0x29, 
-    0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xC8, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 
-    0x90, 0xC8, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x94, 
-    0xA8, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA5, 0x90, 0xA7, 0x88, 0xC6, 0x94, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 
-    0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA7, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0xC8, 0x90, 
-    0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x94, 0x86, 0x88, 0xA5, 0x90, 0x86, 0x88, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 
-    0x88, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0x84, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0x86, 0x8C, 
-    0x84, 0x8C, 0x86, 0x88, 0x63, 0x8C, 0x86, 0x88, 0x64, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x65, 0x88, 0x64, 0x88, 0x44, 0x84, 
-    0x64, 0x84, 0x45, 0x88, 0x45, 0x88, 0x43, 0x84, 0x23, 0x80, 0x42, 0x84, 0x01, 0x80, 0x84, 
-    0x90, 0xC8, 0x90, 0x23, 0x80, 0xA5, 0x94, 0xA5, 0x94, 0x24, 0x80, 0xC7, 0x98, 0x45, 0x88, 
-    0x84, 0x8C, 0xE8, 0xA0, 0x25, 0x80, 0xA5, 0x94, 0xA7, 0x90, 0x24, 0x80, 0x23, 0x80, 0x02, 
-    0x80, 0x01, 0x80, 0xA5, 0x90, 0xC8, 0x90, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 
-    0xC9, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 
-    0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 
-    0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0xC6, 0x94, 0xC9, 0x94, 0xC8, 
-    0x8C, 0x08, 0x99, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0x08, 0x99, 0xC9, 0x94, 0xC6, 0x94, 
-    0xC9, 0x94, 0xE7, 0x9C, 0x0B, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 
-    0x99, 0x6B, 0xA1, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0x29, 0x9D, 0x29, 0x9D, 0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC9, 0x94, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0xEA, 
-    0x94, 0x29, 0x9D, 0x29, 0x9D, 0x6B, 0xA1, 0x8C, 0xA1, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 
-    0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0xE8, 0xA0, 0xE8, 0xA0, 0x08, 0x99, 0xE7, 
-    0x9C, 0xE7, 0x9C, 0x08, 0x99, 0xE7, 0x9C, 0x08, 0x99, 0x09, 0xA5, 0x08, 0x99, 0x08, 0x99, 
-    0x29, 0x9D, 0x0B, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 
-    0x94, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0xE9, 0x8C, 0x08, 0x99, 0x29, 0x9D, 
-    0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 
-    0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC7, 0x98, 0xC8, 0x90, 
-    0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xC8, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 
-    0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x94, 0xA7, 0x88, 0xA5, 0x94, 0x86, 0x8C, 0xA7, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA8, 0x88, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0x86, 
-    0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0x84, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0x08, 0x99, 
-    0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0xC6, 0x94, 0xE9, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x06, 0x89, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x06, 0x89, 0xC8, 
-    0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 
-    0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x88, 0xA5, 
-    0x90, 0x86, 0x8C, 0xA5, 0x90, 0x86, 0x88, 0x84, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0x84, 0x90, 
-    0x86, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0x65, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0xA7, 0x88, 0xC6, 
-    0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x84, 0x8C, 0x85, 0x88, 
-    0x64, 0x88, 0x23, 0x80, 0x65, 0x88, 0x45, 0x88, 0x23, 0x80, 0x23, 0x84, 0x42, 0x84, 0x01, 
-    0x80, 0xA5, 0x90, 0xE7, 0x9C, 0x24, 0x80, 0xA5, 0x94, 0xA7, 0x90, 0x24, 0x80, 0xC7, 0x98, 
-    0x86, 0x88, 0x66, 0x8C, 0x08, 0x99, 0x25, 0x80, 0xA5, 0x90, 0xA6, 0x94, 0x24, 0x80, 0x23, 
-    0x80, 0x02, 0x80, 0x01, 0x80, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 
-    0x29, 0x9D, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 
-    0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0xC8, 0x8C, 0x08, 
-    0x99, 0xC6, 0x94, 0x08, 0x99, 0xC8, 0x8C, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC9, 0x94, 
-    0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xEA, 0x94, 0x08, 0x99, 0xC9, 
-    0x94, 0xC7, 0x98, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0xEA, 0x94, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC8, 
-    0x90, 0xC6, 0x94, 0xC9, 0x94, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0xA7, 0x90, 0xEA, 0x94, 
-    0xA7, 0x90, 0xC9, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xE7, 0x9C, 0xEA, 0x94, 0xE7, 0x9C, 0xE7, 0x9C, 
-    0xE7, 0x9C, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x2C, 
-    0x91, 0x08, 0x99, 0xE7, 0x9C, 0x29, 0x9D, 0x08, 0x99, 0xC9, 0x94, 0x08, 0x99, 0x08, 0x99, 
-    0xC6, 0x94, 0x08, 0x99, 0x29, 0x9D, 0xC7, 0x98, 0xC8, 0x8C, 0x08, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 
-    0xC8, 0x90, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC8, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xC8, 0x90, 0x86, 0x88, 0xA5, 0x90, 0xA8, 
-    0x88, 0xC8, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA5, 0x90, 0xA8, 0x88, 
-    0xA5, 0x94, 0x86, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 
-    0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 
-    0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0x06, 0x89, 0xC8, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 
-    0x86, 0x88, 0x84, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0x84, 0x8C, 0xA5, 0x90, 0x86, 0x8C, 0x63, 
-    0x8C, 0xA7, 0x88, 0x84, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0x84, 0x90, 0xA7, 0x88, 0xA5, 0x90, 
-    0x84, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0x84, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0x84, 0x8C, 
-    0x64, 0x88, 0x44, 0x84, 0x64, 0x84, 0x44, 0x80, 0x65, 0x88, 0x23, 0x80, 0x23, 0x84, 0x42, 
-    0x84, 0x01, 0x80, 0xC8, 0x90, 0xE8, 0xA0, 0x02, 0x80, 0x67, 0x8C, 0xA5, 0x94, 0x24, 0x80, 
-    0xC7, 0x98, 0x67, 0x8C, 0x45, 0x88, 0xE8, 0xA0, 0x25, 0x80, 0xA5, 0x94, 0xC7, 0x98, 0x24, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x01, 0x80, 0xC6, 0x94, 0xA5, 0x90, 0xC9, 0x94, 0xC6, 0x94, 
-    0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 
-    0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xA8, 0x88, 
-    0xA7, 0x88, 0x86, 0x88, 0xA8, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0x86, 0x88, 0xA8, 0x88, 0xA7, 
-    0x88, 0x85, 0x88, 0xA7, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0xA7, 0x88, 
-    0x86, 0x88, 0x86, 0x8C, 0x86, 0x88, 0xA7, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 
-    0x88, 0x86, 0x88, 0x87, 0x84, 0x86, 0x88, 0x87, 0x84, 0xA7, 0x88, 0x86, 0x88, 0xA7, 0x88, 
-    0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0xA7, 0x88, 0xC8, 0x8C, 0xA7, 0x88, 0x86, 0x88, 0x86, 
-    0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 
-    0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x64, 0x88, 0x87, 0x84, 0x86, 0x88, 0x46, 0x84, 0x86, 
-    0x88, 0x86, 0x88, 0x87, 0x84, 0xA8, 0x88, 0x86, 0x88, 0x87, 0x84, 0x86, 0x88, 0x86, 0x8C, 
-    0x86, 0x88, 0x86, 0x88, 0xA7, 0x88, 0x86, 0x88, 0xA7, 0x88, 0x86, 0x88, 0x86, 0x88, 0x87, 
-    0x84, 0xA7, 0x88, 0x86, 0x88, 0xA7, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 
-    0x86, 0x88, 0xA8, 0x88, 0x86, 0x88, 0x86, 0x88, 0x87, 0x84, 0x86, 0x8C, 0x86, 0x88, 0x86, 
-    0x88, 0x86, 0x88, 0x87, 0x84, 0xA7, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 
-    0xA7, 0x88, 0x86, 0x88, 0x86, 0x88, 0xA7, 0x88, 0x85, 0x88, 0x86, 0x88, 0x86, 0x88, 0xA7, 
-    0x88, 0x85, 0x88, 0x86, 0x88, 0x86, 0x88, 0xA7, 0x88, 0x86, 0x8C, 0xA8, 0x88, 0x86, 0x8C, 
-    0x46, 0x84, 0x85, 0x88, 0x46, 0x84, 0x44, 0x84, 0x86, 0x88, 0x25, 0x80, 0x86, 0x88, 0x46, 
-    0x84, 0x64, 0x88, 0x86, 0x88, 0x25, 0x80, 0x86, 0x88, 0x25, 0x80, 0x86, 0x88, 0x25, 0x80, 
-    0x85, 0x88, 0x46, 0x84, 0x64, 0x88, 0x44, 0x84, 0x46, 0x84, 0x65, 0x88, 0x86, 0x88, 0x25, 
-    0x80, 0x64, 0x88, 0x86, 0x88, 0x25, 0x80, 0x64, 0x88, 0x86, 0x88, 0x25, 0x80, 0x45, 0x88, 
-    0x45, 0x88, 0x85, 0x88, 0x85, 0x88, 0x25, 0x80, 0x85, 0x88, 0x25, 0x80, 0x86, 0x88, 0x45, 
-    0x88, 0x45, 0x88, 0x45, 0x88, 0x24, 0x80, 0x45, 0x88, 0x45, 0x88, 0x45, 0x88, 0x46, 0x84, 
-    0x67, 0x8C, 0x66, 0x8C, 0x86, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x66, 0x8C, 0x66, 
-    0x8C, 0x66, 0x8C, 0x86, 0x88, 0x85, 0x88, 0x43, 0x84, 0x86, 0x88, 0x65, 0x88, 0x45, 0x88, 
-    0x85, 0x88, 0x45, 0x88, 0x86, 0x88, 0x45, 0x88, 0x43, 0x84, 0x86, 0x88, 0x43, 0x84, 0x48, 
-    0x84, 0x46, 0x84, 0x67, 0x8C, 0x28, 0x80, 0x86, 0x88, 0x48, 0x84, 0x25, 0x80, 0x25, 0x80, 
-    0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x27, 0x80, 0x25, 
-    0x80, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x27, 0x80, 0x46, 0x84, 0x25, 0x80, 0x46, 0x84, 
-    0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x25, 0x80, 0x45, 0x88, 0x46, 0x84, 0x46, 0x84, 0x46, 
-    0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x48, 0x84, 0x46, 0x84, 0x86, 0x88, 
-    0x05, 0x80, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x45, 0x88, 0x65, 0x88, 0x23, 0x84, 0x23, 
-    0x84, 0x23, 0x84, 0x01, 0x80, 0xA5, 0x94, 0xE8, 0xA0, 0x24, 0x80, 0xA5, 0x94, 0x67, 0x8C, 
-    0x02, 0x80, 0xE7, 0x9C, 0x46, 0x84, 0xA5, 0x94, 0xE8, 0xA0, 0x24, 0x80, 0xA5, 0x94, 0xA5, 
-    0x94, 0x24, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC8, 
-    0x8C, 0xC6, 0x94, 0xC9, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC8, 0x8C, 0x86, 0x88, 0x46, 0x84, 
-    0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x22, 0x84, 0x24, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x22, 0x84, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x42, 0x84, 0x24, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x42, 0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 0x80, 
-    0x05, 0x80, 0x24, 0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x05, 0x80, 0x02, 0x80, 0x05, 0x80, 0x24, 0x80, 0x24, 0x80, 0x05, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x05, 0x80, 0x24, 0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x05, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x05, 
-    0x80, 0x23, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x45, 0x88, 0xC8, 0x90, 0xE8, 0xA0, 0x24, 0x80, 0xA6, 0x94, 
-    0xA5, 0x94, 0x45, 0x88, 0xA5, 0x94, 0x67, 0x8C, 0x66, 0x8C, 0xE8, 0xA0, 0x23, 0x80, 0xA7, 
-    0x90, 0xA5, 0x94, 0x23, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xC8, 0x90, 
-    0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 
-    0x8C, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC9, 0x94, 0xA5, 0x90, 0xA8, 0x88, 0x85, 0x88, 
-    0x05, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 
-    0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 
-    0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x42, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x02, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 
-    0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 
-    0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xC8, 0x90, 0xC7, 0x98, 0x23, 0x80, 
-    0xC7, 0x98, 0xA7, 0x90, 0x24, 0x80, 0xE7, 0x9C, 0x86, 0x88, 0x66, 0x8C, 0xC6, 0x94, 0x25, 
-    0x80, 0xA7, 0x90, 0xA6, 0x94, 0x23, 0x80, 0x24, 0x80, 0x24, 0x80, 0x01, 0x80, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0x06, 0x89, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xA8, 0x88, 
-    0x24, 0x80, 0x01, 0x80, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x42, 0x88, 0x23, 0x80, 0x22, 
-    0x84, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x23, 0x80, 0x01, 0x80, 0x21, 0x84, 
-    0x42, 0x84, 0x01, 0x80, 0x23, 0x80, 0x21, 0x84, 0x21, 0x84, 0x42, 0x84, 0x22, 0x84, 0x42, 
-    0x84, 0x42, 0x84, 0x02, 0x80, 0x42, 0x84, 0x01, 0x80, 0x42, 0x88, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xE7, 0x9C, 0xC7, 0x98, 
-    0x24, 0x80, 0xC7, 0x98, 0xA5, 0x94, 0x23, 0x80, 0xE7, 0x9C, 0x67, 0x8C, 0x63, 0x8C, 0xE8, 
-    0xA0, 0x45, 0x88, 0xA5, 0x94, 0xC7, 0x98, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 
-    0xA5, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0x06, 0x89, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 
-    0x90, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 
-    0x85, 0x88, 0x01, 0x80, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x90, 0xC9, 0x94, 
-    0xE7, 0x9C, 0x23, 0x80, 0xC7, 0x98, 0x67, 0x8C, 0x23, 0x80, 0xE7, 0x9C, 0x67, 0x8C, 0x66, 
-    0x8C, 0xE7, 0x9C, 0x25, 0x80, 0xA7, 0x90, 0xA5, 0x94, 0x23, 0x80, 0x23, 0x80, 0x24, 0x80, 
-    0x01, 0x80, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 
-    0x90, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 
-    0x08, 0x99, 0x64, 0x88, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x90, 
-    0xE8, 0xA0, 0xC7, 0x98, 0x05, 0x80, 0xA6, 0x94, 0xA5, 0x94, 0x25, 0x80, 0xC7, 0x98, 0x67, 
-    0x8C, 0x63, 0x8C, 0xE7, 0x9C, 0x25, 0x80, 0xA5, 0x94, 0xA6, 0x94, 0x23, 0x80, 0x23, 0x80, 
-    0x02, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 
-    0x94, 0xA7, 0x90, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 
-    0x08, 0x99, 0xC6, 0x94, 0x86, 0x88, 0x01, 0x80, 0x42, 0x84, 0x23, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0xA5, 0x90, 0xC7, 0x98, 0xE8, 0xA0, 0x02, 0x80, 0xC7, 0x98, 0xA7, 0x90, 0x23, 0x80, 0xC7, 
-    0x98, 0x46, 0x84, 0x66, 0x8C, 0xE7, 0x9C, 0x45, 0x88, 0xA7, 0x90, 0xA5, 0x94, 0x24, 0x80, 
-    0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 
-    0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 
-    0xC8, 0x8C, 0xC6, 0x94, 0xC9, 0x94, 0x85, 0x88, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0xA5, 0x94, 0xE8, 0xA0, 0xC9, 0x94, 0x23, 0x80, 0xE7, 0x9C, 0xC7, 0x98, 0x23, 
-    0x80, 0xE7, 0x9C, 0x67, 0x8C, 0x66, 0x8C, 0xC7, 0x98, 0x25, 0x80, 0xA5, 0x94, 0xA5, 0x94, 
-    0x25, 0x80, 0x02, 0x80, 0x24, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC8, 
-    0x8C, 0xC6, 0x94, 0x06, 0x89, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0x46, 0x84, 0x01, 0x80, 0x22, 0x84, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xA7, 0x90, 0xC7, 0x98, 0x23, 0x80, 0xE8, 0xA0, 0xC7, 
-    0x98, 0x24, 0x80, 0xE8, 0xA0, 0x67, 0x8C, 0xA5, 0x94, 0x09, 0xA5, 0x64, 0x88, 0xC7, 0x98, 
-    0xE7, 0x9C, 0x24, 0x80, 0x02, 0x80, 0x23, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA5, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xC8, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 
-    0xC8, 0x8C, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 0x90, 0xC8, 0x8C, 0x85, 0x88, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xC7, 0x98, 0xC7, 0x98, 0x23, 0x80, 0xE7, 
-    0x9C, 0xA6, 0x94, 0x23, 0x80, 0xE8, 0xA0, 0xA7, 0x90, 0x84, 0x90, 0xE8, 0xA0, 0x45, 0x88, 
-    0xC7, 0x98, 0xC7, 0x98, 0x23, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xA7, 
-    0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC9, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0x64, 0x88, 0x01, 
-    0x80, 0x42, 0x88, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x90, 0x09, 0xA5, 0xE8, 0xA0, 0x25, 
-    0x80, 0x09, 0xA5, 0xC7, 0x98, 0x23, 0x80, 0xE8, 0xA0, 0xA5, 0x94, 0xA5, 0x94, 0xE8, 0xA0, 
-    0x86, 0x88, 0xA5, 0x94, 0xE7, 0x9C, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 
-    0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x86, 
-    0x88, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 0x94, 0x2A, 0xAD, 0x09, 
-    0xA5, 0x45, 0x88, 0x09, 0xA5, 0xC7, 0x98, 0x23, 0x80, 0xE8, 0xA0, 0x67, 0x8C, 0xA5, 0x94, 
-    0x09, 0xA5, 0x23, 0x84, 0xC7, 0x98, 0xE7, 0x9C, 0x23, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 
-    0x80, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC9, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xA7, 
-    0x90, 0x64, 0x88, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 0x94, 0x2A, 
-    0xA9, 0xE7, 0x9C, 0x64, 0x88, 0x09, 0xA5, 0xC7, 0x98, 0x23, 0x80, 0xE8, 0xA0, 0xA5, 0x94, 
-    0x86, 0x88, 0x09, 0xA5, 0x43, 0x84, 0xE7, 0x9C, 0xE7, 0x9C, 0x02, 0x80, 0x23, 0x80, 0x02, 
-    0x80, 0x01, 0x80, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 0x90, 0x06, 0x89, 
-    0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 
-    0x90, 0xC6, 0x94, 0x86, 0x88, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA6, 
-    0x94, 0x09, 0xA5, 0xE7, 0x9C, 0x24, 0x80, 0xE7, 0x9C, 0xE7, 0x9C, 0x23, 0x80, 0xE8, 0xA0, 
-    0xA5, 0x94, 0x84, 0x90, 0xE8, 0xA0, 0x86, 0x88, 0xC7, 0x98, 0xC7, 0x98, 0x23, 0x80, 0x23, 
-    0x80, 0x02, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 
-    0xC8, 0x90, 0xA5, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xE9, 0x8C, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA7, 0x90, 0x64, 0x88, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0xA5, 0x94, 0x29, 0x9D, 0xE7, 0x9C, 0x23, 0x80, 0xE8, 0xA0, 0xC7, 0x98, 0x23, 0x80, 
-    0xE8, 0xA0, 0xA5, 0x94, 0xA5, 0x94, 0xE8, 0xA0, 0x85, 0x88, 0xC7, 0x98, 0xE7, 0x9C, 0x23, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 
-    0xA7, 0x88, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC9, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xA7, 0x90, 0xC8, 0x8C, 0xC6, 0x94, 0x86, 0x88, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0xC7, 0x98, 0x09, 0xA5, 0xE7, 0x9C, 0x23, 0x80, 0xE8, 0xA0, 0xA5, 0x94, 
-    0x23, 0x80, 0xE7, 0x9C, 0xA5, 0x94, 0x86, 0x8C, 0x09, 0xA5, 0x64, 0x88, 0xC7, 0x98, 0xE7, 
-    0x9C, 0x23, 0x80, 0x23, 0x84, 0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC9, 
-    0x94, 0x06, 0x89, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0x64, 0x88, 0x01, 0x80, 0x42, 0x84, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0xC6, 0x94, 0x09, 0xA5, 0xE8, 0xA0, 0x02, 0x80, 0xE8, 0xA0, 
-    0xC7, 0x98, 0x23, 0x80, 0xE8, 0xA0, 0xA5, 0x94, 0x84, 0x90, 0x09, 0xA5, 0x45, 0x88, 0xC7, 
-    0x98, 0xC7, 0x98, 0x23, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0x85, 0x88, 0xA7, 0x90, 
-    0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xC8, 0x90, 0xC8, 0x90, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA5, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0x64, 0x88, 0x01, 0x80, 
-    0x22, 0x84, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xC7, 0x98, 0x09, 0xA5, 0xE7, 0x9C, 0x23, 0x80, 
-    0xC7, 0x98, 0xA6, 0x94, 0x23, 0x80, 0xE8, 0xA0, 0xA7, 0x90, 0x84, 0x90, 0x09, 0xA5, 0x65, 
-    0x88, 0xC7, 0x98, 0xE7, 0x9C, 0x23, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 
-    0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC8, 0x90, 0xA5, 0x90, 0x86, 0x88, 
-    0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xC7, 0x98, 0x09, 0xA5, 0xE7, 0x9C, 
-    0x23, 0x80, 0xE8, 0xA0, 0xC7, 0x98, 0x23, 0x80, 0xE8, 0xA0, 0xA7, 0x88, 0x63, 0x8C, 0xE7, 
-    0x9C, 0x45, 0x88, 0xC8, 0x90, 0xC7, 0x98, 0x23, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 
-    0x84, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 
-    0x94, 0xC9, 0x94, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0x65, 0x88, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA6, 0x94, 0x09, 0xA5, 
-    0xC7, 0x98, 0x44, 0x80, 0xE8, 0xA0, 0xC7, 0x98, 0x23, 0x80, 0xE8, 0xA0, 0xA7, 0x88, 0xA5, 
-    0x94, 0xE8, 0xA0, 0x85, 0x88, 0xA7, 0x90, 0xC7, 0x98, 0x02, 0x80, 0x45, 0x88, 0x01, 0x80, 
-    0x01, 0x80, 0x65, 0x88, 0xC8, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 
-    0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA7, 0x90, 0x44, 0x84, 0x01, 0x80, 0x42, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 0x90, 
-    0xC7, 0x98, 0x09, 0xA5, 0x02, 0x80, 0xE8, 0xA0, 0xA5, 0x94, 0x23, 0x80, 0xE8, 0xA0, 0x67, 
-    0x8C, 0x63, 0x8C, 0xE8, 0xA0, 0x45, 0x88, 0xC7, 0x98, 0xC7, 0x98, 0x02, 0x80, 0x23, 0x84, 
-    0x01, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 
-    0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA5, 0x90, 0xA7, 0x90, 0x64, 0x84, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0xA5, 0x94, 0xC8, 0x90, 0xC7, 0x98, 0x23, 0x80, 0xE8, 0xA0, 0xA5, 0x94, 0x25, 0x80, 0x29, 
-    0x9D, 0x67, 0x8C, 0x84, 0x8C, 0x09, 0xA5, 0x64, 0x88, 0xC7, 0x98, 0xC7, 0x98, 0x23, 0x80, 
-    0x23, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0x64, 0x84, 0x01, 0x80, 0x22, 0x84, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0xC7, 0x98, 0x29, 0x9D, 0x09, 0xA5, 0x02, 0x80, 0xC7, 0x98, 0xA7, 0x90, 0x02, 
-    0x80, 0x09, 0xA5, 0xA7, 0x88, 0x84, 0x90, 0x09, 0xA5, 0x64, 0x88, 0xC7, 0x98, 0xC7, 0x98, 
-    0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x84, 0x8C, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0x46, 0x84, 0x21, 0x80, 0x42, 0x84, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0xC6, 0x94, 0x09, 0xA5, 0xC7, 0x98, 0x23, 0x80, 0xE7, 0x9C, 0x67, 
-    0x8C, 0x23, 0x84, 0xE8, 0xA0, 0x86, 0x8C, 0x63, 0x8C, 0xE8, 0xA0, 0x65, 0x88, 0xA7, 0x90, 
-    0xC7, 0x98, 0x23, 0x84, 0x23, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA7, 0x88, 0xA5, 
-    0x90, 0xC8, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 
-    0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0x44, 0x84, 0x01, 0x80, 0x42, 
-    0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA6, 0x94, 0x09, 0xA5, 0xE7, 0x9C, 0x63, 0x8C, 0xE7, 
-    0x9C, 0xC7, 0x98, 0x24, 0x80, 0xE8, 0xA0, 0xA7, 0x88, 0x84, 0x90, 0x09, 0xA5, 0x43, 0x84, 
-    0xC7, 0x98, 0xC7, 0x98, 0x23, 0x80, 0x23, 0x80, 0x01, 0x80, 0x02, 0x80, 0x86, 0x88, 0xA5, 
-    0x94, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC8, 0x8C, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x88, 0x01, 
-    0x80, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xE7, 0x9C, 0xE8, 0xA0, 0x25, 
-    0x80, 0xC7, 0x98, 0xA5, 0x94, 0x23, 0x80, 0xE8, 0xA0, 0xA7, 0x88, 0x63, 0x8C, 0x09, 0xA5, 
-    0x64, 0x84, 0xE7, 0x9C, 0xC7, 0x98, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0x84, 
-    0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC6, 0x94, 
-    0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0x25, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 0x94, 0xC8, 0x90, 0xE8, 
-    0xA0, 0x24, 0x80, 0xC7, 0x98, 0x67, 0x8C, 0x23, 0x80, 0xE7, 0x9C, 0x66, 0x8C, 0xA5, 0x90, 
-    0xE8, 0xA0, 0x45, 0x88, 0xC8, 0x90, 0xA5, 0x94, 0x23, 0x80, 0x23, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x84, 0x8C, 0x86, 0x8C, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC8, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 
-    0x88, 0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 0x94, 0xC7, 
-    0x98, 0xC7, 0x98, 0x24, 0x80, 0xC7, 0x98, 0x67, 0x8C, 0x23, 0x84, 0xE7, 0x9C, 0x86, 0x88, 
-    0x84, 0x8C, 0xE8, 0xA0, 0x25, 0x80, 0xA5, 0x94, 0x66, 0x8C, 0x23, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x01, 0x80, 0x84, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xC8, 0x90, 0xA5, 0x90, 0xA7, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 
-    0x90, 0xA7, 0x88, 0x64, 0x88, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 
-    0x90, 0xC9, 0x94, 0xA6, 0x94, 0x23, 0x80, 0xA6, 0x94, 0xA5, 0x90, 0x24, 0x80, 0xE8, 0xA0, 
-    0x86, 0x88, 0x85, 0x88, 0xC7, 0x98, 0x25, 0x80, 0x85, 0x88, 0x66, 0x8C, 0x02, 0x80, 0x23, 
-    0x84, 0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xC8, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x88, 
-    0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 
-    0x94, 0xA5, 0x90, 0xA5, 0x90, 0x44, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0xA5, 0x94, 0xE7, 0x9C, 0xC7, 0x98, 0x23, 0x80, 0xC7, 0x98, 0xA5, 0x94, 0x24, 0x80, 
-    0xC7, 0x98, 0x66, 0x8C, 0x85, 0x88, 0xC7, 0x98, 0x25, 0x80, 0xA5, 0x94, 0x66, 0x8C, 0x22, 
-    0x84, 0x24, 0x80, 0x02, 0x80, 0x01, 0x80, 0x65, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 
-    0xA5, 0x90, 0xC8, 0x90, 0xA5, 0x90, 0xC8, 0x90, 0xA5, 0x90, 0xC8, 0x90, 0xA5, 0x90, 0xE9, 
-    0x8C, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0x44, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0xA5, 0x90, 0xC7, 0x98, 0xA7, 0x90, 0x24, 0x80, 0xA5, 0x94, 0x67, 0x8C, 
-    0x23, 0x80, 0xC7, 0x98, 0x66, 0x8C, 0x84, 0x90, 0xE8, 0xA0, 0x64, 0x88, 0xA7, 0x90, 0xA5, 
-    0x94, 0x24, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA8, 0x88, 0xA5, 0x94, 
-    0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 
-    0x88, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 0x88, 0x25, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 0x94, 0xC8, 0x90, 0xC7, 0x98, 0x23, 0x80, 0xA5, 0x94, 
-    0x67, 0x8C, 0x02, 0x80, 0xE8, 0xA0, 0xA5, 0x94, 0x84, 0x90, 0xE8, 0xA0, 0x45, 0x88, 0xA5, 
-    0x94, 0xC7, 0x98, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA7, 0x88, 
-    0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0x64, 0x88, 0x01, 0x80, 
-    0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 0x94, 0xE7, 0x9C, 0xA5, 0x94, 0x23, 0x80, 
-    0xA5, 0x94, 0xA5, 0x90, 0x23, 0x80, 0xE8, 0xA0, 0x86, 0x88, 0x84, 0x90, 0xE8, 0xA0, 0x25, 
-    0x80, 0xC7, 0x98, 0xC7, 0x98, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 
-    0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC8, 0x8C, 0xC6, 0x94, 0xA7, 0x90, 0x64, 0x88, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 0x94, 0xC9, 0x94, 0xA5, 0x94, 
-    0x23, 0x80, 0xA6, 0x94, 0x67, 0x8C, 0x24, 0x80, 0xC7, 0x98, 0x67, 0x8C, 0x84, 0x8C, 0xE8, 
-    0xA0, 0x45, 0x88, 0xA5, 0x94, 0xC7, 0x98, 0x42, 0x84, 0x24, 0x80, 0x02, 0x80, 0x01, 0x80, 
-    0x84, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x94, 0xA7, 0x88, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 
-    0x88, 0xA5, 0x90, 0xA7, 0x90, 0x06, 0x89, 0xC8, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 
-    0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xC6, 0x94, 0xC7, 0x98, 
-    0xE7, 0x9C, 0x24, 0x80, 0xA7, 0x90, 0xA5, 0x94, 0x23, 0x80, 0xA7, 0x90, 0x67, 0x8C, 0x63, 
-    0x8C, 0xE7, 0x9C, 0x65, 0x88, 0xC7, 0x98, 0xA7, 0x90, 0x23, 0x80, 0x23, 0x80, 0x00, 0x80, 
-    0x01, 0x80, 0x84, 0x8C, 0xA7, 0x88, 0xA5, 0x94, 0x86, 0x8C, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0x64, 0x88, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 0x94, 
-    0xC7, 0x98, 0xC7, 0x98, 0x24, 0x80, 0xA6, 0x94, 0xA5, 0x94, 0x24, 0x80, 0xE7, 0x9C, 0x66, 
-    0x8C, 0x86, 0x8C, 0xE8, 0xA0, 0x43, 0x84, 0xA7, 0x90, 0xA5, 0x94, 0x23, 0x80, 0x23, 0x80, 
-    0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xC6, 0x94, 0xA7, 0x90, 0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0xA5, 0x90, 0xC7, 0x98, 0xC7, 0x98, 0x24, 0x80, 0xA6, 0x94, 0xA5, 0x94, 0x24, 0x80, 0xC7, 
-    0x98, 0x66, 0x8C, 0x86, 0x88, 0xC7, 0x98, 0x65, 0x88, 0xA5, 0x94, 0xC7, 0x98, 0x24, 0x80, 
-    0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 
-    0x88, 0xA5, 0x90, 0xC8, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0x84, 0x8C, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0xA5, 0x94, 0xC9, 0x94, 0xC7, 0x98, 0x24, 0x80, 0xA5, 0x94, 0xA7, 0x90, 0x23, 
-    0x80, 0xE8, 0xA0, 0x43, 0x84, 0x86, 0x8C, 0xE8, 0xA0, 0x23, 0x80, 0xC7, 0x98, 0xA5, 0x94, 
-    0x23, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0x02, 0x80, 0x21, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0xA5, 0x94, 0xC7, 0x98, 0xC7, 0x98, 0x24, 0x80, 0xA5, 0x94, 0xA5, 
-    0x94, 0x24, 0x80, 0xE8, 0xA0, 0x66, 0x8C, 0x66, 0x8C, 0xE8, 0xA0, 0x23, 0x84, 0xA5, 0x94, 
-    0xC7, 0x98, 0x24, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0x27, 0x8D, 0xC6, 0x94, 0x22, 
-    0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xE8, 0xA0, 0xC6, 0x94, 0x24, 0x80, 0xA6, 
-    0x94, 0xA5, 0x94, 0x24, 0x80, 0xE7, 0x9C, 0x66, 0x8C, 0x63, 0x8C, 0xE8, 0xA0, 0x65, 0x88, 
-    0xA7, 0x90, 0xA5, 0x94, 0x23, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA7, 
-    0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0x08, 0x99, 0x69, 
-    0x91, 0xEA, 0x94, 0xC8, 0x90, 0x23, 0x84, 0x02, 0x80, 0x23, 0x84, 0x02, 0x80, 0x01, 0x80, 
-    0x42, 0x84, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x22, 0x84, 0x01, 
-    0x80, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x23, 0x84, 0x21, 0x80, 0x22, 0x84, 0x01, 0x80, 
-    0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x01, 0x80, 0x22, 0x84, 0x02, 0x80, 0x22, 0x84, 0x02, 
-    0x80, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x01, 0x80, 0x22, 0x84, 0x21, 0x80, 
-    0x01, 0x80, 0x22, 0x84, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x02, 0x80, 0x42, 0x84, 0x01, 
-    0x80, 0x42, 0x84, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x42, 0x84, 
-    0x01, 0x80, 0x23, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x42, 0x84, 0x02, 0x80, 0x02, 
-    0x80, 0x23, 0x84, 0x02, 0x80, 0x23, 0x84, 0x21, 0x80, 0x42, 0x84, 0x01, 0x80, 0x23, 0x84, 
-    0x21, 0x80, 0x22, 0x84, 0x21, 0x80, 0x02, 0x80, 0x22, 0x84, 0x21, 0x80, 0x01, 0x80, 0x23, 
-    0x84, 0x21, 0x80, 0x22, 0x84, 0x01, 0x80, 0x42, 0x84, 0x02, 0x80, 0x42, 0x84, 0x01, 0x80, 
-    0x42, 0x84, 0x42, 0x84, 0x21, 0x80, 0x23, 0x80, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x42, 
-    0x84, 0x21, 0x80, 0x42, 0x84, 0x02, 0x80, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x42, 0x84, 
-    0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x42, 
-    0x84, 0x01, 0x80, 0x42, 0x84, 0x21, 0x80, 0x01, 0x80, 0x42, 0x84, 0x21, 0x80, 0x42, 0x84, 
-    0x01, 0x80, 0x22, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x21, 0x84, 0x21, 0x80, 0x01, 0x80, 0x42, 0x84, 
-    0x01, 0x80, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 
-    0x80, 0x23, 0x84, 0x00, 0x80, 0x02, 0x80, 0x01, 0x80, 0x21, 0x80, 0x23, 0x84, 0x21, 0x80, 
-    0x01, 0x80, 0x22, 0x84, 0x21, 0x80, 0x01, 0x80, 0x02, 0x80, 0x42, 0x84, 0x01, 0x80, 0x42, 
-    0x84, 0x21, 0x80, 0x21, 0x80, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x42, 0x84, 0x01, 
-    0x80, 0x01, 0x80, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x42, 0x84, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x42, 0x84, 0x21, 0x80, 0x02, 0x80, 0x42, 
-    0x84, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 0x02, 0x80, 0x23, 0x84, 
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x22, 0x84, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x23, 
-    0x84, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x21, 0x80, 0x02, 0x80, 0x23, 0x84, 0x00, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x21, 0x80, 0x01, 0x80, 0x42, 0x84, 0x21, 0x80, 0x02, 0x80, 0x01, 
-    0x80, 0x21, 0x80, 0x01, 0x80, 0x02, 0x80, 0x42, 0x84, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 
-    0x21, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0xA5, 0x94, 0xC7, 0x98, 0xC7, 0x98, 0x24, 
-    0x80, 0xA5, 0x94, 0xA7, 0x88, 0x23, 0x80, 0xC7, 0x98, 0x66, 0x8C, 0x84, 0x90, 0xE8, 0xA0, 
-    0x23, 0x84, 0xA5, 0x94, 0xA7, 0x90, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0x84, 
-    0x8C, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0xC8, 
-    0x8C, 0x08, 0x99, 0x69, 0x91, 0x8A, 0x99, 0xAB, 0x9D, 0x8A, 0x99, 0x8A, 0x99, 0xAB, 0x9D, 
-    0xAB, 0x9D, 0xEB, 0x99, 0xAB, 0x9D, 0xCC, 0xA1, 0xEB, 0x99, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 
-    0xA6, 0xEB, 0x99, 0x0E, 0xA6, 0xEB, 0x99, 0x8A, 0x99, 0xAB, 0x9D, 0x8A, 0x99, 0x8A, 0x99, 
-    0xAB, 0x9D, 0x8A, 0x99, 0xAB, 0x9D, 0x2C, 0x91, 0x8A, 0x99, 0xAB, 0x9D, 0x8A, 0x99, 0xAB, 
-    0x9D, 0xAB, 0x9D, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0xAB, 0x9D, 0xAB, 0x9D, 0xAB, 0x9D, 
-    0xEB, 0x99, 0x0E, 0xA6, 0x0E, 0xA6, 0x2F, 0xAA, 0x2F, 0xAA, 0x0E, 0xA6, 0x8A, 0x99, 0xCC, 
-    0xA1, 0x0E, 0xA6, 0x0E, 0xA6, 0xEB, 0x99, 0x0E, 0xA6, 0x0E, 0xA6, 0xEB, 0x99, 0x0E, 0xA6, 
-    0xEB, 0x99, 0x0E, 0xA6, 0xEB, 0x99, 0xAB, 0x9D, 0xCC, 0xA1, 0xEB, 0x99, 0xCC, 0xA1, 0x8A, 
-    0x99, 0xAB, 0x9D, 0x8A, 0x99, 0x8A, 0x99, 0xAB, 0x9D, 0x0E, 0xA6, 0x0E, 0xA6, 0xEB, 0x99, 
-    0xCC, 0xA1, 0xEB, 0x99, 0xAB, 0x9D, 0x8A, 0x99, 0x8A, 0x99, 0xAB, 0x9D, 0xCC, 0xA1, 0x0E, 
-    0xA6, 0x0E, 0xA6, 0xEB, 0x99, 0xAB, 0x9D, 0xCC, 0xA1, 0xAB, 0x9D, 0xEB, 0x99, 0xCC, 0xA1, 
-    0xEB, 0x99, 0xCC, 0xA1, 0xAB, 0x9D, 0xAB, 0x9D, 0xEB, 0x99, 0xCC, 0xA1, 0xEB, 0x99, 0xCC, 
-    0xA1, 0xCC, 0xA1, 0xEB, 0x99, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 
-    0xCC, 0xA1, 0x0E, 0xA6, 0x2B, 0x9A, 0x0E, 0xA6, 0x0E, 0xA6, 0xCC, 0xA1, 0xCC, 0xA1, 0xCC, 
-    0xA1, 0xCC, 0xA1, 0xEB, 0x99, 0x0E, 0xA6, 0xCC, 0xA1, 0x0E, 0xA6, 0xCC, 0xA1, 0x0E, 0xA6, 
-    0xEB, 0x99, 0xCC, 0xA1, 0xCC, 0xA1, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 
-    0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x2B, 0x9A, 0xCC, 0xA1, 0xCC, 0xA1, 
-    0xCC, 0xA1, 0xCC, 0xA1, 0xCC, 0xA1, 0xCC, 0xA1, 0x2B, 0x9A, 0x0E, 0xA6, 0x0E, 0xA6, 0x2B, 
-    0x9A, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 
-    0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 
-    0x99, 0x8A, 0x99, 0x8A, 0x99, 0xAB, 0x9D, 0xAB, 0x9D, 0xAB, 0x9D, 0xAB, 0x9D, 0x69, 0x91, 
-    0x69, 0x91, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 
-    0x99, 0x8A, 0x99, 0xAB, 0x9D, 0x8A, 0x99, 0xAB, 0x9D, 0xAB, 0x9D, 0x8A, 0x99, 0xAB, 0x9D, 
-    0xAB, 0x9D, 0xEB, 0x99, 0xEB, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x69, 0x91, 0xE9, 0x8C, 0x08, 
-    0x99, 0xC8, 0x8C, 0x69, 0x91, 0xEA, 0x94, 0x27, 0x8D, 0xEA, 0x94, 0x27, 0x8D, 0xEA, 0x94, 
-    0x69, 0x91, 0xE9, 0x8C, 0x29, 0x9D, 0x69, 0x91, 0x08, 0x99, 0x69, 0x91, 0x29, 0x9D, 0x69, 
-    0x91, 0xEA, 0x94, 0x69, 0x91, 0x29, 0x9D, 0x8A, 0x99, 0xEA, 0x94, 0x69, 0x91, 0xEA, 0x94, 
-    0x69, 0x91, 0x8A, 0x99, 0x6B, 0xA1, 0x8A, 0x99, 0x8A, 0x99, 0x6B, 0xA1, 0x69, 0x91, 0x29, 
-    0x9D, 0x8A, 0x99, 0x29, 0x9D, 0x69, 0x91, 0x29, 0x9D, 0x69, 0x91, 0x8A, 0x99, 0xEA, 0x94, 
-    0x69, 0x91, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0xE9, 0x8C, 0xEA, 0x94, 0xC8, 0x90, 0xA7, 
-    0x90, 0x45, 0x88, 0xA6, 0x94, 0xA7, 0x90, 0x02, 0x80, 0xE8, 0xA0, 0x45, 0x88, 0x84, 0x8C, 
-    0xC9, 0x94, 0x43, 0x84, 0xA5, 0x94, 0xA5, 0x94, 0x23, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 
-    0x80, 0x84, 0x8C, 0xA7, 0x88, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 0x90, 
-    0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xC9, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0x06, 0x89, 0x08, 0x99, 0x27, 0x8D, 
-    0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x2C, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 
-    0x91, 0xEB, 0x99, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x0B, 0x8D, 0x69, 0x91, 0xEB, 0x84, 
-    0x27, 0x8D, 0x69, 0x91, 0xEB, 0x84, 0x27, 0x8D, 0x69, 0x91, 0x69, 0x91, 0xE9, 0x8C, 0x69, 
-    0x91, 0xEB, 0x84, 0x27, 0x8D, 0x69, 0x91, 0x0B, 0x8D, 0x69, 0x91, 0x27, 0x8D, 0x27, 0x8D, 
-    0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0xEB, 0x99, 0xEB, 0x99, 0x69, 0x91, 0x69, 
-    0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 
-    0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x2C, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x2C, 
-    0x91, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xEB, 0x84, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x2C, 0x91, 0x08, 0x99, 0x2C, 0x91, 0x08, 
-    0x99, 0xEA, 0x94, 0x08, 0x99, 0xEA, 0x94, 0xEA, 0x94, 0x08, 0x99, 0xC9, 0x94, 0x08, 0x99, 
-    0xC9, 0x94, 0x08, 0x99, 0xC9, 0x94, 0xC9, 0x94, 0xEA, 0x94, 0xC9, 0x94, 0x08, 0x99, 0xEA, 
-    0x94, 0x08, 0x99, 0xC9, 0x94, 0x08, 0x99, 0xEA, 0x94, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0x9D, 0x69, 0x91, 0xEA, 0x94, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0x29, 0x9D, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0xC9, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x69, 0x91, 0x08, 
-    0x99, 0x29, 0x9D, 0x69, 0x91, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0xEA, 0x94, 
-    0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0x29, 
-    0x9D, 0x08, 0x99, 0x08, 0x99, 0xC8, 0x90, 0xC8, 0x90, 0xC8, 0x90, 0xC9, 0x94, 0xC9, 0x94, 
-    0xC8, 0x90, 0xA7, 0x90, 0xC8, 0x90, 0xC9, 0x94, 0xC8, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 
-    0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC8, 0x90, 0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 0xC8, 0x90, 
-    0xC8, 0x90, 0xC8, 0x90, 0xEA, 0x94, 0x27, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 0x27, 
-    0x8D, 0x27, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 0x69, 0x91, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC8, 0x90, 0xC6, 
-    0x94, 0xC8, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA8, 0x88, 0xC8, 0x90, 0xC8, 
-    0x90, 0xC8, 0x90, 0xC6, 0x94, 0xC8, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 
-    0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xC8, 0x90, 0xC8, 0x90, 0xA7, 
-    0x90, 0x06, 0x89, 0xC8, 0x8C, 0x06, 0x89, 0xA7, 0x88, 0xA7, 0x88, 0x84, 0x8C, 0x86, 0x8C, 
-    0x84, 0x8C, 0x65, 0x88, 0x86, 0x88, 0x25, 0x80, 0x64, 0x88, 0x65, 0x88, 0x64, 0x88, 0x64, 
-    0x88, 0xA7, 0x90, 0x23, 0x84, 0xC7, 0x98, 0xC6, 0x94, 0x21, 0x84, 0xE8, 0xA0, 0x66, 0x8C, 
-    0x63, 0x8C, 0xE7, 0x9C, 0x26, 0x80, 0xA5, 0x94, 0xA7, 0x90, 0x23, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x01, 0x80, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 
-    0x94, 0xC8, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC8, 0x8C, 0xC6, 0x94, 0xC8, 0x8C, 0xC8, 0x8C, 0x08, 
-    0x99, 0xC8, 0x8C, 0xC8, 0x8C, 0xC6, 0x94, 0xC8, 0x8C, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 
-    0xC6, 0x94, 0xA7, 0x90, 0xA8, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 
-    0x90, 0xC8, 0x8C, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xC8, 0x8C, 
-    0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0x27, 0x8D, 0xC9, 0x94, 0x27, 0x8D, 0xE9, 
-    0x8C, 0xC8, 0x8C, 0xC8, 0x8C, 0xC8, 0x8C, 0xC8, 0x8C, 0xE9, 0x8C, 0xC8, 0x8C, 0xC8, 0x8C, 
-    0xE9, 0x8C, 0xC8, 0x8C, 0xE9, 0x8C, 0x08, 0x99, 0xC8, 0x8C, 0xC6, 0x94, 0xC8, 0x8C, 0xE9, 
-    0x8C, 0xC6, 0x94, 0x08, 0x99, 0xC8, 0x90, 0xA5, 0x90, 0xC8, 0x8C, 0x08, 0x99, 0xC8, 0x90, 
-    0xE9, 0x8C, 0xC9, 0x94, 0xC8, 0x8C, 0xC8, 0x8C, 0x08, 0x99, 0x08, 0x99, 0xA7, 0x90, 0x08, 
-    0x99, 0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 
-    0xA7, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 
-    0x90, 0xC6, 0x94, 0xC8, 0x90, 0xC9, 0x94, 0xA7, 0x90, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 
-    0x08, 0x99, 0xC8, 0x8C, 0xC7, 0x98, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC9, 0x94, 0xE9, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0xC9, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 
-    0x99, 0x29, 0x9D, 0x29, 0x9D, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x94, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC8, 0x90, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 
-    0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 
-    0xE9, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 
-    0x88, 0xA5, 0x90, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x65, 0x88, 0x84, 0x8C, 0x86, 0x88, 
-    0x84, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x63, 0x8C, 0x66, 0x8C, 0x84, 0x8C, 0x86, 
-    0x88, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x86, 0x88, 
-    0x84, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x84, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0x84, 0x90, 0x84, 
-    0x8C, 0x85, 0x88, 0x84, 0x90, 0x85, 0x88, 0x84, 0x8C, 0x65, 0x88, 0x64, 0x88, 0x64, 0x88, 
-    0x25, 0x80, 0x64, 0x88, 0x44, 0x84, 0x25, 0x80, 0x65, 0x88, 0x65, 0x88, 0x44, 0x84, 0x65, 
-    0x88, 0x25, 0x80, 0xC7, 0x98, 0x63, 0x8C, 0xA6, 0x94, 0xA5, 0x90, 0x23, 0x80, 0xC7, 0x98, 
-    0x86, 0x88, 0x85, 0x88, 0xA5, 0x94, 0x45, 0x88, 0xA5, 0x94, 0xA5, 0x94, 0x24, 0x80, 0x23, 
-    0x80, 0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC8, 0x8C, 0xA5, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0x08, 
-    0x99, 0xC8, 0x8C, 0x08, 0x99, 0x08, 0x99, 0x06, 0x89, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC8, 0x8C, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC8, 
-    0x90, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 
-    0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC8, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xA7, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0x06, 0x89, 
-    0xC8, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC9, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 
-    0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 
-    0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC8, 0x90, 
-    0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC8, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA7, 0x88, 0x63, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0x86, 0x8C, 
-    0x64, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x66, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x64, 
-    0x88, 0x86, 0x8C, 0x64, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0x63, 0x8C, 0x86, 0x8C, 0x85, 0x88, 
-    0x86, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 0x84, 0x8C, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 
-    0x90, 0x86, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x84, 0x8C, 0x64, 0x88, 
-    0x64, 0x88, 0x64, 0x88, 0x25, 0x80, 0x64, 0x88, 0x64, 0x88, 0x44, 0x84, 0x65, 0x88, 0x44, 
-    0x84, 0x65, 0x88, 0x65, 0x88, 0xC7, 0x98, 0x43, 0x84, 0xA7, 0x90, 0xA5, 0x94, 0x24, 0x80, 
-    0xE7, 0x9C, 0x66, 0x8C, 0x45, 0x88, 0xA5, 0x94, 0x25, 0x80, 0xA5, 0x94, 0x67, 0x8C, 0x02, 
-    0x80, 0x23, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 
-    0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 
-    0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 
-    0x06, 0x89, 0xA5, 0x94, 0xC8, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC8, 
-    0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 
-    0xA7, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xA5, 0x90, 0xC8, 0x8C, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 
-    0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xA7, 0x90, 0xC8, 0x8C, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 
-    0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 
-    0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xA5, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC8, 0x8C, 0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0x84, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x94, 0x86, 0x8C, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 
-    0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x06, 0x89, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 
-    0x94, 0xA5, 0x90, 0xA7, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x90, 0x86, 0x8C, 0x84, 0x8C, 
-    0x86, 0x8C, 0x84, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x86, 0x8C, 0x63, 0x8C, 0x85, 
-    0x88, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x88, 0x64, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x84, 0x8C, 
-    0x86, 0x8C, 0x84, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x63, 0x8C, 0xA7, 0x90, 0x84, 0x8C, 0xA7, 
-    0x88, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x86, 0x88, 0x63, 0x8C, 0x86, 0x88, 
-    0x64, 0x88, 0x25, 0x80, 0x64, 0x88, 0x44, 0x84, 0x64, 0x84, 0x64, 0x84, 0x86, 0x88, 0x64, 
-    0x88, 0x86, 0x88, 0x44, 0x84, 0x65, 0x88, 0xC7, 0x98, 0x23, 0x84, 0xC7, 0x98, 0xA5, 0x90, 
-    0x24, 0x80, 0xE7, 0x9C, 0x45, 0x88, 0x84, 0x8C, 0x67, 0x8C, 0x43, 0x84, 0xA5, 0x94, 0xA5, 
-    0x94, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 
-    0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC8, 0x8C, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x65, 
-    0x88, 0x44, 0x84, 0x44, 0x84, 0x84, 0x8C, 0x86, 0x88, 0x44, 0x84, 0x86, 0x8C, 0xA5, 0x90, 
-    0x65, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0x64, 0x84, 0x86, 0x88, 0x65, 0x88, 0x84, 
-    0x8C, 0xA5, 0x90, 0x87, 0x84, 0xA5, 0x90, 0x85, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 
-    0x84, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 
-    0x8C, 0xA7, 0x90, 0x86, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0xC8, 0x8C, 
-    0xA5, 0x90, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x85, 0x88, 0xA5, 0x90, 0xA5, 
-    0x90, 0xC8, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0x84, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA7, 0x90, 0xC6, 0x94, 0x84, 0x8C, 0x84, 0x8C, 0x85, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0x85, 
-    0x88, 0x65, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x86, 0x88, 0xEA, 0x94, 0x08, 0x99, 0xC8, 0x8C, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0x84, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x88, 0x86, 
-    0x88, 0xA7, 0x90, 0xA5, 0x90, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0xC9, 0x94, 0xA5, 0x90, 
-    0xA5, 0x90, 0x84, 0x8C, 0x84, 0x8C, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x8C, 0x84, 
-    0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x08, 0x99, 0xA5, 0x90, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 
-    0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0x85, 0x88, 0x86, 0x8C, 0x63, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 
-    0xA7, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x86, 
-    0x88, 0x84, 0x8C, 0x64, 0x88, 0x86, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 
-    0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x63, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x84, 0x90, 0xA7, 
-    0x88, 0x84, 0x90, 0x85, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x44, 0x84, 0x86, 0x8C, 0x64, 0x88, 
-    0x84, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x25, 0x80, 0x64, 0x88, 0x44, 0x84, 0x25, 0x80, 0x85, 
-    0x88, 0x64, 0x88, 0x64, 0x88, 0x44, 0x84, 0x64, 0x84, 0xC6, 0x94, 0x23, 0x84, 0xA7, 0x90, 
-    0xA5, 0x94, 0x24, 0x80, 0xA6, 0x94, 0x66, 0x8C, 0x85, 0x88, 0xA6, 0x94, 0x45, 0x88, 0xA5, 
-    0x94, 0xA7, 0x90, 0x23, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA7, 0x88, 
-    0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 
-    0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0x84, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x01, 0x80, 0x42, 0x80, 0x65, 
-    0x88, 0x86, 0x88, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x88, 0x85, 0x88, 
-    0x23, 0x84, 0x21, 0x84, 0x01, 0x80, 0x63, 0x88, 0x65, 0x88, 0x86, 0x88, 0x43, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x02, 0x80, 0x84, 0x8C, 0x86, 0x8C, 0x22, 0x84, 0x22, 0x84, 0x65, 0x88, 
-    0xA5, 0x90, 0x22, 0x84, 0x22, 0x84, 0x84, 0x8C, 0x22, 0x84, 0x42, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x42, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0x21, 0x80, 0x42, 0x84, 0x42, 0x88, 
-    0x85, 0x88, 0x44, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x84, 0x64, 0x84, 0x63, 
-    0x88, 0x02, 0x80, 0x23, 0x84, 0xC6, 0x94, 0x22, 0x84, 0x23, 0x84, 0x43, 0x84, 0xC6, 0x94, 
-    0xA7, 0x90, 0x65, 0x88, 0x84, 0x8C, 0x23, 0x84, 0x21, 0x84, 0x42, 0x88, 0x84, 0x8C, 0x86, 
-    0x88, 0x42, 0x88, 0x23, 0x84, 0x22, 0x84, 0x21, 0x84, 0x63, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 
-    0xA7, 0x88, 0x08, 0x99, 0x23, 0x84, 0x63, 0x8C, 0x08, 0x99, 0x21, 0x84, 0x21, 0x84, 0x01, 
-    0x80, 0x63, 0x88, 0x84, 0x8C, 0x85, 0x88, 0x63, 0x8C, 0x21, 0x84, 0x21, 0x84, 0x84, 0x8C, 
-    0xC8, 0x8C, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x84, 0x42, 0x84, 0x42, 0x88, 0x21, 
-    0x84, 0x63, 0x88, 0x42, 0x84, 0x42, 0x84, 0xA5, 0x90, 0xA5, 0x90, 0x44, 0x84, 0x42, 0x88, 
-    0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x08, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0x84, 0x90, 0xA7, 0x88, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0x06, 0x89, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0x84, 0x90, 0x85, 0x88, 0x86, 0x88, 0x84, 0x8C, 
-    0xA7, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x90, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x85, 
-    0x88, 0x85, 0x88, 0x66, 0x8C, 0x65, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0x64, 0x88, 
-    0x86, 0x8C, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x84, 0x8C, 0xA5, 
-    0x90, 0x84, 0x90, 0x86, 0x88, 0x84, 0x90, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x84, 0x8C, 
-    0x86, 0x8C, 0x85, 0x88, 0x64, 0x88, 0x23, 0x80, 0x64, 0x88, 0x44, 0x84, 0x25, 0x80, 0x85, 
-    0x88, 0x65, 0x88, 0x65, 0x88, 0x44, 0x84, 0x65, 0x88, 0x25, 0x80, 0xC7, 0x98, 0x23, 0x84, 
-    0x08, 0x99, 0xA5, 0x90, 0x23, 0x80, 0xC7, 0x98, 0x46, 0x84, 0x64, 0x88, 0xA7, 0x90, 0x43, 
-    0x84, 0xA5, 0x94, 0x66, 0x8C, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 
-    0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 
-    0x8C, 0xC6, 0x94, 0xC9, 0x94, 0x06, 0x89, 0xC9, 0x94, 0xA5, 0x90, 0xC9, 0x94, 0xC6, 0x94, 
-    0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0x84, 0x8C, 0x22, 0x84, 0x84, 0x90, 0x08, 0x99, 0xA5, 
-    0x94, 0x84, 0x90, 0x84, 0x8C, 0x21, 0x84, 0x21, 0x84, 0x08, 0x99, 0x2A, 0xA9, 0x08, 0x99, 
-    0x63, 0x8C, 0x21, 0x84, 0x84, 0x90, 0xE7, 0x9C, 0x84, 0x8C, 0x44, 0x84, 0x65, 0x88, 0x21, 
-    0x84, 0x84, 0x90, 0xE7, 0x9C, 0xA5, 0x94, 0x21, 0x84, 0x84, 0x90, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0xA5, 0x90, 0x63, 0x8C, 0x22, 0x84, 0xA7, 0x90, 0x22, 0x84, 0x63, 0x88, 0xA5, 
-    0x90, 0xA5, 0x90, 0x22, 0x84, 0x43, 0x84, 0xA5, 0x90, 0x64, 0x88, 0x22, 0x84, 0x84, 0x90, 
-    0x22, 0x84, 0x64, 0x88, 0xA7, 0x90, 0x22, 0x84, 0xC7, 0x98, 0x09, 0xA5, 0xA5, 0x90, 0x63, 
-    0x8C, 0x08, 0x99, 0xA5, 0x90, 0x63, 0x8C, 0x42, 0x88, 0x21, 0x84, 0xA5, 0x94, 0x08, 0x99, 
-    0xA5, 0x90, 0xA7, 0x88, 0x63, 0x8C, 0x21, 0x84, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x94, 0x21, 
-    0x84, 0x85, 0x88, 0x63, 0x88, 0x84, 0x90, 0xE8, 0xA0, 0xE7, 0x9C, 0x21, 0x84, 0x84, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x63, 0x8C, 0x63, 0x8C, 0x08, 0x99, 0x21, 0x84, 0x84, 
-    0x90, 0x29, 0x9D, 0x29, 0x9D, 0xC6, 0x94, 0x42, 0x88, 0x84, 0x90, 0x08, 0x99, 0xC6, 0x94, 
-    0x86, 0x8C, 0xC6, 0x94, 0x29, 0x9D, 0x08, 0x99, 0x21, 0x84, 0x84, 0x8C, 0x08, 0x99, 0x0A, 
-    0x99, 0x21, 0x84, 0x21, 0x84, 0xE7, 0x9C, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x8C, 
-    0xA5, 0x94, 0x21, 0x84, 0x21, 0x84, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xE8, 0xA0, 0xC8, 
-    0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 0x88, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0x86, 0x88, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0x08, 
-    0x99, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0x65, 0x88, 0x86, 0x88, 0xA5, 0x90, 
-    0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0x64, 0x88, 0xA7, 0x88, 0x84, 0x8C, 
-    0x86, 0x8C, 0x64, 0x88, 0x86, 0x8C, 0x64, 0x88, 0x86, 0x8C, 0x84, 0x8C, 0xA7, 0x88, 0x84, 
-    0x8C, 0x86, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0x66, 0x8C, 
-    0x85, 0x88, 0x86, 0x8C, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x84, 
-    0x90, 0x86, 0x8C, 0xA5, 0x90, 0x64, 0x88, 0xA5, 0x90, 0x64, 0x88, 0x86, 0x8C, 0x64, 0x88, 
-    0x86, 0x8C, 0x64, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x25, 0x80, 0x44, 0x84, 0xA7, 0x88, 0x23, 
-    0x84, 0x86, 0x88, 0x85, 0x88, 0x44, 0x84, 0x64, 0x84, 0x25, 0x80, 0x65, 0x88, 0xC8, 0x90, 
-    0x63, 0x88, 0xC6, 0x94, 0xA5, 0x90, 0x24, 0x80, 0xA5, 0x94, 0x86, 0x88, 0x85, 0x88, 0xA5, 
-    0x94, 0x45, 0x88, 0x66, 0x8C, 0xA5, 0x94, 0x23, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 
-    0x84, 0x8C, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 
-    0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 
-    0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0x84, 0x90, 0x63, 
-    0x8C, 0xA7, 0x90, 0xC6, 0x94, 0x43, 0x84, 0x84, 0x90, 0x84, 0x90, 0x23, 0x80, 0x63, 0x88, 
-    0x85, 0x88, 0x84, 0x90, 0x84, 0x8C, 0x08, 0x99, 0x0B, 0x99, 0x6B, 0xA1, 0xE8, 0xA0, 0x85, 
-    0x88, 0x84, 0x90, 0xE8, 0xA0, 0x08, 0x99, 0xC7, 0x98, 0x84, 0x90, 0x84, 0x8C, 0xA5, 0x94, 
-    0x84, 0x90, 0x84, 0x8C, 0x22, 0x84, 0x63, 0x8C, 0x63, 0x8C, 0xA5, 0x90, 0x43, 0x84, 0x63, 
-    0x88, 0x08, 0x99, 0x08, 0x99, 0x43, 0x84, 0x63, 0x8C, 0xC6, 0x94, 0x22, 0x84, 0x22, 0x84, 
-    0xC9, 0x94, 0x22, 0x84, 0x84, 0x8C, 0xC7, 0x98, 0x84, 0x8C, 0xA5, 0x90, 0x63, 0x8C, 0x84, 
-    0x8C, 0xA5, 0x90, 0xA7, 0x90, 0x08, 0x99, 0x84, 0x90, 0x63, 0x8C, 0x84, 0x90, 0x08, 0x99, 
-    0x86, 0x8C, 0xA7, 0x90, 0x86, 0x8C, 0x84, 0x8C, 0x84, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0x84, 0x90, 0xA5, 0x94, 0xA5, 0x90, 0x84, 0x90, 0x63, 0x88, 0x63, 0x8C, 0xA5, 0x94, 
-    0xC6, 0x94, 0xA5, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x63, 0x8C, 0x84, 0x90, 0x08, 0x99, 0x84, 
-    0x90, 0xA5, 0x94, 0x84, 0x90, 0x84, 0x90, 0x85, 0x88, 0x84, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x64, 0x88, 0xA5, 0x90, 0x08, 
-    0x99, 0x08, 0x99, 0x43, 0x84, 0x84, 0x8C, 0x08, 0x99, 0x84, 0x90, 0x84, 0x8C, 0x44, 0x84, 
-    0x63, 0x8C, 0xC7, 0x98, 0x21, 0x84, 0x21, 0x84, 0x84, 0x90, 0x42, 0x88, 0x08, 0x99, 0xE7, 
-    0x9C, 0xE7, 0x9C, 0xE7, 0x9C, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x88, 0x85, 0x88, 0x84, 0x90, 
-    0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xC8, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x88, 0xA5, 0x90, 
-    0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0x86, 0x88, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0x06, 0x89, 0xA5, 0x90, 0x86, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 
-    0x86, 0x8C, 0x85, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x84, 0x8C, 0x86, 
-    0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 
-    0x86, 0x88, 0x63, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0xA5, 0x90, 0x86, 0x8C, 0x63, 0x8C, 0x84, 
-    0x8C, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x64, 0x88, 
-    0x84, 0x8C, 0x85, 0x88, 0x63, 0x8C, 0x65, 0x88, 0x44, 0x84, 0x64, 0x84, 0x25, 0x80, 0x64, 
-    0x84, 0x64, 0x84, 0x85, 0x88, 0x64, 0x88, 0x44, 0x84, 0x64, 0x84, 0x65, 0x88, 0x64, 0x88, 
-    0xA5, 0x94, 0x25, 0x80, 0xC7, 0x98, 0xA5, 0x90, 0x23, 0x80, 0xC7, 0x98, 0x43, 0x84, 0x66, 
-    0x8C, 0xA5, 0x94, 0x25, 0x80, 0xA5, 0x94, 0x67, 0x8C, 0x23, 0x80, 0x24, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x84, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 
-    0xC9, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 
-    0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0x84, 0x8C, 0x08, 0x99, 0xC6, 
-    0x94, 0xA5, 0x94, 0x63, 0x8C, 0x43, 0x84, 0x67, 0x8C, 0x84, 0x90, 0x84, 0x90, 0x08, 0x99, 
-    0xE8, 0xA0, 0xA7, 0x90, 0x84, 0x90, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x88, 0xC6, 
-    0x94, 0xA5, 0x90, 0x84, 0x90, 0xA7, 0x90, 0x86, 0x8C, 0xA5, 0x94, 0x84, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA6, 0x94, 0xC7, 0x98, 0x63, 0x8C, 0x22, 0x84, 0x84, 0x90, 0xA5, 0x90, 0x63, 
-    0x8C, 0x63, 0x88, 0xC6, 0x94, 0xC6, 0x94, 0x63, 0x8C, 0x84, 0x90, 0xA5, 0x90, 0x84, 0x8C, 
-    0x84, 0x90, 0xC7, 0x98, 0x84, 0x90, 0x84, 0x8C, 0xC6, 0x94, 0x84, 0x90, 0xA5, 0x90, 0x63, 
-    0x8C, 0x84, 0x90, 0x08, 0x99, 0xA5, 0x90, 0xC8, 0x90, 0xC7, 0x98, 0x84, 0x90, 0x08, 0x99, 
-    0xA7, 0x90, 0xA7, 0x88, 0x85, 0x88, 0x84, 0x90, 0xC6, 0x94, 0x84, 0x90, 0xC7, 0x98, 0xC6, 
-    0x94, 0xC9, 0x94, 0x84, 0x90, 0x08, 0x99, 0xA5, 0x90, 0x84, 0x90, 0xC7, 0x98, 0xC7, 0x98, 
-    0x84, 0x8C, 0x84, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xA7, 0x90, 0x84, 0x90, 0xC6, 0x94, 0x08, 
-    0x99, 0x84, 0x90, 0xA5, 0x94, 0xE7, 0x9C, 0x29, 0x9D, 0xA6, 0x94, 0x84, 0x90, 0xA5, 0x94, 
-    0xC6, 0x94, 0xA7, 0x88, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x84, 0x90, 0xA5, 
-    0x90, 0xC9, 0x94, 0xE7, 0x9C, 0x84, 0x90, 0xA5, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0x42, 0x88, 
-    0x66, 0x8C, 0x63, 0x8C, 0xA7, 0x88, 0x21, 0x84, 0x63, 0x8C, 0x08, 0x99, 0xE7, 0x9C, 0x08, 
-    0x99, 0xE7, 0x9C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0x85, 0x88, 0x84, 0x90, 
-    0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 
-    0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x88, 0x63, 0x8C, 0xA7, 0x88, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0x86, 0x88, 
-    0x84, 0x8C, 0x66, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0x85, 0x88, 0x63, 0x8C, 0x86, 0x8C, 0x64, 
-    0x88, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 
-    0x86, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x86, 
-    0x8C, 0x84, 0x8C, 0xA5, 0x90, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x85, 0x88, 0x64, 0x88, 
-    0x86, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x44, 0x84, 0xA7, 0x88, 0x44, 0x84, 0x23, 0x84, 0x65, 
-    0x88, 0x44, 0x84, 0x64, 0x84, 0x85, 0x88, 0x44, 0x84, 0x65, 0x88, 0x44, 0x84, 0x25, 0x80, 
-    0x65, 0x88, 0xA5, 0x90, 0x23, 0x80, 0xC7, 0x98, 0xA7, 0x90, 0x02, 0x80, 0xC7, 0x98, 0x46, 
-    0x84, 0x86, 0x8C, 0xA5, 0x94, 0x45, 0x88, 0x66, 0x8C, 0x84, 0x90, 0x23, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x01, 0x80, 0xA5, 0x90, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 
-    0x99, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC9, 0x94, 
-    0x06, 0x89, 0xC8, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x88, 0x22, 
-    0x84, 0x63, 0x8C, 0xC9, 0x94, 0x84, 0x90, 0x84, 0x90, 0x85, 0x88, 0x84, 0x90, 0x84, 0x90, 
-    0xA7, 0x90, 0xC7, 0x98, 0xA5, 0x94, 0xC6, 0x94, 0x84, 0x90, 0x84, 0x8C, 0xA5, 0x90, 0x84, 
-    0x8C, 0x63, 0x8C, 0xC9, 0x94, 0x84, 0x90, 0x63, 0x8C, 0xA5, 0x90, 0x84, 0x8C, 0x84, 0x90, 
-    0x08, 0x99, 0xA5, 0x94, 0xC6, 0x94, 0x29, 0x9D, 0xC6, 0x94, 0x63, 0x8C, 0x84, 0x90, 0xA5, 
-    0x90, 0x84, 0x90, 0x63, 0x88, 0xC6, 0x94, 0xC6, 0x94, 0x84, 0x8C, 0xA5, 0x94, 0xA5, 0x90, 
-    0x84, 0x90, 0x84, 0x90, 0x63, 0x88, 0x84, 0x8C, 0x84, 0x90, 0xA5, 0x90, 0x84, 0x90, 0xC9, 
-    0x94, 0x08, 0x99, 0x84, 0x90, 0x84, 0x8C, 0xA8, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0x84, 0x90, 
-    0x08, 0x99, 0x86, 0x8C, 0x86, 0x8C, 0xA5, 0x94, 0xA7, 0x88, 0x08, 0x99, 0x84, 0x90, 0x84, 
-    0x8C, 0x84, 0x8C, 0x84, 0x90, 0x84, 0x90, 0x08, 0x99, 0xC6, 0x94, 0x84, 0x90, 0x08, 0x99, 
-    0xC6, 0x94, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x84, 0x90, 0xA5, 
-    0x94, 0x08, 0x99, 0x84, 0x90, 0xA5, 0x94, 0xE7, 0x9C, 0xC7, 0x98, 0xEA, 0x94, 0x84, 0x90, 
-    0x84, 0x90, 0xA5, 0x90, 0x63, 0x88, 0x63, 0x88, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x84, 
-    0x90, 0xA5, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x84, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA6, 0x94, 
-    0x84, 0x90, 0x42, 0x88, 0xA5, 0x94, 0xA5, 0x90, 0x44, 0x84, 0x84, 0x8C, 0xC6, 0x94, 0xA6, 
-    0x94, 0xC7, 0x98, 0xC7, 0x98, 0xA5, 0x90, 0x86, 0x88, 0x86, 0x88, 0x85, 0x88, 0xA7, 0x88, 
-    0x84, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x88, 0x86, 0x88, 0xA7, 0x88, 0x84, 0x8C, 0xA7, 
-    0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 
-    0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 
-    0x84, 0x8C, 0x86, 0x8C, 0x65, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x85, 
-    0x88, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 
-    0x86, 0x8C, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0x66, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x63, 
-    0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 
-    0x86, 0x8C, 0x63, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x64, 
-    0x88, 0x86, 0x88, 0x25, 0x80, 0x64, 0x88, 0x64, 0x88, 0x44, 0x84, 0x64, 0x84, 0x85, 0x88, 
-    0x64, 0x88, 0x44, 0x84, 0xA7, 0x88, 0x23, 0x84, 0xC7, 0x98, 0xA7, 0x88, 0x23, 0x80, 0xA5, 
-    0x94, 0x65, 0x88, 0x45, 0x88, 0xA5, 0x94, 0x45, 0x88, 0xA5, 0x94, 0x67, 0x8C, 0x42, 0x84, 
-    0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x06, 
-    0x89, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 
-    0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC7, 
-    0x98, 0xC7, 0x98, 0x64, 0x88, 0x63, 0x88, 0x84, 0x90, 0xE8, 0xA0, 0xA5, 0x90, 0x84, 0x90, 
-    0x84, 0x90, 0x64, 0x88, 0x42, 0x88, 0x84, 0x8C, 0x08, 0x99, 0xA6, 0x94, 0x63, 0x8C, 0x84, 
-    0x8C, 0xA5, 0x94, 0x08, 0x99, 0x29, 0x9D, 0xE7, 0x9C, 0x84, 0x90, 0x63, 0x88, 0xA5, 0x90, 
-    0x29, 0x9D, 0xC9, 0x94, 0xA6, 0x94, 0xC6, 0x94, 0x29, 0x9D, 0x29, 0x9D, 0xA5, 0x90, 0x84, 
-    0x90, 0xC7, 0x98, 0x63, 0x88, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0xA5, 0x90, 0x08, 0x99, 
-    0xA7, 0x90, 0x84, 0x90, 0xC6, 0x94, 0x29, 0x9D, 0x29, 0x9D, 0xA5, 0x90, 0x84, 0x90, 0x84, 
-    0x90, 0xA6, 0x94, 0xEA, 0x94, 0xC6, 0x94, 0x84, 0x90, 0x86, 0x8C, 0xC9, 0x94, 0xA5, 0x94, 
-    0x84, 0x90, 0x29, 0x9D, 0xC9, 0x94, 0x27, 0x8D, 0xEA, 0x94, 0x08, 0x99, 0x29, 0x9D, 0x08, 
-    0x99, 0xA5, 0x94, 0x64, 0x88, 0x63, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xA5, 0x94, 
-    0x84, 0x8C, 0x63, 0x8C, 0x84, 0x90, 0x29, 0x9D, 0xE7, 0x9C, 0xA5, 0x90, 0x63, 0x8C, 0xA5, 
-    0x94, 0x29, 0x9D, 0x08, 0x99, 0x84, 0x90, 0x63, 0x8C, 0x64, 0x88, 0x63, 0x8C, 0xC6, 0x94, 
-    0x08, 0x99, 0x84, 0x90, 0x63, 0x8C, 0x84, 0x8C, 0x08, 0x99, 0xE7, 0x9C, 0x08, 0x99, 0x08, 
-    0x99, 0x84, 0x90, 0xA5, 0x90, 0x08, 0x99, 0x08, 0x99, 0x84, 0x90, 0x84, 0x90, 0xC8, 0x90, 
-    0xC9, 0x94, 0x84, 0x90, 0x84, 0x90, 0xC7, 0x98, 0x86, 0x88, 0x21, 0x84, 0x21, 0x84, 0x63, 
-    0x8C, 0x23, 0x84, 0x63, 0x88, 0xC8, 0x8C, 0xC7, 0x98, 0xC8, 0x8C, 0x86, 0x88, 0xA5, 0x90, 
-    0x86, 0x88, 0x86, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0x84, 0x90, 0x86, 0x88, 0x84, 
-    0x8C, 0x86, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 
-    0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 
-    0xA7, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0x86, 0x88, 0xA7, 0x88, 0x84, 0x90, 0x86, 0x8C, 0xA5, 
-    0x90, 0x86, 0x8C, 0xA5, 0x90, 0x86, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xC6, 0x94, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x64, 0x88, 0x86, 
-    0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 
-    0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0x63, 0x8C, 0x86, 
-    0x88, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x85, 0x88, 
-    0x63, 0x8C, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x63, 
-    0x8C, 0x44, 0x84, 0x64, 0x84, 0x64, 0x84, 0x65, 0x88, 0x86, 0x88, 0x44, 0x84, 0x64, 0x84, 
-    0x86, 0x88, 0x25, 0x80, 0x64, 0x88, 0xA5, 0x94, 0x25, 0x80, 0xC7, 0x98, 0xA7, 0x90, 0x02, 
-    0x80, 0xA5, 0x94, 0x45, 0x88, 0x84, 0x8C, 0xC8, 0x90, 0x23, 0x80, 0x66, 0x8C, 0xA5, 0x94, 
-    0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 
-    0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 
-    0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 
-    0x90, 0xC6, 0x94, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 0xA7, 0x90, 
-    0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 
-    0x99, 0x29, 0x9D, 0x08, 0x99, 0xA7, 0x90, 0xA5, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x29, 0x9D, 
-    0x29, 0x9D, 0xE7, 0x9C, 0xC7, 0x98, 0x08, 0x99, 0x29, 0x9D, 0xA7, 0x90, 0x08, 0x99, 0x29, 
-    0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x08, 0x99, 0xC6, 0x94, 0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x29, 
-    0x9D, 0x29, 0x9D, 0x08, 0x99, 0xA7, 0x90, 0x09, 0xA5, 0x08, 0x99, 0x08, 0x99, 0xA7, 0x90, 
-    0xE8, 0xA0, 0x29, 0x9D, 0x29, 0x9D, 0xA7, 0x90, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 
-    0x99, 0x29, 0x9D, 0x6B, 0xA1, 0x6B, 0xA1, 0x29, 0x9D, 0x08, 0x99, 0xA7, 0x90, 0xE8, 0xA0, 
-    0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x6B, 
-    0xA1, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x6B, 0xA1, 0x6B, 0xA1, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xC8, 0x90, 0xC6, 
-    0x94, 0x08, 0x99, 0x29, 0x9D, 0xC6, 0x94, 0xE7, 0x9C, 0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 
-    0xA7, 0x90, 0x86, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0xEA, 0x94, 0xA7, 0x88, 0xC6, 0x94, 0xC6, 
-    0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC8, 0x8C, 0xC8, 0x8C, 0xC8, 0x8C, 0xA5, 0x90, 
-    0x86, 0x88, 0x84, 0x90, 0x86, 0x8C, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x84, 
-    0x8C, 0x86, 0x88, 0x86, 0x8C, 0x66, 0x8C, 0x84, 0x8C, 0xA7, 0x90, 0xA5, 0x90, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x06, 0x89, 0xC8, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 
-    0x88, 0x84, 0x90, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0xA7, 0x88, 
-    0xA5, 0x90, 0x84, 0x8C, 0xA7, 0x88, 0x63, 0x8C, 0x86, 0x8C, 0x64, 0x88, 0x86, 0x8C, 0x85, 
-    0x88, 0x85, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 
-    0x84, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x64, 0x88, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x86, 
-    0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 
-    0x63, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 
-    0x90, 0x43, 0x84, 0x25, 0x80, 0x85, 0x88, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 
-    0x44, 0x84, 0x25, 0x80, 0x85, 0x88, 0x64, 0x88, 0xC8, 0x90, 0x63, 0x8C, 0xC7, 0x98, 0x86, 
-    0x8C, 0x23, 0x80, 0xE7, 0x9C, 0x86, 0x88, 0x45, 0x88, 0xA6, 0x94, 0x45, 0x88, 0xA5, 0x94, 
-    0x66, 0x8C, 0x23, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xA7, 0x90, 
-    0xA5, 0x90, 0xC8, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0x67, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 
-    0xA5, 0x94, 0xA8, 0x88, 0xA5, 0x94, 0x67, 0x8C, 0xA5, 0x90, 0xC8, 0x90, 0xA5, 0x94, 0xC8, 
-    0x90, 0xC6, 0x94, 0xC8, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xC8, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC8, 0x90, 0xA5, 0x90, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC8, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 
-    0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC7, 0x98, 0xC9, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 
-    0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xE9, 0x8C, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC9, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0xC6, 0x94, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xEA, 0x94, 0xC6, 0x94, 0xC9, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xEA, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 
-    0xA5, 0x90, 0x08, 0x99, 0xC8, 0x90, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0xA7, 
-    0x88, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x86, 0x8C, 
-    0x65, 0x88, 0xA7, 0x88, 0x84, 0x8C, 0x86, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0x86, 
-    0x88, 0xA7, 0x88, 0x67, 0x8C, 0x86, 0x8C, 0x84, 0x90, 0xA8, 0x88, 0xA5, 0x90, 0x86, 0x8C, 
-    0x63, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x86, 
-    0x8C, 0x85, 0x88, 0x66, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA7, 0x88, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0x86, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x84, 0x8C, 0x86, 
-    0x8C, 0x64, 0x88, 0x86, 0x8C, 0x84, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x63, 0x8C, 
-    0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x86, 
-    0x8C, 0x84, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0xA5, 0x90, 0x86, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 
-    0x86, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 0x86, 
-    0x8C, 0x84, 0x90, 0x84, 0x8C, 0x65, 0x88, 0x64, 0x88, 0x86, 0x88, 0x23, 0x80, 0x64, 0x88, 
-    0x64, 0x88, 0x44, 0x84, 0x65, 0x88, 0x44, 0x84, 0x65, 0x88, 0xC7, 0x98, 0x23, 0x80, 0xC8, 
-    0x90, 0xA5, 0x90, 0x23, 0x80, 0xC7, 0x98, 0x45, 0x88, 0xA7, 0x88, 0xA5, 0x94, 0x25, 0x80, 
-    0x66, 0x8C, 0xA5, 0x94, 0x23, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA7, 0x88, 0x85, 0x88, 0x85, 0x88, 0xA7, 0x88, 0x85, 0x88, 0x86, 0x88, 
-    0x85, 0x88, 0x64, 0x88, 0x86, 0x88, 0x86, 0x88, 0x85, 0x88, 0x86, 0x88, 0x64, 0x88, 0x86, 
-    0x88, 0x25, 0x80, 0x86, 0x88, 0x44, 0x84, 0x86, 0x88, 0x44, 0x84, 0x86, 0x88, 0x25, 0x80, 
-    0x85, 0x88, 0x46, 0x84, 0x65, 0x88, 0x46, 0x84, 0x84, 0x8C, 0x86, 0x88, 0x25, 0x80, 0x86, 
-    0x88, 0x86, 0x88, 0x44, 0x84, 0x86, 0x88, 0x86, 0x88, 0x64, 0x84, 0x86, 0x88, 0x64, 0x88, 
-    0x87, 0x84, 0x64, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x88, 0x85, 0x88, 0x64, 0x88, 0x86, 
-    0x88, 0x86, 0x88, 0x86, 0x88, 0x64, 0x84, 0x86, 0x88, 0x44, 0x84, 0xA8, 0x88, 0x86, 0x8C, 
-    0x85, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x87, 0x84, 0x86, 0x88, 0x44, 0x84, 0x86, 
-    0x88, 0x86, 0x88, 0x25, 0x80, 0x86, 0x88, 0x86, 0x88, 0x64, 0x88, 0x86, 0x88, 0x86, 0x88, 
-    0x64, 0x88, 0x86, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x86, 0x88, 0xA7, 0x88, 0x86, 0x8C, 0x85, 
-    0x88, 0x86, 0x88, 0xA7, 0x88, 0x85, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0xA7, 0x88, 
-    0x86, 0x88, 0xA7, 0x88, 0x86, 0x88, 0x86, 0x88, 0x85, 0x88, 0xA7, 0x88, 0x44, 0x80, 0x86, 
-    0x88, 0x86, 0x88, 0x86, 0x88, 0x87, 0x84, 0x65, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 
-    0x86, 0x88, 0x86, 0x88, 0x44, 0x84, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0xA7, 0x88, 0x65, 
-    0x88, 0x86, 0x88, 0x86, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0xA7, 0x88, 0x64, 0x84, 
-    0x25, 0x80, 0x64, 0x84, 0x25, 0x80, 0x86, 0x88, 0x25, 0x80, 0x65, 0x88, 0x25, 0x80, 0x86, 
-    0x88, 0x25, 0x80, 0x25, 0x80, 0x64, 0x88, 0x64, 0x88, 0x46, 0x84, 0x44, 0x84, 0x44, 0x84, 
-    0x25, 0x80, 0x86, 0x88, 0x25, 0x80, 0x44, 0x84, 0x46, 0x84, 0x64, 0x84, 0x46, 0x84, 0x44, 
-    0x84, 0x25, 0x80, 0x44, 0x84, 0x25, 0x80, 0x44, 0x84, 0x25, 0x80, 0x44, 0x84, 0x86, 0x88, 
-    0x86, 0x88, 0x64, 0x84, 0x86, 0x88, 0x44, 0x84, 0x86, 0x88, 0x44, 0x84, 0x64, 0x84, 0x86, 
-    0x88, 0x64, 0x84, 0x86, 0x88, 0x44, 0x84, 0x44, 0x84, 0x86, 0x88, 0x44, 0x80, 0x86, 0x88, 
-    0x85, 0x88, 0x85, 0x88, 0x44, 0x84, 0x86, 0x88, 0x44, 0x80, 0x86, 0x88, 0x44, 0x84, 0x86, 
-    0x88, 0x44, 0x84, 0x86, 0x88, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 0x86, 0x88, 0x44, 0x84, 
-    0x64, 0x84, 0x44, 0x84, 0x65, 0x88, 0x44, 0x84, 0x46, 0x84, 0x46, 0x84, 0x26, 0x80, 0x46, 
-    0x84, 0x25, 0x80, 0x46, 0x84, 0x26, 0x80, 0x46, 0x84, 0x25, 0x80, 0x25, 0x80, 0x46, 0x84, 
-    0x46, 0x84, 0x26, 0x80, 0x46, 0x84, 0x46, 0x84, 0x25, 0x80, 0x25, 0x80, 0x46, 0x84, 0x27, 
-    0x80, 0x25, 0x80, 0x25, 0x80, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x27, 0x80, 
-    0x25, 0x80, 0x46, 0x84, 0x25, 0x80, 0x46, 0x84, 0x26, 0x80, 0x46, 0x84, 0x46, 0x84, 0x46, 
-    0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x26, 0x80, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 
-    0x64, 0x88, 0x64, 0x84, 0x64, 0x84, 0x25, 0x80, 0x65, 0x88, 0x44, 0x84, 0xC7, 0x98, 0x43, 
-    0x84, 0xC7, 0x98, 0xA7, 0x88, 0x23, 0x80, 0xE8, 0xA0, 0x67, 0x8C, 0x64, 0x88, 0xA5, 0x94, 
-    0x25, 0x80, 0xA5, 0x94, 0x66, 0x8C, 0x23, 0x80, 0x24, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 
-    0x90, 0xC6, 0x94, 0x06, 0x89, 0x84, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xC6, 0x94, 
-    0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0x86, 0x88, 0x05, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x05, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x05, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x44, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x44, 0x80, 
-    0x05, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0xA5, 0x90, 0xC7, 
-    0x98, 0x24, 0x80, 0xA5, 0x94, 0xA8, 0x88, 0x23, 0x80, 0xE7, 0x9C, 0x65, 0x88, 0x66, 0x8C, 
-    0xA7, 0x90, 0x45, 0x88, 0x86, 0x8C, 0x84, 0x90, 0x23, 0x80, 0x05, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 
-    0xA7, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 
-    0x94, 0x86, 0x8C, 0x46, 0x84, 0x24, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 0x21, 
-    0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x21, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 
-    0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 
-    0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x21, 0x80, 0xA5, 
-    0x94, 0xA7, 0x90, 0x02, 0x80, 0xC7, 0x98, 0x67, 0x8C, 0x23, 0x80, 0xA5, 0x94, 0x66, 0x8C, 
-    0xA5, 0x90, 0xC7, 0x98, 0x45, 0x88, 0x45, 0x88, 0xA5, 0x94, 0x24, 0x80, 0x02, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x84, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 
-    0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0x06, 0x89, 0xC6, 
-    0x94, 0xC8, 0x90, 0x64, 0x88, 0x24, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 
-    0x80, 0xA5, 0x94, 0xA5, 0x94, 0x23, 0x80, 0xA5, 0x94, 0xA7, 0x90, 0x02, 0x80, 0xC7, 0x98, 
-    0x86, 0x88, 0x63, 0x8C, 0xC7, 0x98, 0x45, 0x88, 0xA5, 0x94, 0xA7, 0x88, 0x24, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 
-    0x90, 0xC6, 0x94, 0xA7, 0x88, 0x65, 0x88, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x42, 0x84, 0xA5, 0x94, 0xE7, 0x9C, 0x24, 0x80, 0xA5, 0x94, 0x67, 0x8C, 0x23, 0x80, 
-    0xA7, 0x90, 0xA7, 0x88, 0x64, 0x88, 0xC8, 0x90, 0x45, 0x88, 0x84, 0x90, 0x67, 0x8C, 0x21, 
-    0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xE9, 0x8C, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x88, 0x65, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x63, 0x88, 0xC7, 0x98, 0xC7, 0x98, 0x24, 0x80, 0xA7, 0x90, 0xA5, 0x94, 
-    0x24, 0x80, 0xC7, 0x98, 0x66, 0x8C, 0x66, 0x8C, 0xC7, 0x98, 0x45, 0x88, 0xA5, 0x94, 0x86, 
-    0x88, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x06, 0x89, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC8, 
-    0x8C, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x64, 0x88, 0xC7, 0x98, 0xC7, 0x98, 0x02, 0x80, 0xA5, 0x94, 
-    0xA7, 0x90, 0x02, 0x80, 0xA5, 0x94, 0x66, 0x8C, 0x84, 0x8C, 0xE8, 0xA0, 0x45, 0x88, 0xA5, 
-    0x94, 0x86, 0x88, 0x02, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x8C, 0x08, 0x99, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 
-    0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0x44, 0x84, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xC8, 0x90, 0xC7, 0x98, 0x23, 0x80, 
-    0xA7, 0x90, 0xA5, 0x94, 0x24, 0x80, 0xA5, 0x94, 0x66, 0x8C, 0x84, 0x8C, 0xC7, 0x98, 0x45, 
-    0x88, 0xA5, 0x90, 0x66, 0x8C, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x06, 0x89, 0xA5, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0x64, 0x88, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xE8, 0xA0, 0xA6, 0x94, 
-    0x23, 0x80, 0xA7, 0x90, 0xA5, 0x94, 0x24, 0x80, 0xC7, 0x98, 0x67, 0x8C, 0x86, 0x88, 0xE7, 
-    0x9C, 0x45, 0x88, 0x65, 0x88, 0x85, 0x88, 0x23, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 
-    0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC8, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 
-    0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 0x94, 0xE8, 0xA0, 
-    0xA6, 0x94, 0x24, 0x80, 0xA5, 0x94, 0x86, 0x8C, 0x24, 0x80, 0xA5, 0x94, 0x86, 0x8C, 0x84, 
-    0x8C, 0xC7, 0x98, 0x45, 0x88, 0x66, 0x8C, 0x65, 0x88, 0x23, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x01, 0x80, 0x84, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 
-    0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC8, 0x8C, 
-    0xC6, 0x94, 0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x90, 
-    0xE7, 0x9C, 0xC7, 0x98, 0x02, 0x80, 0xA6, 0x94, 0xA7, 0x90, 0x23, 0x80, 0xC7, 0x98, 0x66, 
-    0x8C, 0x84, 0x8C, 0xC7, 0x98, 0x23, 0x80, 0xA5, 0x90, 0x85, 0x88, 0x24, 0x80, 0x23, 0x80, 
-    0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA5, 0x90, 0xC6, 0x94, 0x64, 0x88, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x84, 0x8C, 0xC7, 0x98, 0xC8, 0x90, 0x02, 0x80, 0xA6, 0x94, 0xA7, 0x88, 0x02, 0x80, 0xA5, 
-    0x94, 0xA7, 0x88, 0x45, 0x88, 0xC7, 0x98, 0x45, 0x88, 0x66, 0x8C, 0x85, 0x88, 0x23, 0x80, 
-    0x25, 0x80, 0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 
-    0x06, 0x89, 0xA5, 0x94, 0xA5, 0x90, 0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x84, 0x90, 0xC8, 0x90, 0xA5, 0x94, 0x23, 0x80, 0xA5, 0x94, 0xA7, 0x88, 0x23, 
-    0x80, 0xA6, 0x94, 0x45, 0x88, 0x84, 0x90, 0xA6, 0x94, 0x45, 0x88, 0xA5, 0x94, 0x45, 0x88, 
-    0x24, 0x80, 0x23, 0x84, 0x45, 0x88, 0x01, 0x80, 0x84, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0x06, 0x89, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x84, 0x90, 0xE7, 0x9C, 0xA5, 0x94, 0x23, 0x80, 0xA5, 0x94, 0x67, 
-    0x8C, 0x23, 0x80, 0xA5, 0x94, 0x67, 0x8C, 0x25, 0x80, 0xC7, 0x98, 0x25, 0x80, 0xA7, 0x88, 
-    0x66, 0x8C, 0x02, 0x80, 0x25, 0x80, 0x23, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xC6, 0x94, 0xA5, 
-    0x90, 0xC6, 0x94, 0x06, 0x89, 0xC6, 0x94, 0xC8, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x88, 
-    0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x64, 0x88, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xC8, 0x90, 0xA5, 0x94, 0x23, 0x80, 0xA6, 
-    0x94, 0x67, 0x8C, 0x24, 0x80, 0xA6, 0x94, 0x45, 0x88, 0x84, 0x8C, 0xC8, 0x90, 0x45, 0x88, 
-    0x84, 0x90, 0x86, 0x8C, 0x24, 0x80, 0x23, 0x80, 0x25, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xC6, 
-    0x94, 0x06, 0x89, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC8, 0x8C, 0xA5, 0x90, 0x86, 0x8C, 0x25, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x90, 0xC8, 0x90, 0xA6, 0x94, 0x23, 
-    0x80, 0xC8, 0x90, 0xA5, 0x94, 0x24, 0x80, 0xA5, 0x94, 0x66, 0x8C, 0x84, 0x8C, 0xA5, 0x94, 
-    0x45, 0x88, 0x84, 0x8C, 0xA7, 0x90, 0x02, 0x80, 0x25, 0x80, 0x24, 0x80, 0x01, 0x80, 0x84, 
-    0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0x86, 0x8C, 0x84, 0x90, 0x45, 
-    0x88, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x90, 0xC7, 0x98, 0xA5, 
-    0x94, 0x23, 0x80, 0xA5, 0x94, 0xA7, 0x90, 0x02, 0x80, 0xA7, 0x90, 0x45, 0x88, 0x65, 0x88, 
-    0xA7, 0x90, 0x45, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0x23, 0x80, 0x45, 0x88, 0x23, 0x80, 0x01, 
-    0x80, 0x84, 0x8C, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0x25, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xC7, 
-    0x98, 0xA7, 0x90, 0x02, 0x80, 0xA5, 0x94, 0x66, 0x8C, 0x24, 0x80, 0xA5, 0x94, 0x45, 0x88, 
-    0x66, 0x8C, 0xA5, 0x94, 0x45, 0x88, 0x85, 0x88, 0x66, 0x8C, 0x02, 0x80, 0x45, 0x88, 0x02, 
-    0x80, 0x01, 0x80, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 
-    0x90, 0xA5, 0x90, 0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 
-    0x94, 0xA7, 0x90, 0x63, 0x8C, 0x23, 0x80, 0xA5, 0x94, 0x67, 0x8C, 0x02, 0x80, 0xA7, 0x90, 
-    0x45, 0x88, 0x63, 0x8C, 0xA5, 0x94, 0x25, 0x80, 0x64, 0x94, 0xA7, 0x88, 0x24, 0x80, 0x45, 
-    0x88, 0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 
-    0x8C, 0xC6, 0x94, 0xA5, 0x90, 0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x84, 0x8C, 0xA5, 0x94, 0xA5, 0x94, 0x25, 0x80, 0x86, 0x8C, 0x67, 0x8C, 0x02, 0x80, 
-    0xA5, 0x94, 0x66, 0x8C, 0x64, 0x88, 0xA7, 0x90, 0x45, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x24, 
-    0x80, 0x23, 0x84, 0x24, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x06, 
-    0x89, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0xA5, 0x94, 0xC8, 0x90, 0xA5, 0x94, 0x02, 0x80, 0x66, 0x8C, 0x66, 0x8C, 
-    0x23, 0x80, 0xA7, 0x90, 0x64, 0x88, 0x64, 0x88, 0xA5, 0x94, 0x25, 0x80, 0x66, 0x8C, 0x84, 
-    0x90, 0x24, 0x80, 0x45, 0x88, 0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xC6, 0x94, 0xA5, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x90, 0xA5, 0x94, 0xA5, 0x94, 0x05, 0x80, 0xA5, 0x94, 
-    0x86, 0x8C, 0x24, 0x80, 0xA5, 0x94, 0x45, 0x88, 0x64, 0x88, 0xA5, 0x94, 0x25, 0x80, 0x66, 
-    0x8C, 0x84, 0x90, 0x24, 0x80, 0x23, 0x80, 0x23, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0x64, 0x88, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xC8, 0x90, 0xA5, 0x94, 0x24, 0x80, 
-    0xA5, 0x94, 0x66, 0x8C, 0x02, 0x80, 0xA5, 0x94, 0x45, 0x88, 0x65, 0x88, 0xA5, 0x94, 0x25, 
-    0x80, 0x85, 0x88, 0x66, 0x8C, 0x42, 0x84, 0x25, 0x80, 0x25, 0x80, 0x01, 0x80, 0x84, 0x8C, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x64, 0x88, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA5, 0x94, 0x67, 0x8C, 
-    0x02, 0x80, 0xA5, 0x94, 0x86, 0x88, 0x24, 0x80, 0xA5, 0x94, 0x25, 0x80, 0x25, 0x80, 0xA5, 
-    0x94, 0x05, 0x80, 0x84, 0x90, 0x66, 0x8C, 0x42, 0x84, 0x24, 0x80, 0x24, 0x80, 0x01, 0x80, 
-    0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x88, 
-    0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x90, 0x66, 0x8C, 
-    0xA5, 0x94, 0x24, 0x80, 0x66, 0x8C, 0x45, 0x88, 0x24, 0x80, 0xA5, 0x94, 0x25, 0x80, 0x43, 
-    0x84, 0xA5, 0x94, 0x23, 0x80, 0x86, 0x88, 0x66, 0x8C, 0x42, 0x84, 0x05, 0x80, 0x23, 0x80, 
-    0x01, 0x80, 0x84, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA5, 0x90, 0x44, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x8C, 
-    0xC8, 0x90, 0x66, 0x8C, 0x23, 0x80, 0x66, 0x8C, 0x64, 0x88, 0x24, 0x80, 0x66, 0x8C, 0x45, 
-    0x88, 0x65, 0x88, 0x66, 0x8C, 0x25, 0x80, 0x66, 0x8C, 0x66, 0x8C, 0x02, 0x80, 0x45, 0x88, 
-    0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x06, 0x89, 0xC6, 0x94, 
-    0xA5, 0x90, 0xA5, 0x90, 0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0xA5, 0x94, 0xA5, 0x94, 0x66, 0x8C, 0x02, 0x80, 0x66, 0x8C, 0x65, 0x88, 0x24, 0x80, 0x84, 
-    0x90, 0x45, 0x88, 0x25, 0x80, 0x84, 0x90, 0x25, 0x80, 0x84, 0x90, 0x66, 0x8C, 0x42, 0x84, 
-    0x24, 0x80, 0x24, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0x86, 
-    0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 
-    0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x84, 0x8C, 0xA7, 0x90, 0x66, 0x8C, 0x23, 0x84, 0x66, 0x8C, 0x64, 0x88, 0x23, 
-    0x80, 0x66, 0x8C, 0x45, 0x88, 0x25, 0x80, 0xA5, 0x94, 0x23, 0x80, 0x85, 0x88, 0x45, 0x88, 
-    0x02, 0x80, 0x45, 0x88, 0x02, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 
-    0x88, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0x84, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC6, 0x94, 
-    0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x84, 0x90, 0xC7, 0x98, 0xA5, 0x94, 0x23, 0x80, 0x66, 0x8C, 0x64, 
-    0x88, 0x24, 0x80, 0xA5, 0x94, 0x25, 0x80, 0x84, 0x90, 0x66, 0x8C, 0x25, 0x80, 0x45, 0x88, 
-    0x86, 0x8C, 0x02, 0x80, 0x45, 0x88, 0x24, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA7, 0x88, 0xA5, 
-    0x90, 0x84, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0x23, 0x84, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 0x94, 0xA7, 0x90, 0xA5, 0x94, 0x24, 0x80, 0x66, 
-    0x8C, 0x64, 0x88, 0x23, 0x80, 0x66, 0x8C, 0x45, 0x88, 0x64, 0x88, 0xA5, 0x94, 0x23, 0x80, 
-    0x85, 0x88, 0x85, 0x88, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA5, 
-    0x90, 0x86, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0x86, 0x88, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0x65, 0x88, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x90, 0xA7, 0x90, 0x64, 0x94, 0x24, 
-    0x80, 0xA5, 0x94, 0x45, 0x88, 0x24, 0x80, 0xA5, 0x94, 0x25, 0x80, 0x43, 0x84, 0xA7, 0x88, 
-    0x23, 0x80, 0x66, 0x8C, 0x66, 0x8C, 0x02, 0x80, 0x45, 0x88, 0x24, 0x80, 0x01, 0x80, 0x64, 
-    0x88, 0xA5, 0x90, 0x63, 0x8C, 0xA7, 0x88, 0x84, 0x90, 0xA7, 0x88, 0x84, 0x90, 0xA7, 0x88, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x65, 
-    0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x90, 0xA5, 0x94, 0x67, 
-    0x8C, 0x02, 0x80, 0xA5, 0x94, 0x86, 0x88, 0x02, 0x80, 0x66, 0x8C, 0x64, 0x88, 0x45, 0x88, 
-    0xA5, 0x94, 0x23, 0x80, 0x42, 0x88, 0x67, 0x8C, 0x02, 0x80, 0x23, 0x84, 0x24, 0x80, 0x01, 
-    0x80, 0x63, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0x84, 0x90, 0xA7, 0x88, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 
-    0x90, 0x43, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 0x94, 0xA7, 
-    0x90, 0xA5, 0x94, 0x24, 0x80, 0x66, 0x8C, 0x64, 0x88, 0x02, 0x80, 0xA5, 0x94, 0x45, 0x88, 
-    0x25, 0x80, 0xA5, 0x94, 0x25, 0x80, 0x45, 0x88, 0x86, 0x88, 0x24, 0x80, 0x25, 0x80, 0x23, 
-    0x80, 0x01, 0x80, 0x65, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0x43, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 
-    0x90, 0xA7, 0x90, 0x66, 0x8C, 0x24, 0x80, 0x84, 0x8C, 0x86, 0x88, 0x24, 0x80, 0x66, 0x8C, 
-    0x43, 0x84, 0x25, 0x80, 0x63, 0x8C, 0x26, 0x80, 0x66, 0x8C, 0x84, 0x8C, 0x24, 0x80, 0x23, 
-    0x80, 0x24, 0x80, 0x01, 0x80, 0x45, 0x88, 0x64, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 
-    0x84, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0x23, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x84, 0x90, 0xC7, 0x98, 0xA7, 0x88, 0x24, 0x80, 0xA5, 0x94, 0x43, 0x84, 0x24, 0x80, 
-    0xA5, 0x94, 0x45, 0x88, 0x45, 0x88, 0xA5, 0x94, 0x25, 0x80, 0x63, 0x8C, 0x86, 0x88, 0x24, 
-    0x80, 0x23, 0x80, 0x23, 0x80, 0x01, 0x80, 0x64, 0x88, 0x65, 0x88, 0x65, 0x88, 0x84, 0x8C, 
-    0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x94, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0x43, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x84, 0x90, 0xA7, 0x90, 0xA5, 0x94, 0x02, 0x80, 0xA5, 0x94, 0x86, 0x8C, 
-    0x24, 0x80, 0xA5, 0x94, 0x25, 0x80, 0x45, 0x88, 0x63, 0x8C, 0x25, 0x80, 0x45, 0x88, 0xA7, 
-    0x88, 0x02, 0x80, 0x25, 0x80, 0x24, 0x80, 0x02, 0x80, 0x44, 0x84, 0x85, 0x88, 0x85, 0x88, 
-    0x64, 0x88, 0x86, 0x8C, 0x84, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0x23, 0x84, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA5, 0x94, 0xA7, 0x90, 0x02, 0x80, 0xA7, 0x88, 
-    0x45, 0x88, 0x24, 0x80, 0xA5, 0x94, 0x45, 0x88, 0x45, 0x88, 0xA5, 0x94, 0x25, 0x80, 0x86, 
-    0x8C, 0x45, 0x88, 0x23, 0x80, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 0x43, 0x84, 0x86, 0x8C, 
-    0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0x86, 0x8C, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0x84, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0x84, 0x90, 0xA7, 0x88, 0x65, 0x88, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x90, 0xA5, 0x94, 0xA5, 0x94, 0x23, 0x80, 
-    0xA5, 0x94, 0x65, 0x88, 0x24, 0x80, 0x66, 0x8C, 0x45, 0x88, 0x43, 0x84, 0xA7, 0x88, 0x23, 
-    0x84, 0x45, 0x88, 0x63, 0x8C, 0x24, 0x80, 0x23, 0x80, 0x24, 0x80, 0x02, 0x80, 0x44, 0x84, 
-    0x63, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 
-    0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x21, 0x80, 0x02, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xA5, 0x94, 0xA7, 0x90, 0xA5, 0x94, 
-    0x24, 0x80, 0x66, 0x8C, 0x43, 0x84, 0x23, 0x80, 0xA5, 0x94, 0x45, 0x88, 0x45, 0x88, 0xA5, 
-    0x94, 0x23, 0x80, 0x63, 0x8C, 0x86, 0x88, 0x02, 0x80, 0x23, 0x80, 0x23, 0x80, 0x02, 0x80, 
-    0x44, 0x84, 0x45, 0x88, 0x84, 0x8C, 0x66, 0x8C, 0x65, 0x88, 0x65, 0x88, 0x64, 0x88, 0xA7, 
-    0x88, 0x84, 0x90, 0x84, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0x84, 0x90, 
-    0x08, 0x99, 0xA5, 0x90, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x02, 0x80, 
-    0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 
-    0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x8C, 0xA5, 0x94, 
-    0xA5, 0x94, 0x23, 0x80, 0xA5, 0x94, 0x45, 0x88, 0x24, 0x80, 0xA5, 0x94, 0x45, 0x88, 0x45, 
-    0x88, 0x86, 0x8C, 0x23, 0x80, 0x86, 0x88, 0x67, 0x8C, 0x02, 0x80, 0x25, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x44, 0x84, 0x85, 0x88, 0x85, 0x88, 0x64, 0x88, 0x86, 0x8C, 0x64, 0x88, 0x64, 
-    0x88, 0x84, 0x8C, 0x86, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0x8A, 0x99, 0x27, 0x8D, 0xA5, 0x90, 0x63, 0x8C, 0x42, 0x84, 0x01, 
-    0x80, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x80, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x80, 0x22, 0x84, 0x22, 0x84, 0x02, 0x80, 0x23, 
-    0x84, 0x21, 0x84, 0x42, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x42, 0x88, 0x01, 0x80, 0x42, 0x88, 0x01, 0x80, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x42, 0x88, 0x01, 0x80, 0x42, 0x88, 0x42, 0x84, 0x42, 0x84, 0x02, 0x80, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x23, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x23, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x23, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 
-    0x80, 0x42, 0x84, 0x02, 0x80, 0x23, 0x84, 0x42, 0x80, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x80, 0x01, 0x80, 0x23, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x42, 0x80, 0x23, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x42, 0x80, 0x22, 0x84, 0x21, 0x80, 0x42, 0x84, 0x42, 
-    0x84, 0x21, 0x80, 0x23, 0x80, 0x01, 0x80, 0x21, 0x80, 0x23, 0x84, 0x21, 0x84, 0x21, 0x84, 
-    0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x21, 0x80, 0x23, 0x84, 0x21, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x21, 0x84, 0x42, 0x88, 0x42, 0x84, 0x02, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x84, 0x02, 0x80, 0x42, 0x88, 0x42, 0x84, 0x02, 0x80, 0x22, 0x84, 
-    0x42, 0x88, 0x42, 0x84, 0x02, 0x80, 0x23, 0x84, 0x22, 0x84, 0x22, 0x84, 0x42, 0x80, 0x22, 
-    0x84, 0x23, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x23, 0x84, 0x42, 0x80, 0x23, 0x80, 0x01, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x80, 0x22, 0x84, 
-    0x22, 0x84, 0x21, 0x80, 0x23, 0x84, 0x22, 0x84, 0x21, 0x84, 0x22, 0x84, 0x21, 0x80, 0x22, 
-    0x84, 0x22, 0x84, 0x21, 0x84, 0x42, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0xA5, 0x90, 
-    0xA5, 0x94, 0x67, 0x8C, 0x24, 0x80, 0xA7, 0x88, 0x66, 0x8C, 0x02, 0x80, 0xA5, 0x94, 0x25, 
-    0x80, 0x45, 0x88, 0xA7, 0x88, 0x23, 0x80, 0xA5, 0x94, 0x85, 0x88, 0x02, 0x80, 0x23, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x43, 0x84, 0x63, 0x8C, 0x45, 0x88, 0x84, 0x8C, 0x65, 0x88, 0x85, 
-    0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 0xA5, 0x94, 0xA7, 0x90, 
-    0xC6, 0x94, 0xA5, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0x8A, 0x99, 0xEB, 0x99, 0x8A, 0x99, 0xEB, 
-    0x99, 0x8A, 0x99, 0xAB, 0x9D, 0xEB, 0x99, 0xEB, 0x99, 0xCC, 0xA1, 0xEB, 0x99, 0xAB, 0x9D, 
-    0x8A, 0x99, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0xEA, 0x94, 0x69, 0x91, 0x69, 0x91, 0x69, 
-    0x91, 0x69, 0x91, 0x69, 0x91, 0xEA, 0x94, 0x69, 0x91, 0x69, 0x91, 0x8A, 0x99, 0x8A, 0x99, 
-    0xCC, 0xA1, 0xCC, 0xA1, 0xEB, 0x99, 0xCC, 0xA1, 0xCC, 0xA1, 0xCC, 0xA1, 0x2B, 0x9A, 0xAB, 
-    0x9D, 0xAB, 0x9D, 0x8A, 0x99, 0x8A, 0x99, 0xAB, 0x9D, 0x8A, 0x99, 0x8A, 0x99, 0xAB, 0x9D, 
-    0xAB, 0x9D, 0x8A, 0x99, 0xEB, 0x99, 0xAB, 0x9D, 0x8A, 0x99, 0xAB, 0x9D, 0x8A, 0x99, 0x8A, 
-    0x99, 0xAB, 0x9D, 0x8A, 0x99, 0xAB, 0x9D, 0x8A, 0x99, 0xEB, 0x99, 0x8A, 0x99, 0x8A, 0x99, 
-    0xAB, 0x9D, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 
-    0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0xAB, 0x9D, 
-    0x69, 0x91, 0xEA, 0x94, 0x69, 0x91, 0xC8, 0x90, 0x69, 0x91, 0x0B, 0x8D, 0x69, 0x91, 0xEA, 
-    0x94, 0x69, 0x91, 0x69, 0x91, 0x0B, 0x99, 0x69, 0x91, 0x2C, 0x91, 0x69, 0x91, 0xE9, 0x8C, 
-    0x69, 0x91, 0xEA, 0x94, 0x69, 0x91, 0x0B, 0x8D, 0x69, 0x91, 0x69, 0x91, 0xEA, 0x94, 0x69, 
-    0x91, 0x69, 0x91, 0x2C, 0x91, 0x69, 0x91, 0x69, 0x91, 0x8A, 0x99, 0xC9, 0x94, 0x69, 0x91, 
-    0x69, 0x91, 0x69, 0x91, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 
-    0x99, 0x69, 0x91, 0x8A, 0x99, 0xE9, 0x8C, 0x69, 0x91, 0x69, 0x91, 0x8A, 0x99, 0x8A, 0x99, 
-    0x8A, 0x99, 0x69, 0x91, 0x29, 0x9D, 0x29, 0x9D, 0x6B, 0xA1, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 
-    0x99, 0x8A, 0x99, 0x8A, 0x99, 0x6B, 0xA1, 0x29, 0x9D, 0xEA, 0x94, 0xC6, 0x94, 0xC9, 0x94, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0xEA, 0x94, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0x29, 
-    0x9D, 0xEA, 0x94, 0xC9, 0x94, 0x29, 0x9D, 0x29, 0x9D, 0xEA, 0x94, 0x29, 0x9D, 0x08, 0x99, 
-    0x29, 0x9D, 0xEA, 0x94, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 
-    0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0xEA, 0x94, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x69, 0x91, 0x8A, 
-    0x99, 0x69, 0x91, 0x69, 0x91, 0x27, 0x8D, 0x08, 0x99, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 
-    0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0xE9, 0x8C, 0x27, 0x8D, 0x08, 0x99, 0x69, 
-    0x91, 0x08, 0x99, 0x69, 0x91, 0x0B, 0x8D, 0x08, 0x99, 0x69, 0x91, 0x69, 0x91, 0x08, 0x99, 
-    0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0xE9, 0x8C, 0x29, 0x9D, 0x69, 0x91, 0x08, 0x99, 0x69, 
-    0x91, 0xEA, 0x94, 0x69, 0x91, 0x08, 0x99, 0x69, 0x91, 0x08, 0x99, 0x69, 0x91, 0xEA, 0x94, 
-    0x69, 0x91, 0x08, 0x99, 0x69, 0x91, 0x29, 0x9D, 0x69, 0x91, 0x08, 0x99, 0x69, 0x91, 0x29, 
-    0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 
-    0xC9, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0x45, 0x88, 0x84, 0x90, 0x46, 0x84, 0x02, 0x80, 0xA5, 
-    0x94, 0x45, 0x88, 0x25, 0x80, 0xA5, 0x94, 0x23, 0x80, 0x63, 0x8C, 0x67, 0x8C, 0x02, 0x80, 
-    0x05, 0x80, 0x23, 0x80, 0x02, 0x80, 0x44, 0x84, 0x86, 0x88, 0x85, 0x88, 0x45, 0x88, 0x85, 
-    0x88, 0x63, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x66, 0x8C, 0x64, 0x88, 0x64, 0x88, 0xA5, 0x90, 
-    0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0x08, 
-    0x99, 0x27, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 0x69, 0x91, 0x69, 0x91, 0x27, 0x8D, 0x08, 0x99, 
-    0x69, 0x91, 0x29, 0x9D, 0x27, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 0xC8, 0x8C, 0x27, 
-    0x8D, 0xC8, 0x8C, 0x06, 0x89, 0xC8, 0x8C, 0x27, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 0x0B, 0x8D, 
-    0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 
-    0x91, 0x69, 0x91, 0x69, 0x91, 0x27, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 0xE9, 0x8C, 0x27, 0x8D, 
-    0x27, 0x8D, 0x69, 0x91, 0x27, 0x8D, 0x27, 0x8D, 0xEA, 0x94, 0xEA, 0x94, 0x27, 0x8D, 0xC9, 
-    0x94, 0x27, 0x8D, 0x69, 0x91, 0x27, 0x8D, 0x69, 0x91, 0x27, 0x8D, 0x27, 0x8D, 0x27, 0x8D, 
-    0x69, 0x91, 0xE9, 0x8C, 0x27, 0x8D, 0x69, 0x91, 0x06, 0x89, 0x27, 0x8D, 0x27, 0x8D, 0x27, 
-    0x8D, 0xE9, 0x8C, 0x27, 0x8D, 0x06, 0x89, 0xE9, 0x8C, 0x27, 0x8D, 0x27, 0x8D, 0x69, 0x91, 
-    0x69, 0x91, 0x27, 0x8D, 0x06, 0x89, 0xA7, 0x88, 0x06, 0x89, 0xA8, 0x88, 0x06, 0x89, 0xC8, 
-    0x8C, 0x06, 0x89, 0x27, 0x8D, 0xC8, 0x8C, 0x06, 0x89, 0x27, 0x8D, 0x06, 0x89, 0xC8, 0x8C, 
-    0x06, 0x89, 0xC8, 0x8C, 0x06, 0x89, 0x06, 0x89, 0x06, 0x89, 0x06, 0x89, 0xC8, 0x8C, 0x06, 
-    0x89, 0xC8, 0x8C, 0x06, 0x89, 0xC8, 0x8C, 0x27, 0x8D, 0x06, 0x89, 0xC8, 0x8C, 0xA7, 0x90, 
-    0xC8, 0x90, 0xC8, 0x8C, 0x06, 0x89, 0x08, 0x99, 0x08, 0x99, 0x27, 0x8D, 0xC8, 0x90, 0xA7, 
-    0x90, 0xA7, 0x90, 0xC8, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0xA7, 0x90, 0xA7, 0x90, 0x08, 0x99, 
-    0xC8, 0x90, 0xC8, 0x90, 0x08, 0x99, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC8, 0x90, 0xC6, 
-    0x94, 0x08, 0x99, 0xA7, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x88, 
-    0x63, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC8, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x88, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0x08, 0x99, 0xC6, 
-    0x94, 0x27, 0x8D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x27, 0x8D, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xA7, 
-    0x90, 0xC6, 0x94, 0xA7, 0x90, 0xC8, 0x90, 0xC8, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 0x90, 
-    0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x94, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 
-    0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 
-    0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 
-    0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 
-    0xA7, 0x88, 0xC8, 0x8C, 0xA7, 0x90, 0xA8, 0x88, 0xA8, 0x88, 0xA8, 0x88, 0x86, 0x88, 0x86, 
-    0x88, 0x86, 0x88, 0xA5, 0x90, 0x86, 0x88, 0x84, 0x8C, 0x64, 0x84, 0x25, 0x80, 0x65, 0x88, 
-    0x64, 0x88, 0x23, 0x80, 0x64, 0x88, 0x86, 0x88, 0x24, 0x80, 0x66, 0x8C, 0x64, 0x88, 0x23, 
-    0x80, 0xA5, 0x94, 0x25, 0x80, 0x64, 0x88, 0xA5, 0x94, 0x25, 0x80, 0x63, 0x8C, 0x66, 0x8C, 
-    0x02, 0x80, 0x23, 0x80, 0x23, 0x80, 0x02, 0x80, 0x43, 0x84, 0x45, 0x88, 0x63, 0x8C, 0x64, 
-    0x88, 0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 0x45, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x85, 0x88, 
-    0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 
-    0x94, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 
-    0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0x06, 0x89, 0xC6, 0x94, 0x27, 0x8D, 0xC6, 0x94, 0xC8, 
-    0x8C, 0x06, 0x89, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x90, 0xC8, 
-    0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xC6, 0x94, 
-    0xC9, 0x94, 0xC6, 0x94, 0xE9, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x86, 0x88, 0x63, 
-    0x8C, 0xA7, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 
-    0x84, 0x90, 0x84, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x84, 
-    0x8C, 0x86, 0x8C, 0x65, 0x88, 0xA7, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 
-    0xA5, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0xA5, 0x90, 0x66, 0x8C, 0xA5, 0x90, 0xA7, 
-    0x88, 0x84, 0x90, 0x84, 0x90, 0x84, 0x8C, 0x86, 0x88, 0x86, 0x8C, 0x84, 0x90, 0xA5, 0x90, 
-    0xA5, 0x94, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 
-    0x90, 0x86, 0x8C, 0xA5, 0x90, 0x84, 0x90, 0x84, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x94, 0x64, 0x88, 0x85, 0x88, 0x84, 0x8C, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0x63, 
-    0x8C, 0xA5, 0x90, 0x84, 0x8C, 0xA5, 0x90, 0x63, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0xA5, 0x90, 
-    0x63, 0x8C, 0x86, 0x8C, 0x84, 0x90, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x94, 0x86, 0x8C, 0xA5, 
-    0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x90, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 
-    0x85, 0x88, 0x63, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x90, 0x64, 0x88, 0x43, 
-    0x84, 0x63, 0x8C, 0x84, 0x8C, 0x65, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 
-    0x84, 0x8C, 0x85, 0x88, 0x63, 0x8C, 0x63, 0x8C, 0x85, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x64, 
-    0x88, 0x84, 0x8C, 0x64, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 
-    0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 
-    0x88, 0x64, 0x88, 0x23, 0x80, 0x44, 0x84, 0x44, 0x80, 0x25, 0x80, 0x64, 0x84, 0x44, 0x84, 
-    0x44, 0x84, 0x23, 0x80, 0x44, 0x84, 0x44, 0x84, 0x66, 0x8C, 0x43, 0x84, 0x63, 0x8C, 0x86, 
-    0x88, 0x02, 0x80, 0xA5, 0x94, 0x25, 0x80, 0x25, 0x80, 0xA5, 0x94, 0x24, 0x80, 0x45, 0x88, 
-    0x84, 0x8C, 0x25, 0x80, 0x25, 0x80, 0x02, 0x80, 0x02, 0x80, 0x44, 0x84, 0x45, 0x88, 0x65, 
-    0x88, 0x85, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x45, 0x88, 0x85, 0x88, 0x85, 0x88, 0x64, 0x88, 
-    0x45, 0x88, 0x84, 0x8C, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC6, 
-    0x94, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 
-    0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x88, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 
-    0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0x63, 0x8C, 0x66, 0x8C, 0x84, 
-    0x8C, 0x86, 0x88, 0x84, 0x8C, 0xA8, 0x88, 0x84, 0x90, 0x86, 0x88, 0x84, 0x8C, 0xA7, 0x88, 
-    0x84, 0x90, 0x86, 0x88, 0x84, 0x8C, 0x86, 0x88, 0xA7, 0x88, 0x63, 0x8C, 0xA7, 0x88, 0x66, 
-    0x8C, 0x85, 0x88, 0x63, 0x8C, 0x86, 0x8C, 0x84, 0x90, 0x86, 0x8C, 0x85, 0x88, 0x85, 0x88, 
-    0xA5, 0x94, 0x86, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 0x84, 0x8C, 0xA5, 0x94, 0xA7, 0x88, 0xA5, 
-    0x90, 0x63, 0x8C, 0xA7, 0x88, 0x63, 0x8C, 0xA7, 0x88, 0x63, 0x8C, 0xA5, 0x94, 0x86, 0x8C, 
-    0x84, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0x86, 0x8C, 0x84, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x94, 0x84, 0x8C, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 
-    0x86, 0x8C, 0xA5, 0x90, 0x86, 0x8C, 0x45, 0x88, 0x85, 0x88, 0x84, 0x90, 0x84, 0x8C, 0xA5, 
-    0x90, 0x86, 0x8C, 0x84, 0x90, 0x86, 0x8C, 0x63, 0x8C, 0x86, 0x8C, 0x84, 0x90, 0x86, 0x8C, 
-    0x84, 0x8C, 0xA5, 0x94, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0xA5, 
-    0x90, 0xA5, 0x90, 0x84, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x85, 0x88, 
-    0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x84, 0x90, 0x64, 0x88, 0x84, 
-    0x8C, 0x45, 0x88, 0x86, 0x88, 0x63, 0x8C, 0x84, 0x8C, 0x86, 0x88, 0x65, 0x88, 0x86, 0x8C, 
-    0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x86, 
-    0x8C, 0x84, 0x90, 0x84, 0x8C, 0x84, 0x90, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 
-    0x84, 0x8C, 0x85, 0x88, 0x84, 0x90, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 
-    0x88, 0x64, 0x88, 0x24, 0x80, 0x65, 0x88, 0x25, 0x80, 0x44, 0x84, 0x44, 0x84, 0x44, 0x84, 
-    0x25, 0x80, 0x64, 0x84, 0x25, 0x80, 0x65, 0x88, 0x25, 0x80, 0x84, 0x8C, 0x25, 0x80, 0x86, 
-    0x88, 0x45, 0x88, 0x02, 0x80, 0xA5, 0x94, 0x25, 0x80, 0x45, 0x88, 0x65, 0x88, 0x25, 0x80, 
-    0x45, 0x88, 0x84, 0x8C, 0x24, 0x80, 0x45, 0x88, 0x02, 0x80, 0x02, 0x80, 0x44, 0x84, 0x86, 
-    0x88, 0x23, 0x84, 0x85, 0x88, 0x64, 0x88, 0x43, 0x84, 0x66, 0x8C, 0x63, 0x8C, 0x85, 0x88, 
-    0x85, 0x88, 0x45, 0x88, 0x85, 0x88, 0x84, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0x06, 0x89, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 
-    0xA5, 0x90, 0x86, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 
-    0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 
-    0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 
-    0x90, 0xA5, 0x90, 0x86, 0x8C, 0x84, 0x90, 0xA7, 0x88, 0x84, 0x90, 0xA5, 0x90, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x94, 0x86, 
-    0x88, 0x84, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 
-    0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x85, 
-    0x88, 0x85, 0x88, 0x66, 0x8C, 0x84, 0x90, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x66, 0x8C, 
-    0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0xA5, 0x94, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0xA5, 
-    0x90, 0x63, 0x8C, 0xA7, 0x90, 0x84, 0x8C, 0xA7, 0x88, 0x63, 0x8C, 0x67, 0x8C, 0xA5, 0x90, 
-    0x84, 0x8C, 0xA7, 0x88, 0x84, 0x90, 0x86, 0x8C, 0x63, 0x8C, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 
-    0x88, 0xA5, 0x90, 0x86, 0x8C, 0x84, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0x84, 0x90, 0x84, 0x90, 
-    0x84, 0x90, 0x84, 0x8C, 0xA5, 0x90, 0x84, 0x90, 0x84, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x86, 
-    0x8C, 0x84, 0x90, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0xA5, 0x94, 0x85, 0x88, 
-    0x63, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x94, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0x84, 0x90, 0x84, 0x8C, 0xA7, 0x88, 0x64, 0x88, 0x85, 0x88, 0x84, 0x8C, 0x85, 0x88, 
-    0x63, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x43, 0x84, 0x86, 0x8C, 0x42, 0x88, 0x66, 0x8C, 0x85, 
-    0x88, 0x85, 0x88, 0x43, 0x84, 0x66, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x63, 0x88, 0x45, 0x88, 
-    0x85, 0x88, 0x63, 0x8C, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x85, 0x88, 0x85, 
-    0x88, 0x63, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x94, 
-    0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x84, 0x90, 0x63, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 
-    0x8C, 0x64, 0x88, 0x84, 0x8C, 0x25, 0x80, 0x64, 0x88, 0x23, 0x84, 0x25, 0x80, 0x44, 0x84, 
-    0x44, 0x80, 0x44, 0x84, 0x43, 0x84, 0x23, 0x84, 0x44, 0x84, 0x64, 0x84, 0x86, 0x88, 0x24, 
-    0x80, 0x84, 0x8C, 0x86, 0x88, 0x24, 0x80, 0x66, 0x8C, 0x45, 0x88, 0x65, 0x88, 0x66, 0x8C, 
-    0x23, 0x80, 0xA5, 0x94, 0x86, 0x8C, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x01, 0x80, 0x43, 
-    0x84, 0x45, 0x88, 0x84, 0x90, 0x45, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x45, 0x88, 0x85, 0x88, 
-    0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0x84, 
-    0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0x06, 
-    0x89, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0x42, 0x88, 0x42, 0x88, 
-    0xA5, 0x94, 0xA5, 0x94, 0x42, 0x84, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x88, 0x85, 
-    0x88, 0x64, 0x88, 0x86, 0x88, 0xC6, 0x94, 0xA5, 0x90, 0x84, 0x90, 0x84, 0x90, 0x08, 0x99, 
-    0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0x63, 0x8C, 0x63, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 
-    0x90, 0x86, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x88, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0x86, 0x8C, 0x84, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0x84, 0x90, 0x86, 0x8C, 0x84, 
-    0x90, 0xA7, 0x88, 0x84, 0x90, 0x86, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x94, 0xC8, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0x84, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0x84, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA5, 0x90, 0x66, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x86, 0x8C, 
-    0x85, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x66, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x85, 
-    0x88, 0x85, 0x88, 0x84, 0x90, 0x85, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 
-    0x84, 0x8C, 0x86, 0x8C, 0x64, 0x88, 0x84, 0x90, 0x64, 0x84, 0x84, 0x8C, 0x86, 0x8C, 0xA5, 
-    0x90, 0x85, 0x88, 0x63, 0x8C, 0x85, 0x88, 0x63, 0x8C, 0x84, 0x90, 0xA7, 0x88, 0xA5, 0x90, 
-    0xA5, 0x94, 0x65, 0x88, 0x84, 0x8C, 0x85, 0x88, 0xA5, 0x90, 0x85, 0x88, 0x63, 0x8C, 0x86, 
-    0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x85, 0x88, 0x84, 0x90, 0x84, 0x90, 
-    0x86, 0x8C, 0x63, 0x8C, 0xA7, 0x90, 0x84, 0x8C, 0xA5, 0x90, 0x86, 0x8C, 0x66, 0x8C, 0x64, 
-    0x88, 0x64, 0x88, 0x86, 0x8C, 0x84, 0x90, 0x86, 0x8C, 0x84, 0x8C, 0xA5, 0x94, 0x86, 0x88, 
-    0x84, 0x90, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 
-    0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0x84, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0x63, 0x8C, 0x65, 0x88, 0x45, 0x88, 0x65, 0x88, 
-    0x63, 0x8C, 0x23, 0x84, 0x84, 0x8C, 0x44, 0x84, 0x83, 0x80, 0x83, 0x80, 0x83, 0x80, 0x63, 
-    0x88, 0x44, 0x84, 0x63, 0x8C, 0x45, 0x88, 0x44, 0x84, 0x64, 0x88, 0x63, 0x88, 0x23, 0x84, 
-    0x85, 0x88, 0x63, 0x8C, 0x23, 0x84, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x63, 0x8C, 0x64, 
-    0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x63, 0x88, 0x42, 0x88, 0x63, 0x8C, 
-    0x84, 0x8C, 0x63, 0x88, 0x23, 0x84, 0x44, 0x84, 0x63, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x85, 
-    0x88, 0x85, 0x88, 0x63, 0x8C, 0x84, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x25, 0x80, 0x44, 0x84, 
-    0x64, 0x84, 0x25, 0x80, 0x64, 0x84, 0x25, 0x80, 0x64, 0x84, 0x25, 0x80, 0x65, 0x88, 0x86, 
-    0x8C, 0x24, 0x80, 0xA5, 0x94, 0x86, 0x88, 0x02, 0x80, 0xA5, 0x94, 0x45, 0x88, 0x65, 0x88, 
-    0xA7, 0x88, 0x45, 0x88, 0x84, 0x90, 0xA5, 0x94, 0x02, 0x80, 0x23, 0x80, 0x23, 0x80, 0x01, 
-    0x80, 0x43, 0x84, 0x65, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 
-    0x85, 0x88, 0x85, 0x88, 0x45, 0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 0xA5, 
-    0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x42, 0x88, 
-    0x22, 0x84, 0xA5, 0x94, 0x63, 0x8C, 0x42, 0x84, 0x02, 0x80, 0x42, 0x88, 0x21, 0x84, 0x44, 
-    0x84, 0x23, 0x84, 0x21, 0x80, 0x08, 0x99, 0xA5, 0x90, 0xA5, 0x90, 0x63, 0x8C, 0x23, 0x80, 
-    0x08, 0x99, 0xC6, 0x94, 0xA5, 0x90, 0x63, 0x8C, 0x42, 0x84, 0x02, 0x80, 0x01, 0x80, 0x64, 
-    0x84, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0xA7, 0x88, 0xA5, 0x90, 
-    0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x94, 0x86, 0x8C, 0x84, 0x90, 0x86, 0x8C, 0xA5, 
-    0x90, 0x86, 0x8C, 0x84, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0x84, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA5, 0x94, 0xA7, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x86, 0x8C, 
-    0x85, 0x88, 0x84, 0x90, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x85, 
-    0x88, 0x84, 0x90, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x66, 0x8C, 
-    0x84, 0x8C, 0x86, 0x8C, 0x64, 0x88, 0x43, 0x84, 0x42, 0x88, 0x02, 0x80, 0x01, 0x80, 0x21, 
-    0x84, 0x85, 0x88, 0xC6, 0x94, 0x64, 0x88, 0x01, 0x80, 0x22, 0x84, 0x22, 0x84, 0x84, 0x8C, 
-    0xC6, 0x94, 0xC6, 0x94, 0x63, 0x88, 0x01, 0x80, 0x22, 0x84, 0x42, 0x88, 0xC6, 0x94, 0x42, 
-    0x88, 0x21, 0x84, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0x64, 0x88, 0x21, 0x84, 0x21, 0x84, 
-    0x01, 0x80, 0x63, 0x8C, 0x86, 0x8C, 0x84, 0x90, 0xA7, 0x88, 0x84, 0x90, 0xA7, 0x88, 0x84, 
-    0x90, 0x65, 0x88, 0x64, 0x88, 0x85, 0x88, 0x84, 0x8C, 0x84, 0x90, 0x86, 0x8C, 0x84, 0x8C, 
-    0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x90, 0xA7, 0x88, 0x84, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x88, 0x84, 0x90, 0xA5, 
-    0x90, 0x84, 0x90, 0xA7, 0x88, 0x84, 0x90, 0x84, 0x8C, 0x65, 0x88, 0x84, 0x8C, 0xA4, 0x80, 
-    0x23, 0x84, 0x23, 0x84, 0x21, 0x84, 0x00, 0x80, 0x00, 0x80, 0x42, 0x88, 0xA4, 0x80, 0x21, 
-    0x80, 0x01, 0x80, 0x42, 0x84, 0x02, 0x80, 0x01, 0x80, 0x64, 0x88, 0x21, 0x84, 0x01, 0x80, 
-    0x21, 0x84, 0x21, 0x84, 0x43, 0x84, 0x64, 0x88, 0x21, 0x84, 0x01, 0x80, 0x21, 0x84, 0x21, 
-    0x80, 0x23, 0x84, 0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 0x22, 0x84, 0x21, 0x84, 0x42, 0x88, 
-    0x21, 0x80, 0x01, 0x80, 0x22, 0x84, 0x21, 0x84, 0x21, 0x84, 0x63, 0x8C, 0x21, 0x84, 0x21, 
-    0x84, 0x42, 0x84, 0x22, 0x84, 0x85, 0x88, 0x84, 0x90, 0x46, 0x84, 0x23, 0x80, 0x64, 0x88, 
-    0x64, 0x84, 0x44, 0x80, 0x25, 0x80, 0x44, 0x84, 0x44, 0x84, 0x44, 0x80, 0x25, 0x80, 0x65, 
-    0x88, 0xA7, 0x88, 0x24, 0x80, 0xA5, 0x90, 0x66, 0x8C, 0x02, 0x80, 0xA5, 0x94, 0x86, 0x8C, 
-    0x23, 0x84, 0xA5, 0x90, 0x45, 0x88, 0xA7, 0x88, 0x84, 0x90, 0x23, 0x80, 0x25, 0x80, 0x24, 
-    0x80, 0x01, 0x80, 0x45, 0x88, 0x65, 0x88, 0x43, 0x84, 0x86, 0x8C, 0x85, 0x88, 0x45, 0x88, 
-    0x63, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x85, 0x88, 0x45, 0x88, 0x64, 0x88, 0x85, 
-    0x88, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 
-    0x22, 0x84, 0x22, 0x84, 0x63, 0x88, 0x63, 0x88, 0x85, 0x88, 0x08, 0x99, 0x63, 0x8C, 0x84, 
-    0x90, 0xA5, 0x94, 0x63, 0x8C, 0x84, 0x90, 0x08, 0x99, 0xA7, 0x88, 0xA5, 0x94, 0x63, 0x8C, 
-    0x63, 0x8C, 0x08, 0x99, 0xA7, 0x90, 0xA5, 0x94, 0x63, 0x88, 0x84, 0x8C, 0xE7, 0x9C, 0xC6, 
-    0x94, 0x66, 0x8C, 0x86, 0x88, 0x86, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 
-    0xA5, 0x90, 0x67, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 0x84, 0x8C, 0xA5, 0x90, 0x86, 0x8C, 0x84, 
-    0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x84, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0x84, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 
-    0x94, 0x84, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0x84, 0x90, 0xA5, 0x90, 0x85, 0x88, 0x66, 0x8C, 
-    0x84, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x84, 0x90, 0x66, 0x8C, 0x86, 0x8C, 0x84, 
-    0x8C, 0xA5, 0x94, 0x85, 0x88, 0x66, 0x8C, 0x63, 0x8C, 0x86, 0x8C, 0x84, 0x90, 0x86, 0x8C, 
-    0x84, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x63, 0x8C, 0x22, 0x84, 0x22, 0x84, 0xA5, 0x90, 0xE8, 
-    0xA0, 0xC6, 0x94, 0x23, 0x84, 0x42, 0x88, 0x22, 0x84, 0xA5, 0x94, 0xC6, 0x94, 0x84, 0x90, 
-    0x22, 0x84, 0x85, 0x88, 0xC6, 0x94, 0x64, 0x88, 0x42, 0x88, 0x84, 0x90, 0x63, 0x8C, 0xC6, 
-    0x94, 0x42, 0x88, 0x63, 0x8C, 0xA5, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x84, 0x8C, 0x63, 0x8C, 
-    0xE7, 0x9C, 0xC6, 0x94, 0x84, 0x90, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x90, 0x86, 0x8C, 0x84, 
-    0x90, 0xA5, 0x90, 0x84, 0x8C, 0x66, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 
-    0xA5, 0x90, 0x86, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x94, 0x64, 0x88, 0xA5, 0x90, 
-    0xA4, 0x80, 0x24, 0x80, 0x42, 0x88, 0x84, 0x90, 0xE7, 0x9C, 0xA5, 0x94, 0x85, 0x88, 0xA4, 
-    0x80, 0x63, 0x8C, 0x63, 0x8C, 0xE8, 0xA0, 0xC6, 0x94, 0xA5, 0x90, 0x21, 0x84, 0x63, 0x8C, 
-    0xC7, 0x98, 0xC7, 0x98, 0x64, 0x88, 0x23, 0x84, 0x84, 0x90, 0x63, 0x8C, 0xA6, 0x94, 0xA5, 
-    0x90, 0x63, 0x8C, 0x63, 0x88, 0x84, 0x90, 0x84, 0x90, 0xA6, 0x94, 0xE7, 0x9C, 0xE7, 0x9C, 
-    0xE7, 0x9C, 0x09, 0xA5, 0xC6, 0x94, 0x84, 0x90, 0x08, 0x99, 0xC6, 0x94, 0x63, 0x8C, 0x63, 
-    0x8C, 0xE8, 0xA0, 0xA5, 0x94, 0x84, 0x8C, 0x63, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x44, 0x80, 
-    0x64, 0x84, 0x23, 0x80, 0x65, 0x88, 0x25, 0x80, 0x44, 0x84, 0x64, 0x84, 0x44, 0x84, 0x44, 
-    0x84, 0x64, 0x84, 0x84, 0x8C, 0x25, 0x80, 0xA5, 0x90, 0x86, 0x88, 0x42, 0x84, 0xA5, 0x94, 
-    0x45, 0x88, 0x45, 0x88, 0xA5, 0x90, 0x45, 0x88, 0x84, 0x90, 0xA5, 0x90, 0x02, 0x80, 0x23, 
-    0x80, 0x23, 0x84, 0x01, 0x80, 0x65, 0x88, 0x43, 0x84, 0x65, 0x88, 0x45, 0x88, 0x64, 0x88, 
-    0x85, 0x88, 0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x85, 0x88, 0x45, 
-    0x88, 0x64, 0x88, 0x64, 0x88, 0xA5, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 
-    0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xC6, 0x94, 0xA5, 0x90, 0x84, 0x90, 0x42, 0x88, 0x84, 0x90, 0x08, 0x99, 0xC7, 0x98, 0x63, 
-    0x8C, 0x84, 0x8C, 0xA5, 0x94, 0x63, 0x8C, 0x84, 0x90, 0xC6, 0x94, 0x85, 0x88, 0x84, 0x8C, 
-    0x63, 0x8C, 0x63, 0x8C, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x63, 0x8C, 0x63, 
-    0x8C, 0xA5, 0x94, 0x08, 0x99, 0xA7, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0x84, 0x90, 0xA5, 0x90, 
-    0xA7, 0x88, 0xA5, 0x90, 0x84, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0x84, 0x90, 0xA7, 
-    0x88, 0xA5, 0x90, 0xC6, 0x94, 0x84, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x94, 0xA5, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x94, 0xC6, 
-    0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x94, 0x86, 0x8C, 
-    0x85, 0x88, 0x85, 0x88, 0xA5, 0x94, 0x64, 0x88, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 
-    0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x63, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 
-    0xA7, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0xA5, 0x90, 0x64, 0x88, 0x22, 0x84, 0xA5, 0x94, 0xA5, 
-    0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC7, 0x98, 0x84, 0x8C, 0x84, 0x90, 0xC6, 0x94, 0x08, 0x99, 
-    0xC6, 0x94, 0x84, 0x90, 0x84, 0x90, 0x85, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x08, 0x99, 0x84, 
-    0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0x84, 0x90, 0x23, 0x84, 0x84, 0x90, 0xE7, 0x9C, 0xA5, 0x90, 0xA5, 0x94, 0x65, 0x88, 0x84, 
-    0x8C, 0xA7, 0x88, 0x84, 0x90, 0xA5, 0x90, 0x84, 0x8C, 0x85, 0x88, 0x45, 0x88, 0x84, 0x8C, 
-    0x86, 0x8C, 0x86, 0x8C, 0x84, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 
-    0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0x86, 0x88, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x85, 0x88, 
-    0x84, 0x8C, 0xA5, 0x90, 0x85, 0x88, 0xA5, 0x94, 0x00, 0x80, 0x00, 0x80, 0xA5, 0x94, 0xC7, 
-    0x98, 0x64, 0x88, 0x84, 0x90, 0x63, 0x8C, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 
-    0x63, 0x8C, 0x85, 0x88, 0x85, 0x88, 0xE7, 0x9C, 0xC7, 0x98, 0x84, 0x8C, 0x84, 0x90, 0x63, 
-    0x8C, 0x63, 0x88, 0x84, 0x90, 0xA5, 0x90, 0x84, 0x90, 0x84, 0x8C, 0x63, 0x8C, 0x22, 0x84, 
-    0x42, 0x88, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0x84, 0x90, 0xA6, 0x94, 0xC6, 0x94, 0xC7, 
-    0x98, 0x84, 0x90, 0x42, 0x84, 0xA5, 0x90, 0xC7, 0x98, 0x86, 0x88, 0x84, 0x90, 0x44, 0x84, 
-    0x64, 0x88, 0x25, 0x80, 0x65, 0x88, 0x44, 0x84, 0x64, 0x84, 0x44, 0x84, 0x44, 0x84, 0x44, 
-    0x80, 0x25, 0x80, 0x64, 0x84, 0x86, 0x88, 0x02, 0x80, 0xA5, 0x90, 0x85, 0x88, 0x24, 0x80, 
-    0xA5, 0x94, 0x45, 0x88, 0x64, 0x88, 0xA5, 0x90, 0x45, 0x88, 0x84, 0x90, 0xA7, 0x88, 0x02, 
-    0x80, 0x24, 0x80, 0x23, 0x80, 0x02, 0x80, 0x23, 0x84, 0x65, 0x88, 0x43, 0x84, 0x65, 0x88, 
-    0x43, 0x84, 0x65, 0x88, 0x64, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x45, 0x88, 0x85, 0x88, 0x85, 
-    0x88, 0x63, 0x8C, 0x85, 0x88, 0x45, 0x88, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x94, 0xA7, 0x88, 
-    0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x94, 0x84, 0x8C, 0x84, 0x90, 0xA5, 0x94, 0x63, 0x8C, 0xA5, 
-    0x90, 0x63, 0x8C, 0x63, 0x8C, 0xA5, 0x90, 0x63, 0x8C, 0x84, 0x90, 0x08, 0x99, 0x86, 0x88, 
-    0x84, 0x90, 0x63, 0x8C, 0x63, 0x8C, 0x08, 0x99, 0xA5, 0x90, 0xA5, 0x90, 0x08, 0x99, 0xC6, 
-    0x94, 0xA6, 0x94, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0x84, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0x84, 0x90, 0xC6, 0x94, 
-    0xC6, 0x94, 0x84, 0x90, 0xC6, 0x94, 0xA5, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA5, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x94, 0xC6, 0x94, 0xA5, 0x90, 
-    0xA5, 0x94, 0x63, 0x8C, 0x86, 0x8C, 0x64, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x84, 0x90, 0x86, 
-    0x8C, 0x84, 0x90, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x64, 0x88, 0x86, 0x8C, 0x85, 0x88, 
-    0x85, 0x88, 0x84, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x90, 0x84, 0x8C, 0xA5, 
-    0x94, 0x85, 0x88, 0x21, 0x84, 0x42, 0x88, 0x42, 0x88, 0xA5, 0x94, 0x84, 0x90, 0xA6, 0x94, 
-    0x84, 0x90, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 0x42, 0x88, 0x84, 0x8C, 0xA5, 0x94, 0x84, 
-    0x90, 0x84, 0x8C, 0x63, 0x8C, 0x84, 0x90, 0x85, 0x88, 0xA5, 0x94, 0xA5, 0x94, 0x84, 0x8C, 
-    0xA5, 0x94, 0x29, 0x9D, 0xC7, 0x98, 0x84, 0x90, 0x42, 0x88, 0x65, 0x88, 0x64, 0x88, 0xA5, 
-    0x90, 0x84, 0x8C, 0xA5, 0x94, 0x86, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 0x66, 0x8C, 0x64, 0x88, 
-    0x86, 0x88, 0x85, 0x88, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0xA5, 0x90, 0x84, 
-    0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0x84, 0x90, 0x85, 0x88, 0x84, 0x8C, 0x23, 0x84, 0xE8, 0xA0, 0x08, 0x99, 0xA6, 0x94, 0x00, 
-    0x80, 0x00, 0x80, 0x23, 0x80, 0x84, 0x90, 0x63, 0x8C, 0xC7, 0x98, 0xE7, 0x9C, 0xC7, 0x98, 
-    0x84, 0x8C, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x65, 0x88, 0x85, 0x88, 0x84, 
-    0x90, 0x63, 0x8C, 0x63, 0x8C, 0x84, 0x8C, 0xE8, 0xA0, 0x84, 0x90, 0x63, 0x8C, 0xA5, 0x94, 
-    0xC7, 0x98, 0xC7, 0x98, 0x86, 0x8C, 0x63, 0x8C, 0x84, 0x90, 0x84, 0x90, 0xA5, 0x94, 0x84, 
-    0x90, 0x84, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0x23, 0x84, 0x21, 0x84, 0x84, 0x8C, 0x64, 0x88, 
-    0x64, 0x88, 0x25, 0x80, 0x64, 0x88, 0x23, 0x80, 0x64, 0x88, 0x25, 0x80, 0x64, 0x84, 0x44, 
-    0x80, 0x25, 0x80, 0x64, 0x84, 0x23, 0x80, 0x85, 0x88, 0x25, 0x80, 0xA5, 0x94, 0x65, 0x88, 
-    0x02, 0x80, 0xA5, 0x94, 0x45, 0x88, 0x86, 0x88, 0xA5, 0x90, 0x45, 0x88, 0x86, 0x8C, 0x84, 
-    0x90, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 0x02, 0x80, 0x43, 0x84, 0x45, 0x88, 0x66, 0x8C, 
-    0x64, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 0x63, 
-    0x8C, 0x45, 0x88, 0x85, 0x88, 0x45, 0x88, 0x64, 0x88, 0x64, 0x88, 0x63, 0x8C, 0xA5, 0x94, 
-    0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x94, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x94, 0x63, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x84, 0x90, 0x84, 0x90, 0x08, 0x99, 0xE7, 0x9C, 0x84, 
-    0x8C, 0x23, 0x84, 0x63, 0x8C, 0x63, 0x8C, 0xA5, 0x90, 0x63, 0x8C, 0x84, 0x90, 0x08, 0x99, 
-    0xC6, 0x94, 0xA5, 0x90, 0x63, 0x8C, 0x84, 0x90, 0x08, 0x99, 0xC6, 0x94, 0x85, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0xC6, 0x94, 0xA5, 0x94, 0x84, 0x90, 0xC6, 0x94, 0x86, 0x88, 0xA5, 0x90, 
-    0x86, 0x88, 0xA5, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x94, 0xC6, 0x94, 0xA5, 
-    0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA5, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0x84, 0x90, 0xC6, 0x94, 0xA5, 0x90, 
-    0xA5, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x66, 0x8C, 0x84, 
-    0x8C, 0x86, 0x8C, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x84, 0x90, 
-    0x63, 0x8C, 0x86, 0x88, 0x63, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0x84, 
-    0x90, 0x63, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0x63, 0x8C, 0x63, 0x8C, 0xC7, 0x98, 0x84, 0x8C, 
-    0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x84, 0x8C, 0xC6, 0x94, 0x63, 0x8C, 0x84, 0x90, 0x63, 
-    0x8C, 0x23, 0x84, 0x84, 0x90, 0x63, 0x88, 0x84, 0x90, 0x84, 0x90, 0x84, 0x8C, 0x23, 0x84, 
-    0x85, 0x88, 0x01, 0x80, 0x63, 0x88, 0xC6, 0x94, 0xA5, 0x94, 0x84, 0x90, 0xA5, 0x90, 0x86, 
-    0x8C, 0x63, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x90, 0xA7, 0x88, 0xA5, 0x90, 
-    0x43, 0x84, 0x45, 0x88, 0x65, 0x88, 0x84, 0x90, 0xA5, 0x90, 0x84, 0x90, 0xA7, 0x88, 0x84, 
-    0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x94, 0xA5, 0x90, 0xA5, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0x86, 0x8C, 0x63, 0x8C, 0x64, 0x88, 0xA4, 0x80, 0x00, 0x80, 0x63, 0x8C, 0xC6, 
-    0x94, 0xA5, 0x94, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x84, 0x90, 0xC6, 0x94, 0xA5, 0x94, 
-    0xA6, 0x94, 0xA6, 0x94, 0x84, 0x90, 0xA5, 0x90, 0x65, 0x88, 0x21, 0x84, 0x42, 0x88, 0x63, 
-    0x8C, 0x84, 0x8C, 0xC7, 0x98, 0xE7, 0x9C, 0x84, 0x8C, 0x23, 0x84, 0x84, 0x90, 0x84, 0x8C, 
-    0xA5, 0x94, 0xA5, 0x94, 0xC6, 0x94, 0x64, 0x88, 0x65, 0x88, 0x84, 0x90, 0x84, 0x8C, 0xA5, 
-    0x94, 0xA5, 0x90, 0x01, 0x80, 0x42, 0x88, 0xA5, 0x94, 0xA5, 0x94, 0x21, 0x84, 0x85, 0x88, 
-    0x64, 0x88, 0x64, 0x88, 0x25, 0x80, 0x23, 0x80, 0x64, 0x88, 0x44, 0x84, 0x23, 0x84, 0x25, 
-    0x80, 0x44, 0x84, 0x44, 0x84, 0x44, 0x84, 0x25, 0x80, 0x86, 0x88, 0x24, 0x80, 0x86, 0x8C, 
-    0x64, 0x88, 0x23, 0x80, 0xA5, 0x94, 0x45, 0x88, 0x64, 0x88, 0xA5, 0x90, 0x45, 0x88, 0x84, 
-    0x90, 0xA5, 0x90, 0x02, 0x80, 0x24, 0x80, 0x23, 0x84, 0x02, 0x80, 0x23, 0x80, 0x64, 0x88, 
-    0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 0x63, 
-    0x8C, 0x66, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 
-    0x85, 0x88, 0x84, 0x90, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA5, 0x90, 0x86, 0x8C, 0x84, 0x90, 0xA7, 0x88, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x94, 0x86, 0x8C, 0xA5, 0x90, 0x08, 0x99, 0xA5, 0x94, 0x63, 0x8C, 0x84, 0x8C, 0xA5, 
-    0x90, 0xC6, 0x94, 0x63, 0x8C, 0x63, 0x8C, 0x84, 0x90, 0xA5, 0x94, 0x63, 0x8C, 0x84, 0x90, 
-    0x63, 0x8C, 0x63, 0x8C, 0x84, 0x90, 0x63, 0x8C, 0x84, 0x90, 0x63, 0x88, 0x63, 0x88, 0x23, 
-    0x84, 0xA5, 0x94, 0xA5, 0x94, 0x42, 0x88, 0x84, 0x90, 0x08, 0x99, 0xC7, 0x98, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xC6, 0x94, 
-    0x84, 0x90, 0xC6, 0x94, 0xA5, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0x86, 0x8C, 0x84, 0x90, 0x84, 0x8C, 0x84, 0x8C, 0x86, 
-    0x8C, 0x85, 0x88, 0x84, 0x90, 0x86, 0x8C, 0xA5, 0x94, 0x86, 0x8C, 0x84, 0x8C, 0x85, 0x88, 
-    0x66, 0x8C, 0x63, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0xA7, 0x88, 0x85, 0x88, 0xA5, 0x90, 0xA5, 
-    0x90, 0xC6, 0x94, 0x84, 0x90, 0x23, 0x84, 0x42, 0x88, 0x84, 0x90, 0xE8, 0xA0, 0xC8, 0x90, 
-    0xC7, 0x98, 0x84, 0x90, 0x42, 0x88, 0x63, 0x8C, 0x08, 0x99, 0xC7, 0x98, 0x84, 0x90, 0x84, 
-    0x90, 0x08, 0x99, 0x29, 0x9D, 0xC9, 0x94, 0x84, 0x90, 0x84, 0x8C, 0x84, 0x90, 0x63, 0x8C, 
-    0x63, 0x88, 0x42, 0x88, 0xE8, 0xA0, 0xA5, 0x90, 0x42, 0x88, 0x42, 0x88, 0x08, 0x99, 0xC6, 
-    0x94, 0x86, 0x8C, 0x84, 0x8C, 0xA5, 0x94, 0x86, 0x8C, 0x84, 0x90, 0x86, 0x8C, 0x84, 0x90, 
-    0xC6, 0x94, 0xA5, 0x90, 0x63, 0x8C, 0x86, 0x88, 0x43, 0x84, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xC6, 0x94, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x64, 0x88, 0x42, 0x88, 0x84, 0x8C, 0xC6, 0x94, 0x63, 
-    0x8C, 0x00, 0x80, 0x63, 0x8C, 0x08, 0x99, 0x86, 0x88, 0x84, 0x90, 0x84, 0x90, 0x42, 0x84, 
-    0x23, 0x84, 0x42, 0x88, 0xC6, 0x94, 0xA5, 0x94, 0x63, 0x8C, 0x63, 0x8C, 0x84, 0x90, 0x08, 
-    0x99, 0xA5, 0x90, 0x63, 0x8C, 0xA5, 0x90, 0xA5, 0x94, 0xA5, 0x94, 0x63, 0x8C, 0x84, 0x90, 
-    0x84, 0x8C, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x84, 0x65, 0x88, 0x63, 0x8C, 0x84, 0x90, 0x84, 
-    0x90, 0x84, 0x90, 0xA5, 0x90, 0x84, 0x90, 0x84, 0x90, 0x42, 0x88, 0x63, 0x88, 0xA5, 0x90, 
-    0xA5, 0x94, 0x64, 0x88, 0x25, 0x80, 0x64, 0x88, 0x64, 0x88, 0x44, 0x80, 0x25, 0x80, 0x44, 
-    0x84, 0x44, 0x84, 0x44, 0x80, 0x25, 0x80, 0x44, 0x84, 0x44, 0x84, 0x65, 0x88, 0x24, 0x80, 
-    0x84, 0x8C, 0x85, 0x88, 0x02, 0x80, 0xA5, 0x94, 0x66, 0x8C, 0x45, 0x88, 0xA5, 0x90, 0x02, 
-    0x80, 0xA5, 0x94, 0x86, 0x8C, 0x02, 0x80, 0x24, 0x80, 0x23, 0x80, 0x02, 0x80, 0x45, 0x88, 
-    0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x85, 
-    0x88, 0x45, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 
-    0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x84, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0x63, 0x8C, 0xA5, 0x90, 0xA5, 0x94, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x94, 
-    0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x84, 
-    0x8C, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0x09, 0xA5, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0xC6, 0x94, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0xC6, 0x94, 0xA5, 0x90, 
-    0xC6, 0x94, 0xA5, 0x90, 0x08, 0x99, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 
-    0x90, 0xC6, 0x94, 0x84, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 
-    0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x94, 0xA5, 
-    0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0x84, 0x90, 
-    0xA5, 0x90, 0xA5, 0x94, 0x86, 0x8C, 0xA7, 0x88, 0x84, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0x86, 
-    0x8C, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x84, 0x8C, 0xA5, 0x94, 0x86, 0x8C, 
-    0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x66, 
-    0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0xC7, 0x98, 
-    0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x29, 0x9D, 0x6B, 0xA1, 0xE7, 0x9C, 0xA5, 0x90, 0x08, 
-    0x99, 0x29, 0x9D, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x6B, 0xA1, 
-    0x6B, 0xA1, 0x08, 0x99, 0xC6, 0x94, 0xA7, 0x90, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0xC6, 
-    0x94, 0x85, 0x88, 0xA5, 0x90, 0xA5, 0x94, 0xA7, 0x88, 0xA5, 0x90, 0x84, 0x90, 0x84, 0x90, 
-    0xA7, 0x88, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x64, 0x88, 0x65, 0x88, 0x43, 0x84, 0xA5, 
-    0x90, 0xA5, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x94, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x90, 0x85, 0x88, 0x42, 0x88, 0x42, 0x88, 0x84, 
-    0x8C, 0xC7, 0x98, 0x29, 0x9D, 0x29, 0x9D, 0xA5, 0x90, 0x84, 0x8C, 0xC6, 0x94, 0x29, 0x9D, 
-    0x6B, 0xA1, 0x6B, 0xA1, 0x29, 0x9D, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xE7, 
-    0x9C, 0xA5, 0x90, 0xA5, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x85, 0x88, 0xC6, 0x94, 0x08, 0x99, 
-    0xC9, 0x94, 0xE7, 0x9C, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xA7, 0x90, 0x63, 0x8C, 0xC7, 
-    0x98, 0x08, 0x99, 0xA7, 0x90, 0x84, 0x8C, 0xA7, 0x90, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0xC6, 0x94, 0x63, 0x8C, 0x64, 0x88, 0x44, 0x84, 0x44, 0x84, 0x44, 0x80, 0x25, 0x80, 0x44, 
-    0x84, 0x44, 0x84, 0x44, 0x80, 0x44, 0x84, 0x25, 0x80, 0x64, 0x84, 0x44, 0x80, 0x63, 0x8C, 
-    0x25, 0x80, 0x66, 0x8C, 0x45, 0x88, 0x02, 0x80, 0xA5, 0x94, 0x66, 0x8C, 0x45, 0x88, 0xA5, 
-    0x90, 0x02, 0x80, 0x84, 0x90, 0x86, 0x8C, 0x02, 0x80, 0x23, 0x80, 0x23, 0x80, 0x01, 0x80, 
-    0x23, 0x84, 0x64, 0x88, 0x64, 0x88, 0x43, 0x84, 0x65, 0x88, 0x43, 0x84, 0x65, 0x88, 0x66, 
-    0x8C, 0x43, 0x84, 0x84, 0x8C, 0x86, 0x8C, 0x23, 0x84, 0x65, 0x88, 0x64, 0x88, 0x66, 0x8C, 
-    0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x84, 0x90, 0x85, 0x88, 0x84, 0x8C, 0x84, 0x90, 0x86, 
-    0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0x86, 0x8C, 0x63, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 
-    0x86, 0x8C, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0x63, 0x8C, 0x86, 0x88, 0x64, 
-    0x88, 0x63, 0x8C, 0x86, 0x88, 0xA5, 0x94, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0xA5, 0x90, 0xA5, 
-    0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x84, 0x8C, 0xC6, 0x94, 0xA5, 0x94, 
-    0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0x84, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0x84, 
-    0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x84, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0x84, 0x90, 
-    0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0x84, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x94, 0x86, 0x8C, 0xA5, 0x90, 
-    0xA5, 0x90, 0xC6, 0x94, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x86, 0x8C, 0x84, 
-    0x90, 0x84, 0x8C, 0xA5, 0x94, 0x86, 0x8C, 0x85, 0x88, 0x84, 0x90, 0x86, 0x8C, 0x64, 0x88, 
-    0xA5, 0x94, 0x84, 0x8C, 0x86, 0x8C, 0x63, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x66, 0x8C, 0x84, 
-    0x90, 0xA5, 0x90, 0x86, 0x8C, 0x65, 0x88, 0x45, 0x88, 0x66, 0x8C, 0x84, 0x8C, 0xA7, 0x88, 
-    0xC6, 0x94, 0xC6, 0x94, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0xA5, 
-    0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA6, 0x94, 0x84, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xA7, 0x90, 0x84, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 0x86, 0x8C, 
-    0x84, 0x90, 0xA5, 0x90, 0x63, 0x8C, 0xA5, 0x90, 0xA5, 0x94, 0xA7, 0x88, 0x45, 0x88, 0x63, 
-    0x8C, 0x86, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 0x84, 0x90, 
-    0xA5, 0x90, 0xA5, 0x94, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 0x84, 0x8C, 0x43, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x84, 0x8C, 0x84, 0x90, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x63, 0x8C, 
-    0x84, 0x90, 0xA7, 0x88, 0x63, 0x8C, 0x86, 0x88, 0xA5, 0x90, 0x63, 0x8C, 0x84, 0x8C, 0xA7, 
-    0x88, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x90, 0x84, 0x90, 0x63, 0x8C, 
-    0x84, 0x8C, 0x66, 0x8C, 0x63, 0x8C, 0x64, 0x88, 0x65, 0x88, 0x63, 0x8C, 0x45, 0x88, 0x85, 
-    0x88, 0x85, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x85, 0x88, 0x64, 0x88, 0x85, 0x88, 0x84, 0x90, 
-    0x43, 0x84, 0x86, 0x8C, 0x43, 0x84, 0x63, 0x8C, 0x25, 0x80, 0x65, 0x88, 0x25, 0x80, 0x44, 
-    0x84, 0x44, 0x84, 0x44, 0x84, 0x25, 0x80, 0x64, 0x84, 0x23, 0x80, 0x25, 0x80, 0x43, 0x84, 
-    0x86, 0x88, 0x24, 0x80, 0x84, 0x8C, 0x45, 0x88, 0x23, 0x80, 0xA6, 0x94, 0x66, 0x8C, 0x64, 
-    0x88, 0xA7, 0x88, 0x42, 0x84, 0x86, 0x88, 0xA5, 0x94, 0x02, 0x80, 0x24, 0x80, 0x42, 0x84, 
-    0x02, 0x80, 0x42, 0x84, 0x45, 0x88, 0x65, 0x88, 0x45, 0x88, 0x64, 0x88, 0x65, 0x88, 0x43, 
-    0x84, 0x86, 0x8C, 0x63, 0x8C, 0x65, 0x88, 0x63, 0x8C, 0x86, 0x88, 0x63, 0x8C, 0x25, 0x80, 
-    0x84, 0x8C, 0x65, 0x88, 0x43, 0x84, 0x84, 0x8C, 0x45, 0x88, 0x65, 0x88, 0x25, 0x80, 0x44, 
-    0x84, 0x25, 0x80, 0x44, 0x84, 0x64, 0x84, 0x25, 0x80, 0x64, 0x84, 0x64, 0x84, 0x25, 0x80, 
-    0x64, 0x84, 0x64, 0x84, 0x44, 0x84, 0x64, 0x84, 0x44, 0x84, 0x64, 0x84, 0x25, 0x80, 0x25, 
-    0x80, 0x25, 0x80, 0x25, 0x80, 0x23, 0x80, 0x25, 0x80, 0x86, 0x88, 0x64, 0x88, 0x65, 0x88, 
-    0x86, 0x88, 0x44, 0x84, 0x64, 0x84, 0x64, 0x84, 0x86, 0x88, 0x86, 0x88, 0x23, 0x80, 0x65, 
-    0x88, 0x86, 0x88, 0x64, 0x88, 0x44, 0x84, 0x86, 0x88, 0x65, 0x88, 0x44, 0x84, 0x65, 0x88, 
-    0x86, 0x88, 0x25, 0x80, 0x64, 0x88, 0x85, 0x88, 0x44, 0x84, 0x86, 0x88, 0x64, 0x84, 0x85, 
-    0x88, 0x85, 0x88, 0x44, 0x84, 0x65, 0x88, 0x65, 0x88, 0x86, 0x88, 0x84, 0x8C, 0x86, 0x88, 
-    0x44, 0x84, 0x86, 0x88, 0x64, 0x84, 0x85, 0x88, 0x64, 0x88, 0x86, 0x88, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x88, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xA5, 0x90, 0x84, 0x90, 0x84, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0x23, 
-    0x80, 0x86, 0x88, 0x25, 0x80, 0x64, 0x88, 0x44, 0x84, 0x25, 0x80, 0x25, 0x80, 0x64, 0x88, 
-    0x44, 0x84, 0x25, 0x80, 0x64, 0x84, 0x25, 0x80, 0x65, 0x88, 0x25, 0x80, 0x45, 0x88, 0x64, 
-    0x88, 0x25, 0x80, 0x44, 0x84, 0x25, 0x80, 0x25, 0x80, 0x23, 0x84, 0x44, 0x84, 0x86, 0x88, 
-    0x23, 0x80, 0x86, 0x88, 0x65, 0x88, 0x44, 0x84, 0x44, 0x84, 0x86, 0x88, 0x25, 0x80, 0x65, 
-    0x88, 0x44, 0x84, 0x86, 0x88, 0x25, 0x80, 0x86, 0x88, 0x85, 0x88, 0x25, 0x80, 0x85, 0x88, 
-    0x64, 0x88, 0x86, 0x88, 0x23, 0x84, 0x86, 0x88, 0x45, 0x88, 0x86, 0x88, 0x64, 0x88, 0x64, 
-    0x88, 0x64, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x44, 0x84, 0x64, 0x88, 0x86, 0x88, 0x23, 0x84, 
-    0x44, 0x84, 0x44, 0x80, 0x44, 0x84, 0x86, 0x88, 0x44, 0x80, 0x25, 0x80, 0x65, 0x88, 0x23, 
-    0x80, 0x46, 0x84, 0x23, 0x80, 0x23, 0x80, 0x65, 0x88, 0x84, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x94, 0xA5, 0x90, 0x64, 0x88, 0x64, 0x88, 0x65, 0x88, 0x44, 0x84, 
-    0x85, 0x88, 0x44, 0x84, 0x85, 0x88, 0x44, 0x84, 0x44, 0x84, 0x44, 0x84, 0x65, 0x88, 0x25, 
-    0x80, 0x23, 0x84, 0x25, 0x80, 0x64, 0x88, 0x26, 0x80, 0x23, 0x84, 0x46, 0x84, 0x25, 0x80, 
-    0x25, 0x80, 0x46, 0x84, 0x25, 0x80, 0x46, 0x84, 0x25, 0x80, 0x46, 0x84, 0x27, 0x80, 0x25, 
-    0x80, 0x46, 0x84, 0x25, 0x80, 0x46, 0x84, 0x25, 0x80, 0x46, 0x84, 0x25, 0x80, 0x46, 0x84, 
-    0x46, 0x84, 0x25, 0x80, 0x46, 0x84, 0x25, 0x80, 0x46, 0x84, 0x25, 0x80, 0x25, 0x80, 0x25, 
-    0x80, 0x25, 0x80, 0x25, 0x80, 0x46, 0x84, 0x25, 0x80, 0x25, 0x80, 0x44, 0x84, 0x25, 0x80, 
-    0x26, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x26, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 
-    0x80, 0x25, 0x80, 0x25, 0x80, 0x23, 0x84, 0x44, 0x84, 0x44, 0x80, 0x23, 0x80, 0x65, 0x88, 
-    0x44, 0x80, 0x65, 0x88, 0x25, 0x80, 0x86, 0x88, 0x43, 0x84, 0x02, 0x80, 0xC7, 0x98, 0x45, 
-    0x88, 0x65, 0x88, 0xA5, 0x94, 0x42, 0x84, 0x65, 0x88, 0x66, 0x8C, 0x02, 0x80, 0x25, 0x80, 
-    0x02, 0x80, 0x01, 0x80, 0x44, 0x84, 0x65, 0x88, 0x44, 0x84, 0x64, 0x88, 0x64, 0x88, 0x45, 
-    0x88, 0x65, 0x88, 0x23, 0x84, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x86, 0x8C, 0x43, 0x84, 
-    0x86, 0x8C, 0x23, 0x84, 0x86, 0x88, 0x25, 0x80, 0x25, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x25, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x45, 
-    0x88, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xC6, 0x94, 0x86, 0x8C, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x43, 
-    0x84, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x86, 0x88, 0xA5, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0x86, 0x8C, 0xA5, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0x86, 0x88, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x25, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x25, 0x80, 0x63, 0x8C, 0x24, 0x80, 0x85, 0x88, 0x43, 0x84, 0x23, 0x80, 0xA5, 
-    0x94, 0x66, 0x8C, 0x65, 0x88, 0x84, 0x90, 0x24, 0x80, 0x66, 0x8C, 0x63, 0x8C, 0x02, 0x80, 
-    0x23, 0x80, 0x23, 0x80, 0x02, 0x80, 0x23, 0x80, 0x65, 0x88, 0x66, 0x8C, 0x43, 0x84, 0x44, 
-    0x84, 0x85, 0x88, 0x43, 0x84, 0x86, 0x8C, 0x42, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x45, 0x88, 
-    0x84, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x44, 0x80, 0x05, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x24, 0x80, 0x85, 0x88, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 
-    0xC6, 0x94, 0x86, 0x8C, 0x84, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0x86, 
-    0x88, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x43, 0x84, 
-    0xA7, 0x88, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x24, 0x80, 0x43, 0x90, 0x86, 0x88, 0x24, 0x80, 0x86, 0x8C, 0x45, 0x88, 0x24, 
-    0x80, 0xA5, 0x94, 0x45, 0x88, 0x63, 0x8C, 0xA5, 0x90, 0x02, 0x80, 0x84, 0x90, 0xA7, 0x88, 
-    0x02, 0x80, 0x25, 0x80, 0x02, 0x80, 0x01, 0x80, 0x23, 0x84, 0x64, 0x88, 0x64, 0x88, 0x85, 
-    0x88, 0x43, 0x84, 0x63, 0x8C, 0x45, 0x88, 0x64, 0x88, 0x85, 0x88, 0x45, 0x88, 0x84, 0x8C, 
-    0x85, 0x88, 0x45, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x25, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x65, 0x88, 0xA7, 0x88, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 
-    0xA7, 0x88, 0x63, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 
-    0x90, 0x44, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x45, 0x88, 0xC8, 0x8C, 0xA7, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x86, 0x88, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x45, 0x88, 0x66, 0x8C, 0x02, 0x80, 0x86, 0x8C, 0x23, 
-    0x84, 0x02, 0x80, 0xA5, 0x94, 0x66, 0x8C, 0x45, 0x88, 0xA5, 0x90, 0x23, 0x84, 0x84, 0x90, 
-    0x86, 0x8C, 0x02, 0x80, 0x23, 0x80, 0x24, 0x80, 0x01, 0x80, 0x23, 0x84, 0x64, 0x88, 0x64, 
-    0x88, 0x23, 0x84, 0x45, 0x88, 0x85, 0x88, 0x64, 0x88, 0x45, 0x88, 0x63, 0x8C, 0x86, 0x8C, 
-    0x85, 0x88, 0x63, 0x88, 0x64, 0x88, 0x66, 0x8C, 0x64, 0x88, 0x25, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x45, 0x88, 0xA7, 0x88, 0xC8, 0x90, 0xA5, 0x90, 
-    0xC6, 0x94, 0xC8, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 
-    0x90, 0xC6, 0x94, 0x86, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x25, 0x80, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 
-    0x90, 0xA5, 0x90, 0x67, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC8, 0x90, 0x44, 0x84, 
-    0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x23, 0x80, 0x64, 0x88, 0x86, 0x8C, 0x02, 0x80, 0x63, 
-    0x8C, 0x45, 0x88, 0x24, 0x80, 0xA5, 0x94, 0x45, 0x88, 0x65, 0x88, 0xA5, 0x90, 0x02, 0x80, 
-    0xA5, 0x94, 0x86, 0x8C, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0x23, 0x84, 0x64, 
-    0x88, 0x64, 0x88, 0x64, 0x88, 0x23, 0x84, 0x45, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x64, 0x88, 
-    0x85, 0x88, 0x84, 0x90, 0x43, 0x84, 0x45, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x23, 0x80, 0x02, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x25, 0x80, 0xA5, 0x90, 0xA5, 0x90, 
-    0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0x67, 0x8C, 0xA5, 0x90, 0xA5, 
-    0x90, 0xC6, 0x94, 0xA7, 0x90, 0x44, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x86, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 
-    0x86, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x23, 0x80, 0x63, 0x8C, 0x66, 0x8C, 0x02, 
-    0x80, 0x86, 0x88, 0x45, 0x88, 0x02, 0x80, 0xA5, 0x94, 0x45, 0x88, 0x64, 0x88, 0x86, 0x8C, 
-    0x42, 0x84, 0x63, 0x8C, 0xA7, 0x88, 0x02, 0x80, 0x05, 0x80, 0x42, 0x84, 0x01, 0x80, 0x64, 
-    0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x84, 0x8C, 0x44, 0x84, 0x23, 0x80, 0x65, 0x88, 
-    0x84, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x43, 0x84, 0xA7, 0x88, 0x64, 0x88, 0x85, 0x88, 0x24, 
-    0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x86, 0x88, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0x86, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x45, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA7, 0x90, 0xC6, 0x94, 0x86, 0x8C, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x42, 0x84, 0xA5, 0x94, 0x86, 
-    0x88, 0x24, 0x80, 0x63, 0x8C, 0x45, 0x88, 0x24, 0x80, 0xA5, 0x94, 0x45, 0x88, 0x86, 0x88, 
-    0xA5, 0x94, 0x24, 0x80, 0x63, 0x8C, 0x66, 0x8C, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x23, 0x80, 0x63, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x64, 0x84, 0x65, 0x88, 0x64, 0x88, 
-    0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x45, 0x88, 0x64, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x25, 
-    0x80, 0x23, 0x84, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x45, 0x88, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0x86, 0x8C, 0xA7, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x46, 0x84, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 
-    0x90, 0x06, 0x89, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 
-    0xA7, 0x90, 0xA7, 0x90, 0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x23, 0x84, 0x63, 
-    0x8C, 0xA7, 0x88, 0x24, 0x80, 0x86, 0x88, 0x45, 0x88, 0x02, 0x80, 0xA5, 0x94, 0x45, 0x88, 
-    0x25, 0x80, 0x84, 0x90, 0x02, 0x80, 0xA5, 0x94, 0x86, 0x88, 0x02, 0x80, 0x23, 0x80, 0x24, 
-    0x80, 0x01, 0x80, 0x23, 0x84, 0x64, 0x88, 0x85, 0x88, 0x84, 0x90, 0x64, 0x88, 0x86, 0x88, 
-    0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x64, 
-    0x88, 0x64, 0x88, 0x25, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x46, 0x84, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0x64, 0x88, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x45, 0x88, 0xA7, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x43, 
-    0x84, 0xA5, 0x90, 0x86, 0x88, 0x02, 0x80, 0x63, 0x8C, 0x45, 0x88, 0x24, 0x80, 0x84, 0x90, 
-    0x45, 0x88, 0x45, 0x88, 0x86, 0x8C, 0x02, 0x80, 0xA5, 0x94, 0x65, 0x88, 0x02, 0x80, 0x25, 
-    0x80, 0x02, 0x80, 0x21, 0x80, 0x63, 0x8C, 0x45, 0x88, 0x65, 0x88, 0x64, 0x88, 0x63, 0x8C, 
-    0x85, 0x88, 0x85, 0x88, 0x84, 0x90, 0x65, 0x88, 0x64, 0x88, 0x64, 0x88, 0x63, 0x8C, 0x64, 
-    0x88, 0x84, 0x8C, 0x86, 0x88, 0x24, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x65, 0x88, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x88, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x65, 0x88, 0xA7, 
-    0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x88, 
-    0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0x64, 0x88, 0x21, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x45, 0x88, 0xA5, 0x94, 0x86, 0x8C, 0x24, 0x80, 0x66, 0x8C, 0x25, 0x80, 0x23, 0x80, 
-    0xA5, 0x94, 0x25, 0x80, 0x64, 0x88, 0x86, 0x8C, 0x42, 0x84, 0x65, 0x88, 0x66, 0x8C, 0x02, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x01, 0x80, 0x23, 0x84, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 
-    0x84, 0x8C, 0x85, 0x88, 0x84, 0x90, 0x64, 0x88, 0x64, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x64, 
-    0x88, 0x64, 0x88, 0x86, 0x8C, 0x23, 0x84, 0x23, 0x84, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x45, 0x88, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 
-    0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0x44, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x45, 
-    0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0x06, 0x89, 0xA7, 0x90, 0xA7, 0x90, 
-    0xA5, 0x90, 0xC6, 0x94, 0x86, 0x88, 0xA5, 0x90, 0xC8, 0x90, 0x44, 0x84, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x84, 0x8C, 0xA5, 0x90, 0x66, 0x8C, 0x42, 0x84, 0x86, 0x88, 0x45, 0x88, 
-    0x02, 0x80, 0x66, 0x8C, 0x45, 0x88, 0x65, 0x88, 0x86, 0x8C, 0x02, 0x80, 0x66, 0x8C, 0xA5, 
-    0x94, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0x63, 0x88, 0x64, 0x88, 0x64, 0x88, 
-    0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 0x64, 0x88, 0x84, 
-    0x8C, 0x64, 0x88, 0x84, 0x8C, 0x45, 0x88, 0x64, 0x88, 0x25, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x65, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 
-    0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x86, 0x88, 0xA5, 0x90, 
-    0xC8, 0x90, 0x44, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x65, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0x86, 0x88, 0xA5, 0x90, 0xC8, 0x90, 0xA7, 0x90, 0x44, 0x84, 0x21, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x63, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 0x02, 0x80, 0x63, 0x8C, 
-    0x45, 0x88, 0x02, 0x80, 0xA5, 0x94, 0x45, 0x88, 0x43, 0x84, 0xA5, 0x90, 0x02, 0x80, 0x63, 
-    0x8C, 0xA7, 0x88, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x01, 0x80, 0x23, 0x84, 0x64, 0x88, 
-    0x64, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x84, 0x90, 0x64, 0x88, 0x64, 0x88, 0x63, 0x8C, 0x64, 
-    0x88, 0x64, 0x88, 0x86, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x02, 0x80, 0x21, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x45, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x88, 0xA5, 0x90, 
-    0xC8, 0x90, 0xA7, 0x90, 0x44, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x86, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 
-    0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA5, 0x90, 0xC8, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0x44, 
-    0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x42, 0x88, 0xA5, 0x94, 0xA7, 0x88, 0x24, 0x80, 
-    0x66, 0x8C, 0x45, 0x88, 0x23, 0x80, 0xA5, 0x94, 0x25, 0x80, 0x43, 0x84, 0xA5, 0x94, 0x24, 
-    0x80, 0x63, 0x8C, 0x86, 0x8C, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0x63, 0x88, 
-    0x64, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 0x23, 0x84, 0x64, 
-    0x88, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0x63, 0x8C, 0x85, 0x88, 0x45, 0x88, 0x44, 0x84, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x86, 0x88, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA5, 0x90, 
-    0xC8, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0x44, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x45, 0x88, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xC8, 0x90, 0xA5, 
-    0x90, 0x46, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x42, 0x88, 0xC8, 0x90, 0x86, 0x8C, 
-    0x02, 0x80, 0x45, 0x88, 0x45, 0x88, 0x02, 0x80, 0xA5, 0x94, 0x45, 0x88, 0x23, 0x84, 0xA7, 
-    0x88, 0x02, 0x80, 0x66, 0x8C, 0x66, 0x8C, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x01, 0x80, 
-    0x23, 0x80, 0x84, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x85, 0x88, 0x84, 0x90, 0x64, 0x88, 0x85, 
-    0x88, 0x84, 0x90, 0x43, 0x84, 0x66, 0x8C, 0x63, 0x8C, 0x44, 0x84, 0x86, 0x88, 0x85, 0x88, 
-    0x23, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x65, 0x88, 0xA7, 
-    0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA7, 0x88, 0xA5, 0x90, 0xC8, 0x90, 0xA5, 0x90, 0x46, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x65, 0x88, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x45, 0x88, 0xC6, 0x94, 
-    0x66, 0x8C, 0x24, 0x80, 0x66, 0x8C, 0x63, 0x8C, 0x24, 0x80, 0x63, 0x8C, 0x45, 0x88, 0x25, 
-    0x80, 0xA7, 0x88, 0x23, 0x80, 0x84, 0x8C, 0x66, 0x8C, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 
-    0x01, 0x80, 0x63, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x85, 
-    0x88, 0x63, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x84, 0x90, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 
-    0x43, 0x84, 0x23, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x45, 
-    0x88, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 0x90, 
-    0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x64, 0x88, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x86, 0x88, 0xA7, 0x90, 0x84, 0x90, 
-    0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0x84, 
-    0x90, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x63, 0x8C, 
-    0xA7, 0x90, 0x85, 0x88, 0x02, 0x80, 0xA5, 0x94, 0x25, 0x80, 0x23, 0x80, 0xA5, 0x94, 0x25, 
-    0x80, 0x45, 0x88, 0x86, 0x8C, 0x02, 0x80, 0x63, 0x8C, 0xA7, 0x88, 0x02, 0x80, 0x05, 0x80, 
-    0x02, 0x80, 0x01, 0x80, 0x63, 0x88, 0x84, 0x8C, 0x65, 0x88, 0x63, 0x8C, 0x86, 0x88, 0x63, 
-    0x8C, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x63, 0x88, 0x86, 0x88, 0x85, 0x88, 
-    0x84, 0x90, 0x64, 0x88, 0x23, 0x84, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x86, 0x88, 0xA7, 0x90, 0x84, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0x84, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x88, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x65, 0x88, 0xA7, 0x90, 
-    0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0x86, 
-    0x8C, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0x25, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x63, 0x8C, 0x84, 0x90, 0x86, 0x8C, 0x02, 0x80, 0x63, 0x8C, 0x45, 0x88, 0x24, 0x80, 0x66, 
-    0x8C, 0x43, 0x84, 0x45, 0x88, 0xA7, 0x88, 0x23, 0x80, 0x66, 0x8C, 0x85, 0x88, 0x02, 0x80, 
-    0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0x23, 0x80, 0x84, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x85, 
-    0x88, 0x63, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x23, 0x80, 0x65, 0x88, 0x45, 0x88, 0x64, 0x88, 
-    0x64, 0x88, 0x64, 0x88, 0x86, 0x88, 0x24, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x65, 0x88, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x90, 
-    0xA7, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0x25, 
-    0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x86, 0x88, 
-    0xC6, 0x94, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 
-    0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0x65, 0x88, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x63, 0x8C, 0xA5, 0x94, 0x66, 0x8C, 0x02, 0x80, 0x86, 0x88, 0x45, 0x88, 0x02, 
-    0x80, 0xA5, 0x94, 0x45, 0x88, 0x43, 0x84, 0x67, 0x8C, 0x23, 0x80, 0x85, 0x88, 0x85, 0x88, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x01, 0x80, 0x63, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x84, 
-    0x8C, 0x85, 0x88, 0x85, 0x88, 0x84, 0x90, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 0x65, 0x88, 
-    0x84, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x43, 0x84, 0x23, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x86, 0x88, 0xC6, 0x94, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 
-    0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 
-    0x88, 0x65, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x45, 0x88, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x88, 0xA7, 
-    0x88, 0x84, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0x64, 0x88, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x66, 0x8C, 0xA5, 0x94, 0x86, 0x8C, 0x02, 0x80, 0x66, 0x8C, 0x45, 
-    0x88, 0x02, 0x80, 0x63, 0x8C, 0x25, 0x80, 0x45, 0x88, 0x84, 0x90, 0x24, 0x80, 0x85, 0x88, 
-    0x45, 0x88, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 0x01, 0x80, 0x43, 0x84, 0x84, 0x8C, 0x64, 
-    0x88, 0x84, 0x8C, 0x85, 0x88, 0x84, 0x90, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 
-    0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x86, 0x88, 0x23, 0x84, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x45, 0x88, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0x86, 0x88, 0xA7, 0x88, 0x84, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA7, 0x88, 0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x86, 0x88, 0xA7, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 
-    0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0x25, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x90, 0xA5, 0x90, 0x85, 0x88, 0x02, 0x80, 0x45, 
-    0x88, 0x45, 0x88, 0x02, 0x80, 0xA6, 0x94, 0x45, 0x88, 0x23, 0x84, 0xA7, 0x88, 0x23, 0x84, 
-    0x66, 0x8C, 0x84, 0x8C, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x01, 0x80, 0x42, 0x88, 0x84, 
-    0x8C, 0x64, 0x88, 0x84, 0x8C, 0x85, 0x88, 0x84, 0x90, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 
-    0x64, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x85, 0x88, 0x24, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x86, 0x88, 0xC6, 0x94, 0xA5, 0x90, 
-    0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 
-    0x90, 0xA7, 0x88, 0xA7, 0x88, 0x25, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x65, 0x88, 0xA5, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x63, 0x8C, 0xA5, 0x94, 0x86, 0x88, 0x02, 
-    0x80, 0x63, 0x8C, 0x45, 0x88, 0x24, 0x80, 0xA5, 0x94, 0x24, 0x80, 0x65, 0x88, 0x84, 0x90, 
-    0x23, 0x80, 0x84, 0x90, 0x66, 0x8C, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x01, 0x80, 0x42, 
-    0x88, 0x64, 0x88, 0x84, 0x8C, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 
-    0x23, 0x84, 0x64, 0x88, 0x84, 0x90, 0x64, 0x88, 0x84, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x42, 
-    0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x65, 0x88, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x64, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x25, 0x80, 0x06, 0x89, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0x84, 0x90, 0x25, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x63, 0x8C, 0xA5, 0x94, 0x85, 
-    0x88, 0x02, 0x80, 0x86, 0x88, 0x45, 0x88, 0x02, 0x80, 0xA5, 0x94, 0x45, 0x88, 0x45, 0x88, 
-    0xA5, 0x94, 0x24, 0x80, 0x63, 0x8C, 0x86, 0x88, 0x02, 0x80, 0x23, 0x80, 0x24, 0x80, 0x01, 
-    0x80, 0x42, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x63, 0x8C, 0x65, 0x88, 0x64, 0x88, 0x64, 0x88, 
-    0x64, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x84, 0x90, 0x64, 0x88, 0x85, 
-    0x88, 0x43, 0x84, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x25, 0x80, 
-    0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x90, 0x25, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x25, 0x80, 0xA5, 0x90, 0xA7, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0x84, 0x90, 0x84, 0x90, 0xC8, 0x90, 0x84, 0x90, 
-    0xA5, 0x90, 0x84, 0x90, 0x25, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x63, 0x8C, 0xA5, 
-    0x90, 0x86, 0x88, 0x02, 0x80, 0x66, 0x8C, 0x45, 0x88, 0x02, 0x80, 0x63, 0x8C, 0x45, 0x88, 
-    0x23, 0x80, 0x85, 0x88, 0x25, 0x80, 0x45, 0x88, 0x64, 0x88, 0x02, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x01, 0x80, 0x42, 0x84, 0x44, 0x84, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 
-    0x63, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x84, 0x90, 0x85, 0x88, 0x64, 0x88, 0x85, 
-    0x88, 0x63, 0x8C, 0x86, 0x8C, 0x42, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x25, 0x80, 0xA5, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x94, 0xA5, 0x94, 0xA5, 0x90, 0x84, 0x90, 0x25, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 
-    0x80, 0x01, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x23, 0x84, 0xA7, 0x88, 0xA5, 
-    0x90, 0xA7, 0x88, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x8C, 0x86, 0x88, 0x86, 0x8C, 
-    0x84, 0x90, 0xA7, 0x88, 0x84, 0x90, 0x23, 0x84, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x63, 
-    0x8C, 0xA5, 0x94, 0x85, 0x88, 0x02, 0x80, 0x63, 0x8C, 0x45, 0x88, 0x02, 0x80, 0xA5, 0x90, 
-    0x45, 0x88, 0x65, 0x88, 0x63, 0x8C, 0x25, 0x80, 0x63, 0x8C, 0x25, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x84, 0x8C, 0x65, 0x88, 0x84, 0x8C, 0x84, 0x90, 0x63, 0x8C, 0x84, 0x90, 
-    0x63, 0x8C, 0x84, 0x90, 0x84, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0x63, 0x8C, 0x84, 0x90, 0x63, 
-    0x8C, 0x84, 0x90, 0x84, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0x63, 0x88, 0x01, 0x80, 0x01, 0x80, 
-    0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x43, 0x84, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x88, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA5, 0x94, 0xA6, 0x94, 0xA5, 0x94, 0x84, 0x90, 0x86, 0x8C, 0x84, 0x90, 0x23, 0x84, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x25, 0x80, 0x84, 
-    0x8C, 0x65, 0x88, 0x84, 0x90, 0x65, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0x66, 0x8C, 
-    0x63, 0x8C, 0xA5, 0x90, 0x84, 0x90, 0x86, 0x88, 0x25, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 
-    0x80, 0x63, 0x8C, 0xA5, 0x90, 0x66, 0x8C, 0x02, 0x80, 0x86, 0x88, 0x45, 0x88, 0x02, 0x80, 
-    0x66, 0x8C, 0x43, 0x84, 0x25, 0x80, 0xA7, 0x88, 0x24, 0x80, 0x45, 0x88, 0x65, 0x88, 0x02, 
-    0x80, 0x23, 0x80, 0x24, 0x80, 0x64, 0x88, 0x65, 0x88, 0x63, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 
-    0x84, 0x8C, 0xA5, 0x90, 0x84, 0x8C, 0xA5, 0x90, 0x86, 0x88, 0xA7, 0x88, 0x84, 0x8C, 0x84, 
-    0x8C, 0xA5, 0x90, 0x84, 0x8C, 0xA5, 0x90, 0x86, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0x06, 0x89, 
-    0x84, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0xA5, 0x90, 0x86, 
-    0x8C, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 
-    0xA7, 0x88, 0xA5, 0x90, 0x84, 0x90, 0xA7, 0x88, 0x63, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 
-    0x90, 0xA7, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0x63, 0x8C, 
-    0xA7, 0x88, 0xA7, 0x88, 0x63, 0x8C, 0xA7, 0x88, 0xA5, 0x94, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA7, 0x88, 0x63, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 0x84, 0x90, 0xA7, 0x88, 0xA5, 0x90, 
-    0xA7, 0x88, 0x84, 0x90, 0xA7, 0x88, 0x84, 0x8C, 0xA8, 0x88, 0x84, 0x90, 0x86, 0x8C, 0xA7, 
-    0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x94, 0xA7, 0x88, 0x63, 0x8C, 
-    0x84, 0x8C, 0x84, 0x8C, 0x25, 0x80, 0x84, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 
-    0x88, 0xA7, 0x88, 0xA7, 0x88, 0x66, 0x8C, 0x63, 0x8C, 0xA5, 0x90, 0x84, 0x90, 0x86, 0x88, 
-    0x25, 0x80, 0xC6, 0x94, 0xA5, 0x90, 0x86, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x86, 
-    0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 
-    0x90, 0xA5, 0x90, 0x84, 0x90, 0x86, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0x84, 0x8C, 0xA7, 0x88, 
-    0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0x84, 0x90, 0xA7, 0x88, 0x84, 0x90, 0xA7, 
-    0x88, 0x84, 0x90, 0xA7, 0x88, 0x66, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x86, 0x8C, 0xA5, 0x94, 
-    0x86, 0x88, 0x84, 0x90, 0xA7, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0xA5, 0x94, 0xA7, 
-    0x88, 0x63, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x94, 0x86, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 
-    0xA7, 0x88, 0xA5, 0x94, 0x86, 0x8C, 0xA5, 0x94, 0x86, 0x8C, 0x84, 0x90, 0x84, 0x8C, 0x84, 
-    0x8C, 0x84, 0x8C, 0xA7, 0x88, 0x65, 0x88, 0xA5, 0x90, 0x84, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 
-    0x85, 0x88, 0x84, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0x64, 0x88, 0x86, 0x88, 0xA5, 0x90, 0x84, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0x66, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0x66, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 
-    0x66, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0x65, 0x88, 0x84, 0x8C, 0x06, 0x89, 0x84, 0x8C, 0xA8, 
-    0x88, 0xE5, 0x84, 0xE5, 0x84, 0xE5, 0x84, 0xA5, 0x94, 0xA7, 0x88, 0xE5, 0x84, 0xA5, 0x90, 
-    0xA5, 0x90, 0x86, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 
-    0x88, 0x06, 0x89, 0x06, 0x89, 0xA5, 0x90, 0xA8, 0x88, 0xE5, 0x84, 0xA5, 0x90, 0x06, 0x89, 
-    0x27, 0x8D, 0x06, 0x89, 0xC6, 0x94, 0x06, 0x89, 0x06, 0x89, 0x06, 0x89, 0x27, 0x8D, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x65, 0x88, 0x24, 0x80, 0x65, 0x88, 0x45, 0x88, 
-    0x24, 0x80, 0xA5, 0x94, 0x45, 0x88, 0x23, 0x84, 0x63, 0x8C, 0x02, 0x80, 0x45, 0x88, 0x64, 
-    0x88, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x84, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x84, 0x8C, 
-    0x86, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x85, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x86, 
-    0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x85, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x65, 0x88, 
-    0xE9, 0x8C, 0x06, 0x89, 0xC9, 0x94, 0xC8, 0x8C, 0x27, 0x8D, 0xC8, 0x8C, 0xC8, 0x8C, 0x27, 
-    0x8D, 0xC7, 0x98, 0xE9, 0x8C, 0x69, 0x91, 0x27, 0x8D, 0x08, 0x99, 0x69, 0x91, 0xA7, 0x90, 
-    0x27, 0x8D, 0xC9, 0x94, 0x06, 0x89, 0xE9, 0x8C, 0x27, 0x8D, 0xC9, 0x94, 0x27, 0x8D, 0xC8, 
-    0x8C, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x08, 0x99, 0x69, 0x91, 0xC8, 0x8C, 
-    0xC8, 0x8C, 0x06, 0x89, 0xA7, 0x90, 0x06, 0x89, 0xC8, 0x8C, 0x27, 0x8D, 0xC8, 0x8C, 0x27, 
-    0x8D, 0xA7, 0x90, 0x06, 0x89, 0x27, 0x8D, 0xC8, 0x8C, 0xC8, 0x8C, 0x27, 0x8D, 0xC8, 0x8C, 
-    0x27, 0x8D, 0xC8, 0x8C, 0x27, 0x8D, 0xC8, 0x8C, 0x27, 0x8D, 0xC8, 0x8C, 0x27, 0x8D, 0xC8, 
-    0x8C, 0x27, 0x8D, 0xC8, 0x8C, 0x27, 0x8D, 0xA7, 0x90, 0x06, 0x89, 0xC8, 0x8C, 0x27, 0x8D, 
-    0xC8, 0x8C, 0x27, 0x8D, 0xA7, 0x90, 0xC6, 0x94, 0x86, 0x8C, 0xA7, 0x88, 0x84, 0x8C, 0xA5, 
-    0x90, 0x84, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0xA5, 0x90, 0x84, 0x90, 0x86, 0x8C, 0x84, 0x90, 
-    0x84, 0x90, 0x86, 0x88, 0xA5, 0x90, 0xC8, 0x8C, 0x06, 0x89, 0x27, 0x8D, 0xC8, 0x8C, 0x27, 
-    0x8D, 0xC8, 0x8C, 0x27, 0x8D, 0x27, 0x8D, 0xC8, 0x8C, 0x27, 0x8D, 0x69, 0x91, 0xC8, 0x8C, 
-    0x69, 0x91, 0x27, 0x8D, 0x69, 0x91, 0xC8, 0x8C, 0x27, 0x8D, 0x27, 0x8D, 0x69, 0x91, 0xC8, 
-    0x8C, 0x27, 0x8D, 0xC8, 0x8C, 0x06, 0x89, 0xC8, 0x8C, 0x27, 0x8D, 0xA5, 0x90, 0xC8, 0x8C, 
-    0x06, 0x89, 0x06, 0x89, 0xA7, 0x90, 0x06, 0x89, 0xC8, 0x8C, 0xC8, 0x8C, 0x06, 0x89, 0xC8, 
-    0x8C, 0x27, 0x8D, 0xC8, 0x8C, 0xC8, 0x8C, 0x06, 0x89, 0xA7, 0x90, 0xA8, 0x88, 0xA7, 0x88, 
-    0x06, 0x89, 0xA7, 0x90, 0x06, 0x89, 0xA7, 0x88, 0xC8, 0x8C, 0x06, 0x89, 0xC8, 0x8C, 0x06, 
-    0x89, 0xC8, 0x8C, 0xC8, 0x8C, 0xC8, 0x8C, 0x06, 0x89, 0xA8, 0x88, 0x27, 0x8D, 0xA7, 0x90, 
-    0xC8, 0x8C, 0x06, 0x89, 0x06, 0x89, 0xC8, 0x8C, 0x27, 0x8D, 0xA7, 0x90, 0x06, 0x89, 0xC8, 
-    0x8C, 0x66, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 0x84, 0x8C, 0xA7, 0x88, 0x65, 0x88, 
-    0x63, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x63, 0x8C, 0xA4, 
-    0x80, 0xE5, 0x84, 0x06, 0x89, 0x27, 0x8D, 0x69, 0x91, 0x27, 0x8D, 0x69, 0x91, 0x69, 0x91, 
-    0x69, 0x91, 0x69, 0x91, 0xC8, 0x8C, 0x08, 0x99, 0x27, 0x8D, 0x69, 0x91, 0x27, 0x8D, 0xE9, 
-    0x8C, 0x27, 0x8D, 0x27, 0x8D, 0x69, 0x91, 0xC8, 0x8C, 0x27, 0x8D, 0x27, 0x8D, 0xC8, 0x8C, 
-    0x27, 0x8D, 0xC8, 0x8C, 0x27, 0x8D, 0xC8, 0x8C, 0x08, 0x99, 0x69, 0x91, 0xC8, 0x8C, 0x08, 
-    0x99, 0x27, 0x8D, 0x08, 0x99, 0x08, 0x99, 0x69, 0x91, 0xEA, 0x94, 0x27, 0x8D, 0x29, 0x9D, 
-    0xE9, 0x8C, 0x69, 0x91, 0x29, 0x9D, 0x69, 0x91, 0x29, 0x9D, 0x69, 0x91, 0x29, 0x9D, 0x69, 
-    0x91, 0x29, 0x9D, 0xC9, 0x94, 0x69, 0x91, 0xEA, 0x94, 0x69, 0x91, 0xEA, 0x94, 0x27, 0x8D, 
-    0x6B, 0xA1, 0x29, 0x9D, 0x69, 0x91, 0x69, 0x91, 0xE9, 0x8C, 0x27, 0x8D, 0xA5, 0x94, 0xA5, 
-    0x90, 0x43, 0x84, 0x23, 0x84, 0x24, 0x80, 0xA5, 0x94, 0x86, 0x88, 0x02, 0x80, 0x66, 0x8C, 
-    0x45, 0x88, 0x02, 0x80, 0x63, 0x8C, 0x24, 0x80, 0xA5, 0x94, 0x86, 0x88, 0x02, 0x80, 0x66, 
-    0x8C, 0x45, 0x88, 0x02, 0x80, 0x63, 0x8C, 0x45, 0x88, 0x65, 0x88, 0x64, 0x88, 0x84, 0x8C, 
-    0x84, 0x90, 0x84, 0x8C, 0xA5, 0x94, 0x64, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x85, 0x88, 0x64, 
-    0x88, 0x84, 0x8C, 0xA5, 0x94, 0x64, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x85, 0x88, 0x64, 0x88, 
-    0x63, 0x8C, 0x64, 0x88, 0x63, 0x8C, 0x84, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x84, 
-    0x8C, 0x85, 0x88, 0x64, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x84, 0x90, 0x64, 0x88, 0x64, 0x88, 
-    0x85, 0x88, 0x64, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x45, 0x88, 0x64, 0x88, 0xA5, 
-    0x90, 0x84, 0x90, 0x63, 0x8C, 0x84, 0x8C, 0xA5, 0x94, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 
-    0x63, 0x8C, 0x65, 0x88, 0x45, 0x88, 0x63, 0x8C, 0x65, 0x88, 0x63, 0x8C, 0x86, 0x88, 0x63, 
-    0x8C, 0x43, 0x84, 0x66, 0x8C, 0x86, 0x8C, 0x23, 0x84, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 
-    0x84, 0x8C, 0x64, 0x88, 0x63, 0x8C, 0x43, 0x84, 0x86, 0x8C, 0x63, 0x8C, 0x64, 0x88, 0x85, 
-    0x88, 0x84, 0x8C, 0x66, 0x8C, 0x84, 0x8C, 0x85, 0x88, 0x64, 0x88, 0x63, 0x8C, 0x65, 0x88, 
-    0x65, 0x88, 0x63, 0x8C, 0x65, 0x88, 0x85, 0x88, 0x63, 0x88, 0x85, 0x88, 0x84, 0x90, 0x64, 
-    0x88, 0x63, 0x8C, 0x63, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x64, 0x88, 0xA5, 0x90, 0x84, 0x90, 
-    0xA5, 0x90, 0x84, 0x90, 0x84, 0x8C, 0x85, 0x88, 0x63, 0x8C, 0x63, 0x8C, 0x85, 0x88, 0x84, 
-    0x8C, 0x84, 0x8C, 0xA5, 0x90, 0x63, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 0x66, 0x8C, 0x43, 0x84, 
-    0xA5, 0x90, 0x63, 0x8C, 0xA7, 0x88, 0x63, 0x8C, 0x84, 0x8C, 0xA7, 0x88, 0x63, 0x8C, 0x86, 
-    0x88, 0x63, 0x8C, 0x64, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 
-    0x65, 0x88, 0x64, 0x88, 0x43, 0x84, 0x65, 0x88, 0x43, 0x84, 0x86, 0x88, 0x63, 0x8C, 0x84, 
-    0x8C, 0x84, 0x8C, 0x86, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x84, 0x8C, 
-    0x64, 0x88, 0x64, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x65, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x64, 
-    0x88, 0x85, 0x88, 0x64, 0x88, 0x63, 0x8C, 0x84, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 
-    0x65, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x45, 0x88, 0x64, 0x88, 0x84, 
-    0x8C, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x84, 0x8C, 0x65, 0x88, 0x84, 0x8C, 0x45, 0x88, 
-    0x63, 0x8C, 0x84, 0x8C, 0x86, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x25, 0x80, 0x64, 0x88, 0x84, 
-    0x8C, 0x84, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x65, 0x88, 0x64, 0x88, 0x65, 0x88, 0x45, 0x88, 
-    0x45, 0x88, 0x25, 0x80, 0x23, 0x80, 0x05, 0x80, 0x08, 0x80, 0x46, 0x84, 0x69, 0x84, 0x29, 
-    0x80, 0x28, 0x80, 0x02, 0x80, 0x43, 0x84, 0x45, 0x88, 0x64, 0x88, 0x64, 0x88, 0x66, 0x8C, 
-    0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x44, 
-    0x84, 0x64, 0x84, 0x64, 0x84, 0x64, 0x84, 0x86, 0x88, 0x44, 0x80, 0x45, 0x88, 0x65, 0x88, 
-    0x25, 0x80, 0x64, 0x88, 0x63, 0x8C, 0x25, 0x80, 0x65, 0x88, 0x65, 0x88, 0x44, 0x84, 0x25, 
-    0x80, 0x65, 0x88, 0x25, 0x80, 0x64, 0x88, 0x64, 0x88, 0x44, 0x84, 0x64, 0x84, 0x44, 0x84, 
-    0x25, 0x80, 0x86, 0x88, 0x42, 0x80, 0x25, 0x80, 0x02, 0x80, 0x23, 0x84, 0x24, 0x80, 0x23, 
-    0x80, 0x23, 0x80, 0x25, 0x80, 0x05, 0x80, 0x45, 0x88, 0x86, 0x88, 0x85, 0x88, 0x02, 0x80, 
-    0x63, 0x8C, 0x45, 0x88, 0x02, 0x80, 0xA5, 0x94, 0x45, 0x88, 0x86, 0x88, 0x85, 0x88, 0x02, 
-    0x80, 0x63, 0x8C, 0x45, 0x88, 0x02, 0x80, 0xA5, 0x94, 0x25, 0x80, 0x65, 0x88, 0x85, 0x88, 
-    0x84, 0x8C, 0x84, 0x90, 0x84, 0x8C, 0x63, 0x8C, 0x84, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x63, 
-    0x8C, 0x85, 0x88, 0x84, 0x8C, 0x63, 0x8C, 0x84, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x63, 0x8C, 
-    0x85, 0x88, 0x64, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 
-    0x88, 0x84, 0x90, 0x43, 0x84, 0x45, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x63, 0x8C, 
-    0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x84, 0x90, 0x64, 
-    0x88, 0x64, 0x88, 0xA5, 0x90, 0x65, 0x88, 0x64, 0x88, 0x63, 0x8C, 0x85, 0x88, 0x85, 0x88, 
-    0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x65, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0x63, 
-    0x8C, 0x64, 0x88, 0x65, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x85, 0x88, 0x43, 0x84, 0x84, 0x8C, 
-    0x65, 0x88, 0x63, 0x8C, 0x65, 0x88, 0x86, 0x8C, 0x64, 0x88, 0x63, 0x8C, 0x65, 0x88, 0x85, 
-    0x88, 0x63, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x66, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x64, 0x88, 
-    0x66, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x84, 0x90, 0x64, 
-    0x88, 0x63, 0x8C, 0x85, 0x88, 0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 0x84, 0x90, 0x85, 0x88, 
-    0x85, 0x88, 0x84, 0x90, 0x84, 0x90, 0x85, 0x88, 0x63, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x85, 
-    0x88, 0x85, 0x88, 0x85, 0x88, 0x84, 0x90, 0x86, 0x8C, 0x85, 0x88, 0x84, 0x8C, 0x85, 0x88, 
-    0x84, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 0x84, 0x8C, 0xA7, 0x88, 0x63, 0x8C, 0x84, 0x8C, 0xA5, 
-    0x94, 0x45, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 
-    0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x66, 0x8C, 0x63, 0x8C, 0x64, 0x88, 0x64, 
-    0x88, 0x65, 0x88, 0x43, 0x84, 0x86, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x65, 0x88, 0x84, 0x8C, 
-    0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 0x85, 
-    0x88, 0x63, 0x8C, 0x45, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x63, 0x8C, 
-    0x64, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x64, 
-    0x88, 0x86, 0x88, 0x25, 0x80, 0x85, 0x88, 0x45, 0x88, 0x86, 0x88, 0x25, 0x80, 0x64, 0x88, 
-    0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 0x44, 0x84, 0x86, 0x88, 0x24, 0x80, 0x65, 0x88, 0x64, 
-    0x88, 0x86, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x44, 0x84, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 
-    0x44, 0x84, 0x65, 0x88, 0x23, 0x84, 0x05, 0x80, 0x0B, 0x80, 0x4A, 0x80, 0xA7, 0x90, 0x66, 
-    0x8C, 0x67, 0x8C, 0x67, 0x8C, 0x08, 0x80, 0x43, 0x84, 0x63, 0x8C, 0x65, 0x88, 0x85, 0x88, 
-    0x63, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x84, 0x8C, 0x85, 0x88, 0x63, 0x8C, 0x25, 0x80, 0x64, 
-    0x88, 0x64, 0x84, 0x64, 0x84, 0x64, 0x84, 0x64, 0x84, 0x25, 0x80, 0x65, 0x88, 0x23, 0x80, 
-    0x64, 0x88, 0x44, 0x84, 0x65, 0x88, 0x64, 0x88, 0x64, 0x88, 0x25, 0x80, 0x43, 0x84, 0x65, 
-    0x88, 0x25, 0x80, 0x43, 0x84, 0x65, 0x88, 0x25, 0x80, 0x44, 0x84, 0x25, 0x80, 0x65, 0x88, 
-    0x44, 0x84, 0x25, 0x80, 0x84, 0x8C, 0x25, 0x80, 0x24, 0x80, 0x25, 0x80, 0x24, 0x80, 0x25, 
-    0x80, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 0x24, 0x80, 0x45, 0x88, 0x84, 0x8C, 0x86, 0x88, 
-    0x24, 0x80, 0x63, 0x8C, 0x45, 0x88, 0x02, 0x80, 0x63, 0x8C, 0x45, 0x88, 0x84, 0x8C, 0x86, 
-    0x88, 0x24, 0x80, 0x63, 0x8C, 0x45, 0x88, 0x02, 0x80, 0x63, 0x8C, 0x45, 0x88, 0x64, 0x88, 
-    0x84, 0x90, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x90, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x63, 
-    0x8C, 0x45, 0x88, 0x63, 0x8C, 0x84, 0x90, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x63, 0x8C, 
-    0x45, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x23, 
-    0x84, 0x25, 0x80, 0x23, 0x80, 0x23, 0x84, 0x65, 0x88, 0x64, 0x88, 0x84, 0x8C, 0x64, 0x88, 
-    0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x84, 0x90, 0x85, 0x88, 0x63, 0x88, 0x64, 
-    0x88, 0x63, 0x8C, 0x85, 0x88, 0x84, 0x8C, 0xA7, 0x88, 0x84, 0x90, 0x85, 0x88, 0x85, 0x88, 
-    0x63, 0x8C, 0x85, 0x88, 0x63, 0x8C, 0x85, 0x88, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x8C, 0x85, 
-    0x88, 0x66, 0x8C, 0x85, 0x88, 0x84, 0x90, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 
-    0x86, 0x8C, 0x65, 0x88, 0x45, 0x88, 0x84, 0x8C, 0x85, 0x88, 0x63, 0x8C, 0x65, 0x88, 0x65, 
-    0x88, 0x86, 0x8C, 0x65, 0x88, 0x85, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x86, 0x8C, 
-    0x85, 0x88, 0x84, 0x90, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x85, 
-    0x88, 0x66, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x85, 0x88, 
-    0x85, 0x88, 0x63, 0x88, 0x85, 0x88, 0x43, 0x84, 0x63, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x63, 
-    0x8C, 0x85, 0x88, 0x84, 0x90, 0x85, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x84, 0x8C, 0x86, 0x8C, 
-    0x84, 0x90, 0x86, 0x8C, 0x64, 0x88, 0x86, 0x8C, 0x84, 0x90, 0x85, 0x88, 0x64, 0x88, 0x86, 
-    0x8C, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0x65, 0x88, 0x85, 0x88, 0x85, 0x88, 0x63, 0x8C, 
-    0x64, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x63, 0x88, 0x64, 0x88, 0x64, 
-    0x88, 0x64, 0x88, 0x85, 0x88, 0x45, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x85, 0x88, 
-    0x85, 0x88, 0x64, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x65, 0x88, 0x85, 0x88, 0x64, 
-    0x88, 0x63, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 0x43, 0x84, 0x86, 0x8C, 0x43, 0x84, 
-    0x65, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x85, 0x88, 0x45, 0x88, 0x86, 0x88, 0x25, 
-    0x80, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x86, 0x88, 0x25, 0x80, 0x64, 0x88, 0x65, 0x88, 
-    0x64, 0x88, 0x85, 0x88, 0x25, 0x80, 0x85, 0x88, 0x85, 0x88, 0x45, 0x88, 0x64, 0x88, 0x44, 
-    0x84, 0x65, 0x88, 0x44, 0x84, 0x85, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 
-    0x46, 0x84, 0x85, 0x88, 0x22, 0x84, 0x08, 0x80, 0x0B, 0x80, 0xA7, 0x90, 0x2A, 0xA9, 0x6B, 
-    0xAD, 0x6B, 0xAD, 0x2A, 0xA9, 0x4B, 0xAD, 0xAA, 0x94, 0x0B, 0x80, 0x43, 0x84, 0x65, 0x88, 
-    0x63, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x44, 0x84, 0x64, 0x88, 0x85, 0x88, 0x64, 
-    0x88, 0x85, 0x88, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 0x85, 0x88, 0x65, 0x88, 0x64, 0x88, 
-    0x44, 0x84, 0x25, 0x80, 0x64, 0x84, 0x65, 0x88, 0x64, 0x88, 0x23, 0x80, 0x64, 0x88, 0x65, 
-    0x88, 0x44, 0x84, 0x64, 0x84, 0x25, 0x80, 0x65, 0x88, 0x23, 0x84, 0x65, 0x88, 0x44, 0x84, 
-    0x25, 0x80, 0x64, 0x84, 0x44, 0x84, 0x65, 0x88, 0x44, 0x84, 0x24, 0x80, 0x23, 0x80, 0x23, 
-    0x80, 0x02, 0x80, 0x23, 0x80, 0x05, 0x80, 0x24, 0x80, 0x45, 0x88, 0x43, 0x84, 0x45, 0x88, 
-    0x25, 0x80, 0x05, 0x80, 0x25, 0x80, 0x24, 0x80, 0x25, 0x80, 0x66, 0x8C, 0x43, 0x84, 0x45, 
-    0x88, 0x25, 0x80, 0x05, 0x80, 0x25, 0x80, 0x24, 0x80, 0x25, 0x80, 0x66, 0x8C, 0x43, 0x84, 
-    0x86, 0x8C, 0x64, 0x88, 0x84, 0x90, 0x84, 0x8C, 0x86, 0x8C, 0x84, 0x90, 0x64, 0x88, 0x64, 
-    0x88, 0x85, 0x88, 0x43, 0x84, 0x65, 0x88, 0x86, 0x8C, 0x84, 0x90, 0x64, 0x88, 0x64, 0x88, 
-    0x85, 0x88, 0x43, 0x84, 0x65, 0x88, 0x43, 0x84, 0x65, 0x88, 0x66, 0x8C, 0x43, 0x84, 0x25, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x65, 0x88, 0x43, 0x84, 
-    0x86, 0x8C, 0x42, 0x88, 0x85, 0x88, 0x84, 0x90, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x85, 
-    0x88, 0x85, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x63, 0x8C, 
-    0x85, 0x88, 0x66, 0x8C, 0x84, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x84, 0x90, 0x63, 0x8C, 0x84, 
-    0x8C, 0x85, 0x88, 0x84, 0x90, 0x63, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x63, 0x8C, 
-    0x45, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x85, 0x88, 0x65, 
-    0x88, 0x45, 0x88, 0x63, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x85, 0x88, 0x85, 0x88, 
-    0x63, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x85, 0x88, 0x63, 0x8C, 0x85, 
-    0x88, 0x43, 0x84, 0x63, 0x8C, 0x84, 0x8C, 0x86, 0x88, 0x63, 0x8C, 0x85, 0x88, 0x85, 0x88, 
-    0x63, 0x88, 0x85, 0x88, 0x85, 0x88, 0x43, 0x84, 0x84, 0x90, 0x86, 0x88, 0x85, 0x88, 0x45, 
-    0x88, 0x85, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x84, 0x90, 
-    0x84, 0x8C, 0x84, 0x8C, 0x85, 0x88, 0x84, 0x8C, 0x84, 0x90, 0x65, 0x88, 0x64, 0x88, 0x85, 
-    0x88, 0x84, 0x8C, 0x85, 0x88, 0x63, 0x8C, 0x45, 0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 
-    0x45, 0x88, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 0x85, 0x88, 0x63, 0x88, 0x66, 0x8C, 0x64, 
-    0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x45, 0x88, 0x64, 0x88, 0x64, 0x88, 
-    0x64, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x43, 0x84, 0x45, 0x88, 0x64, 0x88, 0x85, 0x88, 0x84, 
-    0x90, 0x43, 0x84, 0x45, 0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x84, 0x90, 0x43, 0x84, 
-    0x86, 0x8C, 0x23, 0x84, 0x45, 0x88, 0x86, 0x88, 0x25, 0x80, 0x64, 0x88, 0x46, 0x84, 0x64, 
-    0x88, 0x64, 0x88, 0x86, 0x88, 0x25, 0x80, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 
-    0x64, 0x88, 0x86, 0x88, 0x44, 0x84, 0x65, 0x88, 0x64, 0x88, 0x64, 0x88, 0x25, 0x80, 0x64, 
-    0x88, 0x86, 0x88, 0x25, 0x80, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 0x45, 0x88, 
-    0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x67, 0x8C, 0x6A, 0x88, 0x2A, 0xA9, 0xAD, 0xB5, 0xAD, 
-    0xB5, 0xAD, 0xB5, 0xAD, 0xB5, 0x2A, 0xAD, 0x4B, 0xAD, 0x6B, 0xB5, 0x2C, 0x9D, 0x89, 0x90, 
-    0x02, 0x80, 0x25, 0x80, 0x45, 0x88, 0x64, 0x88, 0x25, 0x80, 0x64, 0x88, 0x85, 0x88, 0x85, 
-    0x88, 0x85, 0x88, 0x64, 0x88, 0x86, 0x88, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 
-    0x85, 0x88, 0x65, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x64, 0x88, 0x44, 
-    0x84, 0x25, 0x80, 0x65, 0x88, 0x44, 0x84, 0x65, 0x88, 0x25, 0x80, 0x44, 0x84, 0x25, 0x80, 
-    0x64, 0x84, 0x23, 0x80, 0x65, 0x88, 0x44, 0x84, 0x64, 0x84, 0x64, 0x84, 0x24, 0x80, 0x23, 
-    0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x23, 0x80, 0x05, 0x80, 0x43, 0x84, 0x45, 0x88, 
-    0x25, 0x80, 0x66, 0x8C, 0x66, 0x8C, 0x23, 0x84, 0x02, 0x80, 0x23, 0x80, 0x45, 0x88, 0x45, 
-    0x88, 0x25, 0x80, 0x66, 0x8C, 0x66, 0x8C, 0x23, 0x84, 0x02, 0x80, 0x23, 0x80, 0x45, 0x88, 
-    0x45, 0x88, 0x23, 0x84, 0x44, 0x84, 0x64, 0x84, 0x64, 0x84, 0x44, 0x84, 0x42, 0x80, 0x25, 
-    0x80, 0x43, 0x84, 0x23, 0x84, 0x25, 0x80, 0x43, 0x84, 0x44, 0x84, 0x42, 0x80, 0x25, 0x80, 
-    0x43, 0x84, 0x23, 0x84, 0x25, 0x80, 0x43, 0x84, 0x25, 0x80, 0x43, 0x84, 0x23, 0x84, 0x23, 
-    0x84, 0x24, 0x80, 0x01, 0x80, 0x23, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x23, 0x84, 
-    0x45, 0x88, 0x25, 0x80, 0x25, 0x80, 0x44, 0x84, 0x25, 0x80, 0x44, 0x84, 0x25, 0x80, 0x64, 
-    0x88, 0x44, 0x80, 0x44, 0x84, 0x45, 0x88, 0x23, 0x80, 0x64, 0x88, 0x44, 0x84, 0x45, 0x88, 
-    0x86, 0x88, 0x43, 0x84, 0x45, 0x88, 0x25, 0x80, 0x64, 0x88, 0x25, 0x80, 0x64, 0x88, 0x44, 
-    0x80, 0x45, 0x88, 0x25, 0x80, 0x64, 0x88, 0x25, 0x80, 0x45, 0x88, 0x23, 0x84, 0x64, 0x88, 
-    0x25, 0x80, 0x64, 0x88, 0x44, 0x80, 0x45, 0x88, 0x25, 0x80, 0x25, 0x80, 0x64, 0x88, 0x25, 
-    0x80, 0x45, 0x88, 0x64, 0x88, 0x25, 0x80, 0x64, 0x88, 0x25, 0x80, 0x64, 0x88, 0x45, 0x88, 
-    0x25, 0x80, 0x64, 0x88, 0x25, 0x80, 0x45, 0x88, 0x44, 0x80, 0x45, 0x88, 0x25, 0x80, 0x25, 
-    0x80, 0x64, 0x88, 0x25, 0x80, 0x65, 0x88, 0x25, 0x80, 0x64, 0x88, 0x46, 0x84, 0x23, 0x84, 
-    0x45, 0x88, 0x25, 0x80, 0x45, 0x88, 0x25, 0x80, 0x65, 0x88, 0x45, 0x88, 0x25, 0x80, 0x64, 
-    0x88, 0x45, 0x88, 0x25, 0x80, 0x64, 0x88, 0x45, 0x88, 0x45, 0x88, 0x64, 0x88, 0x45, 0x88, 
-    0x64, 0x88, 0x86, 0x88, 0x25, 0x80, 0x64, 0x88, 0x85, 0x88, 0x86, 0x88, 0x25, 0x80, 0x64, 
-    0x88, 0x85, 0x88, 0x64, 0x88, 0x45, 0x88, 0x25, 0x80, 0x44, 0x84, 0x25, 0x80, 0x64, 0x84, 
-    0x25, 0x80, 0x65, 0x88, 0x23, 0x80, 0x25, 0x80, 0x64, 0x88, 0x44, 0x80, 0x25, 0x80, 0x43, 
-    0x84, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x65, 0x88, 0x25, 0x80, 0x44, 0x84, 
-    0x25, 0x80, 0x44, 0x84, 0x25, 0x80, 0x25, 0x80, 0x65, 0x88, 0x64, 0x84, 0x46, 0x84, 0x64, 
-    0x84, 0x25, 0x80, 0x65, 0x88, 0x44, 0x84, 0x46, 0x84, 0x64, 0x84, 0x25, 0x80, 0x64, 0x84, 
-    0x25, 0x80, 0x64, 0x88, 0x44, 0x84, 0x46, 0x84, 0x64, 0x84, 0x25, 0x80, 0x64, 0x84, 0x64, 
-    0x84, 0x65, 0x88, 0x44, 0x84, 0x64, 0x84, 0x64, 0x84, 0x86, 0x88, 0x25, 0x80, 0x64, 0x84, 
-    0x64, 0x84, 0x86, 0x88, 0x44, 0x84, 0x86, 0x88, 0x44, 0x84, 0x25, 0x80, 0x65, 0x88, 0x44, 
-    0x84, 0x86, 0x88, 0x44, 0x84, 0x44, 0x84, 0x86, 0x88, 0x65, 0x88, 0x43, 0x84, 0x84, 0x8C, 
-    0x65, 0x88, 0x85, 0x88, 0x64, 0x88, 0x86, 0x88, 0x08, 0x80, 0x0B, 0x80, 0x8C, 0x88, 0x8C, 
-    0x88, 0x8C, 0x88, 0xCC, 0x98, 0x09, 0xA5, 0xA7, 0x90, 0x6A, 0x88, 0x67, 0x8C, 0xCB, 0x88, 
-    0x4A, 0x80, 0x05, 0x80, 0x65, 0x88, 0x25, 0x80, 0x64, 0x88, 0x44, 0x84, 0x65, 0x88, 0x64, 
-    0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x65, 0x88, 0x63, 0x8C, 0x65, 0x88, 
-    0x64, 0x84, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0xA7, 0x88, 0x84, 0x90, 0x64, 0x88, 0x64, 
-    0x88, 0x65, 0x88, 0x44, 0x84, 0x64, 0x84, 0x64, 0x84, 0x25, 0x80, 0x65, 0x88, 0x23, 0x80, 
-    0x64, 0x88, 0x25, 0x80, 0x64, 0x88, 0x25, 0x80, 0x44, 0x84, 0x44, 0x84, 0x44, 0x84, 0x02, 
-    0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x23, 0x80, 0x45, 0x88, 
-    0x05, 0x80, 0xA5, 0x94, 0xE8, 0xA0, 0xA7, 0x90, 0xA5, 0x94, 0x23, 0x84, 0x24, 0x80, 0x23, 
-    0x80, 0x05, 0x80, 0xA5, 0x94, 0xE8, 0xA0, 0xA7, 0x90, 0xA5, 0x94, 0x23, 0x84, 0x24, 0x80, 
-    0x23, 0x80, 0x23, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x25, 0x80, 0x02, 0x80, 0x02, 0x80, 0x23, 0x80, 0x45, 0x88, 0x05, 0x80, 0x25, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x25, 0x80, 0x05, 0x80, 0x05, 0x80, 
-    0x05, 0x80, 0x05, 0x80, 0x25, 0x80, 0x05, 0x80, 0x05, 0x80, 0x25, 0x80, 0x05, 0x80, 0x05, 
-    0x80, 0x24, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 
-    0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 
-    0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 
-    0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x05, 0x80, 0x25, 0x80, 0x24, 0x80, 0x05, 0x80, 0x05, 
-    0x80, 0x25, 0x80, 0x05, 0x80, 0x25, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x05, 0x80, 
-    0x24, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 
-    0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x05, 0x80, 
-    0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 
-    0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 
-    0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x65, 0x88, 0x43, 0x84, 0x65, 0x88, 0x44, 0x84, 0x46, 
-    0x84, 0x65, 0x88, 0x25, 0x80, 0x43, 0x84, 0x65, 0x88, 0x43, 0x84, 0x86, 0x88, 0x25, 0x80, 
-    0x65, 0x88, 0x63, 0x8C, 0x86, 0x88, 0x43, 0x84, 0x45, 0x88, 0x0B, 0x80, 0x0B, 0x80, 0x0B, 
-    0x80, 0x0B, 0x80, 0x48, 0x84, 0xC9, 0x94, 0x8C, 0x88, 0xC8, 0x90, 0x25, 0x80, 0x8C, 0x88, 
-    0x8C, 0x88, 0x4A, 0x80, 0x08, 0x80, 0x65, 0x88, 0x43, 0x84, 0x65, 0x88, 0x25, 0x80, 0x65, 
-    0x88, 0x44, 0x84, 0x65, 0x88, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0x84, 0x8C, 0x65, 0x88, 
-    0x65, 0x88, 0x44, 0x84, 0x86, 0x88, 0x64, 0x88, 0x84, 0x90, 0x84, 0x8C, 0x85, 0x88, 0x64, 
-    0x88, 0x85, 0x88, 0x64, 0x88, 0x85, 0x88, 0x65, 0x88, 0x65, 0x88, 0x64, 0x88, 0x64, 0x88, 
-    0x64, 0x88, 0x25, 0x80, 0x64, 0x88, 0x23, 0x80, 0x64, 0x88, 0x64, 0x84, 0x64, 0x84, 0x23, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x45, 0x88, 
-    0x23, 0x80, 0x23, 0x80, 0x42, 0x88, 0x67, 0x8C, 0x84, 0x90, 0x65, 0x88, 0x25, 0x80, 0x02, 
-    0x80, 0x43, 0x84, 0x23, 0x80, 0x42, 0x88, 0x67, 0x8C, 0x84, 0x90, 0x65, 0x88, 0x25, 0x80, 
-    0x02, 0x80, 0x43, 0x84, 0x23, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x26, 0x80, 
-    0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x44, 0x84, 0x25, 
-    0x80, 0x64, 0x88, 0x64, 0x88, 0x64, 0x84, 0x86, 0x88, 0x25, 0x80, 0x65, 0x88, 0x65, 0x88, 
-    0x65, 0x88, 0x86, 0x88, 0x63, 0x8C, 0x84, 0x8C, 0x86, 0x88, 0x23, 0x80, 0x0B, 0x80, 0x0B, 
-    0x80, 0x4A, 0x80, 0x0B, 0x80, 0xC8, 0x90, 0xAE, 0x90, 0xAD, 0x8C, 0x2C, 0x9D, 0xE8, 0xA0, 
-    0xCC, 0x98, 0xCC, 0x98, 0x4A, 0x80, 0x08, 0x80, 0x25, 0x80, 0x65, 0x88, 0x43, 0x84, 0x65, 
-    0x88, 0x43, 0x84, 0x86, 0x88, 0x23, 0x84, 0x65, 0x88, 0x43, 0x84, 0x65, 0x88, 0x85, 0x88, 
-    0x64, 0x88, 0x86, 0x88, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0x63, 0x8C, 0x65, 0x88, 0x85, 
-    0x88, 0x64, 0x88, 0x84, 0x8C, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 
-    0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x44, 0x84, 0x25, 0x80, 0x44, 0x84, 0x44, 0x84, 0x65, 
-    0x88, 0x23, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x05, 0x80, 0x24, 0x80, 
-    0x45, 0x88, 0x45, 0x88, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 
-    0x80, 0x23, 0x84, 0x86, 0x88, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x05, 0x80, 0x05, 0x80, 
-    0x24, 0x80, 0x23, 0x84, 0x86, 0x88, 0x25, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x25, 0x80, 
-    0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x05, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x23, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 
-    0x05, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x05, 0x80, 0x43, 0x84, 0x45, 0x88, 0x25, 0x80, 0x64, 0x88, 0x85, 0x88, 0x65, 0x88, 
-    0x65, 0x88, 0x43, 0x84, 0x65, 0x88, 0x65, 0x88, 0x45, 0x88, 0x65, 0x88, 0x64, 0x88, 0x66, 
-    0x8C, 0x4A, 0x80, 0xAD, 0x8C, 0xA7, 0x90, 0xA6, 0x94, 0x89, 0x90, 0xAD, 0x8C, 0x0E, 0xA1, 
-    0x2C, 0x9D, 0x6A, 0x88, 0x8C, 0x88, 0x0B, 0x80, 0x08, 0x80, 0x65, 0x88, 0x43, 0x84, 0xC9, 
-    0x94, 0x43, 0x84, 0xEA, 0x94, 0x64, 0x88, 0xC6, 0x94, 0xA7, 0x90, 0x85, 0x88, 0x64, 0x88, 
-    0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0xC6, 0x94, 0x85, 0x88, 0xC6, 0x94, 0x84, 0x8C, 0xC6, 
-    0x94, 0xA7, 0x90, 0x84, 0x8C, 0x08, 0x99, 0xC8, 0x90, 0xA7, 0x90, 0x84, 0x8C, 0x08, 0x99, 
-    0x85, 0x88, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0x86, 
-    0x88, 0x65, 0x88, 0x64, 0x88, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x23, 0x80, 0x45, 0x88, 0x45, 0x88, 0x23, 0x80, 0x45, 0x88, 0x24, 0x80, 0x24, 0x80, 0x08, 
-    0x80, 0x05, 0x80, 0x65, 0x88, 0x45, 0x88, 0x23, 0x80, 0x45, 0x88, 0x24, 0x80, 0x24, 0x80, 
-    0x08, 0x80, 0x05, 0x80, 0x65, 0x88, 0x45, 0x88, 0x43, 0x84, 0x02, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x05, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x05, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x25, 0x80, 0x65, 0x88, 0x43, 0x84, 
-    0x86, 0x88, 0x64, 0x88, 0x85, 0x88, 0x25, 0x80, 0x43, 0x84, 0x65, 0x88, 0x65, 0x88, 0x45, 
-    0x88, 0x08, 0x80, 0x4A, 0x80, 0xAB, 0x94, 0xA7, 0x90, 0xE8, 0xA0, 0x29, 0xA5, 0xE7, 0x9C, 
-    0xAA, 0x94, 0xC8, 0x90, 0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80, 0x05, 0x80, 0x65, 0x88, 0x86, 
-    0x88, 0xA7, 0x90, 0x65, 0x88, 0x08, 0x99, 0xA5, 0x90, 0xC6, 0x94, 0x86, 0x8C, 0x85, 0x88, 
-    0x64, 0x88, 0x25, 0x80, 0x64, 0x88, 0x64, 0x88, 0xC6, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xA7, 
-    0x90, 0xC8, 0x90, 0xC6, 0x94, 0x86, 0x8C, 0x08, 0x99, 0xC8, 0x8C, 0xA7, 0x90, 0x43, 0x84, 
-    0x08, 0x99, 0x65, 0x88, 0xC8, 0x90, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x85, 
-    0x88, 0x64, 0x88, 0x44, 0x84, 0x44, 0x84, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x05, 0x80, 
-    0x24, 0x80, 0x23, 0x84, 0x45, 0x88, 0x45, 0x88, 0x25, 0x80, 0x84, 0x8C, 0x66, 0x8C, 0x86, 
-    0x8C, 0x23, 0x80, 0x23, 0x80, 0x23, 0x84, 0x25, 0x80, 0x25, 0x80, 0x84, 0x8C, 0x66, 0x8C, 
-    0x86, 0x8C, 0x23, 0x80, 0x23, 0x80, 0x23, 0x84, 0x25, 0x80, 0x45, 0x88, 0x24, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x23, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x23, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x05, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x25, 0x80, 0x23, 0x84, 0x64, 0x88, 0x25, 0x80, 0x45, 0x88, 0x64, 0x88, 0x64, 0x84, 0x45, 
-    0x88, 0x65, 0x88, 0x02, 0x80, 0x4A, 0x80, 0xED, 0x9C, 0xCC, 0x98, 0xE8, 0xA0, 0x29, 0xA5, 
-    0xE8, 0xA0, 0x6A, 0x88, 0x48, 0x84, 0x0B, 0x80, 0x4A, 0x80, 0x08, 0x80, 0x02, 0x80, 0x45, 
-    0x88, 0x25, 0x80, 0xC8, 0x90, 0x86, 0x8C, 0x08, 0x99, 0x65, 0x88, 0x86, 0x8C, 0xA7, 0x90, 
-    0x86, 0x8C, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0xC8, 0x90, 0x64, 0x88, 0xC6, 
-    0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0x86, 0x8C, 0x08, 0x99, 0xA7, 0x90, 0x86, 0x8C, 
-    0x85, 0x88, 0x08, 0x99, 0x85, 0x88, 0xC6, 0x94, 0x65, 0x88, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 
-    0x94, 0x85, 0x88, 0x85, 0x88, 0x65, 0x88, 0x64, 0x88, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x05, 0x80, 0x24, 0x80, 0x45, 0x88, 0x45, 0x88, 0x23, 0x80, 0x45, 0x88, 0x45, 0x88, 0x65, 
-    0x88, 0x65, 0x88, 0x45, 0x88, 0x23, 0x80, 0x23, 0x84, 0x25, 0x80, 0x45, 0x88, 0x45, 0x88, 
-    0x65, 0x88, 0x65, 0x88, 0x45, 0x88, 0x23, 0x80, 0x23, 0x84, 0x25, 0x80, 0x64, 0x88, 0x02, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x45, 0x88, 0x23, 0x80, 0x45, 0x88, 0x23, 0x80, 0x23, 0x84, 0x24, 0x80, 0x02, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x23, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x24, 0x80, 0x05, 0x80, 0x23, 0x80, 
-    0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x23, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x23, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x23, 0x80, 0x05, 0x80, 0x02, 0x80, 0x23, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x23, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x23, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x23, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x23, 0x80, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 0x23, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x23, 
-    0x80, 0x05, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x45, 0x88, 0x65, 0x88, 0x25, 0x80, 0x64, 
-    0x88, 0x64, 0x84, 0x65, 0x88, 0x45, 0x88, 0x48, 0x84, 0x0E, 0xA1, 0xAE, 0x90, 0xCC, 0x98, 
-    0x69, 0x84, 0x69, 0x84, 0x29, 0x80, 0x0B, 0x80, 0x4A, 0x80, 0x08, 0x80, 0x05, 0x80, 0x67, 
-    0x8C, 0x65, 0x88, 0x43, 0x84, 0x65, 0x88, 0x85, 0x88, 0xA7, 0x88, 0x65, 0x88, 0x85, 0x88, 
-    0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0x86, 0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x64, 
-    0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 
-    0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x43, 0x84, 0x86, 0x88, 0x64, 0x88, 0x85, 0x88, 0x85, 
-    0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x05, 0x80, 0x45, 0x88, 0x45, 0x88, 0x45, 0x88, 0x23, 0x80, 0x45, 0x88, 0x65, 
-    0x88, 0x25, 0x80, 0x45, 0x88, 0x25, 0x80, 0x25, 0x80, 0x23, 0x84, 0x25, 0x80, 0x45, 0x88, 
-    0x65, 0x88, 0x25, 0x80, 0x45, 0x88, 0x25, 0x80, 0x25, 0x80, 0x23, 0x84, 0x25, 0x80, 0x45, 
-    0x88, 0x01, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x42, 0x84, 
-    0x24, 0x80, 0x02, 0x80, 0x23, 0x80, 0x24, 0x80, 0x02, 0x80, 0x05, 0x80, 0x42, 0x84, 0x24, 
-    0x80, 0x02, 0x80, 0x23, 0x80, 0x24, 0x80, 0x23, 0x80, 0x02, 0x80, 0x23, 0x80, 0x23, 0x80, 
-    0x02, 0x80, 0x43, 0x84, 0x45, 0x88, 0x25, 0x80, 0x43, 0x84, 0x45, 0x88, 0x25, 0x80, 0x02, 
-    0x80, 0x23, 0x80, 0x24, 0x80, 0x23, 0x80, 0x24, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 
-    0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x24, 0x80, 0x23, 0x80, 0x24, 
-    0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 
-    0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x05, 
-    0x80, 0x25, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 
-    0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x23, 0x80, 0x23, 
-    0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x25, 0x80, 0x02, 0x80, 0x23, 0x80, 
-    0x25, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 
-    0x80, 0x23, 0x80, 0x05, 0x80, 0x25, 0x80, 0x02, 0x80, 0x25, 0x80, 0x24, 0x80, 0x23, 0x80, 
-    0x25, 0x80, 0x05, 0x80, 0x25, 0x80, 0x02, 0x80, 0x25, 0x80, 0x23, 0x80, 0x23, 0x80, 0x25, 
-    0x80, 0x24, 0x80, 0x25, 0x80, 0x25, 0x80, 0x23, 0x80, 0x25, 0x80, 0x25, 0x80, 0x23, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x23, 0x80, 0x23, 0x80, 0x25, 0x80, 0x05, 0x80, 0x25, 0x80, 0x25, 
-    0x80, 0x02, 0x80, 0x25, 0x80, 0x23, 0x80, 0x26, 0x80, 0x25, 0x80, 0x23, 0x80, 0x25, 0x80, 
-    0x23, 0x80, 0x25, 0x80, 0x23, 0x80, 0x25, 0x80, 0x02, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 
-    0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x26, 0x80, 0x05, 0x80, 0x24, 0x80, 
-    0x25, 0x80, 0x23, 0x80, 0x25, 0x80, 0x23, 0x80, 0x25, 0x80, 0x24, 0x80, 0x23, 0x80, 0x25, 
-    0x80, 0x23, 0x80, 0x25, 0x80, 0x23, 0x80, 0x26, 0x80, 0x05, 0x80, 0x23, 0x84, 0x25, 0x80, 
-    0x25, 0x80, 0x24, 0x80, 0x25, 0x80, 0x25, 0x80, 0x23, 0x80, 0x25, 0x80, 0x23, 0x80, 0x25, 
-    0x80, 0x05, 0x80, 0x23, 0x84, 0x25, 0x80, 0x25, 0x80, 0x05, 0x80, 0x05, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x45, 
-    0x88, 0x45, 0x88, 0x25, 0x80, 0x64, 0x88, 0x44, 0x84, 0x25, 0x80, 0x25, 0x80, 0x0B, 0x99, 
-    0x89, 0x90, 0x69, 0x84, 0x4A, 0x80, 0x0B, 0x80, 0x4A, 0x80, 0x08, 0x80, 0x02, 0x80, 0x45, 
-    0x88, 0x65, 0x88, 0x43, 0x84, 0x66, 0x8C, 0x44, 0x84, 0x86, 0x88, 0x64, 0x88, 0x64, 0x88, 
-    0x85, 0x88, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 0x65, 0x88, 0x65, 0x88, 0x65, 0x88, 0x65, 
-    0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x24, 0x80, 0x65, 0x88, 0x65, 0x88, 0x84, 0x8C, 
-    0x64, 0x88, 0x65, 0x88, 0x84, 0x8C, 0x25, 0x80, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x44, 
-    0x84, 0x65, 0x88, 0x44, 0x84, 0x65, 0x88, 0x64, 0x88, 0x44, 0x84, 0x44, 0x84, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x45, 0x88, 0x45, 0x88, 0x45, 0x88, 0x23, 0x84, 0x65, 
-    0x88, 0x25, 0x80, 0x43, 0x84, 0x65, 0x88, 0x43, 0x84, 0x25, 0x80, 0x23, 0x80, 0x25, 0x80, 
-    0x65, 0x88, 0x25, 0x80, 0x43, 0x84, 0x65, 0x88, 0x43, 0x84, 0x25, 0x80, 0x23, 0x80, 0x25, 
-    0x80, 0x24, 0x80, 0x21, 0x80, 0x21, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x05, 0x80, 0x24, 0x80, 0x23, 0x80, 0x25, 0x80, 0x23, 0x80, 0x02, 0x80, 0x24, 0x80, 0x05, 
-    0x80, 0x24, 0x80, 0x23, 0x80, 0x25, 0x80, 0x23, 0x80, 0x25, 0x80, 0x05, 0x80, 0x24, 0x80, 
-    0x25, 0x80, 0x23, 0x80, 0x45, 0x88, 0x23, 0x80, 0x45, 0x88, 0x23, 0x80, 0x45, 0x88, 0x23, 
-    0x80, 0x25, 0x80, 0x25, 0x80, 0x05, 0x80, 0x24, 0x80, 0x25, 0x80, 0x23, 0x80, 0x25, 0x80, 
-    0x24, 0x80, 0x25, 0x80, 0x23, 0x80, 0x25, 0x80, 0x05, 0x80, 0x23, 0x80, 0x25, 0x80, 0x05, 
-    0x80, 0x23, 0x80, 0x25, 0x80, 0x24, 0x80, 0x25, 0x80, 0x05, 0x80, 0x23, 0x80, 0x25, 0x80, 
-    0x25, 0x80, 0x25, 0x80, 0x05, 0x80, 0x26, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 
-    0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x05, 0x80, 0x05, 
-    0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 
-    0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 
-    0x80, 0x24, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 
-    0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 
-    0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 
-    0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x05, 
-    0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 
-    0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 
-    0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 
-    0x01, 0x80, 0x02, 0x80, 0x23, 0x80, 0x25, 0x80, 0x26, 0x80, 0x05, 0x80, 0x26, 0x80, 0x25, 
-    0x80, 0x05, 0x80, 0x26, 0x80, 0x05, 0x80, 0x26, 0x80, 0x25, 0x80, 0x25, 0x80, 0x05, 0x80, 
-    0x26, 0x80, 0x25, 0x80, 0x25, 0x80, 0x05, 0x80, 0x26, 0x80, 0x26, 0x80, 0x25, 0x80, 0x05, 
-    0x80, 0x25, 0x80, 0x25, 0x80, 0x05, 0x80, 0x25, 0x80, 0x25, 0x80, 0x05, 0x80, 0x24, 0x80, 
-    0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x05, 
-    0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 0x80, 0x25, 0x80, 0x43, 0x84, 0x45, 0x88, 0x25, 0x80, 
-    0x42, 0x80, 0x25, 0x80, 0x28, 0x80, 0x08, 0x80, 0x08, 0x80, 0x05, 0x80, 0x01, 0x80, 0x23, 
-    0x84, 0x44, 0x84, 0x26, 0x80, 0x46, 0x84, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x46, 0x84, 
-    0x44, 0x84, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x46, 0x84, 0x25, 0x80, 0x46, 0x84, 0x25, 
-    0x80, 0x46, 0x84, 0x25, 0x80, 0x46, 0x84, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x46, 0x84, 
-    0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x46, 0x84, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 
-    0x80, 0x25, 0x80, 0x46, 0x84, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 
-    0x24, 0x80, 0x05, 0x80, 0x02, 0x80, 0x24, 0x80, 0x25, 0x80, 0x23, 0x80, 0x05, 0x80, 0x25, 
-    0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x27, 0x80, 0x23, 0x80, 0x05, 0x80, 
-    0x24, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x27, 0x80, 0x23, 0x80, 0x05, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x05, 0x80, 
-    0x24, 0x80, 0x23, 0x80, 0x25, 0x80, 0x23, 0x80, 0x02, 0x80, 0x24, 0x80, 0x05, 0x80, 0x24, 
-    0x80, 0x23, 0x80, 0x25, 0x80, 0x23, 0x80, 0x25, 0x80, 0x05, 0x80, 0x24, 0x80, 0x25, 0x80, 
-    0x23, 0x80, 0x45, 0x88, 0x23, 0x80, 0x45, 0x88, 0x23, 0x80, 0x45, 0x88, 0x23, 0x80, 0x25, 
-    0x80, 0x25, 0x80, 0x05, 0x80, 0x24, 0x80, 0x25, 0x80, 0x23, 0x80, 0x25, 0x80, 0x24, 0x80, 
-    0x25, 0x80, 0x23, 0x80, 0x25, 0x80, 0x05, 0x80, 0x23, 0x80, 0x25, 0x80, 0x05, 0x80, 0x23, 
-    0x80, 0x25, 0x80, 0x24, 0x80, 0x25, 0x80, 0x05, 0x80, 0x23, 0x80, 0x25, 0x80, 0x25, 0x80, 
-    0x25, 0x80, 0x05, 0x80, 0x26, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 
-    0x80, 0x05, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 
-    0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 
-    0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 
-    0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x05, 0x80, 
-    0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 
-    0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 
-    0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 
-    0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 
-    0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x05, 
-    0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x01, 0x80, 
-    0x02, 0x80, 0x23, 0x80, 0x25, 0x80, 0x26, 0x80, 0x05, 0x80, 0x26, 0x80, 0x25, 0x80, 0x05, 
-    0x80, 0x26, 0x80, 0x05, 0x80, 0x26, 0x80, 0x25, 0x80, 0x25, 0x80, 0x05, 0x80, 0x26, 0x80, 
-    0x25, 0x80, 0x25, 0x80, 0x05, 0x80, 0x26, 0x80, 0x26, 0x80, 0x25, 0x80, 0x05, 0x80, 0x25, 
-    0x80, 0x25, 0x80, 0x05, 0x80, 0x25, 0x80, 0x25, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 
-    0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 0x80, 0x05, 0x80, 0x05, 0x80, 0x24, 
-    0x80, 0x05, 0x80, 0x24, 0x80, 0x25, 0x80, 0x43, 0x84, 0x45, 0x88, 0x25, 0x80, 0x42, 0x80, 
-    0x25, 0x80, 0x28, 0x80, 0x08, 0x80, 0x08, 0x80, 0x05, 0x80, 0x01, 0x80, 0x23, 0x84, 0x44, 
-    0x84, 0x26, 0x80, 0x46, 0x84, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x46, 0x84, 0x44, 0x84, 
-    0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x46, 0x84, 0x25, 0x80, 0x46, 0x84, 0x25, 0x80, 0x46, 
-    0x84, 0x25, 0x80, 0x46, 0x84, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x46, 0x84, 0x25, 0x80, 
-    0x25, 0x80, 0x25, 0x80, 0x46, 0x84, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 
-    0x80, 0x46, 0x84, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x24, 0x80, 
-    0x05, 0x80, 0x02, 0x80, 0x24, 0x80, 0x25, 0x80, 0x23, 0x80, 0x05, 0x80, 0x25, 0x80, 0x25, 
-    0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x27, 0x80, 0x23, 0x80, 0x05, 0x80, 0x24, 0x80, 
-    0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x27, 0x80, 0x23, 0x80, 0x05, 0x80, 0x24, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x23, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x23, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x21, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x21, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80, 
-    0x01, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80, 0x02, 0x80
+const int help_packed_size = 17726;
+const byte help_packed[] = {
+    0xB8, 0x4F, 0x8E, 0x8E, 0x02, 0x20, 0x07, 0xF0, 0x01, 0x00, 0x10, 0x1F, 0x12, 0x80, 0xBF, 
+    0x0A, 0x20, 0x21, 0x90, 0x23, 0x40, 0x00, 0xB0, 0x14, 0xF0, 0x03, 0x00, 0xF0, 0x4C, 0x1F, 
+    0xA0, 0x70, 0x3F, 0x0D, 0x30, 0x06, 0x80, 0x9A, 0xA0, 0xBC, 0x40, 0x07, 0x00, 0x00, 0x00, 
+    0x5C, 0x5C, 0x44, 0x02, 0x1A, 0x09, 0x00, 0xC7, 0x10, 0xC7, 0x02, 0x10, 0xC7, 0x60, 0xC5, 
+    0xC3, 0xC4, 0xD6, 0xC5, 0x08, 0x10, 0x10, 0xA0, 0xC6, 0x28, 0xC7, 0x10, 0xC6, 0x03, 0x00, 
+    0xC7, 0x03, 0x00, 0xC5, 0xC6, 0x8D, 0x15, 0x10, 0x10, 0x11, 0x10, 0x25, 0x10, 0x53, 0xC6, 
+    0xC7, 0x19, 0x00, 0x07, 0x0A, 0x20, 0x00, 0x90, 0x2D, 0x10, 0xD6, 0xC5, 0xC4, 0xD6, 0xC4, 
+    0x01, 0x00, 0x10, 0xD5, 0xC4, 0xC4, 0xC2, 0xD4, 0xC2, 0xC4, 0x50, 0xD6, 0xC7, 0xC6, 0xD6, 
+    0x01, 0x10, 0xC4, 0x03, 0x00, 0xC5, 0x4E, 0xD6, 0x35, 0x20, 0x01, 0x00, 0x0A, 0x00, 0xC5, 
+    0xC6, 0x14, 0x00, 0xC5, 0xC8, 0xD5, 0xC4, 0xC5, 0x29, 0x00, 0xC5, 0xC5, 0x08, 0x40, 0x52, 
+    0x40, 0xAA, 0x97, 0x00, 0xA0, 0xC8, 0x00, 0x20, 0xC9, 0x03, 0x10, 0xC7, 0x09, 0x50, 0x05, 
+    0x04, 0x10, 0xC9, 0x01, 0x10, 0x13, 0xC9, 0xC8, 0x14, 0x14, 0x22, 0xC9, 0x01, 0xF0, 0x00, 
+    0xCA, 0x14, 0xC9, 0x22, 0x10, 0xC9, 0x9B, 0x00, 0x9C, 0x9B, 0x9B, 0x59, 0x9C, 0x15, 0x15, 
+    0x2B, 0x02, 0x5A, 0x00, 0x30, 0x9D, 0x8A, 0x9D, 0x5C, 0x5C, 0x1D, 0x00, 0x5C, 0x9D, 0x9D, 
+    0x5C, 0x02, 0x4F, 0x8E, 0xC8, 0x06, 0x11, 0x01, 0x00, 0x02, 0x00, 0xD6, 0xD5, 0xD6, 0xD6, 
+    0xD6, 0x23, 0x0C, 0x20, 0x10, 0x90, 0xC4, 0xD5, 0xD6, 0xF3, 0x00, 0xC8, 0xC8, 0xDC, 0x10, 
+    0xC8, 0x06, 0x50, 0x02, 0x50, 0x0B, 0x00, 0x10, 0x02, 0x00, 0xF0, 0x00, 0x39, 0x03, 0xE1, 
+    0xC7, 0xC7, 0x39, 0x00, 0x00, 0x30, 0x01, 0x01, 0xD5, 0xD6, 0xBF, 0x2F, 0x10, 0x3E, 0x00, 
+    0x49, 0x00, 0x59, 0x21, 0x39, 0x00, 0x4F, 0x30, 0xD6, 0x0D, 0x10, 0x0D, 0xDC, 0x00, 0x99, 
+    0x00, 0x20, 0x06, 0x30, 0x54, 0x99, 0x99, 0x56, 0x00, 0x9A, 0x9A, 0x11, 0x9A, 0x99, 0x56, 
+    0x99, 0x99, 0x06, 0x98, 0x00, 0x00, 0x04, 0x50, 0x99, 0x58, 0x58, 0x57, 0x58, 0x08, 0x56, 
+    0x9A, 0x57, 0x02, 0x00, 0x9A, 0x56, 0x9A, 0x56, 0x08, 0x58, 0x9A, 0x58, 0x08, 0x00, 0x58, 
+    0x58, 0x56, 0x9B, 0x41, 0x07, 0x30, 0x9B, 0x9B, 0x58, 0x9B, 0x59, 0x02, 0x00, 0x9B, 0x18, 
+    0xCA, 0xCA, 0x15, 0x02, 0x10, 0x01, 0x00, 0xCB, 0x15, 0xCB, 0xA0, 0xCB, 0x9C, 0xCA, 0xCA, 
+    0xC9, 0x00, 0x10, 0xCA, 0x13, 0x00, 0x04, 0xCB, 0x18, 0x00, 0x80, 0x17, 0x17, 0x18, 0x5C, 
+    0x5A, 0x00, 0x2B, 0x5C, 0x8C, 0x4F, 0x8E, 0x10, 0x56, 0x58, 0xC0, 0x9C, 0x59, 0x59, 0x58, 
+    0x59, 0x59, 0x07, 0x50, 0x2B, 0x01, 0x01, 0x07, 0x00, 0x9B, 0x13, 0x56, 0x98, 0x54, 0x57, 
+    0x56, 0x80, 0x99, 0x53, 0x54, 0x13, 0x59, 0x99, 0x57, 0x00, 0x00, 0x08, 0x14, 0x58, 0x9B, 
+    0x06, 0x10, 0x57, 0x9B, 0x57, 0x59, 0x02, 0x57, 0x02, 0x10, 0x14, 0x57, 0x14, 0x9B, 0x57, 
+    0x9B, 0x40, 0x14, 0x57, 0x9B, 0x9B, 0x11, 0x11, 0xAA, 0x40, 0x9A, 0x00, 0x9A, 0x9A, 0x56, 
+    0x57, 0x9A, 0x9A, 0x13, 0x56, 0x00, 0x56, 0x57, 0x56, 0x56, 0x99, 0x56, 0x54, 0x99, 0x00, 
+    0x54, 0x53, 0x98, 0xC7, 0x53, 0x99, 0x56, 0x13, 0x20, 0x9A, 0x57, 0x13, 0x59, 0x56, 0x32, 
+    0x10, 0x57, 0x14, 0x18, 0x56, 0x14, 0x56, 0x4A, 0x00, 0x02, 0x00, 0x13, 0x56, 0x9A, 0x12, 
+    0x14, 0x02, 0x00, 0x59, 0x56, 0x2A, 0x10, 0x56, 0x99, 0x57, 0x28, 0x58, 0x58, 0x99, 0x16, 
+    0x00, 0x9B, 0x53, 0x00, 0x9B, 0x14, 0x05, 0xC7, 0x00, 0x9C, 0xB1, 0x01, 0x9B, 0x9B, 0x9B, 
+    0x9A, 0x58, 0x18, 0x9B, 0x9A, 0x9A, 0x07, 0x00, 0x17, 0x00, 0x63, 0x15, 0x5A, 0xE0, 0x5A, 
+    0x18, 0x5A, 0x18, 0x17, 0x03, 0x10, 0xBE, 0x00, 0xC3, 0x00, 0x04, 0x18, 0x1B, 0x03, 0x00, 
+    0x17, 0x17, 0x1A, 0x1A, 0x17, 0xDC, 0x17, 0x19, 0x01, 0x00, 0x05, 0x00, 0x06, 0x10, 0x1B, 
+    0x06, 0x10, 0x04, 0x00, 0x03, 0x11, 0x30, 0x28, 0x00, 0x5A, 0x2B, 0x15, 0x9C, 0x9D, 0x9D, 
+    0x00, 0x19, 0x18, 0x02, 0x5C, 0x5C, 0x18, 0x1C, 0x02, 0x20, 0x8B, 0x19, 0x1C, 0x19, 0x1C, 
+    0x0E, 0x00, 0x19, 0x02, 0xC0, 0x9C, 0x02, 0x1A, 0x4C, 0xCE, 0x8E, 0x39, 0x01, 0xF5, 0x00, 
+    0xEF, 0xFA, 0x00, 0x07, 0x50, 0xFB, 0x00, 0xE4, 0x10, 0x9A, 0x82, 0x01, 0x02, 0x00, 0x7F, 
+    0x00, 0xDE, 0x58, 0x70, 0x01, 0x00, 0x00, 0x14, 0x00, 0x01, 0x40, 0x13, 0x6C, 0x01, 0x09, 
+    0x20, 0xC1, 0x08, 0x20, 0x13, 0x58, 0x13, 0x13, 0x11, 0x00, 0x11, 0xA2, 0x01, 0xBF, 0x2A, 
+    0x10, 0xBF, 0x11, 0x02, 0x00, 0xC7, 0x01, 0x16, 0x01, 0x01, 0x00, 0x99, 0x17, 0x00, 0xF1, 
+    0xA3, 0x01, 0x9B, 0x14, 0x9A, 0x49, 0x00, 0x56, 0x00, 0x50, 0x10, 0x0C, 0x00, 0x07, 0xD7, 
+    0x00, 0x56, 0x10, 0xE2, 0x00, 0x9A, 0x99, 0x9A, 0x99, 0x9B, 0xAF, 0x08, 0x00, 0xEF, 0x00, 
+    0xFF, 0x00, 0x00, 0x00, 0xCA, 0x04, 0x10, 0x9C, 0x0F, 0x10, 0x80, 0x9B, 0x9C, 0x9C, 0x9C, 
+    0x15, 0x9C, 0x17, 0x2F, 0x00, 0x68, 0x17, 0xAA, 0x4D, 0x00, 0x00, 0x4E, 0x02, 0x10, 0x01, 
+    0x00, 0x4E, 0xBD, 0x03, 0x20, 0x4F, 0x04, 0x20, 0x03, 0x00, 0x00, 0x30, 0x18, 0x10, 0x4F, 
+    0x14, 0x00, 0xA0, 0x4D, 0x4F, 0x4D, 0x4F, 0x4E, 0x04, 0x10, 0x4F, 0x03, 0x00, 0x00, 0x4D, 
+    0x4D, 0x9C, 0x9C, 0x02, 0x9C, 0x9C, 0x5A, 0x70, 0x9D, 0x18, 0x18, 0x5C, 0x00, 0x00, 0x04, 
+    0x00, 0xFF, 0x00, 0x19, 0x00, 0x8B, 0x17, 0x19, 0x02, 0x15, 0x02, 0x17, 0x1A, 0xF8, 0xAC, 
+    0x4F, 0x8E, 0x3B, 0x02, 0xB7, 0x00, 0xF9, 0x00, 0x07, 0x50, 0x00, 0x11, 0x40, 0x14, 0x9B, 
+    0x58, 0x56, 0x99, 0x26, 0xC9, 0x00, 0x15, 0xD4, 0x9C, 0x57, 0xFE, 0x20, 0x56, 0xF6, 0x10, 
+    0x59, 0xF2, 0x00, 0xF4, 0x11, 0xF3, 0x01, 0x10, 0x0E, 0x12, 0x9B, 0x59, 0x08, 0x02, 0x0D, 
+    0x30, 0x28, 0x02, 0xE7, 0x10, 0x7B, 0xF7, 0x10, 0xC7, 0x01, 0x99, 0xA2, 0x12, 0x01, 0x01, 
+    0x00, 0x31, 0x39, 0x01, 0x58, 0xE7, 0x5D, 0x01, 0xF6, 0x00, 0x07, 0x01, 0x9C, 0x59, 0x04, 
+    0x00, 0x31, 0x00, 0x13, 0x21, 0x35, 0x55, 0x11, 0x9C, 0x17, 0x01, 0x9A, 0x1D, 0x00, 0xEA, 
+    0x10, 0xF5, 0x9D, 0x02, 0x9D, 0xA9, 0x01, 0x03, 0x9D, 0x17, 0x02, 0x1B, 0x9C, 0x40, 0xF5, 
+    0x18, 0x5C, 0x17, 0x9B, 0x5C, 0xDB, 0x01, 0x9B, 0x22, 0x9C, 0x2B, 0x01, 0x63, 0x18, 0xEE, 
+    0x1B, 0xF5, 0x24, 0x4F, 0x4F, 0x80, 0x9C, 0x9C, 0x9D, 0x15, 0x2B, 0x9D, 0x17, 0xFE, 0x01, 
+    0x21, 0x03, 0x10, 0x5C, 0x19, 0x19, 0x8A, 0x05, 0x11, 0x9D, 0x18, 0x80, 0x9D, 0x5A, 0x02, 
+    0x19, 0x4C, 0x4F, 0x8E, 0xBF, 0x20, 0x0D, 0xF4, 0x02, 0x58, 0x07, 0x50, 0xAC, 0x00, 0x59, 
+    0x9B, 0x59, 0x15, 0x20, 0x59, 0x58, 0x99, 0x99, 0x9A, 0x0D, 0x12, 0x9A, 0x9A, 0x0A, 0x5A, 
+    0xA9, 0x00, 0x58, 0x1D, 0x03, 0x9C, 0x59, 0x14, 0x9B, 0x45, 0x05, 0x00, 0x15, 0xBB, 0x00, 
+    0x59, 0x9C, 0x5A, 0x11, 0x10, 0x2B, 0xA0, 0x59, 0xCB, 0x59, 0x5A, 0x9B, 0x38, 0x13, 0x15, 
+    0x2D, 0x00, 0x99, 0xAC, 0x02, 0x5A, 0x57, 0x06, 0x00, 0xFA, 0x00, 0x9A, 0x56, 0x02, 0x10, 
+    0x89, 0xB7, 0x13, 0x25, 0x99, 0x3B, 0x01, 0x9A, 0x57, 0x14, 0x41, 0x00, 0xFF, 0x02, 0x00, 
+    0x08, 0x01, 0xFE, 0x20, 0x0C, 0x22, 0x2D, 0x01, 0x11, 0x12, 0xFB, 0x01, 0x10, 0x12, 0x01, 
+    0xA7, 0x00, 0xF6, 0x00, 0xF6, 0x1A, 0x03, 0x00, 0x9D, 0x00, 0x02, 0xF6, 0x4F, 0x2E, 0x00, 
+    0x1B, 0x8C, 0x1F, 0x40, 0x9C, 0x9C, 0x5C, 0x00, 0x00, 0x18, 0x07, 0x02, 0x9A, 0x08, 0x9B, 
+    0x63, 0x4D, 0x1C, 0xF6, 0x26, 0x4F, 0x9C, 0x58, 0x9C, 0x04, 0x2B, 0x15, 0xF0, 0x12, 0x9D, 
+    0x19, 0x5C, 0x17, 0x5C, 0xC0, 0x9D, 0x4C, 0x1C, 0x8C, 0x19, 0x5C, 0x08, 0x01, 0x10, 0x22, 
+    0x7D, 0xFF, 0x03, 0x9C, 0xF5, 0x10, 0x92, 0x00, 0xD9, 0x03, 0x07, 0x30, 0x09, 0x11, 0x3E, 
+    0x80, 0xAC, 0xEE, 0x4D, 0x8C, 0x18, 0x9B, 0x57, 0xF4, 0x10, 0x00, 0x57, 0x9A, 0x00, 0x01, 
+    0x9A, 0x9A, 0x59, 0x5A, 0x0C, 0x2E, 0x00, 0x8C, 0x10, 0x06, 0x10, 0x5C, 0x59, 0x58, 0x9C, 
+    0x00, 0x01, 0x00, 0x00, 0x9B, 0x00, 0x8E, 0x00, 0x00, 0x40, 0xAC, 0x2E, 0xAC, 0x8C, 0x56, 
+    0x2B, 0x1A, 0x00, 0x00, 0x00, 0x9A, 0x9A, 0x00, 0x2E, 0x9A, 0x9A, 0x2E, 0x2E, 0xC7, 0xFF, 
+    0x22, 0xD2, 0x02, 0x03, 0x00, 0x98, 0x98, 0x25, 0xFF, 0x02, 0xA3, 0x04, 0x77, 0xDE, 0x01, 
+    0xFD, 0x10, 0xEE, 0x00, 0x9C, 0x41, 0x14, 0xFD, 0x02, 0x54, 0x33, 0x56, 0x07, 0x32, 0x01, 
+    0xFB, 0x02, 0x63, 0x01, 0x9A, 0x9B, 0x03, 0x03, 0xF5, 0x00, 0x9D, 0x04, 0x9B, 0x8A, 0x03, 
+    0x1D, 0xF5, 0xF5, 0x00, 0x18, 0xCA, 0x9B, 0x00, 0x03, 0x2B, 0x00, 0xCA, 0x80, 0x15, 0x03, 
+    0x1A, 0x00, 0x9B, 0x59, 0x03, 0x1D, 0x01, 0x09, 0xFF, 0xF0, 0x2A, 0x9B, 0x15, 0x5A, 0x02, 
+    0x17, 0x02, 0x15, 0x5C, 0xA0, 0x5A, 0x5C, 0x9D, 0x5C, 0x4C, 0x12, 0x03, 0x4C, 0x06, 0x02, 
+    0x3F, 0xFE, 0x00, 0x05, 0x00, 0xFF, 0x01, 0xCC, 0x63, 0x07, 0x60, 0x09, 0x00, 0x1B, 0x4F, 
+    0x30, 0xAC, 0x8C, 0x1F, 0xAC, 0x9A, 0x01, 0x13, 0x04, 0x58, 0x59, 0x04, 0x02, 0x00, 0xBB, 
+    0x00, 0x02, 0x00, 0x03, 0x9B, 0x03, 0x00, 0x02, 0x8A, 0x2E, 0x02, 0x9C, 0x04, 0x2E, 0x5C, 
+    0x00, 0x56, 0x2E, 0x2E, 0x2B, 0x00, 0x2E, 0x28, 0x17, 0x10, 0x00, 0x00, 0x58, 0x99, 0xF1, 
+    0x00, 0x00, 0x00, 0x99, 0x00, 0x9B, 0x00, 0x00, 0x26, 0x00, 0x00, 0x2E, 0x9B, 0x6C, 0x2E, 
+    0x9D, 0x00, 0x22, 0xFE, 0x21, 0x25, 0xFF, 0x33, 0xE4, 0x00, 0x9A, 0xFF, 0x5D, 0x22, 0x61, 
+    0x22, 0x64, 0x11, 0x69, 0x00, 0xF3, 0x20, 0x15, 0x04, 0x74, 0x01, 0x09, 0x00, 0x01, 0x12, 
+    0x21, 0x9B, 0x9B, 0x2B, 0x00, 0x03, 0x9A, 0x9C, 0x09, 0x5A, 0x00, 0xCA, 0x28, 0x09, 0x00, 
+    0x9C, 0x00, 0xC9, 0x18, 0x98, 0x9D, 0x03, 0x01, 0x0C, 0x04, 0x1F, 0x00, 0xCA, 0x5C, 0x1D, 
+    0xF8, 0x27, 0x50, 0x9C, 0x9B, 0x2B, 0x5A, 0x03, 0x04, 0x17, 0x02, 0x02, 0x02, 0x16, 0x17, 
+    0x13, 0x04, 0x00, 0x00, 0x8B, 0x0B, 0x01, 0x02, 0x19, 0x9D, 0x38, 0x18, 0x8B, 0x5C, 0xFF, 
+    0x03, 0xD0, 0x53, 0x07, 0x80, 0x14, 0xAC, 0x00, 0xF6, 0x59, 0x28, 0x4C, 0xF6, 0x59, 0x9A, 
+    0x59, 0x02, 0x15, 0xB3, 0x11, 0x03, 0x02, 0x55, 0x9A, 0x9A, 0x02, 0x00, 0x02, 0x04, 0x28, 
+    0x26, 0x02, 0x9D, 0x02, 0x02, 0x01, 0xD6, 0x00, 0x54, 0x28, 0xF6, 0x9D, 0x57, 0xF6, 0xF6, 
+    0x00, 0x58, 0x9B, 0x02, 0x2E, 0x56, 0x57, 0x9D, 0x2E, 0x00, 0x55, 0x2E, 0x9D, 0x59, 0x59, 
+    0x2E, 0x2E, 0x9A, 0xC0, 0x2E, 0x9D, 0x9D, 0x2E, 0x2E, 0x9C, 0xFC, 0x20, 0x01, 0x20, 0xF8, 
+    0x99, 0x98, 0x56, 0x02, 0x11, 0x17, 0x15, 0x02, 0x12, 0x69, 0x20, 0x6E, 0x02, 0xFA, 0x14, 
+    0x10, 0x14, 0x9A, 0x2B, 0x04, 0xB5, 0x06, 0x74, 0x12, 0x20, 0x01, 0x75, 0x00, 0x01, 0xFF, 
+    0x02, 0x9A, 0x9B, 0x29, 0x9D, 0x9C, 0x03, 0x9D, 0x00, 0x2B, 0x03, 0x02, 0x9C, 0x03, 0x01, 
+    0x9C, 0x2B, 0x80, 0x01, 0xCA, 0x17, 0x2B, 0x9C, 0x01, 0xCA, 0x17, 0x10, 0x38, 0x9A, 0xCA, 
+    0x9D, 0xFF, 0xF0, 0x28, 0x41, 0x00, 0x00, 0x01, 0x5C, 0x17, 0xC3, 0x03, 0x14, 0x14, 0x05, 
+    0x4C, 0x1C, 0x4F, 0x02, 0x0F, 0x03, 0x0C, 0x12, 0x3C, 0x5C, 0x1B, 0xFF, 0x43, 0xD6, 0x14, 
+    0x07, 0x50, 0x9B, 0x01, 0xC9, 0x02, 0x40, 0x1D, 0x5A, 0x5A, 0x4C, 0xF5, 0x56, 0xFB, 0x01, 
+    0x56, 0x0A, 0x9B, 0x9D, 0x00, 0x2B, 0xA5, 0x03, 0x03, 0x2B, 0x9B, 0x15, 0x20, 0xCA, 0x03, 
+    0x9B, 0x2B, 0x2B, 0xB4, 0x01, 0x57, 0x9B, 0x00, 0x9D, 0x2B, 0x04, 0x2B, 0x2B, 0x58, 0x17, 
+    0x9D, 0x80, 0x02, 0x56, 0x57, 0x9C, 0x9D, 0x26, 0x9D, 0xFF, 0x00, 0x00, 0x2B, 0x9D, 0x56, 
+    0x2B, 0x29, 0x9C, 0x9D, 0x2B, 0x8B, 0xCF, 0x13, 0x01, 0x01, 0x56, 0x3D, 0x05, 0x25, 0x98, 
+    0x25, 0x01, 0x15, 0x7F, 0x40, 0x00, 0xF7, 0x00, 0x67, 0x60, 0xB1, 0x17, 0x03, 0x01, 0xFC, 
+    0x00, 0xEB, 0x16, 0x59, 0x27, 0x53, 0x04, 0x07, 0x15, 0xFF, 0x10, 0x2E, 0x00, 0x61, 0x02, 
+    0x2B, 0x2B, 0x00, 0x9A, 0x04, 0x9D, 0x8C, 0x9C, 0x2B, 0x9C, 0x2B, 0x90, 0x2B, 0x9C, 0x2E, 
+    0x18, 0x04, 0x00, 0x9C, 0x18, 0x12, 0x16, 0xBC, 0x9D, 0x4F, 0xD0, 0xF9, 0x01, 0x00, 0xF0, 
+    0x13, 0x3B, 0x00, 0xFE, 0x02, 0x9C, 0xEE, 0x00, 0x01, 0x03, 0x07, 0xF6, 0x4F, 0x4F, 0x1C, 
+    0x8B, 0x4F, 0x8B, 0xF4, 0x14, 0x9D, 0x0D, 0x04, 0x19, 0x0D, 0x03, 0xFF, 0x25, 0x94, 0x11, 
+    0x94, 0x22, 0x05, 0x07, 0x30, 0x9A, 0x52, 0x09, 0xF5, 0x4F, 0x4D, 0x2B, 0x99, 0x0C, 0xC8, 
+    0xCA, 0xA2, 0x12, 0x9C, 0x06, 0x2B, 0x04, 0x9C, 0x58, 0x04, 0x9A, 0x2B, 0x9B, 0x01, 0x2B, 
+    0x9A, 0x28, 0x2B, 0x9C, 0x00, 0x18, 0xCC, 0x5C, 0x9C, 0x9C, 0x2B, 0xF5, 0x18, 0x01, 0x58, 
+    0x03, 0x2B, 0x9D, 0x55, 0x57, 0x9C, 0x9C, 0x54, 0x00, 0x03, 0x02, 0x02, 0x9D, 0x2B, 0x28, 
+    0x9A, 0x2B, 0x00, 0x29, 0x99, 0x9C, 0x2B, 0x28, 0x99, 0x9B, 0x9B, 0x07, 0xFB, 0x11, 0xFE, 
+    0x11, 0xFD, 0x26, 0x99, 0x99, 0x57, 0x59, 0x59, 0x9C, 0x9C, 0x14, 0xF7, 0x02, 0xFC, 0x20, 
+    0x07, 0x21, 0x56, 0x9A, 0x0F, 0x31, 0x18, 0x14, 0x9B, 0x14, 0xDE, 0x11, 0x02, 0x26, 0x9A, 
+    0x9A, 0x03, 0x02, 0x03, 0x45, 0x04, 0x03, 0x02, 0x9D, 0x9C, 0x9B, 0x02, 0x48, 0x9C, 0x2B, 
+    0x03, 0x51, 0x03, 0x02, 0x2B, 0x11, 0x00, 0xF5, 0x42, 0x8C, 0x3F, 0x01, 0xCA, 0xCA, 0xCC, 
+    0x1D, 0xFF, 0xF0, 0x27, 0x9C, 0x0E, 0x15, 0x46, 0x01, 0xFE, 0x01, 0xF0, 0x08, 0x5C, 0xAC, 
+    0xAC, 0x4F, 0x30, 0x4F, 0xAC, 0x14, 0x9B, 0xFC, 0x09, 0x10, 0x00, 0x5C, 0x4F, 0x3C, 0x4D, 
+    0x8E, 0x8D, 0x35, 0x9C, 0x30, 0x07, 0x20, 0xF3, 0x00, 0xC9, 0xC7, 0xC0, 0xD6, 0xC5, 0xC5, 
+    0xC4, 0xC7, 0xCA, 0x96, 0x08, 0xFE, 0x04, 0x84, 0x98, 0x9B, 0xED, 0x00, 0x5C, 0x98, 0x98, 
+    0x2B, 0x9F, 0x04, 0x00, 0x56, 0x98, 0x9B, 0x9D, 0x02, 0x03, 0x99, 0x9C, 0x06, 0x9C, 0xDA, 
+    0x00, 0x97, 0x05, 0x59, 0x2B, 0x55, 0x57, 0x03, 0x00, 0x9C, 0x55, 0x9A, 0x9B, 0x02, 0x02, 
+    0x29, 0x99, 0xC0, 0x99, 0x18, 0x29, 0x14, 0x99, 0x03, 0xFF, 0x10, 0xFF, 0x34, 0xFB, 0xFE, 
+    0x23, 0x01, 0x01, 0x98, 0x57, 0x25, 0x5E, 0x53, 0x04, 0x20, 0x6E, 0x18, 0xF8, 0x01, 0x1F, 
+    0x96, 0x1A, 0x00, 0x02, 0xFD, 0x20, 0xE6, 0x06, 0x00, 0x00, 0xC9, 0x9B, 0x9A, 0x84, 0x04, 
+    0x04, 0x58, 0x00, 0xC9, 0x04, 0x9A, 0x9B, 0x03, 0x10, 0x07, 0x0D, 0x00, 0x4A, 0x01, 0x76, 
+    0x06, 0x9A, 0xCA, 0xCB, 0xCC, 0x8C, 0x0E, 0x4F, 0xAF, 0x05, 0xFF, 0xF0, 0x21, 0xFF, 0x08, 
+    0x02, 0x15, 0x03, 0x9C, 0x22, 0x1C, 0x02, 0x03, 0x19, 0x9C, 0x03, 0x78, 0x00, 0x9A, 0x9C, 
+    0xF2, 0x1C, 0x0A, 0x00, 0x9D, 0x18, 0xFF, 0x11, 0xF8, 0x00, 0x4B, 0x2A, 0x64, 0x00, 0xB7, 
+    0x07, 0x30, 0x99, 0x27, 0x9E, 0x0A, 0xC8, 0xC5, 0x00, 0x9E, 0x03, 0x58, 0xC5, 0x05, 0x44, 
+    0x98, 0x96, 0x84, 0x2A, 0xC7, 0x98, 0x99, 0x0D, 0x01, 0xC7, 0x28, 0xC7, 0x98, 0x9A, 0xD5, 
+    0x12, 0x26, 0xDA, 0x00, 0xC8, 0x99, 0x94, 0x99, 0x59, 0xB3, 0x0A, 0x9B, 0xEF, 0x11, 0x9A, 
+    0x55, 0x0C, 0x00, 0xBE, 0x14, 0xEE, 0x01, 0xBE, 0x00, 0xFD, 0x20, 0x14, 0x2A, 0x37, 0x10, 
+    0x99, 0x00, 0x11, 0xE3, 0x59, 0x23, 0x08, 0x00, 0x9C, 0x59, 0x15, 0xFD, 0x10, 0xEA, 0x18, 
+    0x14, 0x10, 0x7F, 0xE5, 0x09, 0x03, 0x29, 0x11, 0x29, 0x15, 0x00, 0x03, 0x10, 0xFE, 0x19, 
+    0x18, 0x01, 0x9C, 0x86, 0x59, 0x28, 0x01, 0x02, 0x20, 0x9B, 0x9A, 0x2B, 0x14, 0x92, 0x00, 
+    0x9C, 0xC6, 0xC7, 0xCC, 0x0B, 0xCB, 0x0A, 0x34, 0x12, 0x9C, 0x14, 0xD0, 0x0B, 0x85, 0x05, 
+    0x00, 0x15, 0x02, 0x00, 0x15, 0x14, 0x9C, 0x14, 0x02, 0x00, 0x91, 0x01, 0x10, 0x14, 0xCA, 
+    0x14, 0xEE, 0x05, 0x14, 0x17, 0xF7, 0x1A, 0xCC, 0xCA, 0x9B, 0xBF, 0x02, 0x00, 0x10, 0x03, 
+    0x9D, 0x29, 0x00, 0x04, 0x01, 0x69, 0x00, 0x03, 0x9D, 0x17, 0x6E, 0x02, 0x9C, 0xFA, 0x02, 
+    0x63, 0x08, 0x19, 0x7C, 0x19, 0x19, 0xFF, 0x16, 0x96, 0x26, 0x92, 0x02, 0x07, 0x50, 0x99, 
+    0x27, 0x57, 0x73, 0xFA, 0x0A, 0x8B, 0x10, 0x59, 0x59, 0xB9, 0x17, 0x6F, 0x1B, 0xD5, 0x15, 
+    0x13, 0xC5, 0xA8, 0x00, 0x13, 0xDC, 0x00, 0x57, 0x9A, 0x10, 0xBE, 0x16, 0x2B, 0x12, 0xFA, 
+    0x9A, 0xB8, 0x0A, 0x58, 0xEF, 0x0A, 0x3B, 0x19, 0xDF, 0x00, 0x16, 0x09, 0xCD, 0x10, 0xFF, 
+    0xFD, 0x10, 0xFE, 0x30, 0x04, 0x23, 0x1C, 0x10, 0xBF, 0x0B, 0xFC, 0x40, 0xFE, 0x40, 0x04, 
+    0x00, 0xFE, 0x57, 0xE7, 0x00, 0x60, 0x07, 0xFA, 0x10, 0x55, 0x04, 0x03, 0x21, 0x19, 0x10, 
+    0xFC, 0x30, 0xCF, 0x01, 0x30, 0x8E, 0x1B, 0x1C, 0x12, 0x98, 0x1A, 0xCA, 0x9A, 0xFD, 0x10, 
+    0xFC, 0x30, 0x7B, 0xFE, 0x00, 0x1A, 0x0A, 0x15, 0x05, 0x00, 0x1F, 0x0A, 0x05, 0x10, 0x02, 
+    0x00, 0x17, 0x15, 0x0E, 0x30, 0x15, 0x0F, 0x00, 0x17, 0x37, 0x1A, 0x02, 0x15, 0x9C, 0x54, 
+    0x19, 0x15, 0xEC, 0x0C, 0x15, 0x4D, 0x04, 0x17, 0x03, 0x00, 0x18, 0xE2, 0x5C, 0x02, 0x05, 
+    0x18, 0x2B, 0x5C, 0xFB, 0x03, 0xFD, 0x02, 0x01, 0x14, 0x1F, 0xFF, 0x01, 0x9D, 0x04, 0x97, 
+    0x26, 0xA2, 0x07, 0x07, 0x30, 0x59, 0x9C, 0x63, 0x04, 0x63, 0x15, 0x00, 0x10, 0x5A, 0x63, 
+    0x17, 0x63, 0x63, 0x1B, 0x43, 0x0B, 0x00, 0x00, 0x5A, 0x03, 0x00, 0x15, 0x00, 0x63, 0x17, 
+    0x14, 0x00, 0x17, 0x18, 0x63, 0x5A, 0x59, 0x3E, 0x15, 0x15, 0x31, 0x17, 0x30, 0x17, 0x17, 
+    0xA9, 0x1A, 0x10, 0x20, 0x30, 0x17, 0x17, 0x44, 0xAA, 0x5A, 0x23, 0x00, 0x63, 0x15, 0x14, 
+    0xA9, 0x0B, 0x15, 0x20, 0x15, 0x89, 0x58, 0x63, 0x63, 0x9B, 0x01, 0x15, 0x13, 0xFB, 0x9F, 
+    0x01, 0x2C, 0x40, 0x5C, 0x2F, 0x00, 0x95, 0x1B, 0x00, 0x10, 0xAD, 0x00, 0x01, 0x00, 0xEF, 
+    0x09, 0x20, 0x00, 0x50, 0x53, 0x50, 0x00, 0x50, 0x3F, 0xC0, 0x2B, 0x20, 0x00, 0xCF, 0x00, 
+    0xA1, 0xE8, 0x0B, 0x15, 0x17, 0x19, 0x15, 0x42, 0x10, 0x1B, 0xF2, 0x0B, 0x07, 0x01, 0x30, 
+    0xF8, 0x0B, 0x0C, 0x00, 0x17, 0x4C, 0x17, 0xAA, 0x5C, 0x15, 0x04, 0x00, 0x1B, 0x03, 0x00, 
+    0x1A, 0x03, 0x00, 0x17, 0x4C, 0x18, 0x66, 0xAA, 0x16, 0x00, 0x3F, 0x0A, 0x5C, 0x5C, 0x14, 
+    0x10, 0x0D, 0x0C, 0x1B, 0xC0, 0x17, 0x1B, 0x18, 0x18, 0x19, 0x19, 0xF0, 0x02, 0x07, 0x06, 
+    0x8E, 0x5C, 0xFB, 0x05, 0x01, 0x02, 0x0D, 0x1A, 0x3F, 0x4F, 0x8E, 0xAB, 0x1A, 0x07, 0x82, 
+    0x17, 0xDF, 0x11, 0x07, 0x20, 0x18, 0x4C, 0x4D, 0x4D, 0xEE, 0xBC, 0x4D, 0x4C, 0x03, 0x00, 
+    0x2A, 0x17, 0x07, 0x10, 0x0C, 0x20, 0x4C, 0x07, 0x00, 0xF9, 0x18, 0x00, 0x4F, 0xEE, 0x0B, 
+    0x30, 0x02, 0x60, 0x2B, 0x40, 0x23, 0x30, 0x3A, 0x00, 0x68, 0x4D, 0xEE, 0x59, 0x1B, 0x40, 
+    0x4C, 0x05, 0x30, 0x03, 0x00, 0xAC, 0xFF, 0x20, 0x30, 0x43, 0x50, 0x03, 0x30, 0x2B, 0x10, 
+    0x0C, 0x30, 0x00, 0xA0, 0xA0, 0x18, 0x00, 0x40, 0xFF, 0x81, 0x00, 0x07, 0x20, 0x10, 0x40, 
+    0xD9, 0x2B, 0x10, 0x90, 0x0C, 0x40, 0x17, 0x30, 0xEB, 0x2B, 0x9F, 0x07, 0x30, 0x0A, 0x10, 
+    0x04, 0x10, 0x0D, 0x90, 0x00, 0x40, 0x9C, 0x58, 0x06, 0x08, 0x8F, 0x01, 0x00, 0xFD, 0x06, 
+    0xFF, 0x49, 0xA9, 0x37, 0x56, 0x9A, 0x17, 0x07, 0x50, 0xAD, 0x62, 0x94, 0xF6, 0x75, 0xF7, 
+    0x27, 0x00, 0xF0, 0x82, 0x4F, 0x0C, 0x0A, 0x59, 0x11, 0x1E, 0xBF, 0xFD, 0x02, 0xFF, 0x69, 
+    0x76, 0x05, 0x37, 0x0F, 0xFC, 0x20, 0xB2, 0x1A, 0x15, 0x61, 0xF5, 0x21, 0xC3, 0x00, 0xF0, 
+    0x96, 0x41, 0x08, 0x9C, 0x59, 0x02, 0x19, 0xFF, 0x02, 0xFE, 0x08, 0xB9, 0xFF, 0x59, 0x9C, 
+    0x59, 0x89, 0x4B, 0xAE, 0x0C, 0x05, 0x00, 0x18, 0xFE, 0xF0, 0xC8, 0xBF, 0xFF, 0x01, 0xED, 
+    0x00, 0xFE, 0x0E, 0xFD, 0x00, 0x01, 0x23, 0xFF, 0x29, 0x9C, 0x89, 0x1B, 0x1B, 0x80, 0x2C, 
+    0xFE, 0x11, 0x9A, 0x67, 0xFB, 0x28, 0x00, 0xF2, 0x93, 0x9C, 0x59, 0x5C, 0xF1, 0x05, 0x0C, 
+    0x9D, 0x9D, 0x15, 0xFF, 0x69, 0xFF, 0x10, 0xA1, 0x2C, 0x03, 0x25, 0xAC, 0x58, 0x2B, 0xFF, 
+    0xF0, 0xCA, 0xFF, 0x11, 0x9D, 0xFF, 0x01, 0x15, 0xFC, 0x02, 0x8F, 0xFF, 0x59, 0xFF, 0x10, 
+    0x01, 0x32, 0xD1, 0x17, 0x58, 0x2B, 0x00, 0x29, 0x43, 0xF3, 0xFF, 0xF0, 0xC7, 0xFE, 0x07, 
+    0x15, 0x1C, 0xFF, 0x27, 0xFF, 0x29, 0xD9, 0x0B, 0x01, 0x11, 0x1E, 0x56, 0x85, 0x2C, 0xFF, 
+    0x07, 0xFB, 0xF0, 0xC8, 0xFF, 0x20, 0x15, 0x9D, 0x19, 0xF8, 0x5A, 0x1C, 0x2B, 0x00, 0x11, 
+    0xFF, 0x59, 0xFF, 0x31, 0xE1, 0x0D, 0x91, 0x0E, 0x45, 0x86, 0x09, 0x19, 0xFF, 0xF2, 0xCB, 
+    0x15, 0x59, 0x5C, 0x05, 0x0B, 0x15, 0x7C, 0x8B, 0x2B, 0xFF, 0x69, 0xFF, 0x01, 0x01, 0x20, 
+    0xF8, 0x1A, 0xAA, 0x0F, 0x99, 0xFC, 0xC8, 0x5A, 0x53, 0xF4, 0x1E, 0x31, 0xF7, 0x18, 0x2B, 
+    0xF0, 0x10, 0x7C, 0x02, 0x7F, 0x22, 0x84, 0xF2, 0x1C, 0xFE, 0x1F, 0x56, 0x20, 0x33, 0x00, 
+    0x07, 0x10, 0x3F, 0x30, 0x09, 0x00, 0x43, 0x40, 0x1B, 0x20, 0x13, 0x04, 0x10, 0x03, 0x10, 
+    0x9C, 0x03, 0xFD, 0x04, 0x17, 0x19, 0x02, 0xBF, 0x04, 0x03, 0xFF, 0x49, 0xFF, 0x31, 0xFE, 
+    0x20, 0xC5, 0x1C, 0xFB, 0x0D, 0xC8, 0xB5, 0x1E, 0xEF, 0xBB, 0x1B, 0x12, 0x18, 0x14, 0x06, 
+    0x00, 0x70, 0x56, 0xD0, 0x1E, 0xD3, 0x3E, 0x05, 0x10, 0x81, 0xE5, 0x2D, 0x56, 0x9A, 0x57, 
+    0x99, 0x99, 0x97, 0xEA, 0x3C, 0x0F, 0xF1, 0x3B, 0x00, 0x40, 0x3D, 0x20, 0x2A, 0x20, 0x98, 
+    0x97, 0x97, 0x97, 0x4A, 0x96, 0x01, 0x00, 0x97, 0xBE, 0x1C, 0x11, 0xC9, 0x5E, 0x0F, 0xC9, 
+    0xE0, 0xC8, 0xC8, 0xCA, 0xC8, 0xC8, 0x05, 0x00, 0x0B, 0x00, 0x04, 0x00, 0xED, 0x00, 0x30, 
+    0x13, 0x03, 0x30, 0x06, 0x10, 0x57, 0x46, 0x1C, 0x21, 0x1C, 0x98, 0x22, 0xDC, 0x9B, 0x9A, 
+    0x1B, 0x2E, 0xA2, 0x06, 0x00, 0x00, 0x58, 0x1E, 0x1C, 0x0E, 0x0C, 0x03, 0x03, 0x40, 0x21, 
+    0x1C, 0x9C, 0x59, 0x03, 0x15, 0x9C, 0x58, 0xD0, 0x5A, 0x89, 0x9C, 0x58, 0x13, 0x10, 0x03, 
+    0x17, 0x1D, 0x04, 0x00, 0xF8, 0x2B, 0x15, 0x02, 0x40, 0x00, 0x45, 0x20, 0x04, 0x40, 0x2D, 
+    0x20, 0xFC, 0x18, 0xF4, 0x02, 0x1A, 0x0C, 0x1B, 0x8C, 0xA1, 0x0A, 0xFF, 0x21, 0xF8, 0x1D, 
+    0x65, 0x00, 0x01, 0x01, 0x11, 0x9A, 0x58, 0x57, 0xC9, 0xC8, 0xC6, 0xC6, 0x00, 0xC5, 0xC4, 
+    0xC4, 0xC4, 0xD5, 0xC4, 0xD6, 0xC5, 0x22, 0xC6, 0x02, 0x00, 0xC6, 0xC6, 0xD6, 0x02, 0x10, 
+    0xD6, 0xC7, 0x1A, 0xD6, 0x16, 0x00, 0xC5, 0x18, 0x0F, 0x03, 0x10, 0xC4, 0xC5, 0xC4, 0x00, 
+    0xD6, 0xC7, 0xC7, 0xC6, 0xC6, 0xC7, 0xC7, 0x10, 0xFF, 0x02, 0x00, 0x2D, 0x00, 0x00, 0x60, 
+    0x1D, 0x00, 0x32, 0x00, 0x31, 0x10, 0x25, 0x00, 0x04, 0x10, 0x01, 0x4B, 0x10, 0xC4, 0xC3, 
+    0xD4, 0xC2, 0xC3, 0xD4, 0xC3, 0x50, 0xC4, 0xC5, 0xC7, 0x10, 0x33, 0x00, 0x10, 0x36, 0x00, 
+    0x3C, 0x37, 0x03, 0x00, 0x54, 0x00, 0x5A, 0x10, 0xC7, 0x48, 0x20, 0x47, 0x00, 0xC8, 0x10, 
+    0xE0, 0xC8, 0xC8, 0xC8, 0x11, 0xC8, 0x06, 0x20, 0x08, 0x00, 0x19, 0x01, 0x26, 0xC7, 0x87, 
+    0x0E, 0x03, 0x00, 0xC8, 0xC7, 0x94, 0x00, 0xD6, 0xD6, 0x3E, 0xC7, 0x16, 0x10, 0x2F, 0x11, 
+    0x1A, 0x00, 0x48, 0x01, 0x3C, 0x11, 0x11, 0xC8, 0x02, 0x13, 0x13, 0x10, 0xC9, 0x57, 0xC9, 
+    0x14, 0x14, 0xC9, 0x94, 0x14, 0xC8, 0x03, 0x00, 0x13, 0x03, 0x00, 0xC9, 0x14, 0xFF, 0x0D, 
+    0xDF, 0x01, 0x00, 0xBA, 0x81, 0x40, 0x31, 0x00, 0x00, 0xFA, 0x25, 0x18, 0xFA, 0x06, 0x00, 
+    0x00, 0x7B, 0x60, 0x0B, 0xFF, 0x00, 0x9B, 0xFB, 0x04, 0x63, 0x0D, 0x06, 0x34, 0xA6, 0x0D, 
+    0x57, 0xA0, 0x56, 0x57, 0x13, 0x99, 0x13, 0xD9, 0x01, 0x57, 0x0A, 0x10, 0x34, 0x57, 0x13, 
+    0x04, 0x00, 0x54, 0x0A, 0x00, 0x07, 0x00, 0x54, 0x57, 0x04, 0x13, 0x58, 0x07, 0x00, 0x13, 
+    0x59, 0x14, 0x14, 0x14, 0x10, 0x58, 0x14, 0x63, 0x58, 0xDE, 0x0C, 0x89, 0x9C, 0x63, 0x9C, 
+    0x15, 0x9C, 0x3D, 0x1F, 0x3B, 0x14, 0x3F, 0x10, 0x14, 0x57, 0x1A, 0x00, 0x19, 0x1B, 0x00, 
+    0x13, 0x13, 0x0A, 0x10, 0x01, 0x10, 0x14, 0x14, 0x9B, 0x06, 0x13, 0x5D, 0x19, 0x2A, 0x02, 
+    0x56, 0x13, 0x9B, 0x59, 0x63, 0x05, 0xC9, 0x0D, 0x14, 0x04, 0x00, 0x14, 0x5A, 0x63, 0x58, 
+    0x63, 0x80, 0x58, 0x59, 0x15, 0x15, 0x59, 0x63, 0x15, 0x05, 0x00, 0x78, 0x9C, 0x15, 0x5A, 
+    0x0B, 0x0E, 0xD1, 0x2D, 0x06, 0x00, 0x40, 0x0D, 0x9C, 0x72, 0x15, 0x28, 0x10, 0x9C, 0x14, 
+    0xED, 0x0E, 0xEB, 0x2E, 0xA7, 0x01, 0x9B, 0x09, 0x27, 0x10, 0x5A, 0x5A, 0x22, 0x00, 0x5A, 
+    0x5A, 0x03, 0x17, 0x85, 0x04, 0x00, 0x5A, 0xDB, 0x0D, 0x8A, 0x17, 0x9C, 0x59, 0xCE, 0x03, 
+    0x88, 0x15, 0x2B, 0x18, 0xF0, 0x0D, 0x9D, 0x15, 0x9D, 0xE6, 0x0E, 0x00, 0x17, 0x02, 0x15, 
+    0x8A, 0x18, 0x5C, 0x1C, 0x8A, 0x8D, 0x23, 0x1E, 0x9B, 0x01, 0x00, 0x00, 0x50, 0x02, 0x9C, 
+    0x2B, 0xF9, 0x1D, 0xE0, 0x17, 0x9D, 0x1A, 0x4C, 0xEE, 0xFD, 0x10, 0x9A, 0x0C, 0xFF, 0x10, 
+    0xFF, 0xF4, 0x00, 0xF9, 0x0C, 0xFE, 0x2E, 0x0A, 0x18, 0x09, 0x24, 0x0D, 0x3A, 0xD4, 0x20, 
+    0x1F, 0x08, 0x18, 0x9B, 0x99, 0x58, 0x20, 0x0E, 0x24, 0x12, 0x9B, 0x13, 0x99, 0xD7, 0x72, 
+    0x12, 0xA2, 0x00, 0x28, 0x0E, 0x59, 0xCE, 0x0E, 0x14, 0x8E, 0x00, 0x3A, 0x21, 0x98, 0x57, 
+    0x9A, 0x57, 0x4B, 0x0F, 0x42, 0x0E, 0x9B, 0x58, 0x1F, 0x00, 0x7F, 0x09, 0x20, 0x01, 0x10, 
+    0x02, 0x10, 0xD7, 0x0E, 0x2A, 0x1F, 0x00, 0x20, 0xD7, 0x5E, 0x03, 0xD9, 0xDD, 0x00, 0x59, 
+    0x58, 0x0C, 0x20, 0x13, 0x2F, 0x5A, 0x1B, 0x1F, 0x1D, 0x3F, 0xBF, 0x0F, 0x50, 0xD8, 0x02, 
+    0xBD, 0x00, 0x06, 0x10, 0x24, 0x10, 0x0C, 0x03, 0x9B, 0xDB, 0x0F, 0xA8, 0x59, 0x5A, 0x2B, 
+    0xDA, 0x02, 0x03, 0x1F, 0x01, 0x5A, 0xF5, 0x00, 0xB6, 0x59, 0xD0, 0x0F, 0xE6, 0x0E, 0x5A, 
+    0x1F, 0x00, 0xD6, 0x00, 0x5A, 0x01, 0x00, 0xFD, 0x02, 0x11, 0x18, 0x00, 0x00, 0xE7, 0x13, 
+    0xF8, 0x60, 0x00, 0x50, 0x23, 0x01, 0xF6, 0x16, 0x06, 0xEE, 0xFD, 0x00, 0xFE, 0x00, 0x8B, 
+    0x4F, 0xEE, 0x4F, 0x8E, 0xFC, 0x9B, 0x15, 0xF5, 0x1D, 0xDD, 0x00, 0x01, 0x30, 0x0B, 0x01, 
+    0x0A, 0x18, 0x15, 0x2D, 0x01, 0xFA, 0x23, 0x55, 0x58, 0x59, 0x57, 0x99, 0x57, 0x03, 0x02, 
+    0x58, 0x82, 0x03, 0x99, 0x9A, 0x59, 0x03, 0x58, 0x9A, 0x74, 0x9C, 0x59, 0x19, 0x02, 0x18, 
+    0xD4, 0x00, 0x9C, 0x2F, 0x5C, 0x01, 0x14, 0x7F, 0x1A, 0x00, 0xA5, 0x2F, 0x9F, 0x23, 0x4F, 
+    0x00, 0xF2, 0x10, 0x00, 0x20, 0xAB, 0x03, 0x58, 0xE5, 0xF8, 0x00, 0x15, 0xBF, 0x03, 0x59, 
+    0x28, 0x0F, 0x00, 0x4C, 0x01, 0xF8, 0x1F, 0x7F, 0xBB, 0x00, 0xC6, 0x00, 0xB3, 0x03, 0x34, 
+    0x00, 0xFD, 0x90, 0x08, 0x10, 0x0D, 0x60, 0x59, 0x8F, 0xCD, 0x03, 0xB6, 0x13, 0x22, 0x00, 
+    0x24, 0x00, 0x9C, 0x15, 0x2B, 0x7C, 0x01, 0xF2, 0x14, 0x0E, 0x00, 0x9C, 0x5A, 0xFE, 0x00, 
+    0xED, 0x01, 0xF4, 0x00, 0x04, 0x20, 0x57, 0x06, 0x10, 0x85, 0x00, 0x25, 0x01, 0x17, 0xF2, 
+    0x00, 0x5A, 0xDA, 0x1C, 0x5A, 0x1B, 0x00, 0x21, 0xDF, 0x0D, 0x9D, 0xFD, 0xA1, 0x00, 0x20, 
+    0x18, 0x5C, 0xAA, 0x44, 0xEE, 0xEE, 0xF9, 0x21, 0x4F, 0x8B, 0x8B, 0x10, 0x0E, 0x8E, 0x7B, 
+    0xA2, 0x00, 0x00, 0x2D, 0x57, 0x06, 0x11, 0x02, 0x17, 0x00, 0x22, 0x08, 0x0E, 0x25, 0x03, 
+    0x33, 0x03, 0x04, 0x02, 0x1D, 0x2E, 0x2E, 0x1C, 0x58, 0x2E, 0x00, 0x2E, 0x2E, 0x00, 0x9C, 
+    0x99, 0x02, 0x02, 0x9A, 0x00, 0x1A, 0xF5, 0x17, 0x9B, 0xF5, 0x1A, 0x56, 0x9C, 0x00, 0x1F, 
+    0xF6, 0x2E, 0x18, 0x59, 0xF6, 0xF6, 0x2E, 0x00, 0x2E, 0x9B, 0x02, 0x4F, 0x9C, 0x9B, 0x1D, 
+    0x8C, 0x02, 0x9C, 0x9D, 0x11, 0x9C, 0x02, 0x02, 0x19, 0x59, 0x9C, 0x00, 0x18, 0x02, 0xF6, 
+    0xF6, 0x18, 0x59, 0x9B, 0x28, 0x08, 0xF6, 0xF6, 0x9A, 0x09, 0x00, 0xF6, 0xF6, 0x59, 0x2B, 
+    0x09, 0x04, 0x00, 0x9C, 0x9C, 0x0A, 0x10, 0xF6, 0x9D, 0xF6, 0x9C, 0x00, 0x9D, 0xF6, 0x9A, 
+    0x9D, 0xF6, 0x9D, 0x18, 0xF6, 0x78, 0xF6, 0xF5, 0xF5, 0x4A, 0x01, 0xD1, 0x02, 0xF3, 0x20, 
+    0xF6, 0x10, 0x5A, 0xCF, 0x00, 0x32, 0x07, 0x01, 0x06, 0x41, 0xEC, 0x00, 0x59, 0x9C, 0xF4, 
+    0x00, 0x18, 0x11, 0x97, 0xC9, 0x12, 0xA8, 0x04, 0x0A, 0x05, 0x9B, 0xF8, 0x01, 0x15, 0x2B, 
+    0xFA, 0x12, 0xDF, 0x07, 0x11, 0x2C, 0x00, 0x65, 0x01, 0xDC, 0x34, 0x04, 0x03, 0x5C, 0x00, 
+    0x01, 0x05, 0x02, 0x8F, 0xFE, 0x01, 0x01, 0x21, 0xF1, 0x10, 0x02, 0x91, 0x18, 0x18, 0xAA, 
+    0xC1, 0x3F, 0x40, 0x4D, 0xAC, 0x8A, 0xAC, 0x1B, 0x2B, 0x1F, 0x0F, 0x8E, 0xF7, 0x52, 0x11, 
+    0xC8, 0x01, 0x02, 0x01, 0x9B, 0xCF, 0x21, 0x02, 0x09, 0x76, 0x25, 0x0E, 0x16, 0x01, 0x2F, 
+    0x24, 0x2B, 0x2B, 0x2E, 0x01, 0x2E, 0x00, 0x29, 0x00, 0x00, 0x00, 0x9A, 0x02, 0x00, 0x99, 
+    0x00, 0x00, 0x00, 0x9D, 0x9B, 0x01, 0x01, 0x9A, 0x5C, 0x1D, 0x1D, 0x00, 0x1D, 0x5C, 0x59, 
+    0xF6, 0x2B, 0x04, 0x2B, 0x02, 0x00, 0x9B, 0x9D, 0x02, 0x2E, 0x01, 0x03, 0x9A, 0x9C, 0x01, 
+    0xE4, 0x01, 0x5C, 0x2E, 0x8C, 0x8C, 0x02, 0x59, 0x9D, 0x00, 0x02, 0x18, 0x02, 0x1C, 0x9C, 
+    0x58, 0x28, 0x19, 0x40, 0x5C, 0x9A, 0x02, 0x01, 0x02, 0x9C, 0xF0, 0x00, 0xF5, 0x00, 0x9C, 
+    0xF5, 0x19, 0x59, 0x03, 0x03, 0x01, 0x02, 0x00, 0x9A, 0x9D, 0x5C, 0x9C, 0x9D, 0x02, 0x9B, 
+    0x9C, 0xC0, 0xF6, 0x2B, 0x18, 0xF6, 0x9C, 0x2B, 0x75, 0x14, 0x44, 0x02, 0xB3, 0xDA, 0x00, 
+    0xB7, 0x05, 0x15, 0x03, 0xF1, 0x01, 0x0A, 0x20, 0x59, 0xCF, 0x03, 0xFF, 0x00, 0x02, 0xFE, 
+    0x00, 0xFC, 0x21, 0xC0, 0x00, 0xFE, 0x22, 0x2D, 0x02, 0x00, 0x13, 0x02, 0x02, 0x3F, 0xB1, 
+    0x20, 0x2C, 0x22, 0xF8, 0x10, 0xFD, 0x00, 0x27, 0x22, 0x02, 0x22, 0x5A, 0x18, 0x10, 0x5A, 
+    0x18, 0x03, 0x18, 0xDA, 0x0C, 0x8A, 0x19, 0x9D, 0xE0, 0x8A, 0x9D, 0x5C, 0x17, 0x2B, 0xFA, 
+    0x30, 0x05, 0x10, 0x29, 0x01, 0x18, 0x18, 0xAA, 0xAC, 0xFB, 0x01, 0xFC, 0x00, 0xEE, 0x19, 
+    0x5C, 0xC0, 0xAC, 0x03, 0xAC, 0x8A, 0x03, 0x4D, 0xFF, 0x11, 0x65, 0x20, 0xE5, 0x01, 0x03, 
+    0xCA, 0x71, 0x21, 0x59, 0xCA, 0x7A, 0x06, 0xAC, 0x23, 0xFE, 0x11, 0x01, 0x02, 0x00, 0x9D, 
+    0x9C, 0x9A, 0x2B, 0xF5, 0x9D, 0x2B, 0x02, 0x28, 0xFC, 0x01, 0x03, 0x02, 0x9A, 0x2E, 0x2E, 
+    0x01, 0x00, 0x02, 0x01, 0xF5, 0x9B, 0x1D, 0x1D, 0x57, 0x1D, 0x00, 0x9D, 0x28, 0x9D, 0x9D, 
+    0x2B, 0x9D, 0x2B, 0x9A, 0x00, 0x9B, 0x2B, 0x02, 0x2B, 0x9A, 0x5A, 0x59, 0x17, 0x00, 0x9B, 
+    0x18, 0x2B, 0x9B, 0x99, 0x9B, 0x9D, 0x9B, 0x00, 0x9C, 0x2B, 0x9A, 0x03, 0x9C, 0x57, 0x57, 
+    0x9B, 0x00, 0x5A, 0x9C, 0x28, 0x02, 0x2B, 0x29, 0x04, 0x57, 0x34, 0x03, 0xF6, 0xB5, 0x01, 
+    0x99, 0xFA, 0x02, 0x41, 0x00, 0x29, 0x2B, 0x08, 0x59, 0x28, 0x2B, 0x86, 0x03, 0x9A, 0x9C, 
+    0x2B, 0x03, 0xF8, 0x59, 0x28, 0x28, 0x79, 0x11, 0xF9, 0x10, 0xF0, 0x00, 0x04, 0x32, 0x09, 
+    0x10, 0xBF, 0x09, 0x12, 0x03, 0x00, 0x86, 0x00, 0x1C, 0x00, 0x1E, 0x15, 0x16, 0x33, 0x17, 
+    0xFF, 0x31, 0xFF, 0x04, 0x21, 0x68, 0x33, 0x00, 0x40, 0x06, 0x37, 0x85, 0x03, 0x00, 0x20, 
+    0xFB, 0x02, 0x03, 0x12, 0x0F, 0x01, 0x20, 0x07, 0x01, 0xF9, 0x82, 0xF8, 0x22, 0xEE, 0xEE, 
+    0x3F, 0x4D, 0x00, 0x8B, 0x4D, 0x4F, 0x03, 0x4C, 0x19, 0x59, 0x8B, 0x38, 0x03, 0x8A, 0x4D, 
+    0xFF, 0x0B, 0x41, 0x01, 0x6A, 0x11, 0x57, 0x9C, 0x91, 0x8C, 0x04, 0x9B, 0x58, 0x14, 0x08, 
+    0x12, 0x57, 0x9B, 0xFA, 0x14, 0x01, 0xFC, 0x00, 0x04, 0x58, 0x9A, 0x98, 0x9B, 0x2B, 0x1C, 
+    0x09, 0xD0, 0x00, 0x2B, 0x2B, 0xE8, 0x00, 0x03, 0x2B, 0x9A, 0x2B, 0x14, 0x02, 0x02, 0x02, 
+    0x00, 0x9B, 0x0F, 0x01, 0x2B, 0x9D, 0x9B, 0x00, 0x2B, 0x9D, 0x02, 0x02, 0x99, 0x9B, 0x9A, 
+    0x2B, 0x00, 0x2B, 0x99, 0x59, 0x15, 0x18, 0x57, 0x5A, 0x9C, 0x94, 0x2B, 0x99, 0x0C, 0x01, 
+    0x99, 0x05, 0x03, 0x2B, 0x03, 0x96, 0x00, 0x00, 0x5A, 0x9C, 0x9A, 0x28, 0x2B, 0x02, 0x9D, 
+    0x9D, 0x04, 0x9C, 0x9D, 0x0C, 0x00, 0x9B, 0x9A, 0x03, 0x15, 0x02, 0x82, 0x9C, 0x1E, 0x00, 
+    0x59, 0x04, 0x2B, 0x9C, 0x18, 0x50, 0x10, 0x6F, 0x3B, 0x00, 0xFF, 0x22, 0xE6, 0x05, 0xBF, 
+    0x27, 0x03, 0x07, 0x21, 0x4B, 0x05, 0x58, 0x7F, 0x39, 0x01, 0xFE, 0x10, 0x1B, 0x33, 0xE7, 
+    0x21, 0xBD, 0x11, 0x1A, 0x02, 0xF7, 0x00, 0x14, 0x7F, 0x04, 0x31, 0x05, 0x02, 0x03, 0x61, 
+    0x1D, 0x20, 0xE4, 0x21, 0x32, 0x14, 0x01, 0x11, 0x5A, 0x36, 0x5C, 0x01, 0x00, 0xFF, 0x22, 
+    0x9D, 0x13, 0x02, 0x00, 0x23, 0x15, 0x18, 0x06, 0x1B, 0xFD, 0x20, 0xF1, 0x06, 0xAC, 0x5A, 
+    0x8A, 0x4F, 0x03, 0x00, 0x17, 0x8A, 0x28, 0x4C, 0x03, 0x03, 0xAC, 0xAC, 0xEF, 0xFF, 0x21, 
+    0x92, 0x04, 0x96, 0x05, 0x70, 0x00, 0x14, 0x4F, 0x22, 0x96, 0x02, 0x01, 0x53, 0x20, 0x9A, 
+    0x9A, 0x98, 0x9C, 0x9B, 0xD3, 0x08, 0x59, 0x2B, 0x88, 0x28, 0x03, 0x9D, 0xFF, 0x00, 0x56, 
+    0x2B, 0x03, 0xFD, 0x00, 0x18, 0x2B, 0x9C, 0x9D, 0x12, 0x12, 0x79, 0x03, 0x9A, 0x2B, 0x9D, 
+    0x36, 0x55, 0xCE, 0x10, 0x8E, 0x06, 0x9A, 0xD3, 0x01, 0xC8, 0x00, 0x9D, 0x98, 0x67, 0xDD, 
+    0x01, 0x26, 0x01, 0xF6, 0x00, 0x2B, 0x99, 0x30, 0x01, 0xF1, 0x04, 0x03, 0xA0, 0x03, 0x03, 
+    0x1B, 0x9D, 0x04, 0xFB, 0x00, 0x9C, 0xF6, 0x00, 0x88, 0x28, 0x9A, 0x03, 0x3C, 0x01, 0x9B, 
+    0x03, 0x02, 0x6A, 0x13, 0xF3, 0xF3, 0x12, 0xF8, 0x41, 0x03, 0x63, 0x47, 0x06, 0x01, 0x21, 
+    0xD1, 0x04, 0x17, 0x22, 0x77, 0xE5, 0x22, 0x01, 0x30, 0xD1, 0x18, 0x17, 0x3D, 0x01, 0xF5, 
+    0x40, 0x08, 0x50, 0x13, 0xBD, 0xFF, 0x20, 0xCA, 0xDC, 0x22, 0x01, 0x00, 0xE5, 0x12, 0x0D, 
+    0x11, 0x59, 0x01, 0x06, 0x37, 0xFA, 0x01, 0x00, 0x64, 0x1F, 0x10, 0xF5, 0xEE, 0x27, 0x00, 
+    0x00, 0x8B, 0x03, 0x00, 0x4D, 0x03, 0x03, 0x4D, 0x59, 0x8A, 0x02, 0x04, 0xB0, 0x8B, 0x8A, 
+    0x58, 0x4F, 0xFF, 0x17, 0xAD, 0x15, 0x59, 0x02, 0x01, 0x5B, 0x02, 0x00, 0xFD, 0x10, 0x57, 
+    0xAC, 0x16, 0x05, 0x10, 0x99, 0xD3, 0x07, 0x57, 0x1C, 0x56, 0x98, 0x0A, 0x11, 0x04, 0x02, 
+    0x02, 0x00, 0x9B, 0x03, 0x9C, 0x22, 0x55, 0xB9, 0x02, 0x02, 0x9A, 0x2B, 0xBB, 0x03, 0x99, 
+    0x99, 0x82, 0x9C, 0x13, 0x02, 0x55, 0x9A, 0x2B, 0x5A, 0x57, 0xFF, 0x01, 0x80, 0x57, 0xC9, 
+    0x56, 0x99, 0x14, 0x26, 0x18, 0xED, 0x01, 0x02, 0x9B, 0xF4, 0x00, 0x9C, 0x18, 0x03, 0x57, 
+    0x5A, 0x02, 0xC8, 0x9D, 0x9A, 0x99, 0x1A, 0x03, 0x9D, 0x3F, 0xF0, 0x00, 0x04, 0x02, 0x01, 
+    0x64, 0x00, 0x9C, 0x28, 0x99, 0x9B, 0x9C, 0x29, 0x14, 0xFC, 0x26, 0x2B, 0x19, 0x00, 0x46, 
+    0x01, 0x20, 0x00, 0xF9, 0x54, 0xF9, 0x10, 0xFA, 0x12, 0xFF, 0xC6, 0x20, 0xF5, 0x60, 0xF8, 
+    0x42, 0xFF, 0x41, 0x10, 0x13, 0xFA, 0x22, 0xF9, 0x10, 0x05, 0x24, 0x8B, 0x04, 0x10, 0x0C, 
+    0x00, 0x58, 0x1A, 0x01, 0x9C, 0x03, 0x5A, 0x23, 0x10, 0xE7, 0xEA, 0x34, 0x2B, 0x00, 0x08, 
+    0x17, 0x8A, 0x19, 0xE0, 0x0A, 0x1C, 0x15, 0x14, 0x00, 0x08, 0x19, 0x18, 0x1B, 0xED, 0x35, 
+    0x8E, 0x18, 0x28, 0x4D, 0x80, 0x03, 0x8A, 0xAC, 0x28, 0x89, 0x8B, 0x26, 0xFF, 0x21, 0xFF, 
+    0xFF, 0x0E, 0x9E, 0x27, 0x56, 0x05, 0x6D, 0x13, 0x58, 0x32, 0x0C, 0x04, 0xB1, 0x03, 0xFC, 
+    0x27, 0x10, 0x99, 0x99, 0x05, 0x23, 0x06, 0x16, 0x98, 0x98, 0x26, 0x3D, 0xD8, 0x0A, 0x21, 
+    0x07, 0x00, 0x14, 0x26, 0xE8, 0x02, 0xDE, 0x1A, 0x9A, 0x59, 0x61, 0x24, 0x06, 0x59, 0x26, 
+    0x99, 0x99, 0x3F, 0x04, 0x2E, 0x17, 0x26, 0x51, 0x0A, 0x00, 0x9A, 0x9A, 0x26, 0x03, 0x0B, 
+    0x26, 0x29, 0x00, 0x99, 0xFA, 0x24, 0x10, 0x3B, 0x9A, 0x2C, 0x0B, 0x4F, 0x12, 0x1A, 0x1B, 
+    0x3F, 0x30, 0x1C, 0x10, 0xDF, 0x00, 0x10, 0xD9, 0x34, 0xDE, 0x18, 0x03, 0x20, 0x04, 0x03, 
+    0x63, 0xFE, 0x01, 0x01, 0x91, 0xF6, 0x15, 0xF1, 0x07, 0x14, 0x34, 0x5A, 0x9D, 0x03, 0xF9, 
+    0x72, 0x01, 0x94, 0x3E, 0x11, 0x6E, 0x17, 0x04, 0x11, 0x11, 0x3B, 0xFE, 0x10, 0x2B, 0x44, 
+    0x02, 0x05, 0x09, 0x17, 0x02, 0x5C, 0xFF, 0x41, 0x19, 0x5C, 0x1B, 0x1A, 0x8B, 0x8B, 0x80, 
+    0x1C, 0xAC, 0xF6, 0x8E, 0x2B, 0x58, 0xAC, 0xFF, 0x01, 0xC8, 0x28, 0x8B, 0x9D, 0xFF, 0x00, 
+    0x59, 0x4D, 0xFF, 0x02, 0xFF, 0x2A, 0x7F, 0xF8, 0x1E, 0x08, 0x33, 0x61, 0x13, 0x11, 0x20, 
+    0xBD, 0x01, 0x0A, 0x22, 0x1B, 0x10, 0x57, 0xF4, 0x04, 0x54, 0xCE, 0x1B, 0x9A, 0x11, 0x3C, 
+    0x28, 0x2C, 0x2E, 0x3C, 0x21, 0x49, 0x33, 0x2E, 0x25, 0x2D, 0x08, 0x98, 0x97, 0x1A, 0x11, 
+    0x17, 0x00, 0x26, 0x26, 0x80, 0x9A, 0x04, 0x04, 0x9A, 0x04, 0x9A, 0x25, 0x0C, 0x00, 0x76, 
+    0x54, 0xB9, 0x3B, 0x16, 0x10, 0x13, 0x54, 0x45, 0x43, 0x21, 0x13, 0x00, 0x28, 0xFF, 0x43, 
+    0x09, 0xF2, 0x15, 0xE4, 0x04, 0xE6, 0x10, 0xED, 0x14, 0x06, 0x04, 0xFE, 0x12, 0x01, 0x00, 
+    0x7E, 0x63, 0xFE, 0x31, 0x11, 0x23, 0xFE, 0x07, 0x64, 0x09, 0xFA, 0x60, 0xF8, 0x22, 0xCA, 
+    0x7F, 0x56, 0x14, 0x06, 0x00, 0xE1, 0x01, 0x06, 0x18, 0x02, 0x10, 0x08, 0x00, 0x15, 0x0A, 
+    0x9C, 0x8A, 0x17, 0xFE, 0x00, 0x2B, 0x08, 0x00, 0x19, 0x9D, 0x5A, 0x14, 0x23, 0x04, 0x9C, 
+    0x9B, 0x14, 0x05, 0xAC, 0x19, 0x8B, 0xAC, 0x8C, 0x20, 0xF6, 0x8E, 0x9C, 0x04, 0x4D, 0xF7, 
+    0x00, 0x28, 0x17, 0x60, 0x8A, 0x9A, 0x4C, 0x9C, 0x29, 0xFF, 0x10, 0xF2, 0x26, 0x99, 0xFF, 
+    0x04, 0x00, 0xFC, 0x00, 0x07, 0x15, 0xFB, 0x20, 0xFE, 0x24, 0x16, 0x12, 0xFE, 0x00, 0x19, 
+    0x10, 0x7B, 0x05, 0x00, 0xE7, 0x0C, 0x28, 0x14, 0x19, 0xF3, 0x20, 0xE9, 0x2A, 0x2B, 0x00, 
+    0x56, 0x38, 0x9A, 0x59, 0x56, 0x2E, 0x05, 0xAA, 0x15, 0x92, 0x10, 0x04, 0x56, 0x08, 0x04, 
+    0x04, 0x04, 0x4F, 0x12, 0x99, 0x9A, 0x10, 0x9A, 0xC6, 0x04, 0x4C, 0x0D, 0x37, 0x00, 0x9A, 
+    0x99, 0x28, 0x44, 0x10, 0x20, 0x11, 0x1F, 0x06, 0x00, 0xC4, 0x10, 0x5C, 0x44, 0x20, 0x29, 
+    0xFE, 0x10, 0x17, 0x9C, 0x63, 0xFF, 0x00, 0x17, 0xF1, 0x00, 0xD5, 0x29, 0x10, 0x58, 0x0B, 
+    0x6B, 0x2C, 0x19, 0xD5, 0x00, 0xFD, 0x30, 0xE7, 0xF4, 0x32, 0x09, 0x10, 0x16, 0x00, 0x9B, 
+    0x9C, 0xAD, 0x16, 0x09, 0x00, 0xFB, 0x00, 0x02, 0x17, 0x7D, 0x04, 0x9D, 0x9C, 0x5A, 0x02, 
+    0x15, 0x2B, 0xBD, 0x1F, 0x18, 0x9C, 0x19, 0x08, 0x11, 0x02, 0x0C, 0x00, 0x14, 0x23, 0x9D, 
+    0xFF, 0x01, 0x84, 0x3F, 0x19, 0xFF, 0x10, 0x58, 0x26, 0x4F, 0x89, 0xFF, 0x01, 0x7D, 0xFF, 
+    0x22, 0x28, 0xFF, 0x25, 0x9A, 0x03, 0x54, 0x00, 0x58, 0x15, 0xFD, 0x21, 0x9B, 0x40, 0x57, 
+    0x63, 0x15, 0x17, 0x63, 0x15, 0x03, 0x10, 0x18, 0xC4, 0x15, 0x17, 0x00, 0x00, 0x15, 0x17, 
+    0x5A, 0x03, 0x00, 0x00, 0x10, 0x90, 0x3E, 0x17, 0x3E, 0x15, 0x0A, 0x20, 0x15, 0x14, 0x10, 
+    0x30, 0xA1, 0x00, 0x40, 0x5C, 0x3E, 0x17, 0xAA, 0x1D, 0x00, 0x63, 0x20, 0x00, 0x8E, 0x5A, 
+    0x2F, 0x10, 0x1C, 0x00, 0x28, 0x40, 0x17, 0x17, 0x63, 0x0B, 0x00, 0x47, 0x14, 0x00, 0x10, 
+    0x10, 0x4B, 0x20, 0x17, 0x15, 0x18, 0x03, 0x40, 0x5A, 0x00, 0x63, 0x5A, 0xAA, 0x18, 0xAA, 
+    0x1B, 0x17, 0x4C, 0x18, 0x17, 0xAA, 0x5C, 0x04, 0x00, 0x01, 0x00, 0x18, 0xAA, 0x5C, 0x60, 
+    0x1B, 0xAA, 0x19, 0x17, 0x4C, 0x0E, 0x00, 0x02, 0x00, 0x8B, 0x00, 0x8B, 0x18, 0x18, 0x4C, 
+    0x18, 0x4C, 0x17, 0x8B, 0x08, 0x8B, 0x8B, 0x4D, 0x03, 0x00, 0xAA, 0x89, 0x8A, 0x17, 0x09, 
+    0xD0, 0x04, 0x8A, 0x8A, 0x06, 0x00, 0x1C, 0x17, 0x19, 0x8B, 0x00, 0x18, 0x8B, 0x17, 0x8B, 
+    0x1C, 0x17, 0x1C, 0xA9, 0x00, 0xAA, 0x89, 0x49, 0x17, 0xA9, 0x4C, 0x4C, 0xAA, 0x25, 0x00, 
+    0x20, 0x4A, 0x07, 0x10, 0x4A, 0xAA, 0x0D, 0x20, 0x4C, 0x8B, 0x41, 0x13, 0x30, 0xAA, 0xA9, 
+    0xAA, 0x17, 0xEE, 0x06, 0x00, 0x8B, 0x00, 0x19, 0x8C, 0x8C, 0x8C, 0x8E, 0x03, 0x26, 0x4D, 
+    0xA0, 0x03, 0x89, 0x4F, 0x04, 0xAA, 0x07, 0x10, 0x03, 0xFF, 0x22, 0xCF, 0xFB, 0x20, 0x52, 
+    0x11, 0xF5, 0x04, 0x6D, 0x09, 0x17, 0xAA, 0x15, 0x09, 0x00, 0x70, 0xFE, 0x1D, 0x0C, 0x00, 
+    0x03, 0x10, 0x2A, 0x05, 0x03, 0x10, 0x09, 0x50, 0x0A, 0x20, 0x08, 0x40, 0xEB, 0x09, 0x30, 
+    0x15, 0x90, 0xF6, 0x0C, 0x10, 0xCE, 0x66, 0x09, 0x6B, 0x18, 0x20, 0x50, 0xFF, 0x03, 0x20, 
+    0x10, 0x00, 0x14, 0x30, 0x00, 0x30, 0x8C, 0x19, 0x0C, 0x30, 0x11, 0x30, 0x05, 0x30, 0x5E, 
+    0x4F, 0x23, 0x50, 0x14, 0x50, 0x48, 0x20, 0x00, 0xD0, 0xEE, 0x26, 0x00, 0x4D, 0xFC, 0xEE, 
+    0xAC, 0x2E, 0x20, 0x00, 0x90, 0x6D, 0x10, 0x04, 0x60, 0x97, 0x60, 0x00, 0x40, 0x00, 0x8B, 
+    0x58, 0x26, 0x4D, 0x29, 0x03, 0x8B, 0x03, 0xE0, 0x89, 0x8A, 0x26, 0xAC, 0x59, 0xFF, 0x26, 
+    0x56, 0x27, 0x03, 0x13, 0x41, 0xEA, 0x22, 0x9C, 0x63, 0x18, 0xEE, 0x8E, 0x00, 0x10, 0x4F, 
+    0xFB, 0x01, 0x40, 0x00, 0x40, 0x1F, 0x08, 0x50, 0x12, 0x20, 0x18, 0x30, 0x03, 0x00, 0x08, 
+    0x20, 0xFA, 0xCE, 0x16, 0x10, 0xF6, 0x03, 0x40, 0x00, 0x50, 0x0B, 0x90, 0x45, 0x20, 0x10, 
+    0x10, 0xFB, 0x4E, 0x60, 0x00, 0x70, 0x1F, 0x14, 0x30, 0x4F, 0x40, 0x00, 0xF0, 0x3F, 0xAD, 
+    0x90, 0x01, 0x10, 0x00, 0x9D, 0x58, 0x28, 0xAC, 0x28, 0x59, 0x4D, 0x04, 0xC0, 0x17, 0x8A, 
+    0x9B, 0x4C, 0x59, 0x29, 0x3C, 0x01, 0xFF, 0x13, 0x27, 0xA7, 0x1D, 0x4D, 0x04, 0xFD, 0x2A, 
+    0x63, 0x4D, 0xAA, 0x10, 0x2E, 0xAC, 0x02, 0x1D, 0xB0, 0x10, 0xAC, 0x8E, 0x01, 0xF6, 0x8E, 
+    0xAC, 0x80, 0x01, 0x01, 0xF6, 0x1D, 0xF6, 0xF6, 0x4F, 0x15, 0x00, 0xFF, 0xB8, 0xB0, 0x00, 
+    0xF0, 0x32, 0x45, 0x20, 0xF8, 0x30, 0x07, 0x61, 0x0D, 0x70, 0x41, 0xB1, 0x00, 0xF0, 0x32, 
+    0x00, 0x9D, 0x04, 0x28, 0x4D, 0x28, 0x03, 0xAC, 0x04, 0xF0, 0x89, 0x02, 0x26, 0x8B, 0xFF, 
+    0x13, 0xFF, 0x27, 0x44, 0x14, 0x66, 0x2D, 0x8D, 0x03, 0x02, 0x18, 0xBA, 0xB1, 0x00, 0xF0, 
+    0xBE, 0x2B, 0x57, 0x04, 0xFC, 0x07, 0xF1, 0xFF, 0x00, 0x8A, 0x04, 0x4C, 0xFF, 0x12, 0xFF, 
+    0x27, 0x65, 0x5E, 0x07, 0x14, 0x02, 0x5C, 0xFE, 0xF0, 0xCB, 0x8E, 0x2B, 0x26, 0x28, 0xEE, 
+    0x29, 0x00, 0x03, 0x4C, 0x28, 0x89, 0x02, 0x04, 0x4C, 0x03, 0x1E, 0x29, 0xFF, 0x23, 0xFD, 
+    0x30, 0x51, 0x29, 0x01, 0x04, 0x17, 0x8E, 0xF6, 0x02, 0xAC, 0xFF, 0xF0, 0xC9, 0x9C, 0x28, 
+    0x26, 0x4F, 0x28, 0x59, 0x80, 0xAC, 0x28, 0xAA, 0x8A, 0x04, 0x8B, 0x59, 0xFF, 0x45, 0x2B, 
+    0xF8, 0x2E, 0x06, 0x03, 0x14, 0x01, 0x16, 0x18, 0xFF, 0xF1, 0xCC, 0x03, 0x26, 0xB0, 0x57, 
+    0xAC, 0x04, 0x28, 0xFF, 0x12, 0xFF, 0x1C, 0x4C, 0xFF, 0x07, 0x8D, 0xF4, 0x2A, 0xCA, 0xBE, 
+    0x28, 0x4B, 0x1D, 0xAA, 0x8E, 0x1D, 0xFF, 0xF0, 0xCA, 0x00, 0x9C, 0x59, 0x28, 0xAC, 0x26, 
+    0x28, 0x4D, 0x26, 0x40, 0x89, 0x03, 0x25, 0x5C, 0x28, 0x04, 0x0C, 0x0E, 0x8E, 0xCD, 0x60, 
+    0x1A, 0x58, 0xF7, 0x1C, 0xFD, 0x1A, 0x59, 0x14, 0xFF, 0x04, 0xFF, 0xF0, 0xCB, 0x02, 0x28, 
+    0xFC, 0x01, 0x29, 0xAC, 0x26, 0x59, 0x2B, 0x26, 0x1E, 0x8B, 0x0A, 0x00, 0xFF, 0x63, 0x04, 
+    0x27, 0x09, 0x19, 0x5C, 0x8E, 0x2E, 0x42, 0x00, 0xFF, 0xF4, 0xCA, 0x25, 0x26, 0x4C, 0x25, 
+    0x02, 0x02, 0x03, 0xC0, 0x03, 0x26, 0x17, 0x03, 0x04, 0x4F, 0xFF, 0x20, 0x01, 0x00, 0x1F, 
+    0x00, 0x08, 0xF9, 0x1A, 0x01, 0x01, 0xFF, 0x04, 0xFF, 0xF3, 0xCB, 0x23, 0x25, 0x8B, 0xA3, 
+    0xFF, 0x10, 0xFF, 0x02, 0x8C, 0x28, 0x04, 0xFF, 0x41, 0x59, 0xFC, 0x04, 0x87, 0x05, 0x2F, 
+    0x01, 0x03, 0xFF, 0xF6, 0xCD, 0x03, 0x24, 0x04, 0x5C, 0xFF, 0x21, 0xB0, 0x17, 0x25, 0x1C, 
+    0x04, 0xFF, 0x31, 0xF9, 0x1F, 0xCA, 0x57, 0x2D, 0x03, 0x08, 0x13, 0xFF, 0xF1, 0xCD, 0x29, 
+    0x25, 0x04, 0x4D, 0x04, 0x04, 0xF1, 0xFF, 0x00, 0x2B, 0x26, 0x17, 0xFF, 0x53, 0x82, 0x2F, 
+    0x47, 0x1E, 0x56, 0x0F, 0x6D, 0xFF, 0xF1, 0xCF, 0x99, 0xFC, 0x00, 0xFF, 0x33, 0x18, 0xFF, 
+    0x02, 0xFF, 0x0A, 0x9D, 0x39, 0x6A, 0x0F, 0x15, 0x9B, 0x03, 0x24, 0x05, 0x19, 0xFF, 0xF1, 
+    0xCD, 0x28, 0x25, 0x21, 0xFC, 0x11, 0xAC, 0x04, 0x03, 0x5A, 0xFF, 0x16, 0xAC, 0x8C, 0x73, 
+    0xFF, 0x00, 0xFE, 0x01, 0x9C, 0x59, 0x04, 0x25, 0x05, 0x08, 0xFF, 0xF1, 0xCE, 0x9B, 0x48, 
+    0x25, 0x26, 0x4F, 0xFF, 0x21, 0x2B, 0x25, 0xFF, 0x46, 0x18, 0x51, 0xFF, 0x11, 0x9C, 0x58, 
+    0x58, 0x06, 0x28, 0x9C, 0xFF, 0x00, 0x1D, 0x4B, 0xFF, 0xF6, 0xCA, 0xFF, 0x11, 0x28, 0xFF, 
+    0x27, 0x25, 0x19, 0xFF, 0x35, 0x9D, 0x6E, 0x15, 0x01, 0x17, 0xFA, 0x10, 0x01, 0x11, 0x9C, 
+    0xFF, 0xF2, 0xD2, 0xFF, 0x01, 0x15, 0xE0, 0x02, 0x04, 0x8B, 0x58, 0x28, 0xFF, 0x23, 0xFD, 
+    0x11, 0xFE, 0x1B, 0xCB, 0x07, 0x00, 0x06, 0x03, 0x19, 0xFF, 0xF5, 0xCE, 0x28, 0x3F, 0xFF, 
+    0x20, 0xFF, 0x04, 0x80, 0x59, 0x28, 0x4F, 0x8B, 0x8E, 0x8E, 0x19, 0xF9, 0x02, 0x07, 0x00, 
+    0x1D, 0x05, 0x08, 0x01, 0x00, 0x59, 0x1B, 0x8E, 0xF6, 0x1F, 0x89, 0xFF, 0xFA, 0xCB, 0x25, 
+    0x4F, 0xFF, 0x04, 0x26, 0x89, 0x02, 0xFF, 0x1A, 0xB8, 0x4F, 0x8C, 0x8E, 0xFF, 0x42, 0xFC, 
+    0x19, 0x00, 0x21, 0x1A, 0xFF, 0xF6, 0xCD, 0x81, 0xF4, 0x02, 0x26, 0x03, 0x4C, 0x99, 0x89, 
+    0x9D, 0xFF, 0x05, 0xAF, 0xFF, 0x04, 0xFF, 0x00, 0xFF, 0x04, 0x00, 0x2A, 0x14, 0xFF, 0x21, 
+    0x1A, 0xFF, 0xFD, 0xCC, 0x08, 0x28, 0x99, 0x25, 0xFF, 0x0F, 0x4F, 0x25, 0x15, 0x2B, 0xF3, 
+    0xFF, 0x10, 0xFE, 0x03, 0x4F, 0x9D, 0xF5, 0x00, 0x01, 0x01, 0xFD, 0x19, 0x08, 0x11, 0x0C, 
+    0xAA, 0x1F, 0xFF, 0xF6, 0xCD, 0xFC, 0x1F, 0x8C, 0x26, 0x5A, 0x02, 0xE0, 0x26, 0x19, 0x59, 
+    0x28, 0x8C, 0xFF, 0x11, 0xFD, 0x19, 0xFE, 0x00, 0xCF, 0x00, 0x0B, 0x00, 0x13, 0xFF, 0x03, 
+    0xFF, 0xFA, 0xCD, 0x02, 0x04, 0xFF, 0x0F, 0xFF, 0x01, 0xE2, 0x1C, 0xFF, 0x22, 0x4F, 0x17, 
+    0x03, 0xF6, 0x11, 0xFE, 0x1A, 0x00, 0x03, 0x82, 0x15, 0xFF, 0xF6, 0xCE, 0x9C, 0x04, 0x26, 
+    0x4C, 0x28, 0xFF, 0x04, 0xC0, 0x15, 0x02, 0x25, 0x1A, 0x04, 0x28, 0xFF, 0x1C, 0xFF, 0x34, 
+    0x1B, 0x04, 0x1D, 0x09, 0x2C, 0x4C, 0xFD, 0xF0, 0xCA, 0xFF, 0x14, 0x26, 0x4D, 0x28, 0x00, 
+    0x89, 0xAC, 0x04, 0x8A, 0x9C, 0x26, 0x8B, 0x58, 0xE2, 0x03, 0xFF, 0x08, 0x4F, 0x9D, 0x5A, 
+    0xF8, 0x28, 0xFE, 0x11, 0x00, 0x03, 0x24, 0x15, 0x5C, 0xFF, 0xF0, 0xCD, 0x28, 0x28, 0xFF, 
+    0x00, 0x8C, 0x04, 0x00, 0x17, 0x9D, 0x26, 0x4C, 0x03, 0x8A, 0xAC, 0x4D, 0x67, 0xFF, 0x21, 
+    0xFF, 0x23, 0x03, 0x11, 0x59, 0x59, 0xFF, 0x00, 0xFE, 0xF7, 0xCA, 0x8E, 0x00, 0x9C, 0x57, 
+    0x29, 0xAC, 0x29, 0x9C, 0x4D, 0x26, 0x80, 0x17, 0x18, 0x28, 0x4C, 0x18, 0x8A, 0x4F, 0xFF, 
+    0x1C, 0xCD, 0xFD, 0x00, 0x15, 0xF8, 0x0F, 0xFC, 0x16, 0x9B, 0x9C, 0xFF, 0x04, 0xFF, 0xF1, 
+    0xCC, 0x00, 0x04, 0x28, 0xAC, 0x28, 0x03, 0x4D, 0x28, 0x8A, 0xD1, 0xFF, 0x00, 0x03, 0x8A, 
+    0x1D, 0xFF, 0x01, 0x19, 0xFF, 0x1D, 0xFF, 0x0F, 0x0D, 0x01, 0x00, 0x13, 0x04, 0x01, 0xFF, 
+    0xF0, 0xCD, 0x9C, 0x28, 0x59, 0x4D, 0x00, 0x03, 0x89, 0xAC, 0x28, 0x8A, 0x2B, 0x26, 0x5C, 
+    0xC8, 0x59, 0x03, 0x4D, 0xFF, 0x14, 0x63, 0x03, 0xFA, 0x24, 0xFC, 0x14, 0x08, 0x59, 0x9B, 
+    0x15, 0xFF, 0xF4, 0xCF, 0x28, 0xAC, 0x03, 0x89, 0x81, 0x02, 0x0B, 0x2B, 0x26, 0x8B, 0x03, 
+    0x28, 0x4D, 0xFF, 0x1C, 0x0F, 0xFE, 0x1E, 0xFB, 0x3B, 0x03, 0x1E, 0xFF, 0xF3, 0xCD, 0x03, 
+    0x04, 0x03, 0xAC, 0xC0, 0x03, 0x9C, 0xAC, 0x26, 0x17, 0x2B, 0x07, 0x07, 0xFF, 0x56, 0x33, 
+    0xFE, 0x30, 0x01, 0x00, 0x14, 0x9B, 0xFF, 0x0F, 0xFF, 0xF1, 0xCC, 0x57, 0x03, 0xA8, 0xAC, 
+    0x29, 0x89, 0x02, 0x06, 0x9D, 0xFF, 0x11, 0xF6, 0xFF, 0x15, 0xD8, 0x9C, 0x15, 0x03, 0xFF, 
+    0x04, 0x03, 0x02, 0xCA, 0x07, 0x16, 0xFF, 0xF0, 0xCD, 0x00, 0x9B, 0x28, 0x04, 0x4D, 0x59, 
+    0x03, 0xAC, 0x59, 0x00, 0x89, 0x02, 0x04, 0x19, 0x28, 0x59, 0xAC, 0xAC, 0xF2, 0x00, 0xFF, 
+    0x01, 0x03, 0x5A, 0xFA, 0x01, 0x03, 0x52, 0xFF, 0xF2, 0xCE, 0xFF, 0x07, 0x00, 0x29, 0x03, 
+    0x4D, 0x04, 0x8A, 0x5A, 0x26, 0x1C, 0x5F, 0x07, 0x01, 0xFF, 0x22, 0xFE, 0x23, 0x05, 0x5A, 
+    0xFF, 0xF1, 0xCD, 0x9C, 0xFF, 0x30, 0x28, 0xF0, 0x8A, 0x17, 0x28, 0x19, 0xFF, 0x14, 0xFF, 
+    0x2C, 0x00, 0x05, 0xFA, 0x02, 0x05, 0x02, 0x35, 0x9D, 0xFF, 0xF3, 0xCE, 0x28, 0x4D, 0x03, 
+    0x59, 0xAC, 0xF0, 0x26, 0x1C, 0x5A, 0x26, 0x07, 0x08, 0xFF, 0x31, 0xFE, 0x64, 0x01, 0x20, 
+    0x02, 0x4F, 0xFF, 0xF2, 0xCF, 0x03, 0x03, 0x4D, 0x26, 0x8A, 0x8A, 0x1C, 0x26, 0x8C, 0xFF, 
+    0x41, 0xFE, 0x75, 0x00, 0x17, 0xC9, 0x9B, 0x1D, 0xF9, 0xFF, 0xF2, 0xCB, 0x26, 0x9B, 0xFF, 
+    0x33, 0xFF, 0x1F, 0xFF, 0x31, 0xFA, 0x43, 0xFF, 0x42, 0xA0, 0x9A, 0xC8, 0x56, 0x58, 0x8C, 
+    0x17, 0x1B, 0xF6, 0x01, 0x20, 0x01, 0x0C, 0x01, 0xF6, 0x8E, 0x8C, 0x1F, 0x1D, 0x8E, 0x1D, 
+    0xA1, 0x03, 0x10, 0x4F, 0x1D, 0x4F, 0x1F, 0x08, 0x20, 0x1F, 0x18, 0x00, 0x38, 0xF6, 0x8E, 
+    0x4F, 0x23, 0x30, 0x01, 0x10, 0x22, 0x00, 0x1F, 0xF6, 0xD2, 0x4F, 0x37, 0x00, 0x8C, 0x1F, 
+    0x0C, 0x30, 0x4F, 0x23, 0x00, 0x37, 0x10, 0xE2, 0xF6, 0x24, 0x10, 0xF6, 0x1F, 0xAC, 0x25, 
+    0x10, 0x21, 0x00, 0x30, 0x60, 0x1D, 0x01, 0x20, 0x1F, 0x13, 0x10, 0x4D, 0x10, 0x00, 0x20, 
+    0xF6, 0x8E, 0x01, 0x87, 0x10, 0x00, 0x07, 0x10, 0x00, 0x00, 0x1F, 0x8C, 0x00, 0x4F, 0x04, 
+    0x00, 0xF5, 0x68, 0x00, 0x1F, 0x67, 0x20, 0x1F, 0x1A, 0x10, 0x28, 0x00, 0x1F, 0x20, 0x24, 
+    0x40, 0x73, 0x3B, 0x00, 0x36, 0x10, 0x1F, 0x4F, 0x79, 0x00, 0xCA, 0x07, 0x7D, 0x00, 0x4F, 
+    0xF3, 0xA1, 0x00, 0x07, 0x30, 0x1F, 0x4F, 0x40, 0x00, 0xCB, 0x02, 0x1D, 0x00, 0x36, 0x00, 
+    0x2D, 0x41, 0x00, 0x1F, 0x01, 0x20, 0xFF, 0x21, 0x15, 0xFF, 0x29, 0x8C, 0x03, 0x3E, 0x59, 
+    0xFF, 0x27, 0xFD, 0x13, 0xFD, 0x0F, 0x02, 0x0D, 0x02, 0x1E, 0x14, 0x9A, 0x00, 0xC8, 0xC7, 
+    0xC6, 0xC7, 0xC7, 0xC6, 0xC6, 0xD6, 0x00, 0xC6, 0xC5, 0xD6, 0xC4, 0xC4, 0xC4, 0xD6, 0xC4, 
+    0xE2, 0xD6, 0x0F, 0x20, 0xC7, 0xC6, 0x10, 0x04, 0x10, 0x0A, 0x00, 0x04, 0x00, 0x82, 0xC6, 
+    0x19, 0x00, 0xC3, 0xC3, 0xC4, 0xC7, 0xC5, 0x1F, 0x10, 0x35, 0x22, 0x10, 0xC4, 0x2D, 0x10, 
+    0xC5, 0x28, 0x20, 0x0F, 0x00, 0xC5, 0xD6, 0xA3, 0x08, 0x10, 0x1C, 0x10, 0xC6, 0xC5, 0xC6, 
+    0x0D, 0x00, 0xC5, 0x30, 0x00, 0x83, 0x05, 0x00, 0x4F, 0x20, 0xC4, 0xC4, 0xC5, 0xC4, 0xD5, 
+    0x04, 0x00, 0x75, 0x00, 0x00, 0xD6, 0x0A, 0x00, 0xC5, 0x2D, 0x00, 0x28, 0x00, 0x00, 0x40, 
+    0xD5, 0xE9, 0x16, 0x10, 0xC5, 0xC5, 0x1F, 0x00, 0xD5, 0x67, 0x00, 0x00, 0xB0, 0x75, 0x00, 
+    0x38, 0xC6, 0xC8, 0xC8, 0x0D, 0x60, 0x8A, 0x10, 0x56, 0x00, 0xD6, 0xC7, 0x00, 0xC7, 0xC8, 
+    0x13, 0x9A, 0x14, 0xC8, 0x56, 0xC9, 0x01, 0x01, 0x00, 0xC8, 0x13, 0x99, 0xC8, 0x9A, 0xC8, 
+    0x99, 0x40, 0xC8, 0x56, 0xC8, 0x99, 0xC7, 0x56, 0x05, 0x00, 0xC7, 0xD0, 0x98, 0xC7, 0xC7, 
+    0x98, 0x0B, 0x00, 0x99, 0x13, 0x00, 0x10, 0x00, 0x00, 0x99, 0x9A, 0x9A, 0x13, 0x56, 0x58, 
+    0x59, 0x8B, 0x00, 0x29, 0x59, 0x4F, 0x26, 0x8B, 0x9D, 0x57, 0x1C, 0x6E, 0x03, 0xFF, 0x43, 
+    0xF5, 0x02, 0xFF, 0x2C, 0x57, 0x00, 0x1F, 0x03, 0x02, 0x59, 0x80, 0xCA, 0x9A, 0xC9, 0xC8, 
+    0xC8, 0xC8, 0x10, 0x03, 0x00, 0x84, 0xC8, 0xD6, 0x03, 0x00, 0x11, 0xC8, 0x3D, 0xC9, 0x02, 
+    0x10, 0x44, 0xC8, 0x13, 0x05, 0x10, 0x11, 0xC8, 0xC9, 0x1D, 0x10, 0xC8, 0x0E, 0xD6, 0x1A, 
+    0x10, 0x00, 0x60, 0x2C, 0x10, 0x10, 0x9A, 0x9A, 0x9A, 0x04, 0x3D, 0x99, 0x00, 0x30, 0x10, 
+    0x9A, 0x10, 0x9A, 0x56, 0x20, 0x9A, 0x56, 0x56, 0x9A, 0x57, 0x01, 0x10, 0x57, 0x56, 0xAE, 
+    0x57, 0x0D, 0x00, 0x03, 0x00, 0x1A, 0x10, 0xC8, 0x17, 0x00, 0x9A, 0x8B, 0x00, 0x3B, 0x1F, 
+    0x10, 0x05, 0x00, 0x57, 0x03, 0x00, 0xB6, 0x00, 0xA3, 0x00, 0x9A, 0x99, 0x06, 0x99, 0x18, 
+    0x50, 0x05, 0x00, 0x58, 0x58, 0x58, 0x57, 0x57, 0x98, 0x58, 0x59, 0x58, 0x03, 0x00, 0x00, 
+    0x10, 0x58, 0x58, 0x12, 0x20, 0x74, 0x56, 0xC9, 0x00, 0x40, 0xC8, 0x4A, 0x10, 0x2B, 0x00, 
+    0x15, 0x00, 0x9B, 0xC6, 0x58, 0xB9, 0x12, 0x02, 0x20, 0x15, 0x9C, 0x63, 0x24, 0x00, 0x10, 
+    0x00, 0x05, 0xCD, 0x2B, 0x59, 0x09, 0x00, 0x58, 0x59, 0xCA, 0x14, 0xCA, 0x00, 0x15, 0x15, 
+    0x9D, 0x5A, 0x9D, 0x19, 0x17, 0x4C, 0x00, 0x5C, 0x19, 0x5C, 0x5C, 0x59, 0x8C, 0x28, 0x9B, 
+    0xC0, 0x01, 0x26, 0x8A, 0x02, 0x04, 0x4B, 0x07, 0x05, 0xFF, 0x28, 0x3F, 0xF9, 0x23, 0xFD, 
+    0x11, 0x05, 0x01, 0x01, 0x02, 0x05, 0x0F, 0x0E, 0x1F, 0x14, 0x9B, 0x50, 0x14, 0x14, 0x9A, 
+    0x14, 0x05, 0x00, 0x15, 0x1E, 0x1E, 0x63, 0x1D, 0x4D, 0x00, 0x15, 0x1F, 0x1A, 0x05, 0x10, 
+    0x20, 0x10, 0xC9, 0x57, 0xC9, 0x4C, 0x13, 0x14, 0x00, 0x00, 0x04, 0x00, 0x13, 0x14, 0x81, 
+    0x01, 0x9B, 0x00, 0x14, 0x13, 0x9B, 0x9A, 0x58, 0x9C, 0x14, 0x9A, 0x08, 0x58, 0x13, 0x57, 
+    0x38, 0x00, 0x9A, 0x59, 0x9A, 0x14, 0x2A, 0x9A, 0x53, 0x00, 0x57, 0x53, 0x00, 0x57, 0x5D, 
+    0x12, 0x59, 0x9B, 0x00, 0x58, 0x57, 0x59, 0x9A, 0x9A, 0x9B, 0x9A, 0x14, 0x36, 0x28, 0x04, 
+    0x00, 0x18, 0x00, 0x13, 0x72, 0x10, 0x6E, 0x02, 0x9B, 0x57, 0xBE, 0x14, 0x0F, 0x00, 0x19, 
+    0x00, 0x15, 0x10, 0x11, 0x30, 0x10, 0x01, 0x99, 0x8A, 0x11, 0xFB, 0x00, 0x00, 0x05, 0x20, 
+    0x03, 0xA2, 0x06, 0xA3, 0x0D, 0x1C, 0x00, 0xAB, 0x20, 0x00, 0x00, 0x36, 0x9C, 0xB4, 0x07, 
+    0xAE, 0x0D, 0x9B, 0xAD, 0x00, 0xE8, 0x00, 0x5A, 0x9D, 0x90, 0x5A, 0x19, 0x9D, 0x17, 0x01, 
+    0x10, 0x02, 0x8A, 0x05, 0x00, 0x06, 0x15, 0x01, 0x00, 0x06, 0x00, 0x18, 0x18, 0x2B, 0x15, 
+    0x9C, 0x40, 0x2B, 0x9D, 0x18, 0x2B, 0x18, 0x9D, 0xF6, 0x00, 0x4C, 0x00, 0x5C, 0x1B, 0x4C, 
+    0x19, 0x19, 0x1B, 0x19, 0x4C, 0x00, 0x28, 0x02, 0x29, 0x9C, 0xAC, 0x28, 0x17, 0x18, 0xFC, 
+    0x03, 0x8B, 0x07, 0x05, 0xFF, 0x23, 0xFD, 0x50, 0x00, 0x10, 0x02, 0x14, 0x03, 0x11, 0x65, 
+    0x0F, 0x10, 0x9A, 0xC2, 0x00, 0x9A, 0xCA, 0x17, 0x14, 0x1F, 0x86, 0x14, 0xFF, 0x28, 0x44, 
+    0xCF, 0x00, 0xB3, 0x00, 0xAC, 0x20, 0xB8, 0x20, 0xED, 0x10, 0x3F, 0x1A, 0x0C, 0x30, 0xDE, 
+    0x9B, 0xAC, 0x00, 0xE4, 0x10, 0x55, 0x10, 0xFE, 0x00, 0x14, 0x17, 0x00, 0x05, 0x11, 0xE7, 
+    0xAE, 0x11, 0xEC, 0x10, 0x6F, 0x40, 0x57, 0xCA, 0x26, 0x00, 0x17, 0x10, 0x03, 0x80, 0xBB, 
+    0x86, 0x10, 0x24, 0x10, 0x9A, 0x90, 0x2F, 0x79, 0x20, 0xA0, 0x27, 0x59, 0xFF, 0x00, 0x3E, 
+    0x9C, 0xA0, 0x1C, 0x11, 0x21, 0x04, 0x00, 0x0E, 0x11, 0x11, 0x21, 0x15, 0x02, 0x01, 0xF0, 
+    0x10, 0x5A, 0x5C, 0x5A, 0x18, 0x18, 0x8A, 0x18, 0x41, 0x06, 0x00, 0x5C, 0x9C, 0x5A, 0x02, 
+    0x5A, 0x08, 0x00, 0x18, 0x80, 0x18, 0x9D, 0x9C, 0x5A, 0x9C, 0x17, 0x18, 0x0C, 0x00, 0x24, 
+    0x9D, 0x5C, 0x00, 0x11, 0x5C, 0x1B, 0xFF, 0x00, 0x19, 0x28, 0xA3, 0xF7, 0x08, 0xFF, 0x04, 
+    0x8B, 0x03, 0x4C, 0x07, 0x0D, 0xAC, 0xFF, 0x15, 0xFF, 0xF9, 0x23, 0x92, 0x40, 0x05, 0x31, 
+    0x89, 0x10, 0xA6, 0x20, 0x85, 0x10, 0x58, 0x22, 0xF3, 0x20, 0xF1, 0x09, 0x21, 0x59, 0xCA, 
+    0x03, 0xE7, 0x00, 0xFE, 0x00, 0xAD, 0x51, 0x08, 0x01, 0xFF, 0xB9, 0x20, 0xEA, 0x01, 0x97, 
+    0x01, 0xEE, 0x01, 0x26, 0x02, 0x31, 0x31, 0x4C, 0x00, 0xC7, 0x10, 0xFF, 0x0E, 0x00, 0x5D, 
+    0x14, 0x07, 0x00, 0x13, 0x12, 0x55, 0x20, 0x07, 0x30, 0x73, 0x24, 0x6E, 0x21, 0x3F, 0x0F, 
+    0x00, 0x81, 0x30, 0x3A, 0x02, 0x00, 0x11, 0x1D, 0x30, 0x93, 0x3E, 0x2B, 0x9C, 0xF2, 0x59, 
+    0xA1, 0x0A, 0x5A, 0x9C, 0x26, 0x00, 0x02, 0x21, 0x03, 0x31, 0x3A, 0x20, 0x36, 0xCA, 0x0F, 
+    0x10, 0xFD, 0x00, 0x2B, 0x01, 0x02, 0xF1, 0x01, 0x5C, 0x5A, 0x54, 0x02, 0x18, 0x07, 0x00, 
+    0x5C, 0x0A, 0x00, 0x5A, 0xFE, 0x01, 0x02, 0x26, 0x59, 0x08, 0x12, 0x0A, 0x02, 0x02, 0x17, 
+    0xFE, 0x11, 0x1A, 0x1A, 0x00, 0x17, 0x5C, 0x17, 0x1B, 0x19, 0x28, 0x8C, 0x28, 0x40, 0x9C, 
+    0x4D, 0x04, 0x8B, 0x9D, 0x89, 0xFF, 0x03, 0x4D, 0x7F, 0xFF, 0x12, 0xF6, 0x1E, 0xF2, 0x30, 
+    0x06, 0x61, 0xB7, 0x11, 0xA4, 0x40, 0x6C, 0x10, 0x5A, 0x00, 0x2E, 0x2E, 0x9D, 0x17, 0x19, 
+    0x1B, 0x1B, 0x9D, 0x20, 0x17, 0x1B, 0x5A, 0x9C, 0x19, 0x10, 0x00, 0x1A, 0x17, 0x00, 0x19, 
+    0x9D, 0x9C, 0x3E, 0x9C, 0x18, 0x9D, 0x9D, 0x16, 0x9C, 0x02, 0x20, 0x00, 0x00, 0x59, 0x7E, 
+    0x01, 0x9D, 0x9D, 0x14, 0xE9, 0x0C, 0x20, 0x18, 0x9C, 0x26, 0x02, 0x9B, 0x19, 0x00, 0x4F, 
+    0x19, 0x0D, 0x00, 0x84, 0x5A, 0x18, 0x9E, 0x02, 0x17, 0x56, 0x9A, 0x14, 0xB6, 0x00, 0x91, 
+    0x93, 0x02, 0x17, 0x17, 0x59, 0x26, 0x10, 0x57, 0x9C, 0x05, 0x00, 0xFB, 0xC9, 0x00, 0x31, 
+    0x10, 0x9A, 0x44, 0x30, 0x08, 0x00, 0x3E, 0x32, 0x0E, 0x11, 0x09, 0x00, 0xFF, 0xFB, 0x21, 
+    0xEC, 0x22, 0xFE, 0x00, 0xA5, 0x00, 0x9C, 0x13, 0x00, 0x22, 0xB1, 0x10, 0xFA, 0x00, 0xD9, 
+    0x0F, 0x12, 0x9C, 0x18, 0xEE, 0x01, 0xF3, 0x22, 0x5A, 0xF8, 0x10, 0xFF, 0x01, 0x27, 0xFC, 
+    0x00, 0x01, 0x00, 0x0A, 0x01, 0x2B, 0x15, 0xFB, 0x02, 0x5A, 0x1B, 0x8B, 0x11, 0x00, 0xFF, 
+    0x32, 0x18, 0x02, 0x02, 0x1A, 0x9B, 0x8C, 0xFF, 0x01, 0xE0, 0x29, 0x8A, 0x18, 0x29, 0x8B, 
+    0xFF, 0x03, 0xFF, 0x3E, 0xFD, 0x62, 0x1F, 0x06, 0x31, 0x06, 0x22, 0x82, 0x22, 0xB9, 0x01, 
+    0xA0, 0x10, 0x2E, 0x2E, 0x8E, 0x00, 0xCE, 0x19, 0x17, 0x1F, 0x01, 0x01, 0x01, 0xF5, 0x00, 
+    0x18, 0x8C, 0x01, 0x8E, 0xF5, 0x19, 0x17, 0x1C, 0x00, 0x01, 0x01, 0x4F, 0x9D, 0x5A, 0x1D, 
+    0x1D, 0x19, 0x00, 0x9C, 0x1D, 0x1D, 0x9D, 0x1D, 0xCE, 0x8E, 0x8E, 0x02, 0x2E, 0x46, 0x00, 
+    0x1F, 0xF6, 0x2E, 0x18, 0x1B, 0x1D, 0x00, 0x1D, 0x01, 0xF6, 0x1A, 0xF5, 0x4F, 0x8C, 0x9B, 
+    0x00, 0x1D, 0x8C, 0x1C, 0x9B, 0x59, 0x19, 0x9D, 0x8C, 0x02, 0x01, 0x3B, 0x01, 0x2E, 0x8C, 
+    0x1D, 0x01, 0x02, 0x9C, 0x80, 0x9B, 0x15, 0x9A, 0x8C, 0x02, 0x9A, 0x01, 0x40, 0x00, 0x00, 
+    0x9D, 0x18, 0x02, 0x01, 0x01, 0x9D, 0x14, 0x1D, 0x00, 0x01, 0x1D, 0xF6, 0xF6, 0x2E, 0x01, 
+    0xF5, 0xF6, 0x20, 0xF6, 0x9C, 0x9C, 0x1B, 0x2E, 0x5E, 0x00, 0x01, 0x01, 0x7F, 0x74, 0x20, 
+    0x01, 0x42, 0x7C, 0x32, 0x02, 0x10, 0x34, 0x01, 0xA4, 0x54, 0xA4, 0x33, 0x9C, 0xB6, 0xCA, 
+    0x04, 0x01, 0x08, 0x20, 0x9C, 0xE3, 0x00, 0xF2, 0x13, 0x5A, 0x03, 0x12, 0x1B, 0x01, 0x03, 
+    0x08, 0x14, 0x5C, 0x0F, 0x11, 0xF5, 0x02, 0x9C, 0x2B, 0x17, 0x66, 0x2B, 0xF9, 0x02, 0x0A, 
+    0x00, 0x5C, 0xAC, 0xFE, 0x10, 0xFF, 0x33, 0x8C, 0x02, 0x9A, 0xFF, 0x03, 0xAA, 0x5C, 0x59, 
+    0x1C, 0x03, 0x8A, 0xC3, 0xFF, 0x36, 0xFA, 0x51, 0x57, 0xCA, 0x57, 0x9C, 0xF9, 0x41, 0xA4, 
+    0x53, 0x01, 0xE9, 0x23, 0x9D, 0x1D, 0x2B, 0x9A, 0x03, 0x2B, 0x9D, 0x01, 0x9C, 0x00, 0x24, 
+    0x9A, 0x02, 0x01, 0x2B, 0x04, 0x9D, 0x04, 0x1B, 0x19, 0x05, 0x00, 0x03, 0x01, 0x2B, 0x1D, 
+    0x1D, 0x00, 0x1D, 0x9C, 0x02, 0x1D, 0x59, 0x1D, 0xF5, 0x9C, 0x00, 0x9C, 0x1D, 0x1C, 0x9C, 
+    0x5C, 0x1D, 0x2B, 0x1D, 0x00, 0x5C, 0x59, 0x1D, 0x28, 0x25, 0x9C, 0x02, 0x9A, 0x40, 0x9C, 
+    0x02, 0x2E, 0x01, 0x03, 0x9A, 0x9A, 0x03, 0x01, 0x00, 0x9C, 0x9B, 0x03, 0x01, 0x18, 0xF5, 
+    0x2B, 0x26, 0xA8, 0x04, 0x01, 0x2B, 0x4F, 0x00, 0x02, 0xFF, 0x00, 0x2B, 0xDC, 0x04, 0x00, 
+    0x2E, 0x2B, 0x9A, 0x9B, 0x5A, 0x9B, 0x99, 0x9A, 0x80, 0x01, 0x9D, 0x9A, 0x55, 0x01, 0x01, 
+    0x04, 0x83, 0x05, 0xC4, 0x9D, 0x03, 0x5F, 0x00, 0x9B, 0x9A, 0x26, 0xFD, 0x20, 0x71, 0x05, 
+    0x77, 0xEC, 0x21, 0x1B, 0x03, 0xED, 0x22, 0x17, 0x07, 0x21, 0x11, 0x00, 0x13, 0x12, 0x9C, 
+    0x62, 0x19, 0x0E, 0x00, 0x9B, 0x9C, 0x03, 0x0E, 0x21, 0x17, 0x00, 0x5C, 0x3B, 0xFC, 0x23, 
+    0xF3, 0x40, 0x18, 0xFE, 0x00, 0x05, 0x04, 0x0B, 0x20, 0x2B, 0x5A, 0x08, 0x9C, 0x5C, 0x9C, 
+    0x19, 0x10, 0x5C, 0x02, 0x5C, 0x4C, 0x00, 0x1B, 0x15, 0x8C, 0x17, 0x18, 0x1B, 0x1A, 0x4C, 
+    0x80, 0x19, 0x58, 0xF5, 0x9B, 0x9C, 0x4D, 0x03, 0xFF, 0x14, 0x7E, 0x8A, 0xFF, 0x36, 0xED, 
+    0x42, 0x00, 0x80, 0x8B, 0x35, 0x97, 0x23, 0x10, 0x15, 0x9C, 0x00, 0x03, 0x2B, 0x02, 0x59, 
+    0x9B, 0x1C, 0x2B, 0x2B, 0x00, 0xAC, 0xF5, 0x18, 0x2B, 0x9D, 0x9A, 0x54, 0x98, 0x00, 0x26, 
+    0x18, 0x2B, 0x26, 0x9A, 0x28, 0x2B, 0x9D, 0x01, 0x14, 0x01, 0x1D, 0x02, 0x02, 0x9C, 0x1C, 
+    0xF5, 0x9A, 0x00, 0x9A, 0x1C, 0x02, 0x9B, 0x1D, 0x1D, 0x57, 0x1D, 0x20, 0x9D, 0x28, 0x9D, 
+    0x9C, 0x02, 0xF7, 0x02, 0x9A, 0x2B, 0x00, 0x02, 0x2B, 0x9A, 0x5A, 0x59, 0x5A, 0x9D, 0x2B, 
+    0x01, 0x49, 0x00, 0x2B, 0x03, 0x9C, 0x2B, 0xF5, 0x02, 0x03, 0x10, 0x9B, 0x03, 0x9A, 0x9B, 
+    0x15, 0x00, 0x2B, 0x03, 0x2B, 0x8C, 0x2B, 0x18, 0x0B, 0x01, 0x64, 0x10, 0x9A, 0x5C, 0x9C, 
+    0x3A, 0x00, 0x00, 0x9D, 0x9A, 0x2B, 0x9D, 0x1B, 0x02, 0x28, 0x01, 0x00, 0x01, 0x2B, 0x2E, 
+    0x9A, 0x04, 0x04, 0x04, 0x9B, 0xF8, 0x9B, 0x15, 0x18, 0xF3, 0x03, 0xF3, 0x24, 0xF0, 0x22, 
+    0xFB, 0x14, 0x04, 0x10, 0x9F, 0x13, 0x31, 0x3F, 0x03, 0xA7, 0x17, 0x04, 0x00, 0x07, 0x32, 
+    0x5A, 0x9D, 0xEA, 0x11, 0xA7, 0xF0, 0x04, 0xF6, 0x32, 0x08, 0x14, 0x02, 0x17, 0xF9, 0x04, 
+    0x02, 0x91, 0x02, 0x15, 0x11, 0x13, 0x5C, 0x6C, 0x02, 0x19, 0xF8, 0x00, 0x1A, 0x1A, 0x18, 
+    0x41, 0xFD, 0x02, 0x19, 0x5C, 0x03, 0x4C, 0x28, 0xFF, 0x01, 0x1C, 0xF2, 0x8A, 0xFF, 0x14, 
+    0xAC, 0x4D, 0xFF, 0x04, 0x91, 0x44, 0xAF, 0x35, 0x8C, 0x26, 0x03, 0x0C, 0x57, 0x15, 0x28, 
+    0x59, 0x15, 0x9D, 0x9A, 0x9B, 0x03, 0x00, 0x02, 0x1C, 0x89, 0x2B, 0x2B, 0x9A, 0x26, 0x59, 
+    0x00, 0x2B, 0x2B, 0x9C, 0x9C, 0x17, 0x9B, 0x9C, 0x2B, 0x08, 0x59, 0x5A, 0x03, 0x09, 0x00, 
+    0x29, 0x28, 0x02, 0x1D, 0x10, 0x2B, 0x9C, 0x02, 0xF5, 0xD8, 0x01, 0x2B, 0x9C, 0x9D, 0x0A, 
+    0x2B, 0x12, 0x01, 0x9B, 0x0E, 0x00, 0x2B, 0x9A, 0x9C, 0x58, 0x10, 0x28, 0x2B, 0x9A, 0x59, 
+    0xC6, 0x00, 0x9B, 0x2B, 0x28, 0x44, 0x9B, 0x57, 0x0F, 0x00, 0x2B, 0x28, 0x28, 0x0A, 0x11, 
+    0x59, 0x01, 0x03, 0x00, 0x2B, 0x03, 0x04, 0x99, 0x29, 0x2B, 0x03, 0x83, 0xC7, 0x00, 0x76, 
+    0x00, 0x2B, 0x9C, 0x57, 0x04, 0x2B, 0xCA, 0x05, 0x00, 0x2E, 0x8A, 0x02, 0x15, 0x01, 0x02, 
+    0x9A, 0x04, 0xC2, 0x9A, 0xFD, 0x00, 0x9B, 0x58, 0x18, 0x2B, 0xF7, 0x13, 0x02, 0x41, 0xFF, 
+    0xF6, 0x13, 0x03, 0x21, 0x2D, 0x35, 0xEE, 0x15, 0x04, 0x12, 0x1C, 0x77, 0xF0, 0x01, 0xEC, 
+    0x06, 0xFA, 0x02, 0x01, 0x12, 0x5A, 0x00, 0x21, 0xF1, 0x00, 0x14, 0x11, 0x98, 0x04, 0x05, 
+    0x05, 0x42, 0x5C, 0x0B, 0x05, 0x1B, 0x15, 0x1B, 0x8C, 0x02, 0x01, 0x18, 0x09, 0xFF, 0x05, 
+    0x4C, 0x19, 0xFC, 0x00, 0x59, 0x4F, 0x28, 0xAA, 0xEA, 0x5A, 0xFF, 0x01, 0x2B, 0xFF, 0x17, 
+    0x9C, 0x79, 0x47, 0x78, 0x23, 0xB1, 0x15, 0x0F, 0x8D, 0x35, 0x69, 0x12, 0x9F, 0x06, 0x63, 
+    0x10, 0x17, 0x1D, 0x02, 0x57, 0x81, 0xB3, 0x11, 0x2B, 0x59, 0x28, 0x03, 0x9B, 0x2B, 0x56, 
+    0x00, 0x85, 0x0E, 0x00, 0x02, 0xEE, 0x00, 0x9A, 0x03, 0x9B, 0x99, 0xF8, 0x10, 0x8A, 0x2B, 
+    0xFF, 0x00, 0x9D, 0xE3, 0x01, 0x2B, 0xF5, 0x9D, 0x0C, 0x00, 0x8E, 0x57, 0xCD, 0x01, 0x2D, 
+    0x08, 0xFE, 0x01, 0x5A, 0x03, 0x15, 0x0B, 0x00, 0x9A, 0x9D, 0x37, 0x01, 0x9B, 0x02, 0x10, 
+    0xB1, 0x13, 0x2B, 0x03, 0xFF, 0x10, 0x74, 0x28, 0x56, 0x46, 0x01, 0xF5, 0x35, 0x00, 0x0C, 
+    0x00, 0x03, 0x11, 0x59, 0x00, 0x29, 0x2B, 0x2E, 0x03, 0x9C, 0x1B, 0x9D, 0x9B, 0xE8, 0x29, 
+    0x28, 0x28, 0x1D, 0x05, 0x18, 0xCC, 0x04, 0x06, 0x00, 0x05, 0x10, 0xFF, 0x01, 0x10, 0x96, 
+    0x2C, 0x05, 0x30, 0x08, 0x10, 0x0B, 0x28, 0x19, 0x31, 0x23, 0x31, 0xFC, 0x37, 0x7F, 0x03, 
+    0x12, 0xF7, 0x25, 0xFB, 0x12, 0x01, 0x03, 0x13, 0x05, 0x0D, 0x31, 0x0C, 0x02, 0x15, 0x38, 
+    0x02, 0x5C, 0x5C, 0xFC, 0x08, 0xFE, 0x01, 0x02, 0x02, 0x15, 0x8C, 0x40, 0x28, 0x15, 0xAC, 
+    0x03, 0x19, 0x8B, 0xFF, 0x07, 0x89, 0xF6, 0xF6, 0xFF, 0x12, 0xE9, 0x00, 0xCA, 0xF5, 0x20, 
+    0xF7, 0x41, 0x0C, 0x42, 0x14, 0x2A, 0x31, 0x65, 0x20, 0x28, 0x28, 0x5C, 0xC0, 0x03, 0xDF, 
+    0x00, 0x5C, 0x2E, 0x00, 0x9D, 0x9A, 0x29, 0x02, 0x9D, 0x03, 0x9A, 0x99, 0x00, 0x04, 0x2B, 
+    0xF5, 0x9C, 0x99, 0x57, 0x29, 0x9B, 0xE4, 0x99, 0x99, 0xDA, 0x01, 0xF5, 0x02, 0x04, 0x03, 
+    0xDB, 0x11, 0x0D, 0x10, 0x00, 0x2B, 0x29, 0x56, 0x9B, 0x2B, 0x5A, 0x57, 0x03, 0x10, 0x2B, 
+    0x99, 0x57, 0xC9, 0xC7, 0x19, 0x03, 0x5C, 0x02, 0x01, 0x4C, 0x00, 0x03, 0x9D, 0x02, 0x2B, 
+    0x99, 0x04, 0x9C, 0x18, 0x02, 0x03, 0x99, 0x19, 0x03, 0x11, 0x10, 0x2B, 0x02, 0x9D, 0x27, 
+    0xED, 0x01, 0xFB, 0x00, 0x03, 0x00, 0x2B, 0x58, 0x5E, 0x01, 0x28, 0x17, 0x00, 0x01, 0x01, 
+    0x02, 0x8C, 0xF5, 0x14, 0x28, 0x14, 0xC2, 0x17, 0xFB, 0x00, 0x9C, 0x5A, 0x15, 0x2B, 0xD0, 
+    0x18, 0xF7, 0x34, 0xF7, 0xF8, 0x30, 0x08, 0x12, 0xF8, 0x13, 0x59, 0xD4, 0x07, 0xF1, 0x06, 
+    0xDB, 0x17, 0x16, 0x22, 0x67, 0xFA, 0x22, 0xFC, 0x11, 0x02, 0x63, 0x15, 0x9D, 0xF4, 0x00, 
+    0x0A, 0x20, 0x18, 0x87, 0x05, 0x03, 0x04, 0x21, 0xFD, 0x06, 0x19, 0x17, 0x1B, 0x1A, 0x05, 
+    0x01, 0x01, 0xFF, 0x02, 0x59, 0x4F, 0x03, 0x8B, 0x9D, 0x58, 0xAC, 0xF8, 0x8A, 0x03, 0x4D, 
+    0xFF, 0x05, 0xEC, 0x28, 0x01, 0x46, 0xF8, 0x58, 0x0E, 0x11, 0xFB, 0xFE, 0x10, 0xFE, 0x02, 
+    0x15, 0xD1, 0x07, 0x8E, 0x09, 0x8B, 0x05, 0x05, 0x00, 0x06, 0x00, 0x09, 0x0C, 0x00, 0x9A, 
+    0x59, 0xB5, 0x01, 0x99, 0x99, 0x04, 0x28, 0x7C, 0x9A, 0x99, 0x14, 0x00, 0xAC, 0x19, 0x19, 
+    0x20, 0x02, 0x00, 0x0B, 0x10, 0x9A, 0x64, 0x59, 0x25, 0xFD, 0x09, 0x26, 0x99, 0x1B, 0x00, 
+    0x1C, 0x00, 0x99, 0x94, 0x98, 0x98, 0x11, 0x00, 0x26, 0x3B, 0x20, 0x99, 0x99, 0x0B, 0x00, 
+    0x95, 0x05, 0x10, 0x98, 0x31, 0x30, 0x58, 0x45, 0x00, 0x9B, 0x04, 0x5A, 0x10, 0x70, 0x5A, 
+    0x9B, 0x9A, 0x56, 0xD5, 0x02, 0x1D, 0x09, 0x00, 0x08, 0x9C, 0xC6, 0x17, 0xCA, 0x05, 0xB5, 
+    0x10, 0x17, 0x5A, 0x8A, 0x1F, 0x07, 0x9C, 0x20, 0x2F, 0x28, 0x09, 0xF9, 0x57, 0xF5, 0x11, 
+    0xF5, 0x18, 0x2B, 0xF3, 0x26, 0x15, 0x9C, 0xFF, 0xDD, 0x01, 0xFB, 0x28, 0xEE, 0x20, 0xF4, 
+    0x11, 0x07, 0x53, 0x02, 0x11, 0x07, 0x01, 0x44, 0x21, 0x0E, 0x1C, 0xFB, 0x06, 0xFD, 0x16, 
+    0x06, 0x00, 0x58, 0x02, 0x28, 0x5A, 0xD0, 0xAC, 0x04, 0x17, 0x8B, 0xFF, 0x06, 0x8A, 0xFF, 
+    0x14, 0x60, 0x30, 0x3F, 0xFC, 0x21, 0xBE, 0x29, 0x09, 0x32, 0x7B, 0x16, 0x00, 0x05, 0x6E, 
+    0x22, 0x15, 0x9C, 0x02, 0x89, 0x03, 0x00, 0x03, 0x63, 0x03, 0x89, 0x9C, 0x58, 0x76, 0x03, 
+    0x52, 0x0B, 0x13, 0x16, 0x9C, 0x62, 0x0B, 0xED, 0x0A, 0xC3, 0x28, 0x58, 0x19, 0x9A, 0x22, 
+    0x9B, 0x28, 0x00, 0x09, 0x74, 0x1B, 0x9B, 0x9B, 0x13, 0x1F, 0x34, 0x15, 0xD7, 0x1B, 0x11, 
+    0x01, 0x25, 0x1A, 0x24, 0x10, 0x57, 0x9B, 0x56, 0x5D, 0x24, 0x39, 0x56, 0x58, 0x05, 0xFA, 
+    0x00, 0x65, 0x01, 0x15, 0x6F, 0x14, 0x9B, 0x00, 0x9B, 0x5A, 0x19, 0x15, 0x9D, 0x17, 0x15, 
+    0x15, 0x80, 0x15, 0x17, 0x15, 0x89, 0x5A, 0x2B, 0x63, 0xBC, 0x19, 0xF5, 0xFE, 0x20, 0x5A, 
+    0xCD, 0x19, 0x5A, 0x9B, 0x37, 0xF5, 0x78, 0xFB, 0x27, 0xB2, 0x20, 0xDF, 0xB6, 0x0C, 0x0F, 
+    0x10, 0x07, 0x02, 0xFB, 0x10, 0xF4, 0x00, 0x18, 0xED, 0x01, 0xFF, 0x43, 0x2F, 0xFC, 0x10, 
+    0x18, 0x15, 0x18, 0x27, 0x09, 0x00, 0x2B, 0x01, 0x0B, 0x17, 0xAC, 0x11, 0x00, 0x3A, 0x28, 
+    0xAC, 0x58, 0x02, 0x04, 0x8B, 0x15, 0x03, 0x1E, 0x4C, 0xFF, 0x55, 0xFC, 0x77, 0xF3, 0x1A, 
+    0x7E, 0x15, 0x18, 0x15, 0x18, 0x12, 0x17, 0x39, 0x04, 0x17, 0x18, 0x31, 0x09, 0x4C, 0x17, 
+    0x1B, 0x81, 0x01, 0x00, 0x4C, 0x18, 0xAA, 0x19, 0xAA, 0x9D, 0x0C, 0x00, 0x75, 0x0B, 0x00, 
+    0x17, 0x48, 0x09, 0x3E, 0x72, 0x01, 0x22, 0x20, 0x0C, 0x00, 0x1B, 0xE2, 0x63, 0x0B, 0x00, 
+    0x17, 0x17, 0x3E, 0x1A, 0x10, 0x20, 0x00, 0x14, 0x00, 0x7F, 0x74, 0x04, 0xBF, 0x03, 0x15, 
+    0x00, 0x47, 0x00, 0x08, 0x00, 0x01, 0x00, 0xD4, 0x03, 0x3F, 0x4D, 0x23, 0x10, 0x19, 0x04, 
+    0x00, 0x43, 0x20, 0x17, 0x15, 0x0A, 0x00, 0x18, 0xC3, 0x69, 0x00, 0x99, 0x05, 0x4C, 0x17, 
+    0x4C, 0x19, 0x03, 0x00, 0xA1, 0x03, 0x08, 0xAA, 0x1B, 0x1B, 0x08, 0x00, 0x1B, 0xAA, 0x1A, 
+    0xAA, 0x3C, 0x1B, 0x4C, 0x01, 0x20, 0x5F, 0x20, 0xB8, 0x12, 0x06, 0x00, 0x1B, 0x17, 0x7E, 
+    0x3F, 0x31, 0x00, 0x05, 0x10, 0x91, 0x10, 0xCF, 0x01, 0x17, 0x00, 0xD1, 0x00, 0xAA, 0xD0, 
+    0xAA, 0x4B, 0xAA, 0x4C, 0x03, 0x10, 0x4C, 0x09, 0x10, 0x06, 0x10, 0x7A, 0x4A, 0x0A, 0x10, 
+    0xAA, 0x06, 0x00, 0x17, 0x20, 0x00, 0x20, 0x06, 0x10, 0x5C, 0x22, 0x1A, 0xFE, 0x06, 0x1B, 
+    0x28, 0x1C, 0xFF, 0x03, 0x26, 0x89, 0x87, 0x07, 0x03, 0xFF, 0x01, 0xFF, 0x05, 0x9C, 0x9B, 
+    0xCA, 0x2B, 0xE7, 0x01, 0x61, 0x04, 0x41, 0x9A, 0x9B, 0x17, 0xEE, 0x15, 0x0A, 0x00, 0x30, 
+    0x4D, 0xFF, 0x00, 0x20, 0x08, 0x10, 0x02, 0x20, 0x03, 0x20, 0x04, 0x00, 0x0D, 0x20, 0x0B, 
+    0x40, 0x03, 0x10, 0xF7, 0x30, 0x60, 0x06, 0x30, 0x1E, 0x10, 0x4D, 0x13, 0x00, 0x00, 0x40, 
+    0x45, 0x40, 0x12, 0x90, 0xCD, 0x0A, 0x30, 0x3F, 0x0F, 0x70, 0x00, 0x70, 0x3F, 0xEE, 0x30, 
+    0x70, 0x40, 0xD0, 0xFF, 0x0C, 0x60, 0x7E, 0x20, 0x01, 0x20, 0x10, 0x20, 0x13, 0x40, 0x0C, 
+    0x70, 0x03, 0x30, 0x05, 0x40, 0x05, 0x00, 0xC0, 0x9C, 0xFF, 0x0F, 0x63, 0xAC, 0x04, 0x19, 
+    0x8A, 0xC0, 0x59, 0x8B, 0x5A, 0x2B, 0xAC, 0xEE, 0xFF, 0x10, 0xE7, 0x14, 0xB3, 0x01, 0x11, 
+    0xF1, 0x23, 0x5A, 0xAA, 0x13, 0x01, 0x00, 0x20, 0x4F, 0x07, 0x40, 0xE7, 0x08, 0x10, 0x0B, 
+    0x10, 0x2B, 0x04, 0x1F, 0x4F, 0x09, 0x30, 0x16, 0x40, 0x0B, 0x70, 0xF9, 0x0C, 0x40, 0x8E, 
+    0x4F, 0x21, 0x00, 0x00, 0xC0, 0x10, 0xE0, 0x20, 0xF0, 0x00, 0x01, 0x80, 0x7F, 0x6B, 0x30, 
+    0x08, 0x20, 0x02, 0x10, 0x35, 0xF0, 0x0A, 0x00, 0xF0, 0x11, 0x4E, 0x70, 0x01, 0x50, 0x1F, 
+    0x02, 0x03, 0xFC, 0x06, 0x89, 0xAC, 0x03, 0x8A, 0x9C, 0x28, 0xE4, 0x8B, 0x8B, 0xFF, 0x04, 
+    0x8E, 0x8E, 0x96, 0x19, 0xEB, 0x48, 0x07, 0x06, 0x0C, 0x58, 0x5C, 0xFE, 0x50, 0x00, 0xF0, 
+    0xC4, 0x1F, 0x03, 0x03, 0xAC, 0x81, 0x02, 0x11, 0x17, 0x02, 0x28, 0x8B, 0x03, 0x15, 0xEB, 
+    0x10, 0x67, 0x56, 0x49, 0x03, 0x12, 0x5A, 0x04, 0x15, 0x19, 0x58, 0xF1, 0x13, 0x00, 0xF0, 
+    0xA7, 0xF6, 0x08, 0x03, 0x04, 0x4D, 0xF7, 0x09, 0x59, 0x15, 0x5C, 0x58, 0xB0, 0x8B, 0x2B, 
+    0x89, 0x01, 0x11, 0x00, 0xFF, 0x01, 0x13, 0x02, 0x43, 0x05, 0x55, 0x15, 0x19, 0xFE, 0xF0, 
+    0xCB, 0x8E, 0xF5, 0x28, 0x28, 0x4D, 0xD1, 0xFF, 0x0D, 0x28, 0x8A, 0x8A, 0xFF, 0x01, 0x17, 
+    0x1F, 0x13, 0xFF, 0x05, 0x15, 0x49, 0x4F, 0x14, 0x5A, 0x16, 0x5C, 0xFF, 0xF0, 0xCC, 0x5C, 
+    0x28, 0x28, 0x42, 0x4F, 0xFF, 0x02, 0x03, 0x8A, 0x9D, 0x26, 0xFF, 0x10, 0x1F, 0x2F, 0xFF, 
+    0x00, 0xEF, 0x2B, 0xE8, 0x1A, 0x00, 0x27, 0x1B, 0xFF, 0xF0, 0xCC, 0x9D, 0x58, 0x0C, 0x28, 
+    0xAC, 0xFF, 0x01, 0xFF, 0x00, 0x28, 0x8B, 0x9C, 0x8A, 0x3B, 0x0F, 0x06, 0xFF, 0x21, 0xCA, 
+    0x82, 0x0C, 0x02, 0x16, 0xFF, 0xF1, 0xD0, 0x9D, 0x26, 0x02, 0x29, 0xFF, 0x10, 0x28, 0x89, 
+    0x17, 0x04, 0x8B, 0x19, 0x2C, 0x18, 0xAC, 0xFF, 0x4A, 0x5F, 0x7E, 0x59, 0xFF, 0xF0, 0xCD, 
+    0x03, 0x26, 0x30, 0x29, 0x4D, 0x03, 0x5A, 0x02, 0x00, 0xFF, 0x01, 0x8A, 0x19, 0x27, 0xFF, 
+    0x10, 0xFF, 0x23, 0x61, 0x5C, 0x14, 0x9B, 0xFF, 0xF0, 0xCD, 0x2B, 0x04, 0x40, 0x28, 0x4F, 
+    0x29, 0x59, 0xAC, 0x28, 0xFF, 0x02, 0xAC, 0xF8, 0x9C, 0x18, 0x4D, 0xFF, 0x2A, 0xF8, 0x07, 
+    0x59, 0x2B, 0x02, 0x11, 0xFF, 0x00, 0x03, 0x13, 0x04, 0xFF, 0xF2, 0xC9, 0x28, 0x58, 0x4F, 
+    0x29, 0x15, 0x4F, 0x88, 0x03, 0x15, 0x8B, 0xFF, 0x01, 0x18, 0xAC, 0x4C, 0xFF, 0x41, 0x93, 
+    0xFB, 0x03, 0xFF, 0x11, 0xCA, 0x03, 0xFF, 0xF3, 0xCE, 0x2B, 0x58, 0xFF, 0x08, 0x20, 0x15, 
+    0xAC, 0x29, 0x8B, 0x2B, 0xFF, 0x0D, 0x8B, 0x4D, 0xFC, 0x8C, 0x8B, 0xFF, 0x56, 0xE1, 0x0D, 
+    0x03, 0x21, 0xFF, 0xF2, 0xCF, 0xFF, 0x00, 0xFF, 0x0A, 0x00, 0x89, 0x4C, 0x28, 0x4C, 0x15, 
+    0x8A, 0x4F, 0x4C, 0xD6, 0xAC, 0xFF, 0x00, 0x01, 0x0D, 0x9B, 0xFF, 0x05, 0x15, 0xEB, 0x1E, 
+    0xFF, 0xF5, 0xCF, 0x81, 0xFF, 0x01, 0x29, 0x89, 0x4D, 0x29, 0x8B, 0x9D, 0xFF, 0x09, 0xD0, 
+    0x5A, 0x4D, 0xAC, 0x4C, 0xFF, 0x00, 0xCA, 0xFC, 0x3E, 0xFC, 0x00, 0x10, 0x14, 0x9C, 0x5A, 
+    0x4C, 0xFF, 0xF2, 0xCE, 0x29, 0xAC, 0x58, 0x01, 0xFF, 0x27, 0x03, 0x8B, 0x9D, 0x59, 0x4F, 
+    0x4C, 0x4D, 0x07, 0xFF, 0x22, 0xFE, 0x07, 0x02, 0x14, 0x59, 0x9B, 0x5A, 0x2B, 0x8B, 0x09, 
+    0xFF, 0xF4, 0xCC, 0x2B, 0x28, 0xFF, 0x2C, 0x59, 0x8B, 0x19, 0x59, 0xE0, 0x8B, 0x9C, 0x5A, 
+    0xAC, 0x8B, 0xFF, 0x22, 0xF9, 0x17, 0xFF, 0x11, 0x1D, 0x02, 0x12, 0x4C, 0xFE, 0xF0, 0xCB, 
+    0xFF, 0x05, 0xFC, 0x1A, 0x4D, 0x03, 0x8B, 0x80, 0x8A, 0x03, 0x8B, 0x18, 0x8A, 0x4F, 0x8B, 
+    0xFF, 0x05, 0x1E, 0x9C, 0xF7, 0x13, 0xFB, 0x1C, 0x03, 0x00, 0xFF, 0xF4, 0xCF, 0x03, 0x59, 
+    0x02, 0x03, 0xFC, 0x04, 0xFF, 0x01, 0x02, 0x03, 0x4C, 0xBC, 0x15, 0x4D, 0x59, 0xFF, 0x30, 
+    0x9C, 0x59, 0xF9, 0x14, 0xFE, 0x00, 0x14, 0xFF, 0xFA, 0xD0, 0x03, 0x10, 0x03, 0x4C, 0x5A, 
+    0x89, 0x02, 0x02, 0x5C, 0x59, 0x8B, 0xF0, 0x9D, 0x5A, 0x4D, 0x8C, 0xFF, 0x03, 0xF7, 0x16, 
+    0xFE, 0x10, 0x06, 0x16, 0x01, 0xFF, 0xF0, 0xCF, 0x03, 0x58, 0x03, 0x4F, 0x8A, 0x8A, 0xAC, 
+    0x80, 0x59, 0x5C, 0x5C, 0x03, 0x4C, 0x8A, 0x2B, 0xFF, 0x31, 0x13, 0xFE, 0x12, 0x04, 0x21, 
+    0x9B, 0x03, 0xFF, 0xF0, 0xCF, 0x2B, 0x03, 0x03, 0xEA, 0xEE, 0xFF, 0x1B, 0x8B, 0xFF, 0x30, 
+    0xAC, 0xFF, 0x04, 0xFB, 0x21, 0x02, 0x41, 0x07, 0xFF, 0xF3, 0xCF, 0xFF, 0x07, 0xFC, 0x06, 
+    0x4F, 0x03, 0x8B, 0x19, 0x03, 0xE0, 0x4C, 0x18, 0x8A, 0xF6, 0x4C, 0xFF, 0x07, 0xFE, 0x20, 
+    0x02, 0x20, 0x07, 0x05, 0x1B, 0xFF, 0xF3, 0xCF, 0xFC, 0x03, 0x17, 0x4D, 0x03, 0x4C, 0x4C, 
+    0xC0, 0x03, 0xEE, 0x2B, 0x8A, 0xF6, 0x4D, 0xFF, 0x13, 0x00, 0x32, 0x09, 0x00, 0x23, 0x9C, 
+    0x15, 0xFF, 0xF2, 0xCE, 0x8A, 0x03, 0x4D, 0x8A, 0x02, 0x8B, 0xFF, 0x00, 0x1C, 0x03, 0xAC, 
+    0x17, 0x8A, 0xF6, 0x8E, 0xEE, 0xFF, 0x12, 0xF9, 0x4B, 0xFE, 0x11, 0x59, 0x9C, 0x1B, 0xFF, 
+    0xF2, 0xCE, 0x10, 0x8A, 0xAC, 0x8A, 0x5C, 0x02, 0x01, 0x19, 0x8A, 0x4C, 0x76, 0x8A, 0xFF, 
+    0x87, 0x00, 0x21, 0xCA, 0x00, 0x09, 0xFF, 0xF5, 0xCE, 0xFC, 0x03, 0x8A, 0x80, 0x19, 0x4D, 
+    0x2B, 0x8B, 0x4C, 0x2B, 0x4C, 0xFF, 0x42, 0x0D, 0xFD, 0x00, 0x17, 0x03, 0x49, 0xFF, 0xF4, 
+    0xD1, 0x59, 0x8A, 0x8C, 0x8A, 0x00, 0x5C, 0xAC, 0x8A, 0x8B, 0x4C, 0x03, 0xAC, 0x18, 0xF2, 
+    0x8B, 0xFF, 0x71, 0x5A, 0x2B, 0xFE, 0x04, 0x00, 0x14, 0xFF, 0xF3, 0xCE, 0xFF, 0x0B, 0x05, 
+    0xFF, 0x02, 0x03, 0xFC, 0x01, 0x4C, 0x8B, 0x5A, 0x4F, 0x8B, 0x91, 0xFF, 0x21, 0x2B, 0x9C, 
+    0x5A, 0x02, 0x57, 0x9B, 0x8C, 0xFF, 0xFA, 0xCE, 0x4B, 0xFF, 0x04, 0xFF, 0x11, 0x5C, 0xFF, 
+    0x01, 0x18, 0xAC, 0xFF, 0x27, 0x17, 0x4D, 0x00, 0x02, 0x5A, 0x03, 0x13, 0x07, 0x0D, 0x9C, 
+    0x19, 0xFF, 0xF1, 0xCD, 0x59, 0x26, 0xBC, 0xFC, 0x08, 0xFF, 0x15, 0x15, 0xAC, 0xFF, 0x14, 
+    0x4D, 0x8E, 0xE0, 0x5C, 0x9C, 0x02, 0x15, 0x2B, 0x01, 0x00, 0xFE, 0x00, 0x03, 0x10, 0x03, 
+    0xFF, 0xF0, 0xCE, 0xFF, 0x27, 0x4F, 0x8A, 0x5C, 0x8B, 0x03, 0xAC, 0xE8, 0x2E, 0x89, 0x4F, 
+    0xFF, 0x0B, 0x02, 0xFC, 0x11, 0xFE, 0x20, 0x05, 0x27, 0x06, 0x1C, 0xFF, 0xF2, 0xD2, 0xFF, 
+    0x09, 0x4C, 0x03, 0x4C, 0x8B, 0x17, 0xA0, 0x4D, 0x4C, 0xAC, 0x8E, 0x19, 0x00, 0x04, 0x5A, 
+    0x00, 0x17, 0x03, 0x06, 0x2C, 0xFF, 0xF0, 0xCE, 0x2B, 0x59, 0x8A, 0x4D, 0x9D, 0x17, 0x00, 
+    0x4D, 0x8A, 0x1C, 0x4C, 0x02, 0x4B, 0x8A, 0x9D, 0xC0, 0x4D, 0xAC, 0x4D, 0x8E, 0x8B, 0x5C, 
+    0xFF, 0x11, 0x03, 0x38, 0x85, 0x00, 0x00, 0xAC, 0xFF, 0xF5, 0xCE, 0x15, 0x4D, 0x03, 0x1C, 
+    0x02, 0x04, 0x20, 0x8B, 0x03, 0x4C, 0x02, 0x17, 0xFF, 0x1C, 0x5C, 0x19, 0x2A, 0x19, 0x02, 
+    0x1A, 0x03, 0xFE, 0x21, 0x15, 0xFF, 0xF1, 0xD0, 0x03, 0x4F, 0x01, 0xFF, 0x1D, 0x4C, 0x8B, 
+    0x02, 0x4C, 0x8B, 0x15, 0x4F, 0x00, 0x4C, 0x4D, 0x4F, 0x1B, 0x18, 0x18, 0x5C, 0x5A, 0x0B, 
+    0xFF, 0x13, 0x01, 0x22, 0x03, 0xFF, 0xF6, 0xCD, 0x9D, 0x03, 0x59, 0x4F, 0x06, 0x15, 0xFF, 
+    0x05, 0xFF, 0x11, 0x5A, 0x8B, 0xAC, 0x4F, 0xAC, 0x80, 0x4F, 0x1C, 0x5A, 0x18, 0x5C, 0x5C, 
+    0x5A, 0x03, 0x23, 0x86, 0x9C, 0x06, 0x06, 0xFF, 0xF5, 0xCF, 0x03, 0xAC, 0x03, 0x19, 0xFF, 
+    0x0B, 0x20, 0x1C, 0x15, 0x8C, 0x8B, 0x02, 0xFF, 0x03, 0x4F, 0x1B, 0xBE, 0x02, 0x00, 0x02, 
+    0x00, 0x01, 0xFF, 0x21, 0x00, 0x05, 0x6B, 0xF0, 0x38, 0x4F, 0x01, 0x20, 0xDC, 0x1F, 0x4F, 
+    0x09, 0x10, 0x02, 0x40, 0x00, 0x20, 0xF6, 0x1C, 0x30, 0xFF, 0xF5, 0x68, 0x04, 0x1C, 0xAC, 
+    0xFF, 0x11, 0xAC, 0x02, 0x17, 0x4F, 0xAC, 0x00, 0xAC, 0x4F, 0x1B, 0x8B, 0x9D, 0x8A, 0x19, 
+    0x19, 0x08, 0x5C, 0x15, 0x2B, 0x03, 0x23, 0x2B, 0x9A, 0x9C, 0x1F, 0xDF, 0x69, 0xF0, 0x34, 
+    0xF7, 0x00, 0xE3, 0x10, 0xE7, 0x30, 0xFD, 0x20, 0x1F, 0x04, 0x71, 0x63, 0xB0, 0x1B, 0x71, 
+    0xF0, 0x35, 0x47, 0xF0, 0x12, 0x9D, 0xFF, 0x11, 0xFF, 0x22, 0x5A, 0xAC, 0x17, 0x10, 0x89, 
+    0x4F, 0x4C, 0x4F, 0xFF, 0x33, 0x5C, 0x5C, 0x9D, 0x04, 0x5A, 0x5C, 0x09, 0x1D, 0x9C, 0x9C, 
+    0xC7, 0xC9, 0x9C, 0x20, 0x02, 0xF6, 0x8E, 0x1D, 0x01, 0x00, 0x00, 0x1D, 0xCE, 0x44, 0x1D, 
+    0x1D, 0x03, 0x10, 0x4F, 0x8C, 0x01, 0x05, 0x00, 0x1F, 0xE1, 0x13, 0x10, 0x2E, 0x8E, 0x2E, 
+    0x8E, 0x19, 0x10, 0x02, 0xA0, 0x14, 0x00, 0xE0, 0xF6, 0xF6, 0x4F, 0x1D, 0x1D, 0x0A, 0x00, 
+    0x01, 0x30, 0x37, 0x10, 0x35, 0x00, 0xC0, 0x8C, 0x09, 0xC0, 0x8C, 0x4F, 0x10, 0x29, 0x00, 
+    0xF6, 0x4F, 0xC6, 0x8C, 0x2D, 0x00, 0x47, 0x30, 0xCE, 0x8E, 0x8C, 0x74, 0x10, 0x04, 0x10, 
+    0x02, 0x01, 0x43, 0x00, 0x1F, 0xF6, 0xF6, 0x1F, 0xAC, 0x8E, 0x7A, 0x1F, 0x0E, 0x20, 0x1F, 
+    0x8F, 0x10, 0x00, 0x00, 0x0D, 0x00, 0x2D, 0x00, 0x2E, 0x79, 0x6D, 0x10, 0x1D, 0x1D, 0x06, 
+    0x00, 0x09, 0x10, 0x03, 0x00, 0x53, 0x00, 0xCE, 0xC1, 0x62, 0x70, 0x01, 0x8C, 0xCE, 0xAC, 
+    0x8E, 0x09, 0x30, 0xB7, 0x10, 0x0A, 0x8C, 0x5E, 0x00, 0x1F, 0x0B, 0x30, 0x1D, 0x9C, 0x03, 
+    0x89, 0x10, 0x4D, 0x15, 0x8A, 0x4F, 0xFF, 0x04, 0x15, 0xAC, 0x03, 0x04, 0x18, 0x4F, 0xFF, 
+    0x02, 0x1C, 0x02, 0x8B, 0x9D, 0x19, 0x21, 0x01, 0x03, 0x5C, 0x18, 0x18, 0x03, 0x01, 0x0E, 
+    0x58, 0x9B, 0x04, 0xC7, 0xD6, 0x01, 0x00, 0xC6, 0xD6, 0xD6, 0xC5, 0xD6, 0xC0, 0xC6, 0xC7, 
+    0xC8, 0xC8, 0xC8, 0x56, 0x03, 0x00, 0x05, 0x20, 0x00, 0xC7, 0xC7, 0xC5, 0xC5, 0xD6, 0xC5, 
+    0xC5, 0xC5, 0x20, 0xD5, 0xC6, 0xC6, 0xC7, 0xC7, 0x02, 0x10, 0xC6, 0xC7, 0x5F, 0x21, 0x00, 
+    0x0B, 0x20, 0x09, 0x00, 0x12, 0x20, 0x00, 0x80, 0xC6, 0x32, 0x00, 0x58, 0x04, 0xC8, 0x11, 
+    0x38, 0x10, 0x54, 0xC8, 0x10, 0xC8, 0x13, 0xD5, 0x08, 0x00, 0x11, 0x46, 0x20, 0x10, 0x49, 
+    0x00, 0x57, 0x51, 0x00, 0x26, 0x30, 0x08, 0xC8, 0xC7, 0x13, 0x0A, 0x20, 0xC8, 0x99, 0x99, 
+    0x98, 0x01, 0x10, 0x20, 0x98, 0x99, 0x56, 0x9B, 0x57, 0x99, 0x99, 0x80, 0x99, 0x56, 0x9A, 
+    0x56, 0x9A, 0x99, 0x56, 0x09, 0x00, 0xD4, 0x56, 0x99, 0x07, 0x00, 0x9A, 0x11, 0x00, 0x9A, 
+    0x01, 0x00, 0x0D, 0x00, 0x43, 0x00, 0x20, 0x39, 0x20, 0xC8, 0xC8, 0xC9, 0x9A, 0x9C, 0x20, 
+    0xC8, 0xC4, 0xC8, 0x13, 0x09, 0x00, 0x9A, 0xC8, 0x11, 0x0E, 0x00, 0x11, 0x10, 0x74, 0x13, 
+    0x99, 0x06, 0x00, 0x56, 0x03, 0x00, 0x05, 0x30, 0x0D, 0x10, 0x99, 0x02, 0x9A, 0x00, 0x20, 
+    0x9B, 0x57, 0x59, 0x9C, 0x8B, 0x2B, 0x82, 0xAA, 0xFF, 0x28, 0xAC, 0x02, 0x89, 0x4F, 0xEE, 
+    0xFF, 0x02, 0x00, 0x17, 0x18, 0x8B, 0x18, 0x02, 0x5C, 0x5C, 0x8A, 0x0C, 0x5C, 0x5C, 0xFF, 
+    0x1D, 0x01, 0x00, 0x9A, 0x9A, 0xC9, 0xC9, 0x0A, 0xC9, 0x5C, 0x20, 0x99, 0x08, 0x00, 0xC9, 
+    0x14, 0xC9, 0x14, 0xBC, 0xCA, 0x14, 0x07, 0x00, 0xBE, 0x00, 0x00, 0x50, 0x0D, 0x00, 0x13, 
+    0x22, 0x00, 0xC0, 0xC9, 0xC9, 0x56, 0x56, 0xC9, 0x57, 0x07, 0x00, 0x10, 0x10, 0x29, 0x83, 
+    0x00, 0xC8, 0xCA, 0x18, 0x20, 0xCA, 0x1B, 0x10, 0xC8, 0xC9, 0x80, 0xCA, 0x15, 0xCA, 0x63, 
+    0xCA, 0x14, 0xCA, 0x3D, 0x00, 0xB2, 0xC9, 0x06, 0x00, 0x14, 0xCA, 0x00, 0x00, 0x06, 0x10, 
+    0x14, 0x0D, 0x00, 0x10, 0x59, 0x58, 0x14, 0xCA, 0x65, 0x00, 0x58, 0x59, 0x59, 0x00, 0x58, 
+    0x9C, 0x03, 0x59, 0x59, 0x9A, 0x58, 0x58, 0x22, 0x9A, 0x7B, 0x0D, 0x58, 0x9B, 0x9A, 0x03, 
+    0x00, 0x9B, 0x9B, 0x3E, 0x15, 0x92, 0x0A, 0x89, 0x11, 0x8F, 0x1D, 0x92, 0x01, 0x11, 0x10, 
+    0x9B, 0x9B, 0x70, 0x58, 0x9A, 0x9B, 0xC9, 0xC1, 0x10, 0x04, 0x20, 0x00, 0x10, 0x59, 0x10, 
+    0x9B, 0x59, 0x58, 0x58, 0x04, 0x00, 0x59, 0x59, 0x03, 0x02, 0x15, 0x00, 0xF0, 0x09, 0x14, 
+    0x59, 0x63, 0x63, 0x63, 0x17, 0x00, 0x17, 0x17, 0x9C, 0x17, 0x9D, 0x1A, 0x4C, 0x19, 0x08, 
+    0x5C, 0xAC, 0x5C, 0xFC, 0x08, 0x5C, 0xAC, 0x03, 0x4C, 0x4A, 0x5C, 0xFF, 0x07, 0x8A, 0xFF, 
+    0x13, 0x1C, 0x8B, 0xFC, 0x00, 0x18, 0xE0, 0x18, 0x8B, 0x9D, 0x5C, 0x18, 0x06, 0x2A, 0x02, 
+    0x11, 0x7D, 0x00, 0xB3, 0x09, 0x05, 0x09, 0x00, 0x59, 0x9B, 0x90, 0x00, 0x0B, 0x00, 0x9B, 
+    0x02, 0x00, 0x00, 0x9B, 0x14, 0x9B, 0xCA, 0x9B, 0xC9, 0x9B, 0x14, 0x5E, 0xCA, 0x97, 0x10, 
+    0x2B, 0x14, 0xA5, 0x00, 0x37, 0x3A, 0x5A, 0x0A, 0x20, 0x15, 0x05, 0x11, 0x10, 0x14, 0x09, 
+    0x30, 0x9B, 0x57, 0x9B, 0x13, 0x17, 0x00, 0x9D, 0x17, 0x17, 0x02, 0x15, 0x9D, 0x17, 0x5A, 
+    0x01, 0x00, 0x00, 0x2B, 0x9D, 0x17, 0x9D, 0x15, 0x5A, 0x5A, 0x80, 0x9D, 0x5A, 0x19, 0x15, 
+    0x9D, 0x9D, 0x5A, 0x72, 0x0F, 0x30, 0x5A, 0x5A, 0x9C, 0x8A, 0x6D, 0x04, 0x17, 0x00, 0x5A, 
+    0x2B, 0x3C, 0x9C, 0x03, 0x7B, 0x06, 0x7F, 0x18, 0x83, 0x06, 0x84, 0x14, 0x03, 0x5C, 0xC4, 
+    0x18, 0x9D, 0x0B, 0x00, 0x02, 0x9C, 0x9D, 0x9A, 0x0C, 0x03, 0x00, 0x71, 0x3D, 0x00, 0x9C, 
+    0x03, 0x5A, 0xA1, 0x69, 0xA8, 0x16, 0x00, 0x00, 0x9D, 0x13, 0x16, 0x00, 0x00, 0x00, 0x18, 
+    0x02, 0x50, 0x00, 0x2B, 0x5C, 0x1C, 0x18, 0x02, 0x9D, 0x19, 0x0E, 0x10, 0x0F, 0x00, 0x02, 
+    0x18, 0x9D, 0xC0, 0x9D, 0x5C, 0x9D, 0x5C, 0x02, 0x5C, 0xD4, 0x12, 0x00, 0x50, 0x00, 0xAC, 
+    0x1B, 0x3F, 0x4C, 0x1A, 0x1B, 0x1B, 0xAC, 0x10, 0x1B, 0x1B, 0x8A, 0x1C, 0xF7, 0x04, 0x03, 
+    0x4C, 0x4C, 0x20, 0x03, 0x4D, 0x8B, 0x9D, 0x4C, 0xFF, 0x13, 0x8B, 0x19, 0x90, 0x18, 0x18, 
+    0x02, 0x8B, 0x05, 0x04, 0x8B, 0x9D, 0xF7, 0x20, 0xDF, 0xF4, 0x00, 0x68, 0x40, 0x7A, 0x11, 
+    0x04, 0x01, 0x00, 0x40, 0x14, 0x0D, 0x40, 0x1F, 0x11, 0x73, 0x29, 0x26, 0x06, 0x30, 0x59, 
+    0x9C, 0xC1, 0x00, 0x10, 0x21, 0x42, 0x36, 0x17, 0x23, 0x04, 0x00, 0x34, 0x20, 0x9C, 0x02, 
+    0x8A, 0xF5, 0x00, 0x63, 0x2B, 0x4B, 0xF9, 0x00, 0x03, 0x00, 0x17, 0xD5, 0x01, 0x8A, 0x18, 
+    0xCB, 0x00, 0x5A, 0x2B, 0x67, 0x03, 0x01, 0x01, 0x9D, 0xF0, 0x00, 0x02, 0x13, 0x00, 0x02, 
+    0x03, 0x1F, 0x12, 0x00, 0x42, 0x00, 0xF7, 0x10, 0xF5, 0x10, 0x8B, 0x1F, 0x5A, 0x8B, 0x18, 
+    0x37, 0xF2, 0x00, 0x17, 0x00, 0x2E, 0x10, 0x9D, 0x16, 0x00, 0x99, 0x28, 0x9C, 0x9B, 0x7D, 
+    0x67, 0x00, 0x03, 0x99, 0x30, 0x06, 0x00, 0x47, 0x11, 0x4B, 0x00, 0x00, 0x10, 0x2B, 0x00, 
+    0x5C, 0x9D, 0x8B, 0x17, 0x02, 0x9D, 0x17, 0x19, 0xA9, 0x0F, 0x10, 0x02, 0x5C, 0x10, 0x11, 
+    0x9D, 0x1C, 0x21, 0x9D, 0x1A, 0x00, 0x01, 0x00, 0x20, 0x4D, 0x19, 0x4C, 0x1B, 0x1B, 0x1B, 
+    0x4C, 0x41, 0x01, 0x02, 0x4C, 0x9D, 0x4C, 0x17, 0x8B, 0xFF, 0x13, 0x19, 0x20, 0x4C, 0x8B, 
+    0x9D, 0x4D, 0x8B, 0xFF, 0x00, 0x17, 0x8C, 0xF0, 0x18, 0x5C, 0x1C, 0x8A, 0x05, 0x07, 0x75, 
+    0x00, 0xB9, 0x00, 0xF8, 0x30, 0x7F, 0xDE, 0x20, 0x0D, 0x23, 0xF7, 0x30, 0xFA, 0x01, 0xFD, 
+    0x20, 0xD8, 0x20, 0xE8, 0x10, 0x17, 0xFF, 0x34, 0x1C, 0xF2, 0x01, 0xF5, 0x30, 0x39, 0x12, 
+    0x0C, 0x20, 0xC8, 0x00, 0x44, 0x00, 0x00, 0x30, 0x58, 0x03, 0x17, 0x9D, 0xF2, 0x11, 0x01, 
+    0x20, 0x15, 0xAB, 0x20, 0x8A, 0x2A, 0x2B, 0x0A, 0x00, 0x8A, 0x03, 0x00, 0x03, 0x13, 0x02, 
+    0x9C, 0x02, 0x40, 0x59, 0x9D, 0x15, 0x02, 0x89, 0x9C, 0x1E, 0x01, 0x5A, 0xDE, 0x02, 0x34, 
+    0x12, 0x47, 0x01, 0x11, 0x02, 0xF9, 0x00, 0x2B, 0x8B, 0x12, 0xF9, 0x00, 0x7F, 0x27, 0x00, 
+    0x31, 0x01, 0x2C, 0x01, 0xEE, 0x00, 0xFE, 0x00, 0x57, 0x11, 0x01, 0x51, 0x2B, 0x0C, 0x9D, 
+    0x15, 0x25, 0x02, 0xEC, 0x00, 0x18, 0x1C, 0x5A, 0x2E, 0xD0, 0x8A, 0x18, 0x18, 0x1C, 0x03, 
+    0x00, 0xF5, 0xC7, 0x03, 0xFE, 0x10, 0xA1, 0x03, 0x21, 0x15, 0x9C, 0x2B, 0x03, 0xD7, 0x02, 
+    0x2B, 0x1E, 0x02, 0x01, 0x0D, 0x02, 0x4C, 0x5C, 0x8C, 0x4C, 0x1B, 0x3F, 0x1B, 0x20, 0x1C, 
+    0x8C, 0x1B, 0x1A, 0x17, 0xFF, 0x2B, 0x8B, 0x19, 0x00, 0x8A, 0xAC, 0x03, 0x5A, 0x4F, 0x4D, 
+    0x4F, 0x8E, 0x78, 0x1C, 0x8B, 0x2B, 0x37, 0x00, 0xFF, 0x01, 0x06, 0x03, 0x69, 0x01, 0x2B, 
+    0x17, 0x66, 0x20, 0x68, 0x10, 0x02, 0x21, 0xCA, 0x0D, 0x20, 0x2E, 0x2E, 0x03, 0x00, 0x03, 
+    0xF6, 0x02, 0x02, 0x02, 0xF5, 0x18, 0x5C, 0x94, 0x17, 0x9B, 0xA4, 0x02, 0x9A, 0x1F, 0x00, 
+    0x02, 0x02, 0x2D, 0x00, 0xFE, 0x17, 0xF0, 0x11, 0x03, 0x00, 0xBA, 0x00, 0xB0, 0x00, 0xFB, 
+    0x00, 0xAC, 0x10, 0x32, 0x03, 0x42, 0x2B, 0x02, 0x10, 0x9C, 0x9C, 0x8A, 0x18, 0xF5, 0x00, 
+    0x5A, 0x78, 0x18, 0x9D, 0x5A, 0xF3, 0x00, 0xA7, 0x11, 0x09, 0x00, 0x0D, 0x10, 0x5C, 0x60, 
+    0x2B, 0x1A, 0x9D, 0x5A, 0x9C, 0xAC, 0x10, 0xF6, 0x01, 0x03, 0x18, 0x19, 0x9D, 0x18, 0x0B, 
+    0x00, 0x45, 0x10, 0x9C, 0x18, 0x2B, 0xEF, 0x0A, 0x11, 0xFA, 0x01, 0x8C, 0x04, 0xFA, 0x21, 
+    0x17, 0x05, 0x11, 0x1F, 0x02, 0xF4, 0x00, 0x07, 0xFD, 0x11, 0x00, 0x30, 0x6F, 0x12, 0x9C, 
+    0x5A, 0x02, 0x19, 0x8B, 0x00, 0x19, 0x02, 0x8C, 0x9D, 0x1B, 0xCD, 0xCD, 0xCD, 0x00, 0xF5, 
+    0x1B, 0x02, 0x8B, 0x1B, 0x5C, 0xF5, 0x8C, 0x38, 0x18, 0x02, 0x8C, 0xEB, 0x01, 0xC7, 0x00, 
+    0x00, 0x00, 0xF5, 0x2E, 0xC0, 0x02, 0x9D, 0xF5, 0x8C, 0x1B, 0xF5, 0x4A, 0x01, 0x22, 0x03, 
+    0xE0, 0x5C, 0x5C, 0x4C, 0x1B, 0x1A, 0xFE, 0x01, 0x00, 0x02, 0xFC, 0x0A, 0x81, 0xFF, 0x02, 
+    0x8B, 0x19, 0x15, 0x8B, 0x2B, 0x03, 0xFF, 0x03, 0xD8, 0x8E, 0x1C, 0x19, 0x2E, 0x10, 0x9D, 
+    0x00, 0x8B, 0x02, 0x26, 0x62, 0x62, 0x83, 0xD2, 0x11, 0xE4, 0x42, 0x9B, 0x2E, 0x1D, 0x03, 
+    0x02, 0x6B, 0x06, 0xA0, 0x01, 0x1B, 0x8C, 0x1F, 0x9A, 0xF9, 0x00, 0xAC, 0xFF, 0x00, 0xF9, 
+    0x0F, 0x00, 0x8E, 0x1A, 0x8A, 0x22, 0xFE, 0x21, 0xC5, 0x62, 0xAF, 0x24, 0xFE, 0x00, 0xE5, 
+    0x00, 0x22, 0x15, 0x88, 0x01, 0x5A, 0x18, 0xC9, 0x21, 0x06, 0x00, 0xAB, 0x22, 0x01, 0x09, 
+    0x01, 0x5C, 0x1C, 0x2E, 0x4F, 0x8E, 0x01, 0x18, 0x04, 0x9B, 0x5C, 0xA3, 0x06, 0x9D, 0x9B, 
+    0x9B, 0xF5, 0x8E, 0x20, 0x1D, 0x2E, 0x9B, 0x2E, 0x01, 0x35, 0x02, 0x5C, 0x01, 0xCC, 0x01, 
+    0x8E, 0xF2, 0x02, 0x85, 0x0A, 0x2B, 0x19, 0xDD, 0x01, 0x37, 0x00, 0xA7, 0x38, 0x10, 0x51, 
+    0x12, 0xF8, 0x93, 0x17, 0x2B, 0xAE, 0x0F, 0x2B, 0xEE, 0x03, 0x00, 0xCC, 0x8C, 0x8C, 0x01, 
+    0x00, 0x00, 0x2E, 0xCC, 0xA4, 0x1F, 0x8E, 0x8B, 0x00, 0x5C, 0x01, 0x97, 0x07, 0x1C, 0x05, 
+    0x10, 0x25, 0x22, 0x07, 0x8E, 0xBF, 0x07, 0x2E, 0x1F, 0xC4, 0x17, 0x02, 0x01, 0x00, 0x01, 
+    0xF6, 0x1D, 0x18, 0x2B, 0xAA, 0xAC, 0x5C, 0x04, 0x1A, 0x3F, 0x02, 0x03, 0x3F, 0x4C, 0x19, 
+    0x15, 0x4D, 0x02, 0x9C, 0xFF, 0x06, 0x5A, 0x8C, 0x9C, 0x8B, 0x15, 0x2B, 0x74, 0xAC, 0x4C, 
+    0xFF, 0x0D, 0x19, 0x01, 0x0B, 0x03, 0x05, 0x2C, 0x03, 0x8B, 0x1F, 0x2F, 0x02, 0x61, 0x10, 
+    0xD4, 0x13, 0x01, 0x62, 0x0E, 0x13, 0x1D, 0x1D, 0xF5, 0x00, 0xF5, 0x18, 0x9A, 0x02, 0x2B, 
+    0x03, 0x02, 0x2B, 0x00, 0x9A, 0x15, 0x03, 0x02, 0x02, 0x9A, 0x59, 0x03, 0x60, 0xF5, 0x9D, 
+    0x04, 0x9B, 0x8A, 0x56, 0x05, 0x27, 0x11, 0x89, 0xE6, 0x9C, 0xA6, 0x04, 0x00, 0x11, 0x9C, 
+    0x03, 0xFA, 0x41, 0x27, 0x13, 0x08, 0x10, 0x56, 0x9C, 0xEF, 0x00, 0xFA, 0x10, 0x8A, 0xCA, 
+    0x12, 0x8A, 0xCE, 0x23, 0x5A, 0x44, 0x18, 0x02, 0x86, 0x07, 0x26, 0x9B, 0x8C, 0x54, 0x01, 
+    0x9B, 0x04, 0x2B, 0x1D, 0x06, 0x01, 0x2E, 0x2B, 0x02, 0x9B, 0x2E, 0xC2, 0x02, 0x3A, 0x00, 
+    0x9D, 0x02, 0x04, 0x9B, 0xD8, 0x02, 0x48, 0x02, 0xF8, 0x9C, 0x9D, 0x8A, 0x39, 0x01, 0x54, 
+    0x00, 0x0C, 0x03, 0xF3, 0x42, 0x9C, 0x25, 0x07, 0x08, 0x10, 0xA2, 0x20, 0xDC, 0x02, 0x9C, 
+    0xCC, 0x4D, 0x2E, 0x2B, 0x00, 0x04, 0x03, 0x18, 0xCC, 0x02, 0x02, 0x26, 0x9B, 0x00, 0x9C, 
+    0x01, 0x02, 0x28, 0x28, 0x5C, 0x8C, 0x2B, 0x00, 0x02, 0x29, 0x9C, 0x02, 0xF5, 0x2B, 0x2B, 
+    0x29, 0x60, 0x04, 0x04, 0x04, 0x25, 0x9B, 0xA7, 0x02, 0x1B, 0x00, 0x03, 0x62, 0x9D, 0x11, 
+    0x02, 0x3F, 0x1A, 0xAC, 0x02, 0x04, 0x01, 0x05, 0x1A, 0x60, 0x9D, 0x4C, 0x9C, 0x17, 0xF6, 
+    0xFF, 0x08, 0x07, 0x07, 0x9C, 0x80, 0x4F, 0xAC, 0x8C, 0x8E, 0x19, 0x1C, 0x19, 0xF7, 0x00, 
+    0x7D, 0x00, 0x12, 0x02, 0x02, 0x12, 0x61, 0x00, 0x05, 0x14, 0xFE, 0x90, 0x0C, 0x00, 0x2B, 
+    0x40, 0x2E, 0x2B, 0x9A, 0x28, 0x02, 0x9D, 0xFF, 0x00, 0x9B, 0x8C, 0x18, 0x9D, 0xFF, 0x00, 
+    0xDC, 0x01, 0x02, 0x02, 0x03, 0xB4, 0x06, 0xF3, 0xB3, 0x13, 0x8E, 0x01, 0x9C, 0x59, 0x03, 
+    0x00, 0xF1, 0x10, 0xA6, 0x03, 0x25, 0x24, 0xAA, 0x03, 0x29, 0x35, 0x03, 0xED, 0x14, 0x5C, 
+    0xFF, 0x21, 0x5A, 0xCD, 0x04, 0x44, 0x5A, 0x18, 0x07, 0x04, 0x9C, 0x5C, 0x1D, 0xCC, 0x13, 
+    0x28, 0x00, 0x9D, 0x2B, 0x9B, 0x9A, 0x9B, 0x2B, 0x2B, 0x18, 0x28, 0x02, 0x2E, 0x9A, 0x52, 
+    0x00, 0x02, 0x77, 0x07, 0x9B, 0x2B, 0xF8, 0x8C, 0x2B, 0x04, 0x10, 0x13, 0xF1, 0x01, 0x8D, 
+    0x01, 0x33, 0x00, 0x53, 0x11, 0x1D, 0x8B, 0x31, 0x03, 0x20, 0x23, 0x00, 0x80, 0x23, 0x06, 
+    0x18, 0x03, 0x00, 0x00, 0x00, 0x03, 0x28, 0x5C, 0x2B, 0x02, 0x1D, 0x2E, 0xF2, 0x2E, 0xF6, 
+    0x05, 0x18, 0x04, 0x53, 0x00, 0xFD, 0x00, 0x1C, 0x04, 0x11, 0x00, 0x01, 0x52, 0x06, 0x2B, 
+    0x29, 0x9B, 0x28, 0x2B, 0xF6, 0x9C, 0x80, 0x28, 0x17, 0x2B, 0x1B, 0x5C, 0x4C, 0x19, 0xFD, 
+    0x10, 0xA1, 0x04, 0x06, 0x17, 0x4F, 0x9C, 0x18, 0xFF, 0x09, 0x5C, 0xFF, 0x00, 0xC0, 0x15, 
+    0x4F, 0x4D, 0xAC, 0x4F, 0x8C, 0x00, 0x01, 0x03, 0x03, 0x3F, 0x02, 0x34, 0x74, 0x00, 0xD0, 
+    0x02, 0x61, 0x01, 0x64, 0x21, 0x14, 0x5E, 0x9B, 0x03, 0x96, 0x9D, 0xFA, 0x01, 0xF1, 0x03, 
+    0x9C, 0xFF, 0x01, 0x17, 0x2B, 0xFF, 0x00, 0xE0, 0x9C, 0x9C, 0x9A, 0x9B, 0x29, 0x97, 0x25, 
+    0x28, 0x10, 0x25, 0x46, 0x3C, 0x2B, 0x58, 0xFC, 0x31, 0xDD, 0x10, 0x09, 0x21, 0x04, 0x01, 
+    0x03, 0x02, 0x7C, 0x5A, 0x5C, 0x01, 0x13, 0xF8, 0x11, 0x08, 0x00, 0x09, 0x00, 0xBB, 0x14, 
+    0x03, 0x24, 0x18, 0x01, 0x52, 0x04, 0x2B, 0x29, 0xAA, 0x00, 0x9C, 0x2E, 0x04, 0x9D, 0x03, 
+    0xAF, 0x00, 0x2B, 0x18, 0x03, 0x03, 0x9D, 0x80, 0x03, 0x99, 0x28, 0x2B, 0x2E, 0x19, 0x5C, 
+    0x1B, 0x06, 0xF1, 0xF7, 0x01, 0x8A, 0x5C, 0x17, 0x8D, 0x12, 0x1B, 0x07, 0x8E, 0x56, 0x00, 
+    0x42, 0x03, 0x9F, 0x43, 0x4C, 0x04, 0x8C, 0x26, 0x9A, 0x29, 0x00, 0x00, 0xB0, 0xAC, 0x2B, 
+    0x02, 0x28, 0xF9, 0x10, 0x13, 0x00, 0x19, 0xEF, 0x04, 0x00, 0x02, 0x9D, 0x26, 0x2B, 0x02, 
+    0x03, 0x28, 0x28, 0x10, 0x5A, 0x02, 0x2B, 0x2B, 0x59, 0x00, 0x9C, 0x9B, 0x8C, 0x16, 0x01, 
+    0xFE, 0x13, 0xF9, 0x07, 0x4C, 0x02, 0x03, 0x1A, 0xAC, 0x18, 0x08, 0x4C, 0x03, 0x19, 0xFF, 
+    0x03, 0x17, 0x9C, 0x8B, 0x5A, 0xF6, 0x2B, 0xFE, 0x0D, 0xFF, 0x07, 0x8A, 0xFC, 0x00, 0xFB, 
+    0x13, 0x01, 0x01, 0x00, 0x02, 0x7E, 0x02, 0x6B, 0x14, 0x02, 0x20, 0x78, 0x06, 0xF5, 0x00, 
+    0xDF, 0x10, 0xF1, 0x04, 0x04, 0x1C, 0x9D, 0x8C, 0xFF, 0x30, 0xFA, 0x03, 0x04, 0x00, 0x18, 
+    0x2E, 0x2E, 0xF0, 0x9B, 0x03, 0x2B, 0x9B, 0x56, 0x08, 0x31, 0x0A, 0xED, 0x31, 0x1E, 0x66, 
+    0x7F, 0xFF, 0x10, 0x07, 0x12, 0xB8, 0x00, 0x4B, 0x00, 0xF4, 0x00, 0xF1, 0x15, 0x00, 0x16, 
+    0x2B, 0x8E, 0x02, 0xA5, 0x06, 0x4D, 0x12, 0x55, 0x00, 0x02, 0x02, 0x28, 0xF5, 0x11, 0x80, 
+    0x9D, 0x9B, 0x02, 0x2B, 0x02, 0x8C, 0x2B, 0xB2, 0x02, 0xE0, 0x9D, 0x8C, 0x18, 0x8E, 0xF5, 
+    0x53, 0x00, 0xD9, 0x04, 0x2B, 0x00, 0xB1, 0x4E, 0x02, 0x1C, 0x8B, 0x19, 0xE9, 0x23, 0xFE, 
+    0x40, 0x03, 0xF8, 0x50, 0x81, 0x05, 0x55, 0x02, 0x5C, 0xCC, 0x00, 0x02, 0x9B, 0x8D, 0x03, 
+    0x49, 0x94, 0x02, 0x03, 0x29, 0x4B, 0x01, 0x19, 0x01, 0xF3, 0x04, 0x28, 0x43, 0xA8, 0x00, 
+    0x60, 0x01, 0x03, 0x9B, 0x5C, 0x19, 0x06, 0x00, 0x9C, 0x0A, 0x8E, 0xB9, 0x05, 0x01, 0x08, 
+    0x08, 0x4C, 0xAC, 0x5C, 0x1B, 0x63, 0x02, 0x06, 0x03, 0x07, 0x17, 0x4D, 0x5A, 0xFF, 0x08, 
+    0xFF, 0x21, 0x9C, 0xE0, 0x4F, 0x4D, 0x8C, 0x4F, 0xAC, 0x21, 0x37, 0xFE, 0x00, 0x07, 0x21, 
+    0x3F, 0xA6, 0x15, 0x70, 0x16, 0x75, 0x00, 0x84, 0x00, 0xE2, 0x01, 0x79, 0x08, 0x9A, 0x03, 
+    0x0F, 0xB6, 0x10, 0x67, 0x00, 0xFF, 0x02, 0x05, 0x00, 0x02, 0x2B, 0xF5, 0xF5, 0xF8, 0x8C, 
+    0x03, 0x03, 0x12, 0x13, 0x2C, 0x37, 0xBA, 0x03, 0xF9, 0x10, 0xA8, 0x02, 0xFF, 0xFC, 0x41, 
+    0x08, 0x14, 0xFF, 0x12, 0x3D, 0x10, 0x88, 0x07, 0x00, 0x12, 0xD2, 0x01, 0x00, 0x14, 0x08, 
+    0x9D, 0x15, 0x18, 0x4F, 0x11, 0x8C, 0x2E, 0x2B, 0x26, 0x22, 0x58, 0xEC, 0x01, 0x02, 0x9A, 
+    0x28, 0x5B, 0x01, 0x99, 0x57, 0x01, 0xAF, 0x07, 0x02, 0xF5, 0x2E, 0x26, 0x9C, 0x2E, 0x2E, 
+    0x9C, 0x9A, 0x9B, 0x1D, 0x17, 0x30, 0x02, 0x67, 0x01, 0x17, 0x1C, 0x7C, 0x33, 0x27, 0xFD, 
+    0x74, 0x02, 0x11, 0x06, 0x51, 0x5C, 0x2E, 0x3C, 0x01, 0x00, 0x02, 0xB1, 0x90, 0x02, 0x2B, 
+    0xF6, 0x8C, 0x8D, 0x01, 0x99, 0x00, 0x9A, 0x34, 0x09, 0x82, 0x03, 0xA4, 0x00, 0x9D, 0x02, 
+    0x2E, 0xF6, 0x19, 0xFF, 0x01, 0xD1, 0x3F, 0x01, 0x2B, 0x2E, 0xF5, 0x50, 0x09, 0x4C, 0x01, 
+    0x04, 0xFE, 0x24, 0x00, 0x1B, 0x1B, 0x19, 0x4D, 0x9D, 0x18, 0x4F, 0x03, 0xF8, 0x8A, 0x8B, 
+    0x9C, 0x04, 0x05, 0xFF, 0x12, 0xF2, 0x01, 0xFE, 0x10, 0xFA, 0x02, 0x7F, 0x05, 0x12, 0x09, 
+    0x26, 0xA4, 0x12, 0xA1, 0x01, 0xFA, 0x10, 0x02, 0x00, 0xEB, 0x02, 0x9A, 0xB2, 0x9B, 0xFF, 
+    0x00, 0x9B, 0x25, 0x44, 0x0B, 0x7B, 0x0B, 0x9B, 0x04, 0x10, 0xFF, 0x0A, 0x20, 0xE9, 0x10, 
+    0x0F, 0x02, 0xFC, 0x10, 0xFB, 0x02, 0x38, 0x47, 0xFF, 0x31, 0x3B, 0x18, 0xCD, 0x81, 0x03, 
+    0x5A, 0xCC, 0x04, 0x01, 0x12, 0x18, 0x18, 0xD4, 0x00, 0xAC, 0x38, 0x4C, 0x18, 0x8A, 0x27, 
+    0x00, 0xCB, 0x0B, 0x28, 0x9B, 0x05, 0x00, 0x98, 0x10, 0x04, 0x9C, 0x9A, 0x99, 0x08, 0x00, 
+    0x9A, 0x9A, 0x98, 0xD0, 0x98, 0x9A, 0x9B, 0x59, 0x53, 0x10, 0x18, 0x51, 0x16, 0x07, 0x0A, 
+    0xF1, 0xEE, 0x00, 0x5C, 0x19, 0x1C, 0xED, 0x60, 0x88, 0x20, 0x05, 0x86, 0xFF, 0x02, 0x00, 
+    0x2E, 0x2E, 0x9D, 0x28, 0x99, 0x99, 0x9C, 0x9D, 0x90, 0x9B, 0x99, 0x98, 0x98, 0x44, 0x00, 
+    0x9B, 0x9A, 0x3B, 0x04, 0x21, 0x99, 0x02, 0x9B, 0x9A, 0x57, 0x04, 0x51, 0x00, 0x59, 0x02, 
+    0x20, 0x28, 0x9A, 0x59, 0x9D, 0x59, 0xF4, 0x1B, 0x02, 0x5C, 0x85, 0xFA, 0x30, 0x3F, 0x01, 
+    0x09, 0x3F, 0x02, 0x4C, 0x8A, 0xFF, 0x08, 0x39, 0xFF, 0x10, 0x2B, 0x5A, 0xFF, 0x16, 0x32, 
+    0x07, 0x00, 0x14, 0x8A, 0x1C, 0x70, 0x9D, 0x5A, 0x8C, 0x19, 0x05, 0x1C, 0xA6, 0x17, 0xCB, 
+    0x25, 0x5A, 0x83, 0xF5, 0x01, 0x90, 0x29, 0x02, 0x17, 0x5C, 0x02, 0x17, 0x99, 0x02, 0xE7, 
+    0xEB, 0x11, 0x80, 0x31, 0x1E, 0x00, 0x9B, 0x9D, 0xEB, 0x31, 0xEF, 0x35, 0xEC, 0x12, 0xDF, 
+    0xF8, 0x28, 0x9E, 0x20, 0xF9, 0x12, 0x22, 0x10, 0x0B, 0x00, 0x9B, 0x00, 0x02, 0xFA, 0x00, 
+    0x40, 0x2B, 0x5A, 0x5C, 0x03, 0x9D, 0x5A, 0xA3, 0x04, 0x8A, 0x61, 0x4F, 0x00, 0x19, 0x8B, 
+    0x8A, 0x9D, 0xD2, 0x0B, 0xD1, 0x10, 0x03, 0xEF, 0xDF, 0x20, 0x56, 0x20, 0xC1, 0x02, 0x3F, 
+    0x00, 0x59, 0x48, 0x20, 0x56, 0x05, 0x7E, 0x01, 0x3C, 0x15, 0x8B, 0x16, 0x28, 0xF7, 0xA2, 
+    0x32, 0x14, 0x31, 0x3B, 0x9D, 0x1C, 0xD7, 0x00, 0x01, 0x4E, 0x0A, 0xE8, 0x03, 0x15, 0x27, 
+    0x00, 0x02, 0x62, 0x13, 0x38, 0x03, 0xE1, 0xF1, 0x08, 0x8A, 0x02, 0x5C, 0x19, 0xCE, 0x14, 
+    0xD2, 0x06, 0xCD, 0x00, 0x30, 0x1C, 0x5A, 0x1C, 0x02, 0xF7, 0x09, 0xFF, 0x29, 0xAC, 0x4C, 
+    0x02, 0x1C, 0xFF, 0x08, 0x8B, 0xAC, 0x29, 0x8A, 0x5C, 0x15, 0x00, 0xF6, 0x17, 0x03, 0x4F, 
+    0x4D, 0xF6, 0x4F, 0xF6, 0x26, 0x8B, 0xFF, 0x05, 0x03, 0x07, 0x02, 0x19, 0x9D, 0x03, 0x4C, 
+    0x9D, 0xE8, 0x19, 0x1C, 0x9D, 0x1A, 0x0A, 0x1B, 0x2E, 0x28, 0x02, 0x10, 0x35, 0x05, 0x04, 
+    0x1A, 0x4C, 0x00, 0x00, 0xAC, 0x4C, 0x17, 0x5C, 0x19, 0x00, 0x17, 0x1B, 0x1A, 0x1A, 0x17, 
+    0x17, 0xAC, 0x19, 0x00, 0x17, 0x5C, 0x1B, 0x17, 0x19, 0x1B, 0x19, 0x17, 0x00, 0x4C, 0x5C, 
+    0x18, 0x1B, 0x17, 0x1A, 0x18, 0x18, 0xD8, 0x1B, 0x19, 0x19, 0xE1, 0x0A, 0x0A, 0x10, 0x5C, 
+    0xB0, 0x00, 0x40, 0x14, 0x97, 0xDE, 0x00, 0x28, 0x19, 0xD7, 0x00, 0xAC, 0x25, 0x00, 0x1B, 
+    0x4C, 0x03, 0x10, 0x05, 0x7D, 0x1A, 0x8B, 0x88, 0x08, 0x4C, 0x4C, 0x8C, 0x1B, 0x17, 0x12, 
+    0xAC, 0x40, 0x00, 0x1B, 0x17, 0x95, 0x05, 0x17, 0x4C, 0x17, 0x84, 0x18, 0x4C, 0x37, 0x00, 
+    0x8C, 0x17, 0x8B, 0x17, 0x7E, 0x02, 0x17, 0x46, 0x00, 0x0B, 0x00, 0xAA, 0x01, 0x17, 0xAB, 
+    0x07, 0xAC, 0xAA, 0xAC, 0x1C, 0xAC, 0x19, 0x4D, 0x27, 0x94, 0x26, 0x5A, 0x10, 0x5C, 0x5C, 
+    0x19, 0x0C, 0x1B, 0x18, 0x01, 0x00, 0xC8, 0x02, 0x4C, 0x8C, 0x4C, 0x5C, 0x40, 0x4B, 0x8C, 
+    0xAA, 0x4C, 0x4C, 0xAA, 0x01, 0x10, 0x4A, 0x39, 0x06, 0x30, 0x4C, 0xAA, 0x06, 0x30, 0x00, 
+    0x10, 0x05, 0x00, 0x1B, 0x4C, 0x0E, 0x4B, 0x08, 0x00, 0x03, 0x10, 0x75, 0x10, 0x3F, 0xAC, 
+    0x19, 0x3F, 0x00, 0x19, 0x4C, 0x17, 0x1C, 0x4F, 0x28, 0x8B, 0x19, 0x10, 0x03, 0xF6, 0x19, 
+    0x8A, 0xFF, 0x0F, 0x8E, 0x1B, 0x19, 0x40, 0x1B, 0x5C, 0x5C, 0x8B, 0x19, 0x8C, 0x99, 0x02, 
+    0x5A, 0x00, 0x1C, 0x5A, 0x8C, 0x17, 0x4C, 0x4C, 0x4D, 0x4D, 0xFB, 0x17, 0x0A, 0x01, 0x10, 
+    0x4F, 0x09, 0x00, 0x0D, 0x00, 0x0F, 0x10, 0x03, 0x00, 0x14, 0x30, 0x1F, 0x1B, 0x40, 0x12, 
+    0x30, 0x02, 0x40, 0x04, 0x10, 0x32, 0x40, 0x4D, 0x4F, 0x8B, 0xF7, 0xCD, 0x21, 0xF9, 0x31, 
+    0xB1, 0x00, 0x1C, 0x2A, 0x60, 0x00, 0x20, 0x2C, 0x20, 0x09, 0x40, 0xBF, 0x03, 0x50, 0x6B, 
+    0x40, 0x70, 0x40, 0x22, 0x50, 0x0E, 0x30, 0x06, 0x00, 0x17, 0x5F, 0x36, 0xDA, 0x5A, 0x67, 
+    0x23, 0x17, 0x16, 0x10, 0x2C, 0x10, 0x4C, 0x08, 0x30, 0x39, 0x40, 0xC7, 0x7F, 0x60, 0x04, 
+    0x60, 0x14, 0x70, 0x4F, 0x4F, 0xEE, 0x29, 0x20, 0x37, 0x40, 0x00, 0x02, 0x4D, 0x18, 0x1C, 
+    0xAC, 0x03, 0x8A, 0x19, 0x50, 0x2B, 0x4D, 0x8A, 0x02, 0xFF, 0x1D, 0xAC, 0xFA, 0x02, 0x1B, 
+    0x87, 0x45, 0x1B, 0xFF, 0x05, 0x28, 0x06, 0x3F, 0xEE, 0x4F, 0x8E, 0x00, 0xF0, 0x2B, 0x6C, 
+    0x4D, 0x18, 0xAF, 0x40, 0xB7, 0x21, 0x17, 0x4D, 0xF0, 0x2D, 0x00, 0x00, 0x1C, 0x46, 0x15, 
+    0x47, 0x00, 0xFC, 0x3D, 0x9B, 0x59, 0x5C, 0x4C, 0xF0, 0x2D, 0x4D, 0xAA, 0xBD, 0xFF, 0x05, 
+    0x8B, 0xFF, 0x07, 0x02, 0xFF, 0x03, 0x15, 0xFF, 0x11, 0x51, 0xFF, 0x03, 0x18, 0x1C, 0x02, 
+    0x02, 0x09, 0x8B, 0x72, 0x18, 0x17, 0xBB, 0x11, 0x0E, 0x62, 0xF0, 0x2D, 0x19, 0xAF, 0x20, 
+    0xCF, 0x08, 0xAF, 0x10, 0x1B, 0xFE, 0xF0, 0x2F, 0xB8, 0x8E, 0x8B, 0x14, 0x7F, 0x2F, 0x08, 
+    0x09, 0x07, 0x00, 0x17, 0x4C, 0xF0, 0x2D, 0x40, 0x4F, 0x8B, 0x8A, 0x4F, 0x5A, 0x8C, 0xFF, 
+    0x24, 0x8C, 0x25, 0xFF, 0x14, 0x4D, 0xFF, 0x10, 0x8C, 0x8B, 0xFC, 0x0E, 0x02, 0x5A, 0x0C, 
+    0x18, 0xF5, 0xFE, 0x04, 0xFF, 0xF0, 0x30, 0x8B, 0x15, 0x58, 0x9C, 0x6C, 0x9B, 0x58, 0xAF, 
+    0xF0, 0x35, 0x00, 0x00, 0x4C, 0x47, 0x11, 0x00, 0x01, 0x89, 0x11, 0x07, 0x00, 0x58, 0x1B, 
+    0x1F, 0x4C, 0xF0, 0x2C, 0xAC, 0x5C, 0x5A, 0xD4, 0x4F, 0x02, 0xFF, 0x11, 0x19, 0xFF, 0x26, 
+    0xAC, 0xFF, 0x21, 0x00, 0x01, 0xB9, 0x00, 0x19, 0x2B, 0x1C, 0x00, 0x03, 0x11, 0x00, 0xAF, 
+    0xF0, 0x39, 0x59, 0xAF, 0xF0, 0x2E, 0x7D, 0x00, 0x00, 0x17, 0x48, 0x01, 0x55, 0x0D, 0x63, 
+    0x0B, 0x06, 0x00, 0x4F, 0xF1, 0x2E, 0xAC, 0x08, 0x02, 0x8A, 0x4F, 0xFF, 0x1F, 0x8B, 0x5C, 
+    0x5A, 0xF6, 0x40, 0x02, 0x15, 0x4F, 0xEE, 0xF6, 0x8E, 0xF3, 0x17, 0x9D, 0xE8, 0x1B, 0xAC, 
+    0x19, 0xFB, 0x03, 0x1C, 0x53, 0x0F, 0x11, 0x0F, 0xAF, 0xF0, 0x7A, 0x33, 0x4F, 0x12, 0x4A, 
+    0x22, 0x9B, 0x5A, 0x02, 0x23, 0xFF, 0xF3, 0x2E, 0xF6, 0x03, 0xC4, 0x17, 0x4D, 0xFF, 0x21, 
+    0x17, 0x03, 0x4D, 0x0A, 0x01, 0xFF, 0x0A, 0x1A, 0xAC, 0xFA, 0x01, 0x1A, 0x03, 0x1F, 0xFE, 
+    0x1D, 0x02, 0x4C, 0x8C, 0xD7, 0xFF, 0xF0, 0x2F, 0xAF, 0xF0, 0x3B, 0x00, 0x00, 0xAA, 0x4D, 
+    0x00, 0xCA, 0x4F, 0x09, 0x4F, 0x11, 0x21, 0x4F, 0xF0, 0x2F, 0x8C, 0x02, 0x15, 0x4D, 0xFF, 
+    0x21, 0x4C, 0x2B, 0x88, 0x4F, 0x03, 0x17, 0xFF, 0x33, 0x18, 0x2B, 0x5C, 0x79, 0x17, 0xF4, 
+    0x18, 0x5C, 0xFF, 0x19, 0x4C, 0xAF, 0xF0, 0x33, 0x00, 0x03, 0xAF, 0xF0, 0x34, 0x4F, 0x11, 
+    0x19, 0x83, 0x2E, 0x59, 0x15, 0x06, 0x20, 0x4F, 0xF2, 0x2E, 0x1C, 0x9C, 0x17, 0x41, 0xFF, 
+    0x13, 0x2B, 0x8B, 0x8B, 0x5A, 0x4F, 0x07, 0x0D, 0x4C, 0x40, 0x4F, 0x1F, 0x02, 0x8B, 0x19, 
+    0x5C, 0x97, 0x09, 0x2B, 0xD5, 0x02, 0x02, 0x02, 0x7D, 0x08, 0x4D, 0xAF, 0xF0, 0x2F, 0x19, 
+    0xAF, 0xF0, 0x3A, 0x4F, 0x20, 0xA1, 0x00, 0x10, 0x9B, 0x9C, 0x15, 0x15, 0x50, 0x05, 0x5C, 
+    0x4F, 0xF4, 0x2D, 0x00, 0x8B, 0x03, 0x5A, 0x4D, 0x8A, 0x4C, 0xAC, 0x03, 0x5E, 0x4C, 0xFF, 
+    0x03, 0xFF, 0x08, 0xED, 0x03, 0xFF, 0x14, 0x9D, 0x02, 0x02, 0x5C, 0x71, 0x00, 0x04, 0x5C, 
+    0x5A, 0x8C, 0xFF, 0xF2, 0x31, 0xAF, 0x90, 0xFF, 0xF4, 0x31, 0x8B, 0xCA, 0x59, 0xFC, 0x07, 
+    0xCA, 0x4C, 0x26, 0x9C, 0x58, 0x4F, 0xF7, 0x2E, 0x57, 0x0F, 0x02, 0xF6, 0xFF, 0x02, 0x8A, 
+    0x8B, 0x19, 0x5A, 0x4F, 0x8A, 0xBA, 0x03, 0xFF, 0x15, 0xF5, 0xF4, 0x2C, 0xF6, 0x0C, 0x00, 
+    0x01, 0x9D, 0x9E, 0x0A, 0xFB, 0xAF, 0xF1, 0x31, 0xAF, 0x00, 0x9B, 0xAF, 0xF0, 0x35, 0x4F, 
+    0x10, 0x4C, 0x02, 0x01, 0x00, 0x4B, 0x02, 0xC4, 0x9C, 0x58, 0x4F, 0xF6, 0x2F, 0x02, 0x9C, 
+    0x15, 0xFF, 0x02, 0xFF, 0x03, 0x98, 0x1C, 0x9C, 0x4F, 0xFF, 0x05, 0xFF, 0x31, 0x02, 0x5C, 
+    0xFE, 0x01, 0xF5, 0xFC, 0x03, 0x5A, 0xFF, 0x02, 0x4F, 0xB0, 0xF1, 0x2F, 0xFF, 0x04, 0xAF, 
+    0xF0, 0x38, 0x4F, 0x36, 0x13, 0x4A, 0x18, 0x4F, 0x03, 0x58, 0x9C, 0x4F, 0xF9, 0x2F, 0x2E, 
+    0x03, 0x15, 0x68, 0x4D, 0x8A, 0x8B, 0xFF, 0x02, 0x1C, 0xFF, 0x05, 0xFF, 0x27, 0xF5, 0x99, 
+    0xF8, 0x12, 0x18, 0x18, 0x06, 0x05, 0x03, 0x01, 0x18, 0x8B, 0xB0, 0xF1, 0x30, 0xAF, 0xAF, 
+    0xF0, 0x3B, 0xFF, 0x34, 0x4D, 0x01, 0x4F, 0x05, 0x15, 0x50, 0x00, 0xAA, 0xFF, 0xF0, 0x2E, 
+    0x10, 0x58, 0x5A, 0x4F, 0x8B, 0xFF, 0x11, 0x8C, 0x15, 0x4F, 0xE2, 0x8A, 0xFF, 0x03, 0x4D, 
+    0x8E, 0xAC, 0xF6, 0x02, 0xFE, 0x03, 0xFD, 0x08, 0xC0, 0x8A, 0x02, 0x1B, 0x17, 0x18, 0x8C, 
+    0xFF, 0xF4, 0x32, 0xAF, 0x80, 0x3F, 0xFF, 0xF1, 0x30, 0xFF, 0x04, 0x4A, 0x16, 0x4E, 0x00, 
+    0x56, 0x00, 0x4F, 0xF6, 0x2E, 0x8B, 0x9B, 0x86, 0x8A, 0xF7, 0x0C, 0x02, 0x08, 0x4C, 0x15, 
+    0xAC, 0x9D, 0xFF, 0x17, 0xF6, 0x8E, 0xF4, 0x05, 0x00, 0x12, 0x02, 0x06, 0x17, 0x09, 0x0C, 
+    0xFF, 0xF0, 0x30, 0xFF, 0x04, 0xF3, 0xAF, 0xF0, 0x38, 0x4F, 0x12, 0x59, 0x2B, 0xFD, 0x1C, 
+    0x54, 0x00, 0x07, 0x00, 0x4F, 0xF6, 0x2E, 0xE0, 0x02, 0x59, 0x18, 0x4F, 0x03, 0xFF, 0x15, 
+    0xFF, 0x06, 0xFF, 0x19, 0x4D, 0xFF, 0x02, 0x9D, 0xF8, 0x1F, 0x03, 0x15, 0xF5, 0x17, 0x02, 
+    0x01, 0x8C, 0x1E, 0x8E, 0xB1, 0xF1, 0x2E, 0xAF, 0xF0, 0x3B, 0x4F, 0x32, 0x4B, 0x1A, 0x5A, 
+    0x9C, 0x5A, 0x1D, 0x07, 0x00, 0x4C, 0xFF, 0xF4, 0x2E, 0xF4, 0x0C, 0xFF, 0x07, 0x8A, 0x1C, 
+    0x8B, 0x70, 0x15, 0xAC, 0x8A, 0x18, 0xFF, 0x11, 0xFF, 0x22, 0xFF, 0x00, 0xAC, 0x7C, 0x19, 
+    0x8B, 0x04, 0x01, 0xFF, 0xF7, 0x34, 0xAF, 0xF0, 0x38, 0x4F, 0x11, 0x4A, 0x0B, 0x15, 0xA3, 
+    0x51, 0x01, 0x05, 0x00, 0x9C, 0x15, 0x19, 0xFF, 0xF1, 0x2E, 0x03, 0xFF, 0x4B, 0xE0, 0x1C, 
+    0x89, 0xAC, 0x18, 0x18, 0xFF, 0x15, 0xFF, 0x12, 0xFE, 0x08, 0x81, 0xFE, 0x04, 0x19, 0x9D, 
+    0x9D, 0x5A, 0x1C, 0x8C, 0xB0, 0xF0, 0x2F, 0xA3, 0xAF, 0xF0, 0x3B, 0xFF, 0x69, 0x17, 0x15, 
+    0x2B, 0x07, 0x00, 0x15, 0x4F, 0xF3, 0x2E, 0x02, 0x8A, 0xF4, 0x0D, 0x8A, 0x8B, 0x4F, 0x02, 
+    0x4C, 0x8B, 0xD0, 0x2B, 0x4D, 0x18, 0x8B, 0xFF, 0x11, 0x1C, 0xFF, 0x34, 0x05, 0x19, 0x70, 
+    0x5A, 0x9D, 0x9D, 0x17, 0xFF, 0xF3, 0x32, 0xAF, 0xF0, 0x39, 0x4F, 0x23, 0x9C, 0x1C, 0x5A, 
+    0x15, 0x50, 0x01, 0x02, 0x20, 0x9E, 0xF8, 0x2E, 0x2B, 0x9C, 0x18, 0x45, 0xFF, 0x15, 0x29, 
+    0xFF, 0x05, 0x8C, 0x8A, 0x9D, 0xFF, 0x15, 0x2E, 0xD3, 0xFF, 0x45, 0x03, 0x25, 0x9D, 0x18, 
+    0xFF, 0xF2, 0x30, 0x17, 0xFA, 0x19, 0xAF, 0xF0, 0x36, 0xDD, 0x4F, 0x13, 0x03, 0x50, 0x21, 
+    0x50, 0x1C, 0x4F, 0xF5, 0x30, 0x02, 0xF4, 0x0C, 0xFF, 0x1D, 0xA0, 0x4D, 0x19, 0x2B, 0xAC, 
+    0x2B, 0xFF, 0x2A, 0x2E, 0xFE, 0x33, 0xE5, 0x00, 0x08, 0x2B, 0x09, 0x00, 0x18, 0xF6, 0xAF, 
+    0xF9, 0x31, 0xAF, 0xF0, 0x39, 0x00, 0x00, 0x8C, 0x4C, 0xCA, 0x49, 0x20, 0x4F, 0x00, 0x9C, 
+    0x9C, 0x2B, 0x4F, 0xF1, 0x2E, 0xE8, 0x02, 0x03, 0x18, 0xFF, 0x33, 0x8B, 0xFF, 0x08, 0xFF, 
+    0x2D, 0xFF, 0x01, 0xAE, 0x02, 0xFE, 0x1E, 0x03, 0x11, 0x06, 0x02, 0x1C, 0xFF, 0xF5, 0x2F, 
+    0x4C, 0xAC, 0x00, 0x87, 0xAF, 0xF0, 0x37, 0x4F, 0x10, 0x4D, 0x30, 0x2B, 0x2B, 0x58, 0x2B, 
+    0xFF, 0xF0, 0x31, 0x03, 0xFF, 0x0D, 0xFF, 0x13, 0x8B, 0xAC, 0x18, 0x4C, 0x8B, 0x5C, 0x39, 
+    0xFF, 0x11, 0xF6, 0x1B, 0xFB, 0x16, 0xFD, 0x20, 0x05, 0x0C, 0x02, 0x5A, 0xFB, 0x00, 0x52, 
+    0x06, 0xB1, 0x4F, 0x16, 0x8D, 0x0A, 0x00, 0x24, 0xCD, 0x2B, 0x20, 0x30, 0x50, 0x92, 0x4C, 
+    0xAF, 0x02, 0x9B, 0x9B, 0xFE, 0x00, 0x03, 0x03, 0xAF, 0xF0, 0x13, 0x5E, 0x4F, 0x01, 0x30, 
+    0x55, 0x30, 0x02, 0x60, 0x4F, 0x70, 0x8C, 0x47, 0x03, 0x2B, 0x00, 0x9C, 0x9C, 0x9D, 0x17, 
+    0x5A, 0x2B, 0x15, 0x2B, 0x0F, 0x9E, 0xF4, 0x29, 0x54, 0x20, 0xFF, 0x11, 0xFF, 0x0B, 0x9C, 
+    0x8B, 0x19, 0x02, 0x08, 0x4C, 0x02, 0x4C, 0xFF, 0x00, 0x9D, 0x19, 0x9D, 0x2B, 0xA2, 0x02, 
+    0x01, 0x00, 0x9D, 0x9C, 0x9B, 0x06, 0x40, 0xF5, 0xFB, 0xA0, 0xFF, 0x0A, 0x30, 0x10, 0xC0, 
+    0xFE, 0x50, 0x0B, 0x10, 0x03, 0x00, 0x02, 0x30, 0x0B, 0x10, 0x18, 0x10, 0x06, 0x1C, 0xF5, 
+    0x07, 0xFE, 0x00, 0x03, 0x29, 0x03, 0x2B, 0x5A, 0x3F, 0xAF, 0xF0, 0x0E, 0x36, 0x30, 0xFB, 
+    0x00, 0x01, 0x30, 0x04, 0x50, 0x64, 0xA0, 0x4C, 0x9D, 0x08, 0x19, 0x2B, 0x19, 0x50, 0x04, 
+    0x8A, 0x02, 0x9C, 0x2B, 0x26, 0x17, 0x4F, 0xF7, 0x21, 0x31, 0xA0, 0x02, 0x9C, 0xFF, 0x26, 
+    0x8A, 0x1C, 0x20, 0x4C, 0x15, 0x4D, 0x8B, 0x19, 0xFF, 0x02, 0x5C, 0x19, 0xC0, 0x02, 0x9D, 
+    0x9D, 0x9D, 0x9C, 0x9D, 0xB0, 0x05, 0x06, 0x40, 0x30, 0x15, 0xCA, 0x9D, 0x15, 0x0A, 0x06, 
+    0xBF, 0x17, 0x2B, 0x9C, 0xC2, 0x15, 0x0B, 0x00, 0x15, 0x9C, 0x2B, 0x15, 0x37, 0x0D, 0xD6, 
+    0x23, 0x00, 0x15, 0x9C, 0x02, 0x15, 0x15, 0x02, 0x15, 0x03, 0x0F, 0xDF, 0x16, 0x13, 0x00, 
+    0xE1, 0x08, 0x03, 0x00, 0x9D, 0x63, 0x2B, 0x5A, 0xD1, 0xED, 0x16, 0x5A, 0x03, 0x15, 0x4C, 
+    0x00, 0x4C, 0x30, 0x00, 0x01, 0x15, 0x75, 0xAF, 0x30, 0x9B, 0x06, 0x0D, 0x9C, 0x4A, 0x00, 
+    0x00, 0x90, 0x1F, 0x00, 0x2B, 0x1E, 0x17, 0x5A, 0x10, 0x21, 0x17, 0xD4, 0x01, 0x01, 0x00, 
+    0x8A, 0x18, 0x18, 0x48, 0x5A, 0x03, 0x17, 0x4A, 0x00, 0x5A, 0x9D, 0x44, 0x00, 0x9C, 0x10, 
+    0x15, 0x03, 0x5A, 0x9D, 0x04, 0x10, 0x03, 0x5A, 0x2B, 0x11, 0x9D, 0x00, 0x15, 0x19, 0x9C, 
+    0x9A, 0x07, 0x18, 0x2B, 0x5A, 0xB8, 0x9C, 0x5C, 0x17, 0x93, 0x00, 0x00, 0x80, 0x0C, 0x00, 
+    0x8A, 0x02, 0x00, 0x02, 0x9D, 0x06, 0x20, 0x19, 0x9D, 0xCA, 0x9D, 0x63, 0xCB, 0x60, 0xCB, 
+    0xCB, 0x03, 0x15, 0xCB, 0x7C, 0x1D, 0x5D, 0x20, 0xCA, 0x00, 0xCA, 0x9C, 0x63, 0xCB, 0x9C, 
+    0xCA, 0xC9, 0xCA, 0x20, 0x9B, 0xCA, 0xCA, 0xCA, 0xC9, 0x32, 0x10, 0x19, 0x4D, 0x42, 0x19, 
+    0xFF, 0x04, 0x8B, 0x8C, 0x02, 0x4F, 0xFF, 0x02, 0xEE, 0x10, 0x4F, 0x9D, 0x5C, 0x18, 0xF7, 
+    0x16, 0x9D, 0x18, 0x1C, 0x02, 0x02, 0x06, 0x40, 0x19, 0x13, 0xCA, 0x57, 0x14, 0xC9, 0x00, 
+    0x14, 0x14, 0xC9, 0x28, 0x13, 0xC8, 0xC9, 0x9A, 0x00, 0xC8, 0x59, 0xC9, 0x57, 0xCA, 0x13, 
+    0xC9, 0x57, 0x08, 0xC9, 0x14, 0xC8, 0x00, 0x00, 0x9A, 0xC8, 0x14, 0x14, 0x88, 0xCA, 0x59, 
+    0xCA, 0x1E, 0x00, 0xC9, 0x59, 0xCA, 0x23, 0x10, 0xE3, 0x01, 0x90, 0x17, 0x40, 0x9B, 0x5A, 
+    0x15, 0x48, 0x01, 0x3F, 0x01, 0xFE, 0x01, 0x1D, 0xE6, 0x00, 0x14, 0x27, 0x00, 0x01, 0x00, 
+    0x02, 0x00, 0xC8, 0x14, 0xC8, 0xF5, 0x03, 0x00, 0xC9, 0x03, 0x10, 0x14, 0x2A, 0x00, 0x19, 
+    0x00, 0x4A, 0x10, 0x0A, 0x10, 0x69, 0x54, 0x10, 0x63, 0x15, 0x0D, 0x00, 0x15, 0x0D, 0x00, 
+    0x12, 0x00, 0x14, 0xB0, 0xCA, 0x63, 0xC9, 0x59, 0x1E, 0x00, 0x53, 0x20, 0x8A, 0x0A, 0x01, 
+    0x03, 0x02, 0x01, 0xA6, 0x11, 0x5A, 0x18, 0x02, 0xCC, 0xCB, 0xCA, 0xA6, 0xC9, 0x46, 0x00, 
+    0x00, 0x00, 0x14, 0x9A, 0x08, 0x00, 0x13, 0x4E, 0x20, 0x03, 0x80, 0x30, 0x9C, 0x00, 0x9A, 
+    0xC9, 0x9A, 0x9A, 0xC8, 0x56, 0x20, 0xC9, 0x99, 0x13, 0xC8, 0x99, 0x01, 0x30, 0x57, 0xC8, 
+    0x02, 0x56, 0x0F, 0x00, 0x98, 0x99, 0xC8, 0xC8, 0x13, 0xC9, 0xE0, 0x03, 0x9C, 0x1C, 0x8C, 
+    0x4D, 0xFF, 0x05, 0xFF, 0x13, 0x07, 0x50, 0x80, 0x8B, 0x19, 0x5C, 0x9D, 0x2B, 0x9D, 0x03, 
+    0xF8, 0x03, 0xE3, 0xFF, 0x0F, 0x06, 0x30, 0x02, 0x5C, 0x02, 0x12, 0x07, 0x0A, 0x01, 0x17, 
+    0x3F, 0x01, 0x17, 0x00, 0x5C, 0x9D, 0x8B, 0x5C, 0x9C, 0x2B, 0x02, 0x44, 0x9D, 0x03, 0x22, 
+    0x1E, 0x19, 0x8B, 0x02, 0x30, 0x1B, 0x1C, 0x08, 0x8A, 0x5A, 0x8C, 0x30, 0x17, 0x5C, 0x02, 
+    0x1C, 0x5A, 0x09, 0x3B, 0x0C, 0x9D, 0x8A, 0x2F, 0x10, 0x19, 0x19, 0x02, 0x19, 0xB4, 0x18, 
+    0xF5, 0x46, 0x05, 0x02, 0x19, 0x10, 0x9D, 0x01, 0x2B, 0x5B, 0x06, 0x04, 0x02, 0x18, 0x58, 
+    0x02, 0x02, 0x9D, 0x9C, 0x8A, 0x1C, 0x31, 0x3B, 0x02, 0x02, 0x9D, 0x15, 0x6D, 0x1B, 0x6F, 
+    0x2B, 0x19, 0x5C, 0x70, 0x1C, 0x19, 0x1C, 0x17, 0xD7, 0x00, 0x10, 0x20, 0x84, 0x0C, 0x9D, 
+    0x17, 0x82, 0x09, 0x70, 0x10, 0x7F, 0x00, 0x5C, 0x0A, 0x10, 0x18, 0x02, 0x8B, 0x85, 0x16, 
+    0x10, 0x5C, 0xA3, 0x03, 0x8B, 0x02, 0x9D, 0x17, 0x5A, 0x02, 0x03, 0xAB, 0x1C, 0x37, 0x00, 
+    0x19, 0x8B, 0x8B, 0x4C, 0xAC, 0xEE, 0x80, 0xED, 0xAA, 0xA8, 0x48, 0x49, 0x4F, 0x1C, 0xB6, 
+    0x0A, 0x06, 0x8A, 0xBE, 0x18, 0x2A, 0x00, 0x1B, 0x1A, 0x1A, 0x1A, 0x17, 0x00, 0x3F, 0x8B, 
+    0x19, 0x4C, 0x5C, 0x02, 0x4C, 0x19, 0x18, 0x19, 0x1B, 0x4C, 0x08, 0x00, 0x13, 0x00, 0x1B, 
+    0x4C, 0x17, 0x00, 0xCE, 0x4C, 0x4F, 0x8C, 0x4D, 0xAC, 0xAC, 0x4C, 0x28, 0xEE, 0x8B, 0x17, 
+    0xFF, 0x23, 0x03, 0x07, 0x50, 0x4C, 0x19, 0x7E, 0x18, 0xFF, 0x00, 0x70, 0x00, 0xF9, 0x00, 
+    0x06, 0x40, 0x9C, 0x20, 0x0F, 0x1E, 0x8B, 0xC7, 0x0E, 0x10, 0x08, 0x11, 0x1E, 0x1A, 0x5C, 
+    0x9C, 0x19, 0x1E, 0x0F, 0x25, 0x28, 0x52, 0x19, 0xC3, 0x00, 0x5C, 0x19, 0x29, 0x00, 0x1C, 
+    0x3A, 0x0C, 0x19, 0xF6, 0x5A, 0xF6, 0x00, 0x08, 0x11, 0x8A, 0x7F, 0x00, 0xC5, 0x02, 0x47, 
+    0x2D, 0x44, 0x00, 0x1B, 0x33, 0x00, 0x02, 0x00, 0x2B, 0x25, 0x00, 0x00, 0x10, 0x2B, 0x5A, 
+    0x18, 0xE6, 0x9D, 0x06, 0x11, 0x39, 0x00, 0x9D, 0x03, 0x57, 0x00, 0x00, 0x20, 0x17, 0x00, 
+    0xE2, 0x8A, 0x6B, 0x00, 0x19, 0x1C, 0x5A, 0xED, 0x20, 0x12, 0x20, 0xF3, 0x10, 0x07, 0x8E, 
+    0x3D, 0x75, 0x01, 0xFC, 0x10, 0x17, 0x4C, 0x18, 0x8B, 0x17, 0x01, 0xC6, 0x00, 0x18, 0x5C, 
+    0x1B, 0x17, 0x4D, 0x19, 0x5C, 0x08, 0x17, 0x9D, 0x17, 0xAF, 0x15, 0x1B, 0x19, 0x8C, 0xEE, 
+    0x80, 0xEC, 0x47, 0x59, 0x8A, 0x89, 0x89, 0xED, 0xB0, 0x02, 0x13, 0xBD, 0x15, 0x68, 0x01, 
+    0x4C, 0x5C, 0xFE, 0x00, 0x1A, 0x4C, 0x19, 0x82, 0xAC, 0x1E, 0x00, 0x5C, 0x5C, 0x4C, 0x1C, 
+    0x19, 0x02, 0x10, 0xC1, 0x04, 0x01, 0x1B, 0x4C, 0x9D, 0x4C, 0x4D, 0x01, 0x00, 0xED, 0x09, 
+    0x70, 0x4D, 0x8B, 0x9D, 0x17, 0xFC, 0x0D, 0xFA, 0x00, 0x07, 0x50, 0x5C, 0x37, 0x60, 0x03, 
+    0xA9, 0x00, 0x76, 0x00, 0x02, 0x06, 0x40, 0x88, 0x20, 0x8C, 0x4C, 0x5C, 0xAC, 0x8C, 0x1A, 
+    0x02, 0xA3, 0x10, 0xC8, 0x00, 0xF5, 0xD1, 0x00, 0x9D, 0x0A, 0x15, 0x1F, 0x00, 0x02, 0x26, 
+    0x11, 0x5A, 0x9D, 0x18, 0x8A, 0x21, 0x2C, 0x2E, 0x18, 0x5A, 0x19, 0x8B, 0x77, 0x00, 0x19, 
+    0x19, 0x9C, 0x5A, 0x19, 0xF8, 0x10, 0xA1, 0x03, 0xC0, 0x20, 0x18, 0x8A, 0x1A, 0x00, 0x2B, 
+    0x07, 0x01, 0x09, 0x02, 0x1C, 0xFE, 0x00, 0x02, 0x09, 0x11, 0x02, 0x9D, 0xA0, 0x5A, 0x2B, 
+    0x5A, 0x5C, 0x5A, 0x62, 0x06, 0x5A, 0x43, 0x01, 0x6B, 0x2E, 0x20, 0x02, 0x10, 0xF5, 0xF3, 
+    0x10, 0x8B, 0x2C, 0x20, 0x0F, 0x10, 0x19, 0x41, 0x7C, 0x11, 0x18, 0x18, 0x1C, 0x5A, 0x1C, 
+    0x0F, 0x01, 0x9D, 0x03, 0xF8, 0x30, 0x01, 0x01, 0x5C, 0x19, 0x5C, 0x18, 0x4C, 0x18, 0x24, 
+    0x18, 0x8B, 0xD7, 0x00, 0x1B, 0x18, 0x93, 0x10, 0xAA, 0x18, 0x00, 0x1D, 0xED, 0xEC, 0x59, 
+    0x24, 0x06, 0x06, 0x24, 0xA0, 0x22, 0x87, 0xEC, 0x1C, 0x19, 0xB2, 0x10, 0x1B, 0x7A, 0x10, 
+    0x01, 0x01, 0x10, 0x19, 0x5C, 0x1B, 0x4C, 0x1A, 0x19, 0x5C, 0x50, 0xAC, 0x5C, 0x19, 0x1B, 
+    0x0B, 0x01, 0x8C, 0xFD, 0x00, 0x1A, 0x03, 0x36, 0x00, 0xFC, 0x01, 0x4F, 0xAC, 0xEE, 0x4D, 
+    0x8B, 0x1C, 0xB8, 0x8B, 0x4C, 0xEE, 0x0A, 0x01, 0xFF, 0x0C, 0x07, 0x40, 0x5A, 0x00, 0x01, 
+    0x4A, 0x5A, 0xF9, 0x2E, 0x19, 0x06, 0x40, 0x1C, 0x19, 0x1D, 0x05, 0x4D, 0x76, 0x4F, 0x00, 
+    0x00, 0x99, 0x01, 0x2E, 0xBC, 0x00, 0x92, 0x10, 0x90, 0x11, 0x9D, 0xEB, 0xD9, 0x00, 0x2A, 
+    0x1C, 0x02, 0x2F, 0x0A, 0xF5, 0x2B, 0x41, 0xDE, 0x10, 0x11, 0x03, 0x77, 0xF5, 0x10, 0x27, 
+    0x20, 0x20, 0x11, 0x1C, 0xAB, 0x02, 0x0E, 0x00, 0x22, 0x00, 0x1C, 0xFC, 0x2B, 0x17, 0xDD, 
+    0x00, 0x03, 0x22, 0x66, 0x01, 0x69, 0x02, 0xC8, 0x00, 0x30, 0x01, 0xF7, 0xB1, 0x02, 0xCC, 
+    0x00, 0xAB, 0x00, 0xF5, 0xB8, 0x12, 0x0F, 0x20, 0x05, 0x00, 0xC8, 0x02, 0xD3, 0x74, 0x12, 
+    0x7A, 0x22, 0x5A, 0x8C, 0xFB, 0x10, 0xAA, 0xFC, 0x20, 0x00, 0x10, 0x0E, 0x17, 0xD1, 0x21, 
+    0x0D, 0x20, 0x07, 0x11, 0x5C, 0x5C, 0x89, 0xA7, 0x04, 0x24, 0x07, 0x00, 0x00, 0x23, 0x22, 
+    0x20, 0x53, 0x88, 0xCA, 0x4F, 0xC9, 0x07, 0x4C, 0xA3, 0x10, 0x5C, 0x17, 0xC6, 0x2A, 0x3B, 
+    0x11, 0x27, 0x10, 0x01, 0xF8, 0x01, 0xFE, 0x11, 0x1A, 0xAC, 0x08, 0x01, 0x1A, 0x4D, 0x11, 
+    0xFC, 0x00, 0xEE, 0xAC, 0xEE, 0xF6, 0x00, 0x8A, 0x8A, 0x8C, 0x2C, 0x4F, 0xAC, 0x3F, 0x03, 
+    0x07, 0x40, 0x8C, 0x1C, 0x00, 0x1B, 0xCE, 0x60, 0x4C, 0x1C, 0x8C, 0x4C, 0x1C, 0x06, 0x40, 
+    0x04, 0x00, 0x8C, 0x84, 0x4D, 0x8E, 0x2B, 0x02, 0x4F, 0x8C, 0x8B, 0x4C, 0x40, 0x00, 0x40, 
+    0x1B, 0x4C, 0x5C, 0x3F, 0x1B, 0x8B, 0x54, 0x02, 0x8B, 0x96, 0x17, 0x3E, 0x00, 0x69, 0x00, 
+    0x3F, 0x05, 0x10, 0x8B, 0x8C, 0x09, 0x30, 0x73, 0x0A, 0x10, 0x09, 0x00, 0x4C, 0x5C, 0x14, 
+    0x20, 0x10, 0x30, 0x76, 0x03, 0xAA, 0x31, 0x3B, 0x00, 0x8B, 0x4C, 0x19, 0x14, 0x00, 0x02, 
+    0x10, 0x8B, 0x5C, 0xFA, 0x8B, 0xBB, 0x10, 0x18, 0x03, 0x10, 0x10, 0x00, 0x94, 0x00, 0xA5, 
+    0x02, 0x3E, 0x00, 0x97, 0x6C, 0x00, 0x00, 0x00, 0xA5, 0x10, 0x1B, 0x06, 0x00, 0x1A, 0xAA, 
+    0x16, 0x00, 0xA2, 0x1B, 0x04, 0x00, 0x1A, 0x4C, 0x5C, 0x06, 0x20, 0x1A, 0xB9, 0x10, 0x22, 
+    0x17, 0x07, 0x00, 0x17, 0x1B, 0x17, 0xCE, 0x10, 0x17, 0x1B, 0x18, 0x1B, 0x17, 0x19, 0x74, 
+    0x03, 0xE8, 0x00, 0xED, 0xEC, 0xA6, 0x00, 0xA6, 0xA6, 0x85, 0x25, 0x59, 0xA7, 0x89, 0x61, 
+    0x1C, 0x47, 0xEE, 0x6F, 0x00, 0x1F, 0x11, 0xFA, 0x10, 0x02, 0x19, 0x1A, 0x3D, 0x02, 0x01, 
+    0x15, 0xC9, 0x01, 0x3B, 0x10, 0x0B, 0x13, 0x8F, 0x00, 0x1B, 0x1B, 0x14, 0x1B, 0x4F, 0xEA, 
+    0x05, 0x4F, 0xEF, 0x00, 0xEE, 0x03, 0x26, 0x2C, 0x59, 0x03, 0x0A, 0x04, 0x07, 0x50, 0xAC, 
+    0xE7, 0x11, 0x4D, 0x4D, 0xEF, 0xEE, 0x11, 0x05, 0x00, 0x06, 0x20, 0x01, 0x00, 0x4C, 0x2A, 
+    0x20, 0x1E, 0x18, 0x0F, 0x10, 0xFF, 0x06, 0x30, 0x17, 0x10, 0x10, 0x40, 0x27, 0x10, 0x0E, 
+    0x10, 0x12, 0x40, 0x01, 0x20, 0x0D, 0x60, 0xDA, 0xEE, 0x00, 0x00, 0x4C, 0x04, 0x40, 0x02, 
+    0x00, 0x4D, 0x0A, 0x10, 0x00, 0xF0, 0x00, 0xFD, 0x16, 0x00, 0x4C, 0x03, 0x10, 0x01, 0x00, 
+    0x06, 0x00, 0x24, 0x10, 0x06, 0x40, 0x30, 0x50, 0x27, 0x37, 0x60, 0x1B, 0x20, 0x94, 0x02, 
+    0x1B, 0xAA, 0xCF, 0x13, 0x1C, 0x17, 0x22, 0x4C, 0x7D, 0x05, 0x1C, 0x8B, 0xEC, 0x00, 0x00, 
+    0xA9, 0x57, 0x80, 0xA6, 0x58, 0x4C, 0xA6, 0xA6, 0x47, 0xED, 0x1D, 0x00, 0xEB, 0xEC, 0x11, 
+    0xF8, 0x00, 0x9D, 0xF5, 0x04, 0x17, 0xD1, 0x02, 0x09, 0x33, 0x13, 0x11, 0x32, 0x4C, 0x09, 
+    0x03, 0x1A, 0x1A, 0xE6, 0x20, 0xFD, 0x03, 0xAC, 0xAC, 0x80, 0x2E, 0x89, 0x2B, 0x19, 0x4C, 
+    0x4F, 0x1C, 0x07, 0x60, 0xCF, 0xE8, 0x22, 0xB7, 0x20, 0x06, 0x60, 0x0B, 0x30, 0xEE, 0x4B, 
+    0x0A, 0x50, 0xDD, 0x10, 0xBF, 0xE8, 0x30, 0x09, 0x30, 0x0B, 0x00, 0x15, 0x00, 0x02, 0xC0, 
+    0x29, 0x20, 0xEE, 0x1A, 0x21, 0xFF, 0x09, 0x31, 0x2C, 0x31, 0x04, 0x30, 0x00, 0xA0, 0x16, 
+    0x50, 0x50, 0x51, 0x56, 0x61, 0x2B, 0xF0, 0x01, 0x15, 0x00, 0x60, 0xEE, 0x85, 0x02, 0x5C, 
+    0x0B, 0x02, 0x19, 0x19, 0x19, 0x01, 0x31, 0x06, 0x17, 0xAC, 0xEC, 0xEC, 0x47, 0xEC, 0x58, 
+    0x00, 0xA4, 0xA5, 0x53, 0x26, 0x85, 0x85, 0x47, 0xED, 0xE2, 0x4C, 0x00, 0x01, 0x1C, 0x17, 
+    0x8C, 0x05, 0x00, 0x19, 0x02, 0xA3, 0x26, 0xCF, 0xB4, 0x16, 0x08, 0x00, 0x00, 0x10, 0x5B, 
+    0x02, 0x1B, 0x19, 0xFF, 0x00, 0xA0, 0x00, 0x94, 0x4D, 0x8B, 0x00, 0x01, 0xAC, 0x4E, 0x01, 
+    0x8C, 0x17, 0x07, 0x50, 0xCF, 0xE3, 0x21, 0xD1, 0x31, 0x06, 0x50, 0xF1, 0x30, 0x4F, 0x4C, 
+    0x07, 0x10, 0x0F, 0x30, 0xFF, 0x22, 0x80, 0xFB, 0x20, 0x07, 0x21, 0x06, 0x41, 0x17, 0x52, 
+    0x00, 0x42, 0x06, 0x11, 0x15, 0x30, 0xBF, 0x0E, 0x11, 0x05, 0x10, 0x56, 0x12, 0x00, 0xA0, 
+    0x43, 0x41, 0x35, 0x42, 0xEE, 0x83, 0x09, 0xDF, 0x12, 0x40, 0x06, 0x20, 0x29, 0xB0, 0x4D, 
+    0x20, 0x80, 0x20, 0x4F, 0xBB, 0x13, 0xD3, 0x11, 0x08, 0x1C, 0x19, 0x19, 0xB4, 0x07, 0x8A, 
+    0x47, 0xA5, 0x59, 0x00, 0x29, 0x88, 0xA5, 0x83, 0x53, 0xA7, 0xA6, 0xEC, 0x81, 0xFF, 0x01, 
+    0x57, 0x1C, 0x56, 0x5C, 0x9B, 0x59, 0xF1, 0x20, 0x00, 0x9B, 0x18, 0x9B, 0x9D, 0x9B, 0x59, 
+    0x9D, 0x9A, 0x02, 0x58, 0x03, 0x00, 0x18, 0x9B, 0x59, 0x59, 0x9B, 0x9B, 0x30, 0x59, 0x17, 
+    0x19, 0x5C, 0xBB, 0x20, 0xEE, 0x03, 0xAC, 0x8B, 0xA0, 0x4D, 0x4D, 0xED, 0xEE, 0x19, 0x07, 
+    0x60, 0x1C, 0x92, 0x51, 0xFF, 0xCD, 0x82, 0xDF, 0x42, 0xEC, 0x52, 0xE6, 0x50, 0x87, 0x50, 
+    0xED, 0x70, 0x13, 0x40, 0x13, 0x42, 0xFF, 0xF4, 0x40, 0xB5, 0x30, 0x05, 0x50, 0x0A, 0x40, 
+    0xDA, 0x71, 0x2A, 0x30, 0x15, 0x40, 0x62, 0x60, 0xFF, 0x52, 0x62, 0x0C, 0x40, 0x7B, 0x70, 
+    0x34, 0x30, 0x1E, 0x31, 0xE7, 0x01, 0xE1, 0x04, 0x05, 0x03, 0x00, 0x19, 0x8B, 0xED, 0x47, 
+    0x86, 0x59, 0x26, 0x05, 0x08, 0x04, 0x87, 0x58, 0x07, 0x03, 0xEE, 0x19, 0x17, 0x59, 0x30, 
+    0x19, 0x9A, 0x9C, 0x9B, 0x59, 0x06, 0x24, 0x02, 0x9B, 0x59, 0x00, 0x9B, 0x59, 0x58, 0x9B, 
+    0x5A, 0x9A, 0x14, 0x59, 0x60, 0x1C, 0x9A, 0x19, 0x58, 0x58, 0x89, 0x0C, 0x3A, 0x07, 0x1B, 
+    0x05, 0xFE, 0x21, 0x8C, 0xF6, 0x04, 0x9D, 0x8A, 0x5A, 0xAC, 0xAC, 0x74, 0x8C, 0x4C, 0x07, 
+    0x50, 0x8B, 0xE7, 0x90, 0x7E, 0x80, 0xFE, 0x04, 0x4D, 0xFF, 0x99, 0x01, 0xA7, 0x71, 0x25, 
+    0x40, 0x19, 0x23, 0x0C, 0x20, 0x09, 0x10, 0x17, 0x20, 0xA6, 0x71, 0xFF, 0x18, 0x51, 0x16, 
+    0x42, 0x24, 0x40, 0x24, 0x52, 0xF3, 0x10, 0x19, 0x60, 0x3F, 0x71, 0x7E, 0x41, 0x9F, 0x4B, 
+    0x61, 0x46, 0x31, 0xFE, 0x41, 0x30, 0x52, 0x8A, 0x42, 0x4F, 0x4C, 0x75, 0x05, 0x08, 0x8B, 
+    0x5C, 0x1A, 0xB9, 0x0B, 0x47, 0x84, 0x85, 0x26, 0x00, 0x05, 0x26, 0xA7, 0xA9, 0xEC, 0x47, 
+    0xED, 0x4F, 0x00, 0x8B, 0x4C, 0x58, 0x5A, 0x9A, 0x19, 0x5A, 0x59, 0x79, 0x5A, 0x17, 0x5C, 
+    0x58, 0x01, 0x11, 0xFF, 0x00, 0x0D, 0x00, 0xFF, 0x01, 0x19, 0x9D, 0x00, 0x01, 0x18, 0x13, 
+    0x07, 0x87, 0x10, 0xFE, 0x12, 0x8B, 0x8B, 0x3C, 0x01, 0x3F, 0xF7, 0x10, 0x07, 0x40, 0x02, 
+    0x1E, 0xFC, 0xA1, 0xEE, 0x51, 0x2A, 0x00, 0xAC, 0x8C, 0xFF, 0x15, 0x40, 0x0B, 0x16, 0x83, 
+    0x50, 0x87, 0x20, 0xB2, 0x12, 0x2B, 0x50, 0x56, 0x16, 0xE8, 0x02, 0xFF, 0x1A, 0x20, 0x30, 
+    0x21, 0x2D, 0x60, 0x70, 0x07, 0x42, 0x11, 0x54, 0x61, 0x53, 0x21, 0xDE, 0x51, 0xFF, 0x21, 
+    0x10, 0x1F, 0x00, 0x4A, 0x10, 0x68, 0x21, 0x9E, 0x07, 0x3A, 0x15, 0x51, 0x10, 0x0A, 0x00, 
+    0x7B, 0x0F, 0x30, 0x6E, 0x41, 0xEE, 0xAE, 0x05, 0x31, 0x42, 0x01, 0x00, 0xDD, 0x19, 0x1A, 
+    0x00, 0x19, 0x8B, 0xA9, 0x83, 0xA4, 0x85, 0xA8, 0xA8, 0xD2, 0x48, 0xFE, 0x00, 0xEE, 0x89, 
+    0xF8, 0x13, 0x15, 0x53, 0x08, 0x27, 0x07, 0xAF, 0x42, 0x29, 0x00, 0x60, 0x2E, 0x12, 0x00, 
+    0x10, 0x5C, 0xFF, 0x20, 0x8B, 0xFF, 0x10, 0x7A, 0x19, 0x96, 0x06, 0x4C, 0xFF, 0x00, 0x07, 
+    0x50, 0x7C, 0x0D, 0x1A, 0x00, 0xF6, 0xD7, 0x83, 0x20, 0x06, 0x30, 0x79, 0x00, 0xAC, 0x55, 
+    0x0A, 0x4C, 0x02, 0x00, 0x0D, 0x10, 0xFF, 0x23, 0x06, 0x00, 0x30, 0x0A, 0x80, 0x00, 0x30, 
+    0xE6, 0x35, 0xA0, 0x05, 0xD0, 0x20, 0x13, 0x30, 0xC5, 0x32, 0x00, 0x4C, 0x1F, 0x70, 0x4F, 
+    0x4C, 0x4D, 0x73, 0x0A, 0x06, 0x00, 0xE1, 0x18, 0x00, 0x4D, 0x4C, 0x4C, 0xAC, 0x02, 0x00, 
+    0x24, 0x01, 0x12, 0x10, 0x6D, 0x13, 0x10, 0x4B, 0x10, 0x00, 0x01, 0x10, 0x4F, 0x04, 0x17, 
+    0x00, 0x00, 0x4B, 0x9C, 0xEE, 0x4D, 0x0F, 0x20, 0x33, 0x00, 0x01, 0x00, 0x4B, 0xEE, 0xA5, 
+    0x02, 0x7F, 0x34, 0x20, 0x2F, 0x00, 0x0A, 0x00, 0x1B, 0x11, 0x3C, 0x31, 0xC5, 0x02, 0xD5, 
+    0x04, 0x4C, 0x10, 0x54, 0x88, 0xA8, 0x47, 0xFD, 0x21, 0x19, 0x1C, 0x8A, 0x4F, 0xF4, 0x05, 
+    0xFD, 0x28, 0x1E, 0x05, 0xF4, 0x15, 0x4D, 0x19, 0x03, 0x08, 0x19, 0xFF, 0x2E, 0x0B, 0x29, 
+    0x1A, 0x1A, 0x07, 0xFF, 0x16, 0x39, 0x01, 0xED, 0x07, 0x43, 0x26, 0x51, 0x00, 0xB1, 0x07, 
+    0x50, 0x4D, 0x1F, 0x1F, 0x1A, 0x10, 0x62, 0x01, 0x4C, 0x6F, 0x01, 0xFB, 0x06, 0x20, 0x91, 
+    0x06, 0x4C, 0xFC, 0x01, 0x01, 0x10, 0x75, 0x00, 0x92, 0x10, 0x03, 0x10, 0xDA, 0xEE, 0x02, 
+    0x20, 0x4D, 0x04, 0x10, 0x15, 0x00, 0x4B, 0x9C, 0x46, 0x3C, 0x11, 0x9F, 0xBF, 0x3E, 0xE1, 
+    0xF6, 0x02, 0xD8, 0x66, 0x14, 0xB0, 0x1A, 0xF0, 0x07, 0x4D, 0x8E, 0x3D, 0x01, 0xE8, 0x4B, 
+    0xEE, 0x4B, 0x5F, 0x10, 0x4B, 0x65, 0x10, 0x03, 0x10, 0x0D, 0x00, 0x1F, 0x06, 0x00, 0x89, 
+    0x10, 0x23, 0x57, 0xA6, 0x00, 0x9C, 0x11, 0xCE, 0x4C, 0x49, 0x00, 0xED, 0xED, 0xEE, 0x8E, 
+    0x8C, 0x1B, 0x4B, 0xAA, 0xE5, 0x92, 0x00, 0xAA, 0x11, 0x01, 0x4C, 0xAA, 0x01, 0x40, 0x09, 
+    0x10, 0x03, 0x30, 0xDF, 0x05, 0x50, 0xA4, 0x01, 0xC5, 0x00, 0x46, 0x00, 0x00, 0x00, 0x4A, 
+    0x0B, 0x09, 0x07, 0x50, 0xFB, 0x7E, 0x23, 0xFD, 0xF0, 0xE8, 0x4D, 0xBF, 0x20, 0x9E, 0x65, 
+    0x06, 0x30, 0xDA, 0x68, 0x13, 0x50, 0xF7, 0xE8, 0x20, 0xA5, 0x97, 0x02, 0x00, 0x8E, 0x00, 
+    0x20, 0x06, 0x50, 0x5F, 0x38, 0x00, 0xF0, 0x18, 0xFF, 0x2F, 0xB0, 0x82, 0x12, 0x51, 0x10, 
+    0x07, 0x00, 0x50, 0x55, 0x93, 0xB6, 0x9A, 0x80, 0xAF, 0x86, 0x3F, 0xA5, 0x76, 0x2C, 0xA6, 
+    0x00, 0xF0, 0x0A, 0x23, 0x20, 0xAF, 0x00, 0x07, 0x50, 0x8E, 0x4F
 };
 
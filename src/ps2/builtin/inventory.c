@@ -5,6560 +5,547 @@ typedef unsigned char byte;
 const int inventory_width  = 256;
 const int inventory_height = 192;
 const int inventory_size_bytes = 98304;
-const byte inventory_data[] __attribute__((aligned(16))) = {
-    0x6B, 0xA1, 0x8C, 0xA1, 0xCE, 0xA9, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0xEB, 0x99, 0xEB, 
-    0x99, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 
-    0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 
-    0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0xCC, 0xA1, 0x8A, 0x99, 0xAB, 0x9D, 0xCC, 0xA1, 0xCC, 0xA1, 
-    0xCC, 0xA1, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 
-    0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 
-    0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 
-    0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x2F, 0xAA, 
-    0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x2F, 0xAA, 0x0E, 0xA6, 0xCC, 0xA1, 0x0E, 
-    0xA6, 0xAB, 0x9D, 0xAB, 0x9D, 0xCC, 0xA1, 0xAB, 0x9D, 0xAB, 0x9D, 0xAB, 0x9D, 0xCC, 0xA1, 
-    0xCC, 0xA1, 0xCC, 0xA1, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 
-    0xA6, 0x0E, 0xA6, 0xAB, 0x9D, 0xCC, 0xA1, 0xCC, 0xA1, 0xCC, 0xA1, 0xAB, 0x9D, 0xAB, 0x9D, 
-    0xAB, 0x9D, 0xAB, 0x9D, 0xAB, 0x9D, 0xCC, 0xA1, 0xAB, 0x9D, 0xAB, 0x9D, 0x8A, 0x99, 0x8A, 
-    0x99, 0x8A, 0x99, 0xAB, 0x9D, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0xCC, 0xA1, 
-    0x0E, 0xA6, 0xCC, 0xA1, 0xCC, 0xA1, 0xAB, 0x9D, 0xCC, 0xA1, 0xCC, 0xA1, 0xCC, 0xA1, 0xCC, 
-    0xA1, 0xCC, 0xA1, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 
-    0x0E, 0xA6, 0x0E, 0xA6, 0xCC, 0xA1, 0xCC, 0xA1, 0xCC, 0xA1, 0xCC, 0xA1, 0xCC, 0xA1, 0xCC, 
-    0xA1, 0xCC, 0xA1, 0xAB, 0x9D, 0xAB, 0x9D, 0xAB, 0x9D, 0xCC, 0xA1, 0xCC, 0xA1, 0xCC, 0xA1, 
-    0xCC, 0xA1, 0x8A, 0x99, 0xAB, 0x9D, 0xCC, 0xA1, 0xCC, 0xA1, 0xAB, 0x9D, 0x8A, 0x99, 0xEB, 
-    0x99, 0xAB, 0x9D, 0x8A, 0x99, 0xAB, 0x9D, 0xEB, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 
-    0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 
-    0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x8A, 0x99, 0x69, 0x91, 
-    0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x8A, 0x99, 0xAB, 0x9D, 0xAB, 0x9D, 0xAB, 0x9D, 0x8A, 
-    0x99, 0xAB, 0x9D, 0xAB, 0x9D, 0x8A, 0x99, 0xAB, 0x9D, 0x8A, 0x99, 0xAB, 0x9D, 0x8A, 0x99, 
-    0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0xAB, 0x9D, 0xAB, 0x9D, 0xAB, 0x9D, 0x8A, 
-    0x99, 0x8A, 0x99, 0x8A, 0x99, 0xAB, 0x9D, 0x8A, 0x99, 0xAB, 0x9D, 0x8A, 0x99, 0x8A, 0x99, 
-    0x8A, 0x99, 0xAB, 0x9D, 0xAB, 0x9D, 0xAB, 0x9D, 0x92, 0x8D, 0xCC, 0xA1, 0xEB, 0x99, 0xAB, 
-    0x9D, 0xAB, 0x9D, 0x0E, 0xA6, 0xAB, 0x9D, 0xAB, 0x9D, 0xAB, 0x9D, 0xAB, 0x9D, 0xAB, 0x9D, 
-    0xCC, 0xA1, 0xCC, 0xA1, 0x92, 0x8D, 0xCC, 0xA1, 0xEB, 0x99, 0x92, 0x8D, 0xAB, 0x9D, 0xCC, 
-    0xA1, 0xCC, 0xA1, 0x92, 0x8D, 0xCC, 0xA1, 0xEB, 0x99, 0xCC, 0xA1, 0xEB, 0x99, 0x8A, 0x99, 
-    0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x29, 0x9D, 0x6B, 0xA1, 0x29, 0x9D, 0x6B, 
-    0xA1, 0x29, 0x9D, 0x4D, 0x9D, 0xCC, 0xA1, 0xEB, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 
-    0x8A, 0x99, 0x8A, 0x99, 0x29, 0x9D, 0x6B, 0xA1, 0x29, 0x9D, 0x6B, 0xA1, 0x29, 0x9D, 0x4D, 
-    0x9D, 0x4D, 0x9D, 0x4D, 0x9D, 0x4D, 0x9D, 0x4D, 0x9D, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 
-    0x64, 0x94, 0xAD, 0xA5, 0xAD, 0xA5, 0x6B, 0xA1, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0x9D, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 
-    0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 
-    0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0x8A, 0x99, 0x69, 0x91, 0x69, 0x91, 0xEB, 0x99, 
-    0x8A, 0x99, 0x69, 0x91, 0x2C, 0x91, 0x8A, 0x99, 0xEB, 0x99, 0x2E, 0x89, 0xEB, 0x99, 0xEB, 
-    0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xAB, 0x9D, 0xEB, 0x99, 0x92, 0x8D, 
-    0xEB, 0x99, 0xEB, 0x99, 0xCC, 0xA1, 0xEB, 0x99, 0x92, 0x8D, 0x2B, 0x9A, 0xEB, 0x99, 0x92, 
-    0x8D, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0x92, 0x8D, 0x2B, 0x9A, 
-    0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 
-    0x99, 0xEB, 0x99, 0x69, 0x91, 0x8A, 0x99, 0x69, 0x91, 0x8A, 0x99, 0x69, 0x91, 0x8A, 0x99, 
-    0x69, 0x91, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0x8A, 0x99, 0xEB, 0x99, 0xAB, 0x9D, 0xEB, 
-    0x99, 0x92, 0x8D, 0xEB, 0x99, 0xEB, 0x99, 0x8A, 0x99, 0xEB, 0x99, 0x69, 0x91, 0x8A, 0x99, 
-    0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x69, 0x91, 0x69, 
-    0x91, 0x69, 0x91, 0x69, 0x91, 0x8A, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 
-    0xEB, 0x99, 0xEB, 0x99, 0xAB, 0x9D, 0xEB, 0x99, 0x8A, 0x99, 0xAB, 0x9D, 0xEB, 0x99, 0xAB, 
-    0x9D, 0xEB, 0x99, 0x8A, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xEB, 0x99, 0xAB, 0x9D, 0xEB, 0x99, 
-    0xEB, 0x99, 0xEB, 0x99, 0x2E, 0x89, 0xEB, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 
-    0x99, 0xEB, 0x99, 0xEB, 0x99, 0x8A, 0x99, 0x69, 0x91, 0x8A, 0x99, 0x8A, 0x99, 0x69, 0x91, 
-    0x69, 0x91, 0x69, 0x91, 0x8A, 0x99, 0x69, 0x91, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 0x99, 0x8A, 
-    0x99, 0x8A, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x6B, 0xA1, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x69, 0x91, 0x69, 0x91, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x0A, 0x99, 0x6B, 0xA1, 0x0B, 
-    0x99, 0x6B, 0xA1, 0x2C, 0x9D, 0x0B, 0x99, 0x0B, 0x99, 0x29, 0x9D, 0x0B, 0x99, 0x29, 0x9D, 
-    0x6B, 0xA1, 0x08, 0x99, 0x6B, 0xA1, 0x0A, 0x99, 0x29, 0x9D, 0x6B, 0xA1, 0x0B, 0x99, 0x29, 
-    0x9D, 0x0B, 0x99, 0x6B, 0xA1, 0x0A, 0x99, 0x29, 0x9D, 0x6B, 0xA1, 0x29, 0x9D, 0x29, 0x9D, 
-    0x6B, 0xA1, 0x0B, 0x99, 0x29, 0x9D, 0x2C, 0x9D, 0x29, 0x9D, 0x6B, 0xA1, 0x29, 0x9D, 0x6B, 
-    0xA1, 0x2C, 0x9D, 0x6B, 0xA1, 0x2C, 0x9D, 0x6B, 0xA1, 0x2C, 0x9D, 0x6B, 0xA1, 0x2C, 0x9D, 
-    0x69, 0x91, 0x8A, 0x99, 0x69, 0x91, 0x69, 0x91, 0x8A, 0x99, 0x69, 0x91, 0x8A, 0x99, 0x69, 
-    0x91, 0xEB, 0x99, 0x69, 0x91, 0x69, 0x91, 0x8A, 0x99, 0x69, 0x91, 0xEB, 0x99, 0x69, 0x91, 
-    0x69, 0x91, 0x69, 0x91, 0x27, 0x8D, 0x69, 0x91, 0x27, 0x8D, 0x27, 0x8D, 0x69, 0x91, 0x27, 
-    0x8D, 0x69, 0x91, 0x69, 0x91, 0x8A, 0x99, 0xEB, 0x99, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 
-    0x27, 0x8D, 0x69, 0x91, 0x27, 0x8D, 0x27, 0x8D, 0x69, 0x91, 0x27, 0x8D, 0x69, 0x91, 0x69, 
-    0x91, 0x8A, 0x99, 0x8A, 0x99, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x08, 0x99, 0x08, 0x99, 
-    0xC6, 0x94, 0x63, 0x8C, 0x6B, 0xA1, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0x9D, 0x29, 0x9D, 0xAD, 0xA5, 0x6B, 0xA1, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x0A, 0x99, 0x0A, 0x99, 0x08, 0x99, 0xC8, 0x90, 0x29, 0x9D, 
-    0x29, 0x9D, 0xC9, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x27, 0x8D, 0x08, 0x99, 0x29, 0x9D, 0x08, 
-    0x99, 0x0A, 0x99, 0x29, 0x9D, 0x0A, 0x99, 0x0B, 0x99, 0x08, 0x99, 0x0A, 0x99, 0x0A, 0x99, 
-    0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x0B, 0x99, 0x69, 0x91, 0x29, 0xA5, 0x08, 0x99, 0x29, 
-    0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x0A, 0x99, 0x0B, 0x99, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0x9D, 0x0B, 0x99, 0x0B, 0x99, 0x6B, 0xA1, 0x0B, 0x99, 0x0B, 0x99, 0x0B, 0x99, 0x29, 
-    0x9D, 0x0A, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC9, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0xEA, 0x94, 0xEA, 
-    0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x0A, 0x99, 0xEA, 0x94, 
-    0xEA, 0x94, 0xEA, 0x94, 0xEA, 0x94, 0xEA, 0x94, 0x08, 0x99, 0xEA, 0x94, 0x08, 0x99, 0xEA, 
-    0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xEA, 0x94, 0x0A, 0x99, 0x08, 0x99, 
-    0x0A, 0x99, 0xEA, 0x94, 0xEA, 0x94, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0xEA, 0x94, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xE5, 0x84, 0xA5, 
-    0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC8, 0x90, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC8, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x27, 0x8D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0xC8, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0x27, 0x8D, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 
-    0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 
-    0xE7, 0x9C, 0x08, 0x99, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 
-    0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 
-    0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0x08, 0x99, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC9, 
-    0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0xC9, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC9, 0x94, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 
-    0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 
-    0x9D, 0xE7, 0x9C, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 
-    0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0xE7, 0x9C, 0x08, 0x99, 0x29, 0x9D, 
-    0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0xE7, 0x9C, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 
-    0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 
-    0x29, 0x9D, 0x29, 0xA5, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 
-    0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0xE7, 0x9C, 0xC7, 0x98, 0xE7, 0x9C, 0xE7, 
-    0x9C, 0xA5, 0x94, 0xA5, 0x94, 0xA5, 0x94, 0xA5, 0x94, 0xA5, 0x94, 0xA5, 0x94, 0xA5, 0x94, 
-    0xA5, 0x94, 0xA5, 0x94, 0xA5, 0x94, 0xA5, 0x94, 0xA5, 0x94, 0xA5, 0x94, 0xA5, 0x94, 0xA5, 
-    0x94, 0xA5, 0x94, 0xA5, 0x94, 0xA5, 0x94, 0xA5, 0x94, 0xA5, 0x94, 0xA5, 0x94, 0xA5, 0x94, 
-    0xA5, 0x94, 0xA5, 0x94, 0xA5, 0x94, 0xC6, 0x94, 0xC7, 0x98, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 
-    0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 
-    0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 
-    0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 
-    0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 
-    0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xA5, 0x90, 0x63, 
-    0x8C, 0x63, 0x8C, 0x63, 0x8C, 0xA5, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x63, 0x88, 
-    0x63, 0x8C, 0x63, 0x8C, 0xA5, 0x90, 0x08, 0x99, 0xC6, 0x94, 0x84, 0x90, 0x63, 0x88, 0x63, 
-    0x88, 0x63, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 
-    0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 
-    0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x29, 0x9D, 0x29, 0x9D, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 
-    0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 0x86, 0x8C, 0x85, 0x88, 
-    0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 
-    0x9D, 0x08, 0x99, 0x29, 0x9D, 0xE7, 0x9C, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 
-    0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 
-    0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0xE8, 0xA0, 0x29, 0x9D, 0x08, 0x99, 
-    0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0xE8, 
-    0xA0, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0xA5, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 
-    0x29, 0x9D, 0xE7, 0x9C, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 
-    0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xE7, 0x9C, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0xE7, 0x9C, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 
-    0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0xC9, 0x94, 0x08, 0x99, 0xE7, 
-    0x9C, 0x6B, 0xB1, 0xAD, 0xB5, 0xEF, 0xBD, 0xEF, 0xBD, 0xEF, 0xBD, 0xEF, 0xBD, 0xEF, 0xBD, 
-    0xEF, 0xBD, 0xEF, 0xBD, 0xEF, 0xBD, 0xEF, 0xBD, 0xEF, 0xBD, 0xEF, 0xBD, 0xEF, 0xBD, 0xEF, 
-    0xBD, 0xEF, 0xBD, 0xEF, 0xBD, 0xEF, 0xBD, 0xEF, 0xBD, 0xEF, 0xBD, 0xEF, 0xBD, 0xEF, 0xBD, 
-    0xEF, 0xBD, 0xAD, 0xB5, 0x2A, 0xAD, 0x09, 0xA5, 0xA5, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 
-    0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC8, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC8, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 
-    0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 
-    0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0x08, 0x99, 0xC9, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x63, 
-    0x8C, 0x42, 0x84, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x08, 0x99, 0xC6, 0x94, 0x84, 0x90, 
-    0x42, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x08, 0x99, 0xC6, 0x94, 0x63, 0x8C, 0x21, 
-    0x84, 0x00, 0x80, 0x00, 0x80, 0x63, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 
-    0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xA7, 
-    0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xC6, 0x94, 0x08, 0x99, 0x29, 0x9D, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 
-    0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 
-    0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x86, 0x8C, 0x23, 0x84, 0x03, 0x80, 
-    0x24, 0x80, 0x44, 0x84, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0xA5, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0xE8, 
-    0xA0, 0x29, 0x9D, 0x29, 0xA5, 0x29, 0x9D, 0x29, 0xA5, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 
-    0xE8, 0xA0, 0x29, 0x9D, 0x29, 0xA5, 0x29, 0x9D, 0x29, 0x9D, 0xE8, 0xA0, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0xA5, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0xA5, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 
-    0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xE7, 0x9C, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 
-    0x99, 0x08, 0x99, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 
-    0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0xE8, 0xA0, 0xE7, 
-    0x9C, 0xAD, 0xB5, 0x31, 0xC6, 0xF7, 0xDE, 0xF7, 0xDE, 0xF7, 0xDE, 0xF7, 0xDE, 0xF7, 0xDE, 
-    0xF7, 0xDE, 0xF7, 0xDE, 0xF7, 0xDE, 0xF7, 0xDE, 0xF7, 0xDE, 0xF7, 0xDE, 0xF7, 0xDE, 0xF7, 
-    0xDE, 0xF7, 0xDE, 0xF7, 0xDE, 0xF7, 0xDE, 0xF7, 0xDE, 0xF7, 0xDE, 0xF7, 0xDE, 0xF7, 0xDE, 
-    0xF7, 0xDE, 0x73, 0xCE, 0xAD, 0xB5, 0xEF, 0xBD, 0xAD, 0xB5, 0x6B, 0xAD, 0xA5, 0x94, 0xA5, 
-    0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 
-    0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC8, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0x08, 0x99, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 
-    0x99, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 
-    0x99, 0x85, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xA7, 0x88, 0xC6, 0x94, 0x08, 0x99, 
-    0x85, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xA7, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0x85, 
-    0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x86, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x86, 
-    0x88, 0x03, 0x80, 0x03, 0x80, 0x25, 0x80, 0x25, 0x80, 0xA7, 0x88, 0xC6, 0x94, 0x29, 0x9D, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 
-    0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 
-    0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0xC6, 0x94, 0x65, 0x88, 0x01, 0x80, 
-    0x02, 0x80, 0x42, 0x88, 0x00, 0x80, 0x63, 0x88, 0xE7, 0x9C, 0x08, 0x99, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 
-    0x29, 0x9D, 0x29, 0xA5, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0xA5, 0x08, 
-    0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 
-    0x99, 0x29, 0xA5, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 0x08, 
-    0x99, 0xC6, 0x94, 0x29, 0x9D, 0x29, 0xA5, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0xC6, 0x94, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0xE8, 0xA0, 0x08, 
-    0x99, 0x2A, 0xAD, 0x31, 0xC6, 0xF7, 0xDE, 0xF7, 0xDE, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 
-    0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 
-    0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 
-    0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0xAD, 0xB5, 0xEF, 0xBD, 0xAD, 0xB5, 0xE7, 
-    0x9C, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xE5, 0x84, 0xC6, 0x94, 0xA5, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0xA5, 0x90, 0x08, 0x99, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 
-    0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC8, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 
-    0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 
-    0x99, 0x08, 0x99, 0x86, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xC8, 0x90, 0x08, 0x99, 
-    0xC6, 0x94, 0xA7, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xC8, 0x8C, 0xC6, 0x94, 0xC6, 
-    0x94, 0xA7, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xA7, 0x88, 0xA5, 0x90, 0xA5, 0x90, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x85, 
-    0x88, 0x03, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x84, 0x90, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 
-    0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x23, 0x84, 
-    0x01, 0x80, 0xC7, 0x98, 0xC7, 0x98, 0x65, 0x88, 0x01, 0x80, 0x29, 0x9D, 0x08, 0x99, 0x29, 
-    0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0xE7, 0x9C, 0x08, 0x99, 0x29, 
-    0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 
-    0xE8, 0xA0, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 
-    0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0xA5, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 
-    0x08, 0x99, 0x29, 0x9D, 0x29, 0xA5, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0xA5, 0x08, 
-    0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 
-    0x9D, 0xE7, 0x9C, 0x6B, 0xAD, 0x31, 0xC6, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xB0, 0xA9, 0xAD, 
-    0xB5, 0x29, 0xA5, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC8, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 
-    0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 
-    0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 
-    0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 
-    0x99, 0xC6, 0x94, 0x08, 0x99, 0xE9, 0x8C, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x08, 0x99, 
-    0xC6, 0x94, 0x08, 0x99, 0xC8, 0x8C, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x08, 0x99, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA7, 0x90, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x08, 0x99, 0xA5, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 
-    0x94, 0x25, 0x80, 0x02, 0x80, 0x01, 0x80, 0x86, 0x88, 0xA7, 0x90, 0xA7, 0x90, 0x02, 0x80, 
-    0x84, 0x90, 0x29, 0x9D, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 
-    0x99, 0xC6, 0x94, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 
-    0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 
-    0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 
-    0x42, 0x88, 0x42, 0x84, 0x85, 0x88, 0x86, 0x8C, 0x23, 0x84, 0xA5, 0x90, 0x6B, 0xA1, 0x08, 
-    0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0xE8, 0xA0, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0xE7, 0x9C, 0x08, 0x99, 0x29, 
-    0x9D, 0x08, 0x99, 0x29, 0x9D, 0xE7, 0x9C, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0xE7, 0x9C, 
-    0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0xA5, 0x29, 0x9D, 0x29, 
-    0xA5, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0xA5, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0x9D, 0x29, 0xA5, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 
-    0x9D, 0x29, 0x9D, 0xE7, 0x9C, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0xC6, 0x94, 0xE7, 0x9C, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0xE7, 0x9C, 0x08, 
-    0x99, 0x08, 0x99, 0xC6, 0x94, 0x6B, 0xAD, 0xEF, 0xBD, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 
-    0xA9, 0xAD, 0xB5, 0x29, 0xA5, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 
-    0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 
-    0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xEA, 0x94, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 0xC9, 0x94, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x29, 
-    0x9D, 0xA5, 0x90, 0xC6, 0x94, 0xEA, 0x94, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x29, 0x9D, 
-    0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC9, 
-    0x94, 0xC6, 0x94, 0x64, 0x88, 0x01, 0x80, 0x03, 0x80, 0x86, 0x8C, 0x66, 0x8C, 0x66, 0x8C, 
-    0x02, 0x80, 0x84, 0x90, 0x6B, 0xA1, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 
-    0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0x9D, 0x08, 0x99, 0x63, 0x88, 0x22, 0x84, 0x02, 0x80, 0xA5, 0x90, 0x29, 0x9D, 0x8C, 
-    0xA1, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x29, 0xA5, 0x08, 0x99, 0x08, 0x99, 0xE7, 0x9C, 0x08, 0x99, 0x08, 0x99, 0x29, 
-    0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0xE7, 0x9C, 0x08, 0x99, 
-    0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0xE7, 0x9C, 0x08, 0x99, 0x29, 0x9D, 0x08, 
-    0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0xA5, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0xA5, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 
-    0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xE7, 0x9C, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0xC6, 0x94, 0x08, 0x99, 0xA5, 0x90, 0xE7, 0x9C, 0xAD, 0xB5, 0x31, 0xC6, 0xBD, 0xF7, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 
-    0xE3, 0xAD, 0xA5, 0x6B, 0xB1, 0xE7, 0x9C, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 
-    0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 
-    0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 
-    0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 
-    0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xEA, 0x8C, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x6B, 0xA1, 0xC6, 0x94, 0x08, 0x99, 0xEA, 0x94, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x6B, 0xA1, 0xC6, 0x94, 0xC6, 0x94, 0xE9, 0x8C, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x6B, 0xA1, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0x08, 0x99, 0xC6, 0x94, 0xA5, 0x90, 0x63, 0x8C, 0x22, 0x84, 0x02, 0x80, 0x03, 0x80, 
-    0x03, 0x80, 0x63, 0x8C, 0x08, 0x99, 0x6B, 0xA1, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 
-    0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 
-    0x29, 0x9D, 0x29, 0x9D, 0x6B, 0xA1, 0x8C, 0xA1, 0xAD, 0xA5, 0xAD, 0xA5, 0xAD, 0xA5, 0x8C, 
-    0xA1, 0x6B, 0xA1, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0xE8, 0xA0, 
-    0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 
-    0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 
-    0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0xE7, 0x9C, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 
-    0x99, 0x08, 0x99, 0x29, 0x9D, 0xE7, 0x9C, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 
-    0xE7, 0x9C, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0xE8, 0xA0, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0xA5, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 
-    0xA5, 0x94, 0x08, 0x99, 0x29, 0xA5, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0xA5, 0x90, 0x84, 0x90, 0xE8, 0xA0, 0xEF, 0xBD, 
-    0x51, 0xBA, 0xFA, 0xDA, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0x5D, 0xE3, 0xBD, 0xF7, 0xBD, 
-    0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0x5D, 0xE3, 0xBD, 0xF7, 
-    0x5D, 0xE3, 0x5D, 0xE3, 0xFF, 0xEB, 0x5D, 0xE3, 0x5D, 0xE3, 0xFF, 0xEB, 0x5D, 0xE3, 0x5D, 
-    0xE3, 0xEF, 0xBD, 0x4B, 0xAD, 0xC7, 0x98, 0x85, 0x88, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 
-    0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0xC9, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC8, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 
-    0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x27, 0x8D, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x84, 0x90, 
-    0x42, 0x88, 0x84, 0x90, 0x29, 0x9D, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x84, 0x90, 0x42, 
-    0x88, 0x84, 0x90, 0x29, 0x9D, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x84, 0x90, 0x42, 0x88, 
-    0x84, 0x90, 0x29, 0x9D, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x6B, 0xA1, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0xC9, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 
-    0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 
-    0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x6B, 0xA1, 0x8C, 0xA1, 0x8C, 0xA1, 0x6B, 
-    0xA1, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 
-    0x29, 0x9D, 0xE7, 0x9C, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 
-    0x99, 0x29, 0x9D, 0x08, 0x99, 0xE7, 0x9C, 0x08, 0x99, 0x29, 0x9D, 0xE7, 0x9C, 0xE7, 0x9C, 
-    0xE7, 0x9C, 0x08, 0x99, 0xE7, 0x9C, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 
-    0x9D, 0x08, 0x99, 0x29, 0x9D, 0xE7, 0x9C, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 
-    0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0xA5, 0x29, 0x9D, 
-    0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0xE7, 0x9C, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xA5, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 
-    0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0xA5, 0xC6, 0x94, 0xA5, 0x90, 0x84, 0x90, 
-    0xE8, 0xA0, 0x6B, 0xAD, 0x4E, 0xA1, 0xEF, 0xBD, 0xEF, 0xBD, 0xEF, 0xBD, 0xEF, 0xBD, 0xEF, 
-    0xBD, 0xEF, 0xBD, 0xB0, 0xA9, 0xEF, 0xBD, 0xAD, 0xB5, 0xB0, 0xA9, 0xEF, 0xBD, 0xAD, 0xB5, 
-    0xAD, 0xB5, 0xEF, 0xBD, 0xAD, 0xB5, 0xAD, 0xB5, 0xAD, 0xB5, 0xEF, 0xBD, 0xEF, 0xBD, 0xAD, 
-    0xB5, 0x2A, 0xA9, 0x08, 0x99, 0x84, 0x90, 0x63, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 
-    0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC8, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0x08, 0x99, 0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xC9, 0x94, 0x08, 0x99, 0xA7, 0x88, 0x08, 
-    0x99, 0x6B, 0xA1, 0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0x08, 0x99, 
-    0x6B, 0xA1, 0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x29, 0x9D, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x6B, 0xA1, 0x29, 0x9D, 
-    0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 
-    0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x6B, 0xA1, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0xEA, 0x94, 0x29, 0x9D, 0x6B, 0xA1, 0x6B, 0xA1, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0xE7, 
-    0x9C, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 
-    0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 
-    0x99, 0x29, 0x9D, 0x08, 0x99, 0xE8, 0xA0, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0xE7, 
-    0x9C, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xA5, 0x94, 0x08, 0x99, 0x08, 0x99, 0xE7, 
-    0x9C, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xA5, 0x90, 
-    0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0x29, 0x9D, 0x08, 0x99, 0x29, 0xA5, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 
-    0x84, 0x90, 0x63, 0x88, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x63, 
-    0x8C, 0x65, 0x88, 0x63, 0x8C, 0x84, 0x90, 0x84, 0x90, 0x84, 0x90, 0x64, 0x94, 0x63, 0x8C, 
-    0x84, 0x8C, 0x84, 0x90, 0x63, 0x8C, 0x44, 0x84, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x63, 
-    0x8C, 0x44, 0x84, 0x63, 0x88, 0x42, 0x88, 0x63, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC8, 0x90, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC9, 0x94, 0xC6, 
-    0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 
-    0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 
-    0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 
-    0x94, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 0xC9, 
-    0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x6B, 0xA1, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 
-    0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x6B, 0xA1, 0x8C, 0xA1, 
-    0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xC6, 
-    0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0x6B, 0xA1, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 
-    0x9D, 0x08, 0x99, 0xE7, 0x9C, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x6B, 0xA1, 0x8C, 0xA1, 
-    0x29, 0x9D, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0x85, 
-    0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x86, 0x88, 0x86, 0x8C, 0x86, 0x88, 0x85, 0x88, 
-    0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 
-    0x88, 0x86, 0x8C, 0x86, 0x8C, 0xC8, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0x86, 0x8C, 0xA5, 0x90, 
-    0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xC8, 
-    0x90, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x88, 0x86, 0x8C, 0xC8, 0x90, 0x86, 0x88, 
-    0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0x86, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0x86, 
-    0x8C, 0xC8, 0x90, 0x85, 0x88, 0xC8, 0x90, 0x86, 0x88, 0xA7, 0x88, 0x86, 0x8C, 0xA7, 0x90, 
-    0x86, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 0x86, 0x8C, 0x86, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x85, 
-    0x88, 0x86, 0x8C, 0x65, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 
-    0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x65, 0x88, 0x85, 0x88, 0x65, 0x88, 0x85, 0x88, 0x85, 
-    0x88, 0x84, 0x8C, 0x65, 0x88, 0x65, 0x88, 0x85, 0x88, 0x85, 0x88, 0xA7, 0x88, 0xA7, 0x88, 
-    0xA7, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 
-    0x88, 0xA7, 0x88, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0x86, 0x8C, 0x86, 0x8C, 
-    0x86, 0x88, 0xA7, 0x88, 0x86, 0x8C, 0x86, 0x88, 0x86, 0x8C, 0x86, 0x88, 0x86, 0x8C, 0x86, 
-    0x8C, 0x86, 0x8C, 0x86, 0x88, 0xA7, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x65, 0x88, 0x85, 0x88, 
-    0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x86, 0x88, 0x86, 
-    0x88, 0xA7, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x8C, 0xA7, 0x88, 
-    0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x88, 0xA7, 0x88, 0x86, 0x88, 0x86, 0x8C, 0x86, 
-    0x88, 0xA5, 0x90, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 
-    0x85, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 
-    0x88, 0x85, 0x88, 0x86, 0x88, 0x86, 0x88, 0x85, 0x88, 0x85, 0x88, 0x86, 0x88, 0x86, 0x88, 
-    0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 
-    0x88, 0x86, 0x88, 0x86, 0x88, 0xA7, 0x88, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 
-    0x86, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 
-    0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 
-    0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0x86, 
-    0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 
-    0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0x86, 
-    0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x85, 0x88, 0x86, 0x88, 0x86, 0x88, 
-    0x86, 0x88, 0xA5, 0x90, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0xC6, 0x94, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 
-    0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x6B, 0xA1, 
-    0x29, 0x9D, 0xC6, 0x94, 0xA5, 0x90, 0x66, 0x8C, 0x23, 0x84, 0x02, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x03, 0x80, 0x03, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x03, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x03, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x25, 0x80, 0x24, 0x80, 0x24, 0x80, 0x25, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x25, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x03, 0x80, 0x24, 0x80, 0x03, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x24, 0x80, 0x02, 0x80, 0x03, 0x80, 0x24, 0x80, 0x03, 0x80, 0x03, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 
-    0x80, 0x03, 0x80, 0x03, 0x80, 0x24, 0x80, 0x02, 0x80, 0x02, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x03, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x02, 0x80, 0x03, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x02, 0x80, 0x03, 0x80, 0x24, 0x80, 0x03, 0x80, 0x24, 0x80, 0x03, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x25, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x03, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x03, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x24, 0x80, 0x03, 0x80, 0x24, 
-    0x80, 0x03, 0x80, 0x24, 0x80, 0x02, 0x80, 0x24, 0x80, 0x03, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x03, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x03, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x03, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 
-    0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x24, 0x80, 
-    0x03, 0x80, 0x24, 0x80, 0x03, 0x80, 0x24, 0x80, 0x24, 0x80, 0x03, 0x80, 0x24, 0x80, 0x24, 
-    0x80, 0x24, 0x80, 0x24, 0x80, 0x43, 0x84, 0x02, 0x80, 0x24, 0x80, 0x03, 0x80, 0x03, 0x80, 
-    0x03, 0x80, 0x03, 0x80, 0x85, 0x88, 0x08, 0x99, 0x6B, 0xA1, 0x29, 0x9D, 0x29, 0x9D, 0x08, 
-    0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 
-    0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 0x85, 0x88, 0x02, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x08, 0x99, 0x6B, 0xA1, 0x29, 0x9D, 0x29, 
-    0x9D, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 
-    0x29, 0x9D, 0x29, 0x9D, 0xC6, 0x94, 0x86, 0x88, 0x02, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x08, 0x99, 0x6B, 0xA1, 0x29, 
-    0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0xC9, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 
-    0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0xC6, 0x94, 0x85, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x08, 0x99, 0x6B, 
-    0xA1, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x29, 0x9D, 0x08, 0x99, 0x08, 
-    0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 
-    0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x29, 0x9D, 0xC6, 0x94, 0x64, 0x88, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x29, 
-    0x9D, 0x6B, 0xA1, 0xE7, 0x9C, 0xE7, 0x9C, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC9, 0x94, 
-    0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x29, 0x9D, 0x08, 
-    0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x65, 0x88, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x08, 0x99, 0x6B, 0xA1, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x29, 
-    0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x85, 
-    0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x29, 0x9D, 0x6B, 0xA1, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 
-    0x94, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0x23, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x08, 0x99, 0x6B, 0xA1, 0xE7, 0x9C, 0xE7, 0x9C, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 
-    0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 
-    0x99, 0xC6, 0x94, 0x42, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x29, 0x9D, 0x6B, 0xA1, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 
-    0x99, 0xC6, 0x94, 0xA7, 0x88, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0x08, 0x99, 0xC6, 0x94, 0x42, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x08, 0x99, 0x6B, 0xA1, 0x29, 0x9D, 
-    0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0xA7, 0x88, 0xA7, 0x88, 0x48, 0x84, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x42, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x08, 0x99, 0x6B, 0xA1, 
-    0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xA7, 
-    0x88, 0xA7, 0x88, 0x48, 0x84, 0x48, 0x84, 0x46, 0x84, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x42, 0x84, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x08, 0x99, 
-    0x6B, 0xA1, 0x29, 0x9D, 0x29, 0x9D, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x8C, 0xA7, 0x88, 0x48, 
-    0x84, 0x48, 0x84, 0x46, 0x84, 0x26, 0x80, 0x46, 0x84, 0x26, 0x80, 0x29, 0x9D, 0x29, 0x9D, 
-    0xE7, 0x9C, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x83, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0xC6, 0x94, 0x08, 0x99, 0xC8, 0x8C, 0xC8, 0x8C, 0xA7, 0x88, 0x48, 0x84, 0x48, 0x84, 0x26, 
-    0x80, 0x26, 0x80, 0x46, 0x84, 0x46, 0x84, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x08, 0x99, 
-    0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 
-    0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x85, 0x88, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x85, 0x88, 0x85, 0x88, 0x48, 0x84, 0x48, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 
-    0x84, 0x46, 0x84, 0x46, 0x84, 0x25, 0x80, 0x05, 0x80, 0x23, 0x84, 0x23, 0x84, 0x03, 0x80, 
-    0xC6, 0x94, 0x29, 0x9D, 0x08, 0x99, 0xE7, 0x9C, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 
-    0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 
-    0x64, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x26, 0x80, 0x46, 0x84, 0x26, 0x80, 0x26, 0x80, 0x46, 0x84, 0x26, 
-    0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x23, 0x84, 0x23, 0x84, 0x23, 0x84, 0x23, 0x84, 
-    0x02, 0x80, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 
-    0xC6, 0x94, 0x64, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x25, 0x80, 0x25, 0x80, 0x43, 0x84, 0x43, 0x84, 0x85, 
-    0x88, 0x44, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x84, 0x90, 0xA5, 0x94, 0x84, 0x90, 
-    0x23, 0x84, 0x02, 0x80, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 
-    0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0xC6, 0x94, 0x85, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x23, 0x80, 0x23, 0x80, 0xA5, 0x94, 0xA5, 
-    0x94, 0x0B, 0x99, 0xA7, 0x88, 0x02, 0x80, 0x02, 0x80, 0x65, 0x88, 0xA5, 0x94, 0x29, 0xA5, 
-    0x84, 0x90, 0x63, 0x8C, 0x03, 0x80, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x85, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x23, 0x84, 0x43, 
-    0x84, 0x43, 0x84, 0xA5, 0x94, 0x65, 0x88, 0x21, 0x80, 0x21, 0x80, 0x64, 0x88, 0xA5, 0x94, 
-    0xE7, 0x9C, 0xA5, 0x94, 0x63, 0x8C, 0x25, 0x80, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x64, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x23, 
-    0x84, 0x65, 0x88, 0x65, 0x88, 0x29, 0xA5, 0xA5, 0x94, 0x43, 0x84, 0x21, 0x84, 0x44, 0x84, 
-    0x86, 0x8C, 0xE7, 0x9C, 0xA7, 0x90, 0x63, 0x8C, 0x45, 0x88, 0x08, 0x99, 0xC6, 0x94, 0xA5, 
-    0x90, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x85, 0x88, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x63, 0x8C, 0x64, 0x88, 0x64, 0x88, 0xA5, 0x94, 0x86, 0x8C, 0x44, 0x84, 0x43, 0x84, 
-    0x42, 0x88, 0x65, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0x63, 0x8C, 0x25, 0x80, 0x08, 0x99, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 
-    0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0x29, 0x9D, 0xC6, 0x94, 0x65, 0x88, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x84, 0x90, 0x22, 0x84, 0x22, 0x84, 0x64, 0x88, 0x85, 0x88, 0x43, 0x84, 
-    0x21, 0x84, 0x21, 0x84, 0x22, 0x84, 0x85, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x25, 0x80, 0x08, 
-    0x99, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0x08, 0x99, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x29, 0x9D, 0xC6, 0x94, 0x64, 
-    0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 
-    0x22, 0x84, 0x00, 0x80, 0x00, 0x80, 0x22, 0x84, 0x44, 0x84, 0x63, 0x8C, 0x42, 0x88, 0x64, 
-    0x84, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x29, 0x9D, 0xC6, 
-    0x94, 0x64, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xA6, 0x94, 0xA6, 0x94, 0xA6, 0x94, 0xA6, 0x94, 
-    0xA6, 0x94, 0xA6, 0x94, 0x85, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0xA5, 0x94, 0xA6, 
-    0x94, 0x64, 0x84, 0x29, 0x9D, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 
-    0x9D, 0xC6, 0x94, 0x85, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xA6, 0x94, 0x63, 0x8C, 0x63, 0x8C, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 
-    0x8C, 0xA5, 0x94, 0x64, 0x84, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 
-    0x9D, 0x6B, 0xA1, 0xC6, 0x94, 0x64, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xA5, 0x94, 0x63, 0x8C, 
-    0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x63, 
-    0x8C, 0x63, 0x8C, 0xA5, 0x94, 0x64, 0x84, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0x29, 0x9D, 0x6B, 0xA1, 0xC6, 0x94, 0x64, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xA5, 0x94, 
-    0x63, 0x8C, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x63, 
-    0x8C, 0x63, 0x8C, 0x63, 0x8C, 0xA5, 0x94, 0x64, 0x84, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x64, 0x84, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x65, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x65, 0x88, 0x84, 0x8C, 0x84, 
-    0x8C, 0x85, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0x64, 0x84, 0x85, 0x88, 0xA5, 0x90, 
-    0xA5, 0x90, 0x85, 0x88, 0x85, 0x88, 0xA5, 0x90, 0x84, 0x8C, 0x86, 0x88, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x88, 0xA5, 0x90, 0x84, 0x8C, 0x85, 0x88, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x42, 0x88, 0x63, 0x8C, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x42, 
-    0x88, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x63, 0x8C, 0x84, 0x8C, 0x64, 0x84, 0x08, 0x99, 
-    0x08, 0x99, 0xAD, 0xA5, 0xCE, 0xA9, 0xCE, 0xA9, 0xCE, 0xA9, 0xCE, 0xA9, 0xCE, 0xA9, 0xCE, 
-    0xA9, 0xCE, 0xA9, 0xAD, 0xA5, 0xAD, 0xA5, 0x08, 0x99, 0x29, 0x9D, 0xC6, 0x94, 0x64, 0x84, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x26, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x24, 0x80, 0x03, 
-    0x80, 0x25, 0x80, 0x24, 0x80, 0x03, 0x80, 0x25, 0x80, 0x25, 0x80, 0x28, 0x80, 0x25, 0x80, 
-    0xC6, 0x94, 0xC6, 0x94, 0x8C, 0xA1, 0xC9, 0x94, 0x48, 0x84, 0x29, 0x80, 0x48, 0x84, 0x29, 
-    0x80, 0x29, 0x80, 0x08, 0x99, 0x8C, 0xA1, 0x8C, 0xA1, 0xC6, 0x94, 0x29, 0x9D, 0xC6, 0x94, 
-    0x42, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 
-    0x80, 0x23, 0x84, 0x25, 0x80, 0x25, 0x80, 0x23, 0x84, 0x25, 0x80, 0x25, 0x80, 0x28, 0x80, 
-    0x25, 0x80, 0xC6, 0x94, 0xC6, 0x94, 0x6B, 0xA1, 0x28, 0x80, 0x18, 0x81, 0xBC, 0x81, 0x5A, 
-    0x81, 0x18, 0x81, 0xBC, 0x81, 0x29, 0x80, 0x6B, 0xA1, 0x6B, 0xA1, 0xA5, 0x90, 0x29, 0x9D, 
-    0xC6, 0x94, 0x65, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x42, 0x88, 0x63, 0x8C, 0x63, 0x8C, 0x42, 
-    0x88, 0x63, 0x8C, 0x63, 0x8C, 0x42, 0x88, 0x63, 0x8C, 0x63, 0x8C, 0x42, 0x88, 0x63, 0x8C, 
-    0x84, 0x8C, 0x25, 0x80, 0xC6, 0x94, 0xC6, 0x94, 0x29, 0x9D, 0x27, 0x80, 0xB5, 0x80, 0x2F, 
-    0x80, 0x0B, 0x80, 0x0E, 0x80, 0x18, 0x81, 0x29, 0x80, 0x29, 0x9D, 0x29, 0x9D, 0xC8, 0x90, 
-    0x08, 0x99, 0xC6, 0x94, 0x86, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0xA5, 0x94, 0xA5, 
-    0x94, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 
-    0xA5, 0x94, 0xA5, 0x94, 0x25, 0x80, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x27, 0x80, 0x18, 
-    0x81, 0x08, 0x80, 0x25, 0x80, 0x27, 0x80, 0x18, 0x81, 0x08, 0x80, 0x08, 0x99, 0x08, 0x99, 
-    0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x85, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x84, 0x90, 0x84, 0x90, 0x25, 0x80, 0xC9, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x26, 
-    0x80, 0x18, 0x81, 0x29, 0x80, 0x29, 0x80, 0x29, 0x80, 0xF6, 0x80, 0x08, 0x80, 0x08, 0x99, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x64, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 
-    0x90, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x63, 0x8C, 0x42, 0x88, 0x63, 0x8C, 
-    0x63, 0x8C, 0x42, 0x88, 0x63, 0x8C, 0x84, 0x90, 0x25, 0x80, 0xC6, 0x94, 0xC6, 0x94, 0x08, 
-    0x99, 0x05, 0x80, 0x18, 0x81, 0x08, 0x80, 0x25, 0x80, 0x08, 0x80, 0xF6, 0x80, 0x25, 0x80, 
-    0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x64, 0x84, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x84, 0x90, 0x42, 0x88, 0x42, 0x88, 0x24, 0x80, 0x42, 0x88, 0x24, 0x80, 0x42, 0x88, 
-    0x24, 0x80, 0x42, 0x88, 0x24, 0x80, 0x63, 0x8C, 0x84, 0x90, 0x25, 0x80, 0xC6, 0x94, 0xC6, 
-    0x94, 0x08, 0x99, 0x25, 0x80, 0x5A, 0x81, 0x29, 0x80, 0x25, 0x80, 0x08, 0x80, 0xF6, 0x80, 
-    0x26, 0x80, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x86, 0x88, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x84, 0x90, 0x42, 0x88, 0x42, 0x88, 0x25, 0x80, 0x25, 0x80, 0x27, 0x80, 
-    0x25, 0x80, 0x27, 0x80, 0x25, 0x80, 0x25, 0x80, 0x63, 0x8C, 0x84, 0x90, 0x25, 0x80, 0x08, 
-    0x99, 0xC6, 0x94, 0x08, 0x99, 0x25, 0x80, 0xF6, 0x80, 0x29, 0x80, 0x25, 0x80, 0x08, 0x80, 
-    0xF6, 0x80, 0x26, 0x80, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x64, 
-    0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x63, 0x8C, 0x63, 0x8C, 0x48, 0x84, 0x25, 0x80, 
-    0x6A, 0x88, 0x25, 0x80, 0x6A, 0x88, 0x25, 0x80, 0x48, 0x84, 0x63, 0x8C, 0x84, 0x90, 0x25, 
-    0x80, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x25, 0x80, 0x18, 0x81, 0x29, 0x80, 0x03, 0x80, 
-    0x27, 0x80, 0xF6, 0x80, 0x25, 0x80, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC9, 
-    0x94, 0x85, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x42, 0x88, 0x42, 0x88, 0x48, 0x84, 
-    0x25, 0x80, 0x6A, 0x88, 0x25, 0x80, 0x6A, 0x88, 0x25, 0x80, 0x48, 0x84, 0x42, 0x88, 0x84, 
-    0x90, 0x25, 0x80, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x25, 0x80, 0x18, 0x81, 0x29, 0x80, 
-    0x03, 0x80, 0x27, 0x80, 0xF6, 0x80, 0x26, 0x80, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 
-    0x99, 0xC6, 0x94, 0x65, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x42, 0x88, 0x42, 0x88, 
-    0x48, 0x84, 0x25, 0x80, 0x6A, 0x88, 0x25, 0x80, 0x6A, 0x88, 0x25, 0x80, 0x48, 0x84, 0x42, 
-    0x88, 0x84, 0x90, 0x25, 0x80, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x25, 0x80, 0x5A, 0x81, 
-    0x29, 0x80, 0x03, 0x80, 0x08, 0x80, 0x5A, 0x81, 0x05, 0x80, 0x08, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0x08, 0x99, 0xC6, 0x94, 0x85, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x42, 0x88, 
-    0x42, 0x88, 0x48, 0x84, 0x25, 0x80, 0x6A, 0x88, 0x25, 0x80, 0x6A, 0x88, 0x25, 0x80, 0x48, 
-    0x84, 0x63, 0x8C, 0x84, 0x90, 0x25, 0x80, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x25, 0x80, 
-    0x5A, 0x81, 0x08, 0x80, 0x02, 0x80, 0x08, 0x80, 0x5A, 0x81, 0x25, 0x80, 0x08, 0x99, 0x08, 
-    0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x65, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 
-    0x42, 0x88, 0x42, 0x88, 0x48, 0x84, 0x25, 0x80, 0x6A, 0x88, 0x25, 0x80, 0x6A, 0x88, 0x25, 
-    0x80, 0x48, 0x84, 0x63, 0x8C, 0x84, 0x90, 0x25, 0x80, 0x08, 0x99, 0xC6, 0x94, 0x29, 0x9D, 
-    0x05, 0x80, 0xBC, 0x81, 0x2F, 0x80, 0x0E, 0x80, 0x0E, 0x80, 0xBC, 0x81, 0x27, 0x80, 0x29, 
-    0x9D, 0x29, 0x9D, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x64, 0x84, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x84, 0x90, 0x63, 0x8C, 0x63, 0x8C, 0x48, 0x84, 0x25, 0x80, 0x6A, 0x88, 0x25, 0x80, 0x6A, 
-    0x88, 0x25, 0x80, 0x48, 0x84, 0x63, 0x8C, 0x84, 0x90, 0x25, 0x80, 0x08, 0x99, 0xC6, 0x94, 
-    0x29, 0x9D, 0x25, 0x80, 0x5F, 0x82, 0x5F, 0x82, 0x5F, 0x82, 0x5F, 0x82, 0xFD, 0x81, 0x29, 
-    0x80, 0x29, 0x9D, 0x29, 0x9D, 0xC9, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x85, 0x88, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x84, 0x90, 0x63, 0x8C, 0x63, 0x8C, 0x48, 0x84, 0x25, 0x80, 0x6A, 0x88, 0x25, 
-    0x80, 0x6A, 0x88, 0x25, 0x80, 0x48, 0x84, 0x63, 0x8C, 0x84, 0x90, 0x25, 0x80, 0x08, 0x99, 
-    0xC6, 0x94, 0x29, 0x9D, 0xA7, 0x90, 0x27, 0x80, 0x27, 0x80, 0x27, 0x80, 0x27, 0x80, 0x08, 
-    0x80, 0xA7, 0x90, 0x29, 0x9D, 0x29, 0x9D, 0xC9, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x64, 0x84, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x63, 0x8C, 0x63, 0x8C, 0x25, 0x80, 0x25, 0x80, 0x27, 
-    0x80, 0x25, 0x80, 0x27, 0x80, 0x25, 0x80, 0x25, 0x80, 0x63, 0x8C, 0x84, 0x90, 0x25, 0x80, 
-    0xC6, 0x94, 0xC6, 0x94, 0x29, 0x9D, 0x09, 0xA5, 0x09, 0xA5, 0xE8, 0xA0, 0xE8, 0xA0, 0xE8, 
-    0xA0, 0xE8, 0xA0, 0x2A, 0xA9, 0x29, 0x9D, 0x29, 0x9D, 0xC9, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0x65, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x63, 0x8C, 0x63, 0x8C, 0x24, 0x80, 0x42, 
-    0x88, 0x24, 0x80, 0x42, 0x88, 0x24, 0x80, 0x42, 0x88, 0x24, 0x80, 0x63, 0x8C, 0x84, 0x90, 
-    0x25, 0x80, 0xC7, 0x98, 0xC6, 0x94, 0x84, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x63, 
-    0x8C, 0x63, 0x8C, 0x63, 0x88, 0x63, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0x85, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x63, 0x8C, 0x63, 0x8C, 0x42, 
-    0x88, 0x63, 0x8C, 0x63, 0x8C, 0x42, 0x88, 0x63, 0x8C, 0x63, 0x8C, 0x42, 0x88, 0x63, 0x8C, 
-    0x84, 0x90, 0x25, 0x80, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 
-    0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0x65, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x63, 0x8C, 0x84, 0x90, 0x25, 0x80, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 
-    0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 
-    0x29, 0x9D, 0x6B, 0xA1, 0x08, 0x99, 0x65, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x63, 
-    0x8C, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x84, 0x90, 0x25, 0x80, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xE8, 0xA0, 0xE8, 0xA0, 0x09, 0xA5, 0xE8, 0xA0, 
-    0xE8, 0xA0, 0x08, 0x99, 0x6B, 0xA1, 0x08, 0x99, 0x85, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 
-    0x90, 0x63, 0x8C, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x84, 0x90, 0x25, 0x80, 0x29, 0x9D, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x85, 0x88, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x84, 0x90, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x84, 0x90, 0x25, 0x80, 0x08, 0x99, 0xC6, 
-    0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x85, 0x88, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x84, 0x90, 0x63, 0x8C, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x23, 0x84, 
-    0x23, 0x84, 0x23, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x84, 0x90, 0x25, 0x80, 0x29, 
-    0x9D, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x29, 0x9D, 0x08, 0x99, 0x85, 
-    0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x63, 0x8C, 0x63, 0x8C, 0x42, 0x88, 0x23, 0x84, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x84, 0x90, 0x25, 
-    0x80, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x29, 0x9D, 0x08, 
-    0x99, 0x85, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x63, 0x8C, 0x63, 0x8C, 0x23, 0x84, 
-    0x45, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x84, 
-    0x90, 0x25, 0x80, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 
-    0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x29, 
-    0x9D, 0x08, 0x99, 0x85, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x42, 0x88, 0x42, 0x88, 
-    0x45, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 
-    0x88, 0x84, 0x90, 0x25, 0x80, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0x29, 0x9D, 0x08, 0x99, 0x86, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x63, 0x8C, 
-    0x63, 0x8C, 0x45, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x84, 0x90, 0x25, 0x80, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0x85, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 
-    0x63, 0x8C, 0x63, 0x8C, 0x45, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x84, 0x90, 0x25, 0x80, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x85, 0x88, 0x85, 0x88, 0x64, 0x84, 0x86, 
-    0x88, 0x86, 0x88, 0x64, 0x84, 0x86, 0x88, 0x64, 0x84, 0x86, 0x88, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x84, 0x90, 0x42, 0x88, 0x42, 0x88, 0x45, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x84, 0x90, 0x25, 0x80, 0x08, 0x99, 0x08, 0x99, 
-    0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x64, 0x88, 0x64, 0x88, 0x43, 0x84, 0x64, 
-    0x84, 0x23, 0x84, 0x23, 0x84, 0x64, 0x84, 0x23, 0x84, 0x64, 0x84, 0x43, 0x84, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x84, 0x90, 0x42, 0x88, 0x42, 0x88, 0x45, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x84, 0x90, 0x25, 0x80, 0x08, 0x99, 
-    0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xA5, 0x90, 0x64, 0x88, 0x84, 0x90, 0xE9, 
-    0x8C, 0x0A, 0x99, 0x08, 0x99, 0x08, 0x99, 0xED, 0x9C, 0xAA, 0x94, 0x64, 0x84, 0x63, 0x8C, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x42, 0x88, 0x42, 0x88, 0x23, 0x84, 0x45, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x84, 0x90, 0x25, 0x80, 
-    0xC6, 0x94, 0xC9, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x85, 0x88, 0x63, 0x8C, 0x63, 
-    0x88, 0xC7, 0x98, 0xE8, 0xA0, 0xAD, 0xB5, 0xAD, 0xB5, 0x73, 0xCE, 0xAD, 0xB5, 0x23, 0x84, 
-    0xA5, 0x94, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x23, 
-    0x84, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 0x84, 0x90, 
-    0x25, 0x80, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xA5, 0x90, 0x63, 
-    0x8C, 0x85, 0x88, 0x65, 0x88, 0xA5, 0x94, 0x4D, 0x9D, 0x4D, 0x9D, 0xAD, 0xB5, 0x4B, 0xAD, 
-    0x03, 0x80, 0x85, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x63, 0x8C, 0x23, 0x84, 0x23, 0x84, 0x23, 0x84, 0x22, 0x84, 0x42, 0x88, 0x42, 0x88, 
-    0x84, 0x90, 0x25, 0x80, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xA5, 
-    0x90, 0x63, 0x88, 0x42, 0x88, 0x23, 0x84, 0xA5, 0x90, 0x4B, 0xAD, 0x4B, 0xAD, 0x31, 0xC6, 
-    0x6B, 0xAD, 0x23, 0x84, 0x85, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x84, 0x90, 0x25, 0x80, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 
-    0x99, 0xA5, 0x90, 0x63, 0x88, 0x43, 0x84, 0x23, 0x84, 0xA5, 0x90, 0xE8, 0xA0, 0xE8, 0xA0, 
-    0xAD, 0xB5, 0xE8, 0xA0, 0x64, 0x84, 0x84, 0x90, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x84, 0x90, 0x25, 0x80, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 
-    0x94, 0x08, 0x99, 0x85, 0x88, 0x63, 0x8C, 0x01, 0x80, 0x42, 0x84, 0xA5, 0x94, 0x4E, 0xA1, 
-    0x4E, 0xA1, 0xAD, 0xB5, 0xAD, 0xB5, 0x86, 0x8C, 0x63, 0x8C, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 
-    0x90, 0x27, 0x80, 0x27, 0x80, 0x27, 0x80, 0x27, 0x80, 0x27, 0x80, 0x27, 0x80, 0x27, 0x80, 
-    0x27, 0x80, 0x27, 0x80, 0x27, 0x80, 0x84, 0x90, 0x25, 0x80, 0x08, 0x99, 0xC6, 0x94, 0x08, 
-    0x99, 0xC6, 0x94, 0x08, 0x99, 0x84, 0x90, 0x63, 0x88, 0x43, 0x84, 0x64, 0x88, 0x08, 0x99, 
-    0xC8, 0x90, 0xC8, 0x90, 0x4E, 0xA1, 0xC7, 0x98, 0xA5, 0x94, 0x85, 0x88, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x84, 0x90, 0x27, 0x80, 0x27, 0x80, 0x4C, 0x80, 0x4C, 0x80, 0x6F, 0x84, 0x6F, 0x84, 
-    0x6F, 0x84, 0x4C, 0x80, 0x4C, 0x80, 0x27, 0x80, 0x84, 0x90, 0x25, 0x80, 0x08, 0x99, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xA5, 0x90, 0x63, 0x88, 0x01, 0x80, 0x23, 0x84, 
-    0x64, 0x84, 0x63, 0x88, 0x63, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0x42, 0x88, 0xA5, 0x94, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x84, 0x90, 0x27, 0x80, 0x27, 0x80, 0x4C, 0x80, 0x6F, 0x84, 0x6F, 0x84, 
-    0x6F, 0x84, 0x6F, 0x84, 0x6F, 0x84, 0x4C, 0x80, 0x27, 0x80, 0x84, 0x90, 0x25, 0x80, 0xA5, 
-    0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x64, 0x88, 0x63, 0x88, 0x21, 0x84, 
-    0x84, 0x90, 0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 0x0A, 0x99, 0xE7, 0x9C, 0x64, 0x84, 0x85, 
-    0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x27, 0x80, 0x27, 0x80, 0x4C, 0x80, 0x4C, 0x80, 
-    0x6F, 0x84, 0x6F, 0x84, 0x6F, 0x84, 0x4C, 0x80, 0x4C, 0x80, 0x27, 0x80, 0x84, 0x90, 0x25, 
-    0x80, 0xC9, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xA5, 0x90, 0x42, 0x88, 
-    0x01, 0x80, 0x42, 0x84, 0x64, 0x84, 0x64, 0x88, 0x64, 0x88, 0x08, 0x99, 0xE8, 0xA0, 0x63, 
-    0x8C, 0x64, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x27, 0x80, 0x27, 0x80, 0x27, 0x80, 
-    0x27, 0x80, 0x27, 0x80, 0x27, 0x80, 0x27, 0x80, 0x27, 0x80, 0x27, 0x80, 0x27, 0x80, 0x84, 
-    0x90, 0x25, 0x80, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 
-    0x42, 0x84, 0x42, 0x80, 0x64, 0x88, 0x86, 0x8C, 0x08, 0x99, 0x08, 0x99, 0x6B, 0xA1, 0x84, 
-    0x90, 0xA5, 0x94, 0x85, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x63, 0x8C, 0x63, 0x8C, 
-    0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x63, 
-    0x8C, 0x84, 0x90, 0x25, 0x80, 0xC6, 0x94, 0x08, 0x99, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 
-    0x84, 0x8C, 0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x84, 0x90, 0x84, 0x90, 0x64, 
-    0x84, 0x42, 0x88, 0x63, 0x88, 0x65, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x84, 0x90, 0x42, 0x88, 
-    0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x84, 0x90, 0x25, 0x80, 0x08, 0x99, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 
-    0x08, 0x99, 0xA5, 0x90, 0x42, 0x84, 0xA5, 0x90, 0xCC, 0x98, 0xA7, 0x88, 0x09, 0xA5, 0x09, 
-    0xA5, 0xEA, 0x94, 0x01, 0x80, 0x42, 0x88, 0x23, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x21, 0x80, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x21, 0x84, 0x21, 0x80, 0x22, 0x84, 0x42, 0x88, 0x21, 0x80, 0x21, 
-    0x80, 0x22, 0x84, 0x22, 0x84, 0x44, 0x84, 0x25, 0x80, 0xC6, 0x94, 0xC8, 0x90, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0x42, 0x88, 0x42, 0x84, 0x86, 0x88, 0x67, 0x8C, 0xC7, 
-    0x98, 0xC7, 0x98, 0x84, 0x90, 0x84, 0x90, 0x85, 0x88, 0x63, 0x8C, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 
-    0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x25, 0x80, 0xC6, 0x94, 0xC6, 0x94, 
-    0xA5, 0x90, 0xA5, 0x90, 0x08, 0x99, 0x64, 0x88, 0x63, 0x88, 0x01, 0x80, 0x23, 0x84, 0xA5, 
-    0x90, 0xA5, 0x94, 0xA5, 0x94, 0xA5, 0x90, 0x84, 0x90, 0x65, 0x88, 0x85, 0x88, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x01, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x64, 0x84, 0x22, 0x84, 0x22, 0x84, 0x64, 
-    0x84, 0x64, 0x84, 0x86, 0x88, 0x86, 0x88, 0x64, 0x84, 0x44, 0x84, 0x23, 0x84, 0xA5, 0x90, 
-    0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0x42, 0x88, 0x42, 0x84, 0x42, 
-    0x88, 0x89, 0x90, 0x84, 0x90, 0x84, 0x90, 0x84, 0x90, 0x84, 0x90, 0x64, 0x88, 0x42, 0x88, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x86, 0x8C, 0x86, 0x8C, 0xC8, 0x90, 0x86, 0x8C, 0x86, 
-    0x8C, 0xA8, 0x88, 0xAA, 0x88, 0xAA, 0x88, 0xCB, 0x88, 0xA8, 0x88, 0x64, 0x84, 0x25, 0x80, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x63, 0x8C, 0x42, 0x84, 0xC6, 
-    0x94, 0x89, 0x90, 0xEA, 0x94, 0x09, 0xA5, 0x09, 0xA5, 0xEA, 0x94, 0x43, 0x90, 0x84, 0x90, 
-    0x23, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x44, 
-    0x84, 0x22, 0x84, 0xAA, 0x88, 0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0xCB, 0x88, 0x86, 0x88, 
-    0x25, 0x80, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0x42, 
-    0x84, 0x42, 0x80, 0x23, 0x84, 0x67, 0x8C, 0xA6, 0x94, 0xA6, 0x94, 0x84, 0x90, 0x23, 0x84, 
-    0x43, 0x84, 0x64, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x86, 0x8C, 0x86, 0x8C, 0x64, 
-    0x88, 0x22, 0x84, 0x22, 0x84, 0xA8, 0x88, 0x21, 0x80, 0x00, 0x80, 0x01, 0x80, 0xCB, 0x88, 
-    0x64, 0x84, 0x25, 0x80, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0x42, 0x88, 0x01, 0x80, 0x22, 0x84, 0xA5, 0x90, 0xC7, 0x98, 0xC7, 0x98, 0x84, 0x90, 
-    0x43, 0x84, 0x43, 0x84, 0x43, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x86, 0x8C, 0x86, 
-    0x8C, 0xC8, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0xAA, 0x88, 0x21, 0x80, 0x00, 0x80, 0x01, 0x80, 
-    0xAA, 0x88, 0x86, 0x88, 0x23, 0x84, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0x08, 
-    0x99, 0x63, 0x8C, 0x43, 0x84, 0x01, 0x80, 0x22, 0x84, 0x67, 0x8C, 0x08, 0x99, 0x08, 0x99, 
-    0xC8, 0x8C, 0x63, 0x8C, 0x63, 0x88, 0x43, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x86, 
-    0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x44, 0x84, 0x64, 0x88, 0x86, 0x88, 0x22, 0x84, 0x21, 0x80, 
-    0x22, 0x84, 0x86, 0x88, 0x64, 0x84, 0x23, 0x84, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0x08, 0x99, 0x63, 0x8C, 0x63, 0x88, 0xA5, 0x90, 0xAA, 0x94, 0xE8, 0xA0, 0x6B, 0xB1, 
-    0x6B, 0xB1, 0x0A, 0x99, 0x84, 0x90, 0x63, 0x8C, 0x42, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x21, 
-    0x80, 0x85, 0x88, 0x85, 0x88, 0x43, 0x84, 0x22, 0x84, 0x22, 0x84, 0x64, 0x88, 0x22, 0x84, 
-    0x22, 0x84, 0x22, 0x84, 0x22, 0x84, 0x64, 0x88, 0x23, 0x84, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 
-    0x94, 0xA5, 0x90, 0x08, 0x99, 0xA5, 0x90, 0x42, 0x84, 0x01, 0x80, 0x23, 0x84, 0xA7, 0x90, 
-    0xC7, 0x98, 0xC7, 0x98, 0x84, 0x90, 0x63, 0x8C, 0x23, 0x84, 0x23, 0x84, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x85, 0x88, 0x85, 0x88, 0x65, 0x88, 0x21, 0x80, 0x85, 0x88, 0x0B, 0x8D, 
-    0xC8, 0x90, 0xEA, 0x94, 0x65, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0x25, 0x80, 0xA5, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x63, 0x8C, 0x63, 0x88, 0x02, 0x80, 0x44, 0x84, 
-    0x67, 0x8C, 0xC7, 0x98, 0xC7, 0x98, 0x84, 0x90, 0x84, 0x90, 0x42, 0x88, 0x42, 0x84, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x21, 0x80, 0x86, 0x88, 0x86, 0x88, 0x86, 0x8C, 0x21, 0x80, 0x86, 0x8C, 
-    0x4D, 0x9D, 0x0B, 0x8D, 0x0B, 0x99, 0xA7, 0x90, 0xE9, 0x8C, 0xA7, 0x90, 0x23, 0x84, 0xA5, 
-    0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0x08, 0x99, 0xA5, 0x90, 0x63, 0x88, 0x01, 0x80, 
-    0x42, 0x84, 0x89, 0x90, 0xEA, 0x94, 0xEA, 0x94, 0xA6, 0x94, 0x42, 0x88, 0x21, 0x84, 0x23, 
-    0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x21, 0x80, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x21, 0x80, 
-    0x44, 0x84, 0x0B, 0x99, 0xC8, 0x90, 0xEA, 0x94, 0x65, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0x23, 
-    0x84, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x64, 0x88, 0x63, 0x88, 
-    0x86, 0x8C, 0xAA, 0x94, 0xEA, 0x94, 0x6B, 0xA1, 0x6B, 0xA1, 0x08, 0x99, 0xEA, 0x94, 0x42, 
-    0x88, 0x21, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x21, 0x80, 0x21, 0x80, 0xA7, 0x88, 0xA7, 0x88, 0x86, 0x88, 
-    0x21, 0x80, 0x21, 0x80, 0xE9, 0x8C, 0x44, 0x84, 0x64, 0x88, 0x64, 0x84, 0x22, 0x84, 0x64, 
-    0x88, 0x23, 0x84, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 
-    0x42, 0x88, 0x64, 0x84, 0x42, 0x84, 0x64, 0x84, 0x84, 0x90, 0x84, 0x90, 0xE8, 0xA0, 0xE8, 
-    0xA0, 0x42, 0x88, 0x42, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x21, 0x80, 0xA7, 0x88, 0xA7, 0x88, 
-    0x44, 0x84, 0x00, 0x80, 0x00, 0x80, 0xA7, 0x90, 0x21, 0x80, 0x00, 0x80, 0x65, 0x88, 0x65, 
-    0x88, 0x85, 0x88, 0x23, 0x84, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x08, 0x99, 
-    0xA5, 0x90, 0x42, 0x84, 0x01, 0x80, 0x63, 0x88, 0x85, 0x88, 0x63, 0x88, 0x63, 0x88, 0xC8, 
-    0x8C, 0xC6, 0x94, 0x63, 0x8C, 0x64, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x21, 0x80, 0xA7, 0x88, 
-    0xA7, 0x88, 0x44, 0x84, 0x00, 0x80, 0x00, 0x80, 0x22, 0x84, 0x21, 0x80, 0x00, 0x80, 0xA7, 
-    0x88, 0x86, 0x8C, 0x85, 0x88, 0x23, 0x84, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xA5, 0x90, 0x42, 0x88, 0x01, 0x80, 0x84, 0x90, 0x64, 0x84, 0x85, 0x88, 0x85, 
-    0x88, 0xEA, 0x94, 0xC7, 0x98, 0x21, 0x84, 0x21, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0xA7, 0x88, 0xA7, 0x88, 0x64, 0x84, 0x21, 0x80, 0x21, 0x80, 0x44, 0x84, 0x85, 0x88, 0x64, 
-    0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x25, 0x80, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xC6, 0x94, 0x08, 0x99, 0x64, 0x88, 0x63, 0x88, 0x21, 0x84, 0x42, 0x84, 0x85, 0x88, 0x86, 
-    0x88, 0x86, 0x88, 0x29, 0x9D, 0xC8, 0x90, 0x42, 0x88, 0x42, 0x84, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0xA7, 0x88, 0xA7, 0x88, 0x64, 0x84, 0x44, 0x84, 0x43, 0x84, 0x22, 0x84, 0x64, 
-    0x88, 0x22, 0x80, 0x22, 0x80, 0x22, 0x80, 0x21, 0x80, 0x45, 0x88, 0xA5, 0x90, 0xC6, 0x94, 
-    0xA5, 0x90, 0xA5, 0x90, 0x08, 0x99, 0xA5, 0x90, 0x21, 0x80, 0x01, 0x80, 0x23, 0x84, 0x86, 
-    0x8C, 0x2C, 0x91, 0x2C, 0x91, 0xAD, 0xB5, 0xE8, 0xA0, 0xA5, 0x90, 0x21, 0x84, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0xA7, 0x88, 0xA7, 0x88, 0x64, 0x84, 0x21, 0x80, 0x21, 0x80, 0xA8, 
-    0x88, 0x85, 0x88, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x23, 0x84, 0xC6, 0x94, 
-    0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0x63, 0x88, 0x01, 0x80, 0x85, 0x88, 0x43, 
-    0x84, 0xA5, 0x90, 0xC9, 0x94, 0xC9, 0x94, 0x4B, 0xAD, 0xC9, 0x94, 0x63, 0x8C, 0x21, 0x84, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xA7, 0x88, 0xA7, 0x88, 0x64, 0x84, 0x22, 0x84, 0x01, 
-    0x80, 0x86, 0x88, 0x44, 0x84, 0x22, 0x80, 0x21, 0x80, 0x22, 0x80, 0x22, 0x84, 0x25, 0x80, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xA5, 0x90, 0x01, 0x80, 0x42, 
-    0x88, 0x23, 0x84, 0xA5, 0x90, 0x09, 0xA5, 0x09, 0xA5, 0xEF, 0xBD, 0x29, 0x9D, 0x63, 0x88, 
-    0x23, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xA7, 0x88, 0xA7, 0x88, 0x64, 0x84, 0x01, 
-    0x80, 0x00, 0x80, 0xA8, 0x88, 0x44, 0x84, 0x64, 0x84, 0x01, 0x80, 0x86, 0x8C, 0x86, 0x8C, 
-    0x25, 0x80, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x08, 0x99, 0xA5, 0x90, 0x01, 
-    0x80, 0x85, 0x88, 0x43, 0x84, 0x84, 0x90, 0x0A, 0x99, 0x0A, 0x99, 0x4B, 0xAD, 0x2A, 0xA9, 
-    0x63, 0x88, 0xA5, 0x90, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xA7, 0x88, 0xA7, 0x88, 0x65, 
-    0x88, 0x43, 0x84, 0x22, 0x84, 0xAA, 0x88, 0x22, 0x84, 0x01, 0x80, 0x01, 0x80, 0x86, 0x88, 
-    0x86, 0x8C, 0x25, 0x80, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x85, 
-    0x88, 0x63, 0x8C, 0x23, 0x84, 0x63, 0x8C, 0xE7, 0x9C, 0x6B, 0xAD, 0x6B, 0xAD, 0xEF, 0xBD, 
-    0xAD, 0xB5, 0xA5, 0x90, 0x64, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xA8, 0x88, 0xA8, 
-    0x88, 0x86, 0x88, 0x86, 0x88, 0x65, 0x88, 0xA8, 0x88, 0x65, 0x88, 0x64, 0x84, 0x01, 0x80, 
-    0xA8, 0x88, 0x86, 0x8C, 0x45, 0x88, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 
-    0x94, 0xA5, 0x90, 0x63, 0x88, 0x84, 0x8C, 0xA5, 0x90, 0xE9, 0x8C, 0xE9, 0x8C, 0xE9, 0x8C, 
-    0xAB, 0x94, 0x89, 0x90, 0x42, 0x84, 0x42, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x86, 
-    0x8C, 0x86, 0x8C, 0x86, 0x88, 0x86, 0x88, 0x65, 0x88, 0xA7, 0x88, 0x65, 0x88, 0x65, 0x88, 
-    0x21, 0x80, 0x85, 0x88, 0x86, 0x8C, 0x45, 0x88, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xC6, 0x94, 0xA5, 0x90, 0x42, 0x88, 0x29, 0xA5, 0x2A, 0xA9, 0xEA, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0x6B, 0xAD, 0xC7, 0x98, 0x84, 0x90, 0xA5, 0x94, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x85, 0x88, 0x85, 0x88, 0x64, 0x84, 0x64, 0x84, 0x43, 0x84, 0x85, 0x88, 0x22, 0x80, 
-    0x22, 0x80, 0x22, 0x80, 0x44, 0x84, 0x43, 0x84, 0x25, 0x80, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0x42, 0x84, 0xA5, 0x90, 0xA5, 0x90, 0xE9, 0x8C, 
-    0xE8, 0xA0, 0xE8, 0xA0, 0x2A, 0xA9, 0xE7, 0x9C, 0xE7, 0x9C, 0xEA, 0x94, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0xA7, 0x88, 0xA7, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 
-    0x85, 0x88, 0x85, 0x88, 0x44, 0x84, 0x85, 0x88, 0x86, 0x8C, 0x25, 0x80, 0xA5, 0x90, 0xC6, 
-    0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0x42, 0x88, 0x42, 0x88, 
-    0x63, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x88, 0x63, 0x8C, 0x63, 0x88, 0x63, 0x88, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0xC8, 0x90, 0xC8, 0x90, 0x85, 0x88, 0x65, 0x88, 0x44, 0x84, 
-    0x65, 0x88, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x64, 0x84, 0x86, 0x8C, 0x23, 0x84, 0xC6, 
-    0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0x84, 0x8C, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0x85, 
-    0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xC8, 0x90, 0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x88, 
-    0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x88, 0x25, 
-    0x80, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 
-    0x90, 0x64, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xEA, 0x8C, 0xEA, 0x8C, 0xC9, 0x94, 
-    0xA7, 0x90, 0x86, 0x8C, 0x65, 0x88, 0x65, 0x88, 0x86, 0x88, 0x64, 0x84, 0x85, 0x88, 0x65, 
-    0x88, 0x25, 0x80, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x08, 
-    0x99, 0xC6, 0x94, 0x64, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xEA, 0x8C, 0xEA, 0x8C, 
-    0xEA, 0x8C, 0xE9, 0x8C, 0xE9, 0x8C, 0xA7, 0x88, 0xA7, 0x88, 0xC8, 0x8C, 0x86, 0x8C, 0xC8, 
-    0x8C, 0x86, 0x88, 0x25, 0x80, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 
-    0x94, 0x08, 0x99, 0xA5, 0x90, 0x64, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x85, 0x88, 
-    0x85, 0x88, 0x86, 0x88, 0x86, 0x88, 0x86, 0x88, 0x64, 0x84, 0x64, 0x84, 0x65, 0x88, 0x65, 
-    0x88, 0x86, 0x88, 0x64, 0x84, 0x23, 0x84, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0x08, 0x99, 0xC6, 0x94, 0x64, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x63, 0x8C, 0x63, 0x8C, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x00, 0x80, 0x00, 
-    0x80, 0x22, 0x84, 0x44, 0x84, 0x44, 0x84, 0x44, 0x84, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 
-    0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0x29, 0x9D, 0xA5, 0x90, 0x64, 0x88, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0xA6, 0x94, 0xA6, 0x94, 0xA6, 0x94, 0xA6, 0x94, 0xA6, 0x94, 0xA6, 0x94, 0x85, 
-    0x88, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0xA5, 0x94, 0xA6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 
-    0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC8, 0x90, 0xC6, 0x94, 0xA5, 
-    0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x29, 0x9D, 0xA5, 0x90, 0x65, 0x88, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0xA6, 0x94, 0xA6, 0x94, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0xA5, 0x94, 0xC6, 0x94, 
-    0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x29, 0x9D, 0xA5, 0x90, 0x65, 0x88, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xA5, 0x94, 0xA5, 0x94, 0x63, 0x8C, 0x42, 0x88, 0x42, 
-    0x88, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0xA5, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xA5, 0x90, 
-    0x65, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x65, 0x88, 0x65, 0x88, 0x84, 0x8C, 0x84, 
-    0x8C, 0x84, 0x8C, 0x65, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x85, 0x88, 0xA5, 0x90, 0xA5, 0x90, 
-    0x86, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 
-    0xA5, 0x90, 0x65, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x42, 0x88, 0x42, 0x88, 0x63, 
-    0x8C, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 
-    0x63, 0x8C, 0x84, 0x8C, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 
-    0x08, 0x99, 0xA5, 0x90, 0x64, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x64, 0x84, 0x64, 
-    0x84, 0x64, 0x84, 0x64, 0x84, 0x64, 0x84, 0x64, 0x84, 0x64, 0x84, 0x44, 0x84, 0x44, 0x84, 
-    0x64, 0x84, 0x44, 0x84, 0x45, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 
-    0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0xA5, 0x90, 0x08, 0x99, 0xA5, 0x90, 0x64, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xE9, 
-    0x8C, 0xE9, 0x8C, 0xC8, 0x8C, 0xC8, 0x8C, 0xC8, 0x8C, 0xC8, 0x8C, 0xC8, 0x8C, 0xA7, 0x88, 
-    0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0x45, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 
-    0xC6, 0x94, 0xA5, 0x90, 0x08, 0x99, 0xA5, 0x90, 0x64, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0xE9, 0x8C, 0xE9, 0x8C, 0xC8, 0x8C, 0xC8, 0x8C, 0xC8, 0x8C, 0xC8, 0x8C, 0xC8, 0x8C, 
-    0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0x45, 0x88, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 
-    0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 
-    0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xA5, 0x90, 0x64, 0x84, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0xE9, 0x8C, 0xE9, 0x8C, 0x85, 0x88, 0x65, 0x88, 0x85, 0x88, 0x85, 0x88, 
-    0x85, 0x88, 0x85, 0x88, 0x65, 0x88, 0xA7, 0x88, 0x85, 0x88, 0x25, 0x80, 0xC6, 0x94, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 
-    0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0x64, 0x84, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0xA8, 0x88, 0xA8, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0x86, 0x8C, 
-    0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x45, 0x88, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xA5, 0x90, 0x64, 
-    0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xA7, 0x88, 0xA7, 0x88, 0x64, 0x84, 0x86, 0x88, 
-    0x43, 0x84, 0x64, 0x84, 0x22, 0x80, 0x22, 0x80, 0x43, 0x84, 0x85, 0x88, 0x65, 0x88, 0x23, 
-    0x84, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x08, 0x99, 0xA5, 
-    0x90, 0x64, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xC8, 0x8C, 0xC8, 0x8C, 0x64, 0x84, 
-    0xC8, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x65, 
-    0x88, 0x25, 0x80, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 
-    0x94, 0xA7, 0x88, 0x64, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xC8, 0x8C, 0xC8, 0x8C, 
-    0x64, 0x84, 0xA7, 0x88, 0x43, 0x84, 0x65, 0x88, 0x22, 0x80, 0x22, 0x80, 0x22, 0x80, 0x85, 
-    0x88, 0x44, 0x84, 0x25, 0x80, 0xC7, 0x98, 0xA5, 0x90, 0xEA, 0x94, 0x29, 0x9D, 0x29, 0x9D, 
-    0x0B, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x0B, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC8, 
-    0x90, 0x08, 0x99, 0x86, 0x8C, 0x64, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xC8, 0x8C, 
-    0xC8, 0x8C, 0x85, 0x88, 0xA7, 0x88, 0x65, 0x88, 0xA7, 0x88, 0x65, 0x88, 0x65, 0x88, 0x21, 
-    0x80, 0x86, 0x8C, 0x64, 0x84, 0x44, 0x84, 0xA5, 0x90, 0xC8, 0x8C, 0x2C, 0x91, 0x6F, 0xA5, 
-    0x6F, 0xA5, 0x6F, 0xA5, 0xAD, 0xA5, 0x4E, 0xA1, 0x6F, 0xA5, 0x6F, 0xA5, 0x2C, 0x91, 0x2C, 
-    0x91, 0xA5, 0x90, 0x08, 0x99, 0x85, 0x88, 0x65, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0xE9, 0x8C, 0xE9, 0x8C, 0xC8, 0x8C, 0xC8, 0x8C, 0x85, 0x88, 0xCB, 0x88, 0x65, 0x88, 0x64, 
-    0x84, 0x01, 0x80, 0xA8, 0x88, 0x44, 0x84, 0x03, 0x80, 0xC8, 0x90, 0xC9, 0x94, 0x6F, 0xA5, 
-    0xEA, 0x94, 0x29, 0x80, 0x29, 0x80, 0x48, 0x84, 0x28, 0x80, 0x28, 0x80, 0xE9, 0x8C, 0x2C, 
-    0x9D, 0x2C, 0x9D, 0xA5, 0x90, 0x08, 0x99, 0x86, 0x8C, 0x64, 0x88, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0xAA, 0x88, 0xAA, 0x88, 0x44, 0x84, 0x21, 0x80, 0x21, 0x80, 0xAA, 0x88, 0x64, 
-    0x84, 0x01, 0x80, 0x01, 0x80, 0x86, 0x88, 0x22, 0x84, 0x23, 0x84, 0x08, 0x99, 0xC8, 0x8C, 
-    0x0B, 0x99, 0x4A, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x28, 
-    0x80, 0x0A, 0x99, 0x0A, 0x99, 0xA5, 0x90, 0x08, 0x99, 0x86, 0x8C, 0x64, 0x88, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x01, 0x80, 0xA8, 0x88, 0xA8, 0x88, 0x44, 0x84, 0x21, 0x80, 0x00, 0x80, 0xA8, 
-    0x88, 0x64, 0x84, 0x64, 0x84, 0x22, 0x80, 0x64, 0x84, 0x64, 0x84, 0x03, 0x80, 0xC7, 0x98, 
-    0xC9, 0x94, 0xEA, 0x94, 0x29, 0x80, 0x29, 0x80, 0x29, 0x80, 0x28, 0x80, 0x28, 0x80, 0x03, 
-    0x80, 0x28, 0x80, 0xC9, 0x94, 0xC9, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0x86, 0x8C, 0x64, 0x88, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x86, 0x88, 0x86, 0x88, 0x64, 0x84, 0x22, 0x84, 0x00, 
-    0x80, 0x86, 0x88, 0x86, 0x8C, 0x22, 0x84, 0x01, 0x80, 0x22, 0x84, 0x64, 0x88, 0x03, 0x80, 
-    0xC6, 0x94, 0xA5, 0x90, 0xE9, 0x8C, 0x27, 0x80, 0x4A, 0x80, 0x4C, 0x80, 0x29, 0x80, 0x4A, 
-    0x80, 0x00, 0x80, 0x27, 0x80, 0xC8, 0x90, 0xC8, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x86, 0x8C, 
-    0x64, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x22, 0x84, 0x64, 0x84, 0x64, 0x84, 0x22, 0x84, 0x01, 
-    0x80, 0x00, 0x80, 0x44, 0x84, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x44, 0x84, 
-    0x25, 0x80, 0xE7, 0x9C, 0xA5, 0x90, 0xC9, 0x94, 0x27, 0x80, 0x4A, 0x80, 0x4C, 0x80, 0x4A, 
-    0x80, 0x4C, 0x80, 0x21, 0x80, 0x25, 0x80, 0xA8, 0x88, 0xA8, 0x88, 0xA5, 0x90, 0xA5, 0x90, 
-    0x86, 0x8C, 0x64, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x21, 0x80, 0x86, 0x88, 0x86, 0x88, 0x44, 
-    0x84, 0x21, 0x80, 0x01, 0x80, 0x22, 0x84, 0x21, 0x80, 0x01, 0x80, 0xA7, 0x88, 0x86, 0x8C, 
-    0x21, 0x80, 0x23, 0x84, 0x08, 0x99, 0x84, 0x90, 0xA7, 0x90, 0x25, 0x80, 0x4A, 0x80, 0x4C, 
-    0x80, 0x4A, 0x80, 0x4C, 0x80, 0x00, 0x80, 0x27, 0x80, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x90, 
-    0xA5, 0x90, 0x64, 0x84, 0x43, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x86, 0x88, 0x86, 
-    0x88, 0x43, 0x84, 0x01, 0x80, 0x01, 0x80, 0x44, 0x84, 0x21, 0x80, 0x01, 0x80, 0x65, 0x88, 
-    0x65, 0x88, 0x01, 0x80, 0x03, 0x80, 0xC6, 0x94, 0x84, 0x90, 0xA7, 0x90, 0x27, 0x80, 0x29, 
-    0x80, 0x4C, 0x80, 0x4A, 0x80, 0x4C, 0x80, 0x00, 0x80, 0x27, 0x80, 0xC8, 0x90, 0xC8, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0x64, 0x84, 0x64, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x86, 
-    0x8C, 0x86, 0x8C, 0x64, 0x88, 0x01, 0x80, 0x22, 0x84, 0x86, 0x8C, 0x44, 0x84, 0x64, 0x88, 
-    0x84, 0x90, 0x22, 0x84, 0x01, 0x80, 0x25, 0x80, 0x08, 0x99, 0x44, 0x84, 0xA7, 0x90, 0x27, 
-    0x80, 0x29, 0x80, 0x4C, 0x80, 0x4A, 0x80, 0x4C, 0x80, 0x00, 0x80, 0x27, 0x80, 0xA7, 0x88, 
-    0xA7, 0x88, 0xA5, 0x90, 0xC6, 0x94, 0x64, 0x84, 0x43, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0xC8, 0x8C, 0xC8, 0x8C, 0x86, 0x8C, 0x21, 0x80, 0x44, 0x84, 0xC8, 0x90, 0x86, 0x8C, 
-    0x84, 0x90, 0xA7, 0x90, 0x65, 0x88, 0x22, 0x84, 0x23, 0x84, 0xC6, 0x94, 0x63, 0x8C, 0xA7, 
-    0x88, 0x27, 0x80, 0x29, 0x80, 0x4C, 0x80, 0x4A, 0x80, 0x4A, 0x80, 0x00, 0x80, 0x27, 0x80, 
-    0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x90, 0xC6, 0x94, 0x86, 0x88, 0x64, 0x88, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0xA7, 0x90, 0xA7, 0x90, 0x85, 0x88, 0x21, 0x80, 0x86, 0x8C, 0xEA, 0x8C, 
-    0xC9, 0x94, 0x86, 0x8C, 0xE7, 0x9C, 0x86, 0x8C, 0x44, 0x84, 0x25, 0x80, 0x08, 0x99, 0x43, 
-    0x90, 0xA7, 0x88, 0x27, 0x80, 0x29, 0x80, 0x4C, 0x80, 0x4A, 0x80, 0x4C, 0x80, 0x00, 0x80, 
-    0x27, 0x80, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x90, 0xC6, 0x94, 0xA7, 0x88, 0x64, 0x88, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x85, 0x88, 0x85, 0x88, 0x64, 0x88, 0x01, 0x80, 0x85, 0x88, 
-    0xA7, 0x88, 0x86, 0x8C, 0x65, 0x88, 0x84, 0x90, 0x65, 0x88, 0x22, 0x84, 0x02, 0x80, 0xC7, 
-    0x98, 0x63, 0x88, 0xC8, 0x8C, 0x25, 0x80, 0x4A, 0x80, 0x4C, 0x80, 0x29, 0x80, 0x4A, 0x80, 
-    0x21, 0x80, 0x25, 0x80, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x90, 0xC6, 0x94, 0x86, 0x8C, 0x42, 
-    0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x64, 0x84, 0x64, 0x84, 0x43, 0x84, 0x22, 0x84, 
-    0x22, 0x84, 0x64, 0x88, 0x22, 0x84, 0x21, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x23, 
-    0x84, 0xC9, 0x94, 0x42, 0x88, 0xA7, 0x88, 0x27, 0x80, 0x00, 0x80, 0x24, 0x80, 0x21, 0x80, 
-    0x24, 0x80, 0x00, 0x80, 0x27, 0x80, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x90, 0xC6, 0x94, 0x86, 
-    0x8C, 0x23, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x64, 0x84, 0x64, 0x84, 0x22, 0x84, 
-    0x44, 0x84, 0x64, 0x88, 0x86, 0x8C, 0x64, 0x88, 0x01, 0x80, 0x44, 0x84, 0x85, 0x88, 0x85, 
-    0x88, 0x23, 0x84, 0x08, 0x99, 0x43, 0x90, 0xA7, 0x88, 0x25, 0x80, 0x00, 0x80, 0x4A, 0x80, 
-    0x4A, 0x80, 0x00, 0x80, 0x4A, 0x80, 0x27, 0x80, 0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x90, 0x08, 
-    0x99, 0x86, 0x8C, 0x64, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x86, 0x88, 0x86, 0x88, 
-    0x22, 0x84, 0x44, 0x84, 0x22, 0x84, 0xC8, 0x90, 0x85, 0x88, 0x01, 0x80, 0x44, 0x84, 0xA7, 
-    0x90, 0x86, 0x8C, 0x02, 0x80, 0x08, 0x99, 0x43, 0x90, 0x86, 0x88, 0x27, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x27, 0x80, 0xA7, 0x90, 0xA7, 0x90, 0xA5, 
-    0x90, 0x29, 0x9D, 0xA7, 0x90, 0x64, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x86, 0x88, 
-    0x86, 0x88, 0x22, 0x84, 0x22, 0x84, 0x00, 0x80, 0x85, 0x88, 0x64, 0x88, 0x22, 0x84, 0x44, 
-    0x84, 0xC9, 0x94, 0x85, 0x88, 0x03, 0x80, 0x08, 0x99, 0x43, 0x90, 0xA7, 0x88, 0x86, 0x8C, 
-    0x27, 0x80, 0x28, 0x80, 0x27, 0x80, 0x27, 0x80, 0x27, 0x80, 0x86, 0x8C, 0x86, 0x8C, 0x86, 
-    0x8C, 0xA5, 0x90, 0x08, 0x99, 0xC8, 0x8C, 0x65, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x86, 0x88, 0x86, 0x88, 0x44, 0x84, 0x44, 0x84, 0x22, 0x84, 0x86, 0x8C, 0x85, 0x88, 0x65, 
-    0x88, 0x85, 0x88, 0xEA, 0x8C, 0x86, 0x8C, 0x02, 0x80, 0x08, 0x99, 0x42, 0x88, 0x86, 0x8C, 
-    0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x88, 0xA7, 0x88, 0x86, 0x8C, 0x64, 
-    0x88, 0x64, 0x88, 0xA5, 0x90, 0x08, 0x99, 0xC8, 0x90, 0x65, 0x88, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x86, 0x88, 0x86, 0x88, 0xA7, 0x90, 0x86, 0x88, 0x86, 0x88, 0xE9, 0x8C, 0xC8, 
-    0x90, 0xC8, 0x90, 0xC8, 0x90, 0xC9, 0x94, 0x65, 0x88, 0x03, 0x80, 0xC6, 0x94, 0xA5, 0x90, 
-    0x84, 0x90, 0x84, 0x8C, 0x84, 0x90, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x63, 
-    0x8C, 0x84, 0x8C, 0x84, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0xC8, 0x90, 0x85, 0x88, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x64, 0x84, 0x64, 0x84, 0x86, 0x88, 0x22, 0x84, 0x64, 0x84, 0x85, 
-    0x88, 0x85, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x44, 0x84, 0x03, 0x80, 0xC8, 0x90, 
-    0x08, 0x99, 0xA5, 0x90, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 0x8C, 0x84, 
-    0x8C, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xA7, 0x90, 0x65, 0x88, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x22, 0x84, 0x21, 0x80, 0x21, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x02, 0x80, 
-    0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 
-    0x90, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x29, 0x9D, 0xC8, 0x90, 
-    0x85, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x22, 0x80, 0x22, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x21, 0x80, 0x21, 0x80, 0x22, 0x80, 0x22, 0x80, 0x43, 0x84, 0x44, 0x84, 
-    0x22, 0x80, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x6B, 0xA1, 
-    0xA7, 0x90, 0x65, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x44, 0x84, 0x44, 0x84, 0x44, 
-    0x84, 0x44, 0x84, 0x21, 0x80, 0x43, 0x84, 0x43, 0x84, 0x64, 0x88, 0x44, 0x84, 0x44, 0x84, 
-    0x64, 0x84, 0x44, 0x84, 0xC7, 0x98, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 
-    0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 
-    0x29, 0x9D, 0xC8, 0x90, 0x65, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x64, 0x88, 0x64, 
-    0x88, 0x85, 0x88, 0x65, 0x88, 0x44, 0x84, 0x65, 0x88, 0x44, 0x84, 0x65, 0x88, 0x85, 0x88, 
-    0x85, 0x88, 0x86, 0x8C, 0x64, 0x88, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC8, 0x90, 0x65, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x44, 
-    0x84, 0x44, 0x84, 0x85, 0x88, 0x65, 0x88, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 0x85, 0x88, 
-    0x85, 0x88, 0x86, 0x8C, 0xA7, 0x90, 0x64, 0x88, 0xC7, 0x98, 0x08, 0x99, 0xC6, 0x94, 0x08, 
-    0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 
-    0x29, 0x9D, 0xA5, 0x90, 0x84, 0x8C, 0x84, 0x8C, 0x65, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x64, 0x84, 0x64, 0x84, 0x65, 0x88, 0x65, 0x88, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 
-    0x85, 0x88, 0x65, 0x88, 0x85, 0x88, 0xA7, 0x90, 0x64, 0x88, 0x08, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 
-    0x29, 0x9D, 0x29, 0x9D, 0xC6, 0x94, 0xC6, 0x94, 0x84, 0x8C, 0x65, 0x88, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x65, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x90, 0x86, 0x8C, 0x64, 0x88, 0x85, 0x88, 
-    0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 0x86, 0x8C, 0xA7, 0x90, 0x65, 0x88, 0xC7, 0x98, 0xE7, 
-    0x9C, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 
-    0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x6B, 0xA1, 0x08, 0x99, 0x84, 0x8C, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x86, 0x8C, 0xEA, 0x8C, 0xEA, 0x8C, 0x0B, 0x99, 0xC8, 0x90, 0x86, 0x8C, 
-    0x86, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0xC8, 0x90, 0x85, 0x88, 0x08, 
-    0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0xC9, 0x94, 0x86, 
-    0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x65, 0x88, 0x65, 0x88, 
-    0x43, 0x84, 0x65, 0x88, 0x65, 0x88, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x88, 0xC9, 0x94, 0x65, 
-    0x88, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xE7, 0x9C, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 
-    0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xA7, 
-    0x90, 0x64, 0x84, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x86, 0x88, 
-    0x86, 0x88, 0x64, 0x84, 0x85, 0x88, 0x85, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x90, 0xC9, 
-    0x94, 0x85, 0x88, 0xC8, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0xA7, 0x88, 0x86, 0x8C, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x85, 0x88, 0x86, 0x8C, 0x86, 0x8C, 
-    0xC8, 0x8C, 0xA7, 0x90, 0x64, 0x84, 0x85, 0x88, 0x85, 0x88, 0x86, 0x8C, 0xA7, 0x88, 0xC8, 
-    0x8C, 0xEA, 0x8C, 0x86, 0x8C, 0x08, 0x99, 0xA5, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0xA5, 0x90, 0xA8, 0x88, 0x65, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x86, 0x8C, 0xEA, 0x8C, 
-    0xEA, 0x8C, 0x0B, 0x99, 0xC8, 0x90, 0xA7, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x90, 0xC8, 
-    0x90, 0xC9, 0x94, 0xC9, 0x94, 0x86, 0x8C, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 
-    0xA5, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 
-    0x94, 0xA5, 0x90, 0x63, 0x88, 0x63, 0x88, 0x65, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 
-    0x21, 0x80, 0x21, 0x80, 0x86, 0x88, 0x64, 0x84, 0x64, 0x84, 0x64, 0x88, 0x64, 0x88, 0x64, 
-    0x88, 0x64, 0x88, 0x85, 0x88, 0xA7, 0x88, 0x65, 0x88, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x29, 
-    0x9D, 0x29, 0x9D, 0xA5, 0x90, 0xA5, 0x90, 0x63, 0x88, 0x65, 0x88, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x63, 0x8C, 0x43, 0x84, 0x43, 0x84, 0x44, 0x84, 0x42, 0x88, 0x22, 0x84, 0x00, 0x80, 0x00, 
-    0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x21, 0x80, 0x64, 0x84, 0xC7, 0x98, 0xC6, 0x94, 
-    0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0xC6, 0x94, 0x65, 0x88, 0x86, 0x88, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0xA6, 0x94, 0xA6, 0x94, 0xA6, 0x94, 0xA6, 0x94, 0xA6, 0x94, 0xA6, 0x94, 0x85, 
-    0x88, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0xA5, 0x94, 0xA6, 0x94, 0x64, 0x84, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC7, 0x98, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x6B, 0xA1, 0xA7, 0x88, 0x65, 0x88, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0xA6, 0x94, 0x4A, 0x80, 0x4A, 0x80, 0x6F, 0x84, 0x91, 0x88, 0x6F, 
-    0x84, 0x6F, 0x84, 0x6F, 0x84, 0x91, 0x88, 0x6F, 0x84, 0x4A, 0x80, 0xA5, 0x94, 0x64, 0x84, 
-    0xA6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC7, 0x98, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xC6, 
-    0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0xC8, 0x90, 
-    0x65, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0xA5, 0x94, 0x4A, 0x80, 0x4A, 0x80, 0x6F, 0x84, 0x91, 
-    0x88, 0x91, 0x88, 0x91, 0x88, 0x91, 0x88, 0x91, 0x88, 0x6F, 0x84, 0x4A, 0x80, 0xA5, 0x94, 
-    0x64, 0x84, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x88, 0xC6, 0x94, 0xC6, 
-    0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 
-    0xA7, 0x88, 0x64, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x65, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x84, 
-    0x8C, 0x84, 0x8C, 0x65, 0x88, 0x84, 0x8C, 0x84, 0x8C, 0x85, 0x88, 0xA5, 0x90, 0xA5, 0x90, 
-    0x86, 0x8C, 0x64, 0x84, 0xC6, 0x94, 0xA5, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xA7, 0x90, 0x64, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x42, 0x88, 0x63, 0x8C, 0x63, 
-    0x8C, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 0x42, 0x88, 0x63, 0x8C, 0x42, 0x88, 
-    0x63, 0x8C, 0x84, 0x8C, 0x64, 0x84, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 0x90, 
-    0x86, 0x8C, 0x86, 0x8C, 0x64, 0x88, 0x65, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x42, 0x88, 0x21, 
-    0x84, 0x21, 0x84, 0x21, 0x84, 0x00, 0x80, 0x00, 0x80, 0x63, 0x8C, 0x42, 0x88, 0x01, 0x80, 
-    0x21, 0x80, 0x42, 0x88, 0x21, 0x84, 0x03, 0x80, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0x08, 0x99, 0x29, 0x9D, 0x6B, 0xA1, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 
-    0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0xA7, 0x88, 0x64, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x63, 
-    0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0x21, 0x84, 0x21, 0x84, 0x84, 0x90, 0x63, 0x8C, 
-    0x22, 0x84, 0x43, 0x84, 0x63, 0x8C, 0x63, 0x8C, 0x03, 0x80, 0xA5, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0xC8, 0x8C, 0x64, 0x88, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x63, 0x8C, 0x84, 0x90, 0x84, 0x90, 0x84, 0x90, 0x63, 0x8C, 0x63, 0x8C, 0xA6, 0x94, 
-    0x84, 0x90, 0x43, 0x84, 0x64, 0x84, 0x63, 0x8C, 0x63, 0x8C, 0x03, 0x80, 0xC6, 0x94, 0xC6, 
-    0x94, 0xA5, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x86, 0x8C, 0x64, 0x88, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0xA5, 0x94, 0xA6, 0x94, 0xA6, 0x94, 0xA6, 0x94, 0xA5, 0x94, 0xA6, 0x94, 
-    0xC7, 0x98, 0xC7, 0x98, 0x65, 0x88, 0xA7, 0x88, 0xC7, 0x98, 0x84, 0x90, 0x03, 0x80, 0xA5, 
-    0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x94, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0xA5, 0x94, 0x85, 
-    0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0xC6, 0x94, 0xE7, 0x9C, 0xE7, 0x9C, 0xE7, 0x9C, 0xA5, 0x94, 
-    0xA5, 0x94, 0xE8, 0xA0, 0xC7, 0x98, 0x65, 0x88, 0x85, 0x88, 0xA7, 0x88, 0x86, 0x8C, 0x05, 
-    0x80, 0xA5, 0x90, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xC7, 0x98, 0xE7, 0x9C, 0x2A, 0xA9, 
-    0x31, 0xC6, 0x6B, 0xB1, 0x29, 0x9D, 0xA5, 0x94, 0xA5, 0x94, 0xA7, 0x90, 0xC6, 0x94, 0xC6, 
-    0x94, 0x85, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0xC6, 0x94, 0xC6, 0x94, 0x29, 0xA5, 0x29, 0xA5, 0x29, 0xA5, 
-    0xE7, 0x9C, 0xE7, 0x9C, 0x2A, 0xA9, 0xE8, 0xA0, 0x85, 0x88, 0x85, 0x88, 0xA7, 0x88, 0xA7, 
-    0x88, 0x03, 0x80, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0xA7, 0x88, 0x84, 0x90, 0x09, 0xA5, 
-    0xA7, 0x88, 0x25, 0x80, 0x23, 0x84, 0x85, 0x88, 0xE7, 0x9C, 0xE7, 0x9C, 0xA6, 0x94, 0xC6, 
-    0x94, 0x08, 0x99, 0xA5, 0x90, 0x63, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0xC6, 0x94, 0x29, 0x9D, 0xE7, 0x9C, 0x29, 0xA5, 0x29, 0xA5, 
-    0x2A, 0xAD, 0x4B, 0xAD, 0x4B, 0xAD, 0x2A, 0xA9, 0xC7, 0x98, 0x63, 0x88, 0x86, 0x88, 0xA5, 
-    0x94, 0x84, 0x90, 0x05, 0x80, 0x84, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0x65, 0x88, 0xC7, 0x98, 
-    0x86, 0x88, 0x25, 0x80, 0x8C, 0x88, 0x69, 0x84, 0x03, 0x80, 0x85, 0x88, 0x85, 0x88, 0xA5, 
-    0x94, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xA5, 0x90, 0x63, 0x8C, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 
-    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 
-    0x80, 0x84, 0x8C, 0xC6, 0x94, 0x29, 0x9D, 0x6B, 0xA1, 0x29, 0x9D, 0xE7, 0x9C, 0x2A, 0xA9, 
-    0x2A, 0xA9, 0x09, 0xA5, 0x21, 0x84, 0x21, 0x84, 0x84, 0x90, 0x63, 0x8C, 0x22, 0x84, 0x43, 
-    0x84, 0x63, 0x8C, 0x63, 0x8C, 0x03, 0x80, 0x85, 0x88, 0x86, 0x88, 0x86, 0x88, 0x84, 0x90, 
-    0x64, 0x84, 0x85, 0x88, 0x27, 0x80, 0x69, 0x84, 0x25, 0x80, 0x23, 0x84, 0x64, 0x84, 0x64, 
-    0x84, 0xA5, 0x94, 0x86, 0x8C, 0xC6, 0x94, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 
-    0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 
-    0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 
-    0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 
-    0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 
-    0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 
-    0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 
-    0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0xE7, 0x9C, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0x29, 0x9D, 0xE7, 0x9C, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0xE7, 0x9C, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 
-    0x9D, 0xE7, 0x9C, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 
-    0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 
-    0x99, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 
-    0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 
-    0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xE7, 0x9C, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 
-    0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 
-    0x9D, 0x6B, 0xA1, 0x6B, 0xA1, 0x69, 0x91, 0x69, 0x91, 0x69, 0x91, 0x6B, 0xA1, 0x6B, 0xA1, 
-    0x6B, 0xA1, 0x8C, 0xA1, 0x8C, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 
-    0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 
-    0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x6B, 
-    0xA1, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x08, 0x99, 0xE7, 0x9C, 
-    0x09, 0xA5, 0x09, 0xA5, 0xE9, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0xA6, 0x94, 0x84, 0x90, 0x43, 
-    0x84, 0x64, 0x84, 0x63, 0x8C, 0x63, 0x8C, 0x03, 0x80, 0x63, 0x8C, 0xA7, 0x88, 0x64, 0x84, 
-    0x42, 0x88, 0xA7, 0x88, 0x86, 0x8C, 0x42, 0x84, 0x25, 0x80, 0x23, 0x84, 0x02, 0x80, 0x65, 
-    0x88, 0x65, 0x88, 0xA5, 0x94, 0x86, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0x29, 0x9D, 
-    0x6B, 0xA1, 0x8C, 0xA1, 0xAD, 0xA5, 0xCE, 0xA9, 0xCE, 0xA9, 0xCE, 0xA9, 0xCE, 0xA9, 0x0E, 
-    0xA6, 0x0E, 0xA6, 0xEB, 0x99, 0x0E, 0xA6, 0xCC, 0xA1, 0xEB, 0x99, 0x0E, 0xA6, 0xEB, 0x99, 
-    0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0xEB, 0x99, 0x0E, 0xA6, 0x0E, 0xA6, 0xEB, 
-    0x99, 0xCC, 0xA1, 0xCC, 0xA1, 0x0E, 0xA6, 0xCC, 0xA1, 0x0E, 0xA6, 0x50, 0xB2, 0x50, 0xB2, 
-    0x50, 0xB2, 0x50, 0xB2, 0x50, 0xB2, 0x50, 0xB2, 0x50, 0xB2, 0x50, 0xB2, 0x50, 0xB2, 0x0E, 
-    0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0xEB, 0x99, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 
-    0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0x0E, 
-    0xA6, 0x0E, 0xA6, 0x0E, 0xA6, 0xAD, 0xA5, 0xAD, 0xA5, 0xAD, 0xA5, 0x8C, 0xA1, 0x6B, 0xA1, 
-    0x29, 0x9D, 0x69, 0x91, 0xC8, 0x8C, 0xE7, 0x9C, 0x27, 0x80, 0x6F, 0xA5, 0xAD, 0xA5, 0xAD, 
-    0xA5, 0xAD, 0xA5, 0xEE, 0xAD, 0xAD, 0xB5, 0xAD, 0xB5, 0xAD, 0xA5, 0xCE, 0xA9, 0x30, 0xB6, 
-    0xAD, 0xB5, 0xAD, 0xA5, 0xCE, 0xA9, 0x0F, 0xB2, 0xAD, 0xB5, 0x8C, 0xA1, 0x8C, 0xA1, 0x0F, 
-    0xB2, 0xAD, 0xB5, 0x8C, 0xA1, 0xAD, 0xA5, 0x0F, 0xB2, 0xAD, 0xB5, 0x4E, 0xA1, 0xCE, 0xA9, 
-    0x0F, 0xB2, 0x6B, 0xB1, 0x8C, 0xA1, 0x8C, 0xA1, 0x8C, 0xA1, 0xCE, 0xA9, 0xAD, 0xB5, 0x6B, 
-    0xA1, 0xAD, 0xA5, 0x30, 0xB6, 0xAD, 0xB5, 0xAD, 0xA5, 0xCE, 0xA9, 0x51, 0xBA, 0xAD, 0xB5, 
-    0xAD, 0xB5, 0x6B, 0xB1, 0x4B, 0xAD, 0x4B, 0xAD, 0x4B, 0xAD, 0x4B, 0xAD, 0x4B, 0xAD, 0x4B, 
-    0xAD, 0x4B, 0xAD, 0xAD, 0xB5, 0xAD, 0xB5, 0xCE, 0xA9, 0xB0, 0xA9, 0xB3, 0xBE, 0xEF, 0xBD, 
-    0x0F, 0xB2, 0x72, 0xBE, 0xEF, 0xBD, 0xCE, 0xA9, 0xB0, 0xA9, 0xB3, 0xBE, 0xEF, 0xBD, 0xCE, 
-    0xA9, 0xAD, 0xB5, 0xCE, 0xA9, 0x72, 0xBE, 0xEF, 0xBD, 0xCE, 0xA9, 0xEE, 0xAD, 0x72, 0xBE, 
-    0xCE, 0xA9, 0xEE, 0xAD, 0xB0, 0xA9, 0x72, 0xBE, 0xAD, 0xB5, 0xAD, 0xB5, 0x51, 0xBA, 0xB0, 
-    0xA9, 0xAD, 0xB5, 0xAD, 0xA5, 0x51, 0xBA, 0xAD, 0xA5, 0xCE, 0xA9, 0xCE, 0xA9, 0xCE, 0xA9, 
-    0x51, 0xBA, 0xAD, 0xA5, 0xCE, 0xA9, 0x6F, 0xA5, 0x0F, 0xB2, 0x29, 0x9D, 0x29, 0x9D, 0x6B, 
-    0xA1, 0x6B, 0xA1, 0x6B, 0xA1, 0x8C, 0xA1, 0xCE, 0xA9, 0xCE, 0xA9, 0xCE, 0xA9, 0x0E, 0xA6, 
-    0x0E, 0xA6, 0x50, 0xB2, 0x0E, 0xA6, 0xCC, 0xA1, 0xEB, 0x99, 0xCC, 0xA1, 0xCC, 0xA1, 0xCC, 
-    0xA1, 0xEB, 0x99, 0x0E, 0xA6, 0xEB, 0x99, 0x0E, 0xA6, 0xEB, 0x99, 0x0E, 0xA6, 0xCC, 0xA1, 
-    0x0E, 0xA6, 0xEB, 0x99, 0x0E, 0xA6, 0xEB, 0x99, 0x0E, 0xA6, 0xEB, 0x99, 0x2F, 0xAA, 0x0E, 
-    0xA6, 0x2F, 0xAA, 0x0E, 0xA6, 0x0E, 0xA6, 0x50, 0xB2, 0x50, 0xB2, 0x50, 0xB2, 0x50, 0xB2, 
-    0x2F, 0xAA, 0x50, 0xB2, 0x50, 0xB2, 0x50, 0xB2, 0x50, 0xB2, 0x50, 0xB2, 0x50, 0xB2, 0x50, 
-    0xB2, 0x50, 0xB2, 0x50, 0xB2, 0x71, 0xB6, 0x71, 0xB6, 0x71, 0xB6, 0x50, 0xB2, 0x71, 0xB6, 
-    0xB3, 0xBE, 0xB3, 0xBE, 0x2F, 0xAA, 0xAD, 0xA5, 0xAD, 0xA5, 0x6B, 0xA1, 0x6B, 0xA1, 0x29, 
-    0x9D, 0x29, 0x9D, 0x08, 0x99, 0xA7, 0x88, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0xE7, 0x9C, 
-    0x09, 0xA5, 0xE8, 0xA0, 0xE8, 0xA0, 0x67, 0x8C, 0xA5, 0x94, 0xA6, 0x94, 0xC7, 0x98, 0xC7, 
-    0x98, 0x65, 0x88, 0xA7, 0x88, 0xC7, 0x98, 0x84, 0x90, 0x03, 0x80, 0x85, 0x88, 0x65, 0x88, 
-    0x65, 0x88, 0x42, 0x88, 0x63, 0x8C, 0xE7, 0x9C, 0x86, 0x8C, 0x03, 0x80, 0x03, 0x80, 0x65, 
-    0x88, 0xA7, 0x88, 0xA7, 0x88, 0x84, 0x90, 0x85, 0x88, 0xA7, 0x88, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 
-    0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x29, 0x9D, 0x08, 
-    0x99, 0xC9, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x27, 0x8D, 
-    0x08, 0x99, 0xEA, 0x94, 0x69, 0x91, 0x08, 0x99, 0xC6, 0x94, 0x27, 0x8D, 0x08, 0x99, 0xC6, 
-    0x94, 0x27, 0x8D, 0xC9, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0x27, 0x8D, 
-    0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0x27, 0x8D, 0xC6, 0x94, 0x08, 0x99, 0xC6, 
-    0x94, 0x27, 0x8D, 0xC6, 0x94, 0x08, 0x99, 0xC6, 0x94, 0x27, 0x8D, 0x08, 0x99, 0xC6, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0x27, 0x8D, 0x6B, 0xA1, 0x6B, 0xA1, 0x23, 0x84, 0x2C, 0x91, 0xE9, 
-    0x8C, 0x84, 0x90, 0x63, 0x8C, 0x4D, 0x9D, 0xC7, 0x98, 0xC7, 0x98, 0x84, 0x90, 0x65, 0x88, 
-    0xAD, 0xB5, 0xC7, 0x98, 0x45, 0x88, 0x65, 0x88, 0x2C, 0x91, 0xE9, 0x8C, 0xA5, 0x94, 0x63, 
-    0x8C, 0x2C, 0x9D, 0xC7, 0x98, 0x63, 0x8C, 0x65, 0x88, 0x4B, 0xAD, 0xE7, 0x9C, 0x64, 0x88, 
-    0x64, 0x88, 0x2C, 0x9D, 0xC8, 0x8C, 0xA7, 0x90, 0x85, 0x88, 0x63, 0x8C, 0x2C, 0x9D, 0xC7, 
-    0x98, 0x63, 0x8C, 0x65, 0x88, 0xAD, 0xB5, 0xC7, 0x98, 0x86, 0x88, 0x84, 0x8C, 0x4E, 0xA1, 
-    0x0A, 0x99, 0x23, 0x84, 0x6B, 0xB1, 0x4B, 0xAD, 0x4B, 0xAD, 0x4B, 0xAD, 0x4B, 0xAD, 0x4B, 
-    0xAD, 0x4B, 0xAD, 0x4B, 0xAD, 0x6B, 0xB1, 0x84, 0x90, 0x86, 0x88, 0x65, 0x88, 0x4E, 0xA1, 
-    0x0A, 0x99, 0x86, 0x88, 0xAD, 0xB5, 0x84, 0x90, 0x66, 0x8C, 0x85, 0x88, 0x4E, 0xA1, 0xEA, 
-    0x94, 0xE9, 0x8C, 0xA5, 0x94, 0x63, 0x8C, 0x4D, 0x9D, 0xA5, 0x90, 0x84, 0x90, 0x65, 0x88, 
-    0x6B, 0xAD, 0xA5, 0x94, 0x65, 0x88, 0x64, 0x84, 0x4D, 0x9D, 0xEA, 0x94, 0x44, 0x84, 0x2C, 
-    0x91, 0xAB, 0x94, 0xA5, 0x90, 0x63, 0x88, 0x4D, 0x9D, 0xA5, 0x90, 0x63, 0x8C, 0x65, 0x88, 
-    0x65, 0x88, 0x4B, 0xAD, 0xA5, 0x90, 0x65, 0x88, 0x64, 0x88, 0x0A, 0x99, 0xEA, 0x94, 0x29, 
-    0x9D, 0x6B, 0xA1, 0x27, 0x8D, 0x85, 0x88, 0xA7, 0x88, 0x86, 0x88, 0xA7, 0x88, 0xA5, 0x90, 
-    0xA7, 0x88, 0xA7, 0x88, 0xA5, 0x94, 0xC6, 0x94, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 
-    0x88, 0x86, 0x8C, 0xA7, 0x88, 0x86, 0x8C, 0xA7, 0x88, 0xC8, 0x8C, 0xA7, 0x90, 0xA7, 0x88, 
-    0xA7, 0x88, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x90, 0xA8, 0x88, 0x08, 
-    0x99, 0xA7, 0x88, 0xA7, 0x88, 0xC6, 0x94, 0xC8, 0x8C, 0xC8, 0x8C, 0xE5, 0x84, 0xA7, 0x88, 
-    0xC8, 0x8C, 0xE5, 0x84, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC6, 0x94, 0xEB, 0x84, 0xE5, 0x84, 0xA7, 0x88, 0x86, 0x88, 0x27, 0x80, 0x25, 0x80, 0x46, 
-    0x84, 0x27, 0x80, 0x25, 0x80, 0x27, 0x80, 0x25, 0x80, 0x46, 0x84, 0x84, 0x90, 0xE7, 0x9C, 
-    0xE8, 0xA0, 0x2A, 0xA9, 0x08, 0x99, 0x08, 0x99, 0x67, 0x8C, 0xA5, 0x94, 0xA5, 0x94, 0xE8, 
-    0xA0, 0xC7, 0x98, 0x65, 0x88, 0x85, 0x88, 0xA7, 0x88, 0x86, 0x8C, 0x05, 0x80, 0x84, 0x90, 
-    0x85, 0x88, 0x65, 0x88, 0x44, 0x84, 0x21, 0x84, 0x84, 0x90, 0xE7, 0x9C, 0x08, 0x99, 0xC6, 
-    0x94, 0xA7, 0x90, 0x63, 0x8C, 0x63, 0x8C, 0x65, 0x88, 0x86, 0x88, 0xA7, 0x88, 0xA7, 0x88, 
-    0xC6, 0x94, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 
-    0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 
-    0x29, 0x9D, 0x29, 0x9D, 0x29, 0x9D, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0xC8, 0x90, 
-    0xC8, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 
-    0x88, 0xA7, 0x88, 0xC8, 0x8C, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0xC8, 0x90, 
-    0xA7, 0x88, 0xC8, 0x8C, 0xA7, 0x88, 0xA7, 0x88, 0xC8, 0x8C, 0xA7, 0x90, 0xC8, 0x90, 0xA7, 
-    0x88, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0xC8, 0x8C, 0xA7, 0x90, 0xA7, 0x88, 
-    0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0x09, 0xA5, 0x6F, 0xA5, 0x6F, 0xA5, 0x84, 0x8C, 0xE9, 
-    0x8C, 0xA7, 0x90, 0x63, 0x8C, 0x85, 0x88, 0xA7, 0x90, 0x84, 0x90, 0x84, 0x90, 0x64, 0x88, 
-    0x44, 0x84, 0xC8, 0x90, 0x63, 0x8C, 0x23, 0x84, 0x64, 0x84, 0xE9, 0x8C, 0x86, 0x8C, 0x84, 
-    0x90, 0x86, 0x88, 0x86, 0x8C, 0x84, 0x90, 0x44, 0x84, 0x64, 0x88, 0xA7, 0x90, 0x63, 0x8C, 
-    0x64, 0x84, 0x43, 0x84, 0xA7, 0x88, 0x86, 0x8C, 0xA7, 0x88, 0x84, 0x90, 0x64, 0x88, 0xA7, 
-    0x88, 0x84, 0x90, 0x63, 0x8C, 0x64, 0x84, 0xC8, 0x90, 0x84, 0x8C, 0x45, 0x88, 0x64, 0x84, 
-    0xE9, 0x8C, 0xA7, 0x90, 0x44, 0x84, 0x29, 0xA5, 0x2A, 0xAD, 0x6B, 0xB1, 0xAD, 0xB5, 0xAD, 
-    0xB5, 0xAD, 0xB5, 0x6B, 0xB1, 0x6B, 0xB1, 0x2A, 0xAD, 0x63, 0x8C, 0x23, 0x84, 0x65, 0x88, 
-    0xC8, 0x90, 0xA7, 0x88, 0x45, 0x88, 0xE9, 0x8C, 0x84, 0x90, 0x44, 0x84, 0x64, 0x88, 0xE9, 
-    0x8C, 0xA7, 0x88, 0xA7, 0x90, 0x63, 0x8C, 0x86, 0x88, 0xA8, 0x88, 0x84, 0x90, 0x63, 0x8C, 
-    0x64, 0x84, 0xE9, 0x8C, 0x84, 0x90, 0x23, 0x84, 0x64, 0x84, 0xE9, 0x8C, 0xA8, 0x88, 0x42, 
-    0x88, 0xE9, 0x8C, 0xA7, 0x88, 0x84, 0x90, 0x65, 0x88, 0xA7, 0x88, 0x84, 0x90, 0x63, 0x8C, 
-    0x23, 0x84, 0x23, 0x84, 0xC8, 0x8C, 0x63, 0x8C, 0x23, 0x84, 0x64, 0x84, 0xA7, 0x88, 0xA7, 
-    0x88, 0x4E, 0xA1, 0x6F, 0xA5, 0x0B, 0x99, 0x85, 0x88, 0xA7, 0x88, 0x86, 0x8C, 0x86, 0x8C, 
-    0xA7, 0x88, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x94, 0xA5, 0x94, 0x86, 0x8C, 0x86, 0x8C, 0xA5, 
-    0x90, 0xA7, 0x88, 0x86, 0x8C, 0x86, 0x88, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0xA5, 0x90, 0xA5, 0x94, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 
-    0x94, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0x86, 0x88, 0xA7, 0x88, 0xA7, 0x88, 
-    0xA7, 0x88, 0xA7, 0x88, 0xC8, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x86, 0x8C, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0x6B, 0xB1, 0xAD, 0xB5, 0xAD, 0xB5, 0x2A, 0xA9, 0x08, 0x99, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xE9, 0x8C, 0x67, 0x8C, 0x85, 0x88, 0x27, 0x80, 0x23, 
-    0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x25, 0x80, 0x25, 0x80, 0x48, 0x84, 0xA5, 0x94, 
-    0xA5, 0x94, 0xE7, 0x9C, 0xE8, 0xA0, 0x86, 0x8C, 0x86, 0x8C, 0xC9, 0x94, 0xE7, 0x9C, 0xE7, 
-    0x9C, 0x2A, 0xA9, 0xE8, 0xA0, 0x85, 0x88, 0x85, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0x03, 0x80, 
-    0xA5, 0x90, 0xA5, 0x90, 0x85, 0x88, 0x64, 0x84, 0x42, 0x88, 0x63, 0x8C, 0x01, 0x80, 0x01, 
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x84, 0x8C, 0x84, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 0xC6, 0x94, 
-    0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xA7, 0x88, 0x86, 
-    0x88, 0x67, 0x8C, 0x85, 0x88, 0x85, 0x88, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA5, 0x90, 0xA8, 0x88, 
-    0xC8, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0xC8, 
-    0x90, 0x86, 0x8C, 0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x8C, 0xA7, 0x90, 
-    0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 
-    0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 
-    0xC8, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0x2C, 0x9D, 0x6F, 0xA5, 0xB0, 0xA9, 0x83, 
-    0x80, 0x66, 0x8C, 0x42, 0x88, 0x42, 0x84, 0x84, 0x90, 0x23, 0x84, 0x42, 0x80, 0x42, 0x80, 
-    0x66, 0x8C, 0x42, 0x88, 0x42, 0x84, 0xA7, 0x88, 0x22, 0x84, 0x22, 0x84, 0x42, 0x88, 0x22, 
-    0x84, 0x84, 0x90, 0x21, 0x84, 0x22, 0x84, 0x84, 0x90, 0x42, 0x88, 0x22, 0x84, 0x63, 0x8C, 
-    0x42, 0x84, 0x42, 0x84, 0x85, 0x88, 0x64, 0x88, 0x23, 0x84, 0x42, 0x84, 0x63, 0x8C, 0x42, 
-    0x88, 0x02, 0x80, 0x84, 0x90, 0x42, 0x88, 0x23, 0x84, 0x84, 0x90, 0x23, 0x84, 0x42, 0x84, 
-    0x22, 0x84, 0x01, 0x80, 0x86, 0x8C, 0x22, 0x84, 0xE7, 0x9C, 0x6B, 0xAD, 0xAD, 0xB5, 0xEF, 
-    0xBD, 0xEF, 0xBD, 0xEF, 0xBD, 0xAD, 0xB5, 0x6B, 0xAD, 0xE7, 0x9C, 0x02, 0x80, 0xA7, 0x88, 
-    0x01, 0x80, 0x22, 0x84, 0x23, 0x84, 0x42, 0x84, 0x84, 0x90, 0x84, 0x90, 0x42, 0x88, 0x86, 
-    0x8C, 0x65, 0x88, 0x44, 0x84, 0x23, 0x84, 0x84, 0x90, 0x42, 0x88, 0x42, 0x84, 0x84, 0x90, 
-    0x42, 0x84, 0x22, 0x84, 0x84, 0x90, 0x42, 0x88, 0x42, 0x84, 0x86, 0x8C, 0x65, 0x88, 0x44, 
-    0x84, 0x66, 0x8C, 0x42, 0x88, 0x22, 0x84, 0x84, 0x90, 0x22, 0x84, 0x01, 0x80, 0x84, 0x90, 
-    0x42, 0x84, 0x42, 0x80, 0x42, 0x80, 0x84, 0x90, 0x21, 0x84, 0x42, 0x84, 0x85, 0x88, 0x84, 
-    0x8C, 0x64, 0x84, 0x4D, 0x9D, 0x4D, 0x9D, 0x0A, 0x99, 0x85, 0x88, 0xA7, 0x90, 0x86, 0x8C, 
-    0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0xC6, 0x94, 0xA5, 0x94, 0x86, 0x8C, 0xA5, 0x90, 0xA7, 
-    0x88, 0xA7, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x90, 
-    0xA5, 0x90, 0xA5, 0x90, 0xA5, 0x94, 0xA5, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0x86, 
-    0x8C, 0x85, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0xA5, 0x90, 
-    0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0xA7, 0x90, 0x85, 0x88, 0x85, 0x88, 0x86, 0x8C, 0x86, 
-    0x8C, 0xA5, 0x94, 0x2A, 0xA9, 0x0B, 0x99, 0xA7, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x88, 
-    0x2A, 0xA9, 0x2A, 0xA9, 0xC7, 0x98, 0xA7, 0x88, 0xEA, 0x94, 0xA7, 0x90, 0x64, 0x84, 0x25, 
-    0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x25, 0x80, 0x05, 0x80, 0x05, 0x80, 0x48, 0x84, 
-    0x67, 0x8C, 0x67, 0x8C, 0x48, 0x84, 0x08, 0x80, 0x48, 0x84, 0x48, 0x84, 0xA7, 0x90, 0x4B, 
-    0xAD, 0x4B, 0xAD, 0x2A, 0xA9, 0xC7, 0x98, 0x63, 0x88, 0x86, 0x88, 0xA5, 0x94, 0x84, 0x90, 
-    0x05, 0x80, 0x63, 0x8C, 0xA5, 0x90, 0x84, 0x90, 0xA5, 0x90, 0x84, 0x8C, 0x64, 0x84, 0x42, 
-    0x88, 0x42, 0x88, 0x42, 0x88, 0x84, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 0xC6, 0x94, 0xC6, 0x94, 
-    0xC7, 0x98, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0x08, 0x99, 0xC6, 0x94, 0xA7, 0x88, 0x46, 
-    0x84, 0x03, 0x80, 0x03, 0x80, 0x01, 0x80, 0x02, 0x80, 0x24, 0x80, 0x86, 0x8C, 0xA5, 0x90, 
-    0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 
-    0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x88, 
-    0xA7, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x88, 0xA5, 
-    0x90, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x90, 
-    0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x8C, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 
-    0x88, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0xC8, 0x90, 0xA7, 0x88, 
-    0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0x0A, 0x99, 0x2C, 0x91, 0x2C, 
-    0x91, 0x65, 0x88, 0x08, 0x99, 0x63, 0x8C, 0x84, 0x90, 0x08, 0x99, 0x63, 0x8C, 0x84, 0x90, 
-    0x84, 0x90, 0xE8, 0xA0, 0x63, 0x8C, 0x84, 0x90, 0xE7, 0x9C, 0x63, 0x8C, 0x84, 0x90, 0xE7, 
-    0x9C, 0x63, 0x8C, 0x84, 0x90, 0xE7, 0x9C, 0x63, 0x8C, 0x84, 0x90, 0xC7, 0x98, 0x63, 0x88, 
-    0x85, 0x88, 0xE7, 0x9C, 0x63, 0x8C, 0x84, 0x90, 0xA5, 0x94, 0x63, 0x8C, 0x85, 0x88, 0xE7, 
-    0x9C, 0x63, 0x8C, 0x64, 0x88, 0xE8, 0xA0, 0x63, 0x88, 0x84, 0x90, 0x08, 0x99, 0x63, 0x8C, 
-    0x84, 0x90, 0x01, 0x80, 0x22, 0x84, 0xA7, 0x90, 0x23, 0x84, 0xA5, 0x94, 0x4E, 0xA1, 0x33, 
-    0x9D, 0xAA, 0x94, 0xAD, 0x8C, 0x6A, 0x88, 0x33, 0x9D, 0x4D, 0x9D, 0xA5, 0x94, 0x64, 0x88, 
-    0xA7, 0x90, 0x01, 0x80, 0x22, 0x84, 0x21, 0x84, 0x84, 0x90, 0x63, 0x8C, 0xE8, 0xA0, 0x84, 
-    0x90, 0x63, 0x8C, 0xE8, 0xA0, 0x85, 0x88, 0x84, 0x90, 0xE7, 0x9C, 0x86, 0x8C, 0x63, 0x8C, 
-    0xE7, 0x9C, 0x84, 0x90, 0x84, 0x90, 0xE7, 0x9C, 0x86, 0x8C, 0x63, 0x8C, 0xC7, 0x98, 0x84, 
-    0x90, 0x63, 0x8C, 0xE7, 0x9C, 0x84, 0x90, 0x63, 0x8C, 0xC7, 0x98, 0x84, 0x90, 0x63, 0x8C, 
-    0xE7, 0x9C, 0x84, 0x90, 0x63, 0x8C, 0x63, 0x8C, 0xE7, 0x9C, 0x63, 0x8C, 0x63, 0x88, 0xE7, 
-    0x9C, 0x84, 0x90, 0x64, 0x88, 0x0A, 0x99, 0x0A, 0x99, 0xA7, 0x90, 0x85, 0x88, 0x86, 0x8C, 
-    0x86, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 0x86, 0x8C, 0xC6, 0x94, 0xA5, 0x94, 0xA5, 0x94, 0xA7, 
-    0x88, 0xA7, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x88, 
-    0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0x86, 
-    0x8C, 0x86, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 
-    0x86, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x86, 0x8C, 0x85, 0x88, 0xA5, 
-    0x94, 0x63, 0x8C, 0xC6, 0x94, 0x29, 0x9D, 0x25, 0x80, 0x28, 0x80, 0x29, 0x80, 0x28, 0x80, 
-    0x25, 0x80, 0x86, 0x88, 0x29, 0x9D, 0xE7, 0x9C, 0xC8, 0x8C, 0xE9, 0x8C, 0x86, 0x8C, 0x64, 
-    0x88, 0x25, 0x80, 0x23, 0x80, 0x23, 0x80, 0x26, 0x80, 0x05, 0x80, 0x05, 0x80, 0x26, 0x80, 
-    0x67, 0x8C, 0x45, 0x88, 0x48, 0x84, 0x4B, 0xAD, 0x2A, 0xA9, 0x86, 0x8C, 0x86, 0x8C, 0x65, 
-    0x88, 0x09, 0xA5, 0xE8, 0xA0, 0xE7, 0x9C, 0xA5, 0x94, 0x02, 0x80, 0x85, 0x88, 0xA5, 0x94, 
-    0x84, 0x90, 0x03, 0x80, 0x63, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0xA7, 
-    0x88, 0x86, 0x8C, 0x65, 0x88, 0x85, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 
-    0xA7, 0x88, 0xA7, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x88, 0x86, 0x8C, 0x85, 
-    0x88, 0x25, 0x80, 0x00, 0x80, 0x42, 0x88, 0x25, 0x80, 0x03, 0x80, 0x24, 0x80, 0x85, 0x88, 
-    0xA7, 0x88, 0xA7, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x86, 
-    0x8C, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xC6, 0x94, 
-    0x86, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 
-    0x88, 0xA7, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0xC8, 0x90, 0xA7, 0x88, 
-    0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 
-    0x88, 0xC8, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x88, 
-    0xC8, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0xA5, 
-    0x90, 0xA5, 0x90, 0x84, 0x90, 0x84, 0x90, 0x42, 0x88, 0x63, 0x8C, 0xA7, 0x88, 0x42, 0x88, 
-    0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x23, 0x84, 0x42, 0x88, 0x84, 0x90, 0x42, 0x88, 0x42, 
-    0x88, 0x86, 0x88, 0x42, 0x88, 0x42, 0x88, 0x86, 0x88, 0x42, 0x88, 0x42, 0x84, 0x86, 0x88, 
-    0x42, 0x88, 0x02, 0x80, 0x86, 0x8C, 0x64, 0x84, 0x21, 0x84, 0x86, 0x8C, 0x42, 0x84, 0x02, 
-    0x80, 0x85, 0x88, 0x64, 0x84, 0x63, 0x8C, 0x84, 0x90, 0x42, 0x88, 0x63, 0x8C, 0xA7, 0x88, 
-    0x42, 0x88, 0x64, 0x84, 0xA7, 0x88, 0x85, 0x88, 0xEA, 0x94, 0x86, 0x8C, 0x23, 0x84, 0x0B, 
-    0x99, 0x0E, 0xA1, 0x01, 0x80, 0x4A, 0x80, 0x01, 0x80, 0x0E, 0xA1, 0x0A, 0x99, 0xA7, 0x88, 
-    0x86, 0x8C, 0xEA, 0x94, 0x86, 0x8C, 0xA7, 0x88, 0x42, 0x88, 0x64, 0x84, 0x42, 0x88, 0x86, 
-    0x88, 0x84, 0x90, 0x42, 0x84, 0x84, 0x90, 0xA5, 0x90, 0x64, 0x88, 0xA7, 0x88, 0x22, 0x84, 
-    0x42, 0x84, 0x86, 0x88, 0x42, 0x88, 0x65, 0x88, 0xA7, 0x88, 0x22, 0x84, 0x42, 0x84, 0x86, 
-    0x8C, 0x42, 0x88, 0x42, 0x84, 0x86, 0x88, 0x42, 0x88, 0x42, 0x84, 0xA7, 0x88, 0x42, 0x88, 
-    0x42, 0x84, 0x84, 0x90, 0x42, 0x88, 0x22, 0x84, 0x22, 0x84, 0x85, 0x88, 0x64, 0x84, 0x42, 
-    0x84, 0x86, 0x8C, 0x63, 0x8C, 0x42, 0x88, 0xA7, 0x90, 0xA7, 0x90, 0x85, 0x88, 0x86, 0x8C, 
-    0xA5, 0x90, 0x86, 0x88, 0xA7, 0x88, 0x86, 0x8C, 0xC6, 0x94, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 
-    0x88, 0xA5, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x90, 0xA7, 0x90, 0x86, 0x8C, 
-    0xA7, 0x90, 0x86, 0x8C, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 
-    0x88, 0xA7, 0x90, 0x86, 0x88, 0x85, 0x88, 0x85, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x85, 0x88, 
-    0x86, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0xA5, 0x90, 0xA5, 
-    0x90, 0x63, 0x8C, 0x63, 0x8C, 0xE8, 0xA0, 0x85, 0x88, 0x27, 0x80, 0x4E, 0x84, 0xB3, 0x90, 
-    0x51, 0x80, 0x48, 0x84, 0x27, 0x80, 0x86, 0x8C, 0x08, 0x99, 0xC8, 0x90, 0xC9, 0x94, 0xA7, 
-    0x90, 0x65, 0x88, 0x25, 0x80, 0x03, 0x80, 0x23, 0x80, 0x05, 0x80, 0x26, 0x80, 0x25, 0x80, 
-    0x46, 0x84, 0x66, 0x8C, 0x28, 0x80, 0x4B, 0xAD, 0xB5, 0xD6, 0x31, 0xC6, 0xAD, 0xB5, 0xAD, 
-    0xB5, 0x86, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0xA5, 0x90, 0xE7, 0x9C, 0x64, 0x84, 0x85, 0x88, 
-    0x86, 0x88, 0x84, 0x90, 0x05, 0x80, 0x02, 0x80, 0x03, 0x80, 0x03, 0x80, 0x02, 0x80, 0x03, 
-    0x80, 0x03, 0x80, 0x03, 0x80, 0x02, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 0x05, 0x80, 
-    0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x03, 
-    0x80, 0x05, 0x80, 0x03, 0x80, 0x22, 0x84, 0x66, 0x8C, 0x67, 0x8C, 0x28, 0x80, 0x29, 0x80, 
-    0x44, 0x84, 0x03, 0x80, 0x05, 0x80, 0x02, 0x80, 0x03, 0x80, 0x05, 0x80, 0x02, 0x80, 0x03, 
-    0x80, 0x03, 0x80, 0x25, 0x80, 0x46, 0x84, 0x46, 0x84, 0x48, 0x84, 0x48, 0x84, 0x67, 0x8C, 
-    0xC6, 0x94, 0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA5, 0x90, 0x86, 
-    0x8C, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0xC8, 0x90, 0x86, 0x8C, 
-    0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 
-    0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 
-    0xC8, 0x90, 0x86, 0x8C, 0xC8, 0x90, 0x86, 0x8C, 0xC8, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0x85, 
-    0x88, 0x46, 0x84, 0x46, 0x84, 0x22, 0x84, 0x64, 0x88, 0x01, 0x80, 0x22, 0x84, 0x43, 0x90, 
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x63, 0x8C, 0x01, 0x80, 0x22, 0x84, 0x42, 0x88, 0x01, 
-    0x80, 0x22, 0x84, 0x42, 0x88, 0x01, 0x80, 0x22, 0x84, 0x42, 0x88, 0x01, 0x80, 0x22, 0x84, 
-    0x43, 0x90, 0x01, 0x80, 0x01, 0x80, 0x42, 0x88, 0x22, 0x84, 0x01, 0x80, 0x42, 0x88, 0x01, 
-    0x80, 0x01, 0x80, 0x63, 0x8C, 0x01, 0x80, 0x01, 0x80, 0x43, 0x84, 0x01, 0x80, 0x22, 0x84, 
-    0x42, 0x88, 0x01, 0x80, 0x01, 0x80, 0xC8, 0x8C, 0x2C, 0x9D, 0x4E, 0xA1, 0xA7, 0x90, 0x01, 
-    0x80, 0xEA, 0x94, 0x91, 0x88, 0x29, 0x80, 0xB2, 0x8C, 0x4A, 0x80, 0xB2, 0x8C, 0xA7, 0x90, 
-    0x63, 0x8C, 0xA7, 0x90, 0x4D, 0x9D, 0x2C, 0x9D, 0xA7, 0x90, 0x42, 0x84, 0x02, 0x80, 0x42, 
-    0x84, 0x63, 0x8C, 0x22, 0x84, 0x01, 0x80, 0x65, 0x88, 0x01, 0x80, 0x42, 0x84, 0x43, 0x90, 
-    0x01, 0x80, 0x22, 0x84, 0x63, 0x8C, 0x01, 0x80, 0x42, 0x84, 0x43, 0x90, 0x01, 0x80, 0x02, 
-    0x80, 0x63, 0x8C, 0x01, 0x80, 0x22, 0x84, 0x42, 0x88, 0x01, 0x80, 0x22, 0x84, 0x43, 0x90, 
-    0x01, 0x80, 0x01, 0x80, 0x63, 0x88, 0x01, 0x80, 0x22, 0x84, 0x22, 0x84, 0x43, 0x90, 0x01, 
-    0x80, 0x02, 0x80, 0x63, 0x8C, 0x01, 0x80, 0x01, 0x80, 0x46, 0x84, 0x85, 0x88, 0x66, 0x8C, 
-    0xA7, 0x88, 0xA7, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0x86, 0x8C, 0x84, 
-    0x90, 0xA7, 0x88, 0xA7, 0x88, 0xC6, 0x94, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x90, 0xA7, 0x90, 
-    0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 
-    0x88, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0x85, 0x88, 0x85, 0x88, 0x86, 0x8C, 
-    0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x84, 0x90, 0x85, 
-    0x88, 0x85, 0x88, 0x63, 0x8C, 0x63, 0x8C, 0xC6, 0x94, 0x25, 0x80, 0x25, 0x80, 0x6F, 0x84, 
-    0x73, 0x80, 0x6F, 0x84, 0x28, 0x80, 0x25, 0x80, 0x25, 0x80, 0x08, 0x99, 0xEA, 0x94, 0xEA, 
-    0x94, 0xA8, 0x88, 0x65, 0x88, 0x25, 0x80, 0x03, 0x80, 0x23, 0x80, 0x25, 0x80, 0x26, 0x80, 
-    0x26, 0x80, 0x45, 0x88, 0x66, 0x8C, 0x46, 0x84, 0x4B, 0xAD, 0xAD, 0xB5, 0x6B, 0xAD, 0x08, 
-    0x99, 0x08, 0x99, 0x67, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0xE8, 0xA0, 0x0A, 0x99, 0x63, 0x8C, 
-    0x85, 0x88, 0x85, 0x88, 0x86, 0x88, 0x03, 0x80, 0x02, 0x80, 0x02, 0x80, 0x05, 0x80, 0x03, 
-    0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x05, 0x80, 
-    0x02, 0x80, 0x05, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 
-    0x80, 0x05, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x03, 0x80, 0x0B, 0x80, 0x0B, 0x80, 
-    0x08, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 
-    0x80, 0x05, 0x80, 0x03, 0x80, 0x25, 0x80, 0x25, 0x80, 0x46, 0x84, 0x46, 0x84, 0x48, 0x84, 
-    0x69, 0x84, 0xC6, 0x94, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 
-    0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x88, 
-    0xC8, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xC8, 0x90, 0x86, 
-    0x8C, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xC8, 0x90, 
-    0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 
-    0x90, 0x85, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x02, 0x80, 0x21, 0x84, 0x01, 0x80, 0x01, 0x80, 
-    0x42, 0x88, 0x22, 0x84, 0x01, 0x80, 0x01, 0x80, 0x42, 0x88, 0x22, 0x84, 0x01, 0x80, 0x42, 
-    0x88, 0x01, 0x80, 0x01, 0x80, 0x42, 0x88, 0x22, 0x84, 0x01, 0x80, 0x42, 0x88, 0x01, 0x80, 
-    0x01, 0x80, 0x42, 0x88, 0x01, 0x80, 0x01, 0x80, 0x42, 0x88, 0x22, 0x84, 0x01, 0x80, 0x42, 
-    0x88, 0x01, 0x80, 0x01, 0x80, 0x42, 0x88, 0x42, 0x84, 0x02, 0x80, 0x42, 0x88, 0x01, 0x80, 
-    0x01, 0x80, 0x42, 0x88, 0x01, 0x80, 0x21, 0x84, 0x22, 0x84, 0x84, 0x90, 0x64, 0x94, 0x01, 
-    0x80, 0x22, 0x84, 0x64, 0x88, 0xE9, 0x8C, 0x28, 0x80, 0x4A, 0x80, 0x28, 0x80, 0x6A, 0x88, 
-    0x85, 0x88, 0x42, 0x88, 0x22, 0x84, 0x64, 0x94, 0x64, 0x94, 0x23, 0x84, 0x64, 0x84, 0x01, 
-    0x80, 0x22, 0x84, 0x42, 0x88, 0x01, 0x80, 0x01, 0x80, 0x43, 0x90, 0x42, 0x80, 0x22, 0x84, 
-    0x42, 0x88, 0x01, 0x80, 0x01, 0x80, 0x63, 0x88, 0x01, 0x80, 0x42, 0x84, 0x23, 0x84, 0x01, 
-    0x80, 0x01, 0x80, 0x42, 0x88, 0x22, 0x84, 0x01, 0x80, 0x42, 0x88, 0x01, 0x80, 0x01, 0x80, 
-    0x42, 0x88, 0x01, 0x80, 0x01, 0x80, 0x42, 0x88, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x42, 
-    0x88, 0x01, 0x80, 0x22, 0x84, 0x42, 0x88, 0x01, 0x80, 0x22, 0x84, 0x84, 0x8C, 0x86, 0x88, 
-    0x84, 0x8C, 0x86, 0x8C, 0xA7, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0xC6, 0x94, 0x86, 0x8C, 0xA5, 
-    0x90, 0x84, 0x90, 0xA5, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 
-    0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 
-    0x88, 0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0xC6, 0x94, 0x86, 0x8C, 
-    0x86, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x84, 
-    0x90, 0x85, 0x88, 0x85, 0x88, 0x84, 0x90, 0xA5, 0x90, 0xA5, 0x90, 0x25, 0x80, 0x25, 0x80, 
-    0x4A, 0x80, 0x4E, 0x84, 0x29, 0x80, 0x27, 0x80, 0x25, 0x80, 0x27, 0x80, 0x08, 0x99, 0xC8, 
-    0x8C, 0xE9, 0x8C, 0xA7, 0x90, 0x65, 0x88, 0x25, 0x80, 0x03, 0x80, 0x25, 0x80, 0x26, 0x80, 
-    0x26, 0x80, 0x46, 0x84, 0x66, 0x8C, 0xA7, 0x88, 0xC9, 0x94, 0x86, 0x88, 0x67, 0x8C, 0x08, 
-    0x80, 0x0B, 0x80, 0x0B, 0x80, 0x08, 0x80, 0x86, 0x8C, 0xC9, 0x94, 0x2C, 0x9D, 0x0A, 0x99, 
-    0x63, 0x8C, 0x85, 0x88, 0xA8, 0x88, 0x84, 0x90, 0x05, 0x80, 0x05, 0x80, 0x05, 0x80, 0x03, 
-    0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 
-    0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x03, 
-    0x80, 0x05, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x03, 0x80, 0x08, 0x80, 
-    0x08, 0x80, 0x02, 0x80, 0x02, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 
-    0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x25, 0x80, 0x25, 0x80, 0x46, 0x84, 
-    0x46, 0x84, 0x69, 0x84, 0xC6, 0x94, 0xC8, 0x90, 0x86, 0x8C, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 
-    0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 
-    0xC8, 0x90, 0x86, 0x88, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xC8, 
-    0x90, 0x86, 0x8C, 0xC8, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xC8, 0x90, 
-    0x86, 0x8C, 0xC8, 0x90, 0x86, 0x8C, 0xC8, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xA7, 
-    0x90, 0x86, 0x8C, 0xA7, 0x88, 0xC8, 0x90, 0x85, 0x88, 0x86, 0x8C, 0x63, 0x8C, 0x85, 0x88, 
-    0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 
-    0x88, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 
-    0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x63, 0x88, 0x64, 
-    0x84, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x63, 0x88, 0x64, 0x84, 0x64, 0x88, 0x64, 0x88, 
-    0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x63, 0x88, 0x64, 0x88, 0x44, 
-    0x84, 0x64, 0x88, 0x63, 0x88, 0x65, 0x88, 0x63, 0x8C, 0x65, 0x88, 0x65, 0x88, 0x65, 0x88, 
-    0x85, 0x88, 0x65, 0x88, 0x65, 0x88, 0x65, 0x88, 0x65, 0x88, 0x84, 0x8C, 0x65, 0x88, 0x65, 
-    0x88, 0x85, 0x88, 0x64, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x85, 0x88, 0x64, 0x84, 0x65, 0x88, 
-    0x65, 0x88, 0x65, 0x88, 0x65, 0x88, 0x85, 0x88, 0x64, 0x88, 0x85, 0x88, 0x65, 0x88, 0x64, 
-    0x88, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 0x63, 0x8C, 
-    0x85, 0x88, 0x64, 0x84, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x85, 
-    0x88, 0x64, 0x88, 0x64, 0x88, 0x64, 0x88, 0x85, 0x88, 0x64, 0x88, 0x64, 0x88, 0xA7, 0x88, 
-    0xA7, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0xA5, 0x90, 0xA7, 
-    0x88, 0xA7, 0x90, 0xA5, 0x94, 0xA5, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x90, 
-    0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA8, 0x88, 0xC8, 0x90, 0x86, 
-    0x8C, 0xC8, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 
-    0xA7, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA7, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 
-    0x88, 0x86, 0x88, 0x85, 0x88, 0x85, 0x88, 0x63, 0x8C, 0x63, 0x8C, 0x86, 0x8C, 0x85, 0x88, 
-    0x02, 0x80, 0x28, 0x80, 0x27, 0x80, 0x27, 0x80, 0x25, 0x80, 0x03, 0x80, 0x86, 0x88, 0xE7, 
-    0x9C, 0xA7, 0x90, 0xA7, 0x90, 0x86, 0x8C, 0x65, 0x88, 0x25, 0x80, 0x03, 0x80, 0x25, 0x80, 
-    0x26, 0x80, 0x26, 0x80, 0x05, 0x80, 0x86, 0x8C, 0xEA, 0x94, 0x08, 0x99, 0xA7, 0x88, 0x46, 
-    0x84, 0x08, 0x80, 0x0B, 0x80, 0x0B, 0x80, 0x08, 0x80, 0x0A, 0x99, 0x2C, 0x9D, 0x4E, 0xA1, 
-    0xEA, 0x94, 0x63, 0x8C, 0xA6, 0x94, 0xA6, 0x94, 0xA5, 0x94, 0x02, 0x80, 0x03, 0x80, 0x03, 
-    0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 
-    0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 
-    0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x25, 0x80, 0x03, 0x80, 
-    0x03, 0x80, 0x02, 0x80, 0x24, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x03, 
-    0x80, 0x05, 0x80, 0x02, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x25, 0x80, 
-    0x25, 0x80, 0x46, 0x84, 0x69, 0x84, 0xC6, 0x94, 0xA5, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 
-    0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x88, 
-    0xC8, 0x90, 0x86, 0x8C, 0xC8, 0x90, 0xA7, 0x88, 0x86, 0x8C, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 
-    0x90, 0x86, 0x8C, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x90, 
-    0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xC8, 
-    0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 
-    0x86, 0x88, 0x85, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x86, 0x8C, 0x85, 
-    0x88, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 
-    0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 
-    0x88, 0x85, 0x88, 0x65, 0x88, 0x64, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 
-    0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x84, 0x8C, 0x86, 
-    0x88, 0x84, 0x8C, 0x65, 0x88, 0x86, 0x88, 0x84, 0x8C, 0x45, 0x88, 0x85, 0x88, 0x84, 0x8C, 
-    0x86, 0x88, 0x84, 0x8C, 0x66, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x66, 0x8C, 0x86, 0x8C, 0x85, 
-    0x88, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 
-    0x86, 0x8C, 0x86, 0x8C, 0x66, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x86, 
-    0x8C, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 
-    0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x65, 0x88, 0x86, 0x8C, 0x65, 0x88, 0x86, 0x8C, 0x85, 
-    0x88, 0x85, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x86, 0x8C, 0x84, 0x8C, 
-    0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x88, 0x86, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0xA8, 0x88, 0xA7, 
-    0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x94, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 
-    0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 
-    0x90, 0xA7, 0x88, 0x86, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0xA5, 0x90, 
-    0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0x86, 0x88, 0x85, 
-    0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x84, 0x90, 0x63, 0x8C, 0xA5, 0x90, 
-    0xA7, 0x88, 0x25, 0x80, 0x24, 0x80, 0x25, 0x80, 0x25, 0x80, 0x24, 0x80, 0x85, 0x88, 0xA5, 
-    0x94, 0xC6, 0x94, 0x86, 0x8C, 0xA7, 0x88, 0x86, 0x8C, 0x64, 0x88, 0x25, 0x80, 0x03, 0x80, 
-    0x03, 0x80, 0x26, 0x80, 0x26, 0x80, 0x66, 0x8C, 0x67, 0x8C, 0xA7, 0x88, 0xEA, 0x94, 0x29, 
-    0x9D, 0x67, 0x8C, 0xA7, 0x88, 0xEA, 0x94, 0x29, 0x9D, 0x2A, 0xAD, 0x29, 0x9D, 0x08, 0x99, 
-    0x08, 0x99, 0x67, 0x8C, 0x43, 0x90, 0x85, 0x88, 0xA5, 0x94, 0x84, 0x90, 0x05, 0x80, 0x05, 
-    0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 
-    0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 
-    0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x23, 0x84, 
-    0x25, 0x80, 0x66, 0x8C, 0x66, 0x8C, 0x45, 0x88, 0x25, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 
-    0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x02, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 
-    0x25, 0x80, 0x44, 0x84, 0x46, 0x84, 0x48, 0x84, 0xC6, 0x94, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 
-    0x88, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0xC8, 0x90, 
-    0xA7, 0x88, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0xA7, 
-    0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 
-    0xC8, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xC8, 
-    0x90, 0x86, 0x8C, 0xC8, 0x90, 0x86, 0x8C, 0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 
-    0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 
-    0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0xA8, 0x88, 
-    0xA7, 0x90, 0x86, 0x8C, 0xC8, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x85, 
-    0x88, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x88, 
-    0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 
-    0x90, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x88, 0x86, 0x8C, 
-    0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0xA7, 0x88, 0x86, 
-    0x8C, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x90, 
-    0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x8C, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 
-    0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 
-    0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xC8, 
-    0x90, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 
-    0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0xA5, 0x90, 0x86, 0x8C, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 
-    0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x94, 0xA7, 0x90, 0x86, 0x8C, 0xC8, 0x90, 
-    0xA7, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA8, 0x88, 0xA7, 
-    0x90, 0xA5, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0x86, 0x8C, 0x86, 0x8C, 
-    0x85, 0x88, 0x85, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x88, 0xC8, 
-    0x90, 0xA7, 0x88, 0xA7, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x84, 0x90, 0x63, 0x8C, 
-    0x63, 0x8C, 0x85, 0x88, 0xC8, 0x90, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0xEA, 
-    0x94, 0x85, 0x88, 0x84, 0x90, 0x86, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x64, 0x88, 0x25, 0x80, 
-    0x03, 0x80, 0x03, 0x80, 0x25, 0x80, 0x23, 0x84, 0x45, 0x88, 0x67, 0x8C, 0xA7, 0x88, 0xEA, 
-    0x8C, 0x0A, 0x99, 0x67, 0x8C, 0xA7, 0x88, 0xEA, 0x8C, 0x0A, 0x99, 0x0A, 0x99, 0x0A, 0x99, 
-    0x08, 0x99, 0x08, 0x99, 0x67, 0x8C, 0x63, 0x8C, 0x85, 0x88, 0xA5, 0x94, 0x86, 0x8C, 0x26, 
-    0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 
-    0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x23, 0x84, 0x05, 0x80, 0x03, 0x80, 0x05, 
-    0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x23, 0x84, 
-    0x66, 0x8C, 0x67, 0x8C, 0x86, 0x88, 0x86, 0x88, 0x67, 0x8C, 0x66, 0x8C, 0x46, 0x84, 0x03, 
-    0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 
-    0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x25, 0x80, 0x48, 0x84, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 
-    0x90, 0xA7, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x88, 
-    0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x85, 
-    0x88, 0x85, 0x88, 0x86, 0x8C, 0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x90, 
-    0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x90, 0x86, 0x8C, 0xC8, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xC8, 
-    0x90, 0x86, 0x8C, 0xC8, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 
-    0xC8, 0x8C, 0xA7, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 
-    0x90, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0xC8, 0x90, 0x86, 0x8C, 0xC8, 0x90, 0xA7, 0x88, 
-    0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0x85, 
-    0x88, 0x86, 0x8C, 0xA5, 0x90, 0x86, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 
-    0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 
-    0x90, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0x86, 0x8C, 
-    0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x86, 
-    0x8C, 0x85, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0xA7, 0x88, 0xA5, 0x90, 
-    0xA7, 0x88, 0xA7, 0x90, 0xC8, 0x8C, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 
-    0x8C, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x8C, 0xA7, 0x90, 0xA7, 0x90, 0x86, 0x8C, 
-    0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xC8, 
-    0x90, 0x86, 0x8C, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0xA7, 0x88, 
-    0xA5, 0x90, 0xA7, 0x88, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x90, 0xA8, 0x88, 0xA7, 0x90, 0xA7, 
-    0x88, 0xA7, 0x90, 0xA7, 0x90, 0x86, 0x8C, 0xA7, 0x90, 0x84, 0x90, 0x84, 0x90, 0xC8, 0x8C, 
-    0xA5, 0x90, 0x86, 0x8C, 0xA8, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 
-    0x88, 0xA7, 0x90, 0xA8, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 
-    0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x85, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x86, 
-    0x8C, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0x85, 0x88, 0x85, 0x88, 0x84, 0x90, 
-    0x63, 0x8C, 0x63, 0x8C, 0x63, 0x8C, 0xA5, 0x90, 0xC6, 0x94, 0x08, 0x99, 0x08, 0x99, 0xC6, 
-    0x94, 0x84, 0x90, 0x84, 0x90, 0x63, 0x8C, 0x86, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x64, 0x84, 
-    0x25, 0x80, 0x03, 0x80, 0x03, 0x80, 0x25, 0x80, 0x45, 0x88, 0x67, 0x8C, 0xA7, 0x88, 0xE9, 
-    0x8C, 0xC9, 0x94, 0xEA, 0x8C, 0xA7, 0x88, 0xE9, 0x8C, 0xC9, 0x94, 0xEA, 0x8C, 0xEA, 0x8C, 
-    0xEA, 0x8C, 0x08, 0x99, 0x08, 0x99, 0x89, 0x90, 0x63, 0x8C, 0x85, 0x88, 0xA6, 0x94, 0x85, 
-    0x88, 0x08, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 
-    0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x23, 0x84, 0x25, 0x80, 0x25, 0x80, 0x25, 
-    0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x23, 0x84, 
-    0x25, 0x80, 0x66, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x67, 0x8C, 0x66, 
-    0x8C, 0x25, 0x80, 0x25, 0x80, 0x23, 0x84, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 0x25, 0x80, 
-    0x25, 0x80, 0x25, 0x80, 0x03, 0x80, 0x05, 0x80, 0x23, 0x84, 0x48, 0x84, 0xA7, 0x88, 0x86, 
-    0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 
-    0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0xA5, 0x90, 0x86, 0x8C, 0x85, 
-    0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xC8, 0x90, 
-    0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xC8, 
-    0x90, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x88, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x90, 
-    0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 
-    0x88, 0xA7, 0x88, 0xC8, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x88, 0xC8, 0x90, 0x86, 0x8C, 
-    0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0x86, 0x8C, 0x85, 
-    0x88, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0xA7, 0x88, 0xC8, 0x90, 
-    0x86, 0x8C, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0xC8, 
-    0x90, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0x86, 0x8C, 
-    0x86, 0x8C, 0xA7, 0x88, 0x86, 0x8C, 0xA7, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x86, 0x8C, 0x86, 
-    0x8C, 0x85, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x86, 0x8C, 
-    0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x94, 0x84, 0x90, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 
-    0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 
-    0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0xC8, 
-    0x90, 0xA7, 0x88, 0xC8, 0x90, 0x86, 0x8C, 0x86, 0x8C, 0xA7, 0x88, 0x86, 0x8C, 0xA7, 0x88, 
-    0xA5, 0x90, 0xA8, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA5, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 
-    0x90, 0x86, 0x8C, 0xA7, 0x88, 0xA7, 0x90, 0x86, 0x8C, 0xA7, 0x88, 0xC8, 0x90, 0xA5, 0x94, 
-    0xC6, 0x94, 0xC6, 0x94, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 0x88, 0xA7, 0x90, 0xA7, 
-    0x88, 0xC8, 0x8C, 0xA7, 0x90, 0xA5, 0x90, 0xA7, 0x88, 0xA7, 0x88, 0x86, 0x8C, 0x85, 0x88, 
-    0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 0x86, 0x8C, 0x85, 0x88, 0x85, 
-    0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x86, 0x8C, 0xC8, 0x90, 0xA7, 0x88, 0xA7, 0x88, 
-    0x86, 0x88, 0x84, 0x90, 0x84, 0x90, 0x63, 0x8C, 0xA5, 0x90, 0x63, 0x8C, 0x84, 0x90, 0x84, 
-    0x90, 0x63, 0x8C, 0x85, 0x88, 0x84, 0x90, 0xA5, 0x90, 0x86, 0x8C, 0x85, 0x88, 0x86, 0x8C, 
-    0x25, 0x80, 0x25, 0x80, 0x05, 0x80, 0x25, 0x80, 0x46, 0x84, 0x45, 0x88, 0x67, 0x8C, 0xA7, 
-    0x88, 0xC9, 0x94, 0xC8, 0x8C, 0xE9, 0x8C, 0xA7, 0x88, 0xC9, 0x94, 0xC8, 0x8C, 0xE9, 0x8C, 
-    0xE9, 0x8C, 0xC9, 0x94, 0xE9, 0x8C, 0xE9, 0x8C, 0x67, 0x8C, 0x63, 0x8C, 0x85, 0x88, 0x85, 
-    0x88, 0x67, 0x8C, 0x08, 0x80, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 
-    0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x25, 0x80, 0x46, 0x84, 0x46, 0x84, 0x46, 
-    0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x25, 0x80, 
-    0x46, 0x84, 0x46, 0x84, 0x67, 0x8C, 0x45, 0x88, 0x67, 0x8C, 0x45, 0x88, 0x67, 0x8C, 0x45, 
-    0x88, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 
-    0x46, 0x84, 0x48, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x69, 0x84, 0x48, 
-    0x84, 0x48, 0x84, 0x69, 0x84, 0x48, 0x84, 0x48, 0x84, 0x69, 0x84, 0x69, 0x84, 0x48, 0x84, 
-    0x48, 0x84, 0x86, 0x88, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 0x64, 0x88, 0x65, 0x88, 0x85, 
-    0x88, 0x64, 0x84, 0x85, 0x88, 0x64, 0x84, 0x64, 0x84, 0x64, 0x84, 0x64, 0x84, 0x85, 0x88, 
-    0x48, 0x84, 0x69, 0x84, 0x48, 0x84, 0x69, 0x84, 0x48, 0x84, 0x69, 0x84, 0x48, 0x84, 0x69, 
-    0x84, 0x48, 0x84, 0x48, 0x84, 0x69, 0x84, 0x48, 0x84, 0x89, 0x90, 0x48, 0x84, 0x48, 0x84, 
-    0x85, 0x88, 0x86, 0x8C, 0x65, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 
-    0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 
-    0x69, 0x84, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 0x69, 0x84, 0x86, 0x88, 0x46, 
-    0x84, 0x46, 0x84, 0x46, 0x84, 0x48, 0x84, 0x48, 0x84, 0x46, 0x84, 0x46, 0x84, 0x69, 0x84, 
-    0x86, 0x88, 0x48, 0x84, 0x86, 0x8C, 0x65, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 
-    0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x85, 0x88, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 
-    0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 0x48, 
-    0x84, 0x86, 0x88, 0x48, 0x84, 0x48, 0x84, 0x86, 0x88, 0x48, 0x84, 0x48, 0x84, 0x45, 0x88, 
-    0x48, 0x84, 0x69, 0x84, 0x48, 0x84, 0x48, 0x84, 0x86, 0x8C, 0x65, 0x88, 0x64, 0x84, 0x65, 
-    0x88, 0x85, 0x88, 0x86, 0x88, 0x86, 0x88, 0x65, 0x88, 0x65, 0x88, 0x65, 0x88, 0x46, 0x84, 
-    0x46, 0x84, 0x48, 0x84, 0x48, 0x84, 0x86, 0x88, 0x48, 0x84, 0x46, 0x84, 0x48, 0x84, 0x85, 
-    0x88, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 
-    0x48, 0x84, 0x69, 0x84, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 0x48, 
-    0x84, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 0x69, 0x84, 0x48, 0x84, 
-    0x48, 0x84, 0x86, 0x8C, 0x65, 0x88, 0x86, 0x88, 0x84, 0x8C, 0x86, 0x88, 0x85, 0x88, 0x85, 
-    0x88, 0x86, 0x8C, 0x86, 0x88, 0x65, 0x88, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 0x48, 0x84, 
-    0x45, 0x88, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x46, 
-    0x84, 0x85, 0x88, 0x46, 0x84, 0x46, 0x84, 0x46, 0x84, 0x86, 0x88, 0x46, 0x84, 0x48, 0x84, 
-    0x48, 0x84, 0x86, 0x88, 0x46, 0x84, 0x46, 0x84, 0x25, 0x80, 0x46, 0x84, 0x48, 0x84, 0x48, 
-    0x84, 0x48, 0x84, 0x86, 0x88, 0x46, 0x84, 0x48, 0x84, 0x46, 0x84, 0x48, 0x84, 0x46, 0x84, 
-    0x48, 0x84, 0x27, 0x80, 0x26, 0x80, 0x26, 0x80, 0x26, 0x80, 0x26, 0x80, 0x46, 0x84, 0x48, 
-    0x84, 0x48, 0x84, 0x48, 0x84, 0x89, 0x90, 0x69, 0x84, 0x48, 0x84, 0x48, 0x84, 0x89, 0x90, 
-    0x69, 0x84, 0x48, 0x84, 0x69, 0x84, 0x6A, 0x88, 0x6A, 0x88, 0x08, 0x80, 0x63, 0x8C, 0x85, 
-    0x88, 0x86, 0x88, 0x69, 0x84, 0x26, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x03, 0x80, 
-    0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 
-    0x03, 0x80, 0x05, 0x80, 0x02, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x03, 
-    0x80, 0x05, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 
-    0x02, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x02, 
-    0x80, 0x03, 0x80, 0x05, 0x80, 0x02, 0x80, 0x05, 0x80, 0x23, 0x80, 0x03, 0x80, 0x03, 0x80, 
-    0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x02, 0x80, 0x02, 0x80, 0x03, 0x80, 0x03, 
-    0x80, 0x02, 0x80, 0x03, 0x80, 0x03, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x03, 
-    0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x23, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 
-    0x05, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 
-    0x80, 0x05, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 0x02, 0x80, 0x03, 0x80, 
-    0x05, 0x80, 0x02, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 0x02, 0x80, 0x03, 0x80, 0x03, 
-    0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x24, 0x80, 0x03, 0x80, 
-    0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 
-    0x80, 0x02, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 
-    0x03, 0x80, 0x23, 0x80, 0x03, 0x80, 0x23, 0x80, 0x03, 0x80, 0x23, 0x80, 0x03, 0x80, 0x23, 
-    0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 
-    0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 0x02, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 
-    0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 
-    0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 0x03, 0x80, 0x03, 
-    0x80, 0x05, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 0x02, 0x80, 0x02, 0x80, 0x23, 0x80, 
-    0x03, 0x80, 0x23, 0x80, 0x03, 0x80, 0x03, 0x80, 0x23, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 
-    0x80, 0x02, 0x80, 0x23, 0x80, 0x03, 0x80, 0x23, 0x80, 0x03, 0x80, 0x05, 0x80, 0x02, 0x80, 
-    0x23, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 
-    0x80, 0x05, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 0x02, 0x80, 0x23, 0x80, 
-    0x02, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x24, 0x80, 0x02, 
-    0x80, 0x02, 0x80, 0x03, 0x80, 0x03, 0x80, 0x02, 0x80, 0x02, 0x80, 0x03, 0x80, 0x02, 0x80, 
-    0x02, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 0x02, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 
-    0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x05, 0x80, 0x02, 0x80, 0x03, 0x80, 0x03, 0x80, 
-    0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 
-    0x80, 0x03, 0x80, 0x05, 0x80, 0x03, 0x80, 0x05, 0x80, 0x02, 0x80, 0x05, 0x80, 0x02, 0x80, 
-    0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x85, 0x88, 0xA7, 0x88, 0xC8, 0x8C, 0xC9, 0x94, 0x29, 
-    0x80, 0x86, 0x88, 0x69, 0x84, 0x08, 0x80, 0x02, 0x80
+const int inventory_packed_size = 8094;
+const byte inventory_packed[] = {
+    0x00, 0x98, 0x97, 0x95, 0xC4, 0xC4, 0xC4, 0xD6, 0xD6, 0x03, 0x04, 0x00, 0x00, 0xB0, 0xC5, 
+    0xC7, 0xC6, 0xC5, 0xC5, 0xC5, 0x0B, 0x16, 0xE0, 0x00, 0x80, 0xC3, 0x04, 0x30, 0xC5, 0xC4, 
+    0xC6, 0xC6, 0x7C, 0xC5, 0xC6, 0x03, 0x00, 0x2D, 0x60, 0x0A, 0x10, 0x10, 0x00, 0x16, 0x20, 
+    0xC7, 0xE8, 0xC7, 0xC7, 0xC6, 0x4E, 0x20, 0xC4, 0x13, 0x00, 0x17, 0x00, 0x52, 0x70, 0x0F, 
+    0x0C, 0x20, 0x28, 0x20, 0x06, 0x10, 0x6D, 0x10, 0xC6, 0xC7, 0xD6, 0xC6, 0xD8, 0xC7, 0xC6, 
+    0xD6, 0x32, 0x00, 0x00, 0x00, 0xC8, 0x00, 0x60, 0x0A, 0x20, 0xF6, 0xC7, 0x27, 0x00, 0x03, 
+    0x00, 0xC7, 0x01, 0x10, 0x00, 0x10, 0x0E, 0x10, 0x05, 0x00, 0x83, 0x0D, 0x20, 0x0B, 0x00, 
+    0x3B, 0xC5, 0xD6, 0xC6, 0xC6, 0x88, 0x00, 0x2B, 0x4D, 0x20, 0x0C, 0x00, 0x3B, 0x06, 0x30, 
+    0xC5, 0x4C, 0x30, 0x99, 0x98, 0x0D, 0x01, 0x00, 0x52, 0x0C, 0xA0, 0x00, 0x10, 0x9A, 0x9A, 
+    0x9B, 0xBC, 0xD0, 0x96, 0x96, 0x98, 0x99, 0x00, 0x10, 0xD6, 0x00, 0xD0, 0x75, 0x00, 0x21, 
+    0x03, 0x00, 0x10, 0xC7, 0xD6, 0x3C, 0x0F, 0x30, 0xC6, 0xD6, 0xE4, 0x3B, 0xD6, 0x4F, 0x00, 
+    0x3B, 0xD5, 0x07, 0x10, 0x00, 0x00, 0x08, 0x00, 0xDF, 0x00, 0x50, 0xA1, 0x00, 0x01, 0x10, 
+    0x34, 0x10, 0x26, 0x30, 0xC7, 0x12, 0x00, 0xC5, 0x70, 0xDE, 0xC7, 0x40, 0x50, 0xDB, 0x00, 
+    0x04, 0x00, 0x0A, 0x20, 0xD6, 0x56, 0x00, 0x1F, 0x10, 0x6F, 0x67, 0x10, 0x25, 0x20, 0x06, 
+    0x10, 0x00, 0x00, 0x9A, 0x8C, 0x20, 0x92, 0x30, 0x9A, 0x09, 0x00, 0x30, 0xC8, 0xC8, 0x06, 
+    0x20, 0x55, 0x98, 0x54, 0x98, 0x00, 0x53, 0x54, 0x54, 0x99, 0x54, 0x99, 0x98, 0x9A, 0x70, 
+    0x98, 0x55, 0x99, 0x98, 0x09, 0x00, 0x06, 0x10, 0x2C, 0x00, 0x54, 0xF4, 0x99, 0x53, 0xD3, 
+    0x10, 0x53, 0x01, 0x30, 0x2E, 0x11, 0x8D, 0x20, 0x06, 0x10, 0xE1, 0x04, 0x00, 0xC8, 0xC9, 
+    0xC8, 0xC9, 0x02, 0x00, 0x86, 0x10, 0x0C, 0x90, 0x50, 0xC7, 0x98, 0x98, 0x98, 0xFF, 0x00, 
+    0x02, 0x6A, 0x30, 0x99, 0x06, 0x99, 0x06, 0x41, 0x00, 0x50, 0x55, 0x55, 0x9A, 0x58, 0x99, 
+    0x00, 0x99, 0x57, 0x9B, 0x9B, 0xC9, 0x9A, 0x99, 0x9A, 0x80, 0x55, 0x99, 0x55, 0x54, 0x9A, 
+    0x55, 0x55, 0x91, 0x00, 0x48, 0x54, 0xC8, 0x05, 0xA1, 0x20, 0x55, 0x54, 0x04, 0x00, 0x54, 
+    0x08, 0x54, 0x98, 0x54, 0x90, 0x00, 0x55, 0x9A, 0x9A, 0x57, 0x04, 0x9B, 0x9A, 0x01, 0x10, 
+    0x9A, 0x56, 0x9A, 0x56, 0x56, 0xDB, 0xB5, 0x40, 0x00, 0x20, 0x9B, 0x00, 0x10, 0xBB, 0x10, 
+    0x56, 0x00, 0x10, 0x1E, 0x10, 0x19, 0x15, 0x10, 0x56, 0x55, 0x10, 0x10, 0xDE, 0x20, 0x56, 
+    0x9A, 0x58, 0xA7, 0x25, 0x00, 0x02, 0x10, 0x28, 0x00, 0xCB, 0x9C, 0x2E, 0x10, 0x58, 0x34, 
+    0x20, 0xBD, 0x00, 0x30, 0x9C, 0x00, 0x10, 0x05, 0x30, 0x08, 0x10, 0x00, 0xF0, 0x00, 0x9A, 
+    0x2D, 0x10, 0x4F, 0x3D, 0x30, 0x07, 0x20, 0x02, 0x10, 0x00, 0xD0, 0x58, 0x9C, 0x14, 0x30, 
+    0xC9, 0xFB, 0x0C, 0xA0, 0x28, 0x40, 0x9B, 0xEE, 0x30, 0x76, 0x31, 0x00, 0x60, 0x0E, 0x00, 
+    0x1A, 0x80, 0x7E, 0x9A, 0x02, 0x20, 0x24, 0x30, 0x03, 0x50, 0x32, 0xA0, 0xE8, 0x60, 0xB2, 
+    0x51, 0x9A, 0xFC, 0x99, 0x04, 0x6A, 0x00, 0x97, 0x60, 0x4E, 0x10, 0x47, 0x20, 0x05, 0x20, 
+    0x51, 0x40, 0xFB, 0x2B, 0x40, 0xBE, 0x30, 0x9A, 0xE5, 0x00, 0xEF, 0x10, 0x05, 0x20, 0x00, 
+    0xB1, 0xFE, 0x60, 0xBF, 0x01, 0x81, 0x5A, 0x00, 0xEF, 0x20, 0xFC, 0x40, 0x01, 0x80, 0x4C, 
+    0x41, 0x57, 0x05, 0x20, 0xFD, 0x07, 0x10, 0x9B, 0xC3, 0x01, 0x83, 0x21, 0x13, 0x10, 0xD7, 
+    0x20, 0xB5, 0x60, 0x02, 0x21, 0x3B, 0xD2, 0x90, 0x06, 0x40, 0x04, 0xF4, 0x30, 0x1E, 0x10, 
+    0x85, 0x32, 0x99, 0x9A, 0xDE, 0x04, 0xB0, 0x10, 0xD4, 0x00, 0x1A, 0x31, 0x01, 0x20, 0x05, 
+    0x07, 0x40, 0x2D, 0x51, 0x0F, 0x2F, 0x01, 0xFB, 0x40, 0xFF, 0xF1, 0x00, 0x23, 0x10, 0x04, 
+    0x28, 0x04, 0x04, 0xF2, 0x03, 0x00, 0xF0, 0x06, 0x9B, 0x28, 0x00, 0x51, 0x03, 0xD1, 0xFF, 
+    0xA0, 0x02, 0x51, 0x0F, 0x35, 0x51, 0x08, 0x90, 0x4A, 0x31, 0xFE, 0x20, 0x9C, 0x02, 0x02, 
+    0x02, 0x02, 0x03, 0x0B, 0x00, 0xF5, 0x02, 0x02, 0x9C, 0x9A, 0x9B, 0xF0, 0x2B, 0xF5, 0xF5, 
+    0x02, 0x36, 0x00, 0x21, 0x10, 0xCE, 0x50, 0x08, 0x20, 0x8F, 0x33, 0x30, 0x11, 0x40, 0x06, 
+    0x51, 0xD1, 0x40, 0x9B, 0x5A, 0x18, 0xB7, 0x31, 0xA7, 0xB9, 0x20, 0x26, 0x61, 0x21, 0x30, 
+    0x99, 0x26, 0x28, 0x60, 0x26, 0x11, 0x00, 0xF6, 0x05, 0x23, 0x20, 0xE6, 0x61, 0x9A, 0x2C, 
+    0x01, 0x03, 0x30, 0xFE, 0x30, 0x18, 0x00, 0x81, 0x2C, 0x20, 0x57, 0x9A, 0x04, 0x21, 0x07, 
+    0x08, 0x00, 0xF0, 0x02, 0xB0, 0x07, 0x23, 0x25, 0x03, 0xF7, 0x50, 0xFB, 0x80, 0x58, 0x0C, 
+    0x30, 0xFE, 0x58, 0xFD, 0xB0, 0x54, 0x10, 0x03, 0x30, 0xFD, 0xA0, 0x0B, 0x40, 0xEF, 0x01, 
+    0x87, 0x00, 0xA0, 0x02, 0xF6, 0x00, 0x00, 0x2B, 0xF8, 0x00, 0xCE, 0x06, 0x20, 0xA0, 0x02, 
+    0x01, 0x00, 0x00, 0x02, 0x34, 0x81, 0x15, 0x00, 0x00, 0x1F, 0x93, 0x00, 0x2C, 0x31, 0x0E, 
+    0x52, 0x9D, 0x52, 0xD7, 0x30, 0x5A, 0x8C, 0x4E, 0x3C, 0x4D, 0x1B, 0x00, 0x41, 0xB4, 0x42, 
+    0xEF, 0x21, 0xEF, 0x00, 0x05, 0x99, 0xFF, 0x01, 0x14, 0x07, 0x10, 0xFC, 0x10, 0x00, 0x00, 
+    0x0E, 0x10, 0x02, 0x11, 0x4E, 0x10, 0x06, 0x00, 0x1B, 0xF8, 0x00, 0x5A, 0x53, 0x9A, 0xD5, 
+    0x02, 0xFE, 0x72, 0x26, 0x04, 0x07, 0x04, 0x09, 0x0C, 0x00, 0xF0, 0x02, 0x0A, 0x07, 0x08, 
+    0x07, 0x06, 0xFE, 0x03, 0xFE, 0x20, 0xEC, 0x11, 0xFE, 0x70, 0xDF, 0x32, 0xFC, 0xF1, 0x03, 
+    0xF6, 0x13, 0xEB, 0x00, 0x87, 0xF5, 0x51, 0x05, 0x61, 0x07, 0x30, 0x18, 0x00, 0x00, 0x00, 
+    0xE2, 0x00, 0xD1, 0x06, 0x10, 0x59, 0x9B, 0x9C, 0x06, 0x10, 0x5A, 0x00, 0x32, 0x2E, 0x10, 
+    0xC0, 0x17, 0x4E, 0x4E, 0x4C, 0x4C, 0x15, 0xAC, 0x02, 0x0E, 0x20, 0x07, 0x0D, 0x53, 0x06, 
+    0x71, 0x01, 0x00, 0x9B, 0x19, 0x8E, 0x4F, 0x2E, 0xFC, 0x00, 0xF5, 0xEE, 0x12, 0xED, 0x62, 
+    0x0B, 0x10, 0xFB, 0x34, 0x05, 0x74, 0xFA, 0x01, 0x3F, 0x22, 0x40, 0x4F, 0x42, 0x21, 0x00, 
+    0xFE, 0xD4, 0x16, 0x21, 0x66, 0x00, 0x26, 0x9A, 0x5A, 0x23, 0xFE, 0x00, 0x0F, 0x00, 0xF0, 
+    0x03, 0x00, 0x01, 0x04, 0xFE, 0x10, 0xCB, 0xF7, 0x02, 0x82, 0xA7, 0x04, 0x01, 0x00, 0x9C, 
+    0x42, 0x11, 0xFE, 0x70, 0x28, 0x45, 0x13, 0x02, 0xCF, 0x59, 0x42, 0x05, 0x31, 0xF9, 0x53, 
+    0xE2, 0x41, 0x9A, 0x17, 0xF1, 0x00, 0x22, 0x04, 0x92, 0x15, 0x06, 0x00, 0x14, 0x9B, 0x06, 
+    0x20, 0x15, 0x9C, 0x08, 0x03, 0xF9, 0x1B, 0x31, 0x4E, 0x4F, 0x00, 0x10, 0x17, 0x02, 0xFE, 
+    0x20, 0x07, 0x01, 0xE3, 0x31, 0x01, 0xFF, 0x80, 0x9A, 0x9B, 0x8C, 0x8E, 0x28, 0x28, 0x19, 
+    0xFE, 0x8E, 0xF2, 0x52, 0xD2, 0x64, 0xFD, 0x43, 0xF8, 0x31, 0x00, 0x33, 0x12, 0x11, 0x1D, 
+    0x31, 0x1F, 0xFA, 0x00, 0x01, 0x85, 0x5B, 0x20, 0x92, 0x51, 0x2B, 0x20, 0x04, 0x06, 0x09, 
+    0x84, 0x0C, 0xD7, 0x00, 0xF0, 0x04, 0xD8, 0xFE, 0x07, 0x05, 0xE8, 0x14, 0xFF, 0xFF, 0x43, 
+    0xF8, 0x53, 0x03, 0x22, 0x12, 0x22, 0xFC, 0x92, 0xFA, 0x65, 0xFA, 0xA3, 0x04, 0xA0, 0x96, 
+    0x13, 0xF1, 0x00, 0x06, 0x00, 0x14, 0x06, 0x20, 0x9B, 0x59, 0x06, 0x10, 0x01, 0x00, 0x44, 
+    0x9B, 0x9B, 0x4C, 0x4F, 0x8E, 0x17, 0x59, 0xF0, 0x59, 0x4F, 0x2B, 0x99, 0x10, 0x40, 0xE2, 
+    0x40, 0x06, 0x51, 0xD9, 0x31, 0x80, 0x2E, 0xF6, 0x18, 0x5A, 0x8C, 0x9C, 0x98, 0xD0, 0x53, 
+    0xFC, 0x9A, 0x26, 0x02, 0x55, 0x04, 0x10, 0xE1, 0x02, 0xFA, 0x21, 0xF4, 0x02, 0x10, 0x32, 
+    0x8F, 0x08, 0x00, 0x16, 0x21, 0x03, 0x14, 0xFC, 0x64, 0x9B, 0x9B, 0x04, 0xAA, 0x63, 0xE9, 
+    0x15, 0x33, 0x06, 0x08, 0xFF, 0xF0, 0x06, 0xD7, 0xFF, 0x00, 0xFA, 0x50, 0x00, 0x74, 0xBF, 
+    0x1C, 0x46, 0x05, 0x57, 0x4D, 0x56, 0x20, 0x40, 0x01, 0x62, 0x0B, 0xF5, 0x01, 0x56, 0xF1, 
+    0x00, 0xE5, 0x8F, 0x02, 0x57, 0x06, 0x10, 0x9C, 0x9B, 0x0D, 0x20, 0x2F, 0x10, 0x03, 0x16, 
+    0x00, 0x9B, 0x5C, 0x8E, 0x4E, 0x5A, 0x8A, 0x8A, 0x4F, 0x3C, 0x2B, 0x98, 0xA6, 0x43, 0xD5, 
+    0x74, 0xFF, 0x30, 0x08, 0x30, 0xF5, 0x1D, 0xD0, 0x4F, 0x9C, 0x99, 0x97, 0xFA, 0x46, 0x9A, 
+    0xDA, 0x01, 0xF4, 0x10, 0xFF, 0x0E, 0x20, 0x08, 0x30, 0x0C, 0x21, 0x01, 0x72, 0x1F, 0x24, 
+    0x15, 0x11, 0x00, 0x31, 0xFC, 0x24, 0x2F, 0xFE, 0x54, 0x67, 0x30, 0xC8, 0x01, 0xFF, 0x03, 
+    0x0F, 0xFE, 0xF0, 0x04, 0xFB, 0x96, 0xFC, 0x21, 0x04, 0xFE, 0x11, 0xE0, 0x23, 0x07, 0x42, 
+    0xEE, 0x40, 0x04, 0x00, 0x17, 0x30, 0x5F, 0xFE, 0x50, 0x21, 0x38, 0x05, 0xB5, 0xF6, 0x42, 
+    0x73, 0x62, 0x12, 0xF1, 0x00, 0x98, 0xD1, 0x06, 0x31, 0x98, 0x9B, 0x9B, 0x0D, 0x12, 0x98, 
+    0x59, 0x10, 0x09, 0x07, 0x01, 0x51, 0x03, 0x02, 0x1D, 0x4F, 0x4E, 0x4E, 0x02, 0x9A, 0x1F, 
+    0x18, 0x00, 0x36, 0x40, 0xF9, 0x54, 0x06, 0x41, 0x01, 0x11, 0x98, 0x97, 0x96, 0xF8, 0x96, 
+    0x96, 0x97, 0x1F, 0x09, 0xB7, 0x14, 0x04, 0x41, 0x0A, 0x42, 0x06, 0x10, 0x9F, 0x09, 0x23, 
+    0x04, 0x41, 0x24, 0x24, 0x10, 0x03, 0x06, 0x31, 0x9A, 0x03, 0x2C, 0x11, 0x07, 0xA6, 0x33, 
+    0xFE, 0x65, 0x66, 0x24, 0x9A, 0x9C, 0x2B, 0x26, 0x08, 0x14, 0x91, 0x6B, 0xED, 0x03, 0xFB, 
+    0xF5, 0x43, 0xFB, 0x0F, 0xFB, 0x84, 0xFB, 0xD8, 0x02, 0x20, 0x08, 0x22, 0x28, 0x18, 0xF7, 
+    0x50, 0xFF, 0xFE, 0x56, 0xB8, 0x27, 0x43, 0x31, 0xF8, 0x34, 0x4E, 0x50, 0xFB, 0x13, 0x22, 
+    0x50, 0xC1, 0x40, 0xA7, 0x03, 0x20, 0xD1, 0x28, 0x07, 0x41, 0x2B, 0x2E, 0xDF, 0x12, 0x9B, 
+    0x06, 0x80, 0xE3, 0x56, 0x60, 0x54, 0x22, 0x9A, 0x9A, 0x98, 0xCC, 0x10, 0xB6, 0x19, 0xBE, 
+    0x47, 0xE3, 0xE3, 0x50, 0xE5, 0x41, 0x98, 0x97, 0x97, 0x0F, 0x4A, 0xE6, 0x30, 0xF6, 0x50, 
+    0xF8, 0x04, 0x04, 0x04, 0x0A, 0x52, 0x09, 0x42, 0x19, 0x67, 0x08, 0x33, 0xFC, 0x55, 0x2F, 
+    0x06, 0x26, 0xD5, 0x06, 0x93, 0x47, 0x2F, 0x03, 0x9B, 0x00, 0x01, 0x06, 0x51, 0x71, 0xF1, 
+    0x36, 0xFE, 0x08, 0x07, 0x02, 0x00, 0xF6, 0x04, 0x03, 0x00, 0x08, 0xF0, 0x07, 0x24, 0x9A, 
+    0x2B, 0xA0, 0x07, 0xE4, 0x10, 0xFB, 0xA7, 0x44, 0x72, 0xFF, 0xF7, 0x96, 0xFD, 0x60, 0x0D, 
+    0x15, 0x09, 0x12, 0x40, 0x0A, 0xD3, 0x40, 0x04, 0x74, 0x94, 0x10, 0x88, 0x57, 0x9A, 0x15, 
+    0xE5, 0x10, 0x9B, 0x9B, 0x14, 0x06, 0x20, 0xFF, 0x5A, 0x40, 0xE9, 0x20, 0xFA, 0x0A, 0xAF, 
+    0x36, 0x01, 0x00, 0xE6, 0x10, 0xC4, 0x55, 0x1B, 0x20, 0xFD, 0xF2, 0x64, 0x56, 0x27, 0x00, 
+    0x00, 0x55, 0xEC, 0x40, 0xBE, 0x59, 0xCF, 0x26, 0x30, 0x88, 0xFE, 0x04, 0x44, 0x79, 0x01, 
+    0x02, 0xFC, 0x20, 0xB9, 0x16, 0xB1, 0x62, 0xFE, 0x00, 0x12, 0x00, 0x06, 0x2B, 0x8F, 0x08, 
+    0x00, 0x10, 0x19, 0x02, 0x2B, 0x2B, 0x2B, 0x40, 0xBC, 0x02, 0x9D, 0x2B, 0x02, 0x1B, 0x0E, 
+    0x10, 0x1B, 0xFC, 0xF5, 0x2E, 0xFE, 0x10, 0xE6, 0x30, 0xFD, 0x77, 0x43, 0x86, 0xFF, 0x43, 
+    0xF6, 0x83, 0xFF, 0x00, 0x30, 0xBF, 0x11, 0xF3, 0x58, 0x09, 0x73, 0x0C, 0x77, 0x42, 0x54, 
+    0x05, 0x00, 0x58, 0x32, 0x9F, 0xD1, 0x49, 0xAD, 0x26, 0xB3, 0x4B, 0xF6, 0x5B, 0xFA, 0x33, 
+    0x98, 0x97, 0x31, 0x11, 0xFF, 0x7B, 0x7B, 0x73, 0xFB, 0x02, 0x9C, 0x41, 0x0F, 0xD0, 0x11, 
+    0xD0, 0x00, 0xF0, 0x01, 0xC9, 0xB9, 0x00, 0xF0, 0x0F, 0xFF, 0x37, 0xA0, 0x3F, 0xF0, 0x08, 
+    0x6D, 0xF0, 0x19, 0x8D, 0x39, 0xAD, 0x57, 0x51, 0x22, 0xE4, 0x15, 0xFD, 0x20, 0x47, 0xF5, 
+    0x0A, 0xFE, 0x10, 0x37, 0x10, 0x5A, 0x5A, 0x18, 0x00, 0x00, 0x17, 0x50, 0x5A, 0x17, 0x18, 
+    0x5A, 0x00, 0x00, 0x15, 0x02, 0x20, 0x58, 0xD1, 0x04, 0x00, 0x9C, 0x15, 0x58, 0x0B, 0x00, 
+    0x58, 0x05, 0x10, 0x0D, 0x00, 0x44, 0x58, 0x17, 0x08, 0x00, 0x17, 0x58, 0x15, 0x09, 0x00, 
+    0x18, 0x49, 0x0B, 0x00, 0x5A, 0x59, 0x1F, 0x00, 0x5A, 0x17, 0x3A, 0x00, 0x5A, 0x16, 0x19, 
+    0x3E, 0x10, 0x00, 0x10, 0x19, 0x01, 0x00, 0x18, 0x9D, 0x19, 0x9F, 0x04, 0x00, 0x73, 0x09, 
+    0x33, 0x00, 0x00, 0x20, 0x06, 0x10, 0x5A, 0x5A, 0x30, 0x00, 0x1F, 0x60, 0x00, 0x48, 0x00, 
+    0x08, 0x00, 0x25, 0x10, 0x00, 0x20, 0x17, 0x17, 0x15, 0x5E, 0x17, 0x00, 0x00, 0x6F, 0x10, 
+    0x17, 0x00, 0x1F, 0x00, 0x9C, 0x0E, 0x10, 0x17, 0x7E, 0x17, 0x18, 0x00, 0x07, 0x50, 0x24, 
+    0x10, 0x22, 0x10, 0x06, 0x30, 0x4C, 0x20, 0x17, 0xDF, 0x57, 0x30, 0x00, 0xC0, 0x1F, 0x30, 
+    0x0E, 0xB0, 0x34, 0x10, 0x9C, 0x05, 0x4B, 0x3F, 0x44, 0x85, 0xE4, 0xA7, 0x98, 0x27, 0x06, 
+    0x8A, 0x8C, 0x4F, 0x4D, 0x21, 0x05, 0xC6, 0x4D, 0x05, 0x00, 0x00, 0x00, 0x4D, 0x4E, 0x4D, 
+    0x00, 0x90, 0x0D, 0xB0, 0xFE, 0x4C, 0x02, 0x20, 0x09, 0x40, 0x1E, 0x30, 0x37, 0x20, 0x06, 
+    0x00, 0x28, 0x00, 0x44, 0x00, 0xFF, 0x00, 0x30, 0x48, 0x00, 0x36, 0xA0, 0x4B, 0x70, 0x17, 
+    0x30, 0x2F, 0x00, 0x33, 0x20, 0x5D, 0x30, 0xFF, 0x4A, 0x20, 0x67, 0x30, 0x6D, 0x50, 0x45, 
+    0x30, 0x5C, 0x30, 0x13, 0x40, 0x06, 0x20, 0x8D, 0x60, 0xB7, 0x96, 0xB0, 0x35, 0xE0, 0x1F, 
+    0x30, 0x1C, 0x3C, 0x00, 0x00, 0x00, 0x18, 0xF2, 0x12, 0xCF, 0x2C, 0x46, 0x9B, 0x58, 0x10, 
+    0x40, 0x16, 0x12, 0x18, 0x4F, 0x2E, 0x06, 0x00, 0xF0, 0xCB, 0xDF, 0xFF, 0x10, 0x2D, 0x6D, 
+    0xFF, 0x41, 0x43, 0x36, 0x17, 0x00, 0x17, 0xFE, 0xF0, 0xCF, 0xFF, 0x20, 0xEF, 0xFF, 0x31, 
+    0xFF, 0x26, 0x14, 0x3F, 0xE3, 0x4A, 0x9B, 0x2C, 0x1C, 0xFF, 0xF0, 0xCF, 0xA1, 0x78, 0x93, 
+    0xFF, 0x70, 0xA8, 0x3C, 0x9B, 0x5C, 0xFF, 0xF0, 0xD0, 0x99, 0x98, 0xC4, 0x08, 0xC7, 0xFF, 
+    0x66, 0xF1, 0x3A, 0x5F, 0x48, 0x9A, 0x9B, 0x19, 0xFF, 0xF1, 0xD4, 0x5E, 0x7B, 0xF7, 0xC2, 
+    0x49, 0xAA, 0x5A, 0xFF, 0xF2, 0xD1, 0x99, 0xFF, 0x12, 0x3F, 0x6B, 0xDD, 0x3B, 0xAA, 0x6B, 
+    0x72, 0x8C, 0xFF, 0xF1, 0xD2, 0x04, 0x04, 0x36, 0x4C, 0x9B, 0x5C, 0xFE, 0x51, 0x9A, 0x6C, 
+    0x9B, 0xF6, 0xFF, 0xF1, 0xD6, 0x03, 0x43, 0x15, 0xFB, 0x35, 0x4E, 0x6E, 0x2E, 0xC3, 0xFF, 
+    0xF1, 0xD2, 0xEF, 0x57, 0x9B, 0x15, 0x15, 0xA9, 0xDE, 0x3C, 0x40, 0x6D, 0xCF, 0xFF, 0xF1, 
+    0xD1, 0xFF, 0x20, 0xEB, 0x11, 0xFD, 0x00, 0xA9, 0xAA, 0xFC, 0x37, 0x2B, 0x4D, 0xC7, 0xFF, 
+    0xF0, 0xD7, 0x15, 0x0F, 0xFC, 0x10, 0x4B, 0xAA, 0x4B, 0xBC, 0x0E, 0x0E, 0x55, 0x45, 0xFF, 
+    0x10, 0xCD, 0xFF, 0xF0, 0xD0, 0x9B, 0x9A, 0x14, 0xFC, 0x10, 0x4B, 0xC0, 0x4B, 0xAA, 0xAA, 
+    0x4C, 0x4C, 0x4C, 0xFE, 0x54, 0x11, 0x44, 0x19, 0xFF, 0xF6, 0xD1, 0x18, 0x18, 0xF9, 0x01, 
+    0x00, 0x10, 0x4C, 0xEE, 0x8C, 0x1C, 0x8C, 0x4E, 0x00, 0x07, 0x0D, 0x26, 0xFF, 0x29, 0x9A, 
+    0x9B, 0x1A, 0xAF, 0xFF, 0xF0, 0xD0, 0xF4, 0x02, 0x02, 0x00, 0xFA, 0x01, 0x8C, 0x00, 0x00, 
+    0x4F, 0xFA, 0x77, 0x03, 0xFF, 0x21, 0xFF, 0xF0, 0xD1, 0x4C, 0x4C, 0x1C, 0x1C, 0x18, 0x1B, 
+    0xC0, 0x1D, 0x1D, 0x1D, 0x2B, 0x03, 0x2B, 0xFF, 0x10, 0xF9, 0x40, 0x03, 0x00, 0x15, 0xFF, 
+    0xF2, 0xD3, 0xAC, 0xAC, 0x03, 0x03, 0x54, 0x15, 0x00, 0x4F, 0x4F, 0x19, 0x03, 0x05, 0x2B, 
+    0x02, 0x4E, 0x07, 0x04, 0x49, 0xFF, 0x57, 0xFF, 0xF0, 0xD1, 0x00, 0x8C, 0x1C, 0x1C, 0x03, 
+    0x00, 0x19, 0x1F, 0x1F, 0x5C, 0x03, 0x04, 0x03, 0x02, 0x06, 0x4C, 0x09, 0x7B, 0xFF, 0xF2, 
+    0xD6, 0x00, 0x8C, 0x19, 0x19, 0x05, 0x00, 0x03, 0x1C, 0x01, 0x1B, 0x5A, 0x04, 0x59, 0x02, 
+    0x30, 0x8B, 0x9A, 0x9B, 0x9C, 0xFE, 0x71, 0xFF, 0xF1, 0xD4, 0x02, 0x5C, 0x00, 0x5C, 0x03, 
+    0x5A, 0x1B, 0x1C, 0x2E, 0x19, 0x59, 0x26, 0x15, 0xFF, 0x21, 0x00, 0x61, 0x58, 0x99, 0xFF, 
+    0xFE, 0xD2, 0x00, 0x2B, 0x00, 0x1D, 0x1D, 0x5C, 0x18, 0x1C, 0x01, 0x01, 0x1D, 0x5C, 0x18, 
+    0x18, 0xFF, 0x10, 0xFE, 0x00, 0xFB, 0x11, 0x58, 0x03, 0x00, 0x99, 0x01, 0xFF, 0xF2, 0xD3, 
+    0x02, 0x1C, 0x1C, 0x1B, 0x2E, 0x1D, 0x00, 0xC0, 0x00, 0x1D, 0x1B, 0x02, 0x2E, 0x1A, 0xFF, 
+    0x56, 0xFE, 0x00, 0x05, 0xFF, 0xF0, 0xD6, 0x29, 0x00, 0x20, 0x18, 0x5A, 0x5A, 0x18, 0x03, 
+    0xDC, 0x29, 0x1A, 0x0A, 0x0B, 0x00, 0x10, 0x03, 0x13, 0x9A, 0x17, 0x0B, 0xFF, 0xF3, 0xD2, 
+    0x10, 0x29, 0x02, 0x02, 0x2E, 0x00, 0x30, 0x02, 0x03, 0x1A, 0x57, 0xFF, 0x3C, 0x02, 0x17, 
+    0xFF, 0x00, 0x98, 0xFF, 0xF1, 0xD3, 0x03, 0xFF, 0x10, 0x02, 0x3F, 0x00, 0x20, 0xFF, 0xF0, 
+    0xF0, 0xFB, 0x22, 0x01, 0x33, 0x00, 0x10, 0xFF, 0xF0, 0xD2, 0x19, 0x9D, 0x83, 0x00, 0x00, 
+    0x04, 0x00, 0x18, 0x9C, 0x9C, 0x5A, 0x1A, 0x04, 0x00, 0x40, 0x18, 0x18, 0x9C, 0x9D, 0x17, 
+    0x9C, 0x00, 0x00, 0x17, 0x3C, 0x9C, 0x9D, 0xFF, 0xF3, 0xD2, 0xFB, 0x01, 0xFF, 0x01, 0x02, 
+    0x10, 0x02, 0x9D, 0x20, 0x1A, 0x9A, 0x9A, 0x96, 0x95, 0x00, 0x30, 0x96, 0x96, 0x01, 0xFF, 
+    0xF5, 0xD5, 0x4B, 0x4E, 0x4E, 0x4E, 0x4D, 0x4E, 0x4C, 0x01, 0x02, 0x00, 0x4C, 0x49, 0x4C, 
+    0x9B, 0x9B, 0x97, 0x57, 0x00, 0xA9, 0x48, 0xA9, 0x48, 0x48, 0x9A, 0x97, 0x97, 0xF0, 0x9B, 
+    0x99, 0x9B, 0x2E, 0xFF, 0xF0, 0xD1, 0xFA, 0x0E, 0xFC, 0x0E, 0x02, 0x20, 0x01, 0xFF, 0x10, 
+    0x98, 0x49, 0xE5, 0xE3, 0xE4, 0xE5, 0xE3, 0x70, 0x48, 0x98, 0x98, 0x9C, 0xFF, 0xF9, 0xD4, 
+    0xFF, 0x12, 0x02, 0x40, 0x9D, 0x01, 0xFF, 0x00, 0x99, 0x4A, 0xE7, 0xEA, 0xEC, 0xEB, 0xE5, 
+    0x80, 0x48, 0x99, 0x99, 0x58, 0x9A, 0x9B, 0x17, 0xFF, 0xFA, 0xD2, 0x58, 0x03, 0x03, 0x18, 
+    0x00, 0x00, 0xFF, 0x18, 0x03, 0xFF, 0x00, 0x9A, 0x70, 0x4A, 0xE5, 0xED, 0x4C, 0x03, 0x00, 
+    0xFF, 0x2D, 0xFF, 0xF4, 0xD2, 0x2B, 0x01, 0xFD, 0x48, 0x2E, 0x2E, 0x2B, 0x2B, 0x4C, 0x57, 
+    0x9B, 0x80, 0x9A, 0x4B, 0xE5, 0x48, 0x48, 0x48, 0xE6, 0xFF, 0x30, 0x57, 0xFF, 0xF4, 0xD2, 
+    0xFF, 0x10, 0xFF, 0x42, 0x2B, 0xFF, 0x11, 0xEE, 0xFF, 0x01, 0xED, 0x34, 0xE6, 0x4C, 0xFF, 
+    0xF0, 0xDA, 0x4D, 0x01, 0x30, 0xFF, 0x30, 0x4C, 0xE4, 0x1A, 0x48, 0xFF, 0x00, 0x4B, 0xFF, 
+    0x20, 0xFF, 0xF3, 0xD3, 0x2E, 0x2E, 0x4C, 0x34, 0x4C, 0x4A, 0x01, 0x00, 0x4C, 0xFF, 0x00, 
+    0xF4, 0x00, 0x4C, 0xE6, 0x83, 0xFF, 0x70, 0xFF, 0xF1, 0xD3, 0x02, 0x02, 0xA9, 0x4C, 0xA7, 
+    0x01, 0x00, 0x42, 0xA9, 0xFF, 0x40, 0xE5, 0x48, 0x4E, 0x4A, 0xFF, 0x32, 0x57, 0x7B, 0xFF, 
+    0xF4, 0xD5, 0xFF, 0x40, 0x2E, 0xFF, 0x80, 0xFF, 0x31, 0xFF, 0xF7, 0xD2, 0xFF, 0xE0, 0xE4, 
+    0x60, 0x48, 0x4E, 0xED, 0xE4, 0xEE, 0xFF, 0xF6, 0xDA, 0xFF, 0xB2, 0xE4, 0x70, 0xED, 0x4F, 
+    0xED, 0xE4, 0xFF, 0x35, 0xFF, 0xF1, 0xDC, 0xFF, 0x20, 0x99, 0x00, 0xEE, 0xE3, 0xEA, 0xEB, 
+    0xEB, 0xE3, 0x4A, 0x99, 0xA2, 0x99, 0xFF, 0xF4, 0xE4, 0x99, 0x4C, 0xE1, 0x00, 0x00, 0xE2, 
+    0xFF, 0x0A, 0x26, 0x57, 0xFF, 0xF2, 0xD5, 0xFF, 0xC0, 0x59, 0x4A, 0x00, 0x00, 0xED, 0x59, 
+    0x8F, 0xFF, 0x20, 0xFF, 0xF1, 0xD5, 0xFF, 0x77, 0xFF, 0x0C, 0x25, 0x25, 0x26, 0x00, 0x00, 
+    0x26, 0x24, 0xFF, 0x20, 0xFF, 0xF3, 0xD3, 0x02, 0x02, 0xFF, 0x79, 0x28, 0x9B, 0x04, 0x9D, 
+    0x02, 0x00, 0x10, 0xF5, 0x02, 0x9D, 0x9D, 0x9B, 0x46, 0x9B, 0xFF, 0xF2, 0xD6, 0xFF, 0x7B, 
+    0x9C, 0x9C, 0x9D, 0x00, 0x60, 0x2B, 0x1C, 0x9C, 0x9C, 0xFF, 0xF5, 0xD5, 0x00, 0x40, 0xFF, 
+    0x00, 0x99, 0x99, 0x9A, 0xC3, 0x01, 0x20, 0x07, 0x00, 0x9A, 0x99, 0x98, 0x9A, 0xFF, 0xF2, 
+    0xD5, 0x00, 0x6F, 0x26, 0x4C, 0xF6, 0x00, 0x00, 0x10, 0x26, 0x26, 0x04, 0x04, 0x9A, 0x98, 
+    0xF6, 0x9A, 0xFF, 0xF2, 0xD6, 0xFF, 0xA0, 0x9B, 0x03, 0x31, 0x00, 0x02, 0xFF, 0xF0, 0xD4, 
+    0xFF, 0x62, 0x1F, 0xFF, 0x3A, 0x02, 0x0F, 0x01, 0x10, 0xFF, 0xF0, 0xD8, 0xFF, 0x11, 0x8C, 
+    0x8C, 0x8C, 0x5E, 0x1D, 0xFF, 0x31, 0xF5, 0x05, 0xFC, 0x10, 0x03, 0x00, 0x9B, 0xFF, 0xF0, 
+    0xD8, 0x8C, 0x2F, 0xFC, 0x01, 0xFF, 0x20, 0xFC, 0x42, 0xFD, 0x10, 0x9B, 0xFF, 0xF1, 0xD8, 
+    0x8C, 0x8B, 0xCF, 0xFF, 0x60, 0xFB, 0x22, 0xFF, 0x32, 0xFF, 0xF1, 0xD6, 0x2E, 0x2E, 0xFE, 
+    0x10, 0xFF, 0x61, 0xFB, 0xFE, 0x64, 0xFF, 0x01, 0x17, 0xFF, 0xF1, 0xD4, 0xFF, 0x80, 0xFE, 
+    0x30, 0x04, 0x14, 0x00, 0x00, 0x06, 0x9C, 0xFF, 0xF2, 0xD5, 0xFF, 0xD0, 0x9B, 0x18, 0x18, 
+    0x1A, 0x17, 0x1C, 0x17, 0x1A, 0x01, 0x00, 0xFF, 0xF2, 0xDF, 0xFA, 0x24, 0x5C, 0x5C, 0x1C, 
+    0x80, 0x1A, 0x8C, 0x8C, 0x1A, 0x8C, 0x1A, 0x1C, 0xFF, 0xF3, 0xE3, 0x00, 0x9C, 0x5C, 0x2B, 
+    0x13, 0x55, 0x9A, 0x9A, 0x84, 0x98, 0x87, 0x1A, 0x02, 0xFF, 0xF0, 0xD4, 0xFF, 0x75, 0x9B, 
+    0x57, 0xFF, 0x01, 0x00, 0x18, 0x02, 0xF5, 0x28, 0x26, 0x07, 0x07, 0x0A, 0x38, 0x07, 0x8C, 
+    0x03, 0xFF, 0xF9, 0xD5, 0xFF, 0x97, 0xFF, 0x01, 0x02, 0x18, 0x80, 0x19, 0x03, 0x52, 0x52, 
+    0x07, 0x22, 0x4E, 0xFF, 0xFA, 0xD6, 0x06, 0x02, 0xFF, 0x59, 0xFF, 0x30, 0xF5, 0x2E, 0x8C, 
+    0x9C, 0x22, 0x30, 0x22, 0x09, 0x06, 0x8C, 0xFF, 0xFB, 0xE1, 0xFF, 0x02, 0x9C, 0xF5, 0x00, 
+    0x1C, 0x8C, 0x9C, 0x26, 0x26, 0x07, 0x26, 0x1A, 0x06, 0x2B, 0xFF, 0xF0, 0xDF, 0x00, 0x11, 
+    0x18, 0x02, 0x8E, 0xF6, 0x03, 0xA0, 0x51, 0x51, 0x07, 0x07, 0x5A, 0xFF, 0xF4, 0xD3, 0x4A, 
+    0x00, 0x60, 0x01, 0xFF, 0x42, 0x2B, 0xF5, 0x1C, 0x5C, 0x9A, 0x58, 0x58, 0x08, 0x51, 0x28, 
+    0x03, 0xFF, 0xF2, 0xD3, 0x4A, 0x4A, 0x46, 0x46, 0x60, 0x44, 0x44, 0x44, 0x46, 0x46, 0xFF, 
+    0x20, 0xFF, 0x01, 0x9C, 0x00, 0xF5, 0x8E, 0x8C, 0x1A, 0xF5, 0xF5, 0x58, 0x15, 0xBE, 0x2E, 
+    0xFF, 0xF5, 0xD3, 0xFF, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0x12, 0x00, 
+    0x5C, 0xF5, 0x01, 0x2B, 0x5C, 0x18, 0x18, 0x55, 0x14, 0x04, 0x1A, 0xFF, 0xF1, 0xDF, 0x57, 
+    0xFF, 0x21, 0x2E, 0x8E, 0xF6, 0x80, 0x1A, 0x5C, 0x5C, 0x9A, 0x26, 0x02, 0x1A, 0xFF, 0xF3, 
+    0xDE, 0x01, 0xF6, 0x3C, 0xF6, 0xCE, 0x5C, 0x5A, 0x9A, 0x9A, 0x98, 0x72, 0x2B, 0xFF, 0xF3, 
+    0xD4, 0x02, 0x02, 0x00, 0x08, 0x00, 0x20, 0xFF, 0x00, 0x9A, 0x20, 0x9C, 0x9B, 0x9A, 0x9D, 
+    0xF5, 0x0B, 0x16, 0x2B, 0x1A, 0x08, 0x2E, 0xF5, 0x19, 0xFF, 0xF7, 0xE0, 0x9C, 0x9C, 0x9A, 
+    0x9C, 0x00, 0xF6, 0x9C, 0x85, 0x15, 0x25, 0x25, 0x56, 0x8E, 0x04, 0x2E, 0x8C, 0xFE, 0xF0, 
+    0xD0, 0x1F, 0x1D, 0x1D, 0x1D, 0x01, 0x10, 0x1F, 0x1D, 0x2E, 0x1F, 0x08, 0x00, 0x1B, 0x4C, 
+    0x9B, 0x02, 0x58, 0xFF, 0x12, 0x2E, 0xF6, 0x17, 0x89, 0x28, 0x28, 0xE8, 0x2B, 0x2B, 0x18, 
+    0xFF, 0xF7, 0xD1, 0x8E, 0x04, 0x10, 0x03, 0x01, 0x00, 0x20, 0x0B, 0xFF, 0x03, 0xFF, 0x01, 
+    0x5C, 0xFF, 0x06, 0x9C, 0x03, 0x03, 0x9C, 0x0C, 0x2B, 0x19, 0xFF, 0xF3, 0xD1, 0xFF, 0x10, 
+    0x1A, 0x1D, 0x1D, 0x1A, 0x00, 0x1A, 0x17, 0x17, 0x1A, 0x1B, 0x8C, 0x9C, 0x9C, 0x82, 0x9B, 
+    0x01, 0x00, 0x2E, 0xF6, 0x2E, 0x88, 0x2B, 0x00, 0x00, 0x04, 0x5C, 0x2E, 0xFF, 0xF0, 0xD1, 
+    0x8E, 0x5A, 0x5A, 0x58, 0x5A, 0x00, 0x5A, 0x63, 0x62, 0x62, 0x61, 0x63, 0x1A, 0x4C, 0x02, 
+    0x9C, 0x00, 0x00, 0x9B, 0x02, 0xF6, 0x9B, 0x88, 0x56, 0x29, 0xFF, 0x03, 0xBD, 0x2B, 0xFF, 
+    0xF3, 0xD1, 0x00, 0xFF, 0x00, 0x5A, 0x1B, 0x64, 0x1D, 0x62, 0xFD, 0x02, 0x61, 0x17, 0xFF, 
+    0x30, 0xFF, 0x06, 0x8C, 0xC0, 0x89, 0x29, 0x29, 0x2B, 0x8C, 0x1C, 0xFF, 0xF7, 0xD2, 0xFF, 
+    0x00, 0x00, 0x5C, 0x1D, 0x1D, 0x63, 0x1F, 0x00, 0x8E, 0x61, 0x23, 0xFF, 0x11, 0xFF, 0x22, 
+    0x8E, 0x1D, 0x9C, 0xFF, 0x04, 0x1C, 0x1C, 0x16, 0x1C, 0xFF, 0xF0, 0xD4, 0xFF, 0x02, 0x62, 
+    0xFF, 0x00, 0x62, 0x17, 0x8C, 0x01, 0xFC, 0x00, 0x9C, 0x9A, 0x02, 0x1C, 0x8E, 0x1D, 0x89, 
+    0x20, 0x9A, 0x9A, 0x14, 0x02, 0xF5, 0xFF, 0xF0, 0xD5, 0x5A, 0x1B, 0x80, 0x5C, 0x17, 0x1D, 
+    0x1F, 0x1D, 0x17, 0x1A, 0xFF, 0x24, 0x00, 0x9A, 0x02, 0xF5, 0x9C, 0x87, 0x26, 0x21, 0x21, 
+    0x10, 0x55, 0x2B, 0x02, 0xF6, 0xFF, 0xF0, 0xD1, 0x1F, 0x18, 0x18, 0xD8, 0x1C, 0x1D, 0x1D, 
+    0x02, 0x03, 0x04, 0x00, 0x8C, 0xFD, 0x12, 0xFF, 0x08, 0x48, 0x8E, 0x8C, 0x59, 0xFF, 0x02, 
+    0x02, 0x8C, 0xFF, 0xF4, 0xD2, 0x00, 0x00, 0x18, 0x18, 0x19, 0x1F, 0x18, 0x11, 0x58, 0x56, 
+    0x20, 0x19, 0x59, 0x5A, 0x4C, 0x9C, 0xFF, 0x1C, 0x02, 0xF5, 0x14, 0x4F, 0x1B, 0xFF, 0x28, 
+    0x2E, 0xFF, 0xF1, 0xD3, 0x17, 0x17, 0x5A, 0x00, 0x1F, 0x5A, 0x52, 0x11, 0x54, 0x59, 0x13, 
+    0x59, 0x03, 0xFF, 0x32, 0xFF, 0x0F, 0xF6, 0x88, 0x56, 0x56, 0x29, 0x2E, 0x86, 0x01, 0xFF, 
+    0xF1, 0xD2, 0xFF, 0x00, 0x17, 0x1F, 0x1B, 0x54, 0xFF, 0x21, 0x03, 0xFF, 0x10, 0xFF, 0x1F, 
+    0x5A, 0x87, 0x56, 0x98, 0x98, 0x9A, 0x08, 0x56, 0x2E, 0x01, 0xFE, 0xF0, 0xD1, 0x1F, 0x15, 
+    0x15, 0x17, 0xC0, 0x1F, 0x1F, 0x13, 0x1B, 0x5C, 0x1A, 0xFF, 0x03, 0xFE, 0x17, 0x01, 0xFF, 
+    0x06, 0x1A, 0xF6, 0x1A, 0x2B, 0x2B, 0x26, 0x26, 0x01, 0xFF, 0xF2, 0xD4, 0x15, 0x15, 0x1B, 
+    0x00, 0x00, 0x59, 0x1F, 0x30, 0x00, 0x19, 0x19, 0x18, 0xFF, 0x10, 0xFF, 0x24, 0xF5, 0x18, 
+    0x40, 0xF5, 0xF5, 0x14, 0x9B, 0x02, 0x5C, 0xFF, 0xF0, 0xD7, 0x1D, 0x30, 0x1F, 0x00, 0x15, 
+    0x5A, 0xFF, 0x10, 0xFF, 0x2D, 0x8E, 0x2B, 0x40, 0x1A, 0x18, 0x18, 0x56, 0x28, 0x01, 0xFF, 
+    0xF2, 0xD1, 0x00, 0x00, 0x00, 0x15, 0x15, 0x1A, 0x1F, 0x1F, 0x1B, 0x18, 0x0E, 0x5C, 0x00, 
+    0x00, 0xFF, 0x1A, 0xFF, 0x13, 0x01, 0xF6, 0x18, 0x17, 0x18, 0x17, 0x99, 0x58, 0xFF, 0xF2, 
+    0xD3, 0xFF, 0x10, 0x1B, 0x1C, 0x1D, 0x40, 0x5C, 0x1E, 0x1E, 0x1E, 0x1F, 0x8B, 0xFF, 0x29, 
+    0x9C, 0x00, 0x1F, 0x8E, 0x8C, 0x5A, 0x10, 0x10, 0x07, 0x26, 0x02, 0x9C, 0xFF, 0xF1, 0xD8, 
+    0x63, 0x18, 0x2E, 0x1D, 0x1D, 0x2E, 0x03, 0xFF, 0x08, 0xFF, 0x01, 0xF5, 0x8E, 0x18, 0x1C, 
+    0x9C, 0x57, 0x10, 0x57, 0x22, 0x57, 0x02, 0xFF, 0xF0, 0xD6, 0x1D, 0x8E, 0x17, 0x20, 0x1B, 
+    0x1E, 0x1F, 0x1E, 0x1D, 0xFF, 0x32, 0x9C, 0x8E, 0x00, 0x2E, 0x8C, 0x9C, 0x25, 0x25, 0x08, 
+    0x99, 0xF5, 0x83, 0xFF, 0xF9, 0xD3, 0xFF, 0x00, 0x8E, 0x00, 0x63, 0x1B, 0x1A, 0x08, 0x0C, 
+    0x03, 0xFF, 0x2E, 0xFF, 0x00, 0x18, 0x1C, 0x2B, 0x55, 0x55, 0x22, 0x48, 0x24, 0xF5, 0x9C, 
+    0xFF, 0xF0, 0xD4, 0x19, 0x1C, 0xFF, 0x0F, 0x8E, 0x10, 0x8E, 0x17, 0x5A, 0x4C, 0xFF, 0x02, 
+    0x9C, 0x9B, 0x18, 0x00, 0x02, 0x8C, 0x02, 0x04, 0x06, 0x06, 0x08, 0x07, 0x02, 0x9C, 0xFF, 
+    0xF6, 0xD2, 0x00, 0x63, 0x63, 0x17, 0x17, 0x19, 0x80, 0x63, 0x19, 0x1A, 0x8E, 0x63, 0x5A, 
+    0x8B, 0xFF, 0x13, 0x00, 0x9B, 0x9C, 0xF5, 0x9D, 0x9C, 0x13, 0x13, 0x13, 0x48, 0x86, 0x88, 
+    0xF6, 0xFF, 0xF5, 0xD3, 0x5A, 0x5A, 0xFF, 0x00, 0x15, 0x0E, 0x19, 0x04, 0x0D, 0xFF, 0x20, 
+    0x02, 0x06, 0x2E, 0x05, 0x24, 0x56, 0x40, 0x9B, 0x9B, 0x06, 0x28, 0x2B, 0x03, 0xFF, 0xFD, 
+    0xD4, 0x1A, 0xC8, 0x1A, 0x1C, 0x18, 0xFE, 0x06, 0x1B, 0x1C, 0xFF, 0x0D, 0xFF, 0x10, 0x00, 
+    0xF6, 0x9C, 0x9C, 0x13, 0x26, 0x26, 0x24, 0x04, 0x04, 0x04, 0x56, 0xFF, 0xF3, 0xD4, 0x5A, 
+    0x5A, 0x18, 0x5A, 0x18, 0x18, 0x18, 0x1B, 0x18, 0xFF, 0x1E, 0xFF, 0x10, 0x9C, 0x2E, 0x2E, 
+    0x22, 0xF5, 0x02, 0x00, 0x02, 0xF5, 0xF5, 0xFF, 0xF0, 0xD2, 0x58, 0x58, 0x00, 0x18, 0x19, 
+    0x1B, 0x19, 0x1C, 0x1C, 0x1B, 0x1A, 0xC6, 0x5A, 0xFF, 0x07, 0x01, 0x00, 0x9B, 0x9C, 0x9D, 
+    0x07, 0x16, 0x04, 0x00, 0xA6, 0x18, 0xFF, 0xF0, 0xD4, 0x01, 0x02, 0x18, 0x5A, 0x00, 0x00, 
+    0x17, 0xFF, 0x25, 0x0B, 0x02, 0x1C, 0x00, 0x20, 0x9C, 0xFF, 0xF5, 0xD4, 0x12, 0x12, 0x57, 
+    0x59, 0x00, 0x5A, 0x19, 0x19, 0x17, 0x1A, 0x18, 0x19, 0x4C, 0x27, 0xF4, 0x00, 0x02, 0x21, 
+    0x06, 0x21, 0x9A, 0x9B, 0xFF, 0xF0, 0xD5, 0x12, 0x13, 0xC0, 0x13, 0x15, 0x15, 0x14, 0x5A, 
+    0x14, 0xFF, 0x01, 0xFE, 0x22, 0x0B, 0xFB, 0x21, 0x08, 0x1A, 0x1A, 0xFF, 0xF5, 0xD4, 0x17, 
+    0x17, 0x17, 0x1A, 0xBA, 0x1A, 0x01, 0x12, 0x8C, 0xF8, 0x10, 0xFC, 0x20, 0x08, 0x2A, 0x9B, 
+    0xFF, 0xF0, 0xD3, 0x00, 0x02, 0x02, 0x1C, 0x1B, 0x2E, 0x1D, 0x00, 0x00, 0x70, 0x1D, 0x1B, 
+    0x1B, 0x1B, 0xFF, 0x20, 0x03, 0x28, 0x03, 0x02, 0x99, 0x8D, 0xFF, 0xF3, 0xD4, 0x29, 0x00, 
+    0x20, 0x00, 0x05, 0x18, 0x03, 0x29, 0xFE, 0x30, 0x94, 0x9B, 0x58, 0xFF, 0x40, 0x19, 0xFF, 
+    0xF0, 0xD4, 0x02, 0x2E, 0x00, 0x30, 0x9C, 0x02, 0x03, 0xFF, 0x40, 0x06, 0x36, 0xFF, 0xF0, 
+    0xD5, 0x03, 0x03, 0xFF, 0x00, 0x7A, 0x02, 0x00, 0x20, 0x03, 0xFF, 0x42, 0x00, 0x25, 0xFF, 
+    0x04, 0xFF, 0xF0, 0xD3, 0x19, 0x10, 0x19, 0x9D, 0x9D, 0x9D, 0x03, 0x00, 0x18, 0x9C, 0x9C, 
+    0x3E, 0x5A, 0xFF, 0x66, 0xFF, 0x17, 0xFF, 0xF0, 0xD5, 0xFC, 0x01, 0x02, 0x40, 0x02, 0x9D, 
+    0x17, 0xFE, 0x54, 0x06, 0x27, 0xFF, 0xF6, 0xD5, 0x1A, 0x00, 0x30, 0x1B, 0x1B, 0x1A, 0x1C, 
+    0x1B, 0x8B, 0xFA, 0x21, 0xFF, 0x23, 0xFF, 0xF0, 0xD8, 0x13, 0x13, 0x14, 0xE1, 0x00, 0x10, 
+    0x15, 0x15, 0x59, 0x5A, 0xFF, 0xF0, 0xEF, 0xF8, 0x30, 0x05, 0x34, 0x41, 0xFF, 0xF9, 0xD6, 
+    0x13, 0x13, 0x18, 0x19, 0x18, 0x00, 0x00, 0x19, 0x3C, 0x15, 0x18, 0xFF, 0x3C, 0x04, 0x4F, 
+    0x05, 0x01, 0xFF, 0xF0, 0xD3, 0x63, 0x63, 0x3B, 0xFF, 0x0D, 0x00, 0x20, 0x18, 0xFF, 0x22, 
+    0xFF, 0x7C, 0xFF, 0xF0, 0xD4, 0x15, 0x15, 0x00, 0x1A, 0x17, 0x1C, 0x1A, 0x1E, 0x1E, 0x1C, 
+    0x18, 0x1C, 0x19, 0x8C, 0xFA, 0x50, 0xFF, 0x3B, 0xFF, 0xF0, 0xD4, 0x14, 0x14, 0x1A, 0xDA, 
+    0x14, 0xFE, 0x2F, 0x5A, 0xFF, 0x0E, 0x00, 0xA2, 0x15, 0xFF, 0xFB, 0xD3, 0xFF, 0x00, 0x00, 
+    0x15, 0x1C, 0x19, 0x1E, 0x1E, 0x1E, 0x18, 0x1B, 0x00, 0x4C, 0x28, 0x9C, 0x56, 0x99, 0x99, 
+    0x54, 0x99, 0x41, 0x03, 0x00, 0x9A, 0x9A, 0x58, 0x9A, 0x5A, 0xFF, 0xF0, 0xD5, 0x18, 0x00, 
+    0x15, 0x19, 0x15, 0x19, 0x19, 0x1F, 0x5A, 0x1A, 0x00, 0x1B, 0x9C, 0x14, 0x10, 0x50, 0x50, 
+    0x50, 0x96, 0x00, 0x51, 0x50, 0x50, 0x10, 0x10, 0x9C, 0x9A, 0x18, 0x03, 0xFF, 0xF9, 0xD3, 
+    0xFF, 0x16, 0x18, 0x61, 0x19, 0x1A, 0x8E, 0x63, 0x00, 0x1B, 0x4E, 0x58, 0x57, 0x50, 0x56, 
+    0x48, 0x48, 0x80, 0xA9, 0x49, 0x49, 0x13, 0x53, 0x53, 0x9C, 0xFF, 0xF1, 0xD5, 0x00, 0x62, 
+    0x62, 0x1B, 0x1F, 0x1F, 0x62, 0x1A, 0x8E, 0x00, 0x8E, 0x17, 0x1D, 0x8C, 0x9A, 0x14, 0x54, 
+    0x47, 0x22, 0x4C, 0x00, 0x10, 0x49, 0x55, 0x55, 0xFF, 0xF0, 0xD5, 0x8E, 0x63, 0x00, 0x63, 
+    0x1B, 0x1F, 0x00, 0x63, 0x1A, 0x1A, 0x1E, 0x20, 0x1A, 0x1A, 0x4E, 0x28, 0x57, 0xFE, 0x01, 
+    0x48, 0x49, 0x80, 0x49, 0x4E, 0x49, 0x57, 0x57, 0x9C, 0x9B, 0xFF, 0xF0, 0xD4, 0x00, 0x17, 
+    0x17, 0x1A, 0x1D, 0x00, 0x17, 0x5A, 0x1D, 0x00, 0x8E, 0x1D, 0x5C, 0x4E, 0x9B, 0x9C, 0x13, 
+    0x4A, 0x00, 0x47, 0x46, 0x48, 0x47, 0x00, 0x4A, 0x58, 0x58, 0x01, 0xFF, 0xF0, 0xD5, 0x1D, 
+    0x1A, 0x1A, 0x1D, 0x8E, 0x00, 0x1B, 0x00, 0x18, 0x5C, 0x5C, 0x5C, 0x1B, 0x4C, 0x04, 0x9C, 
+    0x02, 0x57, 0xFF, 0x00, 0x47, 0x46, 0x1F, 0x4C, 0x63, 0x63, 0x03, 0x0E, 0x0F, 0xFF, 0xF0, 
+    0xD2, 0x1F, 0x17, 0x17, 0x1B, 0x1F, 0x8E, 0x00, 0x1D, 0x1F, 0x8E, 0x15, 0x5A, 0x1F, 0x8C, 
+    0x9A, 0x08, 0x2B, 0x59, 0x4C, 0xFF, 0x10, 0x00, 0x4A, 0x15, 0x15, 0x10, 0x9C, 0x9C, 0x1A, 
+    0x1C, 0xFF, 0xF4, 0xD2, 0x17, 0x17, 0x1C, 0x04, 0x8E, 0x8E, 0x02, 0x01, 0x19, 0x19, 0x8E, 
+    0x4E, 0x9B, 0x30, 0x2B, 0x59, 0x4A, 0x48, 0xFF, 0x20, 0xFF, 0x02, 0x9C, 0x1A, 0x01, 0xFF, 
+    0xF9, 0xD3, 0x5A, 0x5A, 0x5C, 0x8E, 0x1D, 0x5A, 0x1B, 0x80, 0x5C, 0x2B, 0x1D, 0x8E, 0x4C, 
+    0x9A, 0x1B, 0xFF, 0x50, 0x05, 0xFF, 0x01, 0x9B, 0xFF, 0xF1, 0xD4, 0x14, 0x14, 0x5A, 0x1F, 
+    0x1B, 0x00, 0x58, 0x5A, 0x2B, 0x59, 0x19, 0x1D, 0x8C, 0x9B, 0x5C, 0x02, 0x15, 0xFF, 0x10, 
+    0xFF, 0x04, 0xFF, 0x10, 0x17, 0xFF, 0xF7, 0xD3, 0x59, 0x00, 0x59, 0x18, 0x1F, 0x5A, 0x12, 
+    0x57, 0x5A, 0x04, 0xE0, 0x5A, 0x1B, 0x4C, 0x9A, 0xBD, 0xFF, 0x20, 0xFF, 0x41, 0xFF, 0xFB, 
+    0xD4, 0x00, 0x18, 0x18, 0x5C, 0x8E, 0x18, 0x15, 0x5A, 0x19, 0x80, 0x2B, 0x19, 0x1D, 0x4F, 
+    0x28, 0xF5, 0x14, 0xFF, 0x04, 0x90, 0x48, 0x47, 0x1F, 0x4C, 0xFF, 0x10, 0x5A, 0xF6, 0xFF, 
+    0xF0, 0xD2, 0x40, 0x1A, 0x1A, 0x1C, 0x1D, 0x1D, 0x5C, 0x00, 0x06, 0x8E, 0x00, 0x8E, 0x8C, 
+    0x57, 0x2E, 0x15, 0x4A, 0x00, 0x4D, 0x24, 0x1F, 0x4D, 0xFF, 0x31, 0x5A, 0x8C, 0xFF, 0xF0, 
+    0xD4, 0x1D, 0x1B, 0x42, 0x5C, 0x03, 0x05, 0x1B, 0x18, 0x18, 0x8C, 0xFF, 0x02, 0x4C, 0x4A, 
+    0x00, 0xFE, 0x03, 0x47, 0xFF, 0x10, 0x9A, 0x5A, 0xFF, 0xF5, 0xD3, 0x17, 0x00, 0x17, 0x1D, 
+    0x1B, 0x1D, 0x58, 0x18, 0x8E, 0x1B, 0x80, 0x59, 0x5A, 0x4F, 0x9A, 0xBD, 0x17, 0x4A, 0x14, 
+    0x20, 0x40, 0x4A, 0x59, 0x59, 0x9C, 0x99, 0x59, 0xFF, 0xF0, 0xD6, 0x1D, 0x00, 0x00, 0x18, 
+    0x5C, 0x1D, 0x1B, 0x57, 0x18, 0x4E, 0x01, 0xFF, 0x01, 0x5A, 0x4A, 0x49, 0x4A, 0x4A, 0x4A, 
+    0x5A, 0x60, 0x5A, 0x5A, 0x9C, 0x9A, 0x14, 0xFF, 0xFE, 0xD3, 0xFF, 0x09, 0x1B, 0x40, 0x1D, 
+    0x5A, 0x18, 0x19, 0x18, 0x12, 0xFF, 0x01, 0x2E, 0x00, 0x5A, 0x15, 0x15, 0x15, 0x58, 0x17, 
+    0x15, 0x5A, 0x20, 0x5C, 0x5C, 0x9C, 0x9A, 0x58, 0xFF, 0xF0, 0xD5, 0x59, 0x17, 0x80, 0x17, 
+    0x13, 0x58, 0x58, 0x58, 0x57, 0x19, 0xFF, 0x0C, 0x10, 0x2B, 0x9D, 0x2B, 0x02, 0x00, 0x10, 
+    0x9D, 0x9D, 0x9B, 0x08, 0x9A, 0x58, 0x18, 0xFF, 0xF4, 0xD4, 0x17, 0x1D, 0x1A, 0x18, 0x00, 
+    0x18, 0x5A, 0x5A, 0x18, 0x1B, 0x4E, 0x58, 0x9A, 0x04, 0x9C, 0x9D, 0x00, 0x30, 0x9C, 0x9C, 
+    0x9B, 0x9A, 0x59, 0x0B, 0xFF, 0xF1, 0xD3, 0x02, 0x0E, 0x1F, 0x00, 0x40, 0x4F, 0x9A, 0x9A, 
+    0x9B, 0x2A, 0x9C, 0x00, 0x20, 0x9B, 0x09, 0x00, 0x99, 0xFF, 0xF1, 0xD4, 0x1E, 0x1E, 0x01, 
+    0x05, 0x1E, 0x1F, 0x1E, 0x1E, 0x1C, 0x1B, 0x1E, 0x9A, 0xA8, 0x9B, 0x9A, 0x9B, 0x00, 0x20, 
+    0x9A, 0xFF, 0x00, 0x98, 0xFF, 0xF1, 0xD4, 0x02, 0x1B, 0x00, 0x00, 0x1F, 0x1C, 0x1C, 0x5C, 
+    0x1B, 0x1B, 0x78, 0x1A, 0x1B, 0x28, 0xF9, 0x00, 0x02, 0x30, 0xFF, 0x21, 0xFF, 0xF0, 0xD3, 
+    0x5C, 0xB0, 0x5C, 0x18, 0x19, 0x1B, 0x01, 0x00, 0x02, 0x04, 0x5C, 0xFE, 0x51, 0x05, 0xFF, 
+    0x20, 0x9B, 0xFF, 0xF0, 0xD4, 0x1B, 0x1B, 0x18, 0x19, 0x5C, 0xC4, 0x18, 0x5C, 0xFE, 0x00, 
+    0x59, 0x5C, 0x28, 0x00, 0x13, 0xFE, 0x21, 0x8C, 0x99, 0x99, 0x09, 0x05, 0xFF, 0xF0, 0xD3, 
+    0x1A, 0x1A, 0x19, 0xFF, 0x20, 0x70, 0x19, 0x18, 0x59, 0x5C, 0xF5, 0x01, 0xF8, 0x11, 0x00, 
+    0x01, 0x99, 0x08, 0x99, 0x9B, 0x9B, 0xFF, 0xF0, 0xD3, 0x19, 0x5A, 0x5A, 0x59, 0x62, 0x5A, 
+    0xFF, 0x41, 0x19, 0x28, 0x04, 0x00, 0x21, 0x02, 0x20, 0x99, 0x08, 0x98, 0x9A, 0x9D, 0xFF, 
+    0xF0, 0xD1, 0x5A, 0x12, 0x12, 0x54, 0xE6, 0x58, 0xFC, 0x07, 0x00, 0x08, 0x58, 0x18, 0xFE, 
+    0x31, 0x01, 0x12, 0x00, 0x04, 0x08, 0x99, 0x57, 0x17, 0xFF, 0xF7, 0xD4, 0x19, 0x19, 0x1C, 
+    0x19, 0xF2, 0x19, 0xF8, 0x0A, 0x57, 0x19, 0xF7, 0x00, 0x01, 0x12, 0xFD, 0x10, 0x00, 0x00, 
+    0x87, 0xFF, 0xFC, 0xD4, 0x01, 0x1B, 0xFF, 0x29, 0x59, 0x57, 0x18, 0x58, 0xF9, 0x21, 0x61, 
+    0xFE, 0x31, 0x9A, 0x9A, 0x15, 0x5A, 0xFC, 0xF0, 0xD1, 0xF8, 0x00, 0x14, 0x02, 0x59, 0xFF, 
+    0x10, 0x15, 0x14, 0x12, 0x5A, 0x9A, 0x03, 0x5B, 0xFB, 0x50, 0x09, 0x1A, 0x63, 0xFF, 0xF4, 
+    0xD2, 0xFF, 0x23, 0x59, 0xFD, 0x01, 0x58, 0x28, 0x57, 0x57, 0x5A, 0xFB, 0x11, 0x03, 0x03, 
+    0x47, 0x9C, 0xF5, 0x02, 0xF5, 0xFF, 0xF0, 0xD2, 0x8E, 0x1F, 0x1F, 0x17, 0x1A, 0x1A, 0x72, 
+    0x5C, 0x00, 0x00, 0x18, 0x15, 0xFF, 0x13, 0xFE, 0x48, 0xFF, 0x07, 0x9C, 0x81, 0xFF, 0xF0, 
+    0xD3, 0x02, 0x1C, 0x1C, 0x1B, 0x2E, 0x1D, 0x01, 0x1C, 0x98, 0x1F, 0x1F, 0x1A, 0xFF, 0x3A, 
+    0xFE, 0x45, 0x9B, 0x19, 0xFF, 0xF5, 0xD2, 0xC6, 0x29, 0x00, 0x20, 0xFE, 0x1E, 0x03, 0x29, 
+    0x1A, 0xFB, 0x20, 0x04, 0x01, 0x09, 0x00, 0x21, 0x98, 0x15, 0xFF, 0xF1, 0xD2, 0x29, 0x47, 
+    0x47, 0x44, 0x08, 0x43, 0x44, 0x44, 0x03, 0x00, 0x47, 0x03, 0x1A, 0x29, 0xB1, 0xFD, 0x00, 
+    0x15, 0x15, 0x15, 0x03, 0x35, 0xFF, 0xFC, 0xD4, 0x03, 0xFF, 0x10, 0x9F, 0x00, 0x10, 0xFF, 
+    0x10, 0xF9, 0x11, 0xFD, 0x40, 0xFF, 0x00, 0x15, 0x5C, 0xFC, 0xF8, 0xD2, 0x06, 0x9D, 0x00, 
+    0x00, 0x04, 0x00, 0x18, 0x9C, 0x9C, 0x5A, 0x1A, 0x2E, 0x9B, 0xFF, 0x16, 0xFC, 0x1B, 0x05, 
+    0x24, 0x59, 0xFF, 0xF0, 0xD2, 0x2E, 0x02, 0xC8, 0x02, 0x2E, 0x2E, 0x02, 0x20, 0x02, 0x9D, 
+    0xFF, 0x33, 0xFE, 0x20, 0x0A, 0x59, 0x12, 0x07, 0x5C, 0xFF, 0xF2, 0xD2, 0x2E, 0x01, 0x01, 
+    0x01, 0x81, 0x05, 0x06, 0x2E, 0x8E, 0x1F, 0x2E, 0x01, 0x4E, 0xFD, 0x07, 0x49, 0xFF, 0x10, 
+    0x98, 0x99, 0x03, 0x01, 0x99, 0x9A, 0xFF, 0xF2, 0xD3, 0x02, 0x01, 0x00, 0x00, 0x01, 0x01, 
+    0x2B, 0x02, 0x1D, 0x1C, 0x02, 0x4C, 0x02, 0x4E, 0xFE, 0x22, 0x00, 0x5A, 0x99, 0x14, 0xFF, 
+    0xF0, 0xD3, 0x2B, 0x00, 0x2B, 0x2B, 0x02, 0x02, 0x29, 0x2B, 0x1C, 0x1A, 0x8B, 0xFF, 0x00, 
+    0xFF, 0x11, 0x9C, 0x00, 0x41, 0x9B, 0x9A, 0x5A, 0xFF, 0xF0, 0xD2, 0x02, 0x03, 0xFD, 0x07, 
+    0x03, 0x29, 0x28, 0x28, 0x19, 0x15, 0x70, 0x28, 0x2B, 0x4E, 0x9C, 0x00, 0x00, 0x00, 0x0B, 
+    0x02, 0x2D, 0x9B, 0x08, 0x9A, 0x03, 0x18, 0xFF, 0xF0, 0xD1, 0x9B, 0x04, 0x04, 0x04, 0x00, 
+    0x03, 0x03, 0x26, 0x28, 0x19, 0x18, 0x15, 0x5A, 0x00, 0xEE, 0x9C, 0x9B, 0x9C, 0x9C, 0x28, 
+    0x04, 0x24, 0x00, 0x09, 0x21, 0x99, 0x03, 0x03, 0x59, 0x9B, 0x9B, 0x01, 0xFF, 0xF0, 0xD1, 
+    0x9B, 0x9B, 0x05, 0x05, 0x05, 0x04, 0x04, 0x40, 0x24, 0x26, 0x18, 0x18, 0x15, 0x15, 0xFF, 
+    0x01, 0x03, 0x00, 0x15, 0x2B, 0x25, 0x15, 0x4C, 0x8C, 0x18, 0x04, 0x40, 0x04, 0x29, 0x9B, 
+    0x9A, 0x9C, 0xF5, 0xFE, 0xF0, 0xCF, 0x99, 0x00, 0x04, 0x05, 0x05, 0x23, 0x22, 0x22, 0x24, 
+    0x28, 0x00, 0xF5, 0x17, 0x03, 0x2B, 0xEE, 0x2B, 0x9C, 0x15, 0x00, 0x19, 0x28, 0x17, 0x4C, 
+    0xA6, 0xA8, 0x4E, 0x18, 0x24, 0x18, 0x03, 0x0A, 0x0C, 0x9C, 0x02, 0xFC, 0xF0, 0xCA, 0x9D, 
+    0x9B, 0x21, 0xE9, 0x06, 0x04, 0x24, 0x24, 0x25, 0xFF, 0x65, 0x18, 0x17, 0x00, 0x17, 0x2B, 
+    0x1A, 0x18, 0x4A, 0xA8, 0x4C, 0x8C, 0xF0, 0x1A, 0x1A, 0x03, 0x5A, 0x09, 0x18, 0x00, 0x10, 
+    0x0F, 0x46, 0x11, 0x06, 0xFF, 0x1A, 0x18, 0x05, 0x00, 0x1B, 0x05, 0x0F, 0x60, 0x03, 0x00, 
+    0x08, 0x20, 0x01, 0xF0, 0x08, 0x21, 0xB0, 0xE6, 0x04, 0x37, 0x10, 0x04, 0x10, 0x9A, 0x9A, 
+    0x05, 0x30, 0x0C, 0x00, 0x22, 0x10, 0xFF, 0x26, 0x20, 0x31, 0x50, 0x77, 0x40, 0x03, 0x30, 
+    0x4D, 0xA0, 0x04, 0x30, 0x00, 0x30, 0xA8, 0x56, 0x0F, 0x4C, 0x80, 0x94, 0x20, 0x21, 0x30, 
+    0x3C, 0x00, 0x98, 0x98, 0xC8, 0xC8, 0xC0, 0xC8, 0x98, 0x98, 0x98, 0x97, 0x97, 0x04, 0x00, 
+    0x00, 0xE0, 0x21, 0xCB, 0x30, 0x04, 0x25, 0x25, 0x13, 0xFF, 0x65, 0x02, 0x15, 0x00, 0x1A, 
+    0x2E, 0x15, 0x5A, 0xF6, 0x4C, 0x8C, 0x4F, 0x20, 0x19, 0x19, 0x03, 0x5A, 0x9C, 0x0A, 0x18, 
+    0x97, 0x96, 0x02, 0x95, 0x00, 0x00, 0xC4, 0xC4, 0xD6, 0xC4, 0xC5, 0xD6, 0x07, 0x04, 0x00, 
+    0x00, 0x00, 0x04, 0x00, 0xD6, 0xC5, 0xC5, 0xC4, 0xC5, 0x1C, 0xC4, 0xC2, 0x00, 0x50, 0x14, 
+    0x30, 0x00, 0x90, 0x96, 0x96, 0x96, 0x00, 0x97, 0x98, 0x99, 0xC8, 0x14, 0x04, 0x4A, 0x50, 
+    0x81, 0x0A, 0x00, 0x94, 0x07, 0x07, 0x96, 0x95, 0x92, 0x03, 0x00, 0x10, 0x93, 0x07, 0x97, 
+    0x97, 0x03, 0x00, 0x96, 0x93, 0x07, 0x00, 0x51, 0x95, 0x93, 0x21, 0x97, 0x97, 0x97, 0x95, 
+    0x08, 0x07, 0x98, 0x96, 0x18, 0x10, 0x91, 0x07, 0x07, 0x21, 0x02, 0x22, 0x00, 0x30, 0x07, 
+    0x07, 0x95, 0xFE, 0xC0, 0x08, 0x88, 0x93, 0x90, 0x08, 0x06, 0x10, 0x95, 0x07, 0x95, 0x08, 
+    0x00, 0x00, 0x94, 0x90, 0x95, 0x94, 0xFE, 0x90, 0x07, 0x07, 0x60, 0x91, 0xFE, 0x07, 0x96, 
+    0x91, 0x8F, 0x10, 0x04, 0x00, 0x50, 0x52, 0x93, 0xDF, 0x10, 0x98, 0x97, 0x9C, 0x20, 0xC2, 
+    0x9C, 0x00, 0xC5, 0x0E, 0xC5, 0xA0, 0x20, 0xA7, 0x00, 0x05, 0x20, 0xD6, 0xC3, 0xC4, 0xC3, 
+    0x0B, 0x18, 0x00, 0x00, 0x00, 0xC3, 0xA7, 0x60, 0xC1, 0xC1, 0xC1, 0xC2, 0x40, 0xC1, 0xC0, 
+    0xC0, 0xC3, 0x96, 0x96, 0xFD, 0x20, 0x15, 0x41, 0xE0, 0x00, 0x04, 0x25, 0x26, 0x26, 0x89, 
+    0xFF, 0x65, 0x18, 0x00, 0x19, 0x19, 0x2E, 0x02, 0x04, 0x5A, 0x4E, 0x4E, 0xE0, 0x19, 0x15, 
+    0x15, 0x2B, 0x18, 0x09, 0x0C, 0x02, 0x52, 0x00, 0x90, 0x05, 0x34, 0x01, 0x57, 0x21, 0x26, 
+    0xC9, 0x9A, 0x56, 0xC8, 0x9A, 0xF9, 0x05, 0x00, 0x9B, 0xC9, 0x0F, 0x00, 0x05, 0x00, 0x3B, 
+    0x1F, 0x04, 0x10, 0x03, 0x20, 0x01, 0x20, 0x20, 0x98, 0x98, 0x8C, 0x10, 0x13, 0x2B, 0x02, 
+    0x00, 0x52, 0x28, 0x28, 0x2B, 0x19, 0x07, 0x28, 0x8B, 0x00, 0x19, 0x10, 0x13, 0x03, 0x02, 
+    0x53, 0x28, 0x02, 0x00, 0x19, 0x22, 0x04, 0x5C, 0x5C, 0x53, 0x14, 0x59, 0x02, 0x18, 0x0C, 
+    0x20, 0x07, 0x28, 0x17, 0x9D, 0x51, 0x55, 0x02, 0x8C, 0xFF, 0x50, 0x21, 0x2B, 0x17, 0x19, 
+    0x51, 0x55, 0x80, 0x17, 0x07, 0x2B, 0x8A, 0x18, 0x51, 0x56, 0x2F, 0x00, 0x00, 0x52, 0x9C, 
+    0x2B, 0x19, 0x06, 0x03, 0x19, 0x1A, 0x00, 0x52, 0x56, 0x1B, 0x10, 0x86, 0x9C, 0xF5, 0x52, 
+    0x00, 0x9C, 0x02, 0x19, 0x19, 0x22, 0x9C, 0x19, 0x5C, 0x00, 0x55, 0x56, 0x99, 0x98, 0xC9, 
+    0x18, 0x15, 0x17, 0x80, 0x15, 0x9C, 0x15, 0x15, 0x03, 0x9B, 0x5A, 0xB6, 0x0D, 0x12, 0x5A, 
+    0x01, 0x00, 0x14, 0x59, 0x08, 0x00, 0x58, 0x15, 0x59, 0x08, 0x59, 0x63, 0x9A, 0xC7, 0x0D, 
+    0x14, 0x14, 0xCB, 0x15, 0x1C, 0x14, 0xCB, 0xD2, 0x28, 0xD9, 0x28, 0x00, 0x10, 0x3D, 0xCB, 
+    0x15, 0x40, 0x17, 0x4A, 0x4C, 0xAA, 0x4A, 0x4C, 0x04, 0x00, 0x2B, 0x40, 0x04, 0x26, 0x24, 
+    0x9A, 0x9A, 0x89, 0xFF, 0x65, 0x2B, 0x40, 0x18, 0x19, 0x1B, 0x01, 0x2B, 0x04, 0xFE, 0x0A, 
+    0x02, 0xF8, 0x02, 0x19, 0x17, 0x08, 0x5E, 0x57, 0x42, 0x0B, 0x43, 0x43, 0x10, 0x26, 0x07, 
+    0x95, 0x65, 0x00, 0x58, 0x7A, 0x10, 0x15, 0x70, 0x00, 0x14, 0x59, 0x0E, 0x10, 0x34, 0x15, 
+    0x14, 0x09, 0x10, 0x58, 0x09, 0x10, 0x86, 0x20, 0x59, 0x5A, 0x00, 0x25, 0x50, 0x50, 0x9D, 
+    0x13, 0x59, 0x02, 0x18, 0x00, 0x59, 0x2B, 0x2B, 0x5C, 0x1B, 0x58, 0x02, 0x8C, 0x00, 0x1A, 
+    0x13, 0x5A, 0x2B, 0x17, 0x5A, 0x2B, 0x1B, 0x20, 0x5C, 0x59, 0x02, 0x1A, 0x1C, 0xAC, 0x00, 
+    0x2B, 0x5C, 0x00, 0x15, 0x2B, 0x02, 0x1A, 0x58, 0x9D, 0x8B, 0x1A, 0x80, 0x13, 0x59, 0x1B, 
+    0x05, 0x23, 0x21, 0x07, 0x05, 0x02, 0x00, 0x21, 0x23, 0x02, 0x8C, 0x19, 0x58, 0x15, 0x8B, 
+    0x02, 0x13, 0x26, 0x00, 0x13, 0x15, 0x59, 0x02, 0x17, 0x63, 0x09, 0x22, 0x00, 0x13, 0x2B, 
+    0x3B, 0x00, 0x63, 0x2E, 0x13, 0x15, 0x44, 0x2B, 0x19, 0x31, 0x00, 0x8C, 0x8C, 0x14, 0x4B, 
+    0x00, 0x15, 0x30, 0x15, 0x51, 0x50, 0x54, 0xB4, 0x00, 0xF5, 0x00, 0x9C, 0x03, 0x80, 0x03, 
+    0x5A, 0x5A, 0x9C, 0x15, 0x5A, 0x17, 0xBD, 0x07, 0xF8, 0x9B, 0x9C, 0x03, 0x04, 0x00, 0xC8, 
+    0x08, 0x98, 0x10, 0xC2, 0x00, 0x8B, 0x00, 0x58, 0x18, 0x18, 0x5A, 0x11, 0x10, 0x5E, 0x00, 
+    0x24, 0xBD, 0x00, 0x9C, 0x20, 0x13, 0x89, 0x18, 0x4A, 0xAC, 0x00, 0x00, 0x4C, 0x4C, 0x00, 
+    0xA9, 0x03, 0x03, 0x04, 0x26, 0x5A, 0x5A, 0x57, 0x41, 0xFF, 0x85, 0x18, 0x1A, 0x2E, 0x02, 
+    0x8E, 0x00, 0x00, 0x9D, 0x04, 0x9D, 0x9C, 0xFD, 0x40, 0x9B, 0x15, 0x17, 0x89, 0x18, 0x0E, 
+    0x18, 0x2A, 0x02, 0x74, 0x43, 0x00, 0x30, 0x59, 0x9C, 0x63, 0x58, 0xF3, 0x73, 0x01, 0x25, 
+    0x0C, 0x58, 0x5A, 0x6E, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x08, 0x10, 0x1A, 0x59, 0xFE, 0x00, 
+    0x58, 0x06, 0x00, 0x05, 0x00, 0x5A, 0x53, 0x50, 0x00, 0xFE, 0xCD, 0x8A, 0x2E, 0xF6, 0x2B, 
+    0x8C, 0xCE, 0x02, 0xCE, 0x06, 0x00, 0x15, 0x1D, 0x1D, 0x2E, 0x1D, 0x2B, 0x00, 0x01, 0x1D, 
+    0x2B, 0x2E, 0x1D, 0x02, 0xF6, 0xF6, 0x00, 0x18, 0x5C, 0x8C, 0xF6, 0x02, 0x2E, 0x4F, 0x2B, 
+    0x00, 0x2E, 0x8C, 0x2B, 0x8C, 0xF6, 0x1D, 0x8E, 0x5A, 0x00, 0x1D, 0x04, 0x06, 0x07, 0x08, 
+    0x08, 0x08, 0x07, 0x00, 0x06, 0x04, 0x4F, 0x15, 0x8E, 0x1D, 0x8C, 0xF6, 0x00, 0x2B, 0x2B, 
+    0x2E, 0x5A, 0x19, 0x1B, 0x8C, 0x2B, 0x55, 0x3E, 0x00, 0xF6, 0x32, 0x00, 0xF6, 0x0C, 0x00, 
+    0x8A, 0x3E, 0x00, 0x1D, 0x00, 0x8E, 0x2B, 0xF6, 0xCE, 0xCE, 0x2B, 0x01, 0xF6, 0x80, 0x18, 
+    0x9D, 0x1A, 0x52, 0x52, 0x55, 0x18, 0x80, 0x00, 0x78, 0x5A, 0x18, 0x9B, 0xAB, 0x03, 0xFE, 
+    0x01, 0x03, 0x01, 0x00, 0x10, 0x03, 0x47, 0xC9, 0x0D, 0x14, 0x00, 0x01, 0x00, 0x5A, 0x18, 
+    0x9C, 0xA1, 0x00, 0x59, 0x01, 0xFF, 0x00, 0x5A, 0x03, 0x24, 0x54, 0x15, 0x5A, 0x18, 0x00, 
+    0x17, 0x24, 0x24, 0x28, 0x15, 0x56, 0x59, 0x1A, 0x02, 0x4C, 0xFE, 0x10, 0xEE, 0xEE, 0xA9, 
+    0x89, 0x89, 0xA9, 0x10, 0xED, 0xA9, 0xA9, 0x59, 0xFF, 0x65, 0x02, 0x9C, 0x2B, 0x80, 0x9C, 
+    0x9D, 0x1A, 0x2E, 0x2E, 0x2E, 0x9D, 0x49, 0x11, 0x02, 0x28, 0xF3, 0x10, 0x9B, 0x15, 0xAA, 
+    0x4E, 0x4E, 0x8E, 0xBC, 0x4F, 0x4D, 0x0D, 0x04, 0x00, 0xA0, 0x58, 0x00, 0xE1, 0x00, 0x5A, 
+    0x02, 0x12, 0xFE, 0x59, 0xEE, 0x00, 0xF8, 0x10, 0xF4, 0x01, 0x79, 0x12, 0x16, 0x00, 0x08, 
+    0x11, 0x1C, 0x00, 0x80, 0x55, 0x10, 0x10, 0x19, 0x9A, 0x02, 0x2B, 0x02, 0x00, 0x20, 0x2B, 
+    0x26, 0x02, 0x2B, 0x04, 0x02, 0x50, 0x28, 0xF5, 0x12, 0x18, 0x05, 0x00, 0x03, 0x02, 0x05, 
+    0x00, 0x5C, 0x26, 0xF5, 0x01, 0x1E, 0x10, 0x8E, 0x1D, 0x59, 0x8C, 0x03, 0x51, 0xA0, 0x00, 
+    0x87, 0xA5, 0xA7, 0xA0, 0x52, 0x03, 0x5C, 0x59, 0x14, 0x8E, 0x1D, 0x90, 0x05, 0x26, 0x02, 
+    0x00, 0x18, 0x2B, 0x04, 0x90, 0x5A, 0x02, 0x04, 0x2B, 0x05, 0x10, 0x28, 0x2B, 0x08, 0x00, 
+    0x01, 0x05, 0x40, 0x02, 0x04, 0x02, 0xF5, 0x04, 0x2B, 0x5C, 0x98, 0x55, 0x55, 0x59, 0xD9, 
+    0x00, 0xF7, 0x01, 0x9B, 0x03, 0xED, 0x01, 0x3F, 0xF3, 0x00, 0x7B, 0x10, 0x82, 0x31, 0xFA, 
+    0x00, 0x00, 0x20, 0x06, 0x20, 0x5A, 0x18, 0x00, 0x03, 0x02, 0x9B, 0x99, 0x4C, 0x49, 0x48, 
+    0x49, 0x00, 0x4C, 0x17, 0x99, 0x04, 0x14, 0x13, 0x5A, 0x5C, 0x01, 0xFF, 0x00, 0x4B, 0xEE, 
+    0xEE, 0x4B, 0x89, 0x8B, 0xA9, 0x00, 0x22, 0x24, 0x5A, 0x5A, 0x19, 0x25, 0x26, 0x04, 0x80, 
+    0x03, 0x4F, 0x18, 0x03, 0x2B, 0x4E, 0x02, 0x2E, 0x10, 0xE8, 0x15, 0x5A, 0x19, 0x56, 0x00, 
+    0x5A, 0x0F, 0x02, 0xDE, 0x00, 0x34, 0x01, 0xC0, 0x4C, 0x00, 0x2E, 0x4C, 0x4E, 0x4D, 0x0E, 
+    0x30, 0x17, 0x00, 0xDD, 0xF3, 0x20, 0x59, 0x70, 0x03, 0x05, 0x00, 0x6E, 0x10, 0x5A, 0x02, 
+    0x00, 0xEF, 0x20, 0x3F, 0xFA, 0x00, 0xFC, 0x21, 0xFF, 0x12, 0x06, 0x20, 0x8F, 0x11, 0xC6, 
+    0x01, 0x02, 0x15, 0x00, 0x2E, 0x5C, 0x5C, 0x18, 0x8C, 0x2E, 0x2B, 0x2E, 0x04, 0x2E, 0x17, 
+    0x02, 0x10, 0xF6, 0x17, 0x2E, 0x4F, 0x5A, 0x00, 0x1A, 0x01, 0x5A, 0xF6, 0x4F, 0x18, 0x1A, 
+    0x02, 0x01, 0x1E, 0x20, 0x1A, 0x15, 0x18, 0x56, 0x5A, 0x8C, 0x54, 0x00, 0x83, 0x8E, 0x47, 
+    0x8E, 0x83, 0x55, 0x15, 0x5A, 0x04, 0x56, 0x5A, 0x12, 0x00, 0x2E, 0x17, 0x2B, 0xF6, 0x2B, 
+    0x50, 0x9C, 0x5C, 0x15, 0x1D, 0x2E, 0x00, 0x19, 0x05, 0x00, 0x5A, 0x09, 0x37, 0x10, 0xF6, 
+    0x15, 0x0E, 0x02, 0x2E, 0x1D, 0x1D, 0x18, 0x40, 0x1A, 0xF6, 0x5A, 0x02, 0x2E, 0x59, 0xFE, 
+    0x00, 0x9C, 0xE2, 0x17, 0xFE, 0x00, 0x9B, 0x9C, 0x15, 0xF2, 0x11, 0xB3, 0x0E, 0x01, 0x00, 
+    0x19, 0x00, 0x21, 0x59, 0x17, 0xFB, 0x20, 0x05, 0x31, 0x9C, 0x9C, 0x02, 0x01, 0x4A, 0x01, 
+    0x4A, 0x45, 0x41, 0xE9, 0xA9, 0x4A, 0x5A, 0x00, 0x9A, 0x58, 0x57, 0x59, 0x19, 0x4C, 0x4E, 
+    0xAC, 0x00, 0xEE, 0x4B, 0x4C, 0xAA, 0x8A, 0x49, 0x22, 0x0B, 0x10, 0x09, 0x07, 0x07, 0x17, 
+    0xA8, 0x00, 0x04, 0x1A, 0x18, 0xC0, 0x17, 0x2B, 0xEE, 0x4F, 0x4E, 0x4E, 0x02, 0x00, 0x03, 
+    0x10, 0x0C, 0xEE, 0xEE, 0x03, 0x00, 0x02, 0x40, 0x1D, 0x8A, 0x89, 0x49, 0x18, 0x48, 0x1B, 
+    0x4E, 0x1D, 0x00, 0x20, 0x10, 0x4C, 0xAA, 0xAA, 0xD0, 0xA9, 0xA9, 0x89, 0x9B, 0x68, 0x21, 
+    0x9C, 0x03, 0x02, 0xFE, 0x10, 0x07, 0x03, 0x71, 0x01, 0x40, 0x15, 0x23, 0x58, 0x18, 0xAA, 
+    0xAA, 0x1D, 0x10, 0x5C, 0x8E, 0x1D, 0xBD, 0x4F, 0x03, 0x02, 0x8E, 0x1D, 0x86, 0x2E, 0x02, 
+    0x50, 0x0F, 0x00, 0x2E, 0x1D, 0x8E, 0x2E, 0x14, 0x10, 0x04, 0x8E, 0x1C, 0x11, 0x10, 0x8E, 
+    0x14, 0x53, 0x51, 0x59, 0x00, 0x8E, 0x56, 0x43, 0x48, 0x42, 0x47, 0x42, 0x59, 0x00, 0x02, 
+    0x59, 0x52, 0x53, 0x59, 0xF6, 0x4F, 0xF6, 0x00, 0x02, 0x1D, 0x8E, 0x19, 0x8E, 0xF6, 0xBD, 
+    0x8E, 0x34, 0x1D, 0x02, 0x05, 0x10, 0x4F, 0x40, 0x30, 0x3A, 0x00, 0xF5, 0x8E, 0x86, 0x1D, 
+    0x06, 0x00, 0x0F, 0x00, 0x8E, 0xAA, 0x18, 0x8A, 0x94, 0x11, 0xF0, 0x9C, 0x9B, 0x5A, 0x2B, 
+    0xAA, 0x04, 0xFF, 0x20, 0x8F, 0x20, 0x98, 0x10, 0x06, 0x15, 0xF5, 0x12, 0x03, 0x32, 0x2B, 
+    0x18, 0x18, 0x02, 0x02, 0x00, 0x9B, 0x4C, 0x4C, 0x44, 0xE8, 0x44, 0x49, 0x4C, 0x20, 0x4C, 
+    0x9A, 0x56, 0x56, 0x63, 0xFF, 0x10, 0x4C, 0x4B, 0x80, 0x4B, 0x8B, 0x8A, 0xAA, 0x22, 0x07, 
+    0x06, 0xFF, 0x04, 0x10, 0x18, 0x5A, 0x26, 0x55, 0xFA, 0x01, 0x17, 0x4E, 0x4F, 0x16, 0x4F, 
+    0xF0, 0x20, 0x01, 0x00, 0xEE, 0x09, 0x80, 0x4F, 0x4E, 0xEC, 0x58, 0xEC, 0xED, 0x4F, 0x11, 
+    0x10, 0x01, 0x10, 0x4C, 0x00, 0x11, 0xA8, 0xF3, 0xFF, 0x02, 0x01, 0x60, 0x58, 0x17, 0x00, 
+    0x01, 0x02, 0x30, 0x01, 0x82, 0x0C, 0x00, 0x79, 0x46, 0x02, 0x4F, 0x01, 0xEC, 0x20, 0xF0, 
+    0x40, 0x05, 0x40, 0x08, 0x60, 0xF6, 0x06, 0x4F, 0x0E, 0x20, 0x13, 0x04, 0xBC, 0x8E, 0x1D, 
+    0x5C, 0x13, 0x00, 0x49, 0x47, 0x49, 0xA7, 0x18, 0x2E, 0x1D, 0xBC, 0x48, 0xBC, 0x8C, 0x1A, 
+    0x16, 0x21, 0xBD, 0xCE, 0x05, 0x10, 0xF5, 0x38, 0x8E, 0xF6, 0x8C, 0x3A, 0x90, 0x4D, 0x01, 
+    0x47, 0x31, 0x9D, 0x17, 0xD2, 0x9D, 0x91, 0x12, 0x9B, 0x5A, 0xB5, 0x03, 0x59, 0xFE, 0x23, 
+    0x82, 0x22, 0x63, 0x82, 0x10, 0x8F, 0x01, 0x9B, 0x5A, 0x17, 0x00, 0x31, 0xFF, 0x00, 0x2B, 
+    0x80, 0x9C, 0x9C, 0x4C, 0x4C, 0x47, 0x45, 0x48, 0xF4, 0x05, 0x18, 0x9A, 0x14, 0x13, 0xFF, 
+    0x11, 0xFE, 0x00, 0xAA, 0x8A, 0x15, 0x10, 0x57, 0x17, 0x89, 0xED, 0xDB, 0x00, 0x5A, 0x57, 
+    0x53, 0xF1, 0xFF, 0x00, 0x63, 0x2B, 0xEE, 0xF5, 0x01, 0x01, 0x10, 0x02, 0x30, 0x09, 0x70, 
+    0x38, 0x4E, 0xED, 0xED, 0x04, 0x01, 0x11, 0x30, 0x00, 0x31, 0xA8, 0x9B, 0xFE, 0x58, 0x69, 
+    0x12, 0x02, 0x20, 0xEE, 0x00, 0x84, 0x16, 0xF5, 0x21, 0x06, 0x31, 0x08, 0x20, 0xF9, 0x20, 
+    0x24, 0x18, 0x5A, 0x57, 0x01, 0xFD, 0x02, 0x03, 0x10, 0x01, 0x20, 0x07, 0x10, 0x19, 0x00, 
+    0x10, 0xF5, 0x1A, 0x04, 0x50, 0x0D, 0x20, 0x5C, 0x1B, 0x5C, 0x14, 0xF5, 0x19, 0xD8, 0x06, 
+    0x19, 0x81, 0x07, 0x19, 0x19, 0x9D, 0xC1, 0x07, 0x00, 0x5C, 0x18, 0x02, 0x18, 0x1A, 0x0C, 
+    0x10, 0x09, 0x00, 0xFE, 0x19, 0x38, 0x40, 0x11, 0x00, 0x08, 0x20, 0x46, 0x40, 0xFC, 0x11, 
+    0xF2, 0x01, 0xF5, 0x00, 0x66, 0x03, 0x00, 0x03, 0x89, 0x23, 0x15, 0x59, 0x96, 0x05, 0x83, 
+    0x00, 0x9C, 0x1D, 0x15, 0x02, 0x59, 0x19, 0x00, 0xFF, 0x10, 0x0A, 0x03, 0x02, 0x02, 0x5A, 
+    0x00, 0x18, 0x4F, 0x49, 0x4A, 0x4A, 0x4C, 0x4E, 0x17, 0x06, 0x04, 0x25, 0x02, 0xFF, 0x30, 
+    0xEE, 0x5A, 0x56, 0x9A, 0x15, 0x82, 0xAA, 0xFF, 0x10, 0x55, 0x53, 0x51, 0x56, 0x02, 0x06, 
+    0x0E, 0xEB, 0xF7, 0x12, 0x01, 0xF0, 0x01, 0x4C, 0x11, 0x03, 0x4D, 0x0D, 0x31, 0x03, 0x22, 
+    0x00, 0x01, 0xFE, 0xA8, 0x72, 0x03, 0x6A, 0x34, 0xEF, 0x44, 0x0D, 0x11, 0xFA, 0x20, 0x7D, 
+    0x24, 0x02, 0x20, 0xF1, 0x11, 0x21, 0x18, 0x5A, 0x17, 0x87, 0x15, 0x8D, 0x15, 0x01, 0x30, 
+    0x04, 0x10, 0x0F, 0x00, 0x20, 0xD4, 0x00, 0x00, 0x60, 0xC9, 0x01, 0x19, 0x17, 0x9D, 0x8B, 
+    0xE1, 0x07, 0x10, 0x8A, 0x5A, 0x5A, 0x8A, 0x26, 0x10, 0xC2, 0x25, 0x0B, 0x10, 0xBB, 0x06, 
+    0x20, 0x3B, 0x60, 0x19, 0x01, 0x00, 0xCF, 0x15, 0x03, 0x00, 0x9D, 0x8F, 0x14, 0xF8, 0x15, 
+    0x9C, 0x63, 0x71, 0x00, 0xEC, 0x16, 0x8C, 0x30, 0x05, 0x10, 0xFE, 0x20, 0x0F, 0x10, 0x14, 
+    0x0B, 0x00, 0xFC, 0x00, 0x02, 0x12, 0x02, 0x9C, 0x15, 0x4C, 0xB0, 0x4D, 0x4C, 0x4C, 0x4D, 
+    0xD5, 0x0B, 0x34, 0x00, 0x5C, 0xD1, 0x00, 0x80, 0x4B, 0x4B, 0x8A, 0x89, 0x15, 0x56, 0x99, 
+    0x03, 0x10, 0x72, 0x23, 0xD5, 0x07, 0x89, 0xBD, 0xFF, 0x04, 0xFF, 0x51, 0x01, 0xC0, 0x8C, 
+    0x60, 0x4C, 0x8A, 0x8A, 0x8B, 0x4C, 0x0B, 0x30, 0x00, 0x11, 0x4C, 0x78, 0x1B, 0xAA, 0xA9, 
+    0xFF, 0x22, 0x6D, 0x10, 0xF1, 0x00, 0xE9, 0x14, 0x5A, 0xFE, 0x18, 0x08, 0x12, 0x05, 0x22, 
+    0xF7, 0x20, 0x05, 0x42, 0x20, 0x43, 0x25, 0x18, 0x1F, 0x20, 0xFE, 0x63, 0x2C, 0x24, 0xD3, 
+    0x30, 0xA0, 0x30, 0x37, 0x21, 0xBC, 0x15, 0x5D, 0x55, 0x78, 0x05, 0xBF, 0xC4, 0x44, 0x57, 
+    0x47, 0x54, 0x57, 0x2C, 0x50, 0xDD, 0x22, 0x02, 0x30, 0x9C, 0x29, 0x40, 0xF6, 0x03, 0x86, 
+    0x10, 0x0C, 0x20, 0x63, 0xFA, 0x03, 0x61, 0x30, 0x30, 0x21, 0x2C, 0x10, 0x11, 0xFF, 0x20, 
+    0x02, 0x18, 0x58, 0x08, 0x11, 0x56, 0x18, 0x2B, 0x03, 0x19, 0x00, 0xFF, 0x10, 0x4C, 0x8C, 
+    0x8B, 0x89, 0x15, 0x12, 0x12, 0x55, 0x03, 0x10, 0x55, 0x55, 0xFF, 0x00, 0x02, 0x18, 0x03, 
+    0x14, 0x5A, 0x4B, 0xFF, 0x81, 0x8C, 0x09, 0x70, 0x8A, 0x89, 0x17, 0x38, 0x17, 0x89, 0x8A, 
+    0x06, 0x07, 0x01, 0x02, 0x04, 0x30, 0x4C, 0xA9, 0xFE, 0x9B, 0xFC, 0x00, 0x7D, 0x22, 0xE8, 
+    0x32, 0xD3, 0x11, 0x05, 0x66, 0xE2, 0x10, 0xFC, 0x00, 0x5F, 0x13, 0x39, 0x23, 0x05, 0x24, 
+    0x52, 0x22, 0x55, 0xFE, 0x10, 0x9C, 0x74, 0x05, 0x15, 0xFF, 0xB5, 0x03, 0xFE, 0x40, 0x07, 
+    0x20, 0xF4, 0x61, 0xE9, 0x21, 0xD1, 0x12, 0x55, 0x18, 0x02, 0x21, 0xBF, 0x03, 0x00, 0xEA, 
+    0x30, 0x59, 0x10, 0x4D, 0x20, 0x1E, 0x00, 0x35, 0x00, 0x63, 0x5B, 0x10, 0xE2, 0x5A, 0x5F, 
+    0x09, 0x14, 0x9C, 0x5A, 0x0B, 0x20, 0x12, 0x10, 0x2F, 0x52, 0x17, 0x01, 0x31, 0x00, 0x11, 
+    0xFF, 0x00, 0x02, 0xC1, 0x18, 0x9B, 0x2B, 0x2B, 0x1A, 0x02, 0x15, 0x04, 0x1A, 0xFF, 0x10, 
+    0xFE, 0x00, 0x13, 0x57, 0x12, 0x01, 0x03, 0x10, 0x12, 0x12, 0x9A, 0x9A, 0x88, 0x02, 0x18, 
+    0xD0, 0x29, 0x18, 0xED, 0x4C, 0x00, 0x60, 0x8C, 0x09, 0x80, 0x8F, 0x22, 0x6C, 0x89, 0x8A, 
+    0x14, 0x60, 0x12, 0x01, 0xA9, 0xAB, 0x41, 0xB6, 0x41, 0x9C, 0xFF, 0xD3, 0x32, 0xF8, 0x21, 
+    0xFF, 0x52, 0x86, 0x2A, 0x18, 0x38, 0x89, 0x09, 0x24, 0x14, 0x1C, 0x50, 0xFD, 0xFD, 0x31, 
+    0x18, 0x32, 0x55, 0x3E, 0x26, 0x43, 0x11, 0xCE, 0x12, 0x02, 0x31, 0xB9, 0x20, 0xF9, 0xD6, 
+    0x01, 0x2B, 0x9B, 0xCB, 0x35, 0x45, 0x30, 0x27, 0x22, 0x3F, 0x21, 0xF7, 0x22, 0xE6, 0x59, 
+    0xF1, 0x01, 0x3D, 0x41, 0x58, 0x03, 0x91, 0x09, 0x68, 0x20, 0x8A, 0x2A, 0x57, 0x2E, 0x63, 
+    0xFD, 0x27, 0x02, 0x02, 0x17, 0xF7, 0x00, 0x9C, 0x85, 0x08, 0x02, 0x83, 0x09, 0x05, 0x18, 
+    0x00, 0x4C, 0x4C, 0xEE, 0x4C, 0xAA, 0xFF, 0x00, 0x08, 0x57, 0x14, 0x13, 0x03, 0x10, 0x13, 
+    0x57, 0x13, 0x13, 0xE1, 0xFF, 0x01, 0x18, 0x89, 0xED, 0xAA, 0x00, 0x50, 0xE2, 0x04, 0x09, 
+    0x70, 0x2C, 0x89, 0x8B, 0x01, 0x10, 0x10, 0x50, 0xA9, 0x04, 0x10, 0xA8, 0xA9, 0x06, 0xA9, 
+    0x02, 0x10, 0x03, 0x00, 0x17, 0xA9, 0xA9, 0xA9, 0x5C, 0xEA, 0x19, 0x98, 0x04, 0x1A, 0x00, 
+    0x00, 0x18, 0x15, 0x00, 0x01, 0x30, 0x02, 0x00, 0xF8, 0x88, 0xA9, 0xA9, 0xAF, 0x03, 0xE2, 
+    0x53, 0x26, 0x00, 0x16, 0x10, 0x04, 0x00, 0xC6, 0x17, 0x44, 0x10, 0x45, 0x00, 0xA8, 0x17, 
+    0xA9, 0x1E, 0xB0, 0x00, 0x40, 0x0B, 0x51, 0x00, 0x02, 0x00, 0x8B, 0x2D, 0x10, 0x5A, 0x19, 
+    0x1A, 0x19, 0x87, 0x93, 0x0E, 0x05, 0x05, 0x32, 0x10, 0x17, 0xA9, 0xAA, 0xA9, 0x28, 0x60, 
+    0x9B, 0x4B, 0x20, 0x0B, 0x70, 0x5A, 0x3F, 0x04, 0xF3, 0x17, 0x17, 0x19, 0x10, 0x10, 0xF3, 
+    0xAC, 0x50, 0x80, 0x07, 0xAA, 0x17, 0x39, 0x10, 0xC7, 0x10, 0x5A, 0x10, 0xBD, 0x00, 0xD9, 
+    0x01, 0x00, 0x4A, 0x4B, 0x00, 0x00, 0x0F, 0x10, 0x88, 0x39, 0x00, 0x03, 0x00, 0x00, 0xA8, 
+    0xA7, 0xA7, 0xED, 0x02, 0x18, 0x17, 0xA8, 0xFC, 0x4B, 0x4F, 0xE6, 0x05, 0x00, 0x30, 0xF5, 
+    0x16, 0x09, 0x50, 0x05, 0x56, 0x0C, 0x30, 0xFB, 0x06, 0x34, 0x09, 0x14, 0xAC, 0x20, 0x30, 
+    0x29, 0x10, 0x02, 0x10, 0x00, 0x10, 0x22, 0x25, 0x7D, 0x30, 0x20, 0xAC, 0x3F, 0x36, 0x47, 
+    0x56, 0x3D, 0x58, 0x03, 0x10, 0x00, 0x20, 0x4D, 0xFF, 0x5F, 0x68, 0x52, 0x10, 0x31, 0x30, 
+    0x01, 0x30, 0x00, 0x60, 0x2B, 0x30, 0x78, 0x30, 0x58, 0x70, 0x77, 0x9A, 0x10, 0x26, 0x20, 
+    0x02, 0x00, 0xEE, 0x09, 0x20, 0x05, 0x10, 0x68, 0x90, 0xAC, 0xF5, 0x63, 0x30, 0x4D, 0x98, 
+    0x20, 0x4F, 0x9F, 0x20, 0x76, 0x50, 0x7E, 0x60, 0x59, 0x30, 0x01, 0x53, 0x30, 0x4E, 0x18, 
+    0x15, 0x14, 0x57, 0x48, 0x17, 0x00, 0xA8, 0xED, 0x4F
 };
 
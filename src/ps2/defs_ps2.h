@@ -13,7 +13,21 @@
 #ifndef DEFS_PS2_H
 #define DEFS_PS2_H
 
+#ifdef _EE
 #include <tamtypes.h>
+#else
+// Host builds of the tools and the VU reference code don't have the PS2DEV SDK.
+typedef unsigned char      u8;
+typedef unsigned short     u16;
+typedef unsigned int       u32;
+typedef unsigned long long u64;
+typedef unsigned __int128  u128;
+typedef signed char        s8;
+typedef signed short       s16;
+typedef signed int         s32;
+typedef signed long long   s64;
+typedef __int128           s128;
+#endif // _EE
 
 // Shorthand for the awfully verbose GCC attribute...
 #define PS2_ALIGN(alignment) __attribute__((aligned(alignment)))
@@ -119,4 +133,35 @@ enum
 #define PS2_PACKED_XYZ2(X, Y, Z, ADC) ((PS2_AS_U128(ADC) << 111) | (PS2_AS_U128(Z) << 64) | (PS2_AS_U128(Y) << 32) | (PS2_AS_U128(X)))
 #define PS2_PACKED_RGBA(R, G, B, A) ((PS2_AS_U128(A) << 96) | (PS2_AS_U128(B) << 64) | (PS2_AS_U128(G) << 32) | (PS2_AS_U128(R)))
 
+//
+// Where palette entry INDEX goes in a 256 color CLUT uploaded for a PSMT8
+// texture with CSM1: bits 3 and 4 of the index are swapped, so entries
+// 8-15 and 16-23 of every 32 trade places.
+//
+#define PS2_GS_CLUT_CSM1_INDEX(INDEX) (((INDEX) & 0xE7) | (((INDEX) & 0x08) << 1) | (((INDEX) & 0x10) >> 1))
+
+//
+// EE core clock. The COP0 Count register goes up once per CPU cycle, so it
+// times things well under the millisecond resolution of Sys_Milliseconds.
+// It wraps every ~14.5 seconds; differences of two reads are still fine.
+//
+#define PS2_EE_CLOCK_HZ 294912000
+
+#ifdef _EE
+static inline u32 PS2_CpuCycles(void)
+{
+    u32 count;
+    __asm__ volatile ("mfc0 %0, $9" : "=r"(count));
+    return count;
+}
+
+static inline int PS2_CyclesToMicrosec(u32 cycles)
+{
+    return (int)(cycles / (PS2_EE_CLOCK_HZ / 1000000));
+}
+#endif // _EE
+
+// One-At-a-Time hash of a name, to compare names by hash code (sys_ps2.c).
+u32 Sys_HashString(const char * str);
+
 #endif // DEFS_PS2_H
@@ -0,0 +1,162 @@
+
+/* ================================================================================================
+ * -*- C -*-
+ * File: ent_xform.c
+ * Brief: Entity placement in the world (origin + angles) as a model
+ *        matrix, plus the bounds and point transforms that go with it.
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#include "ps2/ent_xform.h"
+
+/*
+================
+PS2_EntXformSet
+================
+*/
+void PS2_EntXformSet(ps2_ent_xform_t * xform, const vec3_t origin, const vec3_t angles)
+{
+    VectorCopy(origin, xform->origin);
+    xform->rotated = (angles[0] != 0.0f || angles[1] != 0.0f || angles[2] != 0.0f);
+
+    if (xform->rotated)
+    {
+        vec3_t right;
+        AngleVectors(angles, xform->axis[0], right, xform->axis[2]);
+        VectorNegate(right, xform->axis[1]);
+    }
+    else
+    {
+        VectorSet(xform->axis[0], 1.0f, 0.0f, 0.0f);
+        VectorSet(xform->axis[1], 0.0f, 1.0f, 0.0f);
+        VectorSet(xform->axis[2], 0.0f, 0.0f, 1.0f);
+    }
+}
+
+/*
+================
+PS2_EntXformMatrix
+================
+*/
+void PS2_EntXformMatrix(m_mat4_t * m, const ps2_ent_xform_t * xform)
+{
+    int i;
+    for (i = 0; i < 3; ++i)
+    {
+        m->m[i][0] = xform->axis[i][0];
+        m->m[i][1] = xform->axis[i][1];
+        m->m[i][2] = xform->axis[i][2];
+        m->m[i][3] = 0.0f;
+    }
+
+    m->m[3][0] = xform->origin[0];
+    m->m[3][1] = xform->origin[1];
+    m->m[3][2] = xform->origin[2];
+    m->m[3][3] = 1.0f;
+}
+
+/*
+================
+PS2_EntXformBounds
+================
+*/
+void PS2_EntXformBounds(const ps2_ent_xform_t * xform, const vec3_t mins, const vec3_t maxs,
+                        vec3_t out_mins, vec3_t out_maxs)
+{
+    int i, j;
+
+    if (!xform->rotated)
+    {
+        VectorAdd(mins, xform->origin, out_mins);
+        VectorAdd(maxs, xform->origin, out_maxs);
+        return;
+    }
+
+    // Center goes through the full transform, the half
+    // extents through the absolute value of the rotation.
+    vec3_t center, extents;
+    for (j = 0; j < 3; ++j)
+    {
+        center[j]  = (mins[j] + maxs[j]) * 0.5f;
+        extents[j] = (maxs[j] - mins[j]) * 0.5f;
+    }
+
+    for (i = 0; i < 3; ++i)
+    {
+        float c = xform->origin[i];
+        float e = 0.0f;
+        for (j = 0; j < 3; ++j)
+        {
+            const float a = xform->axis[j][i];
+            c += a * center[j];
+            e += ((a < 0.0f) ? -a : a) * extents[j];
+        }
+        out_mins[i] = c - e;
+        out_maxs[i] = c + e;
+    }
+}
+
+/*
+================
+PS2_EntXformPointToModel
+================
+*/
+void PS2_EntXformPointToModel(const ps2_ent_xform_t * xform, const vec3_t point, vec3_t out)
+{
+    vec3_t delta;
+    VectorSubtract(point, xform->origin, delta);
+
+    if (!xform->rotated)
+    {
+        VectorCopy(delta, out);
+        return;
+    }
+
+    // Axes are orthonormal, so the inverse rotation is the transpose.
+    out[0] = DotProduct(delta, xform->axis[0]);
+    out[1] = DotProduct(delta, xform->axis[1]);
+    out[2] = DotProduct(delta, xform->axis[2]);
+}
+
+/*
+================
+PS2_EntXformCompare
+================
+*/
+int PS2_EntXformCompare(const ps2_ent_xform_t * a, const ps2_ent_xform_t * b)
+{
+    int i;
+
+    if (a->rotated != b->rotated)
+    {
+        return a->rotated ? 1 : -1; // Unrotated first
+    }
+
+    const float * fa = a->origin;
+    const float * fb = b->origin;
+    for (i = 0; i < 3; ++i)
+    {
+        if (fa[i] != fb[i])
+        {
+            return (fa[i] < fb[i]) ? -1 : 1;
+        }
+    }
+
+    if (!a->rotated)
+    {
+        return 0;
+    }
+
+    fa = &a->axis[0][0];
+    fb = &b->axis[0][0];
+    for (i = 0; i < 9; ++i)
+    {
+        if (fa[i] != fb[i])
+        {
+            return (fa[i] < fb[i]) ? -1 : 1;
+        }
+    }
+    return 0;
+}
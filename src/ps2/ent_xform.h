@@ -0,0 +1,49 @@
+/* ================================================================================================
+ * -*- C -*-
+ * File: ent_xform.h
+ * Brief: Entity placement in the world (origin + angles) as a model
+ *        matrix, plus the bounds and point transforms that go with it.
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#ifndef PS2_ENT_XFORM_H
+#define PS2_ENT_XFORM_H
+
+#include "game/q_shared.h"
+#include "ps2/vec_mat.h"
+
+//
+// Model to world, same as R_DrawBrushModel in ref_gl (R_RotateForEntity
+// with pitch and roll negated): the model X axis goes forward, Y to the
+// left and Z up, as AngleVectors gives them, then the origin is added.
+// Entities with all angles zero skip the rotation ('rotated' is false),
+// which is also what lets brush models placed the same way share batches.
+//
+typedef struct
+{
+    vec3_t origin;
+    vec3_t axis[3]; // Forward, left and up, in world space
+    qboolean rotated;
+} ps2_ent_xform_t;
+
+// Builds the transform from the entity origin and angles (AngleVectors).
+void PS2_EntXformSet(ps2_ent_xform_t * xform, const vec3_t origin, const vec3_t angles);
+
+// Row-major model matrix for Mat4_Multiply with the view-projection.
+void PS2_EntXformMatrix(m_mat4_t * m, const ps2_ent_xform_t * xform);
+
+// Smallest world space box around the model space box once transformed.
+// Tighter than the origin +/- radius box ref_gl uses for rotated models.
+void PS2_EntXformBounds(const ps2_ent_xform_t * xform, const vec3_t mins, const vec3_t maxs,
+                        vec3_t out_mins, vec3_t out_maxs);
+
+// World space point to model space (i.e. the inverse transform).
+void PS2_EntXformPointToModel(const ps2_ent_xform_t * xform, const vec3_t point, vec3_t out);
+
+// Orders transforms so that equal ones end up next to each other
+// when sorted. Zero if both place the model exactly the same way.
+int PS2_EntXformCompare(const ps2_ent_xform_t * a, const ps2_ent_xform_t * b);
+
+#endif // PS2_ENT_XFORM_H
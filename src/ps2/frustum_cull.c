@@ -0,0 +1,266 @@
+
+/* ================================================================================================
+ * -*- C -*-
+ * File: frustum_cull.c
+ * Brief: Bounding box vs view frustum tests, one box at a time or
+ *        in batches of 4 (VU0 macro mode on the PS2, SSE on the host).
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#include "ps2/frustum_cull.h"
+
+#if !defined(_EE) && defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+/*
+================
+PS2_FrustumSetPlanes
+================
+*/
+void PS2_FrustumSetPlanes(ps2_frustum_t * frustum, const cplane_t planes[PS2_FRUSTUM_PLANES])
+{
+    int p, j;
+    for (p = 0; p < PS2_FRUSTUM_PLANES; ++p)
+    {
+        float pos[3], neg[3];
+        for (j = 0; j < 3; ++j)
+        {
+            const float n = planes[p].normal[j];
+            frustum->normals[p][j] = n;
+            pos[j] = (n > 0.0f) ? n : 0.0f;
+            neg[j] = (n < 0.0f) ? n : 0.0f;
+        }
+
+        frustum->dists[p]    = planes[p].dist;
+        frustum->signbits[p] = planes[p].signbits;
+
+        frustum->pos_weights[p].x = pos[0];
+        frustum->pos_weights[p].y = pos[1];
+        frustum->pos_weights[p].z = pos[2];
+        frustum->pos_weights[p].w = planes[p].dist;
+
+        frustum->neg_weights[p].x = neg[0];
+        frustum->neg_weights[p].y = neg[1];
+        frustum->neg_weights[p].z = neg[2];
+        frustum->neg_weights[p].w = 0.0f;
+    }
+}
+
+/*
+================
+PS2_CullBlockSetBox
+================
+*/
+void PS2_CullBlockSetBox(ps2_cull_block_t * blocks, int index, const float * mins, const float * maxs)
+{
+    int j;
+    ps2_cull_block_t * block = &blocks[index >> 2];
+    const int box = index & 3;
+
+    for (j = 0; j < 3; ++j)
+    {
+        block->mins[j][box] = mins[j];
+        block->maxs[j][box] = maxs[j];
+    }
+}
+
+/*
+================
+PS2_FrustumCullBox
+================
+*/
+qboolean PS2_FrustumCullBox(const ps2_frustum_t * frustum, const float * mins, const float * maxs)
+{
+    int p;
+    for (p = 0; p < PS2_FRUSTUM_PLANES; ++p)
+    {
+        // Corner furthest along the normal, as BoxOnPlaneSide's dist1.
+        const int bits = frustum->signbits[p];
+        const float * n = frustum->normals[p];
+        const float x = (bits & 1) ? mins[0] : maxs[0];
+        const float y = (bits & 2) ? mins[1] : maxs[1];
+        const float z = (bits & 4) ? mins[2] : maxs[2];
+        const float dist = n[0] * x + n[1] * y + n[2] * z;
+
+        if (dist < frustum->dists[p])
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+================
+PS2_FrustumCullBlocksRef
+================
+*/
+void PS2_FrustumCullBlocksRef(const ps2_frustum_t * frustum, const ps2_cull_block_t * blocks, int num_blocks, byte * culled)
+{
+    int b, box, j;
+    for (b = 0; b < num_blocks; ++b, ++blocks)
+    {
+        for (box = 0; box < 4; ++box)
+        {
+            float mins[3], maxs[3];
+            for (j = 0; j < 3; ++j)
+            {
+                mins[j] = blocks->mins[j][box];
+                maxs[j] = blocks->maxs[j][box];
+            }
+            *culled++ = PS2_FrustumCullBox(frustum, mins, maxs);
+        }
+    }
+}
+
+#if defined(_EE)
+
+/*
+================
+PS2_FrustumCullBlocks
+
+VU0 macro mode. Planes stay in VF01-VF08 for the whole loop,
+VF15 ends up with the smallest distance of each box to the planes,
+then MMI packs its sign bits into the 4 flags.
+================
+*/
+void PS2_FrustumCullBlocks(const ps2_frustum_t * frustum, const ps2_cull_block_t * blocks, int num_blocks, byte * culled)
+{
+    if (num_blocks <= 0)
+    {
+        return;
+    }
+
+    asm volatile (
+        ".set push                        \n\t"
+        ".set noreorder                   \n\t"
+        "lqc2         $vf1,  0x00(%[pos]) \n\t" // max(normal, 0), dist
+        "lqc2         $vf2,  0x10(%[pos]) \n\t"
+        "lqc2         $vf3,  0x20(%[pos]) \n\t"
+        "lqc2         $vf4,  0x30(%[pos]) \n\t"
+        "lqc2         $vf5,  0x00(%[neg]) \n\t" // min(normal, 0)
+        "lqc2         $vf6,  0x10(%[neg]) \n\t"
+        "lqc2         $vf7,  0x20(%[neg]) \n\t"
+        "lqc2         $vf8,  0x30(%[neg]) \n\t"
+        "1:                               \n\t"
+        "lqc2         $vf9,  0x00(%[blk]) \n\t" // mins x, y, z
+        "lqc2         $vf10, 0x10(%[blk]) \n\t"
+        "lqc2         $vf11, 0x20(%[blk]) \n\t"
+        "lqc2         $vf12, 0x30(%[blk]) \n\t" // maxs x, y, z
+        "lqc2         $vf13, 0x40(%[blk]) \n\t"
+        "lqc2         $vf14, 0x50(%[blk]) \n\t"
+        "vmulax.xyzw  $ACC,  $vf12, $vf1  \n\t" // plane 0
+        "vmaddax.xyzw $ACC,  $vf9,  $vf5  \n\t"
+        "vmadday.xyzw $ACC,  $vf13, $vf1  \n\t"
+        "vmadday.xyzw $ACC,  $vf10, $vf5  \n\t"
+        "vmaddaz.xyzw $ACC,  $vf14, $vf1  \n\t"
+        "vmaddz.xyzw  $vf15, $vf11, $vf5  \n\t"
+        "vsubw.xyzw   $vf15, $vf15, $vf1  \n\t"
+        "vmulax.xyzw  $ACC,  $vf12, $vf2  \n\t" // plane 1
+        "vmaddax.xyzw $ACC,  $vf9,  $vf6  \n\t"
+        "vmadday.xyzw $ACC,  $vf13, $vf2  \n\t"
+        "vmadday.xyzw $ACC,  $vf10, $vf6  \n\t"
+        "vmaddaz.xyzw $ACC,  $vf14, $vf2  \n\t"
+        "vmaddz.xyzw  $vf16, $vf11, $vf6  \n\t"
+        "vsubw.xyzw   $vf16, $vf16, $vf2  \n\t"
+        "vmini.xyzw   $vf15, $vf15, $vf16 \n\t"
+        "vmulax.xyzw  $ACC,  $vf12, $vf3  \n\t" // plane 2
+        "vmaddax.xyzw $ACC,  $vf9,  $vf7  \n\t"
+        "vmadday.xyzw $ACC,  $vf13, $vf3  \n\t"
+        "vmadday.xyzw $ACC,  $vf10, $vf7  \n\t"
+        "vmaddaz.xyzw $ACC,  $vf14, $vf3  \n\t"
+        "vmaddz.xyzw  $vf16, $vf11, $vf7  \n\t"
+        "vsubw.xyzw   $vf16, $vf16, $vf3  \n\t"
+        "vmini.xyzw   $vf15, $vf15, $vf16 \n\t"
+        "vmulax.xyzw  $ACC,  $vf12, $vf4  \n\t" // plane 3
+        "vmaddax.xyzw $ACC,  $vf9,  $vf8  \n\t"
+        "vmadday.xyzw $ACC,  $vf13, $vf4  \n\t"
+        "vmadday.xyzw $ACC,  $vf10, $vf8  \n\t"
+        "vmaddaz.xyzw $ACC,  $vf14, $vf4  \n\t"
+        "vmaddz.xyzw  $vf16, $vf11, $vf8  \n\t"
+        "vsubw.xyzw   $vf16, $vf16, $vf4  \n\t"
+        "vmini.xyzw   $vf15, $vf15, $vf16 \n\t"
+        "qmfc2        $8,    $vf15        \n\t" // sign of each word => 1 byte each
+        "psrlw        $8,    $8,    31    \n\t"
+        "ppach        $8,    $0,    $8    \n\t"
+        "ppacb        $8,    $0,    $8    \n\t"
+        "sw           $8,    0(%[out])    \n\t"
+        "addiu        %[blk], %[blk], 96  \n\t"
+        "addiu        %[num], %[num], -1  \n\t"
+        "bgtz         %[num], 1b          \n\t"
+        "addiu        %[out], %[out], 4   \n\t" // (delay slot)
+        ".set pop                         \n\t"
+        : [blk] "+r" (blocks), [out] "+r" (culled), [num] "+r" (num_blocks)
+        : [pos] "r" (frustum->pos_weights), [neg] "r" (frustum->neg_weights)
+        : "$8", "memory"
+    );
+}
+
+#elif defined(__SSE__)
+
+/*
+================
+PS2_FrustumCullBlocks
+
+SSE, for the host tools. Each plane picks the min or max
+quadword of the block per axis, so the sums are the same
+as in PS2_FrustumCullBox.
+================
+*/
+void PS2_FrustumCullBlocks(const ps2_frustum_t * frustum, const ps2_cull_block_t * blocks, int num_blocks, byte * culled)
+{
+    int b, p, j;
+    __m128 normals[PS2_FRUSTUM_PLANES][3];
+    __m128 dists[PS2_FRUSTUM_PLANES];
+    int offsets[PS2_FRUSTUM_PLANES][3]; // In floats from the start of the block
+
+    for (p = 0; p < PS2_FRUSTUM_PLANES; ++p)
+    {
+        for (j = 0; j < 3; ++j)
+        {
+            normals[p][j] = _mm_set1_ps(frustum->normals[p][j]);
+            offsets[p][j] = ((frustum->signbits[p] >> j) & 1) ? (j * 4) : (12 + j * 4);
+        }
+        dists[p] = _mm_set1_ps(frustum->dists[p]);
+    }
+
+    for (b = 0; b < num_blocks; ++b, culled += 4)
+    {
+        const float * block = &blocks[b].mins[0][0];
+        __m128 behind = _mm_setzero_ps();
+
+        for (p = 0; p < PS2_FRUSTUM_PLANES; ++p)
+        {
+            const __m128 x = _mm_load_ps(block + offsets[p][0]);
+            const __m128 y = _mm_load_ps(block + offsets[p][1]);
+            const __m128 z = _mm_load_ps(block + offsets[p][2]);
+            const __m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(normals[p][0], x),
+                                                      _mm_mul_ps(normals[p][1], y)),
+                                                      _mm_mul_ps(normals[p][2], z));
+            behind = _mm_or_ps(behind, _mm_cmplt_ps(dist, dists[p]));
+        }
+
+        const int mask = _mm_movemask_ps(behind);
+        culled[0] = (mask >> 0) & 1;
+        culled[1] = (mask >> 1) & 1;
+        culled[2] = (mask >> 2) & 1;
+        culled[3] = (mask >> 3) & 1;
+    }
+}
+
+#else
+
+/*
+================
+PS2_FrustumCullBlocks
+================
+*/
+void PS2_FrustumCullBlocks(const ps2_frustum_t * frustum, const ps2_cull_block_t * blocks, int num_blocks, byte * culled)
+{
+    PS2_FrustumCullBlocksRef(frustum, blocks, num_blocks, culled);
+}
+
+#endif // _EE / __SSE__
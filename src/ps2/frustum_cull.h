@@ -0,0 +1,76 @@
+/* ================================================================================================
+ * -*- C -*-
+ * File: frustum_cull.h
+ * Brief: Bounding box vs view frustum tests, one box at a time or
+ *        in batches of 4 (VU0 macro mode on the PS2, SSE on the host).
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#ifndef PS2_FRUSTUM_CULL_H
+#define PS2_FRUSTUM_CULL_H
+
+#include "game/q_shared.h"
+#include "ps2/defs_ps2.h"
+#include "ps2/vec_mat.h"
+
+//
+// A box is culled if it is fully behind any of the planes, the same as
+// BOX_ON_PLANE_SIDE() == 2 for a non axial plane: the corner furthest
+// along the normal, picked with the plane signbits, is behind it.
+//
+// The batched test takes the boxes 4 at a time, reorganized so that
+// each quadword has one axis of the 4 boxes. The host (SSE) and scalar
+// versions give the same results as BOX_ON_PLANE_SIDE. The VU0 one adds
+// the min and max corners weighted by the negative and positive parts
+// of the normal, instead of picking, so it can load the block with
+// fixed offsets. VU floats don't round like the EE FPU, a box right on
+// a plane might come out different there.
+//
+enum
+{
+    PS2_FRUSTUM_PLANES = 4
+};
+
+typedef struct
+{
+    // Planes for the scalar and SSE tests, and the axis of the box
+    // to take the min of for the furthest corner (signbits).
+    float normals[PS2_FRUSTUM_PLANES][3];
+    float dists[PS2_FRUSTUM_PLANES];
+    int   signbits[PS2_FRUSTUM_PLANES];
+
+    // VU0 test: max(normal, 0) with the distance in W,
+    // then min(normal, 0) with W = 0, for each plane.
+    m_vec4_t pos_weights[PS2_FRUSTUM_PLANES];
+    m_vec4_t neg_weights[PS2_FRUSTUM_PLANES];
+} ps2_frustum_t;
+
+// Bounds of 4 boxes, [axis][box]. Unused boxes of the last block are zero.
+typedef struct
+{
+    float mins[3][4];
+    float maxs[3][4];
+} ps2_cull_block_t PS2_ALIGN(16);
+
+// Blocks needed for that many boxes.
+#define PS2_CULL_NUM_BLOCKS(num_boxes) (((num_boxes) + 3) / 4)
+
+// Planes must have their signbits set (SignBitsForPlane).
+void PS2_FrustumSetPlanes(ps2_frustum_t * frustum, const cplane_t planes[PS2_FRUSTUM_PLANES]);
+
+// Stores a box at 'index' of the block array. Clear the last block first.
+void PS2_CullBlockSetBox(ps2_cull_block_t * blocks, int index, const float * mins, const float * maxs);
+
+// True if the box is completely outside the frustum.
+qboolean PS2_FrustumCullBox(const ps2_frustum_t * frustum, const float * mins, const float * maxs);
+
+// Writes 1 to 'culled' for each box outside the frustum, 0 for the others,
+// 4 per block. 'culled' must be 4 bytes aligned, unused boxes included.
+void PS2_FrustumCullBlocks(const ps2_frustum_t * frustum, const ps2_cull_block_t * blocks, int num_blocks, byte * culled);
+
+// Same with PS2_FrustumCullBox on each box, to check the above against.
+void PS2_FrustumCullBlocksRef(const ps2_frustum_t * frustum, const ps2_cull_block_t * blocks, int num_blocks, byte * culled);
+
+#endif // PS2_FRUSTUM_CULL_H
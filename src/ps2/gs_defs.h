@@ -16,7 +16,7 @@
 #ifndef PS2_GS_DEFS_H
 #define PS2_GS_DEFS_H
 
-#include <tamtypes.h>
+#include "ps2/defs_ps2.h"
 
 // *** GS: GENERAL PURPOSE REGISTERS ***
 
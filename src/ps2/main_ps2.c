@@ -12,9 +12,70 @@
 
 #include "common/q_common.h"
 
+#include <math.h>
+
 // An artificial argv[] param for Qcommon_Init:
 static char * ps2_argv[] = { "QPS2.ELF", NULL };
 
+/*
+================
+Frame pacing stats, printed every few seconds if sys_showidle is set.
+Idle is the share of wall time spent sleeping; jitter is the standard
+deviation of the time between frames.
+================
+*/
+static struct
+{
+    int window_start;
+    int frames;
+    int slept;
+    int min_msec;
+    int max_msec;
+    double sum;
+    double sum_sq;
+} ps2_frame_stats;
+
+static void PS2_FrameStats(int now, int frame_msec, int slept_msec)
+{
+    enum
+    {
+        STATS_WINDOW_MSEC = 5000
+    };
+
+    if (ps2_frame_stats.frames == 0)
+    {
+        ps2_frame_stats.min_msec = frame_msec;
+        ps2_frame_stats.max_msec = frame_msec;
+    }
+
+    ps2_frame_stats.frames++;
+    ps2_frame_stats.slept += slept_msec;
+    ps2_frame_stats.sum += frame_msec;
+    ps2_frame_stats.sum_sq += (double)frame_msec * frame_msec;
+    if (frame_msec < ps2_frame_stats.min_msec)
+    {
+        ps2_frame_stats.min_msec = frame_msec;
+    }
+    if (frame_msec > ps2_frame_stats.max_msec)
+    {
+        ps2_frame_stats.max_msec = frame_msec;
+    }
+
+    const int elapsed = now - ps2_frame_stats.window_start;
+    if (elapsed >= STATS_WINDOW_MSEC)
+    {
+        const double avg = ps2_frame_stats.sum / ps2_frame_stats.frames;
+        const double var = ps2_frame_stats.sum_sq / ps2_frame_stats.frames - avg * avg;
+
+        Com_Printf("frames %i, frame %i..%i ms (avg %.2f, jitter %.2f), idle %i%%\n",
+                   ps2_frame_stats.frames, ps2_frame_stats.min_msec, ps2_frame_stats.max_msec,
+                   avg, (var > 0) ? sqrt(var) : 0.0, (ps2_frame_stats.slept * 100) / elapsed);
+
+        memset(&ps2_frame_stats, 0, sizeof(ps2_frame_stats));
+        ps2_frame_stats.window_start = now;
+    }
+}
+
 /*
 ================
 PS2 main():
@@ -28,20 +89,54 @@ int main(void)
     // fake a default program name argv[].
     Qcommon_Init(1, ps2_argv);
 
+    cvar_t * sys_showidle = Cvar_Get("sys_showidle", "0", 0);
+
     int time    = 0;
     int newtime = 0;
     int oldtime = Sys_Milliseconds();
+    int slept   = 0;
+    int idle;
+
+    ps2_frame_stats.window_start = oldtime;
 
     for (;;)
     {
-        do
+        // Sleep until the server tick or the next client frame is due
+        // instead of spinning on the clock. Dedicated servers wait on
+        // the sockets, so an incoming packet wakes them up early.
+        // The idle time is as of the last Qcommon_Frame, which ran
+        // at 'oldtime', so take out what went by since then (the
+        // frame itself, or an earlier sleep that woke up early).
+        idle = Qcommon_IdleMsec() - (Sys_Milliseconds() - oldtime);
+        if (idle > 0)
         {
-            newtime = Sys_Milliseconds();
-            time = newtime - oldtime;
-        } while (time < 1);
+            const int sleep_start = Sys_Milliseconds();
+            if (dedicated->value)
+            {
+                NET_Sleep(idle);
+            }
+            else
+            {
+                Sys_SleepMsec(idle);
+            }
+            slept += Sys_Milliseconds() - sleep_start;
+        }
+
+        newtime = Sys_Milliseconds();
+        time = newtime - oldtime;
+        if (time < 1)
+        {
+            continue;
+        }
 
         Qcommon_Frame(time);
         oldtime = newtime;
+
+        if (sys_showidle->value)
+        {
+            PS2_FrameStats(newtime, time, slept);
+        }
+        slept = 0;
     }
     
     Sys_Quit();
@@ -13,6 +13,10 @@
 #include "ps2/model_load.h"
 #include "ps2/ref_ps2.h"
 #include "ps2/mem_alloc.h"
+#include "ps2/vu1_alias.h"
+#include "ps2/alias_strip.h"
+#include "ps2/vis_cache.h"
+#include "ps2/world_tris.h"
 #include "common/q_files.h"
 
 // d*_t structures are on-disk representation
@@ -38,6 +42,8 @@ int ps2_models_failed       = 0;
 int ps2_model_load_fs_time    = 0; // Total milliseconds spent on FS_LoadFile.
 int ps2_model_load_world_time = 0; // Total milliseconds spent on world/brush models.
 int ps2_model_load_ents_time  = 0; // Total milliseconds spent on MD2 and sprites.
+int ps2_model_load_faces_time = 0; // Part of the world time spent making the polygons, triangle cache included.
+int ps2_model_load_tri_cached = 0; // Set if the world triangles came from the cache file.
 
 // If set, maps are always discarded on level load, even if still the same.
 static cvar_t * r_ps2_flush_map = NULL;
@@ -45,6 +51,9 @@ static cvar_t * r_ps2_flush_map = NULL;
 // If set we don't load the MD2 and sprite models, making them render as null models.
 static cvar_t * r_ps2_force_null_entity_models = NULL;
 
+// If set the world triangles are taken from maps/<name>.tri when it matches the map.
+static cvar_t * r_ps2_world_tri_cache = NULL;
+
 // World instance. Usually a reference to ps2_model_pool[0].
 static ps2_model_t * ps2_world_model = NULL;
 
@@ -55,9 +64,6 @@ static ps2_model_t ps2_model_pool[PS2_MDL_POOL_SIZE];
 // These are only referenced by the world geometry.
 static ps2_model_t ps2_inline_models[PS2_MDL_POOL_SIZE];
 
-// Used to hash the model filenames.
-extern u32 Sys_HashString(const char * str);
-
 // For the fixed-size world chunk.
 #define MEGABYTES(n) ((n) * 1024 * 1024)
 
@@ -77,6 +83,7 @@ void PS2_ModelInit(void)
 
     r_ps2_force_null_entity_models = Cvar_Get("r_ps2_force_null_entity_models", "1", 0);
     r_ps2_flush_map = Cvar_Get("r_ps2_flush_map", "0", 0);
+    r_ps2_world_tri_cache = Cvar_Get("r_ps2_world_tri_cache", "1", 0);
 }
 
 /*
@@ -96,6 +103,9 @@ void PS2_ModelShutdown(void)
         }
     }
 
+    // Cluster lists point into the world.
+    PS2_VisCacheReset();
+
     memset(ps2_model_pool,    0, sizeof(ps2_model_pool));
     memset(ps2_inline_models, 0, sizeof(ps2_inline_models));
 
@@ -133,6 +143,10 @@ ps2_model_t * PS2_ModelAlloc(void)
     return NULL;
 }
 
+// Totals for the alias models currently loaded, MD2 file size vs what we keep resident.
+int ps2_alias_file_bytes = 0;
+int ps2_alias_mem_bytes  = 0;
+
 /*
 ==============
 PS2_ModelFree
@@ -145,6 +159,14 @@ void PS2_ModelFree(ps2_model_t * mdl)
         return;
     }
 
+    // Take it out of the alias model totals.
+    if (mdl->type == MDL_ALIAS && mdl->hunk.base_ptr != NULL)
+    {
+        const ps2_mdl_alias_t * alias = (const ps2_mdl_alias_t *)mdl->hunk.base_ptr;
+        ps2_alias_file_bytes -= alias->file_size;
+        ps2_alias_mem_bytes  -= mdl->hunk.max_size;
+    }
+
     Hunk_Free(&mdl->hunk);
     PS2_MemClearObj(mdl);
     --ps2_model_pool_used;
@@ -179,127 +201,222 @@ void PS2_ModelFreeUnused(void)
 //
 //=============================================================================
 
+/*
+==============
+PS2_AliasLumpInBounds
+
+Remarks: Local function.
+True if 'count' items of 'item_size' bytes starting at 'ofs' are
+all inside the file and past its header. Divides instead of
+multiplying, so huge counts can't wrap around.
+==============
+*/
+static qboolean PS2_AliasLumpInBounds(int ofs, int count, int item_size, int file_len)
+{
+    if (ofs < (int)sizeof(dmdl_t) || ofs > file_len || count < 0 || item_size <= 0)
+    {
+        return false;
+    }
+    return count <= (file_len - ofs) / item_size;
+}
+
 /*
 ==============
 PS2_LoadAliasMD2Model
 
 Remarks: Local function.
 Fails with a Sys_Error if the data is invalid.
-Adapted from ref_gl.
+
+Converts the MD2 into the layout in ps2_mdl_alias_t: triangle
+corners are deduplicated into (xyz, st) vertexes, triangles are
+stripified and the frames keep their 8-bit positions behind a
+qword scale and translate. Frame positions are copied out of the
+file buffer, which the caller frees; the glcmds, frame names and
+MD2 triangle/st lists are dropped.
 ==============
 */
-static void PS2_LoadAliasMD2Model(ps2_model_t * mdl, const void * mdl_data)
+static void PS2_LoadAliasMD2Model(ps2_model_t * mdl, const void * mdl_data, int file_len)
 {
     int i, j;
+    dmdl_t header;
     const dmdl_t * p_mdl_data_in = (const dmdl_t *)mdl_data;
-    const int version = LittleLong(p_mdl_data_in->version);
+    const byte * p_file = (const byte *)mdl_data;
 
-    if (version != ALIAS_VERSION)
+    if (file_len < (int)sizeof(dmdl_t))
     {
-        Sys_Error("Model '%s' has wrong version number (%i should be %i)",
-                  mdl->name, version, ALIAS_VERSION);
+        Sys_Error("Model '%s' is too short to be a MD2! (%d bytes)", mdl->name, file_len);
     }
 
-    dmdl_t * p_header_out = (dmdl_t *)Hunk_BlockAlloc(&mdl->hunk, LittleLong(p_mdl_data_in->ofs_end));
-
     //
     // Byte swap the header fields and validate:
     //
     for (i = 0; i < sizeof(dmdl_t) / 4; ++i)
     {
-        ((int *)p_header_out)[i] = LittleLong(((const int *)mdl_data)[i]);
+        ((int *)&header)[i] = LittleLong(((const int *)p_mdl_data_in)[i]);
     }
 
-    if (p_header_out->skinheight > MAX_MDL_SKIN_HEIGHT)
+    if (header.version != ALIAS_VERSION)
+    {
+        Sys_Error("Model '%s' has wrong version number (%i should be %i)",
+                  mdl->name, header.version, ALIAS_VERSION);
+    }
+    if (header.skinheight > MAX_MDL_SKIN_HEIGHT)
     {
         Sys_Error("Model '%s' has a skin taller than %d.", mdl->name, MAX_MDL_SKIN_HEIGHT);
     }
-    if (p_header_out->num_xyz <= 0)
+    if (header.skinwidth <= 0 || header.skinheight <= 0)
+    {
+        Sys_Error("Model '%s' has a bad skin size!", mdl->name);
+    }
+    if (header.num_xyz <= 0)
     {
         Sys_Error("Model '%s' has no vertices!", mdl->name);
     }
-    if (p_header_out->num_xyz > MAX_VERTS)
+    if (header.num_xyz > MAX_VERTS)
     {
         Sys_Error("Model '%s' has too many vertices!", mdl->name);
     }
-    if (p_header_out->num_st <= 0)
+    if (header.num_st <= 0)
     {
         Sys_Error("Model '%s' has no st vertices!", mdl->name);
     }
-    if (p_header_out->num_tris <= 0)
+    if (header.num_tris <= 0)
     {
         Sys_Error("Model '%s' has no triangles!", mdl->name);
     }
-    if (p_header_out->num_frames <= 0)
+    if (header.num_tris > MAX_TRIANGLES)
+    {
+        Sys_Error("Model '%s' has too many triangles!", mdl->name);
+    }
+    if (header.num_frames <= 0)
     {
         Sys_Error("Model '%s' has no frames!", mdl->name);
     }
+    if (header.num_skins < 0 || header.num_skins > MAX_MD2SKINS)
+    {
+        Sys_Error("Model '%s' has a bad skin count!", mdl->name);
+    }
+    if (header.framesize < (int)sizeof(daliasframe_t) - (int)sizeof(dtrivertx_t) + header.num_xyz * (int)sizeof(dtrivertx_t) ||
+        !PS2_AliasLumpInBounds(header.ofs_st,     header.num_st,     sizeof(dstvert_t),   file_len) ||
+        !PS2_AliasLumpInBounds(header.ofs_tris,   header.num_tris,   sizeof(dtriangle_t), file_len) ||
+        !PS2_AliasLumpInBounds(header.ofs_frames, header.num_frames, header.framesize,    file_len) ||
+        !PS2_AliasLumpInBounds(header.ofs_skins,  header.num_skins,  MAX_SKINNAME,        file_len))
+    {
+        Sys_Error("Model '%s' has lumps out of bounds!", mdl->name);
+    }
+
+    const dstvert_t   * p_st_in   = (const dstvert_t   *)(p_file + header.ofs_st);
+    const dtriangle_t * p_tris_in = (const dtriangle_t *)(p_file + header.ofs_tris);
 
     //
-    // S and T texture coordinates:
+    // Deduplicate the corners and stripify, in scratch
+    // memory released once copied to the final layout:
     //
-    const dstvert_t * p_st_in = (const dstvert_t *)((const byte *)p_mdl_data_in + p_header_out->ofs_st);
-    dstvert_t * p_st_out = (dstvert_t *)((byte *)p_header_out + p_header_out->ofs_st);
+    ps2_alias_strips_t strips;
+    const int scratch_size = PS2_AliasStripScratchSize(header.num_tris);
+    void * scratch = PS2_MemAlloc(scratch_size, MEMTAG_MDL_ALIAS);
 
-    for (i = 0; i < p_header_out->num_st; ++i)
+    if (!PS2_AliasBuildStrips(&strips, p_tris_in, header.num_tris, header.num_xyz, header.num_st, scratch))
     {
-        p_st_out[i].s = LittleShort(p_st_in[i].s);
-        p_st_out[i].t = LittleShort(p_st_in[i].t);
+        Sys_Error("Model '%s' has a bad triangle index!", mdl->name);
     }
 
-    //
-    // Triangle lists:
-    //
-    const dtriangle_t * p_tris_in = (const dtriangle_t *)((const byte *)p_mdl_data_in + p_header_out->ofs_tris);
-    dtriangle_t * p_tris_out = (dtriangle_t *)((byte *)p_header_out + p_header_out->ofs_tris);
+    const int num_verts   = strips.num_verts;
+    const int num_indexes = strips.num_indexes;
+    const int num_strips  = strips.num_strips;
 
-    for (i = 0; i < p_header_out->num_tris; ++i)
+    // Same strips as frame vertex indexes, which is what the VU1
+    // draw path sends. Long strips are split for the batch size.
+    int num_vu_xyz = 0;
+    for (i = 0, j = 0; i < num_strips; ++i)
     {
-        for (j = 0; j < 3; j++)
-        {
-            p_tris_out[i].index_xyz[j] = LittleShort(p_tris_in[i].index_xyz[j]);
-            p_tris_out[i].index_st[j]  = LittleShort(p_tris_in[i].index_st[j]);
-        }
+        num_vu_xyz += VU1_AliasStripToStream(NULL, strips.indexes + j, strips.vert_xyz, strips.lengths[i]);
+        j += strips.lengths[i];
     }
 
     //
-    // Animation frames:
+    // Now we know the sizes, allocate the final layout:
     //
-    for (i = 0; i < p_header_out->num_frames; ++i)
+    const int frame_size = (sizeof(ps2_alias_frame_t) - sizeof(dtrivertx_t) +
+                            header.num_xyz * sizeof(dtrivertx_t) + 15) & ~15;
+
+    #define HUNK_ROUND(x) (((x) + 31) & ~31)
+    const int hunk_size = HUNK_ROUND(sizeof(ps2_mdl_alias_t))
+                        + HUNK_ROUND(num_verts * sizeof(ps2_alias_vertex_t))
+                        + HUNK_ROUND(num_indexes * sizeof(u16))
+                        + HUNK_ROUND(num_strips * sizeof(ps2_alias_strip_t))
+                        + HUNK_ROUND(num_vu_xyz * sizeof(u16))
+                        + HUNK_ROUND(header.num_frames * frame_size)
+                        + HUNK_ROUND(header.num_skins * MAX_SKINNAME + 1);
+    #undef HUNK_ROUND
+
+    Hunk_New(&mdl->hunk, hunk_size, MEMTAG_MDL_ALIAS);
+
+    ps2_mdl_alias_t * alias = (ps2_mdl_alias_t *)Hunk_BlockAlloc(&mdl->hunk, sizeof(ps2_mdl_alias_t));
+    alias->num_frames  = header.num_frames;
+    alias->num_xyz     = header.num_xyz;
+    alias->num_verts   = num_verts;
+    alias->num_indexes = num_indexes;
+    alias->num_strips  = num_strips;
+    alias->num_skins   = header.num_skins;
+    alias->num_vu_xyz  = num_vu_xyz;
+    alias->frame_size  = frame_size;
+    alias->file_size   = file_len;
+    alias->verts       = (ps2_alias_vertex_t *)Hunk_BlockAlloc(&mdl->hunk, num_verts * sizeof(ps2_alias_vertex_t));
+    alias->indexes     = (u16 *)Hunk_BlockAlloc(&mdl->hunk, num_indexes * sizeof(u16));
+    alias->strips      = (ps2_alias_strip_t *)Hunk_BlockAlloc(&mdl->hunk, num_strips * sizeof(ps2_alias_strip_t));
+    alias->vu_xyz      = (u16 *)Hunk_BlockAlloc(&mdl->hunk, num_vu_xyz * sizeof(u16));
+    alias->frames      = Hunk_BlockAlloc(&mdl->hunk, header.num_frames * frame_size);
+    alias->skin_names  = (char (*)[MAX_SKINNAME])Hunk_BlockAlloc(&mdl->hunk, header.num_skins * MAX_SKINNAME + 1);
+
+    const float inv_skin_w = 1.0f / header.skinwidth;
+    const float inv_skin_h = 1.0f / header.skinheight;
+    for (i = 0; i < num_verts; ++i)
     {
-        const daliasframe_t * p_frame_in;
-        daliasframe_t * p_frame_out;
+        alias->verts[i].xyz = strips.vert_xyz[i];
+        alias->verts[i].pad = 0;
+        alias->verts[i].s   = LittleShort(p_st_in[strips.vert_st[i]].s) * inv_skin_w;
+        alias->verts[i].t   = LittleShort(p_st_in[strips.vert_st[i]].t) * inv_skin_h;
+    }
 
-        p_frame_in = (const daliasframe_t *)((const byte *)p_mdl_data_in +
-                                             p_header_out->ofs_frames +
-                                             i * p_header_out->framesize);
+    int first_index = 0;
+    for (i = 0; i < num_indexes; ++i)
+    {
+        alias->indexes[i] = strips.indexes[i];
+    }
+    for (i = 0; i < num_strips; ++i)
+    {
+        alias->strips[i].first_index = first_index;
+        alias->strips[i].num_indexes = strips.lengths[i];
+        first_index += strips.lengths[i];
+    }
+    int vu_xyz_used = 0;
+    for (i = 0, j = 0; i < num_strips; ++i)
+    {
+        vu_xyz_used += VU1_AliasStripToStream(alias->vu_xyz + vu_xyz_used, strips.indexes + j, strips.vert_xyz, strips.lengths[i]);
+        j += strips.lengths[i];
+    }
 
-        p_frame_out = (daliasframe_t *)((byte *)p_header_out +
-                                        p_header_out->ofs_frames +
-                                        i * p_header_out->framesize);
+    PS2_MemFree(scratch, scratch_size, MEMTAG_MDL_ALIAS);
 
-        memcpy(p_frame_out->name, p_frame_in->name, sizeof(p_frame_out->name));
+    //
+    // Animation frames:
+    //
+    for (i = 0; i < header.num_frames; ++i)
+    {
+        const daliasframe_t * p_frame_in = (const daliasframe_t *)(p_file + header.ofs_frames + i * header.framesize);
+        ps2_alias_frame_t * p_frame_out  = (ps2_alias_frame_t *)(alias->frames + i * frame_size);
 
         for (j = 0; j < 3; ++j)
         {
             p_frame_out->scale[j]     = LittleFloat(p_frame_in->scale[j]);
             p_frame_out->translate[j] = LittleFloat(p_frame_in->translate[j]);
         }
+        p_frame_out->scale[3]     = 0.0f;
+        p_frame_out->translate[3] = 0.0f;
 
         // Verts are all 8 bit, so no swapping needed.
-        memcpy(p_frame_out->verts, p_frame_in->verts,
-               p_header_out->num_xyz * sizeof(dtrivertx_t));
-    }
-
-    //
-    // The GL Cmds:
-    //
-    const int * p_cmds_in = (const int *)((const byte *)p_mdl_data_in + p_header_out->ofs_glcmds);
-    int * p_cmds_out = (int *)((byte *)p_header_out + p_header_out->ofs_glcmds);
-
-    for (i = 0; i < p_header_out->num_glcmds; ++i)
-    {
-        p_cmds_out[i] = LittleLong(p_cmds_in[i]);
+        memcpy(p_frame_out->verts, p_frame_in->verts, header.num_xyz * sizeof(dtrivertx_t));
     }
 
     // Set defaults for these:
@@ -311,23 +428,26 @@ static void PS2_LoadAliasMD2Model(ps2_model_t * mdl, const void * mdl_data)
     mdl->maxs[2] =  32;
 
     mdl->type = MDL_ALIAS;
-    mdl->num_frames = p_header_out->num_frames;
+    mdl->num_frames = header.num_frames;
 
     //
     // Register all skins:
     //
-    memcpy((char *)p_header_out + p_header_out->ofs_skins,
-           (const char *)p_mdl_data_in + p_header_out->ofs_skins,
-           p_header_out->num_skins * MAX_SKINNAME);
+    memcpy(alias->skin_names, p_file + header.ofs_skins, header.num_skins * MAX_SKINNAME);
 
-    for (i = 0; i < p_header_out->num_skins; ++i)
+    for (i = 0; i < header.num_skins; ++i)
     {
-        const char * p_skin_name = (const char *)p_header_out + p_header_out->ofs_skins + (i * MAX_SKINNAME);
-        mdl->skins[i] = PS2_TexImageFindOrLoad(p_skin_name, IT_SKIN);
+        alias->skin_names[i][MAX_SKINNAME - 1] = '\0';
+        mdl->skins[i] = PS2_TexImageFindOrLoad(alias->skin_names[i], IT_SKIN);
     }
 
+    ps2_alias_file_bytes += file_len;
+    ps2_alias_mem_bytes  += hunk_size;
+
     #ifdef PS2_VERBOSE_MODEL_LOADER
-    Com_DPrintf("New Alias model '%s' loaded!\n", mdl->name);
+    Com_DPrintf("New Alias model '%s' loaded: %d tris, %d xyz -> %d verts, %d strips, %d frames, %d bytes -> %d\n",
+                mdl->name, header.num_tris, header.num_xyz, num_verts, num_strips,
+                header.num_frames, file_len, hunk_size);
     #endif // PS2_VERBOSE_MODEL_LOADER
 }
 
@@ -654,343 +774,223 @@ static void BMod_CalcSurfaceExtents(ps2_model_t * mdl, ps2_mdl_surface_t * s)
 
 /*
 ==============
-BMod_ComputePolygonNormal
+BMod_SubdividePolygon
 
-Computing the normal of an arbitrary polygon is
-as simple as taking the cross product or each
-pair of vertexes, from the first to the last
-and wrapping around back to the first one if
-needed. A more detailed mathematical explanation
-of why this works can be found at:
-http://www.iquilezles.org/www/articles/areas/areas.htm
+Remarks: Local function.
+Same as SubdividePolygon from ref_gl: cuts the polygon on the 64 units
+grid and adds a center vertex to each piece, so the per vertex warp
+doesn't stretch across large faces. Pieces are fans around the center,
+with the first ring vertex repeated at the end to close them, which is
+also num_verts - 2 triangles. Texture S/T are kept in texels and without
+the texinfo offset, as the turbulence expects them.
 ==============
 */
-static void BMod_ComputePolygonNormal(const ps2_mdl_poly_t * poly, vec3_t normal)
+#define WARP_SUBDIVIDE_SIZE      64
+#define WARP_SUBDIVIDE_MAX_VERTS 64
+static void BMod_SubdividePolygon(ps2_model_t * mdl, ps2_mdl_surface_t * surf, int num_verts, vec3_t * verts)
 {
-    int v;
-    vec3_t cross, p0, p1;
+    int i, j;
+    vec3_t mins, maxs;
+    vec3_t front[WARP_SUBDIVIDE_MAX_VERTS];
+    vec3_t back[WARP_SUBDIVIDE_MAX_VERTS];
+    float dist[WARP_SUBDIVIDE_MAX_VERTS];
 
-    VectorClear(normal);
-    for (v = 0; v < poly->num_verts; ++v)
+    if (num_verts > WARP_SUBDIVIDE_MAX_VERTS - 4)
     {
-        const int v_next = (v + 1) % poly->num_verts;
-
-        VectorCopy(poly->vertexes[v].position, p0);
-        VectorCopy(poly->vertexes[v_next].position, p1);
-
-        CrossProduct(p0, p1, cross);
-        VectorAdd(normal, cross, normal);
+        Sys_Error("BMod_SubdividePolygon: Too many vertexes (%i)", num_verts);
     }
-    VectorNormalize(normal);
-}
 
-/*
-==============
-GetNextActive
+    ClearBounds(mins, maxs);
+    for (i = 0; i < num_verts; ++i)
+    {
+        AddPointToBounds(verts[i], mins, maxs);
+    }
 
-Remarks:
-BMod_TriangulatePolygon helper
-==============
-*/
-static inline int GetNextActive(int x, int num_verts, const byte * active)
-{
-    for (;;)
+    for (i = 0; i < 3; ++i)
     {
-        if (++x == num_verts)
+        float m = (mins[i] + maxs[i]) * 0.5f;
+        m = WARP_SUBDIVIDE_SIZE * floor(m / WARP_SUBDIVIDE_SIZE + 0.5f);
+        if (maxs[i] - m < 8.0f || m - mins[i] < 8.0f)
         {
-            x = 0;
-        }
-        if (active[x])
-        {
-            return x;
+            continue;
         }
-    }
-}
-
-/*
-==============
-GetPrevActive
 
-Remarks:
-BMod_TriangulatePolygon helper
-==============
-*/
-static inline int GetPrevActive(int x, int num_verts, const byte * active)
-{
-    for (;;)
-    {
-        if (--x == -1)
+        // Cut it, wrapping around to the first vertex:
+        for (j = 0; j < num_verts; ++j)
         {
-            x = num_verts - 1;
+            dist[j] = verts[j][i] - m;
         }
-        if (active[x])
+        dist[j] = dist[0];
+        VectorCopy(verts[0], verts[j]);
+
+        int f = 0, b = 0;
+        for (j = 0; j < num_verts; ++j)
         {
-            return x;
+            if (dist[j] >= 0.0f)
+            {
+                VectorCopy(verts[j], front[f]);
+                ++f;
+            }
+            if (dist[j] <= 0.0f)
+            {
+                VectorCopy(verts[j], back[b]);
+                ++b;
+            }
+            if (dist[j] == 0.0f || dist[j + 1] == 0.0f)
+            {
+                continue;
+            }
+            if ((dist[j] > 0.0f) != (dist[j + 1] > 0.0f))
+            {
+                // Clip point:
+                const float frac = dist[j] / (dist[j] - dist[j + 1]);
+                int k;
+                for (k = 0; k < 3; ++k)
+                {
+                    front[f][k] = back[b][k] = verts[j][k] + frac * (verts[j + 1][k] - verts[j][k]);
+                }
+                ++f;
+                ++b;
+            }
         }
-    }
-}
 
-/*
-==============
-TestTriangle
+        BMod_SubdividePolygon(mdl, surf, f, front);
+        BMod_SubdividePolygon(mdl, surf, b, back);
+        return;
+    }
 
-Remarks:
-BMod_TriangulatePolygon helper
-==============
-*/
-static qboolean TestTriangle(int pi1, int pi2, int pi3, vec3_t p1, vec3_t p2, vec3_t p3, vec3_t normal,
-                             const byte * active, const ps2_mdl_poly_t * poly, float epsilon)
-{
-    int v;
-    vec3_t n1, n2, n3, pv;
-    vec3_t temp0, temp1, temp2;
-    qboolean result = false;
+    const int poly_verts    = num_verts + 2;
+    const int num_triangles = num_verts;
 
-    VectorSubtract(p2, p1, temp0);
-    VectorSubtract(p3, p1, temp1);
+    ps2_mdl_poly_t * poly = (ps2_mdl_poly_t *)Hunk_BlockAlloc(&mdl->hunk, sizeof(*poly));
+    poly->num_verts = poly_verts;
+    poly->vertexes  = (ps2_poly_vertex_t  *)Hunk_BlockAlloc(&mdl->hunk, sizeof(ps2_poly_vertex_t)  * poly_verts);
+    poly->triangles = (ps2_mdl_triangle_t *)Hunk_BlockAlloc(&mdl->hunk, sizeof(ps2_mdl_triangle_t) * num_triangles);
+    poly->next      = surf->polys;
+    surf->polys     = poly;
 
-    VectorNormalize(temp0);
-    CrossProduct(normal, temp0, n1);
+    vec3_t total;
+    float total_s = 0.0f;
+    float total_t = 0.0f;
+    VectorClear(total);
 
-    if (DotProduct(n1, temp1) > epsilon)
+    for (i = 0; i < num_verts; ++i)
     {
-        VectorSubtract(p3, p2, temp0);
-        VectorSubtract(p1, p3, temp1);
+        ps2_poly_vertex_t * v = &poly->vertexes[i + 1];
 
-        VectorNormalize(temp0);
-        VectorNormalize(temp1);
+        VectorCopy(verts[i], v->position);
+        v->texture_s  = DotProduct(verts[i], surf->texinfo->vecs[0]);
+        v->texture_t  = DotProduct(verts[i], surf->texinfo->vecs[1]);
+        v->lightmap_s = 0.0f;
+        v->lightmap_t = 0.0f;
 
-        CrossProduct(normal, temp0, n2);
-        CrossProduct(normal, temp1, n3);
-
-        result = true;
-        for (v = 0; v < poly->num_verts; ++v)
-        {
-            // Look for other vertexes inside the triangle:
-            if (active[v] && v != pi1 && v != pi2 && v != pi3)
-            {
-                VectorCopy(poly->vertexes[v].position, pv);
+        total_s += v->texture_s;
+        total_t += v->texture_t;
+        VectorAdd(total, verts[i], total);
+    }
 
-                VectorSubtract(pv, p1, temp0);
-                VectorSubtract(pv, p2, temp1);
-                VectorSubtract(pv, p3, temp2);
+    // Center vertex, then the ring closed with a copy of its first vertex:
+    ps2_poly_vertex_t * center = &poly->vertexes[0];
+    VectorScale(total, 1.0f / num_verts, center->position);
+    center->texture_s  = total_s / num_verts;
+    center->texture_t  = total_t / num_verts;
+    center->lightmap_s = 0.0f;
+    center->lightmap_t = 0.0f;
 
-                VectorNormalize(temp0);
-                VectorNormalize(temp1);
-                VectorNormalize(temp2);
+    poly->vertexes[num_verts + 1] = poly->vertexes[1];
 
-                if (DotProduct(n1, temp0) > -epsilon &&
-                    DotProduct(n2, temp1) > -epsilon &&
-                    DotProduct(n3, temp2) > -epsilon)
-                {
-                    result = false;
-                    break;
-                }
-            }
-        }
+    for (i = 0; i < num_triangles; ++i)
+    {
+        poly->triangles[i].vertexes[0] = 0;
+        poly->triangles[i].vertexes[1] = i + 1;
+        poly->triangles[i].vertexes[2] = i + 2;
     }
-
-    return result;
 }
 
+/*
+ * Storage for the single polygon surfaces, allocated all at once
+ * by BMod_LoadFaces and handed out in face order.
+ */
+typedef struct
+{
+    ps2_mdl_poly_t     * polys;
+    ps2_poly_vertex_t  * vertexes;
+    ps2_mdl_triangle_t * triangles;
+    const byte         * cached_indexes; // Next face in the .tri file, null to triangulate
+} bmod_poly_storage_t;
+
 /*
 ==============
-BMod_TriangulatePolygon
+BMod_TriangulateSurface
 
-Algorithm used below is an "Ear clipping"-based triangulation algorithm,
-adapted from sample code presented in the "Mathematics for 3D Game Programming and Computer Graphics"
-book by Eric Lengyel (available at http://www.mathfor3dgameprogramming.com/code/Listing9.2.cpp).
+Remarks: Local function.
+Triangles of a single polygon surface, read from the
+cache if there's one or made by the ear clipper.
 ==============
 */
-static void BMod_TriangulatePolygon(ps2_mdl_poly_t * poly)
+static void BMod_TriangulateSurface(ps2_mdl_poly_t * poly, bmod_poly_storage_t * storage)
 {
-    // -------------------------------------
-    // Local helpers:
-    #define TRIANGULATION_EPSILON 0.001f
-    #define TRIANGULATION_MAX_VERTS 128
-    #define EMIT_TRI(ptr, v0, v1, v2)                   \
-        do                                              \
-        {                                               \
-            if (triangles_done == num_triangles)        \
-            {                                           \
-                Sys_Error("Triangle list overflowed!"); \
-            }                                           \
-            (ptr)->vertexes[0] = v0;                    \
-            (ptr)->vertexes[1] = v1;                    \
-            (ptr)->vertexes[2] = v2;                    \
-            (ptr)++;                                    \
-            triangles_done++;                           \
-        } while (0)
-    // -------------------------------------
-
-    if (poly->num_verts <= 3)
-    {
-        // Already a triangle or an broken polygon.
-        if (poly->num_verts == 3)
-        {
-            if (poly->triangles == NULL)
-            {
-                Sys_Error("Null triangle list in polygon!");
-            }
-            poly->triangles->vertexes[0] = 0;
-            poly->triangles->vertexes[1] = 1;
-            poly->triangles->vertexes[2] = 2;
-        }
-        else
-        {
-            // Broken polygons will be ignored by the view draw.
-            Com_DPrintf("WARNING: Broken polygon found!\n");
-        }
-        return;
-    }
-
+    int i;
     const int num_verts = poly->num_verts;
-    const int num_triangles = num_verts - 2;
-
-    // Just make it bigger if you hit this. We only require 1 byte per entry.
-    if (num_verts > TRIANGULATION_MAX_VERTS)
+    if (num_verts < 3)
     {
-        Sys_Error("TRIANGULATION_MAX_VERTS exceeded!");
+        // Broken polygons will be ignored by the view draw.
+        Com_DPrintf("WARNING: Broken polygon found!\n");
+        return;
     }
 
-    // We need a normal to properly judge the winding of the triangles.
-    vec3_t normal;
-    BMod_ComputePolygonNormal(poly, normal);
+    const int num_triangles = num_verts - 2;
+    u16 * indexes = &poly->triangles[0].vertexes[0];
 
-    int i;
-    int start = 0;
-    int p1 = 0;
-    int p2 = 1;
-    int m1 = num_verts - 1;
-    int m2 = num_verts - 2;
-    qboolean last_positive = false;
-
-    int triangles_done = 0;
-    ps2_mdl_triangle_t * tris_ptr = poly->triangles;
-
-    vec3_t temp0, temp1;
-    vec3_t vp1, vp2, vm1, vm2;
-
-    // BSP polygons are generally small, under 20 verts or so.
-    // We can get away with a local stack buffer and avoid a malloc.
-    byte active[TRIANGULATION_MAX_VERTS];
-    for (i = 0; i < num_verts; ++i)
+    if (storage->cached_indexes != NULL)
     {
-        active[i] = true;
-    }
+        // The header checks don't cover the indexes themselves. One past
+        // the polygon in a broken or edited file would have the VU read
+        // out of bounds, so the face is triangulated again instead.
+        const byte * cached = storage->cached_indexes;
+        storage->cached_indexes += num_triangles * 3;
 
-    // Triangulation loop:
-    for (;;)
-    {
-        if (p2 == m2)
+        for (i = 0; i < num_triangles * 3 && cached[i] < num_verts; ++i)
         {
-            // Only three vertexes remain. We're done.
-            EMIT_TRI(tris_ptr, m1, p1, p2);
-            break;
+            indexes[i] = cached[i];
         }
-
-        VectorCopy(poly->vertexes[p1].position, vp1);
-        VectorCopy(poly->vertexes[p2].position, vp2);
-        VectorCopy(poly->vertexes[m1].position, vm1);
-        VectorCopy(poly->vertexes[m2].position, vm2);
-
-        // Determine whether vp1, vp2, and vm1 form a valid triangle:
-        qboolean positive = TestTriangle(p1, p2, m1, vp2, vm1, vp1, normal, active, poly, TRIANGULATION_EPSILON);
-
-        // Determine whether vm1, vm2, and vp1 form a valid triangle:
-        qboolean negative = TestTriangle(m1, m2, p1, vp1, vm2, vm1, normal, active, poly, TRIANGULATION_EPSILON);
-
-        // If both triangles are valid, choose the
-        // one having the larger smallest angle.
-        if (positive && negative)
+        if (i == num_triangles * 3)
         {
-            VectorSubtract(vp2, vm1, temp0);
-            VectorSubtract(vm2, vm1, temp1);
-            VectorNormalize(temp0);
-            VectorNormalize(temp1);
-            const float pDot = DotProduct(temp0, temp1);
-
-            VectorSubtract(vm2, vp1, temp0);
-            VectorSubtract(vp2, vp1, temp1);
-            VectorNormalize(temp0);
-            VectorNormalize(temp1);
-            const float mDot = DotProduct(temp0, temp1);
-
-            if (ps2_fabsf(pDot - mDot) < TRIANGULATION_EPSILON)
-            {
-                if (last_positive) { positive = false; }
-                else               { negative = false; }
-            }
-            else
-            {
-                if (pDot < mDot)   { negative = false; }
-                else               { positive = false; }
-            }
+            return;
         }
+        Com_DPrintf("WARNING: Bad index %d in the .tri cache for a face of %d vertexes!\n", cached[i], num_verts);
+    }
 
-        if (positive)
-        {
-            // Output the triangle m1, p1, p2:
-            active[p1] = false;
-            EMIT_TRI(tris_ptr, m1, p1, p2);
-            p1 = GetNextActive(p1, num_verts, active);
-            p2 = GetNextActive(p2, num_verts, active);
-            last_positive = true;
-            start = -1;
-        }
-        else if (negative)
-        {
-            // Output the triangle m2, m1, p1:
-            active[m1] = false;
-            EMIT_TRI(tris_ptr, m2, m1, p1);
-            m1 = GetPrevActive(m1, num_verts, active);
-            m2 = GetPrevActive(m2, num_verts, active);
-            last_positive = false;
-            start = -1;
-        }
-        else // Not a valid triangle yet.
-        {
-            if (start == -1)
-            {
-                start = p2;
-            }
-            else if (p2 == start)
-            {
-                // Exit if we've gone all the way around the
-                // polygon without finding a valid triangle.
-                break;
-            }
+    // Just make it bigger if you hit this.
+    if (num_verts > WORLD_TRIS_MAX_VERTS)
+    {
+        Sys_Error("WORLD_TRIS_MAX_VERTS exceeded!");
+    }
 
-            // Advance working set of vertexes:
-            m2 = m1;
-            m1 = p1;
-            p1 = p2;
-            p2 = GetNextActive(p2, num_verts, active);
-        }
+    vec3_t positions[WORLD_TRIS_MAX_VERTS];
+    for (i = 0; i < num_verts; ++i)
+    {
+        VectorCopy(poly->vertexes[i].position, positions[i]);
     }
 
-    // FIXME I don't think this is a hard error...
-    // we should be outputting at most num_verts - 2 triangles
-    // but the algorithm might still fail to produce that many tris.
-    // better to keep a num_triangles member in the polygon struct instead!
+    // The algorithm might fail to produce all the triangles
+    // for a degenerate polygon. What's left is made zero area.
+    const int triangles_done = PS2_TriangulatePolygon(positions, num_verts, indexes);
     if (triangles_done != num_triangles)
     {
-        // IJB
-        //Sys_Error("BMod_TriangulatePolygon: Unexpected triangle count!");
+        memset(&poly->triangles[triangles_done], 0, (num_triangles - triangles_done) * sizeof(ps2_mdl_triangle_t));
     }
-
-    // We are done with these macros now.
-    #undef TRIANGULATION_EPSILON
-    #undef TRIANGULATION_MAX_VERTS
-    #undef EMIT_TRI
 }
 
 /*
 ==============
 BMod_BuildPolygonFromSurface
+
+SURF_WARP surfaces are subdivided into a list
+of polygons, all others get a single one.
 ==============
 */
-static void BMod_BuildPolygonFromSurface(ps2_model_t * mdl, ps2_mdl_surface_t * surf)
+static void BMod_BuildPolygonFromSurface(ps2_model_t * mdl, ps2_mdl_surface_t * surf, bmod_poly_storage_t * storage)
 {
     int i;
     float * vec;
@@ -998,17 +998,42 @@ static void BMod_BuildPolygonFromSurface(ps2_model_t * mdl, ps2_mdl_surface_t *
 
     ps2_mdl_edge_t * edges  = mdl->edges;
     const int num_verts     = surf->num_edges;
-    const int num_triangles = num_verts - 2;
+
+    if (surf->texinfo->flags & SURF_WARP)
+    {
+        vec3_t verts[WARP_SUBDIVIDE_MAX_VERTS];
+        if (num_verts > WARP_SUBDIVIDE_MAX_VERTS - 4)
+        {
+            Sys_Error("BMod_BuildPolygonFromSurface: Too many warp vertexes (%i)", num_verts);
+        }
+
+        for (i = 0; i < num_verts; ++i)
+        {
+            const int index = mdl->surf_edges[surf->first_edge + i];
+            vec = (index > 0) ? mdl->vertexes[edges[index].v[0]].position : mdl->vertexes[edges[-index].v[1]].position;
+            VectorCopy(vec, verts[i]);
+        }
+
+        BMod_SubdividePolygon(mdl, surf, num_verts, verts);
+        return;
+    }
 
     vec3_t total;
     VectorClear(total);
 
-    ps2_mdl_poly_t * poly = (ps2_mdl_poly_t *)Hunk_BlockAlloc(&mdl->hunk, sizeof(*poly));
+    ps2_mdl_poly_t * poly = storage->polys++;
     surf->polys = poly;
 
+    poly->next      = NULL;
     poly->num_verts = num_verts;
-    poly->vertexes  = (ps2_poly_vertex_t  *)Hunk_BlockAlloc(&mdl->hunk, sizeof(ps2_poly_vertex_t)  * num_verts);
-    poly->triangles = (ps2_mdl_triangle_t *)Hunk_BlockAlloc(&mdl->hunk, sizeof(ps2_mdl_triangle_t) * num_triangles);
+    poly->vertexes  = storage->vertexes;
+    poly->triangles = storage->triangles;
+
+    storage->vertexes += num_verts;
+    if (num_verts >= 3)
+    {
+        storage->triangles += num_verts - 2;
+    }
 
     // Reconstruct the polygon from edges:
     for (i = 0; i < num_verts; ++i)
@@ -1059,7 +1084,7 @@ static void BMod_BuildPolygonFromSurface(ps2_model_t * mdl, ps2_mdl_surface_t *
     }
 
     // We need triangles to render with the PS2.
-    BMod_TriangulatePolygon(poly);
+    BMod_TriangulateSurface(poly, storage);
 }
 
 /*
@@ -1067,7 +1092,7 @@ static void BMod_BuildPolygonFromSurface(ps2_model_t * mdl, ps2_mdl_surface_t *
 BMod_LoadFaces
 ==============
 */
-static void BMod_LoadFaces(ps2_model_t * mdl, const byte * mdl_data, const lump_t * l)
+static void BMod_LoadFaces(ps2_model_t * mdl, const byte * mdl_data, const lump_t * l, const byte * cached_indexes)
 {
     extern int Dbg_GetDebugColorIndex(void);
 
@@ -1083,6 +1108,33 @@ static void BMod_LoadFaces(ps2_model_t * mdl, const byte * mdl_data, const lump_
     mdl->surfaces     = out;
     mdl->num_surfaces = count;
 
+    //
+    // The polygons of the non warped faces, their vertexes and triangles
+    // are each one block of the hunk. Warps are cut in a variable number
+    // of pieces, so BMod_SubdividePolygon allocates those as it goes.
+    //
+    int face_num;
+    int num_polys = 0, num_poly_verts = 0, num_triangles = 0;
+    for (face_num = 0; face_num < count; ++face_num)
+    {
+        const int tex_num = LittleShort(in[face_num].texinfo);
+        if (tex_num >= 0 && tex_num < mdl->num_texinfos && (mdl->texinfos[tex_num].flags & SURF_WARP))
+        {
+            continue;
+        }
+
+        const int num_edges = LittleShort(in[face_num].numedges);
+        num_polys      += 1;
+        num_poly_verts += num_edges;
+        num_triangles  += (num_edges >= 3) ? num_edges - 2 : 0;
+    }
+
+    bmod_poly_storage_t storage;
+    storage.polys          = (ps2_mdl_poly_t *)Hunk_BlockAlloc(&mdl->hunk, num_polys * sizeof(ps2_mdl_poly_t));
+    storage.vertexes       = (ps2_poly_vertex_t *)Hunk_BlockAlloc(&mdl->hunk, num_poly_verts * sizeof(ps2_poly_vertex_t));
+    storage.triangles      = (ps2_mdl_triangle_t *)Hunk_BlockAlloc(&mdl->hunk, num_triangles * sizeof(ps2_mdl_triangle_t));
+    storage.cached_indexes = cached_indexes;
+
     //TODO needed?
     //GL_BeginBuildingLightmaps(mdl);
 
@@ -1147,8 +1199,7 @@ static void BMod_LoadFaces(ps2_model_t * mdl, const byte * mdl_data, const lump_
                 out->texture_mins[i] = -8192;
             }
 
-            //TODO
-            //GL_SubdivideSurface(out); // cut up polygon for warps
+            // Cut up for warps by BMod_BuildPolygonFromSurface.
         }
 
         //
@@ -1161,10 +1212,7 @@ static void BMod_LoadFaces(ps2_model_t * mdl, const byte * mdl_data, const lump_
             GL_CreateSurfaceLightmap(out);
         }
         */
-        if (!(out->texinfo->flags & SURF_WARP))
-        {
-            BMod_BuildPolygonFromSurface(mdl, out);
-        }
+        BMod_BuildPolygonFromSurface(mdl, out, &storage);
     }
 
     //TODO needed?
@@ -1387,6 +1435,48 @@ static void BMod_LoadSubmodels(ps2_model_t * mdl, const byte * mdl_data, const l
     }
 }
 
+/*
+==============
+BMod_LoadTriCache
+
+Remarks: Local function.
+Loads maps/<name>.tri, written by tools/bsptris. Returns the
+triangle indexes in it or null if there's no usable cache for
+the map, in which case the faces get triangulated at load time.
+'tris_file' is set to the file buffer to free when done.
+==============
+*/
+static const byte * BMod_LoadTriCache(const ps2_model_t * mdl, const void * mdl_data, void ** tris_file)
+{
+    *tris_file = NULL;
+    if (!r_ps2_world_tri_cache->value)
+    {
+        return NULL;
+    }
+
+    char base_name[MAX_QPATH];
+    char name[MAX_QPATH];
+    COM_StripExtension((char *)mdl->name, base_name);
+    Com_sprintf(name, sizeof(name), "%s%s", base_name, WORLD_TRIS_EXT);
+
+    const int file_len = FS_LoadFile(name, tris_file);
+    if (*tris_file == NULL || file_len <= 0)
+    {
+        Com_DPrintf("No triangle cache '%s', triangulating the world.\n", name);
+        *tris_file = NULL;
+        return NULL;
+    }
+
+    const byte * indexes = PS2_WorldTrisValidate(*tris_file, file_len, mdl_data);
+    if (indexes == NULL)
+    {
+        Com_Printf("WARNING: Triangle cache '%s' doesn't match the map, ignored.\n", name);
+        FS_FreeFile(*tris_file);
+        *tris_file = NULL;
+    }
+    return indexes;
+}
+
 /*
 ==============
 PS2_LoadBrushModel
@@ -1398,6 +1488,8 @@ Adapted from ref_gl.
 */
 static void PS2_LoadBrushModel(ps2_model_t * mdl, void * mdl_data)
 {
+    int start_time, end_time;
+
     if (mdl != &ps2_model_pool[0])
     {
         Sys_Error("Loaded a brush model after the world!");
@@ -1426,7 +1518,22 @@ static void PS2_LoadBrushModel(ps2_model_t * mdl, void * mdl_data)
     BMod_LoadLighting(mdl, mdl_data, &header->lumps[LUMP_LIGHTING]);
     BMod_LoadPlanes(mdl, mdl_data, &header->lumps[LUMP_PLANES]);
     BMod_LoadTexInfo(mdl, mdl_data, &header->lumps[LUMP_TEXINFO]);
-    BMod_LoadFaces(mdl, mdl_data, &header->lumps[LUMP_FACES]);
+
+    start_time = Sys_Milliseconds();
+    {
+        void * tris_file = NULL;
+        const byte * cached_indexes = BMod_LoadTriCache(mdl, mdl_data, &tris_file);
+        BMod_LoadFaces(mdl, mdl_data, &header->lumps[LUMP_FACES], cached_indexes);
+
+        ps2_model_load_tri_cached = (cached_indexes != NULL);
+        if (tris_file != NULL)
+        {
+            FS_FreeFile(tris_file);
+        }
+    }
+    end_time = Sys_Milliseconds();
+    ps2_model_load_faces_time += end_time - start_time;
+
     BMod_LoadMarkSurfaces(mdl, mdl_data, &header->lumps[LUMP_LEAFFACES]);
     BMod_LoadVisibility(mdl, mdl_data, &header->lumps[LUMP_VISIBILITY]);
     BMod_LoadLeafs(mdl, mdl_data, &header->lumps[LUMP_LEAFS]);
@@ -1515,7 +1622,7 @@ static void PS2_ReferenceAllTextures(ps2_model_t * mdl)
 {
     int i;
     dsprite_t * p_sprite;
-    dmdl_t    * p_md2;
+    ps2_mdl_alias_t * p_alias;
 
     switch (mdl->type)
     {
@@ -1539,12 +1646,12 @@ static void PS2_ReferenceAllTextures(ps2_model_t * mdl)
         break;
 
     case MDL_ALIAS :
-        p_md2 = (dmdl_t *)mdl->hunk.base_ptr;
-        for (i = 0; i < p_md2->num_skins; ++i)
+        p_alias = (ps2_mdl_alias_t *)mdl->hunk.base_ptr;
+        for (i = 0; i < p_alias->num_skins; ++i)
         {
-            mdl->skins[i] = PS2_TexImageFindOrLoad((const char *)p_md2 + p_md2->ofs_skins + (i * MAX_SKINNAME), IT_SKIN);
+            mdl->skins[i] = PS2_TexImageFindOrLoad(p_alias->skin_names[i], IT_SKIN);
         }
-        mdl->num_frames = p_md2->num_frames;
+        mdl->num_frames = p_alias->num_frames;
         break;
 
     default :
@@ -1657,8 +1764,8 @@ ps2_model_t * PS2_ModelFindOrLoad(const char * name, int flags)
     case IDALIASHEADER :
         start_time = Sys_Milliseconds();
         {
-            Hunk_New(&new_model->hunk, file_len + 128, MEMTAG_MDL_ALIAS); // Plus some extra bytes for rounding
-            PS2_LoadAliasMD2Model(new_model, file_data);
+            // Sizes its own hunk, which is smaller than the file.
+            PS2_LoadAliasMD2Model(new_model, file_data, file_len);
         }
         end_time = Sys_Milliseconds();
         ps2_model_load_ents_time += end_time - start_time;
@@ -1719,6 +1826,12 @@ void PS2_ModelLoadWorld(const char * name)
     ps2_model_load_fs_time    = 0;
     ps2_model_load_world_time = 0;
     ps2_model_load_ents_time  = 0;
+    ps2_model_load_faces_time = 0;
+    ps2_model_load_tri_cached = 0;
+
+    // Cached cluster lists are for the previous map, even if
+    // it's the same one, since it might be getting reloaded.
+    PS2_VisCacheReset();
 
     char fullname[MAX_QPATH];
     Com_sprintf(fullname, sizeof(fullname), "maps/%s.bsp", name);
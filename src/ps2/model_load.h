@@ -128,6 +128,7 @@ typedef struct ps2_mdl_poly_s
     int num_verts;                  // size of vertexes[], since it's dynamically allocated
     ps2_poly_vertex_t  * vertexes;  // array of polygon vertexes. Never null
     ps2_mdl_triangle_t * triangles; // (num_verts - 2) triangles with indexes into vertexes[]
+    struct ps2_mdl_poly_s * next;   // next piece of a subdivided SURF_WARP surface
 } ps2_mdl_poly_t;
 
 /*
@@ -211,6 +212,73 @@ typedef struct ps2_mdl_leaf_s
     int num_mark_surfaces;
 } ps2_mdl_leaf_t;
 
+/*
+ * Alias (MD2) model draw vertex.
+ * One for each unique (position, tex coord) pair
+ * referenced by the triangles of the original model.
+ */
+typedef struct ps2_alias_vertex_s
+{
+    u16 xyz; // index into ps2_alias_frame_t::verts
+    u16 pad;
+    float s; // normalized skin coordinates
+    float t;
+} ps2_alias_vertex_t;
+
+/*
+ * Alias model triangle strip.
+ * Triangle k of a strip uses indexes k, k+1, k+2,
+ * with the first two swapped for odd k to keep the winding.
+ */
+typedef struct ps2_alias_strip_s
+{
+    u16 first_index;
+    u16 num_indexes;
+} ps2_alias_strip_t;
+
+/*
+ * Alias model animation frame.
+ * Scale and translate are padded to a qword each and come first,
+ * so they can be sent to VU1 as they are to decompress the 8-bit
+ * positions that follow.
+ */
+typedef struct ps2_alias_frame_s
+{
+    float scale[4];       // w unused
+    float translate[4];   // w unused
+    dtrivertx_t verts[1]; // [num_xyz], variable sized
+} ps2_alias_frame_t;
+
+/*
+ * Alias model data as laid out by the loader.
+ * Lives at the start of the model's hunk. The
+ * glcmds and the MD2 triangle/st lists are not kept.
+ */
+typedef struct ps2_mdl_alias_s
+{
+    int num_frames;
+    int num_xyz;     // quantized positions per frame
+    int num_verts;   // unique (xyz, st) pairs
+    int num_indexes; // strip indexes into verts[]
+    int num_strips;
+    int num_skins;
+    int num_vu_xyz;  // entries in vu_xyz
+    int frame_size;  // bytes from one frame to the next, multiple of 16
+    int file_size;   // bytes of the MD2 it was loaded from, for the stats
+
+    ps2_alias_vertex_t * verts;
+    u16 * indexes;
+    ps2_alias_strip_t * strips;
+    u16 * vu_xyz;                      // strips as frame vertex indexes, in VU1 batches, see vu1_alias.h
+    byte * frames;                     // [num_frames * frame_size], see PS2_AliasFrame
+    char (*skin_names)[MAX_SKINNAME]; // [num_skins]
+} ps2_mdl_alias_t;
+
+static inline const ps2_alias_frame_t * PS2_AliasFrame(const ps2_mdl_alias_t * alias, int frame)
+{
+    return (const ps2_alias_frame_t *)(alias->frames + frame * alias->frame_size);
+}
+
 /*
  * Misc model type flags:
  */
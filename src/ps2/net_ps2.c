@@ -10,9 +10,51 @@
  * Check the accompanying LICENSE file for details.
  * ================================================================================================ */
 
+/*
+ * UDP sockets are always available on host builds. On the console they
+ * need the ps2ip stack (libps2ip/libnetman plus the DEV9, NETMAN and SMAP
+ * IOP modules), so they are only compiled in when the Makefile defines
+ * PS2_USE_SOCKETS. Without it only the loopback is available, as before.
+ */
+#if !defined(_EE) && !defined(PS2_USE_SOCKETS)
+    #define PS2_USE_SOCKETS
+#endif
+
+// Linux can move a whole batch of datagrams per system call.
+#if defined(PS2_USE_SOCKETS) && defined(__linux__) && !defined(_EE)
+    #define NET_USE_MMSG
+    #ifndef _GNU_SOURCE
+        #define _GNU_SOURCE
+    #endif
+#endif
+
 #include "common/q_common.h"
 #include "ps2/defs_ps2.h"
 
+#ifdef PS2_USE_SOCKETS
+    #ifdef _EE
+        #include <netman.h>
+        #include <ps2ip.h>
+        #define NET_SetNonBlocking(s) (ioctlsocket((s), FIONBIO, &net_one) != -1)
+        #define NET_CloseSocket(s) closesocket(s)
+        #define NET_WOULDBLOCK(e) ((e) == EWOULDBLOCK || (e) == EAGAIN)
+    #else // !_EE
+        #include <sys/types.h>
+        #include <sys/socket.h>
+        #include <sys/select.h>
+        #include <sys/time.h>
+        #include <netinet/in.h>
+        #include <arpa/inet.h>
+        #include <netdb.h>
+        #include <fcntl.h>
+        #include <unistd.h>
+        #include <errno.h>
+        #define NET_SetNonBlocking(s) (fcntl((s), F_SETFL, fcntl((s), F_GETFL, 0) | O_NONBLOCK) != -1)
+        #define NET_CloseSocket(s) close(s)
+        #define NET_WOULDBLOCK(e) ((e) == EWOULDBLOCK || (e) == EAGAIN)
+    #endif // _EE
+#endif // PS2_USE_SOCKETS
+
 //
 // Local loopback (localhost) buffers, adapted from net_wins.c
 //
@@ -38,6 +80,38 @@ typedef struct
 // Alignment is not strictly necessary here, but might boost memcpy/memset perf.
 static loopback_t loopbacks[2] PS2_ALIGN(16);
 
+#ifdef PS2_USE_SOCKETS
+
+//
+// UDP sockets, one per netsrc_t, adapted from net_udp.c
+//
+
+static int ip_sockets[2] = { -1, -1 };
+static int net_one = 1;
+static cvar_t * net_noudp;
+
+#ifdef NET_USE_MMSG
+enum
+{
+    NET_BATCH_SIZE = 16 // Datagrams moved per recvmmsg/sendmmsg call
+};
+
+typedef struct
+{
+    int count;   // datagrams in the batch
+    int current; // next one to hand out / free slot for sending
+    struct mmsghdr hdrs[NET_BATCH_SIZE];
+    struct iovec iovs[NET_BATCH_SIZE];
+    struct sockaddr_in addrs[NET_BATCH_SIZE];
+    byte data[NET_BATCH_SIZE][MAX_MSGLEN];
+} netbatch_t;
+
+static netbatch_t net_recvbatch[2];
+static netbatch_t net_sendbatch[2];
+#endif // NET_USE_MMSG
+
+#endif // PS2_USE_SOCKETS
+
 //=============================================================================
 //
 // Misc NET helpers:
@@ -82,6 +156,8 @@ qboolean NET_CompareAdr(netadr_t a, netadr_t b)
         }
         return false;
     }
+
+    return false;
 }
 
 /*
@@ -123,6 +199,8 @@ qboolean NET_CompareBaseAdr(netadr_t a, netadr_t b)
         }
         return false;
     }
+
+    return false;
 }
 
 /*
@@ -132,8 +210,10 @@ NET_AdrToString
 */
 char * NET_AdrToString(netadr_t addr)
 {
-// FIXME temp but fine, since we are currently localhost bound
-#define ntohs(x) (x)
+#ifndef PS2_USE_SOCKETS
+// No socket headers, but ports are still kept in network (big endian) order.
+#define ntohs(x) ((unsigned short)((((x) & 0xFF) << 8) | (((x) >> 8) & 0xFF)))
+#endif // PS2_USE_SOCKETS
 
     static char s[64];
 
@@ -157,7 +237,9 @@ char * NET_AdrToString(netadr_t addr)
 
     return s;
 
+#ifndef PS2_USE_SOCKETS
 #undef ntohs
+#endif // PS2_USE_SOCKETS
 }
 
 /*
@@ -174,9 +256,53 @@ qboolean NET_StringToAdr(const char * s, netadr_t * addr)
         return true;
     }
 
-    // TODO Only localhost is currently supported!
+#ifdef PS2_USE_SOCKETS
+    {
+        // Accepts "a.b.c.d[:port]" and, on the host, "hostname[:port]".
+        char copy[128];
+        char * colon;
+        struct sockaddr_in sadr;
+
+        memset(addr, 0, sizeof(*addr));
+        memset(&sadr, 0, sizeof(sadr));
+        sadr.sin_family = AF_INET;
+
+        strncpy(copy, s, sizeof(copy) - 1);
+        copy[sizeof(copy) - 1] = '\0';
+        colon = strchr(copy, ':');
+        if (colon)
+        {
+            *colon = '\0';
+            sadr.sin_port = htons((unsigned short)atoi(colon + 1));
+        }
+
+        if (copy[0] >= '0' && copy[0] <= '9')
+        {
+            sadr.sin_addr.s_addr = inet_addr(copy);
+            if (sadr.sin_addr.s_addr == INADDR_NONE)
+            {
+                return false; // Malformed dotted address
+            }
+        }
+        else
+        {
+            struct hostent * h = gethostbyname(copy);
+            if (!h)
+            {
+                return false;
+            }
+            sadr.sin_addr.s_addr = *(unsigned *)h->h_addr_list[0];
+        }
+
+        addr->type = NA_IP;
+        memcpy(addr->ip, &sadr.sin_addr, 4);
+        addr->port = sadr.sin_port;
+        return true;
+    }
+#else // !PS2_USE_SOCKETS
     memset(addr, 0, sizeof(*addr));
     return false;
+#endif // PS2_USE_SOCKETS
 }
 
 /*
@@ -189,6 +315,346 @@ qboolean NET_IsLocalAddress(netadr_t adr)
     return adr.type == NA_LOOPBACK;
 }
 
+#ifdef PS2_USE_SOCKETS
+
+//=============================================================================
+//
+// UDP socket helpers:
+//
+//=============================================================================
+
+static void NetadrToSockadr(const netadr_t * a, struct sockaddr_in * s)
+{
+    memset(s, 0, sizeof(*s));
+    s->sin_family = AF_INET;
+    s->sin_port = a->port;
+
+    if (a->type == NA_BROADCAST)
+    {
+        s->sin_addr.s_addr = INADDR_BROADCAST;
+    }
+    else
+    {
+        memcpy(&s->sin_addr, a->ip, 4);
+    }
+}
+
+static void SockadrToNetadr(const struct sockaddr_in * s, netadr_t * a)
+{
+    memset(a, 0, sizeof(*a));
+    a->type = NA_IP;
+    memcpy(a->ip, &s->sin_addr, 4);
+    a->port = s->sin_port;
+}
+
+/*
+====================
+NET_Socket
+
+Opens a non-blocking, broadcast capable UDP socket.
+Returns -1 on failure.
+====================
+*/
+static int NET_Socket(const char * net_interface, int port)
+{
+    int newsocket;
+    struct sockaddr_in address;
+
+    newsocket = socket(PF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (newsocket < 0)
+    {
+        Com_Printf("WARNING: NET_Socket: socket() failed\n");
+        return -1;
+    }
+
+    if (!NET_SetNonBlocking(newsocket))
+    {
+        Com_Printf("WARNING: NET_Socket: can't make socket non-blocking\n");
+        NET_CloseSocket(newsocket);
+        return -1;
+    }
+
+    if (setsockopt(newsocket, SOL_SOCKET, SO_BROADCAST, (char *)&net_one, sizeof(net_one)) < 0)
+    {
+        Com_Printf("WARNING: NET_Socket: can't make socket broadcast capable\n");
+    }
+
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+
+    if (!net_interface || !net_interface[0] || !Q_stricmp(net_interface, "localhost"))
+    {
+        address.sin_addr.s_addr = INADDR_ANY;
+    }
+    else
+    {
+        address.sin_addr.s_addr = inet_addr(net_interface);
+        if (address.sin_addr.s_addr == INADDR_NONE)
+        {
+            Com_Printf("WARNING: NET_Socket: bad interface address '%s'\n", net_interface);
+            NET_CloseSocket(newsocket);
+            return -1;
+        }
+    }
+
+    if (port == PORT_ANY)
+    {
+        address.sin_port = 0;
+    }
+    else
+    {
+        address.sin_port = htons((unsigned short)port);
+    }
+
+    if (bind(newsocket, (struct sockaddr *)&address, sizeof(address)) < 0)
+    {
+        Com_Printf("WARNING: NET_Socket: can't bind to port %i\n", port);
+        NET_CloseSocket(newsocket);
+        return -1;
+    }
+
+    return newsocket;
+}
+
+/*
+====================
+NET_OpenIP
+====================
+*/
+static void NET_OpenIP(void)
+{
+    cvar_t * ip;
+    int port;
+
+    ip = Cvar_Get("ip", "localhost", CVAR_NOSET);
+
+    if (ip_sockets[NS_SERVER] < 0)
+    {
+        port = Cvar_Get("ip_hostport", "0", CVAR_NOSET)->value;
+        if (!port)
+        {
+            port = Cvar_Get("hostport", "0", CVAR_NOSET)->value;
+            if (!port)
+            {
+                port = Cvar_Get("port", va("%i", PORT_SERVER), CVAR_NOSET)->value;
+            }
+        }
+        ip_sockets[NS_SERVER] = NET_Socket(ip->string, port);
+    }
+
+    // dedicated servers don't need client ports
+    if (dedicated && dedicated->value)
+    {
+        return;
+    }
+
+    if (ip_sockets[NS_CLIENT] < 0)
+    {
+        port = Cvar_Get("ip_clientport", "0", CVAR_NOSET)->value;
+        if (!port)
+        {
+            port = Cvar_Get("clientport", va("%i", PORT_CLIENT), CVAR_NOSET)->value;
+            if (!port)
+            {
+                port = PORT_ANY;
+            }
+        }
+        ip_sockets[NS_CLIENT] = NET_Socket(ip->string, port);
+        if (ip_sockets[NS_CLIENT] < 0)
+        {
+            ip_sockets[NS_CLIENT] = NET_Socket(ip->string, PORT_ANY);
+        }
+    }
+}
+
+static void NET_CloseIP(void)
+{
+    int i;
+    for (i = 0; i < 2; ++i)
+    {
+        if (ip_sockets[i] >= 0)
+        {
+            NET_CloseSocket(ip_sockets[i]);
+            ip_sockets[i] = -1;
+        }
+#ifdef NET_USE_MMSG
+        net_recvbatch[i].count = net_recvbatch[i].current = 0;
+        net_sendbatch[i].count = net_sendbatch[i].current = 0;
+#endif // NET_USE_MMSG
+    }
+}
+
+/*
+====================
+NET_GetUDPPacket
+====================
+*/
+static qboolean NET_GetUDPPacket(netsrc_t sock, netadr_t * net_from, sizebuf_t * net_message)
+{
+    const int net_socket = ip_sockets[sock];
+    int ret;
+
+    if (net_socket < 0)
+    {
+        return false;
+    }
+
+#ifdef NET_USE_MMSG
+    netbatch_t * batch = &net_recvbatch[sock];
+
+    // Refill the batch with as many datagrams as are waiting.
+    if (batch->current >= batch->count)
+    {
+        int i;
+        for (i = 0; i < NET_BATCH_SIZE; ++i)
+        {
+            batch->iovs[i].iov_base = batch->data[i];
+            batch->iovs[i].iov_len = MAX_MSGLEN;
+            memset(&batch->hdrs[i], 0, sizeof(batch->hdrs[i]));
+            batch->hdrs[i].msg_hdr.msg_name = &batch->addrs[i];
+            batch->hdrs[i].msg_hdr.msg_namelen = sizeof(batch->addrs[i]);
+            batch->hdrs[i].msg_hdr.msg_iov = &batch->iovs[i];
+            batch->hdrs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        batch->current = 0;
+        batch->count = recvmmsg(net_socket, batch->hdrs, NET_BATCH_SIZE, MSG_DONTWAIT, NULL);
+        if (batch->count <= 0)
+        {
+            if (batch->count < 0 && !NET_WOULDBLOCK(errno) && errno != ECONNREFUSED)
+            {
+                Com_Printf("WARNING: NET_GetPacket: recvmmsg failed (%i)\n", errno);
+            }
+            batch->count = 0;
+            return false;
+        }
+    }
+
+    {
+        const int i = batch->current++;
+        SockadrToNetadr(&batch->addrs[i], net_from);
+
+        // Datagrams bigger than the buffer come back cut to MAX_MSGLEN.
+        ret = batch->hdrs[i].msg_len;
+        if ((batch->hdrs[i].msg_hdr.msg_flags & MSG_TRUNC) || ret >= net_message->maxsize)
+        {
+            Com_Printf("Oversize packet from %s\n", NET_AdrToString(*net_from));
+            return false;
+        }
+
+        memcpy(net_message->data, batch->data[i], ret);
+        net_message->cursize = ret;
+        return true;
+    }
+#else // !NET_USE_MMSG
+    {
+        struct sockaddr_in from;
+        socklen_t fromlen = sizeof(from);
+
+        ret = recvfrom(net_socket, (char *)net_message->data, net_message->maxsize, 0,
+                       (struct sockaddr *)&from, &fromlen);
+        if (ret < 0)
+        {
+            return false; // EWOULDBLOCK or a refused connection, nothing to read
+        }
+
+        SockadrToNetadr(&from, net_from);
+
+        if (ret == net_message->maxsize)
+        {
+            Com_Printf("Oversize packet from %s\n", NET_AdrToString(*net_from));
+            return false;
+        }
+
+        net_message->cursize = ret;
+        return true;
+    }
+#endif // NET_USE_MMSG
+}
+
+#ifdef NET_USE_MMSG
+/*
+====================
+NET_FlushSendBatch
+====================
+*/
+static void NET_FlushSendBatch(netsrc_t sock)
+{
+    netbatch_t * batch = &net_sendbatch[sock];
+    int sent = 0;
+    int ret;
+
+    while (sent < batch->count)
+    {
+        ret = sendmmsg(ip_sockets[sock], &batch->hdrs[sent], batch->count - sent, 0);
+        if (ret <= 0)
+        {
+            if (!NET_WOULDBLOCK(errno))
+            {
+                Com_Printf("WARNING: NET_SendPacket: sendmmsg failed (%i)\n", errno);
+            }
+            break; // drop the rest, this is UDP after all
+        }
+        sent += ret;
+    }
+
+    batch->count = 0;
+}
+#endif // NET_USE_MMSG
+
+/*
+====================
+NET_SendUDPPacket
+====================
+*/
+static void NET_SendUDPPacket(netsrc_t sock, int length, const void * data, netadr_t to)
+{
+    const int net_socket = ip_sockets[sock];
+
+    if (net_socket < 0)
+    {
+        return;
+    }
+
+#ifdef NET_USE_MMSG
+    {
+        netbatch_t * batch = &net_sendbatch[sock];
+        int i;
+
+        if (batch->count == NET_BATCH_SIZE)
+        {
+            NET_FlushSendBatch(sock);
+        }
+
+        // Queued until NET_FlushPackets, so a whole server
+        // frame of client datagrams goes out in one call.
+        i = batch->count++;
+        memcpy(batch->data[i], data, length);
+        NetadrToSockadr(&to, &batch->addrs[i]);
+
+        batch->iovs[i].iov_base = batch->data[i];
+        batch->iovs[i].iov_len = length;
+        memset(&batch->hdrs[i], 0, sizeof(batch->hdrs[i]));
+        batch->hdrs[i].msg_hdr.msg_name = &batch->addrs[i];
+        batch->hdrs[i].msg_hdr.msg_namelen = sizeof(batch->addrs[i]);
+        batch->hdrs[i].msg_hdr.msg_iov = &batch->iovs[i];
+        batch->hdrs[i].msg_hdr.msg_iovlen = 1;
+    }
+#else // !NET_USE_MMSG
+    {
+        struct sockaddr_in addr;
+        NetadrToSockadr(&to, &addr);
+
+        if (sendto(net_socket, data, length, 0, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+        {
+            Com_DPrintf("NET_SendPacket: sendto to %s failed\n", NET_AdrToString(to));
+        }
+    }
+#endif // NET_USE_MMSG
+}
+
+#endif // PS2_USE_SOCKETS
+
 //=============================================================================
 //
 // Loopback buffers for the local player:
@@ -240,8 +706,11 @@ qboolean NET_GetPacket(netsrc_t sock, netadr_t * net_from, sizebuf_t * net_messa
         return true;
     }
 
-    // TODO Only localhost is currently supported!
+#ifdef PS2_USE_SOCKETS
+    return NET_GetUDPPacket(sock, net_from, net_message);
+#else // !PS2_USE_SOCKETS
     return false;
+#endif // PS2_USE_SOCKETS
 }
 
 /*
@@ -273,7 +742,36 @@ void NET_SendPacket(netsrc_t sock, int length, const void * data, netadr_t to)
         return;
     }
 
-    // TODO Only localhost is currently supported!
+#ifdef PS2_USE_SOCKETS
+    if (to.type == NA_IP || to.type == NA_BROADCAST)
+    {
+        NET_SendUDPPacket(sock, length, data, to);
+        return;
+    }
+#endif // PS2_USE_SOCKETS
+
+    Com_DPrintf("NET_SendPacket: bad address type %i\n", to.type);
+}
+
+/*
+====================
+NET_FlushPackets
+
+Sends any datagrams queued by NET_SendPacket.
+====================
+*/
+void NET_FlushPackets(void)
+{
+#ifdef NET_USE_MMSG
+    int i;
+    for (i = 0; i < 2; ++i)
+    {
+        if (net_sendbatch[i].count > 0 && ip_sockets[i] >= 0)
+        {
+            NET_FlushSendBatch(i);
+        }
+    }
+#endif // NET_USE_MMSG
 }
 
 //=============================================================================
@@ -291,22 +789,74 @@ void NET_Config(qboolean multiplayer)
 {
     Com_DPrintf("---- NET_Config ----\n");
 
+#ifdef PS2_USE_SOCKETS
+    if (!multiplayer || net_noudp->value)
+    {
+        // A single player game will only use the loopback code
+        NET_CloseIP();
+    }
+    else
+    {
+        NET_OpenIP();
+    }
+#else // !PS2_USE_SOCKETS
     // A single player game will only use the loopback code
     if (multiplayer)
     {
-        Com_Error(ERR_DROP, "Quake2 multiplayer currently unsupported!\n");
+        Com_Error(ERR_DROP, "Quake2 multiplayer unsupported in this build (no PS2_USE_SOCKETS)!\n");
     }
+#endif // PS2_USE_SOCKETS
 }
 
 /*
 ====================
 NET_Sleep
+
+Only dedicated servers sleep here; a listen server must keep running
+the client frames. Blocks for up to msec milliseconds, returning as
+soon as a datagram arrives on one of the open sockets. With no sockets
+open there's nothing to wait on, so it just sleeps.
 ====================
 */
 void NET_Sleep(int msec)
 {
-    // TODO This is where Quake calls select() with msec timeout.
-    (void)msec;
+#ifdef PS2_USE_SOCKETS
+    struct timeval timeout;
+    fd_set fdset;
+    int maxfd = -1;
+    int i;
+#endif // PS2_USE_SOCKETS
+
+    if (msec <= 0 || !dedicated || !dedicated->value)
+    {
+        return;
+    }
+
+#ifdef PS2_USE_SOCKETS
+
+    FD_ZERO(&fdset);
+    for (i = 0; i < 2; ++i)
+    {
+        if (ip_sockets[i] >= 0)
+        {
+            FD_SET(ip_sockets[i], &fdset);
+            if (ip_sockets[i] > maxfd)
+            {
+                maxfd = ip_sockets[i];
+            }
+        }
+    }
+
+    if (maxfd >= 0)
+    {
+        timeout.tv_sec = msec / 1000;
+        timeout.tv_usec = (msec % 1000) * 1000;
+        select(maxfd + 1, &fdset, NULL, NULL, &timeout);
+        return;
+    }
+#endif // PS2_USE_SOCKETS
+
+    Sys_SleepMsec(msec);
 }
 
 /*
@@ -317,6 +867,38 @@ NET_Init
 void NET_Init(void)
 {
     Com_DPrintf("---- NET_Init ----\n");
+
+#ifdef PS2_USE_SOCKETS
+    net_noudp = Cvar_Get("noudp", "0", CVAR_NOSET);
+
+#ifdef _EE
+    // Static configuration of the EE-side IP stack. The DEV9, NETMAN and
+    // SMAP IOP modules were loaded by Sys_LoadIOPModules, which sets noudp
+    // if any of them failed.
+    if (!net_noudp->value)
+    {
+        struct ip4_addr ip, netmask, gateway;
+        ip.addr = inet_addr(Cvar_Get("ps2_ip", "192.168.0.10", CVAR_ARCHIVE)->string);
+        netmask.addr = inet_addr(Cvar_Get("ps2_netmask", "255.255.255.0", CVAR_ARCHIVE)->string);
+        gateway.addr = inet_addr(Cvar_Get("ps2_gateway", "192.168.0.1", CVAR_ARCHIVE)->string);
+
+        if (ip.addr == INADDR_NONE || netmask.addr == INADDR_NONE || gateway.addr == INADDR_NONE)
+        {
+            Com_Printf("WARNING: Bad ps2_ip/ps2_netmask/ps2_gateway, UDP disabled\n");
+            Cvar_ForceSet("noudp", "1");
+        }
+        else
+        {
+            NetManInit();
+            if (ps2ipInit(&ip, &netmask, &gateway) != 0)
+            {
+                Com_Printf("WARNING: ps2ipInit failed, UDP disabled\n");
+                Cvar_ForceSet("noudp", "1");
+            }
+        }
+    }
+#endif // _EE
+#endif // PS2_USE_SOCKETS
 }
 
 /*
@@ -327,4 +909,8 @@ NET_Shutdown
 void NET_Shutdown(void)
 {
     Com_DPrintf("---- NET_Shutdown ----\n");
+
+#ifdef PS2_USE_SOCKETS
+    NET_CloseIP();
+#endif // PS2_USE_SOCKETS
 }
@@ -14,6 +14,7 @@
 #include "ps2/ref_ps2.h"
 #include "ps2/mem_alloc.h"
 #include "ps2/model_load.h"
+#include "ps2/sky_box.h"
 #include "ps2/vu1.h"
 
 // PS2DEV SDK:
@@ -110,13 +111,22 @@ static struct
     qboolean draw_pending;
 } ps2_cinematic_frame;
 
-// Palette provided by the game to expand 8bit cinematic frames.
+// Palette provided by the game for the 8bit cinematic frames.
 static u32 ps2_cinematic_palette[256] PS2_ALIGN(16);
 
-// Cinematic frames are rendered into this RGB16 texture
-// and blitted to screen using a full-screen quadrilateral
-// that applies this buffer as texture.
-static u16 ps2_cinematic_buffer[MAX_TEXIMAGE_SIZE * MAX_TEXIMAGE_SIZE] PS2_ALIGN(16);
+// Same palette in the GS CLUT layout (CSM1 swaps entries 8-15 and 16-23
+// of every 32). Uploaded to ps2ref.vram_clut_start only when it changes.
+static u32 ps2_cinematic_clut[256] PS2_ALIGN(16);
+static qboolean ps2_cinematic_clut_dirty = true;
+
+// Palette entry closest to black. The texture rows below the frame are
+// filled with it, since they are drawn too (they used to be RGB16 zero).
+static byte ps2_cinematic_black_index = 0;
+
+// Cinematic frames are scaled into this 8bit (PSMT8) texture and
+// blitted to screen using a full-screen quadrilateral that applies
+// this buffer as texture. The GS does the palette lookup.
+static byte ps2_cinematic_buffer[MAX_TEXIMAGE_SIZE * MAX_TEXIMAGE_SIZE] PS2_ALIGN(16);
 
 // Built-in texture images that are always available (defined in tex_image.c):
 extern ps2_teximage_t * ps2_builtin_tex_conchars;
@@ -369,12 +379,15 @@ static void PS2_InitGSBuffers(int vidMode, int fbPsm, int zPsm, qboolean interla
 
     // User textures start after the z-buffer.
     // Allocate space for a single 256x256 large texture. Could be 8 bit palletised.
-    // (pretty much all the space we have left):
+    // (pretty much all the space we have left). The 512x256 RGBA16 sky atlas fits too.
     ps2ref.vram_texture_start = PS2_VRamAlloc(MAX_TEXIMAGE_SIZE,
                                               MAX_TEXIMAGE_SIZE,
                                               GS_PSM_32,
                                               GRAPH_ALIGN_BLOCK);
 
+    // Plus a 16x16 RGBA block for the 256 colors CLUT of the cinematics.
+    ps2ref.vram_clut_start = PS2_VRamAlloc(16, 16, GS_PSM_32, GRAPH_ALIGN_BLOCK);
+
     //
     // Initialize the screen and tie the first framebuffer to the read circuits:
     //
@@ -797,6 +810,35 @@ static void PS2_Flush2DBatch(void)
     ps2_fade_scr_index   = -1;
 }
 
+/*
+================
+PS2_CinematicClutUpload
+
+Sends the cinematic palette to the CLUT area
+of VRam if it changed since the last upload.
+Remarks: Local function.
+================
+*/
+static void PS2_CinematicClutUpload(void)
+{
+    if (!ps2_cinematic_clut_dirty)
+    {
+        return;
+    }
+
+    ps2_gs_packet_t * packet = &ps2ref.tex_upload_packet[ps2ref.frame_index];
+    qword_t * q = packet->data;
+
+    q = draw_texture_transfer(q, ps2_cinematic_clut, 16, 16, GS_PSM_32, ps2ref.vram_clut_start, 64);
+    q = draw_texture_flush(q);
+
+    dma_channel_wait(DMA_CHANNEL_GIF, 0);
+    dma_channel_send_chain(DMA_CHANNEL_GIF, packet->data, (q - packet->data), 0, 0);
+    dma_channel_wait(DMA_CHANNEL_GIF, 0);
+
+    ps2_cinematic_clut_dirty = false;
+}
+
 /*
 ================
 PS2_DrawFullScreenCinematic
@@ -832,6 +874,7 @@ static void PS2_DrawFullScreenCinematic(void)
     texrect.color.a = (byte)ps2ref.ui_brightness;
     texrect.color.q = 1.0f;
 
+    PS2_CinematicClutUpload();
     PS2_TexImageVRamUpload(ps2_cinematic_frame.teximage);
     PS2_TexImageBindCurrent();
 
@@ -956,6 +999,10 @@ static void PS2_DrawRenderStats(void)
     extern int ps2_model_load_fs_time;
     extern int ps2_model_load_world_time;
     extern int ps2_model_load_ents_time;
+    extern int ps2_model_load_faces_time;
+    extern int ps2_model_load_tri_cached;
+    extern int ps2_alias_file_bytes;
+    extern int ps2_alias_mem_bytes;
 
     extern int ps2_teximages_used;
     extern int ps2_teximage_cache_hits;
@@ -963,6 +1010,34 @@ static void PS2_DrawRenderStats(void)
     extern int ps2_teximages_failed;
     extern int ps2_teximage_load_time;
 
+    extern int ps2_world_tex_chains;
+    extern int ps2_world_tex_slots_skipped;
+    extern int ps2_world_tex_switches;
+    extern int ps2_world_leafs_culled;
+    extern int ps2_world_surfs_backface;
+    extern int ps2_vis_cache_hits;
+    extern int ps2_vis_cache_builds;
+    extern int ps2_vis_cache_evictions;
+    extern int ps2_vis_cache_bytes;
+
+    extern int ps2_sky_polys;
+    extern int ps2_sky_faces;
+    extern int ps2_sky_fans;
+    extern int ps2_sky_clip_usec;
+    extern int ps2_sky_draw_usec;
+
+    extern int ps2_warp_surfs_drawn;
+    extern int ps2_alpha_surfs_drawn;
+    extern int ps2_warp_vu_batches;
+
+    extern int ps2_dlights_active;
+    extern int ps2_dlight_surfs;
+    extern int ps2_dlight_vu_batches;
+
+    extern int ps2_sprite_quads;
+    extern int ps2_sprite_groups;
+    extern int ps2_sprite_vu_batches;
+
     draw_stats_old_y = draw_stats_curr_y;
 
     Stats_Print("--------------------");
@@ -971,6 +1046,8 @@ static void PS2_DrawRenderStats(void)
     Stats_Print(va("MDL cache hit  %d", ps2_model_cache_hits));
     Stats_Print(va("MDL freed      %d", ps2_unused_models_freed));
     Stats_Print(va("MDL failed     %d", ps2_models_failed));
+    Stats_Print(va("MD2 file KB    %d", ps2_alias_file_bytes / 1024));
+    Stats_Print(va("MD2 mem KB     %d", ps2_alias_mem_bytes / 1024));
     Stats_Print(va("TEX loaded     %d", ps2_teximages_used));
     Stats_Print(va("TEX cache hits %d", ps2_teximage_cache_hits));
     Stats_Print(va("TEX freed      %d", ps2_unused_teximages_freed));
@@ -978,9 +1055,33 @@ static void PS2_DrawRenderStats(void)
     Stats_Print("--------------------");
     Stats_Print(va("Load MDL FS %.2f s", ps2_msec_to_sec(ps2_model_load_fs_time)));
     Stats_Print(va("Load WORLD  %.2f s", ps2_msec_to_sec(ps2_model_load_world_time)));
+    Stats_Print(va("Load FACES  %.2f s%s", ps2_msec_to_sec(ps2_model_load_faces_time),
+                   ps2_model_load_tri_cached ? " (.tri)" : ""));
     Stats_Print(va("Load ENTS   %.2f s", ps2_msec_to_sec(ps2_model_load_ents_time)));
     Stats_Print(va("Load TEX    %.2f s", ps2_msec_to_sec(ps2_teximage_load_time)));
     Stats_Print("--------------------");
+    Stats_Print(va("WLD tex chains %d", ps2_world_tex_chains));
+    Stats_Print(va("WLD slots skip %d", ps2_world_tex_slots_skipped));
+    Stats_Print(va("WLD tex switch %d", ps2_world_tex_switches));
+    Stats_Print(va("WLD leafs cull %d", ps2_world_leafs_culled));
+    Stats_Print(va("WLD surfs back %d", ps2_world_surfs_backface));
+    Stats_Print(va("VIS hit/build  %d/%d", ps2_vis_cache_hits, ps2_vis_cache_builds));
+    Stats_Print(va("VIS evicted    %d", ps2_vis_cache_evictions));
+    Stats_Print(va("VIS lists KB   %d", ps2_vis_cache_bytes / 1024));
+    Stats_Print(va("SKY polys      %d", ps2_sky_polys));
+    Stats_Print(va("SKY faces/fans %d/%d", ps2_sky_faces, ps2_sky_fans));
+    Stats_Print(va("SKY clip us    %d", ps2_sky_clip_usec));
+    Stats_Print(va("SKY draw us    %d", ps2_sky_draw_usec));
+    Stats_Print(va("WRP surfs      %d", ps2_warp_surfs_drawn));
+    Stats_Print(va("WRP alpha      %d", ps2_alpha_surfs_drawn));
+    Stats_Print(va("WRP batches    %d", ps2_warp_vu_batches));
+    Stats_Print(va("DLT lights     %d", ps2_dlights_active));
+    Stats_Print(va("DLT surfs      %d", ps2_dlight_surfs));
+    Stats_Print(va("DLT batches    %d", ps2_dlight_vu_batches));
+    Stats_Print(va("SPR quads      %d", ps2_sprite_quads));
+    Stats_Print(va("SPR groups     %d", ps2_sprite_groups));
+    Stats_Print(va("SPR batches    %d", ps2_sprite_vu_batches));
+    Stats_Print("--------------------");
 
     // A darker background to give the text more contrast.
     Stats_DrawBackground();
@@ -1070,6 +1171,7 @@ qboolean PS2_RendererInit(void * unused1, void * unused2)
 
     // 3D mesh loading/rendering setup:
     PS2_ModelInit();
+    PS2_ViewDrawInit();
 
     Com_DPrintf("---- PS2_RendererInit completed! ( %d, %d ) ----\n", viddef.width, viddef.height);
     ps2ref.initialized = true;
@@ -1123,6 +1225,7 @@ void PS2_RendererShutdown(void)
     }
     PS2_PacketFree(&ps2ref.flip_fb_packet);
 
+    PS2_SkyShutdown();
     VU1_Shutdown();
     PS2_ModelShutdown();
     PS2_TexImageShutdown();
@@ -1246,13 +1349,8 @@ PS2_SetSky
 */
 void PS2_SetSky(const char * name, float rotate, vec3_t axis)
 {
-    //TODO
-    //
-    // Looking at ref_gl, it seems that the renderer can decide
-    // between using TGA or PCX for the skyboxes. TGA should be
-    // a good choice for the PS2.
-    //
     Com_DPrintf("PS2_SetSky: '%s'\n", name);
+    PS2_SkySet(name, rotate, axis);
 }
 
 /*
@@ -1360,6 +1458,10 @@ void PS2_EndFrame(void)
                                  (q - ps2ref.flip_fb_packet.data), 0);
     dma_channel_wait(DMA_CHANNEL_GIF, 0);
     draw_wait_finish();
+
+    // Drop the pixels of built-in images nobody drew in a while.
+    PS2_TexImageReleaseBuiltins(false);
+
     ps2ref.frame_started = false;
 }
 
@@ -1418,6 +1520,12 @@ void PS2_TexImageVRamUpload(ps2_teximage_t * teximage)
         teximage = ps2_builtin_tex_debug;
     }
 
+    // Built-ins are kept compressed until first needed.
+    if (teximage->type == IT_BUILTIN)
+    {
+        PS2_TexImageUnpackBuiltin(teximage);
+    }
+
     if (ps2ref.current_tex == teximage) // Already in VRam.
     {
         return;
@@ -1467,10 +1575,21 @@ one to sample from on subsequent draw calls.
 void PS2_TexImageBindCurrent(void)
 {
     CHECK_FRAME_STARTED();
+    ps2ref.current_frame_qwptr = PS2_TexImageBindToPacket(ps2ref.current_frame_qwptr);
+}
 
+/*
+================
+PS2_TexImageBindToPacket()
+Same as PS2_TexImageBindCurrent, but for packets
+other than the frame packet. Returns the new end.
+================
+*/
+qword_t * PS2_TexImageBindToPacket(qword_t * qwptr)
+{
     if (ps2ref.current_tex == NULL)
     {
-        return;
+        return qwptr;
     }
 
     lod_t         lod;
@@ -1491,6 +1610,14 @@ void PS2_TexImageBindCurrent(void)
     clut.storage_mode = CLUT_STORAGE_MODE1;
     clut.load_method  = CLUT_NO_LOAD;
 
+    // 8 bit textures (only the cinematic frame for now) sample the CLUT.
+    if (ps2ref.current_tex->texbuf.psm == GS_PSM_8)
+    {
+        clut.address     = ps2ref.vram_clut_start;
+        clut.psm         = GS_PSM_32;
+        clut.load_method = CLUT_LOAD;
+    }
+
     if (!TEXIMAGE_IS_SCRAP(ps2ref.current_tex))
     {
         p_texbuf = &ps2ref.current_tex->texbuf;
@@ -1512,8 +1639,32 @@ void PS2_TexImageBindCurrent(void)
         p_texbuf = &tmp_texbuf;
     }
 
-    ps2ref.current_frame_qwptr = draw_texture_sampling(ps2ref.current_frame_qwptr, 0, &lod);
-    ps2ref.current_frame_qwptr = draw_texturebuffer(ps2ref.current_frame_qwptr, 0, p_texbuf, &clut);
+    qwptr = draw_texture_sampling(qwptr, 0, &lod);
+    qwptr = draw_texturebuffer(qwptr, 0, p_texbuf, &clut);
+    return qwptr;
+}
+
+/*
+================
+PS2_TexImageBindImmediate()
+Binds the current texture with a packet of its
+own, sent right away. For the VU1 drawings,
+which don't go through the frame packet.
+================
+*/
+void PS2_TexImageBindImmediate(void)
+{
+    static qword_t bind_dma_buffer[16] PS2_ALIGN(16);
+
+    qword_t * qwptr = PS2_TexImageBindToPacket(bind_dma_buffer);
+    if (qwptr == bind_dma_buffer)
+    {
+        return;
+    }
+
+    dma_channel_wait(DMA_CHANNEL_GIF, 0);
+    dma_channel_send_normal(DMA_CHANNEL_GIF, bind_dma_buffer, (qwptr - bind_dma_buffer), 0, 0);
+    dma_channel_wait(DMA_CHANNEL_GIF, 0);
 }
 
 /*
@@ -1838,10 +1989,7 @@ void PS2_DrawStretchRaw(int x, int y, int w, int h, int cols, int rows, const by
     float hscale;
 
     const byte * source;
-    u16 * dest;
-
-    u32 color;
-    byte r, g, b, a;
+    byte * dest;
 
     if (rows <= MAX_TEXIMAGE_SIZE)
     {
@@ -1856,10 +2004,13 @@ void PS2_DrawStretchRaw(int x, int y, int w, int h, int cols, int rows, const by
 
     // Good idea to clear the buffer first, in case the
     // next upsampling doesn't fill the whole thing.
-    memset(ps2_cinematic_buffer, 0, sizeof(ps2_cinematic_buffer));
+    memset(ps2_cinematic_buffer, ps2_cinematic_black_index, sizeof(ps2_cinematic_buffer));
 
     // Upsample to fill our 256*256 cinematic buffer.
     // This is based on the algorithm applied by ref_gl.
+    // Only the indexes are copied, the palette is applied
+    // by the GS through the CLUT when drawing.
+    fracstep = cols * 0x10000 / MAX_TEXIMAGE_SIZE;
     for (i = 0; i < trows; i++)
     {
         row = (int)(i * hscale);
@@ -1868,21 +2019,13 @@ void PS2_DrawStretchRaw(int x, int y, int w, int h, int cols, int rows, const by
             break;
         }
 
-        source   = data + cols * row;
-        dest     = &ps2_cinematic_buffer[i * MAX_TEXIMAGE_SIZE];
-        fracstep = cols * 0x10000 / MAX_TEXIMAGE_SIZE;
-        frac     = fracstep >> 1;
+        source = data + cols * row;
+        dest   = &ps2_cinematic_buffer[i * MAX_TEXIMAGE_SIZE];
+        frac   = fracstep >> 1;
 
         for (j = 0; j < MAX_TEXIMAGE_SIZE; j++)
         {
-            color = ps2_cinematic_palette[source[frac >> 16]];
-
-            r = (color & 0xFF);
-            g = (color >>  8) & 0xFF;
-            b = (color >> 16) & 0xFF;
-            a = (color >> 24) & 0xFF;
-
-            dest[j] = ((a & 0x1) << 15) | ((b >> 3) << 10) | ((g >> 3) << 5) | (r >> 3); // Pack RGBA-16
+            dest[j] = source[frac >> 16];
             frac += fracstep;
         }
     }
@@ -1890,7 +2033,14 @@ void PS2_DrawStretchRaw(int x, int y, int w, int h, int cols, int rows, const by
     // Reset the texture parameters (notice we use linear filtering for smoother sampling):
     PS2_TexImageSetup(ps2_cinematic_frame.teximage, "cinematic_frame", MAX_TEXIMAGE_SIZE,
                       MAX_TEXIMAGE_SIZE, TEXTURE_COMPONENTS_RGB, TEXTURE_FUNCTION_MODULATE,
-                      GS_PSM_16, LOD_MAG_LINEAR, LOD_MIN_LINEAR, IT_BUILTIN, (byte *)ps2_cinematic_buffer);
+                      GS_PSM_8, LOD_MAG_LINEAR, LOD_MIN_LINEAR, IT_BUILTIN, ps2_cinematic_buffer);
+
+    // The pixels changed, so make sure the upload isn't skipped
+    // if the cinematic frame was the last texture sent to VRam.
+    if (ps2ref.current_tex == ps2_cinematic_frame.teximage)
+    {
+        ps2ref.current_tex = NULL;
+    }
 
     // Save these for drawing later.
     ps2_cinematic_frame.x = x;
@@ -1966,22 +2116,41 @@ PS2_CinematicSetPalette
 */
 void PS2_CinematicSetPalette(const byte * restrict palette)
 {
+    int i;
+
     if (palette == NULL)
     {
         memcpy(ps2_cinematic_palette, ps2_global_palette, sizeof(ps2_cinematic_palette));
-        return;
     }
+    else
+    {
+        byte * restrict dest = (byte *)ps2_cinematic_palette;
 
-    int i;
-    byte * restrict dest = (byte *)ps2_cinematic_palette;
+        for (i = 0; i < 256; i++)
+        {
+            dest[(i * 4) + 0] = palette[(i * 3) + 0];
+            dest[(i * 4) + 1] = palette[(i * 3) + 1];
+            dest[(i * 4) + 2] = palette[(i * 3) + 2];
+            dest[(i * 4) + 3] = 0xFF;
+        }
+    }
 
+    // Reorder for the GS CSM1 CLUT layout (tools/cinclut.c checks it):
+    int darkest = 3 * 255 + 1;
     for (i = 0; i < 256; i++)
     {
-        dest[(i * 4) + 0] = palette[(i * 3) + 0];
-        dest[(i * 4) + 1] = palette[(i * 3) + 1];
-        dest[(i * 4) + 2] = palette[(i * 3) + 2];
-        dest[(i * 4) + 3] = 0xFF;
+        const u32 color = ps2_cinematic_palette[i];
+        const int sum = (color & 0xFF) + ((color >> 8) & 0xFF) + ((color >> 16) & 0xFF);
+        if (sum < darkest)
+        {
+            darkest = sum;
+            ps2_cinematic_black_index = (byte)i;
+        }
+
+        ps2_cinematic_clut[PS2_GS_CLUT_CSM1_INDEX(i)] = ps2_cinematic_palette[i];
     }
+
+    ps2_cinematic_clut_dirty = true;
 }
 
 /*
@@ -114,6 +114,7 @@ typedef struct
     u32               frame_index;               // Index of the current frame buffer.
     u32               vram_used_bytes;           // Bytes of VRam currently committed.
     u32               vram_texture_start;        // Start of VRam after screen buffers where we can alloc textures.
+    u32               vram_clut_start;           // 256 entry RGBA32 CLUT used by the 8 bit (PSMT8) cinematic texture.
     ps2_teximage_t *  current_tex;               // Pointer to the current game texture in VRam (points to teximages[]).
     ps2_teximage_t    teximages[MAX_TEXIMAGES];  // All the textures used by a game level + UI must fit in here!
 } ps2_refresh_t;
@@ -162,6 +163,7 @@ qboolean PS2_IsFrameStarted(void);
 void PS2_BeginFrame(float camera_separation);
 void PS2_EndFrame(void);
 void PS2_RenderFrame(refdef_t * view_def);
+void PS2_ViewDrawInit(void);
 void PS2_DrawFrameSetup(const refdef_t * view_def);
 void PS2_DrawWorldModel(refdef_t * view_def);
 void PS2_DrawViewEntities(refdef_t * view_def);
@@ -218,12 +220,16 @@ Textures and image loading from file (tex_image.c):
 void PS2_TexImageInit(void);
 void PS2_TexImageShutdown(void);
 void PS2_TexImageFreeUnused(void);
+void PS2_TexImageUnpackBuiltin(ps2_teximage_t * teximage);
+void PS2_TexImageReleaseBuiltins(qboolean force);
 
 ps2_teximage_t * PS2_TexImageAlloc(void); // Sys_Error if depleted.
 ps2_teximage_t * PS2_TexImageFindOrLoad(const char * name, int flags);
 
 void PS2_TexImageVRamUpload(ps2_teximage_t * teximage);
 void PS2_TexImageBindCurrent(void);
+qword_t * PS2_TexImageBindToPacket(qword_t * qwptr);
+void PS2_TexImageBindImmediate(void);
 
 void PS2_TexImageSetup(ps2_teximage_t * teximage, const char * name, int w, int h, int components,
                        int func, int psm, int mag_filter, int min_filter, ps2_imagetype_t type, byte * pic);
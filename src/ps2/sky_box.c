@@ -0,0 +1,846 @@
+/* ================================================================================================
+ * -*- C -*-
+ * File: sky_box.c
+ * Brief: Sky box drawing. Bounds of the visible sky surfaces are gathered
+ *        during the world traversal, then only those parts of the six faces are drawn.
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#include "common/q_common.h"
+#include "ps2/sky_box.h"
+#include "ps2/mem_alloc.h"
+#include "ps2/vu1_clip.h"
+
+// PS2DEV SDK:
+#include <dma.h>
+#include <draw.h>
+#include <gs_psm.h>
+
+//=============================================================================
+//
+// Local sky data:
+//
+//=============================================================================
+
+// Per frame sky stats:
+int ps2_sky_polys     = 0;
+int ps2_sky_faces     = 0;
+int ps2_sky_fans      = 0;
+int ps2_sky_clip_usec = 0;
+int ps2_sky_draw_usec = 0;
+
+// Everything below is the same as in ref_gl (gl_warp.c).
+
+// Face image suffixes, and the image each face (axis) uses.
+static const char * const sky_suffixes[SKY_NUM_FACES] = { "rt", "bk", "lf", "ft", "up", "dn" };
+static const int sky_tex_order[SKY_NUM_FACES] = { 0, 2, 1, 3, 4, 5 };
+
+// Planes between the faces, for ClipSkyPolygon.
+static const vec3_t sky_clip[SKY_NUM_FACES] = {
+    {  1.0f,  1.0f, 0.0f },
+    {  1.0f, -1.0f, 0.0f },
+    {  0.0f, -1.0f, 1.0f },
+    {  0.0f,  1.0f, 1.0f },
+    {  1.0f,  0.0f, 1.0f },
+    { -1.0f,  0.0f, 1.0f }
+};
+
+// 1 = s, 2 = t, 3 = distance
+static const int st_to_vec[SKY_NUM_FACES][3] = {
+    {  3, -1,  2 },
+    { -3,  1,  2 },
+    {  1,  3,  2 },
+    { -1, -3,  2 },
+    { -2, -1,  3 }, // 0 degrees yaw, look straight up
+    {  2, -1, -3 }  // look straight down
+};
+
+// s = [0]/[2], t = [1]/[2]
+static const int vec_to_st[SKY_NUM_FACES][3] = {
+    { -2,  3,  1 },
+    {  2,  3, -1 },
+    {  1,  3,  2 },
+    { -1,  3, -2 },
+    { -2, -1,  3 },
+    { -2,  1, -3 }
+};
+
+// Half the side of the box. Corners stay inside the 4096 units far plane.
+#define SKY_BOX_DIST    2300.0f
+#define ON_EPSILON      0.1f
+#define MAX_CLIP_VERTS  64
+
+// Polygon of a face after the near plane and the guard band (4 sides + 1 each).
+#define MAX_FACE_VERTS  (4 + VU1_GUARD_NUM_PLANES)
+
+// Sky polygon vertex: clip space position and the atlas texture coordinates.
+typedef struct
+{
+    float pos[4];
+    float st[2];
+} sky_vert_t;
+
+static struct
+{
+    ps2_teximage_t * atlas;       // IT_SKY image in ps2ref.teximages[], null if the faces failed to load
+    float            rotate;      // Degrees per second around 'axis', zero for a still sky
+    vec3_t           axis;
+    vec3_t           view_origin; // Eye the sky polygons are taken relative to
+    float            mins[2][SKY_NUM_FACES];
+    float            maxs[2][SKY_NUM_FACES];
+    qboolean         collecting;  // Between PS2_SkyBeginFrame and PS2_SkyDraw
+    u32              clip_cycles;
+    ps2_gs_packet_t  packet;      // GIF packet with the texture setup and the fans
+    m_vec4_t         planes[VU1_GUARD_NUM_CONSTS];
+} ps2_sky;
+
+// 6 faces with a tag and MAX_FACE_VERTS vertexes each, the texture setup and the end tag.
+#define SKY_PACKET_QWORDS 256
+
+//=============================================================================
+//
+// Loading:
+//
+//=============================================================================
+
+/*
+================
+PS2_SkyFaceToAtlas
+
+Remarks: Local function.
+Downsamples a face to SKY_FACE_SIZE and writes it as RGBA16 to its atlas slot.
+================
+*/
+static void PS2_SkyFaceToAtlas(const u32 * pic32, int width, int height, int face, u16 * atlas_pixels)
+{
+    int x, y;
+    const int pixel_count = SKY_FACE_SIZE * SKY_FACE_SIZE;
+    u32 * scaled = PS2_MemAlloc(pixel_count * 4, MEMTAG_TEXIMAGE);
+
+    Img_Resample32(pic32, width, height, scaled, SKY_FACE_SIZE, SKY_FACE_SIZE);
+
+    const int slot_x = (face % SKY_ATLAS_COLUMNS) * SKY_FACE_SIZE;
+    const int slot_y = (face / SKY_ATLAS_COLUMNS) * SKY_FACE_SIZE;
+
+    const byte * src = (const byte *)scaled;
+    for (y = 0; y < SKY_FACE_SIZE; ++y)
+    {
+        u16 * dest = &atlas_pixels[(slot_y + y) * SKY_ATLAS_WIDTH + slot_x];
+        for (x = 0; x < SKY_FACE_SIZE; ++x, src += 4)
+        {
+            // 5-5-5-1, alpha bit set.
+            dest[x] = (1 << 15) | ((src[2] >> 3) << 10) | ((src[1] >> 3) << 5) | (src[0] >> 3);
+        }
+    }
+
+    PS2_MemFree(scaled, pixel_count * 4, MEMTAG_TEXIMAGE);
+}
+
+/*
+================
+PS2_SkyLoadFace
+
+Remarks: Local function.
+TGA is tried first, then the 8 bits PCX of the face.
+================
+*/
+static qboolean PS2_SkyLoadFace(const char * name, int face, u16 * atlas_pixels)
+{
+    char path[MAX_QPATH];
+    byte * pic32;
+    int width, height;
+
+    const char * suffix = sky_suffixes[sky_tex_order[face]];
+
+    Com_sprintf(path, sizeof(path), "env/%s%s.tga", name, suffix);
+    if (!TGA_LoadFromFile(path, &pic32, &width, &height))
+    {
+        byte * pic8;
+        Com_sprintf(path, sizeof(path), "env/%s%s.pcx", name, suffix);
+        if (!PCX_LoadFromFile(path, &pic8, NULL, &width, &height))
+        {
+            Com_DPrintf("WARNING: Can't load sky face '%s'\n", path);
+            return false;
+        }
+
+        pic32 = PS2_MemAlloc(width * height * 4, MEMTAG_TEXIMAGE);
+        Img_UnPalettize32(width, height, pic8, ps2_global_palette, pic32);
+        PS2_MemFree(pic8, width * height, MEMTAG_TEXIMAGE);
+    }
+
+    PS2_SkyFaceToAtlas((const u32 *)pic32, width, height, face, atlas_pixels);
+    PS2_MemFree(pic32, width * height * 4, MEMTAG_TEXIMAGE);
+    return true;
+}
+
+/*
+================
+PS2_SkyLoadAtlas
+
+Remarks: Local function.
+================
+*/
+static ps2_teximage_t * PS2_SkyLoadAtlas(const char * name, const char * atlas_name)
+{
+    int face;
+    const int atlas_bytes = SKY_ATLAS_WIDTH * SKY_ATLAS_HEIGHT * 2;
+    u16 * atlas_pixels = PS2_MemAllocAligned(16, atlas_bytes, MEMTAG_TEXIMAGE);
+
+    // Slots 6 and 7 are never sampled.
+    memset(atlas_pixels, 0, atlas_bytes);
+
+    for (face = 0; face < SKY_NUM_FACES; ++face)
+    {
+        if (!PS2_SkyLoadFace(name, face, atlas_pixels))
+        {
+            PS2_MemFree(atlas_pixels, atlas_bytes, MEMTAG_TEXIMAGE);
+            return NULL;
+        }
+    }
+
+    ps2_teximage_t * teximage = PS2_TexImageAlloc();
+    PS2_TexImageSetup(teximage, atlas_name, SKY_ATLAS_WIDTH, SKY_ATLAS_HEIGHT, TEXTURE_COMPONENTS_RGB,
+                      TEXTURE_FUNCTION_MODULATE, GS_PSM_16, LOD_MAG_LINEAR, LOD_MIN_LINEAR,
+                      IT_SKY, (byte *)atlas_pixels);
+    return teximage;
+}
+
+/*
+================
+PS2_SkyInit
+================
+*/
+void PS2_SkyInit(void)
+{
+    memset(&ps2_sky, 0, sizeof(ps2_sky));
+    PS2_PacketAlloc(&ps2_sky.packet, SKY_PACKET_QWORDS, GS_PACKET_NORMAL);
+
+    // Same clip planes and screen limits as the world batches.
+    VU1_GuardSetupConsts(ps2_sky.planes);
+}
+
+/*
+================
+PS2_SkyShutdown
+================
+*/
+void PS2_SkyShutdown(void)
+{
+    // The atlas goes away with the other teximages.
+    PS2_PacketFree(&ps2_sky.packet);
+    ps2_sky.atlas = NULL;
+}
+
+/*
+================
+PS2_SkySet
+================
+*/
+void PS2_SkySet(const char * name, float rotate, const vec3_t axis)
+{
+    char atlas_name[MAX_QPATH];
+    Com_sprintf(atlas_name, sizeof(atlas_name), "env/%s_atlas", name);
+
+    ps2_sky.rotate = rotate;
+    VectorCopy(axis, ps2_sky.axis);
+    if (VectorNormalize(ps2_sky.axis) == 0.0f)
+    {
+        ps2_sky.rotate = 0.0f;
+    }
+
+    // Still in the pool from the last level? The slot could have been
+    // freed and reused since, so check it is still the same image.
+    ps2_teximage_t * atlas = ps2_sky.atlas;
+    if (atlas != NULL && atlas->type == IT_SKY && atlas->hash == Sys_HashString(atlas_name))
+    {
+        atlas->registration_sequence = ps2ref.registration_sequence;
+        return;
+    }
+
+    ps2_sky.atlas = NULL;
+
+    if (Cvar_VariableValue("r_ps2_skip_sky_tex_load"))
+    {
+        Com_DPrintf("PS2_SkySet: Skipped '%s'\n", name);
+        return;
+    }
+
+    const int start_time = Sys_Milliseconds();
+    atlas = PS2_SkyLoadAtlas(name, atlas_name);
+    if (atlas == NULL)
+    {
+        Com_Printf("WARNING: Sky '%s' not loaded, it won't be drawn.\n", name);
+        return;
+    }
+
+    atlas->registration_sequence = ps2ref.registration_sequence;
+    ps2_sky.atlas = atlas;
+
+    Com_DPrintf("PS2_SkySet: '%s' loaded in %d ms\n", name, Sys_Milliseconds() - start_time);
+}
+
+//=============================================================================
+//
+// Sky bounds:
+//
+//=============================================================================
+
+/*
+================
+DrawSkyPolygon
+
+Remarks: Local function.
+Code reused from ref_gl. Nothing is drawn here, the polygon
+only extends the S/T bounds of the face it maps to.
+================
+*/
+static void DrawSkyPolygon(int nump, const float * vecs)
+{
+    int i, j;
+    int axis;
+    float s, t, dv;
+    vec3_t v, av;
+    const float * vp;
+
+    ++ps2_sky_polys;
+
+    // Decide which face it maps to:
+    VectorClear(v);
+    for (i = 0, vp = vecs; i < nump; ++i, vp += 3)
+    {
+        VectorAdd(vp, v, v);
+    }
+
+    av[0] = fabsf(v[0]);
+    av[1] = fabsf(v[1]);
+    av[2] = fabsf(v[2]);
+
+    if (av[0] > av[1] && av[0] > av[2])
+    {
+        axis = (v[0] < 0.0f) ? 1 : 0;
+    }
+    else if (av[1] > av[2] && av[1] > av[0])
+    {
+        axis = (v[1] < 0.0f) ? 3 : 2;
+    }
+    else
+    {
+        axis = (v[2] < 0.0f) ? 5 : 4;
+    }
+
+    // Project new texture coords:
+    for (i = 0; i < nump; ++i, vecs += 3)
+    {
+        j = vec_to_st[axis][2];
+        dv = (j > 0) ? vecs[j - 1] : -vecs[-j - 1];
+        if (dv < 0.001f)
+        {
+            continue; // Don't divide by zero
+        }
+
+        j = vec_to_st[axis][0];
+        s = (j < 0) ? (-vecs[-j - 1] / dv) : (vecs[j - 1] / dv);
+
+        j = vec_to_st[axis][1];
+        t = (j < 0) ? (-vecs[-j - 1] / dv) : (vecs[j - 1] / dv);
+
+        if (s < ps2_sky.mins[0][axis]) { ps2_sky.mins[0][axis] = s; }
+        if (t < ps2_sky.mins[1][axis]) { ps2_sky.mins[1][axis] = t; }
+        if (s > ps2_sky.maxs[0][axis]) { ps2_sky.maxs[0][axis] = s; }
+        if (t > ps2_sky.maxs[1][axis]) { ps2_sky.maxs[1][axis] = t; }
+    }
+}
+
+/*
+================
+ClipSkyPolygon
+
+Remarks: Local function.
+Code reused from ref_gl.
+================
+*/
+static void ClipSkyPolygon(int nump, float * vecs, int stage)
+{
+    int i, j;
+    float d, e;
+    float * v;
+    qboolean front, back;
+    float dists[MAX_CLIP_VERTS];
+    int sides[MAX_CLIP_VERTS];
+    vec3_t newv[2][MAX_CLIP_VERTS];
+    int newc[2];
+
+    if (nump > MAX_CLIP_VERTS - 2)
+    {
+        Sys_Error("ClipSkyPolygon: MAX_CLIP_VERTS");
+    }
+
+    if (stage == SKY_NUM_FACES)
+    {
+        // Fully clipped, so add it.
+        DrawSkyPolygon(nump, vecs);
+        return;
+    }
+
+    front = back = false;
+    const float * norm = sky_clip[stage];
+    for (i = 0, v = vecs; i < nump; ++i, v += 3)
+    {
+        d = DotProduct(v, norm);
+        if (d > ON_EPSILON)
+        {
+            front = true;
+            sides[i] = SIDE_FRONT;
+        }
+        else if (d < -ON_EPSILON)
+        {
+            back = true;
+            sides[i] = SIDE_BACK;
+        }
+        else
+        {
+            sides[i] = SIDE_ON;
+        }
+        dists[i] = d;
+    }
+
+    if (!front || !back)
+    {
+        // Not clipped.
+        ClipSkyPolygon(nump, vecs, stage + 1);
+        return;
+    }
+
+    // Clip it:
+    sides[i] = sides[0];
+    dists[i] = dists[0];
+    VectorCopy(vecs, (vecs + (i * 3)));
+    newc[0] = newc[1] = 0;
+
+    for (i = 0, v = vecs; i < nump; ++i, v += 3)
+    {
+        switch (sides[i])
+        {
+        case SIDE_FRONT :
+            VectorCopy(v, newv[0][newc[0]]);
+            newc[0]++;
+            break;
+
+        case SIDE_BACK :
+            VectorCopy(v, newv[1][newc[1]]);
+            newc[1]++;
+            break;
+
+        case SIDE_ON :
+            VectorCopy(v, newv[0][newc[0]]);
+            newc[0]++;
+            VectorCopy(v, newv[1][newc[1]]);
+            newc[1]++;
+            break;
+        } // switch (sides[i])
+
+        if (sides[i] == SIDE_ON || sides[i + 1] == SIDE_ON || sides[i + 1] == sides[i])
+        {
+            continue;
+        }
+
+        d = dists[i] / (dists[i] - dists[i + 1]);
+        for (j = 0; j < 3; ++j)
+        {
+            e = v[j] + d * (v[j + 3] - v[j]);
+            newv[0][newc[0]][j] = e;
+            newv[1][newc[1]][j] = e;
+        }
+        newc[0]++;
+        newc[1]++;
+    }
+
+    // Continue:
+    ClipSkyPolygon(newc[0], newv[0][0], stage + 1);
+    ClipSkyPolygon(newc[1], newv[1][0], stage + 1);
+}
+
+/*
+================
+PS2_SkyBeginFrame
+================
+*/
+void PS2_SkyBeginFrame(const refdef_t * view_def)
+{
+    int i;
+    for (i = 0; i < SKY_NUM_FACES; ++i)
+    {
+        ps2_sky.mins[0][i] = ps2_sky.mins[1][i] =  9999.0f;
+        ps2_sky.maxs[0][i] = ps2_sky.maxs[1][i] = -9999.0f;
+    }
+
+    VectorCopy(view_def->vieworg, ps2_sky.view_origin);
+    ps2_sky.collecting  = true;
+    ps2_sky.clip_cycles = 0;
+
+    ps2_sky_polys     = 0;
+    ps2_sky_faces     = 0;
+    ps2_sky_fans      = 0;
+    ps2_sky_clip_usec = 0;
+    ps2_sky_draw_usec = 0;
+}
+
+/*
+================
+PS2_SkyAddSurface
+================
+*/
+void PS2_SkyAddSurface(const ps2_mdl_surface_t * surf)
+{
+    // Brush models come after the sky is drawn, and ref_gl
+    // doesn't give them sky either, so only the world adds.
+    if (!ps2_sky.collecting || ps2_sky.atlas == NULL)
+    {
+        return;
+    }
+
+    const ps2_mdl_poly_t * poly = surf->polys;
+    if (poly == NULL || poly->num_verts < 3)
+    {
+        return;
+    }
+
+    const u32 start = PS2_CpuCycles();
+
+    // Room for the copy of the first vertex ClipSkyPolygon appends.
+    int i;
+    vec3_t verts[MAX_CLIP_VERTS];
+    const int num_verts = (poly->num_verts < MAX_CLIP_VERTS - 2) ? poly->num_verts : MAX_CLIP_VERTS - 2;
+
+    for (i = 0; i < num_verts; ++i)
+    {
+        VectorSubtract(poly->vertexes[i].position, ps2_sky.view_origin, verts[i]);
+    }
+    ClipSkyPolygon(num_verts, verts[0], 0);
+
+    ps2_sky.clip_cycles += PS2_CpuCycles() - start;
+}
+
+//=============================================================================
+//
+// Drawing:
+//
+//=============================================================================
+
+/*
+================
+PS2_SkyMakeVert
+
+Remarks: Local function.
+MakeSkyVec from ref_gl, but the vertex is taken to clip
+space and the texture coordinates are into the atlas.
+================
+*/
+static void PS2_SkyMakeVert(float s, float t, int axis, const m_mat4_t * sky_to_clip, sky_vert_t * out)
+{
+    int k;
+    vec3_t b;
+    m_vec4_t v, clip;
+
+    b[0] = s * SKY_BOX_DIST;
+    b[1] = t * SKY_BOX_DIST;
+    b[2] = SKY_BOX_DIST;
+
+    k = st_to_vec[axis][0];
+    v.x = (k < 0) ? -b[-k - 1] : b[k - 1];
+    k = st_to_vec[axis][1];
+    v.y = (k < 0) ? -b[-k - 1] : b[k - 1];
+    k = st_to_vec[axis][2];
+    v.z = (k < 0) ? -b[-k - 1] : b[k - 1];
+    v.w = 1.0f;
+
+    Mat4_TransformVec4(&clip, sky_to_clip, &v);
+    out->pos[0] = clip.x;
+    out->pos[1] = clip.y;
+    out->pos[2] = clip.z;
+    out->pos[3] = clip.w;
+
+    // Avoid bilinear seams, also with the faces next in the atlas.
+    static const float sky_min = 0.5f / SKY_FACE_SIZE;
+    static const float sky_max = 1.0f - (0.5f / SKY_FACE_SIZE);
+
+    s = (s + 1.0f) * 0.5f;
+    t = (t + 1.0f) * 0.5f;
+
+    s = (s < sky_min) ? sky_min : ((s > sky_max) ? sky_max : s);
+    t = (t < sky_min) ? sky_min : ((t > sky_max) ? sky_max : t);
+    t = 1.0f - t;
+
+    const float slot_x = (float)((axis % SKY_ATLAS_COLUMNS) * SKY_FACE_SIZE);
+    const float slot_y = (float)((axis / SKY_ATLAS_COLUMNS) * SKY_FACE_SIZE);
+
+    out->st[0] = (slot_x + s * SKY_FACE_SIZE) / SKY_ATLAS_WIDTH;
+    out->st[1] = (slot_y + t * SKY_FACE_SIZE) / SKY_ATLAS_HEIGHT;
+}
+
+/*
+================
+PS2_SkyClipFace
+
+Remarks: Local function.
+Sutherland-Hodgman against the near plane and the guard band, the same
+planes as the VU1 world program. Texture coordinates are linear in clip
+space, so they are lerped along with the position. Returns the vertex count.
+================
+*/
+static int PS2_SkyClipFace(sky_vert_t * verts, int n, sky_vert_t * scratch)
+{
+    int p, i, j;
+    float dists[MAX_FACE_VERTS + 1];
+    sky_vert_t * src = verts;
+    sky_vert_t * dst = scratch;
+
+    for (p = 0; p < VU1_GUARD_NUM_PLANES; ++p)
+    {
+        const m_vec4_t * plane = &ps2_sky.planes[p];
+        int num_out = 0;
+
+        for (i = 0; i < n; ++i)
+        {
+            const float * pos = src[i].pos;
+            dists[i] = plane->x * pos[0] + plane->y * pos[1] + plane->z * pos[2] + plane->w * pos[3];
+            num_out += (dists[i] < 0.0f);
+        }
+
+        if (num_out == 0)
+        {
+            continue;
+        }
+        if (num_out == n)
+        {
+            return 0;
+        }
+
+        int num_dst = 0;
+        for (i = 0; i < n; ++i)
+        {
+            const int next = (i + 1 < n) ? (i + 1) : 0;
+            const qboolean cur_in  = (dists[i]    >= 0.0f);
+            const qboolean next_in = (dists[next] >= 0.0f);
+
+            if (cur_in)
+            {
+                dst[num_dst++] = src[i];
+            }
+
+            if (cur_in != next_in)
+            {
+                const float t = dists[i] / (dists[i] - dists[next]);
+                sky_vert_t * d = &dst[num_dst++];
+                for (j = 0; j < 4; ++j)
+                {
+                    d->pos[j] = src[i].pos[j] + (src[next].pos[j] - src[i].pos[j]) * t;
+                }
+                for (j = 0; j < 2; ++j)
+                {
+                    d->st[j] = src[i].st[j] + (src[next].st[j] - src[i].st[j]) * t;
+                }
+            }
+        }
+
+        n = num_dst;
+        if (n > MAX_FACE_VERTS)
+        {
+            return 0;
+        }
+
+        sky_vert_t * tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    if (src != verts)
+    {
+        memcpy(verts, src, n * sizeof(sky_vert_t));
+    }
+    return n;
+}
+
+/*
+================
+PS2_SkyFloatBits
+
+Remarks: Local function.
+================
+*/
+static inline u32 PS2_SkyFloatBits(float f)
+{
+    FU32_t fu;
+    fu.asFloat = f;
+    return fu.asU32;
+}
+
+/*
+================
+PS2_SkyEmitFan
+
+Remarks: Local function.
+GIF PACKED fan: ST (with Q), RGBAQ and XYZ2 for each vertex.
+================
+*/
+static qword_t * PS2_SkyEmitFan(qword_t * q, const sky_vert_t * verts, int n)
+{
+    int i, j;
+    const float * screen_max = &ps2_sky.planes[VU1_GUARD_NUM_PLANES].x;
+    const float   gs_scale[] = { 2048.0f, 2048.0f };
+
+    const u64 prim = PS2_GS_PRIM(PS2_PRIM_TRIFAN, PS2_PRIM_IIP_FLAT, PS2_PRIM_TME_ON, PS2_PRIM_FGE_OFF,
+                                 PS2_PRIM_ABE_OFF, PS2_PRIM_AA1_OFF, PS2_PRIM_FST_STQ,
+                                 PS2_PRIM_CTXT_CONTEXT1, PS2_PRIM_FIX_NOFIXDDA);
+
+    q->dw[0] = PS2_GS_GIFTAG(n, 0, 1, prim, PS2_GIFTAG_PACKED, 3);
+    q->dw[1] = PS2_GIFTAG_ST | (PS2_GIFTAG_RGBAQ << 4) | (PS2_GIFTAG_XYZ2 << 8);
+    ++q;
+
+    for (i = 0; i < n; ++i)
+    {
+        const float w = 1.0f / verts[i].pos[3];
+
+        // ST, Q goes along and is latched by the RGBAQ write.
+        q->sw[0] = PS2_SkyFloatBits(verts[i].st[0] * w);
+        q->sw[1] = PS2_SkyFloatBits(verts[i].st[1] * w);
+        q->sw[2] = PS2_SkyFloatBits(w);
+        q->sw[3] = 0;
+        ++q;
+
+        // Unlit, 128 is 1.0 for MODULATE.
+        q->sw[0] = 128;
+        q->sw[1] = 128;
+        q->sw[2] = 128;
+        q->sw[3] = 128;
+        ++q;
+
+        // Same mapping the VU1 programs do. Depth is the farthest there is,
+        // the Z test (GEQUAL) then lets it through only where the clear is.
+        for (j = 0; j < 2; ++j)
+        {
+            float s = gs_scale[j] + verts[i].pos[j] * w * gs_scale[j];
+            s = (s > 0.0f) ? s : 0.0f;
+            s = (s < screen_max[j]) ? s : screen_max[j];
+            q->sw[j] = (u32)(s * 16.0f);
+        }
+        q->sw[2] = 0;
+        q->sw[3] = 0;
+        ++q;
+    }
+
+    return q;
+}
+
+/*
+================
+PS2_SkyDraw
+================
+*/
+void PS2_SkyDraw(const refdef_t * view_def, const m_mat4_t * view_proj)
+{
+    int i;
+
+    ps2_sky.collecting = false;
+    ps2_sky_clip_usec  = PS2_CyclesToMicrosec(ps2_sky.clip_cycles);
+
+    if (ps2_sky.atlas == NULL)
+    {
+        return;
+    }
+
+    const u32 start = PS2_CpuCycles();
+
+    // Check for no sky at all.
+    for (i = 0; i < SKY_NUM_FACES; ++i)
+    {
+        if (ps2_sky.mins[0][i] < ps2_sky.maxs[0][i] && ps2_sky.mins[1][i] < ps2_sky.maxs[1][i])
+        {
+            break;
+        }
+    }
+    if (i == SKY_NUM_FACES)
+    {
+        return;
+    }
+
+    //
+    // Sky box space to world: the rotation, if any, then the eye.
+    // Same as the glTranslatef/glRotatef pair of ref_gl.
+    //
+    m_mat4_t sky_to_world, sky_to_clip;
+    Mat4_Identity(&sky_to_world);
+
+    if (ps2_sky.rotate != 0.0f)
+    {
+        static const vec3_t basis[3] = { { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } };
+        const float degrees = view_def->time * ps2_sky.rotate;
+
+        for (i = 0; i < 3; ++i)
+        {
+            vec3_t row;
+            RotatePointAroundVector(row, ps2_sky.axis, basis[i], degrees);
+            sky_to_world.m[i][0] = row[0];
+            sky_to_world.m[i][1] = row[1];
+            sky_to_world.m[i][2] = row[2];
+        }
+    }
+
+    sky_to_world.m[3][0] = view_def->vieworg[0];
+    sky_to_world.m[3][1] = view_def->vieworg[1];
+    sky_to_world.m[3][2] = view_def->vieworg[2];
+    Mat4_Multiply(&sky_to_clip, &sky_to_world, view_proj);
+
+    // The atlas is the one texture in VRam, usually already there since the last frame.
+    PS2_TexImageVRamUpload(ps2_sky.atlas);
+
+    dma_channel_wait(DMA_CHANNEL_GIF, 0);
+    qword_t * q = ps2_sky.packet.data;
+    q = PS2_TexImageBindToPacket(q);
+
+    for (i = 0; i < SKY_NUM_FACES; ++i)
+    {
+        if (ps2_sky.rotate != 0.0f)
+        {
+            // Hack from ref_gl, forcing full sky draw when rotating.
+            ps2_sky.mins[0][i] = ps2_sky.mins[1][i] = -1.0f;
+            ps2_sky.maxs[0][i] = ps2_sky.maxs[1][i] =  1.0f;
+        }
+
+        if (ps2_sky.mins[0][i] >= ps2_sky.maxs[0][i] || ps2_sky.mins[1][i] >= ps2_sky.maxs[1][i])
+        {
+            continue;
+        }
+
+        sky_vert_t verts[MAX_FACE_VERTS + 1];
+        sky_vert_t scratch[MAX_FACE_VERTS + 1];
+
+        PS2_SkyMakeVert(ps2_sky.mins[0][i], ps2_sky.mins[1][i], i, &sky_to_clip, &verts[0]);
+        PS2_SkyMakeVert(ps2_sky.mins[0][i], ps2_sky.maxs[1][i], i, &sky_to_clip, &verts[1]);
+        PS2_SkyMakeVert(ps2_sky.maxs[0][i], ps2_sky.maxs[1][i], i, &sky_to_clip, &verts[2]);
+        PS2_SkyMakeVert(ps2_sky.maxs[0][i], ps2_sky.mins[1][i], i, &sky_to_clip, &verts[3]);
+
+        ++ps2_sky_faces;
+
+        const int n = PS2_SkyClipFace(verts, 4, scratch);
+        if (n < 3)
+        {
+            continue;
+        }
+
+        q = PS2_SkyEmitFan(q, verts, n);
+        ++ps2_sky_fans;
+    }
+
+    // Empty tag with EOP to end the GIF packet.
+    q->dw[0] = PS2_GS_GIFTAG(0, 1, 0, 0, PS2_GIFTAG_PACKED, 0);
+    q->dw[1] = 0;
+    ++q;
+
+    dma_channel_send_normal(DMA_CHANNEL_GIF, ps2_sky.packet.data, (q - ps2_sky.packet.data), 0, 0);
+    dma_channel_wait(DMA_CHANNEL_GIF, 0);
+
+    ps2_sky_draw_usec = PS2_CyclesToMicrosec(PS2_CpuCycles() - start);
+}
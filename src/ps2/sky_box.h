@@ -0,0 +1,64 @@
+/* ================================================================================================
+ * -*- C -*-
+ * File: sky_box.h
+ * Brief: Sky box drawing. Bounds of the visible sky surfaces are gathered
+ *        during the world traversal, then only those parts of the six faces are drawn.
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#ifndef PS2_SKY_BOX_H
+#define PS2_SKY_BOX_H
+
+#include "ps2/ref_ps2.h"
+#include "ps2/model_load.h"
+#include "ps2/vec_mat.h"
+
+//
+// The six faces (env/<name>{rt,bk,lf,ft,up,dn}.tga, or the PCX if there's
+// no TGA) are loaded once by PS2_SkySet and kept in main memory as a single
+// 512x256 RGBA16 atlas, 128x128 per face, which is exactly the size of the
+// one VRam texture slot. Drawing a sky is then at most one upload per frame,
+// none if the atlas is still in VRam.
+//
+// Sky bounds are the same as ref_gl: each SURF_SKY polygon is clipped to the
+// six face frustums around the eye and the S/T range it covers on each face
+// is kept. Faces are drawn by the EE straight to the GS as textured fans,
+// clipped to the near plane and the guard band, at Z = 0. That is the farthest
+// depth for the GEQUAL Z test, so they only fill the pixels nothing else has
+// drawn to.
+//
+enum
+{
+    SKY_NUM_FACES     = 6,
+    SKY_FACE_SIZE     = 128, // Faces are 256x256 in the game data
+    SKY_ATLAS_WIDTH   = 512,
+    SKY_ATLAS_HEIGHT  = 256,
+    SKY_ATLAS_COLUMNS = SKY_ATLAS_WIDTH / SKY_FACE_SIZE
+};
+
+// Per frame sky stats for PS2_DrawRenderStats.
+extern int ps2_sky_polys;        // SURF_SKY polygons that reached the sky bounds
+extern int ps2_sky_faces;        // Faces drawn
+extern int ps2_sky_fans;         // Fans sent to the GS, after clipping
+extern int ps2_sky_clip_usec;    // Time spent clipping the sky polygons to the faces
+extern int ps2_sky_draw_usec;    // Time spent building and sending the faces, including the upload
+
+// Renderer startup/shutdown (PS2_ViewDrawInit).
+void PS2_SkyInit(void);
+void PS2_SkyShutdown(void);
+
+// refexport_t::SetSky. Loads the faces into the atlas, unless it already has them.
+void PS2_SkySet(const char * name, float rotate, const vec3_t axis);
+
+// Clears the bounds, before the world surfaces are gathered.
+void PS2_SkyBeginFrame(const refdef_t * view_def);
+
+// Grows the bounds with a visible SURF_SKY surface of the world.
+void PS2_SkyAddSurface(const ps2_mdl_surface_t * surf);
+
+// Draws the visible parts of the faces. 'view_proj' is the world to clip space matrix.
+void PS2_SkyDraw(const refdef_t * view_def, const m_mat4_t * view_proj);
+
+#endif // PS2_SKY_BOX_H
@@ -0,0 +1,404 @@
+/* ================================================================================================
+ * -*- C -*-
+ * File: sprite_draw.c
+ * Brief: Sprite, beam and null model drawing. Entities are queued as camera
+ *        facing quads during the entity pass and drawn on VU1 with the translucent ones.
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#include "common/q_common.h"
+#include "ps2/sprite_draw.h"
+#include "ps2/model_load.h"
+#include "ps2/vu1.h"
+#include "ps2/vu1_sprite.h"
+
+//=============================================================================
+//
+// Local sprite data:
+//
+//=============================================================================
+
+// Per frame sprite stats:
+int ps2_sprite_quads      = 0;
+int ps2_sprite_groups     = 0;
+int ps2_sprite_vu_batches = 0;
+
+// Every entity is at most one quad and one group.
+#define MAX_SPRITE_QUADS  MAX_ENTITIES
+#define MAX_SPRITE_GROUPS MAX_ENTITIES
+
+// Null models are a square this size, grey like ref_gl's.
+#define NULL_MODEL_SIZE   16
+#define NULL_MODEL_COLOR  128
+
+typedef enum
+{
+    SPR_GROUP_FRAME,
+    SPR_GROUP_BEAM,
+    SPR_GROUP_NULL
+} sprite_group_kind_t;
+
+typedef struct
+{
+    sprite_group_kind_t  kind;
+    ps2_teximage_t     * teximage;    // Null if untextured
+    const dsprframe_t  * frame;       // SPR_GROUP_FRAME only
+    int                  color[4];    // RGBA, 128 = 1.0 when textured
+    vec3_t               beam_start;  // SPR_GROUP_BEAM only
+    vec3_t               beam_end;
+    float                beam_diameter;
+    int                  first_quad;  // Linked through sprite_quad_t::next, -1 ends
+    int                  num_quads;
+    float                depth;       // Sum of the quads clip W, then the average
+} sprite_group_t;
+
+typedef struct
+{
+    ps2_vu_sprite_quad_t quad;
+    int                  next;
+} sprite_quad_t;
+
+static struct
+{
+    vec3_t         view_origin;
+    vec3_t         view_right;
+    vec3_t         view_up;
+    int            num_quads;
+    int            num_groups;
+    int            null_group;   // Shared by all the null models, -1 until one is queued
+    sprite_quad_t  quads[MAX_SPRITE_QUADS];
+    sprite_group_t groups[MAX_SPRITE_GROUPS];
+    int            draw_order[MAX_SPRITE_GROUPS];
+} ps2_sprites;
+
+// VIF stream for the batch being built. VU1_ListRaw copies it, so one is enough.
+static u32 ps2_sprite_vif_buffer[VU1_SPRITE_MAX_VIF_QW * 4] PS2_ALIGN(16);
+
+/*
+================
+PS2_SpriteNewGroup
+
+Remarks: Local function.
+Returns null if out of groups.
+================
+*/
+static sprite_group_t * PS2_SpriteNewGroup(sprite_group_kind_t kind)
+{
+    if (ps2_sprites.num_groups == MAX_SPRITE_GROUPS)
+    {
+        return NULL;
+    }
+
+    sprite_group_t * group = &ps2_sprites.groups[ps2_sprites.num_groups++];
+    memset(group, 0, sizeof(*group));
+    group->kind       = kind;
+    group->first_quad = -1;
+    return group;
+}
+
+/*
+================
+PS2_SpriteAddQuad
+
+Remarks: Local function.
+================
+*/
+static void PS2_SpriteAddQuad(sprite_group_t * group, const vec3_t pos, float size)
+{
+    if (ps2_sprites.num_quads == MAX_SPRITE_QUADS)
+    {
+        return;
+    }
+
+    const int index = ps2_sprites.num_quads++;
+    sprite_quad_t * quad = &ps2_sprites.quads[index];
+
+    VectorCopy(pos, quad->quad.pos);
+    quad->quad.size = size;
+    quad->next = group->first_quad;
+
+    group->first_quad = index;
+    ++group->num_quads;
+}
+
+/*
+================
+PS2_SpriteBeginFrame
+================
+*/
+void PS2_SpriteBeginFrame(const refdef_t * view_def)
+{
+    VectorCopy(view_def->vieworg, ps2_sprites.view_origin);
+    AngleVectors(view_def->viewangles, NULL, ps2_sprites.view_right, ps2_sprites.view_up);
+
+    ps2_sprites.num_quads  = 0;
+    ps2_sprites.num_groups = 0;
+    ps2_sprites.null_group = -1;
+
+    ps2_sprite_quads      = 0;
+    ps2_sprite_groups     = 0;
+    ps2_sprite_vu_batches = 0;
+}
+
+/*
+================
+PS2_SpriteAddModel
+
+Same frame, texture and alpha as ref_gl's R_DrawSpriteModel.
+================
+*/
+void PS2_SpriteAddModel(const entity_t * ent)
+{
+    int i;
+    const ps2_model_t * model = (const ps2_model_t *)ent->model;
+    const dsprite_t * sprite = (const dsprite_t *)model->hunk.base_ptr;
+
+    const int frame_num = ent->frame % sprite->numframes;
+    const dsprframe_t * frame = &sprite->frames[frame_num];
+    ps2_teximage_t * teximage = model->skins[frame_num];
+
+    const int alpha = (ent->flags & RF_TRANSLUCENT) ? (int)(ent->alpha * 128.0f) : 128;
+
+    sprite_group_t * group = NULL;
+    for (i = 0; i < ps2_sprites.num_groups; ++i)
+    {
+        sprite_group_t * g = &ps2_sprites.groups[i];
+        if (g->kind == SPR_GROUP_FRAME && g->frame == frame && g->teximage == teximage && g->color[3] == alpha)
+        {
+            group = g;
+            break;
+        }
+    }
+
+    if (group == NULL)
+    {
+        if ((group = PS2_SpriteNewGroup(SPR_GROUP_FRAME)) == NULL)
+        {
+            return;
+        }
+
+        group->teximage = teximage;
+        group->frame    = frame;
+        group->color[0] = 128;
+        group->color[1] = 128;
+        group->color[2] = 128;
+        group->color[3] = alpha;
+    }
+
+    PS2_SpriteAddQuad(group, ent->origin, 1.0f);
+}
+
+/*
+================
+PS2_SpriteAddBeam
+
+Same color and width as ref_gl's R_DrawBeam. The quad
+axes depend on the beam, so each one is a group.
+================
+*/
+void PS2_SpriteAddBeam(const entity_t * ent)
+{
+    sprite_group_t * group = PS2_SpriteNewGroup(SPR_GROUP_BEAM);
+    if (group == NULL)
+    {
+        return;
+    }
+
+    const u32 color = ps2_global_palette[ent->skinnum & 0xFF];
+    group->color[0] = (color >> 0)  & 0xFF;
+    group->color[1] = (color >> 8)  & 0xFF;
+    group->color[2] = (color >> 16) & 0xFF;
+    group->color[3] = (int)(ent->alpha * 128.0f);
+
+    VectorCopy(ent->origin,    group->beam_start);
+    VectorCopy(ent->oldorigin, group->beam_end);
+    group->beam_diameter = (float)ent->frame;
+
+    vec3_t middle;
+    VectorAdd(ent->origin, ent->oldorigin, middle);
+    VectorScale(middle, 0.5f, middle);
+    PS2_SpriteAddQuad(group, middle, 1.0f);
+}
+
+/*
+================
+PS2_SpriteAddNull
+================
+*/
+void PS2_SpriteAddNull(const entity_t * ent)
+{
+    sprite_group_t * group;
+
+    if (ps2_sprites.null_group >= 0)
+    {
+        group = &ps2_sprites.groups[ps2_sprites.null_group];
+    }
+    else
+    {
+        if ((group = PS2_SpriteNewGroup(SPR_GROUP_NULL)) == NULL)
+        {
+            return;
+        }
+
+        group->color[0] = NULL_MODEL_COLOR;
+        group->color[1] = NULL_MODEL_COLOR;
+        group->color[2] = NULL_MODEL_COLOR;
+        group->color[3] = 128;
+        ps2_sprites.null_group = ps2_sprites.num_groups - 1;
+    }
+
+    PS2_SpriteAddQuad(group, ent->origin, 1.0f);
+}
+
+/*
+================
+PS2_SpriteCompareGroups
+
+Remarks: Local function.
+qsort() callback. Farthest group first.
+================
+*/
+static int PS2_SpriteCompareGroups(const void * a, const void * b)
+{
+    const float da = ps2_sprites.groups[*(const int *)a].depth;
+    const float db = ps2_sprites.groups[*(const int *)b].depth;
+
+    if (da > db) { return -1; }
+    if (da < db) { return  1; }
+    return 0;
+}
+
+/*
+================
+PS2_SpriteSendBatch
+
+Remarks: Local function.
+================
+*/
+static void PS2_SpriteSendBatch(int num_quads, qboolean wait_end)
+{
+    const int vif_qw = VU1_SpriteEndBatch(ps2_sprite_vif_buffer, num_quads, wait_end);
+    VU1_Begin();
+    VU1_ListRaw(ps2_sprite_vif_buffer, vif_qw);
+    VU1_End(-1); // The stream already has the MSCAL.
+    ++ps2_sprite_vu_batches;
+}
+
+/*
+================
+PS2_SpriteDraw
+================
+*/
+void PS2_SpriteDraw(const m_mat4_t * view_proj)
+{
+    int i, q;
+
+    if (ps2_sprites.num_groups == 0)
+    {
+        return;
+    }
+
+    //
+    // Average clip space W of the quads in each group. Only
+    // the groups are sorted, the quads go in any order.
+    //
+    for (i = 0; i < ps2_sprites.num_groups; ++i)
+    {
+        sprite_group_t * group = &ps2_sprites.groups[i];
+        float depth = 0.0f;
+
+        for (q = group->first_quad; q >= 0; q = ps2_sprites.quads[q].next)
+        {
+            const float * pos = ps2_sprites.quads[q].quad.pos;
+            depth += pos[0] * view_proj->m[0][3] + pos[1] * view_proj->m[1][3] +
+                     pos[2] * view_proj->m[2][3] + view_proj->m[3][3];
+        }
+
+        group->depth = (group->num_quads > 0) ? depth / (float)group->num_quads : 0.0f;
+        ps2_sprites.draw_order[i] = i;
+    }
+
+    qsort(ps2_sprites.draw_order, ps2_sprites.num_groups, sizeof(int), &PS2_SpriteCompareGroups);
+
+    ps2_vu_sprite_consts_t consts;
+    ps2_vu_sprite_quad_t * quads = NULL;
+    const ps2_teximage_t * bound_teximage = NULL;
+    int num_quads = 0;
+
+    for (i = 0; i < ps2_sprites.num_groups; ++i)
+    {
+        const sprite_group_t * group = &ps2_sprites.groups[ps2_sprites.draw_order[i]];
+        if (group->num_quads == 0)
+        {
+            continue;
+        }
+
+        // The GS has to be done with the last batch before a texture upload.
+        const qboolean new_teximage = (group->teximage != NULL && group->teximage != bound_teximage);
+        if (quads != NULL)
+        {
+            PS2_SpriteSendBatch(num_quads, new_teximage);
+            quads = NULL;
+        }
+
+        if (new_teximage)
+        {
+            VU1_Wait();
+            PS2_TexImageVRamUpload(group->teximage);
+            PS2_TexImageBindImmediate();
+            bound_teximage = group->teximage;
+        }
+
+        VU1_SpriteSetupConsts(&consts, view_proj, group->color, group->teximage != NULL);
+
+        switch (group->kind)
+        {
+        case SPR_GROUP_FRAME :
+            VU1_SpriteSetupFrame(&consts, ps2_sprites.view_right, ps2_sprites.view_up,
+                                 group->frame->width, group->frame->height,
+                                 group->frame->origin_x, group->frame->origin_y);
+            break;
+
+        case SPR_GROUP_BEAM :
+            VU1_SpriteSetupBeam(&consts, group->beam_start, group->beam_end,
+                                group->beam_diameter, ps2_sprites.view_origin);
+            break;
+
+        case SPR_GROUP_NULL :
+            VU1_SpriteSetupFrame(&consts, ps2_sprites.view_right, ps2_sprites.view_up,
+                                 NULL_MODEL_SIZE, NULL_MODEL_SIZE,
+                                 NULL_MODEL_SIZE / 2, NULL_MODEL_SIZE / 2);
+            break;
+        } // switch (group->kind)
+
+        for (q = group->first_quad; q >= 0; q = ps2_sprites.quads[q].next)
+        {
+            if (quads == NULL || num_quads == VU1_SPRITE_MAX_QUADS)
+            {
+                if (quads != NULL)
+                {
+                    PS2_SpriteSendBatch(num_quads, false);
+                }
+                quads = VU1_SpriteBeginBatch(ps2_sprite_vif_buffer, &consts);
+                num_quads = 0;
+            }
+
+            quads[num_quads++] = ps2_sprites.quads[q].quad;
+        }
+
+        ps2_sprite_quads += group->num_quads;
+        ++ps2_sprite_groups;
+    }
+
+    if (quads != NULL)
+    {
+        PS2_SpriteSendBatch(num_quads, true);
+        VU1_Wait();
+    }
+
+    ps2_sprites.num_quads  = 0;
+    ps2_sprites.num_groups = 0;
+    ps2_sprites.null_group = -1;
+}
@@ -0,0 +1,45 @@
+/* ================================================================================================
+ * -*- C -*-
+ * File: sprite_draw.h
+ * Brief: Sprite, beam and null model drawing. Entities are queued as camera
+ *        facing quads during the entity pass and drawn on VU1 with the translucent ones.
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#ifndef PS2_SPRITE_DRAW_H
+#define PS2_SPRITE_DRAW_H
+
+#include "ps2/ref_ps2.h"
+#include "ps2/vec_mat.h"
+
+//
+// Quads are grouped by what the VU sprite program has per batch (vu1_sprite.h):
+// sprite frames with the same texture, size, origin and alpha go together,
+// all the null models are one group and each beam is a group of its own.
+// The quads of a group only cost the VU a qword each (position and size),
+// the corners are made from the view vectors there.
+//
+// Groups are drawn back to front by the average clip space W of their
+// quads, after the solid entities and before the translucent surfaces.
+// Quads inside a group are not sorted.
+//
+
+// Per frame sprite stats for PS2_DrawRenderStats.
+extern int ps2_sprite_quads;      // Quads queued (sprites, beams and null models)
+extern int ps2_sprite_groups;     // Groups drawn
+extern int ps2_sprite_vu_batches; // VU1 program runs
+
+// Clears the queue, before the entities are drawn.
+void PS2_SpriteBeginFrame(const refdef_t * view_def);
+
+// Queue an entity. Null models draw as small grey squares.
+void PS2_SpriteAddModel(const entity_t * ent);
+void PS2_SpriteAddBeam(const entity_t * ent);
+void PS2_SpriteAddNull(const entity_t * ent);
+
+// Draws and clears the queue. 'view_proj' is the world to clip space matrix.
+void PS2_SpriteDraw(const m_mat4_t * view_proj);
+
+#endif // PS2_SPRITE_DRAW_H
@@ -23,6 +23,7 @@
 #include <smod.h>
 #include <sifrpc.h>
 #include <loadfile.h>
+#include <sbv_patches.h>
 
 static
 void Kputc(char c) {
@@ -54,6 +55,42 @@ enum
 //
 //=============================================================================
 
+#ifdef PS2_USE_SOCKETS
+// IOP modules embedded by the Makefile (IRX_FILES), made with bin2c.
+extern unsigned char ps2dev9_irx[];
+extern unsigned int size_ps2dev9_irx;
+extern unsigned char netman_irx[];
+extern unsigned int size_netman_irx;
+extern unsigned char smap_irx[];
+extern unsigned int size_smap_irx;
+#endif // PS2_USE_SOCKETS
+
+/*
+================
+Sys_LoadIOPModule
+
+Remarks: Local function.
+Starts an IRX embedded in the executable. Returns false if
+the module failed to load or didn't stay resident on the IOP.
+================
+*/
+#ifdef PS2_USE_SOCKETS
+static qboolean Sys_LoadIOPModule(const char * name, void * irx, unsigned int irx_size)
+{
+    int ret = 0;
+    const int id = SifExecModuleBuffer(irx, irx_size, 0, NULL, &ret);
+
+    if (id < 0 || ret == 1) // 1 = NO_RESIDENT_END, the module unloaded itself
+    {
+        Com_Printf("WARNING: Failed to load IOP module '%s' (id %d, ret %d)\n", name, id, ret);
+        return false;
+    }
+
+    Com_DPrintf("Loaded IOP module '%s' (id %d)\n", name, id);
+    return true;
+}
+#endif // PS2_USE_SOCKETS
+
 /*
 ================
 Sys_LoadIOPModules
@@ -61,7 +98,20 @@ Sys_LoadIOPModules
 */
 void Sys_LoadIOPModules(void)
 {
-
+#ifdef PS2_USE_SOCKETS
+    // Needed to load modules from EE memory.
+    sbv_patch_enable_lmb();
+
+    // Network adapter: DEV9 expansion bay, then the NETMAN
+    // interface and the SMAP Ethernet driver that plugs into it.
+    if (!Sys_LoadIOPModule("ps2dev9", ps2dev9_irx, size_ps2dev9_irx) ||
+        !Sys_LoadIOPModule("netman",  netman_irx,  size_netman_irx)  ||
+        !Sys_LoadIOPModule("smap",    smap_irx,    size_smap_irx))
+    {
+        // NET_Init leaves UDP off, only the loopback will work.
+        Cvar_ForceSet("noudp", "1");
+    }
+#endif // PS2_USE_SOCKETS
 }
 
 /*
@@ -265,6 +315,74 @@ int Sys_Milliseconds(void)
 	return curtime;
 }
 
+/*
+================
+Sys_Microseconds
+
+Same clock as Sys_Milliseconds, which ticks a lot faster than once
+per millisecond. Wraps around, so only differences are meaningful.
+================
+*/
+unsigned int Sys_Microseconds(void)
+{
+	return (unsigned int)((u64)clock() * 1000000 / CLOCKS_PER_SEC);
+}
+
+/*
+================
+Sys_SleepMsec
+
+Puts the main thread to sleep on a semaphore that a kernel alarm
+signals once the time is up, so the EE is free for other threads
+instead of spinning on the clock. Alarm times are in H-sync ticks.
+================
+*/
+static int sys_sleep_sema = -1;
+
+static void Sys_SleepAlarmHandler(s32 alarm_id, u16 time, void * arg)
+{
+    (void)alarm_id;
+    (void)time;
+    iSignalSema(*(int *)arg);
+    ExitHandler();
+}
+
+void Sys_SleepMsec(int msec)
+{
+    enum
+    {
+        HSYNCS_PER_SEC = 15734, // NTSC, PAL is slightly less (15625)
+        MAX_ALARM_MSEC = 4000   // alarm time is a u16 count of H-syncs
+    };
+
+    if (msec <= 0)
+    {
+        return;
+    }
+    if (msec > MAX_ALARM_MSEC)
+    {
+        msec = MAX_ALARM_MSEC;
+    }
+
+    if (sys_sleep_sema < 0)
+    {
+        ee_sema_t sema;
+        sema.init_count = 0;
+        sema.max_count  = 1;
+        sema.option     = 0;
+        sys_sleep_sema  = CreateSema(&sema);
+        if (sys_sleep_sema < 0)
+        {
+            return;
+        }
+    }
+
+    if (SetAlarm((u16)((msec * HSYNCS_PER_SEC) / 1000), &Sys_SleepAlarmHandler, &sys_sleep_sema) >= 0)
+    {
+        WaitSema(sys_sleep_sema);
+    }
+}
+
 /*
 ================
 Sys_ConsoleInput
@@ -13,6 +13,7 @@
 #include "ps2/ref_ps2.h"
 #include "ps2/mem_alloc.h"
 #include "common/q_files.h"
+#include "common/q_lzss.h"
 
 #include <draw.h>
 #include <gs_psm.h>
@@ -21,48 +22,39 @@
 // Built-in images found in src/ps2/builtin/
 //
 // These are common UI textures like the console
-// chars and overlays that I've dumped as raw
-// arrays of bytes from the originals found in
-// pak0.pak. The ones with no transparency are
-// stored as uint16s to save space, conchars.pcx
-// is saved as an array of RGBA bytes.
+// chars and overlays that I've dumped from the
+// originals found in pak0.pak. They are stored as
+// LZ compressed 8-bit palette indexes and only get
+// unpacked (see PS2_TexImageUnpackBuiltin) when first
+// uploaded. The ones with no transparency expand to
+// uint16s, conchars.pcx expands to RGBA bytes. Unpacked
+// pixels are freed again once an image goes unused.
 //
 // I've embedded these mostly to facilitate testing,
 // since it makes the executable stand-alone and we
 // can still draw the console nicely. There's an imgdump.c
 // file that is the tool used to read the PCX images
-// and dump the pixels as arrays of bytes.
+// and dump the packed pixels as arrays of bytes.
 //
 // ps2_global_palette is also generated by it from colormap.pcx.
 //
 
-// conchars.pcx RGBA-32:
-extern const int conchars_width;
-extern const int conchars_height;
-extern const byte conchars_data[];
-
-// conback.pcx RGB-16:
-extern const int conback_width;
-extern const int conback_height;
-extern const byte conback_data[];
-
-// inventory.pcx RGB-16:
-extern const int inventory_width;
-extern const int inventory_height;
-extern const byte inventory_data[];
-
-// help.pcx RGB-16:
-extern const int help_width;
-extern const int help_height;
-extern const byte help_data[];
-
-// backtile.pcx RGB-16:
-extern const int backtile_width;
-extern const int backtile_height;
-extern const byte backtile_data[];
-
-// These are always available in main RAM, since the
-// texture data comes directly from the above arrays.
+#define EXTERN_BUILTIN_IMAGE(name)            \
+    extern const int name##_width;            \
+    extern const int name##_height;           \
+    extern const int name##_packed_size;      \
+    extern const byte name##_packed[]
+
+EXTERN_BUILTIN_IMAGE(conchars);  // RGBA-32
+EXTERN_BUILTIN_IMAGE(conback);   // RGB-16
+EXTERN_BUILTIN_IMAGE(inventory); // RGB-16
+EXTERN_BUILTIN_IMAGE(help);      // RGB-16
+EXTERN_BUILTIN_IMAGE(backtile);  // RGB-16
+
+#undef EXTERN_BUILTIN_IMAGE
+
+// These are always registered, but their pixels
+// are only resident in main RAM while in use.
 ps2_teximage_t * ps2_builtin_tex_conchars  = NULL;
 ps2_teximage_t * ps2_builtin_tex_conback   = NULL;
 ps2_teximage_t * ps2_builtin_tex_inventory = NULL;
@@ -70,6 +62,42 @@ ps2_teximage_t * ps2_builtin_tex_help      = NULL;
 ps2_teximage_t * ps2_builtin_tex_backtile  = NULL;
 ps2_teximage_t * ps2_builtin_tex_debug     = NULL;
 
+typedef struct
+{
+    ps2_teximage_t ** teximage;
+    const char *      name;
+    const int *       width;
+    const int *       height;
+    const int *       packed_size;
+    const byte *      packed;
+    int               components;
+    int               psm;
+    int               last_used; // Sys_Milliseconds() of the last upload.
+} ps2_packed_builtin_t;
+
+#define PACKED_BUILTIN(name, components, psm) \
+    { &ps2_builtin_tex_##name, "pics/" #name ".pcx", &name##_width, &name##_height, \
+      &name##_packed_size, name##_packed, components, psm, 0 }
+
+static ps2_packed_builtin_t ps2_packed_builtins[] =
+{
+    PACKED_BUILTIN(inventory, TEXTURE_COMPONENTS_RGB,  GS_PSM_16),
+    PACKED_BUILTIN(help,      TEXTURE_COMPONENTS_RGB,  GS_PSM_16),
+    PACKED_BUILTIN(conback,   TEXTURE_COMPONENTS_RGB,  GS_PSM_16),
+    PACKED_BUILTIN(backtile,  TEXTURE_COMPONENTS_RGB,  GS_PSM_16),
+    PACKED_BUILTIN(conchars,  TEXTURE_COMPONENTS_RGBA, GS_PSM_32)
+};
+
+#undef PACKED_BUILTIN
+
+enum
+{
+    NUM_PACKED_BUILTINS = sizeof(ps2_packed_builtins) / sizeof(ps2_packed_builtins[0]),
+
+    // Unpacked built-ins not uploaded for this long are freed.
+    BUILTIN_RELEASE_MSEC = 5000
+};
+
 // Stats for debug printing:
 int ps2_teximages_used         = 0;
 int ps2_teximage_cache_hits    = 0;
@@ -83,7 +111,7 @@ int ps2_teximage_load_time     = 0;
 static cvar_t * r_ps2_skip_skin_tex_load   = NULL;
 static cvar_t * r_ps2_skip_sprite_tex_load = NULL;
 static cvar_t * r_ps2_skip_wall_tex_load   = NULL;
-static cvar_t * r_ps2_skip_sky_tex_load    = NULL;
+static cvar_t * r_ps2_skip_sky_tex_load    = NULL; // Checked by PS2_SkySet, no sky gets drawn
 static cvar_t * r_ps2_skip_pic_tex_load    = NULL;
 
 //=============================================================================
@@ -96,9 +124,6 @@ static cvar_t * r_ps2_skip_pic_tex_load    = NULL;
 #define RGBA16(r, g, b, a) \
     ((((a) & 0x1) << 15) | (((b) >> 3) << 10) | (((g) >> 3) << 5) | ((r) >> 3))
 
-// Used for image name hashing.
-extern u32 Sys_HashString(const char * str);
-
 /*
 ==============
 MakeCheckerPattern
@@ -150,7 +175,7 @@ void PS2_TexImageInit(void)
     r_ps2_skip_skin_tex_load   = Cvar_Get("r_ps2_skip_skin_tex_load",   "1", 0);
     r_ps2_skip_sprite_tex_load = Cvar_Get("r_ps2_skip_sprite_tex_load", "1", 0);
     r_ps2_skip_wall_tex_load   = Cvar_Get("r_ps2_skip_wall_tex_load",   "1", 0);
-    r_ps2_skip_sky_tex_load    = Cvar_Get("r_ps2_skip_sky_tex_load",    "1", 0);
+    r_ps2_skip_sky_tex_load    = Cvar_Get("r_ps2_skip_sky_tex_load",    "0", 0);
     r_ps2_skip_pic_tex_load    = Cvar_Get("r_ps2_skip_pic_tex_load",    "0", 0);
 
     //
@@ -162,30 +187,18 @@ void PS2_TexImageInit(void)
                       TEXTURE_COMPONENTS_RGB, TEXTURE_FUNCTION_MODULATE, GS_PSM_16,
                       LOD_MAG_NEAREST, LOD_MIN_NEAREST, IT_BUILTIN, (byte *)MakeCheckerPattern());
 
-    ps2_builtin_tex_inventory = PS2_TexImageAlloc();
-    PS2_TexImageSetup(ps2_builtin_tex_inventory, "pics/inventory.pcx", inventory_width, inventory_height,
-                      TEXTURE_COMPONENTS_RGB, TEXTURE_FUNCTION_MODULATE, GS_PSM_16,
-                      LOD_MAG_NEAREST, LOD_MIN_NEAREST, IT_BUILTIN, (byte *)inventory_data);
-
-    ps2_builtin_tex_help = PS2_TexImageAlloc();
-    PS2_TexImageSetup(ps2_builtin_tex_help, "pics/help.pcx", help_width, help_height,
-                      TEXTURE_COMPONENTS_RGB, TEXTURE_FUNCTION_MODULATE, GS_PSM_16,
-                      LOD_MAG_NEAREST, LOD_MIN_NEAREST, IT_BUILTIN, (byte *)help_data);
-
-    ps2_builtin_tex_conback = PS2_TexImageAlloc();
-    PS2_TexImageSetup(ps2_builtin_tex_conback, "pics/conback.pcx", conback_width, conback_height,
-                      TEXTURE_COMPONENTS_RGB, TEXTURE_FUNCTION_MODULATE, GS_PSM_16,
-                      LOD_MAG_NEAREST, LOD_MIN_NEAREST, IT_BUILTIN, (byte *)conback_data);
-
-    ps2_builtin_tex_backtile = PS2_TexImageAlloc();
-    PS2_TexImageSetup(ps2_builtin_tex_backtile, "pics/backtile.pcx", backtile_width,backtile_height,
-                      TEXTURE_COMPONENTS_RGB, TEXTURE_FUNCTION_MODULATE, GS_PSM_16,
-                      LOD_MAG_NEAREST, LOD_MIN_NEAREST, IT_BUILTIN, (byte *)backtile_data);
-
-    ps2_builtin_tex_conchars = PS2_TexImageAlloc();
-    PS2_TexImageSetup(ps2_builtin_tex_conchars, "pics/conchars.pcx", conchars_width, conchars_height,
-                      TEXTURE_COMPONENTS_RGBA, TEXTURE_FUNCTION_MODULATE, GS_PSM_32,
-                      LOD_MAG_NEAREST, LOD_MIN_NEAREST, IT_BUILTIN, (byte *)conchars_data);
+    int i;
+    for (i = 0; i < NUM_PACKED_BUILTINS; ++i)
+    {
+        ps2_packed_builtin_t * builtin = &ps2_packed_builtins[i];
+
+        // No pixels yet, PS2_TexImageVRamUpload unpacks them on demand.
+        *builtin->teximage = PS2_TexImageAlloc();
+        PS2_TexImageSetup(*builtin->teximage, builtin->name, *builtin->width, *builtin->height,
+                          builtin->components, TEXTURE_FUNCTION_MODULATE, builtin->psm,
+                          LOD_MAG_NEAREST, LOD_MIN_NEAREST, IT_BUILTIN, NULL);
+        builtin->last_used = 0;
+    }
 }
 
 /*
@@ -206,9 +219,108 @@ void PS2_TexImageShutdown(void)
         }
         PS2_TexImageFree(teximage_iter);
     }
+    PS2_TexImageReleaseBuiltins(true);
     ps2_teximages_used = 0;
 }
 
+/*
+==============
+PS2_TexImageUnpackBuiltin
+
+Called by PS2_TexImageVRamUpload for every built-in image.
+Expands the packed pixels on first use and refreshes the
+last used time so PS2_TexImageReleaseBuiltins keeps them.
+==============
+*/
+void PS2_TexImageUnpackBuiltin(ps2_teximage_t * teximage)
+{
+    int i;
+    ps2_packed_builtin_t * builtin = NULL;
+
+    for (i = 0; i < NUM_PACKED_BUILTINS; ++i)
+    {
+        if (*ps2_packed_builtins[i].teximage == teximage)
+        {
+            builtin = &ps2_packed_builtins[i];
+            break;
+        }
+    }
+
+    if (builtin == NULL) // Debug checker or cinematic, not packed.
+    {
+        return;
+    }
+
+    builtin->last_used = Sys_Milliseconds();
+    if (teximage->pic != NULL)
+    {
+        return;
+    }
+
+    const int start_time  = builtin->last_used;
+    const int pixel_count = teximage->width * teximage->height;
+    const int bytes_pp    = (teximage->texbuf.psm == GS_PSM_32) ? 4 : 2;
+
+    byte * pic8 = PS2_MemAlloc(pixel_count, MEMTAG_TEXIMAGE);
+    if (LZ_Decompress(builtin->packed, *builtin->packed_size, pic8, pixel_count) != pixel_count)
+    {
+        Sys_Error("Built-in image %s is corrupt!", teximage->name);
+    }
+
+    teximage->pic = PS2_MemAllocAligned(16, pixel_count * bytes_pp, MEMTAG_TEXIMAGE);
+    if (bytes_pp == 4)
+    {
+        Img_UnPalettize32(teximage->width, teximage->height, pic8, ps2_global_palette, teximage->pic);
+    }
+    else
+    {
+        Img_UnPalettize16(teximage->width, teximage->height, pic8, ps2_global_palette, teximage->pic);
+    }
+
+    PS2_MemFree(pic8, pixel_count, MEMTAG_TEXIMAGE);
+
+    Com_DPrintf("Unpacked %s: %d bytes from %d in %d ms\n", teximage->name,
+                pixel_count * bytes_pp, *builtin->packed_size, Sys_Milliseconds() - start_time);
+}
+
+/*
+==============
+PS2_TexImageReleaseBuiltins
+
+Frees the unpacked pixels of built-in images that have
+not been uploaded for a while, or all of them if forced.
+==============
+*/
+void PS2_TexImageReleaseBuiltins(qboolean force)
+{
+    int i;
+    const int now = Sys_Milliseconds();
+
+    for (i = 0; i < NUM_PACKED_BUILTINS; ++i)
+    {
+        ps2_packed_builtin_t * builtin = &ps2_packed_builtins[i];
+        ps2_teximage_t * teximage = *builtin->teximage;
+
+        if (teximage == NULL || teximage->pic == NULL)
+        {
+            continue;
+        }
+        if (!force && (teximage == ps2ref.current_tex || (now - builtin->last_used) < BUILTIN_RELEASE_MSEC))
+        {
+            continue;
+        }
+
+        if (teximage == ps2ref.current_tex)
+        {
+            ps2ref.current_tex = NULL;
+        }
+
+        const int bytes_pp = (teximage->texbuf.psm == GS_PSM_32) ? 4 : 2;
+        PS2_MemFree(teximage->pic, teximage->width * teximage->height * bytes_pp, MEMTAG_TEXIMAGE);
+        teximage->pic = NULL;
+    }
+}
+
 /*
 ==============
 PS2_TexImageAlloc
@@ -713,14 +825,22 @@ PS2_TexImageSetup
 void PS2_TexImageSetup(ps2_teximage_t * teximage, const char * name, int w, int h, int components,
                        int func, int psm, int mag_filter, int min_filter, ps2_imagetype_t type, byte * pic)
 {
-    if (w <= 0 || w > MAX_TEXIMAGE_SIZE)
+    // Up to twice MAX_TEXIMAGE_SIZE on a side is fine for the smaller pixel
+    // formats, as long as it fits the 256x256 RGBA32 VRam slot. The 512x256
+    // RGBA16 sky atlas (sky_box.c) is the only one that needs it.
+    const int bytes_pp = (psm == GS_PSM_32) ? 4 : ((psm == GS_PSM_16) ? 2 : 1);
+    if (w <= 0 || w > MAX_TEXIMAGE_SIZE * 2)
     {
         Sys_Error("Bad texture width (%d) for %s!", w, name);
     }
-    if (h <= 0 || h > MAX_TEXIMAGE_SIZE)
+    if (h <= 0 || h > MAX_TEXIMAGE_SIZE * 2)
     {
         Sys_Error("Bad texture height (%d) for %s!", h, name);
     }
+    if (w * h * bytes_pp > MAX_TEXIMAGE_SIZE * MAX_TEXIMAGE_SIZE * 4)
+    {
+        Sys_Error("Texture %s (%dx%d) doesn't fit in VRam!", name, w, h);
+    }
 
     // All textures must share the same VRam space.
     // What this means is that we only have enough VRam
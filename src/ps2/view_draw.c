@@ -17,6 +17,16 @@
 #include "ps2/math_funcs.h"
 #include "ps2/vec_mat.h"
 #include "ps2/vu1.h"
+#include "ps2/vu1_alias.h"
+#include "ps2/vu1_clip.h"
+#include "ps2/vu1_warp.h"
+#include "ps2/vu1_dlight.h"
+#include "ps2/vu1_sprite.h"
+#include "ps2/vis_cache.h"
+#include "ps2/frustum_cull.h"
+#include "ps2/ent_xform.h"
+#include "ps2/sky_box.h"
+#include "ps2/sprite_draw.h"
 #include "ps2/gs_defs.h"
 
 #define VU_DATA_SECTION __attribute__((section(".vudata")))
@@ -52,6 +62,25 @@ int ps2_view_cluster2     = -1;
 int ps2_old_view_cluster  = -1;
 int ps2_old_view_cluster2 = -1;
 
+// World texture chain stats for the last frame (PS2_DrawRenderStats):
+int ps2_world_tex_chains        = 0; // Textures with surfaces to draw
+int ps2_world_tex_slots_skipped = 0; // teximages[] slots not visited
+int ps2_world_tex_switches      = 0; // Chains drawn with a texture other than the one in VRam
+
+// World traversal stats for the last frame, when the cached cluster lists are used:
+int ps2_world_leafs_culled   = 0; // PVS leafs out of the frustum or in a closed area
+int ps2_world_surfs_backface = 0; // Surfaces of the leafs left that face away
+
+// Warp and translucent surfaces for the last frame (PS2_DrawRenderStats):
+int ps2_warp_surfs_drawn  = 0; // Opaque SURF_DRAWTURB surfaces
+int ps2_alpha_surfs_drawn = 0; // SURF_TRANS33/SURF_TRANS66 surfaces, sorted back to front
+int ps2_warp_vu_batches   = 0; // VU1 batches of the two above
+
+// Dynamic lights:
+int ps2_dlights_active    = 0; // Lights of the frame, zero with r_ps2_dlights off
+int ps2_dlight_surfs      = 0; // Surfaces reached by them (PS2_MarkLights)
+int ps2_dlight_vu_batches = 0; // World/brush batches that ran the lighting program
+
 // Scene viewer/camera:
 static m_vec4_t ps2_camera_origin;
 static m_vec4_t ps2_camera_lookat;
@@ -67,7 +96,116 @@ static m_mat4_t ps2_view_proj_matrix;
 static m_mat4_t ps2_mvp_matrix;
 
 // View frustum for the frame, so we can cull bounding boxes out of view.
+// ps2_cull_frustum has the same planes laid out for PS2_FrustumCull*.
 static cplane_t ps2_frustum[4];
+static ps2_frustum_t ps2_cull_frustum;
+
+// Alias models drawn this frame and VU1 batches they took.
+static int ps2_alias_models_drawn = 0;
+static int ps2_alias_vu_batches   = 0;
+
+// Brush models (doors, platforms, etc) that passed the frustum test, drawn
+// after the other solid entities by PS2_DrawBrushModels, grouped by transform.
+typedef struct
+{
+    const entity_t * ent;
+    ps2_ent_xform_t xform;
+} ps2_brush_draw_t;
+
+static ps2_brush_draw_t ps2_brush_draws[MAX_ENTITIES];
+static int ps2_num_brush_draws     = 0;
+static int ps2_brush_models_drawn  = 0;
+static int ps2_brush_models_culled = 0;
+static int ps2_brush_groups        = 0; // Runs of texture chains, one per transform
+
+//
+// Surfaces drawn by the textured warp program (vu1_warp.h). Opaque SURF_DRAWTURB
+// ones go with the texture chains of the same model. Translucent ones are kept
+// for the whole frame with the transform of their model, then sorted far to near
+// and drawn after the solid entities, like ref_gl's R_DrawAlphaSurfaces.
+//
+typedef struct
+{
+    const ps2_mdl_surface_t * surf;
+    ps2_teximage_t * teximage;
+    int   mvp_index; // Into ps2_alpha_mvps[] (0 is the world), always 0 for the opaque ones
+    int   alpha;     // 128 is opaque
+    float depth;     // Clip space W of the surface center
+} ps2_warp_draw_t;
+
+enum
+{
+    MAX_WARP_DRAWS  = 512,
+    MAX_ALPHA_DRAWS = 512
+};
+
+static ps2_warp_draw_t ps2_warp_draws[MAX_WARP_DRAWS];
+static ps2_warp_draw_t ps2_alpha_draws[MAX_ALPHA_DRAWS];
+static int ps2_num_warp_draws  = 0;
+static int ps2_num_alpha_draws = 0;
+
+static m_mat4_t ps2_alpha_mvps[MAX_ENTITIES + 1];
+static int ps2_num_alpha_mvps  = 0;
+static int ps2_alpha_mvp_index = 0; // For the surfaces PS2_AddSurfaceToChains gets next
+
+static u32 ps2_warp_vif_buffer[VU1_WARP_MAX_VIF_QW * 4] PS2_ALIGN(16);
+static float ps2_view_time = 0.0f;
+
+//
+// Dynamic lights of the frame (vu1_dlight.h). The origins are in the space of the
+// model being drawn, the world or a group of brush models. World batches with
+// surfaces the lights reach upload them and add them to the vertex colors on VU1.
+//
+static const dlight_t * ps2_dlights = NULL;
+static vec3_t ps2_dlight_origins[MAX_DLIGHTS];
+static cvar_t * r_ps2_dlights = NULL;
+static cvar_t * r_ps2_dlight_bench = NULL;
+
+// Same as ref_gl, for the brush model surfaces.
+#define BACKFACE_EPSILON 0.01f
+
+// VIF stream for the alias batch being built. VU1_ListRaw copies it, so one is enough.
+static u32 ps2_alias_vif_buffer[VU1_ALIAS_MAX_VIF_QW * 4] PS2_ALIGN(16);
+
+// Alias model lighting, in GS color units (128 = 1.0).
+static const float ALIAS_AMBIENT_COLOR    = 64.0f;
+static const float ALIAS_DIFFUSE_COLOR    = 128.0f;
+static const float ALIAS_FULLBRIGHT_COLOR = 128.0f;
+static const float ALIAS_ALPHA            = 128.0f;
+
+// RF_TRANSLUCENT brush models are drawn at a quarter alpha, as in ref_gl.
+static const int BRUSH_TRANSLUCENT_ALPHA = 32;
+
+// Textures that got a surface chain this frame, in the order they were first
+// reached, so PS2_DrawTextureChains doesn't scan all of the teximages[].
+static ps2_teximage_t * ps2_chained_teximages[MAX_TEXIMAGES];
+static int ps2_num_chained_teximages = 0;
+
+// World batches are clipped to the guard band on VU1 when set,
+// otherwise triangles touching the clip volume edges are dropped.
+static cvar_t * r_ps2_guard_clip = NULL;
+
+// Set to 1 to write the world batches of the next frame to
+// <gamedir>/vubatches.bin, for the host side clipper check (tools/vuclip.c).
+static cvar_t * r_ps2_vu_capture = NULL;
+static FILE * ps2_vu_capture_file = NULL;
+static int ps2_vu_captured_batches = 0;
+
+// The cached cluster lists (vis_cache.c) don't update the leaf/node vis_frame,
+// so PS2_MarkLeaves has to redo them the next time the BSP walk is used.
+static qboolean ps2_leaf_marks_valid = false;
+
+// Set r_ps2_vis_record to 1 to record the camera path, back to 0 writes it to
+// <gamedir>/vispath.bin. r_ps2_vis_bench set to 1 replays that path through
+// both world traversals and prints the timings (PS2_RunVisBenchmark).
+static cvar_t * r_ps2_vis_record = NULL;
+static cvar_t * r_ps2_vis_bench  = NULL;
+static ps2_vis_path_frame_t * ps2_vis_path = NULL;
+static int ps2_vis_path_frames = 0;
+
+// Set to 1 to time the box tests over all nodes and leafs of the world with
+// the current frustum, and compare the VU0 results with BOX_ON_PLANE_SIDE.
+static cvar_t * r_ps2_cull_bench = NULL;
 
 // Buffer to decompress a cluster PVS.
 // Alignment not strictly necessary, but might help the compiler since PS2 likes aligned data.
@@ -150,15 +288,7 @@ and should be culled. False if visible and allowed to draw.
 */
 static inline qboolean PS2_ShouldCullBBox(vec3_t mins, vec3_t maxs)
 {
-    int i;
-    for (i = 0; i < 4; ++i)
-    {
-        if (BOX_ON_PLANE_SIDE(mins, maxs, &ps2_frustum[i]) == 2)
-        {
-            return true;
-        }
-    }
-    return false;
+    return PS2_FrustumCullBox(&ps2_cull_frustum, mins, maxs);
 }
 
 /*
@@ -166,11 +296,12 @@ static inline qboolean PS2_ShouldCullBBox(vec3_t mins, vec3_t maxs)
 PS2_DrawNullModel
 
 Remarks: Local function.
+Queued, drawn by PS2_SpriteDraw with the translucent entities.
 ================
 */
 static void PS2_DrawNullModel(const entity_t * ent)
 {
-    //TODO
+    PS2_SpriteAddNull(ent);
 }
 
 /*
@@ -178,11 +309,12 @@ static void PS2_DrawNullModel(const entity_t * ent)
 PS2_DrawBeamModel
 
 Remarks: Local function.
+Queued, drawn by PS2_SpriteDraw with the translucent entities.
 ================
 */
 static void PS2_DrawBeamModel(const entity_t * ent)
 {
-    //TODO
+    PS2_SpriteAddBeam(ent);
 }
 
 /*
@@ -190,11 +322,50 @@ static void PS2_DrawBeamModel(const entity_t * ent)
 PS2_DrawSpriteModel
 
 Remarks: Local function.
+Queued, drawn by PS2_SpriteDraw with the translucent entities.
 ================
 */
 static void PS2_DrawSpriteModel(const entity_t * ent)
 {
-    //TODO
+    PS2_SpriteAddModel(ent);
+}
+
+/*
+================
+PS2_CullAliasModel
+
+Remarks: Local function.
+Tests a box around both frames, grown to cover any rotation.
+================
+*/
+static qboolean PS2_CullAliasModel(const entity_t * ent, const ps2_alias_frame_t * front, const ps2_alias_frame_t * back)
+{
+    int i;
+    float radius_sqr = 0.0f;
+    vec3_t mins, maxs;
+
+    for (i = 0; i < 3; ++i)
+    {
+        // Quantized positions go from 0 to 255 in each axis.
+        const float front_min = front->translate[i];
+        const float front_max = front->translate[i] + front->scale[i] * 255.0f;
+        const float back_min  = back->translate[i];
+        const float back_max  = back->translate[i] + back->scale[i] * 255.0f;
+
+        const float lo = ps2_fabsf((front_min < back_min) ? front_min : back_min);
+        const float hi = ps2_fabsf((front_max > back_max) ? front_max : back_max);
+        const float extent = (lo > hi) ? lo : hi;
+        radius_sqr += extent * extent;
+    }
+
+    const float radius = ps2_sqrtf(radius_sqr);
+    for (i = 0; i < 3; ++i)
+    {
+        mins[i] = ent->origin[i] - radius;
+        maxs[i] = ent->origin[i] + radius;
+    }
+
+    return PS2_ShouldCullBBox(mins, maxs);
 }
 
 /*
@@ -202,11 +373,114 @@ static void PS2_DrawSpriteModel(const entity_t * ent)
 PS2_DrawAliasMD2Model
 
 Remarks: Local function.
+The lerp between the two frames, transform, lighting and
+clipping all run on VU1 (alias_lerp.vsm). The EE only gathers
+the 8-bit vertexes of both frames for each batch.
 ================
 */
 static void PS2_DrawAliasMD2Model(const entity_t * ent)
 {
-    //TODO
+    const ps2_model_t * model = (const ps2_model_t *)ent->model;
+    const ps2_mdl_alias_t * alias = (const ps2_mdl_alias_t *)model->hunk.base_ptr;
+
+    if (ent->flags & RF_VIEWERMODEL)
+    {
+        return; // Don't draw through the eyes.
+    }
+
+    int frame     = ent->frame;
+    int old_frame = ent->oldframe;
+
+    if (frame < 0 || frame >= alias->num_frames)
+    {
+        Com_DPrintf("PS2_DrawAliasMD2Model: '%s' has no such frame %d\n", model->name, frame);
+        frame = 0;
+    }
+    if (old_frame < 0 || old_frame >= alias->num_frames)
+    {
+        Com_DPrintf("PS2_DrawAliasMD2Model: '%s' has no such oldframe %d\n", model->name, old_frame);
+        old_frame = 0;
+    }
+
+    const ps2_alias_frame_t * front = PS2_AliasFrame(alias, frame);
+    const ps2_alias_frame_t * back  = PS2_AliasFrame(alias, old_frame);
+
+    if (!(ent->flags & RF_WEAPONMODEL) && PS2_CullAliasModel(ent, front, back))
+    {
+        return;
+    }
+
+    //
+    // Model to world: X goes forward, Y left and Z up.
+    //
+    ps2_ent_xform_t xform;
+    PS2_EntXformSet(&xform, ent->origin, ent->angles);
+
+    m_mat4_t model_matrix;
+    PS2_EntXformMatrix(&model_matrix, &xform);
+
+    m_mat4_t mvp_matrix;
+    Mat4_Multiply(&mvp_matrix, &model_matrix, &ps2_view_proj_matrix);
+
+    //
+    // Same fixed light direction ref_gl uses for the shadows,
+    // already in model space. Shells replace the shade color.
+    //
+    const float yaw = ps2_deg_to_rad(-ent->angles[YAW]);
+    vec3_t light_dir = { ps2_cosf(yaw), ps2_sinf(yaw), 1.0f };
+    VectorNormalize(light_dir);
+
+    vec3_t shade = { 1.0f, 1.0f, 1.0f };
+    if (ent->flags & (RF_SHELL_RED | RF_SHELL_GREEN | RF_SHELL_BLUE))
+    {
+        shade[0] = (ent->flags & RF_SHELL_RED)   ? 1.0f : 0.0f;
+        shade[1] = (ent->flags & RF_SHELL_GREEN) ? 1.0f : 0.0f;
+        shade[2] = (ent->flags & RF_SHELL_BLUE)  ? 1.0f : 0.0f;
+    }
+
+    float ambient[3], diffuse[3];
+    const qboolean fullbright = (ent->flags & RF_FULLBRIGHT) != 0;
+
+    int i;
+    for (i = 0; i < 3; ++i)
+    {
+        ambient[i] = shade[i] * (fullbright ? ALIAS_FULLBRIGHT_COLOR : ALIAS_AMBIENT_COLOR);
+        diffuse[i] = shade[i] * (fullbright ? 0.0f : ALIAS_DIFFUSE_COLOR);
+    }
+
+    // Shells and the like are blended with the entity alpha.
+    const qboolean translucent = (ent->flags & RF_TRANSLUCENT) != 0;
+    const float alpha = translucent ? ent->alpha * ALIAS_ALPHA : ALIAS_ALPHA;
+
+    ps2_vu_alias_consts_t consts;
+    VU1_AliasSetupConsts(&consts, &mvp_matrix,
+                         front->scale, front->translate,
+                         back->scale, back->translate,
+                         ent->backlerp, light_dir,
+                         ambient, diffuse, alpha, translucent);
+
+    //
+    // One VU1 program run per batch. Batches don't break strips,
+    // so each one is a single GIF packet of chained strips.
+    //
+    const u16 * xyz = alias->vu_xyz;
+    int remaining   = alias->num_vu_xyz;
+
+    while (remaining > 0)
+    {
+        int vif_qw;
+        const int n = VU1_AliasBuildBatch(ps2_alias_vif_buffer, &vif_qw, &consts,
+                                          front->verts, back->verts, xyz, remaining);
+        VU1_Begin();
+        VU1_ListRaw(ps2_alias_vif_buffer, vif_qw);
+        VU1_End(-1); // The stream already has the MSCAL.
+
+        xyz       += n;
+        remaining -= n;
+        ++ps2_alias_vu_batches;
+    }
+
+    ++ps2_alias_models_drawn;
 }
 
 //=============================================================================
@@ -246,6 +520,95 @@ static ps2_teximage_t * PS2_TextureAnimation(ps2_mdl_texinfo_t * tex)
     */
 }
 
+/*
+================
+PS2_AddAlphaSurface
+
+Remarks: Local function.
+Queues a surface for PS2_DrawAlphaSurfaces, with the
+transform set in ps2_alpha_mvp_index. 128 alpha is opaque.
+================
+*/
+static void PS2_AddAlphaSurface(ps2_mdl_surface_t * surf, int alpha)
+{
+    if (ps2_num_alpha_draws < MAX_ALPHA_DRAWS)
+    {
+        ps2_warp_draw_t * draw = &ps2_alpha_draws[ps2_num_alpha_draws++];
+        draw->surf      = surf;
+        draw->teximage  = PS2_TextureAnimation(surf->texinfo);
+        draw->mvp_index = ps2_alpha_mvp_index;
+        draw->alpha     = alpha;
+        draw->depth     = 0.0f;
+    }
+}
+
+/*
+================
+PS2_AddSurfaceToChains
+
+Remarks: Local function.
+Adds a visible world surface to the draw chain it belongs to.
+================
+*/
+static void PS2_AddSurfaceToChains(ps2_mdl_surface_t * surf)
+{
+    if (surf->texinfo->flags & SURF_SKY)
+    {
+        // Just adds to visible sky bounds.
+        PS2_SkyAddSurface(surf);
+    }
+    else if (surf->texinfo->flags & (SURF_TRANS33 | SURF_TRANS66))
+    {
+        // Sorted and drawn at the end of the frame.
+        PS2_AddAlphaSurface(surf, (surf->texinfo->flags & SURF_TRANS33) ? 42 : 84);
+    }
+    else if (surf->flags & SURF_DRAWTURB)
+    {
+        // Drawn right after the texture chains.
+        if (ps2_num_warp_draws < MAX_WARP_DRAWS)
+        {
+            ps2_warp_draw_t * draw = &ps2_warp_draws[ps2_num_warp_draws++];
+            draw->surf      = surf;
+            draw->teximage  = PS2_TextureAnimation(surf->texinfo);
+            draw->mvp_index = 0;
+            draw->alpha     = 128;
+            draw->depth     = 0.0f;
+        }
+    }
+    else
+    {
+        //TODO: How are we going to handle the lightmaps?
+        /*
+        if (qglMTexCoord2fSGIS && !(surf->flags & SURF_DRAWTURB))
+        {
+            GL_RenderLightmappedPoly(surf);
+        }
+        else
+        {
+            // The polygon is visible, so add it to the texture sorted chain:
+            // FIXME: this is a hack for animation
+            //image = R_TextureAnimation(surf->texinfo);
+            //surf->texturechain = image->texturechain;
+            //image->texturechain = surf;
+        }
+        */
+
+        ps2_teximage_t * image = PS2_TextureAnimation(surf->texinfo);
+        if (image == NULL)
+        {
+            Sys_Error("PS2_AddSurfaceToChains: Null tex image!");
+        }
+
+        if (image->texture_chain == NULL)
+        {
+            ps2_chained_teximages[ps2_num_chained_teximages++] = image;
+        }
+
+        surf->texture_chain  = image->texture_chain;
+        image->texture_chain = surf;
+    }
+}
+
 /*
 ================
 PS2_FindLeafNodeForPoint
@@ -358,12 +721,13 @@ static void PS2_MarkLeaves(ps2_model_t * world_mdl)
 {
     if (ps2_old_view_cluster  == ps2_view_cluster  &&
         ps2_old_view_cluster2 == ps2_view_cluster2 &&
-        ps2_view_cluster != -1)
+        ps2_view_cluster != -1 && ps2_leaf_marks_valid)
     {
         return;
     }
 
     ++ps2_vis_frame_count;
+    ps2_leaf_marks_valid = true;
     ps2_old_view_cluster  = ps2_view_cluster;
     ps2_old_view_cluster2 = ps2_view_cluster2;
 
@@ -535,43 +899,7 @@ static void PS2_RecursiveWorldNode(const refdef_t * view_def, ps2_model_t * worl
             continue; // wrong side
         }
 
-        if (surf->texinfo->flags & SURF_SKY)
-        {
-            // Just adds to visible sky bounds.
-            // TODO
-        }
-        else if (surf->texinfo->flags & (SURF_TRANS33 | SURF_TRANS66))
-        {
-            // Add to the translucent draw chain.
-            // TODO
-        }
-        else
-        {
-            //TODO: How are we going to handle the lightmaps?
-            /*
-            if (qglMTexCoord2fSGIS && !(surf->flags & SURF_DRAWTURB))
-            {
-                GL_RenderLightmappedPoly(surf);
-            }
-            else
-            {
-                // The polygon is visible, so add it to the texture sorted chain:
-                // FIXME: this is a hack for animation
-                //image = R_TextureAnimation(surf->texinfo);
-                //surf->texturechain = image->texturechain;
-                //image->texturechain = surf;
-            }
-            */
-
-            ps2_teximage_t * image = PS2_TextureAnimation(surf->texinfo);
-            if (image == NULL)
-            {
-                Sys_Error("PS2_RecursiveWorldNode: Null tex image!");
-            }
-
-            surf->texture_chain  = image->texture_chain;
-            image->texture_chain = surf;
-        }
+        PS2_AddSurfaceToChains(surf);
     }
 
     // Finally recurse down the back side:
@@ -580,99 +908,407 @@ static void PS2_RecursiveWorldNode(const refdef_t * view_def, ps2_model_t * worl
 
 /*
 ================
-PS2_DrawBrushModel
+PS2_GetClusterSurfList
 
 Remarks: Local function.
+Cached list for the cluster, built from its PVS on a miss.
 ================
 */
-static void PS2_DrawBrushModel(const entity_t * ent)
+static const ps2_vis_cluster_t * PS2_GetClusterSurfList(const ps2_model_t * world_mdl, int cluster)
 {
-    //TODO
+    const ps2_vis_cluster_t * list = PS2_VisCacheFind(cluster);
+    if (list == NULL)
+    {
+        list = PS2_VisCacheAdd(world_mdl, cluster, PS2_GetClusterPVS(cluster, world_mdl));
+    }
+    return list;
 }
 
-//=============================================================================
-//FIXME TEMP BEGIN
-
-extern u32 VU1Prog_Color_Triangles_CodeStart VU_DATA_SECTION;
-extern u32 VU1Prog_Color_Triangles_CodeEnd   VU_DATA_SECTION;
+/*
+================
+PS2_CachedWorldSurfaces
 
-static qboolean vu_prog_set = false;
-void SetVUProg(void)
+Remarks: Local function.
+Chains the same surfaces as PS2_MarkLeaves + PS2_RecursiveWorldNode,
+from the cached lists of the view clusters: one flat pass over the PVS
+leafs for the area and frustum tests, then the backface test over the
+surface planes. Returns false if the lists can't be used (no vis data,
+outside the map, cache off or full), so the BSP walk is used instead.
+================
+*/
+static qboolean PS2_CachedWorldSurfaces(const refdef_t * view_def, ps2_model_t * world_mdl)
 {
-    if (!vu_prog_set) {
-        VU1_UploadProg(&VU1Prog_Color_Triangles_CodeStart, &VU1Prog_Color_Triangles_CodeEnd);
-        vu_prog_set = true;
+    if (!PS2_VisCacheEnabled() || world_mdl->vis == NULL ||
+        ps2_view_cluster == -1 || ps2_view_cluster2 == -1)
+    {
+        return false;
     }
-}
 
-// GS vertex format for our triangles (reglist):
-static const u64 VERTEX_FORMAT = (((u64)GS_REG_RGBAQ) << 0) | (((u64)GS_REG_XYZ2) << 4);
+    const ps2_vis_cluster_t * lists[2];
+    int num_lists = 0;
 
-// Number of elements in a vertex; (color + position) in our case:
-static const int NUM_VERTEX_ELEMENTS = 2;
+    lists[num_lists++] = PS2_GetClusterSurfList(world_mdl, ps2_view_cluster);
+    if (ps2_view_cluster2 != ps2_view_cluster)
+    {
+        // Solid water boundary, both PVSs are visible.
+        lists[num_lists++] = PS2_GetClusterSurfList(world_mdl, ps2_view_cluster2);
+    }
+    if (lists[0] == NULL || (num_lists == 2 && lists[1] == NULL))
+    {
+        return false;
+    }
 
-// Simple struct to hold the temporary DMA buffer we need
-// to send per draw list info to the Vector Unit 1.
-typedef struct
-{
-    m_mat4_t mvp_matrix;
-    float    gs_scale_x;
-    float    gs_scale_y;
-    float    gs_scale_z;
-    int      vert_count;
-} vu_batch_data_t PS2_ALIGN(16);
+    const ps2_vis_surf_planes_t * planes = PS2_VisCacheSurfPlanes(world_mdl);
+    u16 * visible = planes->scratch;
+    int num_visible = 0;
+    int l, i;
 
-// VU1 has 16k mem, 1024 quad words
-// Each vertex takes 2 quad words, so each tri takes 6.
-// 
-enum
-{
-    // we only have one unpack per batch. max size there is 256 including DMAs
-    MAX_TRIS_PER_VU_BATCH = 30,     // 180 qw
-    MAX_VERTS_PER_VU_BATCH = MAX_TRIS_PER_VU_BATCH * 3
-};
+    //
+    // Leafs: surfaces of the ones in an open area and in the frustum,
+    // each once, even if two leafs or both lists share it. The frustum
+    // test is done for the whole list first, 4 leafs at a time.
+    //
+    for (l = 0; l < num_lists; ++l)
+    {
+        const u16 * surfs = lists[l]->surfs;
+        const byte * leaf_culled = planes->leaf_culled;
 
-static int vu1_buffer_index = 0;
-static vu_batch_data_t ps2_batch_data_buffers[2];
+        PS2_FrustumCullBlocks(&ps2_cull_frustum, lists[l]->bounds,
+                              PS2_CULL_NUM_BLOCKS(lists[l]->num_leafs), planes->leaf_culled);
 
-static vu_batch_data_t * ps2_current_batch_data = NULL;
-static u64 * ps2_current_giftag = NULL;
+        for (i = 0; i < lists[l]->num_leafs; ++i)
+        {
+            const ps2_mdl_leaf_t * leaf = &world_mdl->leafs[lists[l]->leafs[i]];
+            const u16 * mark = surfs;
+            surfs += leaf->num_mark_surfaces;
 
-static int ps2_vu_batch_vert_count = 0;
-static int ps2_num_vu_batches = 0; // for printing
+            if (leaf_culled[i])
+            {
+                ++ps2_world_leafs_culled;
+                continue;
+            }
+            if (view_def->areabits && !(view_def->areabits[leaf->area >> 3] & (1 << (leaf->area & 7))))
+            {
+                ++ps2_world_leafs_culled;
+                continue;
+            }
 
-//FIXME END TEMP
-//=============================================================================
+            for (; mark != surfs; ++mark)
+            {
+                ps2_mdl_surface_t * surf = &world_mdl->surfaces[*mark];
+                if (surf->vis_frame != ps2_frame_count)
+                {
+                    surf->vis_frame = ps2_frame_count;
+                    visible[num_visible++] = *mark;
+                }
+            }
+        }
+    }
+
+    //
+    // Backface test, compacting the indexes in place. Same as the node
+    // side check of the BSP walk, since the surfaces lie on the node plane.
+    //
+    const float * normal_x = planes->normal_x;
+    const float * normal_y = planes->normal_y;
+    const float * normal_z = planes->normal_z;
+    const float * dist     = planes->dist;
+    const float eye_x = view_def->vieworg[0];
+    const float eye_y = view_def->vieworg[1];
+    const float eye_z = view_def->vieworg[2];
+    int num_front = 0;
+
+    for (i = 0; i < num_visible; ++i)
+    {
+        const int s = visible[i];
+        if (normal_x[s] * eye_x + normal_y[s] * eye_y + normal_z[s] * eye_z - dist[s] >= 0.0f)
+        {
+            visible[num_front++] = (u16)s;
+        }
+    }
+
+    ps2_world_surfs_backface += num_visible - num_front;
+
+    for (i = 0; i < num_front; ++i)
+    {
+        PS2_AddSurfaceToChains(&world_mdl->surfaces[visible[i]]);
+    }
+
+    // Leaf/node marks no longer match the view clusters.
+    ps2_leaf_marks_valid = false;
+    return true;
+}
 
 /*
 ================
-PS2_BeginNewVUBatch
+PS2_MarkLights
 
 Remarks: Local function.
+Same as ref_gl's R_MarkLights: flags the surfaces of the nodes
+the light reaches with its bit. 'origin' is the light position
+in the space of 'model', which 'node' belongs to.
 ================
 */
-static void PS2_BeginNewVUBatch(void)
+static void PS2_MarkLights(const ps2_model_t * model, const vec3_t origin, float intensity, int bit, const ps2_mdl_node_t * node)
 {
-    printf("PS2_BeginNewVUBatch\n");
-    VU1_Begin();
-
-    ++ps2_num_vu_batches;
-    ps2_current_batch_data = &ps2_batch_data_buffers[vu1_buffer_index];
-    vu1_buffer_index ^= 1;
+    if (node->contents != -1)
+    {
+        return;
+    }
 
-    // Copy the MVP matrix as-is:
-    ps2_current_batch_data->mvp_matrix = ps2_mvp_matrix;
+    const cplane_t * plane = node->plane;
+    const float dist  = DotProduct(origin, plane->normal) - plane->dist;
+    const float reach = intensity - DLIGHT_CUTOFF;
 
-    // GS rasterizer scale factors follow the MVP matrix:
-    ps2_current_batch_data->gs_scale_x = 2048.0f;
-    ps2_current_batch_data->gs_scale_y = 2048.0f;
-    ps2_current_batch_data->gs_scale_z = ((float)0xFFFFFF) / 32.0f;
+    if (dist > reach)
+    {
+        PS2_MarkLights(model, origin, intensity, bit, node->children[0]);
+        return;
+    }
+    if (dist < -reach)
+    {
+        PS2_MarkLights(model, origin, intensity, bit, node->children[1]);
+        return;
+    }
+
+    int i;
+    ps2_mdl_surface_t * surf = model->surfaces + node->first_surface;
+    for (i = 0; i < node->num_surfaces; ++i, ++surf)
+    {
+        if (surf->dlight_frame != ps2_frame_count)
+        {
+            surf->dlight_frame = ps2_frame_count;
+            surf->dlight_bits  = 0;
+            ++ps2_dlight_surfs;
+        }
+        surf->dlight_bits |= bit;
+    }
+
+    PS2_MarkLights(model, origin, intensity, bit, node->children[0]);
+    PS2_MarkLights(model, origin, intensity, bit, node->children[1]);
+}
+
+/*
+================
+PS2_SetDLightOrigins
+
+Remarks: Local function.
+Puts the light origins in the space of the model drawn next.
+'xform' places it in the world, null for the world itself.
+================
+*/
+static void PS2_SetDLightOrigins(const ps2_ent_xform_t * xform)
+{
+    int i;
+    for (i = 0; i < ps2_dlights_active; ++i)
+    {
+        if (xform != NULL)
+        {
+            PS2_EntXformPointToModel(xform, ps2_dlights[i].origin, ps2_dlight_origins[i]);
+        }
+        else
+        {
+            VectorCopy(ps2_dlights[i].origin, ps2_dlight_origins[i]);
+        }
+    }
+}
+
+/*
+================
+PS2_PushDLights
+
+Remarks: Local function.
+Marks the surfaces of the model reached by the lights of the frame,
+from 'node' down. Origins are the ones set by PS2_SetDLightOrigins.
+================
+*/
+static void PS2_PushDLights(const ps2_model_t * model, const ps2_mdl_node_t * node)
+{
+    int i;
+    for (i = 0; i < ps2_dlights_active; ++i)
+    {
+        PS2_MarkLights(model, ps2_dlight_origins[i], ps2_dlights[i].intensity, 1 << i, node);
+    }
+}
+
+/*
+================
+PS2_DrawBrushModel
+
+Remarks: Local function.
+Only does the frustum test and queues the model,
+PS2_DrawBrushModels draws it with the others.
+================
+*/
+static void PS2_DrawBrushModel(const entity_t * ent)
+{
+    const ps2_model_t * model = (const ps2_model_t *)ent->model;
+    if (model->num_model_surfaces == 0 || ps2_num_brush_draws == MAX_ENTITIES)
+    {
+        return;
+    }
+
+    ps2_brush_draw_t * draw = &ps2_brush_draws[ps2_num_brush_draws];
+    PS2_EntXformSet(&draw->xform, ent->origin, ent->angles);
+
+    vec3_t mins, maxs;
+    PS2_EntXformBounds(&draw->xform, model->mins, model->maxs, mins, maxs);
+    if (PS2_ShouldCullBBox(mins, maxs))
+    {
+        ++ps2_brush_models_culled;
+        return;
+    }
+
+    draw->ent = ent;
+    ++ps2_num_brush_draws;
+    ++ps2_brush_models_drawn;
+}
+
+/*
+================
+PS2_CompareBrushDraws
+
+Remarks: Local function.
+qsort() callback. Same transform, then same model.
+================
+*/
+static int PS2_CompareBrushDraws(const void * a, const void * b)
+{
+    const ps2_brush_draw_t * draw_a = (const ps2_brush_draw_t *)a;
+    const ps2_brush_draw_t * draw_b = (const ps2_brush_draw_t *)b;
+
+    const int order = PS2_EntXformCompare(&draw_a->xform, &draw_b->xform);
+    if (order != 0)
+    {
+        return order;
+    }
+
+    if (draw_a->ent->model != draw_b->ent->model)
+    {
+        return (draw_a->ent->model < draw_b->ent->model) ? -1 : 1;
+    }
+    return 0;
+}
+
+//=============================================================================
+//FIXME TEMP BEGIN
+
+extern u32 VU1Prog_Color_Triangles_CodeStart VU_DATA_SECTION;
+extern u32 VU1Prog_Color_Triangles_CodeEnd   VU_DATA_SECTION;
+extern u32 VU1Prog_Alias_Lerp_CodeStart      VU_DATA_SECTION;
+extern u32 VU1Prog_Alias_Lerp_CodeEnd        VU_DATA_SECTION;
+extern u32 VU1Prog_Color_Triangles_Guard_CodeStart VU_DATA_SECTION;
+extern u32 VU1Prog_Color_Triangles_Guard_CodeEnd   VU_DATA_SECTION;
+extern u32 VU1Prog_Warp_Triangles_CodeStart  VU_DATA_SECTION;
+extern u32 VU1Prog_Warp_Triangles_CodeEnd    VU_DATA_SECTION;
+extern u32 VU1Prog_DLight_Triangles_CodeStart VU_DATA_SECTION;
+extern u32 VU1Prog_DLight_Triangles_CodeEnd   VU_DATA_SECTION;
+extern u32 VU1Prog_Sprite_Quads_CodeStart    VU_DATA_SECTION;
+extern u32 VU1Prog_Sprite_Quads_CodeEnd      VU_DATA_SECTION;
+
+// Sits at the top of VU1 memory for the alias program, nothing else writes there.
+static m_vec4_t ps2_alias_normals[NUMVERTEXNORMALS];
+
+// Clip planes for the guard band program, right below the normals.
+static m_vec4_t ps2_guard_consts[VU1_GUARD_NUM_CONSTS];
+
+static qboolean vu_prog_set = false;
+void SetVUProg(void)
+{
+    if (!vu_prog_set) {
+        VU1_UploadProg(0, &VU1Prog_Color_Triangles_CodeStart, &VU1Prog_Color_Triangles_CodeEnd);
+        VU1_UploadProg(VU1_ALIAS_PROG_ADDR, &VU1Prog_Alias_Lerp_CodeStart, &VU1Prog_Alias_Lerp_CodeEnd);
+        VU1_UploadProg(VU1_GUARD_PROG_ADDR, &VU1Prog_Color_Triangles_Guard_CodeStart, &VU1Prog_Color_Triangles_Guard_CodeEnd);
+        VU1_UploadProg(VU1_WARP_PROG_ADDR, &VU1Prog_Warp_Triangles_CodeStart, &VU1Prog_Warp_Triangles_CodeEnd);
+        VU1_UploadProg(VU1_DLIGHT_PROG_ADDR, &VU1Prog_DLight_Triangles_CodeStart, &VU1Prog_DLight_Triangles_CodeEnd);
+        VU1_UploadProg(VU1_SPRITE_PROG_ADDR, &VU1Prog_Sprite_Quads_CodeStart, &VU1Prog_Sprite_Quads_CodeEnd);
+
+        VU1_AliasSetupNormals(ps2_alias_normals);
+        VU1_GuardSetupConsts(ps2_guard_consts);
+        VU1_Begin();
+        VU1_ListData(VU1_ALIAS_NORMALS, ps2_alias_normals, NUMVERTEXNORMALS);
+        VU1_ListData(VU1_GUARD_CONSTS, ps2_guard_consts, VU1_GUARD_NUM_CONSTS);
+        VU1_End(-1);
+
+        vu_prog_set = true;
+    }
+}
+
+// GS vertex format for our triangles (reglist):
+static const u64 VERTEX_FORMAT = (((u64)GS_REG_RGBAQ) << 0) | (((u64)GS_REG_XYZ2) << 4);
+
+// Number of elements in a vertex; (color + position) in our case:
+static const int NUM_VERTEX_ELEMENTS = 2;
+
+// Simple struct to hold the temporary DMA buffer we need
+// to send per draw list info to the Vector Unit 1.
+typedef struct
+{
+    m_mat4_t mvp_matrix;
+    float    gs_scale_x;
+    float    gs_scale_y;
+    float    gs_scale_z;
+    int      vert_count;
+} vu_batch_data_t PS2_ALIGN(16);
+
+// VU1 has 16k mem, 1024 quad words
+// Each vertex takes 2 quad words, so each tri takes 6.
+// 
+enum
+{
+    // we only have one unpack per batch. max size there is 256 including DMAs
+    MAX_TRIS_PER_VU_BATCH = 30,     // 180 qw
+    MAX_VERTS_PER_VU_BATCH = MAX_TRIS_PER_VU_BATCH * 3
+};
+
+static int vu1_buffer_index = 0;
+static vu_batch_data_t ps2_batch_data_buffers[2];
+static ps2_vu_dlights_t ps2_vu_dlights_buffers[2]; // Also sent by reference
+
+static vu_batch_data_t * ps2_current_batch_data = NULL;
+static ps2_vu_dlights_t * ps2_current_vu_dlights = NULL;
+static u64 * ps2_current_giftag = NULL;
+
+// Lights reaching the surfaces of the current batch.
+static u32 ps2_vu_batch_dlight_bits = 0;
+
+static int ps2_vu_batch_vert_count = 0;
+static int ps2_num_vu_batches = 0; // for printing
+
+//FIXME END TEMP
+//=============================================================================
+
+/*
+================
+PS2_BeginNewVUBatch
+
+Remarks: Local function.
+================
+*/
+static void PS2_BeginNewVUBatch(void)
+{
+    printf("PS2_BeginNewVUBatch\n");
+    VU1_Begin();
+
+    ++ps2_num_vu_batches;
+    ps2_current_batch_data = &ps2_batch_data_buffers[vu1_buffer_index];
+    ps2_current_vu_dlights = &ps2_vu_dlights_buffers[vu1_buffer_index];
+    vu1_buffer_index ^= 1;
+
+    // Copy the MVP matrix as-is:
+    ps2_current_batch_data->mvp_matrix = ps2_mvp_matrix;
+
+    // GS rasterizer scale factors follow the MVP matrix:
+    ps2_current_batch_data->gs_scale_x = 2048.0f;
+    ps2_current_batch_data->gs_scale_y = 2048.0f;
+    ps2_current_batch_data->gs_scale_z = ((float)0xFFFFFF) / 32.0f;
 
     // The vertex count is in the W component of the previous quadword.
     // We only actually set the count before the batch is closed, since
     // we don't know the number of vertexes beforehand.
     ps2_current_batch_data->vert_count = 0;
     ps2_vu_batch_vert_count = 0;
+    ps2_vu_batch_dlight_bits = 0;
 
     // Batch/list data will be uploaded at address 0 in VU memory.
     const int batch_data_qwsize = sizeof(*ps2_current_batch_data) >> 4;
@@ -685,6 +1321,27 @@ static void PS2_BeginNewVUBatch(void)
     ps2_current_giftag = VU1_ListAddGIFTag();
 }
 
+/*
+================
+PS2_CaptureVUBatch
+
+Remarks: Local function.
+Writes the batch as VU1 memory will see it: the batch data up to the scales,
+then the GIF tag and the vertexes, which follow it in the packet.
+================
+*/
+static void PS2_CaptureVUBatch(void)
+{
+    const int header_qw = sizeof(*ps2_current_batch_data) >> 4;
+    const int list_qw   = 1 + ps2_vu_batch_vert_count * NUM_VERTEX_ELEMENTS;
+    const int total_qw  = header_qw + list_qw;
+
+    fwrite(&total_qw, sizeof(total_qw), 1, ps2_vu_capture_file);
+    fwrite(ps2_current_batch_data, 16, header_qw, ps2_vu_capture_file);
+    fwrite(ps2_current_giftag, 16, list_qw, ps2_vu_capture_file);
+    ++ps2_vu_captured_batches;
+}
+
 /*
 ================
 PS2_FlushVUBatch
@@ -699,22 +1356,51 @@ static void PS2_FlushVUBatch(void)
     ps2_current_batch_data->vert_count = ps2_vu_batch_vert_count;
 
     // Finish the GIF tag now that we know the vertex count.
-    const int vert_loops = ps2_vu_batch_vert_count;
-    const u64 prim_desc  = GS_PRIM(GS_PRIM_TRIANGLE, GS_PRIM_SFLAT, GS_PRIM_TOFF, GS_PRIM_FOFF, GS_PRIM_ABOFF, GS_PRIM_AAON, GS_PRIM_FSTQ, GS_PRIM_C1, 0);
-
-    // Update it:
-    ps2_current_giftag[0] = GS_GIFTAG(vert_loops, 1, 1, prim_desc, GS_GIFTAG_PACKED, NUM_VERTEX_ELEMENTS);
+    // The guard band program writes its own tag for each triangle fan
+    // it outputs, this one is only the template (NLOOP and EOP cleared).
+    const qboolean guard_clip = (r_ps2_guard_clip->value != 0.0f);
+    if (guard_clip)
+    {
+        const u64 prim_desc = GS_PRIM(GS_PRIM_TRIFAN, GS_PRIM_SFLAT, GS_PRIM_TOFF, GS_PRIM_FOFF, GS_PRIM_ABOFF, GS_PRIM_AAON, GS_PRIM_FSTQ, GS_PRIM_C1, 0);
+        ps2_current_giftag[0] = GS_GIFTAG(0, 0, 1, prim_desc, GS_GIFTAG_PACKED, NUM_VERTEX_ELEMENTS);
+    }
+    else
+    {
+        const int vert_loops = ps2_vu_batch_vert_count;
+        const u64 prim_desc  = GS_PRIM(GS_PRIM_TRIANGLE, GS_PRIM_SFLAT, GS_PRIM_TOFF, GS_PRIM_FOFF, GS_PRIM_ABOFF, GS_PRIM_AAON, GS_PRIM_FSTQ, GS_PRIM_C1, 0);
+        ps2_current_giftag[0] = GS_GIFTAG(vert_loops, 1, 1, prim_desc, GS_GIFTAG_PACKED, NUM_VERTEX_ELEMENTS);
+    }
     ps2_current_giftag[1] = VERTEX_FORMAT;
 
+    if (ps2_vu_capture_file != NULL)
+    {
+        PS2_CaptureVUBatch();
+    }
+
     ps2_current_giftag = NULL;  // never need to use this again
 
     // Close the draw list:
     VU1_ListAddEnd();
 
+    // With dynamic lights reaching the batch, they go right after it
+    // and the lighting program runs first, then jumps to the one above.
+    int start_prog = guard_clip ? VU1_GUARD_PROG_ADDR : 0;
+    if (ps2_vu_batch_dlight_bits != 0)
+    {
+        const int dlights_qw = VU1_DLightSetup(ps2_current_vu_dlights, ps2_dlights, ps2_dlight_origins,
+                                               ps2_vu_batch_dlight_bits, start_prog);
+        if (dlights_qw != 0)
+        {
+            VU1_ListData(VU1_DLIGHT_HEADER, ps2_current_vu_dlights, dlights_qw);
+            start_prog = VU1_DLIGHT_PROG_ADDR;
+            ++ps2_dlight_vu_batches;
+        }
+    }
+
     PS2_WaitGSDrawFinish();
 
-    // Send the batch and start the VU program (located in micromem address 0):
-    VU1_End(0);
+    // Send the batch and start the VU program:
+    VU1_End(start_prog);
 
     //FIXME PROBABLY actually synchronize before VU1_End() call...
     printf("wait for GS Draw finish\n");
@@ -738,6 +1424,11 @@ static void PS2_VUBatchAddSurfaceTris(const ps2_mdl_surface_t * surf)
     const int num_triangles = poly->num_verts - 2;
     const byte * color = Dbg_GetDebugColor(surf->debug_color);
 
+    if (surf->dlight_frame == ps2_frame_count)
+    {
+        ps2_vu_batch_dlight_bits |= surf->dlight_bits;
+    }
+
     int t, v;
     for (t = 0; t < num_triangles; ++t)
     {
@@ -767,6 +1458,189 @@ static void PS2_VUBatchAddSurfaceTris(const ps2_mdl_surface_t * surf)
     }
 }
 
+/*
+================
+PS2_WarpSendBatch
+
+Remarks: Local function.
+================
+*/
+static void PS2_WarpSendBatch(int num_verts, qboolean wait_end)
+{
+    const int vif_qw = VU1_WarpEndBatch(ps2_warp_vif_buffer, num_verts, wait_end);
+    VU1_Begin();
+    VU1_ListRaw(ps2_warp_vif_buffer, vif_qw);
+    VU1_End(-1); // The stream already has the MSCAL.
+    ++ps2_warp_vu_batches;
+}
+
+/*
+================
+PS2_DrawWarpSurfaces
+
+Remarks: Local function.
+Draws the surfaces with the textured warp program, in the order given.
+A new batch starts when the texture, the transform or the kind of
+surface changes. The turbulence is all done by the VU, the EE only
+copies the vertexes of the polygons (cut in pieces for SURF_DRAWTURB).
+================
+*/
+static void PS2_DrawWarpSurfaces(const ps2_warp_draw_t * draws, int num_draws, const m_mat4_t * mvps, qboolean blend)
+{
+    int i, t, v, num_verts = 0;
+    ps2_vu_warp_vert_t * verts = NULL;
+    ps2_vu_warp_consts_t consts;
+
+    const ps2_teximage_t * batch_teximage = NULL;
+    int batch_mvp_index = -1;
+    int batch_flags     = -1;
+
+    for (i = 0; i < num_draws; ++i)
+    {
+        const ps2_mdl_surface_t * surf = draws[i].surf;
+        const int flags = (surf->flags & SURF_DRAWTURB) | (surf->texinfo->flags & SURF_FLOWING);
+
+        if (draws[i].teximage != batch_teximage || draws[i].mvp_index != batch_mvp_index || flags != batch_flags)
+        {
+            // The GS has to be done with the last batch before a texture upload.
+            const qboolean new_teximage = (draws[i].teximage != batch_teximage);
+            if (verts != NULL)
+            {
+                PS2_WarpSendBatch(num_verts, new_teximage);
+                verts = NULL;
+            }
+
+            if (new_teximage)
+            {
+                VU1_Wait();
+                PS2_TexImageVRamUpload(draws[i].teximage);
+                PS2_TexImageBindImmediate();
+                batch_teximage = draws[i].teximage;
+            }
+
+            //
+            // Same turbulence and scrolling as ref_gl. The warp polygons keep their
+            // S/T in texels, the others were already divided by the texture size.
+            //
+            float scroll;
+            if (flags & SURF_DRAWTURB)
+            {
+                scroll = (flags & SURF_FLOWING) ? -64.0f * ((ps2_view_time * 0.5f) - (int)(ps2_view_time * 0.5f)) : 0.0f;
+                VU1_WarpSetupConsts(&consts, &mvps[draws[i].mvp_index], ps2_view_time,
+                                    scroll, VU1_WARP_AMPLITUDE, VU1_WARP_ST_SCALE, blend);
+            }
+            else
+            {
+                scroll = 0.0f;
+                if (flags & SURF_FLOWING)
+                {
+                    scroll = -64.0f * ((ps2_view_time / 40.0f) - (int)(ps2_view_time / 40.0f));
+                    if (scroll == 0.0f)
+                    {
+                        scroll = -64.0f;
+                    }
+                }
+                VU1_WarpSetupConsts(&consts, &mvps[draws[i].mvp_index], ps2_view_time,
+                                    scroll, 0.0f, 1.0f, blend);
+            }
+
+            batch_mvp_index = draws[i].mvp_index;
+            batch_flags     = flags;
+        }
+
+        // Unlit for now, 128 is 1.0 for MODULATE.
+        const int alpha = draws[i].alpha;
+
+        const ps2_mdl_poly_t * poly = surf->polys;
+        for (; poly != NULL; poly = poly->next)
+        {
+            const int num_triangles = poly->num_verts - 2;
+            for (t = 0; t < num_triangles; ++t)
+            {
+                if (verts == NULL || num_verts == VU1_WARP_MAX_VERTS)
+                {
+                    if (verts != NULL)
+                    {
+                        PS2_WarpSendBatch(num_verts, false);
+                    }
+                    verts = VU1_WarpBeginBatch(ps2_warp_vif_buffer, &consts);
+                    num_verts = 0;
+                }
+
+                const ps2_mdl_triangle_t * tri = &poly->triangles[t];
+                for (v = 0; v < 3; ++v)
+                {
+                    const ps2_poly_vertex_t * pv = &poly->vertexes[tri->vertexes[v]];
+                    ps2_vu_warp_vert_t * out = &verts[num_verts++];
+
+                    out->st[0]    = pv->texture_s;
+                    out->st[1]    = pv->texture_t;
+                    out->st[2]    = 0.0f;
+                    out->st[3]    = 0.0f;
+                    out->color[0] = 128;
+                    out->color[1] = 128;
+                    out->color[2] = 128;
+                    out->color[3] = alpha;
+                    out->pos[0]   = pv->position[0];
+                    out->pos[1]   = pv->position[1];
+                    out->pos[2]   = pv->position[2];
+                    out->pos[3]   = 1.0f;
+                }
+            }
+        }
+    }
+
+    if (verts != NULL)
+    {
+        PS2_WarpSendBatch(num_verts, true);
+        VU1_Wait();
+    }
+}
+
+/*
+================
+PS2_CompareWarpDraws
+
+Remarks: Local function.
+qsort() callback. Groups the opaque warp surfaces by texture.
+================
+*/
+static int PS2_CompareWarpDraws(const void * a, const void * b)
+{
+    const ps2_warp_draw_t * da = (const ps2_warp_draw_t *)a;
+    const ps2_warp_draw_t * db = (const ps2_warp_draw_t *)b;
+
+    if (da->teximage != db->teximage)
+    {
+        return (da->teximage < db->teximage) ? -1 : 1;
+    }
+    return (da->surf < db->surf) ? -1 : ((da->surf > db->surf) ? 1 : 0);
+}
+
+/*
+================
+PS2_CompareAlphaDraws
+
+Remarks: Local function.
+qsort() callback. Farthest first, then by texture.
+================
+*/
+static int PS2_CompareAlphaDraws(const void * a, const void * b)
+{
+    const ps2_warp_draw_t * da = (const ps2_warp_draw_t *)a;
+    const ps2_warp_draw_t * db = (const ps2_warp_draw_t *)b;
+
+    if (da->depth != db->depth)
+    {
+        return (da->depth > db->depth) ? -1 : 1;
+    }
+    if (da->teximage != db->teximage)
+    {
+        return (da->teximage < db->teximage) ? -1 : 1;
+    }
+    return (da->surf < db->surf) ? -1 : ((da->surf > db->surf) ? 1 : 0);
+}
+
 /*
 ================
 PS2_DrawTextureChains
@@ -781,22 +1655,31 @@ static void PS2_DrawTextureChains(void)
     PS2_BeginNewVUBatch();
 
     int i;
-    int verts_done = 0;
-    ps2_teximage_t * teximage_iter = ps2ref.teximages;
+    ps2_teximage_t * teximage;
+    const ps2_teximage_t * last_teximage = ps2ref.current_tex;
 
-    for (i = 0; i < MAX_TEXIMAGES; ++i, ++teximage_iter)
+    // Only one texture fits in VRam at a time, so if the one
+    // already there has surfaces, draw them first to save an upload.
+    for (i = 1; i < ps2_num_chained_teximages; ++i)
     {
-        if (teximage_iter->type == IT_NULL)
+        if (ps2_chained_teximages[i] == ps2ref.current_tex)
         {
-            continue;
+            ps2_chained_teximages[i] = ps2_chained_teximages[0];
+            ps2_chained_teximages[0] = ps2ref.current_tex;
+            break;
         }
+    }
 
-        const ps2_mdl_surface_t * surf = teximage_iter->texture_chain;
-        if (surf == NULL)
+    for (i = 0; i < ps2_num_chained_teximages; ++i)
+    {
+        teximage = ps2_chained_teximages[i];
+        if (teximage != last_teximage)
         {
-            continue;
+            ++ps2_world_tex_switches; // Brush models add theirs too
+            last_teximage = teximage;
         }
 
+        const ps2_mdl_surface_t * surf = teximage->texture_chain;
         for (; surf != NULL; surf = surf->texture_chain)
         {
             const ps2_mdl_poly_t * poly = surf->polys;
@@ -823,10 +1706,189 @@ static void PS2_DrawTextureChains(void)
             PS2_VUBatchAddSurfaceTris(surf);
         }
 
-        teximage_iter->texture_chain = NULL;
+        teximage->texture_chain = NULL;
+    }
+
+    ps2_num_chained_teximages = 0;
+    PS2_FlushVUBatch();
+
+    // Opaque warp surfaces of the same model, with the same transform.
+    if (ps2_num_warp_draws != 0)
+    {
+        qsort(ps2_warp_draws, ps2_num_warp_draws, sizeof(ps2_warp_draw_t), &PS2_CompareWarpDraws);
+        PS2_DrawWarpSurfaces(ps2_warp_draws, ps2_num_warp_draws, &ps2_mvp_matrix, false);
+
+        ps2_warp_surfs_drawn += ps2_num_warp_draws;
+        ps2_num_warp_draws = 0;
+    }
+}
+
+/*
+================
+PS2_ClearTextureChains
+
+Remarks: Local function.
+Drops the chains without drawing them.
+Returns the number of surfaces they had.
+================
+*/
+static int PS2_ClearTextureChains(void)
+{
+    int i, num_surfs = 0;
+    for (i = 0; i < ps2_num_chained_teximages; ++i)
+    {
+        const ps2_mdl_surface_t * surf = ps2_chained_teximages[i]->texture_chain;
+        for (; surf != NULL; surf = surf->texture_chain)
+        {
+            ++num_surfs;
+        }
+        ps2_chained_teximages[i]->texture_chain = NULL;
+    }
+
+    num_surfs += ps2_num_warp_draws + ps2_num_alpha_draws;
+    ps2_num_chained_teximages = 0;
+    ps2_num_warp_draws  = 0;
+    ps2_num_alpha_draws = 0;
+    return num_surfs;
+}
+
+/*
+================
+PS2_DrawBrushModels
+
+Remarks: Local function.
+Draws the brush models queued by PS2_DrawBrushModel. Models placed
+the same way (most doors and walls sit at the world origin) go into
+the same texture chains, so submodels sharing a texture share the
+VU1 batches too, and there's only one model matrix per group.
+The surfaces of RF_TRANSLUCENT models go with the translucent
+surfaces instead, at a quarter alpha like ref_gl draws them.
+================
+*/
+static void PS2_DrawBrushModels(const refdef_t * view_def)
+{
+    if (ps2_num_brush_draws == 0)
+    {
+        return;
+    }
+
+    qsort(ps2_brush_draws, ps2_num_brush_draws, sizeof(ps2_brush_draw_t), &PS2_CompareBrushDraws);
+
+    int first, last, i, s;
+    for (first = 0; first < ps2_num_brush_draws; first = last)
+    {
+        const ps2_ent_xform_t * xform = &ps2_brush_draws[first].xform;
+        for (last = first + 1; last < ps2_num_brush_draws; ++last)
+        {
+            if (PS2_EntXformCompare(xform, &ps2_brush_draws[last].xform) != 0)
+            {
+                break;
+            }
+        }
+
+        // Backface test with the eye in model space, as ref_gl does.
+        vec3_t eye;
+        PS2_EntXformPointToModel(xform, view_def->vieworg, eye);
+
+        m_mat4_t model_matrix;
+        PS2_EntXformMatrix(&model_matrix, xform);
+        Mat4_Multiply(&ps2_mvp_matrix, &model_matrix, &ps2_view_proj_matrix);
+
+        // Lights in the space of the group, for marking and for the batches.
+        PS2_SetDLightOrigins(xform);
+
+        // Translucent surfaces are drawn later, they keep the transform.
+        Mat4_Copy(&ps2_alpha_mvps[ps2_num_alpha_mvps], &ps2_mvp_matrix);
+        ps2_alpha_mvp_index = ps2_num_alpha_mvps++;
+
+        for (i = first; i < last; ++i)
+        {
+            const ps2_model_t * model = (const ps2_model_t *)ps2_brush_draws[i].ent->model;
+            const qboolean translucent = (ps2_brush_draws[i].ent->flags & RF_TRANSLUCENT) != 0;
+            ps2_mdl_surface_t * surf = &model->surfaces[model->first_model_surface];
+            PS2_PushDLights(model, model->nodes + model->first_node);
+
+            for (s = 0; s < model->num_model_surfaces; ++s, ++surf)
+            {
+                const float dot = DotProduct(eye, surf->plane->normal) - surf->plane->dist;
+                if (!((surf->flags & SURF_PLANEBACK) ? (dot < -BACKFACE_EPSILON) : (dot > BACKFACE_EPSILON)))
+                {
+                    continue;
+                }
+
+                if (translucent && !(surf->texinfo->flags & (SURF_SKY | SURF_TRANS33 | SURF_TRANS66)))
+                {
+                    PS2_AddAlphaSurface(surf, BRUSH_TRANSLUCENT_ALPHA);
+                }
+                else
+                {
+                    PS2_AddSurfaceToChains(surf);
+                }
+            }
+        }
+
+        if (ps2_num_chained_teximages == 0 && ps2_num_warp_draws == 0)
+        {
+            continue;
+        }
+
+        PS2_DrawTextureChains();
+        ++ps2_brush_groups;
+    }
+
+    // Back to the world for whatever comes next.
+    Mat4_Copy(&ps2_mvp_matrix, &ps2_view_proj_matrix);
+    ps2_alpha_mvp_index = 0;
+    ps2_num_brush_draws = 0;
+}
+
+/*
+================
+PS2_DrawAlphaSurfaces
+
+Remarks: Local function.
+Translucent surfaces of the world and brush models, farthest first.
+Depth is the clip space W of the first polygon center, with the
+transform of the model the surface belongs to.
+================
+*/
+static void PS2_DrawAlphaSurfaces(void)
+{
+    int i, v;
+
+    if (ps2_num_alpha_draws == 0)
+    {
+        return;
+    }
+
+    for (i = 0; i < ps2_num_alpha_draws; ++i)
+    {
+        ps2_warp_draw_t * draw = &ps2_alpha_draws[i];
+        const ps2_mdl_poly_t * poly = draw->surf->polys;
+        const m_mat4_t * mvp = &ps2_alpha_mvps[draw->mvp_index];
+
+        if (poly == NULL || poly->num_verts == 0)
+        {
+            continue;
+        }
+
+        vec3_t center;
+        VectorClear(center);
+        for (v = 0; v < poly->num_verts; ++v)
+        {
+            VectorAdd(center, poly->vertexes[v].position, center);
+        }
+        VectorScale(center, 1.0f / poly->num_verts, center);
+
+        draw->depth = center[0] * mvp->m[0][3] + center[1] * mvp->m[1][3] +
+                      center[2] * mvp->m[2][3] + mvp->m[3][3];
     }
 
-    PS2_FlushVUBatch();
+    qsort(ps2_alpha_draws, ps2_num_alpha_draws, sizeof(ps2_warp_draw_t), &PS2_CompareAlphaDraws);
+    PS2_DrawWarpSurfaces(ps2_alpha_draws, ps2_num_alpha_draws, ps2_alpha_mvps, true);
+
+    ps2_alpha_surfs_drawn = ps2_num_alpha_draws;
+    ps2_num_alpha_draws = 0;
 }
 
 /*
@@ -937,6 +1999,421 @@ static void PS2_SetUpFrustum(const refdef_t * view_def)
         ps2_frustum[i].dist = DotProduct(view_def->vieworg, ps2_frustum[i].normal);
         ps2_frustum[i].signbits = SignBitsForPlane(&ps2_frustum[i]);
     }
+
+    PS2_FrustumSetPlanes(&ps2_cull_frustum, ps2_frustum);
+}
+
+/*
+================
+PS2_RecordVisPath
+
+Remarks: Local function.
+Appends the view to the camera path while r_ps2_vis_record
+is set, writes the path out once it gets cleared.
+================
+*/
+static void PS2_RecordVisPath(const refdef_t * view_def)
+{
+    const int path_bytes = PS2_VIS_PATH_MAX_FRAMES * sizeof(ps2_vis_path_frame_t);
+
+    if (r_ps2_vis_record->value)
+    {
+        if (ps2_vis_path == NULL)
+        {
+            ps2_vis_path = PS2_MemAlloc(path_bytes, MEMTAG_RENDERER);
+            ps2_vis_path_frames = 0;
+            Com_Printf("Recording the camera path...\n");
+        }
+        if (ps2_vis_path_frames < PS2_VIS_PATH_MAX_FRAMES)
+        {
+            ps2_vis_path_frame_t * frame = &ps2_vis_path[ps2_vis_path_frames++];
+            VectorCopy(view_def->vieworg, frame->origin);
+            VectorCopy(view_def->viewangles, frame->angles);
+            frame->fov_x = view_def->fov_x;
+            frame->fov_y = view_def->fov_y;
+        }
+        return;
+    }
+
+    if (ps2_vis_path == NULL)
+    {
+        return;
+    }
+
+    const char * filename = va("%s/%s", FS_Gamedir(), PS2_VIS_PATH_FILENAME);
+    FILE * fd = fopen(filename, "wb");
+    if (fd != NULL)
+    {
+        const int header[3] = { PS2_VIS_PATH_MAGIC, PS2_VIS_PATH_VERSION, ps2_vis_path_frames };
+        fwrite(header, sizeof(header), 1, fd);
+        fwrite(ps2_vis_path, sizeof(ps2_vis_path_frame_t), ps2_vis_path_frames, fd);
+        fclose(fd);
+        Com_Printf("Wrote a %d frames camera path to '%s'.\n", ps2_vis_path_frames, PS2_VIS_PATH_FILENAME);
+    }
+    else
+    {
+        Com_Printf("Can't open '%s' for writing!\n", filename);
+    }
+
+    PS2_MemFree(ps2_vis_path, path_bytes, MEMTAG_RENDERER);
+    ps2_vis_path = NULL;
+    ps2_vis_path_frames = 0;
+}
+
+/*
+================
+PS2_SetUpBenchView
+
+Remarks: Local function.
+View vectors, frustum and clusters like PS2_DrawFrameSetup, for a path frame.
+================
+*/
+static void PS2_SetUpBenchView(refdef_t * bench_def, const ps2_vis_path_frame_t * frame)
+{
+    VectorCopy(frame->origin, bench_def->vieworg);
+    VectorCopy(frame->angles, bench_def->viewangles);
+    bench_def->fov_x = frame->fov_x;
+    bench_def->fov_y = frame->fov_y;
+
+    AngleVectors(bench_def->viewangles, (float *)&ps2_forward_vec, (float *)&ps2_right_vec, (float *)&ps2_up_vec);
+    PS2_SetUpFrustum(bench_def);
+    PS2_SetUpViewClusters(bench_def);
+    ++ps2_frame_count;
+}
+
+/*
+================
+PS2_RunVisBenchmark
+
+Remarks: Local function.
+Replays the recorded camera path a few times through the BSP walk,
+then through the cached lists, starting from an empty cache, and
+prints the time per frame and the surfaces chained by each. Times
+include the view setup of each frame, which is the same for both.
+Areas are all taken as open, the path doesn't have the areabits.
+================
+*/
+static void PS2_RunVisBenchmark(const refdef_t * view_def, ps2_model_t * world_mdl)
+{
+    const int NUM_PASSES = 4;
+
+    const char * filename = va("%s/%s", FS_Gamedir(), PS2_VIS_PATH_FILENAME);
+    FILE * fd = fopen(filename, "rb");
+    if (fd == NULL)
+    {
+        Com_Printf("Can't open '%s'! Record a path with r_ps2_vis_record first.\n", filename);
+        return;
+    }
+
+    int header[3];
+    if (fread(header, sizeof(header), 1, fd) != 1 ||
+        header[0] != PS2_VIS_PATH_MAGIC || header[1] != PS2_VIS_PATH_VERSION ||
+        header[2] <= 0 || header[2] > PS2_VIS_PATH_MAX_FRAMES)
+    {
+        Com_Printf("'%s' is not a valid camera path!\n", filename);
+        fclose(fd);
+        return;
+    }
+
+    const int num_frames = header[2];
+    const int path_bytes = num_frames * sizeof(ps2_vis_path_frame_t);
+    ps2_vis_path_frame_t * path = PS2_MemAlloc(path_bytes, MEMTAG_RENDERER);
+
+    const qboolean read_ok = (fread(path, sizeof(ps2_vis_path_frame_t), num_frames, fd) == (size_t)num_frames);
+    fclose(fd);
+
+    if (!read_ok)
+    {
+        Com_Printf("Failed to read the camera path from '%s'!\n", filename);
+        PS2_MemFree(path, path_bytes, MEMTAG_RENDERER);
+        return;
+    }
+
+    // View clusters of the frame being drawn, put back at the end.
+    const int saved_clusters[4] = {
+        ps2_view_cluster, ps2_view_cluster2,
+        ps2_old_view_cluster, ps2_old_view_cluster2
+    };
+
+    refdef_t bench_def = *view_def;
+    bench_def.areabits = NULL;
+
+    int pass, i, start_time;
+    int bsp_surfs = 0, cached_surfs = 0, fallbacks = 0;
+
+    //
+    // BSP walk:
+    //
+    ps2_leaf_marks_valid = false;
+    start_time = Sys_Milliseconds();
+    for (pass = 0; pass < NUM_PASSES; ++pass)
+    {
+        for (i = 0; i < num_frames; ++i)
+        {
+            PS2_SetUpBenchView(&bench_def, &path[i]);
+            PS2_MarkLeaves(world_mdl);
+            PS2_RecursiveWorldNode(&bench_def, world_mdl, world_mdl->nodes);
+            bsp_surfs += PS2_ClearTextureChains();
+        }
+    }
+    const int bsp_time = Sys_Milliseconds() - start_time;
+
+    //
+    // Cached lists:
+    //
+    PS2_VisCacheReset();
+    start_time = Sys_Milliseconds();
+    for (pass = 0; pass < NUM_PASSES; ++pass)
+    {
+        for (i = 0; i < num_frames; ++i)
+        {
+            PS2_SetUpBenchView(&bench_def, &path[i]);
+            if (!PS2_CachedWorldSurfaces(&bench_def, world_mdl))
+            {
+                PS2_MarkLeaves(world_mdl);
+                PS2_RecursiveWorldNode(&bench_def, world_mdl, world_mdl->nodes);
+                ++fallbacks;
+            }
+            cached_surfs += PS2_ClearTextureChains();
+        }
+    }
+    const int cached_time = Sys_Milliseconds() - start_time;
+
+    const float num_runs = (float)(num_frames * NUM_PASSES);
+    Com_Printf("Vis bench: %d frames, %d passes.\n", num_frames, NUM_PASSES);
+    Com_Printf("  BSP walk: %.3f ms/frame, %d surfaces.\n", bsp_time / num_runs, bsp_surfs);
+    Com_Printf("  Cached:   %.3f ms/frame, %d surfaces, %d lists built, %d evicted, %d fallbacks, %d KB.\n",
+               cached_time / num_runs, cached_surfs, ps2_vis_cache_builds, ps2_vis_cache_evictions,
+               fallbacks, ps2_vis_cache_bytes / 1024);
+    if (bsp_surfs != cached_surfs)
+    {
+        Com_Printf("  Surface counts differ!\n");
+    }
+
+    PS2_MemFree(path, path_bytes, MEMTAG_RENDERER);
+
+    // Back to the frame being drawn:
+    ps2_view_cluster      = saved_clusters[0];
+    ps2_view_cluster2     = saved_clusters[1];
+    ps2_old_view_cluster  = saved_clusters[2];
+    ps2_old_view_cluster2 = saved_clusters[3];
+    ps2_leaf_marks_valid  = false;
+    ++ps2_frame_count;
+
+    AngleVectors(view_def->viewangles, (float *)&ps2_forward_vec, (float *)&ps2_right_vec, (float *)&ps2_up_vec);
+    PS2_SetUpFrustum(view_def);
+}
+
+/*
+================
+PS2_RunCullBenchmark
+
+Remarks: Local function.
+Tests the bounds of every node and leaf of the world against the
+current frustum a number of times with BOX_ON_PLANE_SIDE, as the
+BSP walk used to, PS2_FrustumCullBox and PS2_FrustumCullBlocks,
+then prints the times and the boxes where the results differ.
+See also tools/cullbench.c.
+================
+*/
+static void PS2_RunCullBenchmark(const ps2_model_t * world_mdl)
+{
+    const int NUM_PASSES = 100;
+
+    const int num_boxes  = world_mdl->num_nodes + world_mdl->num_leafs;
+    const int num_blocks = PS2_CULL_NUM_BLOCKS(num_boxes);
+    if (num_boxes == 0)
+    {
+        return;
+    }
+
+    const int blocks_bytes = num_blocks * sizeof(ps2_cull_block_t);
+    const int flags_bytes  = num_blocks * 4;
+    ps2_cull_block_t * blocks = PS2_MemAllocAligned(16, blocks_bytes, MEMTAG_RENDERER);
+    byte * culled_ref   = PS2_MemAllocAligned(16, flags_bytes, MEMTAG_RENDERER);
+    byte * culled_block = PS2_MemAllocAligned(16, flags_bytes, MEMTAG_RENDERER);
+
+    // Pointers to the bounds, nodes first, in the same order as the blocks.
+    const float ** bounds = PS2_MemAlloc(num_boxes * sizeof(float *), MEMTAG_RENDERER);
+
+    int i, p, pass, start_time;
+    for (i = 0; i < world_mdl->num_nodes; ++i)
+    {
+        bounds[i] = world_mdl->nodes[i].minmaxs;
+    }
+    for (i = 0; i < world_mdl->num_leafs; ++i)
+    {
+        bounds[world_mdl->num_nodes + i] = world_mdl->leafs[i].minmaxs;
+    }
+
+    memset(&blocks[num_blocks - 1], 0, sizeof(ps2_cull_block_t));
+    for (i = 0; i < num_boxes; ++i)
+    {
+        PS2_CullBlockSetBox(blocks, i, bounds[i], bounds[i] + 3);
+    }
+
+    //
+    // BOX_ON_PLANE_SIDE:
+    //
+    start_time = Sys_Milliseconds();
+    for (pass = 0; pass < NUM_PASSES; ++pass)
+    {
+        for (i = 0; i < num_boxes; ++i)
+        {
+            vec_t * mins = (vec_t *)bounds[i];
+            vec_t * maxs = (vec_t *)bounds[i] + 3;
+
+            culled_ref[i] = false;
+            for (p = 0; p < PS2_FRUSTUM_PLANES; ++p)
+            {
+                if (BOX_ON_PLANE_SIDE(mins, maxs, &ps2_frustum[p]) == 2)
+                {
+                    culled_ref[i] = true;
+                    break;
+                }
+            }
+        }
+    }
+    const int ref_time = Sys_Milliseconds() - start_time;
+
+    //
+    // One box at a time:
+    //
+    int num_culled = 0;
+    start_time = Sys_Milliseconds();
+    for (pass = 0; pass < NUM_PASSES; ++pass)
+    {
+        num_culled = 0;
+        for (i = 0; i < num_boxes; ++i)
+        {
+            num_culled += PS2_FrustumCullBox(&ps2_cull_frustum, bounds[i], bounds[i] + 3);
+        }
+    }
+    const int box_time = Sys_Milliseconds() - start_time;
+
+    //
+    // 4 at a time:
+    //
+    start_time = Sys_Milliseconds();
+    for (pass = 0; pass < NUM_PASSES; ++pass)
+    {
+        PS2_FrustumCullBlocks(&ps2_cull_frustum, blocks, num_blocks, culled_block);
+    }
+    const int block_time = Sys_Milliseconds() - start_time;
+
+    int mismatches = 0;
+    for (i = 0; i < num_boxes; ++i)
+    {
+        if (culled_block[i] != culled_ref[i])
+        {
+            ++mismatches;
+        }
+    }
+
+    const float num_runs = (float)NUM_PASSES;
+    Com_Printf("Cull bench: %d boxes, %d culled, %d passes.\n", num_boxes, num_culled, NUM_PASSES);
+    Com_Printf("  BOX_ON_PLANE_SIDE:     %.3f ms\n", ref_time / num_runs);
+    Com_Printf("  PS2_FrustumCullBox:    %.3f ms\n", box_time / num_runs);
+    Com_Printf("  PS2_FrustumCullBlocks: %.3f ms, %d boxes differ.\n", block_time / num_runs, mismatches);
+
+    PS2_MemFree(bounds, num_boxes * sizeof(float *), MEMTAG_RENDERER);
+    PS2_MemFree(culled_block, flags_bytes, MEMTAG_RENDERER);
+    PS2_MemFree(culled_ref, flags_bytes, MEMTAG_RENDERER);
+    PS2_MemFree(blocks, blocks_bytes, MEMTAG_RENDERER);
+}
+
+/*
+================
+PS2_RunDLightBenchmark
+
+Remarks: Local function.
+Draws the world of the current view a number of times with 0, 8 and
+MAX_DLIGHTS dynamic lights and prints the time per frame of each.
+The lights are the ones CL_AddDLights gave this frame, repeated to
+make up the count, or a ring of lights in front of the view if there
+are none. Times include the light marking, the surface gathering and
+drawing the batches, up to the GS finishing them.
+================
+*/
+static void PS2_RunDLightBenchmark(const refdef_t * view_def, ps2_model_t * world_mdl)
+{
+    const int NUM_PASSES = 20;
+    const int light_counts[3] = { 0, 8, MAX_DLIGHTS };
+
+    dlight_t bench_lights[MAX_DLIGHTS];
+    int i, c, pass, start_time;
+
+    for (i = 0; i < MAX_DLIGHTS; ++i)
+    {
+        dlight_t * light = &bench_lights[i];
+        if (view_def->num_dlights > 0)
+        {
+            *light = view_def->dlights[i % view_def->num_dlights];
+            continue;
+        }
+
+        const float angle = i * (2.0f * M_PI / MAX_DLIGHTS);
+        VectorCopy(view_def->vieworg, light->origin);
+        VectorMA(light->origin, 192.0f, (float *)&ps2_forward_vec, light->origin);
+        VectorMA(light->origin, 128.0f * ps2_cosf(angle), (float *)&ps2_right_vec, light->origin);
+        VectorMA(light->origin, 128.0f * ps2_sinf(angle), (float *)&ps2_up_vec, light->origin);
+        light->color[0]  = (i & 1) ? 1.0f : 0.5f;
+        light->color[1]  = (i & 2) ? 1.0f : 0.5f;
+        light->color[2]  = (i & 4) ? 1.0f : 0.5f;
+        light->intensity = 200.0f;
+    }
+
+    const dlight_t * saved_dlights = ps2_dlights;
+    const int saved_active = ps2_dlights_active;
+    ps2_dlights = bench_lights;
+
+    Com_Printf("DLight bench: %d passes, %d lights in the frame.\n", NUM_PASSES, view_def->num_dlights);
+    for (c = 0; c < 3; ++c)
+    {
+        int lit_surfs = 0, lit_batches = 0, num_batches = 0;
+        ps2_dlights_active = light_counts[c];
+
+        start_time = Sys_Milliseconds();
+        for (pass = 0; pass < NUM_PASSES; ++pass)
+        {
+            ++ps2_frame_count;
+            ps2_dlight_surfs      = 0;
+            ps2_dlight_vu_batches = 0;
+            ps2_num_vu_batches    = 0;
+
+            PS2_SetDLightOrigins(NULL);
+            PS2_PushDLights(world_mdl, world_mdl->nodes);
+            if (!PS2_CachedWorldSurfaces(view_def, world_mdl))
+            {
+                PS2_MarkLeaves(world_mdl);
+                PS2_RecursiveWorldNode(view_def, world_mdl, world_mdl->nodes);
+            }
+            PS2_DrawTextureChains();
+            PS2_WaitGSDrawFinish();
+
+            // Translucent surfaces are drawn with the entities, not here.
+            ps2_num_alpha_draws = 0;
+
+            lit_surfs   += ps2_dlight_surfs;
+            lit_batches += ps2_dlight_vu_batches;
+            num_batches += ps2_num_vu_batches;
+        }
+        const int time = Sys_Milliseconds() - start_time;
+
+        Com_Printf("  %2d lights: %.3f ms/frame, %d surfaces lit, %d of %d batches lit.\n",
+                   light_counts[c], time / (float)NUM_PASSES, lit_surfs / NUM_PASSES,
+                   lit_batches / NUM_PASSES, num_batches / NUM_PASSES);
+    }
+
+    // Back to the frame being drawn:
+    ps2_dlights           = saved_dlights;
+    ps2_dlights_active    = saved_active;
+    ps2_dlight_surfs      = 0;
+    ps2_dlight_vu_batches = 0;
+    ps2_num_vu_batches    = 0;
+    ps2_warp_surfs_drawn  = 0;
+    ps2_warp_vu_batches   = 0;
+    ++ps2_frame_count;
 }
 
 //=============================================================================
@@ -945,6 +2422,24 @@ static void PS2_SetUpFrustum(const refdef_t * view_def)
 //
 //=============================================================================
 
+/*
+================
+PS2_ViewDrawInit
+================
+*/
+void PS2_ViewDrawInit(void)
+{
+    r_ps2_guard_clip   = Cvar_Get("r_ps2_guard_clip",   "1", 0);
+    r_ps2_vu_capture   = Cvar_Get("r_ps2_vu_capture",   "0", 0);
+    r_ps2_vis_record   = Cvar_Get("r_ps2_vis_record",   "0", 0);
+    r_ps2_vis_bench    = Cvar_Get("r_ps2_vis_bench",    "0", 0);
+    r_ps2_cull_bench   = Cvar_Get("r_ps2_cull_bench",   "0", 0);
+    r_ps2_dlights      = Cvar_Get("r_ps2_dlights",      "1", 0);
+    r_ps2_dlight_bench = Cvar_Get("r_ps2_dlight_bench", "0", 0);
+    PS2_VisCacheInit();
+    PS2_SkyInit();
+}
+
 /*
 ================
 PS2_DrawFrameSetup
@@ -989,6 +2484,41 @@ void PS2_DrawFrameSetup(const refdef_t * view_def)
     ps2_vu_batch_vert_count = 0;
     ps2_current_giftag = NULL;
     ps2_current_batch_data = NULL;
+
+    ps2_alias_models_drawn = 0;
+    ps2_alias_vu_batches = 0;
+
+    ps2_num_brush_draws     = 0;
+    ps2_brush_models_drawn  = 0;
+    ps2_brush_models_culled = 0;
+    ps2_brush_groups        = 0;
+
+    // The world transform is the first one of the translucent surfaces.
+    ps2_view_time         = view_def->time;
+    ps2_num_warp_draws    = 0;
+    ps2_num_alpha_draws   = 0;
+    ps2_warp_surfs_drawn  = 0;
+    ps2_alpha_surfs_drawn = 0;
+    ps2_warp_vu_batches   = 0;
+    Mat4_Copy(&ps2_alpha_mvps[0], &ps2_view_proj_matrix);
+    ps2_num_alpha_mvps  = 1;
+    ps2_alpha_mvp_index = 0;
+
+    // From CL_AddDLights. Marked by PS2_PushDLights for each model drawn.
+    ps2_dlights           = view_def->dlights;
+    ps2_dlights_active    = (r_ps2_dlights->value != 0.0f) ? view_def->num_dlights : 0;
+    if (ps2_dlights_active > MAX_DLIGHTS)
+    {
+        ps2_dlights_active = MAX_DLIGHTS;
+    }
+    ps2_dlight_surfs      = 0;
+    ps2_dlight_vu_batches = 0;
+
+    // Queued by the entity pass, drawn before the translucent surfaces.
+    PS2_SpriteBeginFrame(view_def);
+
+    // Entities may draw without the world (RDF_NOWORLDMODEL).
+    SetVUProg();
 }
 
 /*
@@ -1005,11 +2535,70 @@ void PS2_DrawWorldModel(refdef_t * view_def)
         return;
     }
 
+    if (r_ps2_vu_capture->value)
+    {
+        const char * filename = va("%s/%s", FS_Gamedir(), VU1_GUARD_CAPTURE_FILENAME);
+        ps2_vu_capture_file = fopen(filename, "wb");
+        if (ps2_vu_capture_file != NULL)
+        {
+            const int header[2] = { VU1_GUARD_CAPTURE_MAGIC, VU1_GUARD_CAPTURE_VERSION };
+            fwrite(header, sizeof(header), 1, ps2_vu_capture_file);
+        }
+        else
+        {
+            Com_Printf("Can't open '%s' for writing!\n", filename);
+        }
+        ps2_vu_captured_batches = 0;
+        Cvar_Set("r_ps2_vu_capture", "0");
+    }
+
     ps2_model_t * world_mdl = PS2_ModelGetWorld();
-    PS2_MarkLeaves(world_mdl);
-    PS2_RecursiveWorldNode(view_def, world_mdl, world_mdl->nodes);
+
+    PS2_RecordVisPath(view_def);
+    if (r_ps2_vis_bench->value)
+    {
+        Cvar_Set("r_ps2_vis_bench", "0");
+        PS2_RunVisBenchmark(view_def, world_mdl);
+    }
+    if (r_ps2_cull_bench->value)
+    {
+        Cvar_Set("r_ps2_cull_bench", "0");
+        PS2_RunCullBenchmark(world_mdl);
+    }
+    if (r_ps2_dlight_bench->value)
+    {
+        Cvar_Set("r_ps2_dlight_bench", "0");
+        PS2_RunDLightBenchmark(view_def, world_mdl);
+    }
+
+    ps2_world_leafs_culled   = 0;
+    ps2_world_surfs_backface = 0;
+    PS2_SkyBeginFrame(view_def);
+
+    PS2_SetDLightOrigins(NULL);
+    PS2_PushDLights(world_mdl, world_mdl->nodes);
+
+    if (!PS2_CachedWorldSurfaces(view_def, world_mdl))
+    {
+        PS2_MarkLeaves(world_mdl);
+        PS2_RecursiveWorldNode(view_def, world_mdl, world_mdl->nodes);
+    }
+
+    ps2_world_tex_chains        = ps2_num_chained_teximages;
+    ps2_world_tex_slots_skipped = MAX_TEXIMAGES - ps2_num_chained_teximages;
+    ps2_world_tex_switches      = 0;
     PS2_DrawTextureChains();
 
+    // Only fills what the world left uncovered, so it can go after it.
+    PS2_SkyDraw(view_def, &ps2_view_proj_matrix);
+
+    if (ps2_vu_capture_file != NULL)
+    {
+        fclose(ps2_vu_capture_file);
+        ps2_vu_capture_file = NULL;
+        Com_Printf("Captured %d VU1 world batches to '%s'.\n", ps2_vu_captured_batches, VU1_GUARD_CAPTURE_FILENAME);
+    }
+
     PS2_DrawAltString(10, viddef.height - 30, va("batches: %d", ps2_num_vu_batches));
 }
 
@@ -1077,8 +2666,63 @@ void PS2_DrawViewEntities(refdef_t * view_def)
         } // switch (model->type)
     }
 
+    // Queued by PS2_DrawBrushModel above.
+    PS2_DrawBrushModels(view_def);
+
     //
     // Now draw the translucent/transparent ones:
     //
-    //TODO!
+    for (i = 0; i < num_entities; ++i)
+    {
+        entity = &entities_list[i];
+        if (!(entity->flags & RF_TRANSLUCENT))
+        {
+            continue; // Already drawn.
+        }
+
+        if (entity->flags & RF_BEAM)
+        {
+            PS2_DrawBeamModel(entity);
+            continue;
+        }
+
+        model = (const ps2_model_t *)entity->model;
+        if (model == NULL || model->type == MDL_NULL)
+        {
+            PS2_DrawNullModel(entity);
+            continue;
+        }
+
+        switch (model->type)
+        {
+        case MDL_BRUSH :
+            PS2_DrawBrushModel(entity);
+            break;
+
+        case MDL_SPRITE :
+            PS2_DrawSpriteModel(entity);
+            break;
+
+        case MDL_ALIAS :
+            PS2_DrawAliasMD2Model(entity);
+            break;
+
+        default:
+            Sys_Error("PS2_DrawViewEntities: Bad model type for '%s'!", model->name);
+        } // switch (model->type)
+    }
+
+    // Translucent brush models only queue their surfaces for PS2_DrawAlphaSurfaces.
+    PS2_DrawBrushModels(view_def);
+
+    // Sprites, beams and null models of both passes, farthest group first.
+    PS2_SpriteDraw(&ps2_view_proj_matrix);
+
+    // Then the translucent world and brush model surfaces.
+    PS2_DrawAlphaSurfaces();
+
+    PS2_DrawAltString(10, viddef.height - 40, va("alias: %d models, %d batches",
+                      ps2_alias_models_drawn, ps2_alias_vu_batches));
+    PS2_DrawAltString(10, viddef.height - 50, va("brush: %d models, %d culled, %d groups",
+                      ps2_brush_models_drawn, ps2_brush_models_culled, ps2_brush_groups));
 }
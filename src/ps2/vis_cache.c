@@ -0,0 +1,353 @@
+
+/* ================================================================================================
+ * -*- C -*-
+ * File: vis_cache.c
+ * Brief: Per PVS cluster lists of potentially visible world surfaces, cached
+ *        so the world traversal doesn't have to walk the BSP every frame.
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#include "ps2/vis_cache.h"
+#include "ps2/mem_alloc.h"
+
+// Cache counters since the last map load:
+int ps2_vis_cache_hits      = 0;
+int ps2_vis_cache_builds    = 0;
+int ps2_vis_cache_evictions = 0;
+int ps2_vis_cache_rejects   = 0;
+int ps2_vis_cache_bytes     = 0;
+
+// Set to 0 to always walk the BSP. The lists are capped at r_ps2_vis_cache_kb,
+// 512 KB by default: with the leaf bounds for the frustum test (24 bytes per
+// leaf) a list is about three times the size of its indexes alone.
+static cvar_t * r_ps2_vis_cache    = NULL;
+static cvar_t * r_ps2_vis_cache_kb = NULL;
+
+// Cluster number => cached list or null. Sized for the current world.
+static ps2_vis_cluster_t ** ps2_vis_cluster_table = NULL;
+static int ps2_vis_cluster_table_size = 0;
+
+// Cached lists, most recently used at the head.
+static ps2_vis_cluster_t * ps2_vis_lru_head = NULL;
+static ps2_vis_cluster_t * ps2_vis_lru_tail = NULL;
+
+// Backface test planes of the current world, if built.
+static ps2_vis_surf_planes_t ps2_vis_surf_planes;
+static int ps2_vis_surf_planes_bytes = 0;
+
+/*
+================
+PS2_VisCacheUnlink
+
+Remarks: Local function.
+================
+*/
+static void PS2_VisCacheUnlink(ps2_vis_cluster_t * list)
+{
+    if (list->prev != NULL)
+    {
+        list->prev->next = list->next;
+    }
+    else
+    {
+        ps2_vis_lru_head = list->next;
+    }
+
+    if (list->next != NULL)
+    {
+        list->next->prev = list->prev;
+    }
+    else
+    {
+        ps2_vis_lru_tail = list->prev;
+    }
+
+    list->prev = NULL;
+    list->next = NULL;
+}
+
+/*
+================
+PS2_VisCacheLinkFront
+
+Remarks: Local function.
+================
+*/
+static void PS2_VisCacheLinkFront(ps2_vis_cluster_t * list)
+{
+    list->prev = NULL;
+    list->next = ps2_vis_lru_head;
+
+    if (ps2_vis_lru_head != NULL)
+    {
+        ps2_vis_lru_head->prev = list;
+    }
+    else
+    {
+        ps2_vis_lru_tail = list;
+    }
+
+    ps2_vis_lru_head = list;
+}
+
+/*
+================
+PS2_VisCacheFreeList
+
+Remarks: Local function.
+================
+*/
+static void PS2_VisCacheFreeList(ps2_vis_cluster_t * list)
+{
+    PS2_VisCacheUnlink(list);
+    ps2_vis_cluster_table[list->cluster] = NULL;
+    ps2_vis_cache_bytes -= list->size_bytes;
+    PS2_MemFree(list, list->size_bytes, MEMTAG_RENDERER);
+}
+
+/*
+================
+PS2_VisCacheInit
+================
+*/
+void PS2_VisCacheInit(void)
+{
+    r_ps2_vis_cache    = Cvar_Get("r_ps2_vis_cache",    "1",   0);
+    r_ps2_vis_cache_kb = Cvar_Get("r_ps2_vis_cache_kb", "512", 0);
+}
+
+/*
+================
+PS2_VisCacheReset
+================
+*/
+void PS2_VisCacheReset(void)
+{
+    while (ps2_vis_lru_head != NULL)
+    {
+        PS2_VisCacheFreeList(ps2_vis_lru_head);
+    }
+
+    if (ps2_vis_cluster_table != NULL)
+    {
+        PS2_MemFree(ps2_vis_cluster_table, ps2_vis_cluster_table_size * sizeof(ps2_vis_cluster_t *), MEMTAG_RENDERER);
+        ps2_vis_cluster_table = NULL;
+        ps2_vis_cluster_table_size = 0;
+    }
+
+    if (ps2_vis_surf_planes.normal_x != NULL)
+    {
+        // One block, normal_x is the start of it.
+        PS2_MemFree(ps2_vis_surf_planes.normal_x, ps2_vis_surf_planes_bytes, MEMTAG_RENDERER);
+        PS2_MemClearObj(&ps2_vis_surf_planes);
+        ps2_vis_surf_planes_bytes = 0;
+    }
+
+    ps2_vis_cache_hits      = 0;
+    ps2_vis_cache_builds    = 0;
+    ps2_vis_cache_evictions = 0;
+    ps2_vis_cache_rejects   = 0;
+    ps2_vis_cache_bytes     = 0;
+}
+
+/*
+================
+PS2_VisCacheEnabled
+================
+*/
+qboolean PS2_VisCacheEnabled(void)
+{
+    return r_ps2_vis_cache->value && r_ps2_vis_cache_kb->value > 0.0f;
+}
+
+/*
+================
+PS2_VisCacheFind
+================
+*/
+const ps2_vis_cluster_t * PS2_VisCacheFind(int cluster)
+{
+    if (cluster < 0 || cluster >= ps2_vis_cluster_table_size)
+    {
+        return NULL;
+    }
+
+    ps2_vis_cluster_t * list = ps2_vis_cluster_table[cluster];
+    if (list == NULL)
+    {
+        return NULL;
+    }
+
+    if (list != ps2_vis_lru_head)
+    {
+        PS2_VisCacheUnlink(list);
+        PS2_VisCacheLinkFront(list);
+    }
+
+    ++ps2_vis_cache_hits;
+    return list;
+}
+
+/*
+================
+PS2_VisCacheAdd
+================
+*/
+const ps2_vis_cluster_t * PS2_VisCacheAdd(const ps2_model_t * world_mdl, int cluster, const byte * pvs)
+{
+    if (world_mdl->vis == NULL || cluster < 0 || cluster >= world_mdl->vis->numclusters)
+    {
+        return NULL;
+    }
+
+    if (ps2_vis_cluster_table == NULL)
+    {
+        ps2_vis_cluster_table_size = world_mdl->vis->numclusters;
+        ps2_vis_cluster_table = PS2_MemAlloc(ps2_vis_cluster_table_size * sizeof(ps2_vis_cluster_t *), MEMTAG_RENDERER);
+        memset(ps2_vis_cluster_table, 0, ps2_vis_cluster_table_size * sizeof(ps2_vis_cluster_t *));
+    }
+
+    if (ps2_vis_cluster_table[cluster] != NULL)
+    {
+        return PS2_VisCacheFind(cluster);
+    }
+
+    //
+    // Size it first, then fill it in:
+    //
+    int i;
+    int num_leafs = 0;
+    int num_surfs = 0;
+    const ps2_mdl_leaf_t * leaf;
+
+    for (i = 0, leaf = world_mdl->leafs; i < world_mdl->num_leafs; ++i, ++leaf)
+    {
+        const int c = leaf->cluster;
+        if (c == -1 || leaf->num_mark_surfaces == 0)
+        {
+            continue;
+        }
+        if (pvs[c >> 3] & (1 << (c & 7)))
+        {
+            ++num_leafs;
+            num_surfs += leaf->num_mark_surfaces;
+        }
+    }
+
+    // Header padded to keep the bounds aligned, then the indexes.
+    const int header_bytes = (sizeof(ps2_vis_cluster_t) + 15) & ~15;
+    const int num_blocks   = PS2_CULL_NUM_BLOCKS(num_leafs);
+    const int size_bytes   = header_bytes + num_blocks * sizeof(ps2_cull_block_t) +
+                             (num_leafs + num_surfs) * sizeof(u16);
+    const int cap_bytes    = (int)r_ps2_vis_cache_kb->value * 1024;
+
+    if (size_bytes > cap_bytes)
+    {
+        ++ps2_vis_cache_rejects;
+        return NULL;
+    }
+
+    // Make room, leaving the most recently used alone.
+    while (ps2_vis_cache_bytes + size_bytes > cap_bytes)
+    {
+        if (ps2_vis_lru_tail == NULL || ps2_vis_lru_tail == ps2_vis_lru_head)
+        {
+            ++ps2_vis_cache_rejects;
+            return NULL;
+        }
+        PS2_VisCacheFreeList(ps2_vis_lru_tail);
+        ++ps2_vis_cache_evictions;
+    }
+
+    ps2_vis_cluster_t * list = PS2_MemAllocAligned(16, size_bytes, MEMTAG_RENDERER);
+    list->prev       = NULL;
+    list->next       = NULL;
+    list->cluster    = cluster;
+    list->size_bytes = size_bytes;
+    list->num_leafs  = num_leafs;
+    list->num_surfs  = num_surfs;
+    list->bounds     = (ps2_cull_block_t *)((byte *)list + header_bytes);
+    list->leafs      = (u16 *)(list->bounds + num_blocks);
+    list->surfs      = list->leafs + num_leafs;
+
+    if (num_blocks > 0)
+    {
+        memset(&list->bounds[num_blocks - 1], 0, sizeof(ps2_cull_block_t));
+    }
+
+    u16 * out_leaf = list->leafs;
+    u16 * out_surf = list->surfs;
+
+    for (i = 0, leaf = world_mdl->leafs; i < world_mdl->num_leafs; ++i, ++leaf)
+    {
+        const int c = leaf->cluster;
+        if (c == -1 || leaf->num_mark_surfaces == 0)
+        {
+            continue;
+        }
+        if (!(pvs[c >> 3] & (1 << (c & 7))))
+        {
+            continue;
+        }
+
+        PS2_CullBlockSetBox(list->bounds, out_leaf - list->leafs, leaf->minmaxs, leaf->minmaxs + 3);
+        *out_leaf++ = (u16)i;
+
+        int s;
+        for (s = 0; s < leaf->num_mark_surfaces; ++s)
+        {
+            *out_surf++ = (u16)(leaf->first_mark_surface[s] - world_mdl->surfaces);
+        }
+    }
+
+    ps2_vis_cluster_table[cluster] = list;
+    PS2_VisCacheLinkFront(list);
+
+    ps2_vis_cache_bytes += size_bytes;
+    ++ps2_vis_cache_builds;
+    return list;
+}
+
+/*
+================
+PS2_VisCacheSurfPlanes
+================
+*/
+const ps2_vis_surf_planes_t * PS2_VisCacheSurfPlanes(const ps2_model_t * world_mdl)
+{
+    if (ps2_vis_surf_planes.normal_x != NULL)
+    {
+        return &ps2_vis_surf_planes;
+    }
+
+    // Four float arrays, the scratch indexes and the leaf flags, in one block.
+    const int n = world_mdl->num_surfaces;
+    const int leaf_flags_offset = (n * (4 * sizeof(float) + sizeof(u16)) + 3) & ~3;
+    ps2_vis_surf_planes_bytes = leaf_flags_offset + PS2_CULL_NUM_BLOCKS(world_mdl->num_leafs) * 4;
+
+    float * block = PS2_MemAllocAligned(16, ps2_vis_surf_planes_bytes, MEMTAG_RENDERER);
+    ps2_vis_surf_planes.num_surfs = n;
+    ps2_vis_surf_planes.normal_x  = block;
+    ps2_vis_surf_planes.normal_y  = block + n;
+    ps2_vis_surf_planes.normal_z  = block + n * 2;
+    ps2_vis_surf_planes.dist      = block + n * 3;
+    ps2_vis_surf_planes.scratch   = (u16 *)(block + n * 4);
+    ps2_vis_surf_planes.leaf_culled = (byte *)block + leaf_flags_offset;
+
+    int i;
+    const ps2_mdl_surface_t * surf;
+    for (i = 0, surf = world_mdl->surfaces; i < n; ++i, ++surf)
+    {
+        const cplane_t * plane = surf->plane;
+        const float sign = (surf->flags & SURF_PLANEBACK) ? -1.0f : 1.0f;
+
+        ps2_vis_surf_planes.normal_x[i] = plane->normal[0] * sign;
+        ps2_vis_surf_planes.normal_y[i] = plane->normal[1] * sign;
+        ps2_vis_surf_planes.normal_z[i] = plane->normal[2] * sign;
+        ps2_vis_surf_planes.dist[i]     = plane->dist * sign;
+    }
+
+    return &ps2_vis_surf_planes;
+}
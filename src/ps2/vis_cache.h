@@ -0,0 +1,113 @@
+/* ================================================================================================
+ * -*- C -*-
+ * File: vis_cache.h
+ * Brief: Per PVS cluster lists of potentially visible world surfaces, cached
+ *        so the world traversal doesn't have to walk the BSP every frame.
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#ifndef PS2_VIS_CACHE_H
+#define PS2_VIS_CACHE_H
+
+#include "ps2/model_load.h"
+#include "ps2/frustum_cull.h"
+
+//
+// A list is built the first time the view enters a cluster and kept
+// around until the lists take more than r_ps2_vis_cache_kb, then the
+// least recently used ones are freed. A new map frees all of them.
+//
+// 'leafs' are the leafs in the PVS of the cluster that have surfaces,
+// as indexes into world->leafs[], and 'surfs' their mark surfaces, back
+// to back (leaf->num_mark_surfaces each), as indexes into world->surfaces[].
+// A surface shared by several leafs is repeated, since it has to be drawn
+// if any of them is in the frustum. The format limits both to 65536, same
+// as the BSP file. 'bounds' has the boxes of the leafs, in the same order,
+// for PS2_FrustumCullBlocks.
+//
+typedef struct ps2_vis_cluster_s
+{
+    struct ps2_vis_cluster_s * prev; // LRU links, most recently used first
+    struct ps2_vis_cluster_s * next;
+
+    int cluster;
+    int size_bytes; // Whole block, this header included
+    int num_leafs;
+    int num_surfs;
+
+    ps2_cull_block_t * bounds;
+    u16 * leafs;
+    u16 * surfs;
+} ps2_vis_cluster_t;
+
+//
+// Planes of every world surface for the backface test, as separate
+// arrays for a tight loop over the surface indexes. The plane is flipped
+// for SURF_PLANEBACK surfaces, so a surface faces the eye if
+// dot(eye, normal) - dist >= 0. 'scratch' has room for one index per
+// surface, for the traversal to gather the surfaces to test, and
+// 'leaf_culled' for the frustum flags of the leafs of a list.
+//
+typedef struct
+{
+    int num_surfs;
+    float * normal_x;
+    float * normal_y;
+    float * normal_z;
+    float * dist;
+    u16   * scratch;
+    byte  * leaf_culled;
+} ps2_vis_surf_planes_t;
+
+//
+// Camera path recorded by the renderer (r_ps2_vis_record) and replayed
+// through both world traversals by r_ps2_vis_bench: the magic, version
+// and frame count ints, then the frames.
+//
+#define PS2_VIS_PATH_FILENAME "vispath.bin"
+enum
+{
+    PS2_VIS_PATH_MAGIC      = (('P' << 24) + ('S' << 16) + ('I' << 8) + 'V'), // 'VISP'
+    PS2_VIS_PATH_VERSION    = 1,
+    PS2_VIS_PATH_MAX_FRAMES = 4096
+};
+
+typedef struct
+{
+    float origin[3];
+    float angles[3];
+    float fov_x;
+    float fov_y;
+} ps2_vis_path_frame_t;
+
+// Cache counters since the last map load (for PS2_DrawRenderStats).
+extern int ps2_vis_cache_hits;
+extern int ps2_vis_cache_builds;
+extern int ps2_vis_cache_evictions;
+extern int ps2_vis_cache_rejects; // Lists that didn't fit under the cap
+extern int ps2_vis_cache_bytes;   // Lists currently allocated
+
+// Registers the cache CVars.
+void PS2_VisCacheInit(void);
+
+// Frees all the lists and the surface planes. Called when the world changes.
+void PS2_VisCacheReset(void);
+
+// False if r_ps2_vis_cache is off or has no memory to work with.
+qboolean PS2_VisCacheEnabled(void);
+
+// List for the cluster if already cached, null otherwise.
+const ps2_vis_cluster_t * PS2_VisCacheFind(int cluster);
+
+// Builds the list for the cluster from its decompressed PVS row. Might free
+// older lists to stay under the cap, but never the most recently used one,
+// so the two view clusters of a frame can't push each other out. Returns
+// null if the list can't fit, the caller should use the BSP walk then.
+const ps2_vis_cluster_t * PS2_VisCacheAdd(const ps2_model_t * world_mdl, int cluster, const byte * pvs);
+
+// Surface planes of the world, built on the first call after a reset.
+const ps2_vis_surf_planes_t * PS2_VisCacheSurfPlanes(const ps2_model_t * world_mdl);
+
+#endif // PS2_VIS_CACHE_H
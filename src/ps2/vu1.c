@@ -43,13 +43,13 @@ void VU1_Shutdown(void)
     }
 }
 
-void VU1_UploadProg(void * vu1_code_start, void * vu1_code_end)
+void VU1_UploadProg(int dest_address, void * vu1_code_start, void * vu1_code_end)
 {
-    printf("Uploading VU proog from 0x%x to 0x%x", (u32)vu1_code_start, (u32)vu1_code_end);
+    printf("Uploading VU proog from 0x%x to 0x%x at %d", (u32)vu1_code_start, (u32)vu1_code_end, dest_address);
     // + 1 for end tag
 	u32 packet_size = packet2_utils_get_packet_size_for_program(vu1_code_start, vu1_code_end) + 1; 
 	packet2_t *packet2 = packet2_create(packet_size, P2_TYPE_NORMAL, P2_MODE_CHAIN, 1);
-	packet2_vif_add_micro_program(packet2, 0, vu1_code_start, vu1_code_end);
+	packet2_vif_add_micro_program(packet2, dest_address, vu1_code_start, vu1_code_end);
 	packet2_utils_vu_add_end_tag(packet2);
 	dma_channel_send_packet2(packet2, DMA_CHANNEL_VIF1, 1);
 	dma_channel_wait(DMA_CHANNEL_VIF1, 0);
@@ -97,6 +97,11 @@ void VU1_End(int startProg)
     //printf("    sent\n");
 }
 
+void VU1_Wait(void)
+{
+    dma_channel_wait(DMA_CHANNEL_VIF1, 0);
+}
+
 void VU1_ListAddBegin(int address_qw)
 {
     // Adds CNT, STCYCL (wl=0, cl=0x101), UNPACK V4_32 dest_adderss = address, no tops, signed, no IRQ
@@ -137,3 +142,16 @@ void VU1_ListAddFloat(float v)
 {
     packet2_add_float(buildingPacket, v);
 }
+
+void VU1_ListRaw(const void * data, int quad_size)
+{
+    // Copied under a CNT tag, so the caller can reuse the buffer right away.
+    const u64 * qwords = (const u64 *)data;
+    packet2_chain_open_cnt(buildingPacket, 0, 0, 0);
+    while (quad_size--)
+    {
+        packet2_add_2x_s64(buildingPacket, qwords[0], qwords[1]);
+        qwords += 2;
+    }
+    packet2_chain_close_tag(buildingPacket);
+}
@@ -13,18 +13,37 @@
 #ifndef PS2_VU1_H
 #define PS2_VU1_H
 
+#include "ps2/defs_ps2.h"
+
+// VU1 data memory is 16K, 1024 quadwords.
+#define VU1_MEM_QWORDS 1024
+
+/*
+ * One VU1 memory quadword, for the C reference models
+ * of the microprograms that run on a memory image.
+ */
+typedef union ps2_vu_qword_u
+{
+    float f[4];
+    s32   i[4];
+    u32   u[4];
+} ps2_vu_qword_t PS2_ALIGN(16);
+
 // Initialize local VU1 library data. Call it at renderer startup.
 void VU1_Init(void);
 void VU1_Shutdown(void);
 
-// Send program microcode to the VU1.
-void VU1_UploadProg(void * start, void * end);
+// Send program microcode to the VU1, at 'dest_address' in micromem (instruction units).
+void VU1_UploadProg(int dest_address, void * start, void * end);
 
 // Begin a new program run;
 // End the current list and start the VU1 program (located in micromem 'start' address)
 void VU1_Begin(void);
 void VU1_End(int start);
 
+// Waits for the last list sent by VU1_End to be consumed by the VIF.
+void VU1_Wait(void);
+
 // Begin a new primitive list:
 void VU1_ListAddBegin(int address);
 void VU1_ListAddEnd(void);
@@ -35,6 +54,10 @@ void VU1_ListAdd128(u64 v1, u64 v2);
 void VU1_ListAdd32(u32 v);
 void VU1_ListAddFloat(float v);
 
+// Copy a ready made VIF code stream to the packet, outside of any list.
+// 'data' is 16 aligned, so the stream must be whole quadwords.
+void VU1_ListRaw(const void * data, int quad_size);
+
 // Adds an empty 128-bytes GIF tag + reglist to the draw list.
 // Returns the pointer to the first of the two quadwords.
 // You can then fill it with the tag data anytime before VU1_End().
@@ -0,0 +1,382 @@
+
+/* ================================================================================================
+ * -*- C -*-
+ * File: vu1_alias.c
+ * Brief: VIF packet generation for the VU1 alias (MD2) model program and
+ *        a C reference of the math it runs (alias_lerp.vsm).
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#include "ps2/vu1_alias.h"
+#include "ps2/gs_defs.h"
+
+#include <math.h>
+
+//
+// The VIF codes we use. Layout of a code word:
+// bits 0-15 immediate, 16-23 num, 24-30 command, 31 interrupt.
+//
+#define VIF_CODE(cmd, num, imm) (((u32)(cmd) << 24) | ((u32)(num) << 16) | (u32)(imm))
+
+enum
+{
+    VIF_NOP          = 0x00,
+    VIF_STCYCL       = 0x01,
+    VIF_FLUSH        = 0x11,
+    VIF_MSCAL        = 0x14,
+    VIF_UNPACK_V4_32 = 0x6C,
+    VIF_UNPACK_V4_8  = 0x6E,
+    VIF_UNPACK_USN   = 1 << 14  // Zero extend instead of sign extend (immediate field)
+};
+
+/*
+================
+VU1_AliasStripToStream
+================
+*/
+int VU1_AliasStripToStream(u16 * out, const int * indexes, const int * index_to_xyz, int count)
+{
+    int i, first = 0, written = 0;
+
+    // Strips longer than a batch are cut in pieces that share two
+    // vertexes, so the next piece picks up where the last one stopped.
+    // That may flip the winding of the piece, but the GS doesn't cull.
+    for (;;)
+    {
+        const int len = ((count - first) < VU1_ALIAS_MAX_VERTS) ? (count - first) : VU1_ALIAS_MAX_VERTS;
+        if (out != NULL)
+        {
+            for (i = 0; i < len; ++i)
+            {
+                out[written + i] = index_to_xyz[indexes[first + i]] | ((i < 2) ? VU1_ALIAS_STRIP_START : 0);
+            }
+        }
+        written += len;
+
+        if (first + len >= count)
+        {
+            break;
+        }
+        first += len - 2;
+    }
+
+    return written;
+}
+
+/*
+================
+VU1_AliasSetupConsts
+================
+*/
+void VU1_AliasSetupConsts(ps2_vu_alias_consts_t * consts, const m_mat4_t * mvp,
+                          const float * front_scale, const float * front_translate,
+                          const float * back_scale, const float * back_translate,
+                          float backlerp, const vec3_t light_dir,
+                          const float * ambient, const float * diffuse, float alpha, int blend)
+{
+    int i;
+    const float frontlerp = 1.0f - backlerp;
+
+    consts->mvp_matrix = *mvp;
+
+    // Same rasterizer scale factors used by the world batches.
+    consts->gs_scale_x = 2048.0f;
+    consts->gs_scale_y = 2048.0f;
+    consts->gs_scale_z = ((float)0xFFFFFF) / 32.0f;
+    consts->vert_count = 0;
+
+    // The lerp is folded into the decompression:
+    // pos = front * front_scale + back * back_scale + translate
+    for (i = 0; i < 3; ++i)
+    {
+        consts->front_scale[i] = front_scale[i] * frontlerp;
+        consts->back_scale[i]  = back_scale[i] * backlerp;
+        consts->translate[i]   = front_translate[i] * frontlerp + back_translate[i] * backlerp;
+        consts->light_dir[i]   = light_dir[i];
+        consts->ambient[i]     = ambient[i];
+        consts->diffuse[i]     = diffuse[i];
+    }
+
+    consts->front_scale[3] = frontlerp;
+    consts->back_scale[3]  = backlerp;
+    consts->translate[3]   = 1.0f;
+    consts->light_dir[3]   = 255.0f;
+    consts->ambient[3]     = alpha;
+    consts->diffuse[3]     = 0.0f;
+
+    // Vertex count is patched by VU1_AliasBuildBatch.
+    const u64 prim_desc = GS_PRIM(GS_PRIM_TRISTRIP, GS_PRIM_SGOURAUD, GS_PRIM_TOFF, GS_PRIM_FOFF,
+                                  (blend ? GS_PRIM_ABON : GS_PRIM_ABOFF), GS_PRIM_AAOFF,
+                                  GS_PRIM_FSTQ, 0, 0);
+    consts->giftag[0] = GS_GIFTAG(0, 1, 1, prim_desc, GS_GIFTAG_PACKED, 2);
+    consts->giftag[1] = ((u64)GS_REG_RGBAQ) | (((u64)GS_REG_XYZ2) << 4);
+}
+
+/*
+================
+VU1_AliasSetupNormals
+================
+*/
+void VU1_AliasSetupNormals(m_vec4_t table[NUMVERTEXNORMALS])
+{
+    int i;
+    for (i = 0; i < NUMVERTEXNORMALS; ++i)
+    {
+        table[i].x = bytedirs[i][0];
+        table[i].y = bytedirs[i][1];
+        table[i].z = bytedirs[i][2];
+        table[i].w = 0.0f;
+    }
+}
+
+/*
+================
+VU1_AliasBuildBatch
+================
+*/
+int VU1_AliasBuildBatch(u32 * vif, int * vif_qw, const ps2_vu_alias_consts_t * consts,
+                        const dtrivertx_t * front, const dtrivertx_t * back,
+                        const u16 * xyz, int count)
+{
+    int i, n;
+
+    // Take as much as fits, backing up to the start of the strip that
+    // didn't. A strip starts at an entry with the flag set that doesn't
+    // follow another flagged one (strips are at least 3 long).
+    n = (count < VU1_ALIAS_MAX_VERTS) ? count : VU1_ALIAS_MAX_VERTS;
+    if (n < count)
+    {
+        while (n > 0 && !((xyz[n] & VU1_ALIAS_STRIP_START) && !(xyz[n - 1] & VU1_ALIAS_STRIP_START)))
+        {
+            --n;
+        }
+        if (n == 0)
+        {
+            n = VU1_ALIAS_MAX_VERTS; // Not a stream from VU1_AliasStripToStream, draw it anyway.
+        }
+    }
+
+    // Wait for the previous batch to be kicked before overwriting its output,
+    // then send the constants as they are:
+    u32 * out = vif;
+    *out++ = VIF_CODE(VIF_NOP, 0, 0);
+    *out++ = VIF_CODE(VIF_FLUSH, 0, 0);
+    *out++ = VIF_CODE(VIF_STCYCL, 0, 1 | (1 << 8));
+    *out++ = VIF_CODE(VIF_UNPACK_V4_32, VU1_ALIAS_CONSTS_QW, 0);
+
+    ps2_vu_alias_consts_t * batch_consts = (ps2_vu_alias_consts_t *)out;
+    *batch_consts = *consts;
+    batch_consts->vert_count = n;
+    batch_consts->giftag[0] |= (u64)n; // NLOOP
+    out += VU1_ALIAS_CONSTS_QW * 4;
+
+    // Each dtrivertx_t is one word, unpacked as V4_8 into every other
+    // quadword: front frame at the even ones, back frame at the odd ones.
+    const u32 * front_words = (const u32 *)front;
+    const u32 * back_words  = (const u32 *)back;
+
+    *out++ = VIF_CODE(VIF_STCYCL, 0, 2 | (1 << 8));
+    *out++ = VIF_CODE(VIF_UNPACK_V4_8, n & 0xFF, VIF_UNPACK_USN | VU1_ALIAS_START_VERT);
+    for (i = 0; i < n; ++i)
+    {
+        *out++ = front_words[xyz[i] & ~VU1_ALIAS_STRIP_START];
+    }
+
+    // The back normal isn't used, that byte carries the strip start flag.
+    // Little endian, so lightnormalindex is the top byte.
+    *out++ = VIF_CODE(VIF_UNPACK_V4_8, n & 0xFF, VIF_UNPACK_USN | (VU1_ALIAS_START_VERT + 1));
+    for (i = 0; i < n; ++i)
+    {
+        const u32 flag = (xyz[i] & VU1_ALIAS_STRIP_START) ? (1u << 24) : 0;
+        *out++ = (back_words[xyz[i] & ~VU1_ALIAS_STRIP_START] & 0x00FFFFFF) | flag;
+    }
+
+    // Start the program. The write cycle goes back to the default
+    // the other lists expect; VIF doesn't wait on the VU for that.
+    *out++ = VIF_CODE(VIF_MSCAL, 0, VU1_ALIAS_PROG_ADDR);
+    *out++ = VIF_CODE(VIF_STCYCL, 0, 1 | (1 << 8));
+    while ((out - vif) & 3)
+    {
+        *out++ = VIF_CODE(VIF_NOP, 0, 0);
+    }
+
+    *vif_qw = (out - vif) >> 2;
+    return n;
+}
+
+//=============================================================================
+//
+// C reference of the VIF and VU1 side:
+//
+//=============================================================================
+
+/*
+================
+VU1_AliasReferenceProg
+
+Remarks: Local function.
+Same math and same order of operations as alias_lerp.vsm.
+================
+*/
+static void VU1_AliasReferenceProg(ps2_vu_qword_t * mem)
+{
+    int v, j;
+    const ps2_vu_qword_t * mvp = &mem[0];
+    const float * scales       = mem[4].f;
+    const float * front_scale  = mem[5].f;
+    const float * back_scale   = mem[6].f;
+    const float * translate    = mem[7].f;
+    const float * light_dir    = mem[8].f;
+    const float * ambient      = mem[9].f;
+    const float * diffuse      = mem[10].f;
+    const int     num_verts    = mem[4].i[3];
+
+    // Judgments of the last 4 CLIP instructions, 6 bits each.
+    u32 clip_flags = 0;
+
+    for (v = 0; v < num_verts; ++v)
+    {
+        ps2_vu_qword_t * vf = &mem[VU1_ALIAS_START_VERT + v * 2];
+        ps2_vu_qword_t * vb = vf + 1;
+
+        // ILW only loads 16 bits. LQ addresses wrap around.
+        const int normal = vf->i[3] & 0xFFFF;
+        const int start  = vb->i[3] & 0xFFFF;
+        const float * n  = mem[(VU1_ALIAS_NORMALS + normal) & (VU1_MEM_QWORDS - 1)].f;
+
+        // Lerp and decompress:
+        float pos[3];
+        for (j = 0; j < 3; ++j)
+        {
+            pos[j] = translate[j] + front_scale[j] * (float)vf->i[j] + back_scale[j] * (float)vb->i[j];
+        }
+
+        // Transform:
+        float clip[4];
+        for (j = 0; j < 4; ++j)
+        {
+            clip[j] = mvp[0].f[j] * pos[0] + mvp[1].f[j] * pos[1] + mvp[2].f[j] * pos[2] + mvp[3].f[j];
+        }
+
+        const float w = fabsf(clip[3]);
+        u32 judgment = 0;
+        for (j = 0; j < 3; ++j)
+        {
+            if (clip[j] > +w) { judgment |= 1 << (j * 2 + 0); }
+            if (clip[j] < -w) { judgment |= 1 << (j * 2 + 1); }
+        }
+        clip_flags = ((clip_flags << 6) | judgment) & 0xFFFFFF;
+
+        // A triangle is dropped if any of its 3 vertexes is outside,
+        // and the first two of each strip never close a triangle.
+        const int adc = ((clip_flags & 0x3FFFF) ? 1 : 0) + start + 0x7FFF;
+
+        // Light:
+        float dot = n[0] * light_dir[0] + n[1] * light_dir[1] + n[2] * light_dir[2];
+        if (dot < 0.0f)
+        {
+            dot = 0.0f;
+        }
+
+        float color[4];
+        for (j = 0; j < 4; ++j)
+        {
+            color[j] = ambient[j] + diffuse[j] * dot;
+        }
+        for (j = 0; j < 3; ++j)
+        {
+            if (color[j] > light_dir[3])
+            {
+                color[j] = light_dir[3];
+            }
+        }
+
+        // Project to the GS 12:4 fixed point:
+        const float q = 1.0f / clip[3];
+        for (j = 0; j < 3; ++j)
+        {
+            vb->i[j] = (s32)((scales[j] + clip[j] * q * scales[j]) * 16.0f);
+        }
+        vb->i[3] = adc;
+
+        for (j = 0; j < 4; ++j)
+        {
+            vf->i[j] = (s32)color[j];
+        }
+    }
+}
+
+/*
+================
+VU1_AliasRunVIF
+================
+*/
+qboolean VU1_AliasRunVIF(ps2_vu_qword_t * vu_mem, const u32 * vif, int vif_qw)
+{
+    int cl = 1, wl = 1;
+    const u32 * end = vif + vif_qw * 4;
+
+    while (vif < end)
+    {
+        const u32 code = *vif++;
+        const int cmd  = (code >> 24) & 0x7F;
+        const int num  = (code >> 16) & 0xFF;
+        const int imm  = code & 0xFFFF;
+
+        if (cmd == VIF_NOP || cmd == VIF_FLUSH)
+        {
+            continue;
+        }
+        if (cmd == VIF_STCYCL)
+        {
+            cl = imm & 0xFF;
+            wl = (imm >> 8) & 0xFF;
+            continue;
+        }
+        if (cmd == VIF_MSCAL)
+        {
+            if (imm != VU1_ALIAS_PROG_ADDR)
+            {
+                return false;
+            }
+            VU1_AliasReferenceProg(vu_mem);
+            continue;
+        }
+        if (cmd == VIF_UNPACK_V4_32 || cmd == VIF_UNPACK_V4_8)
+        {
+            int k, j;
+            const int count = num ? num : 256;
+            const int addr  = imm & 0x3FF;
+            const int words = (cmd == VIF_UNPACK_V4_32) ? 4 : 1;
+
+            if (wl == 0 || wl > cl || vif + count * words > end)
+            {
+                return false; // Only skipping write mode is used.
+            }
+
+            for (k = 0; k < count; ++k, vif += words)
+            {
+                ps2_vu_qword_t * dest = &vu_mem[(addr + (k / wl) * cl + (k % wl)) & (VU1_MEM_QWORDS - 1)];
+                for (j = 0; j < 4; ++j)
+                {
+                    if (cmd == VIF_UNPACK_V4_32)
+                    {
+                        dest->u[j] = vif[j];
+                    }
+                    else
+                    {
+                        const u32 b = (*vif >> (j * 8)) & 0xFF;
+                        dest->i[j] = (imm & VIF_UNPACK_USN) ? (s32)b : (s32)(s8)b;
+                    }
+                }
+            }
+            continue;
+        }
+
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,110 @@
+/* ================================================================================================
+ * -*- C -*-
+ * File: vu1_alias.h
+ * Brief: VIF packet generation for the VU1 alias (MD2) model program and
+ *        a C reference of the math it runs (alias_lerp.vsm).
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#ifndef PS2_VU1_ALIAS_H
+#define PS2_VU1_ALIAS_H
+
+#include "common/q_common.h"
+#include "ps2/defs_ps2.h"
+#include "ps2/vec_mat.h"
+#include "ps2/vu1.h"
+
+//
+// Nothing in here depends on the PS2DEV SDK, so the packet builder and
+// the reference implementation can be compiled and checked on a host PC.
+//
+// VU1 memory layout used by alias_lerp.vsm (quadword addresses):
+//
+//  0..3  MVP matrix (model to clip space)
+//  4     GS scale factors XYZ, W = vertex count
+//  5     front frame scale * frontlerp
+//  6     back frame scale * backlerp
+//  7     lerped translate, W = 1
+//  8     light direction in model space, W = color clamp (255)
+//  9     ambient color, W = alpha
+//  10    diffuse color
+//  11    GIF tag (RGBAQ + XYZ2 triangle strip)
+//  12..  vertexes, 2 qwords each: front dtrivertx_t, back dtrivertx_t
+//        unpacked as 4 ints. Overwritten in-place by RGBAQ and XYZ2.
+//  862.. the NUMVERTEXNORMALS normals table, uploaded once.
+//
+enum
+{
+    VU1_ALIAS_CONSTS_QW   = 12,
+    VU1_ALIAS_START_VERT  = 12,
+    VU1_ALIAS_NORMALS     = 1024 - NUMVERTEXNORMALS,
+
+    // Micromem address (in instructions) the program is uploaded to.
+    // The world triangles program sits at 0.
+    VU1_ALIAS_PROG_ADDR   = 512,
+
+    // One UNPACK moves at most 256 vertexes, which also keeps
+    // the batch well below the normals table.
+    VU1_ALIAS_MAX_VERTS   = 256,
+
+    // Set on the first two entries of every strip in the xyz stream.
+    // Sent to the VU in the back vertex normal byte, where it becomes
+    // the ADC bit so strips can be chained under one GIF tag.
+    VU1_ALIAS_STRIP_START = 0x8000,
+
+    // Worst case size of one batch VIF stream: header qword, the constants,
+    // then STCYCL, two UNPACKs with a word per vertex, MSCAL and STCYCL.
+    VU1_ALIAS_MAX_VIF_QW  = 1 + VU1_ALIAS_CONSTS_QW + (5 + VU1_ALIAS_MAX_VERTS * 2 + 3) / 4
+};
+
+/*
+ * Per draw constants. Mirrors VU memory 0..11 and
+ * is copied as-is at the start of every batch.
+ */
+typedef struct ps2_vu_alias_consts_s
+{
+    m_mat4_t mvp_matrix;
+    float    gs_scale_x;
+    float    gs_scale_y;
+    float    gs_scale_z;
+    int      vert_count;
+    float    front_scale[4];
+    float    back_scale[4];
+    float    translate[4];
+    float    light_dir[4];
+    float    ambient[4];
+    float    diffuse[4];
+    u64      giftag[2];
+} ps2_vu_alias_consts_t PS2_ALIGN(16);
+
+// Writes the xyz stream for one strip of 'count' indexes, splitting it in
+// pieces that fit a batch. Returns the number of entries, 'out' may be null
+// to only count them.
+int VU1_AliasStripToStream(u16 * out, const int * indexes, const int * index_to_xyz, int count);
+
+// Fills the lerp, light and screen constants. 'light_dir' is in model space.
+// 'blend' turns on alpha blending, for the translucent entities.
+void VU1_AliasSetupConsts(ps2_vu_alias_consts_t * consts, const m_mat4_t * mvp,
+                          const float * front_scale, const float * front_translate,
+                          const float * back_scale, const float * back_translate,
+                          float backlerp, const vec3_t light_dir,
+                          const float * ambient, const float * diffuse, float alpha, int blend);
+
+// Normals table in the layout expected at VU1_ALIAS_NORMALS.
+void VU1_AliasSetupNormals(m_vec4_t table[NUMVERTEXNORMALS]);
+
+// Builds the VIF stream for the next batch of 'xyz' into 'vif'
+// (VU1_ALIAS_MAX_VIF_QW qwords, 16 aligned). Stops at a strip boundary.
+// Returns the number of stream entries consumed, size in qwords goes to 'vif_qw'.
+int VU1_AliasBuildBatch(u32 * vif, int * vif_qw, const ps2_vu_alias_consts_t * consts,
+                        const dtrivertx_t * front, const dtrivertx_t * back,
+                        const u16 * xyz, int count);
+
+// Reference for the VU side: interprets a stream from VU1_AliasBuildBatch
+// into 'vu_mem' (1024 qwords) and runs the alias_lerp.vsm math in C when
+// it reaches the MSCAL. Returns false on a VIF code it doesn't know.
+qboolean VU1_AliasRunVIF(ps2_vu_qword_t * vu_mem, const u32 * vif, int vif_qw);
+
+#endif // PS2_VU1_ALIAS_H
@@ -0,0 +1,327 @@
+
+/* ================================================================================================
+ * -*- C -*-
+ * File: vu1_clip.c
+ * Brief: Layout and C reference model of the VU1 guard band clipping program
+ *        used by the world batches (color_triangles_guard_clip.vsm).
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#include "ps2/vu1_clip.h"
+
+#include <string.h>
+
+//
+// CLIP flag masks over the last 3 judgments, for FCOR:
+// every vertex beyond the far plane (-z) or in front of the near plane (+z).
+//
+enum
+{
+    CLIP_ALL_FAR  = 0xFDF7DF,
+    CLIP_ALL_NEAR = 0xFEFBEF,
+    CLIP_ANY_3    = 0x3FFFF,
+    CLIP_JUDGMENT = 0xFFFFFF
+};
+
+// Output GIF tag NLOOP field and the EOP bit above it.
+static const u32 GIF_TAG_EOP = 0x8000;
+
+/*
+================
+VU1_GuardSetupConsts
+================
+*/
+void VU1_GuardSetupConsts(m_vec4_t consts[VU1_GUARD_NUM_CONSTS])
+{
+    // Near plane is Z = W, the sides are the full X/Y clip range,
+    // which the GS scales of the world batches map to 0..4096.
+    // Last is the largest 12:4 X/Y the GS takes and the largest
+    // 24 bits Z. A vertex right on the +X/+Y edge would otherwise
+    // wrap around to 0 after FTOI4. W = 0 is used by the program.
+    static const float table[VU1_GUARD_NUM_CONSTS][4] = {
+        {  0.0f,       0.0f,      -1.0f,                    1.0f }, // near
+        { -1.0f,       0.0f,       0.0f,                    1.0f }, // +x
+        {  1.0f,       0.0f,       0.0f,                    1.0f }, // -x
+        {  0.0f,      -1.0f,       0.0f,                    1.0f }, // +y
+        {  0.0f,       1.0f,       0.0f,                    1.0f }, // -y
+        {  4095.9375f, 4095.9375f, ((float)0xFFFFFF) / 16.0f, 0.0f }  // screen max
+    };
+
+    int i;
+    for (i = 0; i < VU1_GUARD_NUM_CONSTS; ++i)
+    {
+        consts[i].x = table[i][0];
+        consts[i].y = table[i][1];
+        consts[i].z = table[i][2];
+        consts[i].w = table[i][3];
+    }
+}
+
+//=============================================================================
+//
+// C reference of the VU1 program:
+//
+//=============================================================================
+
+/*
+================
+VU1_GuardClipJudge
+
+Remarks: Local function.
+CLIPw.xyz; shifts the new judgment into the flags.
+================
+*/
+static u32 VU1_GuardClipJudge(u32 clip_flags, const float * v, float w)
+{
+    int j;
+    u32 judgment = 0;
+
+    w = (w < 0.0f) ? -w : w;
+    for (j = 0; j < 3; ++j)
+    {
+        if (v[j] > +w) { judgment |= 1 << (j * 2 + 0); }
+        if (v[j] < -w) { judgment |= 1 << (j * 2 + 1); }
+    }
+    return ((clip_flags << 6) | judgment) & CLIP_JUDGMENT;
+}
+
+/*
+================
+VU1_GuardEmitVertex
+
+Remarks: Local function.
+Perspective divide, scale, clamp and convert to GS format.
+'color' is already converted to integers.
+================
+*/
+static void VU1_GuardEmitVertex(ps2_vu_qword_t * out, const float * pos, const s32 * color,
+                                const float * scales, const float * screen_max)
+{
+    int j;
+    const float q = 1.0f / pos[3];
+
+    for (j = 0; j < 4; ++j)
+    {
+        out[0].i[j] = color[j];
+    }
+    for (j = 0; j < 3; ++j)
+    {
+        float s = scales[j] + pos[j] * q * scales[j];
+        s = (s > 0.0f) ? s : 0.0f;
+        s = (s < screen_max[j]) ? s : screen_max[j];
+        out[1].i[j] = (s32)(s * 16.0f);
+    }
+    out[1].i[3] = 0; // ADC clear
+}
+
+/*
+================
+VU1_GuardWriteTag
+
+Remarks: Local function.
+Tag template with the NLOOP/EOP half word replaced (ISW.x).
+================
+*/
+static void VU1_GuardWriteTag(ps2_vu_qword_t * out, const ps2_vu_qword_t * tag, u32 nloop_eop)
+{
+    *out = *tag;
+    out->u[0] = nloop_eop & 0xFFFF;
+}
+
+/*
+================
+VU1_GuardClipPolygon
+
+Remarks: Local function.
+Sutherland-Hodgman against every plane, with the triangle in
+scratch polygon A. Returns the final vertex count (0 if culled)
+and where the result ended up.
+================
+*/
+static int VU1_GuardClipPolygon(ps2_vu_qword_t * mem, ps2_vu_qword_t ** result)
+{
+    int p, i, n = 3;
+    ps2_vu_qword_t * src = &mem[VU1_GUARD_POLY_A];
+    ps2_vu_qword_t * dst = &mem[VU1_GUARD_POLY_B];
+
+    for (p = 0; p < VU1_GUARD_NUM_PLANES; ++p)
+    {
+        const float * plane = mem[VU1_GUARD_CONSTS + p].f;
+        int num_out = 0;
+
+        // Distances and the outside flags:
+        for (i = 0; i < n; ++i)
+        {
+            ps2_vu_qword_t * v = &src[i * VU1_GUARD_VERT_QW];
+            const float d = ((plane[0] * v[0].f[0] + plane[1] * v[0].f[1]) +
+                             plane[2] * v[0].f[2]) + plane[3] * v[0].f[3];
+
+            v[2].f[0] = d;
+            v[2].i[1] = (d < 0.0f) ? 1 : 0;
+            num_out  += v[2].i[1];
+        }
+
+        if (num_out == 0)
+        {
+            continue;
+        }
+        if (num_out == n)
+        {
+            return 0;
+        }
+
+        // Close the loop with a copy of the first vertex.
+        src[n * VU1_GUARD_VERT_QW + 0] = src[0];
+        src[n * VU1_GUARD_VERT_QW + 1] = src[1];
+        src[n * VU1_GUARD_VERT_QW + 2] = src[2];
+
+        int num_dst = 0;
+        for (i = 0; i < n; ++i)
+        {
+            const ps2_vu_qword_t * cur  = &src[i * VU1_GUARD_VERT_QW];
+            const ps2_vu_qword_t * next = cur + VU1_GUARD_VERT_QW;
+
+            if (!cur[2].i[1])
+            {
+                ps2_vu_qword_t * d = &dst[num_dst++ * VU1_GUARD_VERT_QW];
+                d[0] = cur[0];
+                d[1] = cur[1];
+            }
+
+            if (cur[2].i[1] != next[2].i[1])
+            {
+                // Always lerp from the inside vertex, so an edge shared
+                // by two triangles is cut at the same point for both.
+                const ps2_vu_qword_t * a = cur[2].i[1] ? next : cur;
+                const ps2_vu_qword_t * b = cur[2].i[1] ? cur  : next;
+                const float t = a[2].f[0] / (a[2].f[0] - b[2].f[0]);
+
+                ps2_vu_qword_t * d = &dst[num_dst++ * VU1_GUARD_VERT_QW];
+                int j;
+                for (j = 0; j < 4; ++j)
+                {
+                    d[0].f[j] = a[0].f[j] + (b[0].f[j] - a[0].f[j]) * t;
+                    d[1].f[j] = a[1].f[j] + (b[1].f[j] - a[1].f[j]) * t;
+                }
+            }
+        }
+
+        n = num_dst;
+        if (n > VU1_GUARD_MAX_POLY)
+        {
+            return 0;
+        }
+
+        ps2_vu_qword_t * tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    *result = src;
+    return n;
+}
+
+/*
+================
+VU1_GuardClipReference
+================
+*/
+void VU1_GuardClipReference(ps2_vu_qword_t * mem, vu1_guard_stats_t * stats)
+{
+    int t, v, j;
+    vu1_guard_stats_t local_stats;
+    const ps2_vu_qword_t * mvp        = &mem[0];
+    const float          * scales     = mem[4].f;
+    const ps2_vu_qword_t * tag        = &mem[VU1_GUARD_GIF_TAG];
+    const float          * screen_max = mem[VU1_GUARD_CONSTS + VU1_GUARD_NUM_PLANES].f;
+    const int              num_tris   = mem[4].i[3] / 3;
+
+    if (stats == NULL)
+    {
+        stats = &local_stats;
+    }
+    memset(stats, 0, sizeof(*stats));
+
+    u32 clip_flags = 0;
+    ps2_vu_qword_t * out = &mem[VU1_GUARD_OUTPUT];
+
+    for (t = 0; t < num_tris; ++t)
+    {
+        const ps2_vu_qword_t * in = &mem[VU1_GUARD_FIRST_VERT + t * 6];
+        float clip[3][4];
+
+        for (v = 0; v < 3; ++v)
+        {
+            const float * p = in[v * 2 + 1].f;
+            for (j = 0; j < 4; ++j)
+            {
+                clip[v][j] = mvp[0].f[j] * p[0] + mvp[1].f[j] * p[1] + mvp[2].f[j] * p[2] + mvp[3].f[j] * p[3];
+            }
+            clip_flags = VU1_GuardClipJudge(clip_flags, clip[v], clip[v][3]);
+        }
+
+        ++stats->tris_in;
+
+        // FCOR: every vertex outside the same depth plane.
+        if ((clip_flags | CLIP_ALL_FAR) == CLIP_JUDGMENT || (clip_flags | CLIP_ALL_NEAR) == CLIP_JUDGMENT)
+        {
+            ++stats->tris_rejected;
+            continue;
+        }
+
+        // FCAND: fully inside, draw the triangle as it is.
+        if ((clip_flags & CLIP_ANY_3) == 0)
+        {
+            VU1_GuardWriteTag(out++, tag, 3);
+            for (v = 0; v < 3; ++v, out += 2)
+            {
+                VU1_GuardEmitVertex(out, clip[v], in[v * 2].i, scales, screen_max);
+            }
+
+            ++stats->tris_accepted;
+            ++stats->polys_out;
+            stats->verts_out += 3;
+            continue;
+        }
+
+        // Clipper works with float colors (ITOF0).
+        ++stats->tris_clipped;
+        ps2_vu_qword_t * poly = &mem[VU1_GUARD_POLY_A];
+        for (v = 0; v < 3; ++v)
+        {
+            for (j = 0; j < 4; ++j)
+            {
+                poly[v * VU1_GUARD_VERT_QW + 0].f[j] = clip[v][j];
+                poly[v * VU1_GUARD_VERT_QW + 1].f[j] = (float)in[v * 2].i[j];
+            }
+        }
+
+        ps2_vu_qword_t * result = NULL;
+        const int n = VU1_GuardClipPolygon(mem, &result);
+        if (n == 0)
+        {
+            ++stats->tris_culled;
+            continue;
+        }
+
+        VU1_GuardWriteTag(out++, tag, n);
+        for (v = 0; v < n; ++v, out += 2)
+        {
+            s32 color[4];
+            for (j = 0; j < 4; ++j)
+            {
+                color[j] = (s32)result[v * VU1_GUARD_VERT_QW + 1].f[j];
+            }
+            VU1_GuardEmitVertex(out, result[v * VU1_GUARD_VERT_QW].f, color, scales, screen_max);
+        }
+
+        ++stats->polys_out;
+        stats->verts_out += n;
+    }
+
+    // Empty tag to end the packet, then XGKICK.
+    VU1_GuardWriteTag(out++, tag, GIF_TAG_EOP);
+    stats->qwords_out = out - &mem[VU1_GUARD_OUTPUT];
+}
@@ -0,0 +1,95 @@
+/* ================================================================================================
+ * -*- C -*-
+ * File: vu1_clip.h
+ * Brief: Layout and C reference model of the VU1 guard band clipping program
+ *        used by the world batches (color_triangles_guard_clip.vsm).
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#ifndef PS2_VU1_CLIP_H
+#define PS2_VU1_CLIP_H
+
+#include "ps2/defs_ps2.h"
+#include "ps2/vec_mat.h"
+#include "ps2/vu1.h"
+
+//
+// Input is the same batch PS2_VUBatchAddSurfaceTris builds for the
+// whole triangle program: MVP at 0, GS scales at 4 (W = vertex count),
+// then the GIF tag at 5, which here is a TRIFAN template with NLOOP 0.
+// Vertexes start at 6, RGBAQ and a float XYZW position, 3 per triangle.
+//
+// Triangles fully inside the clip volume go straight out. Triangles fully
+// behind the near plane or beyond the far plane are dropped. The rest are
+// clipped against the near plane and the four sides of the 4096x4096 GS
+// guard band (the X/Y clip range of the projection). The far plane isn't
+// clipped, Z is clamped to the depth range instead. Every triangle/polygon
+// goes out as its own fan behind its own GIF tag, at VU1_GUARD_OUTPUT,
+// and one last empty tag closes the packet.
+//
+// Polygon scratch vertexes are 3 quadwords: clip position, float color
+// and the distance to the current plane (X), plus the outside flag (Y).
+// A plane can at most double the vertexes written, the polygon is dropped
+// if it ends up with more than VU1_GUARD_MAX_POLY (only rounding does that).
+//
+enum
+{
+    // Micromem address (in instructions) the program is uploaded to.
+    VU1_GUARD_PROG_ADDR    = 1024,
+
+    VU1_GUARD_GIF_TAG      = 5,
+    VU1_GUARD_FIRST_VERT   = 6,
+    VU1_GUARD_MAX_TRIS     = 30,  // Input triangles per batch (MAX_TRIS_PER_VU_BATCH)
+    VU1_GUARD_NUM_PLANES   = 5,
+    VU1_GUARD_MAX_POLY     = 3 + VU1_GUARD_NUM_PLANES, // Each plane adds a vertex at most
+
+    VU1_GUARD_OUTPUT       = 192, // 1 tag + 2 qwords per vertex for each polygon, then the end tag
+    VU1_GUARD_POLY_A       = 704, // Two scratch polygons, room for 2 * MAX_POLY + 1 vertexes each
+    VU1_GUARD_POLY_B       = 768,
+    VU1_GUARD_VERT_QW      = 3,
+
+    // Clip planes, then the max screen XYZ the output is clamped to.
+    // Below the alias program normals table (VU1_ALIAS_NORMALS).
+    VU1_GUARD_CONSTS       = 832,
+    VU1_GUARD_NUM_CONSTS   = VU1_GUARD_NUM_PLANES + 1
+};
+
+//
+// World batch capture written by the renderer (r_ps2_vu_capture) and
+// read by tools/vuclip.c: the magic and version ints, then for each batch
+// an int quadword count and the quadwords, as they land at VU1 address 0.
+//
+#define VU1_GUARD_CAPTURE_FILENAME "vubatches.bin"
+enum
+{
+    VU1_GUARD_CAPTURE_MAGIC   = (('B' << 24) + ('C' << 16) + ('U' << 8) + 'V'), // 'VUCB'
+    VU1_GUARD_CAPTURE_VERSION = 1
+};
+
+/*
+ * What happened to a batch, filled by VU1_GuardClipReference.
+ */
+typedef struct vu1_guard_stats_s
+{
+    int tris_in;
+    int tris_accepted; // fully inside, sent as they are
+    int tris_rejected; // fully behind near or beyond far
+    int tris_clipped;  // went through the clipper
+    int tris_culled;   // clipped away to nothing
+    int polys_out;
+    int verts_out;
+    int qwords_out;    // size of the GIF packet at VU1_GUARD_OUTPUT
+} vu1_guard_stats_t;
+
+// Plane equations for the clip space distances (dot(plane, pos) >= 0 is inside)
+// and the screen clamp, in the layout expected at VU1_GUARD_CONSTS.
+void VU1_GuardSetupConsts(m_vec4_t consts[VU1_GUARD_NUM_CONSTS]);
+
+// Runs the program math in C on a VU1 memory image (VU1_MEM_QWORDS)
+// holding a batch and the planes. Output is left in the image exactly
+// like the VU would, 'stats' may be null.
+void VU1_GuardClipReference(ps2_vu_qword_t * vu_mem, vu1_guard_stats_t * stats);
+
+#endif // PS2_VU1_CLIP_H
@@ -0,0 +1,79 @@
+/* ================================================================================================
+ * -*- C -*-
+ * File: vu1_dlight.c
+ * Brief: Layout and setup of the dynamic lights used by the VU1 world batch
+ *        lighting program (dlight_triangles.vsm).
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#include "ps2/vu1_dlight.h"
+
+#include <string.h>
+
+// Vertex color a light adds right at its origin, for a color of 1.
+static const float DLIGHT_MAX_COLOR = 255.0f;
+
+/*
+================
+VU1_DLightSetup
+================
+*/
+int VU1_DLightSetup(ps2_vu_dlights_t * vu_dlights, const dlight_t * lights,
+                    const vec3_t * origins, u32 light_bits, int next_prog)
+{
+    int i, num_lights = 0;
+
+    for (i = 0; light_bits != 0; ++i, light_bits >>= 1)
+    {
+        if (!(light_bits & 1))
+        {
+            continue;
+        }
+
+        const float radius = lights[i].intensity - DLIGHT_CUTOFF;
+        if (radius <= 0.0f)
+        {
+            continue;
+        }
+
+        ps2_vu_dlight_group_t * group = &vu_dlights->groups[num_lights >> 2];
+        const int slot = num_lights & 3;
+
+        group->x[slot] = origins[i][0];
+        group->y[slot] = origins[i][1];
+        group->z[slot] = origins[i][2];
+        group->inv_radius_sq[slot] = 1.0f / (radius * radius);
+
+        group->color[slot][0] = lights[i].color[0] * DLIGHT_MAX_COLOR;
+        group->color[slot][1] = lights[i].color[1] * DLIGHT_MAX_COLOR;
+        group->color[slot][2] = lights[i].color[2] * DLIGHT_MAX_COLOR;
+        group->color[slot][3] = 0.0f;
+
+        ++num_lights;
+    }
+
+    if (num_lights == 0)
+    {
+        return 0;
+    }
+
+    // Fill the rest of the last group with lights that add nothing.
+    ps2_vu_dlight_group_t * last = &vu_dlights->groups[(num_lights - 1) >> 2];
+    for (i = num_lights & 3; i != 0 && i < 4; ++i)
+    {
+        last->x[i] = 0.0f;
+        last->y[i] = 0.0f;
+        last->z[i] = 0.0f;
+        last->inv_radius_sq[i] = 0.0f;
+        memset(last->color[i], 0, sizeof(last->color[i]));
+    }
+
+    vu_dlights->num_groups  = (num_lights + 3) >> 2;
+    vu_dlights->next_prog   = next_prog;
+    vu_dlights->color_clamp = 255.0f;
+    vu_dlights->pad         = 0;
+
+    return 1 + vu_dlights->num_groups * VU1_DLIGHT_GROUP_QW;
+}
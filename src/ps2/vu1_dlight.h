@@ -0,0 +1,85 @@
+/* ================================================================================================
+ * -*- C -*-
+ * File: vu1_dlight.h
+ * Brief: Layout and setup of the dynamic lights used by the VU1 world batch
+ *        lighting program (dlight_triangles.vsm).
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#ifndef PS2_VU1_DLIGHT_H
+#define PS2_VU1_DLIGHT_H
+
+#include "client/ref.h"
+#include "ps2/defs_ps2.h"
+#include "ps2/vu1.h"
+#include "ps2/vu1_clip.h"
+
+//
+// Dynamic lights are added to the vertex colors of the world batches instead
+// of being blended into the lightmaps like ref_gl does. A batch with surfaces
+// touched by lights (marked by the BSP walk of PS2_MarkLights) runs this
+// program first, which adds the lights to the colors in-place, then jumps to
+// the program that transforms and clips the batch (color triangles or guard).
+//
+// Each light adds color * (1 - d^2 / r^2), with r being the light intensity
+// minus DLIGHT_CUTOFF, the same reach R_MarkLights uses. Lights go in groups
+// of 4, laid out so the program does the 4 distances with a few vector ops.
+//
+// VU1 memory layout used by dlight_triangles.vsm (quadword addresses):
+//
+//  0..5  the world batch, as color_triangles_*.vsm take it
+//  192   X = number of light groups, Y = program to jump to (ints), Z = 255
+//  193.. light groups, 8 qwords each: X, Y and Z of the 4 lights,
+//        their 1 / r^2 and the 4 colors. Unused lights have a black color.
+//
+// The lights sit where the guard band program writes its output,
+// they were all used by the time it starts.
+//
+enum
+{
+    // Micromem address (in instructions) the program is uploaded to.
+    // After the warp program (VU1_WARP_PROG_ADDR).
+    VU1_DLIGHT_PROG_ADDR  = 1792,
+
+    VU1_DLIGHT_HEADER     = VU1_GUARD_OUTPUT,
+    VU1_DLIGHT_GROUP_QW   = 8,
+    VU1_DLIGHT_MAX_GROUPS = MAX_DLIGHTS / 4
+};
+
+// Same as ref_gl, lights don't reach past intensity - DLIGHT_CUTOFF.
+#define DLIGHT_CUTOFF 64.0f
+
+/*
+ * 4 lights, in the layout the program reads them.
+ */
+typedef struct ps2_vu_dlight_group_s
+{
+    float x[4];
+    float y[4];
+    float z[4];
+    float inv_radius_sq[4];
+    float color[4][4]; // 0 to 255, W unused
+} ps2_vu_dlight_group_t PS2_ALIGN(16);
+
+/*
+ * What gets uploaded at VU1_DLIGHT_HEADER.
+ */
+typedef struct ps2_vu_dlights_s
+{
+    int   num_groups;
+    int   next_prog;
+    float color_clamp;
+    int   pad;
+    ps2_vu_dlight_group_t groups[VU1_DLIGHT_MAX_GROUPS];
+} ps2_vu_dlights_t PS2_ALIGN(16);
+
+// Packs the lights of 'lights' selected by 'light_bits' for the program. 'origins'
+// are the light positions in the space of the model being drawn, indexed like 'lights'.
+// 'next_prog' is the micromem address of the program that draws the batch.
+// Returns the qwords to upload at VU1_DLIGHT_HEADER, zero if no light reaches anything.
+int VU1_DLightSetup(ps2_vu_dlights_t * vu_dlights, const dlight_t * lights,
+                    const vec3_t * origins, u32 light_bits, int next_prog);
+
+#endif // PS2_VU1_DLIGHT_H
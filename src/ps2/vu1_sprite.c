@@ -0,0 +1,361 @@
+/* ================================================================================================
+ * -*- C -*-
+ * File: vu1_sprite.c
+ * Brief: VIF packet generation for the VU1 camera facing quads program (sprites,
+ *        beams and null models) and a C reference of the math it runs (sprite_quads.vsm).
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#include "ps2/vu1_sprite.h"
+#include "ps2/gs_defs.h"
+
+#include <math.h>
+
+//
+// The VIF codes we use. Layout of a code word:
+// bits 0-15 immediate, 16-23 num, 24-30 command, 31 interrupt.
+//
+#define VIF_CODE(cmd, num, imm) (((u32)(cmd) << 24) | ((u32)(num) << 16) | (u32)(imm))
+
+enum
+{
+    VIF_NOP          = 0x00,
+    VIF_STCYCL       = 0x01,
+    VIF_FLUSH        = 0x11,
+    VIF_MSCAL        = 0x14,
+    VIF_UNPACK_V4_32 = 0x6C
+};
+
+// Stream words before the quads: header, constants and the quads UNPACK.
+#define SPRITE_QUADS_OFFSET ((1 + VU1_SPRITE_CONSTS_QW + 1) * 4)
+
+// XYZ2 W word of a vertex that doesn't draw a triangle.
+#define SPRITE_ADC 0x8000
+
+/*
+================
+VU1_SpriteSetupConsts
+================
+*/
+void VU1_SpriteSetupConsts(ps2_vu_sprite_consts_t * consts, const m_mat4_t * mvp, const int color[4], int textured)
+{
+    // Corners in strip order: top-left, top-right, bottom-left, bottom-right.
+    static const float corner_st[4][4] = {
+        { 0.0f, 0.0f, 1.0f, 0.0f },
+        { 1.0f, 0.0f, 1.0f, 0.0f },
+        { 0.0f, 1.0f, 1.0f, 0.0f },
+        { 1.0f, 1.0f, 1.0f, 0.0f }
+    };
+
+    int i, j;
+
+    consts->mvp_matrix = *mvp;
+
+    // Same rasterizer scale factors used by the world batches.
+    consts->gs_scale_x = 2048.0f;
+    consts->gs_scale_y = 2048.0f;
+    consts->gs_scale_z = ((float)0xFFFFFF) / 32.0f;
+    consts->quad_count = 0;
+
+    for (i = 0; i < 4; ++i)
+    {
+        consts->color[i] = color[i];
+        for (j = 0; j < 4; ++j)
+        {
+            consts->corner_st[i][j] = corner_st[i][j];
+        }
+    }
+
+    // Quad count is patched by VU1_SpriteEndBatch.
+    const u64 prim_desc = GS_PRIM(GS_PRIM_TRISTRIP, GS_PRIM_SFLAT, (textured ? GS_PRIM_TON : GS_PRIM_TOFF),
+                                  GS_PRIM_FOFF, GS_PRIM_ABON, GS_PRIM_AAOFF, GS_PRIM_FSTQ, GS_PRIM_C1, 0);
+    consts->giftag[0] = GS_GIFTAG(0, 1, 1, prim_desc, GS_GIFTAG_PACKED, 3);
+    consts->giftag[1] = ((u64)GS_REG_ST) | (((u64)GS_REG_RGBAQ) << 4) | (((u64)GS_REG_XYZ2) << 8);
+}
+
+/*
+================
+VU1_SpriteSetupFrame
+================
+*/
+void VU1_SpriteSetupFrame(ps2_vu_sprite_consts_t * consts, const float view_right[3], const float view_up[3],
+                          int width, int height, int origin_x, int origin_y)
+{
+    // ref_gl puts the top-left corner at origin + up * (height - origin_y) - right * origin_x,
+    // the quad center is then half the size from there.
+    const float half_w = width  * 0.5f;
+    const float half_h = height * 0.5f;
+    const float ofs_x  = half_w - origin_x;
+    const float ofs_y  = half_h - origin_y;
+
+    int i;
+    for (i = 0; i < 3; ++i)
+    {
+        consts->right[i]  = view_right[i] * half_w;
+        consts->up[i]     = view_up[i] * half_h;
+        consts->offset[i] = view_right[i] * ofs_x + view_up[i] * ofs_y;
+    }
+    consts->right[3]  = 0.0f;
+    consts->up[3]     = 0.0f;
+    consts->offset[3] = 0.0f;
+}
+
+/*
+================
+VU1_SpriteSetupBeam
+================
+*/
+void VU1_SpriteSetupBeam(ps2_vu_sprite_consts_t * consts, const float start[3], const float end[3],
+                         float diameter, const float eye[3])
+{
+    int i;
+    float dir[3], to_eye[3], side[3];
+
+    for (i = 0; i < 3; ++i)
+    {
+        dir[i]    = end[i] - start[i];
+        to_eye[i] = eye[i] - (start[i] + end[i]) * 0.5f;
+    }
+
+    // Width goes across the beam and the view direction.
+    side[0] = dir[1] * to_eye[2] - dir[2] * to_eye[1];
+    side[1] = dir[2] * to_eye[0] - dir[0] * to_eye[2];
+    side[2] = dir[0] * to_eye[1] - dir[1] * to_eye[0];
+
+    const float len = sqrtf(side[0] * side[0] + side[1] * side[1] + side[2] * side[2]);
+    const float scale = (len > 0.0f) ? (diameter * 0.5f / len) : 0.0f;
+
+    for (i = 0; i < 3; ++i)
+    {
+        consts->right[i]  = dir[i] * 0.5f;
+        consts->up[i]     = side[i] * scale;
+        consts->offset[i] = 0.0f;
+    }
+    consts->right[3]  = 0.0f;
+    consts->up[3]     = 0.0f;
+    consts->offset[3] = 0.0f;
+}
+
+/*
+================
+VU1_SpriteBeginBatch
+================
+*/
+ps2_vu_sprite_quad_t * VU1_SpriteBeginBatch(u32 * vif, const ps2_vu_sprite_consts_t * consts)
+{
+    // Wait for the previous batch to be kicked before overwriting its output,
+    // then send the constants as they are:
+    u32 * out = vif;
+    *out++ = VIF_CODE(VIF_NOP, 0, 0);
+    *out++ = VIF_CODE(VIF_FLUSH, 0, 0);
+    *out++ = VIF_CODE(VIF_STCYCL, 0, 1 | (1 << 8));
+    *out++ = VIF_CODE(VIF_UNPACK_V4_32, VU1_SPRITE_CONSTS_QW, 0);
+
+    *(ps2_vu_sprite_consts_t *)out = *consts;
+    return (ps2_vu_sprite_quad_t *)(vif + SPRITE_QUADS_OFFSET);
+}
+
+/*
+================
+VU1_SpriteEndBatch
+================
+*/
+int VU1_SpriteEndBatch(u32 * vif, int num_quads, int wait_end)
+{
+    ps2_vu_sprite_consts_t * consts = (ps2_vu_sprite_consts_t *)(vif + 4);
+    consts->quad_count = num_quads;
+    consts->giftag[0] |= (u64)(num_quads * 4); // NLOOP
+
+    u32 * out = vif + SPRITE_QUADS_OFFSET - 4;
+    *out++ = VIF_CODE(VIF_NOP, 0, 0);
+    *out++ = VIF_CODE(VIF_NOP, 0, 0);
+    *out++ = VIF_CODE(VIF_NOP, 0, 0);
+    *out++ = VIF_CODE(VIF_UNPACK_V4_32, num_quads, VU1_SPRITE_START_QUAD);
+
+    out += num_quads * 4;
+    *out++ = VIF_CODE(VIF_MSCAL, 0, VU1_SPRITE_PROG_ADDR);
+    *out++ = VIF_CODE(wait_end ? VIF_FLUSH : VIF_NOP, 0, 0);
+    *out++ = VIF_CODE(VIF_NOP, 0, 0);
+    *out++ = VIF_CODE(VIF_NOP, 0, 0);
+
+    return (out - vif) >> 2;
+}
+
+/*
+================
+VU1_SpriteBatchQWords
+================
+*/
+int VU1_SpriteBatchQWords(int num_quads)
+{
+    return 1 + VU1_SPRITE_CONSTS_QW + 1 + num_quads + 1;
+}
+
+//=============================================================================
+//
+// C reference of the VIF and VU1 side:
+//
+//=============================================================================
+
+/*
+================
+VU1_SpriteReferenceCorner
+
+Remarks: Local function.
+Transform and output of one corner, the lCorner subroutine.
+Returns the CLIP judgment of the corner.
+================
+*/
+static u32 VU1_SpriteReferenceCorner(ps2_vu_qword_t * mem, const float pos[3], int corner, ps2_vu_qword_t * out)
+{
+    int j;
+    const ps2_vu_qword_t * mvp = &mem[0];
+    const float * scales = mem[4].f;
+    const float * st     = mem[VU1_SPRITE_CORNER_ST + corner].f;
+
+    float clip[4];
+    for (j = 0; j < 4; ++j)
+    {
+        clip[j] = mvp[0].f[j] * pos[0] + mvp[1].f[j] * pos[1] + mvp[2].f[j] * pos[2] + mvp[3].f[j];
+    }
+
+    const float w = fabsf(clip[3]);
+    u32 judgment = 0;
+    for (j = 0; j < 3; ++j)
+    {
+        if (clip[j] > +w) { judgment |= 1 << (j * 2 + 0); }
+        if (clip[j] < -w) { judgment |= 1 << (j * 2 + 1); }
+    }
+
+    // Project to the GS 12:4 fixed point, S/T divided for the perspective:
+    const float q = 1.0f / clip[3];
+    for (j = 0; j < 3; ++j)
+    {
+        out[0].f[j] = st[j] * q;
+        out[1].i[j] = mem[8].i[j];
+        out[2].i[j] = (s32)((scales[j] + clip[j] * q * scales[j]) * 16.0f);
+    }
+    out[1].i[3] = mem[8].i[3];
+
+    return judgment;
+}
+
+/*
+================
+VU1_SpriteReferenceProg
+
+Remarks: Local function.
+Same math and same order of operations as sprite_quads.vsm.
+================
+*/
+static void VU1_SpriteReferenceProg(ps2_vu_qword_t * mem)
+{
+    int n, j;
+    const float * right  = mem[5].f;
+    const float * up     = mem[6].f;
+    const float * offset = mem[7].f;
+    const int num_quads  = mem[4].i[3] & 0xFFFF;
+
+    mem[VU1_SPRITE_OUTPUT] = mem[VU1_SPRITE_GIF_TAG];
+
+    for (n = 0; n < num_quads; ++n)
+    {
+        const float * quad = mem[(VU1_SPRITE_START_QUAD + n) & (VU1_MEM_QWORDS - 1)].f;
+        ps2_vu_qword_t * out = &mem[(VU1_SPRITE_OUTPUT + 1 + n * VU1_SPRITE_QUAD_OUT_QW) & (VU1_MEM_QWORDS - 1)];
+
+        // center = offset * size + position, A = up - right, B = up + right
+        float center[3], a[3], b[3], pos[3];
+        for (j = 0; j < 3; ++j)
+        {
+            const float r = right[j] * quad[3];
+            const float u = up[j] * quad[3];
+            center[j] = offset[j] * quad[3] + quad[j];
+            a[j] = u - r;
+            b[j] = u + r;
+        }
+
+        // Top-left, top-right, bottom-left, bottom-right:
+        u32 judgments = 0;
+        for (j = 0; j < 3; ++j) { pos[j] = center[j] + a[j]; }
+        judgments |= VU1_SpriteReferenceCorner(mem, pos, 0, out + 0);
+        for (j = 0; j < 3; ++j) { pos[j] = center[j] + b[j]; }
+        judgments |= VU1_SpriteReferenceCorner(mem, pos, 1, out + 3);
+        for (j = 0; j < 3; ++j) { pos[j] = center[j] - b[j]; }
+        judgments |= VU1_SpriteReferenceCorner(mem, pos, 2, out + 6);
+        for (j = 0; j < 3; ++j) { pos[j] = center[j] - a[j]; }
+        judgments |= VU1_SpriteReferenceCorner(mem, pos, 3, out + 9);
+
+        // First two always start a new strip, the other two only draw if nothing was clipped.
+        const int adc = (judgments ? 1 : 0) + 0x7FFF;
+        out[2].i[3]  = SPRITE_ADC;
+        out[5].i[3]  = SPRITE_ADC;
+        out[8].i[3]  = adc;
+        out[11].i[3] = adc;
+    }
+}
+
+/*
+================
+VU1_SpriteRunVIF
+================
+*/
+int VU1_SpriteRunVIF(ps2_vu_qword_t * vu_mem, const u32 * vif, int vif_qw)
+{
+    int cl = 1, wl = 1;
+    const u32 * end = vif + vif_qw * 4;
+
+    while (vif < end)
+    {
+        const u32 code = *vif++;
+        const int cmd  = (code >> 24) & 0x7F;
+        const int num  = (code >> 16) & 0xFF;
+        const int imm  = code & 0xFFFF;
+
+        if (cmd == VIF_NOP || cmd == VIF_FLUSH)
+        {
+            continue;
+        }
+        if (cmd == VIF_STCYCL)
+        {
+            cl = imm & 0xFF;
+            wl = (imm >> 8) & 0xFF;
+            continue;
+        }
+        if (cmd == VIF_MSCAL)
+        {
+            if (imm != VU1_SPRITE_PROG_ADDR)
+            {
+                return 0;
+            }
+            VU1_SpriteReferenceProg(vu_mem);
+            continue;
+        }
+        if (cmd == VIF_UNPACK_V4_32)
+        {
+            int k, j;
+            const int count = num ? num : 256;
+            const int addr  = imm & 0x3FF;
+
+            if (wl == 0 || wl > cl || vif + count * 4 > end)
+            {
+                return 0; // Only skipping write mode is used.
+            }
+
+            for (k = 0; k < count; ++k, vif += 4)
+            {
+                ps2_vu_qword_t * dest = &vu_mem[(addr + (k / wl) * cl + (k % wl)) & (VU1_MEM_QWORDS - 1)];
+                for (j = 0; j < 4; ++j)
+                {
+                    dest->u[j] = vif[j];
+                }
+            }
+            continue;
+        }
+
+        return 0;
+    }
+
+    return 1;
+}
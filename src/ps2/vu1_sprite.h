@@ -0,0 +1,134 @@
+/* ================================================================================================
+ * -*- C -*-
+ * File: vu1_sprite.h
+ * Brief: VIF packet generation for the VU1 camera facing quads program (sprites,
+ *        beams and null models) and a C reference of the math it runs (sprite_quads.vsm).
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#ifndef PS2_VU1_SPRITE_H
+#define PS2_VU1_SPRITE_H
+
+#include "ps2/defs_ps2.h"
+#include "ps2/vec_mat.h"
+#include "ps2/vu1.h"
+
+//
+// Nothing in here depends on the PS2DEV SDK, so the packet builder and
+// the reference implementation can be compiled and checked on a host PC.
+//
+// Each quad goes to the VU as a single qword, its position and a size.
+// The axes of the quad are the same for a whole batch, so a batch is a
+// group of quads that share them: the frames of a sprite model with the
+// same texture and alpha (the axes being the view right and up vectors
+// scaled by the frame size), the null models, or a single beam.
+//
+// For a quad at P with size S, the 4 corners are
+//
+//  P + S * (offset -/+ right + up)  and  P + S * (offset -/+ right - up)
+//
+// The offset moves the quad center off P, which is how the sprite frame
+// origin_x/origin_y of ref_gl's R_DrawSpriteModel are done.
+//
+// Corners are output as a 4 vertexes triangle strip, with the ADC bit set on
+// the first two so all the quads of a batch go under a single GIF tag. Quads
+// with a corner outside the clip volume (near plane or the guard band) are
+// dropped whole, also with the ADC bit.
+//
+// VU1 memory layout used by sprite_quads.vsm (quadword addresses):
+//
+//  0..3  MVP matrix (model to clip space)
+//  4     GS scale factors XYZ, W = quad count
+//  5     right axis, half width
+//  6     up axis, half height
+//  7     offset of the quad center
+//  8     RGBA color, 4 ints
+//  9..12 S/T of the 4 corners, Z = 1
+//  13    GIF tag (ST + RGBAQ + XYZ2 triangle strip)
+//  14..  quads, 1 qword each: position XYZ, W = size
+//  74    output GIF tag, copied from 13
+//  75..  output, 4 vertexes of ST, RGBAQ and XYZ2 for each quad
+//
+enum
+{
+    VU1_SPRITE_CONSTS_QW   = 14,
+    VU1_SPRITE_CORNER_ST   = 9,
+    VU1_SPRITE_GIF_TAG     = 13,
+    VU1_SPRITE_START_QUAD  = 14,
+    VU1_SPRITE_MAX_QUADS   = 60,
+    VU1_SPRITE_OUTPUT      = VU1_SPRITE_START_QUAD + VU1_SPRITE_MAX_QUADS,
+    VU1_SPRITE_QUAD_OUT_QW = 4 * 3,
+
+    // Micromem address (in instructions) the program is uploaded to.
+    // After the dynamic lights program (VU1_DLIGHT_PROG_ADDR).
+    VU1_SPRITE_PROG_ADDR   = 1920,
+
+    // Size of one batch VIF stream: header qword, the constants,
+    // the quads UNPACK qword, the quads, then MSCAL and an optional FLUSH.
+    VU1_SPRITE_MAX_VIF_QW  = 1 + VU1_SPRITE_CONSTS_QW + 1 + VU1_SPRITE_MAX_QUADS + 1
+};
+
+/*
+ * Per batch constants. Mirrors VU memory 0..13 and
+ * is copied as-is at the start of every batch.
+ */
+typedef struct ps2_vu_sprite_consts_s
+{
+    m_mat4_t mvp_matrix;
+    float    gs_scale_x;
+    float    gs_scale_y;
+    float    gs_scale_z;
+    int      quad_count;
+    float    right[4];
+    float    up[4];
+    float    offset[4];
+    s32      color[4];
+    float    corner_st[4][4];
+    u64      giftag[2];
+} ps2_vu_sprite_consts_t PS2_ALIGN(16);
+
+/*
+ * One quad, as it goes to the VU.
+ */
+typedef struct ps2_vu_sprite_quad_s
+{
+    float pos[3];
+    float size;
+} ps2_vu_sprite_quad_t;
+
+// Fills the parts of the constants that are not the quad axes. 'color' is
+// RGBA, 128 being 1.0 for the MODULATE texture function, 'textured' turns
+// texture mapping on. Blending is always on.
+void VU1_SpriteSetupConsts(ps2_vu_sprite_consts_t * consts, const m_mat4_t * mvp, const int color[4], int textured);
+
+// Quad axes of a sprite frame, same corners as ref_gl's R_DrawSpriteModel.
+// 'view_right' and 'view_up' are the camera vectors in model space.
+void VU1_SpriteSetupFrame(ps2_vu_sprite_consts_t * consts, const float view_right[3], const float view_up[3],
+                          int width, int height, int origin_x, int origin_y);
+
+// Quad axes of a beam going from 'start' to 'end', 'diameter' wide, turned to face 'eye'.
+// The quad is then put at the middle of the beam, size 1.
+void VU1_SpriteSetupBeam(ps2_vu_sprite_consts_t * consts, const float start[3], const float end[3],
+                         float diameter, const float eye[3]);
+
+// Starts the VIF stream of a batch in 'vif' (VU1_SPRITE_MAX_VIF_QW qwords,
+// 16 aligned), returns where its VU1_SPRITE_MAX_QUADS quads go.
+ps2_vu_sprite_quad_t * VU1_SpriteBeginBatch(u32 * vif, const ps2_vu_sprite_consts_t * consts);
+
+// Closes the stream after 'num_quads' quads (1 to VU1_SPRITE_MAX_QUADS) were
+// written. With 'wait_end' set the stream only completes once the VU is done
+// and the output was kicked, so the GS can be given something else right after.
+// Returns the size of the stream in qwords, VU1_SpriteBatchQWords(num_quads).
+int VU1_SpriteEndBatch(u32 * vif, int num_quads, int wait_end);
+
+// Size in qwords of the VIF stream of a batch with 'num_quads' quads.
+int VU1_SpriteBatchQWords(int num_quads);
+
+// Reference for the VU side: interprets a stream from VU1_SpriteEndBatch
+// into 'vu_mem' (1024 qwords) and runs the sprite_quads.vsm math in C
+// when it reaches the MSCAL. Returns false on a VIF code it doesn't know.
+int VU1_SpriteRunVIF(ps2_vu_qword_t * vu_mem, const u32 * vif, int vif_qw);
+
+#endif // PS2_VU1_SPRITE_H
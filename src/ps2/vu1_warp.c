@@ -0,0 +1,292 @@
+/* ================================================================================================
+ * -*- C -*-
+ * File: vu1_warp.c
+ * Brief: VIF packet generation for the VU1 textured/warped surfaces program
+ *        and a C reference of the math it runs (warp_triangles.vsm).
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#include "ps2/vu1_warp.h"
+#include "ps2/gs_defs.h"
+
+#include <math.h>
+
+//
+// The VIF codes we use. Layout of a code word:
+// bits 0-15 immediate, 16-23 num, 24-30 command, 31 interrupt.
+//
+#define VIF_CODE(cmd, num, imm) (((u32)(cmd) << 24) | ((u32)(num) << 16) | (u32)(imm))
+
+enum
+{
+    VIF_NOP          = 0x00,
+    VIF_STCYCL       = 0x01,
+    VIF_FLUSH        = 0x11,
+    VIF_MSCAL        = 0x14,
+    VIF_UNPACK_V4_32 = 0x6C
+};
+
+// Stream words before the vertexes: header, constants and the vertexes UNPACK.
+#define WARP_VERTS_OFFSET ((1 + VU1_WARP_CONSTS_QW + 1) * 4)
+
+// 2pi / 256, one step of ref_gl's r_turbsin table.
+#define WARP_TURB_STEP (6.28318530717958647692f / 256.0f)
+
+/*
+================
+VU1_WarpSetupConsts
+================
+*/
+void VU1_WarpSetupConsts(ps2_vu_warp_consts_t * consts, const m_mat4_t * mvp, float time,
+                         float scroll, float amplitude, float st_scale, int blend)
+{
+    consts->mvp_matrix = *mvp;
+
+    // Same rasterizer scale factors used by the world batches.
+    consts->gs_scale_x = 2048.0f;
+    consts->gs_scale_y = 2048.0f;
+    consts->gs_scale_z = ((float)0xFFFFFF) / 32.0f;
+    consts->vert_count = 0;
+
+    // The program takes the sine of (index * step - pi), which is
+    // the sine of (index * step) negated, so is the amplitude.
+    consts->time      = time;
+    consts->scroll    = scroll;
+    consts->st_scale  = st_scale;
+    consts->amplitude = -amplitude;
+
+    consts->turb[0] = 0.125f;
+    consts->turb[1] = 0.125f;
+    consts->turb[2] = 1.0f / WARP_TURB_STEP;
+    consts->turb[3] = WARP_TURB_STEP;
+
+    // Taylor series of the sine up to x^11, the odd coefficients:
+    consts->sin_poly[0]  = -1.0f / 6.0f;
+    consts->sin_poly[1]  =  1.0f / 120.0f;
+    consts->sin_poly[2]  = -1.0f / 5040.0f;
+    consts->sin_poly[3]  =  1.0f / 362880.0f;
+    consts->sin_poly2[0] = -1.0f / 39916800.0f;
+    consts->sin_poly2[1] = -3.14159265358979323846f;
+    consts->sin_poly2[2] = 0.0f;
+    consts->index_mask   = 255;
+
+    // Vertex count is patched by VU1_WarpEndBatch.
+    const u64 prim_desc = GS_PRIM(GS_PRIM_TRIANGLE, GS_PRIM_SFLAT, GS_PRIM_TON, GS_PRIM_FOFF,
+                                  (blend ? GS_PRIM_ABON : GS_PRIM_ABOFF), GS_PRIM_AAOFF,
+                                  GS_PRIM_FSTQ, GS_PRIM_C1, 0);
+    consts->giftag[0] = GS_GIFTAG(0, 1, 1, prim_desc, GS_GIFTAG_PACKED, 3);
+    consts->giftag[1] = ((u64)GS_REG_ST) | (((u64)GS_REG_RGBAQ) << 4) | (((u64)GS_REG_XYZ2) << 8);
+}
+
+/*
+================
+VU1_WarpBeginBatch
+================
+*/
+ps2_vu_warp_vert_t * VU1_WarpBeginBatch(u32 * vif, const ps2_vu_warp_consts_t * consts)
+{
+    // Wait for the previous batch to be kicked before overwriting its output,
+    // then send the constants as they are:
+    u32 * out = vif;
+    *out++ = VIF_CODE(VIF_NOP, 0, 0);
+    *out++ = VIF_CODE(VIF_FLUSH, 0, 0);
+    *out++ = VIF_CODE(VIF_STCYCL, 0, 1 | (1 << 8));
+    *out++ = VIF_CODE(VIF_UNPACK_V4_32, VU1_WARP_CONSTS_QW, 0);
+
+    *(ps2_vu_warp_consts_t *)out = *consts;
+    return (ps2_vu_warp_vert_t *)(vif + WARP_VERTS_OFFSET);
+}
+
+/*
+================
+VU1_WarpEndBatch
+================
+*/
+int VU1_WarpEndBatch(u32 * vif, int num_verts, int wait_end)
+{
+    ps2_vu_warp_consts_t * consts = (ps2_vu_warp_consts_t *)(vif + 4);
+    consts->vert_count = num_verts;
+    consts->giftag[0] |= (u64)num_verts; // NLOOP
+
+    const int verts_qw = num_verts * VU1_WARP_VERT_QW;
+
+    u32 * out = vif + WARP_VERTS_OFFSET - 4;
+    *out++ = VIF_CODE(VIF_NOP, 0, 0);
+    *out++ = VIF_CODE(VIF_NOP, 0, 0);
+    *out++ = VIF_CODE(VIF_NOP, 0, 0);
+    *out++ = VIF_CODE(VIF_UNPACK_V4_32, verts_qw & 0xFF, VU1_WARP_START_VERT);
+
+    out += verts_qw * 4;
+    *out++ = VIF_CODE(VIF_MSCAL, 0, VU1_WARP_PROG_ADDR);
+    *out++ = VIF_CODE(wait_end ? VIF_FLUSH : VIF_NOP, 0, 0);
+    *out++ = VIF_CODE(VIF_NOP, 0, 0);
+    *out++ = VIF_CODE(VIF_NOP, 0, 0);
+
+    return (out - vif) >> 2;
+}
+
+//=============================================================================
+//
+// C reference of the VIF and VU1 side:
+//
+//=============================================================================
+
+/*
+================
+VU1_WarpReferenceProg
+
+Remarks: Local function.
+Same math and same order of operations as warp_triangles.vsm.
+================
+*/
+static void VU1_WarpReferenceProg(ps2_vu_qword_t * mem)
+{
+    int v, j;
+    const ps2_vu_qword_t * mvp = &mem[0];
+    const float * scales       = mem[4].f;
+    const float * warp         = mem[5].f;
+    const float * turb         = mem[6].f;
+    const float * poly         = mem[7].f;
+    const float * poly2        = mem[8].f;
+    const int     index_mask   = mem[8].i[3] & 0xFFFF;
+    const int     num_verts    = mem[4].i[3] & 0xFFFF;
+
+    // Judgments of the last 4 CLIP instructions, 6 bits each.
+    u32 clip_flags = 0;
+
+    for (v = 0; v < num_verts; ++v)
+    {
+        ps2_vu_qword_t * vst  = &mem[(VU1_WARP_START_VERT + v * VU1_WARP_VERT_QW) & (VU1_MEM_QWORDS - 1)];
+        ps2_vu_qword_t * vpos = vst + 2;
+
+        // Turbulence, S from the T phase and the other way around.
+        // MTIR takes the low 16 bits of the truncated phase.
+        float arg[2], sine[2], st[2];
+        arg[0] = turb[0] * vst->f[1];
+        arg[1] = turb[1] * vst->f[0];
+        for (j = 0; j < 2; ++j)
+        {
+            arg[j] = (arg[j] + warp[0]) * turb[2];
+
+            const int index = ((s32)arg[j] & 0xFFFF) & index_mask;
+            const float x   = (float)index * turb[3] + poly2[1];
+            const float x2  = x * x;
+
+            float p = x2 * poly2[0] + poly[3];
+            p = p * x2 + poly[2];
+            p = p * x2 + poly[1];
+            p = p * x2 + poly[0];
+            p = p * x2;
+            p = p * x;
+            sine[j] = p + x;
+
+            st[j] = vst->f[j] + sine[j] * warp[3];
+        }
+        st[0] += warp[1];
+        st[0] *= warp[2];
+        st[1] *= warp[2];
+
+        // Transform:
+        float clip[4];
+        for (j = 0; j < 4; ++j)
+        {
+            clip[j] = mvp[0].f[j] * vpos->f[0] + mvp[1].f[j] * vpos->f[1] +
+                      mvp[2].f[j] * vpos->f[2] + mvp[3].f[j] * vpos->f[3];
+        }
+
+        const float w = fabsf(clip[3]);
+        u32 judgment = 0;
+        for (j = 0; j < 3; ++j)
+        {
+            if (clip[j] > +w) { judgment |= 1 << (j * 2 + 0); }
+            if (clip[j] < -w) { judgment |= 1 << (j * 2 + 1); }
+        }
+        clip_flags = ((clip_flags << 6) | judgment) & 0xFFFFFF;
+
+        // Project to the GS 12:4 fixed point, S/T divided for the perspective:
+        const float q = 1.0f / clip[3];
+        for (j = 0; j < 3; ++j)
+        {
+            vpos->i[j] = (s32)((scales[j] + clip[j] * q * scales[j]) * 16.0f);
+        }
+
+        vst->f[0] = st[0] * q;
+        vst->f[1] = st[1] * q;
+        vst->f[2] = q;
+
+        // Whole triangles: every third vertex decides for all three.
+        if ((v % 3) == 2)
+        {
+            const int adc = ((clip_flags & 0x3FFFF) ? 1 : 0) + 0x7FFF;
+            vpos[0].i[3] = adc;
+            vpos[-VU1_WARP_VERT_QW].i[3] = adc;
+            vpos[-VU1_WARP_VERT_QW * 2].i[3] = adc;
+        }
+    }
+}
+
+/*
+================
+VU1_WarpRunVIF
+================
+*/
+int VU1_WarpRunVIF(ps2_vu_qword_t * vu_mem, const u32 * vif, int vif_qw)
+{
+    int cl = 1, wl = 1;
+    const u32 * end = vif + vif_qw * 4;
+
+    while (vif < end)
+    {
+        const u32 code = *vif++;
+        const int cmd  = (code >> 24) & 0x7F;
+        const int num  = (code >> 16) & 0xFF;
+        const int imm  = code & 0xFFFF;
+
+        if (cmd == VIF_NOP || cmd == VIF_FLUSH)
+        {
+            continue;
+        }
+        if (cmd == VIF_STCYCL)
+        {
+            cl = imm & 0xFF;
+            wl = (imm >> 8) & 0xFF;
+            continue;
+        }
+        if (cmd == VIF_MSCAL)
+        {
+            if (imm != VU1_WARP_PROG_ADDR)
+            {
+                return 0;
+            }
+            VU1_WarpReferenceProg(vu_mem);
+            continue;
+        }
+        if (cmd == VIF_UNPACK_V4_32)
+        {
+            int k, j;
+            const int count = num ? num : 256;
+            const int addr  = imm & 0x3FF;
+
+            if (wl == 0 || wl > cl || vif + count * 4 > end)
+            {
+                return 0; // Only skipping write mode is used.
+            }
+
+            for (k = 0; k < count; ++k, vif += 4)
+            {
+                ps2_vu_qword_t * dest = &vu_mem[(addr + (k / wl) * cl + (k % wl)) & (VU1_MEM_QWORDS - 1)];
+                for (j = 0; j < 4; ++j)
+                {
+                    dest->u[j] = vif[j];
+                }
+            }
+            continue;
+        }
+
+        return 0;
+    }
+
+    return 1;
+}
@@ -0,0 +1,127 @@
+/* ================================================================================================
+ * -*- C -*-
+ * File: vu1_warp.h
+ * Brief: VIF packet generation for the VU1 textured/warped surfaces program
+ *        and a C reference of the math it runs (warp_triangles.vsm).
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#ifndef PS2_VU1_WARP_H
+#define PS2_VU1_WARP_H
+
+#include "ps2/defs_ps2.h"
+#include "ps2/vec_mat.h"
+#include "ps2/vu1.h"
+
+//
+// Nothing in here depends on the PS2DEV SDK, so the packet builder and
+// the reference implementation can be compiled and checked on a host PC.
+//
+// Draws textured triangle lists for the SURF_DRAWTURB and translucent
+// world surfaces. The turbulence of ref_gl's EmitWaterPolys is done per
+// vertex by the VU, from the time in the constants:
+//
+//  s = (os + 8 * sin((ot / 8 + time) * 256 / 2pi) + scroll) / 64
+//  t = (ot + 8 * sin((os / 8 + time) * 256 / 2pi)) / 64
+//
+// where the sine argument is truncated to the 256 steps of the r_turbsin
+// table, so the result matches the table. The sine is a polynomial over
+// [-pi, pi), its error is well under a hundredth of a texel. Surfaces that
+// don't warp use a zero amplitude and a 1 scale, with the S/T as they are.
+//
+// Triangles with a vertex outside the clip volume (near plane or the
+// guard band) are dropped with the ADC bit, like the whole triangle
+// program does. Warp polygons are cut in 64 units pieces at load,
+// so that only leaves small gaps right at the near plane.
+//
+// VU1 memory layout used by warp_triangles.vsm (quadword addresses):
+//
+//  0..3  MVP matrix (model to clip space)
+//  4     GS scale factors XYZ, W = vertex count
+//  5     warp: X = time, Y = scroll, Z = S/T scale, W = -amplitude
+//  6     X,Y = 1/8 (S/T to turbulence phase), Z = 256/2pi, W = 2pi/256
+//  7     sine polynomial: X = c3, Y = c5, Z = c7, W = c9
+//  8     X = c11, Y = -pi, W = the table index mask (int 255)
+//  9     GIF tag (ST + RGBAQ + XYZ2 triangles)
+//  10..  vertexes, 3 qwords each: S/T (X,Y), color (4 ints) and the
+//        position (W = 1). Overwritten in-place by ST, RGBAQ and XYZ2.
+//
+enum
+{
+    VU1_WARP_CONSTS_QW  = 10,
+    VU1_WARP_GIF_TAG    = 9,
+    VU1_WARP_START_VERT = 10,
+    VU1_WARP_VERT_QW    = 3,
+
+    // Micromem address (in instructions) the program is uploaded to.
+    // After the guard band program (VU1_GUARD_PROG_ADDR).
+    VU1_WARP_PROG_ADDR  = 1536,
+
+    // The vertexes go in one UNPACK, which moves at most 256 qwords.
+    VU1_WARP_MAX_TRIS   = 28,
+    VU1_WARP_MAX_VERTS  = VU1_WARP_MAX_TRIS * 3,
+
+    // Size of one batch VIF stream: header qword, the constants, the vertexes
+    // UNPACK qword, the vertexes, then MSCAL and an optional FLUSH.
+    VU1_WARP_MAX_VIF_QW = 1 + VU1_WARP_CONSTS_QW + 1 + VU1_WARP_MAX_VERTS * VU1_WARP_VERT_QW + 1
+};
+
+// Turbulence of ref_gl's warp surfaces.
+#define VU1_WARP_AMPLITUDE 8.0f
+#define VU1_WARP_ST_SCALE  (1.0f / 64.0f)
+
+/*
+ * Per batch constants. Mirrors VU memory 0..9 and
+ * is copied as-is at the start of every batch.
+ */
+typedef struct ps2_vu_warp_consts_s
+{
+    m_mat4_t mvp_matrix;
+    float    gs_scale_x;
+    float    gs_scale_y;
+    float    gs_scale_z;
+    int      vert_count;
+    float    time;
+    float    scroll;
+    float    st_scale;
+    float    amplitude;
+    float    turb[4];
+    float    sin_poly[4];
+    float    sin_poly2[3];
+    int      index_mask;
+    u64      giftag[2];
+} ps2_vu_warp_consts_t PS2_ALIGN(16);
+
+/*
+ * One vertex, as it goes to the VU.
+ */
+typedef struct ps2_vu_warp_vert_s
+{
+    float st[4];    // W unused
+    s32   color[4]; // 128 is 1.0, modulates the texture
+    float pos[4];   // W = 1
+} ps2_vu_warp_vert_t;
+
+// Fills the constants. 'amplitude' and 'st_scale' are VU1_WARP_AMPLITUDE/VU1_WARP_ST_SCALE
+// for the SURF_DRAWTURB surfaces, zero and one otherwise. 'blend' turns on alpha blending.
+void VU1_WarpSetupConsts(ps2_vu_warp_consts_t * consts, const m_mat4_t * mvp, float time,
+                         float scroll, float amplitude, float st_scale, int blend);
+
+// Starts the VIF stream of a batch in 'vif' (VU1_WARP_MAX_VIF_QW qwords,
+// 16 aligned), returns where its VU1_WARP_MAX_VERTS vertexes go.
+ps2_vu_warp_vert_t * VU1_WarpBeginBatch(u32 * vif, const ps2_vu_warp_consts_t * consts);
+
+// Closes the stream after 'num_verts' vertexes (whole triangles) were written.
+// With 'wait_end' set the stream only completes once the VU is done and the
+// output was kicked, so the GS can be given something else right after.
+// Returns the size of the stream in qwords.
+int VU1_WarpEndBatch(u32 * vif, int num_verts, int wait_end);
+
+// Reference for the VU side: interprets a stream from VU1_WarpEndBatch
+// into 'vu_mem' (1024 qwords) and runs the warp_triangles.vsm math in C
+// when it reaches the MSCAL. Returns false on a VIF code it doesn't know.
+int VU1_WarpRunVIF(ps2_vu_qword_t * vu_mem, const u32 * vif, int vif_qw);
+
+#endif // PS2_VU1_WARP_H
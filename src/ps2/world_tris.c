@@ -0,0 +1,438 @@
+/* ================================================================================================
+ * -*- C -*-
+ * File: world_tris.c
+ * Brief: Triangulation of the world polygons and the precomputed triangle
+ *        cache file that lets the map loader skip it (tools/bsptris.c writes them).
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#include "ps2/world_tris.h"
+#include "common/q_files.h"
+
+#include <math.h>
+#include <string.h>
+
+#define TRIANGULATION_EPSILON 0.001f
+
+// q_shared.c has PS2 asm in it (math_funcs.h), so these are local
+// copies of CrossProduct and VectorNormalize for the host tool.
+
+static inline void Tri_Cross(const vec3_t a, const vec3_t b, vec3_t cross)
+{
+    cross[0] = a[1] * b[2] - a[2] * b[1];
+    cross[1] = a[2] * b[0] - a[0] * b[2];
+    cross[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+static inline void Tri_Normalize(vec3_t v)
+{
+    const float length = sqrtf(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    if (length != 0.0f)
+    {
+        const float inv_length = 1.0f / length;
+        v[0] *= inv_length;
+        v[1] *= inv_length;
+        v[2] *= inv_length;
+    }
+}
+
+/*
+==============
+Tri_PolygonNormal
+
+Remarks: Local function.
+Sum of the cross products of each pair of vertexes,
+wrapping around back to the first one. A more detailed
+mathematical explanation of why this works can be found at:
+http://www.iquilezles.org/www/articles/areas/areas.htm
+==============
+*/
+static void Tri_PolygonNormal(const vec3_t * positions, int num_verts, vec3_t normal)
+{
+    int v;
+    vec3_t cross;
+
+    VectorClear(normal);
+    for (v = 0; v < num_verts; ++v)
+    {
+        Tri_Cross(positions[v], positions[(v + 1) % num_verts], cross);
+        VectorAdd(normal, cross, normal);
+    }
+    Tri_Normalize(normal);
+}
+
+/*
+==============
+Tri_NextActive / Tri_PrevActive
+
+Remarks: Local functions.
+==============
+*/
+static inline int Tri_NextActive(int x, int num_verts, const byte * active)
+{
+    for (;;)
+    {
+        if (++x == num_verts)
+        {
+            x = 0;
+        }
+        if (active[x])
+        {
+            return x;
+        }
+    }
+}
+
+static inline int Tri_PrevActive(int x, int num_verts, const byte * active)
+{
+    for (;;)
+    {
+        if (--x == -1)
+        {
+            x = num_verts - 1;
+        }
+        if (active[x])
+        {
+            return x;
+        }
+    }
+}
+
+/*
+==============
+Tri_TestTriangle
+
+Remarks: Local function.
+True if the triangle winds along the normal and
+no other active vertex of the polygon is inside it.
+==============
+*/
+static qboolean Tri_TestTriangle(int pi1, int pi2, int pi3, const vec3_t p1, const vec3_t p2, const vec3_t p3,
+                                 const vec3_t normal, const byte * active, const vec3_t * positions, int num_verts)
+{
+    int v;
+    vec3_t n1, n2, n3;
+    vec3_t temp0, temp1, temp2;
+
+    VectorSubtract(p2, p1, temp0);
+    VectorSubtract(p3, p1, temp1);
+
+    Tri_Normalize(temp0);
+    Tri_Cross(normal, temp0, n1);
+
+    if (DotProduct(n1, temp1) <= TRIANGULATION_EPSILON)
+    {
+        return false;
+    }
+
+    VectorSubtract(p3, p2, temp0);
+    VectorSubtract(p1, p3, temp1);
+
+    Tri_Normalize(temp0);
+    Tri_Normalize(temp1);
+
+    Tri_Cross(normal, temp0, n2);
+    Tri_Cross(normal, temp1, n3);
+
+    for (v = 0; v < num_verts; ++v)
+    {
+        // Look for other vertexes inside the triangle:
+        if (active[v] && v != pi1 && v != pi2 && v != pi3)
+        {
+            VectorSubtract(positions[v], p1, temp0);
+            VectorSubtract(positions[v], p2, temp1);
+            VectorSubtract(positions[v], p3, temp2);
+
+            Tri_Normalize(temp0);
+            Tri_Normalize(temp1);
+            Tri_Normalize(temp2);
+
+            if (DotProduct(n1, temp0) > -TRIANGULATION_EPSILON &&
+                DotProduct(n2, temp1) > -TRIANGULATION_EPSILON &&
+                DotProduct(n3, temp2) > -TRIANGULATION_EPSILON)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/*
+==============
+PS2_TriangulatePolygon
+
+Algorithm used below is an "Ear clipping"-based triangulation algorithm,
+adapted from sample code presented in the "Mathematics for 3D Game Programming and Computer Graphics"
+book by Eric Lengyel (available at http://www.mathfor3dgameprogramming.com/code/Listing9.2.cpp).
+==============
+*/
+int PS2_TriangulatePolygon(const vec3_t * positions, int num_verts, u16 * indexes)
+{
+    #define EMIT_TRI(v0, v1, v2)      \
+        do                            \
+        {                             \
+            indexes[0] = (v0);        \
+            indexes[1] = (v1);        \
+            indexes[2] = (v2);        \
+            indexes += 3;             \
+            triangles_done++;         \
+        } while (0)
+
+    int triangles_done = 0;
+
+    if (num_verts < 3 || num_verts > WORLD_TRIS_MAX_VERTS)
+    {
+        return 0;
+    }
+    if (num_verts == 3)
+    {
+        EMIT_TRI(0, 1, 2);
+        return triangles_done;
+    }
+
+    // We need a normal to properly judge the winding of the triangles.
+    vec3_t normal;
+    Tri_PolygonNormal(positions, num_verts, normal);
+
+    int i;
+    int start = 0;
+    int p1 = 0;
+    int p2 = 1;
+    int m1 = num_verts - 1;
+    int m2 = num_verts - 2;
+    qboolean last_positive = false;
+
+    vec3_t temp0, temp1;
+
+    // Only 1 byte per entry, so a stack buffer is fine.
+    byte active[WORLD_TRIS_MAX_VERTS];
+    for (i = 0; i < num_verts; ++i)
+    {
+        active[i] = true;
+    }
+
+    // Triangulation loop:
+    for (;;)
+    {
+        if (p2 == m2)
+        {
+            // Only three vertexes remain. We're done.
+            EMIT_TRI(m1, p1, p2);
+            break;
+        }
+
+        const float * vp1 = positions[p1];
+        const float * vp2 = positions[p2];
+        const float * vm1 = positions[m1];
+        const float * vm2 = positions[m2];
+
+        // Determine whether vp1, vp2, and vm1 form a valid triangle:
+        qboolean positive = Tri_TestTriangle(p1, p2, m1, vp2, vm1, vp1, normal, active, positions, num_verts);
+
+        // Determine whether vm1, vm2, and vp1 form a valid triangle:
+        qboolean negative = Tri_TestTriangle(m1, m2, p1, vp1, vm2, vm1, normal, active, positions, num_verts);
+
+        // If both triangles are valid, choose the
+        // one having the larger smallest angle.
+        if (positive && negative)
+        {
+            VectorSubtract(vp2, vm1, temp0);
+            VectorSubtract(vm2, vm1, temp1);
+            Tri_Normalize(temp0);
+            Tri_Normalize(temp1);
+            const float pDot = DotProduct(temp0, temp1);
+
+            VectorSubtract(vm2, vp1, temp0);
+            VectorSubtract(vp2, vp1, temp1);
+            Tri_Normalize(temp0);
+            Tri_Normalize(temp1);
+            const float mDot = DotProduct(temp0, temp1);
+
+            if (fabsf(pDot - mDot) < TRIANGULATION_EPSILON)
+            {
+                if (last_positive) { positive = false; }
+                else               { negative = false; }
+            }
+            else
+            {
+                if (pDot < mDot)   { negative = false; }
+                else               { positive = false; }
+            }
+        }
+
+        if (positive)
+        {
+            // Output the triangle m1, p1, p2:
+            active[p1] = false;
+            EMIT_TRI(m1, p1, p2);
+            p1 = Tri_NextActive(p1, num_verts, active);
+            p2 = Tri_NextActive(p2, num_verts, active);
+            last_positive = true;
+            start = -1;
+        }
+        else if (negative)
+        {
+            // Output the triangle m2, m1, p1:
+            active[m1] = false;
+            EMIT_TRI(m2, m1, p1);
+            m1 = Tri_PrevActive(m1, num_verts, active);
+            m2 = Tri_PrevActive(m2, num_verts, active);
+            last_positive = false;
+            start = -1;
+        }
+        else // Not a valid triangle yet.
+        {
+            if (start == -1)
+            {
+                start = p2;
+            }
+            else if (p2 == start)
+            {
+                // Exit if we've gone all the way around the
+                // polygon without finding a valid triangle.
+                break;
+            }
+
+            // Advance working set of vertexes:
+            m2 = m1;
+            m1 = p1;
+            p1 = p2;
+            p2 = Tri_NextActive(p2, num_verts, active);
+        }
+    }
+
+    #undef EMIT_TRI
+    return triangles_done;
+}
+
+/*
+==============
+Tri_HashWords
+
+Remarks: Local function.
+MurmurHash3 (x86, 32 bits) body, continuing from 'hash'. Takes
+the lump 4 bytes at a time, all BSP lumps hashed are made of
+32 bit fields, so the byte tail is only there for broken files.
+==============
+*/
+static u32 Tri_HashWords(u32 hash, const byte * bytes, int count)
+{
+    int i;
+    u32 word;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        // Lumps don't have to be aligned in the file.
+        memcpy(&word, bytes + i, sizeof(word));
+        word *= 0xCC9E2D51u;
+        word  = (word << 15) | (word >> 17);
+        word *= 0x1B873593u;
+
+        hash ^= word;
+        hash  = (hash << 13) | (hash >> 19);
+        hash  = hash * 5 + 0xE6546B64u;
+    }
+    for (; i < count; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 0xCC9E2D51u;
+    }
+    return hash;
+}
+
+/*
+==============
+PS2_WorldTrisHash
+==============
+*/
+u32 PS2_WorldTrisHash(const void * bsp_data)
+{
+    static const int lumps[] = { LUMP_VERTEXES, LUMP_EDGES, LUMP_SURFEDGES, LUMP_FACES, LUMP_TEXINFO };
+
+    const dheader_t * header = (const dheader_t *)bsp_data;
+    u32 hash = 0;
+    u32 total_len = 0;
+
+    int i;
+    for (i = 0; i < (int)(sizeof(lumps) / sizeof(lumps[0])); ++i)
+    {
+        const lump_t * l = &header->lumps[lumps[i]];
+        hash = Tri_HashWords(hash, (const byte *)bsp_data + l->fileofs, l->filelen);
+        total_len += l->filelen;
+    }
+
+    // MurmurHash3 finalizer, with the length of all lumps.
+    hash ^= total_len;
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6Bu;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35u;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+/*
+==============
+PS2_WorldTrisCount
+
+The lumps are read as they are in the file, little-endian.
+==============
+*/
+int PS2_WorldTrisCount(const void * bsp_data)
+{
+    const dheader_t * header = (const dheader_t *)bsp_data;
+    const dface_t * faces    = (const dface_t *)((const byte *)bsp_data + header->lumps[LUMP_FACES].fileofs);
+    const textureinfo_t * infos  = (const textureinfo_t *)((const byte *)bsp_data + header->lumps[LUMP_TEXINFO].fileofs);
+    const int num_faces      = header->lumps[LUMP_FACES].filelen / sizeof(dface_t);
+    const int num_infos      = header->lumps[LUMP_TEXINFO].filelen / sizeof(textureinfo_t);
+
+    int i, count = 0;
+    for (i = 0; i < num_faces; ++i)
+    {
+        if (faces[i].texinfo < 0 || faces[i].texinfo >= num_infos)
+        {
+            return -1;
+        }
+        if (!(infos[faces[i].texinfo].flags & SURF_WARP) && faces[i].numedges >= 3)
+        {
+            count += (faces[i].numedges - 2) * 3;
+        }
+    }
+    return count;
+}
+
+/*
+==============
+PS2_WorldTrisValidate
+==============
+*/
+const byte * PS2_WorldTrisValidate(const void * tris_data, int tris_len, const void * bsp_data)
+{
+    const world_tris_header_t * tris_header = (const world_tris_header_t *)tris_data;
+    const dheader_t * bsp_header = (const dheader_t *)bsp_data;
+
+    if (tris_len < (int)sizeof(world_tris_header_t) ||
+        tris_header->ident   != WORLD_TRIS_IDENT    ||
+        tris_header->version != WORLD_TRIS_VERSION)
+    {
+        return NULL;
+    }
+
+    if (tris_header->num_faces != (int)(bsp_header->lumps[LUMP_FACES].filelen / sizeof(dface_t)) ||
+        tris_header->num_indexes != PS2_WorldTrisCount(bsp_data) ||
+        tris_len != (int)sizeof(world_tris_header_t) + tris_header->num_indexes)
+    {
+        return NULL;
+    }
+
+    if (tris_header->bsp_hash != PS2_WorldTrisHash(bsp_data))
+    {
+        return NULL;
+    }
+
+    return (const byte *)tris_data + sizeof(world_tris_header_t);
+}
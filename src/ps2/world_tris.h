@@ -0,0 +1,69 @@
+/* ================================================================================================
+ * -*- C -*-
+ * File: world_tris.h
+ * Brief: Triangulation of the world polygons and the precomputed triangle
+ *        cache file that lets the map loader skip it (tools/bsptris.c writes them).
+ *
+ * This source code is released under the GNU GPL v2 license.
+ * Check the accompanying LICENSE file for details.
+ * ================================================================================================ */
+
+#ifndef PS2_WORLD_TRIS_H
+#define PS2_WORLD_TRIS_H
+
+#include "game/q_shared.h"
+#include "ps2/defs_ps2.h"
+
+//
+// Nothing in here depends on the PS2DEV SDK, so the offline tool
+// triangulates with the very same code the map loader uses.
+//
+// The cache sits next to the map, maps/<name>.tri for maps/<name>.bsp.
+// It has a header followed by the triangles of every face of the BSP
+// that gets a single polygon (all but SURF_WARP), in face order: each
+// face of N edges has N-2 triangles of 3 byte-sized indexes into the
+// polygon vertexes, in edge order. Faces the triangulator gives up on
+// are padded with degenerate (0,0,0) triangles, as the loader does.
+//
+// The header has a hash of the BSP lumps the triangles depend on, so a
+// cache left from an older build of the map is just ignored.
+//
+#define WORLD_TRIS_IDENT    (('I' << 24) + ('R' << 16) + ('T' << 8) + 'W') // 4CC 'WTRI'
+#define WORLD_TRIS_VERSION  2
+#define WORLD_TRIS_EXT      ".tri"
+
+enum
+{
+    // Most BSP polygons are well under 20 vertexes.
+    WORLD_TRIS_MAX_VERTS = 128
+};
+
+typedef struct
+{
+    int ident;       // WORLD_TRIS_IDENT
+    int version;     // WORLD_TRIS_VERSION
+    u32 bsp_hash;    // PS2_WorldTrisHash of the map
+    int num_faces;   // Faces in the map, warped ones included
+    int num_indexes; // Indexes after the header, 3 per triangle
+} world_tris_header_t;
+
+// Triangulates a planar polygon of 'num_verts' positions (3 to WORLD_TRIS_MAX_VERTS),
+// writing up to num_verts-2 triangles as index triplets to 'indexes'. Returns the number
+// of triangles written, which is less than num_verts-2 only for broken polygons.
+int PS2_TriangulatePolygon(const vec3_t * positions, int num_verts, u16 * indexes);
+
+// Hash of the vertex, edge, surfedge, face and texinfo lumps of a BSP file
+// in memory, with the header already in the native byte order. Taken over
+// 32 bit words, so it's cheap enough to run on every map load.
+u32 PS2_WorldTrisHash(const void * bsp_data);
+
+// Number of indexes a cache for the BSP should have.
+int PS2_WorldTrisCount(const void * bsp_data);
+
+// Checks a cache file loaded in memory against its BSP. Returns
+// where the indexes start or null if it can't be used with the map.
+// Only the header is checked: the loader checks each index against
+// the vertex count of its face as it copies them.
+const byte * PS2_WorldTrisValidate(const void * tris_data, int tris_len, const void * bsp_data);
+
+#endif // PS2_WORLD_TRIS_H
@@ -192,6 +192,9 @@ extern cvar_t * sv_enforcetime;
 extern cvar_t * sv_paused;
 extern cvar_t * sv_noreload;      // don't reload level state when reentering
 extern cvar_t * sv_airaccelerate; // don't reload level state when reentering
+extern cvar_t * sv_showframebuild;
+extern cvar_t * sv_deltacache;
+extern cvar_t * sv_showdelta;
                                   // development tool
 extern client_t * sv_client;
 extern edict_t * sv_player;
@@ -306,6 +309,12 @@ void SV_LinkEdict(edict_t * ent);
 // sets ent->leafnums[] for pvs determination even if the entity
 // is not solid
 
+void SV_ClusterEntities(const byte * pvs, byte * entbits);
+// sets a bit in entbits (MAX_EDICTS bits) for every edict that may be
+// visible from the given pvs, using the cluster index built by
+// SV_LinkEdict. The result is conservative, callers still need to do
+// the exact visibility tests.
+
 int SV_AreaEdicts(vec3_t mins, vec3_t maxs, edict_t ** list, int maxcount, int areatype);
 // fills in a table of edict pointers with edicts that have bounding boxes
 // that intersect the given area.  It is possible for a non-axial bmodel
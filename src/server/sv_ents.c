@@ -116,6 +116,99 @@ void SV_EmitProjectileUpdate (sizebuf_t *msg)
 
 #endif // 0
 
+/*
+=============================================================================
+
+Entity delta cache
+
+PS2: With many clients the same (from, to) pair of entity states gets delta
+encoded over and over, once per client, whenever those clients acknowledged
+the same frame. Encoded deltas are kept in a small direct mapped cache keyed
+by a hash of both states. A hit is verified against full copies of the
+states, so the cache never changes what goes on the wire, and entries stay
+valid across frames since the encoding only depends on the two states.
+Only used when there's more than one client to share the work with.
+
+=============================================================================
+*/
+
+enum
+{
+    DELTA_CACHE_SIZE = 256 // Must be a power of two
+};
+
+typedef struct
+{
+    entity_state_t from;
+    entity_state_t to;
+    byte valid;
+    byte force;
+    byte newentity;
+    byte len;
+    byte data[MAX_ENTITY_DELTA_BYTES];
+} delta_cache_t;
+
+static delta_cache_t * sv_deltacache_entries; // [DELTA_CACHE_SIZE], allocated on first use
+static int sv_deltacache_hits;
+static int sv_deltacache_misses;
+
+static unsigned SV_HashEntityState(const entity_state_t * s)
+{
+    const unsigned * p = (const unsigned *)s;
+    unsigned hash = 0;
+    int i;
+
+    for (i = 0; i < sizeof(*s) / sizeof(unsigned); i++)
+        hash = hash * 31 + p[i];
+
+    return hash;
+}
+
+/*
+=============
+SV_WriteDeltaEntity
+
+Same as MSG_WriteDeltaEntity, but goes through the delta cache.
+=============
+*/
+static void SV_WriteDeltaEntity(entity_state_t * from, entity_state_t * to, sizebuf_t * msg, qboolean force, qboolean newentity)
+{
+    delta_cache_t * entry;
+    unsigned hash;
+
+    if (!sv_deltacache->value || maxclients->value <= 1)
+    {
+        MSG_WriteDeltaEntity(from, to, msg, force, newentity);
+        return;
+    }
+
+    if (!sv_deltacache_entries)
+        sv_deltacache_entries = Z_Malloc(DELTA_CACHE_SIZE * sizeof(delta_cache_t));
+
+    hash = SV_HashEntityState(from) * 16777619u ^ SV_HashEntityState(to);
+    hash ^= (force << 1) | (newentity != 0);
+    entry = &sv_deltacache_entries[(hash ^ (hash >> 16)) & (DELTA_CACHE_SIZE - 1)];
+
+    if (entry->valid && entry->force == force && entry->newentity == (newentity != 0) &&
+        !memcmp(&entry->to, to, sizeof(*to)) && !memcmp(&entry->from, from, sizeof(*from)))
+    {
+        sv_deltacache_hits++;
+    }
+    else
+    {
+        entry->from = *from;
+        entry->to = *to;
+        entry->force = force;
+        entry->newentity = (newentity != 0);
+        entry->len = MSG_EncodeDeltaEntity(from, to, entry->data, force, newentity);
+        entry->valid = true;
+        sv_deltacache_misses++;
+    }
+
+    if (entry->len > 0)
+        SZ_Write(msg, entry->data, entry->len);
+}
+
 /*
 =============
 SV_EmitPacketEntities
@@ -130,6 +223,12 @@ void SV_EmitPacketEntities(client_frame_t * from, client_frame_t * to, sizebuf_t
     int oldnum, newnum;
     int from_num_entities;
     int bits;
+    int start_size;
+    unsigned int start_time;
+
+    start_size = msg->cursize;
+    if (sv_showdelta->value)
+        start_time = Sys_Microseconds();
 
 #if 0
 	if (numprojs)
@@ -169,7 +268,7 @@ void SV_EmitPacketEntities(client_frame_t * from, client_frame_t * to, sizebuf_t
             // in any bytes being emited if the entity has not changed at all
             // note that players are always 'newentities', this updates their oldorigin always
             // and prevents warping
-            MSG_WriteDeltaEntity(oldent, newent, msg, false, newent->number <= maxclients->value);
+            SV_WriteDeltaEntity(oldent, newent, msg, false, newent->number <= maxclients->value);
             oldindex++;
             newindex++;
             continue;
@@ -177,7 +276,7 @@ void SV_EmitPacketEntities(client_frame_t * from, client_frame_t * to, sizebuf_t
 
         if (newnum < oldnum)
         { // this is a new entity, send it from the baseline
-            MSG_WriteDeltaEntity(&sv.baselines[newnum], newent, msg, true, true);
+            SV_WriteDeltaEntity(&sv.baselines[newnum], newent, msg, true, true);
             newindex++;
             continue;
         }
@@ -204,6 +303,27 @@ void SV_EmitPacketEntities(client_frame_t * from, client_frame_t * to, sizebuf_t
 
     MSG_WriteShort(msg, 0); // end of packetentities
 
+    if (sv_showdelta->value)
+    {
+        static unsigned int delta_time;
+        static int delta_bytes, delta_count;
+
+        // One client frame is well under a millisecond.
+        delta_time += Sys_Microseconds() - start_time;
+        delta_bytes += msg->cursize - start_size;
+        if (++delta_count >= 100)
+        {
+            Com_Printf("SV_EmitPacketEntities: %i bytes, %.1f us per client frame, cache %i hits %i misses\n",
+                       delta_bytes / delta_count, (float)delta_time / delta_count,
+                       sv_deltacache_hits, sv_deltacache_misses);
+            delta_time = 0;
+            delta_bytes = 0;
+            delta_count = 0;
+            sv_deltacache_hits = 0;
+            sv_deltacache_misses = 0;
+        }
+    }
+
 #if 0
 	if (numprojs)
 		SV_EmitProjectileUpdate(msg);
@@ -443,7 +563,29 @@ Build a client frame structure
 =============================================================================
 */
 
-byte fatpvs[65536 / 8]; // 32767 is MAX_MAP_LEAFS
+enum
+{
+    FATPVS_CACHE_SIZE = 4,   // a few entries so clients standing in different spots don't thrash
+    FATPVS_MAX_CLUSTERS = 64 // matches the leaf list size used by SV_FatPVS
+};
+
+/*
+ * PS2: The fat PVS only depends on the set of clusters touched by the
+ * client's view box, so it is cached by that set. Stationary clients, and
+ * clients sharing the same spot, reuse the merged vector instead of ORing
+ * the cluster PVSs together again every frame. Flushed on every map load.
+ */
+typedef struct
+{
+    int numclusters; // 0 = unused entry
+    int clusters[FATPVS_MAX_CLUSTERS];
+    int lastused;
+    byte pvs[65536 / 8]; // 32767 is MAX_MAP_LEAFS
+} fatpvs_cache_t;
+
+static fatpvs_cache_t fatpvs_cache[FATPVS_CACHE_SIZE];
+static int fatpvs_cache_spawncount = -1;
+static int fatpvs_cache_counter;
 
 /*
 ============
@@ -453,12 +595,14 @@ The client will interpolate the view position,
 so we can't use a single PVS point
 ===========
 */
-void SV_FatPVS(vec3_t org)
+byte * SV_FatPVS(vec3_t org)
 {
-    int leafs[64];
+    int leafs[FATPVS_MAX_CLUSTERS];
     int i, j, count;
     int longs;
+    int unique;
     byte * src;
+    fatpvs_cache_t * entry;
     vec3_t mins, maxs;
 
     for (i = 0; i < 3; i++)
@@ -467,28 +611,64 @@ void SV_FatPVS(vec3_t org)
         maxs[i] = org[i] + 8;
     }
 
-    count = CM_BoxLeafnums(mins, maxs, leafs, 64, NULL);
+    count = CM_BoxLeafnums(mins, maxs, leafs, FATPVS_MAX_CLUSTERS, NULL);
     if (count < 1)
         Com_Error(ERR_FATAL, "SV_FatPVS: count < 1");
     longs = (CM_NumClusters() + 31) >> 5;
 
-    // convert leafs to clusters
+    // convert leafs to a sorted list of unique clusters,
+    // which is the key into the cache
+    unique = 0;
     for (i = 0; i < count; i++)
-        leafs[i] = CM_LeafCluster(leafs[i]);
-
-    memcpy(fatpvs, CM_ClusterPVS(leafs[0]), longs << 2);
-    // or in all the other leaf bits
-    for (i = 1; i < count; i++)
     {
-        for (j = 0; j < i; j++)
-            if (leafs[i] == leafs[j])
+        const int cluster = CM_LeafCluster(leafs[i]);
+        for (j = 0; j < unique; j++)
+            if (leafs[j] == cluster)
                 break;
-        if (j != i)
+        if (j != unique)
             continue; // already have the cluster we want
+
+        for (j = unique; j > 0 && leafs[j - 1] > cluster; j--)
+            leafs[j] = leafs[j - 1];
+        leafs[j] = cluster;
+        unique++;
+    }
+
+    if (fatpvs_cache_spawncount != svs.spawncount)
+    {
+        memset(fatpvs_cache, 0, sizeof(fatpvs_cache));
+        fatpvs_cache_spawncount = svs.spawncount;
+    }
+
+    ++fatpvs_cache_counter;
+
+    entry = &fatpvs_cache[0];
+    for (i = 0; i < FATPVS_CACHE_SIZE; i++)
+    {
+        if (fatpvs_cache[i].numclusters == unique &&
+            !memcmp(fatpvs_cache[i].clusters, leafs, unique * sizeof(int)))
+        {
+            fatpvs_cache[i].lastused = fatpvs_cache_counter;
+            return fatpvs_cache[i].pvs;
+        }
+        if (fatpvs_cache[i].lastused < entry->lastused)
+            entry = &fatpvs_cache[i];
+    }
+
+    // miss, rebuild the least recently used entry
+    entry->numclusters = unique;
+    entry->lastused = fatpvs_cache_counter;
+    memcpy(entry->clusters, leafs, unique * sizeof(int));
+
+    memcpy(entry->pvs, CM_ClusterPVS(leafs[0]), longs << 2);
+    // or in all the other leaf bits
+    for (i = 1; i < unique; i++)
+    {
         src = CM_ClusterPVS(leafs[i]);
         for (j = 0; j < longs; j++)
-            ((long *)fatpvs)[j] |= ((long *)src)[j];
+            ((long *)entry->pvs)[j] |= ((long *)src)[j];
     }
+    return entry->pvs;
 }
 
 /*
@@ -512,12 +692,18 @@ void SV_BuildClientFrame(client_t * client)
     int leafnum;
     int c_fullsend;
     byte * clientphs;
+    byte * fatpvs;
     byte * bitvector;
+    byte entbits[MAX_EDICTS / 8];
+    unsigned int start_time;
 
     clent = client->edict;
     if (!clent->client)
         return; // not in game yet
 
+    if (sv_showframebuild->value)
+        start_time = Sys_Microseconds();
+
 #if 0
 	numprojs = 0; // no projectiles yet
 #endif
@@ -541,9 +727,15 @@ void SV_BuildClientFrame(client_t * client)
     // grab the current player_state_t
     frame->ps = clent->client->ps;
 
-    SV_FatPVS(org);
+    fatpvs = SV_FatPVS(org);
     clientphs = CM_ClusterPHS(clientcluster);
 
+    // only the edicts touching a visible cluster are candidates,
+    // plus the client itself
+    SV_ClusterEntities(fatpvs, entbits);
+    e = NUM_FOR_EDICT(clent);
+    entbits[e >> 3] |= 1 << (e & 7);
+
     // build up the list of visible entities
     frame->num_entities = 0;
     frame->first_entity = svs.next_client_entities;
@@ -552,6 +744,18 @@ void SV_BuildClientFrame(client_t * client)
 
     for (e = 1; e < ge->num_edicts; e++)
     {
+        // edicts past MAX_EDICTS are not in the cluster index, test them all
+        if (e < MAX_EDICTS)
+        {
+            if (!entbits[e >> 3])
+            {
+                e |= 7; // no candidates in this group of 8
+                continue;
+            }
+            if (!(entbits[e >> 3] & (1 << (e & 7))))
+                continue;
+        }
+
         ent = EDICT_NUM(e);
 
         // ignore ents without visible models
@@ -612,11 +816,9 @@ void SV_BuildClientFrame(client_t * client)
                 if (!ent->s.modelindex)
                 { // don't send sounds if they will be attenuated away
                     vec3_t delta;
-                    float len;
 
                     VectorSubtract(org, ent->s.origin, delta);
-                    len = VectorLength(delta);
-                    if (len > 400)
+                    if (DotProduct(delta, delta) > 400 * 400)
                         continue;
                 }
             }
@@ -643,6 +845,21 @@ void SV_BuildClientFrame(client_t * client)
         svs.next_client_entities++;
         frame->num_entities++;
     }
+
+    if (sv_showframebuild->value)
+    {
+        static unsigned int build_time;
+        static int build_count;
+
+        build_time += Sys_Microseconds() - start_time;
+        if (++build_count >= 100)
+        {
+            Com_Printf("SV_BuildClientFrame: %.3f ms/client over %i frames\n",
+                       (float)build_time / 1000.0f / build_count, build_count);
+            build_time = 0;
+            build_count = 0;
+        }
+    }
 }
 
 /*
@@ -38,6 +38,9 @@ cvar_t * sv_airaccelerate;
 cvar_t * sv_noreload; // don't reload level state when reentering
 cvar_t * maxclients;  // FIXME: rename sv_maxclients
 cvar_t * sv_showclamp;
+cvar_t * sv_showframebuild; // print average SV_BuildClientFrame time
+cvar_t * sv_deltacache;     // share encoded entity deltas between clients
+cvar_t * sv_showdelta;      // print packet entity size and encoding time
 cvar_t * hostname;
 cvar_t * public_server;      // should heartbeats be sent
 cvar_t * sv_reconnect_limit; // minimum seconds between connect messages
@@ -575,6 +578,92 @@ void SV_GiveMsec(void)
     }
 }
 
+/*
+=================
+Client address lookup
+
+PS2: Packets from connected clients are matched by base address and qport.
+Rather than comparing each packet against every client slot, the slots in
+use are hashed by (ip, qport) once per SV_ReadPackets call. Slots are only
+assigned while handling connectionless packets, so the table is rebuilt
+after each one of those. Loopback packets match any slot with the right
+qport (see NET_CompareBaseAdr), so they still use the linear search.
+=================
+*/
+
+enum
+{
+    CLIENT_HASH_SIZE = MAX_CLIENTS * 2 // Must be a power of two
+};
+
+static short sv_clienthash[CLIENT_HASH_SIZE];
+
+static unsigned SV_HashClientAdr(const netadr_t * adr, int qport)
+{
+    unsigned hash;
+
+    hash = (adr->ip[0] << 24) | (adr->ip[1] << 16) | (adr->ip[2] << 8) | adr->ip[3];
+    hash = (hash ^ (unsigned)qport) * 2654435761u;
+    return (hash >> 16) & (CLIENT_HASH_SIZE - 1);
+}
+
+static void SV_BuildClientHash(void)
+{
+    int i;
+    unsigned h;
+    client_t * cl;
+
+    for (i = 0; i < CLIENT_HASH_SIZE; i++)
+        sv_clienthash[i] = -1;
+
+    // inserted in slot order, so probing finds the same
+    // slot the linear search would have found first
+    for (i = 0, cl = svs.clients; i < maxclients->value; i++, cl++)
+    {
+        if (cl->state == cs_free || cl->netchan.remote_address.type != NA_IP)
+            continue;
+
+        h = SV_HashClientAdr(&cl->netchan.remote_address, cl->netchan.qport);
+        while (sv_clienthash[h] != -1)
+            h = (h + 1) & (CLIENT_HASH_SIZE - 1);
+        sv_clienthash[h] = i;
+    }
+}
+
+static client_t * SV_FindClientForPacket(int qport)
+{
+    int i;
+    unsigned h;
+    client_t * cl;
+
+    if (net_from.type == NA_IP)
+    {
+        h = SV_HashClientAdr(&net_from, qport);
+        while (sv_clienthash[h] != -1)
+        {
+            cl = &svs.clients[sv_clienthash[h]];
+            if (cl->state != cs_free &&
+                cl->netchan.qport == qport &&
+                NET_CompareBaseAdr(net_from, cl->netchan.remote_address))
+                return cl;
+            h = (h + 1) & (CLIENT_HASH_SIZE - 1);
+        }
+        return NULL;
+    }
+
+    for (i = 0, cl = svs.clients; i < maxclients->value; i++, cl++)
+    {
+        if (cl->state == cs_free)
+            continue;
+        if (!NET_CompareBaseAdr(net_from, cl->netchan.remote_address))
+            continue;
+        if (cl->netchan.qport != qport)
+            continue;
+        return cl;
+    }
+    return NULL;
+}
+
 /*
 =================
 SV_ReadPackets
@@ -582,16 +671,18 @@ SV_ReadPackets
 */
 void SV_ReadPackets(void)
 {
-    int i;
     client_t * cl;
     int qport;
 
+    SV_BuildClientHash();
+
     while (NET_GetPacket(NS_SERVER, &net_from, &net_message))
     {
         // check for connectionless packet (0xffffffff) first
         if (*(int *)net_message.data == -1)
         {
             SV_ConnectionlessPacket();
+            SV_BuildClientHash(); // may have connected a client
             continue;
         }
 
@@ -603,33 +694,24 @@ void SV_ReadPackets(void)
         qport = MSG_ReadShort(&net_message) & 0xffff;
 
         // check for packets from connected clients
-        for (i = 0, cl = svs.clients; i < maxclients->value; i++, cl++)
+        cl = SV_FindClientForPacket(qport);
+        if (!cl)
+            continue;
+
+        if (cl->netchan.remote_address.port != net_from.port)
         {
-            if (cl->state == cs_free)
-                continue;
-            if (!NET_CompareBaseAdr(net_from, cl->netchan.remote_address))
-                continue;
-            if (cl->netchan.qport != qport)
-                continue;
-            if (cl->netchan.remote_address.port != net_from.port)
-            {
-                Com_Printf("SV_ReadPackets: fixing up a translated port\n");
-                cl->netchan.remote_address.port = net_from.port;
-            }
+            Com_Printf("SV_ReadPackets: fixing up a translated port\n");
+            cl->netchan.remote_address.port = net_from.port;
+        }
 
-            if (Netchan_Process(&cl->netchan, &net_message))
-            { // this is a valid, sequenced packet, so process it
-                if (cl->state != cs_zombie)
-                {
-                    cl->lastmessage = svs.realtime; // don't timeout
-                    SV_ExecuteClientMessage(cl);
-                }
+        if (Netchan_Process(&cl->netchan, &net_message))
+        { // this is a valid, sequenced packet, so process it
+            if (cl->state != cs_zombie)
+            {
+                cl->lastmessage = svs.realtime; // don't timeout
+                SV_ExecuteClientMessage(cl);
             }
-            break;
         }
-
-        if (i != maxclients->value)
-            continue;
     }
 }
 
@@ -738,6 +820,32 @@ void SV_RunGameFrame(void)
     }
 }
 
+/*
+==================
+SV_IdleMsec
+
+Milliseconds until the next game tick is due.
+==================
+*/
+int SV_IdleMsec(void)
+{
+    enum
+    {
+        SV_MAX_IDLE_MSEC = 100 // still wake up now and then for console input
+    };
+
+    if (!svs.initialized)
+        return SV_MAX_IDLE_MSEC;
+
+    if (sv_timedemo->value || svs.realtime >= sv.time)
+        return 0;
+
+    if (sv.time - svs.realtime > SV_MAX_IDLE_MSEC)
+        return SV_MAX_IDLE_MSEC;
+
+    return sv.time - svs.realtime;
+}
+
 /*
 ==================
 SV_Frame
@@ -954,6 +1062,9 @@ void SV_Init(void)
     timeout = Cvar_Get("timeout", "125", 0);
     zombietime = Cvar_Get("zombietime", "2", 0);
     sv_showclamp = Cvar_Get("showclamp", "0", 0);
+    sv_showframebuild = Cvar_Get("sv_showframebuild", "0", 0);
+    sv_deltacache = Cvar_Get("sv_deltacache", "1", 0);
+    sv_showdelta = Cvar_Get("sv_showdelta", "0", 0);
     sv_paused = Cvar_Get("paused", "0", 0);
     sv_timedemo = Cvar_Get("timedemo", "0", 0);
     sv_enforcetime = Cvar_Get("sv_enforcetime", "0", 0);
@@ -127,6 +127,165 @@ areanode_t * SV_CreateAreaNode(int depth, vec3_t mins, vec3_t maxs)
     return anode;
 }
 
+/*
+===============================================================================
+
+CLUSTER ENTITY INDEX
+
+PS2: Reverse index from PVS cluster to the edicts touching it, kept up to
+date by SV_LinkEdict, so SV_BuildClientFrame only has to test the edicts
+found in the clusters that are actually visible instead of every edict for
+every client. Each edict owns MAX_ENT_CLUSTERS link slots, so the link for
+(entnum, slot) lives at entnum * MAX_ENT_CLUSTERS + slot.
+
+Edicts that are linked by headnode (too many clusters) or that are beams
+(which are tested against the PHS) can't be found through the PVS, so they
+are kept in a separate bit set and are always tested.
+
+Only the first MAX_EDICTS edicts are indexed, which keeps the link numbers
+in a short. Any edicts past that (maxentities above MAX_EDICTS) are left out
+of the index and SV_BuildClientFrame tests them all, like it used to.
+===============================================================================
+*/
+
+typedef struct
+{
+    short prev;
+    short next;
+    short cluster;
+} clusterlink_t;
+
+static clusterlink_t * sv_clusterlinks; // [sv_numindexed * MAX_ENT_CLUSTERS]
+static short * sv_clusterheads;         // [CM_NumClusters()]
+static byte * sv_entnumclusters;        // [sv_numindexed], links in use per edict
+static byte sv_alwaysvisible[MAX_EDICTS / 8];
+static int sv_numindexed;
+static int sv_numclusterlinks;
+static int sv_numclusterheads;
+
+static void SV_ClearClusterIndex(void)
+{
+    int i;
+
+    if (sv_clusterlinks)
+        Z_Free(sv_clusterlinks);
+    if (sv_clusterheads)
+        Z_Free(sv_clusterheads);
+    if (sv_entnumclusters)
+        Z_Free(sv_entnumclusters);
+
+    sv_numindexed = ge->max_edicts;
+    if (sv_numindexed > MAX_EDICTS)
+        sv_numindexed = MAX_EDICTS;
+    sv_numclusterlinks = sv_numindexed * MAX_ENT_CLUSTERS;
+
+    sv_numclusterheads = CM_NumClusters();
+    if (sv_numclusterheads < 1)
+        sv_numclusterheads = 1;
+
+    sv_clusterlinks = Z_Malloc(sv_numclusterlinks * sizeof(clusterlink_t));
+    sv_clusterheads = Z_Malloc(sv_numclusterheads * sizeof(short));
+    sv_entnumclusters = Z_Malloc(sv_numindexed);
+
+    for (i = 0; i < sv_numclusterheads; i++)
+        sv_clusterheads[i] = -1;
+
+    memset(sv_alwaysvisible, 0, sizeof(sv_alwaysvisible));
+}
+
+static void SV_UnindexEdict(int entnum)
+{
+    clusterlink_t * link;
+    int i, l;
+
+    sv_alwaysvisible[entnum >> 3] &= ~(1 << (entnum & 7));
+
+    for (i = 0; i < sv_entnumclusters[entnum]; i++)
+    {
+        l = entnum * MAX_ENT_CLUSTERS + i;
+        link = &sv_clusterlinks[l];
+
+        if (link->prev != -1)
+            sv_clusterlinks[link->prev].next = link->next;
+        else
+            sv_clusterheads[link->cluster] = link->next;
+
+        if (link->next != -1)
+            sv_clusterlinks[link->next].prev = link->prev;
+    }
+    sv_entnumclusters[entnum] = 0;
+}
+
+static void SV_IndexEdict(edict_t * ent)
+{
+    clusterlink_t * link;
+    int entnum, cluster;
+    int i, l;
+
+    entnum = NUM_FOR_EDICT(ent);
+    if (entnum >= sv_numindexed)
+        return;
+
+    SV_UnindexEdict(entnum);
+
+    if (ent->num_clusters == -1 || (ent->s.renderfx & RF_BEAM))
+    {
+        sv_alwaysvisible[entnum >> 3] |= 1 << (entnum & 7);
+        return;
+    }
+
+    for (i = 0; i < ent->num_clusters; i++)
+    {
+        cluster = ent->clusternums[i];
+        if (cluster < 0 || cluster >= sv_numclusterheads)
+            continue;
+
+        l = entnum * MAX_ENT_CLUSTERS + sv_entnumclusters[entnum]++;
+        link = &sv_clusterlinks[l];
+        link->cluster = cluster;
+        link->prev = -1;
+        link->next = sv_clusterheads[cluster];
+        if (link->next != -1)
+            sv_clusterlinks[link->next].prev = l;
+        sv_clusterheads[cluster] = l;
+    }
+}
+
+/*
+===============
+SV_ClusterEntities
+
+Sets the bit in entbits for every edict that touches a cluster set in pvs,
+plus all the edicts that must always be tested. Stale entries are harmless,
+the caller still performs the exact visibility tests on each candidate.
+===============
+*/
+void SV_ClusterEntities(const byte * pvs, byte * entbits)
+{
+    int i, cluster;
+    int l;
+
+    memcpy(entbits, sv_alwaysvisible, MAX_EDICTS / 8);
+
+    for (i = 0; i < sv_numclusterheads; i += 8)
+    {
+        if (!pvs[i >> 3])
+            continue; // skip a whole byte of hidden clusters
+
+        for (cluster = i; cluster < i + 8 && cluster < sv_numclusterheads; cluster++)
+        {
+            if (!(pvs[cluster >> 3] & (1 << (cluster & 7))))
+                continue;
+
+            for (l = sv_clusterheads[cluster]; l != -1; l = sv_clusterlinks[l].next)
+            {
+                const int entnum = l / MAX_ENT_CLUSTERS;
+                entbits[entnum >> 3] |= 1 << (entnum & 7);
+            }
+        }
+    }
+}
+
 /*
 ===============
 SV_ClearWorld
@@ -138,6 +297,7 @@ void SV_ClearWorld(void)
     memset(sv_areanodes, 0, sizeof(sv_areanodes));
     sv_numareanodes = 0;
     SV_CreateAreaNode(0, sv.models[1]->mins, sv.models[1]->maxs);
+    SV_ClearClusterIndex();
 }
 
 /*
@@ -315,6 +475,8 @@ void SV_LinkEdict(edict_t * ent)
         }
     }
 
+    SV_IndexEdict(ent);
+
     // if first time, make sure old_origin is valid
     if (!ent->linkcount)
     {
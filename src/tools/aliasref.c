@@ -0,0 +1,424 @@
+
+/*
+ * Command line check of the VU1 alias model path of src/ps2/vu1_alias.c,
+ * the VIF stream the renderer sends and the C reference of alias_lerp.vsm.
+ *
+ * Makes random models (two keyframes of 8-bit vertexes with their scale,
+ * translate and normal indexes, and strips of them, some longer than a
+ * batch) and draws them as PS2_DrawAliasMD2Model does: VU1_AliasSetupConsts,
+ * the stream of VU1_AliasStripToStream cut by VU1_AliasBuildBatch, each
+ * batch run through VU1_AliasRunVIF on a VU memory image that has the
+ * normals table from VU1_AliasSetupNormals. Then checks every vertex of
+ * every batch against the math done here in double precision:
+ *  - the position, decompressing both frames and lerping them, as ref_gl
+ *    does, so the lerp folded into the constants is checked too; then the
+ *    MVP transform and the 12:4 screen position;
+ *  - the color, ambient plus the diffuse light by the front frame normal,
+ *    clamped to 255, and the alpha;
+ *  - the ADC bit, set on the first two vertexes of a strip and on the
+ *    vertexes that close a triangle with a corner out of the clip volume;
+ *  - the GIF tag and vertex count of the batch, alpha blending on for the
+ *    translucent models only, and that batches only start on a strip and
+ *    cover all of the stream.
+ *
+ * Prints the largest differences and exits with a failure status if any
+ * goes over the tolerances below.
+ *
+ * Build with:
+ * cc -I.. aliasref.c ../ps2/vu1_alias.c -lm -o aliasref
+ * ./aliasref [num_models] [seed]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "ps2/vu1_alias.h"
+
+#define DEFAULT_NUM_MODELS 300
+
+// Largest X/Y difference, in 12:4 units, and relative Z difference.
+#define POSITION_TOLERANCE 2.0
+#define Z_TOLERANCE 1e-4
+
+// Colors are truncated to int, float and double can land either side.
+#define COLOR_TOLERANCE 1
+
+// Vertexes and strips of the random models.
+#define MAX_MODEL_XYZ 512
+#define MAX_STRIPS 24
+#define MAX_STRIP_LEN 600
+
+// The table VU1_AliasSetupNormals uploads, as in common.c.
+vec3_t bytedirs[NUMVERTEXNORMALS] =
+{
+#include "client/anorms.h"
+};
+
+static ps2_vu_qword_t vu_mem[VU1_MEM_QWORDS];
+static u32 vif_buffer[VU1_ALIAS_MAX_VIF_QW * 4] __attribute__((aligned(16)));
+
+typedef struct
+{
+    float scale[3];
+    float translate[3];
+    dtrivertx_t verts[MAX_MODEL_XYZ];
+} frame_t;
+
+typedef struct
+{
+    int models;
+    int batches;
+    int vertexes;
+    int clipped;
+    int errors;
+    double max_pos_error;
+    double max_z_error;
+    int max_color_error;
+} totals_t;
+
+static float rand_range(float lo, float hi)
+{
+    return lo + (hi - lo) * ((float)rand() / (float)RAND_MAX);
+}
+
+// Row-vector perspective like Mat4_MakePerspProjection, clip X/Y range
+// of the 4096x4096 guard band, Z = W at the near plane, after moving
+// the model to 'origin' in view space.
+static void make_mvp(m_mat4_t * m, const float * origin)
+{
+    const float z_near = 4.0f;
+    const float z_far  = 4096.0f;
+    const float guard  = 4096.0f / 640.0f;
+
+    memset(m, 0, sizeof(*m));
+    m->m[0][0] = 1.0f / guard;
+    m->m[1][1] = 1.0f / guard;
+    m->m[2][2] = (z_far + z_near) / (z_far - z_near);
+    m->m[2][3] = 1.0f;
+    m->m[3][0] = origin[0] / guard;
+    m->m[3][1] = origin[1] / guard;
+    m->m[3][2] = origin[2] * m->m[2][2] - 2.0f * z_far * z_near / (z_far - z_near);
+    m->m[3][3] = origin[2];
+}
+
+static void make_frame(frame_t * frame, int num_xyz)
+{
+    int i, j;
+    for (j = 0; j < 3; ++j)
+    {
+        frame->scale[j]     = rand_range(0.02f, 1.0f);
+        frame->translate[j] = rand_range(-128.0f, 0.0f);
+    }
+    for (i = 0; i < num_xyz; ++i)
+    {
+        for (j = 0; j < 3; ++j)
+        {
+            frame->verts[i].v[j] = rand() & 0xFF;
+        }
+        frame->verts[i].lightnormalindex = rand() % NUMVERTEXNORMALS;
+    }
+}
+
+// Position of a vertex in clip space, lerped between the decompressed frames as ref_gl does.
+static void ref_clip_pos(const m_mat4_t * mvp, const frame_t * front, const frame_t * back,
+                         float backlerp, int xyz, double * clip)
+{
+    double pos[3];
+    int j;
+    for (j = 0; j < 3; ++j)
+    {
+        const double f = front->verts[xyz].v[j] * (double)front->scale[j] + front->translate[j];
+        const double b = back->verts[xyz].v[j] * (double)back->scale[j] + back->translate[j];
+        pos[j] = f * (1.0 - backlerp) + b * backlerp;
+    }
+    for (j = 0; j < 4; ++j)
+    {
+        clip[j] = mvp->m[0][j] * pos[0] + mvp->m[1][j] * pos[1] + mvp->m[2][j] * pos[2] + mvp->m[3][j];
+    }
+}
+
+static qboolean is_outside(const double * clip, qboolean * on_plane)
+{
+    const double w = fabs(clip[3]);
+    qboolean outside = false;
+    int k;
+    for (k = 0; k < 3; ++k)
+    {
+        outside   |= (clip[k] > w || clip[k] < -w);
+        *on_plane |= fabs(fabs(clip[k]) - w) < 1e-4 * w + 1e-3;
+    }
+    return outside;
+}
+
+// Checks one batch already run on vu_mem. 'xyz' is the part of the stream it drew.
+static void check_batch(const char * name, const m_mat4_t * mvp, const frame_t * front, const frame_t * back,
+                        float backlerp, const float * light_dir, const float * ambient, const float * diffuse,
+                        float alpha, qboolean blend, const u16 * xyz, int n, totals_t * totals)
+{
+    static const double scales[3] = { 2048.0, 2048.0, (double)0xFFFFFF / 32.0 };
+
+    qboolean outside[VU1_ALIAS_MAX_VERTS];
+    qboolean on_plane[VU1_ALIAS_MAX_VERTS];
+    int v, j;
+
+    if (vu_mem[4].i[3] != n || (int)(vu_mem[11].u[0] & 0x7FFF) != n || !(vu_mem[11].u[0] & 0x8000))
+    {
+        printf("%s: batch of %d has vertex count %d, GIF tag NLOOP %u EOP %u\n", name, n,
+               vu_mem[4].i[3], vu_mem[11].u[0] & 0x7FFF, (vu_mem[11].u[0] >> 15) & 1);
+        ++totals->errors;
+    }
+    // PRIM is at bit 47 of the tag, ABE is its bit 6.
+    if ((qboolean)((vu_mem[11].u[1] >> 21) & 1) != blend)
+    {
+        printf("%s: batch of %d has alpha blending %s\n", name, n, blend ? "off" : "on");
+        ++totals->errors;
+    }
+
+    for (v = 0; v < n; ++v)
+    {
+        const int index = xyz[v] & ~VU1_ALIAS_STRIP_START;
+        const ps2_vu_qword_t * rgba = &vu_mem[VU1_ALIAS_START_VERT + v * 2];
+        const ps2_vu_qword_t * pos  = rgba + 1;
+
+        double clip[4];
+        ref_clip_pos(mvp, front, back, backlerp, index, clip);
+        on_plane[v] = false;
+        outside[v]  = is_outside(clip, &on_plane[v]);
+
+        //
+        // ADC, a clipped triangle or the start of a strip:
+        //
+        const qboolean start = (xyz[v] & VU1_ALIAS_STRIP_START) != 0;
+        qboolean expected_adc = start;
+        qboolean near_plane   = false;
+        for (j = 0; j < 3 && v - j >= 0; ++j)
+        {
+            expected_adc |= outside[v - j];
+            near_plane   |= on_plane[v - j];
+        }
+        const qboolean adc = (pos->i[3] & 0x8000) != 0;
+        if (adc != expected_adc && !(near_plane && !start))
+        {
+            if (totals->errors++ < 10)
+            {
+                printf("%s: vertex %d ADC %d, expected %d\n", name, v, adc, expected_adc);
+            }
+        }
+        totals->clipped += (expected_adc && !start) ? 1 : 0;
+
+        //
+        // Color, by the normal of the front frame:
+        //
+        const float * normal = bytedirs[front->verts[index].lightnormalindex];
+        double dot = (double)normal[0] * light_dir[0] + (double)normal[1] * light_dir[1] + (double)normal[2] * light_dir[2];
+        if (dot < 0.0)
+        {
+            dot = 0.0;
+        }
+        for (j = 0; j < 4; ++j)
+        {
+            double color = (j < 3) ? ambient[j] + diffuse[j] * dot : alpha;
+            if (j < 3 && color > 255.0)
+            {
+                color = 255.0;
+            }
+            const int error = abs(rgba->i[j] - (int)color);
+            if (error > totals->max_color_error)
+            {
+                totals->max_color_error = error;
+            }
+            if (error > COLOR_TOLERANCE)
+            {
+                if (totals->errors++ < 10)
+                {
+                    printf("%s: vertex %d color[%d] %d, expected %.2f\n", name, v, j, rgba->i[j], color);
+                }
+            }
+        }
+
+        //
+        // Screen position, where it gets drawn:
+        //
+        if (outside[v])
+        {
+            continue;
+        }
+        const double q = 1.0 / clip[3];
+        for (j = 0; j < 3; ++j)
+        {
+            const double expected = (scales[j] + clip[j] * q * scales[j]) * 16.0;
+            const double error = fabs(pos->i[j] - expected);
+            if (j < 2)
+            {
+                if (error > totals->max_pos_error)
+                {
+                    totals->max_pos_error = error;
+                }
+                if (error > POSITION_TOLERANCE)
+                {
+                    if (totals->errors++ < 10)
+                    {
+                        printf("%s: vertex %d %c at %d, expected %.2f\n", name, v, "XY"[j], pos->i[j], expected);
+                    }
+                }
+            }
+            else
+            {
+                const double relative = error / expected;
+                if (relative > totals->max_z_error)
+                {
+                    totals->max_z_error = relative;
+                }
+                if (relative > Z_TOLERANCE)
+                {
+                    if (totals->errors++ < 10)
+                    {
+                        printf("%s: vertex %d Z at %d, expected %.2f\n", name, v, pos->i[j], expected);
+                    }
+                }
+            }
+        }
+    }
+
+    totals->vertexes += n;
+}
+
+static void check_model(int model, totals_t * totals)
+{
+    static frame_t front, back;
+    static int strip[MAX_STRIP_LEN];
+    static int identity[MAX_MODEL_XYZ];
+    static u16 xyz[MAX_STRIPS * MAX_STRIP_LEN * 2];
+
+    char name[64];
+    int i, j;
+
+    snprintf(name, sizeof(name), "model %d", model);
+
+    //
+    // Two random keyframes and strips of their vertexes:
+    //
+    const int num_xyz = 3 + rand() % (MAX_MODEL_XYZ - 3);
+    make_frame(&front, num_xyz);
+    make_frame(&back, num_xyz);
+
+    int num_vu_xyz = 0;
+    const int num_strips = 1 + rand() % MAX_STRIPS;
+    for (i = 0; i < num_strips; ++i)
+    {
+        const int len = 3 + ((rand() & 7) ? rand() % 40 : rand() % (MAX_STRIP_LEN - 3));
+        for (j = 0; j < len; ++j)
+        {
+            identity[j % MAX_MODEL_XYZ] = j % MAX_MODEL_XYZ;
+            strip[j] = rand() % num_xyz;
+        }
+        num_vu_xyz += VU1_AliasStripToStream(xyz + num_vu_xyz, strip, identity, len);
+    }
+
+    //
+    // Somewhere around the view, some of it out of the clip volume
+    // or behind the near plane, and lit as the renderer does:
+    //
+    float origin[3];
+    origin[2] = (model % 8 == 0) ? rand_range(-100.0f, 200.0f) : rand_range(200.0f, 1500.0f);
+    origin[0] = rand_range(-1.1f, 1.1f) * origin[2] * (4096.0f / 640.0f);
+    origin[1] = rand_range(-1.1f, 1.1f) * origin[2] * (4096.0f / 640.0f);
+
+    m_mat4_t mvp;
+    make_mvp(&mvp, origin);
+
+    const float backlerp = (model % 4 == 0) ? 0.0f : ((model % 4 == 1) ? 1.0f : rand_range(0.0f, 1.0f));
+
+    vec3_t light_dir = { rand_range(-1.0f, 1.0f), rand_range(-1.0f, 1.0f), 1.0f };
+    const float length = sqrtf(DotProduct(light_dir, light_dir));
+    for (j = 0; j < 3; ++j)
+    {
+        light_dir[j] /= length;
+    }
+
+    // Shaded, red shell and fullbright, with the renderer's colors.
+    float ambient[3], diffuse[3];
+    for (j = 0; j < 3; ++j)
+    {
+        switch (model % 3)
+        {
+        case 0  : ambient[j] = 64.0f;  diffuse[j] = 128.0f; break;
+        case 1  : ambient[j] = (j == 0) ? 64.0f : 0.0f; diffuse[j] = (j == 0) ? 255.0f : 0.0f; break;
+        default : ambient[j] = 128.0f; diffuse[j] = 0.0f;   break;
+        }
+    }
+    // Every other one translucent, as the shells.
+    const qboolean blend = (model & 1) != 0;
+    const float alpha = blend ? 0.3f * 128.0f : 128.0f;
+
+    ps2_vu_alias_consts_t consts;
+    VU1_AliasSetupConsts(&consts, &mvp, front.scale, front.translate, back.scale, back.translate,
+                         backlerp, light_dir, ambient, diffuse, alpha, blend);
+
+    //
+    // Batches as in PS2_DrawAliasMD2Model:
+    //
+    int done = 0;
+    while (done < num_vu_xyz)
+    {
+        int vif_qw;
+        const u16 * batch = xyz + done;
+        const int n = VU1_AliasBuildBatch(vif_buffer, &vif_qw, &consts, front.verts, back.verts,
+                                          batch, num_vu_xyz - done);
+
+        if (!(batch[0] & VU1_ALIAS_STRIP_START) || (done > 0 && (batch[-1] & VU1_ALIAS_STRIP_START)))
+        {
+            printf("%s: batch starts at stream entry %d, in the middle of a strip\n", name, done);
+            ++totals->errors;
+        }
+        if (n <= 0 || n > VU1_ALIAS_MAX_VERTS || vif_qw > VU1_ALIAS_MAX_VIF_QW)
+        {
+            printf("%s: batch of %d vertexes in %d qwords\n", name, n, vif_qw);
+            ++totals->errors;
+            break;
+        }
+        if (!VU1_AliasRunVIF(vu_mem, vif_buffer, vif_qw))
+        {
+            printf("%s: VIF stream not understood\n", name);
+            ++totals->errors;
+            break;
+        }
+
+        check_batch(name, &mvp, &front, &back, backlerp, light_dir, ambient, diffuse, alpha, blend,
+                    batch, n, totals);
+
+        done += n;
+        ++totals->batches;
+    }
+
+    ++totals->models;
+}
+
+int main(int argc, const char * argv[])
+{
+    int i;
+    const int num_models = (argc > 1) ? atoi(argv[1]) : DEFAULT_NUM_MODELS;
+    srand((argc > 2) ? (unsigned)atoi(argv[2]) : 1234u);
+
+    // Uploaded once, as SetVUProg does. Batches leave the rest of the memory as it was.
+    memset(vu_mem, 0, sizeof(vu_mem));
+    VU1_AliasSetupNormals((m_vec4_t *)&vu_mem[VU1_ALIAS_NORMALS]);
+
+    totals_t totals;
+    memset(&totals, 0, sizeof(totals));
+
+    for (i = 0; i < num_models; ++i)
+    {
+        check_model(i, &totals);
+    }
+
+    printf("%d models, %d batches, %d vertexes (%d closing a clipped triangle)\n",
+           totals.models, totals.batches, totals.vertexes, totals.clipped);
+    printf("max position error %.3f (12:4 units), max Z error %.2e, max color error %d\n",
+           totals.max_pos_error, totals.max_z_error, totals.max_color_error);
+    printf("%d errors\n", totals.errors);
+
+    return (totals.errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
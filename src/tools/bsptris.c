@@ -0,0 +1,273 @@
+
+/*
+ * Offline triangulation of the world polygons of Quake 2 maps, so the
+ * PS2 loader doesn't have to run the ear clipper on every face of the
+ * world on each map load (see src/ps2/world_tris.h for the file format).
+ *
+ * For each .bsp given (extract them from the pak with unpak first), writes
+ * a <name>.tri next to it, which then goes into the game's maps/ directory.
+ * The triangles are made by the same code the loader uses when there's no
+ * cache, so drawing is the same with or without one.
+ *
+ * Also prints what loading the map saves: the time the triangulation
+ * takes against validating the cache and copying its indexes, which is
+ * what the loader does instead (FS_LoadFile of the .tri not included).
+ * These are host timings, the ratio is what carries over to the EE;
+ * 'Load FACES' in the renderer stats has the times on the PS2.
+ *
+ * Build with:
+ * cc -O2 -I.. bsptris.c ../ps2/world_tris.c -lm -o bsptris
+ * ./bsptris base1.bsp [base2.bsp ...]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "ps2/world_tris.h"
+#include "common/q_files.h"
+
+// Runs of each to time, the best one is printed.
+#define TIMING_RUNS 10
+
+typedef struct
+{
+    int faces;
+    int polys;       // Non warped faces
+    int triangles;
+    int broken;      // Polygons the ear clipper couldn't finish
+    double triangulate_ms;
+    double cache_ms;
+} bsp_stats_t;
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+static void * load_file(const char * filename, int * file_len)
+{
+    FILE * fd = fopen(filename, "rb");
+    if (fd == NULL)
+    {
+        fprintf(stderr, "Can't fopen() the file! %s\n", filename);
+        return NULL;
+    }
+
+    fseek(fd, 0, SEEK_END);
+    *file_len = (int)ftell(fd);
+    fseek(fd, 0, SEEK_SET);
+
+    void * data = malloc(*file_len);
+    if (fread(data, 1, *file_len, fd) != (size_t)*file_len)
+    {
+        fprintf(stderr, "Failed to read '%s'!\n", filename);
+        free(data);
+        data = NULL;
+    }
+
+    fclose(fd);
+    return data;
+}
+
+// Triangulates all the faces that get a single polygon, as BMod_TriangulateSurface
+// does without a cache. 'indexes' gets PS2_WorldTrisCount entries, null to only time it.
+static qboolean triangulate_bsp(const byte * bsp, byte * indexes, bsp_stats_t * stats)
+{
+    const dheader_t * header     = (const dheader_t *)bsp;
+    const dvertex_t * vertexes   = (const dvertex_t *)(bsp + header->lumps[LUMP_VERTEXES].fileofs);
+    const dedge_t * edges        = (const dedge_t *)(bsp + header->lumps[LUMP_EDGES].fileofs);
+    const int * surf_edges       = (const int *)(bsp + header->lumps[LUMP_SURFEDGES].fileofs);
+    const dface_t * faces        = (const dface_t *)(bsp + header->lumps[LUMP_FACES].fileofs);
+    const textureinfo_t * infos  = (const textureinfo_t *)(bsp + header->lumps[LUMP_TEXINFO].fileofs);
+    const int num_faces          = header->lumps[LUMP_FACES].filelen / sizeof(dface_t);
+
+    vec3_t positions[WORLD_TRIS_MAX_VERTS];
+    u16 tris[(WORLD_TRIS_MAX_VERTS - 2) * 3];
+
+    int f, i;
+    memset(stats, 0, sizeof(*stats));
+    stats->faces = num_faces;
+
+    for (f = 0; f < num_faces; ++f)
+    {
+        const int num_verts = faces[f].numedges;
+        if ((infos[faces[f].texinfo].flags & SURF_WARP) || num_verts < 3)
+        {
+            continue;
+        }
+        if (num_verts > WORLD_TRIS_MAX_VERTS)
+        {
+            fprintf(stderr, "Face %d has %d vertexes, more than WORLD_TRIS_MAX_VERTS!\n", f, num_verts);
+            return false;
+        }
+
+        // Same vertex order as BMod_BuildPolygonFromSurface:
+        for (i = 0; i < num_verts; ++i)
+        {
+            const int index = surf_edges[faces[f].firstedge + i];
+            const float * point = (index > 0) ? vertexes[edges[index].v[0]].point : vertexes[edges[-index].v[1]].point;
+            VectorCopy(point, positions[i]);
+        }
+
+        const int num_triangles  = num_verts - 2;
+        const int triangles_done = PS2_TriangulatePolygon(positions, num_verts, tris);
+
+        stats->polys     += 1;
+        stats->triangles += num_triangles;
+        stats->broken    += (triangles_done != num_triangles) ? 1 : 0;
+
+        if (indexes != NULL)
+        {
+            for (i = 0; i < num_triangles * 3; ++i)
+            {
+                *indexes++ = (i < triangles_done * 3) ? (byte)tris[i] : 0;
+            }
+        }
+    }
+
+    return true;
+}
+
+// What the loader does with a cache: validates it, then copies the indexes to the polygons.
+static qboolean read_cache(const byte * bsp, const byte * tris_file, int tris_len, u16 * out)
+{
+    const byte * indexes = PS2_WorldTrisValidate(tris_file, tris_len, bsp);
+    if (indexes == NULL)
+    {
+        return false;
+    }
+
+    const int count = ((const world_tris_header_t *)tris_file)->num_indexes;
+    int i;
+    for (i = 0; i < count; ++i)
+    {
+        out[i] = indexes[i];
+    }
+    return true;
+}
+
+static qboolean process_bsp(const char * bsp_filename)
+{
+    int run, bsp_len;
+    byte * bsp = load_file(bsp_filename, &bsp_len);
+    if (bsp == NULL)
+    {
+        return false;
+    }
+
+    const dheader_t * header = (const dheader_t *)bsp;
+    if (bsp_len < (int)sizeof(dheader_t) || header->ident != IDBSPHEADER || header->version != BSPVERSION)
+    {
+        fprintf(stderr, "'%s' is not a Quake 2 BSP!\n", bsp_filename);
+        free(bsp);
+        return false;
+    }
+
+    const int num_indexes = PS2_WorldTrisCount(bsp);
+    if (num_indexes < 0)
+    {
+        fprintf(stderr, "'%s' has a face with a bad texinfo!\n", bsp_filename);
+        free(bsp);
+        return false;
+    }
+
+    const int tris_len = (int)sizeof(world_tris_header_t) + num_indexes;
+    byte * tris_file = malloc(tris_len);
+    u16 * copy = malloc((num_indexes + 1) * sizeof(u16));
+
+    world_tris_header_t * tris_header = (world_tris_header_t *)tris_file;
+    tris_header->ident       = WORLD_TRIS_IDENT;
+    tris_header->version     = WORLD_TRIS_VERSION;
+    tris_header->bsp_hash    = PS2_WorldTrisHash(bsp);
+    tris_header->num_faces   = header->lumps[LUMP_FACES].filelen / sizeof(dface_t);
+    tris_header->num_indexes = num_indexes;
+
+    bsp_stats_t stats;
+    qboolean ok = triangulate_bsp(bsp, tris_file + sizeof(world_tris_header_t), &stats);
+
+    // Load time with and without the cache:
+    stats.triangulate_ms = stats.cache_ms = 1e9;
+    for (run = 0; ok && run < TIMING_RUNS; ++run)
+    {
+        bsp_stats_t timing;
+        double start = now_ms();
+        triangulate_bsp(bsp, NULL, &timing);
+        double elapsed = now_ms() - start;
+        if (elapsed < stats.triangulate_ms)
+        {
+            stats.triangulate_ms = elapsed;
+        }
+
+        start = now_ms();
+        ok = read_cache(bsp, tris_file, tris_len, copy);
+        elapsed = now_ms() - start;
+        if (elapsed < stats.cache_ms)
+        {
+            stats.cache_ms = elapsed;
+        }
+    }
+
+    if (!ok)
+    {
+        fprintf(stderr, "Failed to make a valid cache for '%s'!\n", bsp_filename);
+    }
+    else
+    {
+        // maps/name.bsp => maps/name.tri
+        char tris_filename[1024];
+        snprintf(tris_filename, sizeof(tris_filename), "%s", bsp_filename);
+        char * ext = strrchr(tris_filename, '.');
+        if (ext == NULL || strchr(ext, '/') != NULL)
+        {
+            ext = tris_filename + strlen(tris_filename);
+        }
+        snprintf(ext, sizeof(tris_filename) - (ext - tris_filename), "%s", WORLD_TRIS_EXT);
+
+        FILE * fd = fopen(tris_filename, "wb");
+        if (fd == NULL || fwrite(tris_file, 1, tris_len, fd) != (size_t)tris_len)
+        {
+            fprintf(stderr, "Failed to write '%s'!\n", tris_filename);
+            ok = false;
+        }
+        if (fd != NULL)
+        {
+            fclose(fd);
+        }
+
+        if (ok)
+        {
+            printf("%s: %d faces, %d polygons, %d triangles (%d polygons broken), %d bytes\n",
+                   tris_filename, stats.faces, stats.polys, stats.triangles, stats.broken, tris_len);
+            printf("  triangulate %.3f ms, from the cache %.3f ms, %.1f%% of the time saved\n",
+                   stats.triangulate_ms, stats.cache_ms,
+                   (stats.triangulate_ms > 0.0) ? 100.0 * (1.0 - stats.cache_ms / stats.triangulate_ms) : 0.0);
+        }
+    }
+
+    free(copy);
+    free(tris_file);
+    free(bsp);
+    return ok;
+}
+
+int main(int argc, const char * argv[])
+{
+    int i, failed = 0;
+
+    if (argc < 2)
+    {
+        printf("Usage: %s <map.bsp> [map2.bsp ...]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    for (i = 1; i < argc; ++i)
+    {
+        failed += process_bsp(argv[i]) ? 0 : 1;
+    }
+
+    return (failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,317 @@
+
+/*
+ * Command line check of the 8 bit cinematic path of src/ps2/ref_ps2.c.
+ *
+ * PS2_DrawStretchRaw used to look every pixel up in the palette on the EE and
+ * upload a RGB16 texture. Now it only scales the indexes into a PSMT8 texture
+ * and PS2_CinematicSetPalette uploads the palette as a CSM1 CLUT, reordered
+ * with PS2_GS_CLUT_CSM1_INDEX, for the GS to look up when drawing.
+ *
+ * For frames of the sizes the game plays (and a few odd ones, with random
+ * palettes and pixels), this rebuilds the old RGB16 texture with the code
+ * PS2_DrawStretchRaw had before and the new index texture plus CLUT, then
+ * reads the new one back the way the GS does: for a PSMT8 texel the CSM1
+ * CLUT is a 16x16 CT32 block where each 32 colors take two rows of 16, the
+ * first row holding colors 0-7 and 16-23, the second 8-15 and 24-31 (GS
+ * User's Manual, CLUT storage mode). Every texel has to come out with the
+ * same RGB as the old RGB16 one, which only had the top 5 bits of each, so
+ * the 8 bits are compared shifted down. The alpha bit is left out, the
+ * cinematic is drawn with TEXTURE_COMPONENTS_RGB.
+ *
+ * The texture rows below a frame of less than 256 rows are drawn as well.
+ * They were RGB16 zero, black, and now get the darkest palette entry, which
+ * is the same black for palettes that have one (most of the ones made here
+ * do, as real cinematic palettes). With no black in the palette, they are
+ * only checked to be the darkest color.
+ *
+ * Build with:
+ * cc -I.. cinclut.c -o cinclut
+ * ./cinclut [num_frames] [seed]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "game/q_shared.h"
+#include "ps2/defs_ps2.h"
+
+// Same as ref_ps2.h, the cinematic texture is always 256x256.
+#define MAX_TEXIMAGE_SIZE 256
+
+typedef struct
+{
+    int cols;
+    int rows;
+} frame_size_t;
+
+static const frame_size_t frame_sizes[] = {
+    { 320, 240 }, // Quake 2 .cin files
+    { 256, 256 },
+    { 640, 480 }, // More rows than the texture, scaled down
+    { 17, 3 },
+    { 1, 1 }
+};
+
+/*
+ * PS2_CinematicSetPalette: game palette to RGBA, then the CLUT.
+ */
+static void expand_palette(const byte * palette, u32 * rgba)
+{
+    byte * dest = (byte *)rgba;
+    int i;
+
+    for (i = 0; i < 256; i++)
+    {
+        dest[(i * 4) + 0] = palette[(i * 3) + 0];
+        dest[(i * 4) + 1] = palette[(i * 3) + 1];
+        dest[(i * 4) + 2] = palette[(i * 3) + 2];
+        dest[(i * 4) + 3] = 0xFF;
+    }
+}
+
+static byte make_clut(const u32 * rgba, u32 * clut)
+{
+    int i, darkest = 3 * 255 + 1;
+    byte black_index = 0;
+
+    for (i = 0; i < 256; i++)
+    {
+        const u32 color = rgba[i];
+        const int sum = (color & 0xFF) + ((color >> 8) & 0xFF) + ((color >> 16) & 0xFF);
+        if (sum < darkest)
+        {
+            darkest = sum;
+            black_index = (byte)i;
+        }
+
+        clut[PS2_GS_CLUT_CSM1_INDEX(i)] = rgba[i];
+    }
+    return black_index;
+}
+
+/*
+ * PS2_DrawStretchRaw before the change: palette lookup and RGBA-16 pack per texel.
+ */
+static void old_stretch_raw(int cols, int rows, const byte * data, const u32 * rgba, u16 * texture)
+{
+    int i, j;
+    int row, trows;
+    int frac, fracstep;
+    float hscale;
+
+    const byte * source;
+    u16 * dest;
+
+    u32 color;
+    byte r, g, b, a;
+
+    if (rows <= MAX_TEXIMAGE_SIZE)
+    {
+        hscale = 1;
+        trows = rows;
+    }
+    else
+    {
+        hscale = (float)rows / (float)MAX_TEXIMAGE_SIZE;
+        trows = MAX_TEXIMAGE_SIZE;
+    }
+
+    memset(texture, 0, MAX_TEXIMAGE_SIZE * MAX_TEXIMAGE_SIZE * sizeof(u16));
+
+    for (i = 0; i < trows; i++)
+    {
+        row = (int)(i * hscale);
+        if (row > rows)
+        {
+            break;
+        }
+
+        source   = data + cols * row;
+        dest     = &texture[i * MAX_TEXIMAGE_SIZE];
+        fracstep = cols * 0x10000 / MAX_TEXIMAGE_SIZE;
+        frac     = fracstep >> 1;
+
+        for (j = 0; j < MAX_TEXIMAGE_SIZE; j++)
+        {
+            color = rgba[source[frac >> 16]];
+
+            r = (color & 0xFF);
+            g = (color >>  8) & 0xFF;
+            b = (color >> 16) & 0xFF;
+            a = (color >> 24) & 0xFF;
+
+            dest[j] = ((a & 0x1) << 15) | ((b >> 3) << 10) | ((g >> 3) << 5) | (r >> 3); // Pack RGBA-16
+            frac += fracstep;
+        }
+    }
+}
+
+/*
+ * PS2_DrawStretchRaw now: the indexes only.
+ */
+static void new_stretch_raw(int cols, int rows, const byte * data, byte black_index, byte * texture)
+{
+    int i, j;
+    int row, trows;
+    int frac, fracstep;
+    float hscale;
+
+    const byte * source;
+    byte * dest;
+
+    if (rows <= MAX_TEXIMAGE_SIZE)
+    {
+        hscale = 1;
+        trows = rows;
+    }
+    else
+    {
+        hscale = (float)rows / (float)MAX_TEXIMAGE_SIZE;
+        trows = MAX_TEXIMAGE_SIZE;
+    }
+
+    memset(texture, black_index, MAX_TEXIMAGE_SIZE * MAX_TEXIMAGE_SIZE);
+
+    fracstep = cols * 0x10000 / MAX_TEXIMAGE_SIZE;
+    for (i = 0; i < trows; i++)
+    {
+        row = (int)(i * hscale);
+        if (row > rows)
+        {
+            break;
+        }
+
+        source = data + cols * row;
+        dest   = &texture[i * MAX_TEXIMAGE_SIZE];
+        frac   = fracstep >> 1;
+
+        for (j = 0; j < MAX_TEXIMAGE_SIZE; j++)
+        {
+            dest[j] = source[frac >> 16];
+            frac += fracstep;
+        }
+    }
+}
+
+// Color the GS reads for a PSMT8 texel from a CSM1 CT32 CLUT uploaded as a 16x16 block.
+static u32 gs_clut_lookup(const u32 * clut, int index)
+{
+    const int group = index >> 5; // 32 colors per two rows of the block
+    const int entry = index & 31;
+    const int x = (entry & 7) + ((entry & 16) ? 8 : 0);
+    const int y = group * 2 + ((entry & 8) ? 1 : 0);
+    return clut[y * 16 + x];
+}
+
+// Compares the two textures of one frame. Returns the texels that differ.
+static int check_frame(int cols, int rows, int * no_black)
+{
+    static byte palette[256 * 3];
+    static u32 rgba[256];
+    static u32 clut[256];
+    static u16 old_texture[MAX_TEXIMAGE_SIZE * MAX_TEXIMAGE_SIZE];
+    static byte new_texture[MAX_TEXIMAGE_SIZE * MAX_TEXIMAGE_SIZE];
+
+    byte * data = malloc(cols * rows + 1);
+    int i, errors = 0;
+
+    for (i = 0; i < 256 * 3; i++)
+    {
+        palette[i] = rand() & 0xFF;
+    }
+    // Black somewhere in 3 of 4 palettes, the rest most likely have none.
+    const qboolean has_black = (rand() & 3) != 0;
+    if (has_black)
+    {
+        memset(&palette[(rand() & 0xFF) * 3], 0, 3);
+    }
+    else
+    {
+        *no_black += 1;
+    }
+    for (i = 0; i < cols * rows; i++)
+    {
+        data[i] = rand() & 0xFF;
+    }
+    // The old loop can read the first byte past the last row (row > rows, not >=).
+    data[cols * rows] = 0;
+
+    expand_palette(palette, rgba);
+    const byte black_index = make_clut(rgba, clut);
+
+    old_stretch_raw(cols, rows, data, rgba, old_texture);
+    new_stretch_raw(cols, rows, data, black_index, new_texture);
+
+    for (i = 0; i < MAX_TEXIMAGE_SIZE * MAX_TEXIMAGE_SIZE; i++)
+    {
+        const u32 color = gs_clut_lookup(clut, new_texture[i]);
+        const u16 old_rgb = old_texture[i] & 0x7FFF;
+
+        // Below the frame with no black to use, only the darkest color will do.
+        if (!has_black && (i / MAX_TEXIMAGE_SIZE) >= rows)
+        {
+            if (new_texture[i] != black_index)
+            {
+                errors++;
+            }
+            continue;
+        }
+
+        const u16 new_rgb = ((((color >> 16) & 0xFF) >> 3) << 10) |
+                            ((((color >>  8) & 0xFF) >> 3) << 5)  |
+                            (((color       ) & 0xFF) >> 3);
+        if (new_rgb != old_rgb)
+        {
+            if (errors++ == 0)
+            {
+                printf("%dx%d: texel %d (index %d) is %04X, the RGB16 one was %04X\n",
+                       cols, rows, i, new_texture[i], new_rgb, old_rgb);
+            }
+        }
+    }
+
+    free(data);
+    return errors;
+}
+
+int main(int argc, const char * argv[])
+{
+    const int num_frames = (argc > 1) ? atoi(argv[1]) : 50;
+    const unsigned seed = (argc > 2) ? (unsigned)atoi(argv[2]) : 1234;
+    const int num_sizes = (int)(sizeof(frame_sizes) / sizeof(frame_sizes[0]));
+    int i, frame, errors = 0, permuted = 0, no_black = 0;
+
+    srand(seed);
+
+    // The reorder has to be its own inverse and move exactly entries 8-15 and 16-23 of each 32.
+    for (i = 0; i < 256; i++)
+    {
+        const int moved = PS2_GS_CLUT_CSM1_INDEX(i) != i;
+        if (PS2_GS_CLUT_CSM1_INDEX(PS2_GS_CLUT_CSM1_INDEX(i)) != i || moved != ((i & 31) >= 8 && (i & 31) < 24))
+        {
+            printf("PS2_GS_CLUT_CSM1_INDEX(%d) = %d is not the CSM1 swap\n", i, PS2_GS_CLUT_CSM1_INDEX(i));
+            errors++;
+        }
+        permuted += moved;
+    }
+
+    for (i = 0; i < num_sizes; i++)
+    {
+        int size_errors = 0;
+        for (frame = 0; frame < num_frames; frame++)
+        {
+            size_errors += check_frame(frame_sizes[i].cols, frame_sizes[i].rows, &no_black);
+        }
+        printf("%4dx%-4d %d frames, %d texels differ\n",
+               frame_sizes[i].cols, frame_sizes[i].rows, num_frames, size_errors);
+        errors += size_errors;
+    }
+
+    printf("%d of 256 CLUT entries moved, %d palettes without black, %d errors\n", permuted, no_black, errors);
+    printf("upload per frame: %d bytes RGB16 before, %d bytes PSMT8 now (+%d for the CLUT when the palette changes)\n",
+           (int)(MAX_TEXIMAGE_SIZE * MAX_TEXIMAGE_SIZE * sizeof(u16)), MAX_TEXIMAGE_SIZE * MAX_TEXIMAGE_SIZE,
+           (int)(256 * sizeof(u32)));
+
+    return (errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,316 @@
+
+/*
+ * Command line microbenchmark of the batched frustum culling
+ * (src/ps2/frustum_cull.c) over all the node and leaf bounds of a map.
+ *
+ * Loads the nodes and leafs of a .bsp (extract it from the pak with
+ * unpak first), then for a number of random views inside the map tests
+ * every box with:
+ *  - BOX_ON_PLANE_SIDE, as PS2_ShouldCullBBox used to;
+ *  - PS2_FrustumCullBox, the scalar test with the precomputed signbits;
+ *  - PS2_FrustumCullBlocks, 4 boxes at a time (SSE on the host).
+ *
+ * Prints the time per view of each and exits with a failure status
+ * if any box comes out different from BOX_ON_PLANE_SIDE. The VU0 version
+ * is checked in the game with 'r_ps2_cull_bench 1'.
+ *
+ * Build with:
+ * cc -O2 -I.. cullbench.c ../ps2/frustum_cull.c -lm -o cullbench
+ * ./cullbench q2dm1.bsp [num_views]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "ps2/frustum_cull.h"
+#include "common/q_files.h"
+
+#define DEFAULT_NUM_VIEWS 1000
+
+// Same as the game at 640x480 (CalcFov).
+#define FOV_X 90.0f
+#define FOV_Y 73.739795f
+
+// q_shared.c has PS2 asm in it (math_funcs.h), so the few
+// functions needed here were just copied from it.
+void AngleVectors(const vec3_t angles, vec3_t forward, vec3_t right, vec3_t up)
+{
+    const float sy = sinf(angles[YAW]   * (M_PI * 2 / 360));
+    const float cy = cosf(angles[YAW]   * (M_PI * 2 / 360));
+    const float sp = sinf(angles[PITCH] * (M_PI * 2 / 360));
+    const float cp = cosf(angles[PITCH] * (M_PI * 2 / 360));
+    const float sr = sinf(angles[ROLL]  * (M_PI * 2 / 360));
+    const float cr = cosf(angles[ROLL]  * (M_PI * 2 / 360));
+
+    forward[0] = cp * cy;
+    forward[1] = cp * sy;
+    forward[2] = -sp;
+    right[0] = (-1 * sr * sp * cy + -1 * cr * -sy);
+    right[1] = (-1 * sr * sp * sy + -1 * cr * cy);
+    right[2] = -1 * sr * cp;
+    up[0] = (cr * sp * cy + -sr * -sy);
+    up[1] = (cr * sp * sy + -sr * cy);
+    up[2] = cr * cp;
+}
+
+int BoxOnPlaneSide(vec3_t emins, vec3_t emaxs, struct cplane_s * p)
+{
+    // Only non axial planes here. Corners as in the switch of the original.
+    const int bits = p->signbits;
+    float dist1, dist2;
+
+    dist1 = p->normal[0] * ((bits & 1) ? emins[0] : emaxs[0]) +
+            p->normal[1] * ((bits & 2) ? emins[1] : emaxs[1]) +
+            p->normal[2] * ((bits & 4) ? emins[2] : emaxs[2]);
+    dist2 = p->normal[0] * ((bits & 1) ? emaxs[0] : emins[0]) +
+            p->normal[1] * ((bits & 2) ? emaxs[1] : emins[1]) +
+            p->normal[2] * ((bits & 4) ? emaxs[2] : emins[2]);
+
+    int sides = 0;
+    if (dist1 >= p->dist)
+    {
+        sides = 1;
+    }
+    if (dist2 < p->dist)
+    {
+        sides |= 2;
+    }
+    return sides;
+}
+
+typedef struct
+{
+    float mins[3];
+    float maxs[3];
+} box_t;
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+static float rand_float(float lo, float hi)
+{
+    return lo + (hi - lo) * ((float)rand() / (float)RAND_MAX);
+}
+
+// Boxes of the nodes followed by the leafs, as the renderer sees them.
+static box_t * load_boxes(const char * filename, int * num_boxes)
+{
+    FILE * fd = fopen(filename, "rb");
+    if (fd == NULL)
+    {
+        fprintf(stderr, "Can't fopen() the file! %s\n", filename);
+        return NULL;
+    }
+
+    dheader_t header;
+    if (fread(&header, sizeof(header), 1, fd) != 1 || header.ident != IDBSPHEADER || header.version != BSPVERSION)
+    {
+        fprintf(stderr, "'%s' is not a Quake 2 BSP!\n", filename);
+        fclose(fd);
+        return NULL;
+    }
+
+    const int num_nodes = header.lumps[LUMP_NODES].filelen / sizeof(dnode_t);
+    const int num_leafs = header.lumps[LUMP_LEAFS].filelen / sizeof(dleaf_t);
+    box_t * boxes = malloc((num_nodes + num_leafs) * sizeof(box_t));
+    dnode_t * nodes = malloc(num_nodes * sizeof(dnode_t));
+    dleaf_t * leafs = malloc(num_leafs * sizeof(dleaf_t));
+
+    fseek(fd, header.lumps[LUMP_NODES].fileofs, SEEK_SET);
+    fread(nodes, sizeof(dnode_t), num_nodes, fd);
+    fseek(fd, header.lumps[LUMP_LEAFS].fileofs, SEEK_SET);
+    fread(leafs, sizeof(dleaf_t), num_leafs, fd);
+
+    if (ferror(fd))
+    {
+        fprintf(stderr, "Error reading the nodes and leafs of '%s'!\n", filename);
+        free(boxes);
+        boxes = NULL;
+    }
+    else
+    {
+        int i, j;
+        for (i = 0; i < num_nodes; ++i)
+        {
+            for (j = 0; j < 3; ++j)
+            {
+                boxes[i].mins[j] = nodes[i].mins[j];
+                boxes[i].maxs[j] = nodes[i].maxs[j];
+            }
+        }
+        for (i = 0; i < num_leafs; ++i)
+        {
+            for (j = 0; j < 3; ++j)
+            {
+                boxes[num_nodes + i].mins[j] = leafs[i].mins[j];
+                boxes[num_nodes + i].maxs[j] = leafs[i].maxs[j];
+            }
+        }
+        *num_boxes = num_nodes + num_leafs;
+        printf("%s: %d nodes, %d leafs.\n", filename, num_nodes, num_leafs);
+    }
+
+    free(nodes);
+    free(leafs);
+    fclose(fd);
+    return boxes;
+}
+
+// Same planes as PS2_SetUpFrustum in view_draw.c: forward rotated
+// towards +/-right and +/-up by 90 - fov/2 degrees, facing inwards.
+static void make_frustum(cplane_t planes[PS2_FRUSTUM_PLANES], const vec3_t origin, const vec3_t angles)
+{
+    vec3_t forward, right, up;
+    AngleVectors(angles, forward, right, up);
+
+    const float sx = sinf(FOV_X / 2.0f * (M_PI / 180.0));
+    const float cx = cosf(FOV_X / 2.0f * (M_PI / 180.0));
+    const float sy = sinf(FOV_Y / 2.0f * (M_PI / 180.0));
+    const float cy = cosf(FOV_Y / 2.0f * (M_PI / 180.0));
+
+    int i, j;
+    for (j = 0; j < 3; ++j)
+    {
+        planes[0].normal[j] = forward[j] * sx + right[j] * cx;
+        planes[1].normal[j] = forward[j] * sx - right[j] * cx;
+        planes[2].normal[j] = forward[j] * sy + up[j] * cy;
+        planes[3].normal[j] = forward[j] * sy - up[j] * cy;
+    }
+
+    for (i = 0; i < PS2_FRUSTUM_PLANES; ++i)
+    {
+        planes[i].type = PLANE_ANYZ;
+        planes[i].dist = DotProduct(origin, planes[i].normal);
+        planes[i].signbits = 0;
+        for (j = 0; j < 3; ++j)
+        {
+            if (planes[i].normal[j] < 0.0f)
+            {
+                planes[i].signbits |= 1 << j;
+            }
+        }
+    }
+}
+
+int main(int argc, const char * argv[])
+{
+    if (argc <= 1)
+    {
+        fprintf(stderr, "No filename!\n");
+        printf("Usage: \n"
+               " $ %s <file.bsp> [num_views]\n"
+               "   Times the frustum culling of all nodes and leafs of the map\n"
+               "   for num_views random views (default %d).\n",
+               argv[0], DEFAULT_NUM_VIEWS);
+        return EXIT_FAILURE;
+    }
+
+    int num_boxes = 0;
+    box_t * boxes = load_boxes(argv[1], &num_boxes);
+    if (boxes == NULL || num_boxes == 0)
+    {
+        return EXIT_FAILURE;
+    }
+
+    const int num_views  = (argc > 2) ? atoi(argv[2]) : DEFAULT_NUM_VIEWS;
+    const int num_blocks = PS2_CULL_NUM_BLOCKS(num_boxes);
+
+    ps2_cull_block_t * blocks = aligned_alloc(16, num_blocks * sizeof(ps2_cull_block_t));
+    memset(blocks, 0, num_blocks * sizeof(ps2_cull_block_t));
+
+    int i, v;
+    for (i = 0; i < num_boxes; ++i)
+    {
+        PS2_CullBlockSetBox(blocks, i, boxes[i].mins, boxes[i].maxs);
+    }
+
+    byte * culled_ref   = malloc(num_blocks * 4);
+    byte * culled_box   = malloc(num_blocks * 4);
+    byte * culled_block = aligned_alloc(16, num_blocks * 4);
+
+    // Views anywhere inside the bounds of the head node.
+    const box_t world = boxes[0];
+    double time_ref = 0.0, time_box = 0.0, time_block = 0.0;
+    long total_culled = 0;
+    int mismatches = 0;
+
+    srand(1234);
+    for (v = 0; v < num_views; ++v)
+    {
+        vec3_t origin, angles;
+        for (i = 0; i < 3; ++i)
+        {
+            origin[i] = rand_float(world.mins[i], world.maxs[i]);
+        }
+        angles[PITCH] = rand_float(-45.0f, 45.0f);
+        angles[YAW]   = rand_float(0.0f, 360.0f);
+        angles[ROLL]  = 0.0f;
+
+        cplane_t planes[PS2_FRUSTUM_PLANES];
+        ps2_frustum_t frustum;
+        make_frustum(planes, origin, angles);
+        PS2_FrustumSetPlanes(&frustum, planes);
+
+        double start = now_ms();
+        for (i = 0; i < num_boxes; ++i)
+        {
+            int p;
+            culled_ref[i] = 0;
+            for (p = 0; p < PS2_FRUSTUM_PLANES; ++p)
+            {
+                if (BOX_ON_PLANE_SIDE(boxes[i].mins, boxes[i].maxs, &planes[p]) == 2)
+                {
+                    culled_ref[i] = 1;
+                    break;
+                }
+            }
+        }
+        time_ref += now_ms() - start;
+
+        start = now_ms();
+        for (i = 0; i < num_boxes; ++i)
+        {
+            culled_box[i] = PS2_FrustumCullBox(&frustum, boxes[i].mins, boxes[i].maxs);
+        }
+        time_box += now_ms() - start;
+
+        start = now_ms();
+        PS2_FrustumCullBlocks(&frustum, blocks, num_blocks, culled_block);
+        time_block += now_ms() - start;
+
+        for (i = 0; i < num_boxes; ++i)
+        {
+            if (culled_box[i] != culled_ref[i] || culled_block[i] != culled_ref[i])
+            {
+                if (mismatches < 10)
+                {
+                    fprintf(stderr, "View %d box %d: BOX_ON_PLANE_SIDE %d, box %d, blocks %d\n",
+                            v, i, culled_ref[i], culled_box[i], culled_block[i]);
+                }
+                ++mismatches;
+            }
+            total_culled += culled_ref[i];
+        }
+    }
+
+    printf("%d views, %d boxes, %.1f%% culled.\n", num_views, num_boxes,
+           100.0 * total_culled / ((double)num_views * num_boxes));
+    printf("BOX_ON_PLANE_SIDE     %8.4f ms/view\n", time_ref / num_views);
+    printf("PS2_FrustumCullBox    %8.4f ms/view (%.2fx)\n", time_box / num_views, time_ref / time_box);
+    printf("PS2_FrustumCullBlocks %8.4f ms/view (%.2fx)\n", time_block / num_views, time_ref / time_block);
+    printf("%d mismatches.\n", mismatches);
+
+    free(culled_ref);
+    free(culled_box);
+    free(culled_block);
+    free(blocks);
+    free(boxes);
+    return (mismatches == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,351 @@
+
+/*
+ * Command line check of MSG_EncodeDeltaEntity in src/common/common.c, which
+ * encodes the packet entity deltas into a byte buffer the server can cache
+ * (sv_ents.c), against MSG_WriteDeltaEntity as it was before: the original
+ * Quake 2 writer, copied here, going through MSG_WriteByte and friends.
+ *
+ * common.c is compiled right into this program, so the encoder and the
+ * MSG_Write functions are the very ones the game uses. The linker drops
+ * the rest of the engine it would pull in; what Com_Error still needs is
+ * stubbed below.
+ *
+ * Every run makes a random pair of entity states, most fields the same in
+ * both as in the game, the others with values around each of the encoding
+ * thresholds (8/16/32 bit skins, effects and renderfx, 16 bit numbers,
+ * RF_BEAM, events), random force and newentity. Both writers must produce
+ * the same bytes, and the encoder no more than MAX_ENTITY_DELTA_BYTES.
+ * MSG_WriteDeltaEntity, now a wrapper of the encoder, is checked as well.
+ *
+ * Build with:
+ * cc -O2 -ffunction-sections -Wl,--gc-sections -I.. deltaref.c -lm -o deltaref
+ * ./deltaref [num_runs] [seed]
+ */
+
+#include "common/common.c"
+
+//
+// What Com_Error and Com_Printf reach, they never run here:
+//
+void Sys_Error(const char * error, ...) { fprintf(stderr, "Sys_Error: %s\n", error); exit(EXIT_FAILURE); }
+void Sys_ConsoleOutput(const char * string) { fputs(string, stdout); }
+void Con_Print(char * txt) { (void)txt; }
+void CL_Drop(void) { }
+void CL_Shutdown(void) { }
+void SV_Shutdown(char * finalmsg, qboolean reconnect) { (void)finalmsg; (void)reconnect; }
+char * FS_Gamedir(void) { return "."; }
+
+char * va(const char * format, ...)
+{
+    static char string[1024];
+    va_list argptr;
+    va_start(argptr, format);
+    vsnprintf(string, sizeof(string), format, argptr);
+    va_end(argptr);
+    return string;
+}
+
+/*
+ * MSG_WriteDeltaEntity before the change.
+ */
+static void old_write_delta(entity_state_t * from, entity_state_t * to, sizebuf_t * msg, qboolean force, qboolean newentity)
+{
+    int bits = 0;
+
+    if (to->number >= 256)
+        bits |= U_NUMBER16; // number8 is implicit otherwise
+
+    if (to->origin[0] != from->origin[0])
+        bits |= U_ORIGIN1;
+    if (to->origin[1] != from->origin[1])
+        bits |= U_ORIGIN2;
+    if (to->origin[2] != from->origin[2])
+        bits |= U_ORIGIN3;
+
+    if (to->angles[0] != from->angles[0])
+        bits |= U_ANGLE1;
+    if (to->angles[1] != from->angles[1])
+        bits |= U_ANGLE2;
+    if (to->angles[2] != from->angles[2])
+        bits |= U_ANGLE3;
+
+    if (to->skinnum != from->skinnum)
+    {
+        if ((unsigned)to->skinnum < 256)
+            bits |= U_SKIN8;
+        else if ((unsigned)to->skinnum < 0x10000)
+            bits |= U_SKIN16;
+        else
+            bits |= (U_SKIN8 | U_SKIN16);
+    }
+
+    if (to->frame != from->frame)
+    {
+        if (to->frame < 256)
+            bits |= U_FRAME8;
+        else
+            bits |= U_FRAME16;
+    }
+
+    if (to->effects != from->effects)
+    {
+        if (to->effects < 256)
+            bits |= U_EFFECTS8;
+        else if (to->effects < 0x8000)
+            bits |= U_EFFECTS16;
+        else
+            bits |= U_EFFECTS8 | U_EFFECTS16;
+    }
+
+    if (to->renderfx != from->renderfx)
+    {
+        if (to->renderfx < 256)
+            bits |= U_RENDERFX8;
+        else if (to->renderfx < 0x8000)
+            bits |= U_RENDERFX16;
+        else
+            bits |= U_RENDERFX8 | U_RENDERFX16;
+    }
+
+    if (to->solid != from->solid)
+        bits |= U_SOLID;
+
+    if (to->event)
+        bits |= U_EVENT;
+
+    if (to->modelindex != from->modelindex)
+        bits |= U_MODEL;
+    if (to->modelindex2 != from->modelindex2)
+        bits |= U_MODEL2;
+    if (to->modelindex3 != from->modelindex3)
+        bits |= U_MODEL3;
+    if (to->modelindex4 != from->modelindex4)
+        bits |= U_MODEL4;
+
+    if (to->sound != from->sound)
+        bits |= U_SOUND;
+
+    if (newentity || (to->renderfx & RF_BEAM))
+        bits |= U_OLDORIGIN;
+
+    if (!bits && !force)
+        return;
+
+    if (bits & 0xff000000)
+        bits |= U_MOREBITS3 | U_MOREBITS2 | U_MOREBITS1;
+    else if (bits & 0x00ff0000)
+        bits |= U_MOREBITS2 | U_MOREBITS1;
+    else if (bits & 0x0000ff00)
+        bits |= U_MOREBITS1;
+
+    MSG_WriteByte(msg, bits & 255);
+
+    if (bits & 0xff000000)
+    {
+        MSG_WriteByte(msg, (bits >> 8) & 255);
+        MSG_WriteByte(msg, (bits >> 16) & 255);
+        MSG_WriteByte(msg, (bits >> 24) & 255);
+    }
+    else if (bits & 0x00ff0000)
+    {
+        MSG_WriteByte(msg, (bits >> 8) & 255);
+        MSG_WriteByte(msg, (bits >> 16) & 255);
+    }
+    else if (bits & 0x0000ff00)
+    {
+        MSG_WriteByte(msg, (bits >> 8) & 255);
+    }
+
+    if (bits & U_NUMBER16)
+        MSG_WriteShort(msg, to->number);
+    else
+        MSG_WriteByte(msg, to->number);
+
+    if (bits & U_MODEL)
+        MSG_WriteByte(msg, to->modelindex);
+    if (bits & U_MODEL2)
+        MSG_WriteByte(msg, to->modelindex2);
+    if (bits & U_MODEL3)
+        MSG_WriteByte(msg, to->modelindex3);
+    if (bits & U_MODEL4)
+        MSG_WriteByte(msg, to->modelindex4);
+
+    if (bits & U_FRAME8)
+        MSG_WriteByte(msg, to->frame);
+    if (bits & U_FRAME16)
+        MSG_WriteShort(msg, to->frame);
+
+    if ((bits & U_SKIN8) && (bits & U_SKIN16))
+        MSG_WriteLong(msg, to->skinnum);
+    else if (bits & U_SKIN8)
+        MSG_WriteByte(msg, to->skinnum);
+    else if (bits & U_SKIN16)
+        MSG_WriteShort(msg, to->skinnum);
+
+    if ((bits & (U_EFFECTS8 | U_EFFECTS16)) == (U_EFFECTS8 | U_EFFECTS16))
+        MSG_WriteLong(msg, to->effects);
+    else if (bits & U_EFFECTS8)
+        MSG_WriteByte(msg, to->effects);
+    else if (bits & U_EFFECTS16)
+        MSG_WriteShort(msg, to->effects);
+
+    if ((bits & (U_RENDERFX8 | U_RENDERFX16)) == (U_RENDERFX8 | U_RENDERFX16))
+        MSG_WriteLong(msg, to->renderfx);
+    else if (bits & U_RENDERFX8)
+        MSG_WriteByte(msg, to->renderfx);
+    else if (bits & U_RENDERFX16)
+        MSG_WriteShort(msg, to->renderfx);
+
+    if (bits & U_ORIGIN1)
+        MSG_WriteCoord(msg, to->origin[0]);
+    if (bits & U_ORIGIN2)
+        MSG_WriteCoord(msg, to->origin[1]);
+    if (bits & U_ORIGIN3)
+        MSG_WriteCoord(msg, to->origin[2]);
+
+    if (bits & U_ANGLE1)
+        MSG_WriteAngle(msg, to->angles[0]);
+    if (bits & U_ANGLE2)
+        MSG_WriteAngle(msg, to->angles[1]);
+    if (bits & U_ANGLE3)
+        MSG_WriteAngle(msg, to->angles[2]);
+
+    if (bits & U_OLDORIGIN)
+    {
+        MSG_WriteCoord(msg, to->old_origin[0]);
+        MSG_WriteCoord(msg, to->old_origin[1]);
+        MSG_WriteCoord(msg, to->old_origin[2]);
+    }
+
+    if (bits & U_SOUND)
+        MSG_WriteByte(msg, to->sound);
+    if (bits & U_EVENT)
+        MSG_WriteByte(msg, to->event);
+    if (bits & U_SOLID)
+        MSG_WriteShort(msg, to->solid);
+}
+
+static float rand_range(float min, float max)
+{
+    return min + (max - min) * ((float)rand() / (float)RAND_MAX);
+}
+
+// Values on both sides of the 8, 16 and 32 bit encodings, and negative ones.
+static int random_field(void)
+{
+    switch (rand() & 7)
+    {
+    case 0  : return 0;
+    case 1  : return rand() & 255;
+    case 2  : return 255 + (rand() & 3);
+    case 3  : return rand() & 0xFFFF;
+    case 4  : return 0x7FFF + (rand() & 3);
+    case 5  : return 0xFFFF + (rand() & 3);
+    case 6  : return -(rand() & 0xFFFF);
+    default : return (rand() << 16) ^ rand();
+    }
+}
+
+static void random_state(entity_state_t * s)
+{
+    int i;
+
+    s->number = 1 + rand() % (MAX_EDICTS - 1);
+    for (i = 0; i < 3; ++i)
+    {
+        s->origin[i]     = rand_range(-4096.0f, 4096.0f);
+        s->angles[i]     = rand_range(-360.0f, 360.0f);
+        s->old_origin[i] = rand_range(-4096.0f, 4096.0f);
+    }
+    s->modelindex  = rand() & 255;
+    s->modelindex2 = rand() & 255;
+    s->modelindex3 = rand() & 255;
+    s->modelindex4 = rand() & 255;
+    s->frame       = random_field() & 0xFFFF;
+    s->skinnum     = random_field();
+    s->effects     = (unsigned)random_field();
+    s->renderfx    = random_field() | ((rand() & 7) == 0 ? RF_BEAM : 0);
+    s->solid       = random_field() & 0xFFFF;
+    s->sound       = rand() & 255;
+    s->event       = (rand() & 3) ? 0 : (rand() & 255);
+}
+
+// 'to' starts as a copy of 'from', then each field changes with a 1 in 4 chance.
+static void random_delta(const entity_state_t * from, entity_state_t * to)
+{
+    entity_state_t other;
+    int i;
+
+    random_state(&other);
+    *to = *from;
+    to->event = other.event;
+
+    #define MAYBE(field) if ((rand() & 3) == 0) { to->field = other.field; }
+    for (i = 0; i < 3; ++i)
+    {
+        MAYBE(origin[i]);
+        MAYBE(angles[i]);
+        MAYBE(old_origin[i]);
+    }
+    MAYBE(modelindex);
+    MAYBE(modelindex2);
+    MAYBE(modelindex3);
+    MAYBE(modelindex4);
+    MAYBE(frame);
+    MAYBE(skinnum);
+    MAYBE(effects);
+    MAYBE(renderfx);
+    MAYBE(solid);
+    MAYBE(sound);
+    #undef MAYBE
+}
+
+int main(int argc, const char * argv[])
+{
+    const int num_runs = (argc > 1) ? atoi(argv[1]) : 200000;
+    const unsigned seed = (argc > 2) ? (unsigned)atoi(argv[2]) : 1234;
+    int run, errors = 0, empty = 0, longest = 0;
+
+    static byte old_data[MAX_MSGLEN];
+    static byte wrap_data[MAX_MSGLEN];
+    byte encoded[MAX_ENTITY_DELTA_BYTES];
+    sizebuf_t old_msg, wrap_msg;
+
+    srand(seed);
+
+    for (run = 0; run < num_runs; ++run)
+    {
+        entity_state_t from, to;
+        random_state(&from);
+        random_delta(&from, &to);
+
+        const qboolean force     = (rand() & 3) == 0;
+        const qboolean newentity = (rand() & 3) == 0;
+
+        SZ_Init(&old_msg, old_data, sizeof(old_data));
+        SZ_Init(&wrap_msg, wrap_data, sizeof(wrap_data));
+
+        old_write_delta(&from, &to, &old_msg, force, newentity);
+        MSG_WriteDeltaEntity(&from, &to, &wrap_msg, force, newentity);
+        const int len = MSG_EncodeDeltaEntity(&from, &to, encoded, force, newentity);
+
+        if (len > MAX_ENTITY_DELTA_BYTES || len != old_msg.cursize || memcmp(encoded, old_data, len) != 0 ||
+            wrap_msg.cursize != old_msg.cursize || memcmp(wrap_data, old_data, old_msg.cursize) != 0)
+        {
+            if (errors++ < 10)
+            {
+                printf("run %d: entity %d, old writer %d bytes, encoder %d, MSG_WriteDeltaEntity %d\n",
+                       run, to.number, old_msg.cursize, len, wrap_msg.cursize);
+            }
+        }
+
+        empty  += (len == 0);
+        longest = (len > longest) ? len : longest;
+    }
+
+    printf("%d state pairs, seed %u: %d with nothing to send, longest delta %d bytes (max %d)\n",
+           num_runs, seed, empty, longest, MAX_ENTITY_DELTA_BYTES);
+    printf("%d errors\n", errors);
+
+    return (errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
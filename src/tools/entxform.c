@@ -0,0 +1,380 @@
+
+/*
+ * Command line check of the entity transforms (src/ps2/ent_xform.c)
+ * used to draw the brush and alias models, over random placements:
+ *  - the model matrix against R_DrawBrushModel's rotations (ref_gl),
+ *    rebuilt here in double precision;
+ *  - the transformed bounds hold all 8 corners of the box and touch
+ *    each of their faces;
+ *  - PS2_EntXformPointToModel undoes the model matrix;
+ *  - PS2_EntXformCompare is a proper ordering;
+ *  - a box culled by PS2_FrustumCullBox with the transformed bounds
+ *    has all its corners outside of the frustum.
+ *
+ * Prints the largest errors and exits with a failure status if any
+ * check fails.
+ *
+ * Build with:
+ * cc -O2 -I.. entxform.c ../ps2/ent_xform.c ../ps2/frustum_cull.c -lm -o entxform
+ * ./entxform [num_tests]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "ps2/ent_xform.h"
+#include "ps2/frustum_cull.h"
+
+// math_funcs.h maps these to the PS2 single precision versions.
+#undef sin
+#undef cos
+
+#define DEFAULT_NUM_TESTS 100000
+
+// Map units. Coordinates go up to 4096, so a few float ulps.
+#define TOLERANCE 0.01
+
+static int failures = 0;
+static double max_matrix_error  = 0.0;
+static double max_inverse_error = 0.0;
+static double max_bounds_slack  = 0.0;
+
+// q_shared.c has PS2 asm in it (math_funcs.h), so this was just copied from it.
+void AngleVectors(const vec3_t angles, vec3_t forward, vec3_t right, vec3_t up)
+{
+    const float sy = sinf(angles[YAW]   * (M_PI * 2 / 360));
+    const float cy = cosf(angles[YAW]   * (M_PI * 2 / 360));
+    const float sp = sinf(angles[PITCH] * (M_PI * 2 / 360));
+    const float cp = cosf(angles[PITCH] * (M_PI * 2 / 360));
+    const float sr = sinf(angles[ROLL]  * (M_PI * 2 / 360));
+    const float cr = cosf(angles[ROLL]  * (M_PI * 2 / 360));
+
+    if (forward)
+    {
+        forward[0] = cp * cy;
+        forward[1] = cp * sy;
+        forward[2] = -sp;
+    }
+    if (right)
+    {
+        right[0] = (-1 * sr * sp * cy + -1 * cr * -sy);
+        right[1] = (-1 * sr * sp * sy + -1 * cr * cy);
+        right[2] = -1 * sr * cp;
+    }
+    if (up)
+    {
+        up[0] = (cr * sp * cy + -sr * -sy);
+        up[1] = (cr * sp * sy + -sr * cy);
+        up[2] = cr * cp;
+    }
+}
+
+static float rand_float(float lo, float hi)
+{
+    return lo + (hi - lo) * ((float)rand() / (float)RAND_MAX);
+}
+
+static void fail(int test, const char * what)
+{
+    if (failures < 10)
+    {
+        fprintf(stderr, "Test %d: %s\n", test, what);
+    }
+    ++failures;
+}
+
+// Rotation of 'degrees' around one axis, as glRotatef with a unit axis.
+static void rotate_axis(double v[3], int axis, double degrees)
+{
+    const double r = degrees * (M_PI / 180.0);
+    const double c = cos(r), s = sin(r);
+    const int a = (axis + 1) % 3;
+    const int b = (axis + 2) % 3;
+    const double va = v[a], vb = v[b];
+    v[a] = c * va - s * vb;
+    v[b] = s * va + c * vb;
+}
+
+// R_DrawBrushModel negates pitch and roll ("stupid quake bug"), then
+// R_RotateForEntity translates, rotates Z by yaw, Y by -pitch, X by -roll,
+// so the point goes through them in the reverse order.
+static void gl_transform(double out[3], const vec3_t origin, const vec3_t angles, const vec3_t p)
+{
+    out[0] = p[0];
+    out[1] = p[1];
+    out[2] = p[2];
+    rotate_axis(out, 0, angles[ROLL]);
+    rotate_axis(out, 1, angles[PITCH]);
+    rotate_axis(out, 2, angles[YAW]);
+    out[0] += origin[0];
+    out[1] += origin[1];
+    out[2] += origin[2];
+}
+
+// Row vector times the row-major matrix, as VU1 does it.
+static void matrix_transform(vec3_t out, const m_mat4_t * m, const vec3_t p)
+{
+    int i;
+    for (i = 0; i < 3; ++i)
+    {
+        out[i] = p[0] * m->m[0][i] + p[1] * m->m[1][i] + p[2] * m->m[2][i] + m->m[3][i];
+    }
+}
+
+static void random_placement(vec3_t origin, vec3_t angles)
+{
+    int i;
+    for (i = 0; i < 3; ++i)
+    {
+        origin[i] = rand_float(-4096.0f, 4096.0f);
+    }
+
+    // Some with no rotation at all, like most brush models.
+    if ((rand() & 3) == 0)
+    {
+        VectorClear(angles);
+    }
+    else
+    {
+        angles[PITCH] = rand_float(-180.0f, 180.0f);
+        angles[YAW]   = rand_float(0.0f, 360.0f);
+        angles[ROLL]  = rand_float(-180.0f, 180.0f);
+    }
+}
+
+static void random_box(vec3_t mins, vec3_t maxs)
+{
+    int i;
+    for (i = 0; i < 3; ++i)
+    {
+        const float a = rand_float(-512.0f, 512.0f);
+        const float b = rand_float(-512.0f, 512.0f);
+        mins[i] = (a < b) ? a : b;
+        maxs[i] = (a < b) ? b : a;
+    }
+}
+
+static void box_corner(vec3_t out, const vec3_t mins, const vec3_t maxs, int corner)
+{
+    out[0] = (corner & 1) ? maxs[0] : mins[0];
+    out[1] = (corner & 2) ? maxs[1] : mins[1];
+    out[2] = (corner & 4) ? maxs[2] : mins[2];
+}
+
+static void check_matrix(int test, const ps2_ent_xform_t * xform, const vec3_t origin, const vec3_t angles)
+{
+    m_mat4_t m;
+    PS2_EntXformMatrix(&m, xform);
+
+    int k, i;
+    for (k = 0; k < 4; ++k)
+    {
+        vec3_t p, out, back;
+        double expected[3];
+
+        p[0] = rand_float(-512.0f, 512.0f);
+        p[1] = rand_float(-512.0f, 512.0f);
+        p[2] = rand_float(-512.0f, 512.0f);
+
+        matrix_transform(out, &m, p);
+        gl_transform(expected, origin, angles, p);
+        PS2_EntXformPointToModel(xform, out, back);
+
+        for (i = 0; i < 3; ++i)
+        {
+            const double error   = fabs(out[i] - expected[i]);
+            const double inverse = fabs(back[i] - p[i]);
+            if (error > max_matrix_error)
+            {
+                max_matrix_error = error;
+            }
+            if (inverse > max_inverse_error)
+            {
+                max_inverse_error = inverse;
+            }
+            if (error > TOLERANCE)
+            {
+                fail(test, "model matrix differs from ref_gl");
+                return;
+            }
+            if (inverse > TOLERANCE)
+            {
+                fail(test, "PS2_EntXformPointToModel doesn't undo the matrix");
+                return;
+            }
+        }
+    }
+}
+
+static void check_bounds(int test, const ps2_ent_xform_t * xform, const vec3_t mins, const vec3_t maxs)
+{
+    m_mat4_t m;
+    PS2_EntXformMatrix(&m, xform);
+
+    vec3_t out_mins, out_maxs;
+    PS2_EntXformBounds(xform, mins, maxs, out_mins, out_maxs);
+
+    vec3_t lo = {  1e30f,  1e30f,  1e30f };
+    vec3_t hi = { -1e30f, -1e30f, -1e30f };
+
+    int c, i;
+    for (c = 0; c < 8; ++c)
+    {
+        vec3_t corner, out;
+        box_corner(corner, mins, maxs, c);
+        matrix_transform(out, &m, corner);
+        for (i = 0; i < 3; ++i)
+        {
+            lo[i] = (out[i] < lo[i]) ? out[i] : lo[i];
+            hi[i] = (out[i] > hi[i]) ? out[i] : hi[i];
+        }
+    }
+
+    for (i = 0; i < 3; ++i)
+    {
+        if (lo[i] < out_mins[i] - TOLERANCE || hi[i] > out_maxs[i] + TOLERANCE)
+        {
+            fail(test, "corner outside of the transformed bounds");
+            return;
+        }
+
+        const double slack = fmax(lo[i] - out_mins[i], out_maxs[i] - hi[i]);
+        if (slack > max_bounds_slack)
+        {
+            max_bounds_slack = slack;
+        }
+        if (slack > TOLERANCE)
+        {
+            fail(test, "transformed bounds larger than the corners");
+            return;
+        }
+    }
+}
+
+static void check_compare(int test, const ps2_ent_xform_t * a, const ps2_ent_xform_t * b)
+{
+    ps2_ent_xform_t copy = *a;
+
+    if (PS2_EntXformCompare(a, &copy) != 0)
+    {
+        fail(test, "transform not equal to itself");
+    }
+    if (PS2_EntXformCompare(a, b) != -PS2_EntXformCompare(b, a))
+    {
+        fail(test, "compare not antisymmetric");
+    }
+    if (!a->rotated && b->rotated && PS2_EntXformCompare(a, b) >= 0)
+    {
+        fail(test, "unrotated transform not sorted first");
+    }
+}
+
+// Frustum at a random place in the map, looking anywhere.
+static void random_frustum(ps2_frustum_t * frustum)
+{
+    vec3_t origin, angles, forward, right, up;
+    random_placement(origin, angles);
+    AngleVectors(angles, forward, right, up);
+
+    const float s = sinf(M_PI / 4.0), c = cosf(M_PI / 4.0);
+    cplane_t planes[PS2_FRUSTUM_PLANES];
+
+    int i, j;
+    for (j = 0; j < 3; ++j)
+    {
+        planes[0].normal[j] = forward[j] * s + right[j] * c;
+        planes[1].normal[j] = forward[j] * s - right[j] * c;
+        planes[2].normal[j] = forward[j] * s + up[j] * c;
+        planes[3].normal[j] = forward[j] * s - up[j] * c;
+    }
+    for (i = 0; i < PS2_FRUSTUM_PLANES; ++i)
+    {
+        planes[i].dist = DotProduct(origin, planes[i].normal);
+        planes[i].signbits = 0;
+        for (j = 0; j < 3; ++j)
+        {
+            if (planes[i].normal[j] < 0.0f)
+            {
+                planes[i].signbits |= 1 << j;
+            }
+        }
+    }
+
+    PS2_FrustumSetPlanes(frustum, planes);
+}
+
+static int check_cull(int test, const ps2_ent_xform_t * xform, const vec3_t mins, const vec3_t maxs)
+{
+    ps2_frustum_t frustum;
+    random_frustum(&frustum);
+
+    vec3_t out_mins, out_maxs;
+    PS2_EntXformBounds(xform, mins, maxs, out_mins, out_maxs);
+    if (!PS2_FrustumCullBox(&frustum, out_mins, out_maxs))
+    {
+        return 0;
+    }
+
+    m_mat4_t m;
+    PS2_EntXformMatrix(&m, xform);
+
+    int c, p;
+    for (c = 0; c < 8; ++c)
+    {
+        vec3_t corner, out;
+        box_corner(corner, mins, maxs, c);
+        matrix_transform(out, &m, corner);
+
+        int inside = 1;
+        for (p = 0; p < PS2_FRUSTUM_PLANES; ++p)
+        {
+            if (DotProduct(out, frustum.normals[p]) < frustum.dists[p] - TOLERANCE)
+            {
+                inside = 0;
+                break;
+            }
+        }
+        if (inside)
+        {
+            fail(test, "culled box has a corner in the frustum");
+            break;
+        }
+    }
+    return 1;
+}
+
+int main(int argc, const char * argv[])
+{
+    const int num_tests = (argc > 1) ? atoi(argv[1]) : DEFAULT_NUM_TESTS;
+    int t, culled = 0;
+
+    srand(1234);
+    ps2_ent_xform_t prev;
+    const vec3_t zero = { 0.0f, 0.0f, 0.0f };
+    PS2_EntXformSet(&prev, zero, zero);
+
+    for (t = 0; t < num_tests; ++t)
+    {
+        vec3_t origin, angles, mins, maxs;
+        random_placement(origin, angles);
+        random_box(mins, maxs);
+
+        ps2_ent_xform_t xform;
+        PS2_EntXformSet(&xform, origin, angles);
+
+        check_matrix(t, &xform, origin, angles);
+        check_bounds(t, &xform, mins, maxs);
+        check_compare(t, &xform, &prev);
+        culled += check_cull(t, &xform, mins, maxs);
+
+        prev = xform;
+    }
+
+    printf("%d placements, %d boxes culled.\n", num_tests, culled);
+    printf("Max matrix error %f, inverse error %f, bounds slack %f.\n",
+           max_matrix_error, max_inverse_error, max_bounds_slack);
+    printf("%d failures.\n", failures);
+    return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
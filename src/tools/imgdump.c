@@ -6,6 +6,12 @@
  * C-style arrays of bytes, so that they can be easily embedded
  * into a C program.
  *
+ * Images are stored as their 8-bit palette indexes, LZ compressed
+ * with src/common/lzss.c, the same coder the renderer unpacks and
+ * expands them with the first time they are used. Every image is
+ * decompressed again after packing and compared against the source
+ * pixels before it is written out.
+ *
  * This tool is hardcoded to look for a few Quake2 textures in
  * the CWD and dump them as arrays. These are then compiled into
  * the PS2 executable to make it standalone. We only do that for
@@ -13,7 +19,7 @@
  * others. Most of the code here was just copied from src/ps2/
  *
  * Build with:
- * cc imgdump.c -o imgdump
+ * cc -I.. imgdump.c ../common/lzss.c -o imgdump
  * ./imgdump
  */
 
@@ -23,6 +29,8 @@
 #include <string.h>
 #include <stdarg.h>
 
+#include "common/q_lzss.h"
+
 typedef unsigned int   u32;
 typedef unsigned short u16;
 typedef unsigned char  byte;
@@ -164,7 +172,7 @@ bool PCX_LoadFromMemory(const char * filename, const byte * data, int data_len,
     if (manufacturer != 0x0A || version != 5 || encoding != 1 ||
         bits_per_pixel != 8  || xmax >= 640  || ymax >= 480)
     {
-        Error("Bad PCX file. Invalid header value(s)!");
+        Error(va("Bad PCX file %s. Invalid header value(s)!", filename));
         return false;
     }
 
@@ -235,7 +243,7 @@ bool PCX_LoadFromMemory(const char * filename, const byte * data, int data_len,
 
     if ((data - (const byte *)pcx) > data_len)
     {
-        Error("PCX image was malformed!");
+        Error(va("PCX image %s was malformed!", filename));
         free(*pic);
         *pic = NULL;
         return false;
@@ -244,76 +252,6 @@ bool PCX_LoadFromMemory(const char * filename, const byte * data, int data_len,
     return true;
 }
 
-void Img_UnPalettize32(int width, int height, const byte * pic8in,
-                       const u32 * palette, byte * pic32out)
-{
-    int i, p;
-    const int pixel_count = width * height;
-    u32 * rgba = (u32 *)pic32out;
-
-    for (i = 0; i < pixel_count; ++i)
-    {
-        p = pic8in[i];
-        rgba[i] = palette[p];
-
-        if (p == 255)
-        {
-            // Transparent, so scan around for another
-            // color to avoid alpha fringes
-            if (i > width && pic8in[i - width] != 255)
-            {
-                p = pic8in[i - width];
-            }
-            else if (i < pixel_count - width && pic8in[i + width] != 255)
-            {
-                p = pic8in[i + width];
-            }
-            else if (i > 0 && pic8in[i - 1] != 255)
-            {
-                p = pic8in[i - 1];
-            }
-            else if (i < pixel_count - 1 && pic8in[i + 1] != 255)
-            {
-                p = pic8in[i + 1];
-            }
-            else
-            {
-                p = 0;
-            }
-
-            // Copy RGB components:
-            ((byte *)&rgba[i])[0] = ((const byte *)&palette[p])[0];
-            ((byte *)&rgba[i])[1] = ((const byte *)&palette[p])[1];
-            ((byte *)&rgba[i])[2] = ((const byte *)&palette[p])[2];
-        }
-    }
-}
-
-void Img_UnPalettize16(int width, int height, const byte * pic8in,
-                       const u32 * palette, byte * pic16out)
-{
-#define RGBA16(r, g, b, a) \
-    (((a & 0x1) << 15) | (((b) >> 3) << 10) | (((g) >> 3) << 5) | ((r) >> 3))
-
-    int i;
-    u32 color;
-    byte r, g, b, a;
-    const int pixel_count = width * height;
-    u16 * dest = (u16 *)pic16out;
-
-    for (i = 0; i < pixel_count; ++i)
-    {
-        color = palette[pic8in[i]];
-
-        r = (color & 0xFF);
-        g = (color >>  8) & 0xFF;
-        b = (color >> 16) & 0xFF;
-        a = (color >> 24) & 0xFF;
-
-        *dest++ = RGBA16(r, g, b, a);
-    }
-}
-
 void DumpColormap(const u32 * palette)
 {
     FILE * fd = fopen("palette.c", "wt");
@@ -349,9 +287,23 @@ void DumpColormap(const u32 * palette)
     fclose(fd);
 }
 
-void DumpImg(const byte * pic, int width, int height, int size_bytes,
+void DumpImg(const byte * pic8, int width, int height, int num_channels,
              const char * filename, const char * tag)
 {
+    const int pixel_count = width * height;
+    byte * packed   = malloc(LZ_BOUND(pixel_count));
+    byte * unpacked = malloc(pixel_count);
+
+    // Images are small, so it can afford to look for the longest match.
+    int packed_size = LZ_Compress(pic8, pixel_count, packed, LZ_WINDOW);
+
+    // Make sure the image comes back bit-exact before writing it.
+    if (LZ_Decompress(packed, packed_size, unpacked, pixel_count) != pixel_count ||
+        memcmp(unpacked, pic8, pixel_count) != 0)
+    {
+        Error(va("%s doesn't decompress back to the original!", tag));
+    }
+
     FILE * fd = fopen(filename, "wt");
     if (fd == NULL)
     {
@@ -365,13 +317,14 @@ void DumpImg(const byte * pic, int width, int height, int size_bytes,
     fprintf(fd, "typedef unsigned char byte;\n");
     fprintf(fd, "const int %s_width  = %d;\n", tag, width);
     fprintf(fd, "const int %s_height = %d;\n", tag, height);
-    fprintf(fd, "const int %s_size_bytes = %d;\n", tag, size_bytes);
-    fprintf(fd, "const byte %s_data[] __attribute__((aligned(16))) = {\n    ", tag);
-    for (i = 0; i < size_bytes; ++i)
+    fprintf(fd, "const int %s_size_bytes = %d;\n", tag, pixel_count * num_channels);
+    fprintf(fd, "const int %s_packed_size = %d;\n", tag, packed_size);
+    fprintf(fd, "const byte %s_packed[] = {\n    ", tag);
+    for (i = 0; i < packed_size; ++i)
     {
-        fprintf(fd, "0x%02X", pic[i]);
+        fprintf(fd, "0x%02X", packed[i]);
 
-        if (i != (size_bytes - 1))
+        if (i != (packed_size - 1))
         {
             fprintf(fd, ", ");
         }
@@ -386,6 +339,11 @@ void DumpImg(const byte * pic, int width, int height, int size_bytes,
     fprintf(fd, "\n};\n\n");
 
     fclose(fd);
+
+    printf("%s: %d bytes -> %d packed\n", tag, pixel_count * num_channels, packed_size);
+
+    free(unpacked);
+    free(packed);
 }
 
 void DoImage(const char * name, int num_channels)
@@ -407,20 +365,11 @@ void DoImage(const char * name, int num_channels)
         Error(va("Failed to load %s.pcx from memory!", name));
     }
 
-    byte * pic_rgba = malloc(width * height * num_channels);
-
-    if (num_channels == 4)
-    {
-        Img_UnPalettize32(width, height, pic, palette, pic_rgba);
-    }
-    else
-    {
-        Img_UnPalettize16(width, height, pic, palette, pic_rgba);
-    }
-
-    DumpImg(pic_rgba, width, height, (width * height * num_channels), va("%s.c", name), name);
+    // Expanded to num_channels bytes per pixel with the
+    // global palette when loaded by the renderer.
+    DumpImg(pic, width, height, num_channels, va("%s.c", name), name);
 
-    free(pic_rgba);
+    free(data_ptr);
     free(pic);
 }
 
@@ -0,0 +1,477 @@
+
+/*
+ * Command line check of the MD2 to triangle strips conversion of the
+ * alias model loader (src/ps2/alias_strip.c, called by PS2_LoadAliasMD2Model),
+ * and of the VU1 xyz stream the loader makes from the strips.
+ *
+ * For each model, the triangles drawn from the strips have to be exactly
+ * the triangles of the MD2, each one once, with the same three (xyz, st)
+ * corners in the same winding, less the degenerate ones that draw nothing.
+ * The deduplicated vertexes have to be all different. Then the strips go
+ * through VU1_AliasStripToStream as in the loader, and the stream is cut in
+ * batches with VU1_AliasBuildBatch: every batch has to start on a strip and
+ * the stream pieces have to give the same triangles again (by xyz, winding
+ * left out, the pieces long strips are cut in may flip it).
+ *
+ * With no arguments it checks random models: grids with texture seams, long
+ * ones that make strips longer than a batch, and random triangle soups with
+ * shared, non-manifold and degenerate triangles. MD2 files given in the
+ * command line (extract them from the pak with unpak first) are checked too.
+ * Prints the strips made and the indexes per triangle, 3 for a plain list.
+ *
+ * Build with:
+ * cc -I.. md2strips.c ../ps2/alias_strip.c ../ps2/vu1_alias.c -lm -o md2strips
+ * ./md2strips [file.md2 ...]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ps2/alias_strip.h"
+#include "ps2/vu1_alias.h"
+
+#define DEFAULT_NUM_MODELS 300
+
+// Random models are made of corners from pools this big.
+#define SOUP_POOL 40
+
+// Both the EE and the PCs this runs on are little endian.
+short LittleShort(short l) { return l; }
+int LittleLong(int l) { return l; }
+
+// Only for VU1_AliasSetupNormals, which isn't called here.
+vec3_t bytedirs[NUMVERTEXNORMALS];
+
+typedef struct
+{
+    int models;
+    int tris;
+    int verts;
+    int strips;
+    int indexes;
+    int longest;
+    int vu_xyz;
+} strip_stats_t;
+
+// One corner as a single key, xyz in the high bits.
+static u32 corner_key(int xyz, int st)
+{
+    return ((u32)xyz << 16) | (u32)st;
+}
+
+// Triangle of three keys, rotated to start at the smallest, which keeps the winding.
+static void make_tri(u32 * tri, u32 a, u32 b, u32 c)
+{
+    if (a <= b && a <= c)
+    {
+        tri[0] = a; tri[1] = b; tri[2] = c;
+    }
+    else if (b <= a && b <= c)
+    {
+        tri[0] = b; tri[1] = c; tri[2] = a;
+    }
+    else
+    {
+        tri[0] = c; tri[1] = a; tri[2] = b;
+    }
+}
+
+// Triangle of three xyz, sorted, for the stream that may flip the winding.
+static void make_xyz_tri(u32 * tri, u32 a, u32 b, u32 c)
+{
+    u32 t;
+    if (a > b) { t = a; a = b; b = t; }
+    if (b > c) { t = b; b = c; c = t; }
+    if (a > b) { t = a; a = b; b = t; }
+    tri[0] = a; tri[1] = b; tri[2] = c;
+}
+
+static int compare_tris(const void * a, const void * b)
+{
+    const u32 * x = (const u32 *)a;
+    const u32 * y = (const u32 *)b;
+    int i;
+    for (i = 0; i < 3; ++i)
+    {
+        if (x[i] != y[i])
+        {
+            return (x[i] < y[i]) ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+// Same number of triangles and the same ones once sorted.
+static qboolean same_tris(u32 * a, int count_a, u32 * b, int count_b)
+{
+    if (count_a != count_b)
+    {
+        return false;
+    }
+    qsort(a, count_a, sizeof(u32) * 3, compare_tris);
+    qsort(b, count_b, sizeof(u32) * 3, compare_tris);
+    return memcmp(a, b, count_a * sizeof(u32) * 3) == 0;
+}
+
+// Strips and checks one model. Returns the number of errors.
+static int check_model(const char * name, const dtriangle_t * tris, int num_tris, int num_xyz, int num_st,
+                       strip_stats_t * stats)
+{
+    int i, j, k, errors = 0;
+
+    void * scratch = malloc(PS2_AliasStripScratchSize(num_tris));
+    ps2_alias_strips_t strips;
+    if (!PS2_AliasBuildStrips(&strips, tris, num_tris, num_xyz, num_st, scratch))
+    {
+        printf("%s: bad triangle index\n", name);
+        free(scratch);
+        return 1;
+    }
+
+    u32 * expected = malloc(num_tris * sizeof(u32) * 3);
+    u32 * drawn    = malloc((strips.num_indexes + 1) * sizeof(u32) * 3);
+    int num_expected = 0, num_drawn = 0;
+
+    // MD2 triangles that draw something:
+    for (i = 0; i < num_tris; ++i)
+    {
+        u32 c[3];
+        for (j = 0; j < 3; ++j)
+        {
+            c[j] = corner_key(tris[i].index_xyz[j], tris[i].index_st[j]);
+        }
+        if (c[0] != c[1] && c[1] != c[2] && c[2] != c[0])
+        {
+            make_tri(&expected[num_expected++ * 3], c[0], c[1], c[2]);
+        }
+    }
+
+    // Deduplicated vertexes all different:
+    u32 * keys = malloc((strips.num_verts + 1) * sizeof(u32) * 3);
+    for (i = 0; i < strips.num_verts; ++i)
+    {
+        keys[i * 3 + 0] = corner_key(strips.vert_xyz[i], strips.vert_st[i]);
+        keys[i * 3 + 1] = keys[i * 3 + 2] = 0;
+    }
+    qsort(keys, strips.num_verts, sizeof(u32) * 3, compare_tris);
+    for (i = 1; i < strips.num_verts; ++i)
+    {
+        if (keys[i * 3] == keys[(i - 1) * 3])
+        {
+            if (errors++ == 0)
+            {
+                printf("%s: vertex xyz %u st %u is in twice\n", name, keys[i * 3] >> 16, keys[i * 3] & 0xFFFF);
+            }
+        }
+    }
+    free(keys);
+
+    // Triangles of the strips, odd ones with the first two swapped:
+    const int * index = strips.indexes;
+    for (i = 0; i < strips.num_strips; ++i)
+    {
+        if (strips.lengths[i] < 3)
+        {
+            printf("%s: strip %d has %d indexes\n", name, i, strips.lengths[i]);
+            errors++;
+        }
+        for (k = 0; k + 2 < strips.lengths[i]; ++k)
+        {
+            const int a = index[k + ((k & 1) ? 1 : 0)];
+            const int b = index[k + ((k & 1) ? 0 : 1)];
+            const int c = index[k + 2];
+            if (a == b || b == c || c == a)
+            {
+                if (errors++ == 0)
+                {
+                    printf("%s: strip %d draws degenerate triangle %d\n", name, i, k);
+                }
+            }
+            make_tri(&drawn[num_drawn++ * 3],
+                     corner_key(strips.vert_xyz[a], strips.vert_st[a]),
+                     corner_key(strips.vert_xyz[b], strips.vert_st[b]),
+                     corner_key(strips.vert_xyz[c], strips.vert_st[c]));
+        }
+        if (strips.lengths[i] > stats->longest)
+        {
+            stats->longest = strips.lengths[i];
+        }
+        index += strips.lengths[i];
+    }
+    if (index != strips.indexes + strips.num_indexes)
+    {
+        printf("%s: strip lengths add up to %d, not %d indexes\n",
+               name, (int)(index - strips.indexes), strips.num_indexes);
+        errors++;
+    }
+
+    if (!same_tris(expected, num_expected, drawn, num_drawn))
+    {
+        printf("%s: strips draw %d triangles, not the %d of the model\n", name, num_drawn, num_expected);
+        errors++;
+    }
+
+    //
+    // VU1 stream as the loader makes it, then cut in batches as drawn:
+    //
+    int num_vu_xyz = 0;
+    for (i = 0, j = 0; i < strips.num_strips; ++i)
+    {
+        num_vu_xyz += VU1_AliasStripToStream(NULL, strips.indexes + j, strips.vert_xyz, strips.lengths[i]);
+        j += strips.lengths[i];
+    }
+    u16 * vu_xyz = malloc((num_vu_xyz + 1) * sizeof(u16));
+    int vu_xyz_used = 0;
+    for (i = 0, j = 0; i < strips.num_strips; ++i)
+    {
+        vu_xyz_used += VU1_AliasStripToStream(vu_xyz + vu_xyz_used, strips.indexes + j, strips.vert_xyz, strips.lengths[i]);
+        j += strips.lengths[i];
+    }
+    if (vu_xyz_used != num_vu_xyz)
+    {
+        printf("%s: stream counted %d entries, wrote %d\n", name, num_vu_xyz, vu_xyz_used);
+        errors++;
+    }
+
+    // Triangles of the stream, by xyz only:
+    for (i = 0; i < num_drawn; ++i)
+    {
+        make_xyz_tri(&drawn[i * 3], drawn[i * 3] >> 16, drawn[i * 3 + 1] >> 16, drawn[i * 3 + 2] >> 16);
+    }
+    u32 * streamed = malloc((num_vu_xyz + 1) * sizeof(u32) * 3);
+    int num_streamed = 0, piece_start = 0;
+    for (i = 0; i < num_vu_xyz; ++i)
+    {
+        if ((vu_xyz[i] & VU1_ALIAS_STRIP_START) && (i == 0 || !(vu_xyz[i - 1] & VU1_ALIAS_STRIP_START)))
+        {
+            piece_start = i;
+        }
+        if (i - piece_start >= 2)
+        {
+            make_xyz_tri(&streamed[num_streamed++ * 3], vu_xyz[i - 2] & ~VU1_ALIAS_STRIP_START,
+                         vu_xyz[i - 1] & ~VU1_ALIAS_STRIP_START, vu_xyz[i] & ~VU1_ALIAS_STRIP_START);
+        }
+        else if (i - piece_start < 2 && !(vu_xyz[i] & VU1_ALIAS_STRIP_START))
+        {
+            if (errors++ == 0)
+            {
+                printf("%s: stream entry %d starts a piece without the flag\n", name, i);
+            }
+        }
+    }
+    // Split pieces repeat the two vertexes at the cut, which adds no triangle.
+    if (!same_tris(drawn, num_drawn, streamed, num_streamed))
+    {
+        printf("%s: stream draws %d triangles, not the %d of the strips\n", name, num_streamed, num_drawn);
+        errors++;
+    }
+
+    // Batches never start in the middle of a piece:
+    static u32 vif[VU1_ALIAS_MAX_VIF_QW * 4];
+    ps2_vu_alias_consts_t consts;
+    dtrivertx_t * frame = calloc(num_xyz, sizeof(dtrivertx_t));
+    memset(&consts, 0, sizeof(consts));
+    for (i = 0; i < num_vu_xyz;)
+    {
+        int vif_qw;
+        if (!(vu_xyz[i] & VU1_ALIAS_STRIP_START) || (i > 0 && (vu_xyz[i - 1] & VU1_ALIAS_STRIP_START)))
+        {
+            if (errors++ == 0)
+            {
+                printf("%s: batch starts at stream entry %d, in the middle of a strip\n", name, i);
+            }
+        }
+        const int n = VU1_AliasBuildBatch(vif, &vif_qw, &consts, frame, frame, vu_xyz + i, num_vu_xyz - i);
+        if (n <= 0 || n > VU1_ALIAS_MAX_VERTS || vif_qw > VU1_ALIAS_MAX_VIF_QW)
+        {
+            printf("%s: batch of %d entries in %d qwords\n", name, n, vif_qw);
+            errors++;
+            break;
+        }
+        i += n;
+    }
+
+    stats->models  += 1;
+    stats->tris    += num_tris;
+    stats->verts   += strips.num_verts;
+    stats->strips  += strips.num_strips;
+    stats->indexes += strips.num_indexes;
+    stats->vu_xyz  += num_vu_xyz;
+
+    free(frame);
+    free(streamed);
+    free(vu_xyz);
+    free(drawn);
+    free(expected);
+    free(scratch);
+    return errors;
+}
+
+// W x H quads of two triangles, with a seam: corners of the same xyz that
+// get a different st, as on the edges of skin pieces. Quads can be split
+// along either diagonal at random, else all the same way for long strips.
+static int make_grid(dtriangle_t * tris, int w, int h, qboolean random_diagonals, int * num_xyz, int * num_st)
+{
+    int x, y, n = 0;
+    const int seam_x = 1 + rand() % w;
+
+    for (y = 0; y < h; ++y)
+    {
+        for (x = 0; x < w; ++x)
+        {
+            const int v00 = y * (w + 1) + x;
+            const int v10 = v00 + 1;
+            const int v01 = v00 + w + 1;
+            const int v11 = v01 + 1;
+
+            // Right of the seam the st are a second copy.
+            const int st_ofs = (x >= seam_x) ? (w + 1) * (h + 1) : 0;
+            const int flip = random_diagonals ? (rand() & 1) : 1;
+
+            const int a[3] = { v00, v10, flip ? v11 : v01 };
+            const int b[3] = { flip ? v00 : v10, v11, v01 };
+
+            int i;
+            for (i = 0; i < 3; ++i)
+            {
+                tris[n].index_xyz[i]     = a[i];
+                tris[n].index_st[i]      = a[i] + st_ofs;
+                tris[n + 1].index_xyz[i] = b[i];
+                tris[n + 1].index_st[i]  = b[i] + st_ofs;
+            }
+            n += 2;
+        }
+    }
+
+    *num_xyz = (w + 1) * (h + 1);
+    *num_st  = (w + 1) * (h + 1) * 2;
+    return n;
+}
+
+// Triangles of random corners from small pools: lots of shared edges,
+// edges with more than two triangles, repeats and degenerate triangles.
+static int make_soup(dtriangle_t * tris, int count, int * num_xyz, int * num_st)
+{
+    int i, j;
+    for (i = 0; i < count; ++i)
+    {
+        for (j = 0; j < 3; ++j)
+        {
+            tris[i].index_xyz[j] = rand() % SOUP_POOL;
+            tris[i].index_st[j]  = rand() % 4;
+        }
+        if ((rand() & 15) == 0)
+        {
+            tris[i].index_xyz[2] = tris[i].index_xyz[0];
+            tris[i].index_st[2]  = tris[i].index_st[0];
+        }
+    }
+
+    *num_xyz = SOUP_POOL;
+    *num_st  = 4;
+    return count;
+}
+
+static int check_md2_file(const char * filename, strip_stats_t * stats)
+{
+    FILE * fd = fopen(filename, "rb");
+    if (fd == NULL)
+    {
+        printf("Can't fopen() the file! %s\n", filename);
+        return 1;
+    }
+
+    fseek(fd, 0, SEEK_END);
+    const int file_len = (int)ftell(fd);
+    fseek(fd, 0, SEEK_SET);
+
+    byte * data = malloc(file_len + 1);
+    const qboolean read_ok = fread(data, 1, file_len, fd) == (size_t)file_len;
+    fclose(fd);
+
+    const dmdl_t * header = (const dmdl_t *)data;
+    if (!read_ok || file_len < (int)sizeof(dmdl_t) || header->ident != IDALIASHEADER ||
+        header->ofs_tris < (int)sizeof(dmdl_t) || header->num_tris <= 0 ||
+        header->num_tris > (file_len - header->ofs_tris) / (int)sizeof(dtriangle_t))
+    {
+        printf("'%s' is not a MD2 model!\n", filename);
+        free(data);
+        return 1;
+    }
+
+    strip_stats_t file_stats;
+    memset(&file_stats, 0, sizeof(file_stats));
+
+    const int errors = check_model(filename, (const dtriangle_t *)(data + header->ofs_tris),
+                                   header->num_tris, header->num_xyz, header->num_st, &file_stats);
+
+    printf("%s: %d tris -> %d verts (%d xyz), %d strips, %.2f indexes per triangle, %d stream entries\n",
+           filename, file_stats.tris, file_stats.verts, header->num_xyz, file_stats.strips,
+           (double)file_stats.indexes / file_stats.tris, file_stats.vu_xyz);
+
+    stats->models  += file_stats.models;
+    stats->tris    += file_stats.tris;
+    stats->verts   += file_stats.verts;
+    stats->strips  += file_stats.strips;
+    stats->indexes += file_stats.indexes;
+    stats->vu_xyz  += file_stats.vu_xyz;
+    if (file_stats.longest > stats->longest)
+    {
+        stats->longest = file_stats.longest;
+    }
+
+    free(data);
+    return errors;
+}
+
+int main(int argc, const char * argv[])
+{
+    static dtriangle_t tris[MAX_TRIANGLES];
+    strip_stats_t stats;
+    int i, errors = 0;
+
+    memset(&stats, 0, sizeof(stats));
+    srand(1234);
+
+    if (argc > 1)
+    {
+        for (i = 1; i < argc; ++i)
+        {
+            errors += check_md2_file(argv[i], &stats);
+        }
+    }
+    else
+    {
+        for (i = 0; i < DEFAULT_NUM_MODELS; ++i)
+        {
+            char name[64];
+            int num_tris, num_xyz, num_st;
+
+            switch (i % 3)
+            {
+            case 0 :
+                snprintf(name, sizeof(name), "grid %d", i);
+                num_tris = make_grid(tris, 1 + rand() % 24, 1 + rand() % 24, true, &num_xyz, &num_st);
+                break;
+            case 1 :
+                // One or two rows: strips of several hundred vertexes.
+                snprintf(name, sizeof(name), "long grid %d", i);
+                num_tris = make_grid(tris, 100 + rand() % 400, 1 + (rand() & 1), false, &num_xyz, &num_st);
+                break;
+            default :
+                snprintf(name, sizeof(name), "soup %d", i);
+                num_tris = make_soup(tris, 1 + rand() % 600, &num_xyz, &num_st);
+                break;
+            }
+
+            errors += check_model(name, tris, num_tris, num_xyz, num_st, &stats);
+        }
+    }
+
+    printf("%d models, %d triangles -> %d verts, %d strips (longest %d indexes), %.2f indexes per triangle, %d errors\n",
+           stats.models, stats.tris, stats.verts, stats.strips, stats.longest,
+           (stats.tris > 0) ? (double)stats.indexes / stats.tris : 0.0, errors);
+
+    return (errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
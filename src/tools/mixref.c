@@ -0,0 +1,298 @@
+
+/*
+ * Command line check of the wide sound mixing kernels of src/client/snd_mix.c
+ * (the s_mixer 1 path) against the reference Quake 2 loops they replace:
+ *  - S_PaintChannelFrom8_Wide  vs S_PaintChannelFrom8 (8 bit scaletable lookups);
+ *  - S_PaintChannelFrom16_Wide vs S_PaintChannelFrom16;
+ *  - S_WriteLinearBlastStereo16_Wide vs S_WriteLinearBlastStereo16 (the clipper).
+ *
+ * snd_mix.c is compiled right into this program, so the static kernels are
+ * the very ones the game uses. Every run paints random channels of random
+ * data, volumes (past 255 too for the 8 bit kernels, which clamp), s_volume
+ * and snd_vol levels up to s_volume 1, lengths and paint buffer offsets,
+ * and blasts random paint buffers loud enough to clip, into output addresses
+ * of any alignment. The paint buffers, the output
+ * samples and the channel state left by both versions must match bit for bit.
+ * Then the time of both versions mixing 32 channels is printed.
+ *
+ * Host builds only cover the C loops, the EE MMI clipper is checked by
+ * the s_mixbench console command on the PS2.
+ *
+ * Build with:
+ * cc -O2 -I.. -I../client mixref.c -lm -o mixref
+ * ./mixref [num_runs] [seed]
+ */
+
+#include "client/snd_mix.c"
+
+#include <time.h>
+
+// Mixing throughput runs, the best one is printed.
+#define TIMING_RUNS 10
+
+// Room for a full paint buffer of samples after the largest channel position.
+#define SFX_SAMPLES (PAINTBUFFER_SIZE * 2)
+
+/*
+ * What snd_mix.c needs from the rest of the client, enough for the kernels.
+ */
+
+channel_t channels[MAX_CHANNELS];
+playsound_t s_pendingplays;
+portable_samplepair_t s_rawsamples[MAX_RAW_SAMPLES];
+int s_rawend;
+int paintedtime;
+dma_t dma;
+cvar_t * s_volume;
+cvar_t * s_testsound;
+cvar_t * s_mixer;
+
+void Com_Printf(const char * fmt, ...)
+{
+    va_list argptr;
+    va_start(argptr, fmt);
+    vprintf(fmt, argptr);
+    va_end(argptr);
+}
+
+void * Z_Malloc(int size) { return calloc(1, size); }
+void Z_Free(void * ptr) { free(ptr); }
+int Sys_Milliseconds(void) { return (int)(clock() / (CLOCKS_PER_SEC / 1000)); }
+float ps2_cosf(float x) { return cosf(x); }
+sfxcache_t * S_LoadSound(sfx_t * s) { (void)s; return NULL; }
+void S_IssuePlaysound(playsound_t * ps) { (void)ps; }
+void S_EncodeADPCM(const short * pcm, int samples, byte * out) { (void)pcm; (void)samples; (void)out; }
+void S_DecodeADPCMBlock(const byte * block, int count, short * out) { (void)block; (void)count; (void)out; }
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+static sfxcache_t * make_sfx(int width)
+{
+    sfxcache_t * sc = calloc(1, sizeof(sfxcache_t) + SFX_SAMPLES * width);
+    int i;
+
+    sc->width = width;
+    sc->length = SFX_SAMPLES;
+    for (i = 0; i < SFX_SAMPLES * width; ++i)
+    {
+        sc->data[i] = rand() & 0xff;
+    }
+    return sc;
+}
+
+static void set_volume(cvar_t * cvar, float volume)
+{
+    cvar->value = volume;
+    S_InitScaletable();
+}
+
+// Any volume the game can give a channel, with the odd one past the
+// clamp of the 8 bit kernels when 'past_clamp' is set. The 16 bit ones
+// don't clamp, past 255 they would overflow an int like the game would.
+static int random_channel_vol(qboolean past_clamp)
+{
+    switch (rand() & 7)
+    {
+    case 0  : return 0;
+    case 1  : return past_clamp ? 255 + (rand() & 255) : 255;
+    default : return rand() & 255;
+    }
+}
+
+// Paints the same channel with both kernels into separate paint buffers. Returns the differences.
+static int check_paint(paintfunc_t reference, paintfunc_t wide, sfxcache_t * sc,
+                       portable_samplepair_t * ref_out, portable_samplepair_t * wide_out)
+{
+    channel_t ref_ch, wide_ch;
+    int i, errors = 0;
+
+    const int offset = rand() % PAINTBUFFER_SIZE;
+    const int count = rand() % (PAINTBUFFER_SIZE - offset + 1);
+
+    memset(&ref_ch, 0, sizeof(ref_ch));
+    ref_ch.leftvol = random_channel_vol(sc->width == 1);
+    ref_ch.rightvol = random_channel_vol(sc->width == 1);
+    ref_ch.pos = rand() % (SFX_SAMPLES - PAINTBUFFER_SIZE);
+    wide_ch = ref_ch;
+
+    // Start both from the same random mix of the channels painted before.
+    for (i = 0; i < PAINTBUFFER_SIZE; ++i)
+    {
+        paintbuffer[i].left = (rand() - RAND_MAX / 2) >> 4;
+        paintbuffer[i].right = (rand() - RAND_MAX / 2) >> 4;
+    }
+    memcpy(wide_out, paintbuffer, sizeof(paintbuffer));
+
+    reference(&ref_ch, sc, count, offset);
+    memcpy(ref_out, paintbuffer, sizeof(paintbuffer));
+
+    memcpy(paintbuffer, wide_out, sizeof(paintbuffer));
+    wide(&wide_ch, sc, count, offset);
+    memcpy(wide_out, paintbuffer, sizeof(paintbuffer));
+
+    for (i = 0; i < PAINTBUFFER_SIZE; ++i)
+    {
+        if (ref_out[i].left != wide_out[i].left || ref_out[i].right != wide_out[i].right)
+        {
+            if (errors++ == 0)
+            {
+                printf("%d bit: sample %d differs (%d,%d) != (%d,%d), vol %d,%d, count %d, offset %d\n",
+                       sc->width * 8, i, wide_out[i].left, wide_out[i].right, ref_out[i].left, ref_out[i].right,
+                       wide_ch.leftvol, wide_ch.rightvol, count, offset);
+            }
+        }
+    }
+    if (memcmp(&ref_ch, &wide_ch, sizeof(channel_t)) != 0)
+    {
+        printf("%d bit: channel state differs, pos %d != %d\n", sc->width * 8, wide_ch.pos, ref_ch.pos);
+        errors++;
+    }
+    return errors;
+}
+
+// Blasts a random paint buffer with both clippers. Returns the differences.
+static int check_blast(short * ref_out, short * wide_out)
+{
+    // Output of the DMA buffer can start on any sample pair,
+    // the count is always of whole pairs as in S_TransferStereo16.
+    const int out_align = (rand() & 1) * 2;
+    const int count = (rand() % (PAINTBUFFER_SIZE + 1)) * 2;
+    int i, errors = 0;
+
+    for (i = 0; i < PAINTBUFFER_SIZE; ++i)
+    {
+        // Up to 4x past the 16 bit range, so about half of them clip.
+        paintbuffer[i].left = (int)(((rand() & 0x3ffff) - 0x20000) * 256.0);
+        paintbuffer[i].right = (int)(((rand() & 0x3ffff) - 0x20000) * 256.0);
+    }
+
+    memset(ref_out, 0, (PAINTBUFFER_SIZE * 2 + 4) * sizeof(short));
+    memset(wide_out, 0, (PAINTBUFFER_SIZE * 2 + 4) * sizeof(short));
+
+    snd_p = (int *)paintbuffer;
+    snd_out = ref_out + out_align;
+    snd_linear_count = count;
+    S_WriteLinearBlastStereo16();
+
+    snd_p = (int *)paintbuffer;
+    snd_out = wide_out + out_align;
+    snd_linear_count = count;
+    S_WriteLinearBlastStereo16_Wide();
+
+    for (i = 0; i < PAINTBUFFER_SIZE * 2 + 4; ++i)
+    {
+        if (ref_out[i] != wide_out[i])
+        {
+            if (errors++ == 0)
+            {
+                printf("blast: sample %d differs %d != %d, count %d, alignment %d\n",
+                       i, wide_out[i], ref_out[i], count, out_align);
+            }
+        }
+    }
+    return errors;
+}
+
+// Best time of TIMING_RUNS of 32 channels mixed over the paint buffer, half 8 and half 16 bit.
+static double time_mix(paintfunc_t paint8, paintfunc_t paint16, blastfunc_t blast,
+                       sfxcache_t * sc8, sfxcache_t * sc16, short * out)
+{
+    double best = 1e9;
+    int run, i;
+
+    for (run = 0; run < TIMING_RUNS; ++run)
+    {
+        const double start = now_ms();
+        memset(paintbuffer, 0, sizeof(paintbuffer));
+
+        for (i = 0; i < MAX_CHANNELS; ++i)
+        {
+            channels[i].leftvol = (i * 37) & 255;
+            channels[i].rightvol = (i * 91) & 255;
+            channels[i].pos = i;
+
+            if (i & 1)
+            {
+                paint8(&channels[i], sc8, PAINTBUFFER_SIZE, 0);
+            }
+            else
+            {
+                paint16(&channels[i], sc16, PAINTBUFFER_SIZE, 0);
+            }
+        }
+
+        snd_p = (int *)paintbuffer;
+        snd_out = out;
+        snd_linear_count = PAINTBUFFER_SIZE * 2;
+        blast();
+
+        const double elapsed = now_ms() - start;
+        if (elapsed < best)
+        {
+            best = elapsed;
+        }
+    }
+    return best;
+}
+
+int main(int argc, const char * argv[])
+{
+    static const float volumes[] = { 0.0f, 0.3f, 0.7f, 1.0f };
+
+    const int num_runs = (argc > 1) ? atoi(argv[1]) : 2000;
+    const unsigned seed = (argc > 2) ? (unsigned)atoi(argv[2]) : 1234;
+    int run, errors8 = 0, errors16 = 0, errors_blast = 0;
+
+    cvar_t volume_cvar;
+    memset(&volume_cvar, 0, sizeof(volume_cvar));
+    s_volume = &volume_cvar;
+
+    srand(seed);
+
+    sfxcache_t * sc8 = make_sfx(1);
+    sfxcache_t * sc16 = make_sfx(2);
+    portable_samplepair_t * ref_paint = malloc(sizeof(paintbuffer));
+    portable_samplepair_t * wide_paint = malloc(sizeof(paintbuffer));
+    short * ref_out = malloc((PAINTBUFFER_SIZE * 2 + 4) * sizeof(short));
+    short * wide_out = malloc((PAINTBUFFER_SIZE * 2 + 4) * sizeof(short));
+
+    for (run = 0; run < num_runs; ++run)
+    {
+        set_volume(&volume_cvar, volumes[run & 3]);
+        snd_vol = (int)(volumes[(run >> 2) & 3] * 256);
+
+        errors8 += check_paint(S_PaintChannelFrom8, S_PaintChannelFrom8_Wide, sc8, ref_paint, wide_paint);
+        errors16 += check_paint(S_PaintChannelFrom16, S_PaintChannelFrom16_Wide, sc16, ref_paint, wide_paint);
+        errors_blast += check_blast(ref_out, wide_out);
+    }
+
+    printf("%d runs, seed %u\n", num_runs, seed);
+    printf("  8 bit paint: %d differences\n", errors8);
+    printf(" 16 bit paint: %d differences\n", errors16);
+    printf("  blast/clip:  %d differences\n", errors_blast);
+
+    set_volume(&volume_cvar, 1.0f);
+    snd_vol = 256;
+
+    const double ref_ms = time_mix(S_PaintChannelFrom8, S_PaintChannelFrom16, S_WriteLinearBlastStereo16,
+                                   sc8, sc16, ref_out);
+    const double wide_ms = time_mix(S_PaintChannelFrom8_Wide, S_PaintChannelFrom16_Wide, S_WriteLinearBlastStereo16_Wide,
+                                    sc8, sc16, wide_out);
+
+    printf("%d channels of %d samples: reference %.3f ms, wide %.3f ms (%.2fx)\n",
+           MAX_CHANNELS, PAINTBUFFER_SIZE, ref_ms, wide_ms, (wide_ms > 0.0) ? ref_ms / wide_ms : 0.0);
+
+    free(wide_out);
+    free(ref_out);
+    free(wide_paint);
+    free(ref_paint);
+    free(sc16);
+    free(sc8);
+
+    return (errors8 + errors16 + errors_blast == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
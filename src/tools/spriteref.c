@@ -0,0 +1,379 @@
+
+/*
+ * Command line check of the VU1 sprite/beam quads program C reference
+ * (src/ps2/vu1_sprite.c) and of the packets built for it.
+ *
+ * Billboards: random sprite frames (size and origin), view axes and
+ * positions are put through the same setup and packet builder the renderer
+ * uses, then VU1_SpriteRunVIF. Every corner is checked against the corners
+ * of ref_gl's R_DrawSpriteModel projected here in double precision: the
+ * 12:4 position, Q and S/T. Beams are checked the same way against their
+ * end points moved half the diameter to the side, with the side being
+ * across both the beam and the view direction.
+ *
+ * Packets: for every batch size, the stream size against VU1_SpriteBatchQWords,
+ * the GIF tag NLOOP and EOP, the output staying below the guard band constants,
+ * and the ADC bits: always set on the two corners that start each strip and on
+ * the other two only when a corner is outside the clip volume.
+ *
+ * Prints the largest differences and exits with a failure status if any
+ * goes over the tolerances below.
+ *
+ * Build with:
+ * cc -I.. spriteref.c ../ps2/vu1_sprite.c -lm -o spriteref
+ * ./spriteref [num_batches] [seed]
+ */
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "ps2/vu1_sprite.h"
+#include "ps2/vu1_clip.h"
+
+#define DEFAULT_NUM_BATCHES 2000
+
+// Largest position difference, in 12:4 units, relative Q difference
+// and S/T difference in fractions of the texture.
+#define POSITION_TOLERANCE 2.0
+#define Q_TOLERANCE 1e-4
+#define ST_TOLERANCE 1e-4
+
+static ps2_vu_qword_t vu_mem[VU1_MEM_QWORDS];
+static u32 vif_buffer[VU1_SPRITE_MAX_VIF_QW * 4] __attribute__((aligned(16)));
+
+typedef struct
+{
+    int quads;
+    int clipped_quads;
+    int corners;
+    int errors;
+    double max_pos_error;
+    double max_q_error;
+    double max_st_error;
+} totals_t;
+
+static double frand(double lo, double hi)
+{
+    return lo + (hi - lo) * ((double)rand() / (double)RAND_MAX);
+}
+
+// Row-vector perspective like Mat4_MakePerspProjection, clip X/Y
+// range of the 4096x4096 guard band, Z = W at the near plane.
+static void make_mvp(m_mat4_t * m)
+{
+    const float z_near = 4.0f;
+    const float z_far  = 4096.0f;
+    const float guard  = 4096.0f / 640.0f;
+
+    memset(m, 0, sizeof(*m));
+    m->m[0][0] = 1.0f / guard;
+    m->m[1][1] = 1.0f / guard;
+    m->m[2][2] = (z_far + z_near) / (z_far - z_near);
+    m->m[2][3] = 1.0f;
+    m->m[3][2] = -2.0f * z_far * z_near / (z_far - z_near);
+}
+
+// Right and up vectors of a random view, like AngleVectors.
+static void random_view_axes(float right[3], float up[3])
+{
+    const double pitch = frand(-1.5, 1.5);
+    const double yaw   = frand(-3.1, 3.1);
+    const double roll  = frand(-0.5, 0.5);
+
+    const double sp = sin(pitch), cp = cos(pitch);
+    const double sy = sin(yaw),   cy = cos(yaw);
+    const double sr = sin(roll),  cr = cos(roll);
+
+    right[0] = (float)(-1 * sr * sp * cy + -1 * cr * -sy);
+    right[1] = (float)(-1 * sr * sp * sy + -1 * cr * cy);
+    right[2] = (float)(-1 * sr * cp);
+    up[0]    = (float)(cr * sp * cy + -sr * -sy);
+    up[1]    = (float)(cr * sp * sy + -sr * cy);
+    up[2]    = (float)(cr * cp);
+}
+
+static bool project(const m_mat4_t * mvp, const double pos[3], double out[4], bool * outside)
+{
+    int k;
+    for (k = 0; k < 4; ++k)
+    {
+        out[k] = mvp->m[0][k] * pos[0] + mvp->m[1][k] * pos[1] + mvp->m[2][k] * pos[2] + mvp->m[3][k];
+    }
+
+    // Right on the planes float and double can disagree.
+    bool on_plane = false;
+    const double w = fabs(out[3]);
+    for (k = 0; k < 3; ++k)
+    {
+        *outside |= (out[k] > w || out[k] < -w);
+        on_plane |= fabs(fabs(out[k]) - w) < 1e-3;
+    }
+    return on_plane;
+}
+
+static void check_corner(int batch, int corner, const ps2_vu_qword_t * out, const double clip[4],
+                         const double st[2], totals_t * totals)
+{
+    int k;
+    const double q = 1.0 / clip[3];
+
+    const double q_error = fabs(out[0].f[2] - q) / q;
+    if (q_error > totals->max_q_error)
+    {
+        totals->max_q_error = q_error;
+    }
+    if (q_error > Q_TOLERANCE)
+    {
+        fprintf(stderr, "batch %d, corner %d: Q %g, expected %g\n", batch, corner, out[0].f[2], q);
+        ++totals->errors;
+    }
+
+    for (k = 0; k < 2; ++k)
+    {
+        const double st_error = fabs(out[0].f[k] / out[0].f[2] - st[k]);
+        if (st_error > totals->max_st_error)
+        {
+            totals->max_st_error = st_error;
+        }
+        if (st_error > ST_TOLERANCE)
+        {
+            fprintf(stderr, "batch %d, corner %d: %c %f, expected %f\n", batch, corner, "ST"[k], out[0].f[k] / out[0].f[2], st[k]);
+            ++totals->errors;
+        }
+
+        const double expected = (2048.0 + clip[k] * q * 2048.0) * 16.0;
+        const double pos_error = fabs(out[2].i[k] - expected);
+        if (pos_error > totals->max_pos_error)
+        {
+            totals->max_pos_error = pos_error;
+        }
+        if (pos_error > POSITION_TOLERANCE)
+        {
+            fprintf(stderr, "batch %d, corner %d: %c at %d, expected %.2f\n", batch, corner, "XY"[k], out[2].i[k], expected);
+            ++totals->errors;
+        }
+    }
+
+    ++totals->corners;
+}
+
+static void check_batch(int batch, bool beam, totals_t * totals)
+{
+    int n, c, k;
+    m_mat4_t mvp;
+    make_mvp(&mvp);
+
+    const int color[4] = { 128, 64, 32, 84 };
+    ps2_vu_sprite_consts_t consts;
+    VU1_SpriteSetupConsts(&consts, &mvp, color, !beam);
+
+    // Sprite frame or beam, the quad axes for the batch:
+    float right[3], up[3];
+    int width = 0, height = 0, origin_x = 0, origin_y = 0;
+    float start[3], end[3], eye[3];
+    float diameter = 0.0f;
+
+    if (beam)
+    {
+        for (k = 0; k < 3; ++k)
+        {
+            start[k] = (float)frand(-512.0, 512.0);
+            end[k]   = (float)frand(-512.0, 512.0);
+            eye[k]   = (float)frand(-64.0, 64.0);
+        }
+        start[2] += 1024.0f;
+        end[2]   += 1024.0f;
+        diameter = (float)frand(1.0, 16.0);
+        VU1_SpriteSetupBeam(&consts, start, end, diameter, eye);
+    }
+    else
+    {
+        random_view_axes(right, up);
+        width    = 8 + rand() % 120;
+        height   = 8 + rand() % 120;
+        origin_x = rand() % width;
+        origin_y = rand() % height;
+        VU1_SpriteSetupFrame(&consts, right, up, width, height, origin_x, origin_y);
+    }
+
+    ps2_vu_sprite_quad_t * quads = VU1_SpriteBeginBatch(vif_buffer, &consts);
+    const int num_quads = beam ? 1 : 1 + (batch % VU1_SPRITE_MAX_QUADS);
+
+    ps2_vu_sprite_quad_t input[VU1_SPRITE_MAX_QUADS];
+    for (n = 0; n < num_quads; ++n)
+    {
+        if (beam)
+        {
+            for (k = 0; k < 3; ++k)
+            {
+                input[n].pos[k] = (start[k] + end[k]) * 0.5f;
+            }
+            input[n].size = 1.0f;
+        }
+        else
+        {
+            // Mostly in view, some behind the near plane or out of the guard band.
+            input[n].pos[2] = (float)frand(-32.0, 3000.0);
+            input[n].pos[0] = (float)(frand(-1.1, 1.1) * input[n].pos[2] * (4096.0 / 640.0));
+            input[n].pos[1] = (float)(frand(-1.1, 1.1) * input[n].pos[2] * (4096.0 / 640.0));
+            input[n].size   = (n & 1) ? 1.0f : (float)frand(0.25, 4.0);
+        }
+        quads[n] = input[n];
+    }
+
+    const int vif_qw = VU1_SpriteEndBatch(vif_buffer, num_quads, (batch & 1));
+    if (vif_qw != VU1_SpriteBatchQWords(num_quads) || vif_qw > VU1_SPRITE_MAX_VIF_QW)
+    {
+        fprintf(stderr, "batch %d: stream is %d qwords, expected %d (max %d)\n", batch, vif_qw,
+                VU1_SpriteBatchQWords(num_quads), VU1_SPRITE_MAX_VIF_QW);
+        ++totals->errors;
+    }
+
+    memset(vu_mem, 0, sizeof(vu_mem));
+    if (!VU1_SpriteRunVIF(vu_mem, vif_buffer, vif_qw))
+    {
+        fprintf(stderr, "batch %d: VIF stream not understood\n", batch);
+        ++totals->errors;
+        return;
+    }
+
+    // Output tag, copied by the program:
+    const ps2_vu_qword_t * tag = &vu_mem[VU1_SPRITE_OUTPUT];
+    if ((int)(tag->u[0] & 0x7FFF) != num_quads * 4 || !(tag->u[0] & 0x8000))
+    {
+        fprintf(stderr, "batch %d: GIF tag NLOOP %u, expected %d with EOP\n", batch, tag->u[0] & 0x7FFF, num_quads * 4);
+        ++totals->errors;
+    }
+
+    const int output_end = VU1_SPRITE_OUTPUT + 1 + num_quads * VU1_SPRITE_QUAD_OUT_QW;
+    if (output_end > VU1_GUARD_CONSTS)
+    {
+        fprintf(stderr, "batch %d: output ends at %d, over the guard band constants\n", batch, output_end);
+        ++totals->errors;
+    }
+
+    for (n = 0; n < num_quads; ++n)
+    {
+        const ps2_vu_qword_t * out = &vu_mem[VU1_SPRITE_OUTPUT + 1 + n * VU1_SPRITE_QUAD_OUT_QW];
+
+        // The corners as ref_gl has them, in strip order: top-left, top-right, bottom-left, bottom-right.
+        double corners[4][3];
+        static const double corner_st[4][2] = { { 0, 0 }, { 1, 0 }, { 0, 1 }, { 1, 1 } };
+
+        for (k = 0; k < 3; ++k)
+        {
+            if (beam)
+            {
+                // Start at the left, end at the right.
+                corners[0][k] = start[k] + consts.up[k];
+                corners[1][k] = end[k]   + consts.up[k];
+                corners[2][k] = start[k] - consts.up[k];
+                corners[3][k] = end[k]   - consts.up[k];
+            }
+            else
+            {
+                const double p = input[n].pos[k];
+                const double s = input[n].size;
+                corners[0][k] = p + s * (up[k] * (height - origin_y) + right[k] * -origin_x);
+                corners[1][k] = p + s * (up[k] * (height - origin_y) + right[k] * (width - origin_x));
+                corners[2][k] = p + s * (up[k] * -origin_y + right[k] * -origin_x);
+                corners[3][k] = p + s * (up[k] * -origin_y + right[k] * (width - origin_x));
+            }
+        }
+
+        bool outside = false, on_plane = false;
+        double clip[4][4];
+        for (c = 0; c < 4; ++c)
+        {
+            on_plane |= project(&mvp, corners[c], clip[c], &outside);
+        }
+
+        totals->quads += 1;
+        totals->clipped_quads += outside ? 1 : 0;
+
+        // Strip starts, then the quad test:
+        if (!(out[2].i[3] & 0x8000) || !(out[5].i[3] & 0x8000))
+        {
+            fprintf(stderr, "batch %d, quad %d: strip start without ADC\n", batch, n);
+            ++totals->errors;
+        }
+        const bool adc = (out[8].i[3] & 0x8000) != 0;
+        if (adc != ((out[11].i[3] & 0x8000) != 0) || (adc != outside && !on_plane))
+        {
+            fprintf(stderr, "batch %d, quad %d: ADC %d, expected %d\n", batch, n, adc, outside);
+            ++totals->errors;
+        }
+
+        for (c = 0; c < 4; ++c)
+        {
+            if (memcmp(out[c * 3 + 1].i, color, sizeof(color)) != 0)
+            {
+                fprintf(stderr, "batch %d, quad %d: color changed\n", batch, n);
+                ++totals->errors;
+            }
+        }
+
+        if (outside)
+        {
+            continue; // Not drawn, and Q may be anything.
+        }
+
+        for (c = 0; c < 4; ++c)
+        {
+            check_corner(batch, n * 4 + c, &out[c * 3], clip[c], corner_st[c], totals);
+        }
+    }
+
+    // The beam side has to be across the beam and the view, half the diameter long.
+    if (beam)
+    {
+        double dir[3], to_eye[3], dot_dir = 0.0, dot_eye = 0.0, len = 0.0;
+        for (k = 0; k < 3; ++k)
+        {
+            dir[k]    = end[k] - start[k];
+            to_eye[k] = eye[k] - (start[k] + end[k]) * 0.5;
+            dot_dir  += dir[k] * consts.up[k];
+            dot_eye  += to_eye[k] * consts.up[k];
+            len      += (double)consts.up[k] * consts.up[k];
+        }
+        len = sqrt(len);
+
+        const double dir_len = sqrt(dir[0] * dir[0] + dir[1] * dir[1] + dir[2] * dir[2]);
+        const double eye_len = sqrt(to_eye[0] * to_eye[0] + to_eye[1] * to_eye[1] + to_eye[2] * to_eye[2]);
+        if (fabs(len - diameter * 0.5) > 1e-3 || fabs(dot_dir) > 1e-4 * dir_len * len ||
+            fabs(dot_eye) > 1e-4 * eye_len * len)
+        {
+            fprintf(stderr, "batch %d: beam side is off, length %f for a diameter of %f\n", batch, len, diameter);
+            ++totals->errors;
+        }
+    }
+}
+
+int main(int argc, const char * argv[])
+{
+    int i;
+    const int num_batches = (argc > 1) ? atoi(argv[1]) : DEFAULT_NUM_BATCHES;
+    srand((argc > 2) ? (unsigned)atoi(argv[2]) : 1234u);
+
+    totals_t totals;
+    memset(&totals, 0, sizeof(totals));
+
+    for (i = 0; i < num_batches; ++i)
+    {
+        check_batch(i, (i % 4) == 3, &totals);
+    }
+
+    printf("%d batches, %d quads (%d dropped by the clip test), %d corners checked\n",
+           num_batches, totals.quads, totals.clipped_quads, totals.corners);
+    printf("batch stream %d to %d qwords, output %d to %d qwords\n",
+           VU1_SpriteBatchQWords(1), VU1_SpriteBatchQWords(VU1_SPRITE_MAX_QUADS),
+           1 + VU1_SPRITE_QUAD_OUT_QW, 1 + VU1_SPRITE_MAX_QUADS * VU1_SPRITE_QUAD_OUT_QW);
+    printf("max position error %.3f (12:4 units), max Q error %.2e, max S/T error %.2e\n",
+           totals.max_pos_error, totals.max_q_error, totals.max_st_error);
+    printf("%d errors\n", totals.errors);
+
+    return (totals.errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,371 @@
+
+/*
+ * Command line tool that runs the C reference of the VU1 guard band
+ * clipping program (src/ps2/vu1_clip.c) over world batches captured
+ * in the game with 'r_ps2_vu_capture 1' (<gamedir>/vubatches.bin).
+ *
+ * Every batch is checked for:
+ *  - a GIF packet that ends where the program says it does and stays
+ *    below the clipper scratch memory;
+ *  - fans of 3 to VU1_GUARD_MAX_POLY vertexes, with the ADC bit clear,
+ *    X/Y inside the 4096x4096 guard band and Z in the 24 bits range;
+ *  - vertex counts and positions matching the same clipping done
+ *    independently here in double precision.
+ *
+ * Prints how many triangles the old whole triangle rejection would have
+ * drawn against what the clipper draws. Exits with a failure status if
+ * any check fails.
+ *
+ * Build with:
+ * cc -I.. vuclip.c ../ps2/vu1_clip.c -lm -o vuclip
+ * ./vuclip vubatches.bin [-v]
+ */
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "ps2/vu1_clip.h"
+
+// Largest distance, in 12:4 units, allowed from the double precision result.
+// VU floats round differently, so a couple pixels right at the near plane.
+#define POSITION_TOLERANCE 32.0
+
+// Input batches never have more than this (MAX_VERTS_PER_VU_BATCH in view_draw.c).
+#define MAX_BATCH_VERTS (VU1_GUARD_MAX_TRIS * 3)
+
+static ps2_vu_qword_t vu_mem[VU1_MEM_QWORDS];
+static bool verbose = false;
+
+typedef struct
+{
+    int batches;
+    int failed_batches;
+    int errors;
+    int old_tris_drawn;
+    int new_polys_drawn;
+    int out_qwords;
+    double max_position_error;
+    vu1_guard_stats_t sums;
+} totals_t;
+
+/*
+ * Double precision clipper, same planes, same order:
+ */
+
+typedef struct
+{
+    double pos[4];
+} dvert_t;
+
+static int clip_triangle(dvert_t poly[VU1_GUARD_MAX_POLY * 2 + 1], const m_vec4_t * planes)
+{
+    int p, i, j, n = 3;
+    dvert_t tmp[VU1_GUARD_MAX_POLY * 2 + 1];
+
+    for (p = 0; p < VU1_GUARD_NUM_PLANES; ++p)
+    {
+        double d[VU1_GUARD_MAX_POLY * 2 + 1];
+        int num_out = 0;
+        for (i = 0; i < n; ++i)
+        {
+            d[i] = planes[p].x * poly[i].pos[0] + planes[p].y * poly[i].pos[1] +
+                   planes[p].z * poly[i].pos[2] + planes[p].w * poly[i].pos[3];
+            num_out += (d[i] < 0.0) ? 1 : 0;
+        }
+        if (num_out == 0)
+        {
+            continue;
+        }
+        if (num_out == n)
+        {
+            return 0;
+        }
+
+        int num_dst = 0;
+        for (i = 0; i < n; ++i)
+        {
+            const int k = (i + 1) % n;
+            if (d[i] >= 0.0)
+            {
+                tmp[num_dst++] = poly[i];
+            }
+            if ((d[i] < 0.0) != (d[k] < 0.0))
+            {
+                const double t = d[i] / (d[i] - d[k]);
+                for (j = 0; j < 4; ++j)
+                {
+                    tmp[num_dst].pos[j] = poly[i].pos[j] + (poly[k].pos[j] - poly[i].pos[j]) * t;
+                }
+                ++num_dst;
+            }
+        }
+
+        n = num_dst;
+        if (n > VU1_GUARD_MAX_POLY)
+        {
+            return 0;
+        }
+        memcpy(poly, tmp, n * sizeof(dvert_t));
+    }
+
+    return n;
+}
+
+static void project(double out[3], const double pos[4], const float * scales)
+{
+    int j;
+    for (j = 0; j < 3; ++j)
+    {
+        out[j] = (scales[j] + pos[j] / pos[3] * scales[j]) * 16.0;
+    }
+}
+
+/*
+ * Batch checks:
+ */
+
+static int check_batch(int batch, int num_qw, totals_t * totals)
+{
+    int t, v, j;
+    int errors = 0;
+    vu1_guard_stats_t stats;
+    m_vec4_t planes[VU1_GUARD_NUM_CONSTS];
+
+    const int num_verts = vu_mem[4].i[3];
+    if (num_verts < 0 || num_verts > MAX_BATCH_VERTS || (num_verts % 3) != 0 ||
+        num_qw != VU1_GUARD_FIRST_VERT + num_verts * 2)
+    {
+        fprintf(stderr, "batch %d: bad vertex count %d for %d qwords\n", batch, num_verts, num_qw);
+        return 1;
+    }
+
+    VU1_GuardSetupConsts(planes);
+    memcpy(&vu_mem[VU1_GUARD_CONSTS], planes, sizeof(planes));
+
+    // Keep a copy of the input, the VU program doesn't touch it but check anyway.
+    static ps2_vu_qword_t input[VU1_GUARD_FIRST_VERT + MAX_BATCH_VERTS * 2];
+    memcpy(input, vu_mem, num_qw * sizeof(ps2_vu_qword_t));
+
+    VU1_GuardClipReference(vu_mem, &stats);
+
+    if (memcmp(input, vu_mem, num_qw * sizeof(ps2_vu_qword_t)) != 0)
+    {
+        fprintf(stderr, "batch %d: input overwritten\n", batch);
+        ++errors;
+    }
+
+    // Walk the GIF packet and the double precision clipper side by side.
+    const ps2_vu_qword_t * mvp = &input[0];
+    const float * scales = input[4].f;
+    const ps2_vu_qword_t * out = &vu_mem[VU1_GUARD_OUTPUT];
+    int polys = 0, verts = 0;
+
+    for (t = 0; t < num_verts / 3 && errors < 10; ++t)
+    {
+        dvert_t poly[VU1_GUARD_MAX_POLY * 2 + 1];
+        bool outside = false, all_far = true, all_near = true;
+
+        for (v = 0; v < 3; ++v)
+        {
+            const float * p = input[VU1_GUARD_FIRST_VERT + t * 6 + v * 2 + 1].f;
+            for (j = 0; j < 4; ++j)
+            {
+                poly[v].pos[j] = (double)mvp[0].f[j] * p[0] + (double)mvp[1].f[j] * p[1] +
+                                 (double)mvp[2].f[j] * p[2] + (double)mvp[3].f[j] * p[3];
+            }
+
+            const double w = fabs(poly[v].pos[3]);
+            for (j = 0; j < 3; ++j)
+            {
+                outside |= (poly[v].pos[j] > w || poly[v].pos[j] < -w);
+            }
+            all_far  &= (poly[v].pos[2] < -w);
+            all_near &= (poly[v].pos[2] > w);
+        }
+
+        if (all_far || all_near)
+        {
+            continue;
+        }
+
+        const int n = outside ? clip_triangle(poly, planes) : 3;
+        if (n == 0)
+        {
+            continue;
+        }
+
+        const int nloop = out->u[0] & 0x7FFF;
+        if ((out->u[0] & 0x8000) || nloop != n)
+        {
+            fprintf(stderr, "batch %d, tri %d: fan of %d, expected %d\n", batch, t, nloop, n);
+            ++errors;
+            break;
+        }
+        if (out->u[1] != input[VU1_GUARD_GIF_TAG].u[1] ||
+            out->u[2] != input[VU1_GUARD_GIF_TAG].u[2] ||
+            out->u[3] != input[VU1_GUARD_GIF_TAG].u[3])
+        {
+            fprintf(stderr, "batch %d, tri %d: tag doesn't match the template\n", batch, t);
+            ++errors;
+        }
+        ++out;
+
+        for (v = 0; v < n; ++v, out += 2)
+        {
+            const ps2_vu_qword_t * xyz = &out[1];
+            if (xyz->i[0] < 0 || xyz->i[0] > 0xFFFF || xyz->i[1] < 0 || xyz->i[1] > 0xFFFF ||
+                xyz->i[2] < 0 || xyz->i[2] > 0xFFFFFF || xyz->i[3] != 0)
+            {
+                fprintf(stderr, "batch %d, tri %d: vertex %d out of range (%d %d %d %d)\n",
+                        batch, t, v, xyz->i[0], xyz->i[1], xyz->i[2], xyz->i[3]);
+                ++errors;
+            }
+            for (j = 0; j < 4; ++j)
+            {
+                if (out[0].i[j] < 0 || out[0].i[j] > 255)
+                {
+                    fprintf(stderr, "batch %d, tri %d: vertex %d bad color\n", batch, t, v);
+                    ++errors;
+                    break;
+                }
+            }
+
+            // Z is clamped by the program, only X/Y are compared.
+            double expected[3];
+            project(expected, poly[v].pos, scales);
+            for (j = 0; j < 2; ++j)
+            {
+                const double e = fabs(expected[j] - xyz->i[j]);
+                if (e > totals->max_position_error)
+                {
+                    totals->max_position_error = e;
+                }
+                if (e > POSITION_TOLERANCE)
+                {
+                    fprintf(stderr, "batch %d, tri %d: vertex %d at %d, expected %.2f\n",
+                            batch, t, v, xyz->i[j], expected[j]);
+                    ++errors;
+                }
+            }
+        }
+
+        ++polys;
+        verts += n;
+    }
+
+    if (errors == 0)
+    {
+        const int used_qw = out - &vu_mem[VU1_GUARD_OUTPUT] + 1;
+        if ((out->u[0] & 0xFFFF) != 0x8000)
+        {
+            fprintf(stderr, "batch %d: packet not closed by an EOP tag\n", batch);
+            ++errors;
+        }
+        if (polys != stats.polys_out || verts != stats.verts_out || used_qw != stats.qwords_out)
+        {
+            fprintf(stderr, "batch %d: stats %d/%d/%d, counted %d/%d/%d\n", batch, stats.polys_out,
+                    stats.verts_out, stats.qwords_out, polys, verts, used_qw);
+            ++errors;
+        }
+        if (VU1_GUARD_OUTPUT + used_qw > VU1_GUARD_POLY_A)
+        {
+            fprintf(stderr, "batch %d: output runs into the scratch polygons\n", batch);
+            ++errors;
+        }
+    }
+
+    if (verbose)
+    {
+        printf("batch %4d: %2d tris, %2d accepted, %2d rejected, %2d clipped (%d culled), "
+               "%2d fans, %3d verts, %3d qw\n", batch, stats.tris_in, stats.tris_accepted,
+               stats.tris_rejected, stats.tris_clipped, stats.tris_culled, stats.polys_out,
+               stats.verts_out, stats.qwords_out);
+    }
+
+    totals->sums.tris_in       += stats.tris_in;
+    totals->sums.tris_accepted += stats.tris_accepted;
+    totals->sums.tris_rejected += stats.tris_rejected;
+    totals->sums.tris_clipped  += stats.tris_clipped;
+    totals->sums.tris_culled   += stats.tris_culled;
+    totals->sums.verts_out     += stats.verts_out;
+    totals->old_tris_drawn     += stats.tris_accepted; // Nothing outside, same CLIP test
+    totals->new_polys_drawn    += stats.polys_out;
+    totals->out_qwords         += stats.qwords_out;
+    return errors;
+}
+
+int main(int argc, const char * argv[])
+{
+    if (argc <= 1)
+    {
+        fprintf(stderr, "No filename!\n");
+        printf("Usage: \n"
+               " $ %s <vubatches.bin> [-v]\n"
+               "   Runs the VU1 guard band clipper reference over the captured batches.\n"
+               "   -v prints the stats of each batch.\n",
+               argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    verbose = (argc > 2 && strcmp(argv[2], "-v") == 0);
+
+    FILE * file = fopen(argv[1], "rb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Can't fopen() the file! %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    int header[2];
+    if (fread(header, sizeof(header), 1, file) != 1 ||
+        header[0] != VU1_GUARD_CAPTURE_MAGIC || header[1] != VU1_GUARD_CAPTURE_VERSION)
+    {
+        fprintf(stderr, "Bad file id or version for %s!\n", argv[1]);
+        fclose(file);
+        return EXIT_FAILURE;
+    }
+
+    totals_t totals;
+    memset(&totals, 0, sizeof(totals));
+
+    int num_qw;
+    while (fread(&num_qw, sizeof(num_qw), 1, file) == 1)
+    {
+        if (num_qw < VU1_GUARD_FIRST_VERT || num_qw > VU1_GUARD_FIRST_VERT + MAX_BATCH_VERTS * 2)
+        {
+            fprintf(stderr, "batch %d: bad size %d\n", totals.batches, num_qw);
+            ++totals.errors;
+            break;
+        }
+
+        memset(vu_mem, 0xCD, sizeof(vu_mem));
+        if (fread(vu_mem, sizeof(ps2_vu_qword_t), num_qw, file) != (size_t)num_qw)
+        {
+            fprintf(stderr, "batch %d: truncated\n", totals.batches);
+            ++totals.errors;
+            break;
+        }
+
+        const int errors = check_batch(totals.batches, num_qw, &totals);
+        if (errors != 0)
+        {
+            ++totals.failed_batches;
+            totals.errors += errors;
+        }
+        ++totals.batches;
+    }
+    fclose(file);
+
+    printf("%d batches, %d triangles: %d accepted, %d rejected, %d clipped (%d culled)\n",
+           totals.batches, totals.sums.tris_in, totals.sums.tris_accepted, totals.sums.tris_rejected,
+           totals.sums.tris_clipped, totals.sums.tris_culled);
+    printf("whole triangle rejection draws %d, guard band clipping draws %d fans (%d verts, %d qw)\n",
+           totals.old_tris_drawn, totals.new_polys_drawn, totals.sums.verts_out, totals.out_qwords);
+    printf("max position error %.3f (12:4 units), %d errors in %d batches\n",
+           totals.max_position_error, totals.errors, totals.failed_batches);
+
+    return (totals.errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,299 @@
+
+/*
+ * Command line check of the VU1 warp program C reference
+ * (src/ps2/vu1_warp.c) against ref_gl's EmitWaterPolys.
+ *
+ * Builds batches of random triangles with the same packet builder the
+ * renderer uses, runs them through VU1_WarpRunVIF and checks every vertex:
+ *  - the warped S/T against the r_turbsin table math of ref_gl, with and
+ *    without SURF_FLOWING scrolling, and the plain S/T when not warping;
+ *  - Q and the 12:4 position against the projection done here in double
+ *    precision;
+ *  - the ADC bit, set on whole triangles with a vertex out of the clip volume.
+ *
+ * Prints the largest differences and exits with a failure status if any
+ * goes over the tolerances below.
+ *
+ * Build with:
+ * cc -I.. warpref.c ../ps2/vu1_warp.c -lm -o warpref
+ * ./warpref [num_batches] [seed]
+ */
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "ps2/vu1_warp.h"
+
+#define DEFAULT_NUM_BATCHES 2000
+
+// Largest S/T difference from the table, in texels. The polynomial alone is
+// under 0.004 texels at the ends of the range, the rest is float rounding.
+#define ST_TOLERANCE 0.01
+
+// Largest position difference, in 12:4 units, and relative Q difference.
+#define POSITION_TOLERANCE 2.0
+#define Q_TOLERANCE 1e-4
+
+static ps2_vu_qword_t vu_mem[VU1_MEM_QWORDS];
+static u32 vif_buffer[VU1_WARP_MAX_VIF_QW * 4] __attribute__((aligned(16)));
+
+/*
+ * ref_gl's EmitWaterPolys, with the r_turbsin table (warpsin.h)
+ * being sin() of the 256 steps times 8. Float math, as the PS2 has.
+ */
+
+#define TURBSCALE (256.0f / (2.0f * 3.14159265358979323846f))
+static float r_turbsin[256];
+
+static void ref_turb_st(float os, float ot, float rdt, float scroll, float * s, float * t)
+{
+    *s = os + r_turbsin[(int)((ot * 0.125f + rdt) * TURBSCALE) & 255];
+    *s += scroll;
+    *s *= (1.0f / 64.0f);
+
+    *t = ot + r_turbsin[(int)((os * 0.125f + rdt) * TURBSCALE) & 255];
+    *t *= (1.0f / 64.0f);
+}
+
+static float frand(float lo, float hi)
+{
+    return lo + (hi - lo) * ((float)rand() / (float)RAND_MAX);
+}
+
+// Row-vector perspective like Mat4_MakePerspProjection, clip X/Y
+// range of the 4096x4096 guard band, Z = W at the near plane.
+static void make_mvp(m_mat4_t * m)
+{
+    const float z_near = 4.0f;
+    const float z_far  = 4096.0f;
+    const float guard  = 4096.0f / 640.0f;
+
+    memset(m, 0, sizeof(*m));
+    m->m[0][0] = 1.0f / guard;
+    m->m[1][1] = 1.0f / guard;
+    m->m[2][2] = (z_far + z_near) / (z_far - z_near);
+    m->m[2][3] = 1.0f;
+    m->m[3][2] = -2.0f * z_far * z_near / (z_far - z_near);
+}
+
+typedef struct
+{
+    int vertexes;
+    int triangles;
+    int clipped_tris;
+    int errors;
+    double max_st_error;
+    double max_pos_error;
+    double max_q_error;
+} totals_t;
+
+static void check_batch(int batch, int mode, totals_t * totals)
+{
+    int i, j;
+    m_mat4_t mvp;
+    make_mvp(&mvp);
+
+    // mode 0: warp, mode 1: warp + flowing, mode 2: plain textured.
+    const float rdt    = frand(0.0f, 3600.0f);
+    const float scroll = (mode == 1) ? -64.0f * ((rdt * 0.5f) - (int)(rdt * 0.5f)) : 0.0f;
+    const bool  warp   = (mode != 2);
+
+    ps2_vu_warp_consts_t consts;
+    VU1_WarpSetupConsts(&consts, &mvp, rdt, scroll,
+                        warp ? VU1_WARP_AMPLITUDE : 0.0f,
+                        warp ? VU1_WARP_ST_SCALE : 1.0f, (mode == 2));
+
+    ps2_vu_warp_vert_t * verts = VU1_WarpBeginBatch(vif_buffer, &consts);
+    const int num_tris  = 1 + rand() % VU1_WARP_MAX_TRIS;
+    const int num_verts = num_tris * 3;
+
+    ps2_vu_warp_vert_t input[VU1_WARP_MAX_VERTS];
+    for (i = 0; i < num_verts; ++i)
+    {
+        // Mostly in view, some behind the near plane or out of the guard band.
+        input[i].st[0]    = warp ? frand(-8192.0f, 8192.0f) : frand(-16.0f, 16.0f);
+        input[i].st[1]    = warp ? frand(-8192.0f, 8192.0f) : frand(-16.0f, 16.0f);
+        input[i].st[2]    = 0.0f;
+        input[i].st[3]    = 0.0f;
+        input[i].color[0] = 128;
+        input[i].color[1] = 128;
+        input[i].color[2] = 128;
+        input[i].color[3] = (mode == 2) ? 84 : 128;
+        input[i].pos[2]   = frand(-8.0f, 3000.0f);
+        input[i].pos[0]   = frand(-1.05f, 1.05f) * input[i].pos[2] * (4096.0f / 640.0f);
+        input[i].pos[1]   = frand(-1.05f, 1.05f) * input[i].pos[2] * (4096.0f / 640.0f);
+        input[i].pos[3]   = 1.0f;
+        verts[i] = input[i];
+    }
+
+    const int vif_qw = VU1_WarpEndBatch(vif_buffer, num_verts, (batch & 1));
+
+    memset(vu_mem, 0, sizeof(vu_mem));
+    if (!VU1_WarpRunVIF(vu_mem, vif_buffer, vif_qw))
+    {
+        fprintf(stderr, "batch %d: VIF stream not understood\n", batch);
+        ++totals->errors;
+        return;
+    }
+
+    const ps2_vu_qword_t * tag = &vu_mem[VU1_WARP_GIF_TAG];
+    if ((int)(tag->u[0] & 0x7FFF) != num_verts || !(tag->u[0] & 0x8000))
+    {
+        fprintf(stderr, "batch %d: GIF tag NLOOP %u, expected %d with EOP\n", batch, tag->u[0] & 0x7FFF, num_verts);
+        ++totals->errors;
+    }
+
+    for (i = 0; i < num_verts; i += 3)
+    {
+        bool outside = false;
+        double clip[3][4];
+
+        for (j = 0; j < 3; ++j)
+        {
+            const float * p = input[i + j].pos;
+            int k;
+            for (k = 0; k < 4; ++k)
+            {
+                clip[j][k] = (double)mvp.m[0][k] * p[0] + (double)mvp.m[1][k] * p[1] +
+                             (double)mvp.m[2][k] * p[2] + (double)mvp.m[3][k] * p[3];
+            }
+            const double w = fabs(clip[j][3]);
+            for (k = 0; k < 3; ++k)
+            {
+                outside |= (clip[j][k] > w || clip[j][k] < -w);
+            }
+        }
+
+        totals->triangles    += 1;
+        totals->clipped_tris += outside ? 1 : 0;
+
+        for (j = 0; j < 3; ++j)
+        {
+            const int v = i + j;
+            const ps2_vu_qword_t * st  = &vu_mem[VU1_WARP_START_VERT + v * VU1_WARP_VERT_QW];
+            const ps2_vu_qword_t * rgb = st + 1;
+            const ps2_vu_qword_t * xyz = st + 2;
+
+            const bool adc = (xyz->i[3] & 0x8000) != 0;
+            if (adc != outside)
+            {
+                // Right on the planes float and double can disagree.
+                bool on_plane = false;
+                int p, k;
+                for (p = 0; p < 3; ++p)
+                {
+                    for (k = 0; k < 3; ++k)
+                    {
+                        on_plane |= fabs(fabs(clip[p][k]) - fabs(clip[p][3])) < 1e-3;
+                    }
+                }
+                if (!on_plane)
+                {
+                    fprintf(stderr, "batch %d, vertex %d: ADC %d, expected %d\n", batch, v, adc, outside);
+                    ++totals->errors;
+                }
+            }
+
+            if (memcmp(rgb->i, input[v].color, sizeof(input[v].color)) != 0)
+            {
+                fprintf(stderr, "batch %d, vertex %d: color changed\n", batch, v);
+                ++totals->errors;
+            }
+
+            if (outside)
+            {
+                continue; // Not drawn, and Q may be anything.
+            }
+
+            // Q and the position:
+            const double q = 1.0 / clip[j][3];
+            const double q_error = fabs(st->f[2] - q) / q;
+            if (q_error > totals->max_q_error)
+            {
+                totals->max_q_error = q_error;
+            }
+            if (q_error > Q_TOLERANCE)
+            {
+                fprintf(stderr, "batch %d, vertex %d: Q %g, expected %g\n", batch, v, st->f[2], q);
+                ++totals->errors;
+            }
+
+            const double scales[3] = { 2048.0, 2048.0, (double)0xFFFFFF / 32.0 };
+            int k;
+            for (k = 0; k < 2; ++k)
+            {
+                const double expected = (scales[k] + clip[j][k] * q * scales[k]) * 16.0;
+                const double error = fabs(xyz->i[k] - expected);
+                if (error > totals->max_pos_error)
+                {
+                    totals->max_pos_error = error;
+                }
+                if (error > POSITION_TOLERANCE)
+                {
+                    fprintf(stderr, "batch %d, vertex %d: %c at %d, expected %.2f\n", batch, v, "XY"[k], xyz->i[k], expected);
+                    ++totals->errors;
+                }
+            }
+
+            // S/T, in texels:
+            float s_ref, t_ref;
+            if (warp)
+            {
+                ref_turb_st(input[v].st[0], input[v].st[1], rdt, scroll, &s_ref, &t_ref);
+            }
+            else
+            {
+                s_ref = input[v].st[0];
+                t_ref = input[v].st[1];
+            }
+
+            const double texels = warp ? 64.0 : 1.0;
+            const double s_error = fabs(st->f[0] / st->f[2] - s_ref) * texels;
+            const double t_error = fabs(st->f[1] / st->f[2] - t_ref) * texels;
+            const double st_error = (s_error > t_error) ? s_error : t_error;
+            if (st_error > totals->max_st_error)
+            {
+                totals->max_st_error = st_error;
+            }
+            if (st_error > ST_TOLERANCE)
+            {
+                fprintf(stderr, "batch %d, vertex %d: ST %f %f, expected %f %f\n", batch, v,
+                        st->f[0] / st->f[2], st->f[1] / st->f[2], s_ref, t_ref);
+                ++totals->errors;
+            }
+
+            ++totals->vertexes;
+        }
+    }
+}
+
+int main(int argc, const char * argv[])
+{
+    int i;
+    const int num_batches = (argc > 1) ? atoi(argv[1]) : DEFAULT_NUM_BATCHES;
+    srand((argc > 2) ? (unsigned)atoi(argv[2]) : 1234u);
+
+    for (i = 0; i < 256; ++i)
+    {
+        r_turbsin[i] = (float)(sin(i * 2.0 * 3.14159265358979323846 / 256.0) * 8.0);
+    }
+
+    totals_t totals;
+    memset(&totals, 0, sizeof(totals));
+
+    for (i = 0; i < num_batches; ++i)
+    {
+        check_batch(i, i % 3, &totals);
+    }
+
+    printf("%d batches, %d triangles (%d dropped by the clip test), %d vertexes checked\n",
+           num_batches, totals.triangles, totals.clipped_tris, totals.vertexes);
+    printf("max S/T error %.5f texels, max position error %.3f (12:4 units), max Q error %.2e\n",
+           totals.max_st_error, totals.max_pos_error, totals.max_q_error);
+    printf("%d errors\n", totals.errors);
+
+    return (totals.errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}